@@ -82,4 +82,5 @@ man_pages = [
     ('manuals/roc_send', 'roc-send', u'send real-time audio', [], 1),
     ('manuals/roc_recv', 'roc-recv', u'receive real-time audio', [], 1),
     ('manuals/roc_conv', 'roc-conv', u'convert audio', [], 1),
+    ('manuals/roc_replay', 'roc-replay', u'replay captured traffic', [], 1),
 ]
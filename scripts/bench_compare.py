@@ -0,0 +1,184 @@
+#! /usr/bin/env python3
+#
+# usage:
+# scons -Q --enable-benchmarks --bench-dir=build/bench_baseline ... bench
+# scons -Q --enable-benchmarks ... bench
+# ./scripts/bench_compare.py build/bench_baseline build/bench
+#
+# Compares Google Benchmark JSON results against baseline. Each argument is
+# either a JSON file or a directory with one JSON file per module, as written
+# by 'bench' target. Exits with non-zero code if any benchmark is slower than
+# its baseline by more than the threshold.
+#
+import argparse
+import json
+import os
+import os.path
+import re
+import sys
+
+TIME_UNITS = {
+    'ns': 1.0,
+    'us': 1e3,
+    'ms': 1e6,
+    's':  1e9,
+}
+
+# context fields that should match for results to be comparable
+CONTEXT_FIELDS = [
+    'host_name',
+    'num_cpus',
+    'mhz_per_cpu',
+    'library_build_type',
+]
+
+def load_file(path, metric):
+    with open(path) as fp:
+        report = json.load(fp)
+
+    results = {}
+    medians = {}
+
+    for bench in report.get('benchmarks', []):
+        if bench.get('error_occurred'):
+            continue
+
+        if metric not in bench:
+            continue
+
+        value = bench[metric] * TIME_UNITS[bench.get('time_unit', 'ns')]
+
+        if bench.get('run_type') == 'aggregate':
+            # with repetitions, median is the most stable estimate
+            if bench.get('aggregate_name') == 'median':
+                medians[bench['run_name']] = value
+            continue
+
+        name = bench.get('run_name', bench['name'])
+
+        # without aggregates, average repetitions
+        results.setdefault(name, []).append(value)
+
+    for name in results:
+        results[name] = sum(results[name]) / len(results[name])
+
+    results.update(medians)
+
+    return report.get('context', {}), results
+
+def load_path(path, metric):
+    if os.path.isdir(path):
+        files = sorted(f for f in os.listdir(path) if f.endswith('.json'))
+    else:
+        files = [os.path.basename(path)]
+        path = os.path.dirname(path)
+
+    reports = {}
+    for f in files:
+        reports[f] = load_file(os.path.join(path, f), metric)
+
+    return reports
+
+def format_time(ns):
+    for unit in ['s', 'ms', 'us']:
+        if ns >= TIME_UNITS[unit]:
+            return '{:.3f}{}'.format(ns / TIME_UNITS[unit], unit)
+    return '{:.1f}ns'.format(ns)
+
+def check_context(module, base_ctx, curr_ctx):
+    for field in CONTEXT_FIELDS:
+        if base_ctx.get(field) != curr_ctx.get(field):
+            print("warning: {}: {} differs: baseline '{}', current '{}',"
+                  " results may be not comparable".format(
+                      module, field, base_ctx.get(field), curr_ctx.get(field)),
+                  file=sys.stderr)
+
+parser = argparse.ArgumentParser(
+    description='compare benchmark results against baseline')
+parser.add_argument('baseline',
+                    help='baseline JSON file or directory')
+parser.add_argument('current',
+                    help='current JSON file or directory')
+parser.add_argument('-t', '--threshold', type=float, default=10,
+                    help='allowed slowdown in percents (default: %(default)s)')
+parser.add_argument('-m', '--metric', choices=['cpu_time', 'real_time'],
+                    default='cpu_time',
+                    help='compared metric (default: %(default)s)')
+parser.add_argument('-f', '--filter', default='',
+                    help='regex to select benchmarks (default: all)')
+parser.add_argument('-a', '--all', action='store_true',
+                    help='print all benchmarks, not only changed ones')
+
+args = parser.parse_args()
+
+baseline = load_path(args.baseline, args.metric)
+current = load_path(args.current, args.metric)
+
+if len(baseline) == 1 and len(current) == 1:
+    # two files with possibly different names
+    baseline = {'': list(baseline.values())[0]}
+    current = {'': list(current.values())[0]}
+
+filter_re = re.compile(args.filter)
+
+n_total = 0
+n_regressions = 0
+n_improvements = 0
+n_missing = 0
+
+for module in sorted(set(baseline) | set(current)):
+    prefix = module[:-len('.json')] + ': ' if module else ''
+
+    if module not in current:
+        print('{}missing from current results'.format(prefix))
+        n_missing += 1
+        continue
+
+    if module not in baseline:
+        print('{}no baseline'.format(prefix))
+        continue
+
+    base_ctx, base_results = baseline[module]
+    curr_ctx, curr_results = current[module]
+
+    check_context(module or args.current, base_ctx, curr_ctx)
+
+    for name in sorted(set(base_results) | set(curr_results)):
+        if not filter_re.search(name):
+            continue
+
+        if name not in curr_results:
+            print('{}{}: missing from current results'.format(prefix, name))
+            n_missing += 1
+            continue
+
+        if name not in base_results:
+            print('{}{}: no baseline'.format(prefix, name))
+            continue
+
+        base = base_results[name]
+        curr = curr_results[name]
+
+        n_total += 1
+
+        change = (curr - base) / base * 100 if base > 0 else 0
+
+        if change > args.threshold:
+            status = 'REGRESSION'
+            n_regressions += 1
+        elif change < -args.threshold:
+            status = 'improvement'
+            n_improvements += 1
+        elif args.all:
+            status = 'ok'
+        else:
+            continue
+
+        print('{}{}: {} -> {} ({:+.1f}%) {}'.format(
+            prefix, name, format_time(base), format_time(curr), change, status))
+
+print('compared {} benchmarks: {} regressions, {} improvements, {} missing'.format(
+    n_total, n_regressions, n_improvements, n_missing))
+
+if n_regressions != 0:
+    exit(1)
@@ -23,7 +23,13 @@ def _run_with_timeout(env, cmd, timeout):
         timeout,
         cmd)
 
-def _add_test(env, kind, name, exe, cmd, timeout):
+def _make_dir(path):
+    def action(target, source, env):
+        if not os.path.isdir(path):
+            os.makedirs(path)
+    return action
+
+def _add_test(env, kind, name, exe, cmd, timeout, json_file=None):
     varname = '_{}_TARGETS'.format(kind.upper())
     testname = '{}/{}'.format(kind, name)
 
@@ -33,11 +39,20 @@ def _add_test(env, kind, name, exe, cmd, timeout):
     if not cmd:
         cmd = env.File(exe).path
 
+    if json_file:
+        cmd = '{} --benchmark_out={} --benchmark_out_format=json'.format(cmd, json_file)
+
     if timeout is not None:
         cmd = _run_with_timeout(env, cmd, timeout)
 
     comstr = env.PrettyCommand(kind.upper(), name, 'green' if kind == 'test' else 'cyan')
-    target = env.Alias(testname, [], env.Action(cmd, comstr))
+
+    actions = [env.Action(cmd, comstr)]
+    if json_file:
+        # Google Benchmark doesn't create missing directories.
+        actions.insert(0, env.Action(_make_dir(os.path.dirname(json_file)), None))
+
+    target = env.Alias(testname, [], actions)
 
     # This target produces no files.
     env.AlwaysBuild(target)
@@ -70,8 +85,8 @@ def _add_test(env, kind, name, exe, cmd, timeout):
 def AddTest(env, name, exe, cmd=None, timeout=5*60):
     _add_test(env, 'test', name, exe, cmd, timeout)
 
-def AddBench(env, name, exe, cmd=None, timeout=None):
-    _add_test(env, 'bench', name, exe, cmd, timeout)
+def AddBench(env, name, exe, cmd=None, timeout=None, json_file=None):
+    _add_test(env, 'bench', name, exe, cmd, timeout, json_file)
 
 def init(env):
     env['_TEST_TARGETS'] = []
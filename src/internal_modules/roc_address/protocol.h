@@ -38,6 +38,12 @@ enum Protocol {
     //! FEC repair packet + FECFRAME LDPC header.
     Proto_LDPC_Repair,
 
+    //! RTP source packet + FECFRAME sliding window RLC footer.
+    Proto_RTP_RLC_Source,
+
+    //! FEC repair packet + FECFRAME sliding window RLC header.
+    Proto_RLC_Repair,
+
     //! RTCP.
     Proto_RTCP
 };
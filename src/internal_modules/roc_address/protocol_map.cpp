@@ -73,6 +73,26 @@ ProtocolMap::ProtocolMap() {
         attrs.fec_scheme = packet::FEC_LDPC_Staircase;
         add_proto_(attrs);
     }
+    {
+        ProtocolAttrs attrs;
+        attrs.protocol = Proto_RTP_RLC_Source;
+        attrs.iface = Iface_AudioSource;
+        attrs.scheme_name = "rtp+rlc";
+        attrs.path_supported = false;
+        attrs.default_port = -1;
+        attrs.fec_scheme = packet::FEC_RLC;
+        add_proto_(attrs);
+    }
+    {
+        ProtocolAttrs attrs;
+        attrs.protocol = Proto_RLC_Repair;
+        attrs.iface = Iface_AudioRepair;
+        attrs.scheme_name = "rlc";
+        attrs.path_supported = false;
+        attrs.default_port = -1;
+        attrs.fec_scheme = packet::FEC_RLC;
+        add_proto_(attrs);
+    }
     {
         ProtocolAttrs attrs;
         attrs.protocol = Proto_RTCP;
@@ -16,6 +16,7 @@
 #include <sys/socket.h>
 
 #include "roc_address/addr_family.h"
+#include "roc_core/hashsum.h"
 #include "roc_core/stddefs.h"
 
 namespace roc {
@@ -72,6 +73,11 @@ public:
     //! Compare addresses.
     bool operator!=(const SocketAddr& other) const;
 
+    //! Compute address hash.
+    //! @remarks
+    //!  Equal addresses have equal hashes.
+    core::hashsum_t hash() const;
+
     enum {
         // An estimate maximum length of a string representation of an address.
         MaxStrLen = 196
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/channel_layout.h
+//! @brief Channel layout.
+
+#ifndef ROC_AUDIO_CHANNEL_LAYOUT_H_
+#define ROC_AUDIO_CHANNEL_LAYOUT_H_
+
+namespace roc {
+namespace audio {
+
+//! Channel positions.
+//! @remarks
+//!  Bit N of channel mask corresponds to channel position N.
+enum ChannelPosition {
+    //! Front left (also used for mono).
+    ChannelPos_FrontLeft = 0,
+
+    //! Front right.
+    ChannelPos_FrontRight = 1,
+
+    //! Front center.
+    ChannelPos_FrontCenter = 2,
+
+    //! Low frequency effects.
+    ChannelPos_LowFrequency = 3,
+
+    //! Back (surround) left.
+    ChannelPos_BackLeft = 4,
+
+    //! Back (surround) right.
+    ChannelPos_BackRight = 5,
+
+    //! Number of positions.
+    ChannelPos_Max = 64
+};
+
+//! Channel mixing modes.
+enum ChannelMixing {
+    //! Copy channels present in both input and output, zero other channels.
+    ChannelMixing_None,
+
+    //! Downmix or upmix using ITU-R BS.775 coefficients.
+    //! Output is normalized to prevent clipping.
+    ChannelMixing_Itu
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_CHANNEL_LAYOUT_H_
@@ -8,17 +8,112 @@
 
 #include "roc_audio/channel_mapper.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
 
 namespace roc {
 namespace audio {
 
+namespace {
+
+// -3dB gain.
+const sample_t Gain3dB = 0.7071068f;
+
+// Minimum average length of runs to prefer them over per-channel mapping.
+const size_t MinRunLength = 4;
+
+bool has_pos(packet::channel_mask_t mask, size_t pos) {
+    return (mask & ((packet::channel_mask_t)1 << pos)) != 0;
+}
+
+size_t lowest_pos(packet::channel_mask_t mask) {
+    size_t pos = 0;
+    while (pos < ChannelPos_Max && !has_pos(mask, pos)) {
+        pos++;
+    }
+    return pos;
+}
+
+// Get index of channel in interleaved frame.
+size_t pos_index(packet::channel_mask_t mask, size_t pos) {
+    roc_panic_if_msg(!has_pos(mask, pos),
+                     "channel mapper: channel position not present in mask: pos=%lu",
+                     (unsigned long)pos);
+
+    return packet::num_channels(mask & (((packet::channel_mask_t)1 << pos) - 1));
+}
+
+} // namespace
+
 ChannelMapper::ChannelMapper(packet::channel_mask_t in_chans,
-                             packet::channel_mask_t out_chans)
+                             packet::channel_mask_t out_chans,
+                             ChannelMixing mixing)
     : in_chan_mask_(in_chans)
     , out_chan_mask_(out_chans)
     , in_chan_count_(packet::num_channels(in_chans))
     , out_chan_count_(packet::num_channels(out_chans))
-    , inout_chan_mask_(in_chans | out_chans) {
+    , n_runs_(0)
+    , matrix_enabled_(false)
+    , map_func_(map_generic_) {
+    size_t in_ch = 0;
+    size_t out_ch = 0;
+
+    for (size_t n = 0; n < MaxChannels; n++) {
+        const packet::channel_mask_t ch = (packet::channel_mask_t)1 << n;
+        if (out_chans & ch) {
+            chan_index_[out_ch++] = (in_chans & ch) ? (int)in_ch : -1;
+        }
+        if (in_chans & ch) {
+            in_ch++;
+        }
+    }
+
+    for (; out_ch < MaxChannels; out_ch++) {
+        chan_index_[out_ch] = -1;
+    }
+
+    init_runs_();
+
+    if (in_chans == out_chans) {
+        map_func_ = map_copy_;
+    } else if (in_chan_count_ == 1 && out_chan_count_ == 2
+               && (chan_index_[0] < 0) != (chan_index_[1] < 0)) {
+        map_func_ = map_1_to_2_;
+    } else if (in_chan_count_ == 2 && out_chan_count_ == 1 && chan_index_[0] >= 0) {
+        map_func_ = map_2_to_1_;
+    } else if (out_chan_count_ == 2 && chan_index_[0] >= 0 && chan_index_[1] >= 0) {
+        map_func_ = map_n_to_2_;
+    } else if (out_chan_count_ >= n_runs_ * MinRunLength) {
+        map_func_ = map_runs_;
+    }
+
+    if (mixing == ChannelMixing_Itu && in_chans != out_chans) {
+        enable_matrix_();
+        fill_itu_matrix_();
+    }
+}
+
+void ChannelMapper::set_gain(ChannelPosition out_pos,
+                             ChannelPosition in_pos,
+                             sample_t gain) {
+    enable_matrix_();
+    set_matrix_gain_((size_t)out_pos, (size_t)in_pos, gain);
+}
+
+sample_t ChannelMapper::gain(ChannelPosition out_pos, ChannelPosition in_pos) const {
+    const size_t out_index = pos_index(out_chan_mask_, (size_t)out_pos);
+    const size_t in_index = pos_index(in_chan_mask_, (size_t)in_pos);
+
+    if (!matrix_enabled_) {
+        return chan_index_[out_index] == (int)in_index ? 1 : 0;
+    }
+
+    return matrix_[out_index * in_chan_count_ + in_index];
 }
 
 void ChannelMapper::map(const Frame& in_frame, Frame& out_frame) {
@@ -37,23 +132,394 @@ void ChannelMapper::map(const Frame& in_frame, Frame& out_frame) {
 
     const size_t n_samples = in_frame.num_samples() / in_chan_count_;
 
-    const sample_t* in_samples = in_frame.samples();
-    sample_t* out_samples = out_frame.samples();
+    map_func_(*this, in_frame.samples(), out_frame.samples(), n_samples);
+}
 
-    for (size_t ns = 0; ns < n_samples; ns++) {
-        for (packet::channel_mask_t ch = 1; ch <= inout_chan_mask_ && ch != 0; ch <<= 1) {
-            if (in_chan_mask_ & ch) {
-                if (out_chan_mask_ & ch) {
-                    *out_samples++ = *in_samples;
-                }
-                in_samples++;
+// Masks are equal.
+void ChannelMapper::map_copy_(const ChannelMapper& mapper,
+                              const sample_t* in,
+                              sample_t* out,
+                              size_t n_samples) {
+    memcpy(out, in, n_samples * mapper.in_chan_count_ * sizeof(sample_t));
+}
+
+// Mono to stereo, one output channel is copied, another is zeroed.
+void ChannelMapper::map_1_to_2_(const ChannelMapper& mapper,
+                                const sample_t* in,
+                                sample_t* out,
+                                size_t n_samples) {
+    const size_t out_ch = mapper.chan_index_[0] >= 0 ? 0 : 1;
+
+    size_t n = 0;
+
+#if defined(__SSE2__)
+    const __m128 zero = _mm_setzero_ps();
+    for (; n + 4 <= n_samples; n += 4) {
+        const __m128 x = _mm_loadu_ps(in + n);
+        if (out_ch == 0) {
+            _mm_storeu_ps(out + n * 2, _mm_unpacklo_ps(x, zero));
+            _mm_storeu_ps(out + n * 2 + 4, _mm_unpackhi_ps(x, zero));
+        } else {
+            _mm_storeu_ps(out + n * 2, _mm_unpacklo_ps(zero, x));
+            _mm_storeu_ps(out + n * 2 + 4, _mm_unpackhi_ps(zero, x));
+        }
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const float32x4_t zero = vdupq_n_f32(0);
+    for (; n + 4 <= n_samples; n += 4) {
+        float32x4x2_t v;
+        v.val[out_ch] = vld1q_f32(in + n);
+        v.val[1 - out_ch] = zero;
+        vst2q_f32(out + n * 2, v);
+    }
+#endif
+
+    for (; n < n_samples; n++) {
+        out[n * 2 + out_ch] = in[n];
+        out[n * 2 + 1 - out_ch] = 0;
+    }
+}
+
+// Stereo to mono, one input channel is picked.
+void ChannelMapper::map_2_to_1_(const ChannelMapper& mapper,
+                                const sample_t* in,
+                                sample_t* out,
+                                size_t n_samples) {
+    const size_t in_ch = (size_t)mapper.chan_index_[0];
+
+    size_t n = 0;
+
+#if defined(__SSE2__)
+    for (; n + 4 <= n_samples; n += 4) {
+        const __m128 a = _mm_loadu_ps(in + n * 2);
+        const __m128 b = _mm_loadu_ps(in + n * 2 + 4);
+        if (in_ch == 0) {
+            _mm_storeu_ps(out + n, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        } else {
+            _mm_storeu_ps(out + n, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for (; n + 4 <= n_samples; n += 4) {
+        const float32x4x2_t v = vld2q_f32(in + n * 2);
+        vst1q_f32(out + n, v.val[in_ch]);
+    }
+#endif
+
+    for (; n < n_samples; n++) {
+        out[n] = in[n * 2 + in_ch];
+    }
+}
+
+// Any layout to stereo, when both output channels are present in input,
+// e.g. 5.1 to stereo.
+void ChannelMapper::map_n_to_2_(const ChannelMapper& mapper,
+                                const sample_t* in,
+                                sample_t* out,
+                                size_t n_samples) {
+    const size_t in_stride = mapper.in_chan_count_;
+    const size_t left = (size_t)mapper.chan_index_[0];
+    const size_t right = (size_t)mapper.chan_index_[1];
+
+    for (size_t n = 0; n < n_samples; n++) {
+        out[0] = in[left];
+        out[1] = in[right];
+        in += in_stride;
+        out += 2;
+    }
+}
+
+// Any layout to any layout, when output channels form long runs,
+// e.g. when channels are added or removed at the end of a large layout.
+void ChannelMapper::map_runs_(const ChannelMapper& mapper,
+                              const sample_t* in,
+                              sample_t* out,
+                              size_t n_samples) {
+    const size_t in_stride = mapper.in_chan_count_;
+    const size_t out_stride = mapper.out_chan_count_;
+    const Run* runs = mapper.runs_;
+    const size_t n_runs = mapper.n_runs_;
+
+    for (size_t n = 0; n < n_samples; n++) {
+        for (size_t r = 0; r < n_runs; r++) {
+            if (runs[r].in_ch >= 0) {
+                memcpy(out + runs[r].out_ch, in + runs[r].in_ch,
+                       runs[r].n_chans * sizeof(sample_t));
             } else {
-                if (out_chan_mask_ & ch) {
-                    *out_samples++ = 0;
+                memset(out + runs[r].out_ch, 0, runs[r].n_chans * sizeof(sample_t));
+            }
+        }
+        in += in_stride;
+        out += out_stride;
+    }
+}
+
+// Any layout to any layout.
+void ChannelMapper::map_generic_(const ChannelMapper& mapper,
+                                 const sample_t* in,
+                                 sample_t* out,
+                                 size_t n_samples) {
+    const size_t in_stride = mapper.in_chan_count_;
+    const size_t out_stride = mapper.out_chan_count_;
+    const int* index = mapper.chan_index_;
+
+    for (size_t n = 0; n < n_samples; n++) {
+        for (size_t ch = 0; ch < out_stride; ch++) {
+            out[ch] = index[ch] >= 0 ? in[index[ch]] : 0;
+        }
+        in += in_stride;
+        out += out_stride;
+    }
+}
+
+// Mixing matrix, any layout.
+void ChannelMapper::map_matrix_(const ChannelMapper& mapper,
+                                const sample_t* in,
+                                sample_t* out,
+                                size_t n_samples) {
+    const size_t in_stride = mapper.in_chan_count_;
+    const size_t out_stride = mapper.out_chan_count_;
+
+    for (size_t n = 0; n < n_samples; n++) {
+        const sample_t* row = mapper.matrix_;
+
+        for (size_t out_ch = 0; out_ch < out_stride; out_ch++) {
+            sample_t acc = 0;
+            for (size_t in_ch = 0; in_ch < in_stride; in_ch++) {
+                acc += row[in_ch] * in[in_ch];
+            }
+            out[out_ch] = acc;
+            row += in_stride;
+        }
+
+        in += in_stride;
+        out += out_stride;
+    }
+}
+
+// Mixing matrix, any layout to stereo.
+void ChannelMapper::map_matrix_to_2_(const ChannelMapper& mapper,
+                                     const sample_t* in,
+                                     sample_t* out,
+                                     size_t n_samples) {
+    const size_t in_stride = mapper.in_chan_count_;
+
+    const sample_t* left = mapper.matrix_;
+    const sample_t* right = mapper.matrix_ + in_stride;
+
+    size_t n = 0;
+
+#if defined(__SSE2__)
+    // Two frames per iteration, every input channel of both frames is
+    // multiplied by its column of the matrix: [left, right, left, right].
+    __m128 columns[MaxChannels];
+    for (size_t in_ch = 0; in_ch < in_stride; in_ch++) {
+        columns[in_ch] =
+            _mm_setr_ps(left[in_ch], right[in_ch], left[in_ch], right[in_ch]);
+    }
+
+    for (; n + 2 <= n_samples; n += 2) {
+        const sample_t* in0 = in;
+        const sample_t* in1 = in + in_stride;
+
+        __m128 acc = _mm_setzero_ps();
+        for (size_t in_ch = 0; in_ch < in_stride; in_ch++) {
+            const __m128 x = _mm_setr_ps(in0[in_ch], in0[in_ch], in1[in_ch], in1[in_ch]);
+            acc = _mm_add_ps(acc, _mm_mul_ps(x, columns[in_ch]));
+        }
+        _mm_storeu_ps(out, acc);
+
+        in += in_stride * 2;
+        out += 4;
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x2_t columns[MaxChannels];
+    for (size_t in_ch = 0; in_ch < in_stride; in_ch++) {
+        const float col[2] = { left[in_ch], right[in_ch] };
+        columns[in_ch] = vld1_f32(col);
+    }
+
+    for (; n < n_samples; n++) {
+        float32x2_t acc = vdup_n_f32(0);
+        for (size_t in_ch = 0; in_ch < in_stride; in_ch++) {
+            acc = vmla_n_f32(acc, columns[in_ch], in[in_ch]);
+        }
+        vst1_f32(out, acc);
+
+        in += in_stride;
+        out += 2;
+    }
+#endif
+
+    for (; n < n_samples; n++) {
+        sample_t acc_l = 0, acc_r = 0;
+        for (size_t in_ch = 0; in_ch < in_stride; in_ch++) {
+            acc_l += left[in_ch] * in[in_ch];
+            acc_r += right[in_ch] * in[in_ch];
+        }
+        out[0] = acc_l;
+        out[1] = acc_r;
+
+        in += in_stride;
+        out += 2;
+    }
+}
+
+// Group index table into runs.
+void ChannelMapper::init_runs_() {
+    for (size_t out_ch = 0; out_ch < out_chan_count_; out_ch++) {
+        const int in_ch = chan_index_[out_ch];
+
+        if (n_runs_ != 0) {
+            Run& last = runs_[n_runs_ - 1];
+
+            if ((in_ch < 0 && last.in_ch < 0)
+                || (in_ch >= 0 && last.in_ch >= 0
+                    && in_ch == last.in_ch + (int)last.n_chans)) {
+                last.n_chans++;
+                continue;
+            }
+        }
+
+        Run& run = runs_[n_runs_++];
+        run.in_ch = in_ch;
+        run.out_ch = out_ch;
+        run.n_chans = 1;
+    }
+}
+
+// Switch from index table to mixing matrix, initialized from index table.
+void ChannelMapper::enable_matrix_() {
+    if (matrix_enabled_) {
+        return;
+    }
+
+    for (size_t out_ch = 0; out_ch < out_chan_count_; out_ch++) {
+        for (size_t in_ch = 0; in_ch < in_chan_count_; in_ch++) {
+            matrix_[out_ch * in_chan_count_ + in_ch] =
+                chan_index_[out_ch] == (int)in_ch ? 1 : 0;
+        }
+    }
+
+    matrix_enabled_ = true;
+    map_func_ = out_chan_count_ == 2 ? map_matrix_to_2_ : map_matrix_;
+}
+
+// Fill matrix with coefficients from ITU-R BS.775.
+// Input channels missing in output are folded into the nearest output channels,
+// LFE is dropped, and every row is normalized to prevent clipping.
+void ChannelMapper::fill_itu_matrix_() {
+    for (size_t n = 0; n < out_chan_count_ * in_chan_count_; n++) {
+        matrix_[n] = 0;
+    }
+
+    if (in_chan_count_ == 1) {
+        // Mono upmix: to center if present, otherwise to front pair.
+        const size_t in_pos = lowest_pos(in_chan_mask_);
+
+        if (has_pos(out_chan_mask_, ChannelPos_FrontCenter)) {
+            set_matrix_gain_(ChannelPos_FrontCenter, in_pos, 1);
+        } else if (has_pos(out_chan_mask_, ChannelPos_FrontLeft)
+                   || has_pos(out_chan_mask_, ChannelPos_FrontRight)) {
+            if (has_pos(out_chan_mask_, ChannelPos_FrontLeft)) {
+                set_matrix_gain_(ChannelPos_FrontLeft, in_pos, 1);
+            }
+            if (has_pos(out_chan_mask_, ChannelPos_FrontRight)) {
+                set_matrix_gain_(ChannelPos_FrontRight, in_pos, 1);
+            }
+        } else if (has_pos(out_chan_mask_, in_pos)) {
+            set_matrix_gain_(in_pos, in_pos, 1);
+        }
+    } else if (out_chan_count_ == 1) {
+        // Mono downmix.
+        const size_t out_pos = lowest_pos(out_chan_mask_);
+
+        for (size_t in_pos = 0; in_pos < MaxChannels; in_pos++) {
+            if (!has_pos(in_chan_mask_, in_pos)) {
+                continue;
+            }
+            switch (in_pos) {
+            case ChannelPos_FrontLeft:
+            case ChannelPos_FrontRight:
+                set_matrix_gain_(out_pos, in_pos, Gain3dB);
+                break;
+            case ChannelPos_FrontCenter:
+                set_matrix_gain_(out_pos, in_pos, 1);
+                break;
+            case ChannelPos_BackLeft:
+            case ChannelPos_BackRight:
+                set_matrix_gain_(out_pos, in_pos, 0.5f);
+                break;
+            default:
+                if (in_pos == out_pos) {
+                    set_matrix_gain_(out_pos, in_pos, 1);
                 }
+                break;
+            }
+        }
+    } else {
+        for (size_t in_pos = 0; in_pos < MaxChannels; in_pos++) {
+            if (!has_pos(in_chan_mask_, in_pos)) {
+                continue;
+            }
+
+            if (has_pos(out_chan_mask_, in_pos)) {
+                set_matrix_gain_(in_pos, in_pos, 1);
+                continue;
+            }
+
+            switch (in_pos) {
+            case ChannelPos_FrontCenter:
+                if (has_pos(out_chan_mask_, ChannelPos_FrontLeft)) {
+                    set_matrix_gain_(ChannelPos_FrontLeft, in_pos, Gain3dB);
+                }
+                if (has_pos(out_chan_mask_, ChannelPos_FrontRight)) {
+                    set_matrix_gain_(ChannelPos_FrontRight, in_pos, Gain3dB);
+                }
+                break;
+            case ChannelPos_FrontLeft:
+            case ChannelPos_FrontRight:
+                if (has_pos(out_chan_mask_, ChannelPos_FrontCenter)) {
+                    set_matrix_gain_(ChannelPos_FrontCenter, in_pos, Gain3dB);
+                }
+                break;
+            case ChannelPos_BackLeft:
+                if (has_pos(out_chan_mask_, ChannelPos_FrontLeft)) {
+                    set_matrix_gain_(ChannelPos_FrontLeft, in_pos, Gain3dB);
+                }
+                break;
+            case ChannelPos_BackRight:
+                if (has_pos(out_chan_mask_, ChannelPos_FrontRight)) {
+                    set_matrix_gain_(ChannelPos_FrontRight, in_pos, Gain3dB);
+                }
+                break;
+            default:
+                break;
             }
         }
     }
+
+    for (size_t out_ch = 0; out_ch < out_chan_count_; out_ch++) {
+        sample_t* row = matrix_ + out_ch * in_chan_count_;
+
+        sample_t sum = 0;
+        for (size_t in_ch = 0; in_ch < in_chan_count_; in_ch++) {
+            sum += row[in_ch];
+        }
+
+        if (sum > 1) {
+            for (size_t in_ch = 0; in_ch < in_chan_count_; in_ch++) {
+                row[in_ch] /= sum;
+            }
+        }
+    }
+}
+
+void ChannelMapper::set_matrix_gain_(size_t out_pos, size_t in_pos, sample_t gain) {
+    roc_panic_if(!matrix_enabled_);
+
+    matrix_[pos_index(out_chan_mask_, out_pos) * in_chan_count_
+            + pos_index(in_chan_mask_, in_pos)] = gain;
 }
 
 } // namespace audio
@@ -12,6 +12,7 @@
 #ifndef ROC_AUDIO_CHANNEL_MAPPER_H_
 #define ROC_AUDIO_CHANNEL_MAPPER_H_
 
+#include "roc_audio/channel_layout.h"
 #include "roc_audio/frame.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/noncopyable.h"
@@ -22,22 +23,82 @@ namespace audio {
 
 //! Channel mapper.
 //! Converts between frames with specified channel masks.
+//! @remarks
+//!  With ChannelMixing_None, output channels which are present in input are
+//!  copied, other output channels are zeroed. The mapping table is computed
+//!  once in constructor, and a specialized kernel is selected for common layouts.
+//!  For layouts with many channels, output channels are grouped into runs that
+//!  are copied from adjacent input channels or zeroed as a whole.
+//!
+//!  With ChannelMixing_Itu, or after set_gain() is called, every output channel
+//!  is computed as a weighted sum of input channels, using mixing matrix.
 class ChannelMapper : public core::NonCopyable<> {
 public:
     //! Initialize.
-    ChannelMapper(packet::channel_mask_t in_chans, packet::channel_mask_t out_chans);
+    ChannelMapper(packet::channel_mask_t in_chans,
+                  packet::channel_mask_t out_chans,
+                  ChannelMixing mixing = ChannelMixing_None);
+
+    //! Set gain of input channel in output channel.
+    //! @remarks
+    //!  Switches mapper to mixing matrix, if it wasn't used yet. Both channels
+    //!  should be present in corresponding channel masks.
+    void set_gain(ChannelPosition out_pos, ChannelPosition in_pos, sample_t gain);
+
+    //! Get gain of input channel in output channel.
+    sample_t gain(ChannelPosition out_pos, ChannelPosition in_pos) const;
 
     //! Map frame.
     void map(const Frame& in_frame, Frame& out_frame);
 
 private:
+    enum { MaxChannels = ChannelPos_Max };
+
+    typedef void (*map_func_t)(const ChannelMapper& mapper,
+                               const sample_t* in,
+                               sample_t* out,
+                               size_t n_samples);
+
+    static void map_copy_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+    static void map_1_to_2_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+    static void map_2_to_1_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+    static void map_n_to_2_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+    static void map_runs_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+    static void map_generic_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+    static void map_matrix_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+    static void
+    map_matrix_to_2_(const ChannelMapper&, const sample_t*, sample_t*, size_t);
+
+    void init_runs_();
+    void enable_matrix_();
+    void fill_itu_matrix_();
+    void set_matrix_gain_(size_t out_pos, size_t in_pos, sample_t gain);
+
     const packet::channel_mask_t in_chan_mask_;
     const packet::channel_mask_t out_chan_mask_;
 
     const size_t in_chan_count_;
     const size_t out_chan_count_;
 
-    const packet::channel_mask_t inout_chan_mask_;
+    // for every output channel, index of input channel or -1 if missing
+    int chan_index_[MaxChannels];
+
+    // adjacent output channels mapped to adjacent input channels or zeroed
+    struct Run {
+        int in_ch;
+        size_t out_ch;
+        size_t n_chans;
+    };
+
+    Run runs_[MaxChannels];
+    size_t n_runs_;
+
+    // gain of every input channel for every output channel,
+    // out_chan_count_ rows of in_chan_count_ elements
+    sample_t matrix_[MaxChannels * MaxChannels];
+    bool matrix_enabled_;
+
+    map_func_t map_func_;
 };
 
 } // namespace audio
@@ -17,10 +17,11 @@ ChannelMapperReader::ChannelMapperReader(IFrameReader& reader,
                                          core::BufferFactory<sample_t>& buffer_factory,
                                          core::nanoseconds_t frame_length,
                                          const SampleSpec& in_spec,
-                                         const SampleSpec& out_spec)
+                                         const SampleSpec& out_spec,
+                                         ChannelMixing mixing)
     : input_reader_(reader)
     , input_buf_()
-    , mapper_(in_spec.channel_mask(), out_spec.channel_mask())
+    , mapper_(in_spec.channel_mask(), out_spec.channel_mask(), mixing)
     , mapper_enabled_(in_spec.channel_mask() != out_spec.channel_mask())
     , in_spec_(in_spec)
     , out_spec_(out_spec)
@@ -33,9 +34,9 @@ ChannelMapperReader::ChannelMapperReader(IFrameReader& reader,
         const size_t frame_size = in_spec.ns_2_samples_overall(frame_length);
         roc_log(LogDebug,
                 "channel mapper reader:"
-                " initializing: frame_size=%lu in_mask=0x%lx out_mask=%lx",
-                (unsigned long)frame_size, (unsigned long)in_spec.channel_mask(),
-                (unsigned long)out_spec.channel_mask());
+                " initializing: frame_size=%lu in_mask=0x%llx out_mask=0x%llx",
+                (unsigned long)frame_size, (unsigned long long)in_spec.channel_mask(),
+                (unsigned long long)out_spec.channel_mask());
 
         if (frame_size == 0) {
             roc_log(LogError, "channel mapper reader: frame size cannot be 0");
@@ -79,11 +80,15 @@ bool ChannelMapperReader::read(Frame& out_frame) {
     size_t n_samples = out_frame.num_samples() / out_spec_.num_channels();
 
     unsigned flags = 0;
+    bool zeros = true;
+
+    FrameLevel level;
+    bool has_level = true;
 
     while (n_samples != 0) {
-        const size_t n_read = std::max(n_samples, max_batch);
+        const size_t n_read = std::min(n_samples, max_batch);
 
-        if (!read_(out_samples, n_read, flags)) {
+        if (!read_(out_samples, n_read, flags, zeros, level, has_level)) {
             return false;
         }
 
@@ -91,14 +96,25 @@ bool ChannelMapperReader::read(Frame& out_frame) {
         n_samples -= n_read;
     }
 
+    if (zeros) {
+        flags |= Frame::FlagZeros;
+    }
+
     out_frame.set_flags(flags);
 
+    if (has_level) {
+        out_frame.set_level(level);
+    }
+
     return true;
 }
 
 bool ChannelMapperReader::read_(sample_t* out_samples,
                                 size_t n_samples,
-                                unsigned& flags) {
+                                unsigned& flags,
+                                bool& zeros,
+                                FrameLevel& level,
+                                bool& has_level) {
     Frame out_frame(out_samples, n_samples * out_spec_.num_channels());
 
     Frame in_frame(input_buf_.data(), n_samples * in_spec_.num_channels());
@@ -107,9 +123,22 @@ bool ChannelMapperReader::read_(sample_t* out_samples,
         return false;
     }
 
-    mapper_.map(in_frame, out_frame);
+    if (in_frame.flags() & Frame::FlagZeros) {
+        memset(out_samples, 0, out_frame.num_samples() * sizeof(sample_t));
+    } else {
+        mapper_.map(in_frame, out_frame);
+        zeros = false;
+    }
+
+    flags |= (in_frame.flags() & ~(unsigned)Frame::FlagZeros);
 
-    flags |= in_frame.flags();
+    // Mapping may change the level, e.g. when channels are mixed, but
+    // input level is close enough for its consumers.
+    if (in_frame.has_level()) {
+        level.add_level(in_frame.level());
+    } else {
+        has_level = false;
+    }
 
     return true;
 }
@@ -12,6 +12,7 @@
 #ifndef ROC_AUDIO_CHANNEL_MAPPER_READER_H_
 #define ROC_AUDIO_CHANNEL_MAPPER_READER_H_
 
+#include "roc_audio/channel_layout.h"
 #include "roc_audio/channel_mapper.h"
 #include "roc_audio/iframe_reader.h"
 #include "roc_audio/sample_spec.h"
@@ -25,6 +26,7 @@ namespace audio {
 
 //! Channel mapper reader.
 //! Reads frames from nested reader and maps them to another channel mask.
+//! Signal level of input frames, if present, is passed to output frames.
 class ChannelMapperReader : public IFrameReader, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -32,7 +34,8 @@ public:
                         core::BufferFactory<sample_t>& buffer_factory,
                         core::nanoseconds_t frame_length,
                         const SampleSpec& in_spec,
-                        const SampleSpec& out_spec);
+                        const SampleSpec& out_spec,
+                        ChannelMixing mixing = ChannelMixing_None);
 
     //! Check if the object was succefully constructed.
     bool valid() const;
@@ -41,7 +44,12 @@ public:
     virtual bool read(Frame& frame);
 
 private:
-    bool read_(sample_t* out_samples, size_t n_samples, unsigned& flags);
+    bool read_(sample_t* out_samples,
+               size_t n_samples,
+               unsigned& flags,
+               bool& zeros,
+               FrameLevel& level,
+               bool& has_level);
 
     IFrameReader& input_reader_;
     core::Slice<sample_t> input_buf_;
@@ -9,6 +9,7 @@
 #include "roc_audio/channel_mapper_writer.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
 
 namespace roc {
 namespace audio {
@@ -17,10 +18,11 @@ ChannelMapperWriter::ChannelMapperWriter(IFrameWriter& writer,
                                          core::BufferFactory<sample_t>& buffer_factory,
                                          core::nanoseconds_t frame_length,
                                          const SampleSpec& in_spec,
-                                         const SampleSpec& out_spec)
+                                         const SampleSpec& out_spec,
+                                         ChannelMixing mixing)
     : output_writer_(writer)
     , output_buf_()
-    , mapper_(in_spec.channel_mask(), out_spec.channel_mask())
+    , mapper_(in_spec.channel_mask(), out_spec.channel_mask(), mixing)
     , mapper_enabled_(in_spec.channel_mask() != out_spec.channel_mask())
     , in_spec_(in_spec)
     , out_spec_(out_spec)
@@ -33,9 +35,9 @@ ChannelMapperWriter::ChannelMapperWriter(IFrameWriter& writer,
         const size_t frame_size = out_spec.ns_2_samples_overall(frame_length);
         roc_log(LogDebug,
                 "channel mapper writer:"
-                " initializing: frame_size=%lu in_mask=0x%lx out_mask=%lx",
-                (unsigned long)frame_size, (unsigned long)in_spec.channel_mask(),
-                (unsigned long)out_spec.channel_mask());
+                " initializing: frame_size=%lu in_mask=0x%llx out_mask=0x%llx",
+                (unsigned long)frame_size, (unsigned long long)in_spec.channel_mask(),
+                (unsigned long long)out_spec.channel_mask());
 
         if (frame_size == 0) {
             roc_log(LogError, "channel mapper writer: frame size cannot be 0");
@@ -81,7 +83,7 @@ void ChannelMapperWriter::write(Frame& in_frame) {
     const unsigned flags = in_frame.flags();
 
     while (n_samples != 0) {
-        const size_t n_write = std::max(n_samples, max_batch);
+        const size_t n_write = std::min(n_samples, max_batch);
 
         write_(in_samples, n_write, flags);
 
@@ -97,7 +99,12 @@ void ChannelMapperWriter::write_(sample_t* in_samples, size_t n_samples, unsigne
 
     out_frame.set_flags(flags);
 
-    mapper_.map(in_frame, out_frame);
+    if (flags & Frame::FlagZeros) {
+        // Mapping of silence is silence.
+        memset(out_frame.samples(), 0, out_frame.num_samples() * sizeof(sample_t));
+    } else {
+        mapper_.map(in_frame, out_frame);
+    }
 
     output_writer_.write(out_frame);
 }
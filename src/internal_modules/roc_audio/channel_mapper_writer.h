@@ -12,6 +12,7 @@
 #ifndef ROC_AUDIO_CHANNEL_MAPPER_WRITER_H_
 #define ROC_AUDIO_CHANNEL_MAPPER_WRITER_H_
 
+#include "roc_audio/channel_layout.h"
 #include "roc_audio/channel_mapper.h"
 #include "roc_audio/iframe_writer.h"
 #include "roc_audio/sample_spec.h"
@@ -32,7 +33,8 @@ public:
                         core::BufferFactory<sample_t>& buffer_factory,
                         core::nanoseconds_t frame_length,
                         const SampleSpec& in_spec,
-                        const SampleSpec& out_spec);
+                        const SampleSpec& out_spec,
+                        ChannelMixing mixing = ChannelMixing_None);
 
     //! Check if the object was succefully constructed.
     bool valid() const;
@@ -10,6 +10,8 @@
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/tracepoint.h"
+#include "roc_packet/ntp.h"
 
 namespace roc {
 namespace audio {
@@ -18,6 +20,8 @@ namespace {
 
 const core::nanoseconds_t LogInterval = 20 * core::Second;
 
+enum { SalvageBufSize = 512 };
+
 inline void write_zeros(sample_t* buf, size_t bufsz) {
     memset(buf, 0, bufsz * sizeof(sample_t));
 }
@@ -33,19 +37,27 @@ inline void write_beep(sample_t* buf, size_t bufsz) {
 Depacketizer::Depacketizer(packet::IReader& reader,
                            IFrameDecoder& payload_decoder,
                            const audio::SampleSpec& sample_spec,
-                           bool beep)
+                           bool beep,
+                           LossConcealer* concealer)
     : reader_(reader)
     , payload_decoder_(payload_decoder)
+    , concealer_(beep ? NULL : concealer)
     , sample_spec_(sample_spec)
     , timestamp_(0)
     , zero_samples_(0)
     , missing_samples_(0)
     , packet_samples_(0)
+    , capture_ts_(0)
+    , capture_rtp_ts_(0)
+    , last_seqnum_(0)
+    , has_last_seqnum_(false)
+    , last_contiguous_(false)
+    , dtx_gap_(false)
     , rate_limiter_(LogInterval)
     , first_packet_(true)
     , beep_(beep) {
-    roc_log(LogDebug, "depacketizer: initializing: n_channels=%lu",
-            (unsigned long)sample_spec_.num_channels());
+    roc_log(LogDebug, "depacketizer: initializing: n_channels=%lu concealment=%d",
+            (unsigned long)sample_spec_.num_channels(), (int)(concealer_ != NULL));
 }
 
 bool Depacketizer::started() const {
@@ -59,6 +71,67 @@ packet::timestamp_t Depacketizer::timestamp() const {
     return timestamp_;
 }
 
+packet::ntp_timestamp_t Depacketizer::capture_timestamp() const {
+    if (first_packet_ || capture_ts_ == 0) {
+        return 0;
+    }
+
+    const core::nanoseconds_t delta = sample_spec_.rtp_timestamp_2_ns(
+        packet::timestamp_diff(timestamp_, capture_rtp_ts_));
+
+    if (delta >= 0) {
+        return capture_ts_ + packet::nanoseconds_2_ntp(delta);
+    } else {
+        return capture_ts_ - packet::nanoseconds_2_ntp(-delta);
+    }
+}
+
+bool Depacketizer::in_dtx_pause() const {
+    return packet_ && dtx_gap_
+        && packet::timestamp_lt(timestamp_, payload_decoder_.position());
+}
+
+DepacketizerMetrics Depacketizer::metrics() const {
+    return metrics_;
+}
+
+void Depacketizer::skip(packet::timestamp_t n_samples) {
+    roc_panic_if_msg(first_packet_, "depacketizer: can't skip before first packet");
+
+    roc_log(LogDebug, "depacketizer: skipping samples: ts=%lu n_samples=%lu",
+            (unsigned long)timestamp_, (unsigned long)n_samples);
+
+    timestamp_ += n_samples;
+
+    if (packet_) {
+        const packet::timestamp_t pkt_end =
+            payload_decoder_.position() + payload_decoder_.available();
+
+        if (packet::timestamp_lt(timestamp_, pkt_end)) {
+            // new position is inside current packet
+            if (packet::timestamp_lt(payload_decoder_.position(), timestamp_)) {
+                const size_t diff_samples = (size_t)packet::timestamp_diff(
+                    timestamp_, payload_decoder_.position());
+
+                if (payload_decoder_.shift(diff_samples) != diff_samples) {
+                    roc_panic("depacketizer: can't shift packet");
+                }
+            }
+            return;
+        }
+
+        payload_decoder_.end();
+        packet_ = NULL;
+        metrics_.skipped_packets++;
+    }
+
+    // fetch next packet, dropping packets that are behind new position
+    FrameInfo info;
+    update_packet_(info, false);
+
+    metrics_.skipped_packets += info.n_dropped_packets;
+}
+
 bool Depacketizer::read(Frame& frame) {
     read_frame_(frame);
 
@@ -83,12 +156,14 @@ void Depacketizer::read_frame_(Frame& frame) {
 
     roc_panic_if(buff_ptr != buff_end);
 
+    metrics_.late_packets += info.n_dropped_packets;
+
     set_frame_flags_(frame, info);
 }
 
 sample_t*
 Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& info) {
-    update_packet_(info);
+    update_packet_(info, true);
 
     if (packet_) {
         packet::timestamp_t next_timestamp = payload_decoder_.position();
@@ -101,49 +176,91 @@ Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& i
 
             const size_t max_samples = (size_t)(buff_end - buff_ptr);
 
-            buff_ptr = read_missing_samples_(
-                buff_ptr, buff_ptr + std::min(mis_samples, max_samples));
+            if (dtx_gap_) {
+                buff_ptr = read_dtx_samples_(
+                    buff_ptr, buff_ptr + std::min(mis_samples, max_samples), info);
+            } else {
+                buff_ptr = read_missing_samples_(
+                    buff_ptr, buff_ptr + std::min(mis_samples, max_samples), info);
+            }
         }
 
         if (buff_ptr < buff_end) {
-            sample_t* new_buff_ptr = read_packet_samples_(buff_ptr, buff_end);
-
-            info.n_decoded_samples += size_t(new_buff_ptr - buff_ptr);
-
-            buff_ptr = new_buff_ptr;
+            buff_ptr = read_packet_samples_(buff_ptr, buff_end, info);
         }
 
         return buff_ptr;
     } else {
-        return read_missing_samples_(buff_ptr, buff_end);
+        return read_missing_samples_(buff_ptr, buff_end, info);
     }
 }
 
-sample_t* Depacketizer::read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end) {
-    const size_t requested_samples =
-        size_t(buff_end - buff_ptr) / sample_spec_.num_channels();
+// decodes current packet and following packets, as long as they continue
+// the stream without gaps, so that a run of in-order packets is decoded
+// into the frame without returning to read_samples_() for every packet
+sample_t* Depacketizer::read_packet_samples_(sample_t* buff_ptr,
+                                             sample_t* buff_end,
+                                             FrameInfo& info) {
+    const size_t num_channels = sample_spec_.num_channels();
+
+    for (;;) {
+        const size_t requested_samples = size_t(buff_end - buff_ptr) / num_channels;
+
+        const size_t decoded_samples =
+            payload_decoder_.read(buff_ptr, requested_samples);
+
+        if (concealer_) {
+            concealer_->process(buff_ptr, decoded_samples);
+        }
 
-    const size_t decoded_samples = payload_decoder_.read(buff_ptr, requested_samples);
+        info.level.add_samples(buff_ptr, decoded_samples * num_channels);
 
-    timestamp_ += packet::timestamp_t(decoded_samples);
-    packet_samples_ += (packet::timestamp_t)decoded_samples;
+        timestamp_ += packet::timestamp_t(decoded_samples);
+        packet_samples_ += (packet::timestamp_t)decoded_samples;
+
+        buff_ptr += decoded_samples * num_channels;
+        info.n_decoded_samples += decoded_samples * num_channels;
+
+        if (decoded_samples == requested_samples
+            && payload_decoder_.available() != 0) {
+            // frame is full, packet will be continued by next frame
+            break;
+        }
 
-    if (decoded_samples < requested_samples) {
         payload_decoder_.end();
         packet_ = NULL;
+
+        if (buff_ptr == buff_end) {
+            break;
+        }
+
+        update_packet_(info, true);
+
+        if (!packet_ || payload_decoder_.position() != timestamp_) {
+            // no more packets or there is a gap
+            break;
+        }
     }
 
-    return (buff_ptr + decoded_samples * sample_spec_.num_channels());
+    return buff_ptr;
 }
 
-sample_t* Depacketizer::read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end) {
+sample_t* Depacketizer::read_missing_samples_(sample_t* buff_ptr,
+                                              sample_t* buff_end,
+                                              FrameInfo& info) {
     const size_t num_samples =
         (size_t)(buff_end - buff_ptr) / sample_spec_.num_channels();
 
-    if (beep_) {
+    if (concealer_ && !first_packet_) {
+        concealer_->conceal(buff_ptr, num_samples);
+        info.n_concealed_samples += num_samples * sample_spec_.num_channels();
+        info.level.add_samples(buff_ptr, num_samples * sample_spec_.num_channels());
+    } else if (beep_) {
         write_beep(buff_ptr, num_samples * sample_spec_.num_channels());
+        info.level.add_samples(buff_ptr, num_samples * sample_spec_.num_channels());
     } else {
         write_zeros(buff_ptr, num_samples * sample_spec_.num_channels());
+        info.level.add_zeros(num_samples * sample_spec_.num_channels());
     }
 
     timestamp_ += packet::timestamp_t(num_samples);
@@ -157,7 +274,36 @@ sample_t* Depacketizer::read_missing_samples_(sample_t* buff_ptr, sample_t* buff
     return (buff_ptr + num_samples * sample_spec_.num_channels());
 }
 
-void Depacketizer::update_packet_(FrameInfo& info) {
+// sender paused transmission during silence, so we know the samples are zero
+sample_t* Depacketizer::read_dtx_samples_(sample_t* buff_ptr,
+                                          sample_t* buff_end,
+                                          FrameInfo& info) {
+    const size_t num_samples =
+        (size_t)(buff_end - buff_ptr) / sample_spec_.num_channels();
+
+    write_zeros(buff_ptr, num_samples * sample_spec_.num_channels());
+
+    // concealer may crossfade beginning of pause with synthetic signal,
+    // such samples are not zeros anymore and are reported as concealed
+    size_t num_xfade_samples = 0;
+
+    if (concealer_) {
+        num_xfade_samples = concealer_->process(buff_ptr, num_samples);
+        info.level.add_samples(buff_ptr, num_samples * sample_spec_.num_channels());
+    } else {
+        info.level.add_zeros(num_samples * sample_spec_.num_channels());
+    }
+
+    timestamp_ += packet::timestamp_t(num_samples);
+
+    info.n_concealed_samples += num_xfade_samples * sample_spec_.num_channels();
+    info.n_dtx_samples +=
+        (num_samples - num_xfade_samples) * sample_spec_.num_channels();
+
+    return (buff_ptr + num_samples * sample_spec_.num_channels());
+}
+
+void Depacketizer::update_packet_(FrameInfo& info, bool salvage) {
     if (packet_) {
         return;
     }
@@ -186,6 +332,10 @@ void Depacketizer::update_packet_(FrameInfo& info) {
 
         n_dropped++;
 
+        if (salvage && concealer_) {
+            salvage_packet_();
+        }
+
         payload_decoder_.end();
     }
 
@@ -200,6 +350,17 @@ void Depacketizer::update_packet_(FrameInfo& info) {
         return;
     }
 
+    dtx_gap_ = last_contiguous_;
+
+    roc_tracepoint(depacketizer_decode, (const void*)this, (const void*)packet_.get(),
+                   (unsigned long)pkt_timestamp,
+                   (unsigned long)payload_decoder_.available());
+
+    if (packet_->rtp()->capture_timestamp != 0) {
+        capture_ts_ = packet_->rtp()->capture_timestamp;
+        capture_rtp_ts_ = packet_->rtp()->timestamp;
+    }
+
     if (first_packet_) {
         roc_log(LogDebug, "depacketizer: got first packet: zero_samples=%lu",
                 (unsigned long)zero_samples_);
@@ -218,6 +379,45 @@ void Depacketizer::update_packet_(FrameInfo& info) {
     }
 }
 
+// decodes late packet and puts its samples to the part of concealer history
+// which they would have occupied if the packet arrived in time
+void Depacketizer::salvage_packet_() {
+    const size_t pkt_delay = (size_t)packet::timestamp_diff(
+        timestamp_, payload_decoder_.position() + payload_decoder_.available());
+
+    if (pkt_delay >= concealer_->history_length()) {
+        return;
+    }
+
+    sample_t buf[SalvageBufSize];
+    const size_t buf_samples = SalvageBufSize / sample_spec_.num_channels();
+
+    if (buf_samples == 0) {
+        return;
+    }
+
+    // skip part of packet which is older than history
+    const size_t pkt_samples = payload_decoder_.available();
+    const size_t max_samples = concealer_->history_length() - pkt_delay;
+
+    if (pkt_samples > max_samples) {
+        payload_decoder_.shift(pkt_samples - max_samples);
+    }
+
+    while (payload_decoder_.available() != 0) {
+        const size_t n_samples = payload_decoder_.read(buf, buf_samples);
+        if (n_samples == 0) {
+            break;
+        }
+
+        concealer_->repair(buf, n_samples,
+                           (size_t)packet::timestamp_diff(timestamp_,
+                                                          payload_decoder_.position()));
+    }
+
+    metrics_.salvaged_packets++;
+}
+
 packet::PacketPtr Depacketizer::read_packet_() {
     packet::PacketPtr pp = reader_.read();
     if (!pp) {
@@ -228,17 +428,41 @@ packet::PacketPtr Depacketizer::read_packet_() {
         roc_panic("depacketizer: unexpected non-rtp packet");
     }
 
+    const packet::seqnum_t seqnum = pp->rtp()->seqnum;
+
+    last_contiguous_ =
+        has_last_seqnum_ && packet::seqnum_diff(seqnum, last_seqnum_) == 1;
+
+    if (!has_last_seqnum_ || packet::seqnum_lt(last_seqnum_, seqnum)) {
+        if (has_last_seqnum_) {
+            metrics_.lost_packets +=
+                size_t(packet::seqnum_diff(seqnum, last_seqnum_) - 1);
+        }
+        last_seqnum_ = seqnum;
+        has_last_seqnum_ = true;
+    }
+
     return pp;
 }
 
 void Depacketizer::set_frame_flags_(Frame& frame, const FrameInfo& info) {
     unsigned flags = 0;
 
+    // samples of dtx pause are treated as decoded silence, unless they were
+    // crossfaded by concealer, in which case they're counted as concealed
+    const size_t n_filled_samples = info.n_decoded_samples + info.n_dtx_samples;
+
     if (info.n_decoded_samples != 0) {
         flags |= Frame::FlagNonblank;
+    } else if ((!beep_ || n_filled_samples == frame.num_samples())
+               && info.n_concealed_samples == 0) {
+        flags |= Frame::FlagZeros;
+        if (n_filled_samples != 0) {
+            flags |= Frame::FlagNonblank;
+        }
     }
 
-    if (info.n_decoded_samples < frame.num_samples()) {
+    if (n_filled_samples < frame.num_samples()) {
         flags |= Frame::FlagIncomplete;
     }
 
@@ -247,6 +471,12 @@ void Depacketizer::set_frame_flags_(Frame& frame, const FrameInfo& info) {
     }
 
     frame.set_flags(flags);
+
+    roc_panic_if(info.level.num_samples() != frame.num_samples());
+    frame.set_level(info.level);
+
+    metrics_.rms_level = info.level.rms();
+    metrics_.peak_level = info.level.peak();
 }
 
 void Depacketizer::report_stats_() {
@@ -12,21 +12,67 @@
 #ifndef ROC_AUDIO_DEPACKETIZER_H_
 #define ROC_AUDIO_DEPACKETIZER_H_
 
+#include "roc_audio/frame_level.h"
 #include "roc_audio/iframe_decoder.h"
 #include "roc_audio/iframe_reader.h"
+#include "roc_audio/loss_concealer.h"
 #include "roc_audio/sample.h"
 #include "roc_audio/sample_spec.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/rate_limiter.h"
 #include "roc_packet/ireader.h"
+#include "roc_packet/units.h"
 
 namespace roc {
 namespace audio {
 
+//! Depacketizer metrics.
+struct DepacketizerMetrics {
+    //! Number of packets that were never received or were received too late.
+    //! Computed from gaps in sequence numbers of packets read from queue,
+    //! so packets restored by FEC are not counted.
+    size_t lost_packets;
+
+    //! Number of packets dropped because they were received too late.
+    size_t late_packets;
+
+    //! Number of late packets which were decoded into loss concealer history.
+    //! These packets are counted in late_packets too.
+    size_t salvaged_packets;
+
+    //! Number of packets dropped by skip().
+    size_t skipped_packets;
+
+    //! Root mean square of samples of last frame.
+    sample_t rms_level;
+
+    //! Maximum absolute value of samples of last frame.
+    sample_t peak_level;
+
+    DepacketizerMetrics()
+        : lost_packets(0)
+        , late_packets(0)
+        , salvaged_packets(0)
+        , skipped_packets(0)
+        , rms_level(0)
+        , peak_level(0) {
+    }
+};
+
 //! Depacketizer.
 //! @remarks
 //!  Reads packets from a packet reader, decodes samples from packets using a
 //!  decoder, and produces an audio stream.
+//!
+//!  A timestamp gap between packets with adjacent sequence numbers is a DTX
+//!  pause: sender intentionally didn't send silence. Such gap is filled with
+//!  zeros and, unlike a loss, is reported as if it was decoded from packets,
+//!  so the frame doesn't look blank or incomplete. If the pause follows a
+//!  concealed loss, its beginning is crossfaded by loss concealer and is
+//!  reported as concealed.
+//!
+//!  Signal level of every frame is computed while samples are being decoded
+//!  and is attached to the frame, see Frame::level().
 class Depacketizer : public IFrameReader, public core::NonCopyable<> {
 public:
     //! Initialization.
@@ -36,10 +82,18 @@ public:
     //!  - @p payload_decoder is used to extract samples from packets
     //!  - @p sample_spec defines a set of channels in the output frames
     //!  - @p beep enables weird beeps instead of silence on packet loss
+    //!  - @p concealer, if non-NULL, is used to fill packet losses with synthetic
+    //!    signal instead of silence; ignored when @p beep is enabled
+    //!
+    //! @remarks
+    //!  When @p concealer is used, packets that arrive too late to be played
+    //!  are still decoded and passed to it, so that concealment of subsequent
+    //!  losses continues the real signal instead of the synthetic one.
     Depacketizer(packet::IReader& reader,
                  IFrameDecoder& payload_decoder,
                  const audio::SampleSpec& sample_spec,
-                 bool beep);
+                 bool beep,
+                 LossConcealer* concealer = NULL);
 
     //! Read audio frame.
     virtual bool read(Frame& frame);
@@ -52,17 +106,52 @@ public:
     //!  started() should return true
     packet::timestamp_t timestamp() const;
 
+    //! Skip samples.
+    //! @remarks
+    //!  Advances stream position by @p n_samples without rendering them,
+    //!  and drops packets which become entirely behind the new position.
+    //!  Used to reduce latency by a jump.
+    //! @pre
+    //!  started() should return true
+    void skip(packet::timestamp_t n_samples);
+
+    //! Get capture time of next sample to be rendered.
+    //! @returns
+    //!  NTP timestamp in sender clock, computed from capture time of the last
+    //!  packet, or zero if packets don't have capture time.
+    packet::ntp_timestamp_t capture_timestamp() const;
+
+    //! Check if depacketizer is inside DTX pause.
+    //! @remarks
+    //!  Returns true if next sample to be rendered is in a gap which is known
+    //!  to be a pause of discontinuous transmission.
+    bool in_dtx_pause() const;
+
+    //! Get cumulative metrics.
+    DepacketizerMetrics metrics() const;
+
 private:
     struct FrameInfo {
         // Number of samples decoded from packets into the frame.
         size_t n_decoded_samples;
 
+        // Number of samples filled by loss concealer.
+        size_t n_concealed_samples;
+
         // Number of packets dropped during frame construction.
         size_t n_dropped_packets;
 
+        // Number of samples filled with zeros during DTX pause.
+        size_t n_dtx_samples;
+
+        // Level of all samples written to the frame.
+        FrameLevel level;
+
         FrameInfo()
             : n_decoded_samples(0)
-            , n_dropped_packets(0) {
+            , n_concealed_samples(0)
+            , n_dropped_packets(0)
+            , n_dtx_samples(0) {
         }
     };
 
@@ -70,10 +159,14 @@ private:
 
     sample_t* read_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& info);
 
-    sample_t* read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end);
-    sample_t* read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end);
+    sample_t*
+    read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& info);
+    sample_t*
+    read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& info);
+    sample_t* read_dtx_samples_(sample_t* buff_ptr, sample_t* buff_end, FrameInfo& info);
 
-    void update_packet_(FrameInfo& info);
+    void update_packet_(FrameInfo& info, bool salvage);
+    void salvage_packet_();
     packet::PacketPtr read_packet_();
 
     void set_frame_flags_(Frame& frame, const FrameInfo& info);
@@ -82,6 +175,7 @@ private:
 
     packet::IReader& reader_;
     IFrameDecoder& payload_decoder_;
+    LossConcealer* concealer_;
 
     const audio::SampleSpec sample_spec_;
 
@@ -93,6 +187,20 @@ private:
     packet::timestamp_t missing_samples_;
     packet::timestamp_t packet_samples_;
 
+    // capture time of the sample with given rtp timestamp
+    packet::ntp_timestamp_t capture_ts_;
+    packet::timestamp_t capture_rtp_ts_;
+
+    packet::seqnum_t last_seqnum_;
+    bool has_last_seqnum_;
+
+    // set if last read packet continues previous one without loss
+    bool last_contiguous_;
+    // set if gap before current packet is a dtx pause
+    bool dtx_gap_;
+
+    DepacketizerMetrics metrics_;
+
     core::RateLimiter rate_limiter_;
 
     bool first_packet_;
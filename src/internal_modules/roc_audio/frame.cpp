@@ -16,7 +16,8 @@ namespace audio {
 Frame::Frame(sample_t* samples, size_t num_samples)
     : samples_(samples)
     , num_samples_(num_samples)
-    , flags_(0) {
+    , flags_(0)
+    , has_level_(false) {
     if (!samples) {
         roc_panic("frame: can't create frame with null samples");
     }
@@ -33,6 +34,25 @@ unsigned Frame::flags() const {
     return flags_;
 }
 
+void Frame::set_level(const FrameLevel& level) {
+    if (has_level_) {
+        roc_panic("frame: can't set level more than once");
+    }
+    level_ = level;
+    has_level_ = true;
+}
+
+bool Frame::has_level() const {
+    return has_level_;
+}
+
+const FrameLevel& Frame::level() const {
+    if (!has_level_) {
+        roc_panic("frame: level is not set");
+    }
+    return level_;
+}
+
 sample_t* Frame::samples() const {
     return samples_;
 }
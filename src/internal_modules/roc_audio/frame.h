@@ -12,6 +12,7 @@
 #ifndef ROC_AUDIO_FRAME_H_
 #define ROC_AUDIO_FRAME_H_
 
+#include "roc_audio/frame_level.h"
 #include "roc_audio/sample.h"
 #include "roc_core/noncopyable.h"
 
@@ -38,7 +39,13 @@ public:
 
         //! Set if some late packets were dropped while the frame was being built.
         //! It's not necessarty that the frame itself is blank or incomplete.
-        FlagDrops = (1 << 2)
+        FlagDrops = (1 << 2),
+
+        //! Set if all samples of the frame are known to be zero.
+        //! Unlike lack of FlagNonblank, which only tells that there were no packets
+        //! (and the frame may be filled with beeps), this flag guarantees that
+        //! samples are zero, so consumers may skip processing them.
+        FlagZeros = (1 << 3)
     };
 
     //! Set flags.
@@ -47,6 +54,21 @@ public:
     //! Get flags.
     unsigned flags() const;
 
+    //! Set signal level of frame samples.
+    //! @remarks
+    //!  Level is computed by the stage that produces samples, e.g. during
+    //!  decoding, when samples are still in cache, so that consumers like
+    //!  mixer don't need separate passes over samples.
+    void set_level(const FrameLevel& level);
+
+    //! Check if signal level was set.
+    bool has_level() const;
+
+    //! Get signal level of frame samples.
+    //! @pre
+    //!  Should be called only if has_level() is true.
+    const FrameLevel& level() const;
+
     //! Get frame data.
     sample_t* samples() const;
 
@@ -60,6 +82,9 @@ private:
     sample_t* samples_;
     size_t num_samples_;
     unsigned flags_;
+
+    FrameLevel level_;
+    bool has_level_;
 };
 
 } // namespace audio
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/frame_level.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+FrameLevel::FrameLevel()
+    : sum_squares_(0)
+    , num_samples_(0)
+    , peak_(0) {
+}
+
+void FrameLevel::add_samples(const sample_t* samples, size_t n_samples) {
+    roc_panic_if(!samples && n_samples != 0);
+
+    // Accumulate in float, which is vectorized by compiler, and add the
+    // result to double sum, which doesn't lose precision for long sequences.
+    sample_t sum = 0;
+    sample_t peak = peak_;
+
+    for (size_t n = 0; n < n_samples; n++) {
+        const sample_t s = samples[n];
+        sum += s * s;
+
+        const sample_t a = s < 0 ? -s : s;
+        if (a > peak) {
+            peak = a;
+        }
+    }
+
+    sum_squares_ += (double)sum;
+    num_samples_ += n_samples;
+    peak_ = peak;
+}
+
+void FrameLevel::add_zeros(size_t n_samples) {
+    num_samples_ += n_samples;
+}
+
+void FrameLevel::add_level(const FrameLevel& level) {
+    sum_squares_ += level.sum_squares_;
+    num_samples_ += level.num_samples_;
+    if (level.peak_ > peak_) {
+        peak_ = level.peak_;
+    }
+}
+
+size_t FrameLevel::num_samples() const {
+    return num_samples_;
+}
+
+sample_t FrameLevel::mean_square() const {
+    if (num_samples_ == 0) {
+        return 0;
+    }
+    return sample_t(sum_squares_ / (double)num_samples_);
+}
+
+sample_t FrameLevel::rms() const {
+    return sample_t(std::sqrt((double)mean_square()));
+}
+
+sample_t FrameLevel::peak() const {
+    return peak_;
+}
+
+} // namespace audio
+} // namespace roc
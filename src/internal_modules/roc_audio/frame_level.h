@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/frame_level.h
+//! @brief Frame level.
+
+#ifndef ROC_AUDIO_FRAME_LEVEL_H_
+#define ROC_AUDIO_FRAME_LEVEL_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Signal level of a sequence of samples.
+//! @remarks
+//!  Accumulates sum of squares and peak of samples, so that levels of
+//!  adjacent parts of a frame can be combined into level of the whole frame.
+class FrameLevel {
+public:
+    //! Initialize empty level.
+    FrameLevel();
+
+    //! Account samples.
+    void add_samples(const sample_t* samples, size_t n_samples);
+
+    //! Account zero samples.
+    void add_zeros(size_t n_samples);
+
+    //! Account level of following samples.
+    void add_level(const FrameLevel& level);
+
+    //! Get number of accounted samples.
+    size_t num_samples() const;
+
+    //! Get mean square of samples.
+    sample_t mean_square() const;
+
+    //! Get root mean square of samples.
+    sample_t rms() const;
+
+    //! Get maximum absolute value of samples.
+    sample_t peak() const;
+
+private:
+    double sum_squares_;
+    size_t num_samples_;
+    sample_t peak_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_FRAME_LEVEL_H_
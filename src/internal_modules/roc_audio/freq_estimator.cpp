@@ -7,6 +7,7 @@
  */
 
 #include "roc_audio/freq_estimator.h"
+#include "roc_core/log.h"
 #include "roc_core/panic.h"
 
 namespace roc {
@@ -14,6 +15,11 @@ namespace audio {
 
 namespace {
 
+// Smoothing factor of exponential filter used in fast phase. Enough to suppress
+// sawtooth caused by packet granularity of latency, but adds delay of only ten
+// updates, in contrast to decimators.
+const float FastFilterCoeff = 0.1f;
+
 // Calculates dot product of arrays IR of filter (@p coeff) and input array (@p samples).
 //
 // - @p coeff Filter impulse response.
@@ -45,7 +51,10 @@ FreqEstimator::FreqEstimator(FreqEstimatorConfig config,
     , dec2_ind_(0)
     , samples_counter_(0)
     , accum_(0)
-    , coeff_(1) {
+    , coeff_(1)
+    , fast_(config.P_fast > 0)
+    , fast_filtered_(target_)
+    , stable_counter_(0) {
     roc_panic_if_msg(config_.decimation_factor1 == 0,
                      "freq_estimator: decimation "
                      "factor 1 must not be zero");
@@ -59,27 +68,80 @@ FreqEstimator::FreqEstimator(FreqEstimatorConfig config,
         roc_panic("freq estimator: decim_len should be power of two");
     }
 
-    memset(dec1_casc_buff_, 0, sizeof(dec1_casc_buff_));
-    memset(dec2_casc_buff_, 0, sizeof(dec2_casc_buff_));
-
-    for (size_t i = 0; i < fe_decim_len; i++) {
-        dec1_casc_buff_[i] = target_;
-        dec2_casc_buff_[i] = target_;
-    }
+    reset_decimators_();
 }
 
 float FreqEstimator::freq_coeff() const {
     return coeff_;
 }
 
+bool FreqEstimator::is_fast() const {
+    return fast_;
+}
+
 void FreqEstimator::update(packet::timestamp_t current) {
     float filtered;
 
-    if (run_decimators_(current, filtered)) {
+    // decimators always run, so that they're ready when fast phase finishes
+    const bool has_filtered = run_decimators_(current, filtered);
+
+    if (config_.P_fast > 0) {
+        fast_filtered_ += ((float)current - fast_filtered_) * FastFilterCoeff;
+        update_phase_(fast_filtered_);
+    }
+
+    if (fast_) {
+        coeff_ = run_fast_controller_(fast_filtered_);
+    } else if (has_filtered) {
         coeff_ = run_controller_(filtered);
     }
 }
 
+void FreqEstimator::restart() {
+    reset_decimators_();
+
+    dec1_ind_ = 0;
+    dec2_ind_ = 0;
+    samples_counter_ = 0;
+
+    fast_filtered_ = target_;
+    stable_counter_ = 0;
+
+    if (config_.P_fast > 0 && !fast_) {
+        fast_ = true;
+        accum_ = config_.I_fast > 0 ? accum_ * config_.I / config_.I_fast : 0;
+    }
+}
+
+void FreqEstimator::set_target_latency(packet::timestamp_t target_latency) {
+    target_ = (float)target_latency;
+}
+
+float FreqEstimator::drift() const {
+    return integral_gain_() * accum_;
+}
+
+void FreqEstimator::set_drift(float drift) {
+    const float gain = integral_gain_();
+
+    accum_ = gain > 0 ? drift / gain : 0;
+    coeff_ = 1 + gain * accum_;
+}
+
+float FreqEstimator::integral_gain_() const {
+    return fast_ ? config_.I_fast : config_.I;
+}
+
+void FreqEstimator::reset_decimators_() {
+    memset(dec1_casc_buff_, 0, sizeof(dec1_casc_buff_));
+    memset(dec2_casc_buff_, 0, sizeof(dec2_casc_buff_));
+
+    for (size_t i = 0; i < fe_decim_len; i++) {
+        dec1_casc_buff_[i] = target_;
+        dec2_casc_buff_[i] = target_;
+    }
+}
+
 bool FreqEstimator::run_decimators_(packet::timestamp_t current, float& filtered) {
     samples_counter_++;
 
@@ -123,5 +185,48 @@ float FreqEstimator::run_controller_(float current) {
     return 1 + config_.P * error + config_.I * accum_;
 }
 
+float FreqEstimator::run_fast_controller_(float current) {
+    const float error = (current - target_);
+
+    // integrate only near target, otherwise integrator winds up while latency
+    // is far away and scaling is trimmed, and then overshoots
+    if (std::abs(error) <= target_ * config_.stable_tolerance) {
+        accum_ = accum_ + error;
+    }
+    return 1 + config_.P_fast * error + config_.I_fast * accum_;
+}
+
+void FreqEstimator::update_phase_(float current) {
+    const float error = (current - target_);
+
+    if (fast_) {
+        if (std::abs(error) > target_ * config_.stable_tolerance) {
+            stable_counter_ = 0;
+            return;
+        }
+
+        if (++stable_counter_ < config_.stable_updates) {
+            return;
+        }
+
+        roc_log(LogDebug, "freq estimator: latency is stable, leaving fast phase");
+
+        // integral term holds estimated clock drift, rescale integrator
+        // to keep it when switching gains
+        fast_ = false;
+        accum_ = config_.I > 0 ? accum_ * config_.I_fast / config_.I : 0;
+    } else {
+        if (std::abs(error) <= target_ * config_.recovery_tolerance) {
+            return;
+        }
+
+        roc_log(LogDebug, "freq estimator: latency is unstable, entering fast phase");
+
+        fast_ = true;
+        stable_counter_ = 0;
+        accum_ = config_.I_fast > 0 ? accum_ * config_.I / config_.I_fast : 0;
+    }
+}
+
 } // namespace audio
 } // namespace roc
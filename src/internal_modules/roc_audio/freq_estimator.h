@@ -33,11 +33,36 @@ struct FreqEstimatorConfig {
     //! decimation stage.
     size_t decimation_factor2;
 
+    //! Proportional gain of PI-controller during fast phase.
+    //! Fast phase is used after start and when latency deviates from target
+    //! too much. In this phase, controller runs on every update, using lightly
+    //! smoothed input instead of decimators output, and with higher gains.
+    //! Zero disables fast phase.
+    float P_fast;
+    float I_fast; //!< Integral gain of PI-controller during fast phase.
+
+    //! Relative deviation of latency from target at which latency is considered
+    //! stable. When latency remains stable during stable_updates consecutive
+    //! updates, fast phase is finished.
+    float stable_tolerance;
+
+    //! Number of consecutive updates with stable latency to finish fast phase.
+    size_t stable_updates;
+
+    //! Relative deviation of latency from target at which fast phase is
+    //! started again.
+    float recovery_tolerance;
+
     FreqEstimatorConfig()
         : P(100e-8f)
         , I(0.5e-8f)
         , decimation_factor1(fe_decim_factor_max)
-        , decimation_factor2(fe_decim_factor_max) {
+        , decimation_factor2(fe_decim_factor_max)
+        , P_fast(2e-5f)
+        , I_fast(5e-8f)
+        , stable_tolerance(0.05f)
+        , stable_updates(200)
+        , recovery_tolerance(0.25f) {
     }
 };
 
@@ -53,15 +78,49 @@ public:
     //! Get current frequecy coefficient.
     float freq_coeff() const;
 
+    //! Check if estimator is in fast phase.
+    bool is_fast() const;
+
     //! Compute new value of frequency coefficient.
     void update(packet::timestamp_t current_latency);
 
+    //! Restart estimation after latency jump.
+    //! @remarks
+    //!  Forgets latency history, assumes that latency is now equal to target,
+    //!  and enters fast phase, if it's enabled. Estimated clock drift is kept.
+    void restart();
+
+    //! Change target latency.
+    //! @remarks
+    //!  Coefficient is not changed immediately; controller gradually steers
+    //!  the latency towards the new target during following updates.
+    void set_target_latency(packet::timestamp_t target_latency);
+
+    //! Get estimated clock drift.
+    //! @remarks
+    //!  Returns integral term of controller, i.e. how much frequency coefficient
+    //!  differs from one when latency is equal to target.
+    float drift() const;
+
+    //! Set estimated clock drift.
+    //! @remarks
+    //!  Overrides integral term of controller, e.g. with value returned by
+    //!  drift() in previous run, so that estimation doesn't have to converge
+    //!  from scratch. Frequency coefficient is updated immediately.
+    void set_drift(float drift);
+
 private:
+    void reset_decimators_();
     bool run_decimators_(packet::timestamp_t current, float& filtered);
     float run_controller_(float current);
+    float run_fast_controller_(float current);
+
+    void update_phase_(float current);
+
+    float integral_gain_() const;
 
     const FreqEstimatorConfig config_;
-    const float target_; // Target latency.
+    float target_; // Target latency.
 
     float dec1_casc_buff_[fe_decim_len];
     size_t dec1_ind_;
@@ -73,6 +132,10 @@ private:
     float accum_;            // Integrator value.
 
     float coeff_; // Current frequency coefficient value.
+
+    bool fast_;
+    float fast_filtered_; // Smoothed input for fast phase.
+    size_t stable_counter_;
 };
 
 } // namespace audio
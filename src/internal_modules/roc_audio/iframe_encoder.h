@@ -26,6 +26,8 @@ public:
     virtual ~IFrameEncoder();
 
     //! Get encoded frame size in bytes for given number of samples per channel.
+    //! @remarks
+    //!  Returns zero if the encoder can't produce frames of such duration.
     virtual size_t encoded_byte_count(size_t num_samples) const = 0;
 
     //! Start encoding a new frame.
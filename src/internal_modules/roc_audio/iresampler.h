@@ -13,6 +13,7 @@
 #define ROC_AUDIO_IRESAMPLER_H_
 
 #include "roc_audio/frame.h"
+#include "roc_audio/resampler_profile.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
 
@@ -32,6 +33,14 @@ public:
     //!  Returns false if the scaling is invalid or out of bounds.
     virtual bool set_scaling(size_t input_rate, size_t output_rate, float multiplier) = 0;
 
+    //! Switch to another quality profile.
+    //! @remarks
+    //!  Can be called at any time between frames, e.g. to reduce CPU load under
+    //!  pressure. Stream position and buffered input are kept, so there is no
+    //!  gap or discontinuity in output. Returns false if the profile can't be
+    //!  used with current scaling; then the current profile is kept.
+    virtual bool set_profile(ResamplerProfile profile) = 0;
+
     //! Get buffer to be filled with input data.
     //! @remarks
     //!  After this call, the caller should fill returned buffer with input
@@ -19,8 +19,8 @@ const core::nanoseconds_t LogInterval = 5 * core::Second;
 
 } // namespace
 
-LatencyMonitor::LatencyMonitor(const packet::SortedQueue& queue,
-                               const Depacketizer& depacketizer,
+LatencyMonitor::LatencyMonitor(const packet::SeqnumQueue& queue,
+                               Depacketizer& depacketizer,
                                ResamplerReader* resampler,
                                const LatencyMonitorConfig& config,
                                core::nanoseconds_t target_latency,
@@ -37,23 +37,40 @@ LatencyMonitor::LatencyMonitor(const packet::SortedQueue& queue,
           config.fe_update_interval))
     , update_pos_(0)
     , has_update_pos_(false)
-    , target_latency_(
+    , max_target_latency_(
           (packet::timestamp_t)input_sample_spec.ns_2_rtp_timestamp(target_latency))
+    , min_target_latency_((packet::timestamp_t)input_sample_spec.ns_2_rtp_timestamp(
+          config.min_adaptive_latency))
+    , target_latency_(max_target_latency_)
     , min_latency_(input_sample_spec.ns_2_rtp_timestamp(config.min_latency))
     , max_latency_(input_sample_spec.ns_2_rtp_timestamp(config.max_latency))
     , max_scaling_delta_(config.max_scaling_delta)
+    , catchup_enabled_(config.catchup)
+    , adaptive_(config.adaptive_latency && resampler != NULL)
+    , sync_(config.sync_playback && resampler != NULL)
+    , network_delay_(0)
+    , has_network_delay_(false)
+    , max_target_step_((float)update_interval_ * config.max_scaling_delta / 2)
+    , adaptive_target_((float)max_target_latency_)
+    , e2e_offset_(0)
     , input_sample_spec_(input_sample_spec)
     , output_sample_spec_(output_sample_spec)
+    , niq_latency_(0)
+    , scaling_(1.0f)
+    , has_external_scaling_(false)
+    , external_scaling_(1.0f)
     , valid_(false) {
     roc_log(LogDebug,
             "latency monitor: initializing:"
-            " target_latency=%lu(%.3fms) in_rate=%lu out_rate=%lu",
+            " target_latency=%lu(%.3fms) in_rate=%lu out_rate=%lu adaptive=%d"
+            " sync=%d",
             (unsigned long)target_latency_,
             (double)input_sample_spec_.rtp_timestamp_2_ns(
                 (packet::timestamp_diff_t)target_latency_)
                 / core::Millisecond,
             (unsigned long)input_sample_spec_.sample_rate(),
-            (unsigned long)output_sample_spec_.sample_rate());
+            (unsigned long)output_sample_spec_.sample_rate(), (int)adaptive_,
+            (int)sync_);
 
     if (config.fe_update_interval <= 0) {
         roc_log(LogError, "latency monitor: invalid config: fe_update_interval=%ld",
@@ -70,6 +87,18 @@ LatencyMonitor::LatencyMonitor(const packet::SortedQueue& queue,
         return;
     }
 
+    if ((adaptive_ || sync_)
+        && (config.min_adaptive_latency <= 0
+            || config.min_adaptive_latency > target_latency
+            || config.min_adaptive_latency < config.min_latency)) {
+        roc_log(LogError,
+                "latency monitor: invalid_config:"
+                " min_adaptive_latency=%ldns target_latency=%ldns min_latency=%ldns",
+                (long)config.min_adaptive_latency, (long)target_latency,
+                (long)config.min_latency);
+        return;
+    }
+
     if (resampler_) {
         if (!init_resampler_(input_sample_spec.sample_rate(),
                              output_sample_spec.sample_rate())) {
@@ -94,14 +123,27 @@ bool LatencyMonitor::valid() const {
 }
 
 bool LatencyMonitor::update(packet::timestamp_t pos) {
+    if (depacketizer_.in_dtx_pause()) {
+        // sender doesn't send packets, so queue tail doesn't advance and
+        // latency would look lower than it is; keep current scaling
+        return true;
+    }
+
     packet::timestamp_diff_t latency = 0;
 
     if (!get_latency_(latency)) {
         return true;
     }
 
+    niq_latency_ = latency;
+
     if (!check_latency_(latency)) {
-        return false;
+        if (!catchup_enabled_ || latency < min_latency_) {
+            return false;
+        }
+        if (!catchup_(latency)) {
+            return false;
+        }
     }
 
     if (resampler_) {
@@ -118,6 +160,115 @@ bool LatencyMonitor::update(packet::timestamp_t pos) {
     return true;
 }
 
+void LatencyMonitor::set_network_delay(core::nanoseconds_t delay) {
+    if (delay < 0) {
+        delay = 0;
+    }
+
+    network_delay_ = (packet::timestamp_t)input_sample_spec_.ns_2_rtp_timestamp(delay);
+    has_network_delay_ = true;
+}
+
+void LatencyMonitor::set_e2e_latency(core::nanoseconds_t e2e_latency) {
+    if (!sync_) {
+        return;
+    }
+
+    // queue latency would be steered to (target - offset), keep it within
+    // [min_target_latency_, target_latency_]
+    packet::timestamp_diff_t offset =
+        input_sample_spec_.ns_2_rtp_timestamp(e2e_latency) - niq_latency_;
+
+    if (offset < 0) {
+        offset = 0;
+    }
+    if (offset > (packet::timestamp_diff_t)(target_latency_ - min_target_latency_)) {
+        offset = (packet::timestamp_diff_t)(target_latency_ - min_target_latency_);
+    }
+
+    e2e_offset_ = (packet::timestamp_t)offset;
+}
+
+void LatencyMonitor::set_external_scaling(bool enabled, float scaling) {
+    if (enabled != has_external_scaling_) {
+        roc_log(LogDebug, "latency monitor: %s external scaling",
+                enabled ? "enabling" : "disabling");
+
+        if (!enabled) {
+            // latency history collected before following is no longer relevant
+            fe_.restart();
+        }
+
+        has_external_scaling_ = enabled;
+    }
+
+    external_scaling_ = enabled ? scaling : 1.0f;
+}
+
+LatencyMonitorMetrics LatencyMonitor::metrics() const {
+    LatencyMonitorMetrics metrics;
+    metrics.niq_latency = input_sample_spec_.rtp_timestamp_2_ns(niq_latency_);
+    metrics.target_latency = input_sample_spec_.rtp_timestamp_2_ns(
+        (packet::timestamp_diff_t)target_latency_);
+    metrics.scaling = scaling_;
+    return metrics;
+}
+
+LatencyMonitorState LatencyMonitor::state() const {
+    LatencyMonitorState state;
+    state.drift = has_external_scaling_ ? external_scaling_ - 1.0f : fe_.drift();
+    state.scaling = scaling_;
+    state.target_latency = input_sample_spec_.rtp_timestamp_2_ns(
+        (packet::timestamp_diff_t)target_latency_);
+    return state;
+}
+
+bool LatencyMonitor::restore_state(const LatencyMonitorState& state) {
+    if (!resampler_) {
+        return false;
+    }
+
+    if (adaptive_ && state.target_latency > 0) {
+        float target = (float)input_sample_spec_.ns_2_rtp_timestamp(state.target_latency);
+
+        if (target < (float)min_target_latency_) {
+            target = (float)min_target_latency_;
+        }
+        if (target > (float)max_target_latency_) {
+            target = (float)max_target_latency_;
+        }
+
+        adaptive_target_ = target;
+        target_latency_ = (packet::timestamp_t)(adaptive_target_ + 0.5f);
+
+        fe_.set_target_latency(target_latency_);
+        // decimators are filled with old target
+        fe_.restart();
+    }
+
+    fe_.set_drift(state.drift);
+
+    const float trimmed_coeff = trim_scaling_(state.scaling);
+
+    roc_log(LogDebug,
+            "latency monitor: restoring state:"
+            " drift=%.7f scaling=%.5f target=%lu(%.3fms)",
+            (double)state.drift, (double)trimmed_coeff, (unsigned long)target_latency_,
+            (double)input_sample_spec_.rtp_timestamp_2_ns(
+                (packet::timestamp_diff_t)target_latency_)
+                / core::Millisecond);
+
+    if (!resampler_->set_scaling(trimmed_coeff)) {
+        roc_log(LogDebug, "latency monitor: scaling factor out of bounds: trim_fe=%.5f",
+                (double)trimmed_coeff);
+        return false;
+    }
+
+    scaling_ = trimmed_coeff;
+
+    return true;
+}
+
 bool LatencyMonitor::get_latency_(packet::timestamp_diff_t& latency) const {
     if (!depacketizer_.started()) {
         return false;
@@ -125,7 +276,7 @@ bool LatencyMonitor::get_latency_(packet::timestamp_diff_t& latency) const {
 
     const packet::timestamp_t head = depacketizer_.timestamp();
 
-    packet::PacketPtr latest = queue_.latest();
+    const packet::Packet* latest = queue_.latest();
     if (!latest) {
         return false;
     }
@@ -164,6 +315,33 @@ bool LatencyMonitor::check_latency_(packet::timestamp_diff_t latency) const {
     return true;
 }
 
+bool LatencyMonitor::catchup_(packet::timestamp_diff_t& latency) {
+    const packet::timestamp_t n_samples =
+        (packet::timestamp_t)(latency - (packet::timestamp_diff_t)target_latency_);
+
+    roc_log(LogDebug,
+            "latency monitor: catching up: latency=%ld(%.3fms) target=%lu(%.3fms)",
+            (long)latency,
+            (double)input_sample_spec_.rtp_timestamp_2_ns(latency) / core::Millisecond,
+            (unsigned long)target_latency_,
+            (double)input_sample_spec_.rtp_timestamp_2_ns(
+                (packet::timestamp_diff_t)target_latency_)
+                / core::Millisecond);
+
+    depacketizer_.skip(n_samples);
+
+    // latency history is no longer relevant
+    fe_.restart();
+
+    if (!get_latency_(latency)) {
+        return false;
+    }
+
+    niq_latency_ = latency;
+
+    return check_latency_(latency);
+}
+
 float LatencyMonitor::trim_scaling_(float freq_coeff) const {
     const float min_coeff = 1.0f - max_scaling_delta_;
     const float max_coeff = 1.0f + max_scaling_delta_;
@@ -205,17 +383,23 @@ bool LatencyMonitor::update_resampler_(packet::timestamp_t pos,
     }
 
     while (pos >= update_pos_) {
-        fe_.update(latency);
+        if (adaptive_) {
+            update_target_();
+        }
+        if (!has_external_scaling_) {
+            fe_.update(latency + e2e_offset_);
+        }
         update_pos_ += update_interval_;
     }
 
-    const float freq_coeff = fe_.freq_coeff();
+    const float freq_coeff = has_external_scaling_ ? external_scaling_ : fe_.freq_coeff();
     const float trimmed_coeff = trim_scaling_(freq_coeff);
 
     if (rate_limiter_.allow()) {
         roc_log(LogDebug,
                 "latency monitor:"
-                " latency=%lu(%.3fms) target=%lu(%.3fms) fe=%.5f trim_fe=%.5f",
+                " latency=%lu(%.3fms) target=%lu(%.3fms) e2e_offset=%lu(%.3fms)"
+                " fe=%.5f trim_fe=%.5f fast=%d",
                 (unsigned long)latency,
                 (double)input_sample_spec_.rtp_timestamp_2_ns(
                     (packet::timestamp_diff_t)latency)
@@ -224,9 +408,15 @@ bool LatencyMonitor::update_resampler_(packet::timestamp_t pos,
                 (double)input_sample_spec_.rtp_timestamp_2_ns(
                     (packet::timestamp_diff_t)target_latency_)
                     / core::Millisecond,
-                (double)freq_coeff, (double)trimmed_coeff);
+                (unsigned long)e2e_offset_,
+                (double)input_sample_spec_.rtp_timestamp_2_ns(
+                    (packet::timestamp_diff_t)e2e_offset_)
+                    / core::Millisecond,
+                (double)freq_coeff, (double)trimmed_coeff, (int)fe_.is_fast());
     }
 
+    scaling_ = trimmed_coeff;
+
     if (!resampler_->set_scaling(trimmed_coeff)) {
         roc_log(LogDebug,
                 "latency monitor: scaling factor out of bounds: fe=%.5f trim_fe=%.5f",
@@ -237,6 +427,34 @@ bool LatencyMonitor::update_resampler_(packet::timestamp_t pos,
     return true;
 }
 
+void LatencyMonitor::update_target_() {
+    // until we have enough measurements, stick to configured latency
+    if (!has_network_delay_) {
+        return;
+    }
+
+    float wanted = (float)min_target_latency_ + (float)network_delay_;
+
+    if (wanted > (float)max_target_latency_) {
+        wanted = (float)max_target_latency_;
+    }
+
+    if (wanted > adaptive_target_ + max_target_step_) {
+        adaptive_target_ += max_target_step_;
+    } else if (wanted < adaptive_target_ - max_target_step_) {
+        adaptive_target_ -= max_target_step_;
+    } else {
+        adaptive_target_ = wanted;
+    }
+
+    const packet::timestamp_t new_target = (packet::timestamp_t)(adaptive_target_ + 0.5f);
+
+    if (new_target != target_latency_) {
+        target_latency_ = new_target;
+        fe_.set_target_latency(target_latency_);
+    }
+}
+
 void LatencyMonitor::report_latency_(packet::timestamp_diff_t latency) {
     if (rate_limiter_.allow()) {
         roc_log(LogDebug, "latency monitor: latency=%ld(%.3fms) target=%lu(%.3fms)",
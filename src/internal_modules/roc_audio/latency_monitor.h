@@ -19,7 +19,7 @@
 #include "roc_core/noncopyable.h"
 #include "roc_core/rate_limiter.h"
 #include "roc_core/time.h"
-#include "roc_packet/sorted_queue.h"
+#include "roc_packet/seqnum_queue.h"
 #include "roc_packet/units.h"
 
 namespace roc {
@@ -36,19 +36,93 @@ struct LatencyMonitorConfig {
     core::nanoseconds_t min_latency;
 
     //! Maximum allowed latency, nanoseconds.
-    //! If the latency goes out of bounds, the session is terminated.
+    //! If the latency goes out of bounds, the session is terminated, unless
+    //! catch-up is enabled.
     core::nanoseconds_t max_latency;
 
+    //! Enable catch-up.
+    //! If enabled, when the latency goes above max_latency, the session
+    //! skips samples to bring the latency back to the target latency, instead
+    //! of being terminated.
+    bool catchup;
+
     //! Maximum allowed freq_coeff delta around one.
     //! If the scaling goes out of bounds, it is trimmed.
     //! For example, 0.01 allows freq_coeff values in range [0.99; 1.01].
     float max_scaling_delta;
 
+    //! Enable adaptive target latency.
+    //! If enabled, target latency is lowered on clean links and raised on noisy
+    //! ones, according to measured delay variation and loss bursts. The target
+    //! never goes above the configured target latency or below
+    //! min_adaptive_latency. Has effect only if resampler is enabled.
+    bool adaptive_latency;
+
+    //! Minimum adaptive target latency, nanoseconds.
+    //! Adaptive target is this value plus network delay passed to
+    //! LatencyMonitor::set_network_delay(). Also limits how low the latency
+    //! may be steered in synchronized playback mode.
+    core::nanoseconds_t min_adaptive_latency;
+
+    //! Enable synchronized playback.
+    //! If enabled, target latency defines end-to-end latency, from capture on
+    //! sender to playback on receiver, measured by LatencyMonitor::set_e2e_latency().
+    //! FreqEstimator slowly steers resampler to keep it, so that receivers with
+    //! synchronized clocks play the same samples at the same time. Has effect
+    //! only if resampler is enabled.
+    bool sync_playback;
+
     LatencyMonitorConfig()
         : fe_update_interval(5 * core::Millisecond)
         , min_latency(0)
         , max_latency(0)
-        , max_scaling_delta(0.005f) {
+        , catchup(true)
+        , max_scaling_delta(0.005f)
+        , adaptive_latency(false)
+        , min_adaptive_latency(20 * core::Millisecond)
+        , sync_playback(false) {
+    }
+};
+
+//! Latency monitor metrics.
+struct LatencyMonitorMetrics {
+    //! Latency of network incoming queue, nanoseconds.
+    //! Difference between the last received and the next played sample.
+    core::nanoseconds_t niq_latency;
+
+    //! Current target latency, nanoseconds.
+    //! Differs from configured target latency if adaptive latency is enabled.
+    core::nanoseconds_t target_latency;
+
+    //! Current scaling factor passed to resampler.
+    float scaling;
+
+    LatencyMonitorMetrics()
+        : niq_latency(0)
+        , target_latency(0)
+        , scaling(1.0f) {
+    }
+};
+
+//! Latency monitor state.
+//! @remarks
+//!  Can be saved when session ends and restored in a new session from the
+//!  same sender, to skip convergence of clock drift estimation.
+struct LatencyMonitorState {
+    //! Estimated clock drift.
+    //! @see FreqEstimator::drift().
+    float drift;
+
+    //! Scaling factor passed to resampler.
+    float scaling;
+
+    //! Target latency, nanoseconds.
+    core::nanoseconds_t target_latency;
+
+    LatencyMonitorState()
+        : drift(0)
+        , scaling(1.0f)
+        , target_latency(0) {
     }
 };
 
@@ -57,20 +131,24 @@ struct LatencyMonitorConfig {
 //!  - calculates session scaling factor
 //!  - trims scaling factor to the allowed range
 //!  - updates resampler scaling
+//!  - skips samples if the latency goes above upper bound
 //!  - shutdowns session if the latency goes out of bounds
+//!  - optionally, adapts target latency to measured network jitter
+//!  - freezes scaling while depacketizer is inside DTX pause
 class LatencyMonitor : public core::NonCopyable<> {
 public:
     //! Constructor.
     //!
     //! @b Parameters
-    //!  - @p queue and @p depacketizer are used to calculate the latency
+    //!  - @p queue and @p depacketizer are used to calculate the latency;
+    //!    @p depacketizer is also used to skip samples during catch-up
     //!  - @p resampler is used to set the scaling factor, may be null
     //!  - @p config defines various miscellaneous parameters
     //!  - @p target_latency defines FreqEstimator target latency, in samples
     //!  - @p input_sample_spec is the sample spec of the input packets
     //!  - @p output_sample_spec is the sample spec of the output frames
-    LatencyMonitor(const packet::SortedQueue& queue,
-                   const Depacketizer& depacketizer,
+    LatencyMonitor(const packet::SeqnumQueue& queue,
+                   Depacketizer& depacketizer,
                    ResamplerReader* resampler,
                    const LatencyMonitorConfig& config,
                    core::nanoseconds_t target_latency,
@@ -86,19 +164,64 @@ public:
     //!  false if the session should be terminated.
     bool update(packet::timestamp_t time);
 
+    //! Set network delay estimate.
+    //! @remarks
+    //!  @p delay is how much latency is needed to absorb network delay
+    //!  variation and loss bursts, nanoseconds. Used to compute target
+    //!  latency if adaptive latency is enabled. Until the first call, target
+    //!  latency stays equal to configured one.
+    void set_network_delay(core::nanoseconds_t delay);
+
+    //! Set end-to-end latency estimate.
+    //! @remarks
+    //!  @p e2e_latency is the difference between playback time of the last
+    //!  played sample and its capture time on sender, nanoseconds. Used to
+    //!  steer latency if synchronized playback is enabled. Until the first
+    //!  call, the network incoming queue latency is steered instead.
+    void set_e2e_latency(core::nanoseconds_t e2e_latency);
+
+    //! Set external scaling factor.
+    //! @remarks
+    //!  Used when several sessions share one sender clock: one of them runs its
+    //!  FreqEstimator, and others pass its scaling to their resamplers instead
+    //!  of running their own. Latency bounds and catch-up still work as usual.
+    //!  If @p enabled is false, @p scaling is ignored and own FreqEstimator is
+    //!  used again; it's restarted when following stops.
+    void set_external_scaling(bool enabled, float scaling);
+
+    //! Get metrics computed during last update.
+    LatencyMonitorMetrics metrics() const;
+
+    //! Get current state.
+    //! @remarks
+    //!  When following external scaling, it is saved as clock drift.
+    LatencyMonitorState state() const;
+
+    //! Restore state obtained from state(), possibly in another process.
+    //! @remarks
+    //!  Should be called before the first update. Clock drift and scaling are
+    //!  restored immediately. Target latency is restored only if adaptive
+    //!  latency is enabled, and is clamped to the allowed range.
+    //! @returns
+    //!  false if resampler is disabled or rejected restored scaling.
+    bool restore_state(const LatencyMonitorState& state);
+
 private:
     bool get_latency_(packet::timestamp_diff_t& latency) const;
     bool check_latency_(packet::timestamp_diff_t latency) const;
+    bool catchup_(packet::timestamp_diff_t& latency);
 
     float trim_scaling_(float scaling) const;
 
     bool init_resampler_(size_t input_sample_rate, size_t output_sample_rate);
     bool update_resampler_(packet::timestamp_t time, packet::timestamp_t latency);
 
+    void update_target_();
+
     void report_latency_(packet::timestamp_diff_t latency);
 
-    const packet::SortedQueue& queue_;
-    const Depacketizer& depacketizer_;
+    const packet::SeqnumQueue& queue_;
+    Depacketizer& depacketizer_;
     ResamplerReader* resampler_;
     FreqEstimator fe_;
 
@@ -108,15 +231,40 @@ private:
     packet::timestamp_t update_pos_;
     bool has_update_pos_;
 
-    const packet::timestamp_t target_latency_;
+    const packet::timestamp_t max_target_latency_;
+    const packet::timestamp_t min_target_latency_;
+    packet::timestamp_t target_latency_;
     const packet::timestamp_diff_t min_latency_;
     const packet::timestamp_diff_t max_latency_;
 
     const float max_scaling_delta_;
 
+    const bool catchup_enabled_;
+
+    const bool adaptive_;
+    const bool sync_;
+    packet::timestamp_t network_delay_;
+    bool has_network_delay_;
+
+    // adaptive target is moved smoothly, by no more than this number of
+    // samples per update interval, so that scaling doesn't saturate
+    const float max_target_step_;
+    float adaptive_target_;
+
+    // how much end-to-end latency is larger than queue latency, used
+    // to steer end-to-end latency in synchronized playback mode
+    packet::timestamp_t e2e_offset_;
+
     const audio::SampleSpec input_sample_spec_;
     const audio::SampleSpec output_sample_spec_;
 
+    packet::timestamp_diff_t niq_latency_;
+    float scaling_;
+
+    // scaling of another session with the same sender clock, if following it
+    bool has_external_scaling_;
+    float external_scaling_;
+
     bool valid_;
 };
 
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/loss_concealer.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+// shortest and longest pitch periods (400 Hz and ~67 Hz)
+const core::nanoseconds_t MinPitch = 2500 * core::Microsecond;
+const core::nanoseconds_t MaxPitch = 15 * core::Millisecond;
+
+// length of signal compared when estimating pitch
+const core::nanoseconds_t CorrLength = 20 * core::Millisecond;
+
+// pitch search is first performed on every n-th sample and lag, where n
+// is chosen to make the search rate close to this one, and then refined
+const size_t CoarseRate = 8000;
+
+// synthetic signal is played at full volume during hold time, and then
+// linearly attenuated down to silence at the end of fade time
+const core::nanoseconds_t HoldLength = 10 * core::Millisecond;
+const core::nanoseconds_t FadeLength = 60 * core::Millisecond;
+
+// length of crossfade from synthetic signal to decoded samples
+const core::nanoseconds_t CrossfadeLength = 2500 * core::Microsecond;
+
+size_t duration_2_samples(const SampleSpec& sample_spec, core::nanoseconds_t duration) {
+    const size_t n_samples = sample_spec.ns_2_samples_per_chan(duration);
+    return n_samples != 0 ? n_samples : 1;
+}
+
+} // namespace
+
+LossConcealer::LossConcealer(const SampleSpec& sample_spec, core::IAllocator& allocator)
+    : num_channels_(sample_spec.num_channels())
+    , min_pitch_(duration_2_samples(sample_spec, MinPitch))
+    , max_pitch_(duration_2_samples(sample_spec, MaxPitch))
+    , corr_len_(duration_2_samples(sample_spec, CorrLength))
+    , coarse_step_(std::max(sample_spec.sample_rate() / CoarseRate, (size_t)1))
+    , hold_len_(duration_2_samples(sample_spec, HoldLength))
+    , fade_len_(duration_2_samples(sample_spec, FadeLength))
+    , xfade_len_(duration_2_samples(sample_spec, CrossfadeLength))
+    , history_(allocator)
+    , history_len_(max_pitch_ + corr_len_)
+    , history_size_(0)
+    , period_(allocator)
+    , pitch_(0)
+    , pitch_pos_(0)
+    , synth_pos_(0)
+    , xfade_pos_(0)
+    , concealing_(false)
+    , crossfading_(false)
+    , valid_(false) {
+    if (num_channels_ == 0) {
+        roc_panic("loss concealer: num_channels is zero");
+    }
+
+    if (!history_.resize(history_len_ * num_channels_)
+        || !period_.resize(max_pitch_ * num_channels_)) {
+        roc_log(LogError, "loss concealer: can't allocate history");
+        return;
+    }
+
+    roc_log(LogDebug,
+            "loss concealer: initializing: n_channels=%lu min_pitch=%lu max_pitch=%lu",
+            (unsigned long)num_channels_, (unsigned long)min_pitch_,
+            (unsigned long)max_pitch_);
+
+    valid_ = true;
+}
+
+bool LossConcealer::valid() const {
+    return valid_;
+}
+
+bool LossConcealer::concealing() const {
+    return concealing_;
+}
+
+size_t LossConcealer::process(sample_t* samples, size_t n_samples) {
+    roc_panic_if_not(valid());
+
+    if (concealing_) {
+        concealing_ = false;
+        crossfading_ = true;
+        xfade_pos_ = 0;
+    }
+
+    size_t n = 0;
+
+    if (crossfading_) {
+        for (; n < n_samples && xfade_pos_ < xfade_len_; n++, xfade_pos_++) {
+            const sample_t w = sample_t(xfade_pos_ + 1) / sample_t(xfade_len_ + 1);
+
+            for (size_t c = 0; c < num_channels_; c++) {
+                sample_t& s = samples[n * num_channels_ + c];
+                s = s * w + synth_sample_(c) * (1 - w);
+            }
+
+            advance_synth_();
+        }
+
+        if (xfade_pos_ == xfade_len_) {
+            crossfading_ = false;
+        }
+    }
+
+    append_history_(samples, n_samples);
+
+    return n;
+}
+
+void LossConcealer::conceal(sample_t* samples, size_t n_samples) {
+    roc_panic_if_not(valid());
+
+    if (!concealing_ && !start_concealment_()) {
+        memset(samples, 0, n_samples * num_channels_ * sizeof(sample_t));
+        append_history_(samples, n_samples);
+        return;
+    }
+
+    for (size_t n = 0; n < n_samples; n++) {
+        for (size_t c = 0; c < num_channels_; c++) {
+            samples[n * num_channels_ + c] = synth_sample_(c);
+        }
+        advance_synth_();
+    }
+
+    append_history_(samples, n_samples);
+}
+
+size_t LossConcealer::history_length() const {
+    return history_len_;
+}
+
+void LossConcealer::repair(const sample_t* samples, size_t n_samples, size_t delay) {
+    roc_panic_if_not(valid());
+
+    if (delay >= history_size_) {
+        return;
+    }
+
+    // samples cover history positions [end - n_samples, end)
+    const size_t end = history_size_ - delay;
+    const size_t skip = n_samples > end ? n_samples - end : 0;
+    const size_t begin = end - (n_samples - skip);
+
+    memcpy(history_.data() + begin * num_channels_, samples + skip * num_channels_,
+           (end - begin) * num_channels_ * sizeof(sample_t));
+}
+
+bool LossConcealer::start_concealment_() {
+    crossfading_ = false;
+
+    if (history_size_ < history_len_) {
+        return false;
+    }
+
+    pitch_ = find_pitch_();
+    pitch_pos_ = 0;
+    synth_pos_ = 0;
+
+    // period is copied, because history is overwritten by synthetic signal
+    memcpy(period_.data(),
+           history_.data() + (history_len_ - pitch_) * num_channels_,
+           pitch_ * num_channels_ * sizeof(sample_t));
+
+    concealing_ = true;
+
+    roc_log(LogTrace, "loss concealer: starting concealment: pitch=%lu",
+            (unsigned long)pitch_);
+
+    return true;
+}
+
+size_t LossConcealer::find_pitch_() const {
+    size_t best_lag = max_pitch_;
+    double best_score = 0;
+
+    for (size_t lag = min_pitch_; lag <= max_pitch_; lag += coarse_step_) {
+        const double score = pitch_score_(lag, coarse_step_);
+        if (score > best_score) {
+            best_score = score;
+            best_lag = lag;
+        }
+    }
+
+    if (coarse_step_ == 1) {
+        return best_lag;
+    }
+
+    const size_t from = std::max(best_lag - std::min(best_lag, coarse_step_), min_pitch_);
+    const size_t to = std::min(best_lag + coarse_step_, max_pitch_);
+
+    best_score = 0;
+
+    for (size_t lag = from; lag <= to; lag++) {
+        const double score = pitch_score_(lag, 1);
+        if (score > best_score) {
+            best_score = score;
+            best_lag = lag;
+        }
+    }
+
+    return best_lag;
+}
+
+// correlation between the end of history and the signal delayed by lag,
+// normalized by energy of the delayed signal
+double LossConcealer::pitch_score_(size_t lag, size_t stride) const {
+    double corr = 0;
+    double energy = 0;
+
+    for (size_t n = history_len_ - corr_len_; n < history_len_; n += stride) {
+        const double delayed = (double)mono_sample_(n - lag);
+
+        corr += (double)mono_sample_(n) * delayed;
+        energy += delayed * delayed;
+    }
+
+    if (!(energy > 0)) {
+        return 0;
+    }
+
+    return corr / std::sqrt(energy);
+}
+
+sample_t LossConcealer::mono_sample_(size_t pos) const {
+    const sample_t* frame = history_.data() + pos * num_channels_;
+
+    sample_t sum = 0;
+    for (size_t c = 0; c < num_channels_; c++) {
+        sum += frame[c];
+    }
+
+    return sum / sample_t(num_channels_);
+}
+
+sample_t LossConcealer::synth_sample_(size_t chan) const {
+    if (synth_pos_ >= fade_len_) {
+        return 0;
+    }
+
+    sample_t gain = 1;
+    if (synth_pos_ >= hold_len_) {
+        gain = sample_t(fade_len_ - synth_pos_) / sample_t(fade_len_ - hold_len_);
+    }
+
+    return period_[pitch_pos_ * num_channels_ + chan] * gain;
+}
+
+void LossConcealer::advance_synth_() {
+    pitch_pos_ = (pitch_pos_ + 1) % pitch_;
+
+    if (synth_pos_ < fade_len_) {
+        synth_pos_++;
+    }
+}
+
+void LossConcealer::append_history_(const sample_t* samples, size_t n_samples) {
+    sample_t* history = history_.data();
+
+    if (n_samples >= history_len_) {
+        memcpy(history, samples + (n_samples - history_len_) * num_channels_,
+               history_len_ * num_channels_ * sizeof(sample_t));
+        history_size_ = history_len_;
+        return;
+    }
+
+    if (history_size_ + n_samples > history_len_) {
+        const size_t shift = history_size_ + n_samples - history_len_;
+
+        memmove(history, history + shift * num_channels_,
+                (history_size_ - shift) * num_channels_ * sizeof(sample_t));
+        history_size_ -= shift;
+    }
+
+    memcpy(history + history_size_ * num_channels_, samples,
+           n_samples * num_channels_ * sizeof(sample_t));
+    history_size_ += n_samples;
+}
+
+} // namespace audio
+} // namespace roc
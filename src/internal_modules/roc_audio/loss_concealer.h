@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/loss_concealer.h
+//! @brief Packet loss concealer.
+
+#ifndef ROC_AUDIO_LOSS_CONCEALER_H_
+#define ROC_AUDIO_LOSS_CONCEALER_H_
+
+#include "roc_audio/sample.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/array.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+
+namespace roc {
+namespace audio {
+
+//! Packet loss concealer.
+//!
+//! Fills gaps caused by lost packets with a synthetic signal instead of
+//! silence, using pitch waveform replication:
+//!  - keeps a short history of recent output samples
+//!  - when a gap begins, estimates pitch period of the history using
+//!    normalized autocorrelation of its mono downmix
+//!  - fills the gap by repeating the last pitch period, gradually
+//!    attenuating it, so that long gaps fade out to silence
+//!  - when decoded samples resume, crossfades the synthetic signal into them
+//!
+//! Works with interleaved samples of any number of channels.
+class LossConcealer : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p sample_spec defines sample rate and channels of the stream
+    //!  - @p allocator is used to allocate history
+    LossConcealer(const SampleSpec& sample_spec, core::IAllocator& allocator);
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Check if a gap is being concealed.
+    bool concealing() const;
+
+    //! Handle decoded samples.
+    //! @remarks
+    //!  Adds samples to history. If they follow a concealed gap, the beginning
+    //!  of samples is modified in place to crossfade from the synthetic signal.
+    //!  @p n_samples defines number of samples per channel.
+    //! @returns
+    //!  number of samples per channel modified by crossfade.
+    size_t process(sample_t* samples, size_t n_samples);
+
+    //! Fill missing samples.
+    //! @remarks
+    //!  Writes synthetic signal continuing the history. If there is not enough
+    //!  history yet, writes zeros. @p n_samples defines number of samples per
+    //!  channel.
+    void conceal(sample_t* samples, size_t n_samples);
+
+    //! Get length of history, in samples per channel.
+    size_t history_length() const;
+
+    //! Replace samples in history with samples received too late.
+    //! @remarks
+    //!  @p samples were already played, e.g. concealed, and the last of them
+    //!  is @p delay samples behind the last sample added to history. They
+    //!  replace the corresponding part of history, so that following
+    //!  concealment continues the real signal. Samples older than history
+    //!  are ignored. @p n_samples and @p delay define number of samples per
+    //!  channel.
+    void repair(const sample_t* samples, size_t n_samples, size_t delay);
+
+private:
+    bool start_concealment_();
+
+    size_t find_pitch_() const;
+    double pitch_score_(size_t lag, size_t stride) const;
+    sample_t mono_sample_(size_t pos) const;
+
+    sample_t synth_sample_(size_t chan) const;
+    void advance_synth_();
+
+    void append_history_(const sample_t* samples, size_t n_samples);
+
+    const size_t num_channels_;
+
+    const size_t min_pitch_;
+    const size_t max_pitch_;
+    const size_t corr_len_;
+    const size_t coarse_step_;
+
+    const size_t hold_len_;
+    const size_t fade_len_;
+    const size_t xfade_len_;
+
+    // last output samples, oldest first
+    core::Array<sample_t> history_;
+    const size_t history_len_;
+    size_t history_size_;
+
+    // pitch period repeated during concealment
+    core::Array<sample_t> period_;
+    size_t pitch_;
+    size_t pitch_pos_;
+
+    // samples synthesized since beginning of gap
+    size_t synth_pos_;
+
+    size_t xfade_pos_;
+
+    bool concealing_;
+    bool crossfading_;
+    bool valid_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_LOSS_CONCEALER_H_
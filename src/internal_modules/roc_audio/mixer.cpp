@@ -7,50 +7,316 @@
  */
 
 #include "roc_audio/mixer.h"
+#include "roc_core/attributes.h"
+#include "roc_core/cpu_dispatch.h"
 #include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/tracepoint.h"
+
+#if ROC_CPU_FAMILY == ROC_CPU_FAMILY_X86 && defined(ROC_ATTR_TARGET)
+#define ROC_MIXER_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ROC_MIXER_NEON
+#include <arm_neon.h>
+#endif
 
 namespace roc {
 namespace audio {
 
 namespace {
 
-sample_t clamp(const sample_t x) {
-    if (x > SampleMax) {
-        return SampleMax;
-    } else if (x < SampleMin) {
-        return SampleMin;
-    } else {
-        return x;
+// Weight of the last block in smoothed energy of input.
+// Makes energy follow speech onsets within a few blocks.
+const sample_t EnergySmoothing = 0.2f;
+
+// Energy of a selected input is multiplied by this factor when comparing it
+// with other inputs, so that inputs with similar levels don't flap.
+const sample_t SelectionHysteresis = 2;
+
+void add_range(sample_t* out,
+               sample_t out_gain,
+               const sample_t* const* in,
+               const sample_t* in_gains,
+               size_t n_in,
+               size_t begin,
+               size_t end) {
+    for (size_t n = begin; n < end; n++) {
+        sample_t acc = out[n] * out_gain;
+        for (size_t i = 0; i < n_in; i++) {
+            acc += in[i][n] * in_gains[i];
+        }
+        out[n] = acc;
+    }
+}
+
+void add_generic(sample_t* out,
+                 sample_t out_gain,
+                 const sample_t* const* in,
+                 const sample_t* in_gains,
+                 size_t n_in,
+                 size_t n_samples) {
+    add_range(out, out_gain, in, in_gains, n_in, 0, n_samples);
+}
+
+// gains are interpolated from "from" to "to" values during the block,
+// channels of one sample share the same gain
+void add_ramp(sample_t* out,
+              sample_t out_from,
+              sample_t out_to,
+              const sample_t* const* in,
+              const sample_t* in_from,
+              const sample_t* in_to,
+              size_t n_in,
+              size_t n_samples,
+              size_t num_channels) {
+    const size_t n_frames = n_samples / num_channels;
+
+    for (size_t f = 0; f < n_frames; f++) {
+        const sample_t pos = sample_t(f + 1) / sample_t(n_frames);
+        const sample_t out_gain = out_from + (out_to - out_from) * pos;
+
+        for (size_t c = 0; c < num_channels; c++) {
+            const size_t n = f * num_channels + c;
+
+            sample_t acc = out[n] * out_gain;
+            for (size_t i = 0; i < n_in; i++) {
+                acc += in[i][n] * (in_from[i] + (in_to[i] - in_from[i]) * pos);
+            }
+            out[n] = acc;
+        }
+    }
+}
+
+void clamp_generic(sample_t* out, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        if (out[n] > SampleMax) {
+            out[n] = SampleMax;
+        } else if (out[n] < SampleMin) {
+            out[n] = SampleMin;
+        }
+    }
+}
+
+#ifdef ROC_MIXER_X86
+
+ROC_ATTR_TARGET("sse2")
+void add_sse2(sample_t* out,
+              sample_t out_gain,
+              const sample_t* const* in,
+              const sample_t* in_gains,
+              size_t n_in,
+              size_t n_samples) {
+    const __m128 og = _mm_set1_ps(out_gain);
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        __m128 acc = _mm_mul_ps(_mm_loadu_ps(out + n), og);
+        for (size_t i = 0; i < n_in; i++) {
+            acc = _mm_add_ps(
+                acc, _mm_mul_ps(_mm_loadu_ps(in[i] + n), _mm_set1_ps(in_gains[i])));
+        }
+        _mm_storeu_ps(out + n, acc);
+    }
+
+    add_range(out, out_gain, in, in_gains, n_in, n, n_samples);
+}
+
+ROC_ATTR_TARGET("sse2")
+void clamp_sse2(sample_t* out, size_t n_samples) {
+    const __m128 lo = _mm_set1_ps(SampleMin);
+    const __m128 hi = _mm_set1_ps(SampleMax);
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        _mm_storeu_ps(out + n, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(out + n), lo), hi));
     }
+
+    clamp_generic(out + n, n_samples - n);
 }
 
+ROC_ATTR_TARGET("avx2")
+void add_avx2(sample_t* out,
+              sample_t out_gain,
+              const sample_t* const* in,
+              const sample_t* in_gains,
+              size_t n_in,
+              size_t n_samples) {
+    const __m256 og = _mm256_set1_ps(out_gain);
+
+    size_t n = 0;
+
+    for (; n + 8 <= n_samples; n += 8) {
+        __m256 acc = _mm256_mul_ps(_mm256_loadu_ps(out + n), og);
+        for (size_t i = 0; i < n_in; i++) {
+            acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(in[i] + n),
+                                                   _mm256_set1_ps(in_gains[i])));
+        }
+        _mm256_storeu_ps(out + n, acc);
+    }
+
+    add_range(out, out_gain, in, in_gains, n_in, n, n_samples);
+}
+
+ROC_ATTR_TARGET("avx2")
+void clamp_avx2(sample_t* out, size_t n_samples) {
+    const __m256 lo = _mm256_set1_ps(SampleMin);
+    const __m256 hi = _mm256_set1_ps(SampleMax);
+
+    size_t n = 0;
+
+    for (; n + 8 <= n_samples; n += 8) {
+        _mm256_storeu_ps(out + n,
+                         _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(out + n), lo), hi));
+    }
+
+    clamp_generic(out + n, n_samples - n);
+}
+
+#endif // ROC_MIXER_X86
+
+#ifdef ROC_MIXER_NEON
+
+void add_neon(sample_t* out,
+              sample_t out_gain,
+              const sample_t* const* in,
+              const sample_t* in_gains,
+              size_t n_in,
+              size_t n_samples) {
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        float32x4_t acc = vmulq_n_f32(vld1q_f32(out + n), out_gain);
+        for (size_t i = 0; i < n_in; i++) {
+            acc = vmlaq_n_f32(acc, vld1q_f32(in[i] + n), in_gains[i]);
+        }
+        vst1q_f32(out + n, acc);
+    }
+
+    add_range(out, out_gain, in, in_gains, n_in, n, n_samples);
+}
+
+void clamp_neon(sample_t* out, size_t n_samples) {
+    const float32x4_t lo = vdupq_n_f32(SampleMin);
+    const float32x4_t hi = vdupq_n_f32(SampleMax);
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        vst1q_f32(out + n, vminq_f32(vmaxq_f32(vld1q_f32(out + n), lo), hi));
+    }
+
+    clamp_generic(out + n, n_samples - n);
+}
+
+#endif // ROC_MIXER_NEON
+
+struct MixerTable {
+    void (*add)(sample_t* out,
+                sample_t out_gain,
+                const sample_t* const* in,
+                const sample_t* in_gains,
+                size_t n_in,
+                size_t n_samples);
+    void (*clamp)(sample_t* out, size_t n_samples);
+};
+
+const core::CpuVariant<MixerTable> mixer_variants[] = {
+#ifdef ROC_MIXER_X86
+    { core::CpuFeature_AVX2, { add_avx2, clamp_avx2 } },
+    { core::CpuFeature_SSE2, { add_sse2, clamp_sse2 } },
+#endif
+#ifdef ROC_MIXER_NEON
+    { core::CpuFeature_NEON, { add_neon, clamp_neon } },
+#endif
+    { core::CpuFeature_Generic, { add_generic, clamp_generic } },
+};
+
+struct MixerVariants {
+    typedef MixerTable Table;
+
+    static const char* name() {
+        return "mixer";
+    }
+
+    static const core::CpuVariant<Table>* variants(size_t& n_variants) {
+        n_variants = ROC_ARRAY_SIZE(mixer_variants);
+        return mixer_variants;
+    }
+};
+
 } // namespace
 
+MixerInput::MixerInput(IFrameReader& reader, const MixerInputConfig& config)
+    : reader_(reader)
+    , config_(config)
+    , gain_(config.gain)
+    , unity_config_(config.gain >= 1 && config.gain <= 1)
+    , gain_selected_(true)
+    , gain_ducked_(false)
+    , unity_(unity_config_)
+    , ramping_(false)
+    , muted_(false)
+    , energy_(0)
+    , score_(0)
+    , selected_(true) {
+}
+
+IFrameReader& MixerInput::reader() const {
+    return reader_;
+}
+
+const MixerInputConfig& MixerInput::config() const {
+    return config_;
+}
+
 Mixer::Mixer(core::BufferFactory<sample_t>& buffer_factory,
              core::nanoseconds_t frame_length,
-             const audio::SampleSpec& sample_spec)
-    : valid_(false) {
+             const audio::SampleSpec& sample_spec,
+             size_t max_active_inputs)
+    : num_channels_(sample_spec.num_channels())
+    , max_active_inputs_(max_active_inputs)
+    , duck_priority_(0)
+    , active_priority_(0)
+    , add_fn_(core::CpuDispatch<MixerVariants>::table().add)
+    , clamp_fn_(core::CpuDispatch<MixerVariants>::table().clamp)
+    , valid_(false) {
     size_t frame_size = sample_spec.ns_2_samples_overall(frame_length);
-    roc_log(LogDebug, "mixer: initializing: frame_size=%lu", (unsigned long)frame_size);
+    roc_log(LogDebug,
+            "mixer: initializing: frame_size=%lu max_block_size=%lu"
+            " max_active_inputs=%lu",
+            (unsigned long)frame_size, (unsigned long)buffer_factory.buffer_size(),
+            (unsigned long)max_active_inputs);
 
     if (frame_size == 0) {
         roc_log(LogError, "mixer: frame size cannot be 0");
         return;
     }
 
-    temp_buf_ = buffer_factory.new_buffer();
-    if (!temp_buf_) {
-        roc_log(LogError, "mixer: can't allocate temporary buffer");
-        return;
-    }
+    for (size_t i = 0; i < MaxBatch; i++) {
+        temp_bufs_[i] = buffer_factory.new_buffer();
+        if (!temp_bufs_[i]) {
+            roc_log(LogError, "mixer: can't allocate temporary buffer");
+            return;
+        }
 
-    if (temp_buf_.capacity() < frame_size) {
-        roc_log(LogError, "mixer: allocated buffer is too small");
-        return;
+        if (temp_bufs_[i].capacity() < frame_size) {
+            roc_log(LogError, "mixer: allocated buffer is too small");
+            return;
+        }
+        // Use whole buffer, so that the output frame is split into as few
+        // blocks as possible, regardless of the internal frame length.
+        // Block size is kept multiple of number of channels, so that gain
+        // ramps don't split samples.
+        temp_bufs_[i].reslice(
+            0, temp_bufs_[i].capacity() / num_channels_ * num_channels_);
     }
-    temp_buf_.reslice(0, frame_size);
 
     valid_ = true;
 }
@@ -59,32 +325,54 @@ bool Mixer::valid() const {
     return valid_;
 }
 
-void Mixer::add_input(IFrameReader& reader) {
+void Mixer::add_input(MixerInput& input) {
     roc_panic_if(!valid_);
 
-    readers_.push_back(reader);
+    // New input is mixed until there is enough inputs louder than it.
+    input.energy_ = 0;
+    input.selected_ = max_active_inputs_ == 0 || inputs_.size() < max_active_inputs_;
+
+    input.gain_ = target_gain_(input);
+    input.gain_selected_ = input.selected_;
+    input.gain_ducked_ = is_ducked_(input);
+
+    inputs_.push_back(input);
 }
 
-void Mixer::remove_input(IFrameReader& reader) {
+void Mixer::remove_input(MixerInput& input) {
     roc_panic_if(!valid_);
 
-    readers_.remove(reader);
+    inputs_.remove(input);
 }
 
 bool Mixer::read(Frame& frame) {
     roc_panic_if(!valid_);
 
-    if (readers_.size() == 1) {
-        readers_.front()->read(frame);
-        return true;
+    roc_tracepoint(mixer_mix, (const void*)this, (unsigned long)inputs_.size(),
+                   (unsigned long)frame.num_samples());
+
+    if (inputs_.size() == 1) {
+        MixerInput& input = *inputs_.front();
+
+        if (keeps_unity_gain_(input)) {
+            if (!input.reader_.read(frame)) {
+                memset(frame.samples(), 0, frame.num_samples() * sizeof(sample_t));
+                frame.set_flags(Frame::FlagZeros);
+            } else if (!(frame.flags() & Frame::FlagZeros)) {
+                // input may be out of range even if it's not mixed with others
+                clamp_fn_(frame.samples(), frame.num_samples());
+            }
+            return true;
+        }
     }
 
-    const size_t max_read = temp_buf_.size();
+    const size_t max_read = temp_bufs_[0].size();
 
     sample_t* samples = frame.samples();
     size_t n_samples = frame.num_samples();
 
     unsigned flags = 0;
+    bool zeros = true;
 
     while (n_samples != 0) {
         size_t n_read = n_samples;
@@ -92,36 +380,253 @@ bool Mixer::read(Frame& frame) {
             n_read = max_read;
         }
 
-        read_(samples, n_read, flags);
+        if (!read_(samples, n_read, flags)) {
+            zeros = false;
+        }
 
         samples += n_read;
         n_samples -= n_read;
     }
 
+    if (zeros) {
+        flags |= Frame::FlagZeros;
+    }
+
     frame.set_flags(flags);
 
     return true;
 }
 
-void Mixer::read_(sample_t* data, size_t size, unsigned& flags) {
+bool Mixer::read_(sample_t* data, size_t size, unsigned& flags) {
     roc_panic_if(!data);
     roc_panic_if(size == 0);
 
-    memset(data, 0, size * sizeof(sample_t));
+    // Ducking of this block is decided by activity during previous block.
+    duck_priority_ = active_priority_;
+    active_priority_ = 0;
+
+    // Same for selection of loudest inputs.
+    if (max_active_inputs_ != 0) {
+        select_inputs_();
+    }
+
+    MixerInput* ip = inputs_.front();
+
+    // First input that has samples writes directly into the output buffer,
+    // so that we don't need to zeroise it and then copy from temporary buffer.
+    // Its gain is applied during the first pass of accumulation.
+    unsigned first_flags = 0;
+    sample_t out_from = 1, out_to = 1;
+    bool out_unity = true;
+
+    for (; ip; ip = inputs_.nextof(*ip)) {
+        Frame frame(data, size);
+        if (read_input_(*ip, frame, out_from, out_to)) {
+            first_flags = frame.flags();
+            break;
+        }
+    }
+
+    if (!ip) {
+        memset(data, 0, size * sizeof(sample_t));
+        return false;
+    }
+
+    flags |= (first_flags & ~(unsigned)Frame::FlagZeros);
+
+    out_unity = ip->unity_;
+    // whether some gain in current pass of accumulation changes
+    bool ramp = ip->ramping_;
 
-    for (IFrameReader* rp = readers_.front(); rp; rp = readers_.nextof(*rp)) {
-        sample_t* temp_data = temp_buf_.data();
+    // Inputs with FlagZeros and inputs muted by selection are skipped. If the
+    // input in the output buffer is skipped, the next mixed input replaces it.
+    const bool muted = ip->muted_;
+    bool zeros = (first_flags & Frame::FlagZeros) || muted;
+
+    const sample_t* batch[MaxBatch];
+    sample_t batch_from[MaxBatch];
+    sample_t batch_to[MaxBatch];
+    size_t batch_size = 0;
+
+    for (ip = inputs_.nextof(*ip); ip; ip = inputs_.nextof(*ip)) {
+        sample_t* temp_data = temp_bufs_[batch_size].data();
+        sample_t gain_from = 1, gain_to = 1;
 
         Frame temp_frame(temp_data, size);
-        if (!rp->read(temp_frame)) {
+        if (!read_input_(*ip, temp_frame, gain_from, gain_to)) {
+            continue;
+        }
+
+        flags |= (temp_frame.flags() & ~(unsigned)Frame::FlagZeros);
+
+        if (temp_frame.flags() & Frame::FlagZeros) {
+            continue;
+        }
+
+        if (ip->muted_) {
             continue;
         }
 
-        for (size_t n = 0; n < size; n++) {
-            data[n] = clamp(data[n] + temp_data[n]);
+        if (zeros) {
+            memcpy(data, temp_data, size * sizeof(sample_t));
+            out_from = gain_from;
+            out_to = gain_to;
+            out_unity = ip->unity_;
+            ramp = ip->ramping_;
+            zeros = false;
+            continue;
+        }
+
+        batch[batch_size] = temp_data;
+        batch_from[batch_size] = gain_from;
+        batch_to[batch_size] = gain_to;
+        batch_size++;
+
+        if (ip->ramping_) {
+            ramp = true;
+        }
+
+        if (batch_size == MaxBatch) {
+            add_(data, ramp, out_from, out_to, batch, batch_from, batch_to, batch_size,
+                 size);
+            out_from = out_to = 1;
+            out_unity = true;
+            ramp = false;
+            batch_size = 0;
         }
+    }
+
+    if (!zeros && (batch_size != 0 || !out_unity)) {
+        add_(data, ramp, out_from, out_to, batch, batch_from, batch_to, batch_size,
+             size);
+    }
+
+    if (!zeros) {
+        clamp_fn_(data, size);
+    }
+
+    if (zeros && muted) {
+        memset(data, 0, size * sizeof(sample_t));
+    }
+
+    return zeros;
+}
+
+bool Mixer::read_input_(MixerInput& input,
+                        Frame& frame,
+                        sample_t& gain_from,
+                        sample_t& gain_to) {
+    const bool ducked = is_ducked_(input);
+
+    input.ramping_ = input.selected_ != input.gain_selected_
+        || ducked != input.gain_ducked_;
+    input.unity_ = !input.ramping_ && input.selected_ && !ducked && input.unity_config_;
+    input.muted_ = !input.selected_ && !input.gain_selected_;
+
+    input.gain_selected_ = input.selected_;
+    input.gain_ducked_ = ducked;
+
+    gain_from = input.gain_;
+    gain_to = target_gain_(input);
 
-        flags |= temp_frame.flags();
+    input.gain_ = gain_to;
+
+    if (!input.reader_.read(frame)) {
+        return false;
+    }
+
+    if (!(frame.flags() & Frame::FlagZeros)) {
+        active_priority_ = std::max(active_priority_, input.config_.priority);
+    }
+
+    if (max_active_inputs_ != 0) {
+        update_energy_(input, frame);
+    }
+
+    return true;
+}
+
+sample_t Mixer::target_gain_(const MixerInput& input) const {
+    if (!input.selected_) {
+        return 0;
+    }
+    if (is_ducked_(input)) {
+        return input.config_.gain * input.config_.duck_gain;
+    }
+    return input.config_.gain;
+}
+
+bool Mixer::is_ducked_(const MixerInput& input) const {
+    return input.config_.priority < duck_priority_;
+}
+
+// Checks if gain of input is one now and will stay one in next block.
+bool Mixer::keeps_unity_gain_(const MixerInput& input) const {
+    return input.unity_config_ && input.selected_ && input.gain_selected_
+        && !is_ducked_(input) && !input.gain_ducked_;
+}
+
+// Selects max_active_inputs_ inputs with highest energy.
+// Takes O(N*K) time, which is cheap for small K compared with mixing itself.
+void Mixer::select_inputs_() {
+    MixerInput* ip;
+
+    if (inputs_.size() <= max_active_inputs_) {
+        for (ip = inputs_.front(); ip; ip = inputs_.nextof(*ip)) {
+            ip->selected_ = true;
+        }
+        return;
+    }
+
+    for (ip = inputs_.front(); ip; ip = inputs_.nextof(*ip)) {
+        ip->score_ = ip->selected_ ? ip->energy_ * SelectionHysteresis : ip->energy_;
+        ip->selected_ = false;
+    }
+
+    for (size_t n = 0; n < max_active_inputs_; n++) {
+        MixerInput* loudest = NULL;
+
+        for (ip = inputs_.front(); ip; ip = inputs_.nextof(*ip)) {
+            if (!ip->selected_ && (!loudest || ip->score_ > loudest->score_)) {
+                loudest = ip;
+            }
+        }
+
+        loudest->selected_ = true;
+    }
+}
+
+void Mixer::update_energy_(MixerInput& input, const Frame& frame) {
+    sample_t energy = 0;
+
+    if (!(frame.flags() & Frame::FlagZeros)) {
+        if (frame.has_level()) {
+            // computed by decoder, no need for extra pass over samples
+            energy = frame.level().mean_square();
+        } else {
+            FrameLevel level;
+            level.add_samples(frame.samples(), frame.num_samples());
+            energy = level.mean_square();
+        }
+    }
+
+    input.energy_ += (energy - input.energy_) * EnergySmoothing;
+}
+
+void Mixer::add_(sample_t* out,
+                 bool ramp,
+                 sample_t out_from,
+                 sample_t out_to,
+                 const sample_t* const* in,
+                 const sample_t* in_from,
+                 const sample_t* in_to,
+                 size_t n_in,
+                 size_t n_samples) {
+    if (ramp) {
+        add_ramp(out, out_from, out_to, in, in_from, in_to, n_in, n_samples,
+                 num_channels_);
+    } else {
+        add_fn_(out, out_from, in, in_from, n_in, n_samples);
     }
 }
 
@@ -25,6 +25,68 @@
 namespace roc {
 namespace audio {
 
+//! Mixer input parameters.
+struct MixerInputConfig {
+    //! Gain applied to input samples.
+    sample_t gain;
+
+    //! Ducking priority.
+    //! While there is an active input with higher priority, i.e. an input
+    //! producing frames without Frame::FlagZeros, this input is ducked.
+    unsigned int priority;
+
+    //! Gain applied on top of gain while input is ducked.
+    sample_t duck_gain;
+
+    MixerInputConfig()
+        : gain(1)
+        , priority(0)
+        , duck_gain(0.25f) {
+    }
+};
+
+//! Mixer input.
+//! Frame reader with its level in the mix. Owned by user.
+class MixerInput : public core::ListNode {
+public:
+    //! Initialize.
+    MixerInput(IFrameReader& reader, const MixerInputConfig& config);
+
+    //! Get frame reader.
+    IFrameReader& reader() const;
+
+    //! Get input parameters.
+    const MixerInputConfig& config() const;
+
+private:
+    friend class Mixer;
+
+    IFrameReader& reader_;
+    const MixerInputConfig config_;
+
+    // gain applied at the end of last block
+    sample_t gain_;
+    // whether configured gain is exactly one
+    const bool unity_config_;
+    // whether gain_ was computed for selected and for ducked input; gain
+    // changes only when one of them changes, so gains aren't compared
+    bool gain_selected_;
+    bool gain_ducked_;
+    // whether gain is exactly one during whole current block
+    bool unity_;
+    // whether gain changes during current block
+    bool ramping_;
+    // whether input stays unselected during current block, so its gain is zero
+    bool muted_;
+
+    // smoothed mean square of input samples
+    sample_t energy_;
+    // energy used to rank input during selection
+    sample_t score_;
+    // whether input is among loudest inputs mixed in current block
+    bool selected_;
+};
+
 //! Mixer.
 //! Mixes multiple input streams into one output stream.
 //!
@@ -38,27 +100,56 @@ namespace audio {
 //! @code
 //!  5, 7, 9, ...
 //! @endcode
+//!
+//! The first input is read directly into the output frame. Remaining inputs
+//! are accumulated into it in batches of several readers per pass using
+//! the fastest kernel supported by CPU, and the result is clamped once,
+//! after all inputs were added, even if there is only one input. Inputs with
+//! Frame::FlagZeros are skipped.
+//!
+//! Every input is multiplied by its gain in the same pass, so level control
+//! doesn't need separate passes over samples. Ducking is decided per block,
+//! from input activity during previous block. When gain of an input changes,
+//! it's ramped linearly during one block to avoid clicks; such blocks are
+//! mixed by a slower non-vectorized kernel.
+//!
+//! For large conferences, the number of mixed inputs may be limited. Then
+//! mixer tracks smoothed energy of every input and mixes only the loudest
+//! inputs, at their full level. Energy is taken from frame level computed by
+//! decoder, or by an extra pass over samples if frame doesn't have level.
+//! Selection is decided per block, from energy measured during previous
+//! blocks; inputs entering or leaving the selection are ramped in or out.
+//! All inputs are still read, so that they stay in sync with the output.
+//!
+//! Since mixer is a frame reader itself, it can be used as an input of
+//! another mixer, which allows to build a tree of mixers, e.g. pre-mixing
+//! groups of inputs into partial sums that are prefetched by worker threads.
 class Mixer : public IFrameReader, public core::NonCopyable<> {
 public:
     //! Initialize.
     //!
     //! @b Parameters
-    //!  - @p buffer_factory is used to allocate a temporary buffer of samples
-    //!  - @p frame_length defines the temporary buffer length used to
-    //!    read from, in nanoseconds
+    //!  - @p buffer_factory is used to allocate temporary buffers of samples
+    //!  - @p frame_length defines the minimum temporary buffer length used to
+    //!    read from, in nanoseconds; output frames are mixed in blocks of the
+    //!    whole buffer size, which may be larger, so the block size doesn't
+    //!    depend on internal frame length
     //!  - @p sample_spec defines the sample spec taken from the audio signal
+    //!  - @p max_active_inputs defines how many loudest inputs are mixed;
+    //!    zero means that all inputs are mixed
     Mixer(core::BufferFactory<sample_t>& buffer_factory,
           core::nanoseconds_t frame_length,
-          const audio::SampleSpec& sample_spec);
+          const audio::SampleSpec& sample_spec,
+          size_t max_active_inputs = 0);
 
     //! Check if the mixer was succefully constructed.
     bool valid() const;
 
-    //! Add input reader.
-    void add_input(IFrameReader&);
+    //! Add input.
+    void add_input(MixerInput&);
 
-    //! Remove input reader.
-    void remove_input(IFrameReader&);
+    //! Remove input.
+    void remove_input(MixerInput&);
 
     //! Read audio frame.
     //! @remarks
@@ -67,10 +158,52 @@ public:
     virtual bool read(Frame& frame);
 
 private:
-    void read_(sample_t* out_data, size_t out_sz, unsigned& flags);
+    //! Maximum number of inputs accumulated in one pass.
+    enum { MaxBatch = 4 };
+
+    // Returns true if there were inputs and all of them had FlagZeros.
+    bool read_(sample_t* out_data, size_t out_sz, unsigned& flags);
+
+    bool read_input_(MixerInput& input,
+                     Frame& frame,
+                     sample_t& gain_from,
+                     sample_t& gain_to);
+
+    sample_t target_gain_(const MixerInput& input) const;
+    bool is_ducked_(const MixerInput& input) const;
+    bool keeps_unity_gain_(const MixerInput& input) const;
+
+    void select_inputs_();
+    void update_energy_(MixerInput& input, const Frame& frame);
+
+    void add_(sample_t* out,
+              bool ramp,
+              sample_t out_from,
+              sample_t out_to,
+              const sample_t* const* in,
+              const sample_t* in_from,
+              const sample_t* in_to,
+              size_t n_in,
+              size_t n_samples);
+
+    core::List<MixerInput, core::NoOwnership> inputs_;
+    core::Slice<sample_t> temp_bufs_[MaxBatch];
+
+    const size_t num_channels_;
+    const size_t max_active_inputs_;
+
+    // inputs with lower priority are ducked in current block
+    unsigned int duck_priority_;
+    // highest priority of inputs active in current block
+    unsigned int active_priority_;
 
-    core::List<IFrameReader, core::NoOwnership> readers_;
-    core::Slice<sample_t> temp_buf_;
+    void (*add_fn_)(sample_t* out,
+                    sample_t out_gain,
+                    const sample_t* const* in,
+                    const sample_t* in_gains,
+                    size_t n_in,
+                    size_t n_samples);
+    void (*clamp_fn_)(sample_t* out, size_t n_samples);
 
     bool valid_;
 };
@@ -10,6 +10,7 @@
 #include "roc_core/fast_random.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_packet/ntp.h"
 
 namespace roc {
 namespace audio {
@@ -21,32 +22,160 @@ Packetizer::Packetizer(packet::IWriter& writer,
                        core::BufferFactory<uint8_t>& buffer_factory,
                        core::nanoseconds_t packet_length,
                        const audio::SampleSpec& sample_spec,
-                       unsigned int payload_type)
+                       unsigned int payload_type,
+                       const DtxConfig& dtx_config)
     : writer_(writer)
     , composer_(composer)
     , payload_encoder_(payload_encoder)
     , packet_factory_(packet_factory)
     , buffer_factory_(buffer_factory)
     , sample_spec_(sample_spec)
+    , payload_type_(payload_type)
     , samples_per_packet_(
           (packet::timestamp_t)sample_spec.ns_2_rtp_timestamp(packet_length))
-    , payload_type_(payload_type)
     , payload_size_(payload_encoder.encoded_byte_count(samples_per_packet_))
+    , next_samples_per_packet_(samples_per_packet_)
+    , next_payload_size_(payload_size_)
     , packet_pos_(0)
+    , packet_zeros_(false)
+    , dtx_enabled_(dtx_config.enabled)
+    , dtx_threshold_(dtx_config.threshold)
+    , dtx_hangover_(
+          (packet::timestamp_t)sample_spec.ns_2_rtp_timestamp(dtx_config.hangover))
+    , dtx_keepalive_((packet::timestamp_t)sample_spec.ns_2_rtp_timestamp(
+          dtx_config.keepalive_interval))
+    , packet_silent_(false)
+    , silent_samples_(0)
+    , paused_samples_(0)
+    , paused_(false)
+    , capture_ts_(0)
+    , capture_rtp_ts_(0)
     , valid_(false) {
     source_ = (packet::source_t)core::fast_random(0, packet::source_t(-1));
     seqnum_ = (packet::seqnum_t)core::fast_random(0, packet::seqnum_t(-1));
     timestamp_ = (packet::timestamp_t)core::fast_random(0, packet::timestamp_t(-1));
+
+    if (payload_size_ == 0) {
+        roc_log(LogError,
+                "packetizer: packet length not supported by encoder:"
+                " samples_per_packet=%lu",
+                (unsigned long)samples_per_packet_);
+        return;
+    }
+
     valid_ = true;
-    roc_log(LogDebug, "packetizer: initializing: n_channels=%lu samples_per_packet=%lu",
+    roc_log(LogDebug,
+            "packetizer: initializing: n_channels=%lu samples_per_packet=%lu dtx=%d",
             (unsigned long)sample_spec_.num_channels(),
-            (unsigned long)samples_per_packet_);
+            (unsigned long)samples_per_packet_, (int)dtx_enabled_);
 }
 
 bool Packetizer::valid() const {
     return valid_;
 }
 
+core::nanoseconds_t Packetizer::packet_length() const {
+    return sample_spec_.samples_per_chan_2_ns(next_samples_per_packet_);
+}
+
+bool Packetizer::is_packet_length_supported(core::nanoseconds_t packet_length) const {
+    size_t payload_size = 0;
+    packet_length_2_samples_(packet_length, payload_size);
+
+    return payload_size != 0;
+}
+
+bool Packetizer::set_packet_length(core::nanoseconds_t packet_length) {
+    roc_panic_if_not(valid());
+
+    size_t payload_size = 0;
+    const size_t samples_per_packet =
+        packet_length_2_samples_(packet_length, payload_size);
+
+    if (payload_size == 0) {
+        roc_log(LogError,
+                "packetizer: packet length not supported by encoder:"
+                " samples_per_packet=%lu",
+                (unsigned long)samples_per_packet);
+        return false;
+    }
+
+    if (samples_per_packet != next_samples_per_packet_) {
+        roc_log(LogDebug,
+                "packetizer: changing packet length:"
+                " old_samples_per_packet=%lu new_samples_per_packet=%lu",
+                (unsigned long)next_samples_per_packet_,
+                (unsigned long)samples_per_packet);
+    }
+
+    next_samples_per_packet_ = samples_per_packet;
+    next_payload_size_ = payload_size;
+
+    return true;
+}
+
+core::nanoseconds_t
+Packetizer::fit_packet_length(size_t max_packet_size,
+                              core::nanoseconds_t max_packet_length) const {
+    roc_panic_if_not(valid());
+
+    size_t header_size = 0;
+    if (!header_size_(header_size)) {
+        return 0;
+    }
+
+    // packet can't be larger than buffer anyway
+    if (max_packet_size > buffer_factory_.buffer_size()) {
+        max_packet_size = buffer_factory_.buffer_size();
+    }
+
+    if (max_packet_size <= header_size) {
+        return 0;
+    }
+
+    const size_t max_payload_size = max_packet_size - header_size;
+
+    // find largest number of samples which fits into payload,
+    // encoded size grows with number of samples
+    size_t lo = 0;
+    size_t hi = 0;
+    if (max_packet_length > 0) {
+        hi = sample_spec_.ns_2_samples_per_chan(max_packet_length);
+    }
+
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo + 1) / 2;
+        const size_t payload_size = payload_encoder_.encoded_byte_count(mid);
+
+        if (payload_size != 0 && payload_size <= max_payload_size) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    if (lo == 0) {
+        return 0;
+    }
+
+    return sample_spec_.samples_per_chan_2_ns(lo);
+}
+
+bool Packetizer::map_ntp_timestamp(packet::ntp_timestamp_t ntp_ts,
+                                   packet::timestamp_t& rtp_ts) const {
+    if (capture_ts_ == 0) {
+        return false;
+    }
+
+    const core::nanoseconds_t delta = ntp_ts >= capture_ts_
+        ? packet::ntp_2_nanoseconds(ntp_ts - capture_ts_)
+        : -packet::ntp_2_nanoseconds(capture_ts_ - ntp_ts);
+
+    rtp_ts =
+        capture_rtp_ts_ + (packet::timestamp_t)sample_spec_.ns_2_rtp_timestamp(delta);
+    return true;
+}
+
 void Packetizer::write(Frame& frame) {
     if (frame.num_samples() % sample_spec_.num_channels() != 0) {
         roc_panic("packetizer: unexpected frame size");
@@ -55,9 +184,20 @@ void Packetizer::write(Frame& frame) {
     const sample_t* buffer_ptr = frame.samples();
     size_t buffer_samples = frame.num_samples() / sample_spec_.num_channels();
 
+    // read clock once per frame; packets started inside the frame get
+    // capture time of their first sample
+    packet::ntp_timestamp_t frame_capture_ts = 0;
+    size_t frame_pos = 0;
+
     while (buffer_samples != 0) {
         if (!packet_) {
-            if (!begin_packet_()) {
+            if (frame_capture_ts == 0) {
+                frame_capture_ts = packet::ntp_timestamp();
+            }
+            const core::nanoseconds_t frame_offset =
+                sample_spec_.samples_per_chan_2_ns(frame_pos);
+            if (!begin_packet_(frame_capture_ts
+                               + packet::nanoseconds_2_ntp(frame_offset))) {
                 return;
             }
         }
@@ -65,11 +205,22 @@ void Packetizer::write(Frame& frame) {
         const size_t n_requested =
             std::min(buffer_samples, samples_per_packet_ - packet_pos_);
 
+        if (packet_zeros_ && !(frame.flags() & Frame::FlagZeros)) {
+            packet_zeros_ =
+                is_zero_(buffer_ptr, n_requested * sample_spec_.num_channels());
+        }
+
+        if (packet_silent_ && !packet_zeros_) {
+            packet_silent_ =
+                is_silent_(buffer_ptr, n_requested * sample_spec_.num_channels());
+        }
+
         const size_t n_encoded = payload_encoder_.write(buffer_ptr, n_requested);
         roc_panic_if_not(n_encoded == n_requested);
 
         buffer_ptr += n_encoded * sample_spec_.num_channels();
         buffer_samples -= n_encoded;
+        frame_pos += n_encoded;
 
         packet_pos_ += n_encoded;
 
@@ -85,7 +236,23 @@ void Packetizer::flush() {
     }
 }
 
-bool Packetizer::begin_packet_() {
+// payload size is zero if length is not supported
+size_t Packetizer::packet_length_2_samples_(core::nanoseconds_t packet_length,
+                                            size_t& payload_size) const {
+    const size_t samples_per_packet =
+        packet_length > 0 ? sample_spec_.ns_2_samples_per_chan(packet_length) : 0;
+
+    payload_size = samples_per_packet != 0
+        ? payload_encoder_.encoded_byte_count(samples_per_packet)
+        : 0;
+
+    return samples_per_packet;
+}
+
+bool Packetizer::begin_packet_(packet::ntp_timestamp_t capture_ts) {
+    samples_per_packet_ = next_samples_per_packet_;
+    payload_size_ = next_payload_size_;
+
     packet::PacketPtr pp = create_packet_();
     if (!pp) {
         return false;
@@ -102,8 +269,14 @@ bool Packetizer::begin_packet_() {
     rtp->seqnum = seqnum_;
     rtp->timestamp = timestamp_;
     rtp->payload_type = payload_type_;
+    rtp->capture_timestamp = capture_ts;
+
+    capture_ts_ = rtp->capture_timestamp;
+    capture_rtp_ts_ = rtp->timestamp;
 
     packet_ = pp;
+    packet_zeros_ = true;
+    packet_silent_ = dtx_enabled_;
 
     return true;
 }
@@ -117,9 +290,15 @@ void Packetizer::end_packet_() {
         pad_packet_();
     }
 
-    writer_.write(packet_);
+    if (packet_zeros_) {
+        packet_->add_flags(packet::Packet::FlagZeros);
+    }
+
+    if (!suppress_packet_()) {
+        writer_.write(packet_);
+        seqnum_++;
+    }
 
-    seqnum_++;
     timestamp_ += (packet::timestamp_t)packet_pos_;
 
     packet_ = NULL;
@@ -140,6 +319,93 @@ void Packetizer::pad_packet_() {
     }
 }
 
+// stops at first non-zero sample, so it's cheap for non-silent audio
+bool Packetizer::is_zero_(const sample_t* samples, size_t n_samples) const {
+    for (size_t n = 0; n < n_samples; n++) {
+        if (samples[n] > 0 || samples[n] < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// stops at first loud sample, so it's cheap for non-silent audio
+bool Packetizer::is_silent_(const sample_t* samples, size_t n_samples) const {
+    for (size_t n = 0; n < n_samples; n++) {
+        if (samples[n] > dtx_threshold_ || samples[n] < -dtx_threshold_) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// checks if packet being finished should be dropped because of dtx
+// when paused, sequence number is not incremented for dropped packets
+bool Packetizer::suppress_packet_() {
+    if (!dtx_enabled_) {
+        return false;
+    }
+
+    if (!packet_silent_) {
+        if (paused_) {
+            roc_log(LogDebug, "packetizer: resuming after silence: ts=%lu",
+                    (unsigned long)timestamp_);
+
+            // beginning of talkspurt
+            packet_->rtp()->marker = true;
+            paused_ = false;
+        }
+        silent_samples_ = 0;
+        return false;
+    }
+
+    silent_samples_ += (packet::timestamp_t)packet_pos_;
+
+    if (silent_samples_ <= dtx_hangover_) {
+        return false;
+    }
+
+    if (!paused_) {
+        roc_log(LogDebug, "packetizer: pausing on silence: ts=%lu",
+                (unsigned long)timestamp_);
+
+        paused_ = true;
+        paused_samples_ = 0;
+    }
+
+    paused_samples_ += (packet::timestamp_t)packet_pos_;
+
+    if (paused_samples_ >= dtx_keepalive_) {
+        paused_samples_ = 0;
+        return false;
+    }
+
+    return true;
+}
+
+// size of headers added by composer, computed by preparing empty packet
+bool Packetizer::header_size_(size_t& header_size) const {
+    packet::PacketPtr packet = packet_factory_.new_packet();
+    if (!packet) {
+        roc_log(LogError, "packetizer: can't allocate packet");
+        return false;
+    }
+
+    core::Slice<uint8_t> data = buffer_factory_.new_buffer();
+    if (!data) {
+        roc_log(LogError, "packetizer: can't allocate buffer");
+        return false;
+    }
+
+    if (!composer_.prepare(*packet, data, 0)) {
+        roc_log(LogError, "packetizer: can't prepare packet");
+        return false;
+    }
+
+    header_size = data.size();
+    return true;
+}
+
 packet::PacketPtr Packetizer::create_packet_() {
     packet::PacketPtr packet = packet_factory_.new_packet();
     if (!packet) {
@@ -27,10 +27,47 @@
 namespace roc {
 namespace audio {
 
+//! Discontinuous transmission (DTX) parameters.
+struct DtxConfig {
+    //! Enable DTX.
+    //! If enabled, packetizer stops sending packets during silence.
+    bool enabled;
+
+    //! Silence threshold.
+    //! Packet is silent if absolute value of every sample is at most this value.
+    sample_t threshold;
+
+    //! How long silence should last before sending is paused, in nanoseconds.
+    //! Silent packets within this period are still sent, so that quiet tails
+    //! of speech are not cut.
+    core::nanoseconds_t hangover;
+
+    //! Interval between packets sent during pause, in nanoseconds.
+    //! Such packets keep session alive on receiver and let it detect that gap
+    //! is a pause and not a loss. Should be below receiver latency.
+    core::nanoseconds_t keepalive_interval;
+
+    DtxConfig()
+        : enabled(false)
+        , threshold(0.001f)
+        , hangover(200 * core::Millisecond)
+        , keepalive_interval(100 * core::Millisecond) {
+    }
+};
+
 //! Packetizer.
 //! @remarks
 //!  Gets an audio stream, encodes samples to packets using an encoder, and
 //!  writes packets to a packet writer.
+//!  Packets in which all samples are zero get packet::Packet::FlagZeros.
+//!  Packet length may be changed on the fly; all packets started after the
+//!  change have the new duration and payload size.
+//!
+//!  If DTX is enabled, packets are not written after a period of silence,
+//!  except rare keepalive packets. Suppressed packets don't consume sequence
+//!  numbers, so receiver sees a timestamp jump between packets with adjacent
+//!  sequence numbers and can tell a pause from a loss. First non-silent packet
+//!  after a pause has marker bit set, as required by RFC 3551.
 class Packetizer : public IFrameWriter, public core::NonCopyable<> {
 public:
     //! Initialization.
@@ -44,6 +81,7 @@ public:
     //!  - @p packet_length defines packet length in nanoseconds
     //!  - @p sample_spec defines the sample spec
     //!  - @p payload_type defines packet payload type
+    //!  - @p dtx_config defines discontinuous transmission parameters
     Packetizer(packet::IWriter& writer,
                packet::IComposer& composer,
                IFrameEncoder& payload_encoder,
@@ -51,7 +89,8 @@ public:
                core::BufferFactory<uint8_t>& buffer_factory,
                core::nanoseconds_t packet_length,
                const audio::SampleSpec& sample_spec,
-               unsigned int payload_type);
+               unsigned int payload_type,
+               const DtxConfig& dtx_config);
 
     //! Write audio frame.
     virtual void write(Frame& frame);
@@ -64,12 +103,56 @@ public:
     //! Check if object is successfully constructed.
     bool valid() const;
 
+    //! Get current packet length.
+    core::nanoseconds_t packet_length() const;
+
+    //! Check if packet length is supported by encoder.
+    bool is_packet_length_supported(core::nanoseconds_t packet_length) const;
+
+    //! Change packet length.
+    //! @remarks
+    //!  The packet being built, if any, keeps its length; the new length is
+    //!  applied starting from the next packet.
+    //! @returns
+    //!  false if the length isn't supported by encoder.
+    bool set_packet_length(core::nanoseconds_t packet_length);
+
+    //! Find packet length fitting into given packet size.
+    //! @remarks
+    //!  Returns the largest packet length, not exceeding @p max_packet_length,
+    //!  for which the whole packet, including headers added by composer, fits
+    //!  into @p max_packet_size bytes, e.g. into path MTU. Doesn't change
+    //!  current packet length.
+    //! @returns
+    //!  zero if even one sample per packet doesn't fit.
+    core::nanoseconds_t fit_packet_length(size_t max_packet_size,
+                                          core::nanoseconds_t max_packet_length) const;
+
+    //! Get RTP timestamp corresponding to given NTP time.
+    //! @remarks
+    //!  Extrapolated from capture time and RTP timestamp of the last packet.
+    //!  Used to map stream timeline to sender clock in RTCP sender reports.
+    //! @returns
+    //!  false if no packets were produced yet.
+    bool map_ntp_timestamp(packet::ntp_timestamp_t ntp_ts,
+                           packet::timestamp_t& rtp_ts) const;
+
 private:
-    bool begin_packet_();
+    size_t packet_length_2_samples_(core::nanoseconds_t packet_length,
+                                    size_t& payload_size) const;
+
+    bool header_size_(size_t& header_size) const;
+
+    bool begin_packet_(packet::ntp_timestamp_t capture_ts);
     void end_packet_();
 
     void pad_packet_();
 
+    bool is_zero_(const sample_t* samples, size_t n_samples) const;
+    bool is_silent_(const sample_t* samples, size_t n_samples) const;
+
+    bool suppress_packet_();
+
     packet::PacketPtr create_packet_();
 
     packet::IWriter& writer_;
@@ -80,17 +163,38 @@ private:
     core::BufferFactory<uint8_t>& buffer_factory_;
 
     const audio::SampleSpec sample_spec_;
-    const size_t samples_per_packet_;
     const unsigned int payload_type_;
-    const size_t payload_size_;
+
+    // length of the packet being built
+    size_t samples_per_packet_;
+    size_t payload_size_;
+
+    // length of the packets started from now on
+    size_t next_samples_per_packet_;
+    size_t next_payload_size_;
 
     packet::PacketPtr packet_;
     size_t packet_pos_;
+    bool packet_zeros_;
+
+    // dtx state
+    const bool dtx_enabled_;
+    const sample_t dtx_threshold_;
+    const packet::timestamp_t dtx_hangover_;
+    const packet::timestamp_t dtx_keepalive_;
+    bool packet_silent_;
+    packet::timestamp_t silent_samples_;
+    packet::timestamp_t paused_samples_;
+    bool paused_;
 
     packet::source_t source_;
     packet::seqnum_t seqnum_;
     packet::timestamp_t timestamp_;
 
+    // capture time and RTP timestamp of the last packet
+    packet::ntp_timestamp_t capture_ts_;
+    packet::timestamp_t capture_rtp_ts_;
+
     bool valid_;
 };
 
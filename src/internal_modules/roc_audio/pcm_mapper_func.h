@@ -10,6 +10,12 @@
 #include "roc_core/cpu_traits.h"
 #include "roc_core/stddefs.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace roc {
 namespace audio {
 
@@ -12719,9 +12725,10 @@ template <> struct pcm_packer<PcmEncoding_Float64, PcmEndian_Little> {
     }
 };
 
-// Map encoding and endian of samples
+// Map encoding and endian of samples, sample by sample
+// Works with arbitrary bit offsets
 template <PcmEncoding InEnc, PcmEncoding OutEnc, PcmEndian InEnd, PcmEndian OutEnd>
-struct pcm_mapper {
+struct pcm_generic_mapper {
     static inline void map(const uint8_t* in_data,
                            size_t& in_bit_off,
                            uint8_t* out_data,
@@ -12736,6 +12743,293 @@ struct pcm_mapper {
     }
 };
 
+// Check whether samples in given endian should be byte-swapped
+template <PcmEndian End> struct pcm_is_swapped {
+#if ROC_CPU_ENDIAN == ROC_CPU_BE
+    enum { value = (End == PcmEndian_Little) };
+#else
+    enum { value = (End == PcmEndian_Big) };
+#endif
+};
+
+// Load 16-bit value from unaligned memory, optionally swapping bytes
+template <bool Swap> inline uint16_t pcm_load16(const uint8_t* ptr) {
+    uint16_t v;
+    memcpy(&v, ptr, sizeof(v));
+    if (Swap) {
+        v = uint16_t((v >> 8) | (v << 8));
+    }
+    return v;
+}
+
+// Store 16-bit value to unaligned memory, optionally swapping bytes
+template <bool Swap> inline void pcm_store16(uint8_t* ptr, uint16_t v) {
+    if (Swap) {
+        v = uint16_t((v >> 8) | (v << 8));
+    }
+    memcpy(ptr, &v, sizeof(v));
+}
+
+// Load 32-bit value from unaligned memory, optionally swapping bytes
+template <bool Swap> inline uint32_t pcm_load32(const uint8_t* ptr) {
+    uint32_t v;
+    memcpy(&v, ptr, sizeof(v));
+    if (Swap) {
+        v = (v >> 24) | ((v >> 8) & 0xff00u) | ((v << 8) & 0xff0000u) | (v << 24);
+    }
+    return v;
+}
+
+// Store 32-bit value to unaligned memory, optionally swapping bytes
+template <bool Swap> inline void pcm_store32(uint8_t* ptr, uint32_t v) {
+    if (Swap) {
+        v = (v >> 24) | ((v >> 8) & 0xff00u) | ((v << 8) & 0xff0000u) | (v << 24);
+    }
+    memcpy(ptr, &v, sizeof(v));
+}
+
+// Convert SInt16 sample to Float32 sample (same as pcm_encoding_converter)
+inline float pcm_s16_to_f32(uint16_t arg) {
+    return float(int16_t(arg) * (1.0 / ((double)pcm_sint16_max + 1.0)));
+}
+
+// Convert Float32 sample to SInt16 sample (same as pcm_encoding_converter)
+inline uint16_t pcm_f32_to_s16(float arg) {
+    return uint16_t(
+        pcm_encoding_converter<PcmEncoding_Float32, PcmEncoding_SInt16>::convert(arg));
+}
+
+// Convert float bits to float value
+inline float pcm_u32_to_f32(uint32_t arg) {
+    float ret;
+    memcpy(&ret, &arg, sizeof(ret));
+    return ret;
+}
+
+// Convert float value to float bits
+inline uint32_t pcm_f32_to_u32(float arg) {
+    uint32_t ret;
+    memcpy(&ret, &arg, sizeof(ret));
+    return ret;
+}
+
+#if defined(__SSE2__)
+// Swap bytes in every 16-bit lane
+inline __m128i pcm_sse2_swap16(__m128i v) {
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+// Swap bytes in every 32-bit lane
+inline __m128i pcm_sse2_swap32(__m128i v) {
+    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);
+    return pcm_sse2_swap16(v);
+}
+#endif
+
+// Map byte-aligned SInt16 to Float32
+template <bool InSwap, bool OutSwap>
+inline void pcm_aligned_s16_to_f32(const uint8_t* in, uint8_t* out, size_t n_samples) {
+    size_t n = 0;
+#if defined(__SSE2__)
+    const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+    for (; n + 8 <= n_samples; n += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(in + n * 2));
+        if (InSwap) {
+            v = pcm_sse2_swap16(v);
+        }
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        lo = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        hi = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+        if (OutSwap) {
+            lo = pcm_sse2_swap32(lo);
+            hi = pcm_sse2_swap32(hi);
+        }
+        _mm_storeu_si128((__m128i*)(void*)(out + n * 4), lo);
+        _mm_storeu_si128((__m128i*)(void*)(out + n * 4 + 16), hi);
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for (; n + 8 <= n_samples; n += 8) {
+        uint8x16_t b = vld1q_u8(in + n * 2);
+        if (InSwap) {
+            b = vrev16q_u8(b);
+        }
+        const int16x8_t v = vreinterpretq_s16_u8(b);
+        float32x4_t lo = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))),
+                                     1.0f / 32768.0f);
+        float32x4_t hi = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))),
+                                     1.0f / 32768.0f);
+        uint8x16_t lo_b = vreinterpretq_u8_f32(lo);
+        uint8x16_t hi_b = vreinterpretq_u8_f32(hi);
+        if (OutSwap) {
+            lo_b = vrev32q_u8(lo_b);
+            hi_b = vrev32q_u8(hi_b);
+        }
+        vst1q_u8(out + n * 4, lo_b);
+        vst1q_u8(out + n * 4 + 16, hi_b);
+    }
+#endif
+    for (; n < n_samples; n++) {
+        const float f = pcm_s16_to_f32(pcm_load16<InSwap>(in + n * 2));
+        pcm_store32<OutSwap>(out + n * 4, pcm_f32_to_u32(f));
+    }
+}
+
+// Map byte-aligned Float32 to SInt16
+template <bool InSwap, bool OutSwap>
+inline void pcm_aligned_f32_to_s16(const uint8_t* in, uint8_t* out, size_t n_samples) {
+    size_t n = 0;
+#if defined(__SSE2__)
+    const __m128 scale = _mm_set1_ps(32768.0f);
+    const __m128 lo_lim = _mm_set1_ps(-32768.0f);
+    const __m128 hi_lim = _mm_set1_ps(32767.0f);
+    for (; n + 8 <= n_samples; n += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(const void*)(in + n * 4));
+        __m128i b = _mm_loadu_si128((const __m128i*)(const void*)(in + n * 4 + 16));
+        if (InSwap) {
+            a = pcm_sse2_swap32(a);
+            b = pcm_sse2_swap32(b);
+        }
+        __m128 fa = _mm_mul_ps(_mm_castsi128_ps(a), scale);
+        __m128 fb = _mm_mul_ps(_mm_castsi128_ps(b), scale);
+        fa = _mm_max_ps(_mm_min_ps(fa, hi_lim), lo_lim);
+        fb = _mm_max_ps(_mm_min_ps(fb, hi_lim), lo_lim);
+        __m128i v = _mm_packs_epi32(_mm_cvttps_epi32(fa), _mm_cvttps_epi32(fb));
+        if (OutSwap) {
+            v = pcm_sse2_swap16(v);
+        }
+        _mm_storeu_si128((__m128i*)(void*)(out + n * 2), v);
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const float32x4_t lo_lim = vdupq_n_f32(-32768.0f);
+    const float32x4_t hi_lim = vdupq_n_f32(32767.0f);
+    for (; n + 8 <= n_samples; n += 8) {
+        uint8x16_t a = vld1q_u8(in + n * 4);
+        uint8x16_t b = vld1q_u8(in + n * 4 + 16);
+        if (InSwap) {
+            a = vrev32q_u8(a);
+            b = vrev32q_u8(b);
+        }
+        float32x4_t fa = vmulq_n_f32(vreinterpretq_f32_u8(a), 32768.0f);
+        float32x4_t fb = vmulq_n_f32(vreinterpretq_f32_u8(b), 32768.0f);
+        fa = vmaxq_f32(vminq_f32(fa, hi_lim), lo_lim);
+        fb = vmaxq_f32(vminq_f32(fb, hi_lim), lo_lim);
+        const int16x8_t v =
+            vcombine_s16(vqmovn_s32(vcvtq_s32_f32(fa)), vqmovn_s32(vcvtq_s32_f32(fb)));
+        uint8x16_t v_b = vreinterpretq_u8_s16(v);
+        if (OutSwap) {
+            v_b = vrev16q_u8(v_b);
+        }
+        vst1q_u8(out + n * 2, v_b);
+    }
+#endif
+    for (; n < n_samples; n++) {
+        const float f = pcm_u32_to_f32(pcm_load32<InSwap>(in + n * 4));
+        pcm_store16<OutSwap>(out + n * 2, pcm_f32_to_s16(f));
+    }
+}
+
+// Map byte-aligned SInt24 to Float32
+template <bool InSwap, bool OutSwap>
+inline void pcm_aligned_s24_to_f32(const uint8_t* in, uint8_t* out, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        const uint8_t* p = in + n * 3;
+        // input is big-endian if it's swapped the same way as big-endian
+        const bool is_big = (InSwap == (bool)pcm_is_swapped<PcmEndian_Big>::value);
+        uint32_t v = is_big ? (uint32_t(p[0]) << 16) | (uint32_t(p[1]) << 8) | p[2]
+                            : (uint32_t(p[2]) << 16) | (uint32_t(p[1]) << 8) | p[0];
+        if (v & 0x800000u) {
+            v |= 0xff000000u;
+        }
+        const float f = float(int32_t(v) * (1.0 / ((double)pcm_sint24_max + 1.0)));
+        pcm_store32<OutSwap>(out + n * 4, pcm_f32_to_u32(f));
+    }
+}
+
+// Map byte-aligned Float32 to SInt24
+template <bool InSwap, bool OutSwap>
+inline void pcm_aligned_f32_to_s24(const uint8_t* in, uint8_t* out, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        const uint32_t v = uint32_t(
+            pcm_encoding_converter<PcmEncoding_Float32, PcmEncoding_SInt24>::convert(
+                pcm_u32_to_f32(pcm_load32<InSwap>(in + n * 4))));
+        uint8_t* p = out + n * 3;
+        // output is big-endian if it's swapped the same way as big-endian
+        const bool is_big = (OutSwap == (bool)pcm_is_swapped<PcmEndian_Big>::value);
+        if (is_big) {
+            p[0] = uint8_t(v >> 16);
+            p[1] = uint8_t(v >> 8);
+            p[2] = uint8_t(v);
+        } else {
+            p[0] = uint8_t(v);
+            p[1] = uint8_t(v >> 8);
+            p[2] = uint8_t(v >> 16);
+        }
+    }
+}
+
+// Map byte-aligned Float32 to Float32
+template <bool InSwap, bool OutSwap>
+inline void pcm_aligned_f32_to_f32(const uint8_t* in, uint8_t* out, size_t n_samples) {
+    if (InSwap == OutSwap) {
+        memmove(out, in, n_samples * 4);
+        return;
+    }
+    size_t n = 0;
+#if defined(__SSE2__)
+    for (; n + 4 <= n_samples; n += 4) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)(in + n * 4));
+        _mm_storeu_si128((__m128i*)(void*)(out + n * 4), pcm_sse2_swap32(v));
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for (; n + 4 <= n_samples; n += 4) {
+        vst1q_u8(out + n * 4, vrev32q_u8(vld1q_u8(in + n * 4)));
+    }
+#endif
+    for (; n < n_samples; n++) {
+        pcm_store32<true>(out + n * 4, pcm_load32<false>(in + n * 4));
+    }
+}
+
+// Map encoding and endian of samples
+template <PcmEncoding InEnc, PcmEncoding OutEnc, PcmEndian InEnd, PcmEndian OutEnd>
+struct pcm_mapper : pcm_generic_mapper<InEnc, OutEnc, InEnd, OutEnd> {};
+
+// Define mapper that uses byte-aligned fast path when both offsets are
+// byte-aligned, and generic path otherwise
+#define ROC_PCM_ALIGNED_MAPPER(in_enc, out_enc, in_bits, out_bits, func)                \
+    template <PcmEndian InEnd, PcmEndian OutEnd>                                         \
+    struct pcm_mapper<in_enc, out_enc, InEnd, OutEnd> {                                  \
+        static inline void map(const uint8_t* in_data,                                   \
+                               size_t& in_bit_off,                                       \
+                               uint8_t* out_data,                                        \
+                               size_t& out_bit_off,                                      \
+                               size_t n_samples) {                                       \
+            if (((in_bit_off | out_bit_off) & 0x7u) != 0) {                              \
+                pcm_generic_mapper<in_enc, out_enc, InEnd, OutEnd>::map(                 \
+                    in_data, in_bit_off, out_data, out_bit_off, n_samples);              \
+                return;                                                                  \
+            }                                                                            \
+            func<pcm_is_swapped<InEnd>::value, pcm_is_swapped<OutEnd>::value>(           \
+                in_data + (in_bit_off >> 3), out_data + (out_bit_off >> 3), n_samples);  \
+            in_bit_off += n_samples * in_bits;                                           \
+            out_bit_off += n_samples * out_bits;                                         \
+        }                                                                                \
+    }
+
+ROC_PCM_ALIGNED_MAPPER(
+    PcmEncoding_SInt16, PcmEncoding_Float32, 16, 32, pcm_aligned_s16_to_f32);
+ROC_PCM_ALIGNED_MAPPER(
+    PcmEncoding_Float32, PcmEncoding_SInt16, 32, 16, pcm_aligned_f32_to_s16);
+ROC_PCM_ALIGNED_MAPPER(
+    PcmEncoding_SInt24, PcmEncoding_Float32, 24, 32, pcm_aligned_s24_to_f32);
+ROC_PCM_ALIGNED_MAPPER(
+    PcmEncoding_Float32, PcmEncoding_SInt24, 32, 24, pcm_aligned_f32_to_s24);
+ROC_PCM_ALIGNED_MAPPER(
+    PcmEncoding_Float32, PcmEncoding_Float32, 32, 32, pcm_aligned_f32_to_f32);
+
+#undef ROC_PCM_ALIGNED_MAPPER
+
 // Sample mapping function
 typedef void (*pcm_mapper_func_t)(
     const uint8_t* in_data,
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/prefetch_reader.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+PrefetchReader::PrefetchReader(IFrameReader& reader,
+                               core::BufferFactory<sample_t>& buffer_factory,
+                               core::nanoseconds_t frame_length,
+                               const SampleSpec& sample_spec)
+    : reader_(reader)
+    , buf_pos_(0)
+    , buf_size_(0)
+    , buf_flags_(0)
+    , buf_status_(false)
+    , buf_has_level_(false)
+    , valid_(false) {
+    const size_t frame_size = sample_spec.ns_2_samples_overall(frame_length);
+    roc_log(LogDebug, "prefetch reader: initializing: frame_size=%lu",
+            (unsigned long)frame_size);
+
+    if (frame_size == 0) {
+        roc_log(LogError, "prefetch reader: frame size cannot be 0");
+        return;
+    }
+
+    buf_ = buffer_factory.new_buffer();
+    if (!buf_) {
+        roc_log(LogError, "prefetch reader: can't allocate temporary buffer");
+        return;
+    }
+
+    if (buf_.capacity() < frame_size) {
+        roc_log(LogError, "prefetch reader: allocated buffer is too small");
+        return;
+    }
+    buf_.reslice(0, frame_size);
+
+    valid_ = true;
+}
+
+bool PrefetchReader::valid() const {
+    return valid_;
+}
+
+size_t PrefetchReader::max_prefetch() const {
+    roc_panic_if(!valid_);
+
+    return buf_.size();
+}
+
+void PrefetchReader::prefetch(size_t num_samples) {
+    roc_panic_if(!valid_);
+
+    if (num_samples > buf_.size()) {
+        num_samples = buf_.size();
+    }
+
+    buf_pos_ = 0;
+    buf_size_ = 0;
+
+    if (num_samples == 0) {
+        return;
+    }
+
+    Frame frame(buf_.data(), num_samples);
+
+    buf_status_ = reader_.read(frame);
+    buf_flags_ = frame.flags();
+    buf_size_ = num_samples;
+
+    buf_has_level_ = frame.has_level();
+    if (buf_has_level_) {
+        buf_level_ = frame.level();
+    }
+}
+
+bool PrefetchReader::read(Frame& frame) {
+    roc_panic_if(!valid_);
+
+    if (buf_pos_ == buf_size_) {
+        return reader_.read(frame);
+    }
+
+    size_t n_samples = buf_size_ - buf_pos_;
+    if (n_samples > frame.num_samples()) {
+        n_samples = frame.num_samples();
+    }
+
+    memcpy(frame.samples(), buf_.data() + buf_pos_, n_samples * sizeof(sample_t));
+    buf_pos_ += n_samples;
+
+    bool status = buf_status_;
+    unsigned flags = buf_flags_;
+
+    // If frame is a part of prefetched buffer, level of whole buffer is used.
+    FrameLevel level = buf_level_;
+    bool has_level = buf_has_level_;
+
+    if (n_samples < frame.num_samples()) {
+        Frame rest_frame(frame.samples() + n_samples, frame.num_samples() - n_samples);
+
+        const bool rest_status = reader_.read(rest_frame);
+
+        // Frame consists of zeros only if both parts do.
+        const unsigned zeros = flags & rest_frame.flags() & Frame::FlagZeros;
+
+        status = status && rest_status;
+        flags = ((flags | rest_frame.flags()) & ~(unsigned)Frame::FlagZeros) | zeros;
+
+        if (has_level && rest_frame.has_level()) {
+            level.add_level(rest_frame.level());
+        } else {
+            has_level = false;
+        }
+    }
+
+    frame.set_flags(flags);
+
+    if (has_level) {
+        frame.set_level(level);
+    }
+
+    return status;
+}
+
+} // namespace audio
+} // namespace roc
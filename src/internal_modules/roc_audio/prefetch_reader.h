@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/prefetch_reader.h
+//! @brief Prefetch reader.
+
+#ifndef ROC_AUDIO_PREFETCH_READER_H_
+#define ROC_AUDIO_PREFETCH_READER_H_
+
+#include "roc_audio/frame.h"
+#include "roc_audio/iframe_reader.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace audio {
+
+//! Prefetch reader.
+//!
+//! Reads samples from nested reader into internal buffer in advance, when
+//! prefetch() is called, and then returns them from read().
+//!
+//! This allows to run the nested reader on another thread: prefetch() may be
+//! called concurrently for different prefetch readers, and then the consumer
+//! can read prefetched frames on its own thread without blocking.
+//!
+//! If read() is called when there are no prefetched samples, or requests
+//! more samples than were prefetched, the rest is read from nested reader
+//! directly.
+class PrefetchReader : public IFrameReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p reader is nested reader to prefetch frames from
+    //!  - @p buffer_factory is used to allocate the internal buffer
+    //!  - @p frame_length defines maximum duration of the prefetched frame
+    //!  - @p sample_spec defines sample spec of the frames
+    PrefetchReader(IFrameReader& reader,
+                   core::BufferFactory<sample_t>& buffer_factory,
+                   core::nanoseconds_t frame_length,
+                   const SampleSpec& sample_spec);
+
+    //! Check if the object was succefully constructed.
+    bool valid() const;
+
+    //! Get maximum number of samples that can be prefetched.
+    size_t max_prefetch() const;
+
+    //! Read samples from nested reader into internal buffer.
+    //! @remarks
+    //!  Reads up to @p num_samples samples, but no more than max_prefetch().
+    //!  Samples prefetched previously and not read yet are discarded, so
+    //!  this should be called only after previous frame was fully read.
+    void prefetch(size_t num_samples);
+
+    //! Read audio frame.
+    //! @remarks
+    //!  Returns prefetched samples, if any, and reads the rest from
+    //!  nested reader.
+    virtual bool read(Frame& frame);
+
+private:
+    IFrameReader& reader_;
+
+    core::Slice<sample_t> buf_;
+    size_t buf_pos_;
+    size_t buf_size_;
+
+    unsigned buf_flags_;
+    bool buf_status_;
+
+    FrameLevel buf_level_;
+    bool buf_has_level_;
+
+    bool valid_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_PREFETCH_READER_H_
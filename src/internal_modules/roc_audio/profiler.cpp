@@ -26,8 +26,6 @@ Profiler::Profiler(core::IAllocator& allocator,
                            / (unsigned long)(profiler_config.chunk_duration))
                   + 1)
     , chunks_(allocator)
-    , first_chunk_num_(0)
-    , last_chunk_num_(0)
     , last_chunk_samples_(0)
     , moving_avg_(0)
     , sample_spec_(sample_spec)
@@ -40,11 +38,13 @@ Profiler::Profiler(core::IAllocator& allocator,
         roc_panic("profiler: sample_rate is zero");
     }
 
-    if (!chunks_.resize(num_chunks_)) {
+    if (!chunks_.grow(num_chunks_)) {
         roc_log(LogError, "profiler: can't allocate chunks");
         return;
     }
 
+    chunks_.push_back(0);
+
     valid_ = true;
 }
 
@@ -59,7 +59,7 @@ void Profiler::update_moving_avg_(size_t frame_size, core::nanoseconds_t elapsed
     while (frame_size > 0) {
         size_t n_samples = std::min(frame_size, (chunk_length_ - last_chunk_samples_));
 
-        float& last_chunk_speed = chunks_[last_chunk_num_];
+        float& last_chunk_speed = chunks_.back();
         last_chunk_samples_ += n_samples;
 
         // Weighted mean equation
@@ -71,23 +71,22 @@ void Profiler::update_moving_avg_(size_t frame_size, core::nanoseconds_t elapsed
 
         // last chunk is full
         if (last_chunk_samples_ == chunk_length_) {
-            last_chunk_num_ = (last_chunk_num_ + 1) % num_chunks_;
+            const size_t n_full_chunks = chunks_.size();
 
             // ring buffer is full
-            if (last_chunk_num_ == first_chunk_num_) {
+            if (n_full_chunks == num_chunks_) {
                 buffer_full_ = true;
                 // Simple Moving Average: https://en.wikipedia.org/wiki/Moving_average
-                moving_avg_ +=
-                    (last_chunk_speed - chunks_[first_chunk_num_]) / (num_chunks_ - 1);
-                first_chunk_num_ = (first_chunk_num_ + 1) % num_chunks_;
+                moving_avg_ += (last_chunk_speed - chunks_.front()) / (num_chunks_ - 1);
+                chunks_.pop_front();
             } else {
                 // Cumulative Moving Average: https://en.wikipedia.org/wiki/Moving_average
-                moving_avg_ = ((moving_avg_ * (last_chunk_num_ - 1) + last_chunk_speed)
-                               / last_chunk_num_);
+                moving_avg_ = ((moving_avg_ * (n_full_chunks - 1) + last_chunk_speed)
+                               / n_full_chunks);
             }
 
             last_chunk_samples_ = 0;
-            chunks_[last_chunk_num_] = 0;
+            chunks_.push_back(0);
         }
 
         frame_size -= n_samples;
@@ -113,17 +112,17 @@ void Profiler::add_frame(size_t frame_size, core::nanoseconds_t elapsed) {
 
 float Profiler::get_moving_avg() {
     if (!buffer_full_) {
-        const size_t num_samples_in_moving_avg = (chunk_length_ * last_chunk_num_);
+        const size_t num_samples_in_moving_avg = (chunk_length_ * (chunks_.size() - 1));
 
         return (moving_avg_ * num_samples_in_moving_avg
-                + chunks_[last_chunk_num_] * last_chunk_samples_)
+                + chunks_.back() * last_chunk_samples_)
             / (num_samples_in_moving_avg + last_chunk_samples_);
     } else {
         const size_t num_samples_in_moving_avg = (chunk_length_ * (num_chunks_ - 1));
 
         return (moving_avg_ * num_samples_in_moving_avg
-                - chunks_[first_chunk_num_] * last_chunk_samples_
-                + chunks_[last_chunk_num_] * last_chunk_samples_)
+                - chunks_.front() * last_chunk_samples_
+                + chunks_.back() * last_chunk_samples_)
             / num_samples_in_moving_avg;
     }
 }
@@ -14,11 +14,11 @@
 
 #include "roc_audio/frame.h"
 #include "roc_audio/sample_spec.h"
-#include "roc_core/array.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/rate_limiter.h"
+#include "roc_core/ring_buffer.h"
 #include "roc_core/time.h"
 #include "roc_packet/units.h"
 
@@ -87,9 +87,7 @@ private:
 
     const size_t chunk_length_;
     const size_t num_chunks_;
-    core::Array<float> chunks_;
-    size_t first_chunk_num_;
-    size_t last_chunk_num_;
+    core::RingBuffer<float> chunks_;
     size_t last_chunk_samples_;
 
     float moving_avg_;
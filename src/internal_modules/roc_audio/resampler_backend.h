@@ -24,7 +24,11 @@ enum ResamplerBackend {
     ResamplerBackend_Builtin,
 
     //! SpeexDSP resampler.
-    ResamplerBackend_Speex
+    ResamplerBackend_Speex,
+
+    //! Roc built-in cubic resampler.
+    //! Intended for compensating small clock drift when rates are equal.
+    ResamplerBackend_Cubic
 };
 
 //! Get string name of resampler backend.
@@ -7,10 +7,17 @@
  */
 
 #include "roc_audio/resampler_builtin.h"
+#include "roc_audio/sinc_table_map.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace roc {
 namespace audio {
 
@@ -85,6 +92,21 @@ inline size_t get_window_size(ResamplerProfile profile) {
     roc_panic("builtin resampler: unexpected profile");
 }
 
+inline size_t get_num_phases(ResamplerProfile profile) {
+    switch (profile) {
+    case ResamplerProfile_Low:
+        return 32;
+
+    case ResamplerProfile_Medium:
+        return 64;
+
+    case ResamplerProfile_High:
+        return 256;
+    }
+
+    roc_panic("builtin resampler: unexpected profile");
+}
+
 inline size_t get_window_interp(ResamplerProfile profile) {
     switch (profile) {
     case ResamplerProfile_Low:
@@ -100,6 +122,119 @@ inline size_t get_window_interp(ResamplerProfile profile) {
     roc_panic("builtin resampler: unexpected profile");
 }
 
+// Scaling used to compute filter bank is rounded up to 1 / FilterScalingQuant,
+// so that small fluctuations of scaling don't cause filter bank rebuild.
+const size_t FilterScalingQuant = 1024;
+
+// Filter bank rows are padded to multiple of this number of taps.
+const size_t TapsAlignment = 4;
+
+// Checks if all samples are zero.
+inline bool is_zero(const sample_t* samples, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (samples[i] > 0 || samples[i] < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Computes dot product of two vectors.
+inline sample_t dot_product(const sample_t* a, const sample_t* b, size_t n) {
+    size_t i = 0;
+    float result = 0;
+
+#if defined(__SSE2__)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc);
+    result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x4_t acc = vdupq_n_f32(0);
+    for (; i + 4 <= n; i += 4) {
+        acc = vmlaq_f32(acc, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+    float lanes[4];
+    vst1q_f32(lanes, acc);
+    result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+
+    for (; i < n; i++) {
+        result += a[i] * b[i];
+    }
+
+    return result;
+}
+
+// Computes dot product of coefficients with left and right channels
+// of interleaved stereo vector. Number of coefficients should be even.
+inline void
+dot_product_stereo(sample_t* out, const sample_t* coeffs, const sample_t* in, size_t n) {
+    size_t i = 0;
+    float left = 0, right = 0;
+
+#if defined(__SSE2__)
+    __m128 acc = _mm_setzero_ps();
+    for (; i + 2 <= n; i += 2) {
+        // c0 c0 c1 c1
+        const __m128 c = _mm_castpd_ps(
+            _mm_load_sd((const double*)(const void*)(coeffs + i)));
+        const __m128 cc = _mm_unpacklo_ps(c, c);
+        // l0 r0 l1 r1
+        acc = _mm_add_ps(acc, _mm_mul_ps(cc, _mm_loadu_ps(in + i * 2)));
+    }
+    float lanes[4];
+    _mm_storeu_ps(lanes, acc);
+    left = lanes[0] + lanes[2];
+    right = lanes[1] + lanes[3];
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x4_t acc = vdupq_n_f32(0);
+    for (; i + 2 <= n; i += 2) {
+        const float32x2_t c = vld1_f32(coeffs + i);
+        const float32x2x2_t cc = vzip_f32(c, c);
+        acc = vmlaq_f32(acc, vcombine_f32(cc.val[0], cc.val[1]), vld1q_f32(in + i * 2));
+    }
+    float lanes[4];
+    vst1q_f32(lanes, acc);
+    left = lanes[0] + lanes[2];
+    right = lanes[1] + lanes[3];
+#endif
+
+    for (; i < n; i++) {
+        left += coeffs[i] * in[i * 2];
+        right += coeffs[i] * in[i * 2 + 1];
+    }
+
+    out[0] = left;
+    out[1] = right;
+}
+
+// Adds vector multiplied by coefficient to output vector.
+inline void
+multiply_accumulate(sample_t* out, const sample_t* in, sample_t coeff, size_t n) {
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128 c = _mm_set1_ps(coeff);
+    for (; i + 4 <= n; i += 4) {
+        const __m128 acc = _mm_loadu_ps(out + i);
+        _mm_storeu_ps(out + i, _mm_add_ps(acc, _mm_mul_ps(c, _mm_loadu_ps(in + i))));
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const float32x4_t c = vdupq_n_f32(coeff);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(out + i, vmlaq_f32(vld1q_f32(out + i), c, vld1q_f32(in + i)));
+    }
+#endif
+
+    for (; i < n; i++) {
+        out[i] += coeff * in[i];
+    }
+}
+
 } // namespace
 
 BuiltinResampler::BuiltinResampler(core::IAllocator& allocator,
@@ -108,21 +243,26 @@ BuiltinResampler::BuiltinResampler(core::IAllocator& allocator,
                                    core::nanoseconds_t frame_length,
                                    const audio::SampleSpec& sample_spec)
     : sample_spec_(sample_spec)
+    , window_(allocator)
     , n_ready_frames_(0)
-    , prev_frame_(NULL)
-    , curr_frame_(NULL)
-    , next_frame_(NULL)
+    , n_zero_frames_(0)
     , scaling_(1.0)
     , frame_size_(sample_spec.ns_2_samples_overall(frame_length))
     , frame_size_ch_(sample_spec.num_channels() ? frame_size_ / sample_spec.num_channels()
                                                 : 0)
+    , profile_(profile)
     , window_size_(get_window_size(profile))
-    , qt_half_sinc_window_size_(float_to_fixedpoint(window_size_))
     , window_interp_(get_window_interp(profile))
     , window_interp_bits_(calc_bits(window_interp_))
-    , sinc_table_(allocator)
-    , sinc_table_ptr_(NULL)
-    , qt_half_window_size_(float_to_fixedpoint((float)window_size_ / scaling_))
+    , sinc_table_(NULL)
+    , sinc_table_size_(window_size_ * window_interp_ + 2)
+    , num_phases_(get_num_phases(profile))
+    , num_phases_bits_(calc_bits(num_phases_))
+    , bank_(allocator)
+    , coeffs_(allocator)
+    , half_taps_(0)
+    , num_taps_(0)
+    , filter_scaling_(0)
     , qt_epsilon_(float_to_fixedpoint(5e-8f))
     , qt_frame_size_(fixedpoint_t(frame_size_ch_ << FRACT_BIT_COUNT))
     , qt_sample_(float_to_fixedpoint(0))
@@ -137,15 +277,25 @@ BuiltinResampler::BuiltinResampler(core::IAllocator& allocator,
         return;
     }
 
+    // cache table of low profile, so that switching to it doesn't allocate
+    if (profile != ResamplerProfile_Low
+        && !SincTableMap::instance().get_table(get_window_size(ResamplerProfile_Low),
+                                               get_window_interp(ResamplerProfile_Low))) {
+        roc_log(LogError, "builtin resampler: can't allocate sinc table");
+        return;
+    }
+
     if (!alloc_frames_(buffer_factory)) {
         return;
     }
 
     roc_log(LogDebug,
             "builtin resampler: initializing: "
-            "window_interp=%lu window_size=%lu frame_size=%lu channels_num=%lu",
+            "window_interp=%lu window_size=%lu num_phases=%lu frame_size=%lu"
+            " channels_num=%lu",
             (unsigned long)window_interp_, (unsigned long)window_size_,
-            (unsigned long)frame_size_, (unsigned long)sample_spec_.num_channels());
+            (unsigned long)num_phases_, (unsigned long)frame_size_,
+            (unsigned long)sample_spec_.num_channels());
 
     valid_ = true;
 }
@@ -187,31 +337,25 @@ bool BuiltinResampler::set_scaling(size_t input_sample_rate,
     // In case of upscaling one should properly shift the edge frequency
     // of the digital filter. In both cases it's sensible to decrease the
     // edge frequency to leave some.
-    if (new_scaling > 1.0f) {
-        const fixedpoint_t new_qt_half_window_len =
-            float_to_fixedpoint((float)window_size_ / cutoff_freq_ * new_scaling);
-
-        // Check that resample_() will not go out of bounds.
-        // Otherwise -- deny changes.
-        const bool out_of_bounds =
-            fixedpoint_to_size(qceil(qt_frame_size_ - new_qt_half_window_len))
-                > frame_size_ch_
-            || fixedpoint_to_size(qfloor(new_qt_half_window_len)) + 1 > frame_size_ch_;
-
-        if (out_of_bounds) {
-            roc_log(LogError,
-                    "builtin resampler: scaling does not fit window size:"
-                    " window_size=%lu frame_size=%lu scaling=%.5f",
-                    (unsigned long)window_size_, (unsigned long)frame_size_,
-                    (double)new_scaling);
+    const size_t new_filter_scaling = new_scaling > 1.0f
+        ? (size_t)std::ceil((double)new_scaling * FilterScalingQuant)
+        : FilterScalingQuant;
+
+    // Check that resample_() will not go out of bounds.
+    // Otherwise -- deny changes.
+    if (compute_half_taps_(new_filter_scaling) > frame_size_ch_) {
+        roc_log(LogError,
+                "builtin resampler: scaling does not fit window size:"
+                " window_size=%lu frame_size=%lu scaling=%.5f",
+                (unsigned long)window_size_, (unsigned long)frame_size_,
+                (double)new_scaling);
+        return false;
+    }
+
+    if (new_filter_scaling != filter_scaling_) {
+        if (!fill_bank_(new_filter_scaling)) {
             return false;
         }
-
-        qt_sinc_step_ = float_to_fixedpoint(cutoff_freq_ / new_scaling);
-        qt_half_window_size_ = new_qt_half_window_len;
-    } else {
-        qt_sinc_step_ = float_to_fixedpoint(cutoff_freq_);
-        qt_half_window_size_ = float_to_fixedpoint((float)window_size_ / cutoff_freq_);
     }
 
     scaling_ = new_scaling;
@@ -219,28 +363,85 @@ bool BuiltinResampler::set_scaling(size_t input_sample_rate,
     return true;
 }
 
-const core::Slice<sample_t>& BuiltinResampler::begin_push_input() {
-    if (n_ready_frames_ < 3) {
-        return frames_[n_ready_frames_];
+bool BuiltinResampler::set_profile(ResamplerProfile profile) {
+    roc_panic_if_msg(!valid_, "builtin resampler: set profile on invalid resampler");
+
+    if (profile == profile_) {
+        return true;
+    }
+
+    if (get_window_size(profile) * scaling_ > frame_size_ch_ - 1) {
+        roc_log(LogDebug,
+                "builtin resampler: profile does not fit frame size:"
+                " window_size=%lu frame_size=%lu scaling=%.5f",
+                (unsigned long)get_window_size(profile), (unsigned long)frame_size_,
+                (double)scaling_);
+        return false;
     }
 
-    core::Slice<sample_t> new_last_frame = frames_[0];
-    frames_[0] = frames_[1];
-    frames_[1] = frames_[2];
-    frames_[2] = new_last_frame;
+    const sample_t* sinc_table = SincTableMap::instance().get_table(
+        get_window_size(profile), get_window_interp(profile));
+    if (!sinc_table) {
+        roc_log(LogError, "builtin resampler: can't allocate sinc table");
+        return false;
+    }
+
+    const ResamplerProfile old_profile = profile_;
+    const sample_t* old_sinc_table = sinc_table_;
+
+    apply_profile_(profile, sinc_table);
+
+    if (filter_scaling_ == 0) {
+        // filter bank will be computed by set_scaling()
+        return true;
+    }
+
+    // Input window is kept, and new filter is centered at the same position
+    // as previous one, so output continues without gap or time shift.
+    if (compute_half_taps_(filter_scaling_) > frame_size_ch_
+        || !fill_bank_(filter_scaling_)) {
+        roc_log(LogDebug, "builtin resampler: can't switch profile, keeping current");
+
+        apply_profile_(old_profile, old_sinc_table);
+
+        // old bank fits into already allocated memory
+        if (!fill_bank_(filter_scaling_)) {
+            roc_panic("builtin resampler: can't restore filter bank");
+        }
+        return false;
+    }
+
+    roc_log(LogDebug,
+            "builtin resampler: switched profile:"
+            " window_interp=%lu window_size=%lu num_phases=%lu half_taps=%lu",
+            (unsigned long)window_interp_, (unsigned long)window_size_,
+            (unsigned long)num_phases_, (unsigned long)half_taps_);
 
-    return frames_[2];
+    return true;
+}
+
+const core::Slice<sample_t>& BuiltinResampler::begin_push_input() {
+    return in_frame_;
 }
 
 void BuiltinResampler::end_push_input() {
-    prev_frame_ = frames_[0].data();
-    curr_frame_ = frames_[1].data();
-    next_frame_ = frames_[2].data();
+    sample_t* window = window_.data();
+
+    memmove(window, window + frame_size_, frame_size_ * 2 * sizeof(sample_t));
+    memcpy(window + frame_size_ * 2, in_frame_.data(), frame_size_ * sizeof(sample_t));
 
     if (n_ready_frames_ < 3) {
         n_ready_frames_++;
     }
 
+    if (is_zero(in_frame_.data(), frame_size_)) {
+        if (n_zero_frames_ < 3) {
+            n_zero_frames_++;
+        }
+    } else {
+        n_zero_frames_ = 0;
+    }
+
     if (qt_sample_ >= qt_frame_size_) {
         qt_sample_ -= qt_frame_size_;
     }
@@ -250,6 +451,10 @@ void BuiltinResampler::end_push_input() {
 }
 
 size_t BuiltinResampler::pop_output(Frame& out) {
+    roc_panic_if_msg(filter_scaling_ == 0,
+                     "builtin resampler: set scaling must be called "
+                     "before any resampling could be done");
+
     if (n_ready_frames_ < 3) {
         return 0;
     }
@@ -269,9 +474,18 @@ size_t BuiltinResampler::pop_output(Frame& out) {
             qt_sample_ += qt_one;
         }
 
-        for (size_t channel = 0; channel < sample_spec_.num_channels(); ++channel) {
-            out_data[out_pos + channel] = resample_(channel);
+        // Index of first input sample in window, relative to the beginning of
+        // previous frame.
+        const size_t begin =
+            frame_size_ch_ + fixedpoint_to_size(qt_sample_) + 1 - half_taps_;
+
+        if (n_zero_frames_ == 3) {
+            memset(out_data + out_pos, 0, sample_spec_.num_channels() * sizeof(sample_t));
+        } else {
+            compute_coeffs_(qt_sample_ & FRACT_PART_MASK);
+            resample_(out_data + out_pos, begin);
         }
+
         qt_sample_ += qt_dt_;
     }
 
@@ -279,17 +493,27 @@ size_t BuiltinResampler::pop_output(Frame& out) {
 }
 
 bool BuiltinResampler::alloc_frames_(core::BufferFactory<sample_t>& buffer_factory) {
-    for (size_t n = 0; n < ROC_ARRAY_SIZE(frames_); n++) {
-        frames_[n] = buffer_factory.new_buffer();
+    in_frame_ = buffer_factory.new_buffer();
 
-        if (!frames_[n]) {
-            roc_log(LogError, "builtin resampler: can't allocate frame buffer");
-            return false;
-        }
+    if (!in_frame_) {
+        roc_log(LogError, "builtin resampler: can't allocate frame buffer");
+        return false;
+    }
+
+    if (in_frame_.capacity() < frame_size_) {
+        roc_log(LogError, "builtin resampler: allocated buffer is too small");
+        return false;
+    }
+
+    in_frame_.reslice(0, frame_size_);
 
-        frames_[n].reslice(0, frame_size_);
+    if (!window_.resize(frame_size_ * 3 + TapsAlignment * sample_spec_.num_channels())) {
+        roc_log(LogError, "builtin resampler: can't allocate window buffer");
+        return false;
     }
 
+    memset(window_.data(), 0, window_.size() * sizeof(sample_t));
+
     return true;
 }
 
@@ -331,151 +555,147 @@ bool BuiltinResampler::check_config_() const {
 }
 
 bool BuiltinResampler::fill_sinc_() {
-    if (!sinc_table_.resize(window_size_ * window_interp_ + 2)) {
+    sinc_table_ = SincTableMap::instance().get_table(window_size_, window_interp_);
+    if (!sinc_table_) {
         roc_log(LogError, "builtin resampler: can't allocate sinc table");
         return false;
     }
 
-    const double sinc_step = 1.0 / (double)window_interp_;
-    double sinc_t = sinc_step;
+    return true;
+}
 
-    sinc_table_[0] = 1.0f;
-    for (size_t i = 1; i < sinc_table_.size(); ++i) {
-        const double window = 0.54
-            - 0.46
-                * std::cos(2 * M_PI
-                           * ((double)(i - 1) / 2.0 / (double)sinc_table_.size() + 0.5));
-        sinc_table_[i] = (float)(std::sin(M_PI * sinc_t) / M_PI / sinc_t * window);
-        sinc_t += sinc_step;
-    }
-    sinc_table_[sinc_table_.size() - 2] = 0;
-    sinc_table_[sinc_table_.size() - 1] = 0;
+void BuiltinResampler::apply_profile_(ResamplerProfile profile,
+                                      const sample_t* sinc_table) {
+    profile_ = profile;
 
-    sinc_table_ptr_ = &sinc_table_[0];
+    window_size_ = get_window_size(profile);
+    window_interp_ = get_window_interp(profile);
+    window_interp_bits_ = calc_bits(window_interp_);
 
-    return true;
+    sinc_table_ = sinc_table;
+    sinc_table_size_ = window_size_ * window_interp_ + 2;
+
+    num_phases_ = get_num_phases(profile);
+    num_phases_bits_ = calc_bits(num_phases_);
 }
 
 // Computes sinc value in x position using linear interpolation between
-// table values from sinc_table.h
-//
-// During going through input signal window only integer part of argument changes,
-// that's why there are two arguments in this function: integer part and fractional
-// part of time coordinate.
-sample_t BuiltinResampler::sinc_(const fixedpoint_t x, const float fract_x) {
-    const size_t index = (x >> (FRACT_BIT_COUNT - window_interp_bits_));
+// table values from sinc_table_.
+sample_t BuiltinResampler::sinc_(const double x) const {
+    const double pos = x * (double)window_interp_;
+    const size_t index = (size_t)pos;
 
-    const sample_t hl = sinc_table_ptr_[index];     // table index smaller than x
-    const sample_t hh = sinc_table_ptr_[index + 1]; // table index next to x
+    roc_panic_if(index + 1 >= sinc_table_size_);
 
-    const sample_t result = hl + fract_x * (hh - hl);
+    const sample_t hl = sinc_table_[index];     // table index smaller than x
+    const sample_t hh = sinc_table_[index + 1]; // table index next to x
 
-    return scaling_ > 1.0f ? result / scaling_ : result;
+    return hl + (sample_t)(pos - (double)index) * (hh - hl);
 }
 
-sample_t BuiltinResampler::resample_(const size_t channel_offset) {
-    roc_panic_if_msg(qt_sinc_step_ == 0,
-                     "builtin resampler: set scaling must be called "
-                     "before any resampling could be done");
-    // Index of first input sample in window.
-    size_t ind_begin_prev;
+// Computes number of taps on each side of the window.
+// Window length is proportional to scaling in case of downsampling.
+size_t BuiltinResampler::compute_half_taps_(const size_t filter_scaling) const {
+    const double half_window = (double)window_size_ / (double)cutoff_freq_
+        * (double)filter_scaling / FilterScalingQuant;
 
-    // Window lasts till that index.
-    const size_t ind_end_prev = channelize_index(frame_size_ch_, channel_offset);
+    return (size_t)std::ceil(half_window);
+}
+
+// Computes filter coefficients for every phase.
+//
+// Tap K of row P is applied to the input sample that is located at
+// (P / num_phases_ + half_taps_ - 1 - K) distance from output sample,
+// so that rows could be applied to contiguous input window.
+bool BuiltinResampler::fill_bank_(const size_t filter_scaling) {
+    const double scaling = (double)filter_scaling / FilterScalingQuant;
+    const double sinc_step = (double)cutoff_freq_ / scaling;
+    const double half_window = (double)window_size_ / sinc_step;
+
+    const size_t half_taps = compute_half_taps_(filter_scaling);
+    const size_t num_taps =
+        (half_taps * 2 + TapsAlignment - 1) / TapsAlignment * TapsAlignment;
+
+    if (!bank_.resize((num_phases_ + 1) * num_taps) || !coeffs_.resize(num_taps)) {
+        roc_log(LogError, "builtin resampler: can't allocate filter bank");
+        return false;
+    }
 
-    size_t ind_begin_cur;
-    size_t ind_end_cur;
+    sample_t* row = bank_.data();
 
-    const size_t ind_begin_next = channelize_index(0, channel_offset);
-    size_t ind_end_next;
+    for (size_t p = 0; p <= num_phases_; p++) {
+        const double fract = (double)p / (double)num_phases_;
 
-    ind_begin_prev = (qt_sample_ >= qt_half_window_size_)
-        ? frame_size_ch_
-        : fixedpoint_to_size(qceil(qt_sample_ + (qt_frame_size_ - qt_half_window_size_)));
-    // ind_begin_prev is comparable with channel_len_ till we'll convert it to channalyzed
-    // presentation.
-    roc_panic_if(ind_begin_prev > frame_size_ch_);
-    ind_begin_prev = channelize_index(ind_begin_prev, channel_offset);
+        for (size_t k = 0; k < num_taps; k++) {
+            const double dist =
+                std::fabs(fract + (double)half_taps - 1.0 - (double)k);
 
-    ind_begin_cur = (qt_sample_ >= qt_half_window_size_)
-        ? fixedpoint_to_size(qceil(qt_sample_ - qt_half_window_size_))
-        : 0;
-    roc_panic_if(ind_begin_cur > frame_size_ch_);
-    ind_begin_cur = channelize_index(ind_begin_cur, channel_offset);
+            if (k >= half_taps * 2 || dist >= half_window) {
+                row[k] = 0;
+            } else {
+                row[k] = (sample_t)((double)sinc_(dist * sinc_step) / scaling);
+            }
+        }
 
-    ind_end_cur = ((qt_sample_ + qt_half_window_size_) > qt_frame_size_)
-        ? frame_size_ch_ - 1
-        : fixedpoint_to_size(qfloor(qt_sample_ + qt_half_window_size_));
-    roc_panic_if(ind_end_cur > frame_size_ch_);
-    ind_end_cur = channelize_index(ind_end_cur, channel_offset);
+        row += num_taps;
+    }
 
-    ind_end_next = ((qt_sample_ + qt_half_window_size_) > qt_frame_size_)
-        ? fixedpoint_to_size(qfloor(qt_sample_ + qt_half_window_size_ - qt_frame_size_))
-            + 1
-        : 0;
-    roc_panic_if(ind_end_next > frame_size_ch_);
-    ind_end_next = channelize_index(ind_end_next, channel_offset);
+    half_taps_ = half_taps;
+    num_taps_ = num_taps;
+    filter_scaling_ = filter_scaling;
 
-    // Counter inside window.
-    // t_sinc = (t_sample - ceil( t_sample - window_len/cutoff*scale )) * sinc_step
-    const long_fixedpoint_t qt_cur_ = qt_frame_size_ + qt_sample_
-        - qceil(qt_frame_size_ + qt_sample_ - qt_half_window_size_);
-    fixedpoint_t qt_sinc_cur =
-        (fixedpoint_t)((qt_cur_ * (long_fixedpoint_t)qt_sinc_step_) >> FRACT_BIT_COUNT);
+    roc_log(LogTrace,
+            "builtin resampler: computed filter bank: scaling=%.5f half_taps=%lu",
+            scaling, (unsigned long)half_taps_);
 
-    // sinc_table defined in positive half-plane, so at the begining of the window
-    // qt_sinc_cur starts decreasing and after we cross 0 it will be increasing
-    // till the end of the window.
-    fixedpoint_t qt_sinc_inc = qt_sinc_step_;
+    return true;
+}
 
-    // Compute fractional part of time position at the begining. It wont change during
-    // the run.
-    float f_sinc_cur_fract = fractional(qt_sinc_cur << window_interp_bits_);
-    sample_t accumulator = 0;
+void BuiltinResampler::compute_coeffs_(const fixedpoint_t qt_fract) {
+    const size_t phase_shift = FRACT_BIT_COUNT - num_phases_bits_;
 
-    size_t i;
+    const size_t phase = qt_fract >> phase_shift;
+    const float weight = (float)(qt_fract & ((1u << phase_shift) - 1))
+        * ((float)1. / (float)(1u << phase_shift));
 
-    // Run through previous frame.
-    for (i = ind_begin_prev; i < ind_end_prev; i += sample_spec_.num_channels()) {
-        accumulator += prev_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur -= qt_sinc_inc;
-    }
+    const sample_t* row0 = bank_.data() + phase * num_taps_;
+    const sample_t* row1 = row0 + num_taps_;
 
-    // Run through current frame through the left windows side. qt_sinc_cur is decreasing.
-    i = ind_begin_cur;
+    sample_t* coeffs = coeffs_.data();
 
-    accumulator += curr_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-    while (qt_sinc_cur >= qt_sinc_step_) {
-        i += sample_spec_.num_channels();
-        qt_sinc_cur -= qt_sinc_inc;
-        accumulator += curr_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
+    for (size_t k = 0; k < num_taps_; k++) {
+        coeffs[k] = row0[k] + weight * (row1[k] - row0[k]);
     }
+}
 
-    i += sample_spec_.num_channels();
+void BuiltinResampler::resample_(sample_t* out, const size_t begin) {
+    const size_t num_ch = sample_spec_.num_channels();
 
-    roc_panic_if(i > channelize_index(frame_size_ch_, channel_offset));
+    roc_panic_if((begin + num_taps_) * num_ch > window_.size());
 
-    // Crossing zero -- we just need to switch qt_sinc_cur.
-    // -1 ------------ 0 ------------- +1
-    //      ^                  ^
-    //      |                  |
-    //   -qt_sinc_cur  ->  +qt_sinc_cur     <=> qt_sinc_cur = 1 - qt_sinc_cur
-    qt_sinc_cur = qt_sinc_step_ - qt_sinc_cur; // qt_sinc_cur = -qt_sinc_cur + 1;
-    f_sinc_cur_fract = fractional(qt_sinc_cur << window_interp_bits_);
+    const sample_t* coeffs = coeffs_.data();
+    const sample_t* in = window_.data() + begin * num_ch;
 
-    // Run through right side of the window, increasing qt_sinc_cur.
-    for (; i <= ind_end_cur; i += sample_spec_.num_channels()) {
-        accumulator += curr_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur += qt_sinc_inc;
-    }
+    switch (num_ch) {
+    case 1:
+        out[0] = dot_product(coeffs, in, num_taps_);
+        break;
 
-    // Next frames run.
-    for (i = ind_begin_next; i < ind_end_next; i += sample_spec_.num_channels()) {
-        accumulator += next_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur += qt_sinc_inc;
-    }
+    case 2:
+        dot_product_stereo(out, coeffs, in, num_taps_);
+        break;
 
-    return accumulator;
+    default:
+        // Single pass over interleaved window, computing all channels of
+        // output frame at once and sharing coefficients between channels.
+        for (size_t ch = 0; ch < num_ch; ch++) {
+            out[ch] = 0;
+        }
+        for (size_t k = 0; k < num_taps_; k++) {
+            multiply_accumulate(out, in + k * num_ch, coeffs[k], num_ch);
+        }
+        break;
+    }
 }
 
 } // namespace audio
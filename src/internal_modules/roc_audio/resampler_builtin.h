@@ -52,6 +52,13 @@ public:
     //!  function returns false.
     virtual bool set_scaling(size_t input_rate, size_t output_rate, float multiplier);
 
+    //! Switch to another quality profile.
+    //! @remarks
+    //!  Replaces sinc table and rebuilds filter bank for new window size.
+    //!  Filter is centered at the same position, so output stays continuous.
+    //!  Doesn't allocate when switching to a profile not higher than initial.
+    virtual bool set_profile(ResamplerProfile profile);
+
     //! Get buffer to be filled with input data.
     virtual const core::Slice<sample_t>& begin_push_input();
 
@@ -69,59 +76,82 @@ private:
 
     const audio::SampleSpec sample_spec_;
 
-    inline size_t channelize_index(const size_t i, const size_t ch_offset) const {
-        return i * sample_spec_.num_channels() + ch_offset;
-    }
-
     bool alloc_frames_(core::BufferFactory<sample_t>&);
 
     bool check_config_() const;
 
     bool fill_sinc_();
-    sample_t sinc_(fixedpoint_t x, float fract_x);
+    void apply_profile_(ResamplerProfile profile, const sample_t* sinc_table);
+    sample_t sinc_(double x) const;
+
+    size_t compute_half_taps_(size_t filter_scaling) const;
+    bool fill_bank_(size_t filter_scaling);
+
+    // Interpolates coefficients for given fractional position between
+    // two adjacent rows of the filter bank.
+    void compute_coeffs_(fixedpoint_t qt_fract);
+
+    // Computes single sample for every channel, using coefficients computed
+    // by compute_coeffs_() and window starting from given input sample.
+    void resample_(sample_t* out, size_t begin);
 
-    // Computes single sample of the particular audio channel.
-    // channel_offset a serial number of the channel
-    //  (e.g. left -- 0, right -- 1, etc.).
-    sample_t resample_(size_t channel_offset);
+    // buffer returned by begin_push_input()
+    core::Slice<sample_t> in_frame_;
 
-    core::Slice<sample_t> frames_[3];
+    // three last input frames (previous, current, next) stored continuously,
+    // followed by zero padding for vectorized reads
+    core::Array<sample_t> window_;
     size_t n_ready_frames_;
 
-    const sample_t* prev_frame_;
-    const sample_t* curr_frame_;
-    const sample_t* next_frame_;
+    // number of last consecutive input frames with all samples zero,
+    // if whole window is zero, output is zero too and we skip computations
+    size_t n_zero_frames_;
 
     float scaling_;
 
     const size_t frame_size_;
     const size_t frame_size_ch_;
 
-    const size_t window_size_;
-    const fixedpoint_t qt_half_sinc_window_size_;
+    // current profile and its parameters, see set_profile()
+    ResamplerProfile profile_;
 
-    const size_t window_interp_;
-    const size_t window_interp_bits_;
+    size_t window_size_;
 
-    core::Array<sample_t> sinc_table_;
-    const sample_t* sinc_table_ptr_;
+    size_t window_interp_;
+    size_t window_interp_bits_;
+
+    // shared between resamplers, see SincTableMap
+    const sample_t* sinc_table_;
+    size_t sinc_table_size_;
+
+    // polyphase filter bank: (num_phases_ + 1) rows of num_taps_ coefficients,
+    // row N holds filter coefficients for input position N / num_phases_
+    size_t num_phases_;
+    size_t num_phases_bits_;
+
+    core::Array<sample_t> bank_;
+    core::Array<sample_t> coeffs_;
+
+    // number of window taps on each side of output sample,
+    // and number of taps in each row (padded for vectorization)
+    size_t half_taps_;
+    size_t num_taps_;
+
+    // quantized scaling for which the filter bank was computed
+    // see compute_half_taps_() and fill_bank_()
+    size_t filter_scaling_;
 
-    // half window len in Q8.24 in terms of input signal
-    fixedpoint_t qt_half_window_size_;
     const fixedpoint_t qt_epsilon_;
 
     const fixedpoint_t qt_frame_size_;
 
     // time position of output sample in terms of input samples indexes
-    // for example 0 -- time position of first sample in curr_frame_
+    // for example 0 -- time position of first sample in current frame
     fixedpoint_t qt_sample_;
 
     // time distance between two output samples, equals to resampling factor
     fixedpoint_t qt_dt_;
 
-    // the step with which we iterate over the sinc_table_
-    fixedpoint_t qt_sinc_step_;
-
     const sample_t cutoff_freq_;
 
     bool valid_;
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/resampler_cubic.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+// Number of bits in fractional part of time position.
+const unsigned FRACT_BIT_COUNT = 32;
+
+const uint64_t FRACT_PART_MASK = ((uint64_t)1 << FRACT_BIT_COUNT) - 1;
+
+// One in terms of fixed point.
+const double FRACT_ONE = (double)((uint64_t)1 << FRACT_BIT_COUNT);
+
+// Checks if all samples are zero.
+inline bool is_zero(const sample_t* samples, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (samples[i] > 0 || samples[i] < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Catmull-Rom interpolation between x0 and x1, f is in range [0; 1).
+inline sample_t interpolate(
+    sample_t xm1, sample_t x0, sample_t x1, sample_t x2, sample_t f) {
+    const sample_t a = 3 * (x0 - x1) + x2 - xm1;
+    const sample_t b = 2 * xm1 - 5 * x0 + 4 * x1 - x2;
+    const sample_t c = x1 - xm1;
+
+    return x0 + 0.5f * f * (c + f * (b + f * a));
+}
+
+} // namespace
+
+const float CubicResampler::MaxScalingDelta = 0.01f;
+
+CubicResampler::CubicResampler(core::IAllocator& allocator,
+                               core::BufferFactory<sample_t>& buffer_factory,
+                               ResamplerProfile,
+                               core::nanoseconds_t frame_length,
+                               const audio::SampleSpec& sample_spec)
+    : sample_spec_(sample_spec)
+    , frame_size_(sample_spec.ns_2_samples_overall(frame_length))
+    , frame_size_ch_(sample_spec.num_channels() ? frame_size_ / sample_spec.num_channels()
+                                                : 0)
+    , window_(allocator)
+    , n_ready_frames_(0)
+    , n_zero_frames_(0)
+    , scaling_(1.0f)
+    , qt_frame_size_((fixedpoint_t)frame_size_ch_ << FRACT_BIT_COUNT)
+    , qt_sample_(0)
+    , qt_dt_(0)
+    , valid_(false) {
+    const size_t num_ch = sample_spec_.num_channels();
+
+    if (num_ch < 1) {
+        roc_log(LogError, "cubic resampler: invalid num_channels: num_channels=%lu",
+                (unsigned long)num_ch);
+        return;
+    }
+
+    if (frame_size_ != frame_size_ch_ * num_ch || frame_size_ch_ < 2) {
+        roc_log(LogError,
+                "cubic resampler: invalid frame_size:"
+                " frame_size=%lu num_channels=%lu",
+                (unsigned long)frame_size_, (unsigned long)num_ch);
+        return;
+    }
+
+    in_frame_ = buffer_factory.new_buffer();
+    if (!in_frame_) {
+        roc_log(LogError, "cubic resampler: can't allocate frame buffer");
+        return;
+    }
+
+    if (in_frame_.capacity() < frame_size_) {
+        roc_log(LogError, "cubic resampler: allocated buffer is too small");
+        return;
+    }
+
+    in_frame_.reslice(0, frame_size_);
+
+    if (!window_.resize(num_ch + frame_size_ * 2)) {
+        roc_log(LogError, "cubic resampler: can't allocate window buffer");
+        return;
+    }
+
+    memset(window_.data(), 0, window_.size() * sizeof(sample_t));
+
+    roc_log(LogDebug, "cubic resampler: initializing: frame_size=%lu channels_num=%lu",
+            (unsigned long)frame_size_, (unsigned long)num_ch);
+
+    valid_ = true;
+}
+
+CubicResampler::~CubicResampler() {
+}
+
+bool CubicResampler::valid() const {
+    return valid_;
+}
+
+bool CubicResampler::set_profile(ResamplerProfile) {
+    return true;
+}
+
+bool CubicResampler::set_scaling(size_t input_sample_rate,
+                                 size_t output_sample_rate,
+                                 float multiplier) {
+    if (input_sample_rate == 0 || output_sample_rate == 0) {
+        roc_log(LogError, "cubic resampler: invalid rate");
+        return false;
+    }
+
+    const float new_scaling = float(input_sample_rate) / output_sample_rate * multiplier;
+
+    if (new_scaling <= 0) {
+        roc_log(LogError, "cubic resampler: invalid scaling");
+        return false;
+    }
+
+    // Every output sample should advance position by no more than one frame.
+    if (new_scaling > frame_size_ch_) {
+        roc_log(LogError,
+                "cubic resampler: scaling does not fit frame size:"
+                " frame_size=%lu scaling=%.5f",
+                (unsigned long)frame_size_, (double)new_scaling);
+        return false;
+    }
+
+    scaling_ = new_scaling;
+
+    return true;
+}
+
+const core::Slice<sample_t>& CubicResampler::begin_push_input() {
+    return in_frame_;
+}
+
+void CubicResampler::end_push_input() {
+    const size_t num_ch = sample_spec_.num_channels();
+
+    sample_t* window = window_.data();
+
+    // keep last sample of current frame, and shift next frame to current
+    memcpy(window, window + frame_size_, num_ch * sizeof(sample_t));
+    memcpy(window + num_ch, window + num_ch + frame_size_,
+           frame_size_ * sizeof(sample_t));
+    memcpy(window + num_ch + frame_size_, in_frame_.data(),
+           frame_size_ * sizeof(sample_t));
+
+    if (n_ready_frames_ < 2) {
+        n_ready_frames_++;
+    }
+
+    // window also includes one sample of previous frame, so three zero frames
+    // guarantee that whole window is zero
+    if (is_zero(in_frame_.data(), frame_size_)) {
+        if (n_zero_frames_ < 3) {
+            n_zero_frames_++;
+        }
+    } else {
+        n_zero_frames_ = 0;
+    }
+
+    if (qt_sample_ >= qt_frame_size_) {
+        qt_sample_ -= qt_frame_size_;
+    }
+
+    // scaling_ may change every frame so it have to be smooth
+    qt_dt_ = (fixedpoint_t)((double)scaling_ * FRACT_ONE + 0.5);
+}
+
+size_t CubicResampler::pop_output(Frame& out) {
+    if (n_ready_frames_ < 2) {
+        return 0;
+    }
+
+    // mono and stereo are the common cases, let compiler unroll inner loop
+    switch (sample_spec_.num_channels()) {
+    case 1:
+        return pop_output_<1>(out);
+    case 2:
+        return pop_output_<2>(out);
+    default:
+        return pop_output_<0>(out);
+    }
+}
+
+// If NumCh is zero, number of channels is taken from sample spec in runtime.
+template <size_t NumCh> size_t CubicResampler::pop_output_(Frame& out) {
+    const size_t num_ch = NumCh != 0 ? NumCh : sample_spec_.num_channels();
+
+    const sample_t* window = window_.data();
+    sample_t* out_data = out.samples();
+
+    size_t out_pos = 0;
+
+    for (; out_pos < out.num_samples(); out_pos += num_ch) {
+        if (qt_sample_ >= qt_frame_size_) {
+            break;
+        }
+
+        if (n_zero_frames_ == 3) {
+            memset(out_data + out_pos, 0, num_ch * sizeof(sample_t));
+            qt_sample_ += qt_dt_;
+            continue;
+        }
+
+        const size_t index = (size_t)(qt_sample_ >> FRACT_BIT_COUNT);
+        const sample_t fract = (sample_t)(uint32_t)(qt_sample_ & FRACT_PART_MASK)
+            * (sample_t)(1 / FRACT_ONE);
+
+        // window starts one sample before current frame
+        const sample_t* in = window + index * num_ch;
+
+        for (size_t ch = 0; ch < num_ch; ch++) {
+            out_data[out_pos + ch] =
+                interpolate(in[ch], in[num_ch + ch], in[num_ch * 2 + ch],
+                            in[num_ch * 3 + ch], fract);
+        }
+
+        qt_sample_ += qt_dt_;
+    }
+
+    return out_pos;
+}
+
+} // namespace audio
+} // namespace roc
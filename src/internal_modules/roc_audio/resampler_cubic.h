@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/resampler_cubic.h
+//! @brief Cubic resampler.
+
+#ifndef ROC_AUDIO_RESAMPLER_CUBIC_H_
+#define ROC_AUDIO_RESAMPLER_CUBIC_H_
+
+#include "roc_audio/frame.h"
+#include "roc_audio/iresampler.h"
+#include "roc_audio/resampler_profile.h"
+#include "roc_audio/sample.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/array.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace audio {
+
+//! Resamples audio stream using cubic interpolation.
+//! @remarks
+//!  Computes every output sample from four neighbour input samples using
+//!  Catmull-Rom spline. It doesn't apply anti-aliasing filter, so it's intended
+//!  for the case when input and output rates are equal and scaling only
+//!  compensates small clock drift, where it's much cheaper than sinc
+//!  interpolation and gives comparable quality.
+class CubicResampler : public IResampler, public core::NonCopyable<> {
+public:
+    //! Maximum scaling deviation from 1.0 for which resampler gives good quality.
+    static const float MaxScalingDelta;
+
+    //! Initialize.
+    CubicResampler(core::IAllocator& allocator,
+                   core::BufferFactory<sample_t>& buffer_factory,
+                   ResamplerProfile profile,
+                   core::nanoseconds_t frame_length,
+                   const audio::SampleSpec& sample_spec);
+
+    ~CubicResampler();
+
+    //! Check if object is successfully constructed.
+    virtual bool valid() const;
+
+    //! Set new resample factor.
+    virtual bool set_scaling(size_t input_rate, size_t output_rate, float multiplier);
+
+    //! Switch to another quality profile.
+    //! @remarks
+    //!  Cubic interpolation has single quality, so profile is ignored.
+    virtual bool set_profile(ResamplerProfile profile);
+
+    //! Get buffer to be filled with input data.
+    virtual const core::Slice<sample_t>& begin_push_input();
+
+    //! Commit buffer with input data.
+    virtual void end_push_input();
+
+    //! Read samples from input frame and fill output frame.
+    virtual size_t pop_output(Frame& out);
+
+private:
+    typedef uint64_t fixedpoint_t;
+
+    template <size_t NumCh> size_t pop_output_(Frame& out);
+
+    const audio::SampleSpec sample_spec_;
+
+    const size_t frame_size_;
+    const size_t frame_size_ch_;
+
+    // buffer returned by begin_push_input()
+    core::Slice<sample_t> in_frame_;
+
+    // one last sample of previous frame, current frame, and next frame,
+    // stored continuously
+    core::Array<sample_t> window_;
+    size_t n_ready_frames_;
+
+    // number of last consecutive input frames with all samples zero,
+    // if whole window is zero, output is zero too and we skip computations
+    size_t n_zero_frames_;
+
+    float scaling_;
+
+    const fixedpoint_t qt_frame_size_;
+
+    // time position of output sample in terms of input samples indexes
+    // for example 0 -- time position of first sample in current frame
+    fixedpoint_t qt_sample_;
+
+    // time distance between two output samples, equals to resampling factor
+    fixedpoint_t qt_dt_;
+
+    bool valid_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_RESAMPLER_CUBIC_H_
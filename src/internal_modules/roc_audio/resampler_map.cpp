@@ -8,6 +8,7 @@
 
 #include "roc_audio/resampler_map.h"
 #include "roc_audio/resampler_builtin.h"
+#include "roc_audio/resampler_cubic.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/scoped_ptr.h"
@@ -49,6 +50,12 @@ ResamplerMap::ResamplerMap()
         back.ctor = &resampler_ctor<BuiltinResampler>;
         add_backend_(back);
     }
+    {
+        Backend back;
+        back.id = ResamplerBackend_Cubic;
+        back.ctor = &resampler_ctor<CubicResampler>;
+        add_backend_(back);
+    }
 }
 
 size_t ResamplerMap::num_backends() const {
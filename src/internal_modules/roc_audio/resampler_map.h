@@ -50,7 +50,7 @@ public:
 private:
     friend class core::Singleton<ResamplerMap>;
 
-    enum { MaxBackends = 2 };
+    enum { MaxBackends = 3 };
 
     struct Backend {
         Backend()
@@ -7,11 +7,20 @@
  */
 
 #include "roc_audio/resampler_reader.h"
+#include "roc_core/log.h"
 #include "roc_core/panic.h"
 
 namespace roc {
 namespace audio {
 
+namespace {
+
+// Number of last input frames that affect resampler output.
+// If all of them are zero, output is zero too.
+const size_t ResamplerInputFrames = 3;
+
+} // namespace
+
 ResamplerReader::ResamplerReader(IFrameReader& reader,
                                  IResampler& resampler,
                                  const SampleSpec& in_sample_spec,
@@ -20,12 +29,75 @@ ResamplerReader::ResamplerReader(IFrameReader& reader,
     , reader_(reader)
     , in_sample_spec_(in_sample_spec)
     , out_sample_spec_(out_sample_spec)
+    , num_channels_(in_sample_spec.num_channels())
+    , mapper_(in_sample_spec.channel_mask(), out_sample_spec.channel_mask())
+    , map_input_(false)
+    , map_output_(false)
+    , n_zero_inputs_(0)
+    , has_last_level_(false)
     , scaling_(1.0f)
     , valid_(false) {
     if (in_sample_spec_.channel_mask() != out_sample_spec_.channel_mask()) {
         roc_panic("resampler reader: input and output channel mask should be equal");
     }
 
+    init_();
+}
+
+ResamplerReader::ResamplerReader(IFrameReader& reader,
+                                 IResampler& resampler,
+                                 core::BufferFactory<sample_t>& buffer_factory,
+                                 const SampleSpec& in_sample_spec,
+                                 const SampleSpec& out_sample_spec,
+                                 ChannelMixing mixing)
+    : resampler_(resampler)
+    , reader_(reader)
+    , in_sample_spec_(in_sample_spec)
+    , out_sample_spec_(out_sample_spec)
+    , num_channels_(packet::num_channels(
+          resampler_channels(in_sample_spec, out_sample_spec)))
+    , mapper_(in_sample_spec.channel_mask(), out_sample_spec.channel_mask(), mixing)
+    , map_input_(false)
+    , map_output_(false)
+    , n_zero_inputs_(0)
+    , has_last_level_(false)
+    , scaling_(1.0f)
+    , valid_(false) {
+    if (in_sample_spec_.channel_mask() != out_sample_spec_.channel_mask()) {
+        temp_buf_ = buffer_factory.new_buffer();
+        if (!temp_buf_) {
+            roc_log(LogError, "resampler reader: can't allocate temporary buffer");
+            return;
+        }
+
+        if (temp_buf_.capacity()
+            < std::max(in_sample_spec_.num_channels(), out_sample_spec_.num_channels())) {
+            roc_log(LogError, "resampler reader: allocated buffer is too small");
+            return;
+        }
+
+        temp_buf_.reslice(0, temp_buf_.capacity());
+
+        if (num_channels_ == out_sample_spec_.num_channels()) {
+            map_input_ = true;
+        } else {
+            map_output_ = true;
+        }
+    }
+
+    init_();
+}
+
+packet::channel_mask_t
+ResamplerReader::resampler_channels(const SampleSpec& in_sample_spec,
+                                    const SampleSpec& out_sample_spec) {
+    if (out_sample_spec.num_channels() < in_sample_spec.num_channels()) {
+        return out_sample_spec.channel_mask();
+    }
+    return in_sample_spec.channel_mask();
+}
+
+void ResamplerReader::init_() {
     if (!resampler_.valid()) {
         return;
     }
@@ -54,11 +126,75 @@ bool ResamplerReader::set_scaling(float multiplier) {
 bool ResamplerReader::read(Frame& out) {
     roc_panic_if_not(valid());
 
+    if (!map_output_) {
+        return read_(out);
+    }
+
+    // Resample into temporary buffer using input channels, and then
+    // map resampled samples into output frame.
+    const size_t in_ch = in_sample_spec_.num_channels();
+    const size_t out_ch = out_sample_spec_.num_channels();
+
+    const size_t max_batch = temp_buf_.size() / in_ch;
+
+    sample_t* out_samples = out.samples();
+    size_t n_samples = out.num_samples() / out_ch;
+
+    bool zeros = true;
+
+    FrameLevel level;
+    bool has_level = true;
+
+    while (n_samples != 0) {
+        const size_t n_read = std::min(n_samples, max_batch);
+
+        Frame temp_frame(temp_buf_.data(), n_read * in_ch);
+        if (!read_(temp_frame)) {
+            return false;
+        }
+
+        if (temp_frame.has_level()) {
+            level.add_level(temp_frame.level());
+        } else {
+            has_level = false;
+        }
+
+        Frame out_frame(out_samples, n_read * out_ch);
+        if (temp_frame.flags() & Frame::FlagZeros) {
+            memset(out_samples, 0, out_frame.num_samples() * sizeof(sample_t));
+        } else {
+            mapper_.map(temp_frame, out_frame);
+            zeros = false;
+        }
+
+        out_samples += n_read * out_ch;
+        n_samples -= n_read;
+    }
+
+    out.set_flags(zeros ? (unsigned)Frame::FlagZeros : 0);
+
+    if (has_level) {
+        out.set_level(level);
+    }
+
+    return true;
+}
+
+// Output samples are produced from several input frames, and resampling
+// keeps signal level, so level of the last input frame is used as an
+// approximation of the level of output frame.
+bool ResamplerReader::read_(Frame& out) {
     size_t out_pos = 0;
 
+    bool zeros = true;
+
     while (out_pos < out.num_samples()) {
         Frame out_part(out.samples() + out_pos, out.num_samples() - out_pos);
 
+        if (n_zero_inputs_ < ResamplerInputFrames) {
+            zeros = false;
+        }
+
         const size_t num_popped = resampler_.pop_output(out_part);
 
         if (num_popped < out_part.num_samples()) {
@@ -70,6 +206,12 @@ bool ResamplerReader::read(Frame& out) {
         out_pos += num_popped;
     }
 
+    out.set_flags(zeros ? (unsigned)Frame::FlagZeros : 0);
+
+    if (has_last_level_) {
+        out.set_level(last_level_);
+    }
+
     return true;
 }
 
@@ -78,13 +220,87 @@ bool ResamplerReader::push_input_() {
 
     Frame frame(buff.data(), buff.size());
 
-    if (!reader_.read(frame)) {
+    bool zeros = false;
+    FrameLevel level;
+    bool has_level = true;
+    if (!read_input_(frame, zeros, level, has_level)) {
         return false;
     }
 
+    has_last_level_ = has_level;
+    if (has_level) {
+        last_level_ = level;
+    }
+
+    if (zeros) {
+        if (n_zero_inputs_ < ResamplerInputFrames) {
+            n_zero_inputs_++;
+        }
+    } else {
+        n_zero_inputs_ = 0;
+    }
+
     resampler_.end_push_input();
     return true;
 }
 
+bool ResamplerReader::read_input_(Frame& frame,
+                                  bool& zeros,
+                                  FrameLevel& level,
+                                  bool& has_level) {
+    if (!map_input_) {
+        if (!reader_.read(frame)) {
+            return false;
+        }
+        zeros = (frame.flags() & Frame::FlagZeros);
+        if (frame.has_level()) {
+            level.add_level(frame.level());
+        } else {
+            has_level = false;
+        }
+        return true;
+    }
+
+    zeros = true;
+
+    // Read input samples into temporary buffer, and then map them
+    // into resampler buffer using output channels.
+    const size_t in_ch = in_sample_spec_.num_channels();
+    const size_t out_ch = out_sample_spec_.num_channels();
+
+    const size_t max_batch = temp_buf_.size() / in_ch;
+
+    sample_t* out_samples = frame.samples();
+    size_t n_samples = frame.num_samples() / out_ch;
+
+    while (n_samples != 0) {
+        const size_t n_read = std::min(n_samples, max_batch);
+
+        Frame in_frame(temp_buf_.data(), n_read * in_ch);
+        if (!reader_.read(in_frame)) {
+            return false;
+        }
+
+        if (in_frame.has_level()) {
+            level.add_level(in_frame.level());
+        } else {
+            has_level = false;
+        }
+
+        Frame out_frame(out_samples, n_read * out_ch);
+        if (in_frame.flags() & Frame::FlagZeros) {
+            memset(out_samples, 0, out_frame.num_samples() * sizeof(sample_t));
+        } else {
+            mapper_.map(in_frame, out_frame);
+            zeros = false;
+        }
+
+        out_samples += n_read * out_ch;
+        n_samples -= n_read;
+    }
+
+    return true;
+}
+
 } // namespace audio
 } // namespace roc
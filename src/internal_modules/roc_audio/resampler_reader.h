@@ -12,12 +12,15 @@
 #ifndef ROC_AUDIO_RESAMPLER_READER_H_
 #define ROC_AUDIO_RESAMPLER_READER_H_
 
+#include "roc_audio/channel_layout.h"
+#include "roc_audio/channel_mapper.h"
 #include "roc_audio/frame.h"
 #include "roc_audio/iframe_reader.h"
 #include "roc_audio/iresampler.h"
 #include "roc_audio/sample.h"
 #include "roc_audio/sample_spec.h"
 #include "roc_core/array.h"
+#include "roc_core/buffer_factory.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
 #include "roc_core/stddefs.h"
@@ -27,14 +30,38 @@ namespace roc {
 namespace audio {
 
 //! Resampler element for reading pipeline.
+//! @remarks
+//!  Optionally, also converts between channel masks in the same pass, which is
+//!  cheaper than a separate ChannelMapperReader. In this case, resampler
+//!  should be created for the channel mask returned by resampler_channels(),
+//!  so that it processes the smallest number of channels: input frames are
+//!  downmixed before resampling, or output frames are upmixed after it.
+//!
+//!  Output frame gets Frame::FlagZeros if it was produced only from input
+//!  frames with this flag, and mapping of such frames is skipped.
 class ResamplerReader : public IFrameReader, public core::NonCopyable<> {
 public:
     //! Initialize.
+    //! Input and output channel masks should be equal.
     ResamplerReader(IFrameReader& reader,
                     IResampler& resampler,
                     const SampleSpec& in_sample_spec,
                     const SampleSpec& out_sample_spec);
 
+    //! Initialize with channel mapping.
+    //! @remarks
+    //!  @p buffer_factory is used to allocate temporary buffer for mapping.
+    ResamplerReader(IFrameReader& reader,
+                    IResampler& resampler,
+                    core::BufferFactory<sample_t>& buffer_factory,
+                    const SampleSpec& in_sample_spec,
+                    const SampleSpec& out_sample_spec,
+                    ChannelMixing mixing);
+
+    //! Get channel mask which should be used by resampler.
+    static packet::channel_mask_t resampler_channels(const SampleSpec& in_sample_spec,
+                                                     const SampleSpec& out_sample_spec);
+
     //! Check if object is successfully constructed.
     bool valid() const;
 
@@ -45,7 +72,11 @@ public:
     virtual bool read(Frame&);
 
 private:
+    void init_();
+
+    bool read_(Frame& out);
     bool push_input_();
+    bool read_input_(Frame& frame, bool& zeros, FrameLevel& level, bool& has_level);
 
     IResampler& resampler_;
     IFrameReader& reader_;
@@ -53,6 +84,23 @@ private:
     const audio::SampleSpec in_sample_spec_;
     const audio::SampleSpec out_sample_spec_;
 
+    // number of channels processed by resampler
+    const size_t num_channels_;
+
+    // mapper and temporary buffer for input (if mapping before resampler)
+    // or output (if mapping after resampler) frames
+    ChannelMapper mapper_;
+    core::Slice<sample_t> temp_buf_;
+    bool map_input_;
+    bool map_output_;
+
+    // number of last consecutive input frames with FlagZeros
+    size_t n_zero_inputs_;
+
+    // level of last input frame, attached to output frames
+    FrameLevel last_level_;
+    bool has_last_level_;
+
     float scaling_;
     bool valid_;
 };
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/sinc_table_map.h"
+#include "roc_audio/sinc_tables.h"
+#include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+SincTableMap::SincTableMap()
+    : n_tables_(0) {
+}
+
+const sample_t* SincTableMap::get_table(size_t window_size, size_t window_interp) {
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(sinc_tables); n++) {
+        if (sinc_tables[n].window_size == window_size
+            && sinc_tables[n].window_interp == window_interp) {
+            return sinc_tables[n].samples;
+        }
+    }
+
+    core::Mutex::Lock lock(mutex_);
+
+    for (size_t n = 0; n < n_tables_; n++) {
+        if (tables_[n].window_size == window_size
+            && tables_[n].window_interp == window_interp) {
+            return tables_[n].samples->data();
+        }
+    }
+
+    if (n_tables_ == MaxTables) {
+        roc_panic("sinc table map: too many tables: max=%d", (int)MaxTables);
+    }
+
+    core::Array<sample_t>* samples = make_table_(window_size, window_interp);
+    if (!samples) {
+        return NULL;
+    }
+
+    tables_[n_tables_].window_size = window_size;
+    tables_[n_tables_].window_interp = window_interp;
+    tables_[n_tables_].samples = samples;
+    n_tables_++;
+
+    roc_log(LogDebug, "sinc table map: created table: window_size=%lu window_interp=%lu",
+            (unsigned long)window_size, (unsigned long)window_interp);
+
+    return samples->data();
+}
+
+core::Array<sample_t>* SincTableMap::make_table_(size_t window_size,
+                                                 size_t window_interp) {
+    core::Array<sample_t>* samples = new (allocator_) core::Array<sample_t>(allocator_);
+    if (!samples) {
+        roc_log(LogError, "sinc table map: can't allocate table");
+        return NULL;
+    }
+
+    core::Array<sample_t>& table = *samples;
+
+    if (!table.resize(window_size * window_interp + 2)) {
+        roc_log(LogError, "sinc table map: can't allocate table");
+        allocator_.destroy_object(table);
+        return NULL;
+    }
+
+    // should match sinc_tables_gen.py
+    const double sinc_step = 1.0 / (double)window_interp;
+    double sinc_t = sinc_step;
+
+    table[0] = 1.0f;
+    for (size_t i = 1; i < table.size(); ++i) {
+        const double window = 0.54
+            - 0.46
+                * std::cos(2 * M_PI
+                           * ((double)(i - 1) / 2.0 / (double)table.size() + 0.5));
+        table[i] = (float)(std::sin(M_PI * sinc_t) / M_PI / sinc_t * window);
+        sinc_t += sinc_step;
+    }
+    table[table.size() - 2] = 0;
+    table[table.size() - 1] = 0;
+
+    return samples;
+}
+
+} // namespace audio
+} // namespace roc
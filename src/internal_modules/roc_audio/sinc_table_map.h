@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/sinc_table_map.h
+//! @brief Shared sinc tables.
+
+#ifndef ROC_AUDIO_SINC_TABLE_MAP_H_
+#define ROC_AUDIO_SINC_TABLE_MAP_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/array.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Process-wide cache of windowed sinc tables.
+//! @remarks
+//!  Sinc table depends only on window parameters, which are defined by
+//!  resampler profile. Tables for all resampler profiles are generated at
+//!  build time by sinc_tables_gen.py and stored in read-only data. Tables for
+//!  other parameters are computed on first request. All tables are shared by
+//!  resamplers with the same parameters; they're never modified or freed.
+class SincTableMap : public core::NonCopyable<> {
+public:
+    //! Get instance.
+    static SincTableMap& instance() {
+        return core::Singleton<SincTableMap>::instance();
+    }
+
+    //! Get table for given window size and number of interpolation points.
+    //! @remarks
+    //!  Table has window_size * window_interp + 2 elements, the last two are
+    //!  zero padding. Thread-safe.
+    //! @returns
+    //!  NULL if table can't be allocated.
+    const sample_t* get_table(size_t window_size, size_t window_interp);
+
+private:
+    friend class core::Singleton<SincTableMap>;
+
+    enum { MaxTables = 8 };
+
+    struct Table {
+        size_t window_size;
+        size_t window_interp;
+        core::Array<sample_t>* samples;
+    };
+
+    SincTableMap();
+
+    core::Array<sample_t>* make_table_(size_t window_size, size_t window_interp);
+
+    core::Mutex mutex_;
+    core::HeapAllocator allocator_;
+
+    Table tables_[MaxTables];
+    size_t n_tables_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_TABLE_MAP_H_
@@ -0,0 +1,9518 @@
+/*
+ * THIS FILE IS AUTO-GENERATED USING `sinc_tables_gen.py'
+ */
+
+#ifndef ROC_AUDIO_SINC_TABLES_H_
+#define ROC_AUDIO_SINC_TABLES_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+// ResamplerProfile_Low
+const sample_t sinc_table_16_64[1026] = {
+    1.0f, 0.999598453f, 0.99839224f, 0.996380965f,
+    0.993567568f, 0.989956159f, 0.985552014f, 0.980361566f,
+    0.974392393f, 0.967653202f, 0.960153818f, 0.951905165f,
+    0.942919247f, 0.933209126f, 0.922788901f, 0.911673683f,
+    0.899879565f, 0.887423601f, 0.87432377f, 0.860598948f,
+    0.846268873f, 0.831354114f, 0.815876032f, 0.799856744f,
+    0.783319086f, 0.766286571f, 0.748783353f, 0.730834178f,
+    0.71246435f, 0.693699682f, 0.674566452f, 0.655091361f,
+    0.635301484f, 0.615224229f, 0.594887284f, 0.574318575f,
+    0.553546214f, 0.53259846f, 0.511503663f, 0.490290219f,
+    0.468986525f, 0.447620931f, 0.426221692f, 0.404816919f,
+    0.383434538f, 0.362102242f, 0.340847444f, 0.319697237f,
+    0.298678344f, 0.277817082f, 0.257139316f, 0.236670418f,
+    0.21643523f, 0.196458022f, 0.176762458f, 0.157371555f,
+    0.138307654f, 0.119592381f, 0.101246618f, 0.0832904741f,
+    0.065743251f, 0.0486234205f, 0.0319485971f, 0.0157355138f,
+    3.86491141e-17f, -0.015243039f, -0.0299796407f, -0.0441968028f,
+    -0.0578824976f, -0.0710256857f, -0.0836163271f, -0.0956453908f,
+    -0.107104862f, -0.11798775f, -0.128288086f, -0.138000932f,
+    -0.147122378f, -0.155649537f, -0.163580545f, -0.170914556f,
+    -0.177651729f, -0.183793225f, -0.189341193f, -0.194298754f,
+    -0.198669994f, -0.202459941f, -0.205674548f, -0.208320678f,
+    -0.210406077f, -0.211939356f, -0.212929963f, -0.213388163f,
+    -0.213325005f, -0.212752297f, -0.21168258f, -0.210129091f,
+    -0.208105736f, -0.205627056f, -0.202708196f, -0.199364865f,
+    -0.195613309f, -0.191470268f, -0.186952942f, -0.182078957f,
+    -0.176866323f, -0.171333398f, -0.16549885f, -0.159381617f,
+    -0.153000872f, -0.146375979f, -0.139526456f, -0.132471941f,
+    -0.125232143f, -0.117826815f, -0.110275707f, -0.102598533f,
+    -0.0948149306f, -0.0869444271f, -0.0790064f, -0.0710200431f,
+    -0.0630043307f, -0.0549779836f, -0.0469594352f, -0.0389667994f,
+    -0.0310178384f, -0.0231299324f, -0.0153200499f, -0.00760471891f,
+    -3.76429005e-17f, 0.0074785401f, 0.0148158534f, 0.0219974341f,
+    0.0290093412f, 0.0358382193f, 0.0424713179f, 0.04889651f,
+    0.0551023087f, 0.0610778819f, 0.066813067f, 0.0722983823f,
+    0.0775250381f, 0.0824849461f, 0.0871707267f, 0.0915757153f,
+    0.0956939672f, 0.0995202605f, 0.103050097f, 0.106279705f,
+    0.109206032f, 0.11182675f, 0.114140244f, 0.11614561f,
+    0.117842647f, 0.119231846f, 0.120314384f, 0.121092112f,
+    0.121567539f, 0.121743822f, 0.121624748f, 0.12121472f,
+    0.120518739f, 0.119542385f, 0.118291798f, 0.116773659f,
+    0.114995164f, 0.112964008f, 0.110688357f, 0.108176828f,
+    0.10543846f, 0.102482693f, 0.0993193406f, 0.0959585634f,
+    0.0924108428f, 0.0886869535f, 0.0847979364f, 0.0807550703f,
+    0.0765698445f, 0.0722539303f, 0.0678191526f, 0.0632774622f,
+    0.058640907f, 0.0539216042f, 0.049131712f, 0.0442834023f,
+    0.0393888324f, 0.0344601186f, 0.029509309f, 0.024548357f,
+    0.0195890957f, 0.0146432123f, 0.00972222356f, 0.00483745149f,
+    3.60015115e-17f, -0.00477926778f, -0.00948975149f, -0.0141211346f,
+    -0.0186634047f, -0.023106873f, -0.0274421923f, -0.0316603751f,
+    -0.0357528097f, -0.0397112759f, -0.0435279593f, -0.0471954646f,
+    -0.0507068282f, -0.0540555292f, -0.0572354995f, -0.0602411329f,
+    -0.0630672929f, -0.0657093192f, -0.0681630334f, -0.0704247437f,
+    -0.0724912476f, -0.0743598343f, -0.0760282859f, -0.0774948768f,
+    -0.0787583728f, -0.0798180286f, -0.0806735843f, -0.081325261f,
+    -0.0817737552f, -0.082020232f, -0.0820663178f, -0.0819140915f,
+    -0.0815660751f, -0.0810252231f, -0.0802949113f, -0.0793789246f,
+    -0.0782814441f, -0.0770070329f, -0.0755606221f, -0.0739474953f,
+    -0.0721732726f, -0.0702438946f, -0.0681656047f, -0.0659449318f,
+    -0.0635886724f, -0.0611038715f, -0.0584978044f, -0.0557779567f,
+    -0.0529520054f, -0.0500277985f, -0.0470133353f, -0.0439167463f,
+    -0.0407462725f, -0.0375102455f, -0.0342170666f, -0.0308751872f,
+    -0.0274930878f, -0.0240792584f, -0.020642178f, -0.0171902956f,
+    -0.01373201f, -0.0102756508f, -0.00682945994f, -0.00340157272f,
+    -3.378778e-17f, 0.0033673894f, 0.00669288583f, 0.00996895536f,
+    0.0131882557f, 0.0163436519f, 0.0194282305f, 0.0224353144f,
+    0.0253584757f, 0.0281915489f, 0.0309286423f, 0.03356415f,
+    0.0360927617f, 0.0385094727f, 0.040809593f, 0.0429887547f,
+    0.04504292f, 0.0469683871f, 0.0487617958f, 0.0504201324f,
+    0.0519407336f, 0.0533212889f, 0.0545598436f, 0.0556547993f,
+    0.0566049149f, 0.0574093059f, 0.058067443f, 0.0585791505f,
+    0.0589446031f, 0.0591643221f, 0.0592391713f, 0.0591703515f,
+    0.0589593947f, 0.0586081571f, 0.0581188122f, 0.0574938422f,
+    0.0567360297f, 0.0558484479f, 0.054834451f, 0.0536976634f,
+    0.052441969f, 0.051071499f, 0.0495906204f, 0.0480039232f,
+    0.0463162073f, 0.0445324696f, 0.0426578901f, 0.0406978177f,
+    0.0386577565f, 0.0365433507f, 0.0343603703f, 0.0321146961f,
+    0.0298123048f, 0.0274592537f, 0.0250616657f, 0.0226257143f,
+    0.020157608f, 0.0176635757f, 0.0151498512f, 0.0126226587f,
+    0.010088198f, 0.00755262969f, 0.00502206093f, 0.00250253154f,
+    3.1086448e-17f, -0.00247966993f, -0.00493072241f, -0.00734752225f,
+    -0.0097245673f, -0.0120565004f, -0.0143381208f, -0.0165643954f,
+    -0.018730469f, -0.0208316744f, -0.0228635421f, -0.024821809f,
+    -0.0267024267f, -0.0285015695f, -0.0302156414f, -0.0318412826f,
+    -0.0333753759f, -0.0348150513f, -0.0361576913f, -0.0374009347f,
+    -0.0385426798f, -0.0395810876f, -0.0405145832f, -0.0413418582f,
+    -0.0420618705f, -0.0426738452f, -0.0431772737f, -0.0435719126f,
+    -0.0438577823f, -0.0440351641f, -0.0441045978f, -0.0440668778f,
+    -0.0439230488f, -0.0436744017f, -0.0433224678f, -0.0428690133f,
+    -0.0423160328f, -0.0416657429f, -0.0409205744f, -0.0400831652f,
+    -0.0391563516f, -0.0381431601f, -0.0370467986f, -0.0358706466f,
+    -0.0346182461f, -0.0332932915f, -0.0318996192f, -0.0304411976f,
+    -0.0289221159f, -0.0273465737f, -0.0257188696f, -0.0240433901f,
+    -0.0223245984f, -0.020567023f, -0.0187752459f, -0.0169538917f,
+    -0.0151076156f, -0.0132410922f, -0.011359004f, -0.00946603004f,
+    -0.00756683485f, -0.00566605704f, -0.00376829862f, -0.0018781141f,
+    -2.80009233e-17f, 0.00186161551f, 0.00370238268f, 0.00551803995f,
+    0.0073044235f, 0.00905747642f, 0.0107732575f, 0.01244795f,
+    0.0140778692f, 0.0156594708f, 0.0171893578f, 0.0186642877f,
+    0.0200811787f, 0.0214371162f, 0.0227293577f, 0.0239553387f,
+    0.0251126766f, 0.0261991757f, 0.02721283f, 0.0281518272f,
+    0.0290145508f, 0.0297995829f, 0.0305057051f, 0.0311319007f,
+    0.0316773546f, 0.0321414539f, 0.0325237877f, 0.0328241462f,
+    0.0330425195f, 0.0331790958f, 0.0332342596f, 0.0332085887f,
+    0.0331028512f, 0.0329180022f, 0.0326551797f, 0.0323157004f,
+    0.0319010548f, 0.0314129023f, 0.0308530656f, 0.0302235249f,
+    0.0295264119f, 0.0287640029f, 0.0279387128f, 0.0270530872f,
+    0.0261097958f, 0.0251116247f, 0.0240614681f, 0.0229623214f,
+    0.0218172721f, 0.0206294919f, 0.0194022288f, 0.0181387974f,
+    0.0168425717f, 0.0155169752f, 0.0141654729f, 0.0127915624f,
+    0.011398765f, 0.00999061711f, 0.00857066139f, 0.00714243835f,
+    0.00570947759f, 0.00427528944f, 0.00284335655f, 0.00141712576f,
+    2.46493204e-17f, -0.00140466957f, -0.0027935912f, -0.00416354009f,
+    -0.00551136554f, -0.00683399803f, -0.00812845592f, -0.00939185192f,
+    -0.0106213993f, -0.0118144177f, -0.0129683389f, -0.0140807119f,
+    -0.0151492078f, -0.0161716246f, -0.0171458913f, -0.0180700719f,
+    -0.0189423687f, -0.0197611257f, -0.0205248313f, -0.0212321208f,
+    -0.0218817781f, -0.0224727379f, -0.0230040864f, -0.0234750627f,
+    -0.0238850589f, -0.0242336205f, -0.0245204463f, -0.0247453873f,
+    -0.0249084461f, -0.0250097756f, -0.025049677f, -0.0250285982f,
+    -0.024947131f, -0.0248060087f, -0.0246061029f, -0.0243484204f,
+    -0.0240340993f, -0.023664405f, -0.0232407266f, -0.0227645717f,
+    -0.0222375621f, -0.0216614288f, -0.0210380067f, -0.0203692295f,
+    -0.0196571236f, -0.0189038031f, -0.0181114631f, -0.0172823742f,
+    -0.0164188761f, -0.0155233713f, -0.0145983186f, -0.0136462268f,
+    -0.0126696481f, -0.0116711714f, -0.0106534157f, -0.00961902358f,
+    -0.00857065439f, -0.00751097769f, -0.00644266669f, -0.00536839163f,
+    -0.00429081336f, -0.00321257692f, -0.00213630522f, -0.00106459284f,
+    -2.11599396e-17f, 0.00105495343f, 0.00209779367f, 0.00312609867f,
+    0.00413750357f, 0.00512970591f, 0.00610047075f, 0.00704763544f,
+    0.00796911431f, 0.00886290306f, 0.00972708289f, 0.0105598244f,
+    0.0113593914f, 0.0121241441f, 0.0128525422f, 0.0135431481f,
+    0.0141946293f, 0.0148057605f, 0.0153754258f, 0.0159026207f,
+    0.0163864529f, 0.0168261442f, 0.0172210307f, 0.017570564f,
+    0.017874311f, 0.0181319541f, 0.0183432911f, 0.0185082343f,
+    0.01862681f, 0.018699157f, 0.0187255258f, 0.0187062764f,
+    0.018641877f, 0.0185329011f, 0.0183800258f, 0.0181840292f,
+    0.0179457871f, 0.0176662701f, 0.0173465408f, 0.0169877498f,
+    0.0165911324f, 0.0161580046f, 0.0156897595f, 0.0151878627f,
+    0.0146538484f, 0.0140893147f, 0.0134959196f, 0.0128753759f,
+    0.0122294467f, 0.0115599406f, 0.0108687069f, 0.0101576307f,
+    0.00942862771f, 0.00868363974f, 0.00792462927f, 0.00715357468f,
+    0.00637246518f, 0.00558329587f, 0.00478806279f, 0.003988758f,
+    0.00318736479f, 0.00238585286f, 0.00158617362f, 0.00079025562f,
+    1.76663552e-17f, -0.000782723891f, -0.00155608278f, -0.00231828363f,
+    -0.00306757765f, -0.00380226415f, -0.0045206943f, -0.00522127462f,
+    -0.00590247043f, -0.00656280899f, -0.00720088259f, -0.00781535133f,
+    -0.00840494579f, -0.00896846947f, -0.00950480105f, -0.0100128964f,
+    -0.0104917904f, -0.0109405985f, -0.0113585183f, -0.0117448307f,
+    -0.0120989006f, -0.0124201778f, -0.0127081979f, -0.012962582f,
+    -0.0131830372f, -0.0133693565f, -0.0135214182f, -0.0136391857f,
+    -0.0137227066f, -0.0137721118f, -0.0137876143f, -0.0137695082f,
+    -0.0137181666f, -0.0136340405f, -0.0135176567f, -0.0133696157f,
+    -0.0131905896f, -0.0129813199f, -0.0127426144f, -0.0124753456f,
+    -0.0121804469f, -0.0118589102f, -0.0115117831f, -0.0111401652f,
+    -0.0107452054f, -0.0103280983f, -0.00989008087f, -0.00943242917f,
+    -0.00895645459f, -0.00846350038f, -0.00795493805f, -0.00743216367f,
+    -0.00689659425f, -0.00634966399f, -0.00579282062f, -0.00522752169f,
+    -0.00465523089f, -0.00407741439f, -0.00349553719f, -0.00291105957f,
+    -0.00232543348f, -0.00174009912f, -0.00115648145f, -0.000575986893f,
+    -1.43023024e-17f, 0.000570119691f, 0.00113304077f, 0.00168746296f,
+    0.00223211997f, 0.00276578232f, 0.00328725996f, 0.0037954048f,
+    0.00428911314f, 0.00476732793f, 0.00522904088f, 0.00567329447f,
+    0.00609918379f, 0.00650585823f, 0.00689252301f, 0.0072584406f,
+    0.00760293193f, 0.00792537745f, 0.0082252181f, 0.00850195601f,
+    0.00875515514f, 0.00898444168f, 0.00918950439f, 0.00937009467f,
+    0.00952602653f, 0.00965717644f, 0.00976348297f, 0.00984494627f,
+    0.00990162747f, 0.0099336479f, 0.00994118812f, 0.0099244869f,
+    0.00988384002f, 0.00981959893f, 0.0097321693f, 0.0096220095f,
+    0.00948962883f, 0.00933558583f, 0.0091604863f, 0.00896498136f,
+    0.00874976535f, 0.00851557367f, 0.00826318051f, 0.00799339656f,
+    0.0077070666f, 0.00740506706f, 0.00708830353f, 0.00675770822f,
+    0.00641423734f, 0.00605886852f, 0.00569259816f, 0.00531643877f,
+    0.00493141628f, 0.00453856739f, 0.00413893687f, 0.00373357493f,
+    0.00332353451f, 0.00290986871f, 0.00249362814f, 0.00207585839f,
+    0.00165759747f, 0.00123987334f, 0.000823701496f, 0.00041008256f,
+    4.07250456e-17f, -0.000405582128f, -0.000805721349f, -0.00119949886f,
+    -0.00158602155f, -0.00196442391f, -0.00233386991f, -0.00269355467f,
+    -0.0030427062f, -0.00338058688f, -0.00370649492f, -0.00401976572f,
+    -0.00431977308f, -0.00460593035f, -0.00487769142f, -0.00513455164f,
+    -0.00537604858f, -0.00560176276f, -0.00581131816f, -0.00600438267f,
+    -0.00618066847f, -0.00633993218f, -0.00648197503f, -0.00660664282f,
+    -0.0067138258f, -0.00680345845f, -0.00687551917f, -0.0069300298f,
+    -0.00696705511f, -0.00698670213f, -0.00698911945f, -0.00697449633f,
+    -0.00694306181f, -0.0068950837f, -0.00683086745f, -0.00675075496f,
+    -0.00665512339f, -0.00654438373f, -0.00641897948f, -0.00627938513f,
+    -0.00612610466f, -0.00595966994f, -0.00578063913f, -0.00558959494f,
+    -0.00538714295f, -0.00517390985f, -0.00495054163f, -0.00471770176f,
+    -0.00447606937f, -0.00422633736f, -0.00396921055f, -0.00370540378f,
+    -0.00343564004f, -0.0031606486f, -0.00288116309f, -0.00259791968f,
+    -0.0023116552f, -0.00202310535f, -0.00173300283f, -0.00144207563f,
+    -0.00115104522f, -0.000860624917f, -0.000571518153f, -0.000284416882f,
+    -8.46801061e-18f, 0.000281068182f, 0.000558139408f, 0.000830582886f,
+    0.00109778665f, 0.00135915883f, 0.0016141289f, 0.00186214883f,
+    0.00210269416f, 0.00233526502f, 0.00255938708f, 0.00277461242f,
+    0.00298052031f, 0.00317671791f, 0.00336284095f, 0.00353855426f,
+    0.00370355224f, 0.00385755928f, 0.00400033005f, 0.0041316498f,
+    0.00425133445f, 0.00435923072f, 0.00445521612f, 0.00453919889f,
+    0.00461111783f, 0.00467094212f, 0.00471867099f, 0.00475433338f,
+    0.00477798749f, 0.00478972029f, 0.00478964695f, 0.00477791021f,
+    0.00475467972f, 0.00472015122f, 0.00467454584f, 0.00461810913f,
+    0.00455111026f, 0.00447384098f, 0.00438661469f, 0.00428976537f,
+    0.00418364647f, 0.00406862988f, 0.00394510472f, 0.00381347619f,
+    0.00367416436f, 0.00352760299f, 0.00337423825f, 0.00321452749f,
+    0.00304893796f, 0.00287794556f, 0.00270203354f, 0.00252169125f,
+    0.00233741282f, 0.00214969591f, 0.00195904044f, 0.00176594735f,
+    0.00157091732f, 0.00137444957f, 0.00117704067f, 0.000979183294f,
+    0.000781365133f, 0.000584067713f, 0.000387765309f, 0.000192923874f,
+    -7.66158796e-18f, -0.000190560082f, -0.000378321462f, -0.000562861475f,
+    -0.000743770578f, -0.000920653184f, -0.00109312846f, -0.00126083106f,
+    -0.00142341182f, -0.00158053843f, -0.001731896f, -0.00187718762f,
+    -0.00201613485f, -0.00214847817f, -0.00227397737f, -0.0023924119f,
+    -0.00250358111f, -0.00260730455f, -0.00270342211f, -0.00279179413f,
+    -0.00287230154f, -0.00294484583f, -0.00300934903f, -0.00306575369f,
+    -0.00311402266f, -0.00315413902f, -0.00318610577f, -0.00320994566f,
+    -0.00322570078f, -0.00323343228f, -0.00323321994f, -0.00322516178f,
+    -0.00320937351f, -0.00318598809f, -0.00315515518f, -0.0031170405f,
+    -0.0030718253f, -0.00301970567f, -0.00296089191f, -0.0028956078f,
+    -0.00282408992f, -0.00274658688f, -0.00266335861f, -0.00257467556f,
+    -0.00248081789f, -0.00238207474f, -0.00227874335f, -0.00217112827f,
+    -0.00205954053f, -0.00194429684f, -0.0018257187f, -0.00170413163f,
+    -0.00157986428f, -0.00145324765f, -0.00132461426f, -0.00119429732f,
+    -0.00106262994f, -0.000929944337f, -0.000796571043f, -0.000662838161f,
+    -0.000529070606f, -0.000395589371f, -0.000262710824f, -0.000130746013f,
+    -4.54186729e-18f, 0.000129228786f, 0.000256649166f, 0.000381977806f,
+    0.000504939788f, 0.000625269143f, 0.000742709371f, 0.000857013914f,
+    0.000967946616f, 0.00107528214f, 0.00117880635f, 0.00127831669f,
+    0.0013736225f, 0.00146454529f, 0.00155091905f, 0.0016325904f,
+    0.00170941889f, 0.00178127707f, 0.00184805068f, 0.00190963871f,
+    0.0019659535f, 0.00201692075f, 0.00206247954f, 0.00210258228f,
+    0.00213719469f, 0.00216629566f, 0.00218987719f, 0.0022079442f,
+    0.00222051439f, 0.00222761802f, 0.00222929767f, 0.00222560804f,
+    0.00221661563f, 0.00220239847f, 0.00218304576f, 0.00215865758f,
+    0.00212934452f, 0.00209522725f, 0.0020564362f, 0.00201311109f,
+    0.00196540051f, 0.00191346151f, 0.0018574591f, 0.00179756582f,
+    0.00173396125f, 0.0016668315f, 0.00159636876f, 0.00152277075f,
+    0.00144624025f, 0.00136698459f, 0.0012852151f, 0.00120114662f,
+    0.00111499698f, 0.00102698646f, 0.000937337336f, 0.000846273282f,
+    0.000754018922f, 0.000660799301f, 0.000566839388f, 0.000472363585f,
+    0.000377595238f, 0.000282756164f, 0.000188066177f, 9.37426377e-05f,
+    1.02530792e-17f, -9.29506205e-05f, -0.000184901871f, -0.000275650569f,
+    -0.0003649981f, -0.000452750801f, -0.000538720319f, -0.000622723973f,
+    -0.000704585078f, -0.000784133273f, -0.000861204815f, -0.00093564287f,
+    -0.00100729777f, -0.00107602728f, -0.00114169682f, -0.00120417964f,
+    -0.00126335711f, -0.00131911878f, -0.00137136264f, -0.00141999517f,
+    -0.00146493153f, -0.00150609563f, -0.0015434202f, -0.00157684689f,
+    -0.00160632628f, -0.00163181794f, -0.00165329039f, -0.00167072117f,
+    -0.00168409673f, -0.00169341243f, -0.0016986725f, -0.0016998899f,
+    -0.00169708629f, -0.00169029188f, -0.00167954532f, -0.00166489356f,
+    -0.0016463917f, -0.00162410278f, -0.00159809767f, -0.00156845481f,
+    -0.00153526003f, -0.0014986063f, -0.00145859354f, -0.00141532833f,
+    -0.00136892368f, -0.00131949877f, -0.00126717863f, -0.00121209391f,
+    -0.00115438054f, -0.00109417945f, -0.00103163627f, -0.000966900985f,
+    -0.000900127628f, -0.000831473956f, -0.000761101103f, -0.000689173254f,
+    -0.000615857294f, -0.000541322465f, -0.000465740018f, -0.000389282864f,
+    -0.000312125219f, -0.000234442253f, -0.000156409734f, -7.820368e-05f,
+    0.0f, 0.0f,
+};
+
+// ResamplerProfile_Medium
+const sample_t sinc_table_32_128[4098] = {
+    1.0f, 0.999899604f, 0.999598318f, 0.999096115f,
+    0.998393178f, 0.997489762f, 0.996386193f, 0.995082872f,
+    0.99358027f, 0.991878933f, 0.989979476f, 0.987882588f,
+    0.985589027f, 0.983099624f, 0.98041528f, 0.977536965f,
+    0.974465721f, 0.971202658f, 0.967748955f, 0.964105859f,
+    0.960274687f, 0.95625682f, 0.952053709f, 0.947666869f,
+    0.943097881f, 0.93834839f, 0.933420106f, 0.928314803f,
+    0.923034315f, 0.917580539f, 0.911955435f, 0.90616102f,
+    0.900199371f, 0.894072625f, 0.887782974f, 0.881332668f,
+    0.874724013f, 0.867959367f, 0.861041145f, 0.85397181f,
+    0.846753881f, 0.839389925f, 0.831882558f, 0.824234444f,
+    0.816448296f, 0.808526871f, 0.800472971f, 0.792289441f,
+    0.783979168f, 0.775545083f, 0.766990153f, 0.758317385f,
+    0.749529823f, 0.740630547f, 0.731622673f, 0.722509348f,
+    0.713293751f, 0.703979095f, 0.694568618f, 0.685065588f,
+    0.6754733f, 0.665795072f, 0.656034249f, 0.646194195f,
+    0.636278296f, 0.626289959f, 0.616232608f, 0.606109683f,
+    0.595924639f, 0.585680946f, 0.575382087f, 0.565031552f,
+    0.554632846f, 0.544189476f, 0.53370496f, 0.52318282f,
+    0.51262658f, 0.502039767f, 0.491425909f, 0.480788534f,
+    0.470131165f, 0.459457324f, 0.448770527f, 0.438074283f,
+    0.427372094f, 0.416667452f, 0.405963837f, 0.395264718f,
+    0.384573552f, 0.373893777f, 0.363228817f, 0.352582079f,
+    0.341956949f, 0.331356793f, 0.320784956f, 0.310244758f,
+    0.299739496f, 0.289272441f, 0.278846837f, 0.268465898f,
+    0.258132811f, 0.247850729f, 0.237622776f, 0.22745204f,
+    0.217341576f, 0.207294403f, 0.197313504f, 0.187401822f,
+    0.177562261f, 0.167797688f, 0.158110925f, 0.148504753f,
+    0.13898191f, 0.129545089f, 0.120196939f, 0.110940059f,
+    0.101777005f, 0.0927102827f, 0.0837423482f, 0.0748756084f,
+    0.0661124192f, 0.0574550847f, 0.0489058564f, 0.0404669326f,
+    0.0321404576f, 0.023928521f, 0.0158331566f, 0.00785634261f,
+    3.88967985e-17f, -0.00773400745f, -0.015343874f, -0.0228278523f,
+    -0.0301842543f, -0.0374114515f, -0.0445078753f, -0.0514720178f,
+    -0.0583024319f, -0.0649977318f, -0.0715565937f, -0.0779777554f,
+    -0.0842600174f, -0.0904022426f, -0.0964033568f, -0.102262349f,
+    -0.107978271f, -0.113550239f, -0.118977432f, -0.124259092f,
+    -0.129394527f, -0.134383106f, -0.139224265f, -0.1439175f,
+    -0.148462373f, -0.15285851f, -0.157105601f, -0.161203396f,
+    -0.165151712f, -0.168950428f, -0.172599485f, -0.176098887f,
+    -0.179448702f, -0.182649058f, -0.185700145f, -0.188602215f,
+    -0.191355582f, -0.193960619f, -0.19641776f, -0.198727497f,
+    -0.200890384f, -0.202907033f, -0.204778112f, -0.206504349f,
+    -0.208086528f, -0.209525491f, -0.210822133f, -0.211977406f,
+    -0.212992317f, -0.213867926f, -0.214605344f, -0.215205739f,
+    -0.215670326f, -0.216000373f, -0.216197197f, -0.216262166f,
+    -0.216196693f, -0.216002242f, -0.215680321f, -0.215232484f,
+    -0.214660329f, -0.213965501f, -0.213149683f, -0.212214604f,
+    -0.211162031f, -0.209993772f, -0.208711674f, -0.20731762f,
+    -0.205813532f, -0.204201366f, -0.202483113f, -0.200660798f,
+    -0.198736477f, -0.196712239f, -0.194590201f, -0.192372512f,
+    -0.190061345f, -0.187658903f, -0.185167413f, -0.182589126f,
+    -0.179926317f, -0.177181284f, -0.174356343f, -0.171453832f,
+    -0.168476108f, -0.165425542f, -0.162304524f, -0.159115458f,
+    -0.155860762f, -0.152542866f, -0.149164211f, -0.145727249f,
+    -0.142234439f, -0.138688249f, -0.135091154f, -0.131445633f,
+    -0.127754169f, -0.124019249f, -0.120243361f, -0.116428992f,
+    -0.112578631f, -0.108694762f, -0.104779868f, -0.100836428f,
+    -0.096866913f, -0.0928737904f, -0.0888595182f, -0.0848265457f,
+    -0.0807773123f, -0.0767142465f, -0.0726397642f, -0.0685562682f,
+    -0.0644661468f, -0.0603717729f, -0.0562755026f, -0.0521796746f,
+    -0.0480866091f, -0.0439986064f, -0.0399179461f, -0.0358468864f,
+    -0.0317876626f, -0.0277424866f, -0.0237135457f, -0.0197030016f,
+    -0.0157129898f, -0.0117456183f, -0.00780296726f, -0.00388708746f,
+    -3.86401784e-17f, 0.00385630474f, 0.00767986788f, 0.0114687628f,
+    0.0152210961f, 0.0189350079f, 0.022608673f, 0.0262403014f,
+    0.0298281392f, 0.0333704687f, 0.0368656098f, 0.04031192f,
+    0.0437077954f, 0.047051671f, 0.0503420215f, 0.0535773616f,
+    0.0567562467f, 0.0598772733f, 0.0629390794f, 0.0659403452f,
+    0.0688797932f, 0.0717561887f, 0.0745683404f, 0.0773151003f,
+    0.0799953645f, 0.0826080731f, 0.0851522108f, 0.087626807f,
+    0.090030936f, 0.0923637173f, 0.0946243156f, 0.0968119413f,
+    0.0989258503f, 0.100965344f, 0.102929771f, 0.104818523f,
+    0.10663104f, 0.108366808f, 0.110025357f, 0.111606265f,
+    0.113109155f, 0.114533695f, 0.1158796f, 0.117146629f,
+    0.118334589f, 0.119443329f, 0.120472746f, 0.121422779f,
+    0.122293415f, 0.123084681f, 0.123796653f, 0.124429446f,
+    0.124983223f, 0.125458185f, 0.125854581f, 0.126172698f,
+    0.126412868f, 0.126575463f, 0.126660897f, 0.126669622f,
+    0.126602134f, 0.126458967f, 0.126240692f, 0.125947922f,
+    0.125581307f, 0.125141532f, 0.124629322f, 0.124045437f,
+    0.123390674f, 0.122665861f, 0.121871865f, 0.121009585f,
+    0.120079952f, 0.11908393f, 0.118022516f, 0.116896735f,
+    0.115707645f, 0.114456331f, 0.113143909f, 0.111771521f,
+    0.110340338f, 0.108851554f, 0.107306393f, 0.105706099f,
+    0.104051944f, 0.102345221f, 0.100587244f, 0.0987793519f,
+    0.0969229004f, 0.095019267f, 0.0930698474f, 0.0910760553f,
+    0.0890393214f, 0.0869610925f, 0.0848428308f, 0.0826860126f,
+    0.080492128f, 0.0782626796f, 0.0759991815f, 0.0737031588f,
+    0.0713761465f, 0.0690196883f, 0.0666353363f, 0.0642246497f,
+    0.0617891938f, 0.0593305394f, 0.0568502618f, 0.0543499398f,
+    0.0518311548f, 0.0492954903f, 0.0467445303f, 0.0441798589f,
+    0.0416030594f, 0.0390157135f, 0.0364193998f, 0.0338156939f,
+    0.0312061666f, 0.0285923839f, 0.0259759054f, 0.023358284f,
+    0.0207410647f, 0.0181257842f, 0.0155139694f, 0.0129071374f,
+    0.0103067942f, 0.00771443394f, 0.00513153828f, 0.00255957554f,
+    3.82143216e-17f, -0.00254574892f, -0.00507624734f, -0.00759008764f,
+    -0.0100858792f, -0.0125622491f, -0.0150178428f, -0.0174513247f,
+    -0.019861379f, -0.0222467101f, -0.0246060436f, -0.0269381265f,
+    -0.029241728f, -0.0315156401f, -0.0337586782f, -0.0359696813f,
+    -0.0381475133f, -0.0402910626f, -0.0423992433f, -0.0444709955f,
+    -0.0465052854f, -0.0485011065f, -0.0504574793f, -0.0523734521f,
+    -0.0542481015f, -0.0560805324f, -0.0578698788f, -0.0596153038f,
+    -0.0613160002f, -0.0629711906f, -0.0645801278f, -0.0661420953f,
+    -0.0676564071f, -0.0691224082f, -0.070539475f, -0.0719070151f,
+    -0.0732244678f, -0.0744913042f, -0.0757070274f, -0.0768711724f,
+    -0.0779833064f, -0.079043029f, -0.0800499721f, -0.0810037998f,
+    -0.0819042091f, -0.082750929f, -0.0835437212f, -0.08428238f,
+    -0.0849667318f, -0.0855966356f, -0.0861719827f, -0.0866926965f,
+    -0.0871587327f, -0.0875700788f, -0.0879267544f, -0.0882288106f,
+    -0.0884763301f, -0.0886694269f, -0.0888082463f, -0.0888929642f,
+    -0.0889237875f, -0.0889009533f, -0.0888247289f, -0.0886954115f,
+    -0.0885133278f, -0.0882788336f, -0.0879923138f, -0.0876541819f,
+    -0.0872648792f, -0.0868248752f, -0.0863346667f, -0.0857947773f,
+    -0.0852057574f, -0.0845681835f, -0.0838826578f, -0.0831498077f,
+    -0.0823702855f, -0.0815447675f, -0.0806739542f, -0.0797585691f,
+    -0.0787993585f, -0.0777970909f, -0.0767525568f, -0.0756665676f,
+    -0.0745399552f, -0.0733735718f, -0.0721682889f, -0.0709249968f,
+    -0.0696446043f, -0.0683280375f, -0.06697624f, -0.0655901715f,
+    -0.0641708077f, -0.0627191394f, -0.061236172f, -0.0597229248f,
+    -0.0581804304f, -0.0566097339f, -0.0550118924f, -0.0533879744f,
+    -0.051739059f, -0.0500662351f, -0.0483706011f, -0.0466532639f,
+    -0.0449153383f, -0.0431579465f, -0.0413822172f, -0.0395892851f,
+    -0.0377802899f, -0.0359563762f, -0.034118692f, -0.032268389f,
+    -0.030406621f, -0.0285345437f, -0.0266533143f, -0.0247640899f,
+    -0.0228680278f, -0.0209662844f, -0.0190600145f, -0.0171503706f,
+    -0.0152385025f, -0.0133255564f, -0.0114126745f, -0.00950099392f,
+    -0.00759164657f, -0.00568575819f, -0.00378444782f, -0.00188882716f,
+    -3.76233254e-17f, 0.00188093846f, 0.00375290216f, 0.00561481479f,
+    0.00746561037f, 0.00930423383f, 0.0111296416f, 0.0129408021f,
+    0.0147366965f, 0.0165163188f, 0.018278677f, 0.020022793f,
+    0.0217477037f, 0.023452461f, 0.0251361324f, 0.0267978019f,
+    0.0284365699f, 0.030051554f, 0.0316418891f, 0.0332067286f,
+    0.0347452438f, 0.036256625f, 0.0377400818f, 0.0391948433f,
+    0.0406201586f, 0.0420152972f, 0.043379549f, 0.0447122253f,
+    0.0460126585f, 0.0472802027f, 0.0485142338f, 0.0497141501f,
+    0.0508793723f, 0.0520093439f, 0.0531035311f, 0.0541614236f,
+    0.0551825344f, 0.0561663999f, 0.0571125806f, 0.0580206607f,
+    0.0588902485f, 0.0597209767f, 0.0605125021f, 0.0612645061f,
+    0.0619766948f, 0.0626487985f, 0.0632805726f, 0.0638717971f,
+    0.0644222767f, 0.0649318411f, 0.0654003445f, 0.0658276662f,
+    0.0662137101f, 0.0665584049f, 0.066861704f, 0.0671235853f,
+    0.0673440514f, 0.0675231293f, 0.0676608704f, 0.0677573501f,
+    0.0678126681f, 0.0678269481f, 0.0678003375f, 0.067733007f,
+    0.0676251513f, 0.067476988f, 0.0672887576f, 0.0670607235f,
+    0.0667931718f, 0.0664864107f, 0.0661407705f, 0.0657566033f,
+    0.0653342825f, 0.0648742029f, 0.06437678f, 0.06384245f,
+    0.0632716693f, 0.0626649139f, 0.0620226797f, 0.0613454816f,
+    0.0606338533f, 0.0598883468f, 0.0591095325f, 0.0582979979f,
+    0.0574543482f, 0.056579205f, 0.0556732066f, 0.0547370071f,
+    0.053771276f, 0.0527766981f, 0.0517539725f, 0.0507038128f,
+    0.0496269458f, 0.048524112f, 0.0473960641f, 0.0462435676f,
+    0.0450673991f, 0.0438683469f, 0.0426472099f, 0.0414047972f,
+    0.0401419274f, 0.0388594288f, 0.0375581379f, 0.0362388995f,
+    0.0349025662f, 0.0335499975f, 0.0321820595f, 0.0307996244f,
+    0.0294035699f, 0.0279947787f, 0.0265741378f, 0.0251425382f,
+    0.0237008743f, 0.0222500432f, 0.0207909443f, 0.019324479f,
+    0.0178515495f, 0.016373059f, 0.0148899106f, 0.0134030073f,
+    0.0119132509f, 0.0104215419f, 0.0089287788f, 0.00743585759f,
+    0.00594367125f, 0.00445310924f, 0.00296505696f, 0.00148039528f,
+    3.6872876e-17f, -0.00147525861f, -0.00294451635f, -0.00440691554f,
+    -0.00586160551f, -0.0073077431f, -0.00874449312f, -0.0101710288f,
+    -0.0115865322f, -0.0129901949f, -0.0143812181f, -0.0157588133f,
+    -0.0171222026f, -0.0184706192f, -0.0198033079f, -0.0211195252f,
+    -0.02241854f, -0.0236996341f, -0.0249621019f, -0.0262052518f,
+    -0.0274284055f, -0.0286308992f, -0.0298120834f, -0.0309713237f,
+    -0.0321080006f, -0.0332215101f, -0.0343112643f, -0.0353766909f,
+    -0.0364172344f, -0.0374323558f, -0.0384215328f, -0.0393842605f,
+    -0.0403200514f, -0.0412284355f, -0.0421089607f, -0.0429611931f,
+    -0.0437847167f, -0.0445791343f, -0.0453440672f, -0.0460791555f,
+    -0.0467840581f, -0.0474584531f, -0.0481020379f, -0.0487145289f,
+    -0.0492956621f, -0.0498451932f, -0.0503628973f, -0.050848569f,
+    -0.051302023f, -0.0517230935f, -0.0521116346f, -0.0524675202f,
+    -0.0527906441f, -0.0530809198f, -0.0533382808f, -0.0535626803f,
+    -0.0537540912f, -0.0539125063f, -0.0540379379f, -0.0541304179f,
+    -0.0541899978f, -0.0542167485f, -0.0542107601f, -0.0541721421f,
+    -0.0541010228f, -0.0539975496f, -0.0538618888f, -0.053694225f,
+    -0.0534947617f, -0.0532637202f, -0.0530013403f, -0.0527078795f,
+    -0.0523836131f, -0.0520288336f, -0.051643851f, -0.0512289923f,
+    -0.0507846012f, -0.0503110378f, -0.0498086786f, -0.0492779159f,
+    -0.0487191578f, -0.0481328278f, -0.0475193644f, -0.0468792209f,
+    -0.0462128652f, -0.0455207791f, -0.0448034584f, -0.0440614124f,
+    -0.0432951634f, -0.0425052466f, -0.0416922095f, -0.0408566119f,
+    -0.0399990251f, -0.0391200318f, -0.0382202255f, -0.0373002105f,
+    -0.0363606012f, -0.0354020215f, -0.0344251051f, -0.0334304943f,
+    -0.0324188403f, -0.0313908021f, -0.0303470466f, -0.0292882482f,
+    -0.0282150877f, -0.0271282529f, -0.0260284373f, -0.0249163401f,
+    -0.0237926657f, -0.0226581232f, -0.021513426f, -0.0203592915f,
+    -0.0191964404f, -0.0180255964f, -0.0168474857f, -0.0156628369f,
+    -0.01447238f, -0.0132768463f, -0.0120769679f, -0.0108734773f,
+    -0.00966710704f, -0.00845858894f, -0.007248654f, -0.00603803186f,
+    -0.00482745033f, -0.003617635f, -0.00240930883f, -0.0012031917f,
+    -3.59701933e-17f, 0.00119955378f, 0.00239476146f, 0.00358491958f,
+    0.00476932982f, 0.00594729937f, 0.00711814135f, 0.00828117517f,
+    0.00943572697f, 0.0105811299f, 0.0117167247f, 0.0128418598f,
+    0.0139558918f, 0.015058186f, 0.0161481163f, 0.0172250663f,
+    0.0182884288f, 0.0193376065f, 0.0203720127f, 0.0213910708f,
+    0.0223942155f, 0.0233808923f, 0.0243505584f, 0.0253026827f,
+    0.0262367461f, 0.0271522419f, 0.0280486759f, 0.0289255668f,
+    0.0297824463f, 0.0306188595f, 0.0314343651f, 0.0322285353f,
+    0.0330009568f, 0.0337512299f, 0.0344789699f, 0.0351838061f,
+    0.0358653831f, 0.03652336f, 0.0371574112f, 0.0377672264f,
+    0.0383525105f, 0.038912984f, 0.0394483831f, 0.0399584596f,
+    0.0404429813f, 0.0409017317f, 0.0413345107f, 0.041741134f,
+    0.0421214335f, 0.0424752574f, 0.0428024702f, 0.0431029524f,
+    0.0433766012f, 0.0436233299f, 0.0438430682f, 0.0440357622f,
+    0.044201374f, 0.0443398825f, 0.0444512825f, 0.044535585f,
+    0.0445928174f, 0.044623023f, 0.0446262613f, 0.0446026076f,
+    0.0445521531f, 0.0444750048f, 0.0443712852f, 0.0442411327f,
+    0.0440847006f, 0.043902158f, 0.0436936886f, 0.0434594916f,
+    0.0431997806f, 0.0429147841f, 0.042604745f, 0.0422699204f,
+    0.0419105815f, 0.0415270137f, 0.0411195156f, 0.0406883996f,
+    0.0402339913f, 0.0397566291f, 0.0392566645f, 0.0387344614f,
+    0.0381903957f, 0.0376248558f, 0.0370382415f, 0.0364309642f,
+    0.0358034465f, 0.035156122f, 0.0344894348f, 0.0338038394f,
+    0.0330998003f, 0.0323777919f, 0.0316382978f, 0.0308818108f,
+    0.0301088327f, 0.0293198733f, 0.028515451f, 0.0276960919f,
+    0.0268623293f, 0.026014704f, 0.0251537633f, 0.0242800613f,
+    0.0233941579f, 0.0224966187f, 0.0215880151f, 0.0206689231f,
+    0.0197399237f, 0.018801602f, 0.0178545472f, 0.0168993521f,
+    0.0159366126f, 0.0149669278f, 0.0139908989f, 0.0130091295f,
+    0.012022225f, 0.011030792f, 0.0100354384f, 0.00903677268f,
+    0.00803540352f, 0.00703193972f, 0.00602698959f, 0.00502116069f,
+    0.00401505945f, 0.00300929082f, 0.00200445786f, 0.00100116148f,
+    3.49239624e-17f, -0.000998431149f, -0.00199353979f, -0.00298473735f,
+    -0.00397143919f, -0.00495306495f, -0.00592903886f, -0.00689879013f,
+    -0.00786175321f, -0.00881736817f, -0.00976508096f, -0.0107043438f,
+    -0.0116346154f, -0.0125553613f, -0.0134660543f, -0.0143661745f,
+    -0.0152552098f, -0.0161326561f, -0.0169980177f, -0.0178508072f,
+    -0.0186905463f, -0.0195167657f, -0.0203290054f, -0.0211268151f,
+    -0.0219097544f, -0.0226773928f, -0.0234293102f, -0.0241650971f,
+    -0.0248843546f, -0.025586695f, -0.0262717415f, -0.0269391289f,
+    -0.0275885035f, -0.0282195231f, -0.0288318577f, -0.0294251892f,
+    -0.0299992118f, -0.0305536321f, -0.0310881692f, -0.0316025547f,
+    -0.0320965332f, -0.0325698622f, -0.033022312f, -0.0334536663f,
+    -0.0338637217f, -0.0342522884f, -0.0346191897f, -0.0349642626f,
+    -0.0352873575f, -0.0355883382f, -0.0358670824f, -0.0361234813f,
+    -0.0363574398f, -0.0365688764f, -0.0367577234f, -0.0369239269f,
+    -0.0370674465f, -0.0371882557f, -0.0372863415f, -0.0373617048f,
+    -0.0374143598f, -0.0374443345f, -0.0374516703f, -0.0374364223f,
+    -0.0373986585f, -0.0373384608f, -0.0372559239f, -0.0371511558f,
+    -0.0370242776f, -0.0368754233f, -0.0367047395f, -0.0365123859f,
+    -0.0362985346f, -0.0360633699f, -0.0358070888f, -0.0355299001f,
+    -0.0352320249f, -0.034913696f, -0.0345751577f, -0.0342166659f,
+    -0.033838488f, -0.0334409021f, -0.0330241977f, -0.0325886745f,
+    -0.0321346432f, -0.0316624244f, -0.031172349f, -0.0306647576f,
+    -0.0301400007f, -0.0295984379f, -0.0290404381f, -0.028466379f,
+    -0.027876647f, -0.0272716371f, -0.0266517521f, -0.026017403f,
+    -0.0253690082f, -0.0247069935f, -0.0240317919f, -0.0233438431f,
+    -0.0226435933f, -0.0219314949f, -0.0212080064f, -0.0204735919f,
+    -0.0197287207f, -0.0189738675f, -0.0182095115f, -0.0174361364f,
+    -0.0166542303f, -0.0158642849f, -0.0150667956f, -0.0142622611f,
+    -0.0134511831f, -0.0126340656f, -0.0118114155f, -0.0109837412f,
+    -0.0101515533f, -0.00931536335f, -0.00847568436f, -0.00763302998f,
+    -0.00678791436f, -0.00594085183f, -0.00509235661f, -0.00424294245f,
+    -0.00339312237f, -0.00254340834f, -0.00169431096f, -0.00084633918f,
+    -3.37442492e-17f, 0.000844201846f, 0.00168576417f, 0.00252418765f,
+    0.00335897607f, 0.00418963668f, 0.00501568041f, 0.00583662222f,
+    0.00665198133f, 0.00746128151f, 0.00826405138f, 0.00905982464f,
+    0.00984814037f, 0.0106285433f, 0.011400584f, 0.0121638191f,
+    0.0129178119f, 0.0136621322f, 0.0143963564f, 0.0151200684f,
+    0.0158328594f, 0.0165343279f, 0.0172240804f, 0.0179017315f,
+    0.0185669039f, 0.0192192286f, 0.0198583455f, 0.0204839031f,
+    0.0210955591f, 0.0216929802f, 0.0222758425f, 0.0228438319f,
+    0.0233966437f, 0.0239339831f, 0.0244555655f, 0.0249611164f,
+    0.0254503714f, 0.0259230769f, 0.0263789894f, 0.0268178766f,
+    0.0272395165f, 0.0276436984f, 0.0280302223f, 0.0283988996f,
+    0.0287495525f, 0.0290820148f, 0.0293961314f, 0.0296917587f,
+    0.0299687646f, 0.0302270284f, 0.0304664411f, 0.0306869049f,
+    0.0308883342f, 0.0310706545f, 0.0312338033f, 0.0313777297f,
+    0.0315023942f, 0.0316077694f, 0.0316938392f, 0.0317605993f,
+    0.0318080569f, 0.0318362308f, 0.0318451515f, 0.0318348607f,
+    0.0318054118f, 0.0317568694f, 0.0316893094f, 0.031602819f,
+    0.0314974966f, 0.0313734516f, 0.0312308044f, 0.0310696862f,
+    0.0308902391f, 0.0306926157f, 0.0304769794f, 0.0302435037f,
+    0.0299923726f, 0.0297237802f, 0.0294379307f, 0.0291350379f,
+    0.0288153257f, 0.0284790272f, 0.0281263851f, 0.0277576513f,
+    0.0273730868f, 0.0269729612f, 0.0265575532f, 0.0261271497f,
+    0.0256820461f, 0.0252225457f, 0.0247489599f, 0.0242616078f,
+    0.0237608159f, 0.023246918f, 0.022720255f, 0.0221811747f,
+    0.0216300313f, 0.0210671858f, 0.0204930048f, 0.0199078614f,
+    0.019312134f, 0.0187062066f, 0.0180904682f, 0.0174653132f,
+    0.0168311402f, 0.0161883526f, 0.0155373579f, 0.0148785675f,
+    0.0142123966f, 0.0135392637f, 0.0128595906f, 0.012173802f,
+    0.0114823251f, 0.0107855898f, 0.0100840278f, 0.0093780729f,
+    0.0086681604f, 0.00795472693f, 0.00723821024f, 0.00651904884f,
+    0.0057976818f, 0.00507454847f, 0.00435008819f, 0.00362474009f,
+    0.00289894274f, 0.00217313395f, 0.00144775051f, 0.000723227885f,
+    3.24424039e-17f, -0.000721501034f, -0.00144084517f, -0.0021576047f,
+    -0.00287135445f, -0.0035816721f, -0.00428813839f, -0.00499033735f,
+    -0.0056878566f, -0.00638028751f, -0.0070672255f, -0.00774827027f,
+    -0.00842302597f, -0.0090911015f, -0.0097521107f, -0.0104056725f,
+    -0.0110514114f, -0.0116889573f, -0.0123179459f, -0.0129380191f,
+    -0.0135488247f, -0.0141500172f, -0.0147412576f, -0.0153222135f,
+    -0.0158925598f, -0.0164519783f, -0.0170001582f, -0.017536796f,
+    -0.0180615963f, -0.0185742711f, -0.0190745405f, -0.0195621327f,
+    -0.0200367842f, -0.0204982399f, -0.0209462532f, -0.0213805863f,
+    -0.0218010098f, -0.0222073036f, -0.0225992565f, -0.0229766664f,
+    -0.0233393402f, -0.0236870945f, -0.0240197551f, -0.0243371572f,
+    -0.0246391458f, -0.0249255752f, -0.0251963096f, -0.0254512231f,
+    -0.0256901992f, -0.0259131317f, -0.026119924f, -0.0263104894f,
+    -0.0264847514f, -0.0266426433f, -0.0267841085f, -0.0269091003f,
+    -0.0270175821f, -0.0271095272f, -0.027184919f, -0.0272437509f,
+    -0.0272860263f, -0.0273117584f, -0.0273209704f, -0.0273136954f,
+    -0.0272899764f, -0.027249866f, -0.0271934266f, -0.0271207304f,
+    -0.0270318591f, -0.0269269039f, -0.0268059656f, -0.0266691541f,
+    -0.026516589f, -0.0263483986f, -0.0261647208f, -0.0259657022f,
+    -0.0257514982f, -0.0255222732f, -0.0252782001f, -0.0250194605f,
+    -0.0247462442f, -0.0244587493f, -0.0241571821f, -0.0238417569f,
+    -0.0235126957f, -0.0231702284f, -0.0228145921f, -0.0224460317f,
+    -0.0220647989f, -0.0216711527f, -0.0212653589f, -0.0208476899f,
+    -0.0204184247f, -0.0199778485f, -0.019526253f, -0.0190639354f,
+    -0.0185911989f, -0.0181083523f, -0.0176157096f, -0.0171135901f,
+    -0.0166023181f, -0.0160822224f, -0.0155536367f, -0.0150168988f,
+    -0.0144723506f, -0.0139203381f, -0.0133612109f, -0.012795322f,
+    -0.0122230277f, -0.0116446875f, -0.0110606633f, -0.01047132f,
+    -0.0098770247f, -0.00927814659f, -0.00867505682f, -0.00806812821f,
+    -0.00745773504f, -0.00684425279f, -0.00622805797f, -0.00560952781f,
+    -0.00498904012f, -0.004366973f, -0.00374370464f, -0.00311961308f,
+    -0.00249507599f, -0.00187047043f, -0.00124617266f, -0.000622557876f,
+    -3.10309517e-17f, 0.000621128529f, 0.00124045699f, 0.00185761659f,
+    0.0024722407f, 0.00308396502f, 0.00369242788f, 0.00429727035f,
+    0.00489813653f, 0.00549467373f, 0.00608653263f, 0.00667336757f,
+    0.00725483668f, 0.0078306021f, 0.00840033018f, 0.00896369166f,
+    0.00952036186f, 0.0100700209f, 0.0106123537f, 0.0111470506f,
+    0.0116738069f, 0.0121923237f, 0.0127023074f, 0.0132034705f,
+    0.0136955313f, 0.0141782143f, 0.0146512502f, 0.0151143761f,
+    0.0155673358f, 0.0160098797f, 0.0164417649f, 0.0168627558f,
+    0.0172726235f, 0.0176711467f, 0.0180581112f, 0.0184333103f,
+    0.0187965447f, 0.019147623f, 0.0194863614f, 0.0198125841f,
+    0.0201261229f, 0.0204268179f, 0.0207145173f, 0.0209890774f,
+    0.0212503625f, 0.0214982456f, 0.0217326078f, 0.0219533387f,
+    0.0221603363f, 0.0223535071f, 0.0225327661f, 0.022698037f,
+    0.022849252f, 0.0229863518f, 0.023109286f, 0.0232180126f,
+    0.0233124983f, 0.0233927186f, 0.0234586574f, 0.0235103073f,
+    0.0235476697f, 0.0235707544f, 0.0235795797f, 0.0235741728f,
+    0.023554569f, 0.0235208124f, 0.0234729551f, 0.0234110581f,
+    0.0233351902f, 0.0232454288f, 0.0231418594f, 0.0230245755f,
+    0.0228936788f, 0.022749279f, 0.0225914933f, 0.0224204472f,
+    0.0222362737f, 0.0220391132f, 0.0218291138f, 0.0216064311f,
+    0.0213712278f, 0.0211236737f, 0.0208639458f, 0.0205922282f,
+    0.0203087113f, 0.0200135927f, 0.0197070763f, 0.0193893723f,
+    0.0190606973f, 0.018721274f, 0.0183713311f, 0.0180111031f,
+    0.0176408301f, 0.0172607578f, 0.0168711371f, 0.0164722243f,
+    0.0160642805f, 0.0156475717f, 0.0152223688f, 0.014788947f,
+    0.0143475857f, 0.0138985688f, 0.0134421838f, 0.0129787224f,
+    0.0125084795f, 0.0120317537f, 0.0115488467f, 0.0110600632f,
+    0.010565711f, 0.0100661003f, 0.00956154394f, 0.00905235686f,
+    0.00853885623f, 0.00802136108f, 0.00750019208f, 0.00697567146f,
+    0.00644812269f, 0.00591787037f, 0.00538524f, 0.00485055776f,
+    0.00431415036f, 0.00377634481f, 0.00323746822f, 0.00269784763f,
+    0.00215780979f, 0.00161768097f, 0.00107778676f, 0.000538451878f,
+    1.07385213e-16f, -0.000537246472f, -0.00107296657f, -0.00160684098f,
+    -0.0021385522f, -0.00266778473f, -0.00319422528f, -0.00371756295f,
+    -0.00423748938f, -0.00475369896f, -0.00526588901f, -0.00577375994f,
+    -0.00627701543f, -0.00677536258f, -0.00726851214f, -0.0077561786f,
+    -0.00823808041f, -0.00871394009f, -0.00918348446f, -0.00964644471f,
+    -0.0101025566f, -0.0105515607f, -0.0109932022f, -0.0114272316f,
+    -0.0118534042f, -0.012271481f, -0.012681228f, -0.0130824169f,
+    -0.0134748251f, -0.0138582358f, -0.0142324381f, -0.0145972268f,
+    -0.0149524034f, -0.0152977751f, -0.0156331558f, -0.0159583656f,
+    -0.0162732313f, -0.0165775861f, -0.0168712701f, -0.0171541301f,
+    -0.0174260198f, -0.0176867997f, -0.0179363375f, -0.0181745078f,
+    -0.0184011925f, -0.0186162804f, -0.0188196678f, -0.0190112582f,
+    -0.0191909623f, -0.0193586984f, -0.0195143919f, -0.0196579759f,
+    -0.0197893907f, -0.0199085841f, -0.0200155116f, -0.020110136f,
+    -0.0201924276f, -0.0202623641f, -0.020319931f, -0.0203651209f,
+    -0.0203979342f, -0.0204183786f, -0.0204264692f, -0.0204222286f,
+    -0.0204056866f, -0.0203768807f, -0.0203358553f, -0.0202826623f,
+    -0.0202173607f, -0.0201400169f, -0.020050704f, -0.0199495024f,
+    -0.0198364996f, -0.0197117898f, -0.0195754741f, -0.0194276604f,
+    -0.0192684632f, -0.0190980037f, -0.0189164096f, -0.0187238151f,
+    -0.0185203605f, -0.0183061925f, -0.018081464f, -0.0178463337f,
+    -0.0176009664f, -0.0173455326f, -0.0170802086f, -0.0168051761f,
+    -0.0165206224f, -0.0162267401f, -0.0159237269f, -0.0156117856f,
+    -0.015291124f, -0.0149619547f, -0.0146244948f, -0.014278966f,
+    -0.0139255944f, -0.0135646104f, -0.0131962484f, -0.0128207466f,
+    -0.0124383471f, -0.0120492956f, -0.0116538414f, -0.0112522369f,
+    -0.0108447377f, -0.0104316025f, -0.0100130927f, -0.00958947231f,
+    -0.00916100806f, -0.00872796882f, -0.00829062569f, -0.00784925175f,
+    -0.00740412191f, -0.00695551274f, -0.00650370229f, -0.00604896993f,
+    -0.00559159617f, -0.00513186249f, -0.00467005119f, -0.00420644516f,
+    -0.00374132779f, -0.00327498272f, -0.00280769374f, -0.00233974455f,
+    -0.00187141864f, -0.00140299909f, -0.000934768433f, -0.000467008443f,
+    -2.79344697e-17f, 0.000465977091f, 0.000930644261f, 0.00139372435f,
+    0.00185494175f, 0.00231402261f, 0.00277069494f, 0.00322468883f,
+    0.00367573654f, 0.00412357274f, 0.00456793459f, 0.00500856193f,
+    0.00544519743f, 0.00587758671f, 0.00630547855f, 0.00672862496f,
+    0.00714678136f, 0.00755970672f, 0.0079671637f, 0.00836891878f,
+    0.00876474236f, 0.00915440896f, 0.00953769728f, 0.00991439037f,
+    0.0102842757f, 0.0106471454f, 0.0110027961f, 0.0113510294f,
+    0.0116916518f, 0.0120244747f, 0.0123493148f, 0.0126659937f,
+    0.0129743386f, 0.0132741821f, 0.0135653621f, 0.0138477221f,
+    0.0141211115f, 0.0143853852f, 0.014640404f, 0.0148860345f,
+    0.0151221495f, 0.0153486275f, 0.0155653532f, 0.0157722174f,
+    0.0159691173f, 0.0161559561f, 0.0163326433f, 0.0164990947f,
+    0.0166552326f, 0.0168009855f, 0.0169362886f, 0.0170610831f,
+    0.0171753171f, 0.0172789449f, 0.0173719274f, 0.017454232f,
+    0.0175258326f, 0.0175867096f, 0.0176368499f, 0.0176762469f,
+    0.0177049006f, 0.0177228172f, 0.0177300097f, 0.0177264973f,
+    0.0177123056f, 0.0176874668f, 0.0176520192f, 0.0176060076f,
+    0.0175494829f, 0.0174825024f, 0.0174051294f, 0.0173174335f,
+    0.0172194902f, 0.0171113812f, 0.0169931939f, 0.0168650218f,
+    0.0167269641f, 0.0165791259f, 0.0164216176f, 0.0162545557f,
+    0.0160780618f, 0.015892263f, 0.0156972918f, 0.015493286f,
+    0.0152803884f, 0.015058747f, 0.0148285145f, 0.0145898486f,
+    0.0143429119f, 0.0140878713f, 0.0138248985f, 0.0135541694f,
+    0.0132758643f, 0.0129901676f, 0.0126972679f, 0.0123973575f,
+    0.0120906327f, 0.0117772934f, 0.0114575431f, 0.0111315885f,
+    0.01079964f, 0.0104619107f, 0.010118617f, 0.00976997813f,
+    0.00941621602f, 0.0090575552f, 0.00869422269f, 0.0083264478f,
+    0.00795446204f, 0.00757849893f, 0.0071987939f, 0.00681558408f,
+    0.00642910822f, 0.00603960652f, 0.00564732046f, 0.00525249267f,
+    0.00485536678f, 0.00445618729f, 0.00405519936f, 0.00365264875f,
+    0.00324878159f, 0.00284384428f, 0.0024380833f, 0.00203174511f,
+    0.00162507596f, 0.00121832179f, 0.000811728002f, 0.000405539404f,
+    -3.23641044e-17f, -0.000404647125f, -0.000808159961f, -0.00121029771f,
+    -0.00161082094f, -0.00200949171f, -0.00240607372f, -0.00280033245f,
+    -0.0031920353f, -0.00358095171f, -0.00396685332f, -0.00434951409f,
+    -0.00472871041f, -0.00510422127f, -0.00547582837f, -0.00584331623f,
+    -0.00620647233f, -0.00656508724f, -0.00691895471f, -0.00726787181f,
+    -0.00761163907f, -0.00795006052f, -0.00828294387f, -0.00861010059f,
+    -0.00893134601f, -0.00924649943f, -0.00955538422f, -0.00985782793f,
+    -0.0101536624f, -0.0104427237f, -0.0107248525f, -0.0109998939f,
+    -0.0112676977f, -0.0115281183f, -0.011781015f, -0.0120262517f,
+    -0.0122636975f, -0.0124932264f, -0.0127147173f, -0.0129280544f,
+    -0.0131331269f, -0.0133298295f, -0.0135180619f, -0.0136977293f,
+    -0.0138687422f, -0.0140310164f, -0.0141844734f, -0.0143290401f,
+    -0.0144646488f, -0.0145912376f, -0.0147087498f, -0.0148171346f,
+    -0.0149163468f, -0.0150063467f, -0.0150871004f, -0.0151585794f,
+    -0.0152207612f, -0.0152736286f, -0.0153171703f, -0.0153513807f,
+    -0.0153762595f, -0.0153918123f, -0.0153980504f, -0.0153949904f,
+    -0.0153826547f, -0.0153610711f, -0.015330273f, -0.0152902994f,
+    -0.0152411944f, -0.0151830078f, -0.0151157948f, -0.0150396157f,
+    -0.0149545362f, -0.0148606272f, -0.0147579649f, -0.0146466303f,
+    -0.0145267099f, -0.0143982947f, -0.014261481f, -0.0141163697f,
+    -0.0139630667f, -0.0138016825f, -0.0136323321f, -0.0134551353f,
+    -0.0132702163f, -0.0130777035f, -0.0128777299f, -0.0126704324f,
+    -0.0124559522f, -0.0122344345f, -0.0120060284f, -0.0117708868f,
+    -0.0115291664f, -0.0112810275f, -0.0110266339f, -0.0107661527f,
+    -0.0104997546f, -0.0102276132f, -0.00994990522f, -0.00966681055f,
+    -0.00937851175f, -0.00908519418f, -0.00878704581f, -0.00848425709f,
+    -0.0081770209f, -0.00786553232f, -0.0075499886f, -0.00723058899f,
+    -0.00690753463f, -0.00658102843f, -0.00625127491f, -0.00591848013f,
+    -0.00558285151f, -0.00524459772f, -0.00490392856f, -0.00456105484f,
+    -0.0042161882f, -0.00386954105f, -0.00352132638f, -0.00317175767f,
+    -0.00282104875f, -0.00246941365f, -0.00211706651f, -0.00176422139f,
+    -0.00141109222f, -0.00105789261f, -0.000704835729f, -0.000352134213f,
+    -2.45736837e-17f, 0.000351355777f, 0.000701722922f, 0.0010508923f,
+    0.00139865596f, 0.00174480725f, 0.00208914096f, 0.00243145342f,
+    0.00277154264f, 0.00310920841f, 0.00344425241f, 0.00377647837f,
+    0.00410569213f, 0.00443170178f, 0.00475431778f, 0.00507335303f,
+    0.00538862304f, 0.00569994597f, 0.00600714277f, 0.00631003728f,
+    0.00660845632f, 0.0069022298f, 0.0071911908f, 0.00747517567f,
+    0.00775402414f, 0.00802757939f, 0.00829568811f, 0.00855820066f,
+    0.00881497108f, 0.0090658572f, 0.00931072073f, 0.00954942729f,
+    0.00978184653f, 0.0100078522f, 0.0102273222f, 0.0104401385f,
+    0.0106461877f, 0.0108453602f, 0.0110375514f, 0.0112226607f,
+    0.011400592f, 0.0115712542f, 0.0117345601f, 0.0118904278f,
+    0.0120387796f, 0.0121795428f, 0.0123126491f, 0.0124380354f,
+    0.0125556431f, 0.0126654185f, 0.0127673128f, 0.0128612819f,
+    0.0129472869f, 0.0130252933f, 0.0130952721f, 0.0131571987f,
+    0.0132110536f, 0.0132568224f, 0.0132944952f, 0.0133240675f,
+    0.0133455392f, 0.0133589155f, 0.0133642062f, 0.0133614261f,
+    0.0133505949f, 0.0133317368f, 0.0133048812f, 0.013270062f,
+    0.0132273178f, 0.0131766921f, 0.013118233f, 0.013051993f,
+    0.0129780295f, 0.0128964042f, 0.0128071834f, 0.0127104378f,
+    0.0126062425f, 0.0124946769f, 0.0123758247f, 0.0122497738f,
+    0.0121166163f, 0.0119764483f, 0.01182937f, 0.0116754853f,
+    0.0115149024f, 0.011347733f, 0.0111740927f, 0.0109941004f,
+    0.0108078791f, 0.0106155549f, 0.0104172573f, 0.0102131194f,
+    0.0100032773f, 0.00978787029f, 0.0095670407f, 0.00934093384f,
+    0.00910969788f, 0.00887348374f, 0.00863244503f, 0.00838673791f,
+    0.00813652102f, 0.00788195536f, 0.00762320421f, 0.007360433f,
+    0.00709380922f, 0.00682350232f, 0.00654968358f, 0.00627252605f,
+    0.00599220436f, 0.00570889471f, 0.00542277468f, 0.00513402316f,
+    0.00484282024f, 0.00454934706f, 0.00425378575f, 0.00395631929f,
+    0.0036571314f, 0.00335640644f, 0.00305432925f, 0.00275108513f,
+    0.00244685962f, 0.00214183846f, 0.00183620747f, 0.00153015239f,
+    0.00122385884f, 0.000917512127f, 0.000611297215f, 0.000305398555f,
+    6.69958111e-17f, -0.00030471531f, -0.000608565056f, -0.000911367849f,
+    -0.00121294334f, -0.00151311231f, -0.00181169681f, -0.00210852023f,
+    -0.00240340743f, -0.00269618482f, -0.00298668047f, -0.00327472422f,
+    -0.00356014776f, -0.00384278476f, -0.00412247091f, -0.00439904408f,
+    -0.00467234437f, -0.00494221421f, -0.00520849845f, -0.00547104447f,
+    -0.00572970222f, -0.00598432437f, -0.00623476631f, -0.00648088632f,
+    -0.00672254559f, -0.0069596083f, -0.00719194172f, -0.00741941629f,
+    -0.00764190564f, -0.00785928672f, -0.00807143982f, -0.00827824866f,
+    -0.00847960046f, -0.00867538598f, -0.00886549957f, -0.00904983926f,
+    -0.00922830678f, -0.00940080764f, -0.00956725116f, -0.0097275505f,
+    -0.00988162276f, -0.010029389f, -0.0101707741f, -0.0103057072f,
+    -0.0104341214f, -0.0105559538f, -0.0106711458f, -0.0107796427f,
+    -0.0108813941f, -0.0109763538f, -0.0110644799f, -0.0111457344f,
+    -0.0112200839f, -0.011287499f, -0.0113479546f, -0.0114014299f,
+    -0.0114479084f, -0.0114873778f, -0.0115198301f, -0.0115452615f,
+    -0.0115636724f, -0.0115750675f, -0.0115794559f, -0.0115768506f,
+    -0.011567269f, -0.0115507326f, -0.0115272671f, -0.0114969022f,
+    -0.0114596718f, -0.0114156139f, -0.0113647704f, -0.0113071875f,
+    -0.0112429149f, -0.0111720067f, -0.0110945205f, -0.011010518f,
+    -0.0109200647f, -0.0108232295f, -0.0107200855f, -0.0106107091f,
+    -0.0104951803f, -0.0103735829f, -0.0102460038f, -0.0101125337f,
+    -0.00997326631f, -0.00982829886f, -0.00967773171f, -0.00952166839f,
+    -0.0093602155f, -0.00919348268f, -0.00902158249f, -0.00884463037f,
+    -0.00866274453f, -0.00847604592f, -0.00828465809f, -0.00808870716f,
+    -0.00788832173f, -0.00768363276f, -0.00747477354f, -0.00726187956f,
+    -0.00704508844f, -0.00682453985f, -0.0066003754f, -0.00637273858f,
+    -0.00614177463f, -0.00590763049f, -0.00567045469f, -0.00543039722f,
+    -0.00518760952f, -0.00494224429f, -0.00469445546f, -0.00444439809f,
+    -0.00419222823f, -0.00393810287f, -0.00368217982f, -0.0034246176f,
+    -0.0031655754f, -0.00290521291f, -0.00264369025f, -0.00238116792f,
+    -0.0021178066f, -0.00185376716f, -0.0015892105f, -0.00132429745f,
+    -0.0010591887f, -0.000794044715f, -0.000529025581f, -0.000264290967f,
+    -2.10776212e-17f, 0.000263688821f, 0.000526617722f, 0.000788629745f,
+    0.00104956885f, 0.00130927998f, 0.0015676092f, 0.00182440375f,
+    0.00207951212f, 0.00233278421f, 0.00258407133f, 0.00283322634f,
+    0.00308010374f, 0.00332455971f, 0.00356645224f, 0.00380564118f,
+    0.00404198833f, 0.00427535755f, 0.00450561476f, 0.00473262811f,
+    0.00495626799f, 0.00517640711f, 0.00539292063f, 0.00560568612f,
+    0.00581458376f, 0.00601949628f, 0.00622030913f, 0.00641691047f,
+    0.00660919128f, 0.00679704537f, 0.00698036949f, 0.00715906337f,
+    0.00733302973f, 0.0075021744f, 0.00766640632f, 0.00782563762f,
+    0.00797978364f, 0.00812876298f, 0.00827249757f, 0.00841091266f,
+    0.00854393689f, 0.00867150234f, 0.00879354453f, 0.00891000244f,
+    0.0090208186f, 0.00912593906f, 0.00922531344f, 0.00931889493f,
+    0.00940664036f, 0.00948851015f, 0.00956446837f, 0.00963448275f,
+    0.00969852469f, 0.00975656925f, 0.00980859516f, 0.00985458486f,
+    0.00989452447f, 0.00992840377f, 0.00995621626f, 0.0099779591f,
+    0.00999363313f, 0.0100032428f, 0.0100067964f, 0.0100043056f,
+    0.00999578583f, 0.00998125614f, 0.00996073914f, 0.009934261f,
+    0.00990185142f, 0.00986354365f, 0.0098193744f, 0.00976938384f,
+    0.00971361557f, 0.00965211656f, 0.00958493717f, 0.00951213105f,
+    0.00943375512f, 0.00934986955f, 0.0092605377f, 0.00916582606f,
+    0.00906580422f, 0.00896054482f, 0.00885012351f, 0.00873461886f,
+    0.00861411235f, 0.00848868827f, 0.00835843372f, 0.00822343847f,
+    0.008083795f, 0.00793959834f, 0.00779094609f, 0.00763793827f,
+    0.00748067734f, 0.00731926808f, 0.00715381752f, 0.00698443491f,
+    0.0068112316f, 0.006634321f, 0.0064538185f, 0.00626984139f,
+    0.00608250878f, 0.00589194155f, 0.00569826223f, 0.00550159496f,
+    0.0053020654f, 0.00509980065f, 0.00489492916f, 0.00468758066f,
+    0.00447788607f, 0.00426597743f, 0.00405198782f, 0.00383605125f,
+    0.0036183026f, 0.00339887755f, 0.00317791246f, 0.00295554431f,
+    0.0027319106f, 0.00250714928f, 0.00228139868f, 0.00205479738f,
+    0.00182748416f, 0.00159959792f, 0.00137127757f, 0.00114266195f,
+    0.000913889778f, 0.000685099535f, 0.000456429387f, 0.00022801711f,
+    -1.36496601e-17f, -0.000227485202f, -0.000454302397f, -0.000680316205f,
+    -0.000905392048f, -0.00112939623f, -0.001352196f, -0.00157365968f,
+    -0.00179365666f, -0.00201205755f, -0.00222873422f, -0.00244355988f,
+    -0.00265640915f, -0.00286715814f, -0.00307568453f, -0.00328186762f,
+    -0.00348558838f, -0.0036867296f, -0.00388517585f, -0.00408081364f,
+    -0.00427353142f, -0.00446321966f, -0.00464977093f, -0.00483307995f,
+    -0.00501304363f, -0.00518956115f, -0.00536253402f, -0.00553186609f,
+    -0.00569746368f, -0.00585923554f, -0.00601709299f, -0.00617094988f,
+    -0.00632072271f, -0.00646633064f, -0.00660769551f, -0.00674474195f,
+    -0.00687739734f, -0.00700559189f, -0.0071292587f, -0.00724833371f,
+    -0.00736275584f, -0.00747246693f, -0.0075774118f, -0.00767753831f,
+    -0.00777279733f, -0.0078631428f, -0.00794853172f, -0.0080289242f,
+    -0.00810428346f, -0.00817457586f, -0.00823977088f, -0.00829984116f,
+    -0.00835476251f, -0.0084045139f, -0.00844907747f, -0.00848843855f,
+    -0.00852258563f, -0.0085515104f, -0.00857520772f, -0.0085936756f,
+    -0.00860691524f, -0.00861493098f, -0.00861773033f, -0.00861532391f,
+    -0.00860772547f, -0.00859495186f, -0.00857702303f, -0.008553962f,
+    -0.00852579481f, -0.00849255056f, -0.00845426133f, -0.00841096217f,
+    -0.00836269109f, -0.008309489f, -0.00825139969f, -0.00818846983f,
+    -0.00812074887f, -0.00804828907f, -0.00797114539f, -0.00788937553f,
+    -0.00780303983f, -0.00771220125f, -0.00761692533f, -0.00751728012f,
+    -0.00741333616f, -0.00730516642f, -0.00719284626f, -0.00707645335f,
+    -0.00695606765f, -0.00683177134f, -0.00670364877f, -0.00657178641f,
+    -0.00643627277f, -0.00629719836f, -0.00615465565f, -0.00600873894f,
+    -0.0058595444f, -0.00570716991f, -0.00555171506f, -0.00539328105f,
+    -0.00523197067f, -0.00506788817f, -0.00490113924f, -0.00473183094f,
+    -0.00456007161f, -0.00438597082f, -0.00420963929f, -0.00403118882f,
+    -0.00385073224f, -0.00366838331f, -0.00348425667f, -0.00329846775f,
+    -0.00311113273f, -0.00292236842f, -0.00273229224f, -0.00254102211f,
+    -0.0023486764f, -0.00215537383f, -0.00196123344f, -0.00176637446f,
+    -0.0015709163f, -0.00137497843f, -0.00117868032f, -0.000982141399f,
+    -0.000785480923f, -0.000588817953f, -0.000392271267f, -0.000195959284f,
+    -1.75805031e-17f, 0.000195489086f, 0.000390391039f, 0.000584589562f,
+    0.000777969058f, 0.000970414704f, 0.00116181252f, 0.00135204942f,
+    0.00154101332f, 0.00172859313f, 0.00191467891f, 0.00209916185f,
+    0.0022819344f, 0.00246289027f, 0.00264192455f, 0.00281893374f,
+    0.0029938158f, 0.00316647023f, 0.00333679812f, 0.00350470219f,
+    0.00367008689f, 0.00383285839f, 0.00399292468f, 0.00415019562f,
+    0.00430458294f, 0.00445600036f, 0.0046043636f, 0.0047495904f,
+    0.00489160064f, 0.0050303163f, 0.00516566155f, 0.00529756279f,
+    0.00542594868f, 0.00555075016f, 0.00567190051f, 0.0057893354f,
+    0.00590299287f, 0.00601281341f, 0.00611873997f, 0.006220718f,
+    0.00631869546f, 0.00641262286f, 0.00650245326f, 0.00658814234f,
+    0.00666964837f, 0.00674693226f, 0.00681995756f, 0.00688869049f,
+    0.00695309994f, 0.00701315749f, 0.00706883743f, 0.00712011675f,
+    0.00716697516f, 0.00720939508f, 0.00724736168f, 0.00728086284f,
+    0.00730988917f, 0.00733443401f, 0.00735449344f, 0.00737006624f,
+    0.00738115393f, 0.0073877607f, 0.00738989348f, 0.00738756186f,
+    0.00738077812f, 0.00736955721f, 0.0073539167f, 0.00733387681f,
+    0.00730946037f, 0.0072806928f, 0.00724760207f, 0.00721021872f,
+    0.0071685758f, 0.00712270886f, 0.00707265591f, 0.00701845741f,
+    0.00696015621f, 0.00689779756f, 0.00683142904f, 0.00676110052f,
+    0.00668686418f, 0.00660877441f, 0.00652688781f, 0.00644126312f,
+    0.00635196121f, 0.00625904504f, 0.00616257956f, 0.00606263175f,
+    0.00595927051f, 0.00585256664f, 0.00574259278f, 0.00562942338f,
+    0.00551313464f, 0.00539380446f, 0.00527151237f, 0.00514633953f,
+    0.00501836861f, 0.00488768378f, 0.00475437067f, 0.00461851624f,
+    0.00448020882f, 0.00433953798f, 0.0041965945f, 0.00405147033f,
+    0.0039042585f, 0.00375505306f, 0.00360394907f, 0.00345104246f,
+    0.00329643006f, 0.00314020946f, 0.002982479f, 0.00282333767f,
+    0.0026628851f, 0.00250122144f, 0.00233844735f, 0.00217466389f,
+    0.0020099725f, 0.00184447491f, 0.00167827309f, 0.00151146918f,
+    0.00134416543f, 0.00117646416f, 0.00100846765f, 0.000840278125f,
+    0.000671997667f, 0.000503728163f, 0.000335571241f, 0.000167628211f,
+    4.01102859e-17f, -0.000167212901f, -0.000333910503f, -0.000499993374f,
+    -0.000665362703f, -0.000829920352f, -0.000993568918f, -0.00115621179f,
+    -0.0013177532f, -0.00147809829f, -0.00163715316f, -0.00179482492f,
+    -0.00195102174f, -0.00210565292f, -0.00225862893f, -0.00240986146f,
+    -0.00255926349f, -0.00270674929f, -0.00285223453f, -0.00299563629f,
+    -0.00313687311f, -0.00327586506f, -0.00341253375f, -0.00354680238f,
+    -0.00367859583f, -0.00380784063f, -0.00393446505f, -0.00405839911f,
+    -0.00417957465f, -0.00429792533f, -0.0044133867f, -0.00452589621f,
+    -0.00463539326f, -0.00474181919f, -0.00484511739f, -0.00494523326f,
+    -0.00504211426f, -0.00513570993f, -0.00522597195f, -0.00531285412f,
+    -0.00539631239f, -0.00547630491f, -0.00555279202f, -0.00562573629f,
+    -0.0056951025f, -0.00576085772f, -0.00582297125f, -0.00588141471f,
+    -0.00593616196f, -0.00598718921f, -0.00603447496f, -0.00607800001f,
+    -0.00611774751f, -0.00615370292f, -0.00618585404f, -0.006214191f,
+    -0.00623870626f, -0.00625939461f, -0.00627625316f, -0.00628928137f,
+    -0.00629848098f, -0.00630385608f, -0.00630541304f, -0.00630316052f,
+    -0.00629710948f, -0.00628727314f, -0.00627366699f, -0.00625630873f,
+    -0.00623521832f, -0.0062104179f, -0.00618193182f, -0.00614978659f,
+    -0.00611401086f, -0.00607463541f, -0.00603169312f, -0.00598521895f,
+    -0.0059352499f, -0.00588182499f, -0.00582498524f, -0.00576477362f,
+    -0.00570123505f, -0.00563441633f, -0.00556436614f, -0.00549113499f,
+    -0.00541477517f, -0.00533534075f, -0.00525288752f, -0.00516747295f,
+    -0.00507915615f, -0.00498799785f, -0.00489406034f, -0.00479740743f,
+    -0.00469810441f, -0.00459621801f, -0.00449181637f, -0.00438496895f,
+    -0.00427574653f, -0.00416422114f, -0.00405046604f, -0.00393455562f,
+    -0.00381656541f, -0.003696572f, -0.00357465299f, -0.00345088696f,
+    -0.00332535341f, -0.00319813268f, -0.00306930596f, -0.00293895518f,
+    -0.002807163f, -0.00267401274f, -0.00253958832f, -0.00240397421f,
+    -0.00226725542f, -0.00212951737f, -0.0019908459f, -0.0018513272f,
+    -0.00171104775f, -0.00157009424f, -0.0014285536f, -0.00128651285f,
+    -0.00114405911f, -0.00100127951f, -0.000858261193f, -0.000715091178f,
+    -0.000571856378f, -0.000428643519f, -0.000285539091f, -0.000142629296f,
+    -1.42165911e-17f, 0.000142263323f, 0.000284075638f, 0.000425352401f,
+    0.000566009609f, 0.000705963848f, 0.000845132344f, 0.000983433012f,
+    0.0011207845f, 0.00125710624f, 0.0013923185f, 0.00152634241f,
+    0.00165910004f, 0.0017905144f, 0.00192050955f, 0.00204901056f,
+    0.00217594363f, 0.00230123608f, 0.00242481641f, 0.00254661437f,
+    0.00266656092f, 0.00278458835f, 0.00290063029f, 0.00301462171f,
+    0.00312649903f, 0.00323620009f, 0.0033436642f, 0.00344883219f,
+    0.00355164644f, 0.0036520509f, 0.0037499911f, 0.00384541423f,
+    0.00393826913f, 0.00402850632f, 0.00411607804f, 0.00420093827f,
+    0.00428304273f, 0.00436234895f, 0.00443881624f, 0.00451240574f,
+    0.00458308044f, 0.00465080518f, 0.00471554668f, 0.00477727355f,
+    0.00483595631f, 0.0048915674f, 0.00494408117f, 0.00499347394f,
+    0.00503972396f, 0.00508281145f, 0.00512271858f, 0.00515942951f,
+    0.00519293036f, 0.00522320925f, 0.00525025624f, 0.00527406342f,
+    0.00529462482f, 0.00531193648f, 0.0053259964f, 0.00533680455f,
+    0.00534436289f, 0.00534867533f, 0.00534974771f, 0.00534758785f,
+    0.0053422055f, 0.00533361231f, 0.00532182187f, 0.00530684966f,
+    0.00528871304f, 0.00526743125f, 0.00524302538f, 0.00521551834f,
+    0.00518493487f, 0.00515130152f, 0.0051146466f, 0.00507500017f,
+    0.00503239404f, 0.0049868617f, 0.00493843836f, 0.00488716086f,
+    0.00483306768f, 0.0047761989f, 0.00471659618f, 0.00465430272f,
+    0.00458936324f, 0.00452182393f, 0.00445173247f, 0.0043791379f,
+    0.00430409071f, 0.00422664269f, 0.00414684698f, 0.00406475799f,
+    0.00398043136f, 0.00389392397f, 0.00380529384f, 0.00371460014f,
+    0.00362190312f, 0.00352726411f, 0.00343074542f, 0.00333241035f,
+    0.00323232313f, 0.0031305489f, 0.00302715361f, 0.00292220405f,
+    0.00281576777f, 0.00270791302f, 0.00259870876f, 0.00248822456f,
+    0.00237653058f, 0.00226369756f, 0.0021497967f, 0.00203489968f,
+    0.00191907859f, 0.0018024059f, 0.00168495438f, 0.0015667971f,
+    0.00144800735f, 0.00132865861f, 0.00120882452f, 0.0010885788f,
+    0.000967995227f, 0.000847147593f, 0.000726109652f, 0.000604955075f,
+    0.000483757412f, 0.00036259004f, 0.000241526125f, 0.000120638575f,
+    -4.81570919e-18f, -0.000120317337f, -0.000240241557f, -0.000359701212f,
+    -0.000478625323f, -0.000596943426f, -0.000714585611f, -0.000831482563f,
+    -0.000947565601f, -0.00106276672f, -0.00117701864f, -0.00129025481f,
+    -0.00140240951f, -0.0015134178f, -0.00162321565f, -0.00173173992f,
+    -0.00183892841f, -0.00194471987f, -0.00204905411f, -0.00215187193f,
+    -0.00225311525f, -0.00235272706f, -0.00245065152f, -0.00254683395f,
+    -0.00264122087f, -0.00273376002f, -0.00282440042f, -0.00291309236f,
+    -0.00299978745f, -0.00308443863f, -0.00316700021f, -0.00324742789f,
+    -0.00332567878f, -0.00340171141f, -0.00347548577f, -0.00354696335f,
+    -0.00361610709f, -0.00368288147f, -0.0037472525f, -0.00380918772f,
+    -0.00386865626f, -0.00392562878f, -0.00398007759f, -0.00403197654f,
+    -0.00408130115f, -0.00412802852f, -0.00417213741f, -0.00421360822f,
+    -0.00425242298f, -0.0042885654f, -0.00432202085f, -0.00435277635f,
+    -0.00438082059f, -0.00440614396f, -0.00442873849f, -0.00444859789f,
+    -0.00446571757f, -0.00448009457f, -0.00449172763f, -0.00450061714f,
+    -0.00450676515f, -0.00451017538f, -0.00451085316f, -0.00450880551f,
+    -0.00450404104f, -0.00449657001f, -0.00448640426f, -0.00447355726f,
+    -0.00445804404f, -0.00443988123f, -0.004419087f, -0.00439568107f,
+    -0.00436968469f, -0.00434112061f, -0.00431001309f, -0.00427638784f,
+    -0.00424027205f, -0.00420169434f, -0.00416068471f, -0.0041172746f,
+    -0.00407149678f, -0.00402338539f, -0.00397297586f, -0.00392030495f,
+    -0.00386541066f, -0.00380833224f, -0.00374911018f, -0.00368778612f,
+    -0.00362440287f, -0.00355900439f, -0.00349163572f, -0.00342234298f,
+    -0.00335117332f, -0.0032781749f, -0.00320339687f, -0.00312688929f,
+    -0.00304870317f, -0.00296889036f, -0.00288750359f, -0.00280459638f,
+    -0.002720223f, -0.00263443851f, -0.00254729862f, -0.00245885976f,
+    -0.00236917895f, -0.00227831383f, -0.00218632258f, -0.00209326393f,
+    -0.00199919706f, -0.00190418163f, -0.00180827769f, -0.00171154567f,
+    -0.00161404633f, -0.00151584075f, -0.00141699024f, -0.00131755634f,
+    -0.00121760079f, -0.00111718546f, -0.00101637232f, -0.000915223447f,
+    -0.00081380091f, -0.000712166791f, -0.00061038313f, -0.000508511881f,
+    -0.000406614885f, -0.000304753825f, -0.000202990192f, -0.000101385251f,
+    -4.04285147e-17f, 0.000101104865f, 0.000201868984f, 0.000302232371f,
+    0.000402135448f, 0.00050151908f, 0.000600324611f, 0.000698493896f,
+    0.000795969337f, 0.000892693915f, 0.000988611224f, 0.0010836655f,
+    0.00117780167f, 0.00127096534f, 0.00136310289f, 0.00145416144f,
+    0.00154408894f, 0.00163283414f, 0.00172034666f, 0.00180657701f,
+    0.00189147662f, 0.00197499784f, 0.00205709401f, 0.00213771944f,
+    0.00221682947f, 0.00229438049f, 0.00237032993f, 0.00244463634f,
+    0.00251725935f, 0.00258815974f, 0.00265729945f, 0.00272464156f,
+    0.00279015038f, 0.0028537914f, 0.00291553136f, 0.00297533821f,
+    0.0030331812f, 0.00308903083f, 0.0031428589f, 0.00319463851f,
+    0.00324434407f, 0.00329195132f, 0.00333743735f, 0.00338078058f,
+    0.0034219608f, 0.00346095916f, 0.0034977582f, 0.0035323418f,
+    0.00356469528f, 0.00359480531f, 0.00362265999f, 0.00364824877f,
+    0.00367156256f, 0.00369259363f, 0.00371133568f, 0.00372778379f,
+    0.00374193446f, 0.00375378559f, 0.00376333647f, 0.00377058779f,
+    0.00377554164f, 0.00377820147f, 0.00377857213f, 0.00377665985f,
+    0.0037724722f, 0.00376601811f, 0.00375730789f, 0.00374635314f,
+    0.00373316683f, 0.0037177632f, 0.00370015784f, 0.0036803676f,
+    0.0036584106f, 0.00363430625f, 0.00360807518f, 0.00357973925f,
+    0.00354932156f, 0.00351684637f, 0.00348233913f, 0.00344582647f,
+    0.00340733613f, 0.00336689698f, 0.00332453899f, 0.00328029321f,
+    0.00323419174f, 0.00318626771f, 0.00313655526f, 0.00308508953f,
+    0.00303190661f, 0.00297704353f, 0.00292053824f, 0.00286242955f,
+    0.00280275716f, 0.0027415616f, 0.0026788842f, 0.00261476706f,
+    0.00254925306f, 0.00248238579f, 0.00241420951f, 0.0023447692f,
+    0.00227411043f, 0.0022022794f, 0.00212932289f, 0.00205528822f,
+    0.00198022324f, 0.00190417626f, 0.00182719609f, 0.00174933193f,
+    0.00167063338f, 0.00159115043f, 0.00151093338f, 0.00143003282f,
+    0.00134849965f, 0.00126638496f, 0.00118374008f, 0.0011006165f,
+    0.00101706586f, 0.000933139911f, 0.000848890473f, 0.000764369424f,
+    0.000679628655f, 0.000594720041f, 0.000509695412f, 0.000424606519f,
+    0.000339505004f, 0.000254442367f, 0.000169469941f, 8.46388527e-05f,
+    2.1935532e-17f, -8.43959827e-05f, -0.000168498753f, -0.000252258291f,
+    -0.000335624927f, -0.000418549373f, -0.000500982749f, -0.000582876614f,
+    -0.000664182992f, -0.0007448544f, -0.000824843878f, -0.000904105012f,
+    -0.000982591962f, -0.00106025949f, -0.00113706299f, -0.00121295849f,
+    -0.00128790271f, -0.00136185308f, -0.00143476772f, -0.00150660554f,
+    -0.00157732618f, -0.0016468901f, -0.00171525858f, -0.0017823937f,
+    -0.00184825843f, -0.0019128166f, -0.00197603295f, -0.00203787312f,
+    -0.00209830368f, -0.00215729217f, -0.00221480707f, -0.00227081787f,
+    -0.00232529505f, -0.00237821008f, -0.0024295355f, -0.00247924486f,
+    -0.00252731279f, -0.00257371496f, -0.00261842814f, -0.00266143018f,
+    -0.00270270004f, -0.00274221778f, -0.00277996458f, -0.00281592275f,
+    -0.00285007573f, -0.00288240812f, -0.00291290564f, -0.00294155518f,
+    -0.00296834477f, -0.00299326363f, -0.00301630211f, -0.00303745176f,
+    -0.00305670527f, -0.00307405652f, -0.00308950054f, -0.00310303355f,
+    -0.00311465293f, -0.00312435722f, -0.00313214613f, -0.00313802053f,
+    -0.00314198245f, -0.00314403506f, -0.00314418269f, -0.00314243081f,
+    -0.00313878602f, -0.00313325605f, -0.00312584974f, -0.00311657704f,
+    -0.00310544903f, -0.00309247784f, -0.00307767671f, -0.00306105994f,
+    -0.00304264288f, -0.00302244194f, -0.00300047455f, -0.00297675916f,
+    -0.00295131523f, -0.0029241632f, -0.00289532451f, -0.00286482153f,
+    -0.00283267758f, -0.00279891691f, -0.00276356468f, -0.00272664693f,
+    -0.00268819057f, -0.00264822339f, -0.00260677398f, -0.00256387175f,
+    -0.00251954693f, -0.00247383048f, -0.00242675415f, -0.0023783504f,
+    -0.00232865241f, -0.00227769403f, -0.00222550978f, -0.00217213484f,
+    -0.00211760497f, -0.00206195656f, -0.00200522655f, -0.00194745243f,
+    -0.00188867222f, -0.00182892443f, -0.00176824803f, -0.00170668247f,
+    -0.00164426758f, -0.00158104363f, -0.00151705123f, -0.00145233135f,
+    -0.00138692527f, -0.00132087457f, -0.0012542211f, -0.00118700695f,
+    -0.00111927442f, -0.001051066f, -0.000982424346f, -0.000913392251f,
+    -0.000844012615f, -0.000774328422f, -0.000704382713f, -0.000634218562f,
+    -0.000563879044f, -0.000493407217f, -0.000422846089f, -0.000352238595f,
+    -0.000281627572f, -0.00021105573f, -0.00014056563f, -7.01996589e-05f,
+    -8.39490284e-18f, 6.99913878e-05f, 0.000139732797f, 0.000209182793f,
+    0.000278300244f, 0.00034704434f, 0.000415374617f, 0.000483250984f,
+    0.000550633742f, 0.000617483611f, 0.000683761749f, 0.000749429774f,
+    0.000814449792f, 0.00087878441f, 0.000942396763f, 0.00100525053f,
+    0.00106730997f, 0.0011285399f, 0.00118890579f, 0.00124837368f,
+    0.00130691031f, 0.00136448304f, 0.00142105994f, 0.00147660976f,
+    0.00153110197f, 0.00158450677f, 0.00163679512f, 0.00168793872f,
+    0.00173791007f, 0.00178668245f, 0.00183422994f, 0.00188052746f,
+    0.00192555073f, 0.00196927635f, 0.00201168175f, 0.00205274523f,
+    0.00209244597f, 0.00213076405f, 0.00216768043f, 0.00220317698f,
+    0.00223723649f, 0.00226984265f, 0.00230098011f, 0.00233063444f,
+    0.00235879215f, 0.00238544069f, 0.00241056847f, 0.00243416486f,
+    0.00245622018f, 0.00247672572f, 0.00249567372f, 0.00251305739f,
+    0.00252887093f, 0.00254310949f, 0.00255576917f, 0.00256684707f,
+    0.00257634123f, 0.00258425068f, 0.00259057539f, 0.00259531631f,
+    0.00259847532f, 0.00260005527f, 0.00260005995f, 0.0025984941f,
+    0.00259536339f, 0.00259067442f, 0.00258443471f, 0.00257665271f,
+    0.00256733777f, 0.00255650013f, 0.00254415093f, 0.0025303022f,
+    0.00251496682f, 0.00249815855f, 0.00247989199f, 0.00246018258f,
+    0.00243904659f, 0.0024165011f, 0.002392564f, 0.00236725396f,
+    0.00234059042f, 0.00231259359f, 0.00228328443f, 0.00225268462f,
+    0.00222081656f, 0.00218770334f, 0.00215336875f, 0.00211783725f,
+    0.00208113392f, 0.00204328451f, 0.00200431536f, 0.00196425343f,
+    0.00192312623f, 0.00188096187f, 0.00183778896f, 0.00179363666f,
+    0.00174853464f, 0.00170251303f, 0.00165560244f, 0.00160783394f,
+    0.00155923899f, 0.00150984949f, 0.00145969769f, 0.00140881623f,
+    0.00135723809f, 0.00130499656f, 0.00125212523f, 0.00119865798f,
+    0.00114462894f, 0.00109007248f, 0.00103502318f, 0.000979515824f,
+    0.000923585352f, 0.000867266864f, 0.000810595586f, 0.000753606848f,
+    0.000696336069f, 0.000638818726f, 0.000581090341f, 0.000523186453f,
+    0.000465142601f, 0.000406994298f, 0.000348777015f, 0.000290526155f,
+    0.000232277033f, 0.000174064857f, 0.000115924703f, 5.7891499e-05f,
+    -1.156707e-18f, -5.77152299e-05f, -0.000115219839f, -0.000172479707f,
+    -0.000229460968f, -0.000286130025f, -0.000342453575f, -0.000398398623f,
+    -0.000453932508f, -0.000509022912f, -0.000563637888f, -0.000617745874f,
+    -0.000671315708f, -0.000724316653f, -0.000776718408f, -0.000828491125f,
+    -0.000879605432f, -0.000930032443f, -0.000979743775f, -0.00102871157f,
+    -0.00107690849f, -0.00112430777f, -0.00117088319f, -0.00121660912f,
+    -0.00126146052f, -0.00130541295f, -0.00134844259f, -0.00139052626f,
+    -0.00143164141f, -0.00147176616f, -0.00151087928f, -0.00154896023f,
+    -0.00158598915f, -0.00162194688f, -0.00165681496f, -0.00169057566f,
+    -0.00172321197f, -0.00175470759f, -0.00178504699f, -0.00181421538f,
+    -0.0018421987f, -0.00186898369f, -0.00189455782f, -0.00191890934f,
+    -0.0019420273f, -0.00196390149f, -0.00198452251f, -0.00200388174f,
+    -0.00202197135f, -0.0020387843f, -0.00205431435f, -0.00206855604f,
+    -0.00208150472f, -0.00209315654f, -0.00210350842f, -0.00211255812f,
+    -0.00212030414f, -0.00212674582f, -0.00213188326f, -0.00213571736f,
+    -0.00213824981f, -0.00213948308f, -0.00213942041f, -0.00213806583f,
+    -0.0021354241f, -0.0021315008f, -0.00212630222f, -0.00211983542f,
+    -0.00211210822f, -0.00210312915f, -0.00209290749f, -0.00208145324f,
+    -0.00206877709f, -0.00205489048f, -0.00203980552f, -0.002023535f,
+    -0.0020060924f, -0.00198749186f, -0.0019677482f, -0.00194687684f,
+    -0.00192489388f, -0.00190181601f, -0.00187766056f, -0.00185244542f,
+    -0.0018261891f, -0.00179891066f, -0.00177062973f, -0.00174136649f,
+    -0.00171114164f, -0.00167997639f, -0.00164789248f, -0.00161491212f,
+    -0.00158105799f, -0.00154635324f, -0.00151082145f, -0.00147448663f,
+    -0.00143737322f, -0.00139950603f, -0.00136091026f, -0.00132161147f,
+    -0.00128163556f, -0.00124100878f, -0.00119975767f, -0.00115790908f,
+    -0.00111549012f, -0.00107252819f, -0.0010290509f, -0.000985086103f,
+    -0.000940661866f, -0.000895806437f, -0.000850548242f, -0.000804915859f,
+    -0.000758938006f, -0.000712643521f, -0.000666061342f, -0.000619220495f,
+    -0.000572150068f, -0.000524879201f, -0.000477437063f, -0.000429852839f,
+    -0.000382155706f, -0.000334374821f, -0.0002865393f, -0.000238678204f,
+    -0.000190820517f, -0.000142995134f, -9.52308383e-05f, -4.75562884e-05f,
+    7.58710832e-18f, 4.74096712e-05f, 9.46445457e-05f, 0.000141676637f,
+    0.000188478168f, 0.000235021586f, 0.000281279581f, 0.000327225099f,
+    0.000372831357f, 0.000418071864f, 0.000462920428f, 0.000507351177f,
+    0.00055133857f, 0.000594857414f, 0.000637882878f, 0.000680390503f,
+    0.000722356221f, 0.000763756364f, 0.000804567681f, 0.000844767347f,
+    0.000884332977f, 0.00092324264f, 0.000961474867f, 0.000999008665f,
+    0.00103582353f, 0.00107189945f, 0.00110721693f, 0.00114175698f,
+    0.00117550116f, 0.00120843154f, 0.00124053077f, 0.00127178201f,
+    0.00130216903f, 0.00133167615f, 0.00136028827f, 0.00138799088f,
+    0.00141477007f, 0.00144061251f, 0.00146550551f, 0.00148943696f,
+    0.00151239538f, 0.00153436992f, 0.00155535035f, 0.00157532708f,
+    0.00159429115f, 0.00161223422f, 0.00162914863f, 0.00164502734f,
+    0.00165986395f, 0.00167365274f, 0.0016863886f, 0.00169806711f,
+    0.00170868448f, 0.00171823756f, 0.00172672389f, 0.00173414162f,
+    0.00174048958f, 0.00174576724f, 0.00174997472f, 0.00175311276f,
+    0.00175518279f, 0.00175618684f, 0.00175612759f, 0.00175500837f,
+    0.00175283311f, 0.00174960638f, 0.00174533337f, 0.00174001989f,
+    0.00173367235f, 0.00172629776f, 0.00171790375f, 0.00170849852f,
+    0.00169809085f, 0.00168669013f, 0.00167430629f, 0.00166094982f,
+    0.00164663179f, 0.0016313638f, 0.00161515798f, 0.001598027f,
+    0.00157998404f, 0.00156104281f, 0.00154121748f, 0.00152052276f,
+    0.00149897378f, 0.0014765862f, 0.00145337608f, 0.00142935998f,
+    0.00140455485f, 0.00137897808f, 0.00135264748f, 0.00132558126f,
+    0.00129779799f, 0.00126931665f, 0.00124015656f, 0.0012103374f,
+    0.00117987919f, 0.00114880224f, 0.00111712722f, 0.00108487507f,
+    0.00105206701f, 0.00101872454f, 0.000984869401f, 0.000950523599f,
+    0.000915709351f, 0.000880449091f, 0.000844765454f, 0.00080868126f,
+    0.000772219498f, 0.000735403317f, 0.000698256006f, 0.000660800981f,
+    0.000623061773f, 0.000585062012f, 0.000546825409f, 0.000508375748f,
+    0.000469736867f, 0.000430932644f, 0.000391986983f, 0.000352923799f,
+    0.000313767007f, 0.000274540501f, 0.000235268146f, 0.000195973759f,
+    0.000156681099f, 0.00011741385f, 7.81956075e-05f, 3.9049865e-05f,
+    1.08977538e-17f, -3.89307395e-05f, -7.77192488e-05f, -0.00011634258f,
+    -0.000154777955f, -0.00019300278f, -0.000230994656f, -0.000268731394f,
+    -0.000306191026f, -0.00034335182f, -0.000380192288f, -0.000416691204f,
+    -0.000452827612f, -0.000488580836f, -0.000523930497f, -0.000558856521f,
+    -0.000593339151f, -0.000627358955f, -0.000660896842f, -0.000693934069f,
+    -0.000726452252f, -0.000758433374f, -0.000789859798f, -0.000820714276f,
+    -0.000850979956f, -0.00088064039f, -0.000909679548f, -0.00093808182f,
+    -0.00096583203f, -0.000992915439f, -0.00101931775f, -0.00104502514f,
+    -0.00107002421f, -0.00109430206f, -0.00111784625f, -0.00114064483f,
+    -0.00116268631f, -0.00118395972f, -0.00120445457f, -0.00122416088f,
+    -0.00124306915f, -0.00126117042f, -0.00127845623f, -0.00129491864f,
+    -0.00131055021f, -0.00132534406f, -0.00133929379f, -0.00135239357f,
+    -0.00136463807f, -0.0013760225f, -0.0013865426f, -0.00139619464f,
+    -0.00140497545f, -0.00141288234f, -0.00141991321f, -0.00142606645f,
+    -0.00143134101f, -0.00143573636f, -0.0014392525f, -0.00144188997f,
+    -0.00144364981f, -0.00144453362f, -0.00144454349f, -0.00144368204f,
+    -0.00144195242f, -0.00143935828f, -0.00143590377f, -0.00143159355f,
+    -0.0014264328f, -0.00142042717f, -0.00141358281f, -0.00140590636f,
+    -0.00139740492f, -0.0013880861f, -0.00137795794f, -0.00136702897f,
+    -0.00135530815f, -0.00134280493f, -0.00132952915f, -0.00131549113f,
+    -0.00130070158f, -0.00128517165f, -0.0012689129f, -0.00125193729f,
+    -0.00123425716f, -0.00121588528f, -0.00119683474f, -0.00117711903f,
+    -0.001156752f, -0.00113574785f, -0.00111412111f, -0.00109188663f,
+    -0.00106905961f, -0.00104565554f, -0.00102169022f, -0.000997179722f,
+    -0.000972140419f, -0.00094658894f, -0.000920542176f, -0.000894017262f,
+    -0.000867031571f, -0.000839602699f, -0.000811748457f, -0.000783486857f,
+    -0.000754836103f, -0.000725814575f, -0.000696440826f, -0.00066673356f,
+    -0.000636711628f, -0.000606394013f, -0.00057579982f, -0.000544948262f,
+    -0.000513858648f, -0.000482550376f, -0.000451042914f, -0.000419355794f,
+    -0.000387508597f, -0.000355520941f, -0.000323412471f, -0.000291202848f,
+    -0.000258911732f, -0.000226558775f, -0.00019416361f, -0.000161745834f,
+    -0.000129325003f, -9.69206131e-05f, -6.45520965e-05f, -3.22388049e-05f,
+    -4.498002e-18f, 3.21451577e-05f, 6.41776205e-05f, 9.60784643e-05f,
+    0.000127828899f, 0.000159410282f, 0.000190804123f, 0.000221992103f,
+    0.000252956076f, 0.000283678086f, 0.000314140375f, 0.00034432539f,
+    0.000374215799f, 0.000403794494f, 0.000433044607f, 0.000461949513f,
+    0.000490492845f, 0.000518658499f, 0.000546430645f, 0.000573793734f,
+    0.000600732509f, 0.000627232009f, 0.000653277581f, 0.000678854889f,
+    0.000703949914f, 0.000728548971f, 0.00075263871f, 0.000776206124f,
+    0.000799238558f, 0.000821723712f, 0.000843649653f, 0.000865004813f,
+    0.000885778001f, 0.000905958408f, 0.000925535608f, 0.00094449957f,
+    0.000962840656f, 0.00098054963f, 0.00099761766f, 0.00101403632f,
+    0.00102979761f, 0.00104489393f, 0.0010593181f, 0.00107306338f,
+    0.00108612345f, 0.00109849239f, 0.00111016475f, 0.0011211355f,
+    0.00113140002f, 0.00114095416f, 0.00114979419f, 0.00115791682f,
+    0.00116531919f, 0.0011719989f, 0.00117795396f, 0.00118318285f,
+    0.00118768447f, 0.00119145815f, 0.00119450368f, 0.00119682127f,
+    0.00119841157f, 0.00119927566f, 0.00119941505f, 0.00119883169f,
+    0.00119752794f, 0.0011955066f, 0.00119277088f, 0.0011893244f,
+    0.00118517122f, 0.00118031579f, 0.00117476297f, 0.00116851803f,
+    0.00116158664f, 0.00115397484f, 0.0011456891f, 0.00113673624f,
+    0.00112712348f, 0.0011168584f, 0.00110594896f, 0.00109440347f,
+    0.00108223061f, 0.0010694394f, 0.0010560392f, 0.00104203974f,
+    0.00102745103f, 0.00101228345f, 0.000996547671f, 0.000980254676f,
+    0.000963415757f, 0.000946042496f, 0.000928146766f, 0.000909740714f,
+    0.000890836762f, 0.000871447594f, 0.000851586146f, 0.000831265604f,
+    0.000810499389f, 0.000789301152f, 0.000767684765f, 0.000745664309f,
+    0.00072325407f, 0.000700468526f, 0.000677322341f, 0.000653830351f,
+    0.000630007561f, 0.00060586913f, 0.000581430366f, 0.000556706712f,
+    0.000531713741f, 0.000506467143f, 0.000480982718f, 0.000455276364f,
+    0.000429364069f, 0.000403261899f, 0.000376985992f, 0.000350552544f,
+    0.000323977802f, 0.000297278055f, 0.000270469621f, 0.000243568838f,
+    0.000216592058f, 0.000189555633f, 0.000162475905f, 0.000135369203f,
+    0.000108251823f, 8.11400268e-05f, 5.40500296e-05f, 2.69979897e-05f,
+    -1.36012098e-21f, -2.69279213e-05f, -5.37698402e-05f, -8.05099164e-05f,
+    -0.000107132412f, -0.0001336217f, -0.000159962275f, -0.000186138761f,
+    -0.000212135919f, -0.000237938658f, -0.000263532041f, -0.000288901297f,
+    -0.000314031824f, -0.000338909204f, -0.000363519203f, -0.000387847788f,
+    -0.000411881125f, -0.000435605596f, -0.0004590078f, -0.000482074563f,
+    -0.000504792944f, -0.000527150244f, -0.00054913401f, -0.000570732044f,
+    -0.000591932411f, -0.000612723439f, -0.000633093733f, -0.000653032177f,
+    -0.000672527938f, -0.000691570475f, -0.000710149545f, -0.000728255206f,
+    -0.00074587782f, -0.000763008065f, -0.000779636933f, -0.000795755736f,
+    -0.000811356113f, -0.000826430031f, -0.000840969792f, -0.000854968032f,
+    -0.00086841773f, -0.000881312206f, -0.00089364513f, -0.000905410517f,
+    -0.000916602739f, -0.000927216518f, -0.000937246936f, -0.000946689432f,
+    -0.000955539807f, -0.000963794222f, -0.000971449202f, -0.000978501639f,
+    -0.000984948786f, -0.000990788266f, -0.000996018067f, -0.00100063654f,
+    -0.00100464242f, -0.00100803478f, -0.00101081308f, -0.00101297714f,
+    -0.00101452715f, -0.00101546365f, -0.00101578756f, -0.00101550016f,
+    -0.00101460307f, -0.00101309828f, -0.00101098814f, -0.00100827535f,
+    -0.00100496297f, -0.00100105438f, -0.00099655333f, -0.000991463911f,
+    -0.000985790547f, -0.000979537997f, -0.000972711354f, -0.000965316039f,
+    -0.000957357798f, -0.000948842695f, -0.000939777111f, -0.000930167738f,
+    -0.000920021574f, -0.000909345918f, -0.000898148368f, -0.000886436811f,
+    -0.00087421942f, -0.000861504649f, -0.000848301228f, -0.000834618155f,
+    -0.00082046469f, -0.000805850351f, -0.000790784908f, -0.000775278374f,
+    -0.000759341f, -0.000742983269f, -0.000726215889f, -0.000709049785f,
+    -0.000691496093f, -0.000673566154f, -0.000655271504f, -0.00063662387f,
+    -0.00061763516f, -0.000598317458f, -0.000578683014f, -0.000558744239f,
+    -0.000538513694f, -0.000518004086f, -0.000497228259f, -0.000476199183f,
+    -0.000454929951f, -0.000433433767f, -0.000411723942f, -0.000389813881f,
+    -0.00036771708f, -0.000345447114f, -0.000323017629f, -0.000300442339f,
+    -0.000277735011f, -0.00025490946f, -0.00023197954f, -0.000208959139f,
+    -0.000185862165f, -0.000162702543f, -0.000139494203f, -0.000116251074f,
+    -9.2987077e-05f, -6.9716113e-05f, -4.64520578e-05f, -2.32087536e-05f,
+    -1.01834725e-17f, 2.3160453e-05f, 4.62589136e-05f, 6.92817558e-05f,
+    9.22154274e-05f, 0.000115046457f, 0.000137761465f, 0.000160347164f,
+    0.000182790375f, 0.00020507803f, 0.000227197179f, 0.000249135f,
+    0.000270878804f, 0.000292416045f, 0.000313734321f, 0.000334821389f,
+    0.000355665167f, 0.000376253739f, 0.000396575367f, 0.000416618494f,
+    0.000436371751f, 0.000455823962f, 0.000474964154f, 0.000493781557f,
+    0.000512265617f, 0.000530405995f, 0.000548192578f, 0.00056561548f,
+    0.000582665051f, 0.000599331879f, 0.000615606799f, 0.000631480892f,
+    0.000646945495f, 0.000661992205f, 0.000676612879f, 0.000690799643f,
+    0.000704544894f, 0.000717841305f, 0.000730681826f, 0.000743059692f,
+    0.000754968421f, 0.000766401822f, 0.000777353996f, 0.000787819338f,
+    0.000797792542f, 0.000807268601f, 0.00081624281f, 0.000824710771f,
+    0.000832668391f, 0.000840111884f, 0.000847037777f, 0.000853442906f,
+    0.000859324421f, 0.000864679786f, 0.000869506778f, 0.000873803492f,
+    0.000877568334f, 0.000880800032f, 0.000883497626f, 0.000885660474f,
+    0.00088728825f, 0.000888380943f, 0.000888938857f, 0.000888962611f,
+    0.000888453136f, 0.000887411677f, 0.000885839787f, 0.000883739333f,
+    0.000881112484f, 0.000877961719f, 0.00087428982f, 0.00087009987f,
+    0.000865395251f, 0.000860179643f, 0.000854457019f, 0.000848231645f,
+    0.000841508074f, 0.000834291144f, 0.000826585975f, 0.000818397966f,
+    0.00080973279f, 0.000800596391f, 0.00079099498f, 0.00078093503f,
+    0.000770423275f, 0.000759466701f, 0.000748072544f, 0.000736248287f,
+    0.000724001651f, 0.000711340593f, 0.000698273302f, 0.000684808191f,
+    0.000670953892f, 0.000656719253f, 0.000642113331f, 0.000627145386f,
+    0.000611824876f, 0.00059616145f, 0.000580164945f, 0.000563845375f,
+    0.00054721293f, 0.000530277967f, 0.000513051005f, 0.000495542717f,
+    0.000477763923f, 0.000459725589f, 0.000441438813f, 0.000422914823f,
+    0.000404164968f, 0.000385200714f, 0.000366033632f, 0.000346675398f,
+    0.000327137781f, 0.000307432637f, 0.000287571903f, 0.00026756759f,
+    0.000247431774f, 0.000227176591f, 0.00020681423f, 0.000186356922f,
+    0.000165816938f, 0.000145206581f, 0.000124538174f, 0.000103824058f,
+    8.30765831e-05f, 6.23081005e-05f, 4.15309566e-05f, 2.07574851e-05f,
+    6.21179392e-18f, -2.07292113e-05f, -4.14178955e-05f, -6.20538399e-05f,
+    -8.262488e-05f, -0.000103118906f, -0.000123523871f, -0.000143827795f,
+    -0.000164018774f, -0.000184084989f, -0.000204014707f, -0.000223796293f,
+    -0.000243418212f, -0.00026286904f, -0.000282137469f, -0.000301212312f,
+    -0.000320082509f, -0.000338737136f, -0.000357165409f, -0.000375356691f,
+    -0.000393300497f, -0.000410986502f, -0.000428404543f, -0.000445544629f,
+    -0.000462396943f, -0.00047895185f, -0.000495199901f, -0.000511131839f,
+    -0.000526738602f, -0.000542011332f, -0.000556941376f, -0.000571520293f,
+    -0.000585739858f, -0.000599592065f, -0.000613069135f, -0.000626163517f,
+    -0.000638867893f, -0.000651175182f, -0.000663078544f, -0.000674571385f,
+    -0.000685647356f, -0.000696300362f, -0.000706524562f, -0.000716314373f,
+    -0.000725664473f, -0.000734569802f, -0.000743025568f, -0.000751027246f,
+    -0.000758570583f, -0.0007656516f, -0.00077226659f, -0.000778412126f,
+    -0.000784085058f, -0.000789282516f, -0.000794001914f, -0.000798240944f,
+    -0.000801997586f, -0.000805270103f, -0.000808057042f, -0.000810357238f,
+    -0.000812169811f, -0.000813494168f, -0.00081433f, -0.000814677289f,
+    -0.000814536299f, -0.00081390758f, -0.00081279197f, -0.000811190588f,
+    -0.000809104838f, -0.000806536406f, -0.000803487257f, -0.000799959639f,
+    -0.000795956076f, -0.000791479368f, -0.00078653259f, -0.000781119089f,
+    -0.000775242483f, -0.000768906656f, -0.000762115761f, -0.000754874209f,
+    -0.000747186673f, -0.000739058085f, -0.000730493628f, -0.000721498736f,
+    -0.000712079092f, -0.000702240622f, -0.000691989491f, -0.000681332101f,
+    -0.000670275089f, -0.000658825317f, -0.000646989872f, -0.000634776063f,
+    -0.000622191413f, -0.000609243657f, -0.000595940735f, -0.000582290791f,
+    -0.000568302164f, -0.000553983385f, -0.000539343173f, -0.000524390428f,
+    -0.000509134227f, -0.000493583816f, -0.000477748608f, -0.000461638177f,
+    -0.000445262249f, -0.0004286307f, -0.000411753549f, -0.00039464095f,
+    -0.00037730319f, -0.000359750681f, -0.000341993952f, -0.000324043645f,
+    -0.00030591051f, -0.000287605395f, -0.000269139244f, -0.000250523086f,
+    -0.000231768033f, -0.00021288527f, -0.000193886051f, -0.000174781691f,
+    -0.000155583559f, -0.000136303075f, -0.000116951698f, -9.75409225e-05f,
+    -7.80822719e-05f, -5.85872911e-05f, -3.90675399e-05f, -1.95345863e-05f,
+    0.0f, 0.0f,
+};
+
+// ResamplerProfile_High
+const sample_t sinc_table_64_512[32770] = {
+    1.0f, 0.999993725f, 0.999974898f, 0.999943518f,
+    0.999899585f, 0.9998431f, 0.999774065f, 0.999692481f,
+    0.99959835f, 0.999491673f, 0.999372454f, 0.999240696f,
+    0.9990964f, 0.998939571f, 0.998770212f, 0.998588326f,
+    0.998393918f, 0.998186993f, 0.997967554f, 0.997735607f,
+    0.997491158f, 0.997234211f, 0.996964773f, 0.996682849f,
+    0.996388446f, 0.99608157f, 0.99576223f, 0.99543043f,
+    0.99508618f, 0.994729488f, 0.99436036f, 0.993978805f,
+    0.993584833f, 0.993178451f, 0.99275967f, 0.992328498f,
+    0.991884945f, 0.991429022f, 0.990960739f, 0.990480105f,
+    0.989987133f, 0.989481832f, 0.988964216f, 0.988434294f,
+    0.98789208f, 0.987337586f, 0.986770823f, 0.986191805f,
+    0.985600545f, 0.984997056f, 0.984381352f, 0.983753447f,
+    0.983113355f, 0.98246109f, 0.981796667f, 0.981120101f,
+    0.980431407f, 0.979730602f, 0.979017699f, 0.978292717f,
+    0.977555671f, 0.976806577f, 0.976045453f, 0.975272316f,
+    0.974487183f, 0.973690071f, 0.972881f, 0.972059986f,
+    0.97122705f, 0.970382208f, 0.969525481f, 0.968656888f,
+    0.967776447f, 0.96688418f, 0.965980106f, 0.965064246f,
+    0.96413662f, 0.963197248f, 0.962246153f, 0.961283356f,
+    0.960308878f, 0.95932274f, 0.958324967f, 0.957315579f,
+    0.9562946f, 0.955262052f, 0.954217959f, 0.953162344f,
+    0.952095231f, 0.951016643f, 0.949926606f, 0.948825144f,
+    0.947712281f, 0.946588043f, 0.945452454f, 0.94430554f,
+    0.943147328f, 0.941977842f, 0.940797109f, 0.939605157f,
+    0.93840201f, 0.937187697f, 0.935962245f, 0.934725681f,
+    0.933478033f, 0.932219329f, 0.930949598f, 0.929668866f,
+    0.928377164f, 0.927074521f, 0.925760965f, 0.924436526f,
+    0.923101233f, 0.921755117f, 0.920398208f, 0.919030536f,
+    0.917652132f, 0.916263026f, 0.914863249f, 0.913452834f,
+    0.912031811f, 0.910600212f, 0.90915807f, 0.907705416f,
+    0.906242284f, 0.904768705f, 0.903284712f, 0.90179034f,
+    0.900285621f, 0.898770588f, 0.897245277f, 0.89570972f,
+    0.894163952f, 0.892608007f, 0.891041921f, 0.889465728f,
+    0.887879463f, 0.886283162f, 0.88467686f, 0.883060593f,
+    0.881434397f, 0.879798309f, 0.878152364f, 0.876496599f,
+    0.874831052f, 0.87315576f, 0.871470759f, 0.869776087f,
+    0.868071782f, 0.866357881f, 0.864634424f, 0.862901448f,
+    0.861158991f, 0.859407093f, 0.857645792f, 0.855875127f,
+    0.854095138f, 0.852305865f, 0.850507346f, 0.848699622f,
+    0.846882733f, 0.84505672f, 0.843221622f, 0.84137748f,
+    0.839524336f, 0.83766223f, 0.835791204f, 0.833911298f,
+    0.832022555f, 0.830125017f, 0.828218725f, 0.826303721f,
+    0.824380048f, 0.822447749f, 0.820506865f, 0.818557441f,
+    0.816599519f, 0.814633141f, 0.812658353f, 0.810675197f,
+    0.808683716f, 0.806683956f, 0.804675959f, 0.802659771f,
+    0.800635435f, 0.798602997f, 0.7965625f, 0.794513991f,
+    0.792457513f, 0.790393113f, 0.788320835f, 0.786240726f,
+    0.78415283f, 0.782057194f, 0.779953864f, 0.777842886f,
+    0.775724307f, 0.773598172f, 0.771464529f, 0.769323423f,
+    0.767174903f, 0.765019016f, 0.762855808f, 0.760685326f,
+    0.758507619f, 0.756322734f, 0.754130719f, 0.751931622f,
+    0.74972549f, 0.747512373f, 0.745292317f, 0.743065373f,
+    0.740831588f, 0.738591012f, 0.736343692f, 0.734089679f,
+    0.73182902f, 0.729561767f, 0.727287967f, 0.72500767f,
+    0.722720927f, 0.720427786f, 0.718128298f, 0.715822512f,
+    0.713510479f, 0.711192249f, 0.708867872f, 0.706537399f,
+    0.70420088f, 0.701858365f, 0.699509907f, 0.697155555f,
+    0.694795361f, 0.692429375f, 0.690057649f, 0.687680235f,
+    0.685297182f, 0.682908544f, 0.680514372f, 0.678114717f,
+    0.675709631f, 0.673299166f, 0.670883374f, 0.668462307f,
+    0.666036017f, 0.663604557f, 0.661167979f, 0.658726335f,
+    0.656279678f, 0.65382806f, 0.651371534f, 0.648910153f,
+    0.646443969f, 0.643973036f, 0.641497407f, 0.639017134f,
+    0.636532271f, 0.634042871f, 0.631548987f, 0.629050673f,
+    0.626547982f, 0.624040967f, 0.621529682f, 0.619014181f,
+    0.616494517f, 0.613970744f, 0.611442917f, 0.608911087f,
+    0.606375311f, 0.603835641f, 0.601292132f, 0.598744837f,
+    0.596193811f, 0.593639109f, 0.591080783f, 0.588518889f,
+    0.585953481f, 0.583384613f, 0.580812339f, 0.578236715f,
+    0.575657794f, 0.573075631f, 0.570490281f, 0.567901798f,
+    0.565310237f, 0.562715652f, 0.560118099f, 0.557517632f,
+    0.554914305f, 0.552308174f, 0.549699293f, 0.547087717f,
+    0.544473501f, 0.5418567f, 0.539237369f, 0.536615562f,
+    0.533991335f, 0.531364743f, 0.52873584f, 0.526104682f,
+    0.523471323f, 0.520835819f, 0.518198224f, 0.515558594f,
+    0.512916983f, 0.510273447f, 0.507628041f, 0.504980819f,
+    0.502331837f, 0.49968115f, 0.497028812f, 0.494374879f,
+    0.491719407f, 0.489062448f, 0.48640406f, 0.483744297f,
+    0.481083213f, 0.478420864f, 0.475757305f, 0.473092591f,
+    0.470426776f, 0.467759916f, 0.465092065f, 0.462423278f,
+    0.459753611f, 0.457083118f, 0.454411853f, 0.451739872f,
+    0.449067229f, 0.44639398f, 0.443720178f, 0.441045878f,
+    0.438371136f, 0.435696005f, 0.43302054f, 0.430344796f,
+    0.427668827f, 0.424992687f, 0.422316432f, 0.419640115f,
+    0.41696379f, 0.414287512f, 0.411611336f, 0.408935315f,
+    0.406259503f, 0.403583954f, 0.400908723f, 0.398233864f,
+    0.39555943f, 0.392885475f, 0.390212053f, 0.387539217f,
+    0.384867022f, 0.382195521f, 0.379524768f, 0.376854815f,
+    0.374185717f, 0.371517527f, 0.368850298f, 0.366184083f,
+    0.363518936f, 0.360854908f, 0.358192055f, 0.355530428f,
+    0.35287008f, 0.350211064f, 0.347553432f, 0.344897238f,
+    0.342242534f, 0.339589372f, 0.336937804f, 0.334287883f,
+    0.331639662f, 0.328993191f, 0.326348523f, 0.323705711f,
+    0.321064805f, 0.318425858f, 0.315788921f, 0.313154046f,
+    0.310521284f, 0.307890687f, 0.305262305f, 0.30263619f,
+    0.300012393f, 0.297390965f, 0.294771956f, 0.292155418f,
+    0.289541401f, 0.286929955f, 0.284321131f, 0.28171498f,
+    0.279111551f, 0.276510894f, 0.273913059f, 0.271318097f,
+    0.268726057f, 0.266136988f, 0.26355094f, 0.260967962f,
+    0.258388104f, 0.255811414f, 0.253237942f, 0.250667737f,
+    0.248100847f, 0.24553732f, 0.242977206f, 0.240420552f,
+    0.237867408f, 0.23531782f, 0.232771837f, 0.230229506f,
+    0.227690876f, 0.225155994f, 0.222624907f, 0.220097662f,
+    0.217574307f, 0.215054889f, 0.212539454f, 0.21002805f,
+    0.207520721f, 0.205017516f, 0.202518481f, 0.20002366f,
+    0.197533101f, 0.195046849f, 0.19256495f, 0.19008745f,
+    0.187614392f, 0.185145824f, 0.18268179f, 0.180222334f,
+    0.177767502f, 0.175317337f, 0.172871886f, 0.17043119f,
+    0.167995296f, 0.165564246f, 0.163138084f, 0.160716855f,
+    0.1583006f, 0.155889365f, 0.153483191f, 0.151082121f,
+    0.148686199f, 0.146295467f, 0.143909967f, 0.141529741f,
+    0.139154832f, 0.136785282f, 0.134421132f, 0.132062423f,
+    0.129709197f, 0.127361495f, 0.125019359f, 0.122682828f,
+    0.120351944f, 0.118026747f, 0.115707277f, 0.113393574f,
+    0.111085678f, 0.10878363f, 0.106487467f, 0.10419723f,
+    0.101912959f, 0.0996346904f, 0.0973624647f, 0.09509632f,
+    0.0928362948f, 0.0905824271f, 0.0883347549f, 0.0860933161f,
+    0.0838581482f, 0.0816292887f, 0.0794067746f, 0.0771906429f,
+    0.0749809306f, 0.0727776741f, 0.0705809099f, 0.0683906741f,
+    0.0662070028f, 0.0640299317f, 0.0618594963f, 0.0596957322f,
+    0.0575386744f, 0.0553883579f, 0.0532448174f, 0.0511080875f,
+    0.0489782026f, 0.0468551968f, 0.044739104f, 0.0426299579f,
+    0.0405277919f, 0.0384326395f, 0.0363445336f, 0.0342635071f,
+    0.0321895927f, 0.0301228228f, 0.0280632296f, 0.0260108451f,
+    0.0239657011f, 0.0219278292f, 0.0198972606f, 0.0178740265f,
+    0.0158581579f, 0.0138496854f, 0.0118486394f, 0.00985505032f,
+    0.00786894805f, 0.00589036241f, 0.003919323f, 0.00195585915f,
+    3.89602058e-17f, -0.00194822555f, -0.00388878882f, -0.00582166136f,
+    -0.00774681494f, -0.00966422158f, -0.0115738535f, -0.0134756831f,
+    -0.0153696832f, -0.0172558266f, -0.0191340866f, -0.0210044363f,
+    -0.0228668496f, -0.0247213002f, -0.0265677621f, -0.0284062098f,
+    -0.0302366176f, -0.0320589605f, -0.0338732134f, -0.0356793515f,
+    -0.0374773503f, -0.0392671856f, -0.0410488332f, -0.0428222693f,
+    -0.0445874704f, -0.0463444131f, -0.0480930743f, -0.0498334312f,
+    -0.051565461f, -0.0532891414f, -0.0550044503f, -0.0567113657f,
+    -0.0584098659f, -0.0600999296f, -0.0617815354f, -0.0634546625f,
+    -0.0651192901f, -0.0667753978f, -0.0684229653f, -0.0700619726f,
+    -0.0716924f, -0.0733142279f, -0.0749274372f, -0.0765320087f,
+    -0.0781279238f, -0.0797151638f, -0.0812937105f, -0.0828635458f,
+    -0.084424652f, -0.0859770114f, -0.0875206068f, -0.089055421f,
+    -0.0905814374f, -0.0920986392f, -0.0936070102f, -0.0951065342f,
+    -0.0965971955f, -0.0980789785f, -0.0995518677f, -0.101015848f,
+    -0.102470905f, -0.103917023f, -0.105354189f, -0.106782388f,
+    -0.108201607f, -0.109611831f, -0.111013048f, -0.112405244f,
+    -0.113788407f, -0.115162523f, -0.116527581f, -0.117883568f,
+    -0.119230472f, -0.120568283f, -0.121896987f, -0.123216575f,
+    -0.124527036f, -0.125828358f, -0.127120532f, -0.128403546f,
+    -0.129677392f, -0.13094206f, -0.13219754f, -0.133443823f,
+    -0.134680901f, -0.135908764f, -0.137127405f, -0.138336814f,
+    -0.139536985f, -0.140727909f, -0.141909579f, -0.143081988f,
+    -0.14424513f, -0.145398996f, -0.146543582f, -0.147678881f,
+    -0.148804886f, -0.149921593f, -0.151028996f, -0.152127089f,
+    -0.153215868f, -0.154295328f, -0.155365465f, -0.156426274f,
+    -0.157477752f, -0.158519895f, -0.159552699f, -0.160576162f,
+    -0.161590279f, -0.16259505f, -0.16359047f, -0.164576539f,
+    -0.165553253f, -0.166520612f, -0.167478614f, -0.168427257f,
+    -0.169366541f, -0.170296464f, -0.171217027f, -0.17212823f,
+    -0.173030071f, -0.173922552f, -0.174805673f, -0.175679434f,
+    -0.176543837f, -0.177398883f, -0.178244573f, -0.17908091f,
+    -0.179907894f, -0.180725528f, -0.181533815f, -0.182332757f,
+    -0.183122357f, -0.183902618f, -0.184673544f, -0.185435139f,
+    -0.186187405f, -0.186930348f, -0.187663972f, -0.18838828f,
+    -0.189103279f, -0.189808973f, -0.190505367f, -0.191192467f,
+    -0.191870279f, -0.192538808f, -0.193198062f, -0.193848045f,
+    -0.194488766f, -0.195120231f, -0.195742447f, -0.196355422f,
+    -0.196959163f, -0.197553678f, -0.198138975f, -0.198715063f,
+    -0.19928195f, -0.199839645f, -0.200388157f, -0.200927496f,
+    -0.20145767f, -0.201978689f, -0.202490564f, -0.202993304f,
+    -0.20348692f, -0.203971423f, -0.204446823f, -0.204913131f,
+    -0.20537036f, -0.205818519f, -0.206257622f, -0.206687679f,
+    -0.207108704f, -0.207520708f, -0.207923705f, -0.208317706f,
+    -0.208702726f, -0.209078777f, -0.209445872f, -0.209804027f,
+    -0.210153254f, -0.210493568f, -0.210824983f, -0.211147513f,
+    -0.211461174f, -0.211765981f, -0.212061948f, -0.212349091f,
+    -0.212627427f, -0.21289697f, -0.213157736f, -0.213409743f,
+    -0.213653007f, -0.213887543f, -0.21411337f, -0.214330504f,
+    -0.214538963f, -0.214738764f, -0.214929925f, -0.215112463f,
+    -0.215286398f, -0.215451747f, -0.215608528f, -0.215756762f,
+    -0.215896465f, -0.216027659f, -0.216150362f, -0.216264593f,
+    -0.216370373f, -0.216467721f, -0.216556657f, -0.216637202f,
+    -0.216709377f, -0.216773201f, -0.216828696f, -0.216875884f,
+    -0.216914784f, -0.21694542f, -0.216967812f, -0.216981982f,
+    -0.216987953f, -0.216985746f, -0.216975384f, -0.21695689f,
+    -0.216930287f, -0.216895596f, -0.216852843f, -0.216802049f,
+    -0.216743239f, -0.216676436f, -0.216601664f, -0.216518947f,
+    -0.216428309f, -0.216329775f, -0.216223369f, -0.216109116f,
+    -0.215987042f, -0.21585717f, -0.215719527f, -0.215574137f,
+    -0.215421027f, -0.215260222f, -0.215091749f, -0.214915633f,
+    -0.2147319f, -0.214540577f, -0.214341691f, -0.214135269f,
+    -0.213921336f, -0.213699922f, -0.213471052f, -0.213234754f,
+    -0.212991056f, -0.212739986f, -0.21248157f, -0.212215839f,
+    -0.211942819f, -0.211662539f, -0.211375027f, -0.211080313f,
+    -0.210778425f, -0.210469392f, -0.210153243f, -0.209830007f,
+    -0.209499714f, -0.209162393f, -0.208818074f, -0.208466788f,
+    -0.208108563f, -0.207743429f, -0.207371419f, -0.20699256f,
+    -0.206606885f, -0.206214424f, -0.205815207f, -0.205409266f,
+    -0.204996632f, -0.204577336f, -0.204151409f, -0.203718882f,
+    -0.203279788f, -0.202834158f, -0.202382024f, -0.201923418f,
+    -0.201458372f, -0.200986919f, -0.20050909f, -0.200024918f,
+    -0.199534436f, -0.199037676f, -0.198534672f, -0.198025456f,
+    -0.197510062f, -0.196988522f, -0.19646087f, -0.195927139f,
+    -0.195387363f, -0.194841576f, -0.194289811f, -0.193732102f,
+    -0.193168483f, -0.192598989f, -0.192023653f, -0.191442509f,
+    -0.190855593f, -0.190262938f, -0.189664579f, -0.189060552f,
+    -0.18845089f, -0.187835628f, -0.187214803f, -0.186588447f,
+    -0.185956598f, -0.18531929f, -0.184676558f, -0.184028439f,
+    -0.183374967f, -0.182716178f, -0.182052108f, -0.181382792f,
+    -0.180708267f, -0.180028569f, -0.179343733f, -0.178653797f,
+    -0.177958795f, -0.177258764f, -0.176553741f, -0.175843763f,
+    -0.175128865f, -0.174409084f, -0.173684458f, -0.172955022f,
+    -0.172220814f, -0.17148187f, -0.170738227f, -0.169989924f,
+    -0.169236995f, -0.16847948f, -0.167717415f, -0.166950836f,
+    -0.166179783f, -0.165404291f, -0.1646244f, -0.163840145f,
+    -0.163051565f, -0.162258697f, -0.161461579f, -0.160660249f,
+    -0.159854745f, -0.159045104f, -0.158231365f, -0.157413565f,
+    -0.156591742f, -0.155765935f, -0.154936181f, -0.154102519f,
+    -0.153264987f, -0.152423622f, -0.151578464f, -0.150729551f,
+    -0.149876921f, -0.149020612f, -0.148160663f, -0.147297113f,
+    -0.146429999f, -0.14555936f, -0.144685236f, -0.143807663f,
+    -0.142926682f, -0.142042331f, -0.141154648f, -0.140263671f,
+    -0.139369441f, -0.138471995f, -0.137571373f, -0.136667612f,
+    -0.135760753f, -0.134850833f, -0.133937892f, -0.133021968f,
+    -0.1321031f, -0.131181328f, -0.130256689f, -0.129329224f,
+    -0.12839897f, -0.127465967f, -0.126530254f, -0.12559187f,
+    -0.124650853f, -0.123707243f, -0.122761078f, -0.121812398f,
+    -0.120861241f, -0.119907647f, -0.118951654f, -0.117993302f,
+    -0.117032628f, -0.116069673f, -0.115104475f, -0.114137073f,
+    -0.113167506f, -0.112195813f, -0.111222033f, -0.110246205f,
+    -0.109268367f, -0.108288559f, -0.107306819f, -0.106323186f,
+    -0.105337699f, -0.104350397f, -0.103361318f, -0.102370502f,
+    -0.101377987f, -0.100383811f, -0.0993880139f, -0.0983906339f,
+    -0.0973917096f, -0.0963912797f, -0.0953893826f, -0.0943860571f,
+    -0.0933813415f, -0.0923752744f, -0.0913678942f, -0.0903592393f,
+    -0.0893493482f, -0.0883382591f, -0.0873260105f, -0.0863126404f,
+    -0.0852981873f, -0.0842826892f, -0.0832661844f, -0.0822487109f,
+    -0.0812303067f, -0.08021101f, -0.0791908587f, -0.0781698906f,
+    -0.0771481437f, -0.0761256558f, -0.0751024647f, -0.074078608f,
+    -0.0730541235f, -0.0720290488f, -0.0710034214f, -0.0699772788f,
+    -0.0689506585f, -0.0679235979f, -0.0668961342f, -0.0658683049f,
+    -0.064840147f, -0.0638116978f, -0.0627829942f, -0.0617540734f,
+    -0.0607249722f, -0.0596957277f, -0.0586663765f, -0.0576369554f,
+    -0.0566075012f, -0.0555780504f, -0.0545486395f, -0.0535193051f,
+    -0.0524900836f, -0.0514610111f, -0.0504321241f, -0.0494034587f,
+    -0.0483750509f, -0.0473469367f, -0.0463191522f, -0.0452917331f,
+    -0.0442647152f, -0.0432381343f, -0.0422120258f, -0.0411864254f,
+    -0.0401613685f, -0.0391368904f, -0.0381130263f, -0.0370898116f,
+    -0.0360672811f, -0.03504547f, -0.0340244132f, -0.0330041454f,
+    -0.0319847013f, -0.0309661157f, -0.029948423f, -0.0289316576f,
+    -0.027915854f, -0.0269010463f, -0.0258872687f, -0.0248745552f,
+    -0.0238629397f, -0.0228524562f, -0.0218431384f, -0.0208350198f,
+    -0.0198281341f, -0.0188225146f, -0.0178181947f, -0.0168152076f,
+    -0.0158135864f, -0.0148133642f, -0.0138145737f, -0.0128172478f,
+    -0.0118214192f, -0.0108271204f, -0.00983438382f, -0.00884324189f,
+    -0.00785372678f, -0.0068658706f, -0.00587970535f, -0.0048952629f,
+    -0.00391257501f, -0.00293167331f, -0.00195258933f, -0.000975354467f,
+    -3.88955518e-17f, 0.000973442911f, 0.00194494323f, 0.00291447004f,
+    0.00388199256f, 0.00484748011f, 0.00581090216f, 0.00677222829f,
+    0.00773142822f, 0.00868847178f, 0.00964332895f, 0.0105959698f,
+    0.0115463646f, 0.0124944837f, 0.0134402975f, 0.0143837768f,
+    0.0153248922f, 0.0162636146f, 0.0171999151f, 0.0181337648f,
+    0.019065135f, 0.0199939971f, 0.0209203227f, 0.0218440835f,
+    0.0227652513f, 0.0236837981f, 0.0245996961f, 0.0255129174f,
+    0.0264234346f, 0.0273312201f, 0.0282362465f, 0.0291384869f,
+    0.030037914f, 0.030934501f, 0.0318282212f, 0.032719048f,
+    0.033606955f, 0.0344919158f, 0.0353739042f, 0.0362528943f,
+    0.0371288602f, 0.0380017763f, 0.0388716168f, 0.0397383565f,
+    0.04060197f, 0.0414624323f, 0.0423197184f, 0.0431738035f,
+    0.044024663f, 0.0448722723f, 0.0457166071f, 0.0465576432f,
+    0.0473953566f, 0.0482297234f, 0.0490607199f, 0.0498883225f,
+    0.0507125079f, 0.0515332526f, 0.0523505338f, 0.0531643284f,
+    0.0539746137f, 0.0547813671f, 0.055584566f, 0.0563841883f,
+    0.0571802117f, 0.0579726144f, 0.0587613745f, 0.0595464703f,
+    0.0603278804f, 0.0611055835f, 0.0618795584f, 0.0626497842f,
+    0.0634162399f, 0.064178905f, 0.0649377589f, 0.0656927813f,
+    0.0664439521f, 0.0671912513f, 0.067934659f, 0.0686741556f,
+    0.0694097215f, 0.0701413376f, 0.0708689845f, 0.0715926434f,
+    0.0723122954f, 0.0730279218f, 0.0737395042f, 0.0744470244f,
+    0.075150464f, 0.0758498053f, 0.0765450303f, 0.0772361215f,
+    0.0779230615f, 0.0786058329f, 0.0792844186f, 0.0799588018f,
+    0.0806289656f, 0.0812948935f, 0.081956569f, 0.082613976f,
+    0.0832670983f, 0.0839159202f, 0.0845604258f, 0.0852005996f,
+    0.0858364263f, 0.0864678907f, 0.0870949778f, 0.0877176728f,
+    0.0883359609f, 0.0889498277f, 0.0895592589f, 0.0901642404f,
+    0.0907647582f, 0.0913607986f, 0.0919523479f, 0.0925393928f,
+    0.0931219199f, 0.0936999163f, 0.094273369f, 0.0948422654f,
+    0.0954065929f, 0.0959663391f, 0.096521492f, 0.0970720394f,
+    0.0976179697f, 0.0981592711f, 0.0986959322f, 0.0992279417f,
+    0.0997552885f, 0.100277962f, 0.100795951f, 0.101309245f,
+    0.101817834f, 0.102321707f, 0.102820855f, 0.103315267f,
+    0.103804935f, 0.104289848f, 0.104769997f, 0.105245374f,
+    0.105715969f, 0.106181773f, 0.106642778f, 0.107098975f,
+    0.107550357f, 0.107996915f, 0.108438641f, 0.108875528f,
+    0.109307568f, 0.109734754f, 0.110157079f, 0.110574535f,
+    0.110987116f, 0.111394816f, 0.111797628f, 0.112195545f,
+    0.112588563f, 0.112976674f, 0.113359873f, 0.113738154f,
+    0.114111513f, 0.114479944f, 0.114843442f, 0.115202003f,
+    0.115555621f, 0.115904292f, 0.116248013f, 0.116586778f,
+    0.116920584f, 0.117249428f, 0.117573305f, 0.117892213f,
+    0.118206147f, 0.118515106f, 0.118819086f, 0.119118085f,
+    0.1194121f, 0.119701129f, 0.11998517f, 0.12026422f,
+    0.120538278f, 0.120807343f, 0.121071413f, 0.121330486f,
+    0.121584562f, 0.12183364f, 0.122077719f, 0.122316799f,
+    0.122550878f, 0.122779958f, 0.123004037f, 0.123223117f,
+    0.123437197f, 0.123646278f, 0.12385036f, 0.124049445f,
+    0.124243534f, 0.124432627f, 0.124616726f, 0.124795833f,
+    0.124969949f, 0.125139076f, 0.125303216f, 0.125462372f,
+    0.125616546f, 0.12576574f, 0.125909957f, 0.1260492f,
+    0.126183472f, 0.126312777f, 0.126437117f, 0.126556497f,
+    0.12667092f, 0.126780389f, 0.12688491f, 0.126984486f,
+    0.127079122f, 0.127168822f, 0.127253591f, 0.127333435f,
+    0.127408357f, 0.127478363f, 0.127543459f, 0.127603651f,
+    0.127658943f, 0.127709342f, 0.127754854f, 0.127795485f,
+    0.127831242f, 0.12786213f, 0.127888158f, 0.127909331f,
+    0.127925656f, 0.127937141f, 0.127943794f, 0.127945621f,
+    0.12794263f, 0.127934829f, 0.127922226f, 0.127904829f,
+    0.127882647f, 0.127855687f, 0.127823959f, 0.127787471f,
+    0.127746232f, 0.127700251f, 0.127649537f, 0.1275941f,
+    0.127533949f, 0.127469093f, 0.127399544f, 0.127325309f,
+    0.127246401f, 0.127162828f, 0.127074601f, 0.126981731f,
+    0.126884229f, 0.126782105f, 0.12667537f, 0.126564036f,
+    0.126448113f, 0.126327613f, 0.126202548f, 0.12607293f,
+    0.12593877f, 0.125800079f, 0.125656872f, 0.125509158f,
+    0.125356952f, 0.125200266f, 0.125039111f, 0.124873502f,
+    0.12470345f, 0.12452897f, 0.124350074f, 0.124166776f,
+    0.123979089f, 0.123787028f, 0.123590604f, 0.123389833f,
+    0.123184729f, 0.122975306f, 0.122761578f, 0.122543559f,
+    0.122321264f, 0.122094708f, 0.121863906f, 0.121628872f,
+    0.121389622f, 0.12114617f, 0.120898533f, 0.120646725f,
+    0.120390762f, 0.120130661f, 0.119866435f, 0.119598103f,
+    0.119325679f, 0.11904918f, 0.118768622f, 0.118484022f,
+    0.118195396f, 0.11790276f, 0.117606132f, 0.117305529f,
+    0.117000967f, 0.116692464f, 0.116380036f, 0.116063702f,
+    0.115743478f, 0.115419383f, 0.115091433f, 0.114759647f,
+    0.114424043f, 0.114084638f, 0.113741451f, 0.1133945f,
+    0.113043803f, 0.112689379f, 0.112331246f, 0.111969423f,
+    0.111603929f, 0.111234782f, 0.110862002f, 0.110485607f,
+    0.110105618f, 0.109722052f, 0.109334929f, 0.108944269f,
+    0.108550092f, 0.108152416f, 0.107751263f, 0.10734665f,
+    0.1069386f, 0.106527131f, 0.106112263f, 0.105694017f,
+    0.105272414f, 0.104847473f, 0.104419215f, 0.103987661f,
+    0.103552831f, 0.103114745f, 0.102673426f, 0.102228893f,
+    0.101781169f, 0.101330272f, 0.100876226f, 0.100419051f,
+    0.0999587688f, 0.0994954002f, 0.099028967f, 0.0985594908f,
+    0.0980869931f, 0.0976114958f, 0.0971330205f, 0.0966515892f,
+    0.0961672238f, 0.0956799462f, 0.0951897787f, 0.0946967432f,
+    0.0942008622f, 0.0937021577f, 0.0932006523f, 0.0926963683f,
+    0.0921893282f, 0.0916795546f, 0.0911670702f, 0.0906518976f,
+    0.0901340595f, 0.0896135788f, 0.0890904784f, 0.0885647812f,
+    0.0880365102f, 0.0875056885f, 0.0869723391f, 0.0864364853f,
+    0.0858981504f, 0.0853573575f, 0.08481413f, 0.0842684914f,
+    0.083720465f, 0.0831700744f, 0.0826173431f, 0.0820622948f,
+    0.0815049531f, 0.0809453416f, 0.0803834842f, 0.0798194046f,
+    0.0792531267f, 0.0786846744f, 0.0781140716f, 0.0775413422f,
+    0.0769665103f, 0.0763896f, 0.0758106353f, 0.0752296404f,
+    0.0746466395f, 0.0740616568f, 0.0734747165f, 0.0728858429f,
+    0.0722950604f, 0.0717023933f, 0.071107866f, 0.0705115029f,
+    0.0699133285f, 0.0693133673f, 0.0687116438f, 0.0681081826f,
+    0.0675030082f, 0.0668961452f, 0.0662876182f, 0.065677452f,
+    0.0650656711f, 0.0644523004f, 0.0638373645f, 0.0632208881f,
+    0.0626028961f, 0.0619834132f, 0.0613624643f, 0.0607400742f,
+    0.0601162676f, 0.0594910696f, 0.0588645049f, 0.0582365984f,
+    0.0576073752f, 0.05697686f, 0.0563450778f, 0.0557120535f,
+    0.0550778122f, 0.0544423788f, 0.0538057782f, 0.0531680355f,
+    0.0525291756f, 0.0518892235f, 0.0512482042f, 0.0506061427f,
+    0.0499630641f, 0.0493189933f, 0.0486739554f, 0.0480279753f,
+    0.0473810781f, 0.0467332888f, 0.0460846324f, 0.0454351339f,
+    0.0447848184f, 0.0441337107f, 0.043481836f, 0.0428292191f,
+    0.0421758852f, 0.0415218591f, 0.0408671658f, 0.0402118303f,
+    0.0395558775f, 0.0388993324f, 0.0382422199f, 0.0375845648f,
+    0.0369263922f, 0.0362677268f, 0.0356085936f, 0.0349490173f,
+    0.0342890229f, 0.0336286351f, 0.0329678787f, 0.0323067786f,
+    0.0316453594f, 0.0309836459f, 0.0303216628f, 0.0296594348f,
+    0.0289969866f, 0.0283343428f, 0.027671528f, 0.0270085668f,
+    0.0263454838f, 0.0256823035f, 0.0250190504f, 0.024355749f,
+    0.0236924237f, 0.0230290989f, 0.0223657991f, 0.0217025486f,
+    0.0210393716f, 0.0203762925f, 0.0197133356f, 0.0190505249f,
+    0.0183878848f, 0.0177254392f, 0.0170632124f, 0.0164012284f,
+    0.0157395112f, 0.0150780848f, 0.014416973f, 0.0137561999f,
+    0.0130957892f, 0.0124357648f, 0.0117761503f, 0.0111169696f,
+    0.0104582463f, 0.00980000405f, 0.00914226634f, 0.00848505675f,
+    0.00782839873f, 0.00717231573f, 0.0065168311f, 0.00586196818f,
+    0.00520775023f, 0.00455420046f, 0.00390134205f, 0.0032491981f,
+    0.00259779165f, 0.00194714571f, 0.00129728321f, 0.000648227029f,
+    3.87879117e-17f, -0.000647375119f, -0.00129387562f, -0.00193947887f,
+    -0.00258416228f, -0.00322790333f, -0.00387067956f, -0.00451246858f,
+    -0.00515324807f, -0.00579299575f, -0.00643168942f, -0.00706930696f,
+    -0.00770582629f, -0.00834122543f, -0.00897548243f, -0.00960857544f,
+    -0.0102404827f, -0.0108711824f, -0.011500653f, -0.0121288728f,
+    -0.0127558204f, -0.0133814743f, -0.0140058132f, -0.0146288158f,
+    -0.0152504608f, -0.0158707272f, -0.0164895939f, -0.0171070398f,
+    -0.0177230442f, -0.0183375862f, -0.0189506449f, -0.0195621999f,
+    -0.0201722304f, -0.020780716f, -0.0213876362f, -0.0219929707f,
+    -0.0225966993f, -0.0231988018f, -0.023799258f, -0.024398048f,
+    -0.0249951518f, -0.0255905497f, -0.0261842218f, -0.0267761486f,
+    -0.0273663103f, -0.0279546876f, -0.028541261f, -0.0291260113f,
+    -0.0297089191f, -0.0302899654f, -0.0308691312f, -0.0314463975f,
+    -0.0320217453f, -0.0325951561f, -0.0331666111f, -0.0337360917f,
+    -0.0343035794f, -0.0348690559f, -0.0354325029f, -0.0359939021f,
+    -0.0365532355f, -0.0371104851f, -0.037665633f, -0.0382186613f,
+    -0.0387695523f, -0.0393182885f, -0.0398648524f, -0.0404092264f,
+    -0.0409513934f, -0.0414913361f, -0.0420290374f, -0.0425644802f,
+    -0.0430976478f, -0.0436285232f, -0.0441570899f, -0.0446833311f,
+    -0.0452072305f, -0.0457287715f, -0.0462479381f, -0.0467647139f,
+    -0.0472790829f, -0.0477910292f, -0.0483005369f, -0.0488075902f,
+    -0.0493121735f, -0.0498142714f, -0.0503138683f, -0.0508109489f,
+    -0.0513054981f, -0.0517975008f, -0.0522869419f, -0.0527738067f,
+    -0.0532580803f, -0.0537397481f, -0.0542187955f, -0.0546952082f,
+    -0.0551689718f, -0.0556400722f, -0.0561084952f, -0.0565742269f,
+    -0.0570372534f, -0.0574975609f, -0.0579551359f, -0.0584099649f,
+    -0.0588620344f, -0.0593113311f, -0.0597578419f, -0.0602015538f,
+    -0.0606424538f, -0.0610805291f, -0.061515767f, -0.0619481549f,
+    -0.0623776804f, -0.0628043311f, -0.0632280949f, -0.0636489595f,
+    -0.064066913f, -0.0644819436f, -0.0648940395f, -0.065303189f,
+    -0.0657093808f, -0.0661126033f, -0.0665128453f, -0.0669100958f,
+    -0.0673043436f, -0.0676955779f, -0.0680837878f, -0.0684689629f,
+    -0.0688510924f, -0.069230166f, -0.0696061735f, -0.0699791046f,
+    -0.0703489493f, -0.0707156977f, -0.07107934f, -0.0714398666f,
+    -0.0717972679f, -0.0721515345f, -0.072502657f, -0.0728506264f,
+    -0.0731954335f, -0.0735370695f, -0.0738755256f, -0.0742107931f,
+    -0.0745428634f, -0.0748717281f, -0.075197379f, -0.0755198079f,
+    -0.0758390068f, -0.0761549676f, -0.0764676828f, -0.0767771445f,
+    -0.0770833453f, -0.0773862777f, -0.0776859346f, -0.0779823086f,
+    -0.0782753929f, -0.0785651805f, -0.0788516646f, -0.0791348387f,
+    -0.0794146961f, -0.0796912305f, -0.0799644358f, -0.0802343056f,
+    -0.0805008341f, -0.0807640153f, -0.0810238435f, -0.0812803131f,
+    -0.0815334187f, -0.0817831548f, -0.0820295162f, -0.0822724978f,
+    -0.0825120947f, -0.082748302f, -0.0829811149f, -0.083210529f,
+    -0.0834365397f, -0.0836591427f, -0.0838783338f, -0.0840941089f,
+    -0.0843064641f, -0.0845153956f, -0.0847208996f, -0.0849229727f,
+    -0.0851216114f, -0.0853168123f, -0.0855085724f, -0.0856968886f,
+    -0.0858817579f, -0.0860631775f, -0.0862411449f, -0.0864156575f,
+    -0.0865867128f, -0.0867543086f, -0.0869184428f, -0.0870791133f,
+    -0.0872363182f, -0.0873900559f, -0.0875403245f, -0.0876871227f,
+    -0.0878304491f, -0.0879703024f, -0.0881066815f, -0.0882395853f,
+    -0.0883690131f, -0.0884949641f, -0.0886174376f, -0.0887364332f,
+    -0.0888519505f, -0.0889639893f, -0.0890725494f, -0.089177631f,
+    -0.0892792341f, -0.089377359f, -0.0894720061f, -0.0895631759f,
+    -0.0896508691f, -0.0897350865f, -0.0898158289f, -0.0898930974f,
+    -0.0899668931f, -0.0900372174f, -0.0901040715f, -0.0901674571f,
+    -0.0902273757f, -0.0902838292f, -0.0903368194f, -0.0903863484f,
+    -0.0904324184f, -0.0904750315f, -0.0905141901f, -0.0905498969f,
+    -0.0905821544f, -0.0906109653f, -0.0906363326f, -0.0906582593f,
+    -0.0906767484f, -0.0906918033f, -0.0907034273f, -0.0907116239f,
+    -0.0907163967f, -0.0907177494f, -0.0907156858f, -0.09071021f,
+    -0.0907013261f, -0.0906890382f, -0.0906733506f, -0.0906542679f,
+    -0.0906317946f, -0.0906059353f, -0.0905766949f, -0.0905440782f,
+    -0.0905080904f, -0.0904687366f, -0.090426022f, -0.090379952f,
+    -0.0903305322f, -0.0902777681f, -0.0902216655f, -0.0901622302f,
+    -0.0900994682f, -0.0900333856f, -0.0899639886f, -0.0898912834f,
+    -0.0898152766f, -0.0897359745f, -0.0896533839f, -0.0895675116f,
+    -0.0894783643f, -0.0893859492f, -0.0892902731f, -0.0891913435f,
+    -0.0890891676f, -0.0889837527f, -0.0888751066f, -0.0887632367f,
+    -0.0886481508f, -0.0885298568f, -0.0884083628f, -0.0882836766f,
+    -0.0881558066f, -0.088024761f, -0.0878905483f, -0.0877531768f,
+    -0.0876126553f, -0.0874689925f, -0.0873221971f, -0.0871722781f,
+    -0.0870192445f, -0.0868631055f, -0.0867038702f, -0.0865415481f,
+    -0.0863761486f, -0.0862076812f, -0.0860361555f, -0.0858615813f,
+    -0.0856839684f, -0.0855033269f, -0.0853196666f, -0.0851329978f,
+    -0.0849433308f, -0.0847506758f, -0.0845550433f, -0.0843564438f,
+    -0.084154888f, -0.0839503866f, -0.0837429503f, -0.0835325902f,
+    -0.0833193173f, -0.0831031426f, -0.0828840773f, -0.0826621328f,
+    -0.0824373205f, -0.0822096517f, -0.0819791382f, -0.0817457915f,
+    -0.0815096234f, -0.0812706458f, -0.0810288705f, -0.0807843097f,
+    -0.0805369753f, -0.0802868797f, -0.0800340351f, -0.0797784539f,
+    -0.0795201485f, -0.0792591315f, -0.0789954156f, -0.0787290133f,
+    -0.0784599376f, -0.0781882014f, -0.0779138175f, -0.0776367991f,
+    -0.0773571593f, -0.0770749113f, -0.0767900683f, -0.0765026439f,
+    -0.0762126513f, -0.0759201043f, -0.0756250163f, -0.0753274011f,
+    -0.0750272724f, -0.0747246441f, -0.0744195302f, -0.0741119445f,
+    -0.0738019013f, -0.0734894146f, -0.0731744987f, -0.0728571678f,
+    -0.0725374364f, -0.0722153189f, -0.0718908297f, -0.0715639836f,
+    -0.0712347951f, -0.0709032789f, -0.07056945f, -0.070233323f,
+    -0.069894913f, -0.069554235f, -0.0692113041f, -0.0688661353f,
+    -0.0685187439f, -0.0681691451f, -0.0678173543f, -0.0674633868f,
+    -0.0671072582f, -0.0667489839f, -0.0663885795f, -0.0660260607f,
+    -0.0656614432f, -0.0652947427f, -0.0649259751f, -0.0645551562f,
+    -0.064182302f, -0.0638074285f, -0.0634305517f, -0.0630516878f,
+    -0.0626708529f, -0.0622880632f, -0.061903335f, -0.0615166848f,
+    -0.0611281287f, -0.0607376833f, -0.0603453651f, -0.0599511906f,
+    -0.0595551764f, -0.0591573392f, -0.0587576955f, -0.0583562622f,
+    -0.0579530561f, -0.057548094f, -0.0571413927f, -0.0567329693f,
+    -0.0563228406f, -0.0559110237f, -0.0554975356f, -0.0550823935f,
+    -0.0546656146f, -0.0542472158f, -0.0538272147f, -0.0534056283f,
+    -0.052982474f, -0.0525577692f, -0.0521315312f, -0.0517037775f,
+    -0.0512745255f, -0.0508437928f, -0.0504115968f, -0.0499779553f,
+    -0.0495428856f, -0.0491064056f, -0.0486685329f, -0.0482292852f,
+    -0.0477886802f, -0.0473467357f, -0.0469034695f, -0.0464588995f,
+    -0.0460130434f, -0.0455659193f, -0.045117545f, -0.0446679384f,
+    -0.0442171176f, -0.0437651005f, -0.0433119052f, -0.0428575497f,
+    -0.0424020521f, -0.0419454304f, -0.0414877029f, -0.0410288876f,
+    -0.0405690027f, -0.0401080664f, -0.0396460969f, -0.0391831124f,
+    -0.0387191312f, -0.0382541715f, -0.0377882515f, -0.0373213897f,
+    -0.0368536043f, -0.0363849135f, -0.0359153359f, -0.0354448896f,
+    -0.0349735931f, -0.0345014648f, -0.034028523f, -0.0335547862f,
+    -0.0330802727f, -0.032605001f, -0.0321289895f, -0.0316522566f,
+    -0.0311748209f, -0.0306967007f, -0.0302179145f, -0.0297384807f,
+    -0.0292584179f, -0.0287777446f, -0.0282964791f, -0.02781464f,
+    -0.0273322458f, -0.0268493149f, -0.0263658659f, -0.0258819172f,
+    -0.0253974873f, -0.0249125947f, -0.0244272579f, -0.0239414953f,
+    -0.0234553256f, -0.022968767f, -0.0224818381f, -0.0219945574f,
+    -0.0215069433f, -0.0210190143f, -0.0205307889f, -0.0200422854f,
+    -0.0195535222f, -0.019064518f, -0.0185752909f, -0.0180858595f,
+    -0.0175962421f, -0.0171064571f, -0.016616523f, -0.0161264579f,
+    -0.0156362803f, -0.0151460086f, -0.0146556609f, -0.0141652557f,
+    -0.0136748112f, -0.0131843457f, -0.0126938773f, -0.0122034245f,
+    -0.0117130052f, -0.0112226379f, -0.0107323405f, -0.0102421313f,
+    -0.00975202843f, -0.00926204996f, -0.00877221398f, -0.00828253857f,
+    -0.00779304175f, -0.00730374154f, -0.00681465594f, -0.0063258029f,
+    -0.00583720037f, -0.00534886625f, -0.00486081843f, -0.00437307476f,
+    -0.00388565307f, -0.00339857116f, -0.00291184679f, -0.0024254977f,
+    -0.00193954159f, -0.00145399615f, -0.000968878999f, -0.000484207759f,
+    -3.8637545e-17f, 0.000483726737f, 0.000966954948f, 0.00144966716f,
+    0.00193184595f, 0.00241347391f, 0.00289453368f, 0.00337500794f,
+    0.00385487941f, 0.00433413085f, 0.00481274504f, 0.00529070483f,
+    0.00576799309f, 0.00624459274f, 0.00672048673f, 0.00719565808f,
+    0.00767008982f, 0.00814376504f, 0.00861666688f, 0.00908877851f,
+    0.00956008316f, 0.0100305641f, 0.0105002046f, 0.0109689881f,
+    0.011436898f, 0.0119039177f, 0.0123700308f, 0.0128352207f,
+    0.0132994712f, 0.0137627658f, 0.0142250883f, 0.0146864224f,
+    0.0151467519f, 0.0156060608f, 0.0160643329f, 0.0165215521f,
+    0.0169777026f, 0.0174327684f, 0.0178867336f, 0.0183395824f,
+    0.018791299f, 0.0192418679f, 0.0196912732f, 0.0201394996f,
+    0.0205865313f, 0.021032353f, 0.0214769492f, 0.0219203047f,
+    0.0223624041f, 0.0228032321f, 0.0232427738f, 0.0236810138f,
+    0.0241179372f, 0.0245535291f, 0.0249877744f, 0.0254206585f,
+    0.0258521663f, 0.0262822834f, 0.0267109949f, 0.0271382864f,
+    0.0275641432f, 0.0279885509f, 0.0284114952f, 0.0288329617f,
+    0.0292529362f, 0.0296714045f, 0.0300883524f, 0.0305037659f,
+    0.030917631f, 0.0313299339f, 0.0317406607f, 0.0321497976f,
+    0.0325573309f, 0.032963247f, 0.0333675324f, 0.0337701736f,
+    0.0341711572f, 0.0345704698f, 0.0349680982f, 0.0353640292f,
+    0.0357582497f, 0.0361507467f, 0.0365415072f, 0.0369305183f,
+    0.0373177673f, 0.0377032413f, 0.0380869279f, 0.0384688143f,
+    0.0388488881f, 0.0392271369f, 0.0396035484f, 0.0399781102f,
+    0.0403508103f, 0.0407216364f, 0.0410905767f, 0.0414576191f,
+    0.0418227518f, 0.0421859631f, 0.0425472412f, 0.0429065745f,
+    0.0432639515f, 0.0436193608f, 0.043972791f, 0.0443242308f,
+    0.044673669f, 0.0450210945f, 0.0453664964f, 0.0457098635f,
+    0.0460511852f, 0.0463904506f, 0.046727649f, 0.0470627698f,
+    0.0473958026f, 0.0477267369f, 0.0480555623f, 0.0483822687f,
+    0.0487068457f, 0.0490292835f, 0.0493495719f, 0.0496677011f,
+    0.0499836613f, 0.0502974427f, 0.0506090358f, 0.0509184309f,
+    0.0512256186f, 0.0515305896f, 0.0518333345f, 0.0521338443f,
+    0.0524321097f, 0.0527281219f, 0.0530218718f, 0.0533133508f,
+    0.0536025499f, 0.0538894607f, 0.0541740746f, 0.0544563831f,
+    0.0547363778f, 0.0550140506f, 0.0552893932f, 0.0555623975f,
+    0.0558330556f, 0.0561013596f, 0.0563673016f, 0.0566308741f,
+    0.0568920693f, 0.0571508798f, 0.0574072981f, 0.0576613169f,
+    0.057912929f, 0.0581621272f, 0.0584089046f, 0.0586532542f,
+    0.058895169f, 0.0591346425f, 0.0593716678f, 0.0596062385f,
+    0.0598383482f, 0.0600679903f, 0.0602951587f, 0.0605198472f,
+    0.0607420498f, 0.0609617603f, 0.0611789731f, 0.0613936822f,
+    0.061605882f, 0.0618155669f, 0.0620227314f, 0.0622273701f,
+    0.0624294778f, 0.0626290492f, 0.0628260792f, 0.0630205628f,
+    0.0632124952f, 0.0634018715f, 0.063588687f, 0.0637729372f,
+    0.0639546174f, 0.0641337234f, 0.0643102507f, 0.0644841952f,
+    0.0646555528f, 0.0648243195f, 0.0649904912f, 0.0651540644f,
+    0.0653150351f, 0.0654733998f, 0.065629155f, 0.0657822972f,
+    0.0659328232f, 0.0660807298f, 0.0662260137f, 0.066368672f,
+    0.0665087018f, 0.0666461002f, 0.0667808646f, 0.0669129923f,
+    0.0670424807f, 0.0671693275f, 0.0672935303f, 0.067415087f,
+    0.0675339953f, 0.0676502533f, 0.0677638591f, 0.0678748107f,
+    0.0679831066f, 0.068088745f, 0.0681917244f, 0.0682920435f,
+    0.0683897008f, 0.0684846952f, 0.0685770255f, 0.0686666907f,
+    0.0687536899f, 0.0688380222f, 0.0689196869f, 0.0689986833f,
+    0.069075011f, 0.0691486694f, 0.0692196584f, 0.0692879775f,
+    0.0693536267f, 0.0694166059f, 0.0694769153f, 0.0695345548f,
+    0.0695895249f, 0.0696418259f, 0.0696914581f, 0.0697384222f,
+    0.0697827188f, 0.0698243486f, 0.0698633125f, 0.0698996114f,
+    0.0699332464f, 0.0699642186f, 0.0699925292f, 0.0700181796f,
+    0.0700411712f, 0.0700615054f, 0.070079184f, 0.0700942086f,
+    0.070106581f, 0.0701163033f, 0.0701233772f, 0.0701278051f,
+    0.0701295889f, 0.0701287312f, 0.0701252341f, 0.0701191003f,
+    0.0701103323f, 0.0700989328f, 0.0700849044f, 0.0700682502f,
+    0.070048973f, 0.0700270759f, 0.0700025621f, 0.0699754347f,
+    0.0699456972f, 0.0699133529f, 0.0698784053f, 0.0698408582f,
+    0.069800715f, 0.0697579798f, 0.0697126563f, 0.0696647485f,
+    0.0696142606f, 0.0695611966f, 0.0695055609f, 0.0694473577f,
+    0.0693865915f, 0.0693232669f, 0.0692573884f, 0.0691889609f,
+    0.0691179889f, 0.0690444776f, 0.0689684317f, 0.0688898565f,
+    0.068808757f, 0.0687251386f, 0.0686390065f, 0.0685503661f,
+    0.068459223f, 0.0683655828f, 0.0682694511f, 0.0681708338f,
+    0.0680697366f, 0.0679661655f, 0.0678601267f, 0.0677516261f,
+    0.0676406699f, 0.0675272646f, 0.0674114163f, 0.0672931317f,
+    0.0671724172f, 0.0670492795f, 0.0669237252f, 0.0667957612f,
+    0.0666653944f, 0.0665326316f, 0.06639748f, 0.0662599467f,
+    0.0661200388f, 0.0659777637f, 0.0658331287f, 0.0656861413f,
+    0.065536809f, 0.0653851394f, 0.0652311402f, 0.0650748192f,
+    0.0649161842f, 0.0647552431f, 0.064592004f, 0.0644264749f,
+    0.064258664f, 0.0640885795f, 0.0639162298f, 0.0637416232f,
+    0.0635647683f, 0.0633856734f, 0.0632043473f, 0.0630207987f,
+    0.0628350363f, 0.062647069f, 0.0624569056f, 0.0622645552f,
+    0.0620700269f, 0.0618733297f, 0.0616744729f, 0.0614734658f,
+    0.0612703177f, 0.061065038f, 0.0608576362f, 0.0606481219f,
+    0.0604365048f, 0.0602227944f, 0.0600070007f, 0.0597891334f,
+    0.0595692024f, 0.0593472178f, 0.0591231895f, 0.0588971277f,
+    0.0586690426f, 0.0584389443f, 0.0582068433f, 0.0579727498f,
+    0.0577366744f, 0.0574986275f, 0.0572586197f, 0.0570166616f,
+    0.0567727639f, 0.0565269374f, 0.0562791929f, 0.0560295413f,
+    0.0557779935f, 0.0555245605f, 0.0552692534f, 0.0550120833f,
+    0.0547530613f, 0.0544921989f, 0.0542295071f, 0.0539649975f,
+    0.0536986813f, 0.0534305702f, 0.0531606755f, 0.0528890089f,
+    0.0526155821f, 0.0523404067f, 0.0520634945f, 0.0517848573f,
+    0.0515045069f, 0.0512224554f, 0.0509387145f, 0.0506532964f,
+    0.0503662131f, 0.0500774768f, 0.0497870995f, 0.0494950936f,
+    0.0492014714f, 0.048906245f, 0.048609427f, 0.0483110297f,
+    0.0480110656f, 0.0477095472f, 0.0474064871f, 0.0471018979f,
+    0.0467957922f, 0.0464881828f, 0.0461790823f, 0.0458685036f,
+    0.0455564596f, 0.045242963f, 0.0449280269f, 0.0446116641f,
+    0.0442938877f, 0.0439747107f, 0.0436541463f, 0.0433322074f,
+    0.0430089074f, 0.0426842595f, 0.0423582767f, 0.0420309726f,
+    0.0417023603f, 0.0413724532f, 0.0410412648f, 0.0407088084f,
+    0.0403750976f, 0.0400401458f, 0.0397039666f, 0.0393665735f,
+    0.0390279801f, 0.0386882002f, 0.0383472473f, 0.0380051352f,
+    0.0376618776f, 0.0373174883f, 0.0369719811f, 0.0366253697f,
+    0.0362776681f, 0.0359288901f, 0.0355790497f, 0.0352281608f,
+    0.0348762374f, 0.0345232934f, 0.0341693429f, 0.0338143999f,
+    0.0334584785f, 0.0331015929f, 0.032743757f, 0.0323849851f,
+    0.0320252914f, 0.03166469f, 0.0313031951f, 0.0309408211f,
+    0.030577582f, 0.0302134922f, 0.0298485661f, 0.0294828178f,
+    0.0291162619f, 0.0287489125f, 0.028380784f, 0.028011891f,
+    0.0276422477f, 0.0272718685f, 0.026900768f, 0.0265289605f,
+    0.0261564606f, 0.0257832826f, 0.0254094412f, 0.0250349507f,
+    0.0246598257f, 0.0242840808f, 0.0239077304f, 0.0235307892f,
+    0.0231532716f, 0.0227751923f, 0.0223965658f, 0.0220174067f,
+    0.0216377296f, 0.0212575491f, 0.0208768798f, 0.0204957364f,
+    0.0201141333f, 0.0197320854f, 0.0193496071f, 0.0189667132f,
+    0.0185834182f, 0.0181997368f, 0.0178156837f, 0.0174312735f,
+    0.0170465208f, 0.0166614402f, 0.0162760466f, 0.0158903543f,
+    0.0155043782f, 0.0151181329f, 0.0147316329f, 0.014344893f,
+    0.0139579278f, 0.0135707519f, 0.0131833799f, 0.0127958265f,
+    0.0124081063f, 0.0120202339f, 0.0116322238f, 0.0112440908f,
+    0.0108558494f, 0.0104675142f, 0.0100790998f, 0.00969062067f,
+    0.00930209146f, 0.00891352669f, 0.00852494092f, 0.00813634865f,
+    0.00774776442f, 0.00735920272f, 0.00697067806f, 0.00658220491f,
+    0.00619379773f, 0.00580547099f, 0.00541723911f, 0.00502911652f,
+    0.00464111763f, 0.00425325682f, 0.00386554848f, 0.00347800696f,
+    0.0030906466f, 0.00270348172f, 0.00231652663f, 0.0019297956f,
+    0.0015433029f, 0.00115706278f, 0.000771089462f, 0.000385397141f,
+    3.84448139e-17f, -0.000385087803f, -0.000769852132f, -0.00115427888f,
+    -0.00153835395f, -0.00192206328f, -0.00230539284f, -0.0026883286f,
+    -0.00307085659f, -0.00345296284f, -0.00383463341f, -0.0042158544f,
+    -0.00459661192f, -0.00497689213f, -0.0053566812f, -0.00573596533f,
+    -0.00611473077f, -0.00649296377f, -0.00687065063f, -0.00724777769f,
+    -0.00762433129f, -0.00800029783f, -0.00837566373f, -0.00875041545f,
+    -0.00912453947f, -0.00949802233f, -0.00987085058f, -0.0102430108f,
+    -0.0106144897f, -0.0109852738f, -0.0113553499f, -0.0117247047f,
+    -0.0120933249f, -0.0124611975f, -0.0128283093f, -0.013194647f,
+    -0.0135601978f, -0.0139249484f, -0.014288886f, -0.0146519976f,
+    -0.0150142702f, -0.0153756911f, -0.0157362473f, -0.0160959261f,
+    -0.0164547148f, -0.0168126006f, -0.0171695708f, -0.017525613f,
+    -0.0178807144f, -0.0182348626f, -0.0185880451f, -0.0189402495f,
+    -0.0192914633f, -0.0196416742f, -0.01999087f, -0.0203390383f,
+    -0.0206861671f, -0.0210322441f, -0.0213772571f, -0.0217211943f,
+    -0.0220640435f, -0.0224057929f, -0.0227464304f, -0.0230859443f,
+    -0.0234243228f, -0.023761554f, -0.0240976263f, -0.024432528f,
+    -0.0247662476f, -0.0250987735f, -0.0254300942f, -0.0257601983f,
+    -0.0260890744f, -0.0264167111f, -0.0267430972f, -0.0270682214f,
+    -0.0273920727f, -0.0277146399f, -0.0280359119f, -0.0283558777f,
+    -0.0286745265f, -0.0289918473f, -0.0293078293f, -0.0296224617f,
+    -0.0299357339f, -0.0302476351f, -0.0305581549f, -0.0308672826f,
+    -0.0311750078f, -0.0314813201f, -0.0317862092f, -0.0320896647f,
+    -0.0323916764f, -0.0326922342f, -0.0329913279f, -0.0332889476f,
+    -0.0335850832f, -0.0338797248f, -0.0341728626f, -0.0344644867f,
+    -0.0347545875f, -0.0350431553f, -0.0353301804f, -0.0356156535f,
+    -0.0358995649f, -0.0361819052f, -0.0364626653f, -0.0367418357f,
+    -0.0370194072f, -0.0372953708f, -0.0375697173f, -0.0378424378f,
+    -0.0381135233f, -0.0383829649f, -0.0386507539f, -0.0389168814f,
+    -0.0391813389f, -0.0394441177f, -0.0397052093f, -0.0399646052f,
+    -0.0402222971f, -0.0404782766f, -0.0407325354f, -0.0409850655f,
+    -0.0412358586f, -0.0414849068f, -0.0417322021f, -0.0419777365f,
+    -0.0422215022f, -0.0424634916f, -0.0427036968f, -0.0429421103f,
+    -0.0431787246f, -0.0434135322f, -0.0436465256f, -0.0438776977f,
+    -0.044107041f, -0.0443345485f, -0.044560213f, -0.0447840276f,
+    -0.0450059852f, -0.0452260789f, -0.0454443021f, -0.0456606479f,
+    -0.0458751097f, -0.0460876809f, -0.046298355f, -0.0465071256f,
+    -0.0467139863f, -0.0469189308f, -0.047121953f, -0.0473230467f,
+    -0.0475222058f, -0.0477194244f, -0.0479146966f, -0.0481080166f,
+    -0.0482993786f, -0.0484887769f, -0.048676206f, -0.0488616604f,
+    -0.0490451346f, -0.0492266232f, -0.049406121f, -0.0495836227f,
+    -0.0497591234f, -0.0499326178f, -0.050104101f, -0.0502735682f,
+    -0.0504410145f, -0.0506064352f, -0.0507698257f, -0.0509311814f,
+    -0.0510904977f, -0.0512477703f, -0.0514029948f, -0.0515561669f,
+    -0.0517072826f, -0.0518563376f, -0.052003328f, -0.0521482498f,
+    -0.0522910992f, -0.0524318724f, -0.0525705656f, -0.0527071753f,
+    -0.052841698f, -0.0529741301f, -0.0531044683f, -0.0532327092f,
+    -0.0533588498f, -0.0534828867f, -0.053604817f, -0.0537246377f,
+    -0.0538423459f, -0.0539579388f, -0.0540714136f, -0.0541827676f,
+    -0.0542919984f, -0.0543991034f, -0.0545040802f, -0.0546069264f,
+    -0.0547076398f, -0.0548062183f, -0.0549026598f, -0.0549969622f,
+    -0.0550891235f, -0.0551791421f, -0.0552670161f, -0.0553527437f,
+    -0.0554363235f, -0.0555177539f, -0.0555970334f, -0.0556741607f,
+    -0.0557491344f, -0.0558219535f, -0.0558926168f, -0.0559611232f,
+    -0.0560274718f, -0.0560916617f, -0.0561536922f, -0.0562135624f,
+    -0.0562712718f, -0.0563268198f, -0.056380206f, -0.0564314299f,
+    -0.0564804913f, -0.0565273898f, -0.0565721254f, -0.056614698f,
+    -0.0566551077f, -0.0566933544f, -0.0567294383f, -0.0567633598f,
+    -0.0567951191f, -0.0568247167f, -0.0568521531f, -0.0568774287f,
+    -0.0569005443f, -0.0569215007f, -0.0569402985f, -0.0569569388f,
+    -0.0569714225f, -0.0569837505f, -0.0569939242f, -0.0570019446f,
+    -0.057007813f, -0.0570115309f, -0.0570130996f, -0.0570125207f,
+    -0.0570097958f, -0.0570049266f, -0.0569979148f, -0.0569887623f,
+    -0.056977471f, -0.0569640428f, -0.0569484799f, -0.0569307844f,
+    -0.0569109585f, -0.0568890046f, -0.056864925f, -0.0568387222f,
+    -0.0568103986f, -0.056779957f, -0.0567474001f, -0.0567127305f,
+    -0.0566759511f, -0.0566370649f, -0.0565960749f, -0.056552984f,
+    -0.0565077955f, -0.0564605127f, -0.0564111387f, -0.056359677f,
+    -0.056306131f, -0.0562505042f, -0.0561928003f, -0.0561330229f,
+    -0.0560711757f, -0.0560072627f, -0.0559412876f, -0.0558732545f,
+    -0.0558031673f, -0.0557310303f, -0.0556568476f, -0.0555806235f,
+    -0.0555023623f, -0.0554220683f, -0.0553397462f, -0.0552554005f,
+    -0.0551690357f, -0.0550806565f, -0.0549902679f, -0.0548978745f,
+    -0.0548034813f, -0.0547070933f, -0.0546087155f, -0.054508353f,
+    -0.0544060111f, -0.054301695f, -0.0541954101f, -0.0540871617f,
+    -0.0539769553f, -0.0538647964f, -0.0537506907f, -0.0536346439f,
+    -0.0535166616f, -0.0533967497f, -0.0532749141f, -0.0531511607f,
+    -0.0530254956f, -0.0528979247f, -0.0527684544f, -0.0526370907f,
+    -0.0525038399f, -0.0523687085f, -0.0522317028f, -0.0520928292f,
+    -0.0519520944f, -0.051809505f, -0.0516650675f, -0.0515187888f,
+    -0.0513706756f, -0.0512207348f, -0.0510689733f, -0.0509153981f,
+    -0.0507600163f, -0.0506028349f, -0.0504438612f, -0.0502831023f,
+    -0.0501205657f, -0.0499562585f, -0.0497901883f, -0.0496223625f,
+    -0.0494527886f, -0.0492814743f, -0.0491084272f, -0.048933655f,
+    -0.0487571656f, -0.0485789666f, -0.0483990661f, -0.0482174719f,
+    -0.0480341921f, -0.0478492347f, -0.0476626079f, -0.0474743198f,
+    -0.0472843787f, -0.0470927928f, -0.0468995705f, -0.0467047202f,
+    -0.0465082503f, -0.0463101693f, -0.0461104859f, -0.0459092086f,
+    -0.045706346f, -0.0455019069f, -0.0452959001f, -0.0450883344f,
+    -0.0448792187f, -0.0446685619f, -0.0444563729f, -0.0442426609f,
+    -0.0440274348f, -0.0438107038f, -0.0435924772f, -0.043372764f,
+    -0.0431515736f, -0.0429289154f, -0.0427047986f, -0.0424792328f,
+    -0.0422522273f, -0.0420237917f, -0.0417939356f, -0.0415626685f,
+    -0.0413300001f, -0.0410959402f, -0.0408604984f, -0.0406236845f,
+    -0.0403855085f, -0.04014598f, -0.0399051092f, -0.0396629058f,
+    -0.03941938f, -0.0391745418f, -0.0389284013f, -0.0386809685f,
+    -0.0384322537f, -0.0381822672f, -0.037931019f, -0.0376785196f,
+    -0.0374247792f, -0.0371698082f, -0.0369136171f, -0.0366562163f,
+    -0.0363976162f, -0.0361378274f, -0.0358768604f, -0.0356147259f,
+    -0.0353514345f, -0.0350869968f, -0.0348214235f, -0.0345547254f,
+    -0.0342869133f, -0.0340179979f, -0.0337479901f, -0.0334769007f,
+    -0.0332047407f, -0.032931521f, -0.0326572526f, -0.0323819464f,
+    -0.0321056136f, -0.0318282651f, -0.031549912f, -0.0312705655f,
+    -0.0309902367f, -0.0307089369f, -0.0304266771f, -0.0301434687f,
+    -0.0298593228f, -0.0295742509f, -0.0292882642f, -0.029001374f,
+    -0.0287135917f, -0.0284249288f, -0.0281353966f, -0.0278450066f,
+    -0.0275537702f, -0.0272616989f, -0.0269688043f, -0.0266750979f,
+    -0.0263805912f, -0.0260852958f, -0.0257892234f, -0.0254923855f,
+    -0.0251947937f, -0.0248964599f, -0.0245973956f, -0.0242976125f,
+    -0.0239971223f, -0.0236959369f, -0.0233940679f, -0.0230915272f,
+    -0.0227883264f, -0.0224844775f, -0.0221799922f, -0.0218748824f,
+    -0.02156916f, -0.0212628368f, -0.0209559246f, -0.0206484355f,
+    -0.0203403812f, -0.0200317738f, -0.0197226251f, -0.0194129471f,
+    -0.0191027518f, -0.0187920511f, -0.018480857f, -0.0181691816f,
+    -0.0178570367f, -0.0175444344f, -0.0172313868f, -0.0169179058f,
+    -0.0166040036f, -0.016289692f, -0.0159749832f, -0.0156598893f,
+    -0.0153444223f, -0.0150285942f, -0.0147124172f, -0.0143959033f,
+    -0.0140790645f, -0.0137619131f, -0.013444461f, -0.0131267204f,
+    -0.0128087034f, -0.012490422f, -0.0121718883f, -0.0118531145f,
+    -0.0115341127f, -0.0112148949f, -0.0108954732f, -0.0105758598f,
+    -0.0102560667f, -0.0099361061f, -0.00961599002f, -0.00929573055f,
+    -0.00897533981f, -0.00865482987f, -0.00833421281f, -0.00801350072f,
+    -0.00769270566f, -0.0073718397f, -0.00705091491f, -0.00672994335f,
+    -0.00640893705f, -0.00608790808f, -0.00576686845f, -0.0054458302f,
+    -0.00512480536f, -0.00480380592f, -0.0044828439f, -0.00416193129f,
+    -0.00384108007f, -0.0035203022f, -0.00319960966f, -0.0028790144f,
+    -0.00255852834f, -0.00223816343f, -0.00191793157f, -0.00159784466f,
+    -0.00127791459f, -0.000958153242f, -0.000638572466f, -0.000319184108f,
+    -3.82101825e-17f, 0.000318968046f, 0.00063770823f, 0.000956208773f,
+    0.00127445791f, 0.00159244389f, 0.00191015498f, 0.00222757949f,
+    0.0025447057f, 0.00286152195f, 0.00317801658f, 0.00349417795f,
+    0.00380999446f, 0.00412545451f, 0.00444054653f, 0.00475525896f,
+    0.00506958027f, 0.00538349896f, 0.00569700354f, 0.00601008255f,
+    0.00632272456f, 0.00663491815f, 0.00694665192f, 0.00725791452f,
+    0.0075686946f, 0.00787898085f, 0.00818876198f, 0.00849802674f,
+    0.00880676387f, 0.00911496219f, 0.0094226105f, 0.00972969765f,
+    0.0100362125f, 0.010342144f, 0.0106474811f, 0.0109522126f,
+    0.0112563277f, 0.0115598154f, 0.0118626646f, 0.0121648645f,
+    0.0124664041f, 0.0127672728f, 0.0130674595f, 0.0133669536f,
+    0.0136657443f, 0.0139638208f, 0.0142611725f, 0.0145577887f,
+    0.0148536588f, 0.0151487723f, 0.0154431185f, 0.015736687f,
+    0.0160294672f, 0.0163214488f, 0.0166126214f, 0.0169029745f,
+    0.0171924978f, 0.0174811812f, 0.0177690142f, 0.0180559867f,
+    0.0183420885f, 0.0186273095f, 0.0189116395f, 0.0191950686f,
+    0.0194775867f, 0.0197591837f, 0.0200398499f, 0.0203195753f,
+    0.02059835f, 0.0208761643f, 0.0211530083f, 0.0214288723f,
+    0.0217037467f, 0.0219776218f, 0.022250488f, 0.0225223358f,
+    0.0227931557f, 0.0230629381f, 0.0233316737f, 0.0235993531f,
+    0.023865967f, 0.0241315061f, 0.0243959611f, 0.0246593229f,
+    0.0249215823f, 0.0251827302f, 0.0254427576f, 0.0257016555f,
+    0.0259594149f, 0.0262160269f, 0.0264714827f, 0.0267257735f,
+    0.0269788904f, 0.0272308249f, 0.0274815681f, 0.0277311117f,
+    0.0279794468f, 0.0282265652f, 0.0284724582f, 0.0287171175f,
+    0.0289605348f, 0.0292027017f, 0.0294436101f, 0.0296832516f,
+    0.0299216181f, 0.0301587017f, 0.0303944941f, 0.0306289875f,
+    0.0308621739f, 0.0310940454f, 0.0313245942f, 0.0315538125f,
+    0.0317816926f, 0.032008227f, 0.0322334078f, 0.0324572277f,
+    0.032679679f, 0.0329007545f, 0.0331204466f, 0.033338748f,
+    0.0335556516f, 0.0337711501f, 0.0339852362f, 0.0341979031f,
+    0.0344091434f, 0.0346189504f, 0.0348273171f, 0.0350342366f,
+    0.0352397021f, 0.0354437069f, 0.0356462442f, 0.0358473074f,
+    0.0360468901f, 0.0362449855f, 0.0364415874f, 0.0366366893f,
+    0.0368302848f, 0.0370223677f, 0.0372129318f, 0.037401971f,
+    0.0375894791f, 0.0377754501f, 0.0379598781f, 0.038142757f,
+    0.0383240812f, 0.0385038448f, 0.0386820421f, 0.0388586674f,
+    0.0390337151f, 0.0392071797f, 0.0393790557f, 0.0395493377f,
+    0.0397180204f, 0.0398850985f, 0.0400505667f, 0.0402144199f,
+    0.0403766531f, 0.040537261f, 0.0406962389f, 0.0408535819f,
+    0.0410092849f, 0.0411633434f, 0.0413157525f, 0.0414665077f,
+    0.0416156043f, 0.0417630379f, 0.041908804f, 0.0420528981f,
+    0.0421953161f, 0.0423360536f, 0.0424751064f, 0.0426124704f,
+    0.0427481416f, 0.0428821159f, 0.0430143895f, 0.0431449584f,
+    0.043273819f, 0.0434009673f, 0.0435263999f, 0.043650113f,
+    0.0437721032f, 0.043892367f, 0.0440109009f, 0.0441277018f,
+    0.0442427662f, 0.044356091f, 0.0444676732f, 0.0445775095f,
+    0.044685597f, 0.0447919328f, 0.0448965141f, 0.044999338f,
+    0.0451004017f, 0.0451997028f, 0.0452972384f, 0.0453930062f,
+    0.0454870037f, 0.0455792284f, 0.0456696781f, 0.0457583505f,
+    0.0458452434f, 0.0459303547f, 0.0460136823f, 0.0460952243f,
+    0.0461749787f, 0.0462529438f, 0.0463291176f, 0.0464034986f,
+    0.046476085f, 0.0465468753f, 0.046615868f, 0.0466830616f,
+    0.0467484548f, 0.0468120462f, 0.0468738347f, 0.046933819f,
+    0.0469919981f, 0.0470483709f, 0.0471029364f, 0.0471556939f,
+    0.0472066423f, 0.0472557811f, 0.0473031094f, 0.0473486267f,
+    0.0473923324f, 0.047434226f, 0.0474743072f, 0.0475125754f,
+    0.0475490305f, 0.0475836723f, 0.0476165006f, 0.0476475153f,
+    0.0476767163f, 0.0477041039f, 0.047729678f, 0.0477534389f,
+    0.0477753868f, 0.047795522f, 0.047813845f, 0.0478303562f,
+    0.0478450561f, 0.0478579454f, 0.0478690246f, 0.0478782945f,
+    0.0478857559f, 0.0478914097f, 0.0478952568f, 0.0478972982f,
+    0.0478975349f, 0.0478959681f, 0.047892599f, 0.0478874288f,
+    0.0478804589f, 0.0478716907f, 0.0478611256f, 0.0478487651f,
+    0.0478346108f, 0.0478186645f, 0.0478009278f, 0.0477814025f,
+    0.0477600905f, 0.0477369937f, 0.0477121141f, 0.0476854537f,
+    0.0476570146f, 0.0476267991f, 0.0475948094f, 0.0475610477f,
+    0.0475255166f, 0.0474882183f, 0.0474491555f, 0.0474083306f,
+    0.0473657464f, 0.0473214055f, 0.0472753107f, 0.0472274648f,
+    0.0471778706f, 0.0471265313f, 0.0470734497f, 0.0470186289f,
+    0.0469620722f, 0.0469037826f, 0.0468437635f, 0.0467820182f,
+    0.04671855f, 0.0466533625f, 0.0465864592f, 0.0465178436f,
+    0.0464475193f, 0.0463754901f, 0.0463017598f, 0.0462263321f,
+    0.046149211f, 0.0460704004f, 0.0459899042f, 0.0459077267f,
+    0.0458238718f, 0.0457383438f, 0.0456511469f, 0.0455622855f,
+    0.0454717639f, 0.0453795864f, 0.0452857577f, 0.0451902823f,
+    0.0450931647f, 0.0449944096f, 0.0448940217f, 0.0447920059f,
+    0.0446883668f, 0.0445831096f, 0.044476239f, 0.0443677601f,
+    0.0442576779f, 0.0441459976f, 0.0440327244f, 0.0439178635f,
+    0.0438014201f, 0.0436833996f, 0.0435638075f, 0.0434426491f,
+    0.04331993f, 0.0431956557f, 0.0430698319f, 0.0429424643f,
+    0.0428135585f, 0.0426831204f, 0.0425511557f, 0.0424176705f,
+    0.0422826705f, 0.0421461619f, 0.0420081506f, 0.0418686428f,
+    0.0417276446f, 0.0415851622f, 0.0414412019f, 0.04129577f,
+    0.0411488728f, 0.0410005168f, 0.0408507084f, 0.0406994541f,
+    0.0405467604f, 0.0403926341f, 0.0402370817f, 0.04008011f,
+    0.0399217256f, 0.0397619355f, 0.0396007465f, 0.0394381654f,
+    0.0392741992f, 0.039108855f, 0.0389421397f, 0.0387740605f,
+    0.0386046245f, 0.0384338389f, 0.0382617108f, 0.0380882477f,
+    0.0379134567f, 0.0377373453f, 0.0375599209f, 0.0373811909f,
+    0.0372011629f, 0.0370198443f, 0.0368372428f, 0.036653366f,
+    0.0364682216f, 0.0362818172f, 0.0360941607f, 0.0359052598f,
+    0.0357151224f, 0.0355237564f, 0.0353311697f, 0.0351373702f,
+    0.034942366f, 0.0347461651f, 0.0345487756f, 0.0343502056f,
+    0.0341504633f, 0.0339495569f, 0.0337474946f, 0.0335442847f,
+    0.0333399355f, 0.0331344555f, 0.0329278528f, 0.0327201361f,
+    0.0325113138f, 0.0323013943f, 0.0320903862f, 0.0318782981f,
+    0.0316651386f, 0.0314509163f, 0.0312356399f, 0.0310193181f,
+    0.0308019597f, 0.0305835735f, 0.0303641681f, 0.0301437526f,
+    0.0299223357f, 0.0296999265f, 0.0294765337f, 0.0292521664f,
+    0.0290268336f, 0.0288005444f, 0.0285733077f, 0.0283451328f,
+    0.0281160286f, 0.0278860044f, 0.0276550693f, 0.0274232326f,
+    0.0271905034f, 0.0269568912f, 0.026722405f, 0.0264870544f,
+    0.0262508485f, 0.0260137968f, 0.0257759087f, 0.0255371936f,
+    0.025297661f, 0.0250573203f, 0.024816181f, 0.0245742527f,
+    0.0243315448f, 0.0240880671f, 0.023843829f, 0.0235988402f,
+    0.0233531103f, 0.0231066489f, 0.0228594659f, 0.0226115708f,
+    0.0223629733f, 0.0221136833f, 0.0218637105f, 0.0216130647f,
+    0.0213617556f, 0.0211097932f, 0.0208571871f, 0.0206039474f,
+    0.0203500838f, 0.0200956063f, 0.0198405248f, 0.0195848492f,
+    0.0193285894f, 0.0190717555f, 0.0188143573f, 0.0185564049f,
+    0.0182979082f, 0.0180388774f, 0.0177793224f, 0.0175192532f,
+    0.01725868f, 0.0169976128f, 0.0167360617f, 0.0164740368f,
+    0.0162115481f, 0.0159486059f, 0.0156852203f, 0.0154214013f,
+    0.0151571591f, 0.014892504f, 0.014627446f, 0.0143619954f,
+    0.0140961623f, 0.013829957f, 0.0135633896f, 0.0132964704f,
+    0.0130292095f, 0.0127616172f, 0.0124937038f, 0.0122254794f,
+    0.0119569544f, 0.0116881389f, 0.0114190432f, 0.0111496776f,
+    0.0108800523f, 0.0106101776f, 0.0103400638f, 0.0100697212f,
+    0.00979915991f, 0.00952839034f, 0.00925742275f, 0.0089862674f,
+    0.00871493458f, 0.00844343457f, 0.00817177764f, 0.00789997409f,
+    0.00762803418f, 0.00735596821f, 0.00708378643f, 0.00681149915f,
+    0.00653911661f, 0.00626664911f, 0.0059941069f, 0.00572150025f,
+    0.00544883942f, 0.00517613467f, 0.00490339626f, 0.00463063442f,
+    0.00435785941f, 0.00408508147f, 0.00381231081f, 0.00353955768f,
+    0.00326683229f, 0.00299414484f, 0.00272150555f, 0.00244892461f,
+    0.00217641221f, 0.00190397852f, 0.00163163373f, 0.00135938799f,
+    0.00108725145f, 0.000815234252f, 0.000543346534f, 0.000271598414f,
+    3.79342162e-17f, -0.000271438609f, -0.000542707327f, -0.000813796081f,
+    -0.00108469481f, -0.00135539346f, -0.001625882f, -0.00189615042f,
+    -0.00216618869f, -0.00243598684f, -0.00270553488f, -0.00297482284f,
+    -0.00324384079f, -0.00351257879f, -0.00378102693f, -0.0040491753f,
+    -0.00431701403f, -0.00458453325f, -0.00485172312f, -0.00511857381f,
+    -0.0053850755f, -0.00565121841f, -0.00591699276f, -0.00618238881f,
+    -0.00644739682f, -0.00671200707f, -0.00697620988f, -0.00723999557f,
+    -0.0075033545f, -0.00776627703f, -0.00802875356f, -0.0082907745f,
+    -0.0085523303f, -0.00881341142f, -0.00907400833f, -0.00933411155f,
+    -0.00959371161f, -0.00985279906f, -0.0101113645f, -0.0103693985f,
+    -0.0106268917f, -0.0108838348f, -0.0111402185f, -0.0113960334f,
+    -0.0116512703f, -0.01190592f, -0.0121599732f, -0.0124134209f,
+    -0.0126662537f, -0.0129184626f, -0.0131700385f, -0.0134209723f,
+    -0.0136712551f, -0.0139208777f, -0.0141698311f, -0.0144181066f,
+    -0.0146656951f, -0.0149125877f, -0.0151587756f, -0.0154042499f,
+    -0.0156490019f, -0.0158930228f, -0.0161363039f, -0.0163788365f,
+    -0.0166206118f, -0.0168616214f, -0.0171018565f, -0.0173413087f,
+    -0.0175799694f, -0.01781783f, -0.0180548822f, -0.0182911175f,
+    -0.0185265276f, -0.018761104f, -0.0189948384f, -0.0192277227f,
+    -0.0194597484f, -0.0196909075f, -0.0199211918f, -0.020150593f,
+    -0.0203791032f, -0.0206067143f, -0.0208334182f, -0.0210592069f,
+    -0.0212840726f, -0.0215080073f, -0.0217310032f, -0.0219530523f,
+    -0.0221741471f, -0.0223942796f, -0.0226134423f, -0.0228316273f,
+    -0.0230488272f, -0.0232650344f, -0.0234802412f, -0.0236944402f,
+    -0.023907624f, -0.0241197851f, -0.0243309161f, -0.0245410098f,
+    -0.0247500588f, -0.0249580559f, -0.0251649939f, -0.0253708657f,
+    -0.0255756641f, -0.025779382f, -0.0259820125f, -0.0261835486f,
+    -0.0263839833f, -0.0265833098f, -0.0267815212f, -0.0269786106f,
+    -0.0271745715f, -0.0273693969f, -0.0275630804f, -0.0277556153f,
+    -0.0279469949f, -0.0281372129f, -0.0283262627f, -0.0285141379f,
+    -0.0287008321f, -0.028886339f, -0.0290706523f, -0.0292537658f,
+    -0.0294356733f, -0.0296163686f, -0.0297958457f, -0.0299740986f,
+    -0.0301511212f, -0.0303269076f, -0.0305014519f, -0.0306747483f,
+    -0.030846791f, -0.0310175743f, -0.0311870924f, -0.0313553397f,
+    -0.0315223106f, -0.0316879996f, -0.0318524013f, -0.0320155101f,
+    -0.0321773207f, -0.0323378277f, -0.032497026f, -0.0326549101f,
+    -0.0328114751f, -0.0329667157f, -0.0331206268f, -0.0332732035f,
+    -0.0334244408f, -0.0335743338f, -0.0337228776f, -0.0338700674f,
+    -0.0340158984f, -0.034160366f, -0.0343034655f, -0.0344451923f,
+    -0.0345855419f, -0.0347245098f, -0.0348620915f, -0.0349982827f,
+    -0.035133079f, -0.0352664762f, -0.0353984702f, -0.0355290566f,
+    -0.0356582314f, -0.0357859906f, -0.0359123302f, -0.0360372462f,
+    -0.0361607347f, -0.036282792f, -0.0364034143f, -0.0365225977f,
+    -0.0366403388f, -0.0367566338f, -0.0368714793f, -0.0369848717f,
+    -0.0370968076f, -0.0372072836f, -0.0373162964f, -0.0374238428f,
+    -0.0375299194f, -0.0376345233f, -0.0377376512f, -0.0378393002f,
+    -0.0379394673f, -0.0380381494f, -0.0381353439f, -0.0382310478f,
+    -0.0383252584f, -0.0384179731f, -0.0385091891f, -0.0385989039f,
+    -0.0386871149f, -0.0387738198f, -0.0388590161f, -0.0389427014f,
+    -0.0390248735f, -0.0391055301f, -0.039184669f, -0.0392622882f,
+    -0.0393383856f, -0.0394129591f, -0.0394860068f, -0.0395575269f,
+    -0.0396275175f, -0.0396959769f, -0.0397629032f, -0.039828295f,
+    -0.0398921505f, -0.0399544683f, -0.0400152468f, -0.0400744847f,
+    -0.0401321806f, -0.0401883332f, -0.0402429412f, -0.0402960034f,
+    -0.0403475188f, -0.0403974863f, -0.0404459048f, -0.0404927734f,
+    -0.0405380912f, -0.0405818574f, -0.0406240711f, -0.0406647318f,
+    -0.0407038386f, -0.0407413911f, -0.0407773886f, -0.0408118308f,
+    -0.040844717f, -0.0408760471f, -0.0409058207f, -0.0409340375f,
+    -0.0409606973f, -0.0409858001f, -0.0410093457f, -0.0410313341f,
+    -0.0410517653f, -0.0410706395f, -0.0410879569f, -0.0411037175f,
+    -0.0411179218f, -0.04113057f, -0.0411416625f, -0.0411511998f,
+    -0.0411591823f, -0.0411656107f, -0.0411704856f, -0.0411738076f,
+    -0.0411755775f, -0.041175796f, -0.0411744641f, -0.0411715826f,
+    -0.0411671525f, -0.0411611749f, -0.0411536507f, -0.0411445812f,
+    -0.0411339675f, -0.0411218109f, -0.0411081127f, -0.0410928743f,
+    -0.041076097f, -0.0410577825f, -0.0410379321f, -0.0410165476f,
+    -0.0409936305f, -0.0409691826f, -0.0409432055f, -0.0409157013f,
+    -0.0408866716f, -0.0408561185f, -0.040824044f, -0.04079045f,
+    -0.0407553387f, -0.0407187122f, -0.0406805728f, -0.0406409227f,
+    -0.0405997642f, -0.0405570997f, -0.0405129316f, -0.0404672625f,
+    -0.0404200948f, -0.0403714312f, -0.0403212743f, -0.0402696268f,
+    -0.0402164914f, -0.0401618711f, -0.0401057686f, -0.0400481868f,
+    -0.0399891288f, -0.0399285976f, -0.0398665962f, -0.0398031278f,
+    -0.0397381955f, -0.0396718027f, -0.0396039525f, -0.0395346484f,
+    -0.0394638938f, -0.0393916921f, -0.0393180467f, -0.0392429613f,
+    -0.0391664395f, -0.0390884849f, -0.0390091012f, -0.0389282923f,
+    -0.0388460618f, -0.0387624137f, -0.0386773519f, -0.0385908803f,
+    -0.038503003f, -0.0384137241f, -0.0383230476f, -0.0382309777f,
+    -0.0381375187f, -0.0380426747f, -0.0379464502f, -0.0378488495f,
+    -0.0377498769f, -0.0376495371f, -0.0375478344f, -0.0374447734f,
+    -0.0373403588f, -0.0372345952f, -0.0371274873f, -0.0370190398f,
+    -0.0369092576f, -0.0367981455f, -0.0366857084f, -0.0365719513f,
+    -0.0364568791f, -0.0363404968f, -0.0362228096f, -0.0361038226f,
+    -0.035983541f, -0.0358619698f, -0.0357391146f, -0.0356149804f,
+    -0.0354895728f, -0.035362897f, -0.0352349586f, -0.035105763f,
+    -0.0349753158f, -0.0348436225f, -0.0347106887f, -0.0345765202f,
+    -0.0344411225f, -0.0343045016f, -0.0341666631f, -0.0340276128f,
+    -0.0338873568f, -0.0337459008f, -0.0336032509f, -0.033459413f,
+    -0.0333143933f, -0.0331681976f, -0.0330208323f, -0.0328723035f,
+    -0.0327226173f, -0.03257178f, -0.0324197979f, -0.0322666773f,
+    -0.0321124245f, -0.0319570461f, -0.0318005484f, -0.0316429379f,
+    -0.0314842211f, -0.0313244045f, -0.0311634948f, -0.0310014987f,
+    -0.0308384226f, -0.0306742735f, -0.0305090579f, -0.0303427827f,
+    -0.0301754547f, -0.0300070807f, -0.0298376677f, -0.0296672225f,
+    -0.0294957521f, -0.0293232635f, -0.0291497636f, -0.0289752597f,
+    -0.0287997587f, -0.0286232677f, -0.028445794f, -0.0282673448f,
+    -0.0280879271f, -0.0279075484f, -0.0277262158f, -0.0275439368f,
+    -0.0273607186f, -0.0271765687f, -0.0269914944f, -0.0268055032f,
+    -0.0266186025f, -0.0264308f, -0.026242103f, -0.0260525192f,
+    -0.0258620562f, -0.0256707215f, -0.0254785229f, -0.025285468f,
+    -0.0250915645f, -0.0248968201f, -0.0247012427f, -0.0245048399f,
+    -0.0243076196f, -0.0241095897f, -0.023910758f, -0.0237111324f,
+    -0.0235107208f, -0.0233095312f, -0.0231075715f, -0.0229048498f,
+    -0.022701374f, -0.0224971521f, -0.0222921924f, -0.0220865027f,
+    -0.0218800913f, -0.0216729663f, -0.0214651358f, -0.0212566081f,
+    -0.0210473912f, -0.0208374935f, -0.0206269232f, -0.0204156885f,
+    -0.0202037977f, -0.0199912591f, -0.0197780811f, -0.019564272f,
+    -0.0193498402f, -0.0191347939f, -0.0189191417f, -0.018702892f,
+    -0.0184860531f, -0.0182686336f, -0.0180506419f, -0.0178320865f,
+    -0.0176129759f, -0.0173933186f, -0.0171731232f, -0.0169523982f,
+    -0.0167311522f, -0.0165093937f, -0.0162871313f, -0.0160643738f,
+    -0.0158411296f, -0.0156174075f, -0.015393216f, -0.0151685639f,
+    -0.0149434598f, -0.0147179124f, -0.0144919304f, -0.0142655226f,
+    -0.0140386976f, -0.0138114642f, -0.0135838311f, -0.0133558072f,
+    -0.013127401f, -0.0128986216f, -0.0126694775f, -0.0124399776f,
+    -0.0122101308f, -0.0119799458f, -0.0117494314f, -0.0115185966f,
+    -0.01128745f, -0.0110560006f, -0.0108242572f, -0.0105922286f,
+    -0.0103599238f, -0.0101273515f, -0.00989452075f, -0.00966144029f,
+    -0.00942811905f, -0.0091945659f, -0.00896078975f, -0.00872679948f,
+    -0.00849260398f, -0.00825821218f, -0.00802363295f, -0.00778887521f,
+    -0.00755394787f, -0.00731885983f, -0.00708362f, -0.0068482373f,
+    -0.00661272064f, -0.00637707892f, -0.00614132106f, -0.00590545598f,
+    -0.00566949257f, -0.00543343976f, -0.00519730646f, -0.00496110155f,
+    -0.00472483397f, -0.00448851259f, -0.00425214634f, -0.00401574409f,
+    -0.00377931476f, -0.00354286722f, -0.00330641036f, -0.00306995307f,
+    -0.00283350422f, -0.00259707268f, -0.00236066732f, -0.00212429701f,
+    -0.00188797059f, -0.00165169692f, -0.00141548484f, -0.00117934319f,
+    -0.000943280783f, -0.000707306455f, -0.000471429013f, -0.000235657263f,
+    -3.76175795e-17f, 0.000235533988f, 0.000470935923f, 0.000706197037f,
+    0.000941308571f, 0.00117626178f, 0.00141104792f, 0.00164565826f,
+    0.0018800841f, 0.00211431672f, 0.00234834743f, 0.00258216756f,
+    0.00281576843f, 0.00304914139f, 0.00328227779f, 0.00351516901f,
+    0.00374780643f, 0.00398018145f, 0.00421228548f, 0.00444410995f,
+    0.0046756463f, 0.00490688599f, 0.00513782049f, 0.00536844129f,
+    0.00559873989f, 0.00582870783f, 0.00605833662f, 0.00628761784f,
+    0.00651654305f, 0.00674510384f, 0.00697329183f, 0.00720109863f,
+    0.0074285159f, 0.00765553529f, 0.0078821485f, 0.00810834721f,
+    0.00833412317f, 0.00855946811f, 0.00878437379f, 0.009008832f,
+    0.00923283453f, 0.00945637323f, 0.00967943994f, 0.00990202652f,
+    0.0101241249f, 0.0103457269f, 0.0105668245f, 0.0107874098f,
+    0.0110074746f, 0.0112270109f, 0.0114460109f, 0.0116644665f,
+    0.0118823699f, 0.0120997131f, 0.0123164883f, 0.0125326876f,
+    0.0127483032f, 0.0129633273f, 0.0131777521f, 0.01339157f,
+    0.0136047732f, 0.0138173539f, 0.0140293046f, 0.0142406176f,
+    0.0144512854f, 0.0146613002f, 0.0148706546f, 0.0150793411f,
+    0.0152873522f, 0.0154946803f, 0.0157013182f, 0.0159072583f,
+    0.0161124933f, 0.0163170159f, 0.0165208187f, 0.0167238945f,
+    0.016926236f, 0.017127836f, 0.0173286873f, 0.0175287827f,
+    0.0177281152f, 0.0179266776f, 0.0181244629f, 0.018321464f,
+    0.018517674f, 0.0187130859f, 0.0189076928f, 0.0191014877f,
+    0.0192944639f, 0.0194866144f, 0.0196779326f, 0.0198684116f,
+    0.0200580447f, 0.0202468252f, 0.0204347466f, 0.0206218021f,
+    0.0208079852f, 0.0209932893f, 0.021177708f, 0.0213612348f,
+    0.0215438632f, 0.0217255868f, 0.0219063993f, 0.0220862944f,
+    0.0222652657f, 0.0224433071f, 0.0226204123f, 0.0227965751f,
+    0.0229717894f, 0.0231460492f, 0.0233193483f, 0.0234916807f,
+    0.0236630406f, 0.0238334218f, 0.0240028186f, 0.0241712251f,
+    0.0243386355f, 0.0245050439f, 0.0246704447f, 0.0248348321f,
+    0.0249982005f, 0.0251605443f, 0.0253218579f, 0.0254821358f,
+    0.0256413724f, 0.0257995624f, 0.0259567004f, 0.0261127809f,
+    0.0262677986f, 0.0264217483f, 0.0265746248f, 0.0267264227f,
+    0.0268771371f, 0.0270267627f, 0.0271752946f, 0.0273227276f,
+    0.0274690568f, 0.0276142774f, 0.0277583843f, 0.0279013727f,
+    0.0280432379f, 0.0281839751f, 0.0283235796f, 0.0284620467f,
+    0.0285993718f, 0.0287355503f, 0.0288705776f, 0.0290044494f,
+    0.0291371611f, 0.0292687084f, 0.0293990869f, 0.0295282923f,
+    0.0296563203f, 0.0297831668f, 0.0299088276f, 0.0300332985f,
+    0.0301565755f, 0.0302786546f, 0.0303995318f, 0.0305192031f,
+    0.0306376647f, 0.0307549127f, 0.0308709433f, 0.0309857529f,
+    0.0310993377f, 0.031211694f, 0.0313228184f, 0.0314327071f,
+    0.0315413568f, 0.0316487639f, 0.0317549251f, 0.0318598369f,
+    0.0319634962f, 0.0320658996f, 0.0321670439f, 0.032266926f,
+    0.0323655427f, 0.032462891f, 0.0325589679f, 0.0326537703f,
+    0.0327472954f, 0.0328395404f, 0.0329305023f, 0.0330201785f,
+    0.0331085661f, 0.0331956626f, 0.0332814654f, 0.0333659717f,
+    0.0334491792f, 0.0335310853f, 0.0336116876f, 0.0336909839f,
+    0.0337689716f, 0.0338456486f, 0.0339210127f, 0.0339950616f,
+    0.0340677933f, 0.0341392057f, 0.0342092968f, 0.0342780645f,
+    0.0343455071f, 0.0344116225f, 0.0344764091f, 0.0345398649f,
+    0.0346019884f, 0.0346627779f, 0.0347222317f, 0.0347803483f,
+    0.0348371261f, 0.0348925638f, 0.0349466598f, 0.0349994129f,
+    0.0350508217f, 0.0351008849f, 0.0351496015f, 0.0351969701f,
+    0.0352429898f, 0.0352876594f, 0.0353309779f, 0.0353729445f,
+    0.0354135581f, 0.035452818f, 0.0354907234f, 0.0355272734f,
+    0.0355624675f, 0.0355963049f, 0.0356287851f, 0.0356599076f,
+    0.0356896718f, 0.0357180773f, 0.0357451237f, 0.0357708107f,
+    0.0357951379f, 0.0358181053f, 0.0358397125f, 0.0358599594f,
+    0.035878846f, 0.0358963722f, 0.0359125381f, 0.0359273437f,
+    0.0359407891f, 0.0359528746f, 0.0359636003f, 0.0359729665f,
+    0.0359809735f, 0.0359876217f, 0.0359929116f, 0.0359968436f,
+    0.0359994182f, 0.0360006361f, 0.0360004978f, 0.035999004f,
+    0.0359961555f, 0.035991953f, 0.0359863974f, 0.0359794896f,
+    0.0359712304f, 0.0359616209f, 0.0359506621f, 0.0359383551f,
+    0.035924701f, 0.035909701f, 0.0358933563f, 0.0358756682f,
+    0.035856638f, 0.0358362671f, 0.035814557f, 0.0357915091f,
+    0.035767125f, 0.0357414062f, 0.0357143543f, 0.0356859711f,
+    0.0356562583f, 0.0356252175f, 0.0355928508f, 0.0355591598f,
+    0.0355241466f, 0.0354878131f, 0.0354501614f, 0.0354111934f,
+    0.0353709114f, 0.0353293175f, 0.0352864138f, 0.0352422027f,
+    0.0351966864f, 0.0351498673f, 0.0351017479f, 0.0350523305f,
+    0.0350016177f, 0.0349496119f, 0.0348963159f, 0.0348417322f,
+    0.0347858635f, 0.0347287125f, 0.0346702821f, 0.034610575f,
+    0.0345495941f, 0.0344873424f, 0.0344238228f, 0.0343590383f,
+    0.034292992f, 0.0342256869f, 0.0341571263f, 0.0340873133f,
+    0.0340162511f, 0.0339439431f, 0.0338703926f, 0.0337956028f,
+    0.0337195774f, 0.0336423196f, 0.0335638331f, 0.0334841214f,
+    0.033403188f, 0.0333210367f, 0.033237671f, 0.0331530948f,
+    0.0330673118f, 0.0329803258f, 0.0328921407f, 0.0328027603f,
+    0.0327121887f, 0.0326204297f, 0.0325274875f, 0.0324333661f,
+    0.0323380696f, 0.0322416021f, 0.032143968f, 0.0320451713f,
+    0.0319452164f, 0.0318441077f, 0.0317418494f, 0.031638446f,
+    0.0315339019f, 0.0314282216f, 0.0313214096f, 0.0312134705f,
+    0.0311044089f, 0.0309942295f, 0.0308829369f, 0.0307705359f,
+    0.0306570311f, 0.0305424275f, 0.0304267299f, 0.0303099431f,
+    0.0301920721f, 0.0300731218f, 0.0299530971f, 0.0298320033f,
+    0.0297098452f, 0.0295866281f, 0.0294623571f, 0.0293370373f,
+    0.0292106739f, 0.0290832723f, 0.0289548378f, 0.0288253755f,
+    0.028694891f, 0.0285633895f, 0.0284308766f, 0.0282973578f,
+    0.0281628384f, 0.0280273241f, 0.0278908204f, 0.027753333f,
+    0.0276148674f, 0.0274754294f, 0.0273350247f, 0.027193659f,
+    0.0270513381f, 0.0269080677f, 0.0267638539f, 0.0266187023f,
+    0.026472619f, 0.0263256098f, 0.0261776808f, 0.0260288379f,
+    0.0258790872f, 0.0257284347f, 0.0255768866f, 0.0254244489f,
+    0.0252711279f, 0.0251169297f, 0.0249618605f, 0.0248059266f,
+    0.0246491342f, 0.0244914897f, 0.0243329993f, 0.0241736696f,
+    0.0240135068f, 0.0238525173f, 0.0236907077f, 0.0235280843f,
+    0.0233646538f, 0.0232004225f, 0.0230353972f, 0.0228695843f,
+    0.0227029904f, 0.0225356223f, 0.0223674865f, 0.0221985898f,
+    0.0220289389f, 0.0218585405f, 0.0216874013f, 0.0215155282f,
+    0.0213429279f, 0.0211696073f, 0.0209955733f, 0.0208208328f,
+    0.0206453925f, 0.0204692596f, 0.0202924408f, 0.0201149433f,
+    0.0199367739f, 0.0197579397f, 0.0195784478f, 0.0193983052f,
+    0.0192175189f, 0.0190360962f, 0.018854044f, 0.0186713696f,
+    0.0184880801f, 0.0183041827f, 0.0181196846f, 0.017934593f,
+    0.0177489151f, 0.0175626583f, 0.0173758297f, 0.0171884367f,
+    0.0170004866f, 0.0168119867f, 0.0166229443f, 0.0164333669f,
+    0.0162432618f, 0.0160526363f, 0.015861498f, 0.0156698542f,
+    0.0154777123f, 0.0152850799f, 0.0150919644f, 0.0148983733f,
+    0.0147043141f, 0.0145097942f, 0.0143148213f, 0.0141194029f,
+    0.0139235465f, 0.0137272597f, 0.01353055f, 0.0133334251f,
+    0.0131358926f, 0.0129379601f, 0.0127396352f, 0.0125409255f,
+    0.0123418387f, 0.0121423825f, 0.0119425645f, 0.0117423925f,
+    0.011541874f, 0.0113410168f, 0.0111398286f, 0.0109383171f,
+    0.0107364901f, 0.0105343552f, 0.0103319203f, 0.010129193f,
+    0.00992618114f, 0.00972289246f, 0.00951933472f, 0.00931551572f,
+    0.00911144322f, 0.00890712501f, 0.00870256889f, 0.00849778265f,
+    0.0082927741f, 0.00808755105f, 0.0078821213f, 0.00767649268f,
+    0.007470673f, 0.00726467008f, 0.00705849175f, 0.00685214584f,
+    0.00664564019f, 0.00643898262f, 0.00623218097f, 0.00602524309f,
+    0.0058181768f, 0.00561098994f, 0.00540369037f, 0.00519628592f,
+    0.00498878443f, 0.00478119374f, 0.0045735217f, 0.00436577614f,
+    0.0041579649f, 0.00395009583f, 0.00374217675f, 0.00353421551f,
+    0.00332621994f, 0.00311819786f, 0.0029101571f, 0.0027021055f,
+    0.00249405086f, 0.00228600101f, 0.00207796376f, 0.00186994693f,
+    0.0016619583f, 0.0014540057f, 0.0012460969f, 0.00103823971f,
+    0.0008304419f, 0.000622711256f, 0.000415055549f, 0.000207482544f,
+    3.72610352e-17f, -0.000207384331f, -0.000414662703f, -0.000621827381f,
+    -0.000828870635f, -0.00103578474f, -0.001242562f, -0.00144919469f,
+    -0.00165567512f, -0.00186199562f, -0.0020681485f, -0.00227412609f,
+    -0.00247992075f, -0.00268552483f, -0.00289093069f, -0.00309613071f,
+    -0.00330111727f, -0.00350588279f, -0.00371041966f, -0.00391472031f,
+    -0.00411877719f, -0.00432258273f, -0.0045261294f, -0.00472940967f,
+    -0.00493241604f, -0.005135141f, -0.00533757707f, -0.00553971678f,
+    -0.00574155268f, -0.00594307732f, -0.00614428329f, -0.00634516317f,
+    -0.00654570957f, -0.00674591512f, -0.00694577244f, -0.0071452742f,
+    -0.00734441307f, -0.00754318173f, -0.0077415729f, -0.0079395793f,
+    -0.00813719366f, -0.00833440876f, -0.00853121736f, -0.00872761227f,
+    -0.00892358629f, -0.00911913227f, -0.00931424306f, -0.00950891153f,
+    -0.00970313058f, -0.00989689312f, -0.0100901921f, -0.0102830204f,
+    -0.0104753711f, -0.0106672372f, -0.0108586116f, -0.0110494875f,
+    -0.0112398578f, -0.0114297157f, -0.0116190542f, -0.0118078665f,
+    -0.0119961458f, -0.0121838852f, -0.012371078f, -0.0125577173f,
+    -0.0127437963f, -0.0129293085f, -0.013114247f, -0.0132986052f,
+    -0.0134823764f, -0.013665554f, -0.0138481314f, -0.014030102f,
+    -0.0142114593f, -0.0143921967f, -0.0145723077f, -0.0147517859f,
+    -0.0149306248f, -0.0151088179f, -0.015286359f, -0.0154632416f,
+    -0.0156394594f, -0.0158150061f, -0.0159898753f, -0.0161640609f,
+    -0.0163375567f, -0.0165103563f, -0.0166824537f, -0.0168538427f,
+    -0.0170245172f, -0.0171944711f, -0.0173636984f, -0.0175321931f,
+    -0.0176999491f, -0.0178669606f, -0.0180332215f, -0.018198726f,
+    -0.0183634682f, -0.0185274423f, -0.0186906424f, -0.0188530629f,
+    -0.0190146979f, -0.0191755418f, -0.0193355889f, -0.0194948335f,
+    -0.01965327f, -0.0198108929f, -0.0199676966f, -0.0201236756f,
+    -0.0202788244f, -0.0204331376f, -0.0205866097f, -0.0207392354f,
+    -0.0208910094f, -0.0210419263f, -0.0211919809f, -0.0213411679f,
+    -0.0214894821f, -0.0216369184f, -0.0217834716f, -0.0219291367f,
+    -0.0220739085f, -0.022217782f, -0.0223607523f, -0.0225028144f,
+    -0.0226439634f, -0.0227841943f, -0.0229235025f, -0.0230618829f,
+    -0.023199331f, -0.0233358419f, -0.0234714109f, -0.0236060335f,
+    -0.0237397049f, -0.0238724206f, -0.024004176f, -0.0241349667f,
+    -0.0242647882f, -0.024393636f, -0.0245215057f, -0.024648393f,
+    -0.0247742936f, -0.0248992033f, -0.0250231176f, -0.0251460326f,
+    -0.025267944f, -0.0253888477f, -0.0255087395f, -0.0256276156f,
+    -0.0257454719f, -0.0258623044f, -0.0259781092f, -0.0260928824f,
+    -0.0262066202f, -0.0263193189f, -0.0264309745f, -0.0265415835f,
+    -0.0266511421f, -0.0267596468f, -0.0268670939f, -0.0269734799f,
+    -0.0270788012f, -0.0271830544f, -0.0272862362f, -0.027388343f,
+    -0.0274893715f, -0.0275893185f, -0.0276881807f, -0.0277859549f,
+    -0.0278826379f, -0.0279782265f, -0.0280727177f, -0.0281661085f,
+    -0.0282583958f, -0.0283495766f, -0.0284396481f, -0.0285286074f,
+    -0.0286164517f, -0.028703178f, -0.0287887838f, -0.0288732663f,
+    -0.0289566229f, -0.0290388509f, -0.0291199477f, -0.0291999109f,
+    -0.0292787379f, -0.0293564263f, -0.0294329738f, -0.0295083779f,
+    -0.0295826363f, -0.0296557468f, -0.0297277072f, -0.0297985152f,
+    -0.0298681688f, -0.0299366659f, -0.0300040043f, -0.0300701822f,
+    -0.0301351976f, -0.0301990484f, -0.030261733f, -0.0303232494f,
+    -0.0303835959f, -0.0304427708f, -0.0305007723f, -0.0305575988f,
+    -0.0306132487f, -0.0306677205f, -0.0307210127f, -0.0307731237f,
+    -0.0308240523f, -0.0308737969f, -0.0309223563f, -0.0309697291f,
+    -0.0310159143f, -0.0310609104f, -0.0311047165f, -0.0311473314f,
+    -0.031188754f, -0.0312289833f, -0.0312680184f, -0.0313058584f,
+    -0.0313425023f, -0.0313779493f, -0.0314121987f, -0.0314452497f,
+    -0.0314771015f, -0.0315077537f, -0.0315372055f, -0.0315654563f,
+    -0.0315925058f, -0.0316183533f, -0.0316429985f, -0.0316664411f,
+    -0.0316886806f, -0.0317097167f, -0.0317295493f, -0.0317481781f,
+    -0.031765603f, -0.0317818239f, -0.0317968407f, -0.0318106534f,
+    -0.031823262f, -0.0318346666f, -0.0318448673f, -0.0318538643f,
+    -0.0318616578f, -0.031868248f, -0.0318736352f, -0.0318778198f,
+    -0.0318808022f, -0.0318825828f, -0.031883162f, -0.0318825405f,
+    -0.0318807187f, -0.0318776973f, -0.0318734769f, -0.0318680583f,
+    -0.0318614421f, -0.0318536293f, -0.0318446205f, -0.0318344167f,
+    -0.0318230189f, -0.0318104279f, -0.0317966448f, -0.0317816707f,
+    -0.0317655066f, -0.0317481538f, -0.0317296133f, -0.0317098864f,
+    -0.0316889745f, -0.0316668787f, -0.0316436006f, -0.0316191414f,
+    -0.0315935027f, -0.031566686f, -0.0315386927f, -0.0315095245f,
+    -0.031479183f, -0.0314476698f, -0.0314149867f, -0.0313811355f,
+    -0.0313461179f, -0.0313099358f, -0.031272591f, -0.0312340855f,
+    -0.0311944213f, -0.0311536003f, -0.0311116247f, -0.0310684964f,
+    -0.0310242178f, -0.0309787909f, -0.0309322179f, -0.0308845012f,
+    -0.0308356431f, -0.0307856458f, -0.0307345118f, -0.0306822435f,
+    -0.0306288434f, -0.0305743141f, -0.030518658f, -0.0304618777f,
+    -0.030403976f, -0.0303449554f, -0.0302848188f, -0.0302235688f,
+    -0.0301612082f, -0.03009774f, -0.030033167f, -0.0299674921f,
+    -0.0299007182f, -0.0298328485f, -0.0297638859f, -0.0296938334f,
+    -0.0296226943f, -0.0295504717f, -0.0294771688f, -0.0294027888f,
+    -0.029327335f, -0.0292508107f, -0.0291732193f, -0.0290945642f,
+    -0.0290148488f, -0.0289340765f, -0.0288522509f, -0.0287693756f,
+    -0.0286854541f, -0.02860049f, -0.028514487f, -0.0284274488f,
+    -0.0283393792f, -0.0282502818f, -0.0281601606f, -0.0280690193f,
+    -0.0279768618f, -0.0278836921f, -0.0277895141f, -0.0276943318f,
+    -0.0275981492f, -0.0275009704f, -0.0274027995f, -0.0273036406f,
+    -0.0272034978f, -0.0271023755f, -0.0270002778f, -0.0268972089f,
+    -0.0267931733f, -0.0266881752f, -0.0265822191f, -0.0264753092f,
+    -0.0263674502f, -0.0262586463f, -0.0261489023f, -0.0260382225f,
+    -0.0259266116f, -0.0258140742f, -0.025700615f, -0.0255862385f,
+    -0.0254709496f, -0.0253547529f, -0.0252376532f, -0.0251196554f,
+    -0.0250007642f, -0.0248809845f, -0.0247603213f, -0.0246387794f,
+    -0.0245163638f, -0.0243930795f, -0.0242689316f, -0.024143925f,
+    -0.0240180648f, -0.0238913562f, -0.0237638043f, -0.0236354143f,
+    -0.0235061914f, -0.0233761407f, -0.0232452675f, -0.0231135772f,
+    -0.0229810751f, -0.0228477664f, -0.0227136566f, -0.022578751f,
+    -0.0224430551f, -0.0223065743f, -0.0221693141f, -0.02203128f,
+    -0.0218924775f, -0.0217529122f, -0.0216125897f, -0.0214715156f,
+    -0.0213296955f, -0.0211871351f, -0.02104384f, -0.020899816f,
+    -0.0207550688f, -0.0206096042f, -0.0204634279f, -0.0203165459f,
+    -0.0201689638f, -0.0200206875f, -0.019871723f, -0.0197220761f,
+    -0.0195717528f, -0.019420759f, -0.0192691007f, -0.0191167838f,
+    -0.0189638145f, -0.0188101987f, -0.0186559424f, -0.0185010519f,
+    -0.0183455331f, -0.0181893922f, -0.0180326353f, -0.0178752686f,
+    -0.0177172984f, -0.0175587307f, -0.0173995718f, -0.017239828f,
+    -0.0170795054f, -0.0169186105f, -0.0167571495f, -0.0165951287f,
+    -0.0164325544f, -0.0162694331f, -0.016105771f, -0.0159415746f,
+    -0.0157768502f, -0.0156116044f, -0.0154458434f, -0.0152795739f,
+    -0.0151128023f, -0.014945535f, -0.0147777785f, -0.0146095395f,
+    -0.0144408243f, -0.0142716396f, -0.014101992f, -0.013931888f,
+    -0.0137613341f, -0.0135903371f, -0.0134189035f, -0.01324704f,
+    -0.0130747532f, -0.0129020498f, -0.0127289365f, -0.0125554199f,
+    -0.0123815067f, -0.0122072037f, -0.0120325175f, -0.011857455f,
+    -0.0116820228f, -0.0115062277f, -0.0113300765f, -0.011153576f,
+    -0.0109767328f, -0.010799554f, -0.0106220461f, -0.0104442161f,
+    -0.0102660708f, -0.010087617f, -0.00990886162f, -0.00972981141f,
+    -0.00955047326f, -0.00937085405f, -0.00919096065f, -0.00901079995f,
+    -0.00883037882f, -0.00864970416f, -0.00846878289f, -0.0082876219f,
+    -0.0081062281f, -0.00792460843f, -0.0077427698f, -0.00756071914f,
+    -0.0073784634f, -0.0071960095f, -0.00701336439f, -0.00683053503f,
+    -0.00664752836f, -0.00646435135f, -0.00628101094f, -0.0060975141f,
+    -0.00591386781f, -0.00573007901f, -0.0055461547f, -0.00536210183f,
+    -0.00517792738f, -0.00499363833f, -0.00480924166f, -0.00462474433f,
+    -0.00444015334f, -0.00425547565f, -0.00407071826f, -0.00388588813f,
+    -0.00370099225f, -0.00351603759f, -0.00333103114f, -0.00314597986f,
+    -0.00296089074f, -0.00277577074f, -0.00259062685f, -0.00240546602f,
+    -0.00222029522f, -0.00203512143f, -0.00184995159f, -0.00166479268f,
+    -0.00147965164f, -0.00129453542f, -0.00110945098f, -0.000924405246f,
+    -0.00073940517f, -0.000554457681f, -0.000369569709f, -0.000184748175f,
+    -3.68654423e-17f, 0.000184667905f, 0.000369248635f, 0.000553735287f,
+    0.00073812097f, 0.000922398796f, 0.00110656189f, 0.00129060337f,
+    0.00147451637f, 0.00165829405f, 0.00184192955f, 0.00202541603f,
+    0.00220874665f, 0.0023919146f, 0.00257491305f, 0.00275773522f,
+    0.00294037429f, 0.00312282348f, 0.00330507603f, 0.00348712515f,
+    0.00366896411f, 0.00385058614f, 0.00403198453f, 0.00421315255f,
+    0.00439408349f, 0.00457477065f, 0.00475520734f, 0.0049353869f,
+    0.00511530265f, 0.00529494796f, 0.00547431618f, 0.0056534007f,
+    0.0058321949f, 0.00601069219f, 0.00618888599f, 0.00636676974f,
+    0.00654433687f, 0.00672158085f, 0.00689849516f, 0.0070750733f,
+    0.00725130876f, 0.00742719508f, 0.00760272578f, 0.00777789444f,
+    0.00795269462f, 0.0081271199f, 0.0083011639f, 0.00847482024f,
+    0.00864808255f, 0.00882094449f, 0.00899339974f, 0.009165442f,
+    0.00933706496f, 0.00950826237f, 0.00967902797f, 0.00984935552f,
+    0.0100192388f, 0.0101886717f, 0.0103576479f, 0.0105261613f,
+    0.0106942059f, 0.0108617753f, 0.0110288637f, 0.0111954649f,
+    0.0113615728f, 0.0115271814f, 0.0116922848f, 0.0118568769f,
+    0.0120209517f, 0.0121845033f, 0.0123475258f, 0.0125100133f,
+    0.0126719599f, 0.0128333597f, 0.012994207f, 0.0131544958f,
+    0.0133142205f, 0.0134733753f, 0.0136319543f, 0.013789952f,
+    0.0139473626f, 0.0141041805f, 0.0142604f, 0.0144160155f,
+    0.0145710213f, 0.0147254121f, 0.0148791821f, 0.0150323259f,
+    0.0151848381f, 0.015336713f, 0.0154879454f, 0.0156385298f,
+    0.0157884607f, 0.015937733f, 0.0160863411f, 0.0162342799f,
+    0.0163815441f, 0.0165281283f, 0.0166740274f, 0.0168192362f,
+    0.0169637496f, 0.0171075623f, 0.0172506694f, 0.0173930656f,
+    0.017534746f, 0.0176757056f, 0.0178159393f, 0.0179554422f,
+    0.0180942094f, 0.0182322359f, 0.0183695169f, 0.0185060475f,
+    0.018641823f, 0.0187768386f, 0.0189110894f, 0.0190445708f,
+    0.0191772781f, 0.0193092067f, 0.0194403518f, 0.019570709f,
+    0.0197002736f, 0.0198290411f, 0.019957007f, 0.0200841669f,
+    0.0202105163f, 0.0203360508f, 0.020460766f, 0.0205846577f,
+    0.0207077214f, 0.0208299529f, 0.020951348f, 0.0210719025f,
+    0.0211916121f, 0.0213104729f, 0.0214284805f, 0.0215456311f,
+    0.0216619204f, 0.0217773446f, 0.0218918997f, 0.0220055817f,
+    0.0221183867f, 0.0222303109f, 0.0223413503f, 0.0224515014f,
+    0.0225607601f, 0.0226691229f, 0.022776586f, 0.0228831459f,
+    0.0229887987f, 0.0230935411f, 0.0231973694f, 0.02330028f,
+    0.0234022697f, 0.0235033348f, 0.0236034719f, 0.0237026778f,
+    0.0238009491f, 0.0238982824f, 0.0239946746f, 0.0240901223f,
+    0.0241846224f, 0.0242781718f, 0.0243707674f, 0.024462406f,
+    0.0245530846f, 0.0246428003f, 0.02473155f, 0.0248193308f,
+    0.0249061399f, 0.0249919744f, 0.0250768314f, 0.0251607083f,
+    0.0252436022f, 0.0253255104f, 0.0254064304f, 0.0254863594f,
+    0.025565295f, 0.0256432345f, 0.0257201754f, 0.0257961152f,
+    0.0258710517f, 0.0259449822f, 0.0260179045f, 0.0260898164f,
+    0.0261607154f, 0.0262305993f, 0.026299466f, 0.0263673134f,
+    0.0264341392f, 0.0264999414f, 0.0265647179f, 0.0266284668f,
+    0.0266911861f, 0.0267528739f, 0.0268135283f, 0.0268731474f,
+    0.0269317294f, 0.0269892727f, 0.0270457753f, 0.0271012357f,
+    0.0271556523f, 0.0272090234f, 0.0272613474f, 0.0273126228f,
+    0.0273628481f, 0.027412022f, 0.0274601429f, 0.0275072096f,
+    0.0275532206f, 0.0275981748f, 0.0276420708f, 0.0276849074f,
+    0.0277266836f, 0.0277673981f, 0.0278070499f, 0.027845638f,
+    0.0278831613f, 0.0279196188f, 0.0279550098f, 0.0279893332f,
+    0.0280225882f, 0.028054774f, 0.0280858899f, 0.0281159352f,
+    0.0281449091f, 0.0281728111f, 0.0281996405f, 0.0282253968f,
+    0.0282500794f, 0.0282736879f, 0.0282962218f, 0.0283176808f,
+    0.0283380645f, 0.0283573725f, 0.0283756046f, 0.0283927607f,
+    0.0284088403f, 0.0284238435f, 0.0284377701f, 0.0284506201f,
+    0.0284623933f, 0.0284730899f, 0.0284827098f, 0.0284912531f,
+    0.0284987201f, 0.0285051108f, 0.0285104254f, 0.0285146643f,
+    0.0285178277f, 0.0285199158f, 0.0285209292f, 0.0285208683f,
+    0.0285197334f, 0.028517525f, 0.0285142437f, 0.0285098901f,
+    0.0285044648f, 0.0284979684f, 0.0284904017f, 0.0284817652f,
+    0.02847206f, 0.0284612866f, 0.028449446f, 0.0284365391f,
+    0.0284225669f, 0.0284075302f, 0.0283914301f, 0.0283742676f,
+    0.0283560438f, 0.02833676f, 0.0283164171f, 0.0282950165f,
+    0.0282725593f, 0.0282490469f, 0.0282244806f, 0.0281988617f,
+    0.0281721917f, 0.028144472f, 0.0281157041f, 0.0280858894f,
+    0.0280550296f, 0.0280231262f, 0.0279901809f, 0.0279561954f,
+    0.0279211713f, 0.0278851105f, 0.0278480146f, 0.0278098855f,
+    0.0277707252f, 0.0277305354f, 0.0276893182f, 0.0276470754f,
+    0.0276038092f, 0.0275595216f, 0.0275142146f, 0.0274678904f,
+    0.0274205511f, 0.0273721991f, 0.0273228364f, 0.0272724653f,
+    0.0272210883f, 0.0271687076f, 0.0271153256f, 0.0270609448f,
+    0.0270055675f, 0.0269491964f, 0.0268918339f, 0.0268334826f,
+    0.0267741451f, 0.026713824f, 0.026652522f, 0.0265902419f,
+    0.0265269864f, 0.0264627582f, 0.0263975602f, 0.0263313952f,
+    0.0262642662f, 0.026196176f, 0.0261271276f, 0.026057124f,
+    0.0259861682f, 0.0259142633f, 0.0258414124f, 0.0257676186f,
+    0.025692885f, 0.025617215f, 0.0255406116f, 0.0254630783f,
+    0.0253846182f, 0.0253052347f, 0.0252249312f, 0.0251437111f,
+    0.0250615778f, 0.0249785347f, 0.0248945855f, 0.0248097335f,
+    0.0247239824f, 0.0246373358f, 0.0245497972f, 0.0244613704f,
+    0.0243720591f, 0.0242818669f, 0.0241907976f, 0.0240988551f,
+    0.0240060431f, 0.0239123654f, 0.023817826f, 0.0237224288f,
+    0.0236261776f, 0.0235290766f, 0.0234311296f, 0.0233323407f,
+    0.023232714f, 0.0231322535f, 0.0230309635f, 0.0229288479f,
+    0.0228259111f, 0.0227221572f, 0.0226175905f, 0.0225122151f,
+    0.0224060355f, 0.022299056f, 0.0221912808f, 0.0220827144f,
+    0.0219733612f, 0.0218632256f, 0.0217523121f, 0.0216406252f,
+    0.0215281694f, 0.0214149492f, 0.0213009691f, 0.0211862339f,
+    0.0210707482f, 0.0209545165f, 0.0208375435f, 0.020719834f,
+    0.0206013927f, 0.0204822244f, 0.0203623337f, 0.0202417256f,
+    0.0201204049f, 0.0199983763f, 0.0198756449f, 0.0197522154f,
+    0.0196280928f, 0.0195032821f, 0.0193777883f, 0.0192516163f,
+    0.0191247711f, 0.0189972579f, 0.0188690817f, 0.0187402475f,
+    0.0186107605f, 0.0184806258f, 0.0183498486f, 0.0182184341f,
+    0.0180863874f, 0.0179537138f, 0.0178204186f, 0.0176865069f,
+    0.0175519842f, 0.0174168556f, 0.0172811265f, 0.0171448024f,
+    0.0170078884f, 0.0168703901f, 0.0167323128f, 0.016593662f,
+    0.0164544431f, 0.0163146616f, 0.016174323f, 0.0160334327f,
+    0.0158919963f, 0.0157500194f, 0.0156075075f, 0.0154644661f,
+    0.0153209009f, 0.0151768175f, 0.0150322215f, 0.0148871186f,
+    0.0147415143f, 0.0145954145f, 0.0144488248f, 0.0143017508f,
+    0.0141541984f, 0.0140061733f, 0.0138576812f, 0.013708728f,
+    0.0135593193f, 0.013409461f, 0.013259159f, 0.013108419f,
+    0.0129572469f, 0.0128056485f, 0.0126536298f, 0.0125011966f,
+    0.0123483548f, 0.0121951104f, 0.0120414692f, 0.0118874373f,
+    0.0117330204f, 0.0115782247f, 0.0114230561f, 0.0112675205f,
+    0.011111624f, 0.0109553726f, 0.0107987723f, 0.0106418291f,
+    0.0104845491f, 0.0103269383f, 0.0101690028f, 0.0100107487f,
+    0.00985218193f, 0.00969330872f, 0.00953413513f, 0.00937466727f,
+    0.00921491125f, 0.0090548732f, 0.00889455925f, 0.00873397553f,
+    0.0085731282f, 0.00841202341f, 0.00825066732f, 0.00808906611f,
+    0.00792722594f, 0.007765153f, 0.00760285348f, 0.00744033358f,
+    0.00727759948f, 0.00711465741f, 0.00695151357f, 0.00678817417f,
+    0.00662464544f, 0.0064609336f, 0.00629704489f, 0.00613298553f,
+    0.00596876177f, 0.00580437984f, 0.005639846f, 0.00547516649f,
+    0.00531034755f, 0.00514539545f, 0.00498031644f, 0.00481511678f,
+    0.00464980273f, 0.00448438055f, 0.00431885651f, 0.00415323687f,
+    0.0039875279f, 0.00382173586f, 0.00365586702f, 0.00348992765f,
+    0.00332392402f, 0.00315786239f, 0.00299174903f, 0.00282559022f,
+    0.00265939221f, 0.00249316127f, 0.00232690367f, 0.00216062566f,
+    0.00199433352f, 0.00182803348f, 0.00166173182f, 0.00149543479f,
+    0.00132914863f, 0.0011628796f, 0.000996633936f, 0.000830417885f,
+    0.000664237685f, 0.000498099568f, 0.000332009765f, 0.000165974502f,
+    1.32512583e-16f, -0.000165907525f, -0.000331741862f, -0.000497496804f,
+    -0.000663166151f, -0.000828743708f, -0.000994223287f, -0.0011595987f,
+    -0.00132486378f, -0.00149001235f, -0.00165503825f, -0.00181993532f,
+    -0.00198469742f, -0.0021493184f, -0.00231379214f, -0.0024781125f,
+    -0.00264227336f, -0.00280626863f, -0.0029700922f, -0.00313373798f,
+    -0.00329719988f, -0.00346047184f, -0.00362354779f, -0.00378642168f,
+    -0.00394908747f, -0.00411153912f, -0.00427377061f, -0.00443577593f,
+    -0.00459754908f, -0.00475908407f, -0.00492037492f, -0.00508141566f,
+    -0.00524220034f, -0.00540272301f, -0.00556297775f, -0.00572295864f,
+    -0.00588265977f, -0.00604207525f, -0.00620119919f, -0.00636002574f,
+    -0.00651854904f, -0.00667676325f, -0.00683466254f, -0.0069922411f,
+    -0.00714949315f, -0.00730641289f, -0.00746299456f, -0.0076192324f,
+    -0.00777512068f, -0.00793065368f, -0.00808582569f, -0.00824063102f,
+    -0.008395064f, -0.00854911897f, -0.00870279029f, -0.00885607233f,
+    -0.00900895948f, -0.00916144616f, -0.00931352679f, -0.00946519581f,
+    -0.00961644769f, -0.00976727691f, -0.00991767796f, -0.0100676454f,
+    -0.0102171736f, -0.0103662574f, -0.0105148911f, -0.0106630694f,
+    -0.0108107869f, -0.0109580383f, -0.0111048182f, -0.0112511212f,
+    -0.0113969421f, -0.0115422755f, -0.0116871162f, -0.011831459f,
+    -0.0119752985f, -0.0121186297f, -0.0122614473f, -0.0124037461f,
+    -0.012545521f, -0.0126867669f, -0.0128274787f, -0.0129676513f,
+    -0.0131072796f, -0.0132463587f, -0.0133848834f, -0.0135228489f,
+    -0.0136602502f, -0.0137970822f, -0.0139333401f, -0.0140690191f,
+    -0.0142041141f, -0.0143386204f, -0.0144725332f, -0.0146058477f,
+    -0.014738559f, -0.0148706625f, -0.0150021533f, -0.0151330269f,
+    -0.0152632785f, -0.0153929035f, -0.0155218972f, -0.0156502551f,
+    -0.0157779726f, -0.0159050451f, -0.0160314681f, -0.0161572372f,
+    -0.0162823478f, -0.0164067955f, -0.0165305758f, -0.0166536845f,
+    -0.0167761171f, -0.0168978694f, -0.0170189369f, -0.0171393154f,
+    -0.0172590007f, -0.0173779885f, -0.0174962747f, -0.017613855f,
+    -0.0177307254f, -0.0178468817f, -0.0179623198f, -0.0180770357f,
+    -0.0181910254f, -0.0183042847f, -0.0184168099f, -0.0185285969f,
+    -0.0186396419f, -0.0187499409f, -0.0188594901f, -0.0189682856f,
+    -0.0190763238f, -0.0191836008f, -0.0192901128f, -0.0193958563f,
+    -0.0195008274f, -0.0196050227f, -0.0197084384f, -0.019811071f,
+    -0.0199129169f, -0.0200139726f, -0.0201142347f, -0.0202136996f,
+    -0.020312364f, -0.0204102245f, -0.0205072776f, -0.0206035201f,
+    -0.0206989486f, -0.02079356f, -0.0208873509f, -0.0209803182f,
+    -0.0210724587f, -0.0211637692f, -0.0212542467f, -0.021343888f,
+    -0.0214326902f, -0.0215206502f, -0.0216077651f, -0.0216940319f,
+    -0.0217794477f, -0.0218640096f, -0.0219477148f, -0.0220305604f,
+    -0.0221125438f, -0.0221936621f, -0.0222739127f, -0.0223532928f,
+    -0.0224317999f, -0.0225094313f, -0.0225861844f, -0.0226620567f,
+    -0.0227370458f, -0.0228111491f, -0.0228843642f, -0.0229566886f,
+    -0.0230281201f, -0.0230986563f, -0.0231682949f, -0.0232370336f,
+    -0.0233048702f, -0.0233718025f, -0.0234378283f, -0.0235029455f,
+    -0.0235671521f, -0.0236304459f, -0.023692825f, -0.0237542874f,
+    -0.023814831f, -0.023874454f, -0.0239331546f, -0.0239909308f,
+    -0.0240477809f, -0.0241037031f, -0.0241586957f, -0.0242127568f,
+    -0.024265885f, -0.0243180785f, -0.0243693358f, -0.0244196553f,
+    -0.0244690354f, -0.0245174747f, -0.0245649718f, -0.0246115252f,
+    -0.0246571335f, -0.0247017954f, -0.0247455096f, -0.0247882748f,
+    -0.0248300898f, -0.0248709534f, -0.0249108644f, -0.0249498216f,
+    -0.0249878241f, -0.0250248708f, -0.0250609605f, -0.0250960924f,
+    -0.0251302655f, -0.0251634789f, -0.0251957317f, -0.0252270231f,
+    -0.0252573523f, -0.0252867185f, -0.025315121f, -0.0253425591f,
+    -0.0253690321f, -0.0253945395f, -0.0254190806f, -0.0254426549f,
+    -0.025465262f, -0.0254869012f, -0.0255075723f, -0.0255272747f,
+    -0.0255460082f, -0.0255637724f, -0.025580567f, -0.0255963918f,
+    -0.0256112465f, -0.0256251311f, -0.0256380452f, -0.0256499889f,
+    -0.025660962f, -0.0256709645f, -0.0256799965f, -0.0256880579f,
+    -0.0256951489f, -0.0257012695f, -0.02570642f, -0.0257106004f,
+    -0.025713811f, -0.0257160522f, -0.025717324f, -0.025717627f,
+    -0.0257169614f, -0.0257153277f, -0.0257127263f, -0.0257091577f,
+    -0.0257046224f, -0.0256991209f, -0.0256926539f, -0.0256852219f,
+    -0.0256768256f, -0.0256674656f, -0.0256571429f, -0.0256458579f,
+    -0.0256336117f, -0.025620405f, -0.0256062387f, -0.0255911137f,
+    -0.0255750309f, -0.0255579914f, -0.0255399961f, -0.025521046f,
+    -0.0255011424f, -0.0254802862f, -0.0254584786f, -0.0254357209f,
+    -0.0254120143f, -0.02538736f, -0.0253617593f, -0.0253352135f,
+    -0.0253077241f, -0.0252792923f, -0.0252499198f, -0.0252196078f,
+    -0.025188358f, -0.0251561718f, -0.0251230509f, -0.0250889968f,
+    -0.0250540113f, -0.0250180959f, -0.0249812523f, -0.0249434825f,
+    -0.024904788f, -0.0248651707f, -0.0248246326f, -0.0247831754f,
+    -0.024740801f, -0.0246975115f, -0.0246533088f, -0.0246081949f,
+    -0.0245621719f, -0.0245152419f, -0.0244674069f, -0.0244186692f,
+    -0.0243690308f, -0.0243184941f, -0.0242670613f, -0.0242147346f,
+    -0.0241615164f, -0.024107409f, -0.0240524148f, -0.0239965362f,
+    -0.0239397757f, -0.0238821357f, -0.0238236188f, -0.0237642274f,
+    -0.0237039642f, -0.0236428317f, -0.0235808327f, -0.0235179697f,
+    -0.0234542454f, -0.0233896627f, -0.0233242242f, -0.0232579327f,
+    -0.0231907912f, -0.0231228023f, -0.023053969f, -0.0229842943f,
+    -0.022913781f, -0.0228424322f, -0.0227702508f, -0.0226972399f,
+    -0.0226234026f, -0.0225487419f, -0.022473261f, -0.0223969631f,
+    -0.0223198512f, -0.0222419287f, -0.0221631988f, -0.0220836647f,
+    -0.0220033297f, -0.0219221973f, -0.0218402707f, -0.0217575533f,
+    -0.0216740486f, -0.0215897599f, -0.0215046909f, -0.0214188449f,
+    -0.0213322254f, -0.0212448362f, -0.0211566806f, -0.0210677624f,
+    -0.0209780852f, -0.0208876527f, -0.0207964685f, -0.0207045363f,
+    -0.02061186f, -0.0205184432f, -0.0204242898f, -0.0203294036f,
+    -0.0202337885f, -0.0201374483f, -0.0200403869f, -0.0199426083f,
+    -0.0198441164f, -0.0197449152f, -0.0196450087f, -0.0195444009f,
+    -0.0194430959f, -0.0193410978f, -0.0192384106f, -0.0191350385f,
+    -0.0190309857f, -0.0189262563f, -0.0188208544f, -0.0187147845f,
+    -0.0186080506f, -0.0185006571f, -0.0183926082f, -0.0182839083f,
+    -0.0181745617f, -0.0180645727f, -0.0179539458f, -0.0178426854f,
+    -0.0177307958f, -0.0176182816f, -0.0175051471f, -0.017391397f,
+    -0.0172770357f, -0.0171620677f, -0.0170464976f, -0.01693033f,
+    -0.0168135695f, -0.0166962207f, -0.0165782882f, -0.0164597767f,
+    -0.0163406909f, -0.0162210355f, -0.0161008152f, -0.0159800347f,
+    -0.0158586988f, -0.0157368122f, -0.0156143798f, -0.0154914064f,
+    -0.0153678968f, -0.0152438559f, -0.0151192885f, -0.0149941995f,
+    -0.0148685938f, -0.0147424764f, -0.0146158522f, -0.0144887261f,
+    -0.0143611031f, -0.0142329882f, -0.0141043864f, -0.0139753027f,
+    -0.0138457422f, -0.01371571f, -0.013585211f, -0.0134542505f,
+    -0.0133228334f, -0.0131909649f, -0.0130586501f, -0.0129258943f,
+    -0.0127927025f, -0.0126590799f, -0.0125250317f, -0.0123905631f,
+    -0.0122556794f, -0.0121203857f, -0.0119846874f, -0.0118485896f,
+    -0.0117120977f, -0.0115752168f, -0.0114379525f, -0.0113003098f,
+    -0.0111622942f, -0.011023911f, -0.0108851655f, -0.0107460631f,
+    -0.0106066091f, -0.010466809f, -0.0103266681f, -0.0101861919f,
+    -0.0100453856f, -0.00990425488f, -0.00976280501f, -0.00962104147f,
+    -0.00947896971f, -0.00933659521f, -0.00919392341f, -0.00905095982f,
+    -0.0089077099f, -0.00876417917f, -0.00862037312f, -0.00847629728f,
+    -0.00833195715f, -0.00818735827f, -0.00804250619f, -0.00789740643f,
+    -0.00775206456f, -0.00760648613f, -0.00746067671f, -0.00731464187f,
+    -0.00716838719f, -0.00702191825f, -0.00687524065f, -0.00672835998f,
+    -0.00658128183f, -0.00643401183f, -0.00628655558f, -0.00613891869f,
+    -0.00599110679f, -0.00584312551f, -0.00569498048f, -0.00554667732f,
+    -0.00539822168f, -0.0052496192f, -0.00510087552f, -0.0049519963f,
+    -0.00480298717f, -0.00465385381f, -0.00450460186f, -0.00435523698f,
+    -0.00420576483f, -0.00405619108f, -0.00390652139f, -0.00375676143f,
+    -0.00360691685f, -0.00345699334f, -0.00330699656f, -0.00315693218f,
+    -0.00300680586f, -0.00285662329f, -0.00270639012f, -0.00255611203f,
+    -0.00240579469f, -0.00225544376f, -0.00210506492f, -0.00195466383f,
+    -0.00180424616f, -0.00165381757f, -0.00150338372f, -0.00135295027f,
+    -0.00120252288f, -0.0010521072f, -0.000901708899f, -0.000751333613f,
+    -0.000600986993f, -0.000450674683f, -0.000300402323f, -0.000150175551f,
+    -3.59610135e-17f, 0.000150118701f, 0.000300174928f, 0.000450163061f,
+    0.000600077482f, 0.000749912583f, 0.000899662756f, 0.0010493224f,
+    0.00119888593f, 0.00134834774f, 0.00149770226f, 0.00164694391f,
+    0.00179606712f, 0.00194506632f, 0.00209393595f, 0.00224267048f,
+    0.00239126434f, 0.00253971202f, 0.00268800797f, 0.00283614668f,
+    0.00298412264f, 0.00313193034f, 0.00327956428f, 0.00342701898f,
+    0.00357428897f, 0.00372136876f, 0.00386825291f, 0.00401493595f,
+    0.00416141245f, 0.00430767698f, 0.00445372412f, 0.00459954844f,
+    0.00474514457f, 0.00489050709f, 0.00503563064f, 0.00518050984f,
+    0.00532513934f, 0.0054695138f, 0.00561362787f, 0.00575747624f,
+    0.00590105359f, 0.00604435463f, 0.00618737407f, 0.00633010664f,
+    0.00647254708f, 0.00661469013f, 0.00675653057f, 0.00689806318f,
+    0.00703928274f, 0.00718018406f, 0.00732076197f, 0.0074610113f,
+    0.00760092689f, 0.00774050361f, 0.00787973633f, 0.00801861995f,
+    0.00815714938f, 0.00829531954f, 0.00843312536f, 0.0085705618f,
+    0.00870762384f, 0.00884430645f, 0.00898060463f, 0.00911651341f,
+    0.00925202782f, 0.00938714291f, 0.00952185374f, 0.00965615541f,
+    0.00979004301f, 0.00992351167f, 0.0100565565f, 0.0101891727f,
+    0.0103213554f, 0.0104530999f, 0.0105844012f, 0.0107152547f,
+    0.0108456556f, 0.0109755991f, 0.0111050806f, 0.0112340953f,
+    0.0113626386f, 0.0114907058f, 0.0116182923f, 0.0117453935f,
+    0.0118720046f, 0.0119981213f, 0.0121237389f, 0.0122488528f,
+    0.0123734586f, 0.0124975518f, 0.0126211279f, 0.0127441824f,
+    0.0128667109f, 0.012988709f, 0.0131101723f, 0.0132310964f,
+    0.013351477f, 0.0134713098f, 0.0135905904f, 0.0137093146f,
+    0.0138274782f, 0.0139450768f, 0.0140621063f, 0.0141785625f,
+    0.0142944412f, 0.0144097382f, 0.0145244496f, 0.014638571f,
+    0.0147520986f, 0.0148650282f, 0.0149773559f, 0.0150890775f,
+    0.0152001892f, 0.015310687f, 0.015420567f, 0.0155298252f,
+    0.0156384578f, 0.0157464609f, 0.0158538307f, 0.0159605635f,
+    0.0160666553f, 0.0161721025f, 0.0162769014f, 0.0163810482f,
+    0.0164845393f, 0.0165873711f, 0.0166895398f, 0.0167910419f,
+    0.0168918739f, 0.0169920322f, 0.0170915132f, 0.0171903136f,
+    0.0172884297f, 0.0173858583f, 0.0174825959f, 0.017578639f,
+    0.0176739844f, 0.0177686288f, 0.0178625687f, 0.017955801f,
+    0.0180483224f, 0.0181401297f, 0.0182312198f, 0.0183215893f,
+    0.0184112353f, 0.0185001546f, 0.0185883442f, 0.0186758009f,
+    0.0187625218f, 0.018848504f, 0.0189337443f, 0.0190182399f,
+    0.019101988f, 0.0191849856f, 0.0192672298f, 0.0193487179f,
+    0.0194294472f, 0.0195094147f, 0.0195886179f, 0.019667054f,
+    0.0197447203f, 0.0198216142f, 0.0198977332f, 0.0199730746f,
+    0.0200476358f, 0.0201214145f, 0.020194408f, 0.020266614f,
+    0.0203380299f, 0.0204086535f, 0.0204784824f, 0.0205475142f,
+    0.0206157466f, 0.0206831773f, 0.0207498042f, 0.020815625f,
+    0.0208806375f, 0.0209448396f, 0.0210082292f, 0.0210708041f,
+    0.0211325624f, 0.021193502f, 0.021253621f, 0.0213129173f,
+    0.021371389f, 0.0214290343f, 0.0214858513f, 0.0215418382f,
+    0.0215969931f, 0.0216513143f, 0.0217048001f, 0.0217574487f,
+    0.0218092585f, 0.0218602279f, 0.0219103552f, 0.0219596389f,
+    0.0220080774f, 0.0220556692f, 0.0221024129f, 0.022148307f,
+    0.02219335f, 0.0222375407f, 0.0222808776f, 0.0223233595f,
+    0.022364985f, 0.022405753f, 0.0224456622f, 0.0224847113f,
+    0.0225228994f, 0.0225602251f, 0.0225966876f, 0.0226322856f,
+    0.0226670183f, 0.0227008845f, 0.0227338834f, 0.022766014f,
+    0.0227972755f, 0.0228276669f, 0.0228571876f, 0.0228858366f,
+    0.0229136132f, 0.0229405167f, 0.0229665464f, 0.0229917017f,
+    0.0230159818f, 0.0230393864f, 0.0230619147f, 0.0230835663f,
+    0.0231043406f, 0.0231242372f, 0.0231432558f, 0.0231613958f,
+    0.0231786569f, 0.0231950389f, 0.0232105413f, 0.0232251641f,
+    0.0232389068f, 0.0232517694f, 0.0232637517f, 0.0232748535f,
+    0.0232850748f, 0.0232944155f, 0.0233028756f, 0.023310455f,
+    0.0233171539f, 0.0233229722f, 0.0233279102f, 0.0233319679f,
+    0.0233351455f, 0.0233374432f, 0.0233388612f, 0.0233393999f,
+    0.0233390595f, 0.0233378403f, 0.0233357428f, 0.0233327673f,
+    0.0233289143f, 0.0233241842f, 0.0233185776f, 0.0233120949f,
+    0.0233047367f, 0.0232965037f, 0.0232873964f, 0.0232774156f,
+    0.0232665618f, 0.023254836f, 0.0232422387f, 0.0232287709f,
+    0.0232144333f, 0.0231992268f, 0.0231831522f, 0.0231662106f,
+    0.0231484028f, 0.0231297299f, 0.0231101929f, 0.0230897928f,
+    0.0230685307f, 0.0230464077f, 0.023023425f, 0.0229995837f,
+    0.0229748851f, 0.0229493305f, 0.022922921f, 0.022895658f,
+    0.0228675428f, 0.0228385768f, 0.0228087614f, 0.0227780981f,
+    0.0227465882f, 0.0227142334f, 0.022681035f, 0.0226469948f,
+    0.0226121142f, 0.0225763949f, 0.0225398386f, 0.0225024468f,
+    0.0224642214f, 0.0224251641f, 0.0223852766f, 0.0223445608f,
+    0.0223030185f, 0.0222606515f, 0.0222174618f, 0.0221734512f,
+    0.0221286218f, 0.0220829755f, 0.0220365144f, 0.0219892404f,
+    0.0219411557f, 0.0218922623f, 0.0218425624f, 0.0217920582f,
+    0.0217407519f, 0.0216886456f, 0.0216357417f, 0.0215820424f,
+    0.02152755f, 0.0214722668f, 0.0214161953f, 0.0213593379f,
+    0.0213016969f, 0.0212432747f, 0.021184074f, 0.0211240972f,
+    0.0210633469f, 0.0210018255f, 0.0209395358f, 0.0208764803f,
+    0.0208126616f, 0.0207480826f, 0.0206827458f, 0.020616654f,
+    0.02054981f, 0.0204822165f, 0.0204138764f, 0.0203447925f,
+    0.0202749677f, 0.0202044049f, 0.020133107f, 0.0200610769f,
+    0.0199883177f, 0.0199148323f, 0.0198406238f, 0.0197656952f,
+    0.0196900496f, 0.0196136901f, 0.0195366198f, 0.0194588419f,
+    0.0193803596f, 0.0193011762f, 0.0192212947f, 0.0191407185f,
+    0.0190594509f, 0.0189774951f, 0.0188948546f, 0.0188115326f,
+    0.0187275326f, 0.018642858f, 0.0185575121f, 0.0184714985f,
+    0.0183848206f, 0.0182974819f, 0.018209486f, 0.0181208364f,
+    0.0180315366f, 0.0179415903f, 0.0178510011f, 0.0177597727f,
+    0.0176679086f, 0.0175754126f, 0.0174822884f, 0.0173885397f,
+    0.0172941703f, 0.0171991839f, 0.0171035844f, 0.0170073755f,
+    0.0169105612f, 0.0168131452f, 0.0167151314f, 0.0166165239f,
+    0.0165173264f, 0.0164175429f, 0.0163171774f, 0.016216234f,
+    0.0161147164f, 0.016012629f, 0.0159099755f, 0.0158067602f,
+    0.0157029871f, 0.0155986604f, 0.0154937841f, 0.0153883623f,
+    0.0152823994f, 0.0151758993f, 0.0150688664f, 0.0149613049f,
+    0.014853219f, 0.0147446129f, 0.0146354909f, 0.0145258574f,
+    0.0144157166f, 0.0143050728f, 0.0141939305f, 0.0140822939f,
+    0.0139701674f, 0.0138575555f, 0.0137444625f, 0.0136308929f,
+    0.0135168512f, 0.0134023417f, 0.0132873689f, 0.0131719375f,
+    0.0130560518f, 0.0129397163f, 0.0128229357f, 0.0127057145f,
+    0.0125880572f, 0.0124699685f, 0.0123514529f, 0.012232515f,
+    0.0121131595f, 0.011993391f, 0.0118732142f, 0.0117526337f,
+    0.0116316542f, 0.0115102804f, 0.0113885171f, 0.0112663689f,
+    0.0111438406f, 0.0110209369f, 0.0108976625f, 0.0107740224f,
+    0.0106500212f, 0.0105256637f, 0.0104009547f, 0.0102758991f,
+    0.0101505017f, 0.0100247673f, 0.00989870079f, 0.00977230702f,
+    0.00964559088f, 0.00951855722f, 0.00939121096f, 0.009263557f,
+    0.00913560025f, 0.00900734562f, 0.00887879806f, 0.00874996251f,
+    0.00862084391f, 0.00849144722f, 0.00836177743f, 0.00823183949f,
+    0.00810163839f, 0.00797117913f, 0.00784046672f, 0.00770950615f,
+    0.00757830244f, 0.00744686062f, 0.00731518572f, 0.00718328277f,
+    0.00705115683f, 0.00691881293f, 0.00678625614f, 0.00665349152f,
+    0.00652052414f, 0.00638735908f, 0.00625400142f, 0.00612045623f,
+    0.00598672863f, 0.00585282369f, 0.00571874652f, 0.00558450223f,
+    0.00545009593f, 0.00531553274f, 0.00518081776f, 0.00504595613f,
+    0.00491095297f, 0.00477581341f, 0.00464054259f, 0.00450514563f,
+    0.00436962768f, 0.00423399388f, 0.00409824938f, 0.00396239931f,
+    0.00382644884f, 0.0036904031f, 0.00355426726f, 0.00341804646f,
+    0.00328174587f, 0.00314537063f, 0.00300892591f, 0.00287241686f,
+    0.00273584864f, 0.00259922642f, 0.00246255534f, 0.00232584057f,
+    0.00218908727f, 0.0020523006f, 0.00191548571f, 0.00177864776f,
+    0.00164179191f, 0.00150492331f, 0.00136804712f, 0.00123116849f,
+    0.00109429256f, 0.000957424496f, 0.000820569433f, 0.000683732517f,
+    0.00054691889f, 0.000410133691f, 0.000273382055f, 0.000136669115f,
+    -4.36636999e-17f, -0.000136620164f, -0.000273186254f, -0.000409693152f,
+    -0.000546135745f, -0.000682508921f, -0.000818807575f, -0.000955026607f,
+    -0.00109116092f, -0.00122720542f, -0.00136315503f, -0.00149900466f,
+    -0.00163474924f, -0.00177038369f, -0.00190590297f, -0.002041302f,
+    -0.00217657574f, -0.00231171914f, -0.00244672717f, -0.00258159479f,
+    -0.00271631699f, -0.00285088874f, -0.00298530503f, -0.00311956087f,
+    -0.00325365127f, -0.00338757122f, -0.00352131577f, -0.00365487993f,
+    -0.00378825876f, -0.00392144729f, -0.00405444058f, -0.00418723371f,
+    -0.00431982174f, -0.00445219977f, -0.00458436288f, -0.00471630618f,
+    -0.00484802479f, -0.00497951383f, -0.00511076843f, -0.00524178375f,
+    -0.00537255493f, -0.00550307715f, -0.00563334558f, -0.00576335541f,
+    -0.00589310185f, -0.0060225801f, -0.0061517854f, -0.00628071297f,
+    -0.00640935807f, -0.00653771595f, -0.0066657819f, -0.00679355119f,
+    -0.00692101913f, -0.00704818102f, -0.0071750322f, -0.007301568f,
+    -0.00742778377f, -0.00755367487f, -0.0076792367f, -0.00780446463f,
+    -0.00792935409f, -0.00805390048f, -0.00817809925f, -0.00830194585f,
+    -0.00842543574f, -0.00854856441f, -0.00867132734f, -0.00879372007f,
+    -0.0089157381f, -0.00903737698f, -0.00915863227f, -0.00927949956f,
+    -0.00939997441f, -0.00952005245f, -0.0096397293f, -0.0097590006f,
+    -0.009877862f, -0.00999630918f, -0.0101143378f, -0.0102319437f,
+    -0.0103491224f, -0.0104658698f, -0.0105821815f, -0.0106980535f,
+    -0.0108134815f, -0.0109284612f, -0.0110429886f, -0.0111570595f,
+    -0.0112706697f, -0.0113838152f, -0.0114964918f, -0.0116086955f,
+    -0.0117204222f, -0.0118316679f, -0.0119424286f, -0.0120527003f,
+    -0.0121624789f, -0.0122717607f, -0.0123805415f, -0.0124888176f,
+    -0.0125965849f, -0.0127038397f, -0.0128105781f, -0.0129167962f,
+    -0.0130224903f, -0.0131276565f, -0.013232291f, -0.0133363902f,
+    -0.0134399503f, -0.0135429676f, -0.0136454384f, -0.0137473591f,
+    -0.013848726f, -0.0139495354f, -0.0140497839f, -0.0141494678f,
+    -0.0142485835f, -0.0143471276f, -0.0144450966f, -0.0145424869f,
+    -0.0146392951f, -0.0147355178f, -0.0148311515f, -0.0149261929f,
+    -0.0150206386f, -0.0151144852f, -0.0152077295f, -0.0153003681f,
+    -0.0153923977f, -0.0154838152f, -0.0155746173f, -0.0156648008f,
+    -0.0157543625f, -0.0158432993f, -0.0159316081f, -0.0160192857f,
+    -0.016106329f, -0.0161927351f, -0.0162785009f, -0.0163636234f,
+    -0.0164480996f, -0.0165319266f, -0.0166151015f, -0.0166976212f,
+    -0.0167794831f, -0.0168606842f, -0.0169412217f, -0.0170210928f,
+    -0.0171002947f, -0.0171788248f, -0.0172566802f, -0.0173338583f,
+    -0.0174103564f, -0.017486172f, -0.0175613023f, -0.0176357448f,
+    -0.0177094969f, -0.0177825561f, -0.0178549199f, -0.0179265858f,
+    -0.0179975515f, -0.0180678143f, -0.018137372f, -0.0182062222f,
+    -0.0182743625f, -0.0183417907f, -0.0184085043f, -0.0184745013f,
+    -0.0185397793f, -0.0186043362f, -0.0186681698f, -0.0187312779f,
+    -0.0187936583f, -0.0188553092f, -0.0189162282f, -0.0189764135f,
+    -0.019035863f, -0.0190945748f, -0.0191525468f, -0.0192097772f,
+    -0.0192662641f, -0.0193220055f, -0.0193769998f, -0.019431245f,
+    -0.0194847395f, -0.0195374813f, -0.0195894689f, -0.0196407006f,
+    -0.0196911746f, -0.0197408893f, -0.0197898432f, -0.0198380347f,
+    -0.0198854622f, -0.0199321241f, -0.0199780191f, -0.0200231457f,
+    -0.0200675024f, -0.0201110878f, -0.0201539005f, -0.0201959393f,
+    -0.0202372029f, -0.0202776898f, -0.0203173989f, -0.020356329f,
+    -0.0203944789f, -0.0204318474f, -0.0204684333f, -0.0205042357f,
+    -0.0205392533f, -0.0205734852f, -0.0206069304f, -0.0206395878f,
+    -0.0206714565f, -0.0207025357f, -0.0207328243f, -0.0207623216f,
+    -0.0207910266f, -0.0208189387f, -0.020846057f, -0.0208723809f,
+    -0.0208979094f, -0.0209226421f, -0.0209465783f, -0.0209697172f,
+    -0.0209920584f, -0.0210136013f, -0.0210343453f, -0.0210542899f,
+    -0.0210734347f, -0.0210917793f, -0.0211093231f, -0.021126066f,
+    -0.0211420074f, -0.021157147f, -0.0211714847f, -0.0211850201f,
+    -0.0211977529f, -0.0212096831f, -0.0212208104f, -0.0212311347f,
+    -0.0212406559f, -0.0212493739f, -0.0212572887f, -0.0212644002f,
+    -0.0212707084f, -0.0212762135f, -0.0212809154f, -0.0212848143f,
+    -0.0212879104f, -0.0212902037f, -0.0212916944f, -0.0212923829f,
+    -0.0212922693f, -0.021291354f, -0.0212896372f, -0.0212871193f,
+    -0.0212838007f, -0.0212796817f, -0.0212747629f, -0.0212690446f,
+    -0.0212625274f, -0.0212552118f, -0.0212470984f, -0.0212381876f,
+    -0.0212284803f, -0.0212179769f, -0.0212066781f, -0.0211945847f,
+    -0.0211816975f, -0.021168017f, -0.0211535443f, -0.0211382799f,
+    -0.021122225f, -0.0211053802f, -0.0210877465f, -0.0210693249f,
+    -0.0210501163f, -0.0210301217f, -0.0210093421f, -0.0209877786f,
+    -0.0209654323f, -0.0209423044f, -0.0209183958f, -0.0208937079f,
+    -0.0208682417f, -0.0208419986f, -0.0208149798f, -0.0207871866f,
+    -0.0207586203f, -0.0207292822f, -0.0206991737f, -0.0206682962f,
+    -0.0206366512f, -0.0206042401f, -0.0205710644f, -0.0205371256f,
+    -0.0205024252f, -0.0204669649f, -0.0204307462f, -0.0203937707f,
+    -0.0203560401f, -0.0203175561f, -0.0202783204f, -0.0202383347f,
+    -0.0201976008f, -0.0201561204f, -0.0201138955f, -0.0200709279f,
+    -0.0200272194f, -0.0199827719f, -0.0199375873f, -0.0198916677f,
+    -0.019845015f, -0.0197976312f, -0.0197495183f, -0.0197006785f,
+    -0.0196511137f, -0.0196008262f, -0.019549818f, -0.0194980914f,
+    -0.0194456484f, -0.0193924915f, -0.0193386227f, -0.0192840444f,
+    -0.0192287589f, -0.0191727684f, -0.0191160754f, -0.0190586823f,
+    -0.0190005913f, -0.018941805f, -0.0188823258f, -0.0188221563f,
+    -0.0187612987f, -0.0186997559f, -0.0186375301f, -0.0185746242f,
+    -0.0185110406f, -0.0184467819f, -0.0183818509f, -0.0183162502f,
+    -0.0182499825f, -0.0181830506f, -0.0181154571f, -0.0180472049f,
+    -0.0179782967f, -0.0179087354f, -0.0178385238f, -0.0177676648f,
+    -0.0176961612f, -0.0176240161f, -0.0175512323f, -0.0174778127f,
+    -0.0174037604f, -0.0173290784f, -0.0172537697f, -0.0171778373f,
+    -0.0171012844f, -0.0170241139f, -0.0169463291f, -0.0168679331f,
+    -0.016788929f, -0.01670932f, -0.0166291094f, -0.0165483003f,
+    -0.0164668959f, -0.0163848997f, -0.0163023148f, -0.0162191446f,
+    -0.0161353923f, -0.0160510614f, -0.0159661553f, -0.0158806772f,
+    -0.0157946307f, -0.0157080192f, -0.015620846f, -0.0155331148f,
+    -0.0154448289f, -0.015355992f, -0.0152666074f, -0.0151766789f,
+    -0.0150862099f, -0.0149952041f, -0.014903665f, -0.0148115963f,
+    -0.0147190017f, -0.0146258847f, -0.0145322491f, -0.0144380986f,
+    -0.0143434369f, -0.0142482678f, -0.0141525949f, -0.0140564221f,
+    -0.0139597532f, -0.013862592f, -0.0137649422f, -0.0136668078f,
+    -0.0135681926f, -0.0134691005f, -0.0133695353f, -0.013269501f,
+    -0.0131690015f, -0.0130680408f, -0.0129666228f, -0.0128647514f,
+    -0.0127624307f, -0.0126596647f, -0.0125564574f, -0.0124528128f,
+    -0.012348735f, -0.012244228f, -0.012139296f, -0.0120339429f,
+    -0.011928173f, -0.0118219904f, -0.0117153991f, -0.0116084034f,
+    -0.0115010073f, -0.0113932152f, -0.0112850311f, -0.0111764593f,
+    -0.0110675041f, -0.0109581695f, -0.0108484599f, -0.0107383796f,
+    -0.0106279327f, -0.0105171237f, -0.0104059567f, -0.0102944361f,
+    -0.0101825662f, -0.0100703513f, -0.00995779579f, -0.00984490401f,
+    -0.00973168032f, -0.0096181291f, -0.00950425472f, -0.00939006158f,
+    -0.00927555409f, -0.00916073667f, -0.00904561374f, -0.00893018974f,
+    -0.00881446911f, -0.00869845632f, -0.00858215582f, -0.0084655721f,
+    -0.00834870963f, -0.00823157291f, -0.00811416643f, -0.00799649473f,
+    -0.0078785623f, -0.00776037367f, -0.00764193339f, -0.00752324599f,
+    -0.00740431603f, -0.00728514806f, -0.00716574665f, -0.00704611637f,
+    -0.0069262618f, -0.00680618753f, -0.00668589815f, -0.00656539826f,
+    -0.00644469247f, -0.0063237854f, -0.00620268164f, -0.00608138585f,
+    -0.00595990263f, -0.00583823664f, -0.0057163925f, -0.00559437486f,
+    -0.00547218838f, -0.00534983771f, -0.00522732752f, -0.00510466245f,
+    -0.00498184719f, -0.00485888641f, -0.00473578477f, -0.00461254697f,
+    -0.00448917769f, -0.00436568161f, -0.00424206342f, -0.00411832783f,
+    -0.00399447951f, -0.00387052317f, -0.00374646352f, -0.00362230526f,
+    -0.00349805308f, -0.00337371171f, -0.00324928584f, -0.00312478019f,
+    -0.00300019947f, -0.0028755484f, -0.00275083168f, -0.00262605404f,
+    -0.00250122019f, -0.00237633485f, -0.00225140273f, -0.00212642855f,
+    -0.00200141702f, -0.00187637287f, -0.00175130081f, -0.00162620555f,
+    -0.00150109181f, -0.00137596431f, -0.00125082775f, -0.00112568686f,
+    -0.00100054633f, -0.000875410878f, -0.000750285212f, -0.000625174035f,
+    -0.000500082051f, -0.000375013958f, -0.000249974456f, -0.000124968239f,
+    -3.49130023e-17f, 0.000124925572f, 0.000249803792f, 0.000374629975f,
+    0.000499399444f, 0.000624107522f, 0.000748749539f, 0.000873320826f,
+    0.000997816721f, 0.00112223256f, 0.0012465637f, 0.00137080549f,
+    0.00149495327f, 0.00161900241f, 0.00174294829f, 0.00186678626f,
+    0.0019905117f, 0.00211412001f, 0.00223760656f, 0.00236096676f,
+    0.002484196f, 0.00260728969f, 0.00273024324f, 0.00285305209f,
+    0.00297571164f, 0.00309821735f, 0.00322056466f, 0.003342749f,
+    0.00346476585f, 0.00358661067f, 0.00370827893f, 0.00382976611f,
+    0.0039510677f, 0.00407217921f, 0.00419309614f, 0.004313814f,
+    0.00443432833f, 0.00455463465f, 0.00467472852f, 0.00479460547f,
+    0.00491426109f, 0.00503369093f, 0.00515289059f, 0.00527185565f,
+    0.00539058172f, 0.00550906441f, 0.00562729936f, 0.00574528218f,
+    0.00586300853f, 0.00598047407f, 0.00609767447f, 0.0062146054f,
+    0.00633126255f, 0.00644764164f, 0.00656373837f, 0.00667954847f,
+    0.00679506769f, 0.00691029177f, 0.00702521648f, 0.0071398376f,
+    0.00725415091f, 0.00736815223f, 0.00748183736f, 0.00759520213f,
+    0.0077082424f, 0.00782095401f, 0.00793333283f, 0.00804537476f,
+    0.00815707568f, 0.00826843152f, 0.00837943819f, 0.00849009165f,
+    0.00860038783f, 0.00871032273f, 0.00881989232f, 0.0089290926f,
+    0.00903791959f, 0.00914636932f, 0.00925443784f, 0.00936212122f,
+    0.00946941552f, 0.00957631685f, 0.00968282131f, 0.00978892503f,
+    0.00989462417f, 0.00999991486f, 0.0101047933f, 0.0102092557f,
+    0.0103132982f, 0.0104169171f, 0.0105201086f, 0.010622869f,
+    0.0107251945f, 0.0108270815f, 0.0109285263f, 0.0110295252f,
+    0.0111300745f, 0.0112301706f, 0.01132981f, 0.011428989f,
+    0.011527704f, 0.0116259515f, 0.0117237279f, 0.0118210297f,
+    0.0119178535f, 0.0120141957f, 0.0121100529f, 0.0122054216f,
+    0.0123002985f, 0.01239468f, 0.0124885629f, 0.0125819437f,
+    0.0126748191f, 0.0127671859f, 0.0128590406f, 0.01295038f,
+    0.0130412009f, 0.0131315f, 0.013221274f, 0.0133105198f,
+    0.0133992342f, 0.0134874141f, 0.0135750562f, 0.0136621576f,
+    0.013748715f, 0.0138347255f, 0.0139201859f, 0.0140050932f,
+    0.0140894445f, 0.0141732367f, 0.0142564669f, 0.0143391322f,
+    0.0144212295f, 0.0145027561f, 0.014583709f, 0.0146640853f,
+    0.0147438824f, 0.0148230973f, 0.0149017273f, 0.0149797696f,
+    0.0150572214f, 0.0151340801f, 0.015210343f, 0.0152860073f,
+    0.0153610705f, 0.0154355299f, 0.015509383f, 0.0155826271f,
+    0.0156552597f, 0.0157272783f, 0.0157986803f, 0.0158694634f,
+    0.0159396249f, 0.0160091626f, 0.016078074f, 0.0161463567f,
+    0.0162140084f, 0.0162810267f, 0.0163474093f, 0.0164131539f,
+    0.0164782584f, 0.0165427203f, 0.0166065376f, 0.0166697081f,
+    0.0167322295f, 0.0167940998f, 0.0168553168f, 0.0169158785f,
+    0.0169757829f, 0.0170350277f, 0.0170936112f, 0.0171515312f,
+    0.0172087858f, 0.0172653732f, 0.0173212913f, 0.0173765384f,
+    0.0174311125f, 0.0174850118f, 0.0175382346f, 0.017590779f,
+    0.0176426433f, 0.0176938258f, 0.0177443248f, 0.0177941386f,
+    0.0178432656f, 0.0178917041f, 0.0179394526f, 0.0179865095f,
+    0.0180328732f, 0.0180785423f, 0.0181235153f, 0.0181677907f,
+    0.018211367f, 0.0182542429f, 0.018296417f, 0.0183378879f,
+    0.0183786543f, 0.018418715f, 0.0184580686f, 0.0184967139f,
+    0.0185346497f, 0.0185718747f, 0.018608388f, 0.0186441882f,
+    0.0186792743f, 0.0187136452f, 0.0187472999f, 0.0187802373f,
+    0.0188124564f, 0.0188439563f, 0.018874736f, 0.0189047946f,
+    0.0189341312f, 0.018962745f, 0.0189906351f, 0.0190178007f,
+    0.019044241f, 0.0190699553f, 0.0190949428f, 0.0191192029f,
+    0.0191427349f, 0.0191655381f, 0.019187612f, 0.0192089559f,
+    0.0192295693f, 0.0192494516f, 0.0192686024f, 0.0192870212f,
+    0.0193047075f, 0.0193216609f, 0.019337881f, 0.0193533675f,
+    0.01936812f, 0.0193821382f, 0.0193954218f, 0.0194079706f,
+    0.0194197843f, 0.0194308628f, 0.0194412059f, 0.0194508133f,
+    0.0194596851f, 0.0194678212f, 0.0194752213f, 0.0194818857f,
+    0.0194878141f, 0.0194930067f, 0.0194974635f, 0.0195011846f,
+    0.0195041701f, 0.0195064201f, 0.0195079348f, 0.0195087143f,
+    0.019508759f, 0.019508069f, 0.0195066445f, 0.019504486f,
+    0.0195015937f, 0.019497968f, 0.0194936093f, 0.0194885179f,
+    0.0194826944f, 0.0194761391f, 0.0194688526f, 0.0194608354f,
+    0.019452088f, 0.019442611f, 0.019432405f, 0.0194214706f,
+    0.0194098085f, 0.0193974194f, 0.019384304f, 0.019370463f,
+    0.0193558971f, 0.0193406072f, 0.0193245941f, 0.0193078586f,
+    0.0192904017f, 0.0192722241f, 0.0192533268f, 0.0192337108f,
+    0.0192133771f, 0.0191923266f, 0.0191705603f, 0.0191480795f,
+    0.019124885f, 0.0191009781f, 0.0190763599f, 0.0190510315f,
+    0.0190249941f, 0.018998249f, 0.0189707973f, 0.0189426404f,
+    0.0189137796f, 0.0188842161f, 0.0188539513f, 0.0188229867f,
+    0.0187913235f, 0.0187589632f, 0.0187259073f, 0.0186921572f,
+    0.0186577145f, 0.0186225806f, 0.0185867571f, 0.0185502457f,
+    0.0185130478f, 0.0184751652f, 0.0184365994f, 0.0183973522f,
+    0.0183574252f, 0.0183168203f, 0.0182755391f, 0.0182335834f,
+    0.018190955f, 0.0181476558f, 0.0181036876f, 0.0180590523f,
+    0.0180137517f, 0.0179677879f, 0.0179211628f, 0.0178738782f,
+    0.0178259363f, 0.0177773391f, 0.0177280886f, 0.0176781868f,
+    0.0176276359f, 0.017576438f, 0.0175245952f, 0.0174721097f,
+    0.0174189837f, 0.0173652194f, 0.017310819f, 0.0172557848f,
+    0.0172001191f, 0.0171438242f, 0.0170869023f, 0.0170293559f,
+    0.0169711873f, 0.016912399f, 0.0168529933f, 0.0167929726f,
+    0.0167323395f, 0.0166710965f, 0.0166092459f, 0.0165467904f,
+    0.0164837326f, 0.0164200749f, 0.01635582f, 0.0162909705f,
+    0.016225529f, 0.0161594983f, 0.0160928809f, 0.0160256796f,
+    0.015957897f, 0.0158895361f, 0.0158205994f, 0.0157510898f,
+    0.0156810101f, 0.0156103632f, 0.0155391518f, 0.0154673788f,
+    0.0153950472f, 0.0153221598f, 0.0152487195f, 0.0151747294f,
+    0.0151001923f, 0.0150251113f, 0.0149494894f, 0.0148733295f,
+    0.0147966348f, 0.0147194083f, 0.014641653f, 0.0145633722f,
+    0.0144845688f, 0.014405246f, 0.0143254071f, 0.0142450551f,
+    0.0141641933f, 0.0140828249f, 0.0140009531f, 0.0139185811f,
+    0.0138357122f, 0.0137523498f, 0.013668497f, 0.0135841573f,
+    0.0134993339f, 0.0134140302f, 0.0133282496f, 0.0132419955f,
+    0.0131552712f, 0.0130680802f, 0.012980426f, 0.0128923119f,
+    0.0128037414f, 0.0127147181f, 0.0126252453f, 0.0125353268f,
+    0.0124449658f, 0.0123541661f, 0.0122629312f, 0.0121712647f,
+    0.01207917f, 0.011986651f, 0.0118937111f, 0.011800354f,
+    0.0117065834f, 0.0116124029f, 0.0115178162f, 0.011422827f,
+    0.0113274391f, 0.011231656f, 0.0111354817f, 0.0110389197f,
+    0.0109419739f, 0.0108446481f, 0.010746946f, 0.0106488714f,
+    0.0105504282f, 0.0104516202f, 0.0103524512f, 0.0102529251f,
+    0.0101530457f, 0.0100528169f, 0.00995224261f, 0.00985132671f,
+    0.00975007312f, 0.00964848575f, 0.00954656854f, 0.00944432544f,
+    0.00934176039f, 0.00923887737f, 0.00913568035f, 0.00903217331f,
+    0.00892836027f, 0.00882424521f, 0.00871983217f, 0.00861512516f,
+    0.00851012823f, 0.00840484542f, 0.00829928079f, 0.00819343841f,
+    0.00808732234f, 0.00798093668f, 0.00787428551f, 0.00776737293f,
+    0.00766020307f, 0.00755278002f, 0.00744510792f, 0.00733719091f,
+    0.00722903312f, 0.0071206387f, 0.00701201182f, 0.00690315663f,
+    0.00679407731f, 0.00668477804f, 0.00657526299f, 0.00646553637f,
+    0.00635560238f, 0.00624546521f, 0.00613512908f, 0.00602459821f,
+    0.00591387682f, 0.00580296914f, 0.00569187941f, 0.00558061186f,
+    0.00546917075f, 0.00535756032f, 0.00524578482f, 0.00513384853f,
+    0.0050217557f, 0.0049095106f, 0.00479711752f, 0.00468458072f,
+    0.00457190449f, 0.00445909311f, 0.00434615088f, 0.00423308209f,
+    0.00411989104f, 0.00400658201f, 0.00389315933f, 0.00377962729f,
+    0.00366599021f, 0.00355225238f, 0.00343841814f, 0.00332449178f,
+    0.00321047764f, 0.00309638002f, 0.00298220326f, 0.00286795167f,
+    0.00275362957f, 0.0026392413f, 0.00252479118f, 0.00241028354f,
+    0.0022957227f, 0.00218111299f, 0.00206645875f, 0.0019517643f,
+    0.00183703397f, 0.00172227209f, 0.001607483f, 0.00149267101f,
+    0.00137784046f, 0.00126299568f, 0.00114814098f, 0.00103328071f,
+    0.000918419173f, 0.000803560703f, 0.00068870962f, 0.000573870243f,
+    0.000459046889f, 0.000344243876f, 0.000229465516f, 0.000114716121f,
+    1.0074869e-16f, -0.000114678541f, -0.000229315198f, -0.000343905671f,
+    -0.000458445663f, -0.00057293088f, -0.000687357031f, -0.000801719829f,
+    -0.000916014991f, -0.00103023824f, -0.0011443853f, -0.00125845189f,
+    -0.00137243376f, -0.00148632664f, -0.00160012627f, -0.00171382841f,
+    -0.0018274288f, -0.0019409232f, -0.00205430738f, -0.00216757711f,
+    -0.00228072815f, -0.0023937563f, -0.00250665733f, -0.00261942704f,
+    -0.00273206123f, -0.00284455571f, -0.00295690628f, -0.00306910877f,
+    -0.00318115899f, -0.00329305279f, -0.00340478601f, -0.00351635449f,
+    -0.00362775408f, -0.00373898066f, -0.00385003008f, -0.00396089824f,
+    -0.00407158101f, -0.00418207429f, -0.00429237399f, -0.00440247601f,
+    -0.00451237628f, -0.00462207073f, -0.0047315553f, -0.00484082593f,
+    -0.00494987858f, -0.00505870923f, -0.00516731384f, -0.0052756884f,
+    -0.00538382892f, -0.00549173139f, -0.00559939183f, -0.00570680628f,
+    -0.00581397076f, -0.00592088133f, -0.00602753405f, -0.00613392499f,
+    -0.00624005022f, -0.00634590584f, -0.00645148796f, -0.00655679269f,
+    -0.00666181616f, -0.00676655451f, -0.00687100389f, -0.00697516046f,
+    -0.0070790204f, -0.00718257989f, -0.00728583514f, -0.00738878236f,
+    -0.00749141778f, -0.00759373764f, -0.00769573818f, -0.00779741567f,
+    -0.0078987664f, -0.00799978664f, -0.00810047272f, -0.00820082095f,
+    -0.00830082766f, -0.0084004892f, -0.00849980194f, -0.00859876224f,
+    -0.0086973665f, -0.00879561113f, -0.00889349254f, -0.00899100716f,
+    -0.00908815146f, -0.00918492189f, -0.00928131493f, -0.00937732707f,
+    -0.00947295484f, -0.00956819475f, -0.00966304334f, -0.00975749718f,
+    -0.00985155284f, -0.00994520691f, -0.010038456f, -0.0101312967f,
+    -0.0102237257f, -0.0103157396f, -0.0104073351f, -0.010498509f,
+    -0.0105892578f, -0.0106795783f, -0.0107694673f, -0.0108589215f,
+    -0.0109479377f, -0.0110365127f, -0.0111246433f, -0.0112123263f,
+    -0.0112995586f, -0.011386337f, -0.0114726584f, -0.0115585197f,
+    -0.0116439179f, -0.0117288498f, -0.0118133125f, -0.0118973028f,
+    -0.0119808179f, -0.0120638546f, -0.0121464101f, -0.0122284813f,
+    -0.0123100654f, -0.0123911595f, -0.0124717605f, -0.0125518658f,
+    -0.0126314724f, -0.0127105774f, -0.0127891781f, -0.0128672717f,
+    -0.0129448554f, -0.0130219265f, -0.0130984821f, -0.0131745197f,
+    -0.0132500364f, -0.0133250297f, -0.0133994969f, -0.0134734353f,
+    -0.0135468423f, -0.0136197154f, -0.0136920519f, -0.0137638494f,
+    -0.0138351053f, -0.0139058171f, -0.0139759823f, -0.0140455984f,
+    -0.0141146631f, -0.0141831738f, -0.0142511282f, -0.0143185239f,
+    -0.0143853586f, -0.0144516298f, -0.0145173354f, -0.014582473f,
+    -0.0146470404f, -0.0147110352f, -0.0147744554f, -0.0148372986f,
+    -0.0148995627f, -0.0149612456f, -0.0150223451f, -0.0150828591f,
+    -0.0151427855f, -0.0152021222f, -0.0152608673f, -0.0153190186f,
+    -0.0153765743f, -0.0154335322f, -0.0154898905f, -0.0155456473f,
+    -0.0156008006f, -0.0156553486f, -0.0157092893f, -0.0157626211f,
+    -0.015815342f, -0.0158674502f, -0.0159189441f, -0.0159698218f,
+    -0.0160200817f, -0.0160697221f, -0.0161187412f, -0.0161671375f,
+    -0.0162149093f, -0.0162620551f, -0.0163085732f, -0.0163544621f,
+    -0.0163997203f, -0.0164443463f, -0.0164883386f, -0.0165316958f,
+    -0.0165744165f, -0.0166164991f, -0.0166579424f, -0.0166987451f,
+    -0.0167389056f, -0.0167784229f, -0.0168172956f, -0.0168555224f,
+    -0.0168931021f, -0.0169300335f, -0.0169663154f, -0.0170019467f,
+    -0.0170369263f, -0.0170712529f, -0.0171049256f, -0.0171379434f,
+    -0.017170305f, -0.0172020096f, -0.0172330562f, -0.0172634438f,
+    -0.0172931715f, -0.0173222384f, -0.0173506436f, -0.0173783862f,
+    -0.0174054654f, -0.0174318805f, -0.0174576306f, -0.0174827149f,
+    -0.0175071328f, -0.0175308835f, -0.0175539664f, -0.0175763808f,
+    -0.0175981261f, -0.0176192017f, -0.0176396069f, -0.0176593414f,
+    -0.0176784044f, -0.0176967955f, -0.0177145143f, -0.0177315603f,
+    -0.0177479331f, -0.0177636322f, -0.0177786574f, -0.0177930082f,
+    -0.0178066843f, -0.0178196854f, -0.0178320113f, -0.0178436617f,
+    -0.0178546364f, -0.0178649352f, -0.0178745579f, -0.0178835044f,
+    -0.0178917746f, -0.0178993683f, -0.0179062855f, -0.0179125262f,
+    -0.0179180904f, -0.0179229779f, -0.017927189f, -0.0179307236f,
+    -0.0179335818f, -0.0179357638f, -0.0179372696f, -0.0179380995f,
+    -0.0179382535f, -0.017937732f, -0.0179365352f, -0.0179346633f,
+    -0.0179321167f, -0.0179288955f, -0.0179250002f, -0.0179204312f,
+    -0.0179151888f, -0.0179092734f, -0.0179026854f, -0.0178954255f,
+    -0.0178874939f, -0.0178788913f, -0.0178696181f, -0.0178596751f,
+    -0.0178490626f, -0.0178377814f, -0.0178258321f, -0.0178132153f,
+    -0.0177999318f, -0.0177859822f, -0.0177713673f, -0.0177560879f,
+    -0.0177401447f, -0.0177235386f, -0.0177062704f, -0.0176883409f,
+    -0.0176697511f, -0.0176505019f, -0.0176305941f, -0.0176100288f,
+    -0.017588807f, -0.0175669296f, -0.0175443977f, -0.0175212123f,
+    -0.0174973745f, -0.0174728855f, -0.0174477463f, -0.0174219582f,
+    -0.0173955223f, -0.0173684397f, -0.0173407118f, -0.0173123397f,
+    -0.0172833248f, -0.0172536684f, -0.0172233717f, -0.0171924361f,
+    -0.0171608631f, -0.0171286538f, -0.0170958099f, -0.0170623328f,
+    -0.0170282238f, -0.0169934845f, -0.0169581164f, -0.016922121f,
+    -0.0168854999f, -0.0168482546f, -0.0168103868f, -0.0167718981f,
+    -0.0167327902f, -0.0166930646f, -0.0166527232f, -0.0166117675f,
+    -0.0165701994f, -0.0165280206f, -0.0164852329f, -0.0164418381f,
+    -0.016397838f, -0.0163532345f, -0.0163080295f, -0.0162622248f,
+    -0.0162158223f, -0.016168824f, -0.0161212319f, -0.016073048f,
+    -0.0160242742f, -0.0159749125f, -0.015924965f, -0.0158744339f,
+    -0.0158233211f, -0.0157716287f, -0.015719359f, -0.015666514f,
+    -0.015613096f, -0.0155591071f, -0.0155045495f, -0.0154494255f,
+    -0.0153937373f, -0.0153374873f, -0.0152806776f, -0.0152233107f,
+    -0.0151653888f, -0.0151069143f, -0.0150478897f, -0.0149883172f,
+    -0.0149281993f, -0.0148675385f, -0.0148063371f, -0.0147445978f,
+    -0.0146823229f, -0.014619515f, -0.0145561766f, -0.0144923103f,
+    -0.0144279187f, -0.0143630043f, -0.0142975697f, -0.0142316176f,
+    -0.0141651507f, -0.0140981715f, -0.0140306828f, -0.0139626873f,
+    -0.0138941877f, -0.0138251867f, -0.0137556871f, -0.0136856917f,
+    -0.0136152032f, -0.0135442245f, -0.0134727584f, -0.0134008078f,
+    -0.0133283755f, -0.0132554643f, -0.0131820773f, -0.0131082172f,
+    -0.0130338871f, -0.0129590899f, -0.0128838285f, -0.0128081059f,
+    -0.0127319251f, -0.0126552892f, -0.0125782011f, -0.0125006639f,
+    -0.0124226807f, -0.0123442546f, -0.0122653886f, -0.0121860858f,
+    -0.0121063494f, -0.0120261826f, -0.0119455883f, -0.01186457f,
+    -0.0117831306f, -0.0117012735f, -0.0116190018f, -0.0115363187f,
+    -0.0114532276f, -0.0113697316f, -0.011285834f, -0.0112015382f,
+    -0.0111168474f, -0.0110317649f, -0.0109462941f, -0.0108604383f,
+    -0.0107742008f, -0.010687585f, -0.0106005944f, -0.0105132322f,
+    -0.0104255019f, -0.010337407f, -0.0102489508f, -0.0101601368f,
+    -0.0100709685f, -0.00998144925f, -0.00989158262f, -0.00980137209f,
+    -0.00971082116f, -0.00961993335f, -0.00952871217f, -0.00943716118f,
+    -0.00934528393f, -0.00925308397f, -0.00916056487f, -0.00906773023f,
+    -0.00897458363f, -0.00888112868f, -0.008787369f, -0.00869330821f,
+    -0.00859894995f, -0.00850429786f, -0.0084093556f, -0.00831412684f,
+    -0.00821861524f, -0.0081228245f, -0.00802675831f, -0.00793042038f,
+    -0.0078338144f, -0.00773694412f, -0.00763981324f, -0.00754242553f,
+    -0.00744478471f, -0.00734689455f, -0.00724875881f, -0.00715038126f,
+    -0.00705176568f, -0.00695291586f, -0.00685383559f, -0.00675452868f,
+    -0.00665499893f, -0.00655525017f, -0.00645528621f, -0.00635511088f,
+    -0.00625472803f, -0.0061541415f, -0.00605335514f, -0.0059523728f,
+    -0.00585119835f, -0.00574983565f, -0.00564828859f, -0.00554656104f,
+    -0.00544465688f, -0.00534258002f, -0.00524033434f, -0.00513792375f,
+    -0.00503535216f, -0.00493262347f, -0.0048297416f, -0.00472671048f,
+    -0.00462353403f, -0.00452021617f, -0.00441676085f, -0.00431317199f,
+    -0.00420945355f, -0.00410560946f, -0.00400164367f, -0.00389756014f,
+    -0.00379336281f, -0.00368905566f, -0.00358464263f, -0.0034801277f,
+    -0.00337551482f, -0.00327080796f, -0.00316601111f, -0.00306112822f,
+    -0.00295616328f, -0.00285112026f, -0.00274600314f, -0.00264081589f,
+    -0.00253556251f, -0.00243024697f, -0.00232487325f, -0.00221944535f,
+    -0.00211396724f, -0.00200844292f, -0.00190287636f, -0.00179727156f,
+    -0.00169163249f, -0.00158596316f, -0.00148026754f, -0.00137454963f,
+    -0.0012688134f, -0.00116306284f, -0.00105730195f, -0.000951534691f,
+    -0.00084576506f, -0.000739997037f, -0.0006342346f, -0.000528481728f,
+    -0.0004227424f, -0.000317020591f, -0.000211320274f, -0.00010564542f,
+    -3.37315003e-17f, 0.00010561202f, 0.000211186676f, 0.000316720005f,
+    0.000422208048f, 0.000527646851f, 0.000633032458f, 0.000738360922f,
+    0.000843628295f, 0.000948830635f, 0.001053964f, 0.00115902446f,
+    0.00126400809f, 0.00136891094f, 0.00147372911f, 0.00157845867f,
+    0.00168309571f, 0.00178763632f, 0.00189207659f, 0.00199641263f,
+    0.00210064055f, 0.00220475644f, 0.00230875644f, 0.00241263666f,
+    0.00251639323f, 0.00262002228f, 0.00272351996f, 0.00282688241f,
+    0.00293010578f, 0.00303318623f, 0.00313611993f, 0.00323890304f,
+    0.00334153175f, 0.00344400225f, 0.00354631072f, 0.00364845337f,
+    0.00375042641f, 0.00385222604f, 0.0039538485f, 0.00405529001f,
+    0.00415654681f, 0.00425761516f, 0.0043584913f, 0.0044591715f,
+    0.00455965203f, 0.00465992917f, 0.00475999921f, 0.00485985846f,
+    0.00495950322f, 0.0050589298f, 0.00515813454f, 0.00525711376f,
+    0.00535586382f, 0.00545438107f, 0.00555266187f, 0.00565070261f,
+    0.00574849966f, 0.00584604942f, 0.0059433483f, 0.00604039272f,
+    0.0061371791f, 0.00623370388f, 0.00632996351f, 0.00642595445f,
+    0.00652167317f, 0.00661711616f, 0.0067122799f, 0.00680716092f,
+    0.00690175572f, 0.00699606083f, 0.00709007279f, 0.00718378817f,
+    0.00727720352f, 0.00737031542f, 0.00746312047f, 0.00755561526f,
+    0.00764779642f, 0.00773966057f, 0.00783120436f, 0.00792242444f,
+    0.00801331747f, 0.00810388015f, 0.00819410916f, 0.00828400122f,
+    0.00837355304f, 0.00846276137f, 0.00855162295f, 0.00864013455f,
+    0.00872829294f, 0.00881609493f, 0.00890353731f, 0.00899061691f,
+    0.00907733057f, 0.00916367513f, 0.00924964747f, 0.00933524446f,
+    0.009420463f, 0.0095053f, 0.00958975238f, 0.0096738171f,
+    0.00975749111f, 0.00984077138f, 0.00992365489f, 0.0100061387f,
+    0.0100882197f, 0.0101698951f, 0.0102511618f, 0.010332017f,
+    0.0104124577f, 0.010492481f, 0.010572084f, 0.010651264f,
+    0.0107300179f, 0.0108083431f, 0.0108862366f, 0.0109636958f,
+    0.0110407177f, 0.0111172997f, 0.0111934391f, 0.011269133f,
+    0.0113443787f, 0.0114191737f, 0.0114935151f, 0.0115674004f,
+    0.0116408269f, 0.011713792f, 0.0117862931f, 0.0118583276f,
+    0.0119298929f, 0.0120009865f, 0.0120716059f, 0.0121417486f,
+    0.012211412f, 0.0122805937f, 0.0123492913f, 0.0124175022f,
+    0.0124852242f, 0.0125524548f, 0.0126191915f, 0.0126854322f,
+    0.0127511743f, 0.0128164157f, 0.012881154f, 0.0129453869f,
+    0.0130091122f, 0.0130723276f, 0.0131350309f, 0.01319722f,
+    0.0132588925f, 0.0133200465f, 0.0133806797f, 0.0134407899f,
+    0.0135003752f, 0.0135594335f, 0.0136179626f, 0.0136759606f,
+    0.0137334254f, 0.013790355f, 0.0138467474f, 0.0139026008f,
+    0.0139579132f, 0.0140126825f, 0.0140669071f, 0.0141205849f,
+    0.0141737142f, 0.0142262931f, 0.0142783198f, 0.0143297926f,
+    0.0143807095f, 0.014431069f, 0.0144808693f, 0.0145301087f,
+    0.0145787855f, 0.0146268981f, 0.0146744448f, 0.014721424f,
+    0.0147678341f, 0.0148136736f, 0.0148589409f, 0.0149036344f,
+    0.0149477528f, 0.0149912944f, 0.0150342579f, 0.0150766418f,
+    0.0151184447f, 0.0151596651f, 0.0152003018f, 0.0152403534f,
+    0.0152798185f, 0.0153186959f, 0.0153569843f, 0.0153946824f,
+    0.0154317889f, 0.0154683028f, 0.0155042227f, 0.0155395475f,
+    0.0155742761f, 0.0156084073f, 0.0156419401f, 0.0156748734f,
+    0.0157072061f, 0.0157389372f, 0.0157700656f, 0.0158005905f,
+    0.0158305108f, 0.0158598257f, 0.0158885341f, 0.0159166352f,
+    0.0159441282f, 0.0159710121f, 0.0159972862f, 0.0160229497f,
+    0.0160480018f, 0.0160724417f, 0.0160962687f, 0.0161194821f,
+    0.0161420812f, 0.0161640655f, 0.0161854341f, 0.0162061865f,
+    0.0162263222f, 0.0162458405f, 0.016264741f, 0.0162830231f,
+    0.0163006862f, 0.01631773f, 0.016334154f, 0.0163499577f,
+    0.0163651408f, 0.0163797029f, 0.0163936436f, 0.0164069626f,
+    0.0164196595f, 0.0164317342f, 0.0164431863f, 0.0164540157f,
+    0.016464222f, 0.0164738051f, 0.0164827649f, 0.0164911011f,
+    0.0164988137f, 0.0165059026f, 0.0165123677f, 0.016518209f,
+    0.0165234264f, 0.0165280199f, 0.0165319895f, 0.0165353354f,
+    0.0165380575f, 0.016540156f, 0.0165416309f, 0.0165424824f,
+    0.0165427107f, 0.016542316f, 0.0165412984f, 0.0165396582f,
+    0.0165373957f, 0.0165345111f, 0.0165310047f, 0.0165268769f,
+    0.016522128f, 0.0165167584f, 0.0165107684f, 0.0165041586f,
+    0.0164969292f, 0.0164890809f, 0.0164806141f, 0.0164715292f,
+    0.0164618269f, 0.0164515077f, 0.0164405721f, 0.0164290208f,
+    0.0164168544f, 0.0164040736f, 0.0163906789f, 0.0163766712f,
+    0.0163620512f, 0.0163468194f, 0.0163309769f, 0.0163145242f,
+    0.0162974623f, 0.016279792f, 0.016261514f, 0.0162426294f,
+    0.0162231389f, 0.0162030436f, 0.0161823443f, 0.016161042f,
+    0.0161391378f, 0.0161166326f, 0.0160935274f, 0.0160698234f,
+    0.0160455216f, 0.016020623f, 0.0159951289f, 0.0159690403f,
+    0.0159423585f, 0.0159150846f, 0.0158872198f, 0.0158587653f,
+    0.0158297225f, 0.0158000926f, 0.0157698768f, 0.0157390766f,
+    0.0157076932f, 0.015675728f, 0.0156431824f, 0.0156100578f,
+    0.0155763557f, 0.0155420774f, 0.0155072244f, 0.0154717983f,
+    0.0154358005f, 0.0153992326f, 0.0153620961f, 0.0153243926f,
+    0.0152861238f, 0.0152472911f, 0.0152078963f, 0.015167941f,
+    0.0151274268f, 0.0150863556f, 0.0150447289f, 0.0150025486f,
+    0.0149598164f, 0.0149165341f, 0.0148727035f, 0.0148283263f,
+    0.0147834045f, 0.0147379399f, 0.0146919344f, 0.0146453898f,
+    0.0145983082f, 0.0145506913f, 0.0145025413f, 0.01445386f,
+    0.0144046495f, 0.0143549118f, 0.0143046489f, 0.0142538629f,
+    0.0142025558f, 0.0141507298f, 0.0140983869f, 0.0140455293f,
+    0.0139921591f, 0.0139382786f, 0.0138838898f, 0.013828995f,
+    0.0137735964f, 0.0137176962f, 0.0136612968f, 0.0136044004f,
+    0.0135470092f, 0.0134891256f, 0.013430752f, 0.0133718907f,
+    0.013312544f, 0.0132527143f, 0.013192404f, 0.0131316157f,
+    0.0130703515f, 0.0130086142f, 0.012946406f, 0.0128837295f,
+    0.0128205873f, 0.0127569817f, 0.0126929154f, 0.0126283909f,
+    0.0125634108f, 0.0124979777f, 0.0124320942f, 0.0123657628f,
+    0.0122989863f, 0.0122317672f, 0.0121641083f, 0.0120960122f,
+    0.0120274816f, 0.0119585193f, 0.0118891279f, 0.0118193103f,
+    0.0117490691f, 0.0116784072f, 0.0116073273f, 0.0115358323f,
+    0.0114639249f, 0.011391608f, 0.0113188844f, 0.0112457571f,
+    0.0111722289f, 0.0110983026f, 0.0110239812f, 0.0109492676f,
+    0.0108741647f, 0.0107986756f, 0.010722803f, 0.0106465501f,
+    0.0105699198f, 0.0104929151f, 0.010415539f, 0.0103377945f,
+    0.0102596848f, 0.0101812128f, 0.0101023815f, 0.0100231942f,
+    0.00994365386f, 0.00986376358f, 0.00978352649f, 0.00970294572f,
+    0.0096220244f, 0.0095407657f, 0.00945917277f, 0.00937724879f,
+    0.00929499693f, 0.00921242041f, 0.00912952243f, 0.0090463062f,
+    0.00896277496f, 0.00887893194f, 0.00879478041f, 0.00871032363f,
+    0.00862556486f, 0.00854050739f, 0.00845515451f, 0.00836950954f,
+    0.00828357577f, 0.00819735654f, 0.00811085518f, 0.00802407504f,
+    0.00793701945f, 0.00784969179f, 0.00776209543f, 0.00767423375f,
+    0.00758611013f, 0.00749772798f, 0.0074090907f, 0.0073202017f,
+    0.00723106441f, 0.00714168227f, 0.0070520587f, 0.00696219716f,
+    0.00687210111f, 0.006781774f, 0.00669121931f, 0.00660044052f,
+    0.00650944112f, 0.00641822459f, 0.00632679443f, 0.00623515417f,
+    0.0061433073f, 0.00605125735f, 0.00595900785f, 0.00586656233f,
+    0.00577392433f, 0.0056810974f, 0.00558808508f, 0.00549489095f,
+    0.00540151855f, 0.00530797147f, 0.00521425328f, 0.00512036755f,
+    0.00502631787f, 0.00493210784f, 0.00483774104f, 0.00474322108f,
+    0.00464855157f, 0.00455373611f, 0.00445877831f, 0.00436368181f,
+    0.0042684502f, 0.00417308714f, 0.00407759623f, 0.00398198113f,
+    0.00388624545f, 0.00379039286f, 0.00369442698f, 0.00359835147f,
+    0.00350216998f, 0.00340588615f, 0.00330950365f, 0.00321302614f,
+    0.00311645727f, 0.00301980071f, 0.00292306012f, 0.00282623917f,
+    0.00272934153f, 0.00263237087f, 0.00253533086f, 0.00243822518f,
+    0.0023410575f, 0.00224383151f, 0.00214655086f, 0.00204921926f,
+    0.00195184037f, 0.00185441787f, 0.00175695545f, 0.00165945678f,
+    0.00156192556f, 0.00146436545f, 0.00136678014f, 0.00126917331f,
+    0.00117154864f, 0.00107390982f, 0.000976260517f, 0.000878604415f,
+    0.000780945191f, 0.000683286523f, 0.000585632086f, 0.000487985556f,
+    0.000390350605f, 0.000292730905f, 0.000195130126f, 9.75519352e-05f,
+    -2.33802894e-17f, -9.75220162e-05f, -0.000195010451f, -0.000292461647f,
+    -0.000389871945f, -0.000487237692f, -0.000584555236f, -0.000681820929f,
+    -0.000779031126f, -0.000876182184f, -0.000973270464f, -0.00107029233f,
+    -0.00116724415f, -0.00126412231f, -0.00136092316f, -0.0014576431f,
+    -0.0015542785f, -0.00165082576f, -0.00174728127f, -0.00184364142f,
+    -0.00193990262f, -0.00203606128f, -0.0021321138f, -0.0022280566f,
+    -0.00232388611f, -0.00241959876f, -0.00251519097f, -0.00261065918f,
+    -0.00270599984f, -0.0028012094f, -0.00289628431f, -0.00299122105f,
+    -0.00308601607f, -0.00318066584f, -0.00327516687f, -0.00336951562f,
+    -0.0034637086f, -0.00355774231f, -0.00365161325f, -0.00374531795f,
+    -0.00383885293f, -0.00393221471f, -0.00402539985f, -0.00411840487f,
+    -0.00421122634f, -0.00430386082f, -0.00439630489f, -0.00448855511f,
+    -0.00458060807f, -0.00467246038f, -0.00476410863f, -0.00485554943f,
+    -0.00494677942f, -0.00503779521f, -0.00512859345f, -0.00521917079f,
+    -0.00530952388f, -0.0053996494f, -0.00548954401f, -0.00557920441f,
+    -0.00566862729f, -0.00575780936f, -0.00584674733f, -0.00593543794f,
+    -0.00602387792f, -0.00611206401f, -0.00619999298f, -0.00628766159f,
+    -0.00637506663f, -0.00646220487f, -0.00654907314f, -0.00663566823f,
+    -0.00672198697f, -0.0068080262f, -0.00689378276f, -0.00697925351f,
+    -0.00706443532f, -0.00714932508f, -0.00723391967f, -0.00731821601f,
+    -0.007402211f, -0.00748590159f, -0.00756928471f, -0.00765235732f,
+    -0.00773511638f, -0.00781755888f, -0.00789968181f, -0.00798148218f,
+    -0.008062957f, -0.00814410331f, -0.00822491816f, -0.00830539859f,
+    -0.00838554169f, -0.00846534454f, -0.00854480425f, -0.00862391792f,
+    -0.00870268268f, -0.00878109567f, -0.00885915406f, -0.008936855f,
+    -0.00901419569f, -0.00909117331f, -0.0091677851f, -0.00924402826f,
+    -0.00931990006f, -0.00939539773f, -0.00947051856f, -0.00954525983f,
+    -0.00961961885f, -0.00969359292f, -0.00976717939f, -0.00984037561f,
+    -0.00991317893f, -0.00998558673f, -0.0100575964f, -0.0101292054f,
+    -0.0102004111f, -0.0102712109f, -0.0103416024f, -0.010411583f,
+    -0.0104811501f, -0.0105503014f, -0.0106190342f, -0.0106873462f,
+    -0.010755235f, -0.010822698f, -0.0108897329f, -0.0109563372f,
+    -0.0110225087f, -0.0110882449f, -0.0111535436f, -0.0112184023f,
+    -0.0112828188f, -0.0113467907f, -0.0114103159f, -0.0114733921f,
+    -0.0115360169f, -0.0115981883f, -0.0116599039f, -0.0117211617f,
+    -0.0117819594f, -0.0118422949f, -0.011902166f, -0.0119615707f,
+    -0.0120205069f, -0.0120789725f, -0.0121369654f, -0.0121944835f,
+    -0.012251525f, -0.0123080877f, -0.0123641697f, -0.0124197689f,
+    -0.0124748836f, -0.0125295117f, -0.0125836514f, -0.0126373006f,
+    -0.0126904577f, -0.0127431207f, -0.0127952877f, -0.0128469571f,
+    -0.0128981269f, -0.0129487955f, -0.012998961f, -0.0130486217f,
+    -0.0130977759f, -0.0131464219f, -0.0131945581f, -0.0132421827f,
+    -0.0132892941f, -0.0133358908f, -0.0133819711f, -0.0134275335f,
+    -0.0134725763f, -0.0135170981f, -0.0135610973f, -0.0136045724f,
+    -0.013647522f, -0.0136899446f, -0.0137318387f, -0.013773203f,
+    -0.0138140361f, -0.0138543365f, -0.0138941029f, -0.0139333341f,
+    -0.0139720286f, -0.0140101851f, -0.0140478025f, -0.0140848794f,
+    -0.0141214146f, -0.014157407f, -0.0141928552f, -0.0142277582f,
+    -0.0142621149f, -0.0142959239f, -0.0143291844f, -0.0143618951f,
+    -0.0143940551f, -0.0144256632f, -0.0144567184f, -0.0144872199f,
+    -0.0145171664f, -0.0145465572f, -0.0145753913f, -0.0146036677f,
+    -0.0146313856f, -0.0146585441f, -0.0146851423f, -0.0147111794f,
+    -0.0147366546f, -0.0147615671f, -0.0147859161f, -0.014809701f,
+    -0.0148329209f, -0.0148555751f, -0.0148776631f, -0.0148991841f,
+    -0.0149201374f, -0.0149405226f, -0.0149603389f, -0.0149795858f,
+    -0.0149982627f, -0.0150163692f, -0.0150339047f, -0.0150508687f,
+    -0.0150672607f, -0.0150830804f, -0.0150983272f, -0.0151130009f,
+    -0.015127101f, -0.0151406271f, -0.0151535789f, -0.0151659562f,
+    -0.0151777585f, -0.0151889857f, -0.0151996375f, -0.0152097137f,
+    -0.015219214f, -0.0152281384f, -0.0152364865f, -0.0152442583f,
+    -0.0152514537f, -0.0152580725f, -0.0152641148f, -0.0152695803f,
+    -0.0152744692f, -0.0152787814f, -0.0152825169f, -0.0152856757f,
+    -0.015288258f, -0.0152902637f, -0.015291693f, -0.0152925459f,
+    -0.0152928228f, -0.0152925236f, -0.0152916486f, -0.015290198f,
+    -0.0152881721f, -0.015285571f, -0.015282395f, -0.0152786445f,
+    -0.0152743198f, -0.0152694211f, -0.0152639489f, -0.0152579036f,
+    -0.0152512854f, -0.0152440949f, -0.0152363325f, -0.0152279987f,
+    -0.0152190939f, -0.0152096187f, -0.0151995736f, -0.0151889591f,
+    -0.0151777758f, -0.0151660243f, -0.0151537052f, -0.0151408191f,
+    -0.0151273668f, -0.0151133489f, -0.015098766f, -0.015083619f,
+    -0.0150679085f, -0.0150516353f, -0.0150348001f, -0.0150174039f,
+    -0.0149994474f, -0.0149809315f, -0.0149618569f, -0.0149422247f,
+    -0.0149220357f, -0.0149012909f, -0.0148799912f, -0.0148581375f,
+    -0.0148357309f, -0.0148127723f, -0.0147892629f, -0.0147652036f,
+    -0.0147405955f, -0.0147154398f, -0.0146897375f, -0.0146634897f,
+    -0.0146366976f, -0.0146093625f, -0.0145814854f, -0.0145530676f,
+    -0.0145241103f, -0.0144946148f, -0.0144645823f, -0.0144340142f,
+    -0.0144029118f, -0.0143712763f, -0.0143391092f, -0.0143064118f,
+    -0.0142731855f, -0.0142394317f, -0.0142051518f, -0.0141703473f,
+    -0.0141350197f, -0.0140991704f, -0.014062801f, -0.014025913f,
+    -0.0139885079f, -0.0139505873f, -0.0139121527f, -0.0138732059f,
+    -0.0138337483f, -0.0137937816f, -0.0137533076f, -0.0137123278f,
+    -0.013670844f, -0.0136288578f, -0.0135863711f, -0.0135433855f,
+    -0.0134999029f, -0.0134559249f, -0.0134114535f, -0.0133664905f,
+    -0.0133210376f, -0.0132750967f, -0.0132286698f, -0.0131817587f,
+    -0.0131343653f, -0.0130864916f, -0.0130381394f, -0.0129893108f,
+    -0.0129400078f, -0.0128902323f, -0.0128399864f, -0.0127892721f,
+    -0.0127380914f, -0.0126864465f, -0.0126343393f, -0.012581772f,
+    -0.0125287468f, -0.0124752657f, -0.0124213309f, -0.0123669445f,
+    -0.0123121088f, -0.012256826f, -0.0122010982f, -0.0121449277f,
+    -0.0120883168f, -0.0120312677f, -0.0119737826f, -0.011915864f,
+    -0.011857514f, -0.0117987351f, -0.0117395295f, -0.0116798996f,
+    -0.0116198478f, -0.0115593765f, -0.0114984881f, -0.011437185f,
+    -0.0113754696f, -0.0113133444f, -0.0112508119f, -0.0111878744f,
+    -0.0111245346f, -0.0110607949f, -0.0109966578f, -0.0109321259f,
+    -0.0108672017f, -0.0108018878f, -0.0107361867f, -0.0106701011f,
+    -0.0106036335f, -0.0105367866f, -0.010469563f, -0.0104019653f,
+    -0.0103339962f, -0.0102656584f, -0.0101969545f, -0.0101278873f,
+    -0.0100584594f, -0.00998867364f, -0.00991853266f, -0.00984803924f,
+    -0.00977719614f, -0.00970600613f, -0.00963447199f, -0.00956259653f,
+    -0.00949038254f, -0.00941783286f, -0.00934495031f, -0.00927173773f,
+    -0.00919819798f, -0.00912433393f, -0.00905014845f, -0.00897564444f,
+    -0.00890082479f, -0.00882569242f, -0.00875025025f, -0.00867450121f,
+    -0.00859844824f, -0.00852209431f, -0.00844544236f, -0.00836849539f,
+    -0.00829125637f, -0.0082137283f, -0.00813591419f, -0.00805781705f,
+    -0.0079794399f, -0.00790078578f, -0.00782185774f, -0.00774265882f,
+    -0.0076631921f, -0.00758346063f, -0.00750346751f, -0.00742321582f,
+    -0.00734270866f, -0.00726194914f, -0.00718094038f, -0.0070996855f,
+    -0.00701818762f, -0.0069364499f, -0.00685447548f, -0.00677226752f,
+    -0.00668982919f, -0.00660716365f, -0.00652427408f, -0.00644116368f,
+    -0.00635783564f, -0.00627429316f, -0.00619053944f, -0.00610657772f,
+    -0.0060224112f, -0.00593804312f, -0.00585347672f, -0.00576871524f,
+    -0.00568376192f, -0.00559862003f, -0.00551329283f, -0.00542778357f,
+    -0.00534209554f, -0.00525623202f, -0.00517019629f, -0.00508399164f,
+    -0.00499762137f, -0.00491108878f, -0.00482439717f, -0.00473754986f,
+    -0.00465055015f, -0.00456340138f, -0.00447610687f, -0.00438866995f,
+    -0.00430109394f, -0.0042133822f, -0.00412553806f, -0.00403756487f,
+    -0.00394946598f, -0.00386124474f, -0.00377290452f, -0.00368444867f,
+    -0.00359588055f, -0.00350720354f, -0.00341842101f, -0.00332953633f,
+    -0.00324055287f, -0.00315147402f, -0.00306230316f, -0.00297304368f,
+    -0.00288369895f, -0.00279427236f, -0.00270476732f, -0.00261518721f,
+    -0.00252553543f, -0.00243581537f, -0.00234603043f, -0.00225618402f,
+    -0.00216627952f, -0.00207632035f, -0.0019863099f, -0.00189625158f,
+    -0.0018061488f, -0.00171600496f, -0.00162582346f, -0.00153560772f,
+    -0.00144536113f, -0.00135508711f, -0.00126478906f, -0.00117447039f,
+    -0.0010841345f, -0.000993784801f, -0.000903424698f, -0.000813057596f,
+    -0.000722686898f, -0.000632316008f, -0.000541948327f, -0.000451587257f,
+    -0.000361236196f, -0.000270898545f, -0.000180577698f, -9.02770521e-05f,
+    -3.24278846e-17f, 9.02500668e-05f, 0.000180469759f, 0.000270655689f,
+    0.000360804472f, 0.000450912725f, 0.000540977069f, 0.000630994125f,
+    0.00072096052f, 0.000810872881f, 0.00090072784f, 0.000990522031f,
+    0.00108025209f, 0.00116991467f, 0.0012595064f, 0.00134902393f,
+    0.00143846392f, 0.00152782302f, 0.0016170979f, 0.00170628521f,
+    0.00179538164f, 0.00188438383f, 0.00197328849f, 0.00206209229f,
+    0.00215079191f, 0.00223938405f, 0.0023278654f, 0.00241623267f,
+    0.00250448257f, 0.0025926118f, 0.00268061709f, 0.00276849516f,
+    0.00285624274f, 0.00294385656f, 0.00303133337f, 0.00311866991f,
+    0.00320586295f, 0.00329290923f, 0.00337980552f, 0.00346654861f,
+    0.00355313526f, 0.00363956228f, 0.00372582644f, 0.00381192455f,
+    0.00389785342f, 0.00398360987f, 0.00406919072f, 0.00415459279f,
+    0.00423981294f, 0.004324848f, 0.00440969482f, 0.00449435027f,
+    0.00457881123f, 0.00466307456f, 0.00474713715f, 0.00483099591f,
+    0.00491464773f, 0.00499808953f, 0.00508131822f, 0.00516433074f,
+    0.00524712403f, 0.00532969504f, 0.00541204072f, 0.00549415804f,
+    0.00557604397f, 0.00565769551f, 0.00573910966f, 0.0058202834f,
+    0.00590121377f, 0.00598189779f, 0.00606233249f, 0.00614251491f,
+    0.00622244213f, 0.0063021112f, 0.0063815192f, 0.00646066322f,
+    0.00653954035f, 0.00661814772f, 0.00669648243f, 0.00677454163f,
+    0.00685232245f, 0.00692982206f, 0.0070070376f, 0.00708396628f,
+    0.00716060526f, 0.00723695176f, 0.00731300299f, 0.00738875617f,
+    0.00746420854f, 0.00753935735f, 0.00761419986f, 0.00768873334f,
+    0.00776295508f, 0.00783686238f, 0.00791045255f, 0.00798372291f,
+    0.0080566708f, 0.00812929357f, 0.00820158859f, 0.00827355322f,
+    0.00834518486f, 0.00841648091f, 0.00848743879f, 0.00855805592f,
+    0.00862832975f, 0.00869825774f, 0.00876783735f, 0.00883706607f,
+    0.00890594139f, 0.00897446084f, 0.00904262193f, 0.00911042221f,
+    0.00917785924f, 0.00924493057f, 0.0093116338f, 0.00937796652f,
+    0.00944392634f, 0.0095095109f, 0.00957471784f, 0.00963954481f,
+    0.00970398949f, 0.00976804956f, 0.00983172272f, 0.00989500671f,
+    0.00995789923f, 0.0100203981f, 0.0100825009f, 0.0101442057f,
+    0.01020551f, 0.0102664118f, 0.0103269089f, 0.0103869991f,
+    0.0104466803f, 0.0105059503f, 0.0105648071f, 0.0106232485f,
+    0.0106812725f, 0.010738877f, 0.01079606f, 0.0108528194f,
+    0.0109091532f, 0.0109650594f, 0.0110205362f, 0.0110755814f,
+    0.0111301932f, 0.0111843695f, 0.0112381086f, 0.0112914086f,
+    0.0113442674f, 0.0113966834f, 0.0114486546f, 0.0115001792f,
+    0.0115512554f, 0.0116018815f, 0.0116520556f, 0.011701776f,
+    0.011751041f, 0.0117998488f, 0.0118481977f, 0.0118960861f,
+    0.0119435123f, 0.0119904746f, 0.0120369714f, 0.0120830011f,
+    0.0121285621f, 0.0121736529f, 0.0122182718f, 0.0122624173f,
+    0.012306088f, 0.0123492822f, 0.0123919986f, 0.0124342356f,
+    0.0124759918f, 0.0125172658f, 0.0125580562f, 0.0125983615f,
+    0.0126381805f, 0.0126775116f, 0.0127163537f, 0.0127547054f,
+    0.0127925654f, 0.0128299323f, 0.0128668051f, 0.0129031823f,
+    0.0129390628f, 0.0129744455f, 0.013009329f, 0.0130437122f,
+    0.0130775941f, 0.0131109733f, 0.013143849f, 0.0131762199f,
+    0.013208085f, 0.0132394433f, 0.0132702937f, 0.0133006351f,
+    0.0133304667f, 0.0133597875f, 0.0133885964f, 0.0134168926f,
+    0.0134446751f, 0.0134719431f, 0.0134986956f, 0.0135249319f,
+    0.0135506511f, 0.0135758523f, 0.0136005348f, 0.0136246978f,
+    0.0136483406f, 0.0136714623f, 0.0136940624f, 0.01371614f,
+    0.0137376946f, 0.0137587254f, 0.0137792319f, 0.0137992133f,
+    0.0138186692f, 0.0138375989f, 0.0138560019f, 0.0138738776f,
+    0.0138912256f, 0.0139080453f, 0.0139243362f, 0.013940098f,
+    0.0139553301f, 0.0139700321f, 0.0139842037f, 0.0139978444f,
+    0.014010954f, 0.014023532f, 0.0140355782f, 0.0140470922f,
+    0.0140580739f, 0.0140685228f, 0.0140784389f, 0.0140878219f,
+    0.0140966715f, 0.0141049876f, 0.0141127701f, 0.0141200188f,
+    0.0141267336f, 0.0141329145f, 0.0141385612f, 0.0141436738f,
+    0.0141482523f, 0.0141522966f, 0.0141558068f, 0.0141587828f,
+    0.0141612247f, 0.0141631326f, 0.0141645065f, 0.0141653466f,
+    0.014165653f, 0.0141654259f, 0.0141646653f, 0.0141633715f,
+    0.0141615448f, 0.0141591852f, 0.0141562931f, 0.0141528688f,
+    0.0141489125f, 0.0141444245f, 0.0141394052f, 0.0141338548f,
+    0.0141277738f, 0.0141211626f, 0.0141140216f, 0.0141063511f,
+    0.0140981516f, 0.0140894237f, 0.0140801677f, 0.0140703842f,
+    0.0140600737f, 0.0140492367f, 0.0140378739f, 0.0140259858f,
+    0.0140135729f, 0.014000636f, 0.0139871757f, 0.0139731925f,
+    0.0139586873f, 0.0139436607f, 0.0139281134f, 0.0139120462f,
+    0.0138954598f, 0.013878355f, 0.0138607325f, 0.0138425933f,
+    0.0138239382f, 0.013804768f, 0.0137850835f, 0.0137648857f,
+    0.0137441755f, 0.0137229538f, 0.0137012215f, 0.0136789797f,
+    0.0136562293f, 0.0136329714f, 0.0136092069f, 0.0135849368f,
+    0.0135601624f, 0.0135348846f, 0.0135091045f, 0.0134828233f,
+    0.013456042f, 0.013428762f, 0.0134009842f, 0.01337271f,
+    0.0133439405f, 0.0133146769f, 0.0132849206f, 0.0132546727f,
+    0.0132239346f, 0.0131927076f, 0.0131609929f, 0.0131287919f,
+    0.013096106f, 0.0130629366f, 0.013029285f, 0.0129951526f,
+    0.0129605409f, 0.0129254513f, 0.0128898853f, 0.0128538443f,
+    0.0128173299f, 0.0127803436f, 0.0127428869f, 0.0127049613f,
+    0.0126665684f, 0.0126277098f, 0.0125883872f, 0.012548602f,
+    0.012508356f, 0.0124676507f, 0.012426488f, 0.0123848694f,
+    0.0123427966f, 0.0123002715f, 0.0122572956f, 0.0122138708f,
+    0.0121699988f, 0.0121256814f, 0.0120809204f, 0.0120357176f,
+    0.0119900749f, 0.0119439941f, 0.011897477f, 0.0118505256f,
+    0.0118031417f, 0.0117553273f, 0.0117070843f, 0.0116584146f,
+    0.0116093201f, 0.0115598029f, 0.011509865f, 0.0114595083f,
+    0.0114087348f, 0.0113575467f, 0.0113059459f, 0.0112539345f,
+    0.0112015146f, 0.0111486883f, 0.0110954576f, 0.0110418248f,
+    0.010987792f, 0.0109333612f, 0.0108785347f, 0.0108233147f,
+    0.0107677033f, 0.0107117028f, 0.0106553153f, 0.0105985432f,
+    0.0105413886f, 0.0104838538f, 0.0104259412f, 0.0103676529f,
+    0.0103089914f, 0.0102499589f, 0.0101905577f, 0.0101307902f,
+    0.0100706588f, 0.0100101658f, 0.00994931362f, 0.00988810464f,
+    0.00982654127f, 0.00976462595f, 0.00970236109f, 0.00963974916f,
+    0.0095767926f, 0.00951349389f, 0.00944985552f, 0.00938587997f,
+    0.00932156976f, 0.00925692741f, 0.00919195544f, 0.00912665641f,
+    0.00906103286f, 0.00899508735f, 0.00892882248f, 0.00886224083f,
+    0.00879534498f, 0.00872813757f, 0.00866062121f, 0.00859279852f,
+    0.00852467217f, 0.00845624479f, 0.00838751905f, 0.00831849763f,
+    0.00824918322f, 0.00817957851f, 0.0081096862f, 0.00803950901f,
+    0.00796904967f, 0.00789831091f, 0.00782729548f, 0.00775600613f,
+    0.00768444563f, 0.00761261674f, 0.00754052226f, 0.00746816498f,
+    0.00739554769f, 0.00732267322f, 0.00724954436f, 0.00717616396f,
+    0.00710253485f, 0.00702865988f, 0.0069545419f, 0.00688018376f,
+    0.00680558835f, 0.00673075853f, 0.0066556972f, 0.00658040725f,
+    0.00650489158f, 0.0064291531f, 0.00635319472f, 0.00627701938f,
+    0.00620062999f, 0.00612402951f, 0.00604722087f, 0.00597020703f,
+    0.00589299095f, 0.0058155756f, 0.00573796394f, 0.00566015897f,
+    0.00558216365f, 0.00550398099f, 0.00542561399f, 0.00534706564f,
+    0.00526833897f, 0.00518943697f, 0.00511036269f, 0.00503111914f,
+    0.00495170936f, 0.00487213638f, 0.00479240326f, 0.00471251303f,
+    0.00463246875f, 0.00455227349f, 0.0044719303f, 0.00439144225f,
+    0.00431081242f, 0.00423004388f, 0.00414913972f, 0.00406810301f,
+    0.00398693685f, 0.00390564434f, 0.00382422857f, 0.00374269263f,
+    0.00366103965f, 0.00357927272f, 0.00349739496f, 0.00341540948f,
+    0.0033333194f, 0.00325112784f, 0.00316883793f, 0.00308645279f,
+    0.00300397555f, 0.00292140934f, 0.00283875731f, 0.00275602258f,
+    0.00267320829f, 0.00259031759f, 0.00250735362f, 0.00242431952f,
+    0.00234121844f, 0.00225805353f, 0.00217482794f, 0.00209154482f,
+    0.00200820732f, 0.0019248186f, 0.0018413818f, 0.00175790009f,
+    0.00167437662f, 0.00159081455f, 0.00150721703f, 0.00142358723f,
+    0.0013399283f, 0.00125624339f, 0.00117253568f, 0.00108880831f,
+    0.00100506444f, 0.00092130723f, 0.000837539841f, 0.000753765426f,
+    0.000669987143f, 0.000586208146f, 0.000502431589f, 0.000418660626f,
+    0.000334898409f, 0.000251148089f, 0.000167412816f, 8.36957372e-05f,
+    8.01874042e-17f, -8.36712512e-05f, -0.000167314873f, -0.000250927726f,
+    -0.000334506669f, -0.000418048567f, -0.000501550285f, -0.00058500869f,
+    -0.000668420655f, -0.000751783051f, -0.000835092755f, -0.000918346646f,
+    -0.00100154161f, -0.00108467452f, -0.00116774227f, -0.00125074176f,
+    -0.00133366988f, -0.00141652353f, -0.0014992996f, -0.00158199502f,
+    -0.00166460667f, -0.00174713149f, -0.00182956639f, -0.00191190829f,
+    -0.00199415412f, -0.00207630081f, -0.0021583453f, -0.00224028452f,
+    -0.00232211543f, -0.00240383498f, -0.00248544011f, -0.00256692779f,
+    -0.002648295f, -0.00272953869f, -0.00281065585f, -0.00289164346f,
+    -0.00297249851f, -0.003053218f, -0.00313379891f, -0.00321423827f,
+    -0.00329453308f, -0.00337468037f, -0.00345467715f, -0.00353452047f,
+    -0.00361420735f, -0.00369373485f, -0.00377310002f, -0.00385229991f,
+    -0.0039313316f, -0.00401019216f, -0.00408887866f, -0.0041673882f,
+    -0.00424571788f, -0.00432386478f, -0.00440182604f, -0.00447959876f,
+    -0.00455718008f, -0.00463456712f, -0.00471175703f, -0.00478874697f,
+    -0.00486553409f, -0.00494211556f, -0.00501848856f, -0.00509465027f,
+    -0.00517059789f, -0.00524632862f, -0.00532183967f, -0.00539712827f,
+    -0.00547219164f, -0.00554702703f, -0.00562163167f, -0.00569600284f,
+    -0.0057701378f, -0.00584403383f, -0.00591768821f, -0.00599109824f,
+    -0.00606426123f, -0.0061371745f, -0.00620983538f, -0.0062822412f,
+    -0.00635438931f, -0.00642627707f, -0.00649790185f, -0.00656926103f,
+    -0.006640352f, -0.00671117217f, -0.00678171894f, -0.00685198974f,
+    -0.006921982f, -0.00699169317f, -0.00706112071f, -0.00713026209f,
+    -0.00719911478f, -0.00726767628f, -0.00733594409f, -0.00740391573f,
+    -0.00747158872f, -0.00753896061f, -0.00760602894f, -0.00767279129f,
+    -0.00773924521f, -0.00780538831f, -0.00787121818f, -0.00793673243f,
+    -0.0080019287f, -0.00806680461f, -0.00813135783f, -0.00819558601f,
+    -0.00825948682f, -0.00832305797f, -0.00838629715f, -0.00844920208f,
+    -0.00851177048f, -0.0085740001f, -0.0086358887f, -0.00869743404f,
+    -0.00875863391f, -0.00881948611f, -0.00887998844f, -0.00894013872f,
+    -0.0089999348f, -0.00905937453f, -0.00911845578f, -0.00917717641f,
+    -0.00923553434f, -0.00929352746f, -0.0093511537f, -0.009408411f,
+    -0.0094652973f, -0.00952181058f, -0.00957794882f, -0.00963371001f,
+    -0.00968909216f, -0.00974409329f, -0.00979871145f, -0.0098529447f,
+    -0.00990679109f, -0.00996024873f, -0.0100133157f, -0.0100659901f,
+    -0.0101182701f, -0.0101701539f, -0.0102216395f, -0.0102727252f,
+    -0.0103234092f, -0.0103736896f, -0.0104235648f, -0.0104730329f,
+    -0.0105220921f, -0.0105707409f, -0.0106189773f, -0.0106667999f,
+    -0.0107142068f, -0.0107611964f, -0.0108077671f, -0.0108539173f,
+    -0.0108996452f, -0.0109449494f, -0.0109898282f, -0.0110342801f,
+    -0.0110783035f, -0.0111218969f, -0.0111650587f, -0.0112077876f,
+    -0.0112500819f, -0.0112919402f, -0.0113333611f, -0.0113743432f,
+    -0.011414885f, -0.0114549851f, -0.0114946422f, -0.0115338549f,
+    -0.0115726217f, -0.0116109415f, -0.0116488129f, -0.0116862346f,
+    -0.0117232053f, -0.0117597238f, -0.0117957888f, -0.011831399f,
+    -0.0118665534f, -0.0119012506f, -0.0119354896f, -0.0119692691f,
+    -0.012002588f, -0.0120354453f, -0.0120678397f, -0.0120997703f,
+    -0.0121312359f, -0.0121622355f, -0.012192768f, -0.0122228325f,
+    -0.012252428f, -0.0122815535f, -0.0123102079f, -0.0123383904f,
+    -0.0123661001f, -0.0123933361f, -0.0124200974f, -0.0124463831f,
+    -0.0124721925f, -0.0124975248f, -0.012522379f, -0.0125467543f,
+    -0.0125706501f, -0.0125940656f, -0.012617f, -0.0126394525f,
+    -0.0126614225f, -0.0126829094f, -0.0127039123f, -0.0127244307f,
+    -0.012744464f, -0.0127640115f, -0.0127830726f, -0.0128016468f,
+    -0.0128197335f, -0.0128373321f, -0.0128544422f, -0.0128710632f,
+    -0.0128871947f, -0.0129028361f, -0.0129179871f, -0.0129326472f,
+    -0.012946816f, -0.0129604932f, -0.0129736782f, -0.0129863709f,
+    -0.0129985708f, -0.0130102776f, -0.0130214911f, -0.0130322109f,
+    -0.0130424368f, -0.0130521686f, -0.013061406f, -0.0130701489f,
+    -0.013078397f, -0.0130861501f, -0.0130934082f, -0.0131001711f,
+    -0.0131064387f, -0.0131122108f, -0.0131174875f, -0.0131222687f,
+    -0.0131265543f, -0.0131303443f, -0.0131336387f, -0.0131364375f,
+    -0.0131387408f, -0.0131405486f, -0.0131418611f, -0.0131426782f,
+    -0.0131430002f, -0.0131428271f, -0.013142159f, -0.0131409963f,
+    -0.013139339f, -0.0131371873f, -0.0131345415f, -0.0131314019f,
+    -0.0131277686f, -0.013123642f, -0.0131190223f, -0.0131139099f,
+    -0.0131083052f, -0.0131022084f, -0.0130956199f, -0.0130885402f,
+    -0.0130809696f, -0.0130729085f, -0.0130643575f, -0.0130553169f,
+    -0.0130457873f, -0.0130357692f, -0.013025263f, -0.0130142694f,
+    -0.0130027888f, -0.0129908218f, -0.0129783691f, -0.0129654313f,
+    -0.0129520088f, -0.0129381026f, -0.012923713f, -0.012908841f,
+    -0.0128934871f, -0.0128776521f, -0.0128613367f, -0.0128445416f,
+    -0.0128272677f, -0.0128095158f, -0.0127912865f, -0.0127725809f,
+    -0.0127533996f, -0.0127337435f, -0.0127136137f, -0.0126930108f,
+    -0.0126719359f, -0.0126503899f, -0.0126283737f, -0.0126058882f,
+    -0.0125829346f, -0.0125595137f, -0.0125356266f, -0.0125112743f,
+    -0.0124864579f, -0.0124611784f, -0.012435437f, -0.0124092347f,
+    -0.0123825726f, -0.012355452f, -0.0123278738f, -0.0122998394f,
+    -0.0122713499f, -0.0122424065f, -0.0122130104f, -0.0121831628f,
+    -0.0121528651f, -0.0121221185f, -0.0120909242f, -0.0120592837f,
+    -0.0120271981f, -0.0119946688f, -0.0119616973f, -0.0119282848f,
+    -0.0118944327f, -0.0118601425f, -0.0118254155f, -0.0117902533f,
+    -0.0117546572f, -0.0117186287f, -0.0116821693f, -0.0116452805f,
+    -0.0116079637f, -0.0115702207f, -0.0115320528f, -0.0114934616f,
+    -0.0114544487f, -0.0114150158f, -0.0113751643f, -0.011334896f,
+    -0.0112942125f, -0.0112531153f, -0.0112116063f, -0.011169687f,
+    -0.0111273592f, -0.0110846245f, -0.0110414848f, -0.0109979417f,
+    -0.010953997f, -0.0109096525f, -0.0108649099f, -0.0108197711f,
+    -0.0107742378f, -0.010728312f, -0.0106819954f, -0.0106352899f,
+    -0.0105881973f, -0.0105407196f, -0.0104928586f, -0.0104446164f,
+    -0.0103959947f, -0.0103469955f, -0.0102976208f, -0.0102478726f,
+    -0.0101977528f, -0.0101472634f, -0.0100964065f, -0.010045184f,
+    -0.00999359798f, -0.00994165052f, -0.00988934365f, -0.00983667946f,
+    -0.00978366002f, -0.00973028743f, -0.00967656381f, -0.00962249128f,
+    -0.00956807198f, -0.00951330805f, -0.00945820166f, -0.00940275499f,
+    -0.0093469702f, -0.00929084951f, -0.00923439513f, -0.00917760927f,
+    -0.00912049417f, -0.00906305208f, -0.00900528525f, -0.00894719595f,
+    -0.00888878646f, -0.00883005907f, -0.00877101609f, -0.00871165983f,
+    -0.00865199261f, -0.00859201678f, -0.00853173467f, -0.00847114865f,
+    -0.00841026108f, -0.00834907435f, -0.00828759084f, -0.00822581296f,
+    -0.00816374312f, -0.00810138373f, -0.00803873723f, -0.00797580605f,
+    -0.00791259267f, -0.00784909952f, -0.00778532909f, -0.00772128385f,
+    -0.0076569663f, -0.00759237893f, -0.00752752426f, -0.00746240481f,
+    -0.00739702309f, -0.00733138166f, -0.00726548305f, -0.00719932982f,
+    -0.00713292454f, -0.00706626978f, -0.00699936812f, -0.00693222214f,
+    -0.00686483446f, -0.00679720767f, -0.00672934439f, -0.00666124725f,
+    -0.00659291887f, -0.00652436189f, -0.00645557897f, -0.00638657275f,
+    -0.0063173459f, -0.0062479011f, -0.006178241f, -0.00610836831f,
+    -0.00603828571f, -0.0059679959f, -0.0058975016f, -0.0058268055f,
+    -0.00575591033f, -0.00568481883f, -0.00561353371f, -0.00554205773f,
+    -0.00547039362f, -0.00539854414f, -0.00532651205f, -0.00525430012f,
+    -0.0051819111f, -0.00510934779f, -0.00503661296f, -0.0049637094f,
+    -0.0048906399f, -0.00481740727f, -0.0047440143f, -0.00467046381f,
+    -0.00459675861f, -0.00452290152f, -0.00444889537f, -0.00437474298f,
+    -0.00430044719f, -0.00422601084f, -0.00415143676f, -0.00407672782f,
+    -0.00400188685f, -0.00392691672f, -0.00385182028f, -0.00377660041f,
+    -0.00370125996f, -0.0036258018f, -0.00355022883f, -0.0034745439f,
+    -0.0033987499f, -0.00332284972f, -0.00324684625f, -0.00317074238f,
+    -0.003094541f, -0.00301824501f, -0.00294185731f, -0.0028653808f,
+    -0.00278881839f, -0.00271217298f, -0.00263544748f, -0.00255864481f,
+    -0.00248176788f, -0.0024048196f, -0.0023278029f, -0.00225072069f,
+    -0.00217357589f, -0.00209637143f, -0.00201911023f, -0.00194179522f,
+    -0.00186442932f, -0.00178701545f, -0.00170955656f, -0.00163205556f,
+    -0.00155451539f, -0.00147693898f, -0.00139932925f, -0.00132168915f,
+    -0.0012440216f, -0.00116632954f, -0.00108861589f, -0.0010108836f,
+    -0.000933135583f, -0.000855374782f, -0.000777604127f, -0.000699826548f,
+    -0.000622044975f, -0.000544262338f, -0.000466481567f, -0.000388705589f,
+    -0.000310937331f, -0.00023317972f, -0.000155435679f, -7.77081314e-05f,
+    -3.10147083e-17f, 7.76857955e-05f, 0.000155346336f, 0.000232978706f,
+    0.00031057999f, 0.000388147274f, 0.000465677649f, 0.000543168206f,
+    0.000620616038f, 0.000698018242f, 0.000775371916f, 0.000852674163f,
+    0.000929922086f, 0.00100711279f, 0.00108424339f, 0.001161311f,
+    0.00123831273f, 0.0013152457f, 0.00139210704f, 0.00146889387f,
+    0.00154560333f, 0.00162223254f, 0.00169877865f, 0.00177523879f,
+    0.00185161011f, 0.00192788977f, 0.00200407492f, 0.00208016271f,
+    0.00215615031f, 0.00223203488f, 0.0023078136f, 0.00238348365f,
+    0.00245904221f, 0.00253448646f, 0.0026098136f, 0.00268502083f,
+    0.00276010534f, 0.00283506435f, 0.00290989507f, 0.00298459471f,
+    0.00305916051f, 0.0031335897f, 0.00320787951f, 0.00328202718f,
+    0.00335602996f, 0.00342988512f, 0.0035035899f, 0.00357714158f,
+    0.00365053744f, 0.00372377475f, 0.0037968508f, 0.00386976289f,
+    0.00394250832f, 0.0040150844f, 0.00408748844f, 0.00415971777f,
+    0.00423176972f, 0.00430364162f, 0.00437533082f, 0.00444683468f,
+    0.00451815055f, 0.00458927581f, 0.00466020783f, 0.00473094399f,
+    0.00480148169f, 0.00487181833f, 0.00494195132f, 0.00501187808f,
+    0.00508159603f, 0.00515110261f, 0.00522039526f, 0.00528947144f,
+    0.0053583286f, 0.00542696421f, 0.00549537576f, 0.00556356073f,
+    0.00563151663f, 0.00569924095f, 0.00576673121f, 0.00583398495f,
+    0.00590099969f, 0.00596777298f, 0.00603430238f, 0.00610058545f,
+    0.00616661977f, 0.00623240292f, 0.00629793249f, 0.0063632061f,
+    0.00642822135f, 0.00649297588f, 0.00655746732f, 0.00662169331f,
+    0.00668565153f, 0.00674933962f, 0.00681275528f, 0.00687589619f,
+    0.00693876006f, 0.00700134459f, 0.00706364752f, 0.00712566657f,
+    0.00718739949f, 0.00724884405f, 0.007309998f, 0.00737085913f,
+    0.00743142524f, 0.00749169412f, 0.00755166359f, 0.00761133149f,
+    0.00767069564f, 0.0077297539f, 0.00778850414f, 0.00784694424f,
+    0.00790507207f, 0.00796288554f, 0.00802038257f, 0.00807756108f,
+    0.008134419f, 0.0081909543f, 0.00824716493f, 0.00830304887f,
+    0.00835860411f, 0.00841382865f, 0.0084687205f, 0.00852327771f,
+    0.00857749829f, 0.00863138033f, 0.00868492187f, 0.008738121f,
+    0.00879097582f, 0.00884348443f, 0.00889564497f, 0.00894745555f,
+    0.00899891434f, 0.00905001949f, 0.00910076919f, 0.00915116162f,
+    0.00920119498f, 0.00925086751f, 0.00930017742f, 0.00934912298f,
+    0.00939770243f, 0.00944591405f, 0.00949375614f, 0.009541227f,
+    0.00958832495f, 0.00963504832f, 0.00968139546f, 0.00972736473f,
+    0.00977295451f, 0.00981816319f, 0.00986298917f, 0.00990743089f,
+    0.00995148677f, 0.00999515528f, 0.0100384349f, 0.010081324f,
+    0.0101238212f, 0.010165925f, 0.0102076339f, 0.0102489465f,
+    0.0102898612f, 0.0103303767f, 0.0103704916f, 0.0104102044f,
+    0.0104495139f, 0.0104884185f, 0.0105269171f, 0.0105650082f,
+    0.0106026905f, 0.0106399627f, 0.0106768235f, 0.0107132718f,
+    0.0107493061f, 0.0107849253f, 0.0108201282f, 0.0108549135f,
+    0.01088928f, 0.0109232267f, 0.0109567522f, 0.0109898556f,
+    0.0110225356f, 0.0110547911f, 0.0110866211f, 0.0111180244f,
+    0.0111490001f, 0.011179547f, 0.0112096642f, 0.0112393506f,
+    0.0112686053f, 0.0112974272f, 0.0113258154f, 0.011353769f,
+    0.0113812869f, 0.0114083684f, 0.0114350125f, 0.0114612184f,
+    0.0114869851f, 0.0115123119f, 0.0115371978f, 0.0115616422f,
+    0.0115856441f, 0.0116092029f, 0.0116323178f, 0.0116549879f,
+    0.0116772127f, 0.0116989913f, 0.0117203231f, 0.0117412074f,
+    0.0117616436f, 0.011781631f, 0.011801169f, 0.011820257f,
+    0.0118388943f, 0.0118570805f, 0.011874815f, 0.0118920971f,
+    0.0119089265f, 0.0119253026f, 0.0119412248f, 0.0119566929f,
+    0.0119717062f, 0.0119862643f, 0.0120003669f, 0.0120140136f,
+    0.0120272039f, 0.0120399374f, 0.0120522139f, 0.012064033f,
+    0.0120753944f, 0.0120862978f, 0.0120967429f, 0.0121067295f,
+    0.0121162572f, 0.0121253259f, 0.0121339354f, 0.0121420855f,
+    0.012149776f, 0.0121570067f, 0.0121637775f, 0.0121700882f,
+    0.0121759389f, 0.0121813293f, 0.0121862594f, 0.0121907292f,
+    0.0121947386f, 0.0121982876f, 0.0122013762f, 0.0122040044f,
+    0.0122061722f, 0.0122078798f, 0.0122091271f, 0.0122099142f,
+    0.0122102413f, 0.0122101084f, 0.0122095157f, 0.0122084634f,
+    0.0122069517f, 0.0122049806f, 0.0122025504f, 0.0121996614f,
+    0.0121963138f, 0.0121925078f, 0.0121882437f, 0.0121835218f,
+    0.0121783424f, 0.0121727059f, 0.0121666125f, 0.0121600627f,
+    0.0121530568f, 0.0121455952f, 0.0121376783f, 0.0121293065f,
+    0.0121204804f, 0.0121112003f, 0.0121014667f, 0.0120912802f,
+    0.0120806412f, 0.0120695503f, 0.012058008f, 0.0120460149f,
+    0.0120335715f, 0.0120206785f, 0.0120073365f, 0.011993546f,
+    0.0119793079f, 0.0119646226f, 0.0119494909f, 0.0119339135f,
+    0.0119178911f, 0.0119014245f, 0.0118845143f, 0.0118671614f,
+    0.0118493665f, 0.0118311304f, 0.0118124539f, 0.0117933379f,
+    0.0117737832f, 0.0117537907f, 0.0117333612f, 0.0117124957f,
+    0.011691195f, 0.01166946f, 0.0116472918f, 0.0116246913f,
+    0.0116016594f, 0.0115781971f, 0.0115543055f, 0.0115299856f,
+    0.0115052383f, 0.0114800649f, 0.0114544662f, 0.0114284435f,
+    0.0114019977f, 0.0113751301f, 0.0113478418f, 0.0113201338f,
+    0.0112920075f, 0.0112634638f, 0.0112345041f, 0.0112051296f,
+    0.0111753415f, 0.0111451409f, 0.0111145292f, 0.0110835077f,
+    0.0110520776f, 0.0110202402f, 0.0109879968f, 0.0109553489f,
+    0.0109222976f, 0.0108888444f, 0.0108549906f, 0.0108207377f,
+    0.010786087f, 0.01075104f, 0.010715598f, 0.0106797626f,
+    0.0106435352f, 0.0106069173f, 0.0105699103f, 0.0105325158f,
+    0.0104947352f, 0.0104565702f, 0.0104180223f, 0.0103790929f,
+    0.0103397838f, 0.0103000965f, 0.0102600325f, 0.0102195935f,
+    0.0101787812f, 0.0101375972f, 0.010096043f, 0.0100541205f,
+    0.0100118313f, 0.00996917705f, 0.00992615949f, 0.00988278035f,
+    0.00983904136f, 0.00979494427f, 0.00975049084f, 0.00970568286f,
+    0.00966052209f, 0.00961501035f, 0.00956914946f, 0.00952294123f,
+    0.0094763875f, 0.00942949013f, 0.00938225098f, 0.00933467193f,
+    0.00928675486f, 0.00923850167f, 0.00918991429f, 0.00914099462f,
+    0.00909174461f, 0.0090421662f, 0.00899226136f, 0.00894203206f,
+    0.00889148028f, 0.00884060802f, 0.00878941728f, 0.00873791009f,
+    0.00868608846f, 0.00863395444f, 0.00858151009f, 0.00852875747f,
+    0.00847569864f, 0.0084223357f, 0.00836867074f, 0.00831470587f,
+    0.0082604432f, 0.00820588486f, 0.00815103299f, 0.00809588975f,
+    0.00804045728f, 0.00798473776f, 0.00792873337f, 0.00787244629f,
+    0.00781587873f, 0.0077590329f, 0.00770191101f, 0.0076445153f,
+    0.00758684801f, 0.00752891137f, 0.00747070766f, 0.00741223914f,
+    0.00735350808f, 0.00729451677f, 0.00723526751f, 0.0071757626f,
+    0.00711600435f, 0.00705599509f, 0.00699573714f, 0.00693523285f,
+    0.00687448457f, 0.00681349464f, 0.00675226544f, 0.00669079935f,
+    0.00662909873f, 0.00656716598f, 0.00650500351f, 0.0064426137f,
+    0.00637999899f, 0.00631716179f, 0.00625410452f, 0.00619082964f,
+    0.00612733957f, 0.00606363677f, 0.00599972371f, 0.00593560285f,
+    0.00587127665f, 0.00580674761f, 0.0057420182f, 0.00567709093f,
+    0.00561196829f, 0.00554665279f, 0.00548114695f, 0.00541545328f,
+    0.00534957432f, 0.00528351259f, 0.00521727064f, 0.00515085101f,
+    0.00508425625f, 0.00501748892f, 0.00495055158f, 0.00488344681f,
+    0.00481617717f, 0.00474874524f, 0.00468115362f, 0.00461340488f,
+    0.00454550163f, 0.00447744647f, 0.004409242f, 0.00434089083f,
+    0.00427239558f, 0.00420375887f, 0.00413498332f, 0.00406607157f,
+    0.00399702623f, 0.00392784997f, 0.0038585454f, 0.00378911519f,
+    0.00371956198f, 0.00364988842f, 0.00358009717f, 0.0035101909f,
+    0.00344017226f, 0.00337004393f, 0.00329980858f, 0.00322946889f,
+    0.00315902752f, 0.00308848717f, 0.00301785051f, 0.00294712024f,
+    0.00287629904f, 0.00280538961f, 0.00273439463f, 0.00266331682f,
+    0.00259215886f, 0.00252092347f, 0.00244961334f, 0.00237823118f,
+    0.0023067797f, 0.00223526161f, 0.00216367961f, 0.00209203644f,
+    0.00202033479f, 0.00194857739f, 0.00187676695f, 0.0018049062f,
+    0.00173299785f, 0.00166104462f, 0.00158904923f, 0.00151701442f,
+    0.0014449429f, 0.00137283739f, 0.00130070062f, 0.00122853532f,
+    0.00115634422f, 0.00108413003f, 0.00101189548f, 0.000939643296f,
+    0.00086737621f, 0.000795096943f, 0.00072280822f, 0.000650512766f,
+    0.000578213304f, 0.00050591256f, 0.000433613254f, 0.000361318109f,
+    0.000289029847f, 0.000216751187f, 0.000144484847f, 7.22335462e-05f,
+    -1.15464763e-17f, -7.22130765e-05f, -0.00014440297f, -0.000216566969f,
+    -0.000288702364f, -0.000360806446f, -0.000432876509f, -0.00050490985f,
+    -0.000576903766f, -0.000648855558f, -0.000720762528f, -0.000792621981f,
+    -0.000864431226f, -0.000936187572f, -0.00100788833f, -0.00107953082f,
+    -0.00115111237f, -0.00122263028f, -0.00129408189f, -0.00136546452f,
+    -0.00143677551f, -0.00150801219f, -0.0015791719f, -0.00165025199f,
+    -0.00172124979f, -0.00179216266f, -0.00186298796f, -0.00193372304f,
+    -0.00200436525f, -0.00207491198f, -0.00214536059f, -0.00221570845f,
+    -0.00228595295f, -0.00235609147f, -0.00242612139f, -0.00249604011f,
+    -0.00256584504f, -0.00263553357f, -0.00270510312f, -0.00277455109f,
+    -0.0028438749f, -0.00291307199f, -0.00298213979f, -0.00305107571f,
+    -0.00311987722f, -0.00318854176f, -0.00325706677f, -0.00332544973f,
+    -0.00339368809f, -0.00346177933f, -0.00352972092f, -0.00359751034f,
+    -0.0036651451f, -0.00373262268f, -0.00379994059f, -0.00386709635f,
+    -0.00393408745f, -0.00400091144f, -0.00406756584f, -0.0041340482f,
+    -0.00420035604f, -0.00426648694f, -0.00433243844f, -0.00439820812f,
+    -0.00446379355f, -0.00452919232f, -0.004594402f, -0.00465942021f,
+    -0.00472424455f, -0.00478887262f, -0.00485330206f, -0.0049175305f,
+    -0.00498155556f, -0.00504537491f, -0.00510898619f, -0.00517238706f,
+    -0.00523557521f, -0.00529854831f, -0.00536130404f, -0.00542384012f,
+    -0.00548615424f, -0.00554824413f, -0.0056101075f, -0.00567174209f,
+    -0.00573314565f, -0.00579431594f, -0.0058552507f, -0.00591594772f,
+    -0.00597640477f, -0.00603661965f, -0.00609659016f, -0.00615631412f,
+    -0.00621578933f, -0.00627501363f, -0.00633398486f, -0.00639270088f,
+    -0.00645115955f, -0.00650935873f, -0.0065672963f, -0.00662497017f,
+    -0.00668237823f, -0.0067395184f, -0.0067963886f, -0.00685298677f,
+    -0.00690931084f, -0.00696535879f, -0.00702112857f, -0.00707661816f,
+    -0.00713182556f, -0.00718674877f, -0.00724138579f, -0.00729573466f,
+    -0.0073497934f, -0.00740356006f, -0.0074570327f, -0.0075102094f,
+    -0.00756308822f, -0.00761566727f, -0.00766794465f, -0.00771991847f,
+    -0.00777158687f, -0.00782294799f, -0.00787399997f, -0.00792474099f,
+    -0.00797516922f, -0.00802528285f, -0.00807508008f, -0.00812455912f,
+    -0.00817371821f, -0.00822255559f, -0.00827106949f, -0.0083192582f,
+    -0.00836711998f, -0.00841465313f, -0.00846185595f, -0.00850872676f,
+    -0.00855526388f, -0.00860146565f, -0.00864733044f, -0.00869285661f,
+    -0.00873804254f, -0.00878288662f, -0.00882738727f, -0.0088715429f,
+    -0.00891535195f, -0.00895881287f, -0.00900192412f, -0.00904468417f,
+    -0.00908709152f, -0.00912914467f, -0.00917084213f, -0.00921218243f,
+    -0.00925316412f, -0.00929378576f, -0.00933404592f, -0.00937394318f,
+    -0.00941347614f, -0.00945264343f, -0.00949144366f, -0.00952987548f,
+    -0.00956793755f, -0.00960562853f, -0.00964294712f, -0.00967989201f,
+    -0.00971646192f, -0.00975265558f, -0.00978847173f, -0.00982390912f,
+    -0.00985896653f, -0.00989364276f, -0.00992793659f, -0.00996184684f,
+    -0.00999537236f, -0.010028512f, -0.0100612646f, -0.010093629f,
+    -0.0101256041f, -0.0101571889f, -0.0101883823f, -0.0102191831f,
+    -0.0102495904f, -0.0102796031f, -0.0103092202f, -0.0103384407f,
+    -0.0103672636f, -0.0103956879f, -0.0104237126f, -0.0104513369f,
+    -0.0104785598f, -0.0105053804f, -0.0105317978f, -0.0105578111f,
+    -0.0105834194f, -0.010608622f, -0.0106334179f, -0.0106578063f,
+    -0.0106817865f, -0.0107053576f, -0.0107285189f, -0.0107512696f,
+    -0.010773609f, -0.0107955363f, -0.0108170509f, -0.0108381521f,
+    -0.0108588391f, -0.0108791114f, -0.0108989682f, -0.0109184089f,
+    -0.010937433f, -0.0109560397f, -0.0109742287f, -0.0109919992f,
+    -0.0110093507f, -0.0110262827f, -0.0110427946f, -0.011058886f,
+    -0.0110745564f, -0.0110898053f, -0.0111046323f, -0.0111190369f,
+    -0.0111330186f, -0.0111465771f, -0.011159712f, -0.011172423f,
+    -0.0111847095f, -0.0111965714f, -0.0112080083f, -0.0112190198f,
+    -0.0112296058f, -0.0112397658f, -0.0112494996f, -0.0112588071f,
+    -0.0112676879f, -0.0112761418f, -0.0112841687f, -0.0112917684f,
+    -0.0112989406f, -0.0113056853f, -0.0113120024f, -0.0113178916f,
+    -0.0113233529f, -0.0113283863f, -0.0113329915f, -0.0113371687f,
+    -0.0113409177f, -0.0113442386f, -0.0113471313f, -0.0113495958f,
+    -0.0113516322f, -0.0113532405f, -0.0113544208f, -0.0113551732f,
+    -0.0113554976f, -0.0113553944f, -0.0113548635f, -0.0113539051f,
+    -0.0113525194f, -0.0113507065f, -0.0113484667f, -0.0113458001f,
+    -0.0113427069f, -0.0113391875f, -0.011335242f, -0.0113308707f,
+    -0.0113260739f, -0.0113208519f, -0.011315205f, -0.0113091336f,
+    -0.011302638f, -0.0112957185f, -0.0112883756f, -0.0112806096f,
+    -0.011272421f, -0.0112638101f, -0.0112547775f, -0.0112453235f,
+    -0.0112354487f, -0.0112251536f, -0.0112144386f, -0.0112033042f,
+    -0.0111917511f, -0.0111797797f, -0.0111673906f, -0.0111545845f,
+    -0.0111413619f, -0.0111277234f, -0.0111136697f, -0.0110992013f,
+    -0.0110843191f, -0.0110690236f, -0.0110533155f, -0.0110371955f,
+    -0.0110206645f, -0.011003723f, -0.0109863719f, -0.0109686119f,
+    -0.0109504438f, -0.0109318685f, -0.0109128866f, -0.0108934991f,
+    -0.0108737068f, -0.0108535106f, -0.0108329113f, -0.0108119098f,
+    -0.010790507f, -0.0107687039f, -0.0107465014f, -0.0107239004f,
+    -0.0107009018f, -0.0106775068f, -0.0106537161f, -0.010629531f,
+    -0.0106049523f, -0.0105799812f, -0.0105546186f, -0.0105288657f,
+    -0.0105027235f, -0.0104761931f, -0.0104492756f, -0.0104219722f,
+    -0.010394284f, -0.0103662121f, -0.0103377576f, -0.0103089219f,
+    -0.010279706f, -0.0102501112f, -0.0102201387f, -0.0101897897f,
+    -0.0101590655f, -0.0101279673f, -0.0100964965f, -0.0100646543f,
+    -0.0100324419f, -0.00999986084f, -0.00996691231f, -0.00993359768f,
+    -0.0098999183f, -0.00986587556f, -0.00983147083f, -0.00979670552f,
+    -0.00976158103f, -0.00972609878f, -0.00969026022f, -0.00965406679f,
+    -0.00961751996f, -0.0095806212f, -0.009543372f, -0.00950577385f,
+    -0.00946782829f, -0.00942953682f, -0.00939090099f, -0.00935192236f,
+    -0.00931260248f, -0.00927294294f, -0.00923294531f, -0.00919261121f,
+    -0.00915194225f, -0.00911094004f, -0.00906960624f, -0.00902794248f,
+    -0.00898595043f, -0.00894363177f, -0.00890098818f, -0.00885802135f,
+    -0.008814733f, -0.00877112485f, -0.00872719862f, -0.00868295606f,
+    -0.00863839893f, -0.00859352899f, -0.00854834802f, -0.0085028578f,
+    -0.00845706015f, -0.00841095686f, -0.00836454977f, -0.0083178407f,
+    -0.0082708315f, -0.00822352401f, -0.00817592012f, -0.00812802169f,
+    -0.00807983061f, -0.00803134877f, -0.00798257809f, -0.00793352048f,
+    -0.00788417787f, -0.00783455219f, -0.0077846454f, -0.00773445946f,
+    -0.00768399632f, -0.00763325798f, -0.00758224641f, -0.00753096362f,
+    -0.00747941161f, -0.00742759241f, -0.00737550802f, -0.0073231605f,
+    -0.00727055189f, -0.00721768423f, -0.0071645596f, -0.00711118007f,
+    -0.00705754772f, -0.00700366463f, -0.00694953292f, -0.00689515468f,
+    -0.00684053203f, -0.00678566711f, -0.00673056204f, -0.00667521896f,
+    -0.00661964003f, -0.0065638274f, -0.00650778325f, -0.00645150975f,
+    -0.00639500908f, -0.00633828343f, -0.006281335f, -0.006224166f,
+    -0.00616677865f, -0.00610917516f, -0.00605135777f, -0.00599332871f,
+    -0.00593509023f, -0.00587664458f, -0.00581799402f, -0.00575914081f,
+    -0.00570008723f, -0.00564083555f, -0.00558138808f, -0.00552174708f,
+    -0.00546191488f, -0.00540189377f, -0.00534168607f, -0.0052812941f,
+    -0.00522072017f, -0.00515996664f, -0.00509903582f, -0.00503793008f,
+    -0.00497665175f, -0.0049152032f, -0.00485358678f, -0.00479180486f,
+    -0.00472985982f, -0.00466775403f, -0.00460548988f, -0.00454306975f,
+    -0.00448049605f, -0.00441777116f, -0.0043548975f, -0.00429187747f,
+    -0.00422871349f, -0.00416540798f, -0.00410196336f, -0.00403838206f,
+    -0.0039746665f, -0.00391081914f, -0.0038468424f, -0.00378273874f,
+    -0.0037185106f, -0.00365416044f, -0.00358969071f, -0.00352510388f,
+    -0.00346040241f, -0.00339558877f, -0.00333066543f, -0.00326563487f,
+    -0.00320049956f, -0.00313526199f, -0.00306992464f, -0.00300449001f,
+    -0.00293896058f, -0.00287333884f, -0.0028076273f, -0.00274182845f,
+    -0.0026759448f, -0.00260997885f, -0.0025439331f, -0.00247781007f,
+    -0.00241161227f, -0.00234534221f, -0.00227900241f, -0.00221259539f,
+    -0.00214612366f, -0.00207958974f, -0.00201299617f, -0.00194634546f,
+    -0.00187964013f, -0.00181288273f, -0.00174607576f, -0.00167922177f,
+    -0.00161232329f, -0.00154538284f, -0.00147840297f, -0.00141138619f,
+    -0.00134433505f, -0.00127725208f, -0.00121013982f, -0.00114300079f,
+    -0.00107583755f, -0.00100865261f, -0.000941448526f, -0.000874227825f,
+    -0.000806993044f, -0.000739746719f, -0.000672491385f, -0.000605229579f,
+    -0.000537963833f, -0.000470696683f, -0.000403430662f, -0.000336168302f,
+    -0.000268912135f, -0.000201664692f, -0.000134428503f, -6.72060965e-05f,
+    -1.07320131e-16f, 6.71872603e-05f, 0.00013435316f, 0.000201495175f,
+    0.000268610785f, 0.000335697469f, 0.000402752709f, 0.00046977399f,
+    0.000536758796f, 0.000603704616f, 0.00067060894f, 0.00073746926f,
+    0.00080428307f, 0.000871047868f, 0.000937761154f, 0.00100442043f,
+    0.0010710232f, 0.00113756697f, 0.00120404926f, 0.00127046757f,
+    0.00133681942f, 0.00140310234f, 0.00146931385f, 0.00153545147f,
+    0.00160151274f, 0.00166749518f, 0.00173339634f, 0.00179921376f,
+    0.00186494497f, 0.00193058754f, 0.00199613901f, 0.00206159695f,
+    0.0021269589f, 0.00219222244f, 0.00225738514f, 0.00232244457f,
+    0.00238739832f, 0.00245224396f, 0.00251697908f, 0.00258160127f,
+    0.00264610815f, 0.0027104973f, 0.00277476633f, 0.00283891287f,
+    0.00290293453f, 0.00296682892f, 0.00303059369f, 0.00309422647f,
+    0.0031577249f, 0.00322108662f, 0.00328430929f, 0.00334739056f,
+    0.0034103281f, 0.00347311959f, 0.00353576269f, 0.00359825508f,
+    0.00366059447f, 0.00372277854f, 0.00378480499f, 0.00384667154f,
+    0.0039083759f, 0.00396991579f, 0.00403128893f, 0.00409249307f,
+    0.00415352595f, 0.00421438532f, 0.00427506892f, 0.00433557454f,
+    0.00439589994f, 0.00445604289f, 0.00451600119f, 0.00457577263f,
+    0.00463535501f, 0.00469474613f, 0.00475394383f, 0.00481294591f,
+    0.00487175022f, 0.00493035459f, 0.00498875688f, 0.00504695494f,
+    0.00510494663f, 0.00516272984f, 0.00522030244f, 0.00527766233f,
+    0.0053348074f, 0.00539173556f, 0.00544844473f, 0.00550493284f,
+    0.00556119782f, 0.00561723761f, 0.00567305017f, 0.00572863345f,
+    0.00578398544f, 0.0058391041f, 0.00589398744f, 0.00594863344f,
+    0.00600304012f, 0.00605720549f, 0.00611112759f, 0.00616480445f,
+    0.00621823412f, 0.00627141465f, 0.00632434412f, 0.0063770206f,
+    0.00642944217f, 0.00648160693f, 0.006533513f, 0.00658515849f,
+    0.00663654152f, 0.00668766024f, 0.0067385128f, 0.00678909735f,
+    0.00683941206f, 0.00688945512f, 0.00693922471f, 0.00698871905f,
+    0.00703793634f, 0.0070868748f, 0.00713553268f, 0.00718390821f,
+    0.00723199966f, 0.00727980529f, 0.00732732339f, 0.00737455224f,
+    0.00742149014f, 0.00746813542f, 0.00751448639f, 0.0075605414f,
+    0.00760629879f, 0.00765175692f, 0.00769691416f, 0.0077417689f,
+    0.00778631953f, 0.00783056446f, 0.00787450211f, 0.00791813091f,
+    0.00796144931f, 0.00800445576f, 0.00804714872f, 0.00808952668f,
+    0.00813158813f, 0.00817333158f, 0.00821475553f, 0.00825585853f,
+    0.00829663911f, 0.00833709582f, 0.00837722724f, 0.00841703195f,
+    0.00845650853f, 0.00849565559f, 0.00853447175f, 0.00857295564f,
+    0.00861110591f, 0.0086489212f, 0.0086864002f, 0.00872354158f,
+    0.00876034403f, 0.00879680628f, 0.00883292703f, 0.00886870503f,
+    0.00890413902f, 0.00893922777f, 0.00897397005f, 0.00900836464f,
+    0.00904241036f, 0.00907610601f, 0.00910945043f, 0.00914244245f,
+    0.00917508094f, 0.00920736477f, 0.00923929281f, 0.00927086396f,
+    0.00930207714f, 0.00933293126f, 0.00936342528f, 0.00939355813f,
+    0.0094233288f, 0.00945273624f, 0.00948177947f, 0.00951045749f,
+    0.00953876932f, 0.00956671399f, 0.00959429057f, 0.0096214981f,
+    0.00964833567f, 0.00967480238f, 0.00970089733f, 0.00972661964f,
+    0.00975196844f, 0.00977694289f, 0.00980154215f, 0.0098257654f,
+    0.00984961183f, 0.00987308065f, 0.00989617108f, 0.00991888236f,
+    0.00994121374f, 0.00996316448f, 0.00998473386f, 0.0100059212f,
+    0.0100267257f, 0.0100471469f, 0.0100671839f, 0.0100868362f,
+    0.0101061031f, 0.0101249841f, 0.0101434784f, 0.0101615856f,
+    0.010179305f, 0.0101966361f, 0.0102135783f, 0.0102301311f,
+    0.0102462941f, 0.0102620666f, 0.0102774482f, 0.0102924385f,
+    0.010307037f, 0.0103212432f, 0.0103350568f, 0.0103484772f,
+    0.0103615042f, 0.0103741373f, 0.0103863761f, 0.0103982204f,
+    0.0104096698f, 0.0104207239f, 0.0104313825f, 0.0104416453f,
+    0.0104515119f, 0.0104609822f, 0.0104700558f, 0.0104787326f,
+    0.0104870123f, 0.0104948948f, 0.0105023798f, 0.0105094672f,
+    0.0105161568f, 0.0105224484f, 0.0105283421f, 0.0105338376f,
+    0.0105389348f, 0.0105436337f, 0.0105479342f, 0.0105518362f,
+    0.0105553398f, 0.0105584448f, 0.0105611513f, 0.0105634594f,
+    0.0105653689f, 0.01056688f, 0.0105679927f, 0.0105687072f,
+    0.0105690233f, 0.0105689414f, 0.0105684614f, 0.0105675835f,
+    0.0105663079f, 0.0105646347f, 0.0105625641f, 0.0105600963f,
+    0.0105572314f, 0.0105539698f, 0.0105503116f, 0.010546257f,
+    0.0105418064f, 0.0105369601f, 0.0105317182f, 0.0105260812f,
+    0.0105200493f, 0.0105136229f, 0.0105068023f, 0.0104995879f,
+    0.0104919801f, 0.0104839793f, 0.0104755859f, 0.0104668003f,
+    0.0104576229f, 0.0104480543f, 0.0104380948f, 0.010427745f,
+    0.0104170054f, 0.0104058765f, 0.0103943587f, 0.0103824527f,
+    0.010370159f, 0.0103574782f, 0.0103444108f, 0.0103309575f,
+    0.0103171188f, 0.0103028955f, 0.0102882881f, 0.0102732973f,
+    0.0102579238f, 0.0102421682f, 0.0102260313f, 0.0102095138f,
+    0.0101926164f, 0.0101753398f, 0.0101576848f, 0.0101396522f,
+    0.0101212427f, 0.0101024572f, 0.0100832965f, 0.0100637613f,
+    0.0100438526f, 0.0100235712f, 0.0100029179f, 0.00998189365f,
+    0.00996049933f, 0.00993873585f, 0.00991660413f, 0.0098941051f,
+    0.00987123972f, 0.00984800895f, 0.00982441376f, 0.00980045515f,
+    0.00977613412f, 0.00975145169f, 0.00972640888f, 0.00970100674f,
+    0.00967524633f, 0.00964912872f, 0.00962265499f, 0.00959582623f,
+    0.00956864356f, 0.00954110809f, 0.00951322097f, 0.00948498334f,
+    0.00945639636f, 0.00942746121f, 0.00939817907f, 0.00936855114f,
+    0.00933857864f, 0.00930826278f, 0.00927760481f, 0.00924660598f,
+    0.00921526754f, 0.00918359078f, 0.00915157698f, 0.00911922744f,
+    0.00908654347f, 0.00905352639f, 0.00902017755f, 0.00898649828f,
+    0.00895248996f, 0.00891815395f, 0.00888349163f, 0.00884850441f,
+    0.00881319369f, 0.00877756089f, 0.00874160744f, 0.00870533479f,
+    0.00866874439f, 0.00863183771f, 0.00859461622f, 0.00855708141f,
+    0.00851923479f, 0.00848107787f, 0.00844261217f, 0.00840383922f,
+    0.00836476057f, 0.00832537779f, 0.00828569242f, 0.00824570606f,
+    0.0082054203f, 0.00816483672f, 0.00812395696f, 0.00808278262f,
+    0.00804131534f, 0.00799955676f, 0.00795750854f, 0.00791517235f,
+    0.00787254984f, 0.00782964272f, 0.00778645267f, 0.0077429814f,
+    0.00769923063f, 0.00765520208f, 0.00761089748f, 0.00756631859f,
+    0.00752146715f, 0.00747634494f, 0.00743095372f, 0.00738529528f,
+    0.00733937142f, 0.00729318393f, 0.00724673463f, 0.00720002535f,
+    0.00715305791f, 0.00710583416f, 0.00705835594f, 0.00701062511f,
+    0.00696264354f, 0.00691441311f, 0.0068659357f, 0.00681721321f,
+    0.00676824754f, 0.0067190406f, 0.00666959432f, 0.00661991061f,
+    0.00656999142f, 0.0065198387f, 0.00646945439f, 0.00641884046f,
+    0.00636799888f, 0.00631693162f, 0.00626564068f, 0.00621412804f,
+    0.00616239572f, 0.0061104457f, 0.00605828003f, 0.00600590071f,
+    0.00595330978f, 0.00590050928f, 0.00584750126f, 0.00579428776f,
+    0.00574087086f, 0.00568725262f, 0.00563343511f, 0.00557942042f,
+    0.00552521064f, 0.00547080785f, 0.00541621417f, 0.00536143171f,
+    0.00530646257f, 0.00525130888f, 0.00519597277f, 0.00514045638f,
+    0.00508476183f, 0.00502889129f, 0.00497284691f, 0.00491663083f,
+    0.00486024524f, 0.00480369229f, 0.00474697416f, 0.00469009305f,
+    0.00463305112f, 0.00457585058f, 0.00451849363f, 0.00446098246f,
+    0.0044033193f, 0.00434550634f, 0.00428754581f, 0.00422943993f,
+    0.00417119094f, 0.00411280106f, 0.00405427253f, 0.0039956076f,
+    0.00393680851f, 0.00387787751f, 0.00381881687f, 0.00375962883f,
+    0.00370031567f, 0.00364087966f, 0.00358132306f, 0.00352164815f,
+    0.00346185721f, 0.00340195253f, 0.00334193639f, 0.00328181108f,
+    0.00322157891f, 0.00316124216f, 0.00310080314f, 0.00304026415f,
+    0.0029796275f, 0.00291889551f, 0.00285807047f, 0.00279715472f,
+    0.00273615057f, 0.00267506034f, 0.00261388636f, 0.00255263095f,
+    0.00249129644f, 0.00242988516f, 0.00236839946f, 0.00230684166f,
+    0.0022452141f, 0.00218351912f, 0.00212175907f, 0.00205993629f,
+    0.00199805313f, 0.00193611192f, 0.00187411502f, 0.00181206479f,
+    0.00174996356f, 0.00168781371f, 0.00162561757f, 0.0015633775f,
+    0.00150109586f, 0.00143877501f, 0.00137641731f, 0.0013140251f,
+    0.00125160076f, 0.00118914664f, 0.00112666511f, 0.00106415851f,
+    0.00100162922f, 0.000939079593f, 0.000876511992f, 0.000813928778f,
+    0.000751332311f, 0.000688724953f, 0.000626109065f, 0.000563487006f,
+    0.000500861137f, 0.000438233818f, 0.000375607406f, 0.00031298426f,
+    0.000250366738f, 0.000187757196f, 0.00012515799f, 6.25714732e-05f,
+    6.494376e-17f, -6.25540777e-05f, -0.000125088409f, -0.000187600645f,
+    -0.000250088437f, -0.000312549438f, -0.000374981305f, -0.000437381695f,
+    -0.000499748265f, -0.000562078678f, -0.000624370595f, -0.000686621681f,
+    -0.000748829605f, -0.000810992034f, -0.000873106642f, -0.000935171101f,
+    -0.000997183089f, -0.00105914028f, -0.00112104037f, -0.00118288103f,
+    -0.00124465996f, -0.00130637483f, -0.00136802336f, -0.00142960322f,
+    -0.00149111214f, -0.0015525478f, -0.00161390791f, -0.00167519019f,
+    -0.00173639234f, -0.0017975121f, -0.00185854716f, -0.00191949528f,
+    -0.00198035416f, -0.00204112155f, -0.00210179517f, -0.00216237278f,
+    -0.00222285212f, -0.00228323094f, -0.00234350698f, -0.00240367802f,
+    -0.00246374181f, -0.00252369613f, -0.00258353873f, -0.00264326741f,
+    -0.00270287994f, -0.00276237412f, -0.00282174772f, -0.00288099856f,
+    -0.00294012444f, -0.00299912315f, -0.00305799252f, -0.00311673037f,
+    -0.00317533452f, -0.00323380279f, -0.00329213303f, -0.00335032308f,
+    -0.00340837079f, -0.003466274f, -0.00352403058f, -0.00358163839f,
+    -0.00363909531f, -0.00369639922f, -0.00375354799f, -0.00381053952f,
+    -0.00386737171f, -0.00392404246f, -0.00398054969f, -0.0040368913f,
+    -0.00409306522f, -0.00414906939f, -0.00420490174f, -0.00426056022f,
+    -0.00431604278f, -0.00437134738f, -0.00442647199f, -0.00448141458f,
+    -0.00453617312f, -0.00459074562f, -0.00464513007f, -0.00469932447f,
+    -0.00475332683f, -0.00480713518f, -0.00486074754f, -0.00491416194f,
+    -0.00496737643f, -0.00502038907f, -0.00507319791f, -0.00512580101f,
+    -0.00517819646f, -0.00523038234f, -0.00528235674f, -0.00533411777f,
+    -0.00538566353f, -0.00543699214f, -0.00548810174f, -0.00553899045f,
+    -0.00558965642f, -0.0056400978f, -0.00569031277f, -0.00574029948f,
+    -0.00579005612f, -0.00583958089f, -0.00588887197f, -0.00593792759f,
+    -0.00598674595f, -0.00603532528f, -0.00608366383f, -0.00613175983f,
+    -0.00617961155f, -0.00622721724f, -0.0062745752f, -0.00632168369f,
+    -0.00636854101f, -0.00641514548f, -0.00646149541f, -0.00650758911f,
+    -0.00655342493f, -0.00659900122f, -0.00664431632f, -0.0066893686f,
+    -0.00673415645f, -0.00677867824f, -0.00682293237f, -0.00686691726f,
+    -0.00691063132f, -0.00695407297f, -0.00699724067f, -0.00704013285f,
+    -0.00708274799f, -0.00712508454f, -0.007167141f, -0.00720891586f,
+    -0.00725040763f, -0.00729161481f, -0.00733253595f, -0.00737316956f,
+    -0.00741351422f, -0.00745356847f, -0.00749333089f, -0.00753280006f,
+    -0.00757197457f, -0.00761085304f, -0.00764943409f, -0.00768771633f,
+    -0.00772569842f, -0.007763379f, -0.00780075674f, -0.00783783032f,
+    -0.00787459842f, -0.00791105975f, -0.00794721302f, -0.00798305694f,
+    -0.00801859026f, -0.00805381173f, -0.00808872011f, -0.00812331416f,
+    -0.00815759267f, -0.00819155444f, -0.00822519828f, -0.00825852301f,
+    -0.00829152746f, -0.00832421047f, -0.00835657092f, -0.00838860766f,
+    -0.00842031958f, -0.00845170558f, -0.00848276457f, -0.00851349546f,
+    -0.00854389719f, -0.0085739687f, -0.00860370897f, -0.00863311695f,
+    -0.00866219163f, -0.00869093201f, -0.0087193371f, -0.00874740593f,
+    -0.00877513752f, -0.00880253093f, -0.00882958523f, -0.00885629948f,
+    -0.00888267278f, -0.00890870422f, -0.00893439292f, -0.00895973801f,
+    -0.00898473863f, -0.00900939393f, -0.00903370308f, -0.00905766526f,
+    -0.00908127967f, -0.00910454551f, -0.009127462f, -0.00915002838f,
+    -0.00917224389f, -0.0091941078f, -0.00921561938f, -0.00923677791f,
+    -0.00925758269f, -0.00927803305f, -0.00929812831f, -0.00931786781f,
+    -0.00933725091f, -0.00935627698f, -0.00937494539f, -0.00939325554f,
+    -0.00941120685f, -0.00942879874f, -0.00944603065f, -0.00946290202f,
+    -0.00947941231f, -0.00949556102f, -0.00951134763f, -0.00952677165f,
+    -0.00954183259f, -0.00955652999f, -0.0095708634f, -0.00958483238f,
+    -0.0095984365f, -0.00961167536f, -0.00962454854f, -0.00963705568f,
+    -0.00964919641f, -0.00966097036f, -0.00967237719f, -0.00968341658f,
+    -0.00969408821f, -0.00970439179f, -0.00971432702f, -0.00972389364f,
+    -0.00973309139f, -0.00974192002f, -0.0097503793f, -0.00975846902f,
+    -0.00976618897f, -0.00977353897f, -0.00978051884f, -0.00978712842f,
+    -0.00979336757f, -0.00979923615f, -0.00980473405f, -0.00980986116f,
+    -0.00981461738f, -0.00981900266f, -0.00982301691f, -0.00982666009f,
+    -0.00982993218f, -0.00983283314f, -0.00983536298f, -0.00983752169f,
+    -0.00983930931f, -0.00984072587f, -0.00984177141f, -0.009842446f,
+    -0.00984274971f, -0.00984268265f, -0.00984224491f, -0.00984143661f,
+    -0.00984025789f, -0.0098387089f, -0.00983678978f, -0.00983450073f,
+    -0.00983184193f, -0.00982881357f, -0.00982541588f, -0.00982164909f,
+    -0.00981751344f, -0.00981300919f, -0.00980813661f, -0.00980289599f,
+    -0.00979728762f, -0.00979131183f, -0.00978496892f, -0.00977825926f,
+    -0.00977118319f, -0.00976374107f, -0.0097559333f, -0.00974776026f,
+    -0.00973922236f, -0.00973032004f, -0.00972105372f, -0.00971142385f,
+    -0.0097014309f, -0.00969107534f, -0.00968035766f, -0.00966927838f,
+    -0.009657838f, -0.00964603706f, -0.00963387609f, -0.00962135567f,
+    -0.00960847636f, -0.00959523874f, -0.00958164341f, -0.00956769099f,
+    -0.00955338209f, -0.00953871736f, -0.00952369744f, -0.00950832301f,
+    -0.00949259473f, -0.0094765133f, -0.00946007942f, -0.0094432938f,
+    -0.00942615719f, -0.00940867031f, -0.00939083393f, -0.00937264881f,
+    -0.00935411574f, -0.00933523551f, -0.00931600892f, -0.0092964368f,
+    -0.00927651998f, -0.00925625931f, -0.00923565563f, -0.00921470984f,
+    -0.0091934228f, -0.00917179541f, -0.00914982858f, -0.00912752324f,
+    -0.00910488032f, -0.00908190076f, -0.00905858553f, -0.00903493558f,
+    -0.00901095192f, -0.00898663552f, -0.00896198741f, -0.0089370086f,
+    -0.00891170012f, -0.00888606302f, -0.00886009835f, -0.00883380718f,
+    -0.00880719059f, -0.00878024968f, -0.00875298555f, -0.00872539932f,
+    -0.00869749211f, -0.00866926506f, -0.00864071933f, -0.00861185608f,
+    -0.00858267648f, -0.00855318172f, -0.008523373f, -0.00849325152f,
+    -0.00846281852f, -0.00843207521f, -0.00840102285f, -0.00836966269f,
+    -0.00833799599f, -0.00830602404f, -0.00827374812f, -0.00824116953f,
+    -0.00820828958f, -0.0081751096f, -0.00814163091f, -0.00810785486f,
+    -0.00807378281f, -0.00803941612f, -0.00800475616f, -0.00796980432f,
+    -0.007934562f, -0.00789903061f, -0.00786321156f, -0.00782710628f,
+    -0.00779071622f, -0.00775404282f, -0.00771708753f, -0.00767985184f,
+    -0.00764233722f, -0.00760454516f, -0.00756647716f, -0.00752813473f,
+    -0.00748951939f, -0.00745063267f, -0.00741147611f, -0.00737205125f,
+    -0.00733235967f, -0.00729240292f, -0.00725218259f, -0.00721170026f,
+    -0.00717095753f, -0.007129956f, -0.0070886973f, -0.00704718304f,
+    -0.00700541486f, -0.00696339441f, -0.00692112334f, -0.0068786033f,
+    -0.00683583596f, -0.00679282302f, -0.00674956615f, -0.00670606705f,
+    -0.00666232743f, -0.00661834899f, -0.00657413347f, -0.0065296826f,
+    -0.0064849981f, -0.00644008174f, -0.00639493526f, -0.00634956042f,
+    -0.00630395901f, -0.00625813281f, -0.00621208359f, -0.00616581315f,
+    -0.00611932331f, -0.00607261587f, -0.00602569264f, -0.00597855546f,
+    -0.00593120617f, -0.00588364659f, -0.00583587859f, -0.00578790402f,
+    -0.00573972473f, -0.00569134262f, -0.00564275954f, -0.00559397739f,
+    -0.00554499806f, -0.00549582345f, -0.00544645546f, -0.00539689601f,
+    -0.00534714702f, -0.0052972104f, -0.00524708811f, -0.00519678206f,
+    -0.00514629422f, -0.00509562652f, -0.00504478094f, -0.00499375943f,
+    -0.00494256396f, -0.0048911965f, -0.00483965905f, -0.00478795359f,
+    -0.00473608211f, -0.00468404662f, -0.00463184911f, -0.00457949159f,
+    -0.0045269761f, -0.00447430463f, -0.00442147923f, -0.00436850192f,
+    -0.00431537474f, -0.00426209974f, -0.00420867896f, -0.00415511444f,
+    -0.00410140826f, -0.00404756247f, -0.00399357914f, -0.00393946033f,
+    -0.00388520813f, -0.00383082462f, -0.00377631187f, -0.00372167198f,
+    -0.00366690704f, -0.00361201914f, -0.0035570104f, -0.00350188291f,
+    -0.00344663878f, -0.00339128013f, -0.00333580906f, -0.00328022771f,
+    -0.0032245382f, -0.00316874264f, -0.00311284318f, -0.00305684195f,
+    -0.00300074108f, -0.00294454272f, -0.002888249f, -0.00283186208f,
+    -0.0027753841f, -0.00271881722f, -0.00266216358f, -0.00260542536f,
+    -0.0025486047f, -0.00249170378f, -0.00243472475f, -0.00237766978f,
+    -0.00232054105f, -0.00226334072f, -0.00220607097f, -0.00214873398f,
+    -0.00209133191f, -0.00203386696f, -0.00197634131f, -0.00191875713f,
+    -0.00186111661f, -0.00180342195f, -0.00174567531f, -0.00168787891f,
+    -0.00163003492f, -0.00157214553f, -0.00151421295f, -0.00145623936f,
+    -0.00139822695f, -0.00134017793f, -0.00128209449f, -0.00122397883f,
+    -0.00116583314f, -0.00110765962f, -0.00104946048f, -0.000991237902f,
+    -0.000932994095f, -0.000874731255f, -0.000816451583f, -0.000758157278f,
+    -0.00069985054f, -0.000641533567f, -0.000583208559f, -0.000524877714f,
+    -0.000466543231f, -0.000408207308f, -0.000349872141f, -0.000291539929f,
+    -0.000233212866f, -0.000174893148f, -0.000116582969f, -5.82845219e-05f,
+    -2.79150297e-17f, 5.82684061e-05f, 0.000116518506f, 0.000174748112f,
+    0.000232955036f, 0.000291137093f, 0.000349292098f, 0.000407417869f,
+    0.000465512224f, 0.000523572985f, 0.000581597974f, 0.000639585016f,
+    0.000697531938f, 0.000755436568f, 0.000813296737f, 0.00087111028f,
+    0.00092887503f, 0.000986588827f, 0.00104424951f, 0.00110185493f,
+    0.00115940292f, 0.00121689133f, 0.00127431802f, 0.00133168084f,
+    0.00138897765f, 0.00144620631f, 0.00150336468f, 0.00156045063f,
+    0.00161746203f, 0.00167439675f, 0.00173125266f, 0.00178802766f,
+    0.00184471963f, 0.00190132644f, 0.001957846f, 0.0020142762f,
+    0.00207061494f, 0.00212686012f, 0.00218300965f, 0.00223906144f,
+    0.00229501342f, 0.00235086349f, 0.00240660958f, 0.00246224963f,
+    0.00251778156f, 0.00257320332f, 0.00262851284f, 0.00268370809f,
+    0.002738787f, 0.00279374754f, 0.00284858767f, 0.00290330536f,
+    0.00295789858f, 0.00301236531f, 0.00306670353f, 0.00312091124f,
+    0.00317498642f, 0.00322892708f, 0.00328273123f, 0.00333639687f,
+    0.00338992202f, 0.0034433047f, 0.00349654295f, 0.0035496348f,
+    0.00360257829f, 0.00365537146f, 0.00370801238f, 0.00376049909f,
+    0.00381282967f, 0.00386500219f, 0.00391701473f, 0.00396886537f,
+    0.0040205522f, 0.00407207333f, 0.00412342685f, 0.00417461089f,
+    0.00422562356f, 0.00427646298f, 0.00432712729f, 0.00437761464f,
+    0.00442792316f, 0.00447805101f, 0.00452799636f, 0.00457775737f,
+    0.00462733222f, 0.0046767191f, 0.00472591619f, 0.00477492171f,
+    0.00482373384f, 0.00487235082f, 0.00492077086f, 0.00496899219f,
+    0.00501701305f, 0.00506483169f, 0.00511244637f, 0.00515985535f,
+    0.00520705689f, 0.00525404928f, 0.00530083081f, 0.00534739977f,
+    0.00539375447f, 0.00543989322f, 0.00548581434f, 0.00553151617f,
+    0.00557699704f, 0.00562225531f, 0.00566728932f, 0.00571209744f,
+    0.00575667806f, 0.00580102955f, 0.00584515031f, 0.00588903873f,
+    0.00593269324f, 0.00597611224f, 0.00601929418f, 0.00606223748f,
+    0.00610494061f, 0.00614740201f, 0.00618962015f, 0.00623159352f,
+    0.00627332059f, 0.00631479987f, 0.00635602986f, 0.00639700908f,
+    0.00643773605f, 0.00647820931f, 0.00651842741f, 0.0065583889f,
+    0.00659809234f, 0.00663753631f, 0.00667671941f, 0.00671564022f,
+    0.00675429735f, 0.00679268942f, 0.00683081506f, 0.0068686729f,
+    0.0069062616f, 0.0069435798f, 0.00698062619f, 0.00701739943f,
+    0.00705389823f, 0.00709012128f, 0.00712606729f, 0.00716173499f,
+    0.00719712311f, 0.00723223039f, 0.0072670556f, 0.00730159749f,
+    0.00733585485f, 0.00736982645f, 0.00740351111f, 0.00743690764f,
+    0.00747001485f, 0.00750283157f, 0.00753535666f, 0.00756758896f,
+    0.00759952735f, 0.0076311707f, 0.00766251791f, 0.00769356786f,
+    0.00772431949f, 0.0077547717f, 0.00778492345f, 0.00781477366f,
+    0.00784432131f, 0.00787356537f, 0.00790250481f, 0.00793113863f,
+    0.00795946583f, 0.00798748545f, 0.00801519649f, 0.00804259801f,
+    0.00806968907f, 0.00809646871f, 0.00812293603f, 0.00814909011f,
+    0.00817493005f, 0.00820045497f, 0.008225664f, 0.00825055626f,
+    0.00827513091f, 0.00829938712f, 0.00832332405f, 0.0083469409f,
+    0.00837023686f, 0.00839321114f, 0.00841586298f, 0.00843819159f,
+    0.00846019624f, 0.00848187618f, 0.00850323068f, 0.00852425904f,
+    0.00854496054f, 0.00856533451f, 0.00858538026f, 0.00860509712f,
+    0.00862448446f, 0.00864354162f, 0.00866226798f, 0.00868066294f,
+    0.00869872587f, 0.00871645621f, 0.00873385336f, 0.00875091678f,
+    0.0087676459f, 0.0087840402f, 0.00880009914f, 0.00881582221f,
+    0.00883120891f, 0.00884625877f, 0.00886097129f, 0.00887534603f,
+    0.00888938253f, 0.00890308036f, 0.0089164391f, 0.00892945833f,
+    0.00894213767f, 0.00895447672f, 0.00896647512f, 0.0089781325f,
+    0.00898944853f, 0.00900042287f, 0.00901105521f, 0.00902134523f,
+    0.00903129264f, 0.00904089716f, 0.00905015854f, 0.0090590765f,
+    0.00906765081f, 0.00907588125f, 0.0090837676f, 0.00909130965f,
+    0.00909850722f, 0.00910536013f, 0.00911186822f, 0.00911803133f,
+    0.00912384934f, 0.00912932211f, 0.00913444954f, 0.00913923153f,
+    0.00914366799f, 0.00914775886f, 0.00915150407f, 0.00915490358f,
+    0.00915795735f, 0.00916066537f, 0.00916302762f, 0.00916504413f,
+    0.00916671489f, 0.00916803996f, 0.00916901937f, 0.00916965318f,
+    0.00916994146f, 0.0091698843f, 0.0091694818f, 0.00916873406f,
+    0.00916764121f, 0.00916620339f, 0.00916442074f, 0.00916229343f,
+    0.00915982163f, 0.00915700553f, 0.00915384533f, 0.00915034125f,
+    0.00914649351f, 0.00914230235f, 0.00913776803f, 0.00913289081f,
+    0.00912767096f, 0.00912210879f, 0.00911620459f, 0.00910995868f,
+    0.00910337139f, 0.00909644306f, 0.00908917405f, 0.00908156473f,
+    0.00907361547f, 0.00906532667f, 0.00905669873f, 0.00904773208f,
+    0.00903842714f, 0.00902878436f, 0.00901880419f, 0.00900848711f,
+    0.00899783359f, 0.00898684413f, 0.00897551923f, 0.00896385942f,
+    0.00895186523f, 0.0089395372f, 0.00892687588f, 0.00891388185f,
+    0.00890055569f, 0.00888689798f, 0.00887290934f, 0.00885859039f,
+    0.00884394175f, 0.00882896406f, 0.00881365799f, 0.0087980242f,
+    0.00878206336f, 0.00876577618f, 0.00874916335f, 0.00873222558f,
+    0.00871496362f, 0.00869737818f, 0.00867947004f, 0.00866123994f,
+    0.00864268868f, 0.00862381702f, 0.00860462578f, 0.00858511576f,
+    0.00856528779f, 0.00854514269f, 0.00852468133f, 0.00850390454f,
+    0.00848281322f, 0.00846140822f, 0.00843969046f, 0.00841766083f,
+    0.00839532024f, 0.00837266963f, 0.00834970993f, 0.0083264421f,
+    0.00830286709f, 0.00827898588f, 0.00825479945f, 0.0082303088f,
+    0.00820551493f, 0.00818041885f, 0.00815502161f, 0.00812932424f,
+    0.00810332778f, 0.0080770333f, 0.00805044188f, 0.00802355459f,
+    0.00799637254f, 0.00796889681f, 0.00794112854f, 0.00791306885f,
+    0.00788471887f, 0.00785607976f, 0.00782715266f, 0.00779793876f,
+    0.00776843922f, 0.00773865524f, 0.00770858803f, 0.00767823878f,
+    0.00764760872f, 0.00761669908f, 0.00758551111f, 0.00755404605f,
+    0.00752230516f, 0.00749028972f, 0.00745800101f, 0.00742544032f,
+    0.00739260895f, 0.00735950822f, 0.00732613943f, 0.00729250393f,
+    0.00725860305f, 0.00722443815f, 0.00719001058f, 0.00715532172f,
+    0.00712037293f, 0.00708516562f, 0.00704970117f, 0.00701398099f,
+    0.0069780065f, 0.00694177912f, 0.0069053003f, 0.00686857146f,
+    0.00683159407f, 0.00679436958f, 0.00675689946f, 0.0067191852f,
+    0.00668122828f, 0.0066430302f, 0.00660459246f, 0.00656591657f,
+    0.00652700407f, 0.00648785647f, 0.00644847532f, 0.00640886217f,
+    0.00636901857f, 0.00632894608f, 0.00628864629f, 0.00624812076f,
+    0.00620737109f, 0.00616639887f, 0.00612520572f, 0.00608379323f,
+    0.00604216303f, 0.00600031675f, 0.00595825603f, 0.0059159825f,
+    0.00587349782f, 0.00583080365f, 0.00578790165f, 0.00574479349f,
+    0.00570148086f, 0.00565796545f, 0.00561424894f, 0.00557033304f,
+    0.00552621946f, 0.00548190991f, 0.00543740612f, 0.00539270982f,
+    0.00534782274f, 0.00530274663f, 0.00525748324f, 0.00521203431f,
+    0.00516640163f, 0.00512058694f, 0.00507459204f, 0.0050284187f,
+    0.00498206871f, 0.00493554387f, 0.00488884597f, 0.00484197682f,
+    0.00479493824f, 0.00474773204f, 0.00470036004f, 0.00465282408f,
+    0.004605126f, 0.00455726762f, 0.00450925081f, 0.0044610774f,
+    0.00441274927f, 0.00436426826f, 0.00431563626f, 0.00426685513f,
+    0.00421792675f, 0.00416885301f, 0.00411963578f, 0.00407027698f,
+    0.00402077849f, 0.00397114221f, 0.00392137006f, 0.00387146394f,
+    0.00382142578f, 0.00377125749f, 0.003720961f, 0.00367053823f,
+    0.00361999113f, 0.00356932163f, 0.00351853167f, 0.0034676232f,
+    0.00341659817f, 0.00336545853f, 0.00331420624f, 0.00326284326f,
+    0.00321137155f, 0.00315979309f, 0.00310810985f, 0.00305632379f,
+    0.00300443691f, 0.00295245118f, 0.00290036859f, 0.00284819112f,
+    0.00279592077f, 0.00274355953f, 0.00269110939f, 0.00263857237f,
+    0.00258595045f, 0.00253324566f, 0.00248045998f, 0.00242759544f,
+    0.00237465404f, 0.00232163781f, 0.00226854876f, 0.0022153889f,
+    0.00216216026f, 0.00210886487f, 0.00205550475f, 0.00200208192f,
+    0.00194859842f, 0.00189505628f, 0.00184145752f, 0.00178780419f,
+    0.00173409832f, 0.00168034195f, 0.00162653711f, 0.00157268584f,
+    0.00151879019f, 0.0014648522f, 0.00141087391f, 0.00135685737f,
+    0.00130280461f, 0.0012487177f, 0.00119459866f, 0.00114044955f,
+    0.00108627242f, 0.00103206931f, 0.000977842278f, 0.000923593366f,
+    0.000869324627f, 0.000815038107f, 0.000760735858f, 0.000706419929f,
+    0.000652092368f, 0.000597755226f, 0.000543410551f, 0.000489060392f,
+    0.000434706798f, 0.000380351816f, 0.000325997494f, 0.00027164588f,
+    0.000217299018f, 0.000162958955f, 0.000108627735f, 5.43074027e-05f,
+    -4.3459925e-18f, -5.4292431e-05f, -0.00010856785f, -0.000162824217f,
+    -0.000217059494f, -0.000271271645f, -0.000325458633f, -0.000379618426f,
+    -0.000433748991f, -0.000487848297f, -0.000541914316f, -0.00059594502f,
+    -0.000649938384f, -0.000703892386f, -0.000757805003f, -0.000811674217f,
+    -0.000865498011f, -0.000919274371f, -0.000973001284f, -0.00102667674f,
+    -0.00108029873f, -0.00113386526f, -0.00118737431f, -0.00124082389f,
+    -0.00129421201f, -0.00134753666f, -0.00140079586f, -0.00145398763f,
+    -0.00150710997f, -0.0015601609f, -0.00161313845f, -0.00166604065f,
+    -0.00171886551f, -0.00177161107f, -0.00182427537f, -0.00187685645f,
+    -0.00192935234f, -0.0019817611f, -0.00203408077f, -0.00208630941f,
+    -0.00213844508f, -0.00219048584f, -0.00224242975f, -0.00229427489f,
+    -0.00234601933f, -0.00239766115f, -0.00244919843f, -0.00250062927f,
+    -0.00255195174f, -0.00260316396f, -0.00265426401f, -0.00270525002f,
+    -0.00275612008f, -0.00280687232f, -0.00285750485f, -0.00290801581f,
+    -0.00295840332f, -0.00300866552f, -0.00305880055f, -0.00310880656f,
+    -0.0031586817f, -0.00320842413f, -0.00325803201f, -0.00330750351f,
+    -0.0033568368f, -0.00340603007f, -0.0034550815f, -0.00350398928f,
+    -0.00355275161f, -0.00360136669f, -0.00364983274f, -0.00369814796f,
+    -0.00374631059f, -0.00379431884f, -0.00384217096f, -0.00388986518f,
+    -0.00393739975f, -0.00398477293f, -0.00403198297f, -0.00407902815f,
+    -0.00412590673f, -0.004172617f, -0.00421915724f, -0.00426552575f,
+    -0.00431172082f, -0.00435774078f, -0.00440358392f, -0.00444924858f,
+    -0.00449473308f, -0.00454003576f, -0.00458515497f, -0.00463008905f,
+    -0.00467483636f, -0.00471939527f, -0.00476376416f, -0.0048079414f,
+    -0.00485192539f, -0.00489571451f, -0.00493930718f, -0.00498270181f,
+    -0.00502589681f, -0.00506889063f, -0.00511168168f, -0.00515426842f,
+    -0.0051966493f, -0.00523882277f, -0.00528078732f, -0.00532254141f,
+    -0.00536408353f, -0.00540541218f, -0.00544652585f, -0.00548742306f,
+    -0.00552810233f, -0.00556856218f, -0.00560880115f, -0.0056488178f,
+    -0.00568861066f, -0.0057281783f, -0.00576751931f, -0.00580663224f,
+    -0.00584551571f, -0.0058841683f, -0.00592258862f, -0.0059607753f,
+    -0.00599872695f, -0.00603644221f, -0.00607391973f, -0.00611115816f,
+    -0.00614815616f, -0.00618491241f, -0.00622142559f, -0.00625769439f,
+    -0.00629371751f, -0.00632949366f, -0.00636502157f, -0.00640029997f,
+    -0.00643532758f, -0.00647010318f, -0.0065046255f, -0.00653889333f,
+    -0.00657290544f, -0.00660666063f, -0.00664015768f, -0.00667339542f,
+    -0.00670637266f, -0.00673908823f, -0.00677154097f, -0.00680372973f,
+    -0.00683565337f, -0.00686731077f, -0.0068987008f, -0.00692982235f,
+    -0.00696067433f, -0.00699125565f, -0.00702156523f, -0.00705160201f,
+    -0.00708136492f, -0.00711085293f, -0.007140065f, -0.0071690001f,
+    -0.00719765722f, -0.00722603536f, -0.00725413353f, -0.00728195075f,
+    -0.00730948603f, -0.00733673844f, -0.00736370701f, -0.00739039081f,
+    -0.00741678891f, -0.00744290041f, -0.00746872438f, -0.00749425995f,
+    -0.00751950622f, -0.00754446233f, -0.00756912742f, -0.00759350063f,
+    -0.00761758113f, -0.0076413681f, -0.00766486072f, -0.00768805818f,
+    -0.0077109597f, -0.00773356449f, -0.00775587178f, -0.00777788081f,
+    -0.00779959084f, -0.00782100114f, -0.00784211097f, -0.00786291963f,
+    -0.00788342641f, -0.00790363063f, -0.00792353161f, -0.00794312868f,
+    -0.00796242119f, -0.0079814085f, -0.00800008997f, -0.00801846498f,
+    -0.00803653294f, -0.00805429323f, -0.00807174528f, -0.00808888852f,
+    -0.00810572239f, -0.00812224633f, -0.0081384598f, -0.0081543623f,
+    -0.00816995329f, -0.00818523228f, -0.00820019878f, -0.00821485232f,
+    -0.00822919242f, -0.00824321863f, -0.00825693051f, -0.00827032764f,
+    -0.00828340959f, -0.00829617595f, -0.00830862635f, -0.00832076038f,
+    -0.00833257768f, -0.0083440779f, -0.00835526069f, -0.00836612571f,
+    -0.00837667264f, -0.00838690118f, -0.00839681102f, -0.00840640188f,
+    -0.0084156735f, -0.00842462559f, -0.00843325793f, -0.00844157026f,
+    -0.00844956237f, -0.00845723404f, -0.00846458507f, -0.00847161527f,
+    -0.00847832447f, -0.00848471251f, -0.00849077922f, -0.00849652447f,
+    -0.00850194814f, -0.0085070501f, -0.00851183025f, -0.00851628851f,
+    -0.00852042479f, -0.00852423902f, -0.00852773116f, -0.00853090115f,
+    -0.00853374897f, -0.0085362746f, -0.00853847803f, -0.00854035927f,
+    -0.00854191833f, -0.00854315525f, -0.00854407007f, -0.00854466284f,
+    -0.00854493363f, -0.00854488252f, -0.00854450959f, -0.00854381496f,
+    -0.00854279873f, -0.00854146103f, -0.008539802f, -0.0085378218f,
+    -0.00853552058f, -0.00853289852f, -0.00852995581f, -0.00852669264f,
+    -0.00852310924f, -0.00851920581f, -0.0085149826f, -0.00851043985f,
+    -0.00850557783f, -0.0085003968f, -0.00849489704f, -0.00848907886f,
+    -0.00848294256f, -0.00847648845f, -0.00846971687f, -0.00846262816f,
+    -0.00845522267f, -0.00844750078f, -0.00843946285f, -0.00843110929f,
+    -0.00842244048f, -0.00841345684f, -0.00840415881f, -0.00839454681f,
+    -0.00838462129f, -0.00837438272f, -0.00836383156f, -0.0083529683f,
+    -0.00834179344f, -0.00833030747f, -0.00831851093f, -0.00830640434f,
+    -0.00829398823f, -0.00828126317f, -0.00826822972f, -0.00825488845f,
+    -0.00824123996f, -0.00822728483f, -0.00821302368f, -0.00819845713f,
+    -0.00818358582f, -0.00816841038f, -0.00815293148f, -0.00813714978f,
+    -0.00812106595f, -0.0081046807f, -0.0080879947f, -0.00807100869f,
+    -0.00805372338f, -0.0080361395f, -0.0080182578f, -0.00800007903f,
+    -0.00798160396f, -0.00796283337f, -0.00794376805f, -0.00792440879f,
+    -0.00790475641f, -0.00788481173f, -0.00786457557f, -0.00784404878f,
+    -0.00782323222f, -0.00780212674f, -0.00778073323f, -0.00775905256f,
+    -0.00773708564f, -0.00771483336f, -0.00769229665f, -0.00766947644f,
+    -0.00764637365f, -0.00762298924f, -0.00759932417f, -0.00757537941f,
+    -0.00755115593f, -0.00752665472f, -0.00750187678f, -0.00747682313f,
+    -0.00745149478f, -0.00742589275f, -0.0074000181f, -0.00737387187f,
+    -0.00734745512f, -0.00732076892f, -0.00729381435f, -0.00726659249f,
+    -0.00723910446f, -0.00721135134f, -0.00718333427f, -0.00715505437f,
+    -0.00712651279f, -0.00709771065f, -0.00706864913f, -0.00703932939f,
+    -0.0070097526f, -0.00697991995f, -0.00694983264f, -0.00691949186f,
+    -0.00688889882f, -0.00685805476f, -0.0068269609f, -0.00679561848f,
+    -0.00676402875f, -0.00673219297f, -0.0067001124f, -0.00666778833f,
+    -0.00663522203f, -0.00660241479f, -0.00656936793f, -0.00653608275f,
+    -0.00650256056f, -0.00646880271f, -0.00643481052f, -0.00640058533f,
+    -0.00636612852f, -0.00633144142f, -0.00629652542f, -0.00626138189f,
+    -0.00622601221f, -0.00619041779f, -0.00615460003f, -0.00611856033f,
+    -0.00608230011f, -0.00604582081f, -0.00600912385f, -0.00597221067f,
+    -0.00593508273f, -0.00589774149f, -0.00586018841f, -0.00582242495f,
+    -0.00578445261f, -0.00574627287f, -0.00570788723f, -0.00566929718f,
+    -0.00563050424f, -0.00559150992f, -0.00555231575f, -0.00551292326f,
+    -0.00547333399f, -0.00543354948f, -0.00539357129f, -0.00535340097f,
+    -0.00531304009f, -0.00527249022f, -0.00523175294f, -0.00519082985f,
+    -0.00514972252f, -0.00510843256f, -0.00506696158f, -0.00502531118f,
+    -0.00498348299f, -0.00494147863f, -0.00489929972f, -0.00485694792f,
+    -0.00481442485f, -0.00477173217f, -0.00472887153f, -0.00468584459f,
+    -0.00464265303f, -0.0045992985f, -0.00455578269f, -0.00451210729f,
+    -0.00446827398f, -0.00442428445f, -0.00438014041f, -0.00433584356f,
+    -0.00429139561f, -0.00424679828f, -0.00420205328f, -0.00415716235f,
+    -0.00411212721f, -0.00406694961f, -0.00402163127f, -0.00397617395f,
+    -0.0039305794f, -0.00388484937f, -0.00383898563f, -0.00379298992f,
+    -0.00374686404f, -0.00370060974f, -0.0036542288f, -0.00360772302f,
+    -0.00356109416f, -0.00351434403f, -0.00346747442f, -0.00342048712f,
+    -0.00337338394f, -0.00332616669f, -0.00327883716f, -0.00323139719f,
+    -0.00318384857f, -0.00313619315f, -0.00308843273f, -0.00304056915f,
+    -0.00299260423f, -0.00294453982f, -0.00289637775f, -0.00284811986f,
+    -0.00279976799f, -0.002751324f, -0.00270278972f, -0.00265416703f,
+    -0.00260545776f, -0.00255666378f, -0.00250778695f, -0.00245882913f,
+    -0.0024097922f, -0.00236067801f, -0.00231148844f, -0.00226222536f,
+    -0.00221289065f, -0.00216348619f, -0.00211401386f, -0.00206447553f,
+    -0.00201487309f, -0.00196520844f, -0.00191548345f, -0.00186570001f,
+    -0.00181586002f, -0.00176596537f, -0.00171601795f, -0.00166601966f,
+    -0.0016159724f, -0.00156587806f, -0.00151573855f, -0.00146555576f,
+    -0.0014153316f, -0.00136506797f, -0.00131476677f, -0.00126442991f,
+    -0.0012140593f, -0.00116365683f, -0.00111322443f, -0.00106276399f,
+    -0.00101227742f, -0.000961766642f, -0.000911233551f, -0.000860680062f,
+    -0.000810108084f, -0.000759519526f, -0.000708916299f, -0.000658300313f,
+    -0.000607673477f, -0.000557037701f, -0.000506394895f, -0.000455746968f,
+    -0.000405095829f, -0.000354443386f, -0.000303791549f, -0.000253142224f,
+    -0.000202497318f, -0.000151858737f, -0.000101228388f, -5.06081743e-05f,
+    3.23384188e-17f, 5.05942321e-05f, 0.00010117262f, 0.000151733264f,
+    0.000202274264f, 0.000252793722f, 0.000303289741f, 0.000353760426f,
+    0.000404203882f, 0.000454618218f, 0.000505001543f, 0.000555351967f,
+    0.000605667604f, 0.000655946568f, 0.000706186974f, 0.000756386943f,
+    0.000806544593f, 0.000856658048f, 0.000906725433f, 0.000956744873f,
+    0.0010067145f, 0.00105663244f, 0.00110649684f, 0.00115630582f,
+    0.00120605753f, 0.00125575011f, 0.0013053817f, 0.00135495046f,
+    0.00140445453f, 0.00145389206f, 0.00150326121f, 0.00155256015f,
+    0.00160178703f, 0.00165094001f, 0.00170001728f, 0.001749017f,
+    0.00179793734f, 0.00184677649f, 0.00189553263f, 0.00194420394f,
+    0.00199278862f, 0.00204128486f, 0.00208969086f, 0.00213800481f,
+    0.00218622493f, 0.00223434943f, 0.00228237651f, 0.0023303044f,
+    0.00237813132f, 0.00242585549f, 0.00247347515f, 0.00252098853f,
+    0.00256839387f, 0.00261568942f, 0.00266287342f, 0.00270994413f,
+    0.0027568998f, 0.0028037387f, 0.0028504591f, 0.00289705927f,
+    0.00294353749f, 0.00298989204f, 0.00303612121f, 0.00308222329f,
+    0.00312819659f, 0.0031740394f, 0.00321975003f, 0.0032653268f,
+    0.00331076803f, 0.00335607205f, 0.00340123719f, 0.00344626178f,
+    0.00349114416f, 0.0035358827f, 0.00358047573f, 0.00362492162f,
+    0.00366921875f, 0.00371336547f, 0.00375736017f, 0.00380120123f,
+    0.00384488705f, 0.00388841602f, 0.00393178655f, 0.00397499705f,
+    0.00401804592f, 0.0040609316f, 0.00410365252f, 0.00414620711f,
+    0.00418859382f, 0.00423081109f, 0.00427285738f, 0.00431473116f,
+    0.00435643089f, 0.00439795505f, 0.00443930213f, 0.00448047062f,
+    0.00452145902f, 0.00456226583f, 0.00460288957f, 0.00464332875f,
+    0.00468358191f, 0.00472364758f, 0.0047635243f, 0.00480321062f,
+    0.0048427051f, 0.0048820063f, 0.00492111281f, 0.00496002319f,
+    0.00499873604f, 0.00503724996f, 0.00507556354f, 0.00511367541f,
+    0.00515158417f, 0.00518928846f, 0.00522678692f, 0.00526407819f,
+    0.00530116091f, 0.00533803377f, 0.00537469541f, 0.00541114452f,
+    0.00544737978f, 0.0054833999f, 0.00551920356f, 0.00555478949f,
+    0.0055901564f, 0.00562530302f, 0.00566022809f, 0.00569493035f,
+    0.00572940856f, 0.00576366148f, 0.00579768788f, 0.00583148655f,
+    0.00586505627f, 0.00589839584f, 0.00593150407f, 0.00596437977f,
+    0.00599702178f, 0.00602942893f, 0.00606160005f, 0.00609353401f,
+    0.00612522967f, 0.0061566859f, 0.00618790158f, 0.00621887559f,
+    0.00624960685f, 0.00628009426f, 0.00631033674f, 0.00634033321f,
+    0.00637008262f, 0.00639958392f, 0.00642883605f, 0.00645783799f,
+    0.00648658872f, 0.00651508721f, 0.00654333247f, 0.0065713235f,
+    0.00659905933f, 0.00662653896f, 0.00665376144f, 0.00668072582f,
+    0.00670743115f, 0.0067338765f, 0.00676006093f, 0.00678598355f,
+    0.00681164343f, 0.0068370397f, 0.00686217146f, 0.00688703784f,
+    0.00691163798f, 0.00693597102f, 0.00696003613f, 0.00698383246f,
+    0.0070073592f, 0.00703061554f, 0.00705360067f, 0.0070763138f,
+    0.00709875416f, 0.00712092097f, 0.00714281347f, 0.00716443091f,
+    0.00718577256f, 0.00720683768f, 0.00722762557f, 0.00724813551f,
+    0.00726836681f, 0.00728831878f, 0.00730799075f, 0.00732738205f,
+    0.00734649203f, 0.00736532005f, 0.00738386548f, 0.0074021277f,
+    0.00742010609f, 0.00743780007f, 0.00745520903f, 0.0074723324f,
+    0.00748916962f, 0.00750572014f, 0.0075219834f, 0.00753795887f,
+    0.00755364603f, 0.00756904438f, 0.0075841534f, 0.00759897262f,
+    0.00761350154f, 0.00762773971f, 0.00764168667f, 0.00765534197f,
+    0.00766870518f, 0.00768177588f, 0.00769455365f, 0.0077070381f,
+    0.00771922883f, 0.00773112547f, 0.00774272765f, 0.00775403501f,
+    0.00776504721f, 0.00777576392f, 0.00778618481f, 0.00779630957f,
+    0.00780613791f, 0.00781566953f, 0.00782490415f, 0.00783384152f,
+    0.00784248137f, 0.00785082347f, 0.00785886758f, 0.00786661348f,
+    0.00787406096f, 0.00788120982f, 0.00788805987f, 0.00789461095f,
+    0.00790086288f, 0.00790681551f, 0.0079124687f, 0.00791782232f,
+    0.00792287626f, 0.00792763039f, 0.00793208464f, 0.0079362389f,
+    0.00794009311f, 0.00794364721f, 0.00794690114f, 0.00794985487f,
+    0.00795250836f, 0.0079548616f, 0.00795691458f, 0.00795866731f,
+    0.00796011981f, 0.0079612721f, 0.00796212422f, 0.00796267622f,
+    0.00796292817f, 0.00796288014f, 0.0079625322f, 0.00796188447f,
+    0.00796093704f, 0.00795969004f, 0.00795814358f, 0.00795629783f,
+    0.00795415291f, 0.00795170901f, 0.00794896629f, 0.00794592494f,
+    0.00794258515f, 0.00793894714f, 0.00793501112f, 0.00793077733f,
+    0.007926246f, 0.00792141738f, 0.00791629175f, 0.00791086938f,
+    0.00790515055f, 0.00789913556f, 0.00789282471f, 0.00788621833f,
+    0.00787931675f, 0.00787212031f, 0.00786462936f, 0.00785684426f,
+    0.00784876539f, 0.00784039314f, 0.00783172789f, 0.00782277007f,
+    0.00781352007f, 0.00780397834f, 0.00779414532f, 0.00778402145f,
+    0.00777360719f, 0.00776290302f, 0.00775190943f, 0.0077406269f,
+    0.00772905594f, 0.00771719706f, 0.0077050508f, 0.00769261768f,
+    0.00767989825f, 0.00766689308f, 0.00765360274f, 0.00764002779f,
+    0.00762616883f, 0.00761202647f, 0.0075976013f, 0.00758289396f,
+    0.00756790507f, 0.00755263528f, 0.00753708524f, 0.00752125561f,
+    0.00750514707f, 0.00748876029f, 0.00747209598f, 0.00745515483f,
+    0.00743793757f, 0.00742044491f, 0.0074026776f, 0.00738463636f,
+    0.00736632197f, 0.00734773519f, 0.00732887678f, 0.00730974755f,
+    0.00729034827f, 0.00727067976f, 0.00725074283f, 0.00723053831f,
+    0.00721006703f, 0.00718932983f, 0.00716832758f, 0.00714706112f,
+    0.00712553135f, 0.00710373914f, 0.00708168538f, 0.00705937098f,
+    0.00703679685f, 0.00701396391f, 0.00699087309f, 0.00696752534f,
+    0.0069439216f, 0.00692006283f, 0.00689595001f, 0.0068715841f,
+    0.00684696611f, 0.00682209701f, 0.00679697783f, 0.00677160958f,
+    0.00674599327f, 0.00672012995f, 0.00669402066f, 0.00666766643f,
+    0.00664106835f, 0.00661422747f, 0.00658714488f, 0.00655982165f,
+    0.00653225889f, 0.00650445771f, 0.0064764192f, 0.0064481445f,
+    0.00641963473f, 0.00639089103f, 0.00636191456f, 0.00633270646f,
+    0.0063032679f, 0.00627360005f, 0.00624370409f, 0.00621358122f,
+    0.00618323262f, 0.00615265951f, 0.00612186309f, 0.0060908446f,
+    0.00605960525f, 0.00602814628f, 0.00599646895f, 0.00596457451f,
+    0.0059324642f, 0.00590013932f, 0.00586760112f, 0.0058348509f,
+    0.00580188995f, 0.00576871956f, 0.00573534105f, 0.00570175573f,
+    0.00566796492f, 0.00563396995f, 0.00559977215f, 0.00556537288f,
+    0.00553077348f, 0.00549597531f, 0.00546097973f, 0.00542578812f,
+    0.00539040186f, 0.00535482234f, 0.00531905094f, 0.00528308907f,
+    0.00524693814f, 0.00521059956f, 0.00517407474f, 0.00513736512f,
+    0.00510047213f, 0.00506339721f, 0.00502614181f, 0.00498870737f,
+    0.00495109537f, 0.00491330726f, 0.00487534451f, 0.00483720861f,
+    0.00479890104f, 0.00476042329f, 0.00472177685f, 0.00468296323f,
+    0.00464398394f, 0.00460484048f, 0.00456553438f, 0.00452606716f,
+    0.00448644036f, 0.00444665552f, 0.00440671416f, 0.00436661784f,
+    0.00432636812f, 0.00428596655f, 0.0042454147f, 0.00420471413f,
+    0.00416386642f, 0.00412287314f, 0.00408173589f, 0.00404045625f,
+    0.00399903582f, 0.00395747618f, 0.00391577896f, 0.00387394575f,
+    0.00383197817f, 0.00378987784f, 0.00374764637f, 0.00370528541f,
+    0.00366279657f, 0.00362018149f, 0.00357744181f, 0.00353457918f,
+    0.00349159525f, 0.00344849167f, 0.00340527009f, 0.00336193217f,
+    0.00331847958f, 0.00327491399f, 0.00323123707f, 0.0031874505f,
+    0.00314355594f, 0.0030995551f, 0.00305544965f, 0.00301124129f,
+    0.0029669317f, 0.00292252259f, 0.00287801565f, 0.00283341259f,
+    0.00278871512f, 0.00274392494f, 0.00269904376f, 0.00265407331f,
+    0.0026090153f, 0.00256387145f, 0.00251864349f, 0.00247333314f,
+    0.00242794213f, 0.0023824722f, 0.00233692507f, 0.00229130249f,
+    0.00224560619f, 0.00219983792f, 0.00215399942f, 0.00210809244f,
+    0.00206211871f, 0.00201608001f, 0.00196997806f, 0.00192381464f,
+    0.00187759149f, 0.00183131037f, 0.00178497305f, 0.00173858128f,
+    0.00169213682f, 0.00164564144f, 0.0015990969f, 0.00155250498f,
+    0.00150586743f, 0.00145918603f, 0.00141246255f, 0.00136569876f,
+    0.00131889644f, 0.00127205734f, 0.00122518326f, 0.00117827596f,
+    0.00113133722f, 0.00108436882f, 0.00103737254f, 0.000990350147f,
+    0.000943303426f, 0.000896234154f, 0.000849144111f, 0.000802035076f,
+    0.000754908829f, 0.000707767149f, 0.000660611817f, 0.000613444612f,
+    0.000566267314f, 0.000519081703f, 0.000471889559f, 0.00042469266f,
+    0.000377492785f, 0.000330291714f, 0.000283091224f, 0.000235893093f,
+    0.000188699099f, 0.000141511017f, 9.43306234e-05f, 4.7159693e-05f,
+    5.27121992e-17f, -4.71466825e-05f, -9.42785823e-05f, -0.000141393928f,
+    -0.00018849095f, -0.00023556788f, -0.000282622948f, -0.000329654391f,
+    -0.000376660441f, -0.000423639336f, -0.000470589315f, -0.000517508615f,
+    -0.00056439548f, -0.000611248151f, -0.000658064873f, -0.000704843894f,
+    -0.000751583461f, -0.000798281824f, -0.000844937237f, -0.000891547954f,
+    -0.000938112231f, -0.000984628328f, -0.00103109451f, -0.00107750903f,
+    -0.00112387016f, -0.00117017617f, -0.00121642533f, -0.00126261592f,
+    -0.0013087462f, -0.00135481447f, -0.00140081899f, -0.00144675806f,
+    -0.00149262997f, -0.001538433f, -0.00158416545f, -0.00162982561f,
+    -0.00167541179f, -0.00172092228f, -0.00176635541f, -0.00181170946f,
+    -0.00185698277f, -0.00190217364f, -0.0019472804f, -0.00199230138f,
+    -0.00203723489f, -0.00208207927f, -0.00212683285f, -0.00217149398f,
+    -0.00221606101f, -0.00226053226f, -0.00230490611f, -0.0023491809f,
+    -0.00239335499f, -0.00243742674f, -0.00248139454f, -0.00252525674f,
+    -0.00256901172f, -0.00261265787f, -0.00265619358f, -0.00269961722f,
+    -0.00274292721f, -0.00278612193f, -0.0028291998f, -0.00287215922f,
+    -0.0029149986f, -0.00295771638f, -0.00300031096f, -0.00304278079f,
+    -0.0030851243f, -0.00312733991f, -0.0031694261f, -0.00321138129f,
+    -0.00325320395f, -0.00329489254f, -0.00333644552f, -0.00337786138f,
+    -0.00341913858f, -0.00346027561f, -0.00350127095f, -0.00354212311f,
+    -0.00358283059f, -0.00362339189f, -0.00366380552f, -0.00370407f,
+    -0.00374418386f, -0.00378414563f, -0.00382395384f, -0.00386360704f,
+    -0.00390310378f, -0.00394244261f, -0.00398162209f, -0.0040206408f,
+    -0.0040594973f, -0.00409819018f, -0.00413671802f, -0.00417507943f,
+    -0.004213273f, -0.00425129733f, -0.00428915105f, -0.00432683278f,
+    -0.00436434114f, -0.00440167476f, -0.0044388323f, -0.0044758124f,
+    -0.00451261371f, -0.0045492349f, -0.00458567464f, -0.0046219316f,
+    -0.00465800448f, -0.00469389196f, -0.00472959274f, -0.00476510553f,
+    -0.00480042904f, -0.00483556201f, -0.00487050314f, -0.00490525119f,
+    -0.00493980489f, -0.00497416301f, -0.00500832429f, -0.0050422875f,
+    -0.00507605143f, -0.00510961486f, -0.00514297657f, -0.00517613536f,
+    -0.00520909004f, -0.00524183944f, -0.00527438236f, -0.00530671764f,
+    -0.00533884413f, -0.00537076066f, -0.0054024661f, -0.00543395931f,
+    -0.00546523915f, -0.00549630452f, -0.0055271543f, -0.00555778738f,
+    -0.00558820268f, -0.00561839911f, -0.00564837559f, -0.00567813106f,
+    -0.00570766444f, -0.0057369747f, -0.00576606079f, -0.00579492168f,
+    -0.00582355633f, -0.00585196374f, -0.0058801429f, -0.00590809281f,
+    -0.00593581248f, -0.00596330093f, -0.00599055719f, -0.00601758029f,
+    -0.00604436929f, -0.00607092323f, -0.00609724119f, -0.00612332223f,
+    -0.00614916544f, -0.00617476991f, -0.00620013475f, -0.00622525906f,
+    -0.00625014196f, -0.00627478259f, -0.00629918008f, -0.00632333358f,
+    -0.00634724224f, -0.00637090524f, -0.00639432176f, -0.00641749097f,
+    -0.00644041207f, -0.00646308428f, -0.00648550679f, -0.00650767885f,
+    -0.00652959967f, -0.00655126851f, -0.00657268462f, -0.00659384726f,
+    -0.00661475571f, -0.00663540924f, -0.00665580715f, -0.00667594874f,
+    -0.00669583333f, -0.00671546024f, -0.00673482879f, -0.00675393833f,
+    -0.00677278821f, -0.0067913778f, -0.00680970646f, -0.00682777358f,
+    -0.00684557855f, -0.00686312076f, -0.00688039964f, -0.00689741461f,
+    -0.00691416508f, -0.00693065052f, -0.00694687037f, -0.00696282408f,
+    -0.00697851115f, -0.00699393104f, -0.00700908325f, -0.00702396729f,
+    -0.00703858266f, -0.0070529289f, -0.00706700553f, -0.0070808121f,
+    -0.00709434816f, -0.00710761328f, -0.00712060704f, -0.00713332901f,
+    -0.00714577881f, -0.00715795602f, -0.00716986027f, -0.00718149119f,
+    -0.0071928484f, -0.00720393157f, -0.00721474035f, -0.00722527441f,
+    -0.00723553342f, -0.00724551707f, -0.00725522508f, -0.00726465714f,
+    -0.00727381297f, -0.00728269232f, -0.00729129492f, -0.00729962051f,
+    -0.00730766888f, -0.00731543978f, -0.00732293301f, -0.00733014836f,
+    -0.00733708563f, -0.00734374463f, -0.00735012521f, -0.00735622718f,
+    -0.0073620504f, -0.00736759472f, -0.00737286002f, -0.00737784618f,
+    -0.00738255307f, -0.00738698061f, -0.00739112869f, -0.00739499726f,
+    -0.00739858622f, -0.00740189553f, -0.00740492515f, -0.00740767502f,
+    -0.00741014513f, -0.00741233546f, -0.00741424601f, -0.00741587677f,
+    -0.00741722777f, -0.00741829904f, -0.0074190906f, -0.00741960252f,
+    -0.00741983483f, -0.00741978762f, -0.00741946096f, -0.00741885495f,
+    -0.00741796968f, -0.00741680526f, -0.00741536181f, -0.00741363947f,
+    -0.00741163837f, -0.00740935867f, -0.00740680054f, -0.00740396414f,
+    -0.00740084966f, -0.00739745729f, -0.00739378724f, -0.00738983973f,
+    -0.00738561497f, -0.0073811132f, -0.00737633468f, -0.00737127965f,
+    -0.00736594838f, -0.00736034116f, -0.00735445826f, -0.00734829999f,
+    -0.00734186665f, -0.00733515856f, -0.00732817605f, -0.00732091946f,
+    -0.00731338914f, -0.00730558545f, -0.00729750876f, -0.00728915944f,
+    -0.00728053788f, -0.0072716445f, -0.00726247969f, -0.00725304387f,
+    -0.00724333749f, -0.00723336097f, -0.00722311477f, -0.00721259934f,
+    -0.00720181517f, -0.00719076272f, -0.0071794425f, -0.00716785499f,
+    -0.00715600072f, -0.00714388019f, -0.00713149395f, -0.00711884252f,
+    -0.00710592647f, -0.00709274634f, -0.00707930272f, -0.00706559617f,
+    -0.00705162729f, -0.00703739668f, -0.00702290494f, -0.00700815269f,
+    -0.00699314057f, -0.0069778692f, -0.00696233923f, -0.00694655133f,
+    -0.00693050615f, -0.00691420438f, -0.00689764669f, -0.00688083378f,
+    -0.00686376636f, -0.00684644514f, -0.00682887083f, -0.00681104418f,
+    -0.00679296593f, -0.00677463682f, -0.00675605761f, -0.00673722908f,
+    -0.006718152f, -0.00669882715f, -0.00667925534f, -0.00665943737f,
+    -0.00663937406f, -0.00661906622f, -0.0065985147f, -0.00657772033f,
+    -0.00655668396f, -0.00653540645f, -0.00651388867f, -0.0064921315f,
+    -0.00647013582f, -0.00644790253f, -0.00642543253f, -0.00640272673f,
+    -0.00637978606f, -0.00635661143f, -0.0063332038f, -0.0063095641f,
+    -0.00628569328f, -0.00626159233f, -0.00623726219f, -0.00621270386f,
+    -0.00618791832f, -0.00616290657f, -0.00613766961f, -0.00611220846f,
+    -0.00608652413f, -0.00606061766f, -0.00603449009f, -0.00600814245f,
+    -0.0059815758f, -0.00595479121f, -0.00592778974f, -0.00590057246f,
+    -0.00587314048f, -0.00584549486f, -0.00581763673f, -0.00578956718f,
+    -0.00576128733f, -0.0057327983f, -0.00570410123f, -0.00567519725f,
+    -0.00564608751f, -0.00561677316f, -0.00558725537f, -0.0055575353f,
+    -0.00552761412f, -0.00549749302f, -0.0054671732f, -0.00543665583f,
+    -0.00540594214f, -0.00537503333f, -0.00534393062f, -0.00531263524f,
+    -0.00528114841f, -0.00524947138f, -0.00521760538f, -0.00518555169f,
+    -0.00515331154f, -0.00512088621f, -0.00508827698f, -0.00505548512f,
+    -0.00502251191f, -0.00498935865f, -0.00495602664f, -0.00492251718f,
+    -0.00488883158f, -0.00485497117f, -0.00482093726f, -0.00478673118f,
+    -0.00475235428f, -0.00471780788f, -0.00468309335f, -0.00464821203f,
+    -0.00461316529f, -0.00457795449f, -0.004542581f, -0.0045070462f,
+    -0.00447135147f, -0.0044354982f, -0.00439948779f, -0.00436332163f,
+    -0.00432700114f, -0.00429052772f, -0.00425390278f, -0.00421712775f,
+    -0.00418020406f, -0.00414313314f, -0.00410591642f, -0.00406855535f,
+    -0.00403105138f, -0.00399340595f, -0.00395562052f, -0.00391769656f,
+    -0.00387963553f, -0.0038414389f, -0.00380310815f, -0.00376464477f,
+    -0.00372605023f, -0.00368732603f, -0.00364847366f, -0.00360949461f,
+    -0.0035703904f, -0.00353116254f, -0.00349181252f, -0.00345234187f,
+    -0.00341275211f, -0.00337304476f, -0.00333322135f, -0.00329328342f,
+    -0.00325323249f, -0.00321307011f, -0.00317279783f, -0.00313241718f,
+    -0.00309192973f, -0.00305133702f, -0.00301064061f, -0.00296984207f,
+    -0.00292894295f, -0.00288794484f, -0.00284684929f, -0.00280565789f,
+    -0.00276437221f, -0.00272299384f, -0.00268152435f, -0.00263996534f,
+    -0.0025983184f, -0.00255658511f, -0.00251476708f, -0.0024728659f,
+    -0.00243088317f, -0.0023888205f, -0.0023466795f, -0.00230446177f,
+    -0.00226216893f, -0.00221980258f, -0.00217736435f, -0.00213485585f,
+    -0.00209227871f, -0.00204963454f, -0.00200692497f, -0.00196415164f,
+    -0.00192131616f, -0.00187842016f, -0.00183546529f, -0.00179245317f,
+    -0.00174938544f, -0.00170626374f, -0.00166308971f, -0.00161986499f,
+    -0.00157659121f, -0.00153327003f, -0.00148990309f, -0.00144649203f,
+    -0.0014030385f, -0.00135954416f, -0.00131601064f, -0.00127243961f,
+    -0.00122883271f, -0.00118519159f, -0.00114151791f, -0.00109781332f,
+    -0.00105407948f, -0.00101031804f, -0.000966530662f, -0.000922718996f,
+    -0.000878884703f, -0.000835029438f, -0.00079115486f, -0.000747262627f,
+    -0.000703354397f, -0.000659431828f, -0.000615496578f, -0.000571550307f,
+    -0.000527594672f, -0.000483631331f, -0.000439661943f, -0.000395688166f,
+    -0.000351711657f, -0.000307734074f, -0.000263757072f, -0.000219782309f,
+    -0.00017581144f, -0.000131846121f, -8.78880051e-05f, -4.39387472e-05f,
+    -2.45515689e-17f, 4.39265845e-05f, 8.78393549e-05f, 0.000131736661f,
+    0.000175616854f, 0.000219478285f, 0.000263319308f, 0.000307138277f,
+    0.000350933547f, 0.000394703476f, 0.000438446421f, 0.000482160743f,
+    0.000525844803f, 0.000569496963f, 0.000613115589f, 0.000656699047f,
+    0.000700245704f, 0.000743753931f, 0.0007872221f, 0.000830648583f,
+    0.000874031758f, 0.000917370002f, 0.000960661695f, 0.00100390522f,
+    0.00104709896f, 0.0010902413f, 0.00113333063f, 0.00117636535f,
+    0.00121934385f, 0.00126226452f, 0.00130512576f, 0.00134792598f,
+    0.00139066357f, 0.00143333696f, 0.00147594454f, 0.00151848474f,
+    0.00156095596f, 0.00160335663f, 0.00164568517f, 0.00168794001f,
+    0.00173011956f, 0.00177222228f, 0.00181424658f, 0.00185619092f,
+    0.00189805373f, 0.00193983346f, 0.00198152855f, 0.00202313746f,
+    0.00206465865f, 0.00210609058f, 0.00214743171f, 0.00218868051f,
+    0.00222983545f, 0.00227089501f, 0.00231185766f, 0.00235272189f,
+    0.0023934862f, 0.00243414906f, 0.00247470898f, 0.00251516446f,
+    0.002555514f, 0.00259575612f, 0.00263588932f, 0.00267591212f,
+    0.00271582305f, 0.00275562064f, 0.00279530342f, 0.00283486992f,
+    0.00287431869f, 0.00291364828f, 0.00295285722f, 0.00299194409f,
+    0.00303090744f, 0.00306974585f, 0.00310845787f, 0.00314704209f,
+    0.0031854971f, 0.00322382147f, 0.0032620138f, 0.00330007268f,
+    0.00333799673f, 0.00337578455f, 0.00341343476f, 0.00345094597f,
+    0.00348831681f, 0.00352554591f, 0.00356263191f, 0.00359957345f,
+    0.00363636918f, 0.00367301776f, 0.00370951784f, 0.00374586809f,
+    0.00378206718f, 0.0038181138f, 0.00385400662f, 0.00388974434f,
+    0.00392532565f, 0.00396074925f, 0.00399601387f, 0.0040311182f,
+    0.00406606098f, 0.00410084093f, 0.00413545679f, 0.00416990729f,
+    0.00420419119f, 0.00423830725f, 0.00427225422f, 0.00430603086f,
+    0.00433963597f, 0.00437306831f, 0.00440632668f, 0.00443940987f,
+    0.00447231669f, 0.00450504594f, 0.00453759644f, 0.00456996701f,
+    0.00460215649f, 0.0046341637f, 0.00466598751f, 0.00469762675f,
+    0.00472908029f, 0.004760347f, 0.00479142575f, 0.00482231541f,
+    0.00485301489f, 0.00488352307f, 0.00491383886f, 0.00494396116f,
+    0.00497388891f, 0.00500362103f, 0.00503315645f, 0.0050624941f,
+    0.00509163296f, 0.00512057196f, 0.00514931007f, 0.00517784628f,
+    0.00520617955f, 0.00523430888f, 0.00526223327f, 0.00528995171f,
+    0.00531746323f, 0.00534476685f, 0.00537186159f, 0.00539874648f,
+    0.00542542059f, 0.00545188295f, 0.00547813264f, 0.00550416872f,
+    0.00552999027f, 0.00555559637f, 0.00558098613f, 0.00560615865f,
+    0.00563111303f, 0.0056558484f, 0.00568036389f, 0.00570465863f,
+    0.00572873178f, 0.00575258248f, 0.0057762099f, 0.00579961321f,
+    0.0058227916f, 0.00584574424f, 0.00586847034f, 0.00589096911f,
+    0.00591323976f, 0.00593528151f, 0.00595709361f, 0.00597867528f,
+    0.00600002579f, 0.00602114438f, 0.00604203034f, 0.00606268294f,
+    0.00608310146f, 0.0061032852f, 0.00612323346f, 0.00614294557f,
+    0.00616242084f, 0.0061816586f, 0.0062006582f, 0.00621941898f,
+    0.00623794031f, 0.00625622155f, 0.00627426209f, 0.00629206131f,
+    0.0063096186f, 0.00632693337f, 0.00634400504f, 0.00636083303f,
+    0.00637741677f, 0.00639375571f, 0.00640984931f, 0.00642569701f,
+    0.0064412983f, 0.00645665265f, 0.00647175955f, 0.00648661851f,
+    0.00650122903f, 0.00651559063f, 0.00652970284f, 0.0065435652f,
+    0.00655717725f, 0.00657053855f, 0.00658364867f, 0.00659650718f,
+    0.00660911367f, 0.00662146773f, 0.00663356897f, 0.006645417f,
+    0.00665701145f, 0.00666835195f, 0.00667943813f, 0.00669026967f,
+    0.00670084621f, 0.00671116744f, 0.00672123302f, 0.00673104266f,
+    0.00674059606f, 0.00674989292f, 0.00675893297f, 0.00676771594f,
+    0.00677624157f, 0.00678450961f, 0.00679251982f, 0.00680027196f,
+    0.00680776583f, 0.0068150012f, 0.00682197788f, 0.00682869568f,
+    0.00683515441f, 0.00684135391f, 0.006847294f, 0.00685297455f,
+    0.0068583954f, 0.00686355644f, 0.00686845752f, 0.00687309855f,
+    0.00687747941f, 0.00688160002f, 0.00688546029f, 0.00688906015f,
+    0.00689239954f, 0.0068954784f, 0.00689829669f, 0.00690085437f,
+    0.00690315143f, 0.00690518784f, 0.0069069636f, 0.00690847872f,
+    0.00690973321f, 0.0069107271f, 0.00691146043f, 0.00691193323f,
+    0.00691214556f, 0.00691209749f, 0.00691178909f, 0.00691122044f,
+    0.00691039164f, 0.0069093028f, 0.00690795401f, 0.00690634541f,
+    0.00690447714f, 0.00690234932f, 0.00689996212f, 0.0068973157f,
+    0.00689441022f, 0.00689124587f, 0.00688782285f, 0.00688414134f,
+    0.00688020156f, 0.00687600374f, 0.0068715481f, 0.00686683487f,
+    0.00686186432f, 0.0068566367f, 0.00685115227f, 0.00684541131f,
+    0.00683941412f, 0.00683316099f, 0.00682665222f, 0.00681988813f,
+    0.00681286905f, 0.00680559531f, 0.00679806726f, 0.00679028524f,
+    0.00678224964f, 0.00677396081f, 0.00676541914f, 0.00675662502f,
+    0.00674757886f, 0.00673828106f, 0.00672873204f, 0.00671893224f,
+    0.00670888209f, 0.00669858204f, 0.00668803254f, 0.00667723407f,
+    0.0066661871f, 0.00665489212f, 0.00664334962f, 0.00663156009f,
+    0.00661952407f, 0.00660724206f, 0.0065947146f, 0.00658194222f,
+    0.00656892549f, 0.00655566495f, 0.00654216117f, 0.00652841473f,
+    0.00651442622f, 0.00650019622f, 0.00648572535f, 0.0064710142f,
+    0.00645606342f, 0.00644087361f, 0.00642544543f, 0.00640977951f,
+    0.00639387653f, 0.00637773713f, 0.00636136199f, 0.00634475181f,
+    0.00632790726f, 0.00631082904f, 0.00629351787f, 0.00627597446f,
+    0.00625819954f, 0.00624019384f, 0.00622195811f, 0.00620349308f,
+    0.00618479953f, 0.00616587822f, 0.00614672993f, 0.00612735544f,
+    0.00610775554f, 0.00608793103f, 0.00606788273f, 0.00604761145f,
+    0.00602711801f, 0.00600640326f, 0.00598546803f, 0.00596431316f,
+    0.00594293953f, 0.00592134799f, 0.00589953942f, 0.00587751471f,
+    0.00585527473f, 0.00583282039f, 0.00581015259f, 0.00578727225f,
+    0.00576418029f, 0.00574087763f, 0.00571736521f, 0.00569364398f,
+    0.00566971489f, 0.00564557889f, 0.00562123696f, 0.00559669006f,
+    0.00557193918f, 0.00554698531f, 0.00552182945f, 0.00549647259f,
+    0.00547091575f, 0.00544515995f, 0.00541920621f, 0.00539305556f,
+    0.00536670905f, 0.00534016773f, 0.00531343263f, 0.00528650483f,
+    0.0052593854f, 0.00523207541f, 0.00520457593f, 0.00517688807f,
+    0.00514901291f, 0.00512095155f, 0.00509270511f, 0.00506427471f,
+    0.00503566145f, 0.00500686647f, 0.00497789091f, 0.00494873591f,
+    0.00491940262f, 0.00488989218f, 0.00486020577f, 0.00483034454f,
+    0.00480030968f, 0.00477010235f, 0.00473972376f, 0.00470917508f,
+    0.00467845752f, 0.00464757228f, 0.00461652057f, 0.00458530361f,
+    0.00455392261f, 0.00452237881f, 0.00449067345f, 0.00445880775f,
+    0.00442678296f, 0.00439460034f, 0.00436226114f, 0.00432976662f,
+    0.00429711804f, 0.00426431669f, 0.00423136384f, 0.00419826078f,
+    0.00416500878f, 0.00413160915f, 0.00409806319f, 0.00406437219f,
+    0.00403053747f, 0.00399656035f, 0.00396244214f, 0.00392818416f,
+    0.00389378775f, 0.00385925424f, 0.00382458497f, 0.00378978128f,
+    0.00375484452f, 0.00371977605f, 0.00368457722f, 0.00364924939f,
+    0.00361379393f, 0.00357821221f, 0.00354250561f, 0.00350667551f,
+    0.00347072329f, 0.00343465033f, 0.00339845803f, 0.0033621478f,
+    0.00332572102f, 0.0032891791f, 0.00325252345f, 0.00321575549f,
+    0.00317887662f, 0.00314188828f, 0.00310479188f, 0.00306758885f,
+    0.00303028062f, 0.00299286862f, 0.0029553543f, 0.0029177391f,
+    0.00288002446f, 0.00284221182f, 0.00280430265f, 0.00276629839f,
+    0.0027282005f, 0.00269001045f, 0.0026517297f, 0.00261335971f,
+    0.00257490196f, 0.00253635792f, 0.00249772906f, 0.00245901687f,
+    0.00242022282f, 0.0023813484f, 0.00234239509f, 0.00230336439f,
+    0.00226425779f, 0.00222507678f, 0.00218582285f, 0.00214649751f,
+    0.00210710226f, 0.0020676386f, 0.00202810803f, 0.00198851207f,
+    0.00194885223f, 0.00190913001f, 0.00186934692f, 0.00182950449f,
+    0.00178960424f, 0.00174964767f, 0.00170963632f, 0.0016695717f,
+    0.00162945533f, 0.00158928876f, 0.00154907349f, 0.00150881106f,
+    0.001468503f, 0.00142815084f, 0.00138775611f, 0.00134732034f,
+    0.00130684508f, 0.00126633185f, 0.00122578219f, 0.00118519764f,
+    0.00114457974f, 0.00110393003f, 0.00106325005f, 0.00102254133f,
+    0.000981805423f, 0.000941043868f, 0.000900258207f, 0.000859449983f,
+    0.00081862074f, 0.000777772021f, 0.000736905371f, 0.000696022335f,
+    0.000655124455f, 0.000614213278f, 0.000573290348f, 0.00053235721f,
+    0.000491415408f, 0.000450466488f, 0.000409511993f, 0.000368553467f,
+    0.000327592456f, 0.000286630502f, 0.000245669149f, 0.000204709939f,
+    0.000163754415f, 0.000122804118f, 8.186059e-05f, 4.09253707e-05f,
+    -8.25585517e-21f, -4.09139833e-05f, -8.18150412e-05f, -0.000122701637f,
+    -0.000163572233f, -0.000204425296f, -0.000245259292f, -0.000286072687f,
+    -0.000326863949f, -0.00036763155f, -0.000408373958f, -0.000449089647f,
+    -0.000489777091f, -0.000530434764f, -0.000571061143f, -0.000611654708f,
+    -0.000652213937f, -0.000692737313f, -0.000733223318f, -0.000773670439f,
+    -0.000814077163f, -0.000854441979f, -0.000894763378f, -0.000935039852f,
+    -0.000975269899f, -0.00101545201f, -0.0010555847f, -0.00109566645f,
+    -0.00113569578f, -0.0011756712f, -0.0012155912f, -0.00125545431f,
+    -0.00129525903f, -0.00133500389f, -0.0013746874f, -0.00141430809f,
+    -0.00145386447f, -0.00149335509f, -0.00153277847f, -0.00157213313f,
+    -0.00161141763f, -0.0016506305f, -0.00168977028f, -0.00172883552f,
+    -0.00176782476f, -0.00180673657f, -0.00184556949f, -0.00188432209f,
+    -0.00192299292f, -0.00196158056f, -0.00200008357f, -0.00203850053f,
+    -0.00207683001f, -0.0021150706f, -0.00215322087f, -0.00219127942f,
+    -0.00222924484f, -0.00226711572f, -0.00230489067f, -0.00234256828f,
+    -0.00238014717f, -0.00241762595f, -0.00245500323f, -0.00249227763f,
+    -0.00252944778f, -0.00256651231f, -0.00260346985f, -0.00264031904f,
+    -0.00267705851f, -0.00271368693f, -0.00275020293f, -0.00278660518f,
+    -0.00282289233f, -0.00285906304f, -0.002895116f, -0.00293104988f,
+    -0.00296686334f, -0.00300255509f, -0.0030381238f, -0.00307356817f,
+    -0.00310888691f, -0.00314407871f, -0.00317914229f, -0.00321407635f,
+    -0.00324887963f, -0.00328355085f, -0.00331808873f, -0.00335249201f,
+    -0.00338675944f, -0.00342088976f, -0.00345488173f, -0.00348873409f,
+    -0.00352244563f, -0.0035560151f, -0.00358944127f, -0.00362272294f,
+    -0.00365585889f, -0.00368884791f, -0.0037216888f, -0.00375438036f,
+    -0.0037869214f, -0.00381931074f, -0.0038515472f, -0.00388362961f,
+    -0.00391555681f, -0.00394732763f, -0.00397894092f, -0.00401039553f,
+    -0.00404169033f, -0.00407282418f, -0.00410379595f, -0.00413460452f,
+    -0.00416524877f, -0.0041957276f, -0.0042260399f, -0.00425618459f,
+    -0.00428616056f, -0.00431596674f, -0.00434560205f, -0.00437506543f,
+    -0.0044043558f, -0.00443347213f, -0.00446241335f, -0.00449117843f,
+    -0.00451976633f, -0.00454817603f, -0.0045764065f, -0.00460445673f,
+    -0.00463232571f, -0.00466001245f, -0.00468751596f, -0.00471483524f,
+    -0.00474196932f, -0.00476891723f, -0.00479567801f, -0.0048222507f,
+    -0.00484863435f, -0.00487482803f, -0.00490083079f, -0.00492664171f,
+    -0.00495225987f, -0.00497768436f, -0.00500291428f, -0.00502794873f,
+    -0.00505278683f, -0.00507742768f, -0.00510187043f, -0.00512611419f,
+    -0.00515015812f, -0.00517400137f, -0.00519764309f, -0.00522108245f,
+    -0.00524431861f, -0.00526735078f, -0.00529017812f, -0.00531279985f,
+    -0.00533521515f, -0.00535742326f, -0.00537942339f, -0.00540121476f,
+    -0.00542279662f, -0.00544416822f, -0.00546532879f, -0.00548627761f,
+    -0.00550701395f, -0.00552753709f, -0.0055478463f, -0.00556794089f,
+    -0.00558782016f, -0.00560748342f, -0.00562692999f, -0.00564615919f,
+    -0.00566517037f, -0.00568396287f, -0.00570253603f, -0.00572088923f,
+    -0.00573902183f, -0.00575693322f, -0.00577462277f, -0.00579208988f,
+    -0.00580933396f, -0.00582635442f, -0.00584315069f, -0.00585972218f,
+    -0.00587606834f, -0.00589218862f, -0.00590808248f, -0.00592374937f,
+    -0.00593918876f, -0.00595440016f, -0.00596938303f, -0.00598413688f,
+    -0.00599866123f, -0.00601295558f, -0.00602701947f, -0.00604085242f,
+    -0.00605445398f, -0.0060678237f, -0.00608096115f, -0.00609386589f,
+    -0.0061065375f, -0.00611897558f, -0.0061311797f, -0.0061431495f,
+    -0.00615488456f, -0.00616638453f, -0.00617764903f, -0.0061886777f,
+    -0.0061994702f, -0.00621002618f, -0.00622034531f, -0.00623042727f,
+    -0.00624027175f, -0.00624987844f, -0.00625924704f, -0.00626837727f,
+    -0.00627726885f, -0.00628592152f, -0.00629433501f, -0.00630250907f,
+    -0.00631044346f, -0.00631813796f, -0.00632559233f, -0.00633280636f,
+    -0.00633977986f, -0.00634651262f, -0.00635300445f, -0.00635925519f,
+    -0.00636526465f, -0.00637103269f, -0.00637655915f, -0.00638184389f,
+    -0.00638688678f, -0.0063916877f, -0.00639624653f, -0.00640056318f,
+    -0.00640463753f, -0.00640846952f, -0.00641205906f, -0.00641540608f,
+    -0.00641851053f, -0.00642137236f, -0.00642399153f, -0.006426368f,
+    -0.00642850175f, -0.00643039278f, -0.00643204107f, -0.00643344664f,
+    -0.0064346095f, -0.00643552967f, -0.00643620718f, -0.00643664208f,
+    -0.00643683442f, -0.00643678427f, -0.00643649168f, -0.00643595673f,
+    -0.00643517953f, -0.00643416015f, -0.00643289872f, -0.00643139534f,
+    -0.00642965013f, -0.00642766324f, -0.0064254348f, -0.00642296496f,
+    -0.00642025389f, -0.00641730176f, -0.00641410874f, -0.00641067501f,
+    -0.00640700079f, -0.00640308627f, -0.00639893166f, -0.0063945372f,
+    -0.0063899031f, -0.00638502963f, -0.00637991702f, -0.00637456553f,
+    -0.00636897543f, -0.00636314701f, -0.00635708054f, -0.00635077632f,
+    -0.00634423466f, -0.00633745586f, -0.00633044026f, -0.00632318817f,
+    -0.00631569994f, -0.00630797592f, -0.00630001646f, -0.00629182193f,
+    -0.0062833927f, -0.00627472916f, -0.0062658317f, -0.00625670072f,
+    -0.00624733662f, -0.00623773983f, -0.00622791078f, -0.00621784989f,
+    -0.00620755761f, -0.00619703439f, -0.0061862807f, -0.006175297f,
+    -0.00616408378f, -0.00615264151f, -0.00614097069f, -0.00612907184f,
+    -0.00611694545f, -0.00610459204f, -0.00609201216f, -0.00607920633f,
+    -0.0060661751f, -0.00605291903f, -0.00603943867f, -0.0060257346f,
+    -0.00601180739f, -0.00599765764f, -0.00598328593f, -0.00596869288f,
+    -0.00595387908f, -0.00593884517f, -0.00592359177f, -0.00590811952f,
+    -0.00589242905f, -0.00587652103f, -0.00586039611f, -0.00584405495f,
+    -0.00582749825f, -0.00581072667f, -0.00579374091f, -0.00577654168f,
+    -0.00575912967f, -0.00574150561f, -0.00572367022f, -0.00570562422f,
+    -0.00568736836f, -0.00566890339f, -0.00565023005f, -0.00563134911f,
+    -0.00561226133f, -0.00559296751f, -0.00557346841f, -0.00555376483f,
+    -0.00553385757f, -0.00551374744f, -0.00549343525f, -0.00547292182f,
+    -0.00545220799f, -0.00543129458f, -0.00541018245f, -0.00538887243f,
+    -0.0053673654f, -0.00534566222f, -0.00532376375f, -0.00530167088f,
+    -0.0052793845f, -0.00525690549f, -0.00523423476f, -0.00521137322f,
+    -0.00518832177f, -0.00516508135f, -0.00514165288f, -0.0051180373f,
+    -0.00509423554f, -0.00507024856f, -0.00504607731f, -0.00502172275f,
+    -0.00499718585f, -0.0049724676f, -0.00494756896f, -0.00492249092f,
+    -0.00489723449f, -0.00487180067f, -0.00484619045f, -0.00482040486f,
+    -0.00479444492f, -0.00476831165f, -0.00474200608f, -0.00471552925f,
+    -0.00468888222f, -0.00466206603f, -0.00463508173f, -0.0046079304f,
+    -0.0045806131f, -0.0045531309f, -0.00452548489f, -0.00449767616f,
+    -0.0044697058f, -0.0044415749f, -0.00441328457f, -0.00438483593f,
+    -0.00435623008f, -0.00432746816f, -0.00429855128f, -0.00426948058f,
+    -0.00424025719f, -0.00421088227f, -0.00418135695f, -0.0041516824f,
+    -0.00412185978f, -0.00409189024f, -0.00406177496f, -0.00403151511f,
+    -0.00400111188f, -0.00397056644f, -0.00393988f, -0.00390905374f,
+    -0.00387808887f, -0.00384698658f, -0.0038157481f, -0.00378437463f,
+    -0.0037528674f, -0.00372122762f, -0.00368945654f, -0.00365755537f,
+    -0.00362552537f, -0.00359336777f, -0.00356108381f, -0.00352867476f,
+    -0.00349614187f, -0.00346348639f, -0.00343070959f, -0.00339781275f,
+    -0.00336479712f, -0.003331664f, -0.00329841465f, -0.00326505037f,
+    -0.00323157245f, -0.00319798217f, -0.00316428084f, -0.00313046976f,
+    -0.00309655022f, -0.00306252354f, -0.00302839103f, -0.002994154f,
+    -0.00295981378f, -0.00292537168f, -0.00289082903f, -0.00285618717f,
+    -0.00282144742f, -0.00278661112f, -0.0027516796f, -0.00271665422f,
+    -0.00268153632f, -0.00264632724f, -0.00261102835f, -0.00257564098f,
+    -0.0025401665f, -0.00250460628f, -0.00246896167f, -0.00243323404f,
+    -0.00239742477f, -0.00236153521f, -0.00232556675f, -0.00228952076f,
+    -0.00225339863f, -0.00221720173f, -0.00218093146f, -0.00214458918f,
+    -0.00210817631f, -0.00207169422f, -0.00203514431f, -0.00199852798f,
+    -0.00196184662f, -0.00192510163f, -0.00188829443f, -0.0018514264f,
+    -0.00181449896f, -0.00177751351f, -0.00174047147f, -0.00170337424f,
+    -0.00166622323f, -0.00162901987f, -0.00159176557f, -0.00155446174f,
+    -0.00151710981f, -0.0014797112f, -0.00144226732f, -0.0014047796f,
+    -0.00136724946f, -0.00132967834f, -0.00129206765f, -0.00125441883f,
+    -0.0012167333f, -0.00117901249f, -0.00114125784f, -0.00110347078f,
+    -0.00106565273f, -0.00102780514f, -0.000989929432f, -0.000952027046f,
+    -0.000914099416f, -0.000876147977f, -0.000838174167f, -0.000800179421f,
+    -0.000762165177f, -0.000724132873f, -0.000686083946f, -0.000648019834f,
+    -0.000609941975f, -0.000571851807f, -0.00053375077f, -0.0004956403f,
+    -0.000457521837f, -0.000419396818f, -0.000381266682f, -0.000343132866f,
+    -0.000304996808f, -0.000266859945f, -0.000228723714f, -0.000190589551f,
+    -0.000152458893f, -0.000114333174f, -7.62138294e-05f, -3.81022937e-05f,
+    -6.69277735e-17f, 3.80916188e-05f, 7.61711309e-05f, 0.000114237105f,
+    0.000152288111f, 0.00019032272f, 0.000228339504f, 0.000266337035f,
+    0.000304313888f, 0.000342268638f, 0.000380199861f, 0.000418106134f,
+    0.000455986038f, 0.000493838152f, 0.000531661059f, 0.000569453341f,
+    0.000607213584f, 0.000644940374f, 0.000682632299f, 0.00072028795f,
+    0.000757905918f, 0.000795484796f, 0.00083302318f, 0.000870519667f,
+    0.000907972857f, 0.00094538135f, 0.00098274375f, 0.00102005866f,
+    0.00105732469f, 0.00109454046f, 0.00113170456f, 0.00116881562f,
+    0.00120587226f, 0.00124287308f, 0.00127981673f, 0.00131670181f,
+    0.00135352695f, 0.0013902908f, 0.00142699197f, 0.0014636291f,
+    0.00150020083f, 0.00153670581f, 0.00157314267f, 0.00160951006f,
+    0.00164580663f, 0.00168203104f, 0.00171818193f, 0.00175425798f,
+    0.00179025783f, 0.00182618016f, 0.00186202363f, 0.00189778691f,
+    0.00193346869f, 0.00196906764f, 0.00200458244f, 0.00204001177f,
+    0.00207535434f, 0.00211060882f, 0.00214577392f, 0.00218084834f,
+    0.00221583077f, 0.00225071994f, 0.00228551455f, 0.00232021331f,
+    0.00235481495f, 0.00238931819f, 0.00242372175f, 0.00245802438f,
+    0.00249222481f, 0.00252632177f, 0.00256031401f, 0.00259420028f,
+    0.00262797933f, 0.00266164993f, 0.00269521082f, 0.00272866079f,
+    0.00276199859f, 0.00279522302f, 0.00282833283f, 0.00286132683f,
+    0.0028942038f, 0.00292696254f, 0.00295960184f, 0.0029921205f,
+    0.00302451735f, 0.00305679118f, 0.00308894082f, 0.0031209651f,
+    0.00315286284f, 0.00318463287f, 0.00321627404f, 0.00324778518f,
+    0.00327916516f, 0.00331041282f, 0.00334152702f, 0.00337250663f,
+    0.00340335052f, 0.00343405757f, 0.00346462665f, 0.00349505665f,
+    0.00352534648f, 0.00355549502f, 0.00358550117f, 0.00361536386f,
+    0.00364508199f, 0.00367465449f, 0.00370408027f, 0.00373335828f,
+    0.00376248746f, 0.00379146674f, 0.00382029508f, 0.00384897144f,
+    0.00387749477f, 0.00390586405f, 0.00393407825f, 0.00396213634f,
+    0.00399003733f, 0.00401778019f, 0.00404536394f, 0.00407278757f,
+    0.0041000501f, 0.00412715054f, 0.00415408792f, 0.00418086128f,
+    0.00420746964f, 0.00423391205f, 0.00426018757f, 0.00428629525f,
+    0.00431223415f, 0.00433800334f, 0.00436360191f, 0.00438902893f,
+    0.00441428349f, 0.0044393647f, 0.00446427165f, 0.00448900345f,
+    0.00451355923f, 0.00453793811f, 0.00456213922f, 0.0045861617f,
+    0.00461000468f, 0.00463366734f, 0.00465714881f, 0.00468044828f,
+    0.00470356491f, 0.00472649789f, 0.0047492464f, 0.00477180963f,
+    0.0047941868f, 0.0048163771f, 0.00483837975f, 0.00486019399f,
+    0.00488181903f, 0.00490325413f, 0.00492449851f, 0.00494555145f,
+    0.00496641219f, 0.00498708001f, 0.00500755418f, 0.00502783399f,
+    0.00504791872f, 0.00506780767f, 0.00508750015f, 0.00510699548f,
+    0.00512629297f, 0.00514539195f, 0.00516429177f, 0.00518299175f,
+    0.00520149126f, 0.00521978965f, 0.00523788629f, 0.00525578056f,
+    0.00527347184f, 0.00529095952f, 0.00530824299f, 0.00532532167f,
+    0.00534219496f, 0.0053588623f, 0.0053753231f, 0.00539157682f,
+    0.00540762289f, 0.00542346076f, 0.00543908991f, 0.00545450979f,
+    0.00546971989f, 0.0054847197f, 0.0054995087f, 0.0055140864f,
+    0.00552845231f, 0.00554260595f, 0.00555654685f, 0.00557027453f,
+    0.00558378855f, 0.00559708844f, 0.00561017378f, 0.00562304413f,
+    0.00563569907f, 0.00564813817f, 0.00566036103f, 0.00567236725f,
+    0.00568415645f, 0.00569572823f, 0.00570708222f, 0.00571821806f,
+    0.00572913538f, 0.00573983384f, 0.0057503131f, 0.00576057282f,
+    0.00577061267f, 0.00578043235f, 0.00579003154f, 0.00579940995f,
+    0.00580856727f, 0.00581750324f, 0.00582621757f, 0.00583471f,
+    0.00584298027f, 0.00585102814f, 0.00585885335f, 0.00586645569f,
+    0.00587383492f, 0.00588099083f, 0.00588792322f, 0.00589463188f,
+    0.00590111663f, 0.00590737728f, 0.00591341366f, 0.00591922561f,
+    0.00592481297f, 0.00593017559f, 0.00593531334f, 0.00594022609f,
+    0.00594491371f, 0.00594937608f, 0.00595361311f, 0.0059576247f,
+    0.00596141077f, 0.00596497122f, 0.00596830599f, 0.00597141502f,
+    0.00597429826f, 0.00597695566f, 0.00597938718f, 0.0059815928f,
+    0.00598357249f, 0.00598532624f, 0.00598685406f, 0.00598815595f,
+    0.00598923192f, 0.00599008199f, 0.00599070621f, 0.00599110459f,
+    0.00599127721f, 0.00599122411f, 0.00599094535f, 0.00599044102f,
+    0.00598971119f, 0.00598875596f, 0.00598757542f, 0.00598616969f,
+    0.00598453887f, 0.0059826831f, 0.0059806025f, 0.00597829722f,
+    0.00597576742f, 0.00597301323f, 0.00597003485f, 0.00596683243f,
+    0.00596340616f, 0.00595975624f, 0.00595588286f, 0.00595178624f,
+    0.00594746659f, 0.00594292414f, 0.00593815911f, 0.00593317176f,
+    0.00592796233f, 0.00592253109f, 0.00591687829f, 0.00591100421f,
+    0.00590490915f, 0.00589859338f, 0.00589205721f, 0.00588530095f,
+    0.00587832491f, 0.00587112943f, 0.00586371482f, 0.00585608143f,
+    0.00584822962f, 0.00584015974f, 0.00583187215f, 0.00582336722f,
+    0.00581464535f, 0.00580570692f, 0.00579655232f, 0.00578718196f,
+    0.00577759626f, 0.00576779564f, 0.00575778052f, 0.00574755135f,
+    0.00573710857f, 0.00572645264f, 0.00571558401f, 0.00570450315f,
+    0.00569321055f, 0.00568170668f, 0.00566999204f, 0.00565806713f,
+    0.00564593246f, 0.00563358855f, 0.00562103591f, 0.00560827509f,
+    0.00559530661f, 0.00558213104f, 0.00556874891f, 0.0055551608f,
+    0.00554136727f, 0.0055273689f, 0.00551316627f, 0.00549875999f,
+    0.00548415064f, 0.00546933884f, 0.00545432521f, 0.00543911035f,
+    0.00542369491f, 0.00540807952f, 0.00539226482f, 0.00537625147f,
+    0.00536004013f, 0.00534363145f, 0.00532702613f, 0.00531022483f,
+    0.00529322825f, 0.00527603708f, 0.00525865202f, 0.00524107378f,
+    0.00522330308f, 0.00520534065f, 0.0051871872f, 0.00516884349f,
+    0.00515031026f, 0.00513158825f, 0.00511267823f, 0.00509358096f,
+    0.00507429721f, 0.00505482776f, 0.0050351734f, 0.00501533492f,
+    0.00499531312f, 0.00497510881f, 0.00495472279f, 0.00493415589f,
+    0.00491340894f, 0.00489248276f, 0.00487137819f, 0.00485009608f,
+    0.00482863728f, 0.00480700265f, 0.00478519306f, 0.00476320937f,
+    0.00474105246f, 0.00471872322f, 0.00469622253f, 0.00467355129f,
+    0.0046507104f, 0.00462770078f, 0.00460452333f, 0.00458117898f,
+    0.00455766865f, 0.00453399327f, 0.00451015379f, 0.00448615114f,
+    0.00446198629f, 0.00443766017f, 0.00441317376f, 0.00438852803f,
+    0.00436372394f, 0.00433876248f, 0.00431364462f, 0.00428837137f,
+    0.00426294371f, 0.00423736265f, 0.0042116292f, 0.00418574436f,
+    0.00415970916f, 0.00413352462f, 0.00410719176f, 0.00408071162f,
+    0.00405408524f, 0.00402731367f, 0.00400039794f, 0.00397333913f,
+    0.00394613828f, 0.00391879647f, 0.00389131475f, 0.00386369421f,
+    0.00383593593f, 0.00380804099f, 0.00378001048f, 0.00375184549f,
+    0.00372354713f, 0.00369511649f, 0.00366655469f, 0.00363786284f,
+    0.00360904205f, 0.00358009345f, 0.00355101816f, 0.00352181732f,
+    0.00349249206f, 0.00346304352f, 0.00343347284f, 0.00340378118f,
+    0.00337396968f, 0.0033440395f, 0.00331399181f, 0.00328382777f,
+    0.00325354854f, 0.0032231553f, 0.00319264924f, 0.00316203152f,
+    0.00313130333f, 0.00310046587f, 0.00306952032f, 0.00303846788f,
+    0.00300730976f, 0.00297604715f, 0.00294468126f, 0.0029132133f,
+    0.00288164449f, 0.00284997605f, 0.00281820919f, 0.00278634514f,
+    0.00275438513f, 0.00272233039f, 0.00269018215f, 0.00265794165f,
+    0.00262561013f, 0.00259318884f, 0.00256067902f, 0.00252808192f,
+    0.00249539879f, 0.00246263089f, 0.00242977949f, 0.00239684583f,
+    0.00236383118f, 0.00233073681f, 0.00229756399f, 0.00226431399f,
+    0.00223098808f, 0.00219758755f, 0.00216411367f, 0.00213056772f,
+    0.00209695098f, 0.00206326475f, 0.00202951031f, 0.00199568895f,
+    0.00196180197f, 0.00192785066f, 0.00189383632f, 0.00185976024f,
+    0.00182562373f, 0.00179142809f, 0.00175717462f, 0.00172286464f,
+    0.00168849945f, 0.00165408036f, 0.00161960869f, 0.00158508574f,
+    0.00155051283f, 0.00151589128f, 0.0014812224f, 0.00144650752f,
+    0.00141174796f, 0.00137694503f, 0.00134210007f, 0.00130721439f,
+    0.00127228932f, 0.0012373262f, 0.00120232633f, 0.00116729107f,
+    0.00113222172f, 0.00109711964f, 0.00106198614f, 0.00102682256f,
+    0.00099163023f, 0.00095641049f, 0.00092116467f, 0.000885894107f,
+    0.000850600136f, 0.000815284094f, 0.000779947316f, 0.00074459114f,
+    0.000709216903f, 0.000673825943f, 0.000638419598f, 0.000602999207f,
+    0.000567566106f, 0.000532121636f, 0.000496667134f, 0.000461203938f,
+    0.000425733388f, 0.000390256821f, 0.000354775576f, 0.000319290991f,
+    0.000283804402f, 0.000248317149f, 0.000212830567f, 0.000177345993f,
+    0.000141864764f, 0.000106388216f, 7.09176827e-05f, 3.54544994e-05f,
+    4.24588354e-17f, -3.54444824e-05f, -7.08776154e-05f, -0.000106298067f,
+    -0.000141704507f, -0.000177095606f, -0.000212470034f, -0.000247826463f,
+    -0.000283163567f, -0.00031848002f, -0.000353774498f, -0.000389045676f,
+    -0.000424292233f, -0.000459512848f, -0.000494706201f, -0.000529870975f,
+    -0.000565005853f, -0.000600109519f, -0.00063518066f, -0.000670217964f,
+    -0.000705220121f, -0.000740185822f, -0.000775113759f, -0.000810002629f,
+    -0.000844851128f, -0.000879657953f, -0.000914421807f, -0.000949141391f,
+    -0.000983815409f, -0.00101844257f, -0.00105302158f, -0.00108755115f,
+    -0.00112203f, -0.00115645683f, -0.00119083038f, -0.00122514935f,
+    -0.00125941247f, -0.00129361847f, -0.00132776607f, -0.00136185401f,
+    -0.00139588101f, -0.00142984581f, -0.00146374715f, -0.00149758377f,
+    -0.00153135441f, -0.00156505782f, -0.00159869276f, -0.00163225796f,
+    -0.0016657522f, -0.00169917421f, -0.00173252278f, -0.00176579665f,
+    -0.00179899461f, -0.00183211541f, -0.00186515784f, -0.00189812067f,
+    -0.00193100268f, -0.00196380266f, -0.00199651939f, -0.00202915166f,
+    -0.00206169827f, -0.00209415802f, -0.00212652971f, -0.00215881215f,
+    -0.00219100414f, -0.00222310449f, -0.00225511203f, -0.00228702557f,
+    -0.00231884394f, -0.00235056596f, -0.00238219047f, -0.00241371631f,
+    -0.00244514231f, -0.00247646732f, -0.00250769019f, -0.00253880977f,
+    -0.00256982492f, -0.00260073449f, -0.00263153736f, -0.00266223239f,
+    -0.00269281846f, -0.00272329445f, -0.00275365923f, -0.0027839117f,
+    -0.00281405075f, -0.00284407528f, -0.00287398418f, -0.00290377637f,
+    -0.00293345075f, -0.00296300624f, -0.00299244176f, -0.00302175623f,
+    -0.00305094859f, -0.00308001777f, -0.00310896271f, -0.00313778235f,
+    -0.00316647564f, -0.00319504154f, -0.00322347901f, -0.00325178701f,
+    -0.00327996452f, -0.00330801051f, -0.00333592395f, -0.00336370384f,
+    -0.00339134917f, -0.00341885893f, -0.00344623213f, -0.00347346777f,
+    -0.00350056486f, -0.00352752243f, -0.0035543395f, -0.00358101509f,
+    -0.00360754825f, -0.00363393801f, -0.00366018342f, -0.00368628354f,
+    -0.00371223741f, -0.00373804411f, -0.0037637027f, -0.00378921226f,
+    -0.00381457187f, -0.00383978061f, -0.00386483759f, -0.00388974189f,
+    -0.00391449263f, -0.00393908891f, -0.00396352986f, -0.00398781459f,
+    -0.00401194223f, -0.00403591193f, -0.00405972282f, -0.00408337404f,
+    -0.00410686477f, -0.00413019414f, -0.00415336134f, -0.00417636553f,
+    -0.0041992059f, -0.00422188163f, -0.00424439191f, -0.00426673594f,
+    -0.00428891293f, -0.00431092208f, -0.00433276263f, -0.00435443378f,
+    -0.00437593478f, -0.00439726486f, -0.00441842327f, -0.00443940925f,
+    -0.00446022208f, -0.004480861f, -0.0045013253f, -0.00452161424f,
+    -0.00454172713f, -0.00456166324f, -0.00458142189f, -0.00460100236f,
+    -0.00462040399f, -0.00463962608f, -0.00465866796f, -0.00467752897f,
+    -0.00469620845f, -0.00471470575f, -0.00473302021f, -0.00475115121f,
+    -0.00476909811f, -0.00478686028f, -0.00480443712f, -0.00482182801f,
+    -0.00483903234f, -0.00485604953f, -0.00487287899f, -0.00488952012f,
+    -0.00490597237f, -0.00492223517f, -0.00493830795f, -0.00495419016f,
+    -0.00496988126f, -0.00498538072f, -0.00500068799f, -0.00501580257f,
+    -0.00503072394f, -0.00504545158f, -0.005059985f, -0.00507432371f,
+    -0.00508846722f, -0.00510241506f, -0.00511616674f, -0.00512972182f,
+    -0.00514307984f, -0.00515624034f, -0.0051692029f, -0.00518196707f,
+    -0.00519453243f, -0.00520689857f, -0.00521906507f, -0.00523103154f,
+    -0.00524279758f, -0.00525436281f, -0.00526572683f, -0.0052768893f,
+    -0.00528784983f, -0.00529860808f, -0.00530916369f, -0.00531951633f,
+    -0.00532966567f, -0.00533961138f, -0.00534935314f, -0.00535889064f,
+    -0.00536822358f, -0.00537735168f, -0.00538627463f, -0.00539499217f,
+    -0.00540350403f, -0.00541180994f, -0.00541990964f, -0.0054278029f,
+    -0.00543548947f, -0.00544296912f, -0.00545024163f, -0.00545730678f,
+    -0.00546416437f, -0.0054708142f, -0.00547725607f, -0.0054834898f,
+    -0.00548951521f, -0.00549533214f, -0.00550094044f, -0.00550633993f,
+    -0.00551153049f, -0.00551651197f, -0.00552128425f, -0.0055258472f,
+    -0.00553020072f, -0.0055343447f, -0.00553827904f, -0.00554200365f,
+    -0.00554551845f, -0.00554882338f, -0.00555191836f, -0.00555480334f,
+    -0.00555747826f, -0.0055599431f, -0.00556219781f, -0.00556424237f,
+    -0.00556607675f, -0.00556770097f, -0.005569115f, -0.00557031886f,
+    -0.00557131256f, -0.00557209612f, -0.00557266958f, -0.00557303297f,
+    -0.00557318634f, -0.00557312973f, -0.00557286323f, -0.00557238688f,
+    -0.00557170078f, -0.005570805f, -0.00556969963f, -0.00556838479f,
+    -0.00556686058f, -0.00556512712f, -0.00556318452f, -0.00556103293f,
+    -0.00555867248f, -0.00555610332f, -0.00555332561f, -0.00555033951f,
+    -0.0055471452f, -0.00554374285f, -0.00554013265f, -0.00553631479f,
+    -0.00553228948f, -0.00552805693f, -0.00552361736f, -0.00551897098f,
+    -0.00551411805f, -0.00550905879f, -0.00550379346f, -0.00549832232f,
+    -0.00549264562f, -0.00548676364f, -0.00548067666f, -0.00547438498f,
+    -0.00546788887f, -0.00546118865f, -0.00545428463f, -0.00544717712f,
+    -0.00543986645f, -0.00543235296f, -0.00542463697f, -0.00541671885f,
+    -0.00540859895f, -0.00540027763f, -0.00539175526f, -0.00538303222f,
+    -0.00537410889f, -0.00536498568f, -0.00535566297f, -0.00534614118f,
+    -0.00533642072f, -0.00532650202f, -0.0053163855f, -0.0053060716f,
+    -0.00529556077f, -0.00528485345f, -0.00527395012f, -0.00526285123f,
+    -0.00525155725f, -0.00524006868f, -0.00522838599f, -0.00521650968f,
+    -0.00520444026f, -0.00519217823f, -0.00517972412f, -0.00516707844f,
+    -0.00515424172f, -0.0051412145f, -0.00512799734f, -0.00511459077f,
+    -0.00510099537f, -0.00508721168f, -0.0050732403f, -0.00505908179f,
+    -0.00504473675f, -0.00503020576f, -0.00501548943f, -0.00500058836f,
+    -0.00498550318f, -0.00497023449f, -0.00495478293f, -0.00493914913f,
+    -0.00492333373f, -0.00490733738f, -0.00489116073f, -0.00487480445f,
+    -0.00485826919f, -0.00484155564f, -0.00482466448f, -0.00480759638f,
+    -0.00479035206f, -0.00477293219f, -0.0047553375f, -0.00473756869f,
+    -0.00471962648f, -0.0047015116f, -0.00468322478f, -0.00466476676f,
+    -0.00464613827f, -0.00462734008f, -0.00460837294f, -0.0045892376f,
+    -0.00456993485f, -0.00455046545f, -0.00453083018f, -0.00451102983f,
+    -0.0044910652f, -0.00447093708f, -0.00445064628f, -0.00443019361f,
+    -0.00440957988f, -0.00438880592f, -0.00436787256f, -0.00434678063f,
+    -0.00432553096f, -0.00430412441f, -0.00428256183f, -0.00426084407f,
+    -0.00423897199f, -0.00421694647f, -0.00419476837f, -0.00417243857f,
+    -0.00414995797f, -0.00412732745f, -0.0041045479f, -0.00408162022f,
+    -0.00405854533f, -0.00403532412f, -0.00401195753f, -0.00398844647f,
+    -0.00396479186f, -0.00394099464f, -0.00391705575f, -0.00389297613f,
+    -0.00386875672f, -0.00384439848f, -0.00381990236f, -0.00379526934f,
+    -0.00377050036f, -0.00374559641f, -0.00372055846f, -0.0036953875f,
+    -0.0036700845f, -0.00364465047f, -0.00361908639f, -0.00359339327f,
+    -0.00356757211f, -0.00354162392f, -0.00351554971f, -0.0034893505f,
+    -0.00346302732f, -0.00343658119f, -0.00341001315f, -0.00338332422f,
+    -0.00335651544f, -0.00332958787f, -0.00330254256f, -0.00327538054f,
+    -0.00324810288f, -0.00322071065f, -0.00319320489f, -0.00316558669f,
+    -0.00313785712f, -0.00311001724f, -0.00308206815f, -0.00305401093f,
+    -0.00302584666f, -0.00299757643f, -0.00296920135f, -0.0029407225f,
+    -0.002912141f, -0.00288345794f, -0.00285467444f, -0.00282579161f,
+    -0.00279681057f, -0.00276773243f, -0.00273855833f, -0.00270928938f,
+    -0.00267992671f, -0.00265047146f, -0.00262092477f, -0.00259128777f,
+    -0.00256156161f, -0.00253174742f, -0.00250184637f, -0.0024718596f,
+    -0.00244178826f, -0.00241163352f, -0.00238139652f, -0.00235107844f,
+    -0.00232068044f, -0.00229020368f, -0.00225964935f, -0.0022290186f,
+    -0.00219831262f, -0.00216753259f, -0.00213667968f, -0.00210575508f,
+    -0.00207475997f, -0.00204369555f, -0.002012563f, -0.00198136351f,
+    -0.00195009828f, -0.0019187685f, -0.00188737538f, -0.00185592012f,
+    -0.00182440391f, -0.00179282796f, -0.00176119348f, -0.00172950168f,
+    -0.00169775377f, -0.00166595095f, -0.00163409445f, -0.00160218548f,
+    -0.00157022525f, -0.00153821499f, -0.00150615591f, -0.00147404924f,
+    -0.00144189619f, -0.001409698f, -0.00137745589f, -0.00134517109f,
+    -0.00131284482f, -0.00128047832f, -0.00124807281f, -0.00121562953f,
+    -0.00118314971f, -0.00115063459f, -0.00111808539f, -0.00108550336f,
+    -0.00105288974f, -0.00102024575f, -0.000987572643f, -0.000954871653f,
+    -0.00092214402f, -0.000889390986f, -0.00085661379f, -0.000823813677f,
+    -0.000790991886f, -0.000758149661f, -0.000725288246f, -0.000692408883f,
+    -0.000659512816f, -0.00062660129f, -0.000593675548f, -0.000560736836f,
+    -0.000527786397f, -0.000494825477f, -0.00046185532f, -0.00042887717f,
+    -0.000395892274f, -0.000362901875f, -0.000329907217f, -0.000296909545f,
+    -0.000263910103f, -0.000230910134f, -0.000197910882f, -0.00016491359f,
+    -0.000131919501f, -9.89298556e-05f, -6.59458966e-05f, -3.29688646e-05f,
+    -2.1053566e-17f, 3.29594575e-05f, 6.59082688e-05f, 9.88451958e-05f,
+    0.000131769001f, 0.000164678448f, 0.0001975723f, 0.000230449324f,
+    0.000263308285f, 0.00029614795f, 0.000328967089f, 0.000361764469f,
+    0.000394538863f, 0.000427289042f, 0.000460013778f, 0.000492711847f,
+    0.000525382024f, 0.000558023086f, 0.000590633812f, 0.000623212981f,
+    0.000655759377f, 0.000688271781f, 0.000720748979f, 0.000753189758f,
+    0.000785592904f, 0.00081795721f, 0.000850281465f, 0.000882564464f,
+    0.000914805003f, 0.000947001879f, 0.000979153892f, 0.00101125984f,
+    0.00104331853f, 0.00107532877f, 0.00110728937f, 0.00113919913f,
+    0.00117105687f, 0.0012028614f, 0.00123461154f, 0.00126630611f,
+    0.00129794393f, 0.00132952382f, 0.00136104462f, 0.00139250515f,
+    0.00142390424f, 0.00145524072f, 0.00148651345f, 0.00151772125f,
+    0.00154886296f, 0.00157993744f, 0.00161094354f, 0.00164188009f,
+    0.00167274597f, 0.00170354002f, 0.0017342611f, 0.00176490809f,
+    0.00179547984f, 0.00182597522f, 0.00185639312f, 0.0018867324f,
+    0.00191699194f, 0.00194717063f, 0.00197726735f, 0.002007281f,
+    0.00203721046f, 0.00206705464f, 0.00209681242f, 0.00212648273f,
+    0.00215606445f, 0.00218555651f, 0.00221495782f, 0.00224426729f,
+    0.00227348385f, 0.00230260643f, 0.00233163395f, 0.00236056535f,
+    0.00238939957f, 0.00241813554f, 0.00244677222f, 0.00247530854f,
+    0.00250374348f, 0.00253207597f, 0.00256030499f, 0.00258842951f,
+    0.00261644848f, 0.00264436089f, 0.00267216572f, 0.00269986194f,
+    0.00272744855f, 0.00275492454f, 0.0027822889f, 0.00280954063f,
+    0.00283667875f, 0.00286370226f, 0.00289061018f, 0.00291740152f,
+    0.00294407531f, 0.00297063058f, 0.00299706635f, 0.00302338168f,
+    0.0030495756f, 0.00307564716f, 0.00310159542f, 0.00312741942f,
+    0.00315311824f, 0.00317869094f, 0.0032041366f, 0.00322945428f,
+    0.00325464308f, 0.00327970208f, 0.00330463038f, 0.00332942707f,
+    0.00335409126f, 0.00337862205f, 0.00340301856f, 0.00342727992f,
+    0.00345140523f, 0.00347539364f, 0.00349924428f, 0.00352295628f,
+    0.00354652881f, 0.003569961f, 0.00359325202f, 0.00361640102f,
+    0.00363940719f, 0.00366226968f, 0.00368498768f, 0.00370756038f,
+    0.00372998697f, 0.00375226664f, 0.0037743986f, 0.00379638205f,
+    0.00381821622f, 0.00383990031f, 0.00386143356f, 0.0038828152f,
+    0.00390404446f, 0.00392512059f, 0.00394604284f, 0.00396681047f,
+    0.00398742273f, 0.0040078789f, 0.00402817825f, 0.00404832005f,
+    0.0040683036f, 0.00408812819f, 0.00410779312f, 0.00412729768f,
+    0.0041466412f, 0.00416582299f, 0.00418484237f, 0.00420369867f,
+    0.00422239124f, 0.0042409194f, 0.00425928252f, 0.00427747994f,
+    0.00429551103f, 0.00431337516f, 0.0043310717f, 0.00434860003f,
+    0.00436595954f, 0.00438314963f, 0.00440016969f, 0.00441701913f,
+    0.00443369738f, 0.00445020384f, 0.00446653794f, 0.00448269913f,
+    0.00449868683f, 0.0045145005f, 0.0045301396f, 0.00454560357f,
+    0.0045608919f, 0.00457600405f, 0.0045909395f, 0.00460569775f,
+    0.00462027828f, 0.0046346806f, 0.00464890423f, 0.00466294866f,
+    0.00467681343f, 0.00469049806f, 0.0047040021f, 0.00471732508f,
+    0.00473046655f, 0.00474342607f, 0.0047562032f, 0.00476879753f,
+    0.00478120861f, 0.00479343604f, 0.00480547941f, 0.00481733832f,
+    0.00482901237f, 0.00484050118f, 0.00485180437f, 0.00486292157f,
+    0.00487385241f, 0.00488459652f, 0.00489515357f, 0.0049055232f,
+    0.00491570508f, 0.00492569889f, 0.00493550428f, 0.00494512096f,
+    0.00495454862f, 0.00496378694f, 0.00497283564f, 0.00498169444f,
+    0.00499036304f, 0.00499884119f, 0.00500712861f, 0.00501522505f,
+    0.00502313026f, 0.00503084399f, 0.00503836602f, 0.0050456961f,
+    0.00505283402f, 0.00505977956f, 0.00506653253f, 0.00507309271f,
+    0.00507945992f, 0.00508563398f, 0.0050916147f, 0.00509740192f,
+    0.00510299547f, 0.0051083952f, 0.00511360096f, 0.00511861261f,
+    0.00512343001f, 0.00512805305f, 0.0051324816f, 0.00513671555f,
+    0.0051407548f, 0.00514459925f, 0.00514824881f, 0.0051517034f,
+    0.00515496295f, 0.00515802739f, 0.00516089666f, 0.0051635707f,
+    0.00516604948f, 0.00516833296f, 0.0051704211f, 0.00517231388f,
+    0.00517401129f, 0.00517551332f, 0.00517681998f, 0.00517793125f,
+    0.00517884717f, 0.00517956775f, 0.00518009302f, 0.00518042301f,
+    0.00518055778f, 0.00518049737f, 0.00518024184f, 0.00517979125f,
+    0.00517914568f, 0.00517830521f, 0.00517726993f, 0.00517603992f,
+    0.0051746153f, 0.00517299618f, 0.00517118266f, 0.00516917487f,
+    0.00516697295f, 0.00516457704f, 0.00516198727f, 0.0051592038f,
+    0.0051562268f, 0.00515305643f, 0.00514969287f, 0.00514613629f,
+    0.00514238689f, 0.00513844486f, 0.00513431041f, 0.00512998375f,
+    0.0051254651f, 0.00512075468f, 0.00511585272f, 0.00511075946f,
+    0.00510547516f, 0.00510000006f, 0.00509433443f, 0.00508847854f,
+    0.00508243265f, 0.00507619705f, 0.00506977203f, 0.00506315789f,
+    0.00505635494f, 0.00504936347f, 0.00504218381f, 0.00503481629f,
+    0.00502726123f, 0.00501951897f, 0.00501158986f, 0.00500347426f,
+    0.00499517251f, 0.00498668499f, 0.00497801207f, 0.00496915413f,
+    0.00496011155f, 0.00495088474f, 0.00494147409f, 0.00493188f,
+    0.0049221029f, 0.0049121432f, 0.00490200133f, 0.00489167772f,
+    0.00488117282f, 0.00487048708f, 0.00485962094f, 0.00484857488f,
+    0.00483734935f, 0.00482594483f, 0.00481436181f, 0.00480260077f,
+    0.0047906622f, 0.0047785466f, 0.00476625449f, 0.00475378638f,
+    0.00474114279f, 0.00472832423f, 0.00471533126f, 0.0047021644f,
+    0.0046888242f, 0.00467531122f, 0.00466162602f, 0.00464776915f,
+    0.00463374119f, 0.00461954272f, 0.00460517432f, 0.00459063658f,
+    0.0045759301f, 0.00456105548f, 0.00454601333f, 0.00453080427f,
+    0.00451542891f, 0.00449988788f, 0.00448418182f, 0.00446831136f,
+    0.00445227715f, 0.00443607985f, 0.0044197201f, 0.00440319857f,
+    0.00438651593f, 0.00436967286f, 0.00435267003f, 0.00433550813f,
+    0.00431818786f, 0.00430070991f, 0.00428307498f, 0.00426528379f,
+    0.00424733705f, 0.00422923548f, 0.00421097981f, 0.00419257078f,
+    0.0041740091f, 0.00415529554f, 0.00413643084f, 0.00411741575f,
+    0.00409825104f, 0.00407893746f, 0.00405947579f, 0.00403986681f,
+    0.00402011129f, 0.00400021002f, 0.0039801638f, 0.00395997342f,
+    0.00393963968f, 0.00391916339f, 0.00389854537f, 0.00387778642f,
+    0.00385688738f, 0.00383584906f, 0.00381467231f, 0.00379335796f,
+    0.00377190685f, 0.00375031984f, 0.00372859776f, 0.00370674149f,
+    0.00368475188f, 0.0036626298f, 0.00364037612f, 0.00361799171f,
+    0.00359547746f, 0.00357283426f, 0.00355006299f, 0.00352716455f,
+    0.00350413983f, 0.00348098975f, 0.0034577152f, 0.00343431711f,
+    0.00341079639f, 0.00338715396f, 0.00336339074f, 0.00333950767f,
+    0.00331550568f, 0.00329138571f, 0.0032671487f, 0.0032427956f,
+    0.00321832736f, 0.00319374493f, 0.00316904928f, 0.00314424137f,
+    0.00311932215f, 0.00309429261f, 0.00306915372f, 0.00304390646f,
+    0.00301855181f, 0.00299309075f, 0.00296752428f, 0.00294185339f,
+    0.00291607907f, 0.00289020233f, 0.00286422418f, 0.00283814561f,
+    0.00281196764f, 0.00278569129f, 0.00275931758f, 0.00273284752f,
+    0.00270628214f, 0.00267962247f, 0.00265286954f, 0.00262602438f,
+    0.00259908804f, 0.00257206156f, 0.00254494597f, 0.00251774233f,
+    0.00249045168f, 0.00246307508f, 0.00243561359f, 0.00240806826f,
+    0.00238044016f, 0.00235273035f, 0.0023249399f, 0.00229706988f,
+    0.00226912136f, 0.00224109541f, 0.00221299312f, 0.00218481557f,
+    0.00215656384f, 0.00212823901f, 0.00209984217f, 0.00207137442f,
+    0.00204283685f, 0.00201423054f, 0.00198555661f, 0.00195681615f,
+    0.00192801025f, 0.00189914004f, 0.0018702066f, 0.00184121106f,
+    0.00181215451f, 0.00178303808f, 0.00175386287f, 0.00172463001f,
+    0.0016953406f, 0.00166599578f, 0.00163659666f, 0.00160714436f,
+    0.00157764002f, 0.00154808475f, 0.00151847968f, 0.00148882596f,
+    0.00145912469f, 0.00142937703f, 0.00139958409f, 0.00136974703f,
+    0.00133986697f, 0.00130994505f, 0.00127998242f, 0.00124998021f,
+    0.00121993956f, 0.00118986162f, 0.00115974753f, 0.00112959844f,
+    0.00109941549f, 0.00106919983f, 0.00103895261f, 0.00100867497f,
+    0.000978368065f, 0.000948033048f, 0.000917671067f, 0.000887283274f,
+    0.000856870822f, 0.000826434863f, 0.00079597655f, 0.000765497038f,
+    0.000734997481f, 0.000704479034f, 0.000673942852f, 0.00064339009f,
+    0.000612821905f, 0.000582239453f, 0.000551643889f, 0.000521036371f,
+    0.000490418054f, 0.000459790097f, 0.000429153654f, 0.000398509884f,
+    0.000367859941f, 0.000337204984f, 0.000306546169f, 0.000275884651f,
+    0.000245221586f, 0.000214558131f, 0.00018389544f, 0.000153234669f,
+    0.000122576972f, 9.19235031e-05f, 6.12754162e-05f, 3.06338643e-05f,
+    2.43912381e-18f, -3.06250249e-05f, -6.12400591e-05f, -9.1843952e-05f,
+    -0.000122435554f, -0.000153013716f, -0.00018357729f, -0.000214125128f,
+    -0.000244656085f, -0.000275169014f, -0.000305662772f, -0.000336136215f,
+    -0.000366588201f, -0.000397017589f, -0.000427423239f, -0.000457804012f,
+    -0.000488158771f, -0.00051848638f, -0.000548785704f, -0.000579055609f,
+    -0.000609294965f, -0.000639502639f, -0.000669677504f, -0.000699818432f,
+    -0.000729924297f, -0.000759993975f, -0.000790026344f, -0.000820020283f,
+    -0.000849974673f, -0.000879888397f, -0.00090976034f, -0.000939589388f,
+    -0.00096937443f, -0.000999114357f, -0.00102880806f, -0.00105845444f,
+    -0.00108805238f, -0.00111760079f, -0.00114709857f, -0.00117654462f,
+    -0.00120593785f, -0.00123527716f, -0.00126456147f, -0.00129378969f,
+    -0.00132296073f, -0.00135207351f, -0.00138112695f, -0.00141011997f,
+    -0.0014390515f, -0.00146792047f, -0.0014967258f, -0.00152546644f,
+    -0.0015541413f, -0.00158274935f, -0.0016112895f, -0.00163976072f,
+    -0.00166816195f, -0.00169649213f, -0.00172475022f, -0.00175293518f,
+    -0.00178104597f, -0.00180908154f, -0.00183704087f, -0.00186492292f,
+    -0.00189272666f, -0.00192045108f, -0.00194809514f, -0.00197565783f,
+    -0.00200313814f, -0.00203053505f, -0.00205784755f, -0.00208507465f,
+    -0.00211221533f, -0.00213926861f, -0.00216623348f, -0.00219310896f,
+    -0.00221989407f, -0.00224658781f, -0.00227318921f, -0.00229969729f,
+    -0.00232611108f, -0.00235242962f, -0.00237865193f, -0.00240477707f,
+    -0.00243080406f, -0.00245673197f, -0.00248255984f, -0.00250828673f,
+    -0.0025339117f, -0.00255943381f, -0.00258485214f, -0.00261016574f,
+    -0.00263537371f, -0.00266047511f, -0.00268546904f, -0.00271035459f,
+    -0.00273513084f, -0.0027597969f, -0.00278435187f, -0.00280879486f,
+    -0.00283312497f, -0.00285734133f, -0.00288144306f, -0.00290542927f,
+    -0.0029292991f, -0.00295305169f, -0.00297668617f, -0.00300020168f,
+    -0.00302359738f, -0.00304687242f, -0.00307002596f, -0.00309305715f,
+    -0.00311596517f, -0.00313874919f, -0.00316140839f, -0.00318394194f,
+    -0.00320634905f, -0.00322862889f, -0.00325078066f, -0.00327280358f,
+    -0.00329469684f, -0.00331645967f, -0.00333809126f, -0.00335959086f,
+    -0.00338095769f, -0.00340219098f, -0.00342328996f, -0.0034442539f,
+    -0.00346508202f, -0.0034857736f, -0.00350632788f, -0.00352674413f,
+    -0.00354702163f, -0.00356715965f, -0.00358715747f, -0.00360701438f,
+    -0.00362672967f, -0.00364630264f, -0.0036657326f, -0.00368501885f,
+    -0.0037041607f, -0.00372315749f, -0.00374200853f, -0.00376071315f,
+    -0.0037792707f, -0.00379768052f, -0.00381594196f, -0.00383405437f,
+    -0.00385201711f, -0.00386982955f, -0.00388749106f, -0.00390500102f,
+    -0.00392235882f, -0.00393956384f, -0.00395661548f, -0.00397351315f,
+    -0.00399025624f, -0.00400684418f, -0.00402327638f, -0.00403955228f,
+    -0.00405567129f, -0.00407163287f, -0.00408743645f, -0.00410308149f,
+    -0.00411856744f, -0.00413389376f, -0.00414905992f, -0.00416406541f,
+    -0.00417890969f, -0.00419359226f, -0.00420811261f, -0.00422247024f,
+    -0.00423666466f, -0.00425069537f, -0.00426456191f, -0.00427826378f,
+    -0.00429180053f, -0.0043051717f, -0.00431837682f, -0.00433141544f,
+    -0.00434428713f, -0.00435699145f, -0.00436952797f, -0.00438189625f,
+    -0.0043940959f, -0.00440612649f, -0.00441798762f, -0.0044296789f,
+    -0.00444119993f, -0.00445255032f, -0.00446372971f, -0.00447473771f,
+    -0.00448557397f, -0.00449623812f, -0.00450672981f, -0.0045170487f,
+    -0.00452719445f, -0.00453716672f, -0.0045469652f, -0.00455658956f,
+    -0.00456603948f, -0.00457531468f, -0.00458441483f, -0.00459333966f,
+    -0.00460208888f, -0.00461066221f, -0.00461905938f, -0.00462728012f,
+    -0.00463532417f, -0.00464319128f, -0.00465088121f, -0.00465839372f,
+    -0.00466572858f, -0.00467288555f, -0.00467986443f, -0.00468666501f,
+    -0.00469328707f, -0.00469973042f, -0.00470599487f, -0.00471208024f,
+    -0.00471798634f, -0.00472371301f, -0.00472926009f, -0.00473462741f,
+    -0.00473981483f, -0.0047448222f, -0.00474964939f, -0.00475429626f,
+    -0.0047587627f, -0.00476304859f, -0.00476715382f, -0.00477107829f,
+    -0.00477482189f, -0.00477838455f, -0.00478176619f, -0.00478496672f,
+    -0.00478798607f, -0.0047908242f, -0.00479348104f, -0.00479595654f,
+    -0.00479825067f, -0.00480036339f, -0.00480229467f, -0.0048040445f,
+    -0.00480561286f, -0.00480699974f, -0.00480820515f, -0.00480922909f,
+    -0.00481007157f, -0.00481073263f, -0.00481121227f, -0.00481151055f,
+    -0.0048116275f, -0.00481156316f, -0.0048113176f, -0.00481089088f,
+    -0.00481028306f, -0.00480949422f, -0.00480852444f, -0.00480737382f,
+    -0.00480604244f, -0.00480453041f, -0.00480283784f, -0.00480096484f,
+    -0.00479891155f, -0.00479667808f, -0.00479426457f, -0.00479167118f,
+    -0.00478889804f, -0.00478594531f, -0.00478281317f, -0.00477950177f,
+    -0.00477601129f, -0.00477234193f, -0.00476849386f, -0.00476446728f,
+    -0.00476026241f, -0.00475587944f, -0.0047513186f, -0.00474658011f,
+    -0.0047416642f, -0.00473657111f, -0.00473130107f, -0.00472585434f,
+    -0.00472023118f, -0.00471443185f, -0.00470845662f, -0.00470230576f,
+    -0.00469597956f, -0.0046894783f, -0.00468280229f, -0.00467595182f,
+    -0.00466892721f, -0.00466172877f, -0.00465435682f, -0.00464681168f,
+    -0.0046390937f, -0.00463120321f, -0.00462314057f, -0.00461490612f,
+    -0.00460650023f, -0.00459792326f, -0.00458917558f, -0.00458025758f,
+    -0.00457116964f, -0.00456191215f, -0.00455248551f, -0.00454289013f,
+    -0.0045331264f, -0.00452319476f, -0.00451309563f, -0.00450282943f,
+    -0.00449239659f, -0.00448179757f, -0.0044710328f, -0.00446010275f,
+    -0.00444900787f, -0.00443774862f, -0.00442632549f, -0.00441473894f,
+    -0.00440298947f, -0.00439107755f, -0.00437900369f, -0.0043667684f,
+    -0.00435437217f, -0.00434181552f, -0.00432909897f, -0.00431622305f,
+    -0.00430318829f, -0.00428999522f, -0.00427664439f, -0.00426313635f,
+    -0.00424947165f, -0.00423565085f, -0.00422167452f, -0.00420754323f,
+    -0.00419325756f, -0.00417881809f, -0.00416422541f, -0.00414948011f,
+    -0.0041345828f, -0.00411953408f, -0.00410433455f, -0.00408898485f,
+    -0.00407348558f, -0.00405783738f, -0.00404204088f, -0.00402609671f,
+    -0.00401000553f, -0.00399376798f, -0.00397738471f, -0.00396085639f,
+    -0.00394418367f, -0.00392736724f, -0.00391040776f, -0.00389330591f,
+    -0.00387606239f, -0.00385867787f, -0.00384115307f, -0.00382348867f,
+    -0.00380568539f, -0.00378774394f, -0.00376966503f, -0.00375144938f,
+    -0.00373309772f, -0.00371461078f, -0.0036959893f, -0.00367723402f,
+    -0.00365834568f, -0.00363932503f, -0.00362017283f, -0.00360088984f,
+    -0.00358147682f, -0.00356193455f, -0.00354226379f, -0.00352246532f,
+    -0.00350253993f, -0.00348248841f, -0.00346231155f, -0.00344201014f,
+    -0.00342158498f, -0.00340103689f, -0.00338036666f, -0.00335957512f,
+    -0.00333866309f, -0.00331763138f, -0.00329648083f, -0.00327521226f,
+    -0.00325382651f, -0.00323232443f, -0.00321070685f, -0.00318897462f,
+    -0.0031671286f, -0.00314516963f, -0.0031230986f, -0.00310091634f,
+    -0.00307862374f, -0.00305622167f, -0.003033711f, -0.00301109261f,
+    -0.00298836739f, -0.00296553621f, -0.00294259999f, -0.0029195596f,
+    -0.00289641594f, -0.00287316993f, -0.00284982246f, -0.00282637445f,
+    -0.0028028268f, -0.00277918043f, -0.00275543627f, -0.00273159523f,
+    -0.00270765824f, -0.00268362624f, -0.00265950015f, -0.00263528091f,
+    -0.00261096946f, -0.00258656675f, -0.00256207371f, -0.00253749131f,
+    -0.00251282048f, -0.00248806219f, -0.0024632174f, -0.00243828706f,
+    -0.00241327214f, -0.00238817361f, -0.00236299244f, -0.00233772959f,
+    -0.00231238605f, -0.0022869628f, -0.00226146081f, -0.00223588107f,
+    -0.00221022457f, -0.00218449228f, -0.00215868522f, -0.00213280436f,
+    -0.00210685072f, -0.00208082527f, -0.00205472904f, -0.00202856301f,
+    -0.0020023282f, -0.00197602562f, -0.00194965627f, -0.00192322118f,
+    -0.00189672135f, -0.00187015779f, -0.00184353155f, -0.00181684362f,
+    -0.00179009504f, -0.00176328683f, -0.00173642002f, -0.00170949564f,
+    -0.00168251471f, -0.00165547828f, -0.00162838738f, -0.00160124304f,
+    -0.00157404631f, -0.00154679821f, -0.0015194998f, -0.00149215212f,
+    -0.00146475621f, -0.00143731312f, -0.00140982389f, -0.00138228957f,
+    -0.00135471123f, -0.0013270899f, -0.00129942664f, -0.0012717225f,
+    -0.00124397855f, -0.00121619583f, -0.00118837541f, -0.00116051834f,
+    -0.00113262569f, -0.00110469851f, -0.00107673788f, -0.00104874484f,
+    -0.00102072047f, -0.000992665837f, -0.000964581996f, -0.000936470018f,
+    -0.000908330971f, -0.000880165923f, -0.000851975943f, -0.000823762099f,
+    -0.000795525462f, -0.000767267103f, -0.000738988092f, -0.000710689501f,
+    -0.000682372402f, -0.000654037867f, -0.000625686969f, -0.000597320781f,
+    -0.000568940375f, -0.000540546826f, -0.000512141206f, -0.00048372459f,
+    -0.000455298052f, -0.000426862665f, -0.000398419504f, -0.000369969641f,
+    -0.000341514152f, -0.000313054109f, -0.000284590587f, -0.000256124659f,
+    -0.000227657398f, -0.000199189877f, -0.000170723168f, -0.000142258344f,
+    -0.000113796478f, -8.53386388e-05f, -5.68858994e-05f, -2.84393298e-05f,
+    1.36322175e-17f, 2.84310207e-05f, 5.68526636e-05f, 8.52638604e-05f,
+    0.000113663544f, 0.000142050647f, 0.000170424105f, 0.000198782852f,
+    0.000227125824f, 0.000255451957f, 0.00028376019f, 0.000312049461f,
+    0.00034031871f, 0.000368566878f, 0.000396792906f, 0.000424995737f,
+    0.000453174316f, 0.000481327588f, 0.000509454499f, 0.000537553999f,
+    0.000565625035f, 0.000593666559f, 0.000621677524f, 0.000649656881f,
+    0.000677603587f, 0.000705516598f, 0.000733394872f, 0.00076123737f,
+    0.000789043052f, 0.000816810882f, 0.000844539824f, 0.000872228845f,
+    0.000899876915f, 0.000927483002f, 0.000955046079f, 0.00098256512f,
+    0.0010100391f, 0.001037467f, 0.0010648478f, 0.00109218048f,
+    0.00111946402f, 0.00114669742f, 0.00117387965f, 0.00120100972f,
+    0.00122808661f, 0.00125510931f, 0.00128207684f, 0.00130898818f,
+    0.00133584234f, 0.00136263833f, 0.00138937515f, 0.00141605181f,
+    0.00144266732f, 0.0014692207f, 0.00149571097f, 0.00152213715f,
+    0.00154849826f, 0.00157479332f, 0.00160102137f, 0.00162718144f,
+    0.00165327256f, 0.00167929376f, 0.0017052441f, 0.0017311226f,
+    0.00175692832f, 0.00178266031f, 0.00180831762f, 0.00183389929f,
+    0.0018594044f, 0.00188483201f, 0.00191018117f, 0.00193545096f,
+    0.00196064044f, 0.00198574869f, 0.0020107748f, 0.00203571783f,
+    0.00206057688f, 0.00208535103f, 0.00211003937f, 0.00213464101f,
+    0.00215915503f, 0.00218358054f, 0.00220791664f, 0.00223216245f,
+    0.00225631708f, 0.00228037964f, 0.00230434926f, 0.00232822505f,
+    0.00235200615f, 0.00237569169f, 0.00239928081f, 0.00242277263f,
+    0.00244616631f, 0.002469461f, 0.00249265584f, 0.00251574999f,
+    0.00253874261f, 0.00256163287f, 0.00258441992f, 0.00260710295f,
+    0.00262968113f, 0.00265215363f, 0.00267451965f, 0.00269677837f,
+    0.00271892898f, 0.00274097069f, 0.00276290268f, 0.00278472418f,
+    0.00280643438f, 0.00282803251f, 0.00284951777f, 0.00287088941f,
+    0.00289214664f, 0.00291328869f, 0.00293431481f, 0.00295522424f,
+    0.00297601621f, 0.00299668999f, 0.00301724483f, 0.00303767998f,
+    0.00305799472f, 0.00307818832f, 0.00309826004f, 0.00311820917f,
+    0.003138035f, 0.0031577368f, 0.00317731388f, 0.00319676554f,
+    0.00321609107f, 0.0032352898f, 0.00325436102f, 0.00327330406f,
+    0.00329211825f, 0.00331080291f, 0.00332935737f, 0.00334778099f,
+    0.00336607309f, 0.00338423303f, 0.00340226017f, 0.00342015386f,
+    0.00343791346f, 0.00345553836f, 0.00347302792f, 0.00349038153f,
+    0.00350759856f, 0.00352467842f, 0.0035416205f, 0.0035584242f,
+    0.00357508893f, 0.0035916141f, 0.00360799913f, 0.00362424344f,
+    0.00364034647f, 0.00365630764f, 0.0036721264f, 0.00368780219f,
+    0.00370333447f, 0.00371872269f, 0.00373396632f, 0.00374906482f,
+    0.00376401766f, 0.00377882433f, 0.00379348431f, 0.00380799709f,
+    0.00382236216f, 0.00383657904f, 0.00385064723f, 0.00386456623f,
+    0.00387833558f, 0.00389195479f, 0.00390542339f, 0.00391874093f,
+    0.00393190695f, 0.00394492099f, 0.00395778261f, 0.00397049136f,
+    0.00398304682f, 0.00399544856f, 0.00400769615f, 0.00401978918f,
+    0.00403172723f, 0.00404350991f, 0.00405513682f, 0.00406660756f,
+    0.00407792174f, 0.00408907899f, 0.00410007893f, 0.0041109212f,
+    0.00412160542f, 0.00413213126f, 0.00414249834f, 0.00415270634f,
+    0.00416275491f, 0.00417264372f, 0.00418237245f, 0.00419194077f,
+    0.00420134838f, 0.00421059496f, 0.00421968022f, 0.00422860385f,
+    0.00423736558f, 0.00424596511f, 0.00425440218f, 0.0042626765f,
+    0.00427078783f, 0.00427873589f, 0.00428652044f, 0.00429414124f,
+    0.00430159804f, 0.00430889061f, 0.00431601872f, 0.00432298216f,
+    0.00432978071f, 0.00433641416f, 0.00434288231f, 0.00434918497f,
+    0.00435532195f, 0.00436129306f, 0.00436709813f, 0.00437273699f,
+    0.00437820947f, 0.00438351542f, 0.00438865469f, 0.00439362713f,
+    0.0043984326f, 0.00440307097f, 0.00440754212f, 0.00441184593f,
+    0.00441598228f, 0.00441995106f, 0.00442375219f, 0.00442738555f,
+    0.00443085107f, 0.00443414867f, 0.00443727826f, 0.00444023979f,
+    0.00444303318f, 0.00444565838f, 0.00444811535f, 0.00445040404f,
+    0.00445252441f, 0.00445447643f, 0.00445626009f, 0.00445787535f,
+    0.00445932221f, 0.00446060067f, 0.00446171072f, 0.00446265238f,
+    0.00446342565f, 0.00446403056f, 0.00446446714f, 0.00446473541f,
+    0.00446483542f, 0.00446476722f, 0.00446453085f, 0.00446412637f,
+    0.00446355385f, 0.00446281336f, 0.00446190497f, 0.00446082877f,
+    0.00445958486f, 0.00445817332f, 0.00445659426f, 0.00445484778f,
+    0.00445293401f, 0.00445085306f, 0.00444860506f, 0.00444619015f,
+    0.00444360846f, 0.00444086014f, 0.00443794535f, 0.00443486424f,
+    0.00443161697f, 0.00442820373f, 0.00442462468f, 0.00442088001f,
+    0.00441696991f, 0.00441289458f, 0.00440865421f, 0.00440424903f,
+    0.00439967923f, 0.00439494504f, 0.00439004669f, 0.00438498441f,
+    0.00437975845f, 0.00437436903f, 0.00436881643f, 0.00436310088f,
+    0.00435722267f, 0.00435118205f, 0.0043449793f, 0.0043386147f,
+    0.00433208855f, 0.00432540112f, 0.00431855273f, 0.00431154368f,
+    0.00430437428f, 0.00429704485f, 0.00428955571f, 0.00428190718f,
+    0.00427409962f, 0.00426613334f, 0.00425800871f, 0.00424972608f,
+    0.0042412858f, 0.00423268824f, 0.00422393376f, 0.00421502276f,
+    0.00420595559f, 0.00419673267f, 0.00418735437f, 0.00417782109f,
+    0.00416813325f, 0.00415829125f, 0.00414829551f, 0.00413814645f,
+    0.0041278445f, 0.00411739009f, 0.00410678365f, 0.00409602564f,
+    0.00408511651f, 0.00407405671f, 0.00406284669f, 0.00405148693f,
+    0.00403997791f, 0.00402832009f, 0.00401651396f, 0.00400456001f,
+    0.00399245873f, 0.00398021062f, 0.00396781619f, 0.00395527595f,
+    0.00394259041f, 0.00392976009f, 0.00391678552f, 0.00390366723f,
+    0.00389040576f, 0.00387700165f, 0.00386345544f, 0.00384976769f,
+    0.00383593896f, 0.00382196981f, 0.0038078608f, 0.00379361251f,
+    0.00377922552f, 0.0037647004f, 0.00375003776f, 0.00373523817f,
+    0.00372030225f, 0.00370523058f, 0.00369002379f, 0.00367468248f,
+    0.00365920726f, 0.00364359877f, 0.00362785763f, 0.00361198447f,
+    0.00359597994f, 0.00357984466f, 0.00356357929f, 0.00354718447f,
+    0.00353066088f, 0.00351400915f, 0.00349722997f, 0.003480324f,
+    0.00346329191f, 0.00344613438f, 0.0034288521f, 0.00341144576f,
+    0.00339391604f, 0.00337626365f, 0.00335848928f, 0.00334059364f,
+    0.00332257744f, 0.0033044414f, 0.00328618623f, 0.00326781266f,
+    0.00324932142f, 0.00323071322f, 0.00321198882f, 0.00319314895f,
+    0.00317419436f, 0.00315512579f, 0.00313594399f, 0.00311664973f,
+    0.00309724375f, 0.00307772683f, 0.00305809974f, 0.00303836324f,
+    0.00301851811f, 0.00299856513f, 0.00297850509f, 0.00295833876f,
+    0.00293806696f, 0.00291769046f, 0.00289721006f, 0.00287662658f,
+    0.00285594081f, 0.00283515357f, 0.00281426566f, 0.00279327791f,
+    0.00277219114f, 0.00275100616f, 0.00272972381f, 0.00270834491f,
+    0.00268687031f, 0.00266530083f, 0.00264363732f, 0.00262188063f,
+    0.00260003159f, 0.00257809107f, 0.0025560599f, 0.00253393896f,
+    0.0025117291f, 0.00248943119f, 0.00246704608f, 0.00244457465f,
+    0.00242201778f, 0.00239937633f, 0.00237665118f, 0.00235384322f,
+    0.00233095334f, 0.0023079824f, 0.00228493131f, 0.00226180096f,
+    0.00223859224f, 0.00221530605f, 0.0021919433f, 0.00216850487f,
+    0.00214499168f, 0.00212140464f, 0.00209774466f, 0.00207401265f,
+    0.00205020952f, 0.0020263362f, 0.0020023936f, 0.00197838265f,
+    0.00195430427f, 0.00193015938f, 0.00190594893f, 0.00188167383f,
+    0.00185733503f, 0.00183293345f, 0.00180847004f, 0.00178394574f,
+    0.00175936149f, 0.00173471823f, 0.00171001691f, 0.00168525848f,
+    0.00166044388f, 0.00163557407f, 0.00161065001f, 0.00158567264f,
+    0.00156064292f, 0.00153556181f, 0.00151043028f, 0.00148524928f,
+    0.00146001977f, 0.00143474273f, 0.00140941912f, 0.00138404991f,
+    0.00135863606f, 0.00133317854f, 0.00130767834f, 0.00128213642f,
+    0.00125655375f, 0.00123093132f, 0.0012052701f, 0.00117957106f,
+    0.0011538352f, 0.00112806348f, 0.00110225689f, 0.00107641641f,
+    0.00105054304f, 0.00102463774f, 0.000998701504f, 0.000972735325f,
+    0.000946740185f, 0.000920717074f, 0.000894666979f, 0.00086859089f,
+    0.000842489798f, 0.000816364693f, 0.000790216566f, 0.00076404641f,
+    0.000737855218f, 0.000711643981f, 0.000685413695f, 0.000659165352f,
+    0.000632899948f, 0.000606618476f, 0.000580321932f, 0.000554011311f,
+    0.000527687608f, 0.000501351819f, 0.000475004941f, 0.000448647969f,
+    0.000422281898f, 0.000395907726f, 0.000369526449f, 0.000343139061f,
+    0.000316746561f, 0.000290349942f, 0.000263950202f, 0.000237548336f,
+    0.000211145339f, 0.000184742206f, 0.000158339932f, 0.000131939512f,
+    0.00010554194f, 7.914821e-05f, 5.27593147e-05f, 2.63762472e-05f,
+    3.36923197e-17f, -2.63684353e-05f, -5.27280674e-05f, -7.90779057e-05f,
+    -0.00010541696f, -0.000131744242f, -0.000158058763f, -0.000184359534f,
+    -0.00021064557f, -0.000236915883f, -0.000263169489f, -0.000289405404f,
+    -0.000315622645f, -0.000341820228f, -0.000367997173f, -0.0003941525f,
+    -0.00042028523f, -0.000446394384f, -0.000472478985f, -0.00049853806f,
+    -0.000524570632f, -0.000550575729f, -0.000576552379f, -0.000602499613f,
+    -0.00062841646f, -0.000654301955f, -0.000680155129f, -0.00070597502f,
+    -0.000731760664f, -0.000757511099f, -0.000783225366f, -0.000808902507f,
+    -0.000834541566f, -0.000860141586f, -0.000885701616f, -0.000911220705f,
+    -0.000936697902f, -0.000962132261f, -0.000987522836f, -0.00101286868f,
+    -0.00103816886f, -0.00106342243f, -0.00108862845f, -0.00111378599f,
+    -0.00113889411f, -0.00116395188f, -0.00118895838f, -0.00121391267f,
+    -0.00123881384f, -0.00126366095f, -0.00128845309f, -0.00131318935f,
+    -0.0013378688f, -0.00136249053f, -0.00138705363f, -0.0014115572f,
+    -0.00143600033f, -0.00146038211f, -0.00148470164f, -0.00150895804f,
+    -0.00153315039f, -0.00155727782f, -0.00158133942f, -0.00160533431f,
+    -0.00162926162f, -0.00165312045f, -0.00167690992f, -0.00170062917f,
+    -0.00172427732f, -0.0017478535f, -0.00177135684f, -0.00179478648f,
+    -0.00181814155f, -0.00184142121f, -0.00186462459f, -0.00188775084f,
+    -0.00191079912f, -0.00193376858f, -0.00195665837f, -0.00197946766f,
+    -0.00200219562f, -0.00202484141f, -0.0020474042f, -0.00206988316f,
+    -0.00209227748f, -0.00211458634f, -0.00213680891f, -0.0021589444f,
+    -0.00218099198f, -0.00220295086f, -0.00222482024f, -0.00224659931f,
+    -0.00226828729f, -0.00228988338f, -0.0023113868f, -0.00233279676f,
+    -0.00235411249f, -0.00237533321f, -0.00239645815f, -0.00241748653f,
+    -0.00243841761f, -0.00245925062f, -0.00247998479f, -0.00250061939f,
+    -0.00252115366f, -0.00254158686f, -0.00256191825f, -0.00258214709f,
+    -0.00260227265f, -0.00262229421f, -0.00264221103f, -0.00266202241f,
+    -0.00268172762f, -0.00270132595f, -0.00272081671f, -0.00274019918f,
+    -0.00275947267f, -0.00277863648f, -0.00279768992f, -0.00281663231f,
+    -0.00283546298f, -0.00285418123f, -0.00287278641f, -0.00289127783f,
+    -0.00290965485f, -0.0029279168f, -0.00294606302f, -0.00296409288f,
+    -0.00298200571f, -0.00299980089f, -0.00301747778f, -0.00303503574f,
+    -0.00305247416f, -0.0030697924f, -0.00308698986f, -0.00310406592f,
+    -0.00312101996f, -0.0031378514f, -0.00315455964f, -0.00317114407f,
+    -0.00318760411f, -0.00320393918f, -0.00322014871f, -0.0032362321f,
+    -0.00325218881f, -0.00326801826f, -0.0032837199f, -0.00329929317f,
+    -0.00331473752f, -0.00333005241f, -0.00334523731f, -0.00336029167f,
+    -0.00337521498f, -0.00339000669f, -0.00340466631f, -0.00341919331f,
+    -0.00343358719f, -0.00344784745f, -0.00346197358f, -0.00347596509f,
+    -0.00348982151f, -0.00350354234f, -0.0035171271f, -0.00353057534f,
+    -0.00354388658f, -0.00355706035f, -0.00357009621f, -0.00358299371f,
+    -0.0035957524f, -0.00360837184f, -0.00362085159f, -0.00363319123f,
+    -0.00364539034f, -0.00365744849f, -0.00366936528f, -0.0036811403f,
+    -0.00369277314f, -0.00370426341f, -0.00371561073f, -0.00372681469f,
+    -0.00373787493f, -0.00374879108f, -0.00375956275f, -0.0037701896f,
+    -0.00378067126f, -0.00379100738f, -0.00380119761f, -0.00381124162f,
+    -0.00382113907f, -0.00383088962f, -0.00384049297f, -0.00384994878f,
+    -0.00385925675f, -0.00386841656f, -0.00387742793f, -0.00388629055f,
+    -0.00389500413f, -0.00390356839f, -0.00391198305f, -0.00392024784f,
+    -0.00392836249f, -0.00393632675f, -0.00394414035f, -0.00395180304f,
+    -0.00395931459f, -0.00396667475f, -0.00397388329f, -0.00398093999f,
+    -0.00398784462f, -0.00399459697f, -0.00400119684f, -0.00400764401f,
+    -0.00401393829f, -0.00402007949f, -0.00402606742f, -0.00403190191f,
+    -0.00403758277f, -0.00404310985f, -0.00404848297f, -0.00405370198f,
+    -0.00405876674f, -0.00406367709f, -0.00406843289f, -0.00407303402f,
+    -0.00407748035f, -0.00408177175f, -0.00408590811f, -0.00408988933f,
+    -0.00409371528f, -0.00409738589f, -0.00410090105f, -0.00410426068f,
+    -0.0041074647f, -0.00411051304f, -0.00411340562f, -0.00411614239f,
+    -0.00411872328f, -0.00412114826f, -0.00412341726f, -0.00412553026f,
+    -0.00412748722f, -0.00412928811f, -0.00413093291f, -0.00413242161f,
+    -0.00413375419f, -0.00413493066f, -0.00413595101f, -0.00413681525f,
+    -0.0041375234f, -0.00413807548f, -0.00413847151f, -0.00413871153f,
+    -0.00413879557f, -0.00413872367f, -0.00413849589f, -0.00413811227f,
+    -0.00413757289f, -0.0041368778f, -0.00413602709f, -0.00413502082f,
+    -0.00413385908f, -0.00413254197f, -0.00413106958f, -0.004129442f,
+    -0.00412765936f, -0.00412572175f, -0.00412362931f, -0.00412138215f,
+    -0.00411898041f, -0.00411642422f, -0.00411371373f, -0.00411084908f,
+    -0.00410783043f, -0.00410465793f, -0.00410133176f, -0.00409785209f,
+    -0.00409421908f, -0.00409043293f, -0.00408649382f, -0.00408240195f,
+    -0.00407815751f, -0.00407376071f, -0.00406921177f, -0.00406451089f,
+    -0.00405965831f, -0.00405465424f, -0.00404949893f, -0.00404419262f,
+    -0.00403873554f, -0.00403312795f, -0.0040273701f, -0.00402146226f,
+    -0.0040154047f, -0.00400919768f, -0.00400284149f, -0.0039963364f,
+    -0.00398968272f, -0.00398288073f, -0.00397593074f, -0.00396883304f,
+    -0.00396158796f, -0.00395419581f, -0.00394665691f, -0.00393897159f,
+    -0.00393114018f, -0.00392316302f, -0.00391504046f, -0.00390677285f,
+    -0.00389836053f, -0.00388980388f, -0.00388110325f, -0.00387225902f,
+    -0.00386327156f, -0.00385414126f, -0.00384486849f, -0.00383545366f,
+    -0.00382589716f, -0.00381619939f, -0.00380636077f, -0.00379638169f,
+    -0.00378626259f, -0.00377600388f, -0.00376560599f, -0.00375506936f,
+    -0.00374439442f, -0.00373358162f, -0.0037226314f, -0.00371154423f,
+    -0.00370032055f, -0.00368896084f, -0.00367746556f, -0.00366583518f,
+    -0.00365407019f, -0.00364217106f, -0.00363013829f, -0.00361797236f,
+    -0.00360567378f, -0.00359324306f, -0.00358068069f, -0.00356798719f,
+    -0.00355516308f, -0.00354220888f, -0.00352912511f, -0.00351591232f,
+    -0.00350257103f, -0.00348910179f, -0.00347550513f, -0.00346178163f,
+    -0.00344793182f, -0.00343395626f, -0.00341985553f, -0.00340563019f,
+    -0.00339128081f, -0.00337680797f, -0.00336221226f, -0.00334749426f,
+    -0.00333265455f, -0.00331769375f, -0.00330261244f, -0.00328741123f,
+    -0.00327209073f, -0.00325665156f, -0.00324109432f, -0.00322541965f,
+    -0.00320962816f, -0.0031937205f, -0.00317769728f, -0.00316155915f,
+    -0.00314530675f, -0.00312894074f, -0.00311246175f, -0.00309587044f,
+    -0.00307916748f, -0.00306235353f, -0.00304542924f, -0.0030283953f,
+    -0.00301125238f, -0.00299400115f, -0.0029766423f, -0.00295917652f,
+    -0.00294160449f, -0.00292392691f, -0.00290614448f, -0.0028882579f,
+    -0.00287026786f, -0.00285217509f, -0.0028339803f, -0.00281568419f,
+    -0.0027972875f, -0.00277879094f, -0.00276019524f, -0.00274150113f,
+    -0.00272270935f, -0.00270382062f, -0.0026848357f, -0.00266575533f,
+    -0.00264658025f, -0.00262731122f, -0.00260794898f, -0.0025884943f,
+    -0.00256894794f, -0.00254931066f, -0.00252958323f, -0.00250976642f,
+    -0.00248986101f, -0.00246986776f, -0.00244978746f, -0.00242962089f,
+    -0.00240936883f, -0.00238903209f, -0.00236861144f, -0.00234810768f,
+    -0.00232752161f, -0.00230685403f, -0.00228610575f, -0.00226527756f,
+    -0.00224437028f, -0.00222338472f, -0.0022023217f, -0.00218118202f,
+    -0.00215996652f, -0.002138676f, -0.0021173113f, -0.00209587325f,
+    -0.00207436267f, -0.00205278039f, -0.00203112726f, -0.0020094041f,
+    -0.00198761176f, -0.00196575108f, -0.0019438229f, -0.00192182807f,
+    -0.00189976744f, -0.00187764186f, -0.00185545218f, -0.00183319926f,
+    -0.00181088395f, -0.00178850712f, -0.00176606962f, -0.00174357233f,
+    -0.0017210161f, -0.0016984018f, -0.00167573031f, -0.00165300249f,
+    -0.00163021921f, -0.00160738136f, -0.00158448981f, -0.00156154544f,
+    -0.00153854912f, -0.00151550175f, -0.00149240419f, -0.00146925735f,
+    -0.00144606211f, -0.00142281935f, -0.00139952996f, -0.00137619484f,
+    -0.00135281488f, -0.00132939098f, -0.00130592402f, -0.00128241491f,
+    -0.00125886454f, -0.00123527382f, -0.00121164365f, -0.00118797492f,
+    -0.00116426855f, -0.00114052543f, -0.00111674647f, -0.00109293259f,
+    -0.00106908467f, -0.00104520365f, -0.00102129041f, -0.000997345887f,
+    -0.000973370977f, -0.000949366597f, -0.000925333659f, -0.000901273079f,
+    -0.000877185771f, -0.00085307265f, -0.000828934632f, -0.000804772636f,
+    -0.000780587578f, -0.000756380377f, -0.000732151951f, -0.00070790322f,
+    -0.000683635103f, -0.000659348521f, -0.000635044395f, -0.000610723644f,
+    -0.000586387192f, -0.000562035959f, -0.000537670868f, -0.00051329284f,
+    -0.000488902798f, -0.000464501665f, -0.000440090364f, -0.000415669817f,
+    -0.000391240948f, -0.000366804678f, -0.000342361932f, -0.000317913632f,
+    -0.000293460701f, -0.000269004062f, -0.000244544638f, -0.00022008335f,
+    -0.000195621122f, -0.000171158875f, -0.00014669753f, -0.000122238011f,
+    -9.77812361e-05f, -7.33281277e-05f, -4.88796058e-05f, -2.44365901e-05f,
+    -1.7555431e-17f, 2.44292457e-05f, 4.88502286e-05f, 7.32620311e-05f,
+    9.76637362e-05f, 0.000122054427f, 0.000146433189f, 0.000170799106f,
+    0.000195151264f, 0.00021948875f, 0.000243810651f, 0.000268116055f,
+    0.000292404051f, 0.000316673731f, 0.000340924183f, 0.000365154502f,
+    0.000389363779f, 0.000413551108f, 0.000437715586f, 0.000461856308f,
+    0.000485972372f, 0.000510062877f, 0.000534126922f, 0.000558163609f,
+    0.00058217204f, 0.000606151319f, 0.000630100552f, 0.000654018845f,
+    0.000677905306f, 0.000701759045f, 0.000725579172f, 0.000749364801f,
+    0.000773115045f, 0.00079682902f, 0.000820505844f, 0.000844144636f,
+    0.000867744515f, 0.000891304606f, 0.000914824031f, 0.000938301917f,
+    0.000961737393f, 0.000985129586f, 0.00100847763f, 0.00103178066f,
+    0.00105503781f, 0.00107824821f, 0.00110141101f, 0.00112452535f,
+    0.00114759037f, 0.00117060521f, 0.00119356903f, 0.00121648098f,
+    0.0012393402f, 0.00126214586f, 0.0012848971f, 0.00130759309f,
+    0.001330233f, 0.00135281597f, 0.00137534119f, 0.00139780781f,
+    0.00142021501f, 0.00144256196f, 0.00146484784f, 0.00148707183f,
+    0.00150923311f, 0.00153133086f, 0.00155336427f, 0.00157533253f,
+    0.00159723483f, 0.00161907036f, 0.00164083833f, 0.00166253793f,
+    0.00168416836f, 0.00170572883f, 0.00172721855f, 0.00174863674f,
+    0.00176998259f, 0.00179125535f, 0.00181245421f, 0.00183357841f,
+    0.00185462718f, 0.00187559974f, 0.00189649532f, 0.00191731317f,
+    0.00193805252f, 0.00195871261f, 0.00197929269f, 0.001999792f,
+    0.0020202098f, 0.00204054535f, 0.0020607979f, 0.00208096672f,
+    0.00210105106f, 0.00212105021f, 0.00214096342f, 0.00216078998f,
+    0.00218052916f, 0.00220018026f, 0.00221974254f, 0.00223921531f,
+    0.00225859786f, 0.00227788948f, 0.00229708947f, 0.00231619714f,
+    0.0023352118f, 0.00235413276f, 0.00237295933f, 0.00239169083f,
+    0.00241032658f, 0.00242886592f, 0.00244730817f, 0.00246565267f,
+    0.00248389875f, 0.00250204575f, 0.00252009303f, 0.00253803994f,
+    0.00255588582f, 0.00257363003f, 0.00259127194f, 0.00260881092f,
+    0.00262624632f, 0.00264357754f, 0.00266080394f, 0.00267792491f,
+    0.00269493984f, 0.00271184811f, 0.00272864912f, 0.00274534227f,
+    0.00276192697f, 0.00277840262f, 0.00279476863f, 0.00281102442f,
+    0.00282716941f, 0.00284320303f, 0.00285912471f, 0.00287493387f,
+    0.00289062996f, 0.00290621242f, 0.0029216807f, 0.00293703425f,
+    0.00295227252f, 0.00296739498f, 0.00298240109f, 0.00299729032f,
+    0.00301206215f, 0.00302671604f, 0.0030412515f, 0.003055668f,
+    0.00306996504f, 0.00308414211f, 0.00309819872f, 0.00311213437f,
+    0.00312594858f, 0.00313964086f, 0.00315321073f, 0.00316665772f,
+    0.00317998136f, 0.00319318118f, 0.00320625673f, 0.00321920754f,
+    0.00323203317f, 0.00324473318f, 0.00325730711f, 0.00326975454f,
+    0.00328207504f, 0.00329426818f, 0.00330633353f, 0.00331827069f,
+    0.00333007924f, 0.00334175877f, 0.00335330889f, 0.0033647292f,
+    0.0033760193f, 0.00338717882f, 0.00339820736f, 0.00340910456f,
+    0.00341987004f, 0.00343050343f, 0.00344100439f, 0.00345137254f,
+    0.00346160754f, 0.00347170905f, 0.00348167672f, 0.00349151022f,
+    0.00350120922f, 0.0035107734f, 0.00352020243f, 0.003529496f,
+    0.0035386538f, 0.00354767552f, 0.00355656088f, 0.00356530957f,
+    0.00357392131f, 0.0035823958f, 0.00359073279f, 0.00359893198f,
+    0.00360699313f, 0.00361491595f, 0.0036227002f, 0.00363034563f,
+    0.00363785198f, 0.00364521903f, 0.00365244652f, 0.00365953424f,
+    0.00366648196f, 0.00367328946f, 0.00367995652f, 0.00368648293f,
+    0.0036928685f, 0.00369911302f, 0.0037052163f, 0.00371117816f,
+    0.0037169984f, 0.00372267687f, 0.00372821338f, 0.00373360777f,
+    0.00373885987f, 0.00374396954f, 0.00374893663f, 0.00375376098f,
+    0.00375844247f, 0.00376298095f, 0.00376737631f, 0.00377162841f,
+    0.00377573715f, 0.00377970241f, 0.00378352408f, 0.00378720206f,
+    0.00379073626f, 0.00379412659f, 0.00379737297f, 0.00380047531f,
+    0.00380343354f, 0.0038062476f, 0.00380891742f, 0.00381144295f,
+    0.00381382413f, 0.00381606091f, 0.00381815327f, 0.00382010116f,
+    0.00382190454f, 0.00382356341f, 0.00382507774f, 0.00382644751f,
+    0.00382767272f, 0.00382875337f, 0.00382968945f, 0.00383048098f,
+    0.00383112798f, 0.00383163045f, 0.00383198843f, 0.00383220194f,
+    0.00383227103f, 0.00383219573f, 0.00383197609f, 0.00383161216f,
+    0.00383110399f, 0.00383045166f, 0.00382965523f, 0.00382871477f,
+    0.00382763037f, 0.0038264021f, 0.00382503005f, 0.00382351433f,
+    0.00382185503f, 0.00382005226f, 0.00381810613f, 0.00381601676f,
+    0.00381378426f, 0.00381140877f, 0.00380889042f, 0.00380622935f,
+    0.00380342569f, 0.00380047961f, 0.00379739125f, 0.00379416078f,
+    0.00379078835f, 0.00378727414f, 0.00378361832f, 0.00377982108f,
+    0.00377588259f, 0.00377180306f, 0.00376758268f, 0.00376322164f,
+    0.00375872016f, 0.00375407845f, 0.00374929673f, 0.00374437521f,
+    0.00373931413f, 0.00373411372f, 0.00372877422f, 0.00372329587f,
+    0.00371767892f, 0.00371192362f, 0.00370603023f, 0.00369999902f,
+    0.00369383025f, 0.00368752421f, 0.00368108116f, 0.00367450139f,
+    0.00366778519f, 0.00366093287f, 0.0036539447f, 0.00364682101f,
+    0.0036395621f, 0.00363216828f, 0.00362463988f, 0.00361697721f,
+    0.00360918061f, 0.00360125042f, 0.00359318696f, 0.0035849906f,
+    0.00357666166f, 0.00356820052f, 0.00355960752f, 0.00355088304f,
+    0.00354202744f, 0.00353304109f, 0.00352392437f, 0.00351467767f,
+    0.00350530137f, 0.00349579587f, 0.00348616156f, 0.00347639884f,
+    0.00346650813f, 0.00345648983f, 0.00344634436f, 0.00343607214f,
+    0.0034256736f, 0.00341514916f, 0.00340449927f, 0.00339372435f,
+    0.00338282486f, 0.00337180125f, 0.00336065396f, 0.00334938345f,
+    0.00333799019f, 0.00332647464f, 0.00331483727f, 0.00330307856f,
+    0.003291199f, 0.00327919905f, 0.00326707922f, 0.00325483999f,
+    0.00324248186f, 0.00323000534f, 0.00321741093f, 0.00320469913f,
+    0.00319187048f, 0.00317892547f, 0.00316586465f, 0.00315268853f,
+    0.00313939764f, 0.00312599253f, 0.00311247373f, 0.00309884178f,
+    0.00308509724f, 0.00307124065f, 0.00305727257f, 0.00304319357f,
+    0.0030290042f, 0.00301470503f, 0.00300029665f, 0.00298577961f,
+    0.00297115451f, 0.00295642192f, 0.00294158244f, 0.00292663665f,
+    0.00291158516f, 0.00289642855f, 0.00288116744f, 0.00286580243f,
+    0.00285033413f, 0.00283476316f, 0.00281909013f, 0.00280331566f,
+    0.00278744038f, 0.00277146493f, 0.00275538992f, 0.002739216f,
+    0.00272294381f, 0.00270657399f, 0.00269010718f, 0.00267354404f,
+    0.00265688522f, 0.00264013138f, 0.00262328317f, 0.00260634126f,
+    0.00258930632f, 0.00257217902f, 0.00255496003f, 0.00253765003f,
+    0.00252024969f, 0.0025027597f, 0.00248518075f, 0.00246751353f,
+    0.00244975872f, 0.00243191703f, 0.00241398916f, 0.00239597579f,
+    0.00237787765f, 0.00235969544f, 0.00234142986f, 0.00232308164f,
+    0.00230465148f, 0.00228614011f, 0.00226754825f, 0.00224887662f,
+    0.00223012596f, 0.00221129699f, 0.00219239045f, 0.00217340707f,
+    0.0021543476f, 0.00213521276f, 0.00211600331f, 0.00209672f,
+    0.00207736356f, 0.00205793477f, 0.00203843435f, 0.00201886309f,
+    0.00199922173f, 0.00197951103f, 0.00195973176f, 0.00193988469f,
+    0.00191997058f, 0.0018999902f, 0.00187994433f, 0.00185983375f,
+    0.00183965922f, 0.00181942154f, 0.00179912147f, 0.00177875981f,
+    0.00175833735f, 0.00173785486f, 0.00171731314f, 0.00169671299f,
+    0.00167605519f, 0.00165534054f, 0.00163456984f, 0.00161374389f,
+    0.00159286349f, 0.00157192945f, 0.00155094257f, 0.00152990365f,
+    0.00150881351f, 0.00148767295f, 0.00146648279f, 0.00144524384f,
+    0.00142395692f, 0.00140262284f, 0.00138124242f, 0.00135981648f,
+    0.00133834584f, 0.00131683133f, 0.00129527376f, 0.00127367397f,
+    0.00125203279f, 0.00123035103f, 0.00120862952f, 0.00118686911f,
+    0.00116507062f, 0.00114323488f, 0.00112136273f, 0.00109945501f,
+    0.00107751254f, 0.00105553617f, 0.00103352673f, 0.00101148507f,
+    0.000989412027f, 0.000967308438f, 0.000945175148f, 0.000923012999f,
+    0.000900822836f, 0.000878605504f, 0.000856361847f, 0.000834092712f,
+    0.000811798945f, 0.000789481395f, 0.00076714091f, 0.000744778338f,
+    0.000722394529f, 0.000699990333f, 0.0006775666f, 0.000655124181f,
+    0.000632663927f, 0.000610186691f, 0.000587693324f, 0.000565184678f,
+    0.000542661608f, 0.000520124965f, 0.000497575603f, 0.000475014376f,
+    0.000452442137f, 0.000429859741f, 0.000407268041f, 0.000384667891f,
+    0.000362060146f, 0.00033944566f, 0.000316825287f, 0.000294199882f,
+    0.000271570297f, 0.000248937388f, 0.000226302008f, 0.000203665011f,
+    0.000181027251f, 0.000158389579f, 0.000135752851f, 0.000113117918f,
+    9.04856321e-05f, 6.78568461e-05f, 4.52324114e-05f, 2.26131791e-05f,
+    3.60553617e-18f, -2.26062756e-05f, -4.52047981e-05f, -6.77947183e-05f,
+    -9.03751875e-05f, -0.000112945358f, -0.000135504382f, -0.000158051413f,
+    -0.000180585605f, -0.000203106114f, -0.000225612094f, -0.000248102701f,
+    -0.000270577094f, -0.00029303443f, -0.000315473869f, -0.000337894569f,
+    -0.000360295693f, -0.000382676401f, -0.000405035857f, -0.000427373225f,
+    -0.000449687669f, -0.000471978357f, -0.000494244455f, -0.000516485131f,
+    -0.000538699556f, -0.0005608869f, -0.000583046336f, -0.000605177037f,
+    -0.000627278178f, -0.000649348936f, -0.000671388487f, -0.000693396011f,
+    -0.000715370688f, -0.000737311701f, -0.000759218233f, -0.000781089468f,
+    -0.000802924595f, -0.0008247228f, -0.000846483274f, -0.000868205208f,
+    -0.000889887796f, -0.000911530233f, -0.000933131715f, -0.00095469144f,
+    -0.000976208611f, -0.000997682427f, -0.00101911209f, -0.00104049682f,
+    -0.00106183581f, -0.00108312827f, -0.00110437342f, -0.00112557047f,
+    -0.00114671863f, -0.00116781713f, -0.00118886518f, -0.00120986201f,
+    -0.00123080684f, -0.0012516989f, -0.00127253742f, -0.00129332162f,
+    -0.00131405075f, -0.00133472403f, -0.00135534071f, -0.00137590002f,
+    -0.00139640121f, -0.00141684352f, -0.00143722621f, -0.00145754852f,
+    -0.0014778097f, -0.00149800901f, -0.00151814571f, -0.00153821905f,
+    -0.00155822831f, -0.00157817274f, -0.00159805162f, -0.00161786421f,
+    -0.00163760979f, -0.00165728764f, -0.00167689703f, -0.00169643725f,
+    -0.00171590758f, -0.00173530731f, -0.00175463573f, -0.00177389213f,
+    -0.00179307581f, -0.00181218608f, -0.00183122222f, -0.00185018355f,
+    -0.00186906938f, -0.00188787901f, -0.00190661177f, -0.00192526696f,
+    -0.00194384392f, -0.00196234195f, -0.0019807604f, -0.00199909859f,
+    -0.00201735586f, -0.00203553154f, -0.00205362497f, -0.00207163549f,
+    -0.00208956246f, -0.00210740521f, -0.00212516312f, -0.00214283552f,
+    -0.00216042179f, -0.00217792129f, -0.00219533337f, -0.00221265743f,
+    -0.00222989281f, -0.00224703892f, -0.00226409512f, -0.00228106081f,
+    -0.00229793536f, -0.00231471818f, -0.00233140866f, -0.00234800619f,
+    -0.00236451018f, -0.00238092004f, -0.00239723518f, -0.00241345501f,
+    -0.00242957895f, -0.00244560642f, -0.00246153685f, -0.00247736967f,
+    -0.00249310431f, -0.0025087402f, -0.00252427679f, -0.00253971353f,
+    -0.00255504986f, -0.00257028523f, -0.0025854191f, -0.00260045094f,
+    -0.00261538021f, -0.00263020637f, -0.0026449289f, -0.00265954728f,
+    -0.00267406099f, -0.00268846951f, -0.00270277233f, -0.00271696894f,
+    -0.00273105885f, -0.00274504156f, -0.00275891656f, -0.00277268338f,
+    -0.00278634152f, -0.00279989051f, -0.00281332986f, -0.00282665911f,
+    -0.00283987778f, -0.00285298541f, -0.00286598155f, -0.00287886573f,
+    -0.00289163751f, -0.00290429643f, -0.00291684207f, -0.00292927396f,
+    -0.0029415917f, -0.00295379484f, -0.00296588296f, -0.00297785563f,
+    -0.00298971246f, -0.00300145301f, -0.0030130769f, -0.0030245837f,
+    -0.00303597304f, -0.00304724451f, -0.00305839772f, -0.00306943229f,
+    -0.00308034785f, -0.00309114401f, -0.00310182041f, -0.00311237667f,
+    -0.00312281245f, -0.00313312739f, -0.00314332112f, -0.00315339331f,
+    -0.00316334361f, -0.00317317169f, -0.00318287721f, -0.00319245985f,
+    -0.00320191928f, -0.00321125517f, -0.00322046723f, -0.00322955514f,
+    -0.00323851859f, -0.00324735729f, -0.00325607094f, -0.00326465925f,
+    -0.00327312194f, -0.00328145872f, -0.00328966932f, -0.00329775347f,
+    -0.00330571091f, -0.00331354136f, -0.00332124459f, -0.00332882033f,
+    -0.00333626834f, -0.00334358837f, -0.0033507802f, -0.00335784358f,
+    -0.0033647783f, -0.00337158413f, -0.00337826086f, -0.00338480827f,
+    -0.00339122615f, -0.0033975143f, -0.00340367253f, -0.00340970065f,
+    -0.00341559846f, -0.00342136578f, -0.00342700245f, -0.00343250828f,
+    -0.0034378831f, -0.00344312676f, -0.0034482391f, -0.00345321997f,
+    -0.00345806921f, -0.00346278669f, -0.00346737227f, -0.00347182582f,
+    -0.0034761472f, -0.00348033631f, -0.00348439301f, -0.0034883172f,
+    -0.00349210877f, -0.00349576763f, -0.00349929366f, -0.00350268678f,
+    -0.00350594691f, -0.00350907395f, -0.00351206784f, -0.0035149285f,
+    -0.00351765587f, -0.00352024988f, -0.00352271047f, -0.0035250376f,
+    -0.00352723122f, -0.00352929129f, -0.00353121777f, -0.00353301062f,
+    -0.00353466983f, -0.00353619536f, -0.00353758721f, -0.00353884537f,
+    -0.00353996982f, -0.00354096056f, -0.00354181761f, -0.00354254096f,
+    -0.00354313064f, -0.00354358665f, -0.00354390903f, -0.00354409781f,
+    -0.00354415301f, -0.00354407468f, -0.00354386286f, -0.0035435176f,
+    -0.00354303895f, -0.00354242698f, -0.00354168174f, -0.00354080331f,
+    -0.00353979176f, -0.00353864717f, -0.00353736962f, -0.00353595921f,
+    -0.00353441602f, -0.00353274015f, -0.00353093172f, -0.00352899082f,
+    -0.00352691758f, -0.00352471211f, -0.00352237453f, -0.00351990498f,
+    -0.00351730358f, -0.00351457049f, -0.00351170583f, -0.00350870975f,
+    -0.00350558242f, -0.00350232399f, -0.00349893463f, -0.00349541449f,
+    -0.00349176376f, -0.0034879826f, -0.00348407122f, -0.00348002978f,
+    -0.00347585849f, -0.00347155754f, -0.00346712714f, -0.00346256748f,
+    -0.00345787878f, -0.00345306127f, -0.00344811515f, -0.00344304066f,
+    -0.00343783802f, -0.00343250748f, -0.00342704927f, -0.00342146363f,
+    -0.00341575082f, -0.0034099111f, -0.00340394471f, -0.00339785193f,
+    -0.00339163302f, -0.00338528825f, -0.00337881791f, -0.00337222228f,
+    -0.00336550164f, -0.00335865628f, -0.00335168651f, -0.00334459262f,
+    -0.00333737492f, -0.00333003371f, -0.00332256932f, -0.00331498206f,
+    -0.00330727226f, -0.00329944024f, -0.00329148634f, -0.00328341089f,
+    -0.00327521424f, -0.00326689673f, -0.00325845871f, -0.00324990055f,
+    -0.00324122259f, -0.0032324252f, -0.00322350875f, -0.00321447362f,
+    -0.00320532017f, -0.0031960488f, -0.00318665988f, -0.00317715381f,
+    -0.00316753099f, -0.0031577918f, -0.00314793665f, -0.00313796596f,
+    -0.00312788012f, -0.00311767957f, -0.00310736471f, -0.00309693597f,
+    -0.00308639378f, -0.00307573857f, -0.00306497078f, -0.00305409084f,
+    -0.00304309921f, -0.00303199633f, -0.00302078265f, -0.00300945864f,
+    -0.00299802474f, -0.00298648144f, -0.00297482918f, -0.00296306846f,
+    -0.00295119974f, -0.0029392235f, -0.00292714023f, -0.00291495042f,
+    -0.00290265457f, -0.00289025315f, -0.00287774669f, -0.00286513567f,
+    -0.00285242061f, -0.00283960201f, -0.00282668041f, -0.0028136563f,
+    -0.00280053022f, -0.00278730268f, -0.00277397423f, -0.0027605454f,
+    -0.00274701671f, -0.00273338871f, -0.00271966195f, -0.00270583698f,
+    -0.00269191434f, -0.00267789458f, -0.00266377828f, -0.00264956599f,
+    -0.00263525827f, -0.00262085569f, -0.00260635883f, -0.00259176826f,
+    -0.00257708456f, -0.00256230831f, -0.0025474401f, -0.00253248051f,
+    -0.00251743014f, -0.00250228959f, -0.00248705944f, -0.00247174031f,
+    -0.0024563328f, -0.00244083751f, -0.00242525506f, -0.00240958605f,
+    -0.00239383112f, -0.00237799088f, -0.00236206594f, -0.00234605695f,
+    -0.00232996452f, -0.00231378929f, -0.00229753189f, -0.00228119297f,
+    -0.00226477316f, -0.0022482731f, -0.00223169345f, -0.00221503485f,
+    -0.00219829796f, -0.00218148343f, -0.00216459191f, -0.00214762408f,
+    -0.00213058058f, -0.00211346209f, -0.00209626927f, -0.0020790028f,
+    -0.00206166335f, -0.0020442516f, -0.00202676821f, -0.00200921388f,
+    -0.00199158929f, -0.00197389513f, -0.00195613207f, -0.00193830082f,
+    -0.00192040206f, -0.0019024365f, -0.00188440482f, -0.00186630773f,
+    -0.00184814593f, -0.00182992013f, -0.00181163103f, -0.00179327934f,
+    -0.00177486577f, -0.00175639104f, -0.00173785585f, -0.00171926093f,
+    -0.001700607f, -0.00168189478f, -0.00166312498f, -0.00164429834f,
+    -0.00162541558f, -0.00160647744f, -0.00158748464f, -0.00156843791f,
+    -0.00154933799f, -0.00153018561f, -0.00151098152f, -0.00149172645f,
+    -0.00147242115f, -0.00145306635f, -0.00143366281f, -0.00141421126f,
+    -0.00139471246f, -0.00137516716f, -0.0013555761f, -0.00133594004f,
+    -0.00131625974f, -0.00129653594f, -0.00127676941f, -0.0012569609f,
+    -0.00123711117f, -0.00121722098f, -0.0011972911f, -0.00117732229f,
+    -0.00115731532f, -0.00113727094f, -0.00111718992f, -0.00109707304f,
+    -0.00107692106f, -0.00105673476f, -0.0010365149f, -0.00101626226f,
+    -0.000995977605f, -0.000975661716f, -0.000955315367f, -0.000934939334f,
+    -0.000914534394f, -0.000894101325f, -0.000873640905f, -0.000853153913f,
+    -0.000832641131f, -0.000812103339f, -0.000791541319f, -0.000770955852f,
+    -0.000750347723f, -0.000729717714f, -0.000709066611f, -0.000688395197f,
+    -0.000667704257f, -0.000646994579f, -0.000626266947f, -0.000605522148f,
+    -0.000584760971f, -0.0005639842f, -0.000543192626f, -0.000522387035f,
+    -0.000501568217f, -0.000480736959f, -0.000459894051f, -0.000439040281f,
+    -0.000418176439f, -0.000397303315f, -0.000376421697f, -0.000355532375f,
+    -0.000334636138f, -0.000313733777f, -0.000292826081f, -0.000271913838f,
+    -0.00025099784f, -0.000230078875f, -0.000209157732f, -0.0001882352f,
+    -0.000167312069f, -0.000146389126f, -0.000125467161f, -0.000104546961f,
+    -8.36293137e-05f, -6.27150073e-05f, -4.18048285e-05f, -2.0899564e-05f,
+    -4.00466482e-17f, 2.08930776e-05f, 4.17788836e-05f, 6.26566332e-05f,
+    8.35255421e-05f, 0.000104384827f, 0.000125233704f, 0.000146071391f,
+    0.000166897107f, 0.00018771007f, 0.000208509501f, 0.000229294619f,
+    0.000250064645f, 0.000270818802f, 0.000291556313f, 0.000312276401f,
+    0.00033297829f, 0.000353661208f, 0.000374324379f, 0.000394967031f,
+    0.000415588393f, 0.000436187695f, 0.000456764166f, 0.00047731704f,
+    0.000497845547f, 0.000518348924f, 0.000538826404f, 0.000559277224f,
+    0.000579700622f, 0.000600095836f, 0.000620462107f, 0.000640798677f,
+    0.000661104788f, 0.000681379684f, 0.000701622611f, 0.000721832817f,
+    0.00074200955f, 0.000762152059f, 0.000782259597f, 0.000802331417f,
+    0.000822366773f, 0.000842364922f, 0.000862325121f, 0.000882246631f,
+    0.000902128712f, 0.000921970629f, 0.000941771644f, 0.000961531026f,
+    0.000981248042f, 0.00100092196f, 0.00102055206f, 0.00104013761f,
+    0.00105967788f, 0.00107917216f, 0.00109861972f, 0.00111801985f,
+    0.00113737182f, 0.00115667493f, 0.00117592847f, 0.00119513171f,
+    0.00121428396f, 0.00123338451f, 0.00125243265f, 0.00127142769f,
+    0.00129036892f, 0.00130925565f, 0.00132808718f, 0.00134686282f,
+    0.00136558187f, 0.00138424367f, 0.0014028475f, 0.0014213927f,
+    0.00143987859f, 0.00145830448f, 0.00147666969f, 0.00149497357f,
+    0.00151321543f, 0.0015313946f, 0.00154951043f, 0.00156756224f,
+    0.00158554939f, 0.0016034712f, 0.00162132703f, 0.00163911622f,
+    0.00165683813f, 0.0016744921f, 0.00169207749f, 0.00170959367f,
+    0.00172703999f, 0.00174441581f, 0.00176172051f, 0.00177895345f,
+    0.00179611401f, 0.00181320157f, 0.00183021549f, 0.00184715517f,
+    0.00186401999f, 0.00188080933f, 0.00189752259f, 0.00191415916f,
+    0.00193071844f, 0.00194719982f, 0.00196360272f, 0.00197992653f,
+    0.00199617067f, 0.00201233455f, 0.00202841759f, 0.0020444192f,
+    0.0020603388f, 0.00207617583f, 0.00209192971f, 0.00210759987f,
+    0.00212318575f, 0.0021386868f, 0.00215410244f, 0.00216943212f,
+    0.0021846753f, 0.00219983143f, 0.00221489997f, 0.00222988036f,
+    0.00224477208f, 0.0022595746f, 0.00227428737f, 0.00228890989f,
+    0.00230344161f, 0.00231788203f, 0.00233223063f, 0.00234648689f,
+    0.00236065031f, 0.00237472039f, 0.00238869661f, 0.00240257849f,
+    0.00241636553f, 0.00243005724f, 0.00244365314f, 0.00245715273f,
+    0.00247055555f, 0.00248386112f, 0.00249706896f, 0.00251017862f,
+    0.00252318962f, 0.00253610151f, 0.00254891383f, 0.00256162612f,
+    0.00257423795f, 0.00258674887f, 0.00259915843f, 0.00261146621f,
+    0.00262367177f, 0.00263577467f, 0.00264777451f, 0.00265967085f,
+    0.00267146328f, 0.0026831514f, 0.00269473478f, 0.00270621303f,
+    0.00271758575f, 0.00272885254f, 0.00274001301f, 0.00275106678f,
+    0.00276201345f, 0.00277285266f, 0.00278358402f, 0.00279420717f,
+    0.00280472174f, 0.00281512736f, 0.00282542368f, 0.00283561034f,
+    0.002845687f, 0.00285565331f, 0.00286550893f, 0.00287525351f,
+    0.00288488674f, 0.00289440828f, 0.0029038178f, 0.00291311499f,
+    0.00292229953f, 0.00293137111f, 0.00294032943f, 0.00294917418f,
+    0.00295790506f, 0.00296652178f, 0.00297502406f, 0.0029834116f,
+    0.00299168412f, 0.00299984136f, 0.00300788304f, 0.00301580888f,
+    0.00302361864f, 0.00303131205f, 0.00303888886f, 0.00304634882f,
+    0.00305369168f, 0.00306091721f, 0.00306802516f, 0.00307501531f,
+    0.00308188743f, 0.00308864131f, 0.00309527671f, 0.00310179343f,
+    0.00310819126f, 0.00311446999f, 0.00312062944f, 0.00312666939f,
+    0.00313258966f, 0.00313839007f, 0.00314407044f, 0.00314963058f,
+    0.00315507033f, 0.00316038951f, 0.00316558797f, 0.00317066555f,
+    0.0031756221f, 0.00318045745f, 0.00318517148f, 0.00318976404f,
+    0.003194235f, 0.00319858422f, 0.00320281158f, 0.00320691695f,
+    0.00321090023f, 0.0032147613f, 0.00321850005f, 0.00322211638f,
+    0.0032256102f, 0.0032289814f, 0.0032322299f, 0.00323535561f,
+    0.00323835847f, 0.00324123838f, 0.00324399529f, 0.00324662912f,
+    0.00324913981f, 0.00325152732f, 0.00325379158f, 0.00325593256f,
+    0.0032579502f, 0.00325984447f, 0.00326161534f, 0.00326326279f,
+    0.00326478678f, 0.00326618729f, 0.00326746432f, 0.00326861786f,
+    0.0032696479f, 0.00327055443f, 0.00327133747f, 0.00327199702f,
+    0.0032725331f, 0.00327294572f, 0.00327323491f, 0.0032734007f,
+    0.00327344311f, 0.00327336219f, 0.00327315798f, 0.00327283052f,
+    0.00327237987f, 0.00327180607f, 0.0032711092f, 0.00327028931f,
+    0.00326934647f, 0.00326828076f, 0.00326709226f, 0.00326578104f,
+    0.00326434721f, 0.00326279085f, 0.00326111205f, 0.00325931092f,
+    0.00325738757f, 0.0032553421f, 0.00325317463f, 0.00325088528f,
+    0.00324847418f, 0.00324594146f, 0.00324328724f, 0.00324051166f,
+    0.00323761488f, 0.00323459703f, 0.00323145827f, 0.00322819875f,
+    0.00322481863f, 0.00322131809f, 0.00321769728f, 0.00321395639f,
+    0.00321009558f, 0.00320611506f, 0.00320201499f, 0.00319779558f,
+    0.00319345702f, 0.0031889995f, 0.00318442325f, 0.00317972846f,
+    0.00317491535f, 0.00316998415f, 0.00316493506f, 0.00315976832f,
+    0.00315448416f, 0.00314908282f, 0.00314356453f, 0.00313792955f,
+    0.00313217811f, 0.00312631048f, 0.00312032691f, 0.00311422766f,
+    0.003108013f, 0.00310168319f, 0.00309523853f, 0.00308867927f,
+    0.00308200571f, 0.00307521814f, 0.00306831683f, 0.0030613021f,
+    0.00305417424f, 0.00304693355f, 0.00303958034f, 0.00303211493f,
+    0.00302453763f, 0.00301684877f, 0.00300904866f, 0.00300113763f,
+    0.00299311602f, 0.00298498417f, 0.00297674242f, 0.0029683911f,
+    0.00295993058f, 0.0029513612f, 0.00294268332f, 0.0029338973f,
+    0.00292500351f, 0.00291600231f, 0.00290689409f, 0.00289767921f,
+    0.00288835805f, 0.00287893101f, 0.00286939846f, 0.00285976081f,
+    0.00285001844f, 0.00284017176f, 0.00283022118f, 0.00282016709f,
+    0.00281000991f, 0.00279975006f, 0.00278938795f, 0.00277892401f,
+    0.00276835866f, 0.00275769234f, 0.00274692547f, 0.0027360585f,
+    0.00272509186f, 0.002714026f, 0.00270286137f, 0.00269159842f,
+    0.00268023761f, 0.00266877938f, 0.00265722422f, 0.00264557257f,
+    0.00263382492f, 0.00262198173f, 0.00261004349f, 0.00259801066f,
+    0.00258588373f, 0.0025736632f, 0.00256134954f, 0.00254894326f,
+    0.00253644485f, 0.00252385481f, 0.00251117364f, 0.00249840185f,
+    0.00248553995f, 0.00247258845f, 0.00245954787f, 0.00244641873f,
+    0.00243320155f, 0.00241989685f, 0.00240650517f, 0.00239302704f,
+    0.00237946299f, 0.00236581356f, 0.00235207929f, 0.00233826072f,
+    0.00232435841f, 0.0023103729f, 0.00229630475f, 0.00228215451f,
+    0.00226792274f, 0.00225361001f, 0.00223921687f, 0.0022247439f,
+    0.00221019167f, 0.00219556074f, 0.0021808517f, 0.00216606513f,
+    0.0021512016f, 0.0021362617f, 0.00212124602f, 0.00210615515f,
+    0.00209098967f, 0.0020757502f, 0.00206043731f, 0.00204505161f,
+    0.00202959371f, 0.00201406421f, 0.00199846372f, 0.00198279285f,
+    0.00196705221f, 0.00195124241f, 0.00193536407f, 0.00191941782f,
+    0.00190340428f, 0.00188732406f, 0.00187117781f, 0.00185496614f,
+    0.00183868968f, 0.00182234908f, 0.00180594497f, 0.00178947798f,
+    0.00177294876f, 0.00175635794f, 0.00173970618f, 0.00172299412f,
+    0.00170622241f, 0.0016893917f, 0.00167250264f, 0.00165555589f,
+    0.0016385521f, 0.00162149193f, 0.00160437605f, 0.00158720511f,
+    0.00156997979f, 0.00155270074f, 0.00153536863f, 0.00151798414f,
+    0.00150054793f, 0.00148306069f, 0.00146552308f, 0.00144793577f,
+    0.00143029946f, 0.00141261482f, 0.00139488253f, 0.00137710328f,
+    0.00135927774f, 0.00134140661f, 0.00132349057f, 0.00130553032f,
+    0.00128752654f, 0.00126947992f, 0.00125139116f, 0.00123326096f,
+    0.00121509001f, 0.00119687901f, 0.00117862865f, 0.00116033964f,
+    0.00114201268f, 0.00112364847f, 0.00110524771f, 0.00108681112f,
+    0.00106833939f, 0.00104983323f, 0.00103129336f, 0.00101272047f,
+    0.000994115287f, 0.000975478515f, 0.000956810868f, 0.000938113058f,
+    0.0009193858f, 0.000900629809f, 0.0008818458f, 0.000863034491f,
+    0.000844196598f, 0.000825332841f, 0.000806443938f, 0.000787530609f,
+    0.000768593574f, 0.000749633554f, 0.000730651272f, 0.000711647449f,
+    0.000692622809f, 0.000673578074f, 0.00065451397f, 0.00063543122f,
+    0.00061633055f, 0.000597212685f, 0.000578078351f, 0.000558928273f,
+    0.00053976318f, 0.000520583797f, 0.000501390852f, 0.000482185073f,
+    0.000462967187f, 0.000443737923f, 0.000424498008f, 0.000405248171f,
+    0.000385989141f, 0.000366721646f, 0.000347446415f, 0.000328164177f,
+    0.00030887566f, 0.000289581594f, 0.000270282708f, 0.00025097973f,
+    0.000231673388f, 0.000212364412f, 0.000193053531f, 0.000173741471f,
+    0.000154428962f, 0.000135116731f, 0.000115805507f, 9.64960156e-05f,
+    7.71889851e-05f, 5.78851421e-05f, 3.85852129e-05f, 1.92899236e-05f,
+    2.61799654e-17f, -1.92838328e-05f, -3.85608499e-05f, -5.7830327e-05f,
+    -7.70915405e-05f, -9.6343767e-05f, -0.000115586284f, -0.000134818369f,
+    -0.000154039301f, -0.000173248359f, -0.000192444823f, -0.000211627973f,
+    -0.000230797091f, -0.000249951458f, -0.000269090359f, -0.000288213075f,
+    -0.000307318893f, -0.000326407096f, -0.000345476971f, -0.000364527807f,
+    -0.000383558889f, -0.000402569508f, -0.000421558954f, -0.000440526518f,
+    -0.000459471491f, -0.000478393167f, -0.000497290841f, -0.000516163808f,
+    -0.000535011364f, -0.000553832807f, -0.000572627436f, -0.000591394551f,
+    -0.000610133454f, -0.000628843448f, -0.000647523836f, -0.000666173924f,
+    -0.000684793019f, -0.000703380429f, -0.000721935463f, -0.000740457433f,
+    -0.00075894565f, -0.000777399429f, -0.000795818085f, -0.000814200936f,
+    -0.0008325473f, -0.000850856496f, -0.000869127847f, -0.000887360676f,
+    -0.000905554309f, -0.000923708071f, -0.000941821292f, -0.000959893302f,
+    -0.000977923433f, -0.000995911018f, -0.00101385539f, -0.0010317559f,
+    -0.00104961186f, -0.00106742264f, -0.00108518757f, -0.001102906f,
+    -0.00112057726f, -0.00113820072f, -0.00115577573f, -0.00117330163f,
+    -0.00119077778f, -0.00120820353f, -0.00122557826f, -0.00124290132f,
+    -0.00126017206f, -0.00127738987f, -0.0012945541f, -0.00131166413f,
+    -0.00132871933f, -0.00134571907f, -0.00136266273f, -0.00137954969f,
+    -0.00139637933f, -0.00141315103f, -0.00142986419f, -0.00144651819f,
+    -0.00146311242f, -0.00147964627f, -0.00149611914f, -0.00151253043f,
+    -0.00152887954f, -0.00154516588f, -0.00156138885f, -0.00157754785f,
+    -0.0015936423f, -0.00160967162f, -0.00162563522f, -0.00164153252f,
+    -0.00165736294f, -0.0016731259f, -0.00168882084f, -0.00170444718f,
+    -0.00172000436f, -0.00173549181f, -0.00175090897f, -0.00176625529f,
+    -0.00178153019f, -0.00179673315f, -0.00181186359f, -0.00182692098f,
+    -0.00184190477f, -0.00185681442f, -0.00187164939f, -0.00188640915f,
+    -0.00190109316f, -0.0019157009f, -0.00193023183f, -0.00194468544f,
+    -0.0019590612f, -0.0019733586f, -0.00198757713f, -0.00200171626f,
+    -0.0020157755f, -0.00202975435f, -0.00204365229f, -0.00205746883f,
+    -0.00207120348f, -0.00208485574f, -0.00209842513f, -0.00211191116f,
+    -0.00212531335f, -0.00213863122f, -0.00215186429f, -0.0021650121f,
+    -0.00217807418f, -0.00219105005f, -0.00220393927f, -0.00221674136f,
+    -0.00222945588f, -0.00224208238f, -0.0022546204f, -0.0022670695f,
+    -0.00227942925f, -0.00229169919f, -0.00230387891f, -0.00231596797f,
+    -0.00232796593f, -0.00233987239f, -0.00235168692f, -0.0023634091f,
+    -0.00237503852f, -0.00238657477f, -0.00239801745f, -0.00240936616f,
+    -0.00242062049f, -0.00243178006f, -0.00244284447f, -0.00245381334f,
+    -0.00246468628f, -0.00247546291f, -0.00248614286f, -0.00249672576f,
+    -0.00250721123f, -0.00251759892f, -0.00252788847f, -0.00253807951f,
+    -0.0025481717f, -0.00255816468f, -0.00256805811f, -0.00257785165f,
+    -0.00258754496f, -0.00259713771f, -0.00260662957f, -0.00261602021f,
+    -0.00262530932f, -0.00263449656f, -0.00264358164f, -0.00265256424f,
+    -0.00266144405f, -0.00267022077f, -0.0026788941f, -0.00268746376f,
+    -0.00269592944f, -0.00270429087f, -0.00271254776f, -0.00272069984f,
+    -0.00272874682f, -0.00273668844f, -0.00274452444f, -0.00275225455f,
+    -0.00275987851f, -0.00276739608f, -0.002774807f, -0.00278211102f,
+    -0.00278930791f, -0.00279639742f, -0.00280337933f, -0.00281025341f,
+    -0.00281701943f, -0.00282367716f, -0.0028302264f, -0.00283666694f,
+    -0.00284299855f, -0.00284922105f, -0.00285533422f, -0.00286133788f,
+    -0.00286723183f, -0.00287301589f, -0.00287868987f, -0.00288425359f,
+    -0.00288970688f, -0.00289504957f, -0.00290028149f, -0.00290540248f,
+    -0.00291041239f, -0.00291531105f, -0.00292009832f, -0.00292477406f,
+    -0.00292933812f, -0.00293379037f, -0.00293813068f, -0.00294235891f,
+    -0.00294647494f, -0.00295047866f, -0.00295436995f, -0.0029581487f,
+    -0.0029618148f, -0.00296536815f, -0.00296880864f, -0.0029721362f,
+    -0.00297535073f, -0.00297845213f, -0.00298144034f, -0.00298431528f,
+    -0.00298707687f, -0.00298972504f, -0.00299225973f, -0.00299468089f,
+    -0.00299698845f, -0.00299918237f, -0.0030012626f, -0.00300322909f,
+    -0.00300508182f, -0.00300682074f, -0.00300844583f, -0.00300995705f,
+    -0.0030113544f, -0.00301263786f, -0.0030138074f, -0.00301486303f,
+    -0.00301580474f, -0.00301663254f, -0.00301734642f, -0.00301794639f,
+    -0.00301843248f, -0.00301880469f, -0.00301906305f, -0.00301920759f,
+    -0.00301923834f, -0.00301915533f, -0.0030189586f, -0.00301864819f,
+    -0.00301822416f, -0.00301768656f, -0.00301703543f, -0.00301627085f,
+    -0.00301539288f, -0.00301440158f, -0.00301329703f, -0.00301207931f,
+    -0.0030107485f, -0.00300930469f, -0.00300774796f, -0.00300607842f,
+    -0.00300429615f, -0.00300240127f, -0.00300039387f, -0.00299827408f,
+    -0.00299604201f, -0.00299369777f, -0.0029912415f, -0.00298867331f,
+    -0.00298599335f, -0.00298320174f, -0.00298029864f, -0.00297728418f,
+    -0.00297415851f, -0.00297092179f, -0.00296757417f, -0.00296411582f,
+    -0.0029605469f, -0.00295686759f, -0.00295307804f, -0.00294917845f,
+    -0.002945169f, -0.00294104987f, -0.00293682124f, -0.00293248333f,
+    -0.00292803631f, -0.00292348041f, -0.00291881581f, -0.00291404274f,
+    -0.00290916141f, -0.00290417203f, -0.00289907483f, -0.00289387004f,
+    -0.00288855788f, -0.0028831386f, -0.00287761242f, -0.00287197959f,
+    -0.00286624036f, -0.00286039497f, -0.00285444369f, -0.00284838677f,
+    -0.00284222446f, -0.00283595705f, -0.00282958479f, -0.00282310796f,
+    -0.00281652685f, -0.00280984172f, -0.00280305286f, -0.00279616057f,
+    -0.00278916514f, -0.00278206685f, -0.00277486602f, -0.00276756295f,
+    -0.00276015794f, -0.00275265131f, -0.00274504338f, -0.00273733445f,
+    -0.00272952486f, -0.00272161492f, -0.00271360498f, -0.00270549536f,
+    -0.0026972864f, -0.00268897845f, -0.00268057184f, -0.00267206693f,
+    -0.00266346407f, -0.00265476361f, -0.00264596591f, -0.00263707134f,
+    -0.00262808025f, -0.00261899303f, -0.00260981004f, -0.00260053166f,
+    -0.00259115828f, -0.00258169026f, -0.00257212801f, -0.00256247191f,
+    -0.00255272236f, -0.00254287974f, -0.00253294447f, -0.00252291695f,
+    -0.00251279759f, -0.00250258678f, -0.00249228496f, -0.00248189254f,
+    -0.00247140993f, -0.00246083756f, -0.00245017587f, -0.00243942527f,
+    -0.0024285862f, -0.0024176591f, -0.00240664442f, -0.00239554258f,
+    -0.00238435404f, -0.00237307925f, -0.00236171866f, -0.00235027273f,
+    -0.00233874191f, -0.00232712666f, -0.00231542746f, -0.00230364477f,
+    -0.00229177905f, -0.00227983079f, -0.00226780045f, -0.00225568853f,
+    -0.0022434955f, -0.00223122185f, -0.00221886806f, -0.00220643463f,
+    -0.00219392204f, -0.00218133081f, -0.00216866142f, -0.00215591439f,
+    -0.00214309021f, -0.00213018939f, -0.00211721244f, -0.00210415989f,
+    -0.00209103223f, -0.00207783f, -0.00206455371f, -0.00205120389f,
+    -0.00203778106f, -0.00202428576f, -0.00201071851f, -0.00199707985f,
+    -0.00198337031f, -0.00196959044f, -0.00195574078f, -0.00194182187f,
+    -0.00192783426f, -0.0019137785f, -0.00189965513f, -0.00188546472f,
+    -0.00187120782f, -0.00185688498f, -0.00184249677f, -0.00182804376f,
+    -0.0018135265f, -0.00179894556f, -0.00178430152f, -0.00176959495f,
+    -0.00175482642f, -0.0017399965f, -0.00172510579f, -0.00171015484f,
+    -0.00169514426f, -0.00168007462f, -0.00166494651f, -0.00164976053f,
+    -0.00163451725f, -0.00161921727f, -0.0016038612f, -0.00158844962f,
+    -0.00157298313f, -0.00155746233f, -0.00154188784f, -0.00152626024f,
+    -0.00151058015f, -0.00149484817f, -0.00147906492f, -0.001463231f,
+    -0.00144734702f, -0.00143141361f, -0.00141543138f, -0.00139940095f,
+    -0.00138332293f, -0.00136719795f, -0.00135102663f, -0.00133480959f,
+    -0.00131854747f, -0.00130224088f, -0.00128589046f, -0.00126949683f,
+    -0.00125306063f, -0.0012365825f, -0.00122006305f, -0.00120350294f,
+    -0.0011869028f, -0.00117026327f, -0.00115358498f, -0.00113686858f,
+    -0.00112011471f, -0.00110332401f, -0.00108649714f, -0.00106963472f,
+    -0.00105273742f, -0.00103580587f, -0.00101884073f, -0.00100184265f,
+    -0.000984812275f, -0.000967750264f, -0.000950657266f, -0.000933533937f,
+    -0.00091638093f, -0.000899198903f, -0.000881988512f, -0.000864750415f,
+    -0.00084748527f, -0.000830193737f, -0.000812876475f, -0.000795534146f,
+    -0.000778167411f, -0.000760776933f, -0.000743363374f, -0.000725927398f,
+    -0.000708469669f, -0.000690990853f, -0.000673491615f, -0.000655972621f,
+    -0.000638434537f, -0.000620878031f, -0.000603303769f, -0.000585712421f,
+    -0.000568104654f, -0.000550481137f, -0.00053284254f, -0.000515189533f,
+    -0.000497522784f, -0.000479842964f, -0.000462150744f, -0.000444446795f,
+    -0.000426731786f, -0.000409006391f, -0.000391271279f, -0.000373527123f,
+    -0.000355774594f, -0.000338014363f, -0.000320247103f, -0.000302473486f,
+    -0.000284694182f, -0.000266909865f, -0.000249121205f, -0.000231328875f,
+    -0.000213533547f, -0.000195735892f, -0.000177936581f, -0.000160136286f,
+    -0.000142335677f, -0.000124535427f, -0.000106736205f, -8.89386828e-05f,
+    -7.11435293e-05f, -5.33514149e-05f, -3.55630092e-05f, -1.77789813e-05f,
+    -1.4191579e-17f, 1.77732663e-05f, 3.55401495e-05f, 5.32999822e-05f,
+    7.10520974e-05f, 8.87958285e-05f, 0.00010653051f, 0.000124255475f,
+    0.00014197006f, 0.000159673601f, 0.000177365433f, 0.000195044893f,
+    0.000212711321f, 0.000230364053f, 0.000248002429f, 0.000265625789f,
+    0.000283233474f, 0.000300824824f, 0.000318399183f, 0.000335955893f,
+    0.000353494299f, 0.000371013745f, 0.000388513578f, 0.000405993143f,
+    0.00042345179f, 0.000440888866f, 0.000458303721f, 0.000475695707f,
+    0.000493064175f, 0.000510408478f, 0.000527727971f, 0.000545022008f,
+    0.000562289946f, 0.000579531143f, 0.000596744957f, 0.000613930749f,
+    0.00063108788f, 0.000648215712f, 0.00066531361f, 0.000682380939f,
+    0.000699417065f, 0.000716421356f, 0.000733393183f, 0.000750331915f,
+    0.000767236925f, 0.000784107587f, 0.000800943276f, 0.000817743368f,
+    0.000834507243f, 0.00085123428f, 0.00086792386f, 0.000884575367f,
+    0.000901188185f, 0.000917761701f, 0.000934295303f, 0.00095078838f,
+    0.000967240324f, 0.000983650528f, 0.00100001839f, 0.0010163433f,
+    0.00103262466f, 0.00104886187f, 0.00106505434f, 0.00108120146f,
+    0.00109730265f, 0.00111335731f, 0.00112936485f, 0.00114532468f,
+    0.00116123623f, 0.00117709889f, 0.0011929121f, 0.00120867526f,
+    0.00122438781f, 0.00124004917f, 0.00125565876f, 0.00127121601f,
+    0.00128672036f, 0.00130217123f, 0.00131756806f, 0.00133291029f,
+    0.00134819736f, 0.0013634287f, 0.00137860377f, 0.00139372201f,
+    0.00140878286f, 0.00142378578f, 0.00143873022f, 0.00145361564f,
+    0.0014684415f, 0.00148320725f, 0.00149791236f, 0.00151255629f,
+    0.00152713851f, 0.0015416585f, 0.00155611572f, 0.00157050965f,
+    0.00158483977f, 0.00159910556f, 0.0016133065f, 0.00162744208f,
+    0.00164151179f, 0.00165551511f, 0.00166945154f, 0.00168332058f,
+    0.00169712173f, 0.00171085448f, 0.00172451835f, 0.00173811283f,
+    0.00175163745f, 0.00176509171f, 0.00177847512f, 0.00179178722f,
+    0.00180502751f, 0.00181819552f, 0.00183129078f, 0.00184431283f,
+    0.00185726118f, 0.00187013538f, 0.00188293497f, 0.00189565949f,
+    0.00190830848f, 0.00192088149f, 0.00193337807f, 0.00194579778f,
+    0.00195814017f, 0.0019704048f, 0.00198259123f, 0.00199469904f,
+    0.00200672779f, 0.00201867704f, 0.00203054639f, 0.0020423354f,
+    0.00205404366f, 0.00206567075f, 0.00207721626f, 0.00208867978f,
+    0.00210006091f, 0.00211135924f, 0.00212257438f, 0.00213370592f,
+    0.00214475348f, 0.00215571667f, 0.0021665951f, 0.00217738838f,
+    0.00218809615f, 0.00219871802f, 0.00220925362f, 0.00221970258f,
+    0.00223006454f, 0.00224033913f, 0.002250526f, 0.00226062478f,
+    0.00227063513f, 0.0022805567f, 0.00229038914f, 0.00230013212f,
+    0.00230978528f, 0.00231934831f, 0.00232882086f, 0.00233820261f,
+    0.00234749323f, 0.00235669241f, 0.00236579982f, 0.00237481516f,
+    0.00238373811f, 0.00239256837f, 0.00240130563f, 0.0024099496f,
+    0.00241849998f, 0.00242695647f, 0.0024353188f, 0.00244358666f,
+    0.00245175979f, 0.00245983791f, 0.00246782074f, 0.00247570801f,
+    0.00248349946f, 0.00249119482f, 0.00249879383f, 0.00250629624f,
+    0.0025137018f, 0.00252101026f, 0.00252822138f, 0.00253533491f,
+    0.00254235062f, 0.00254926828f, 0.00255608765f, 0.00256280851f,
+    0.00256943065f, 0.00257595384f, 0.00258237787f, 0.00258870252f,
+    0.0025949276f, 0.0026010529f, 0.00260707823f, 0.00261300337f,
+    0.00261882816f, 0.00262455239f, 0.00263017589f, 0.00263569848f,
+    0.00264111998f, 0.00264644022f, 0.00265165903f, 0.00265677625f,
+    0.00266179172f, 0.00266670527f, 0.00267151677f, 0.00267622606f,
+    0.002680833f, 0.00268533744f, 0.00268973926f, 0.00269403831f,
+    0.00269823447f, 0.00270232762f, 0.00270631762f, 0.00271020438f,
+    0.00271398776f, 0.00271766767f, 0.002721244f, 0.00272471665f,
+    0.00272808552f, 0.00273135051f, 0.00273451154f, 0.00273756852f,
+    0.00274052138f, 0.00274337002f, 0.00274611439f, 0.00274875441f,
+    0.00275129001f, 0.00275372113f, 0.00275604771f, 0.00275826971f,
+    0.00276038707f, 0.00276239974f, 0.00276430769f, 0.00276611087f,
+    0.00276780925f, 0.00276940281f, 0.00277089151f, 0.00277227533f,
+    0.00277355425f, 0.00277472827f, 0.00277579737f, 0.00277676154f,
+    0.00277762078f, 0.0027783751f, 0.00277902449f, 0.00277956897f,
+    0.00278000856f, 0.00278034326f, 0.00278057311f, 0.00278069812f,
+    0.00278071832f, 0.00278063376f, 0.00278044446f, 0.00278015047f,
+    0.00277975183f, 0.00277924859f, 0.0027786408f, 0.00277792853f,
+    0.00277711182f, 0.00277619076f, 0.00277516539f, 0.00277403581f,
+    0.00277280207f, 0.00277146427f, 0.00277002249f, 0.00276847682f,
+    0.00276682734f, 0.00276507416f, 0.00276321737f, 0.00276125707f,
+    0.00275919338f, 0.00275702641f, 0.00275475627f, 0.00275238308f,
+    0.00274990696f, 0.00274732804f, 0.00274464645f, 0.00274186232f,
+    0.0027389758f, 0.00273598703f, 0.00273289614f, 0.00272970329f,
+    0.00272640864f, 0.00272301234f, 0.00271951455f, 0.00271591544f,
+    0.00271221517f, 0.00270841392f, 0.00270451187f, 0.00270050919f,
+    0.00269640606f, 0.00269220268f, 0.00268789923f, 0.00268349592f,
+    0.00267899293f, 0.00267439047f, 0.00266968875f, 0.00266488797f,
+    0.00265998836f, 0.00265499012f, 0.00264989347f, 0.00264469864f,
+    0.00263940586f, 0.00263401536f, 0.00262852738f, 0.00262294214f,
+    0.0026172599f, 0.0026114809f, 0.00260560539f, 0.00259963363f,
+    0.00259356586f, 0.00258740234f, 0.00258114335f, 0.00257478915f,
+    0.00256834001f, 0.0025617962f, 0.002555158f, 0.00254842569f,
+    0.00254159956f, 0.00253467989f, 0.00252766697f, 0.00252056111f,
+    0.00251336259f, 0.00250607172f, 0.0024986888f, 0.00249121414f,
+    0.00248364806f, 0.00247599086f, 0.00246824287f, 0.00246040441f,
+    0.0024524758f, 0.00244445737f, 0.00243634946f, 0.00242815238f,
+    0.0024198665f, 0.00241149214f, 0.00240302965f, 0.00239447937f,
+    0.00238584167f, 0.00237711689f, 0.00236830539f, 0.00235940752f,
+    0.00235042366f, 0.00234135418f, 0.00233219943f, 0.00232295979f,
+    0.00231363564f, 0.00230422736f, 0.00229473532f, 0.00228515992f,
+    0.00227550155f, 0.00226576058f, 0.00225593742f, 0.00224603247f,
+    0.00223604612f, 0.00222597878f, 0.00221583085f, 0.00220560274f,
+    0.00219529486f, 0.00218490763f, 0.00217444146f, 0.00216389678f,
+    0.00215327401f, 0.00214257357f, 0.00213179589f, 0.00212094141f,
+    0.00211001055f, 0.00209900376f, 0.00208792147f, 0.00207676413f,
+    0.00206553217f, 0.00205422606f, 0.00204284623f, 0.00203139315f,
+    0.00201986726f, 0.00200826903f, 0.00199659892f, 0.00198485738f,
+    0.00197304489f, 0.00196116191f, 0.00194920892f, 0.00193718638f,
+    0.00192509478f, 0.00191293458f, 0.00190070628f, 0.00188841036f,
+    0.00187604729f, 0.00186361757f, 0.00185112169f, 0.00183856015f,
+    0.00182593342f, 0.00181324203f, 0.00180048645f, 0.00178766719f,
+    0.00177478477f, 0.00176183968f, 0.00174883243f, 0.00173576353f,
+    0.0017226335f, 0.00170944285f, 0.00169619209f, 0.00168288175f,
+    0.00166951235f, 0.00165608441f, 0.00164259845f, 0.001629055f,
+    0.0016154546f, 0.00160179777f, 0.00158808505f, 0.00157431696f,
+    0.00156049406f, 0.00154661687f, 0.00153268593f, 0.0015187018f,
+    0.00150466501f, 0.00149057611f, 0.00147643565f, 0.00146224418f,
+    0.00144800225f, 0.00143371041f, 0.00141936922f, 0.00140497923f,
+    0.00139054101f, 0.00137605511f, 0.00136152209f, 0.00134694252f,
+    0.00133231696f, 0.00131764598f, 0.00130293014f, 0.00128817002f,
+    0.00127336618f, 0.00125851921f, 0.00124362966f, 0.00122869812f,
+    0.00121372516f, 0.00119871137f, 0.00118365731f, 0.00116856357f,
+    0.00115343074f, 0.00113825939f, 0.00112305011f, 0.00110780349f,
+    0.00109252011f, 0.00107720055f, 0.00106184542f, 0.0010464553f,
+    0.00103103078f, 0.00101557245f, 0.00100008091f, 0.000984556748f,
+    0.000969000566f, 0.000953412958f, 0.000937794522f, 0.000922145857f,
+    0.000906467562f, 0.000890760238f, 0.000875024487f, 0.00085926091f,
+    0.000843470111f, 0.000827652694f, 0.000811809264f, 0.000795940426f,
+    0.000780046786f, 0.000764128953f, 0.000748187532f, 0.000732223134f,
+    0.000716236368f, 0.000700227842f, 0.000684198168f, 0.000668147956f,
+    0.000652077819f, 0.000635988368f, 0.000619880216f, 0.000603753976f,
+    0.000587610261f, 0.000571449687f, 0.000555272868f, 0.000539080418f,
+    0.000522872953f, 0.000506651089f, 0.000490415441f, 0.000474166626f,
+    0.000457905262f, 0.000441631964f, 0.00042534735f, 0.000409052037f,
+    0.000392746644f, 0.000376431787f, 0.000360108085f, 0.000343776156f,
+    0.000327436618f, 0.00031109009f, 0.000294737189f, 0.000278378535f,
+    0.000262014745f, 0.000245646438f, 0.000229274232f, 0.000212898746f,
+    0.000196520598f, 0.000180140406f, 0.000163758788f, 0.000147376361f,
+    0.000130993744f, 0.000114611555f, 9.82304091e-05f, 8.18509249e-05f,
+    6.54737189e-05f, 4.90994073e-05f, 3.27286065e-05f, 1.63619322e-05f,
+    4.18032454e-17f, -1.63565751e-05f, -3.27071784e-05f, -4.90511956e-05f,
+    -6.53880129e-05f, -8.1717017e-05f, -9.8037595e-05f, -0.000114349135f,
+    -0.000130651024f, -0.000146942652f, -0.000163223408f, -0.000179492681f,
+    -0.000195749864f, -0.000211994346f, -0.00022822552f, -0.000244442778f,
+    -0.000260645513f, -0.000276833121f, -0.000293004995f, -0.000309160532f,
+    -0.000325299128f, -0.000341420179f, -0.000357523085f, -0.000373607245f,
+    -0.000389672058f, -0.000405716925f, -0.000421741248f, -0.00043774443f,
+    -0.000453725875f, -0.000469684987f, -0.000485621173f, -0.000501533839f,
+    -0.000517422393f, -0.000533286244f, -0.000549124803f, -0.000564937481f,
+    -0.000580723691f, -0.000596482846f, -0.00061221436f, -0.000627917652f,
+    -0.000643592137f, -0.000659237234f, -0.000674852364f, -0.000690436947f,
+    -0.000705990407f, -0.000721512168f, -0.000737001654f, -0.000752458293f,
+    -0.000767881513f, -0.000783270743f, -0.000798625416f, -0.000813944962f,
+    -0.000829228817f, -0.000844476417f, -0.000859687198f, -0.000874860599f,
+    -0.000889996061f, -0.000905093026f, -0.000920150937f, -0.000935169239f,
+    -0.000950147381f, -0.00096508481f, -0.000979980976f, -0.000994835332f,
+    -0.00100964733f, -0.00102441643f, -0.00103914209f, -0.00105382376f,
+    -0.00106846091f, -0.001083053f, -0.0010975995f, -0.00111209986f,
+    -0.00112655357f, -0.00114096009f, -0.00115531889f, -0.00116962945f,
+    -0.00118389124f, -0.00119810375f, -0.00121226645f, -0.00122637883f,
+    -0.00124044037f, -0.00125445055f, -0.00126840887f, -0.00128231482f,
+    -0.00129616789f, -0.00130996758f, -0.00132371338f, -0.00133740479f,
+    -0.00135104132f, -0.00136462246f, -0.00137814773f, -0.00139161663f,
+    -0.00140502868f, -0.00141838339f, -0.00143168027f, -0.00144491884f,
+    -0.00145809862f, -0.00147121914f, -0.00148427991f, -0.00149728048f,
+    -0.00151022035f, -0.00152309908f, -0.00153591619f, -0.00154867122f,
+    -0.00156136371f, -0.0015739932f, -0.00158655924f, -0.00159906137f,
+    -0.00161149915f, -0.00162387212f, -0.00163617985f, -0.00164842188f,
+    -0.00166059778f, -0.00167270712f, -0.00168474945f, -0.00169672435f,
+    -0.00170863138f, -0.00172047013f, -0.00173224016f, -0.00174394106f,
+    -0.0017555724f, -0.00176713378f, -0.00177862477f, -0.00179004497f,
+    -0.00180139398f, -0.00181267138f, -0.00182387678f, -0.00183500978f,
+    -0.00184606997f, -0.00185705698f, -0.00186797041f, -0.00187880986f,
+    -0.00188957497f, -0.00190026534f, -0.0019108806f, -0.00192142037f,
+    -0.00193188428f, -0.00194227196f, -0.00195258304f, -0.00196281717f,
+    -0.00197297398f, -0.00198305311f, -0.00199305421f, -0.00200297692f,
+    -0.00201282091f, -0.00202258582f, -0.00203227131f, -0.00204187705f,
+    -0.00205140269f, -0.00206084791f, -0.00207021237f, -0.00207949576f,
+    -0.00208869774f, -0.00209781799f, -0.0021068562f, -0.00211581206f,
+    -0.00212468526f, -0.00213347548f, -0.00214218243f, -0.0021508058f,
+    -0.00215934529f, -0.00216780062f, -0.00217617148f, -0.0021844576f,
+    -0.00219265869f, -0.00220077447f, -0.00220880465f, -0.00221674897f,
+    -0.00222460715f, -0.00223237893f, -0.00224006405f, -0.00224766223f,
+    -0.00225517322f, -0.00226259678f, -0.00226993264f, -0.00227718056f,
+    -0.0022843403f, -0.00229141161f, -0.00229839426f, -0.00230528801f,
+    -0.00231209264f, -0.00231880791f, -0.00232543361f, -0.0023319695f,
+    -0.00233841538f, -0.00234477104f, -0.00235103626f, -0.00235721083f,
+    -0.00236329456f, -0.00236928724f, -0.00237518868f, -0.00238099868f,
+    -0.00238671706f, -0.00239234363f, -0.00239787822f, -0.00240332063f,
+    -0.0024086707f, -0.00241392826f, -0.00241909313f, -0.00242416516f,
+    -0.00242914418f, -0.00243403004f, -0.00243882258f, -0.00244352165f,
+    -0.00244812711f, -0.00245263882f, -0.00245705663f, -0.00246138041f,
+    -0.00246561002f, -0.00246974535f, -0.00247378626f, -0.00247773263f,
+    -0.00248158435f, -0.0024853413f, -0.00248900337f, -0.00249257046f,
+    -0.00249604246f, -0.00249941927f, -0.00250270079f, -0.00250588695f,
+    -0.00250897763f, -0.00251197277f, -0.00251487227f, -0.00251767607f,
+    -0.00252038408f, -0.00252299625f, -0.00252551249f, -0.00252793274f,
+    -0.00253025696f, -0.00253248508f, -0.00253461704f, -0.00253665281f,
+    -0.00253859233f, -0.00254043556f, -0.00254218248f, -0.00254383303f,
+    -0.0025453872f, -0.00254684495f, -0.00254820627f, -0.00254947112f,
+    -0.00255063951f, -0.00255171141f, -0.00255268681f, -0.00255356572f,
+    -0.00255434813f, -0.00255503404f, -0.00255562346f, -0.00255611639f,
+    -0.00255651286f, -0.00255681288f, -0.00255701646f, -0.00255712364f,
+    -0.00255713444f, -0.00255704889f, -0.00255686703f, -0.00255658889f,
+    -0.00255621453f, -0.00255574398f, -0.00255517729f, -0.00255451452f,
+    -0.00255375572f, -0.00255290096f, -0.00255195029f, -0.00255090379f,
+    -0.00254976153f, -0.00254852357f, -0.00254719001f, -0.00254576092f,
+    -0.00254423638f, -0.0025426165f, -0.00254090135f, -0.00253909103f,
+    -0.00253718565f, -0.0025351853f, -0.0025330901f, -0.00253090016f,
+    -0.00252861558f, -0.00252623649f, -0.00252376301f, -0.00252119526f,
+    -0.00251853336f, -0.00251577746f, -0.00251292768f, -0.00250998417f,
+    -0.00250694706f, -0.00250381651f, -0.00250059265f, -0.00249727565f,
+    -0.00249386565f, -0.00249036283f, -0.00248676733f, -0.00248307933f,
+    -0.002479299f, -0.00247542651f, -0.00247146203f, -0.00246740575f,
+    -0.00246325784f, -0.00245901851f, -0.00245468792f, -0.00245026629f,
+    -0.0024457538f, -0.00244115066f, -0.00243645707f, -0.00243167323f,
+    -0.00242679936f, -0.00242183567f, -0.00241678238f, -0.0024116397f,
+    -0.00240640786f, -0.00240108709f, -0.00239567762f, -0.00239017968f,
+    -0.0023845935f, -0.00237891933f, -0.00237315741f, -0.00236730799f,
+    -0.00236137131f, -0.00235534762f, -0.00234923719f, -0.00234304028f,
+    -0.00233675714f, -0.00233038803f, -0.00232393324f, -0.00231739303f,
+    -0.00231076767f, -0.00230405744f, -0.00229726263f, -0.00229038352f,
+    -0.00228342039f, -0.00227637354f, -0.00226924325f, -0.00226202984f,
+    -0.00225473358f, -0.0022473548f, -0.00223989378f, -0.00223235085f,
+    -0.00222472631f, -0.00221702047f, -0.00220923366f, -0.0022013662f,
+    -0.0021934184f, -0.00218539059f, -0.00217728311f, -0.00216909628f,
+    -0.00216083045f, -0.00215248594f, -0.0021440631f, -0.00213556227f,
+    -0.00212698379f, -0.00211832803f, -0.00210959532f, -0.00210078603f,
+    -0.00209190051f, -0.00208293911f, -0.00207390222f, -0.00206479018f,
+    -0.00205560337f, -0.00204634215f, -0.00203700691f, -0.00202759802f,
+    -0.00201811586f, -0.0020085608f, -0.00199893324f, -0.00198923357f,
+    -0.00197946216f, -0.00196961941f, -0.00195970572f, -0.00194972148f,
+    -0.0019396671f, -0.00192954298f, -0.00191934951f, -0.00190908711f,
+    -0.00189875619f, -0.00188835717f, -0.00187789044f, -0.00186735644f,
+    -0.00185675557f, -0.00184608827f, -0.00183535495f, -0.00182455605f,
+    -0.00181369199f, -0.0018027632f, -0.00179177012f, -0.00178071318f,
+    -0.00176959282f, -0.00175840948f, -0.0017471636f, -0.00173585562f,
+    -0.001724486f, -0.00171305519f, -0.00170156362f, -0.00169001177f,
+    -0.00167840008f, -0.001666729f, -0.00165499901f, -0.00164321055f,
+    -0.00163136411f, -0.00161946013f, -0.00160749909f, -0.00159548146f,
+    -0.0015834077f, -0.00157127831f, -0.00155909374f, -0.00154685448f,
+    -0.001534561f, -0.00152221379f, -0.00150981333f, -0.00149736011f,
+    -0.00148485461f, -0.00147229732f, -0.00145968873f, -0.00144702934f,
+    -0.00143431964f, -0.00142156012f, -0.00140875128f, -0.00139589362f,
+    -0.00138298764f, -0.00137003384f, -0.00135703274f, -0.00134398482f,
+    -0.00133089061f, -0.00131775061f, -0.00130456533f, -0.00129133528f,
+    -0.00127806097f, -0.00126474293f, -0.00125138166f, -0.00123797769f,
+    -0.00122453153f, -0.00121104371f, -0.00119751475f, -0.00118394516f,
+    -0.00117033549f, -0.00115668624f, -0.00114299796f, -0.00112927116f,
+    -0.00111550639f, -0.00110170416f, -0.00108786501f, -0.00107398949f,
+    -0.00106007811f, -0.00104613143f, -0.00103214996f, -0.00101813427f,
+    -0.00100408487f, -0.000990002325f, -0.000975887162f, -0.000961739928f,
+    -0.000947561168f, -0.000933351425f, -0.000919111245f, -0.000904841176f,
+    -0.000890541766f, -0.000876213562f, -0.000861857115f, -0.000847472975f,
+    -0.000833061694f, -0.000818623823f, -0.000804159915f, -0.000789670525f,
+    -0.000775156207f, -0.000760617516f, -0.000746055009f, -0.000731469242f,
+    -0.000716860772f, -0.000702230158f, -0.000687577959f, -0.000672904734f,
+    -0.000658211043f, -0.000643497446f, -0.000628764505f, -0.000614012782f,
+    -0.000599242838f, -0.000584455237f, -0.000569650541f, -0.000554829315f,
+    -0.000539992122f, -0.000525139528f, -0.000510272096f, -0.000495390392f,
+    -0.000480494982f, -0.000465586432f, -0.000450665308f, -0.000435732177f,
+    -0.000420787605f, -0.00040583216f, -0.000390866408f, -0.000375890918f,
+    -0.000360906256f, -0.000345912992f, -0.000330911692f, -0.000315902925f,
+    -0.000300887258f, -0.000285865261f, -0.000270837502f, -0.000255804548f,
+    -0.000240766968f, -0.00022572533f, -0.000210680204f, -0.000195632156f,
+    -0.000180581754f, -0.000165529568f, -0.000150476165f, -0.000135422113f,
+    -0.000120367978f, -0.00010531433f, -9.02617337e-05f, -7.52107576e-05f,
+    -6.01619681e-05f, -4.51159316e-05f, -3.00732142e-05f, -1.50343819e-05f,
+    4.80634781e-18f, 1.50293662e-05f, 3.0053152e-05f, 4.5070793e-05f,
+    6.00817252e-05f, 7.50853852e-05f, 9.00812098e-05f, 0.000105068636f,
+    0.000120047103f, 0.000135016048f, 0.000149974911f, 0.000164923131f,
+    0.000179860148f, 0.000194785403f, 0.000209698338f, 0.000224598393f,
+    0.000239485013f, 0.000254357641f, 0.000269215721f, 0.000284058697f,
+    0.000298886015f, 0.000313697121f, 0.000328491464f, 0.00034326849f,
+    0.000358027649f, 0.000372768391f, 0.000387490165f, 0.000402192423f,
+    0.000416874619f, 0.000431536204f, 0.000446176634f, 0.000460795363f,
+    0.000475391849f, 0.000489965548f, 0.000504515918f, 0.000519042419f,
+    0.000533544512f, 0.000548021658f, 0.000562473319f, 0.00057689896f,
+    0.000591298046f, 0.000605670042f, 0.000620014417f, 0.000634330638f,
+    0.000648618175f, 0.000662876501f, 0.000677105086f, 0.000691303405f,
+    0.000705470932f, 0.000719607145f, 0.00073371152f, 0.000747783537f,
+    0.000761822676f, 0.000775828419f, 0.000789800249f, 0.000803737651f,
+    0.000817640112f, 0.000831507118f, 0.00084533816f, 0.000859132727f,
+    0.000872890313f, 0.00088661041f, 0.000900292515f, 0.000913936125f,
+    0.000927540737f, 0.000941105853f, 0.000954630975f, 0.000968115605f,
+    0.00098155925f, 0.000994961416f, 0.00100832161f, 0.00102163935f,
+    0.00103491414f, 0.00104814549f, 0.00106133293f, 0.00107447597f,
+    0.00108757413f, 0.00110062693f, 0.00111363389f, 0.00112659455f,
+    0.00113950842f, 0.00115237503f, 0.00116519393f, 0.00117796463f,
+    0.00119068667f, 0.0012033596f, 0.00121598294f, 0.00122855625f,
+    0.00124107906f, 0.00125355091f, 0.00126597137f, 0.00127833996f,
+    0.00129065625f, 0.00130291979f, 0.00131513014f, 0.00132728684f,
+    0.00133938947f, 0.00135143758f, 0.00136343074f, 0.00137536851f,
+    0.00138725047f, 0.00139907618f, 0.00141084521f, 0.00142255715f,
+    0.00143421157f, 0.00144580804f, 0.00145734616f, 0.00146882551f,
+    0.00148024566f, 0.00149160623f, 0.00150290678f, 0.00151414693f,
+    0.00152532626f, 0.00153644438f, 0.00154750088f, 0.00155849537f,
+    0.00156942746f, 0.00158029676f, 0.00159110287f, 0.00160184541f,
+    0.001612524f, 0.00162313825f, 0.00163368779f, 0.00164417225f,
+    0.00165459124f, 0.0016649444f, 0.00167523136f, 0.00168545175f,
+    0.00169560521f, 0.00170569139f, 0.00171570991f, 0.00172566044f,
+    0.00173554261f, 0.00174535607f, 0.00175510049f, 0.00176477551f,
+    0.0017743808f, 0.00178391601f, 0.00179338081f, 0.00180277487f,
+    0.00181209785f, 0.00182134943f, 0.00183052929f, 0.00183963709f,
+    0.00184867253f, 0.00185763529f, 0.00186652505f, 0.0018753415f,
+    0.00188408433f, 0.00189275325f, 0.00190134794f, 0.00190986811f,
+    0.00191831347f, 0.00192668371f, 0.00193497855f, 0.00194319771f,
+    0.00195134089f, 0.00195940782f, 0.00196739821f, 0.0019753118f,
+    0.00198314831f, 0.00199090747f, 0.00199858901f, 0.00200619267f,
+    0.00201371819f, 0.00202116532f, 0.00202853379f, 0.00203582336f,
+    0.00204303377f, 0.00205016479f, 0.00205721617f, 0.00206418767f,
+    0.00207107906f, 0.00207789011f, 0.00208462057f, 0.00209127023f,
+    0.00209783887f, 0.00210432626f, 0.00211073218f, 0.00211705643f,
+    0.00212329878f, 0.00212945904f, 0.002135537f, 0.00214153245f,
+    0.00214744521f, 0.00215327506f, 0.00215902183f, 0.00216468532f,
+    0.00217026535f, 0.00217576174f, 0.0021811743f, 0.00218650286f,
+    0.00219174725f, 0.00219690729f, 0.00220198283f, 0.0022069737f,
+    0.00221187974f, 0.00221670079f, 0.0022214367f, 0.00222608732f,
+    0.0022306525f, 0.00223513211f, 0.00223952599f, 0.00224383402f,
+    0.00224805605f, 0.00225219197f, 0.00225624164f, 0.00226020494f,
+    0.00226408175f, 0.00226787194f, 0.00227157542f, 0.00227519206f,
+    0.00227872177f, 0.00228216443f, 0.00228551994f, 0.00228878822f,
+    0.00229196916f, 0.00229506267f, 0.00229806867f, 0.00230098708f,
+    0.0023038178f, 0.00230656078f, 0.00230921592f, 0.00231178317f,
+    0.00231426245f, 0.0023166537f, 0.00231895686f, 0.00232117187f,
+    0.00232329868f, 0.00232533724f, 0.0023272875f, 0.00232914941f,
+    0.00233092295f, 0.00233260806f, 0.00233420472f, 0.00233571289f,
+    0.00233713255f, 0.00233846368f, 0.00233970625f, 0.00234086025f,
+    0.00234192566f, 0.00234290248f, 0.00234379069f, 0.00234459029f,
+    0.00234530129f, 0.00234592368f, 0.00234645747f, 0.00234690267f,
+    0.0023472593f, 0.00234752737f, 0.0023477069f, 0.00234779791f,
+    0.00234780043f, 0.00234771449f, 0.00234754013f, 0.00234727737f,
+    0.00234692626f, 0.00234648684f, 0.00234595916f, 0.00234534327f,
+    0.00234463922f, 0.00234384707f, 0.00234296687f, 0.00234199869f,
+    0.00234094259f, 0.00233979865f, 0.00233856694f, 0.00233724753f,
+    0.0023358405f, 0.00233434593f, 0.00233276392f, 0.00233109455f,
+    0.00232933791f, 0.0023274941f, 0.00232556321f, 0.00232354535f,
+    0.00232144063f, 0.00231924915f, 0.00231697102f, 0.00231460637f,
+    0.0023121553f, 0.00230961794f, 0.00230699441f, 0.00230428485f,
+    0.00230148938f, 0.00229860814f, 0.00229564126f, 0.00229258889f,
+    0.00228945117f, 0.00228622825f, 0.00228292027f, 0.00227952739f,
+    0.00227604977f, 0.00227248756f, 0.00226884094f, 0.00226511005f,
+    0.00226129509f, 0.00225739621f, 0.00225341359f, 0.00224934741f,
+    0.00224519785f, 0.0022409651f, 0.00223664934f, 0.00223225076f,
+    0.00222776956f, 0.00222320594f, 0.00221856009f, 0.00221383222f,
+    0.00220902253f, 0.00220413123f, 0.00219915854f, 0.00219410466f,
+    0.00218896982f, 0.00218375424f, 0.00217845814f, 0.00217308175f,
+    0.00216762529f, 0.00216208901f, 0.00215647313f, 0.0021507779f,
+    0.00214500355f, 0.00213915033f, 0.00213321849f, 0.00212720828f,
+    0.00212111994f, 0.00211495375f, 0.00210870995f, 0.0021023888f,
+    0.00209599058f, 0.00208951555f, 0.00208296397f, 0.00207633612f,
+    0.00206963228f, 0.00206285273f, 0.00205599774f, 0.0020490676f,
+    0.0020420626f, 0.00203498302f, 0.00202782916f, 0.00202060132f,
+    0.00201329978f, 0.00200592485f, 0.00199847684f, 0.00199095604f,
+    0.00198336277f, 0.00197569734f, 0.00196796005f, 0.00196015123f,
+    0.0019522712f, 0.00194432027f, 0.00193629877f, 0.00192820703f,
+    0.00192004537f, 0.00191181412f, 0.00190351363f, 0.00189514422f,
+    0.00188670623f, 0.00187820001f, 0.0018696259f, 0.00186098424f,
+    0.00185227539f, 0.00184349969f, 0.0018346575f, 0.00182574917f,
+    0.00181677506f, 0.00180773554f, 0.00179863096f, 0.00178946169f,
+    0.0017802281f, 0.00177093055f, 0.00176156943f, 0.0017521451f,
+    0.00174265794f, 0.00173310833f, 0.00172349664f, 0.00171382328f,
+    0.00170408861f, 0.00169429302f, 0.00168443692f, 0.00167452068f,
+    0.0016645447f, 0.00165450939f, 0.00164441513f, 0.00163426232f,
+    0.00162405138f, 0.0016137827f, 0.00160345669f, 0.00159307377f,
+    0.00158263433f, 0.00157213879f, 0.00156158757f, 0.00155098109f,
+    0.00154031975f, 0.00152960399f, 0.00151883423f, 0.00150801088f,
+    0.00149713438f, 0.00148620515f, 0.00147522363f, 0.00146419024f,
+    0.00145310541f, 0.00144196959f, 0.00143078321f, 0.00141954671f,
+    0.00140826053f, 0.00139692511f, 0.00138554089f, 0.00137410833f,
+    0.00136262786f, 0.00135109994f, 0.00133952502f, 0.00132790355f,
+    0.00131623599f, 0.00130452278f, 0.00129276438f, 0.00128096127f,
+    0.00126911388f, 0.0012572227f, 0.00124528817f, 0.00123331076f,
+    0.00122129095f, 0.00120922919f, 0.00119712596f, 0.00118498172f,
+    0.00117279695f, 0.00116057212f, 0.00114830771f, 0.00113600418f,
+    0.00112366203f, 0.00111128172f, 0.00109886373f, 0.00108640856f,
+    0.00107391667f, 0.00106138855f, 0.00104882468f, 0.00103622556f,
+    0.00102359167f, 0.0010109235f, 0.000998221525f, 0.00098548625f,
+    0.000972718162f, 0.000959917753f, 0.000947085518f, 0.000934221949f,
+    0.000921327543f, 0.000908402796f, 0.000895448206f, 0.000882464271f,
+    0.00086945149f, 0.000856410363f, 0.000843341393f, 0.000830245079f,
+    0.000817121927f, 0.000803972438f, 0.000790797119f, 0.000777596474f,
+    0.000764371009f, 0.000751121231f, 0.000737847648f, 0.000724550768f,
+    0.000711231101f, 0.000697889155f, 0.000684525442f, 0.000671140473f,
+    0.000657734759f, 0.000644308812f, 0.000630863146f, 0.000617398273f,
+    0.000603914709f, 0.000590412967f, 0.000576893563f, 0.000563357012f,
+    0.00054980383f, 0.000536234533f, 0.000522649639f, 0.000509049665f,
+    0.000495435128f, 0.000481806547f, 0.00046816444f, 0.000454509326f,
+    0.000440841724f, 0.000427162153f, 0.000413471133f, 0.000399769184f,
+    0.000386056826f, 0.000372334579f, 0.000358602965f, 0.000344862503f,
+    0.000331113714f, 0.00031735712f, 0.000303593242f, 0.000289822601f,
+    0.000276045718f, 0.000262263115f, 0.000248475313f, 0.000234682833f,
+    0.000220886198f, 0.000207085928f, 0.000193282545f, 0.000179476569f,
+    0.000165668524f, 0.000151858928f, 0.000138048304f, 0.000124237173f,
+    0.000110426055f, 9.66154701e-05f, 8.28059394e-05f, 6.8997983e-05f,
+    5.51921206e-05f, 4.13888718e-05f, 2.75887562e-05f, 1.37922926e-05f,
+    1.98193659e-17f, -1.37876033e-05f, -2.75699993e-05f, -4.13466701e-05f,
+    -5.51170986e-05f, -6.88807677e-05f, -8.26371611e-05f, -9.63857627e-05f,
+    -0.000110126057f, -0.000123857529f, -0.000137579664f, -0.000151291948f,
+    -0.000164993868f, -0.00017868491f, -0.000192364562f, -0.000206032314f,
+    -0.000219687652f, -0.000233330068f, -0.000246959051f, -0.000260574092f,
+    -0.000274174683f, -0.000287760315f, -0.000301330483f, -0.00031488468f,
+    -0.0003284224f, -0.000341943139f, -0.000355446392f, -0.000368931658f,
+    -0.000382398433f, -0.000395846217f, -0.000409274509f, -0.000422682809f,
+    -0.00043607062f, -0.000449437443f, -0.000462782781f, -0.00047610614f,
+    -0.000489407024f, -0.00050268494f, -0.000515939394f, -0.000529169897f,
+    -0.000542375956f, -0.000555557082f, -0.000568712788f, -0.000581842586f,
+    -0.00059494599f, -0.000608022515f, -0.000621071677f, -0.000634092994f,
+    -0.000647085984f, -0.000660050168f, -0.000672985067f, -0.000685890203f,
+    -0.000698765099f, -0.000711609281f, -0.000724422276f, -0.00073720361f,
+    -0.000749952813f, -0.000762669416f, -0.000775352949f, -0.000788002947f,
+    -0.000800618944f, -0.000813200476f, -0.000825747081f, -0.000838258297f,
+    -0.000850733665f, -0.000863172727f, -0.000875575027f, -0.00088794011f,
+    -0.000900267522f, -0.000912556811f, -0.000924807528f, -0.000937019224f,
+    -0.000949191451f, -0.000961323765f, -0.000973415721f, -0.000985466878f,
+    -0.000997476796f, -0.00100944504f, -0.00102137116f, -0.00103325473f,
+    -0.00104509532f, -0.0010568925f, -0.00106864583f, -0.00108035489f,
+    -0.00109201924f, -0.00110363848f, -0.00111521217f, -0.00112673989f,
+    -0.00113822122f, -0.00114965575f, -0.00116104307f, -0.00117238275f,
+    -0.00118367439f, -0.00119491758f, -0.00120611191f, -0.00121725698f,
+    -0.00122835238f, -0.00123939772f, -0.00125039258f, -0.00126133658f,
+    -0.00127222932f, -0.00128307041f, -0.00129385945f, -0.00130459606f,
+    -0.00131527986f, -0.00132591044f, -0.00133648744f, -0.00134701048f,
+    -0.00135747917f, -0.00136789313f, -0.001378252f, -0.00138855541f,
+    -0.00139880298f, -0.00140899434f, -0.00141912914f, -0.00142920701f,
+    -0.00143922758f, -0.00144919051f, -0.00145909543f, -0.00146894199f,
+    -0.00147872984f, -0.00148845863f, -0.00149812801f, -0.00150773765f,
+    -0.0015172872f, -0.00152677631f, -0.00153620466f, -0.0015455719f,
+    -0.00155487771f, -0.00156412175f, -0.00157330371f, -0.00158242324f,
+    -0.00159148004f, -0.00160047378f, -0.00160940414f, -0.00161827081f,
+    -0.00162707347f, -0.00163581183f, -0.00164448556f, -0.00165309436f,
+    -0.00166163794f, -0.00167011599f, -0.00167852821f, -0.00168687432f,
+    -0.00169515401f, -0.001703367f, -0.001711513f, -0.00171959174f,
+    -0.00172760291f, -0.00173554626f, -0.0017434215f, -0.00175122835f,
+    -0.00175896656f, -0.00176663584f, -0.00177423593f, -0.00178176658f,
+    -0.00178922751f, -0.00179661848f, -0.00180393923f, -0.0018111895f,
+    -0.00181836905f, -0.00182547763f, -0.001832515f, -0.00183948091f,
+    -0.00184637514f, -0.00185319743f, -0.00185994757f, -0.00186662532f,
+    -0.00187323045f, -0.00187976274f, -0.00188622197f, -0.00189260792f,
+    -0.00189892037f, -0.00190515911f, -0.00191132394f, -0.00191741464f,
+    -0.00192343101f, -0.00192937284f, -0.00193523995f, -0.00194103214f,
+    -0.0019467492f, -0.00195239096f, -0.00195795723f, -0.00196344781f,
+    -0.00196886254f, -0.00197420123f, -0.0019794637f, -0.00198464979f,
+    -0.00198975933f, -0.00199479214f, -0.00199974807f, -0.00200462696f,
+    -0.00200942864f, -0.00201415297f, -0.00201879979f, -0.00202336895f,
+    -0.00202786031f, -0.00203227372f, -0.00203660905f, -0.00204086616f,
+    -0.00204504491f, -0.00204914518f, -0.00205316683f, -0.00205710975f,
+    -0.0020609738f, -0.00206475888f, -0.00206846486f, -0.00207209164f,
+    -0.00207563909f, -0.00207910713f, -0.00208249564f, -0.00208580452f,
+    -0.00208903368f, -0.00209218302f, -0.00209525245f, -0.00209824189f,
+    -0.00210115123f, -0.00210398042f, -0.00210672935f, -0.00210939797f,
+    -0.00211198619f, -0.00211449395f, -0.00211692118f, -0.00211926781f,
+    -0.00212153379f, -0.00212371905f, -0.00212582355f, -0.00212784722f,
+    -0.00212979003f, -0.00213165192f, -0.00213343286f, -0.0021351328f,
+    -0.00213675171f, -0.00213828955f, -0.0021397463f, -0.00214112192f,
+    -0.0021424164f, -0.00214362971f, -0.00214476184f, -0.00214581276f,
+    -0.00214678248f, -0.00214767097f, -0.00214847824f, -0.00214920427f,
+    -0.00214984908f, -0.00215041267f, -0.00215089503f, -0.00215129619f,
+    -0.00215161615f, -0.00215185493f, -0.00215201255f, -0.00215208903f,
+    -0.0021520844f, -0.00215199868f, -0.00215183191f, -0.00215158411f,
+    -0.00215125533f, -0.00215084561f, -0.00215035498f, -0.0021497835f,
+    -0.00214913122f, -0.00214839818f, -0.00214758445f, -0.00214669007f,
+    -0.00214571512f, -0.00214465966f, -0.00214352375f, -0.00214230746f,
+    -0.00214101087f, -0.00213963406f, -0.0021381771f, -0.00213664008f,
+    -0.00213502308f, -0.00213332619f, -0.0021315495f, -0.00212969311f,
+    -0.00212775711f, -0.0021257416f, -0.00212364669f, -0.00212147248f,
+    -0.00211921909f, -0.00211688662f, -0.00211447519f, -0.00211198492f,
+    -0.00210941592f, -0.00210676833f, -0.00210404227f, -0.00210123787f,
+    -0.00209835525f, -0.00209539457f, -0.00209235595f, -0.00208923953f,
+    -0.00208604547f, -0.00208277391f, -0.00207942499f, -0.00207599888f,
+    -0.00207249572f, -0.00206891567f, -0.0020652589f, -0.00206152557f,
+    -0.00205771585f, -0.00205382991f, -0.00204986792f, -0.00204583005f,
+    -0.00204171649f, -0.00203752741f, -0.002033263f, -0.00202892344f,
+    -0.00202450893f, -0.00202001966f, -0.00201545582f, -0.00201081761f,
+    -0.00200610522f, -0.00200131887f, -0.00199645876f, -0.0019915251f,
+    -0.0019865181f, -0.00198143796f, -0.00197628492f, -0.00197105919f,
+    -0.00196576098f, -0.00196039054f, -0.00195494807f, -0.00194943381f,
+    -0.00194384801f, -0.00193819088f, -0.00193246267f, -0.00192666361f,
+    -0.00192079396f, -0.00191485395f, -0.00190884384f, -0.00190276388f,
+    -0.00189661431f, -0.0018903954f, -0.0018841074f, -0.00187775057f,
+    -0.00187132518f, -0.00186483149f, -0.00185826977f, -0.0018516403f,
+    -0.00184494334f, -0.00183817917f, -0.00183134806f, -0.00182445031f,
+    -0.00181748619f, -0.00181045598f, -0.00180335998f, -0.00179619848f,
+    -0.00178897176f, -0.00178168012f, -0.00177432387f, -0.00176690329f,
+    -0.0017594187f, -0.00175187038f, -0.00174425867f, -0.00173658385f,
+    -0.00172884624f, -0.00172104615f, -0.00171318391f, -0.00170525983f,
+    -0.00169727422f, -0.00168922741f, -0.00168111973f, -0.00167295149f,
+    -0.00166472304f, -0.0016564347f, -0.0016480868f, -0.00163967968f,
+    -0.00163121367f, -0.00162268912f, -0.00161410637f, -0.00160546576f,
+    -0.00159676763f, -0.00158801234f, -0.00157920023f, -0.00157033166f,
+    -0.00156140697f, -0.00155242653f, -0.0015433907f, -0.00153429982f,
+    -0.00152515427f, -0.0015159544f, -0.00150670059f, -0.0014973932f,
+    -0.0014880326f, -0.00147861915f, -0.00146915324f, -0.00145963524f,
+    -0.00145006553f, -0.00144044448f, -0.00143077247f, -0.00142104989f,
+    -0.00141127712f, -0.00140145454f, -0.00139158255f, -0.00138166153f,
+    -0.00137169187f, -0.00136167397f, -0.00135160822f, -0.00134149501f,
+    -0.00133133475f, -0.00132112783f, -0.00131087465f, -0.00130057562f,
+    -0.00129023114f, -0.00127984161f, -0.00126940745f, -0.00125892905f,
+    -0.00124840684f, -0.00123784123f, -0.00122723261f, -0.00121658142f,
+    -0.00120588807f, -0.00119515297f, -0.00118437655f, -0.00117355922f,
+    -0.0011627014f, -0.00115180353f, -0.00114086602f, -0.0011298893f,
+    -0.00111887379f, -0.00110781994f, -0.00109672815f, -0.00108559888f,
+    -0.00107443254f, -0.00106322958f, -0.00105199042f, -0.00104071551f,
+    -0.00102940528f, -0.00101806017f, -0.00100668062f, -0.000995267067f,
+    -0.000983819959f, -0.000972339735f, -0.000960826841f, -0.000949281721f,
+    -0.000937704823f, -0.000926096592f, -0.000914457479f, -0.000902787931f,
+    -0.000891088399f, -0.000879359335f, -0.000867601191f, -0.000855814421f,
+    -0.000843999477f, -0.000832156817f, -0.000820286894f, -0.000808390167f,
+    -0.000796467092f, -0.000784518129f, -0.000772543737f, -0.000760544375f,
+    -0.000748520505f, -0.000736472589f, -0.000724401089f, -0.000712306467f,
+    -0.000700189188f, -0.000688049717f, -0.000675888518f, -0.000663706058f,
+    -0.000651502803f, -0.00063927922f, -0.000627035777f, -0.000614772943f,
+    -0.000602491186f, -0.000590190975f, -0.000577872781f, -0.000565537075f,
+    -0.000553184326f, -0.000540815008f, -0.000528429591f, -0.000516028548f,
+    -0.000503612352f, -0.000491181476f, -0.000478736394f, -0.00046627758f,
+    -0.000453805508f, -0.000441320652f, -0.000428823489f, -0.000416314492f,
+    -0.000403794139f, -0.000391262903f, -0.000378721263f, -0.000366169693f,
+    -0.000353608671f, -0.000341038673f, -0.000328460176f, -0.000315873657f,
+    -0.000303279594f, -0.000290678463f, -0.000278070743f, -0.00026545691f,
+    -0.000252837441f, -0.000240212816f, -0.000227583511f, -0.000214950004f,
+    -0.000202312773f, -0.000189672294f, -0.000177029047f, -0.000164383508f,
+    -0.000151736155f, -0.000139087464f, -0.000126437914f, -0.000113787982f,
+    -0.000101138143f, -8.84888761e-05f, -7.58406565e-05f, -6.31939609e-05f,
+    -5.05492655e-05f, -3.79070462e-05f, -2.52677787e-05f, -1.26319382e-05f,
+    -4.03420653e-17f, 1.26275612e-05f, 2.52502711e-05f, 3.78676554e-05f,
+    5.04792404e-05f, 6.30845529e-05f, 7.56831198e-05f, 8.82744687e-05f,
+    0.000100858127f, 0.000113433624f, 0.000126000488f, 0.000138558248f,
+    0.000151106435f, 0.000163644578f, 0.000176172208f, 0.000188688857f,
+    0.000201194058f, 0.000213687341f, 0.000226168242f, 0.000238636293f,
+    0.000251091029f, 0.000263531985f, 0.000275958698f, 0.000288370703f,
+    0.000300767538f, 0.000313148741f, 0.000325513851f, 0.000337862407f,
+    0.00035019395f, 0.00036250802f, 0.00037480416f, 0.000387081912f,
+    0.00039934082f, 0.000411580428f, 0.000423800282f, 0.000435999928f,
+    0.000448178913f, 0.000460336785f, 0.000472473094f, 0.000484587389f,
+    0.000496679221f, 0.000508748143f, 0.000520793707f, 0.000532815468f,
+    0.00054481298f, 0.0005567858f, 0.000568733486f, 0.000580655595f,
+    0.000592551687f, 0.000604421323f, 0.000616264064f, 0.000628079473f,
+    0.000639867116f, 0.000651626556f, 0.00066335736f, 0.000675059097f,
+    0.000686731335f, 0.000698373645f, 0.000709985598f, 0.000721566767f,
+    0.000733116725f, 0.00074463505f, 0.000756121317f, 0.000767575105f,
+    0.000778995993f, 0.000790383562f, 0.000801737394f, 0.000813057074f,
+    0.000824342186f, 0.000835592318f, 0.000846807057f, 0.000857985992f,
+    0.000869128716f, 0.000880234819f, 0.000891303898f, 0.000902335547f,
+    0.000913329363f, 0.000924284945f, 0.000935201894f, 0.000946079811f,
+    0.0009569183f, 0.000967716967f, 0.000978475417f, 0.00098919326f,
+    0.000999870105f, 0.00101050557f, 0.00102109925f, 0.00103165078f,
+    0.00104215977f, 0.00105262584f, 0.00106304861f, 0.0010734277f,
+    0.00108376274f, 0.00109405335f, 0.00110429915f, 0.00111449978f,
+    0.00112465488f, 0.00113476406f, 0.00114482697f, 0.00115484325f,
+    0.00116481253f, 0.00117473445f, 0.00118460866f, 0.0011944348f,
+    0.00120421251f, 0.00121394145f, 0.00122362127f, 0.00123325161f,
+    0.00124283213f, 0.0012523625f, 0.00126184235f, 0.00127127137f,
+    0.0012806492f, 0.00128997551f, 0.00129924998f, 0.00130847226f,
+    0.00131764203f, 0.00132675896f, 0.00133582273f, 0.00134483301f,
+    0.00135378948f, 0.00136269182f, 0.00137153972f, 0.00138033286f,
+    0.00138907093f, 0.00139775362f, 0.00140638062f, 0.00141495163f,
+    0.00142346633f, 0.00143192444f, 0.00144032565f, 0.00144866966f,
+    0.00145695618f, 0.00146518491f, 0.00147335558f, 0.00148146788f,
+    0.00148952154f, 0.00149751627f, 0.00150545179f, 0.00151332782f,
+    0.00152114409f, 0.00152890032f, 0.00153659623f, 0.00154423157f,
+    0.00155180607f, 0.00155931945f, 0.00156677146f, 0.00157416184f,
+    0.00158149033f, 0.00158875668f, 0.00159596063f, 0.00160310194f,
+    0.00161018035f, 0.00161719563f, 0.00162414753f, 0.00163103581f,
+    0.00163786023f, 0.00164462056f, 0.00165131656f, 0.00165794801f,
+    0.00166451468f, 0.00167101634f, 0.00167745277f, 0.00168382375f,
+    0.00169012906f, 0.00169636849f, 0.00170254183f, 0.00170864887f,
+    0.00171468939f, 0.0017206632f, 0.0017265701f, 0.00173240987f,
+    0.00173818234f, 0.0017438873f, 0.00174952455f, 0.00175509393f,
+    0.00176059522f, 0.00176602826f, 0.00177139287f, 0.00177668885f,
+    0.00178191604f, 0.00178707427f, 0.00179216336f, 0.00179718315f,
+    0.00180213347f, 0.00180701416f, 0.00181182506f, 0.00181656602f,
+    0.00182123687f, 0.00182583746f, 0.00183036766f, 0.0018348273f,
+    0.00183921626f, 0.00184353438f, 0.00184778153f, 0.00185195757f,
+    0.00185606238f, 0.00186009582f, 0.00186405776f, 0.00186794808f,
+    0.00187176666f, 0.00187551338f, 0.00187918812f, 0.00188279078f,
+    0.00188632123f, 0.00188977937f, 0.0018931651f, 0.00189647832f,
+    0.00189971891f, 0.0019028868f, 0.00190598188f, 0.00190900406f,
+    0.00191195326f, 0.00191482938f, 0.00191763235f, 0.00192036208f,
+    0.00192301851f, 0.00192560154f, 0.00192811112f, 0.00193054717f,
+    0.00193290962f, 0.00193519842f, 0.0019374135f, 0.00193955481f,
+    0.00194162229f, 0.00194361588f, 0.00194553555f, 0.00194738123f,
+    0.00194915289f, 0.00195085049f, 0.00195247399f, 0.00195402336f,
+    0.00195549855f, 0.00195689955f, 0.00195822632f, 0.00195947884f,
+    0.00196065709f, 0.00196176106f, 0.00196279071f, 0.00196374606f,
+    0.00196462707f, 0.00196543375f, 0.00196616609f, 0.00196682408f,
+    0.00196740774f, 0.00196791707f, 0.00196835206f, 0.00196871273f,
+    0.0019689991f, 0.00196921118f, 0.00196934898f, 0.00196941253f,
+    0.00196940185f, 0.00196931697f, 0.00196915791f, 0.00196892471f,
+    0.00196861741f, 0.00196823603f, 0.00196778063f, 0.00196725124f,
+    0.00196664791f, 0.00196597068f, 0.00196521962f, 0.00196439477f,
+    0.00196349619f, 0.00196252394f, 0.00196147808f, 0.00196035868f,
+    0.00195916581f, 0.00195789953f, 0.00195655992f, 0.00195514706f,
+    0.00195366102f, 0.00195210189f, 0.00195046975f, 0.00194876469f,
+    0.0019469868f, 0.00194513616f, 0.00194321288f, 0.00194121706f,
+    0.00193914879f, 0.00193700817f, 0.00193479532f, 0.00193251034f,
+    0.00193015334f, 0.00192772444f, 0.00192522376f, 0.0019226514f,
+    0.00192000751f, 0.00191729219f, 0.00191450558f, 0.00191164781f,
+    0.00190871901f, 0.00190571931f, 0.00190264886f, 0.00189950779f,
+    0.00189629625f, 0.00189301438f, 0.00188966233f, 0.00188624026f,
+    0.00188274831f, 0.00187918664f, 0.00187555541f, 0.00187185478f,
+    0.00186808492f, 0.00186424599f, 0.00186033816f, 0.0018563616f,
+    0.00185231649f, 0.001848203f, 0.00184402131f, 0.0018397716f,
+    0.00183545406f, 0.00183106888f, 0.00182661624f, 0.00182209633f,
+    0.00181750935f, 0.00181285549f, 0.00180813496f, 0.00180334795f,
+    0.00179849467f, 0.00179357532f, 0.00178859011f, 0.00178353926f,
+    0.00177842298f, 0.00177324148f, 0.00176799498f, 0.00176268371f,
+    0.00175730788f, 0.00175186771f, 0.00174636345f, 0.00174079531f,
+    0.00173516353f, 0.00172946835f, 0.00172371f, 0.00171788872f,
+    0.00171200475f, 0.00170605834f, 0.00170004973f, 0.00169397916f,
+    0.0016878469f, 0.0016816532f, 0.0016753983f, 0.00166908246f,
+    0.00166270596f, 0.00165626904f, 0.00164977196f, 0.00164321501f,
+    0.00163659844f, 0.00162992253f, 0.00162318754f, 0.00161639375f,
+    0.00160954145f, 0.0016026309f, 0.00159566239f, 0.0015886362f,
+    0.00158155262f, 0.00157441193f, 0.00156721443f, 0.0015599604f,
+    0.00155265013f, 0.00154528393f, 0.00153786209f, 0.00153038491f,
+    0.00152285269f, 0.00151526573f, 0.00150762434f, 0.00149992883f,
+    0.00149217951f, 0.00148437668f, 0.00147652065f, 0.00146861176f,
+    0.0014606503f, 0.0014526366f, 0.00144457098f, 0.00143645377f,
+    0.00142828528f, 0.00142006584f, 0.00141179578f, 0.00140347543f,
+    0.00139510512f, 0.00138668518f, 0.00137821596f, 0.00136969777f,
+    0.00136113097f, 0.00135251589f, 0.00134385288f, 0.00133514227f,
+    0.00132638442f, 0.00131757967f, 0.00130872837f, 0.00129983086f,
+    0.0012908875f, 0.00128189865f, 0.00127286465f, 0.00126378587f,
+    0.00125466266f, 0.00124549539f, 0.0012362844f, 0.00122703007f,
+    0.00121773276f, 0.00120839283f, 0.00119901066f, 0.0011895866f,
+    0.00118012104f, 0.00117061434f, 0.00116106687f, 0.00115147901f,
+    0.00114185114f, 0.00113218362f, 0.00112247685f, 0.00111273119f,
+    0.00110294704f, 0.00109312477f, 0.00108326476f, 0.00107336741f,
+    0.00106343309f, 0.0010534622f, 0.00104345512f, 0.00103341224f,
+    0.00102333396f, 0.00101322067f, 0.00100307275f, 0.000992890612f,
+    0.000982674644f, 0.000972425244f, 0.00096214281f, 0.000951827741f,
+    0.000941480438f, 0.000931101301f, 0.000920690734f, 0.000910249139f,
+    0.000899776922f, 0.000889274487f, 0.000878742242f, 0.000868180593f,
+    0.000857589949f, 0.00084697072f, 0.000836323316f, 0.000825648148f,
+    0.000814945629f, 0.00080421617f, 0.000793460187f, 0.000782678094f,
+    0.000771870307f, 0.000761037242f, 0.000750179316f, 0.000739296947f,
+    0.000728390554f, 0.000717460557f, 0.000706507376f, 0.000695531432f,
+    0.000684533147f, 0.000673512942f, 0.000662471242f, 0.00065140847f,
+    0.000640325051f, 0.000629221408f, 0.000618097969f, 0.00060695516f,
+    0.000595793406f, 0.000584613136f, 0.000573414778f, 0.000562198759f,
+    0.00055096551f, 0.000539715459f, 0.000528449036f, 0.000517166673f,
+    0.000505868799f, 0.000494555846f, 0.000483228246f, 0.000471886431f,
+    0.000460530833f, 0.000449161886f, 0.000437780022f, 0.000426385675f,
+    0.00041497928f, 0.00040356127f, 0.000392132079f, 0.000380692143f,
+    0.000369241896f, 0.000357781774f, 0.000346312212f, 0.000334833646f,
+    0.000323346511f, 0.000311851244f, 0.000300348281f, 0.000288838058f,
+    0.000277321011f, 0.000265797578f, 0.000254268194f, 0.000242733296f,
+    0.000231193321f, 0.000219648706f, 0.000208099888f, 0.000196547303f,
+    0.000184991388f, 0.00017343258f, 0.000161871315f, 0.000150308031f,
+    0.000138743164f, 0.00012717715f, 0.000115610425f, 0.000104043427f,
+    9.24765904e-05f, 8.09103517e-05f, 6.93451468e-05f, 5.7781411e-05f,
+    4.62195799e-05f, 3.46600885e-05f, 2.31033716e-05f, 1.1549864e-05f,
+    3.68535537e-18f, -1.15457864e-05f, -2.30870613e-05f, -3.46233915e-05f,
+    -4.61543436e-05f, -5.76794852e-05f, -6.91983836e-05f, -8.07106071e-05f,
+    -9.2215724e-05f, -0.000103713303f, -0.000115202914f, -0.000126684126f,
+    -0.000138156509f, -0.000149619635f, -0.000161073074f, -0.000172516398f,
+    -0.000183949179f, -0.00019537099f, -0.000206781405f, -0.000218179997f,
+    -0.000229566341f, -0.000240940012f, -0.000252300586f, -0.000263647639f,
+    -0.000274980748f, -0.000286299492f, -0.000297603448f, -0.000308892195f,
+    -0.000320165314f, -0.000331422385f, -0.000342662989f, -0.000353886709f,
+    -0.000365093128f, -0.000376281828f, -0.000387452396f, -0.000398604415f,
+    -0.000409737473f, -0.000420851156f, -0.000431945052f, -0.00044301875f,
+    -0.00045407184f, -0.000465103913f, -0.000476114559f, -0.000487103373f,
+    -0.000498069946f, -0.000509013874f, -0.000519934752f, -0.000530832177f,
+    -0.000541705746f, -0.000552555058f, -0.000563379712f, -0.000574179309f,
+    -0.000584953452f, -0.000595701742f, -0.000606423783f, -0.000617119182f,
+    -0.000627787544f, -0.000638428476f, -0.000649041588f, -0.000659626488f,
+    -0.000670182789f, -0.000680710102f, -0.000691208041f, -0.00070167622f,
+    -0.000712114255f, -0.000722521765f, -0.000732898366f, -0.000743243679f,
+    -0.000753557325f, -0.000763838926f, -0.000774088107f, -0.000784304492f,
+    -0.000794487708f, -0.000804637383f, -0.000814753146f, -0.000824834628f,
+    -0.00083488146f, -0.000844893278f, -0.000854869715f, -0.000864810407f,
+    -0.000874714994f, -0.000884583114f, -0.000894414409f, -0.000904208521f,
+    -0.000913965093f, -0.000923683771f, -0.000933364204f, -0.000943006038f,
+    -0.000952608924f, -0.000962172515f, -0.000971696463f, -0.000981180424f,
+    -0.000990624055f, -0.00100002701f, -0.00100938896f, -0.00101870955f,
+    -0.00102798846f, -0.00103722535f, -0.00104641987f, -0.00105557172f,
+    -0.00106468054f, -0.00107374602f, -0.00108276783f, -0.00109174564f,
+    -0.00110067914f, -0.00110956799f, -0.00111841188f, -0.0011272105f,
+    -0.00113596353f, -0.00114467065f, -0.00115333155f, -0.00116194592f,
+    -0.00117051346f, -0.00117903385f, -0.0011875068f, -0.001195932f,
+    -0.00120430915f, -0.00121263794f, -0.0012209181f, -0.00122914931f,
+    -0.00123733129f, -0.00124546374f, -0.00125354638f, -0.00126157893f,
+    -0.00126956108f, -0.00127749257f, -0.0012853731f, -0.00129320241f,
+    -0.00130098022f, -0.00130870624f, -0.00131638021f, -0.00132400185f,
+    -0.00133157091f, -0.0013390871f, -0.00134655017f, -0.00135395986f,
+    -0.00136131589f, -0.00136861802f, -0.00137586599f, -0.00138305955f,
+    -0.00139019844f, -0.00139728241f, -0.00140431122f, -0.00141128462f,
+    -0.00141820236f, -0.00142506422f, -0.00143186994f, -0.00143861929f,
+    -0.00144531203f, -0.00145194795f, -0.00145852679f, -0.00146504834f,
+    -0.00147151238f, -0.00147791867f, -0.001484267f, -0.00149055714f,
+    -0.00149678889f, -0.00150296203f, -0.00150907634f, -0.00151513161f,
+    -0.00152112765f, -0.00152706424f, -0.00153294118f, -0.00153875827f,
+    -0.00154451532f, -0.00155021212f, -0.00155584849f, -0.00156142422f,
+    -0.00156693915f, -0.00157239307f, -0.0015777858f, -0.00158311717f,
+    -0.00158838699f, -0.00159359509f, -0.00159874129f, -0.00160382541f,
+    -0.0016088473f, -0.00161380679f, -0.0016187037f, -0.00162353788f,
+    -0.00162830916f, -0.00163301739f, -0.00163766242f, -0.00164224409f,
+    -0.00164676225f, -0.00165121675f, -0.00165560745f, -0.0016599342f,
+    -0.00166419687f, -0.00166839532f, -0.0016725294f, -0.001676599f,
+    -0.00168060397f, -0.0016845442f, -0.00168841955f, -0.0016922299f,
+    -0.00169597513f, -0.00169965512f, -0.00170326976f, -0.00170681894f,
+    -0.00171030254f, -0.00171372045f, -0.00171707258f, -0.00172035881f,
+    -0.00172357905f, -0.0017267332f, -0.00172982116f, -0.00173284284f,
+    -0.00173579815f, -0.00173868701f, -0.00174150932f, -0.00174426501f,
+    -0.001746954f, -0.0017495762f, -0.00175213154f, -0.00175461995f,
+    -0.00175704136f, -0.0017593957f, -0.00176168291f, -0.00176390292f,
+    -0.00176605568f, -0.00176814113f, -0.00177015921f, -0.00177210987f,
+    -0.00177399306f, -0.00177580873f, -0.00177755685f, -0.00177923736f,
+    -0.00178085024f, -0.00178239543f, -0.00178387292f, -0.00178528265f,
+    -0.00178662462f, -0.00178789879f, -0.00178910513f, -0.00179024363f,
+    -0.00179131427f, -0.00179231703f, -0.00179325189f, -0.00179411885f,
+    -0.0017949179f, -0.00179564903f, -0.00179631224f, -0.00179690753f,
+    -0.00179743489f, -0.00179789434f, -0.00179828588f, -0.00179860951f,
+    -0.00179886526f, -0.00179905314f, -0.00179917316f, -0.00179922534f,
+    -0.00179920971f, -0.00179912628f, -0.0017989751f, -0.00179875618f,
+    -0.00179846956f, -0.00179811528f, -0.00179769336f, -0.00179720386f,
+    -0.00179664682f, -0.00179602227f, -0.00179533027f, -0.00179457086f,
+    -0.00179374411f, -0.00179285006f, -0.00179188878f, -0.00179086031f,
+    -0.00178976473f, -0.00178860211f, -0.0017873725f, -0.00178607598f,
+    -0.00178471262f, -0.0017832825f, -0.00178178569f, -0.00178022228f,
+    -0.00177859234f, -0.00177689597f, -0.00177513324f, -0.00177330426f,
+    -0.00177140911f, -0.00176944788f, -0.00176742068f, -0.00176532761f,
+    -0.00176316876f, -0.00176094425f, -0.00175865418f, -0.00175629865f,
+    -0.00175387779f, -0.0017513917f, -0.0017488405f, -0.00174622432f,
+    -0.00174354327f, -0.00174079748f, -0.00173798708f, -0.00173511219f,
+    -0.00173217294f, -0.00172916947f, -0.00172610192f, -0.00172297042f,
+    -0.00171977512f, -0.00171651615f, -0.00171319367f, -0.00170980781f,
+    -0.00170635874f, -0.0017028466f, -0.00169927156f, -0.00169563375f,
+    -0.00169193336f, -0.00168817053f, -0.00168434543f, -0.00168045823f,
+    -0.00167650909f, -0.0016724982f, -0.00166842571f, -0.00166429181f,
+    -0.00166009668f, -0.00165584049f, -0.00165152342f, -0.00164714567f,
+    -0.00164270741f, -0.00163820884f, -0.00163365015f, -0.00162903152f,
+    -0.00162435317f, -0.00161961527f, -0.00161481804f, -0.00160996168f,
+    -0.00160504639f, -0.00160007237f, -0.00159503983f, -0.001589949f,
+    -0.00158480007f, -0.00157959326f, -0.00157432879f, -0.00156900688f,
+    -0.00156362776f, -0.00155819163f, -0.00155269873f, -0.00154714929f,
+    -0.00154154353f, -0.00153588169f, -0.001530164f, -0.0015243907f,
+    -0.00151856202f, -0.0015126782f, -0.00150673948f, -0.00150074611f,
+    -0.00149469834f, -0.0014885964f, -0.00148244056f, -0.00147623105f,
+    -0.00146996814f, -0.00146365208f, -0.00145728313f, -0.00145086154f,
+    -0.00144438757f, -0.0014378615f, -0.00143128358f, -0.00142465408f,
+    -0.00141797326f, -0.00141124141f, -0.00140445878f, -0.00139762567f,
+    -0.00139074233f, -0.00138380904f, -0.0013768261f, -0.00136979377f,
+    -0.00136271234f, -0.0013555821f, -0.00134840333f, -0.00134117632f,
+    -0.00133390135f, -0.00132657873f, -0.00131920874f, -0.00131179168f,
+    -0.00130432784f, -0.00129681752f, -0.00128926103f, -0.00128165866f,
+    -0.00127401071f, -0.0012663175f, -0.00125857932f, -0.00125079649f,
+    -0.00124296931f, -0.0012350981f, -0.00122718317f, -0.00121922482f,
+    -0.00121122339f, -0.00120317918f, -0.00119509251f, -0.0011869637f,
+    -0.00117879308f, -0.00117058096f, -0.00116232768f, -0.00115403355f,
+    -0.00114569891f, -0.00113732408f, -0.0011289094f, -0.00112045519f,
+    -0.00111196178f, -0.00110342952f, -0.00109485874f, -0.00108624977f,
+    -0.00107760295f, -0.00106891863f, -0.00106019714f, -0.00105143882f,
+    -0.00104264402f, -0.00103381308f, -0.00102494635f, -0.00101604418f,
+    -0.00100710691f, -0.000998134891f, -0.000989128477f, -0.00098008802f,
+    -0.000971013871f, -0.000961906385f, -0.000952765916f, -0.000943592822f,
+    -0.000934387459f, -0.000925150187f, -0.000915881364f, -0.000906581352f,
+    -0.000897250513f, -0.000887889208f, -0.000878497802f, -0.00086907666f,
+    -0.000859626147f, -0.00085014663f, -0.000840638477f, -0.000831102056f,
+    -0.000821537738f, -0.000811945892f, -0.00080232689f, -0.000792681105f,
+    -0.000783008909f, -0.000773310676f, -0.000763586783f, -0.000753837603f,
+    -0.000744063514f, -0.000734264893f, -0.000724442118f, -0.000714595569f,
+    -0.000704725624f, -0.000694832664f, -0.000684917071f, -0.000674979227f,
+    -0.000665019513f, -0.000655038313f, -0.000645036011f, -0.000635012992f,
+    -0.000624969641f, -0.000614906344f, -0.000604823486f, -0.000594721457f,
+    -0.000584600642f, -0.00057446143f, -0.00056430421f, -0.000554129372f,
+    -0.000543937304f, -0.000533728399f, -0.000523503045f, -0.000513261635f,
+    -0.000503004561f, -0.000492732215f, -0.000482444989f, -0.000472143276f,
+    -0.000461827471f, -0.000451497966f, -0.000441155157f, -0.000430799438f,
+    -0.000420431203f, -0.000410050849f, -0.00039965877f, -0.000389255363f,
+    -0.000378841024f, -0.000368416149f, -0.000357981135f, -0.00034753638f,
+    -0.00033708228f, -0.000326619232f, -0.000316147635f, -0.000305667886f,
+    -0.000295180383f, -0.000284685524f, -0.000274183707f, -0.000263675331f,
+    -0.000253160794f, -0.000242640495f, -0.000232114833f, -0.000221584205f,
+    -0.000211049011f, -0.00020050965f, -0.00018996652f, -0.000179420019f,
+    -0.000168870548f, -0.000158318504f, -0.000147764286f, -0.000137208293f,
+    -0.000126650924f, -0.000116092576f, -0.000105533648f, -9.49745381e-05f,
+    -8.44156448e-05f, -7.38573658e-05f, -6.33000989e-05f, -5.27442416e-05f,
+    -4.21901912e-05f, -3.16383451e-05f, -2.10891001e-05f, -1.05428529e-05f,
+    -2.18842409e-17f, 1.05390624e-05f, 2.10739385e-05f, 3.16042327e-05f,
+    4.21295496e-05f, 5.26494943e-05f, 6.31636723e-05f, 7.36716892e-05f,
+    8.41731512e-05f, 9.46676648e-05f, 0.000105154837f, 0.000115634275f,
+    0.000126105587f, 0.00013656838f, 0.000147022265f, 0.000157466848f,
+    0.000167901742f, 0.000178326554f, 0.000188740897f, 0.000199144382f,
+    0.000209536619f, 0.000219917222f, 0.000230285803f, 0.000240641977f,
+    0.000250985356f, 0.000261315556f, 0.000271632192f, 0.00028193488f,
+    0.000292223236f, 0.000302496879f, 0.000312755426f, 0.000322998496f,
+    0.000333225708f, 0.000343436683f, 0.000353631041f, 0.000363808405f,
+    0.000373968396f, 0.000384110638f, 0.000394234756f, 0.000404340373f,
+    0.000414427116f, 0.000424494611f, 0.000434542486f, 0.00044457037f,
+    0.00045457789f, 0.000464564678f, 0.000474530364f, 0.000484474581f,
+    0.000494396961f, 0.000504297138f, 0.000514174748f, 0.000524029424f,
+    0.000533860806f, 0.00054366853f, 0.000553452235f, 0.000563211561f,
+    0.000572946149f, 0.000582655641f, 0.00059233968f, 0.00060199791f,
+    0.000611629976f, 0.000621235526f, 0.000630814205f, 0.000640365663f,
+    0.00064988955f, 0.000659385517f, 0.000668853215f, 0.000678292298f,
+    0.000687702421f, 0.000697083239f, 0.000706434409f, 0.000715755589f,
+    0.00072504644f, 0.000734306621f, 0.000743535794f, 0.000752733624f,
+    0.000761899774f, 0.00077103391f, 0.0007801357f, 0.000789204812f,
+    0.000798240916f, 0.000807243684f, 0.000816212787f, 0.000825147901f,
+    0.000834048701f, 0.000842914863f, 0.000851746065f, 0.000860541989f,
+    0.000869302313f, 0.000878026723f, 0.0008867149f, 0.000895366531f,
+    0.000903981304f, 0.000912558906f, 0.000921099028f, 0.00092960136f,
+    0.000938065598f, 0.000946491434f, 0.000954878566f, 0.000963226691f,
+    0.000971535509f, 0.00097980472f, 0.000988034027f, 0.000996223134f,
+    0.00100437175f, 0.00101247958f, 0.00102054633f, 0.00102857171f,
+    0.00103655544f, 0.00104449723f, 0.00105239679f, 0.00106025385f,
+    0.00106806812f, 0.00107583933f, 0.00108356719f, 0.00109125143f,
+    0.00109889177f, 0.00110648795f, 0.0011140397f, 0.00112154674f,
+    0.00112900881f, 0.00113642564f, 0.00114379697f, 0.00115112254f,
+    0.00115840209f, 0.00116563536f, 0.0011728221f, 0.00117996205f,
+    0.00118705495f, 0.00119410057f, 0.00120109864f, 0.00120804893f,
+    0.00121495119f, 0.00122180517f, 0.00122861064f, 0.00123536735f,
+    0.00124207508f, 0.00124873357f, 0.00125534261f, 0.00126190196f,
+    0.00126841139f, 0.00127487067f, 0.00128127957f, 0.00128763789f,
+    0.00129394538f, 0.00130020184f, 0.00130640704f, 0.00131256077f,
+    0.00131866282f, 0.00132471298f, 0.00133071103f, 0.00133665677f,
+    0.00134255f, 0.0013483905f, 0.00135417809f, 0.00135991256f,
+    0.00136559371f, 0.00137122135f, 0.00137679528f, 0.00138231532f,
+    0.00138778128f, 0.00139319297f, 0.0013985502f, 0.0014038528f,
+    0.00140910058f, 0.00141429337f, 0.00141943098f, 0.00142451325f,
+    0.00142954001f, 0.00143451108f, 0.0014394263f, 0.0014442855f,
+    0.00144908852f, 0.0014538352f, 0.00145852538f, 0.00146315891f,
+    0.00146773562f, 0.00147225538f, 0.00147671802f, 0.0014811234f,
+    0.00148547138f, 0.00148976181f, 0.00149399455f, 0.00149816946f,
+    0.00150228641f, 0.00150634526f, 0.00151034589f, 0.00151428815f,
+    0.00151817192f, 0.00152199708f, 0.00152576351f, 0.00152947108f,
+    0.00153311968f, 0.00153670918f, 0.00154023948f, 0.00154371047f,
+    0.00154712202f, 0.00155047405f, 0.00155376644f, 0.00155699909f,
+    0.00156017189f, 0.00156328476f, 0.0015663376f, 0.00156933031f,
+    0.00157226279f, 0.00157513498f, 0.00157794677f, 0.00158069808f,
+    0.00158338883f, 0.00158601894f, 0.00158858834f, 0.00159109694f,
+    0.00159354469f, 0.00159593149f, 0.0015982573f, 0.00160052204f,
+    0.00160272565f, 0.00160486807f, 0.00160694924f, 0.0016089691f,
+    0.0016109276f, 0.00161282469f, 0.00161466032f, 0.00161643444f,
+    0.001618147f, 0.00161979798f, 0.00162138731f, 0.00162291498f,
+    0.00162438094f, 0.00162578516f, 0.0016271276f, 0.00162840825f,
+    0.00162962707f, 0.00163078405f, 0.00163187915f, 0.00163291237f,
+    0.00163388368f, 0.00163479307f, 0.00163564052f, 0.00163642604f,
+    0.00163714961f, 0.00163781123f, 0.00163841089f, 0.0016389486f,
+    0.00163942435f, 0.00163983816f, 0.00164019002f, 0.00164047995f,
+    0.00164070796f, 0.00164087407f, 0.00164097828f, 0.00164102062f,
+    0.0016410011f, 0.00164091976f, 0.00164077662f, 0.0016405717f,
+    0.00164030503f, 0.00163997666f, 0.0016395866f, 0.0016391349f,
+    0.00163862161f, 0.00163804675f, 0.00163741038f, 0.00163671253f,
+    0.00163595327f, 0.00163513264f, 0.00163425069f, 0.00163330747f,
+    0.00163230306f, 0.0016312375f, 0.00163011086f, 0.00162892321f,
+    0.0016276746f, 0.00162636511f, 0.00162499482f, 0.00162356379f,
+    0.0016220721f, 0.00162051983f, 0.00161890706f, 0.00161723387f,
+    0.00161550035f, 0.00161370658f, 0.00161185266f, 0.00160993867f,
+    0.00160796472f, 0.00160593088f, 0.00160383728f, 0.001601684f,
+    0.00159947114f, 0.00159719882f, 0.00159486714f, 0.0015924762f,
+    0.00159002613f, 0.00158751703f, 0.00158494903f, 0.00158232223f,
+    0.00157963676f, 0.00157689275f, 0.00157409031f, 0.00157122957f,
+    0.00156831067f, 0.00156533373f, 0.00156229889f, 0.00155920628f,
+    0.00155605604f, 0.00155284831f, 0.00154958323f, 0.00154626095f,
+    0.0015428816f, 0.00153944535f, 0.00153595234f, 0.00153240272f,
+    0.00152879664f, 0.00152513427f, 0.00152141576f, 0.00151764127f,
+    0.00151381096f, 0.00150992501f, 0.00150598357f, 0.00150198681f,
+    0.00149793491f, 0.00149382804f, 0.00148966637f, 0.00148545008f,
+    0.00148117935f, 0.00147685436f, 0.00147247529f, 0.00146804232f,
+    0.00146355565f, 0.00145901546f, 0.00145442195f, 0.0014497753f,
+    0.0014450757f, 0.00144032337f, 0.00143551849f, 0.00143066126f,
+    0.00142575189f, 0.00142079058f, 0.00141577754f, 0.00141071297f,
+    0.00140559708f, 0.0014004301f, 0.00139521221f, 0.00138994366f,
+    0.00138462464f, 0.00137925539f, 0.00137383611f, 0.00136836704f,
+    0.00136284839f, 0.0013572804f, 0.00135166329f, 0.00134599729f,
+    0.00134028264f, 0.00133451955f, 0.00132870828f, 0.00132284905f,
+    0.00131694211f, 0.0013109877f, 0.00130498605f, 0.00129893741f,
+    0.00129284203f, 0.00128670014f, 0.00128051201f, 0.00127427788f,
+    0.001267998f, 0.00126167263f, 0.00125530202f, 0.00124888642f,
+    0.0012424261f, 0.00123592132f, 0.00122937233f, 0.0012227794f,
+    0.00121614279f, 0.00120946278f, 0.00120273962f, 0.00119597359f,
+    0.00118916496f, 0.00118231399f, 0.00117542097f, 0.00116848617f,
+    0.00116150987f, 0.00115449233f, 0.00114743385f, 0.0011403347f,
+    0.00113319517f, 0.00112601554f, 0.0011187961f, 0.00111153712f,
+    0.00110423891f, 0.00109690174f, 0.00108952591f, 0.00108211172f,
+    0.00107465945f, 0.0010671694f, 0.00105964187f, 0.00105207715f,
+    0.00104447555f, 0.00103683735f, 0.00102916287f, 0.00102145241f,
+    0.00101370626f, 0.00100592475f, 0.000998108157f, 0.000990256808f,
+    0.000982371005f, 0.000974451059f, 0.000966497281f, 0.000958509984f,
+    0.000950489479f, 0.000942436082f, 0.000934350109f, 0.000926231875f,
+    0.000918081699f, 0.0009098999f, 0.000901686797f, 0.000893442712f,
+    0.000885167966f, 0.000876862883f, 0.000868527787f, 0.000860163002f,
+    0.000851768856f, 0.000843345674f, 0.000834893786f, 0.00082641352f,
+    0.000817905207f, 0.000809369176f, 0.000800805761f, 0.000792215294f,
+    0.000783598108f, 0.000774954538f, 0.00076628492f, 0.000757589589f,
+    0.000748868884f, 0.000740123141f, 0.000731352701f, 0.000722557901f,
+    0.000713739083f, 0.000704896588f, 0.000696030758f, 0.000687141936f,
+    0.000678230465f, 0.000669296688f, 0.000660340952f, 0.000651363602f,
+    0.000642364983f, 0.000633345443f, 0.00062430533f, 0.000615244992f,
+    0.000606164777f, 0.000597065036f, 0.000587946118f, 0.000578808373f,
+    0.000569652155f, 0.000560477813f, 0.000551285701f, 0.000542076172f,
+    0.000532849579f, 0.000523606276f, 0.000514346618f, 0.00050507096f,
+    0.000495779657f, 0.000486473064f, 0.00047715154f, 0.00046781544f,
+    0.000458465121f, 0.000449100941f, 0.000439723259f, 0.000430332432f,
+    0.00042092882f, 0.000411512781f, 0.000402084676f, 0.000392644863f,
+    0.000383193703f, 0.000373731556f, 0.000364258783f, 0.000354775746f,
+    0.000345282804f, 0.00033578032f, 0.000326268655f, 0.000316748172f,
+    0.000307219231f, 0.000297682196f, 0.000288137429f, 0.000278585293f,
+    0.00026902615f, 0.000259460363f, 0.000249888295f, 0.00024031031f,
+    0.00023072677f, 0.000221138038f, 0.000211544479f, 0.000201946455f,
+    0.000192344331f, 0.000182738468f, 0.000173129232f, 0.000163516984f,
+    0.000153902089f, 0.000144284911f, 0.000134665811f, 0.000125045155f,
+    0.000115423304f, 0.000105800622f, 9.61774721e-05f, 8.65542173e-05f,
+    7.69312201e-05f, 6.73088433e-05f, 5.76874492e-05f, 4.80674003e-05f,
+    3.84490587e-05f, 2.88327862e-05f, 1.92189447e-05f, 9.60789552e-06f,
+    -7.67488043e-18f, -9.60438086e-06f, -1.92048863e-05f, -2.88011559e-05f,
+    -3.83928295e-05f, -4.79795472e-05f, -5.75609494e-05f, -6.7136677e-05f,
+    -7.6706371e-05f, -8.6269673e-05f, -9.58262248e-05f, -0.000105375669f,
+    -0.000114917647f, -0.000124451804f, -0.000133977781f, -0.000143495224f,
+    -0.000153003776f, -0.000162503083f, -0.000171992789f, -0.000181472541f,
+    -0.000190941985f, -0.000200400767f, -0.000209848535f, -0.000219284938f,
+    -0.000228709622f, -0.000238122238f, -0.000247522435f, -0.000256909864f,
+    -0.000266284174f, -0.000275645018f, -0.000284992048f, -0.000294324916f,
+    -0.000303643275f, -0.000312946781f, -0.000322235087f, -0.000331507849f,
+    -0.000340764723f, -0.000350005366f, -0.000359229436f, -0.000368436591f,
+    -0.000377626491f, -0.000386798794f, -0.000395953162f, -0.000405089257f,
+    -0.00041420674f, -0.000423305275f, -0.000432384526f, -0.000441444157f,
+    -0.000450483835f, -0.000459503226f, -0.000468501997f, -0.000477479816f,
+    -0.000486436354f, -0.000495371279f, -0.000504284264f, -0.000513174981f,
+    -0.000522043101f, -0.0005308883f, -0.000539710253f, -0.000548508635f,
+    -0.000557283123f, -0.000566033395f, -0.000574759131f, -0.000583460011f,
+    -0.000592135715f, -0.000600785925f, -0.000609410326f, -0.000618008602f,
+    -0.000626580437f, -0.000635125519f, -0.000643643536f, -0.000652134175f,
+    -0.000660597127f, -0.000669032084f, -0.000677438737f, -0.000685816781f,
+    -0.000694165909f, -0.000702485817f, -0.000710776204f, -0.000719036766f,
+    -0.000727267204f, -0.000735467219f, -0.000743636512f, -0.000751774787f,
+    -0.000759881749f, -0.000767957102f, -0.000776000556f, -0.000784011817f,
+    -0.000791990596f, -0.000799936605f, -0.000807849555f, -0.00081572916f,
+    -0.000823575136f, -0.0008313872f, -0.000839165068f, -0.000846908461f,
+    -0.0008546171f, -0.000862290706f, -0.000869929003f, -0.000877531716f,
+    -0.000885098572f, -0.000892629299f, -0.000900123625f, -0.000907581283f,
+    -0.000915002003f, -0.000922385521f, -0.000929731571f, -0.000937039891f,
+    -0.000944310218f, -0.000951542292f, -0.000958735855f, -0.000965890651f,
+    -0.000973006422f, -0.000980082917f, -0.000987119881f, -0.000994117065f,
+    -0.00100107422f, -0.0010079911f, -0.00101486745f, -0.00102170304f,
+    -0.00102849761f, -0.00103525094f, -0.00104196278f, -0.00104863288f,
+    -0.00105526102f, -0.00106184697f, -0.00106839048f, -0.00107489133f,
+    -0.00108134928f, -0.00108776412f, -0.00109413561f, -0.00110046353f,
+    -0.00110674766f, -0.00111298778f, -0.00111918366f, -0.00112533509f,
+    -0.00113144186f, -0.00113750375f, -0.00114352055f, -0.00114949205f,
+    -0.00115541804f, -0.00116129831f, -0.00116713266f, -0.00117292089f,
+    -0.00117866279f, -0.00118435816f, -0.00119000682f, -0.00119560855f,
+    -0.00120116318f, -0.00120667049f, -0.00121213032f, -0.00121754246f,
+    -0.00122290674f, -0.00122822296f, -0.00123349094f, -0.0012387105f,
+    -0.00124388147f, -0.00124900367f, -0.00125407692f, -0.00125910104f,
+    -0.00126407588f, -0.00126900125f, -0.00127387699f, -0.00127870294f,
+    -0.00128347892f, -0.00128820479f, -0.00129288037f, -0.00129750552f,
+    -0.00130208007f, -0.00130660388f, -0.00131107679f, -0.00131549864f,
+    -0.0013198693f, -0.00132418862f, -0.00132845645f, -0.00133267265f,
+    -0.00133683708f, -0.0013409496f, -0.00134501008f, -0.00134901839f,
+    -0.00135297438f, -0.00135687794f, -0.00136072893f, -0.00136452722f,
+    -0.00136827271f, -0.00137196525f, -0.00137560474f, -0.00137919105f,
+    -0.00138272407f, -0.00138620368f, -0.00138962978f, -0.00139300226f,
+    -0.001396321f, -0.0013995859f, -0.00140279687f, -0.00140595379f,
+    -0.00140905657f, -0.00141210511f, -0.00141509931f, -0.00141803909f,
+    -0.00142092436f, -0.00142375501f, -0.00142653098f, -0.00142925217f,
+    -0.00143191849f, -0.00143452988f, -0.00143708625f, -0.00143958753f,
+    -0.00144203364f, -0.00144442451f, -0.00144676007f, -0.00144904025f,
+    -0.00145126499f, -0.00145343422f, -0.00145554789f, -0.00145760593f,
+    -0.00145960828f, -0.0014615549f, -0.00146344572f, -0.0014652807f,
+    -0.00146705979f, -0.00146878295f, -0.00147045012f, -0.00147206127f,
+    -0.00147361635f, -0.00147511533f, -0.00147655817f, -0.00147794484f,
+    -0.00147927531f, -0.00148054955f, -0.00148176752f, -0.00148292921f,
+    -0.00148403459f, -0.00148508364f, -0.00148607635f, -0.00148701269f,
+    -0.00148789265f, -0.00148871622f, -0.00148948339f, -0.00149019415f,
+    -0.00149084849f, -0.00149144641f, -0.00149198791f, -0.00149247299f,
+    -0.00149290165f, -0.0014932739f, -0.00149358974f, -0.00149384918f,
+    -0.00149405223f, -0.00149419891f, -0.00149428923f, -0.00149432321f,
+    -0.00149430087f, -0.00149422223f, -0.00149408731f, -0.00149389614f,
+    -0.00149364874f, -0.00149334516f, -0.00149298541f, -0.00149256954f,
+    -0.00149209757f, -0.00149156956f, -0.00149098553f, -0.00149034554f,
+    -0.00148964962f, -0.00148889783f, -0.00148809021f, -0.00148722681f,
+    -0.00148630768f, -0.00148533289f, -0.00148430249f, -0.00148321654f,
+    -0.00148207509f, -0.00148087822f, -0.00147962599f, -0.00147831847f,
+    -0.00147695572f, -0.00147553782f, -0.00147406484f, -0.00147253685f,
+    -0.00147095395f, -0.0014693162f, -0.00146762368f, -0.00146587649f,
+    -0.0014640747f, -0.00146221841f, -0.00146030771f, -0.00145834268f,
+    -0.00145632342f, -0.00145425004f, -0.00145212262f, -0.00144994126f,
+    -0.00144770607f, -0.00144541716f, -0.00144307462f, -0.00144067857f,
+    -0.00143822912f, -0.00143572637f, -0.00143317045f, -0.00143056147f,
+    -0.00142789954f, -0.00142518479f, -0.00142241734f, -0.00141959731f,
+    -0.00141672483f, -0.00141380003f, -0.00141082303f, -0.00140779396f,
+    -0.00140471297f, -0.00140158018f, -0.00139839573f, -0.00139515977f,
+    -0.00139187243f, -0.00138853385f, -0.00138514419f, -0.00138170358f,
+    -0.00137821217f, -0.00137467013f, -0.00137107759f, -0.00136743471f,
+    -0.00136374165f, -0.00135999857f, -0.00135620562f, -0.00135236297f,
+    -0.00134847077f, -0.00134452921f, -0.00134053843f, -0.00133649862f,
+    -0.00133240994f, -0.00132827256f, -0.00132408665f, -0.0013198524f,
+    -0.00131556998f, -0.00131123957f, -0.00130686135f, -0.0013024355f,
+    -0.00129796221f, -0.00129344167f, -0.00128887405f, -0.00128425956f,
+    -0.00127959838f, -0.0012748907f, -0.00127013673f, -0.00126533665f,
+    -0.00126049066f, -0.00125559897f, -0.00125066177f, -0.00124567928f,
+    -0.00124065168f, -0.00123557919f, -0.00123046202f, -0.00122530038f,
+    -0.00122009447f, -0.00121484452f, -0.00120955072f, -0.00120421331f,
+    -0.0011988325f, -0.00119340849f, -0.00118794153f, -0.00118243183f,
+    -0.0011768796f, -0.00117128508f, -0.0011656485f, -0.00115997008f,
+    -0.00115425005f, -0.00114848864f, -0.00114268608f, -0.00113684261f,
+    -0.00113095847f, -0.00112503389f, -0.0011190691f, -0.00111306435f,
+    -0.00110701989f, -0.00110093594f, -0.00109481277f, -0.0010886506f,
+    -0.00108244969f, -0.00107621029f, -0.00106993264f, -0.001063617f,
+    -0.00105726362f, -0.00105087275f, -0.00104444465f, -0.00103797957f,
+    -0.00103147777f, -0.00102493951f, -0.00101836505f, -0.00101175465f,
+    -0.00100510857f, -0.000998427077f, -0.000991710436f, -0.000984958912f,
+    -0.000978172773f, -0.000971352288f, -0.000964497726f, -0.000957609358f,
+    -0.000950687457f, -0.000943732296f, -0.000936744149f, -0.000929723292f,
+    -0.000922670001f, -0.000915584555f, -0.000908467233f, -0.000901318314f,
+    -0.00089413808f, -0.000886926813f, -0.000879684797f, -0.000872412315f,
+    -0.000865109653f, -0.000857777098f, -0.000850414937f, -0.000843023459f,
+    -0.000835602953f, -0.000828153709f, -0.000820676019f, -0.000813170175f,
+    -0.000805636471f, -0.000798075201f, -0.00079048666f, -0.000782871145f,
+    -0.000775228952f, -0.000767560379f, -0.000759865726f, -0.000752145292f,
+    -0.000744399377f, -0.000736628282f, -0.000728832311f, -0.000721011767f,
+    -0.000713166952f, -0.000705298172f, -0.000697405733f, -0.00068948994f,
+    -0.0006815511f, -0.000673589522f, -0.000665605514f, -0.000657599385f,
+    -0.000649571446f, -0.000641522006f, -0.000633451378f, -0.000625359872f,
+    -0.000617247803f, -0.000609115483f, -0.000600963227f, -0.000592791349f,
+    -0.000584600165f, -0.00057638999f, -0.000568161141f, -0.000559913935f,
+    -0.000551648689f, -0.000543365723f, -0.000535065354f, -0.000526747902f,
+    -0.000518413688f, -0.00051006303f, -0.000501696251f, -0.000493313671f,
+    -0.000484915613f, -0.000476502398f, -0.000468074349f, -0.000459631791f,
+    -0.000451175045f, -0.000442704436f, -0.00043422029f, -0.000425722929f,
+    -0.000417212681f, -0.000408689869f, -0.000400154821f, -0.000391607862f,
+    -0.000383049319f, -0.000374479519f, -0.000365898789f, -0.000357307457f,
+    -0.00034870585f, -0.000340094297f, -0.000331473125f, -0.000322842663f,
+    -0.000314203241f, -0.000305555186f, -0.000296898829f, -0.000288234498f,
+    -0.000279562523f, -0.000270883234f, -0.000262196961f, -0.000253504034f,
+    -0.000244804782f, -0.000236099536f, -0.000227388627f, -0.000218672384f,
+    -0.000209951139f, -0.000201225222f, -0.000192494964f, -0.000183760695f,
+    -0.000175022746f, -0.000166281448f, -0.000157537131f, -0.000148790127f,
+    -0.000140040765f, -0.000131289377f, -0.000122536294f, -0.000113781845f,
+    -0.000105026361f, -9.62701736e-05f, -8.75136118e-05f, -7.87570062e-05f,
+    -7.00006869e-05f, -6.12449839e-05f, -5.2490227e-05f, -4.37367457e-05f,
+    -3.49848696e-05f, -2.6234928e-05f, -1.748725e-05f, -8.74216443e-06f,
+    -8.37361798e-18f, 8.73891486e-06f, 1.7474252e-05f, 2.62056834e-05f,
+    3.49328814e-05f, 4.36555187e-05f, 5.23732682e-05f, 6.1085803e-05f,
+    6.97927967e-05f, 7.84939232e-05f, 8.71888567e-05f, 9.58772717e-05f,
+    0.000104558843f, 0.000113233246f, 0.000121900157f, 0.000130559251f,
+    0.000139210206f, 0.000147852697f, 0.000156486403f, 0.000165111001f,
+    0.00017372617f, 0.000182331587f, 0.000190926934f, 0.000199511889f,
+    0.000208086132f, 0.000216649345f, 0.000225201208f, 0.000233741404f,
+    0.000242269615f, 0.000250785524f, 0.000259288815f, 0.000267779171f,
+    0.000276256278f, 0.000284719821f, 0.000293169485f, 0.000301604959f,
+    0.000310025928f, 0.000318432082f, 0.000326823107f, 0.000335198695f,
+    0.000343558535f, 0.000351902318f, 0.000360229734f, 0.000368540478f,
+    0.00037683424f, 0.000385110715f, 0.000393369598f, 0.000401610584f,
+    0.000409833369f, 0.000418037649f, 0.000426223122f, 0.000434389487f,
+    0.000442536443f, 0.000450663691f, 0.00045877093f, 0.000466857863f,
+    0.000474924193f, 0.000482969624f, 0.000490993859f, 0.000498996605f,
+    0.000506977567f, 0.000514936453f, 0.000522872971f, 0.000530786831f,
+    0.000538677742f, 0.000546545416f, 0.000554389564f, 0.0005622099f,
+    0.000570006138f, 0.000577777993f, 0.000585525181f, 0.000593247419f,
+    0.000600944426f, 0.000608615921f, 0.000616261623f, 0.000623881255f,
+    0.000631474539f, 0.000639041199f, 0.000646580959f, 0.000654093545f,
+    0.000661578685f, 0.000669036105f, 0.000676465536f, 0.000683866707f,
+    0.000691239351f, 0.0006985832f, 0.000705897988f, 0.00071318345f,
+    0.000720439323f, 0.000727665343f, 0.00073486125f, 0.000742026784f,
+    0.000749161686f, 0.000756265698f, 0.000763338564f, 0.000770380029f,
+    0.00077738984f, 0.000784367743f, 0.000791313489f, 0.000798226826f,
+    0.000805107508f, 0.000811955285f, 0.000818769913f, 0.000825551147f,
+    0.000832298744f, 0.000839012461f, 0.00084569206f, 0.0008523373f,
+    0.000858947944f, 0.000865523755f, 0.000872064499f, 0.000878569943f,
+    0.000885039853f, 0.000891474f, 0.000897872155f, 0.000904234089f,
+    0.000910559577f, 0.000916848393f, 0.000923100314f, 0.000929315119f,
+    0.000935492586f, 0.000941632498f, 0.000947734635f, 0.000953798784f,
+    0.000959824728f, 0.000965812256f, 0.000971761156f, 0.000977671218f,
+    0.000983542234f, 0.000989373996f, 0.000995166301f, 0.00100091894f,
+    0.00100663172f, 0.00101230444f, 0.00101793689f, 0.00102352888f,
+    0.00102908022f, 0.0010345907f, 0.00104006015f, 0.00104548836f,
+    0.00105087514f, 0.00105622032f, 0.0010615237f, 0.0010667851f,
+    0.00107200434f, 0.00107718123f, 0.0010823156f, 0.00108740727f,
+    0.00109245606f, 0.0010974618f, 0.00110242432f, 0.00110734344f,
+    0.00111221899f, 0.00111705082f, 0.00112183875f, 0.00112658261f,
+    0.00113128226f, 0.00113593751f, 0.00114054823f, 0.00114511424f,
+    0.0011496354f, 0.00115411155f, 0.00115854254f, 0.00116292821f,
+    0.00116726843f, 0.00117156303f, 0.00117581189f, 0.00118001485f,
+    0.00118417178f, 0.00118828253f, 0.00119234697f, 0.00119636496f,
+    0.00120033636f, 0.00120426105f, 0.0012081389f, 0.00121196977f,
+    0.00121575353f, 0.00121949008f, 0.00122317927f, 0.00122682099f,
+    0.00123041512f, 0.00123396154f, 0.00123746014f, 0.0012409108f,
+    0.00124431341f, 0.00124766786f, 0.00125097404f, 0.00125423185f,
+    0.00125744117f, 0.00126060191f, 0.00126371397f, 0.00126677724f,
+    0.00126979164f, 0.00127275706f, 0.0012756734f, 0.00127854059f,
+    0.00128135853f, 0.00128412713f, 0.0012868463f, 0.00128951597f,
+    0.00129213605f, 0.00129470645f, 0.00129722711f, 0.00129969794f,
+    0.00130211887f, 0.00130448983f, 0.00130681075f, 0.00130908155f,
+    0.00131130217f, 0.00131347256f, 0.00131559263f, 0.00131766234f,
+    0.00131968162f, 0.00132165041f, 0.00132356867f, 0.00132543633f,
+    0.00132725335f, 0.00132901967f, 0.00133073526f, 0.00133240005f,
+    0.00133401402f, 0.00133557711f, 0.00133708929f, 0.00133855051f,
+    0.00133996076f, 0.00134131998f, 0.00134262814f, 0.00134388523f,
+    0.0013450912f, 0.00134624603f, 0.00134734971f, 0.0013484022f,
+    0.00134940348f, 0.00135035354f, 0.00135125236f, 0.00135209992f,
+    0.00135289622f, 0.00135364123f, 0.00135433496f, 0.0013549774f,
+    0.00135556853f, 0.00135610837f, 0.00135659689f, 0.00135703412f,
+    0.00135742005f, 0.00135775468f, 0.00135803802f, 0.00135827008f,
+    0.00135845087f, 0.0013585804f, 0.00135865869f, 0.00135868575f,
+    0.00135866161f, 0.00135858627f, 0.00135845977f, 0.00135828212f,
+    0.00135805336f, 0.00135777351f, 0.0013574426f, 0.00135706066f,
+    0.00135662772f, 0.00135614383f, 0.00135560901f, 0.00135502331f,
+    0.00135438678f, 0.00135369944f, 0.00135296135f, 0.00135217255f,
+    0.00135133309f, 0.00135044303f, 0.00134950241f, 0.00134851129f,
+    0.00134746973f, 0.00134637778f, 0.0013452355f, 0.00134404296f,
+    0.00134280022f, 0.00134150735f, 0.00134016441f, 0.00133877147f,
+    0.0013373286f, 0.00133583589f, 0.00133429339f, 0.00133270119f,
+    0.00133105937f, 0.001329368f, 0.00132762718f, 0.00132583698f,
+    0.00132399748f, 0.00132210879f, 0.00132017098f, 0.00131818416f,
+    0.0013161484f, 0.00131406381f, 0.00131193049f, 0.00130974853f,
+    0.00130751803f, 0.0013052391f, 0.00130291183f, 0.00130053634f,
+    0.00129811274f, 0.00129564112f, 0.00129312161f, 0.00129055432f,
+    0.00128793936f, 0.00128527684f, 0.00128256689f, 0.00127980963f,
+    0.00127700517f, 0.00127415365f, 0.00127125518f, 0.00126830989f,
+    0.00126531792f, 0.00126227938f, 0.00125919442f, 0.00125606317f,
+    0.00125288576f, 0.00124966233f, 0.00124639301f, 0.00124307796f,
+    0.00123971731f, 0.0012363112f, 0.00123285978f, 0.0012293632f,
+    0.00122582161f, 0.00122223515f, 0.00121860398f, 0.00121492825f,
+    0.00121120812f, 0.00120744375f, 0.00120363528f, 0.00119978289f,
+    0.00119588674f, 0.00119194698f, 0.00118796378f, 0.00118393732f,
+    0.00117986775f, 0.00117575525f, 0.00117159998f, 0.00116740213f,
+    0.00116316186f, 0.00115887935f, 0.00115455478f, 0.00115018832f,
+    0.00114578016f, 0.00114133048f, 0.00113683947f, 0.00113230729f,
+    0.00112773416f, 0.00112312024f, 0.00111846573f, 0.00111377082f,
+    0.00110903571f, 0.00110426058f, 0.00109944564f, 0.00109459107f,
+    0.00108969707f, 0.00108476386f, 0.00107979161f, 0.00107478055f,
+    0.00106973086f, 0.00106464277f, 0.00105951646f, 0.00105435215f,
+    0.00104915006f, 0.00104391038f, 0.00103863333f, 0.00103331913f,
+    0.00102796798f, 0.00102258011f, 0.00101715572f, 0.00101169505f,
+    0.0010061983f, 0.0010006657f, 0.000995097474f, 0.000989493839f,
+    0.000983855024f, 0.000978181252f, 0.000972472751f, 0.00096672975f,
+    0.000960952477f, 0.000955141164f, 0.000949296042f, 0.000943417345f,
+    0.000937505305f, 0.00093156016f, 0.000925582145f, 0.000919571497f,
+    0.000913528457f, 0.000907453263f, 0.000901346158f, 0.000895207382f,
+    0.00088903718f, 0.000882835795f, 0.000876603474f, 0.000870340462f,
+    0.000864047007f, 0.000857723359f, 0.000851369766f, 0.00084498648f,
+    0.000838573752f, 0.000832131835f, 0.000825660982f, 0.000819161449f,
+    0.000812633492f, 0.000806077366f, 0.00079949333f, 0.000792881643f,
+    0.000786242563f, 0.000779576353f, 0.000772883272f, 0.000766163583f,
+    0.000759417551f, 0.000752645438f, 0.00074584751f, 0.000739024033f,
+    0.000732175274f, 0.0007253015f, 0.00071840298f, 0.000711479983f,
+    0.000704532779f, 0.00069756164f, 0.000690566837f, 0.000683548642f,
+    0.000676507329f, 0.000669443173f, 0.000662356447f, 0.000655247428f,
+    0.000648116391f, 0.000640963615f, 0.000633789376f, 0.000626593953f,
+    0.000619377626f, 0.000612140674f, 0.000604883378f, 0.000597606018f,
+    0.000590308878f, 0.000582992239f, 0.000575656384f, 0.000568301597f,
+    0.000560928163f, 0.000553536367f, 0.000546126493f, 0.000538698828f,
+    0.00053125366f, 0.000523791274f, 0.000516311959f, 0.000508816003f,
+    0.000501303694f, 0.000493775323f, 0.000486231179f, 0.000478671552f,
+    0.000471096733f, 0.000463507013f, 0.000455902684f, 0.000448284038f,
+    0.000440651368f, 0.000433004966f, 0.000425345126f, 0.000417672142f,
+    0.000409986308f, 0.000402287918f, 0.000394577268f, 0.000386854652f,
+    0.000379120366f, 0.000371374706f, 0.000363617969f, 0.00035585045f,
+    0.000348072447f, 0.000340284257f, 0.000332486177f, 0.000324678505f,
+    0.000316861539f, 0.000309035577f, 0.000301200917f, 0.000293357857f,
+    0.000285506698f, 0.000277647737f, 0.000269781274f, 0.000261907607f,
+    0.000254027038f, 0.000246139865f, 0.000238246387f, 0.000230346906f,
+    0.00022244172f, 0.000214531131f, 0.000206615438f, 0.000198694941f,
+    0.000190769941f, 0.000182840739f, 0.000174907634f, 0.000166970927f,
+    0.000159030919f, 0.000151087911f, 0.000143142202f, 0.000135194093f,
+    0.000127243886f, 0.000119291879f, 0.000111338374f, 0.000103383671f,
+    9.54280706e-05f, 8.74718724e-05f, 7.95153768e-05f, 7.15588837e-05f,
+    6.36026932e-05f, 5.56471049e-05f, 4.76924186e-05f, 3.97389336e-05f,
+    3.17869493e-05f, 2.3836765e-05f, 1.58886795e-05f, 7.9429916e-06f,
+    2.15611354e-17f, -7.93999698e-06f, -1.58767012e-05f, -2.38098147e-05f,
+    -3.173904e-05f, -3.96640794e-05f, -4.7584636e-05f, -5.55004128e-05f,
+    -6.34111134e-05f, -7.13164414e-05f, -7.92161009e-05f, -8.71097963e-05f,
+    -9.49972323e-05f, -0.000102878114f, -0.000110752147f, -0.000118619036f,
+    -0.000126478489f, -0.000134330212f, -0.00014217391f, -0.000150009293f,
+    -0.000157836068f, -0.000165653943f, -0.000173462626f, -0.000181261827f,
+    -0.000189051256f, -0.000196830622f, -0.000204599637f, -0.00021235801f,
+    -0.000220105455f, -0.000227841682f, -0.000235566404f, -0.000243279336f,
+    -0.00025098019f, -0.00025866868f, -0.000266344522f, -0.000274007431f,
+    -0.000281657123f, -0.000289293315f, -0.000296915724f, -0.000304524068f,
+    -0.000312118066f, -0.000319697436f, -0.000327261898f, -0.000334811173f,
+    -0.000342344983f, -0.000349863048f, -0.000357365092f, -0.000364850838f,
+    -0.00037232001f, -0.000379772333f, -0.000387207531f, -0.000394625332f,
+    -0.000402025462f, -0.000409407649f, -0.000416771622f, -0.000424117109f,
+    -0.000431443841f, -0.00043875155f, -0.000446039965f, -0.000453308821f,
+    -0.000460557851f, -0.000467786788f, -0.000474995369f, -0.000482183328f,
+    -0.000489350403f, -0.000496496332f, -0.000503620853f, -0.000510723705f,
+    -0.00051780463f, -0.000524863368f, -0.000531899662f, -0.000538913255f,
+    -0.000545903892f, -0.000552871317f, -0.000559815277f, -0.000566735519f,
+    -0.000573631791f, -0.000580503842f, -0.000587351422f, -0.000594174282f,
+    -0.000600972175f, -0.000607744853f, -0.000614492072f, -0.000621213586f,
+    -0.000627909151f, -0.000634578526f, -0.000641221468f, -0.000647837737f,
+    -0.000654427094f, -0.000660989301f, -0.000667524121f, -0.000674031317f,
+    -0.000680510655f, -0.000686961901f, -0.000693384823f, -0.000699779188f,
+    -0.000706144768f, -0.000712481333f, -0.000718788655f, -0.000725066507f,
+    -0.000731314664f, -0.000737532901f, -0.000743720996f, -0.000749878727f,
+    -0.000756005873f, -0.000762102214f, -0.000768167533f, -0.000774201613f,
+    -0.000780204238f, -0.000786175193f, -0.000792114266f, -0.000798021244f,
+    -0.000803895918f, -0.000809738078f, -0.000815547516f, -0.000821324026f,
+    -0.000827067402f, -0.00083277744f, -0.000838453938f, -0.000844096694f,
+    -0.000849705509f, -0.000855280184f, -0.000860820521f, -0.000866326326f,
+    -0.000871797402f, -0.000877233558f, -0.000882634602f, -0.000888000343f,
+    -0.000893330592f, -0.000898625163f, -0.000903883868f, -0.000909106524f,
+    -0.000914292946f, -0.000919442954f, -0.000924556367f, -0.000929633006f,
+    -0.000934672693f, -0.000939675253f, -0.000944640511f, -0.000949568294f,
+    -0.00095445843f, -0.00095931075f, -0.000964125085f, -0.000968901268f,
+    -0.000973639133f, -0.000978338516f, -0.000982999254f, -0.000987621187f,
+    -0.000992204154f, -0.000996747999f, -0.00100125256f, -0.0010057177f,
+    -0.00101014324f, -0.00101452904f, -0.00101887495f, -0.00102318083f,
+    -0.00102744652f, -0.00103167188f, -0.00103585676f, -0.00104000102f,
+    -0.00104410453f, -0.00104816714f, -0.00105218871f, -0.00105616911f,
+    -0.00106010821f, -0.00106400586f, -0.00106786195f, -0.00107167634f,
+    -0.0010754489f, -0.0010791795f, -0.00108286803f, -0.00108651435f,
+    -0.00109011835f, -0.00109367991f, -0.00109719891f, -0.00110067523f,
+    -0.00110410876f, -0.00110749938f, -0.00111084698f, -0.00111415146f,
+    -0.0011174127f, -0.0011206306f, -0.00112380505f, -0.00112693595f,
+    -0.0011300232f, -0.0011330667f, -0.00113606635f, -0.00113902205f,
+    -0.00114193372f, -0.00114480124f, -0.00114762455f, -0.00115040354f,
+    -0.00115313812f, -0.00115582822f, -0.00115847374f, -0.00116107461f,
+    -0.00116363073f, -0.00116614205f, -0.00116860846f, -0.00117102991f,
+    -0.00117340631f, -0.00117573759f, -0.00117802369f, -0.00118026453f,
+    -0.00118246004f, -0.00118461017f, -0.00118671484f, -0.00118877399f,
+    -0.00119078757f, -0.00119275551f, -0.00119467776f, -0.00119655427f,
+    -0.00119838497f, -0.00120016982f, -0.00120190877f, -0.00120360177f,
+    -0.00120524877f, -0.00120684973f, -0.00120840461f, -0.00120991336f,
+    -0.00121137595f, -0.00121279234f, -0.00121416249f, -0.00121548636f,
+    -0.00121676393f, -0.00121799517f, -0.00121918004f, -0.00122031852f,
+    -0.00122141058f, -0.00122245621f, -0.00122345537f, -0.00122440805f,
+    -0.00122531423f, -0.0012261739f, -0.00122698703f, -0.00122775362f,
+    -0.00122847365f, -0.00122914712f, -0.00122977401f, -0.00123035433f,
+    -0.00123088806f, -0.00123137521f, -0.00123181577f, -0.00123220974f,
+    -0.00123255714f, -0.00123285795f, -0.0012331122f, -0.00123331988f,
+    -0.00123348101f, -0.00123359559f, -0.00123366365f, -0.00123368519f,
+    -0.00123366024f, -0.00123358881f, -0.00123347092f, -0.0012333066f,
+    -0.00123309586f, -0.00123283874f, -0.00123253526f, -0.00123218544f,
+    -0.00123178933f, -0.00123134696f, -0.00123085835f, -0.00123032354f,
+    -0.00122974257f, -0.00122911549f, -0.00122844233f, -0.00122772313f,
+    -0.00122695794f, -0.0012261468f, -0.00122528977f, -0.00122438689f,
+    -0.00122343822f, -0.0012224438f, -0.0012214037f, -0.00122031797f,
+    -0.00121918666f, -0.00121800984f, -0.00121678757f, -0.00121551991f,
+    -0.00121420693f, -0.00121284869f, -0.00121144527f, -0.00120999673f,
+    -0.00120850314f, -0.00120696458f, -0.00120538112f, -0.00120375284f,
+    -0.00120207982f, -0.00120036213f, -0.00119859987f, -0.00119679311f,
+    -0.00119494193f, -0.00119304643f, -0.00119110669f, -0.00118912281f,
+    -0.00118709487f, -0.00118502296f, -0.00118290719f, -0.00118074765f,
+    -0.00117854443f, -0.00117629764f, -0.00117400738f, -0.00117167374f,
+    -0.00116929684f, -0.00116687678f, -0.00116441367f, -0.00116190762f,
+    -0.00115935873f, -0.00115676713f, -0.00115413292f, -0.00115145622f,
+    -0.00114873715f, -0.00114597582f, -0.00114317235f, -0.00114032688f,
+    -0.00113743951f, -0.00113451038f, -0.00113153962f, -0.00112852734f,
+    -0.00112547368f, -0.00112237876f, -0.00111924274f, -0.00111606572f,
+    -0.00111284786f, -0.00110958928f, -0.00110629013f, -0.00110295055f,
+    -0.00109957067f, -0.00109615064f, -0.00109269061f, -0.00108919071f,
+    -0.00108565111f, -0.00108207193f, -0.00107845334f, -0.00107479549f,
+    -0.00107109853f, -0.00106736261f, -0.00106358789f, -0.00105977452f,
+    -0.00105592267f, -0.0010520325f, -0.00104810415f, -0.00104413781f,
+    -0.00104013363f, -0.00103609177f, -0.00103201241f, -0.00102789571f,
+    -0.00102374185f, -0.00101955098f, -0.00101532329f, -0.00101105894f,
+    -0.00100675812f, -0.00100242099f, -0.000998047742f, -0.000993638545f,
+    -0.000989193582f, -0.000984713033f, -0.000980197081f, -0.00097564591f,
+    -0.000971059705f, -0.000966438651f, -0.000961782937f, -0.000957092751f,
+    -0.000952368282f, -0.000947609723f, -0.000942817264f, -0.0009379911f,
+    -0.000933131426f, -0.000928238437f, -0.000923312331f, -0.000918353305f,
+    -0.000913361559f, -0.000908337295f, -0.000903280712f, -0.000898192015f,
+    -0.000893071407f, -0.000887919094f, -0.000882735282f, -0.000877520177f,
+    -0.00087227399f, -0.000866996928f, -0.000861689203f, -0.000856351027f,
+    -0.000850982612f, -0.000845584172f, -0.000840155922f, -0.000834698078f,
+    -0.000829210857f, -0.000823694477f, -0.000818149157f, -0.000812575116f,
+    -0.000806972577f, -0.000801341761f, -0.00079568289f, -0.00078999619f,
+    -0.000784281884f, -0.000778540199f, -0.000772771362f, -0.0007669756f,
+    -0.000761153142f, -0.000755304217f, -0.000749429057f, -0.000743527892f,
+    -0.000737600955f, -0.000731648479f, -0.000725670699f, -0.000719667848f,
+    -0.000713640163f, -0.000707587881f, -0.000701511239f, -0.000695410475f,
+    -0.000689285829f, -0.00068313754f, -0.000676965849f, -0.000670770997f,
+    -0.000664553228f, -0.000658312783f, -0.000652049907f, -0.000645764845f,
+    -0.000639457842f, -0.000633129143f, -0.000626778996f, -0.000620407648f,
+    -0.000614015347f, -0.000607602343f, -0.000601168884f, -0.000594715221f,
+    -0.000588241606f, -0.000581748289f, -0.000575235523f, -0.000568703561f,
+    -0.000562152656f, -0.000555583062f, -0.000548995034f, -0.000542388828f,
+    -0.000535764699f, -0.000529122904f, -0.0005224637f, -0.000515787344f,
+    -0.000509094095f, -0.000502384212f, -0.000495657953f, -0.000488915578f,
+    -0.000482157348f, -0.000475383523f, -0.000468594365f, -0.000461790135f,
+    -0.000454971096f, -0.00044813751f, -0.000441289641f, -0.000434427751f,
+    -0.000427552105f, -0.000420662967f, -0.000413760602f, -0.000406845275f,
+    -0.000399917252f, -0.000392976799f, -0.000386024182f, -0.000379059667f,
+    -0.000372083523f, -0.000365096015f, -0.000358097412f, -0.000351087982f,
+    -0.000344067994f, -0.000337037714f, -0.000329997414f, -0.000322947361f,
+    -0.000315887826f, -0.000308819077f, -0.000301741385f, -0.000294655021f,
+    -0.000287560253f, -0.000280457354f, -0.000273346594f, -0.000266228243f,
+    -0.000259102574f, -0.000251969856f, -0.000244830363f, -0.000237684365f,
+    -0.000230532135f, -0.000223373944f, -0.000216210064f, -0.000209040768f,
+    -0.000201866328f, -0.000194687016f, -0.000187503105f, -0.000180314866f,
+    -0.000173122574f, -0.0001659265f, -0.000158726917f, -0.000151524097f,
+    -0.000144318314f, -0.000137109841f, -0.000129898949f, -0.000122685911f,
+    -0.000115471001f, -0.000108254491f, -0.000101036653f, -9.38177604e-05f,
+    -8.65980851e-05f, -7.93778998e-05f, -7.21574768e-05f, -6.49370882e-05f,
+    -5.77170063e-05f, -5.04975029e-05f, -4.327885e-05f, -3.60613194e-05f,
+    -2.88451826e-05f, -2.1630711e-05f, -1.44181761e-05f, -7.20784874e-06f,
+    1.15356649e-18f, 7.20509945e-06f, 1.44071791e-05f, 2.16059686e-05f,
+    2.8801198e-05f, 3.59925974e-05f, 4.31798972e-05f, 5.03628281e-05f,
+    5.75411211e-05f, 6.47145073e-05f, 7.18827183e-05f, 7.90454858e-05f,
+    8.6202542e-05f, 9.33536194e-05f, 0.000100498451f, 0.000107636769f,
+    0.000114768307f, 0.0001218928f, 0.000129009982f, 0.000136119586f,
+    0.000143221348f, 0.000150315003f, 0.000157400287f, 0.000164476936f,
+    0.000171544687f, 0.000178603276f, 0.000185652442f, 0.000192691922f,
+    0.000199721454f, 0.000206740777f, 0.000213749631f, 0.000220747755f,
+    0.000227734891f, 0.000234710777f, 0.000241675157f, 0.000248627772f,
+    0.000255568364f, 0.000262496677f, 0.000269412453f, 0.000276315437f,
+    0.000283205375f, 0.00029008201f, 0.000296945089f, 0.000303794359f,
+    0.000310629566f, 0.000317450459f, 0.000324256785f, 0.000331048295f,
+    0.000337824736f, 0.000344585861f, 0.000351331419f, 0.000358061163f,
+    0.000364774845f, 0.000371472218f, 0.000378153035f, 0.000384817052f,
+    0.000391464024f, 0.000398093706f, 0.000404705856f, 0.00041130023f,
+    0.000417876588f, 0.000424434687f, 0.000430974289f, 0.000437495153f,
+    0.00044399704f, 0.000450479714f, 0.000456942937f, 0.000463386473f,
+    0.000469810086f, 0.000476213543f, 0.000482596609f, 0.000488959051f,
+    0.000495300639f, 0.00050162114f, 0.000507920324f, 0.000514197963f,
+    0.000520453828f, 0.000526687691f, 0.000532899326f, 0.000539088507f,
+    0.00054525501f, 0.00055139861f, 0.000557519086f, 0.000563616214f,
+    0.000569689775f, 0.000575739549f, 0.000581765316f, 0.000587766858f,
+    0.000593743959f, 0.000599696403f, 0.000605623974f, 0.000611526459f,
+    0.000617403645f, 0.000623255321f, 0.000629081274f, 0.000634881296f,
+    0.000640655178f, 0.000646402713f, 0.000652123693f, 0.000657817913f,
+    0.000663485169f, 0.000669125258f, 0.000674737977f, 0.000680323125f,
+    0.000685880503f, 0.000691409911f, 0.000696911152f, 0.000702384029f,
+    0.000707828347f, 0.000713243911f, 0.000718630529f, 0.000723988008f,
+    0.000729316158f, 0.000734614789f, 0.000739883713f, 0.000745122741f,
+    0.00075033169f, 0.000755510373f, 0.000760658607f, 0.000765776209f,
+    0.000770862999f, 0.000775918796f, 0.000780943422f, 0.000785936699f,
+    0.000790898452f, 0.000795828504f, 0.000800726683f, 0.000805592816f,
+    0.000810426732f, 0.000815228261f, 0.000819997235f, 0.000824733485f,
+    0.000829436847f, 0.000834107155f, 0.000838744246f, 0.000843347959f,
+    0.000847918131f, 0.000852454605f, 0.000856957221f, 0.000861425823f,
+    0.000865860256f, 0.000870260365f, 0.000874625998f, 0.000878957004f,
+    0.000883253232f, 0.000887514534f, 0.000891740763f, 0.000895931772f,
+    0.000900087418f, 0.000904207557f, 0.000908292048f, 0.000912340749f,
+    0.000916353523f, 0.000920330232f, 0.00092427074f, 0.000928174911f,
+    0.000932042613f, 0.000935873715f, 0.000939668085f, 0.000943425594f,
+    0.000947146116f, 0.000950829524f, 0.000954475693f, 0.000958084501f,
+    0.000961655825f, 0.000965189545f, 0.000968685543f, 0.000972143701f,
+    0.000975563903f, 0.000978946035f, 0.000982289985f, 0.00098559564f,
+    0.00098886289f, 0.000992091628f, 0.000995281747f, 0.00099843314f,
+    0.0010015457f, 0.00100461934f, 0.00100765394f, 0.0010106494f,
+    0.00101360564f, 0.00101652255f, 0.00101940004f, 0.00102223802f,
+    0.00102503639f, 0.00102779506f, 0.00103051395f, 0.00103319297f,
+    0.00103583202f, 0.00103843104f, 0.00104098993f, 0.00104350861f,
+    0.00104598701f, 0.00104842504f, 0.00105082263f, 0.00105317971f,
+    0.0010554962f, 0.00105777203f, 0.00106000713f, 0.00106220143f,
+    0.00106435487f, 0.00106646737f, 0.00106853888f, 0.00107056933f,
+    0.00107255866f, 0.00107450681f, 0.00107641372f, 0.00107827935f,
+    0.00108010363f, 0.00108188651f, 0.00108362794f, 0.00108532787f,
+    0.00108698625f, 0.00108860303f, 0.00109017818f, 0.00109171164f,
+    0.00109320338f, 0.00109465335f, 0.00109606152f, 0.00109742785f,
+    0.00109875229f, 0.00110003483f, 0.00110127543f, 0.00110247405f,
+    0.00110363067f, 0.00110474526f, 0.0011058178f, 0.00110684825f,
+    0.0011078366f, 0.00110878283f, 0.00110968691f, 0.00111054883f,
+    0.00111136858f, 0.00111214613f, 0.00111288147f, 0.0011135746f,
+    0.0011142255f, 0.00111483416f, 0.00111540059f, 0.00111592476f,
+    0.00111640668f, 0.00111684635f, 0.00111724377f, 0.00111759893f,
+    0.00111791185f, 0.00111818252f, 0.00111841095f, 0.00111859715f,
+    0.00111874112f, 0.00111884289f, 0.00111890245f, 0.00111891983f,
+    0.00111889504f, 0.0011188281f, 0.00111871902f, 0.00111856783f,
+    0.00111837455f, 0.0011181392f, 0.0011178618f, 0.00111754239f,
+    0.00111718099f, 0.00111677763f, 0.00111633234f, 0.00111584516f,
+    0.00111531612f, 0.00111474525f, 0.00111413259f, 0.00111347819f,
+    0.00111278208f, 0.00111204431f, 0.00111126491f, 0.00111044394f,
+    0.00110958143f, 0.00110867745f, 0.00110773204f, 0.00110674524f,
+    0.00110571713f, 0.00110464774f, 0.00110353713f, 0.00110238537f,
+    0.0011011925f, 0.0010999586f, 0.00109868373f, 0.00109736794f,
+    0.00109601131f, 0.00109461389f, 0.00109317577f, 0.001091697f,
+    0.00109017766f, 0.00108861783f, 0.00108701757f, 0.00108537696f,
+    0.00108369609f, 0.00108197502f, 0.00108021384f, 0.00107841264f,
+    0.00107657148f, 0.00107469047f, 0.00107276968f, 0.0010708092f,
+    0.00106880912f, 0.00106676954f, 0.00106469054f, 0.00106257222f,
+    0.00106041467f, 0.00105821798f, 0.00105598227f, 0.00105370762f,
+    0.00105139414f, 0.00104904193f, 0.00104665109f, 0.00104422172f,
+    0.00104175394f, 0.00103924785f, 0.00103670356f, 0.00103412118f,
+    0.00103150083f, 0.00102884261f, 0.00102614664f, 0.00102341304f,
+    0.00102064192f, 0.00101783341f, 0.00101498762f, 0.00101210467f,
+    0.00100918469f, 0.00100622781f, 0.00100323414f, 0.00100020382f,
+    0.000997136966f, 0.000994033718f, 0.000990894203f, 0.000987718554f,
+    0.000984506905f, 0.000981259389f, 0.000977976143f, 0.000974657306f,
+    0.000971303014f, 0.000967913409f, 0.000964488632f, 0.000961028825f,
+    0.000957534132f, 0.000954004698f, 0.00095044067f, 0.000946842195f,
+    0.000943209422f, 0.000939542501f, 0.000935841583f, 0.000932106822f,
+    0.00092833837f, 0.000924536382f, 0.000920701015f, 0.000916832427f,
+    0.000912930775f, 0.000908996219f, 0.000905028921f, 0.000901029042f,
+    0.000896996746f, 0.000892932197f, 0.00088883556f, 0.000884707003f,
+    0.000880546693f, 0.000876354799f, 0.000872131492f, 0.000867876941f,
+    0.000863591321f, 0.000859274804f, 0.000854927565f, 0.000850549779f,
+    0.000846141623f, 0.000841703275f, 0.000837234915f, 0.00083273672f,
+    0.000828208874f, 0.000823651557f, 0.000819064953f, 0.000814449246f,
+    0.000809804621f, 0.000805131264f, 0.000800429362f, 0.000795699104f,
+    0.000790940679f, 0.000786154276f, 0.000781340088f, 0.000776498305f,
+    0.000771629122f, 0.000766732731f, 0.000761809329f, 0.000756859111f,
+    0.000751882273f, 0.000746879015f, 0.000741849534f, 0.000736794029f,
+    0.000731712703f, 0.000726605755f, 0.000721473388f, 0.000716315806f,
+    0.000711133213f, 0.000705925813f, 0.000700693812f, 0.000695437417f,
+    0.000690156835f, 0.000684852275f, 0.000679523945f, 0.000674172056f,
+    0.000668796819f, 0.000663398445f, 0.000657977145f, 0.000652533135f,
+    0.000647066626f, 0.000641577835f, 0.000636066976f, 0.000630534265f,
+    0.00062497992f, 0.000619404158f, 0.000613807198f, 0.000608189258f,
+    0.000602550558f, 0.000596891319f, 0.000591211762f, 0.000585512109f,
+    0.000579792582f, 0.000574053405f, 0.000568294801f, 0.000562516996f,
+    0.000556720213f, 0.000550904678f, 0.000545070619f, 0.000539218262f,
+    0.000533347835f, 0.000527459565f, 0.000521553683f, 0.000515630416f,
+    0.000509689995f, 0.00050373265f, 0.000497758613f, 0.000491768115f,
+    0.000485761388f, 0.000479738664f, 0.000473700177f, 0.000467646161f,
+    0.000461576849f, 0.000455492476f, 0.000449393278f, 0.000443279489f,
+    0.000437151346f, 0.000431009086f, 0.000424852944f, 0.000418683159f,
+    0.000412499968f, 0.00040630361f, 0.000400094323f, 0.000393872345f,
+    0.000387637918f, 0.000381391279f, 0.000375132669f, 0.000368862329f,
+    0.0003625805f, 0.000356287422f, 0.000349983338f, 0.000343668488f,
+    0.000337343116f, 0.000331007463f, 0.000324661772f, 0.000318306287f,
+    0.00031194125f, 0.000305566905f, 0.000299183496f, 0.000292791267f,
+    0.000286390463f, 0.000279981327f, 0.000273564104f, 0.00026713904f,
+    0.00026070638f, 0.000254266368f, 0.000247819251f, 0.000241365275f,
+    0.000234904684f, 0.000228437725f, 0.000221964645f, 0.000215485689f,
+    0.000209001104f, 0.000202511136f, 0.000196016033f, 0.000189516041f,
+    0.000183011406f, 0.000176502376f, 0.000169989198f, 0.000163472119f,
+    0.000156951385f, 0.000150427244f, 0.000143899944f, 0.000137369731f,
+    0.000130836852f, 0.000124301555f, 0.000117764088f, 0.000111224696f,
+    0.000104683628f, 9.81411308e-05f, 9.15974511e-05f, 8.50528362e-05f,
+    7.8507533e-05f, 7.19617885e-05f, 6.54158497e-05f, 5.88699631e-05f,
+    5.23243755e-05f, 4.57793335e-05f, 3.92350835e-05f, 3.26918718e-05f,
+    2.61499447e-05f, 1.96095481e-05f, 1.3070928e-05f, 6.53433014e-06f,
+    1.04326843e-17f, -6.53181699e-06f, -1.30608757e-05f, -1.9586931e-05f,
+    -2.61097382e-05f, -3.26290527e-05f, -3.91446302e-05f, -4.56562265e-05f,
+    -5.21635978e-05f, -5.86665005e-05f, -6.51646913e-05f, -7.16579269e-05f,
+    -7.81459648e-05f, -8.46285622e-05f, -9.11054771e-05f, -9.75764675e-05f,
+    -0.000104041292f, -0.000110499709f, -0.000116951478f, -0.000123396358f,
+    -0.000129834108f, -0.00013626449f, -0.000142687264f, -0.00014910219f,
+    -0.000155509029f, -0.000161907544f, -0.000168297497f, -0.000174678649f,
+    -0.000181050764f, -0.000187413605f, -0.000193766937f, -0.000200110522f,
+    -0.000206444126f, -0.000212767514f, -0.000219080452f, -0.000225382706f,
+    -0.000231674042f, -0.000237954227f, -0.00024422303f, -0.000250480218f,
+    -0.000256725559f, -0.000262958824f, -0.000269179781f, -0.000275388202f,
+    -0.000281583856f, -0.000287766516f, -0.000293935953f, -0.000300091941f,
+    -0.000306234251f, -0.000312362658f, -0.000318476937f, -0.000324576862f,
+    -0.000330662209f, -0.000336732754f, -0.000342788275f, -0.000348828548f,
+    -0.000354853352f, -0.000360862467f, -0.00036685567f, -0.000372832744f,
+    -0.000378793468f, -0.000384737624f, -0.000390664996f, -0.000396575365f,
+    -0.000402468516f, -0.000408344233f, -0.000414202301f, -0.000420042507f,
+    -0.000425864637f, -0.000431668479f, -0.000437453822f, -0.000443220453f,
+    -0.000448968164f, -0.000454696744f, -0.000460405986f, -0.000466095681f,
+    -0.000471765623f, -0.000477415605f, -0.000483045423f, -0.000488654872f,
+    -0.000494243748f, -0.000499811849f, -0.000505358973f, -0.000510884919f,
+    -0.000516389487f, -0.000521872477f, -0.000527333691f, -0.000532772933f,
+    -0.000538190004f, -0.000543584711f, -0.000548956857f, -0.00055430625f,
+    -0.000559632696f, -0.000564936004f, -0.000570215982f, -0.000575472441f,
+    -0.000580705192f, -0.000585914046f, -0.000591098817f, -0.000596259317f,
+    -0.000601395363f, -0.00060650677f, -0.000611593355f, -0.000616654936f,
+    -0.000621691331f, -0.000626702361f, -0.000631687846f, -0.000636647609f,
+    -0.000641581472f, -0.00064648926f, -0.000651370797f, -0.00065622591f,
+    -0.000661054426f, -0.000665856173f, -0.000670630981f, -0.00067537868f,
+    -0.000680099101f, -0.000684792077f, -0.000689457442f, -0.000694095031f,
+    -0.00069870468f, -0.000703286225f, -0.000707839505f, -0.000712364359f,
+    -0.000716860627f, -0.000721328152f, -0.000725766775f, -0.000730176341f,
+    -0.000734556695f, -0.000738907683f, -0.000743229152f, -0.000747520951f,
+    -0.000751782929f, -0.000756014938f, -0.000760216829f, -0.000764388455f,
+    -0.000768529672f, -0.000772640334f, -0.000776720299f, -0.000780769425f,
+    -0.00078478757f, -0.000788774597f, -0.000792730365f, -0.000796654738f,
+    -0.000800547581f, -0.000804408759f, -0.000808238138f, -0.000812035587f,
+    -0.000815800974f, -0.000819534171f, -0.000823235048f, -0.000826903479f,
+    -0.000830539339f, -0.000834142501f, -0.000837712845f, -0.000841250247f,
+    -0.000844754586f, -0.000848225745f, -0.000851663604f, -0.000855068046f,
+    -0.000858438957f, -0.000861776223f, -0.00086507973f, -0.000868349367f,
+    -0.000871585024f, -0.000874786592f, -0.000877953964f, -0.000881087032f,
+    -0.000884185694f, -0.000887249844f, -0.000890279381f, -0.000893274204f,
+    -0.000896234214f, -0.000899159312f, -0.000902049401f, -0.000904904387f,
+    -0.000907724175f, -0.000910508672f, -0.000913257787f, -0.000915971431f,
+    -0.000918649514f, -0.000921291949f, -0.00092389865f, -0.000926469534f,
+    -0.000929004517f, -0.000931503517f, -0.000933966454f, -0.000936393248f,
+    -0.000938783824f, -0.000941138104f, -0.000943456013f, -0.000945737479f,
+    -0.000947982429f, -0.000950190793f, -0.000952362501f, -0.000954497487f,
+    -0.000956595683f, -0.000958657026f, -0.00096068145f, -0.000962668895f,
+    -0.0009646193f, -0.000966532605f, -0.000968408753f, -0.000970247687f,
+    -0.000972049352f, -0.000973813695f, -0.000975540664f, -0.000977230208f,
+    -0.000978882278f, -0.000980496825f, -0.000982073804f, -0.00098361317f,
+    -0.000985114879f, -0.000986578889f, -0.00098800516f, -0.000989393651f,
+    -0.000990744327f, -0.000992057149f, -0.000993332084f, -0.000994569097f,
+    -0.000995768157f, -0.000996929234f, -0.000998052298f, -0.000999137321f,
+    -0.00100018428f, -0.00100119314f, -0.00100216389f, -0.00100309651f,
+    -0.00100399096f, -0.00100484724f, -0.00100566533f, -0.00100644521f,
+    -0.00100718686f, -0.00100789027f, -0.00100855544f, -0.00100918235f,
+    -0.00100977098f, -0.00101032134f, -0.00101083342f, -0.00101130722f,
+    -0.00101174272f, -0.00101213993f, -0.00101249885f, -0.00101281948f,
+    -0.00101310182f, -0.00101334588f, -0.00101355166f, -0.00101371917f,
+    -0.00101384842f, -0.00101393942f, -0.00101399217f, -0.0010140067f,
+    -0.00101398301f, -0.00101392112f, -0.00101382105f, -0.00101368282f,
+    -0.00101350645f, -0.00101329195f, -0.00101303935f, -0.00101274868f,
+    -0.00101241996f, -0.00101205322f, -0.00101164849f, -0.00101120579f,
+    -0.00101072516f, -0.00101020663f, -0.00100965023f, -0.001009056f,
+    -0.00100842399f, -0.00100775421f, -0.00100704672f, -0.00100630156f,
+    -0.00100551877f, -0.00100469839f, -0.00100384047f, -0.00100294505f,
+    -0.00100201219f, -0.00100104193f, -0.00100003433f, -0.000998989432f,
+    -0.000997907294f, -0.000996787972f, -0.000995631522f, -0.000994438002f,
+    -0.00099320747f, -0.000991939989f, -0.000990635619f, -0.000989294425f,
+    -0.00098791647f, -0.000986501822f, -0.000985050547f, -0.000983562714f,
+    -0.000982038394f, -0.000980477658f, -0.000978880578f, -0.00097724723f,
+    -0.000975577688f, -0.00097387203f, -0.000972130334f, -0.000970352679f,
+    -0.000968539146f, -0.000966689817f, -0.000964804776f, -0.000962884108f,
+    -0.000960927898f, -0.000958936234f, -0.000956909206f, -0.000954846902f,
+    -0.000952749415f, -0.000950616836f, -0.00094844926f, -0.000946246782f,
+    -0.000944009498f, -0.000941737507f, -0.000939430907f, -0.000937089798f,
+    -0.000934714282f, -0.000932304462f, -0.000929860441f, -0.000927382326f,
+    -0.000924870223f, -0.000922324238f, -0.000919744482f, -0.000917131065f,
+    -0.000914484098f, -0.000911803694f, -0.000909089967f, -0.000906343031f,
+    -0.000903563003f, -0.000900750002f, -0.000897904144f, -0.000895025551f,
+    -0.000892114344f, -0.000889170644f, -0.000886194576f, -0.000883186263f,
+    -0.000880145832f, -0.00087707341f, -0.000873969124f, -0.000870833104f,
+    -0.000867665481f, -0.000864466386f, -0.000861235951f, -0.000857974311f,
+    -0.000854681601f, -0.000851357956f, -0.000848003514f, -0.000844618413f,
+    -0.000841202792f, -0.000837756792f, -0.000834280555f, -0.000830774223f,
+    -0.000827237939f, -0.00082367185f, -0.0008200761f, -0.000816450836f,
+    -0.000812796207f, -0.000809112362f, -0.00080539945f, -0.000801657623f,
+    -0.000797887033f, -0.000794087833f, -0.000790260178f, -0.000786404222f,
+    -0.000782520122f, -0.000778608035f, -0.000774668119f, -0.000770700534f,
+    -0.00076670544f, -0.000762682997f, -0.000758633368f, -0.000754556716f,
+    -0.000750453205f, -0.000746323001f, -0.000742166268f, -0.000737983174f,
+    -0.000733773887f, -0.000729538576f, -0.000725277409f, -0.000720990558f,
+    -0.000716678195f, -0.00071234049f, -0.000707977619f, -0.000703589754f,
+    -0.000699177071f, -0.000694739745f, -0.000690277954f, -0.000685791875f,
+    -0.000681281686f, -0.000676747567f, -0.000672189697f, -0.000667608258f,
+    -0.000663003432f, -0.0006583754f, -0.000653724347f, -0.000649050456f,
+    -0.000644353912f, -0.000639634902f, -0.000634893611f, -0.000630130227f,
+    -0.000625344938f, -0.000620537932f, -0.0006157094f, -0.000610859531f,
+    -0.000605988516f, -0.000601096548f, -0.000596183818f, -0.00059125052f,
+    -0.000586296847f, -0.000581322995f, -0.000576329157f, -0.000571315531f,
+    -0.000566282313f, -0.000561229699f, -0.000556157889f, -0.00055106708f,
+    -0.000545957471f, -0.000540829262f, -0.000535682655f, -0.000530517849f,
+    -0.000525335047f, -0.00052013445f, -0.000514916262f, -0.000509680686f,
+    -0.000504427926f, -0.000499158186f, -0.000493871672f, -0.000488568589f,
+    -0.000483249144f, -0.000477913543f, -0.000472561994f, -0.000467194704f,
+    -0.000461811882f, -0.000456413737f, -0.000451000477f, -0.000445572313f,
+    -0.000440129456f, -0.000434672115f, -0.000429200502f, -0.000423714829f,
+    -0.000418215307f, -0.00041270215f, -0.000407175571f, -0.000401635782f,
+    -0.000396082999f, -0.000390517434f, -0.000384939303f, -0.00037934882f,
+    -0.000373746202f, -0.000368131664f, -0.000362505421f, -0.000356867692f,
+    -0.000351218692f, -0.000345558638f, -0.000339887749f, -0.000334206242f,
+    -0.000328514335f, -0.000322812247f, -0.000317100197f, -0.000311378403f,
+    -0.000305647086f, -0.000299906464f, -0.000294156758f, -0.000288398187f,
+    -0.000282630973f, -0.000276855336f, -0.000271071496f, -0.000265279675f,
+    -0.000259480095f, -0.000253672976f, -0.00024785854f, -0.00024203701f,
+    -0.000236208608f, -0.000230373555f, -0.000224532074f, -0.000218684388f,
+    -0.00021283072f, -0.000206971292f, -0.000201106327f, -0.000195236049f,
+    -0.000189360681f, -0.000183480446f, -0.000177595568f, -0.000171706269f,
+    -0.000165812775f, -0.000159915308f, -0.000154014092f, -0.000148109352f,
+    -0.00014220131f, -0.000136290191f, -0.000130376219f, -0.000124459617f,
+    -0.00011854061f, -0.000112619422f, -0.000106696277f, -0.000100771397f,
+    -9.48450087e-05f, -8.89173343e-05f, -8.29885981e-05f, -7.7059024e-05f,
+    -7.11288356e-05f, -6.51982566e-05f, -5.92675108e-05f, -5.33368215e-05f,
+    -4.74064123e-05f, -4.14765066e-05f, -3.55473275e-05f, -2.96190983e-05f,
+    -2.36920418e-05f, -1.77663811e-05f, -1.18423389e-05f, -5.92013769e-06f,
+    7.56546956e-18f, 5.91785191e-06f, 1.18331959e-05f, 1.77458101e-05f,
+    2.36554728e-05f, 2.95619624e-05f, 3.54650575e-05f, 4.13645371e-05f,
+    4.72601802e-05f, 5.31517662e-05f, 5.90390747e-05f, 6.49218854e-05f,
+    7.07999784e-05f, 7.66731341e-05f, 8.25411331e-05f, 8.84037561e-05f,
+    9.42607845e-05f, 0.000100112f, 0.000105957183f, 0.000111796118f,
+    0.000117628585f, 0.000123454368f, 0.00012927325f, 0.000135085014f,
+    0.000140889444f, 0.000146686324f, 0.000152475439f, 0.000158256573f,
+    0.000164029512f, 0.000169794041f, 0.000175549947f, 0.000181297015f,
+    0.000187035033f, 0.000192763788f, 0.000198483068f, 0.00020419266f,
+    0.000209892354f, 0.000215581938f, 0.000221261203f, 0.000226929937f,
+    0.000232587932f, 0.000238234978f, 0.000243870867f, 0.00024949539f,
+    0.000255108341f, 0.000260709513f, 0.000266298698f, 0.00027187569f,
+    0.000277440285f, 0.000282992278f, 0.000288531463f, 0.000294057638f,
+    0.000299570599f, 0.000305070144f, 0.00031055607f, 0.000316028176f,
+    0.000321486261f, 0.000326930125f, 0.000332359568f, 0.000337774391f,
+    0.000343174397f, 0.000348559386f, 0.000353929163f, 0.00035928353f,
+    0.000364622291f, 0.000369945253f, 0.000375252219f, 0.000380542997f,
+    0.000385817394f, 0.000391075216f, 0.000396316272f, 0.000401540371f,
+    0.000406747323f, 0.000411936939f, 0.000417109028f, 0.000422263404f,
+    0.000427399879f, 0.000432518267f, 0.000437618381f, 0.000442700036f,
+    0.000447763048f, 0.000452807233f, 0.000457832409f, 0.000462838393f,
+    0.000467825005f, 0.000472792064f, 0.000477739391f, 0.000482666805f,
+    0.000487574131f, 0.00049246119f, 0.000497327806f, 0.000502173803f,
+    0.000506999008f, 0.000511803246f, 0.000516586344f, 0.000521348131f,
+    0.000526088434f, 0.000530807085f, 0.000535503912f, 0.000540178749f,
+    0.000544831426f, 0.000549461778f, 0.000554069639f, 0.000558654843f,
+    0.000563217226f, 0.000567756627f, 0.000572272881f, 0.000576765828f,
+    0.000581235309f, 0.000585681163f, 0.000590103231f, 0.000594501358f,
+    0.000598875385f, 0.000603225159f, 0.000607550523f, 0.000611851325f,
+    0.000616127412f, 0.000620378633f, 0.000624604836f, 0.000628805872f,
+    0.000632981594f, 0.000637131852f, 0.000641256501f, 0.000645355395f,
+    0.00064942839f, 0.000653475342f, 0.000657496109f, 0.000661490548f,
+    0.000665458521f, 0.000669399888f, 0.00067331451f, 0.00067720225f,
+    0.000681062973f, 0.000684896542f, 0.000688702825f, 0.000692481689f,
+    0.000696233f, 0.00069995663f, 0.000703652448f, 0.000707320325f,
+    0.000710960135f, 0.000714571751f, 0.000718155047f, 0.000721709901f,
+    0.000725236188f, 0.000728733787f, 0.000732202577f, 0.000735642439f,
+    0.000739053254f, 0.000742434905f, 0.000745787276f, 0.000749110251f,
+    0.000752403718f, 0.000755667562f, 0.000758901674f, 0.000762105941f,
+    0.000765280256f, 0.00076842451f, 0.000771538596f, 0.000774622409f,
+    0.000777675843f, 0.000780698797f, 0.000783691167f, 0.000786652852f,
+    0.000789583754f, 0.000792483773f, 0.000795352811f, 0.000798190774f,
+    0.000800997566f, 0.000803773093f, 0.000806517263f, 0.000809229984f,
+    0.000811911167f, 0.000814560722f, 0.000817178562f, 0.0008197646f,
+    0.000822318752f, 0.000824840934f, 0.000827331062f, 0.000829789056f,
+    0.000832214835f, 0.00083460832f, 0.000836969433f, 0.000839298099f,
+    0.000841594241f, 0.000843857787f, 0.000846088662f, 0.000848286796f,
+    0.000850452119f, 0.000852584561f, 0.000854684055f, 0.000856750535f,
+    0.000858783936f, 0.000860784193f, 0.000862751244f, 0.000864685028f,
+    0.000866585485f, 0.000868452556f, 0.000870286183f, 0.000872086311f,
+    0.000873852885f, 0.00087558585f, 0.000877285156f, 0.000878950749f,
+    0.000880582582f, 0.000882180605f, 0.000883744772f, 0.000885275035f,
+    0.000886771352f, 0.000888233678f, 0.000889661972f, 0.000891056193f,
+    0.000892416301f, 0.000893742259f, 0.00089503403f, 0.000896291578f,
+    0.000897514869f, 0.000898703871f, 0.000899858551f, 0.000900978879f,
+    0.000902064827f, 0.000903116367f, 0.000904133473f, 0.000905116119f,
+    0.000906064281f, 0.000906977938f, 0.000907857069f, 0.000908701653f,
+    0.000909511672f, 0.000910287109f, 0.000911027948f, 0.000911734174f,
+    0.000912405774f, 0.000913042737f, 0.000913645052f, 0.000914212708f,
+    0.000914745699f, 0.000915244018f, 0.000915707659f, 0.000916136618f,
+    0.000916530893f, 0.000916890482f, 0.000917215384f, 0.000917505601f,
+    0.000917761136f, 0.000917981992f, 0.000918168174f, 0.000918319689f,
+    0.000918436544f, 0.000918518749f, 0.000918566313f, 0.000918579248f,
+    0.000918557567f, 0.000918501285f, 0.000918410416f, 0.000918284978f,
+    0.000918124988f, 0.000917930466f, 0.000917701433f, 0.000917437911f,
+    0.000917139922f, 0.000916807492f, 0.000916440646f, 0.000916039411f,
+    0.000915603816f, 0.00091513389f, 0.000914629665f, 0.000914091172f,
+    0.000913518445f, 0.000912911519f, 0.00091227043f, 0.000911595216f,
+    0.000910885914f, 0.000910142566f, 0.000909365211f, 0.000908553892f,
+    0.000907708654f, 0.000906829541f, 0.000905916599f, 0.000904969876f,
+    0.00090398942f, 0.000902975282f, 0.000901927512f, 0.000900846163f,
+    0.000899731289f, 0.000898582945f, 0.000897401187f, 0.000896186072f,
+    0.000894937659f, 0.000893656008f, 0.00089234118f, 0.000890993237f,
+    0.000889612243f, 0.000888198263f, 0.000886751363f, 0.00088527161f,
+    0.000883759072f, 0.000882213819f, 0.000880635923f, 0.000879025454f,
+    0.000877382486f, 0.000875707094f, 0.000873999354f, 0.000872259341f,
+    0.000870487135f, 0.000868682814f, 0.000866846459f, 0.000864978151f,
+    0.000863077973f, 0.00086114601f, 0.000859182345f, 0.000857187065f,
+    0.000855160258f, 0.000853102012f, 0.000851012417f, 0.000848891564f,
+    0.000846739544f, 0.000844556451f, 0.00084234238f, 0.000840097424f,
+    0.000837821681f, 0.000835515249f, 0.000833178226f, 0.000830810713f,
+    0.000828412809f, 0.000825984618f, 0.000823526242f, 0.000821037785f,
+    0.000818519354f, 0.000815971054f, 0.000813392993f, 0.000810785279f,
+    0.000808148023f, 0.000805481336f, 0.000802785328f, 0.000800060112f,
+    0.000797305804f, 0.000794522517f, 0.000791710369f, 0.000788869475f,
+    0.000785999954f, 0.000783101925f, 0.000780175509f, 0.000777220827f,
+    0.000774238f, 0.000771227152f, 0.000768188408f, 0.000765121892f,
+    0.000762027732f, 0.000758906053f, 0.000755756985f, 0.000752580656f,
+    0.000749377197f, 0.000746146739f, 0.000742889414f, 0.000739605355f,
+    0.000736294697f, 0.000732957573f, 0.000729594121f, 0.000726204477f,
+    0.000722788779f, 0.000719347165f, 0.000715879776f, 0.000712386751f,
+    0.000708868233f, 0.000705324364f, 0.000701755286f, 0.000698161145f,
+    0.000694542085f, 0.000690898253f, 0.000687229795f, 0.000683536859f,
+    0.000679819593f, 0.000676078147f, 0.000672312671f, 0.000668523317f,
+    0.000664710235f, 0.000660873581f, 0.000657013505f, 0.000653130165f,
+    0.000649223713f, 0.000645294308f, 0.000641342104f, 0.000637367262f,
+    0.000633369937f, 0.000629350291f, 0.000625308483f, 0.000621244674f,
+    0.000617159026f, 0.0006130517f, 0.00060892286f, 0.00060477267f,
+    0.000600601295f, 0.000596408899f, 0.000592195649f, 0.000587961712f,
+    0.000583707255f, 0.000579432446f, 0.000575137455f, 0.00057082245f,
+    0.000566487602f, 0.000562133083f, 0.000557759063f, 0.000553365716f,
+    0.000548953213f, 0.000544521729f, 0.000540071438f, 0.000535602515f,
+    0.000531115135f, 0.000526609475f, 0.000522085712f, 0.000517544022f,
+    0.000512984584f, 0.000508407577f, 0.00050381318f, 0.000499201572f,
+    0.000494572933f, 0.000489927446f, 0.000485265291f, 0.000480586651f,
+    0.000475891708f, 0.000471180645f, 0.000466453646f, 0.000461710895f,
+    0.000456952577f, 0.000452178877f, 0.000447389982f, 0.000442586077f,
+    0.000437767349f, 0.000432933985f, 0.000428086173f, 0.000423224102f,
+    0.00041834796f, 0.000413457935f, 0.000408554219f, 0.000403637f,
+    0.00039870647f, 0.000393762818f, 0.000388806237f, 0.000383836919f,
+    0.000378855054f, 0.000373860836f, 0.000368854458f, 0.000363836114f,
+    0.000358805995f, 0.000353764298f, 0.000348711216f, 0.000343646943f,
+    0.000338571676f, 0.000333485609f, 0.000328388939f, 0.000323281861f,
+    0.000318164571f, 0.000313037268f, 0.000307900146f, 0.000302753405f,
+    0.000297597241f, 0.000292431853f, 0.000287257438f, 0.000282074195f,
+    0.000276882323f, 0.000271682021f, 0.000266473487f, 0.000261256921f,
+    0.000256032523f, 0.000250800493f, 0.000245561031f, 0.000240314336f,
+    0.00023506061f, 0.000229800053f, 0.000224532866f, 0.000219259249f,
+    0.000213979405f, 0.000208693534f, 0.000203401838f, 0.000198104518f,
+    0.000192801776f, 0.000187493815f, 0.000182180835f, 0.00017686304f,
+    0.000171540631f, 0.00016621381f, 0.000160882781f, 0.000155547744f,
+    0.000150208904f, 0.000144866463f, 0.000139520623f, 0.000134171586f,
+    0.000128819557f, 0.000123464736f, 0.000118107329f, 0.000112747536f,
+    0.000107385561f, 0.000102021607f, 9.66558772e-05f, 9.12885735e-05f,
+    8.59198991e-05f, 8.05500568e-05f, 7.51792494e-05f, 6.98076795e-05f,
+    6.44355499e-05f, 5.90630631e-05f, 5.36904217e-05f, 4.83178281e-05f,
+    4.29454848e-05f, 3.7573594e-05f, 3.22023579e-05f, 2.68319786e-05f,
+    2.14626581e-05f, 1.60945983e-05f, 1.0728001e-05f, 5.36306775e-06f,
+    2.56738811e-18f, -5.36100089e-06f, -1.07197338e-05f, -1.60759976e-05f,
+    -2.14295916e-05f, -2.6780315e-05f, -3.21279675e-05f, -3.74723486e-05f,
+    -4.28132584e-05f, -4.8150497e-05f, -5.34838647e-05f, -5.8813162e-05f,
+    -6.41381899e-05f, -6.94587492e-05f, -7.47746414e-05f, -8.00856678e-05f,
+    -8.53916304e-05f, -9.06923312e-05f, -9.59875724e-05f, -0.000101277157f,
+    -0.000106560887f, -0.000111838567f, -0.000117109999f, -0.000122374988f,
+    -0.000127633338f, -0.000132884853f, -0.000138129337f, -0.000143366597f,
+    -0.000148596438f, -0.000153818664f, -0.000159033084f, -0.000164239502f,
+    -0.000169437727f, -0.000174627565f, -0.000179808824f, -0.000184981313f,
+    -0.000190144839f, -0.000195299212f, -0.000200444241f, -0.000205579736f,
+    -0.000210705507f, -0.000215821364f, -0.00022092712f, -0.000226022585f,
+    -0.000231107571f, -0.00023618189f, -0.000241245357f, -0.000246297784f,
+    -0.000251338984f, -0.000256368774f, -0.000261386966f, -0.000266393378f,
+    -0.000271387824f, -0.000276370122f, -0.000281340088f, -0.000286297539f,
+    -0.000291242294f, -0.000296174172f, -0.000301092991f, -0.000305998572f,
+    -0.000310890734f, -0.000315769299f, -0.000320634087f, -0.000325484922f,
+    -0.000330321625f, -0.00033514402f, -0.00033995193f, -0.000344745181f,
+    -0.000349523597f, -0.000354287003f, -0.000359035227f, -0.000363768096f,
+    -0.000368485436f, -0.000373187076f, -0.000377872845f, -0.000382542573f,
+    -0.000387196089f, -0.000391833226f, -0.000396453814f, -0.000401057685f,
+    -0.000405644674f, -0.000410214612f, -0.000414767336f, -0.00041930268f,
+    -0.000423820479f, -0.000428320571f, -0.000432802792f, -0.000437266981f,
+    -0.000441712977f, -0.000446140619f, -0.000450549746f, -0.000454940201f,
+    -0.000459311826f, -0.000463664462f, -0.000467997952f, -0.000472312142f,
+    -0.000476606876f, -0.000480882f, -0.00048513736f, -0.000489372803f,
+    -0.000493588178f, -0.000497783334f, -0.00050195812f, -0.000506112387f,
+    -0.000510245986f, -0.00051435877f, -0.000518450591f, -0.000522521304f,
+    -0.000526570763f, -0.000530598824f, -0.000534605344f, -0.000538590179f,
+    -0.000542553189f, -0.000546494232f, -0.000550413167f, -0.000554309857f,
+    -0.000558184163f, -0.000562035947f, -0.000565865073f, -0.000569671406f,
+    -0.00057345481f, -0.000577215153f, -0.000580952301f, -0.000584666123f,
+    -0.000588356488f, -0.000592023265f, -0.000595666326f, -0.000599285542f,
+    -0.000602880786f, -0.000606451933f, -0.000609998857f, -0.000613521433f,
+    -0.000617019538f, -0.000620493051f, -0.000623941848f, -0.000627365811f,
+    -0.00063076482f, -0.000634138756f, -0.000637487502f, -0.000640810941f,
+    -0.000644108958f, -0.000647381438f, -0.000650628269f, -0.000653849337f,
+    -0.000657044531f, -0.00066021374f, -0.000663356857f, -0.000666473771f,
+    -0.000669564375f, -0.000672628564f, -0.000675666233f, -0.000678677276f,
+    -0.00068166159f, -0.000684619074f, -0.000687549627f, -0.000690453148f,
+    -0.000693329539f, -0.000696178701f, -0.000699000537f, -0.000701794953f,
+    -0.000704561853f, -0.000707301143f, -0.000710012731f, -0.000712696526f,
+    -0.000715352437f, -0.000717980374f, -0.00072058025f, -0.000723151978f,
+    -0.00072569547f, -0.000728210644f, -0.000730697413f, -0.000733155697f,
+    -0.000735585412f, -0.000737986479f, -0.000740358819f, -0.000742702352f,
+    -0.000745017002f, -0.000747302692f, -0.000749559348f, -0.000751786896f,
+    -0.000753985262f, -0.000756154377f, -0.000758294168f, -0.000760404567f,
+    -0.000762485505f, -0.000764536916f, -0.000766558733f, -0.000768550893f,
+    -0.00077051333f, -0.000772445982f, -0.000774348789f, -0.000776221691f,
+    -0.000778064627f, -0.00077987754f, -0.000781660373f, -0.000783413072f,
+    -0.00078513558f, -0.000786827846f, -0.000788489817f, -0.000790121441f,
+    -0.00079172267f, -0.000793293455f, -0.000794833747f, -0.000796343501f,
+    -0.000797822672f, -0.000799271216f, -0.00080068909f, -0.000802076252f,
+    -0.000803432661f, -0.00080475828f, -0.000806053069f, -0.000807316991f,
+    -0.000808550011f, -0.000809752095f, -0.000810923208f, -0.000812063319f,
+    -0.000813172397f, -0.000814250412f, -0.000815297334f, -0.000816313138f,
+    -0.000817297795f, -0.000818251282f, -0.000819173574f, -0.000820064649f,
+    -0.000820924485f, -0.000821753061f, -0.000822550359f, -0.00082331636f,
+    -0.000824051048f, -0.000824754406f, -0.000825426421f, -0.00082606708f,
+    -0.000826676369f, -0.000827254279f, -0.000827800799f, -0.000828315921f,
+    -0.000828799638f, -0.000829251943f, -0.000829672832f, -0.000830062301f,
+    -0.000830420347f, -0.000830746968f, -0.000831042166f, -0.000831305939f,
+    -0.000831538291f, -0.000831739226f, -0.000831908746f, -0.000832046859f,
+    -0.000832153571f, -0.00083222889f, -0.000832272825f, -0.000832285387f,
+    -0.000832266587f, -0.000832216438f, -0.000832134954f, -0.000832022151f,
+    -0.000831878043f, -0.00083170265f, -0.000831495988f, -0.000831258079f,
+    -0.000830988944f, -0.000830688603f, -0.000830357081f, -0.000829994403f,
+    -0.000829600593f, -0.000829175678f, -0.000828719687f, -0.000828232649f,
+    -0.000827714593f, -0.000827165552f, -0.000826585558f, -0.000825974644f,
+    -0.000825332846f, -0.000824660199f, -0.000823956741f, -0.000823222511f,
+    -0.000822457546f, -0.000821661889f, -0.000820835581f, -0.000819978664f,
+    -0.000819091184f, -0.000818173184f, -0.000817224712f, -0.000816245814f,
+    -0.00081523654f, -0.000814196939f, -0.000813127061f, -0.00081202696f,
+    -0.000810896687f, -0.000809736297f, -0.000808545845f, -0.000807325388f,
+    -0.000806074982f, -0.000804794688f, -0.000803484564f, -0.000802144671f,
+    -0.000800775071f, -0.000799375827f, -0.000797947003f, -0.000796488665f,
+    -0.000795000878f, -0.000793483711f, -0.00079193723f, -0.000790361507f,
+    -0.000788756611f, -0.000787122614f, -0.000785459588f, -0.000783767609f,
+    -0.00078204675f, -0.000780297087f, -0.000778518698f, -0.00077671166f,
+    -0.000774876052f, -0.000773011955f, -0.00077111945f, -0.000769198618f,
+    -0.000767249544f, -0.000765272311f, -0.000763267004f, -0.000761233711f,
+    -0.000759172518f, -0.000757083513f, -0.000754966786f, -0.000752822428f,
+    -0.000750650529f, -0.000748451182f, -0.000746224481f, -0.00074397052f,
+    -0.000741689394f, -0.000739381199f, -0.000737046034f, -0.000734683995f,
+    -0.000732295183f, -0.000729879698f, -0.00072743764f, -0.000724969113f,
+    -0.000722474219f, -0.000719953062f, -0.000717405748f, -0.000714832382f,
+    -0.000712233071f, -0.000709607924f, -0.000706957048f, -0.000704280554f,
+    -0.000701578553f, -0.000698851155f, -0.000696098474f, -0.000693320622f,
+    -0.000690517714f, -0.000687689866f, -0.000684837192f, -0.000681959811f,
+    -0.000679057841f, -0.000676131399f, -0.000673180605f, -0.00067020558f,
+    -0.000667206446f, -0.000664183324f, -0.000661136338f, -0.000658065611f,
+    -0.000654971269f, -0.000651853436f, -0.00064871224f, -0.000645547807f,
+    -0.000642360266f, -0.000639149746f, -0.000635916376f, -0.000632660287f,
+    -0.00062938161f, -0.000626080478f, -0.000622757023f, -0.000619411379f,
+    -0.000616043681f, -0.000612654064f, -0.000609242663f, -0.000605809617f,
+    -0.000602355062f, -0.000598879137f, -0.000595381981f, -0.000591863734f,
+    -0.000588324536f, -0.000584764529f, -0.000581183854f, -0.000577582656f,
+    -0.000573961076f, -0.00057031926f, -0.000566657352f, -0.000562975498f,
+    -0.000559273845f, -0.000555552538f, -0.000551811727f, -0.000548051559f,
+    -0.000544272183f, -0.000540473749f, -0.000536656408f, -0.00053282031f,
+    -0.000528965608f, -0.000525092453f, -0.000521200998f, -0.000517291397f,
+    -0.000513363805f, -0.000509418376f, -0.000505455265f, -0.000501474629f,
+    -0.000497476624f, -0.000493461407f, -0.000489429137f, -0.000485379971f,
+    -0.000481314069f, -0.000477231591f, -0.000473132695f, -0.000469017544f,
+    -0.000464886298f, -0.000460739119f, -0.000456576169f, -0.000452397612f,
+    -0.00044820361f, -0.000443994327f, -0.000439769929f, -0.000435530579f,
+    -0.000431276443f, -0.000427007687f, -0.000422724477f, -0.000418426981f,
+    -0.000414115366f, -0.000409789798f, -0.000405450448f, -0.000401097483f,
+    -0.000396731072f, -0.000392351386f, -0.000387958594f, -0.000383552866f,
+    -0.000379134374f, -0.000374703289f, -0.000370259783f, -0.000365804027f,
+    -0.000361336195f, -0.000356856459f, -0.000352364992f, -0.000347861969f,
+    -0.000343347562f, -0.000338821947f, -0.000334285298f, -0.000329737791f,
+    -0.0003251796f, -0.000320610903f, -0.000316031873f, -0.000311442689f,
+    -0.000306843527f, -0.000302234563f, -0.000297615976f, -0.000292987943f,
+    -0.000288350641f, -0.00028370425f, -0.000279048947f, -0.000274384911f,
+    -0.000269712322f, -0.000265031358f, -0.000260342199f, -0.000255645025f,
+    -0.000250940016f, -0.000246227351f, -0.000241507212f, -0.000236779779f,
+    -0.000232045233f, -0.000227303755f, -0.000222555526f, -0.000217800728f,
+    -0.000213039542f, -0.00020827215f, -0.000203498734f, -0.000198719476f,
+    -0.000193934558f, -0.000189144162f, -0.000184348472f, -0.00017954767f,
+    -0.000174741938f, -0.00016993146f, -0.000165116418f, -0.000160296996f,
+    -0.000155473376f, -0.000150645743f, -0.000145814279f, -0.000140979168f,
+    -0.000136140593f, -0.000131298738f, -0.000126453786f, -0.000121605922f,
+    -0.000116755329f, -0.00011190219f, -0.00010704669f, -0.000102189012f,
+    -9.73293396e-05f, -9.24678572e-05f, -8.76047484e-05f, -8.2740197e-05f,
+    -7.78743866e-05f, -7.30075012e-05f, -6.81397243e-05f, -6.32712397e-05f,
+    -5.84022309e-05f, -5.35328817e-05f, -4.86633755e-05f, -4.37938957e-05f,
+    -3.89246258e-05f, -3.40557491e-05f, -2.91874488e-05f, -2.4319908e-05f,
+    -1.94533099e-05f, -1.45878372e-05f, -9.7236729e-06f, -4.86099964e-06f,
+    -1.08660759e-17f, 4.85914358e-06f, 9.71624879e-06f, 1.45711335e-05f,
+    1.94236157e-05f, 2.42735134e-05f, 2.91206452e-05f, 3.39648294e-05f,
+    3.88058847e-05f, 4.36436301e-05f, 4.84778844e-05f, 5.33084671e-05f,
+    5.81351976e-05f, 6.29578955e-05f, 6.77763808e-05f, 7.25904736e-05f,
+    7.73999943e-05f, 8.22047634e-05f, 8.70046018e-05f, 9.17993306e-05f,
+    9.65887712e-05f, 0.000101372745f, 0.000106151075f, 0.000110923582f,
+    0.000115690088f, 0.000120450418f, 0.000125204393f, 0.000129951838f,
+    0.000134692576f, 0.00013942643f, 0.000144153226f, 0.000148872788f,
+    0.00015358494f, 0.000158289509f, 0.00016298632f, 0.000167675199f,
+    0.000172355972f, 0.000177028467f, 0.00018169251f, 0.000186347929f,
+    0.000190994553f, 0.000195632208f, 0.000200260725f, 0.000204879932f,
+    0.000209489658f, 0.000214089735f, 0.000218679992f, 0.00022326026f,
+    0.000227830371f, 0.000232390155f, 0.000236939447f, 0.000241478077f,
+    0.000246005879f, 0.000250522688f, 0.000255028336f, 0.000259522659f,
+    0.000264005491f, 0.000268476668f, 0.000272936027f, 0.000277383403f,
+    0.000281818634f, 0.000286241557f, 0.000290652011f, 0.000295049833f,
+    0.000299434864f, 0.000303806944f, 0.000308165911f, 0.000312511608f,
+    0.000316843875f, 0.000321162554f, 0.000325467489f, 0.000329758522f,
+    0.000334035496f, 0.000338298257f, 0.000342546649f, 0.000346780517f,
+    0.000350999708f, 0.000355204068f, 0.000359393444f, 0.000363567685f,
+    0.000367726639f, 0.000371870156f, 0.000375998084f, 0.000380110275f,
+    0.000384206579f, 0.00038828685f, 0.000392350937f, 0.000396398696f,
+    0.00040042998f, 0.000404444643f, 0.00040844254f, 0.000412423528f,
+    0.000416387462f, 0.0004203342f, 0.0004242636f, 0.000428175521f,
+    0.000432069821f, 0.000435946361f, 0.000439805002f, 0.000443645605f,
+    0.000447468032f, 0.000451272147f, 0.000455057812f, 0.000458824893f,
+    0.000462573255f, 0.000466302763f, 0.000470013285f, 0.000473704687f,
+    0.000477376839f, 0.000481029609f, 0.000484662866f, 0.000488276483f,
+    0.000491870329f, 0.000495444278f, 0.000498998201f, 0.000502531974f,
+    0.00050604547f, 0.000509538564f, 0.000513011134f, 0.000516463056f,
+    0.000519894209f, 0.000523304469f, 0.000526693718f, 0.000530061836f,
+    0.000533408703f, 0.000536734202f, 0.000540038216f, 0.000543320628f,
+    0.000546581324f, 0.000549820188f, 0.000553037107f, 0.000556231967f,
+    0.000559404658f, 0.000562555068f, 0.000565683087f, 0.000568788606f,
+    0.000571871516f, 0.000574931709f, 0.00057796908f, 0.000580983523f,
+    0.000583974931f, 0.000586943203f, 0.000589888234f, 0.000592809924f,
+    0.000595708169f, 0.000598582871f, 0.00060143393f, 0.000604261248f,
+    0.000607064727f, 0.00060984427f, 0.000612599783f, 0.00061533117f,
+    0.000618038338f, 0.000620721194f, 0.000623379647f, 0.000626013604f,
+    0.000628622978f, 0.000631207678f, 0.000633767616f, 0.000636302707f,
+    0.000638812863f, 0.000641297999f, 0.000643758032f, 0.000646192879f,
+    0.000648602457f, 0.000650986685f, 0.000653345483f, 0.000655678772f,
+    0.000657986474f, 0.000660268511f, 0.000662524808f, 0.000664755289f,
+    0.00066695988f, 0.000669138507f, 0.000671291099f, 0.000673417585f,
+    0.000675517894f, 0.000677591957f, 0.000679639706f, 0.000681661074f,
+    0.000683655995f, 0.000685624403f, 0.000687566235f, 0.000689481428f,
+    0.000691369919f, 0.000693231648f, 0.000695066555f, 0.00069687458f,
+    0.000698655667f, 0.000700409757f, 0.000702136796f, 0.000703836729f,
+    0.000705509501f, 0.00070715506f, 0.000708773355f, 0.000710364335f,
+    0.00071192795f, 0.000713464152f, 0.000714972893f, 0.000716454128f,
+    0.00071790781f, 0.000719333895f, 0.000720732341f, 0.000722103105f,
+    0.000723446146f, 0.000724761423f, 0.000726048899f, 0.000727308535f,
+    0.000728540293f, 0.000729744139f, 0.000730920038f, 0.000732067955f,
+    0.000733187859f, 0.000734279717f, 0.0007353435f, 0.000736379177f,
+    0.000737386721f, 0.000738366105f, 0.000739317301f, 0.000740240286f,
+    0.000741135034f, 0.000742001523f, 0.000742839731f, 0.000743649638f,
+    0.000744431223f, 0.000745184467f, 0.000745909354f, 0.000746605866f,
+    0.000747273989f, 0.000747913707f, 0.000748525008f, 0.000749107879f,
+    0.000749662308f, 0.000750188287f, 0.000750685806f, 0.000751154856f,
+    0.000751595432f, 0.000752007527f, 0.000752391137f, 0.000752746258f,
+    0.000753072887f, 0.000753371023f, 0.000753640665f, 0.000753881815f,
+    0.000754094473f, 0.000754278643f, 0.000754434329f, 0.000754561535f,
+    0.000754660267f, 0.000754730533f, 0.000754772341f, 0.0007547857f,
+    0.000754770619f, 0.000754727112f, 0.000754655189f, 0.000754554865f,
+    0.000754426153f, 0.000754269071f, 0.000754083633f, 0.000753869859f,
+    0.000753627766f, 0.000753357375f, 0.000753058706f, 0.000752731782f,
+    0.000752376625f, 0.00075199326f, 0.000751581712f, 0.000751142006f,
+    0.000750674171f, 0.000750178234f, 0.000749654225f, 0.000749102173f,
+    0.000748522111f, 0.000747914072f, 0.000747278087f, 0.000746614193f,
+    0.000745922424f, 0.000745202817f, 0.00074445541f, 0.000743680241f,
+    0.000742877351f, 0.00074204678f, 0.000741188569f, 0.000740302761f,
+    0.000739389401f, 0.000738448533f, 0.000737480203f, 0.000736484457f,
+    0.000735461345f, 0.000734410913f, 0.000733333214f, 0.000732228296f,
+    0.000731096213f, 0.000729937017f, 0.000728750762f, 0.000727537503f,
+    0.000726297296f, 0.000725030198f, 0.000723736266f, 0.00072241556f,
+    0.00072106814f, 0.000719694065f, 0.000718293399f, 0.000716866204f,
+    0.000715412543f, 0.000713932482f, 0.000712426086f, 0.000710893422f,
+    0.000709334558f, 0.000707749562f, 0.000706138503f, 0.000704501453f,
+    0.000702838482f, 0.000701149663f, 0.00069943507f, 0.000697694777f,
+    0.000695928859f, 0.000694137392f, 0.000692320453f, 0.000690478121f,
+    0.000688610474f, 0.000686717593f, 0.000684799557f, 0.00068285645f,
+    0.000680888353f, 0.00067889535f, 0.000676877525f, 0.000674834965f,
+    0.000672767754f, 0.000670675981f, 0.000668559734f, 0.0006664191f,
+    0.000664254171f, 0.000662065037f, 0.000659851789f, 0.00065761452f,
+    0.000655353323f, 0.000653068292f, 0.000650759523f, 0.000648427112f,
+    0.000646071154f, 0.000643691748f, 0.000641288992f, 0.000638862986f,
+    0.000636413829f, 0.000633941623f, 0.00063144647f, 0.000628928471f,
+    0.000626387731f, 0.000623824353f, 0.000621238443f, 0.000618630107f,
+    0.000615999451f, 0.000613346583f, 0.000610671611f, 0.000607974645f,
+    0.000605255793f, 0.000602515167f, 0.000599752878f, 0.000596969039f,
+    0.000594163762f, 0.00059133716f, 0.00058848935f, 0.000585620444f,
+    0.000582730561f, 0.000579819816f, 0.000576888327f, 0.000573936212f,
+    0.00057096359f, 0.000567970581f, 0.000564957306f, 0.000561923884f,
+    0.000558870438f, 0.000555797091f, 0.000552703966f, 0.000549591187f,
+    0.000546458878f, 0.000543307165f, 0.000540136173f, 0.00053694603f,
+    0.000533736863f, 0.000530508799f, 0.000527261968f, 0.000523996499f,
+    0.000520712521f, 0.000517410166f, 0.000514089564f, 0.000510750848f,
+    0.00050739415f, 0.000504019604f, 0.000500627342f, 0.0004972175f,
+    0.000493790213f, 0.000490345616f, 0.000486883845f, 0.000483405037f,
+    0.00047990933f, 0.000476396862f, 0.000472867771f, 0.000469322196f,
+    0.000465760277f, 0.000462182155f, 0.00045858797f, 0.000454977863f,
+    0.000451351977f, 0.000447710454f, 0.000444053437f, 0.000440381069f,
+    0.000436693495f, 0.00043299086f, 0.000429273307f, 0.000425540983f,
+    0.000421794035f, 0.000418032608f, 0.000414256849f, 0.000410466907f,
+    0.000406662929f, 0.000402845064f, 0.00039901346f, 0.000395168268f,
+    0.000391309637f, 0.000387437717f, 0.00038355266f, 0.000379654616f,
+    0.000375743737f, 0.000371820176f, 0.000367884084f, 0.000363935615f,
+    0.000359974922f, 0.000356002158f, 0.000352017479f, 0.000348021038f,
+    0.00034401299f, 0.000339993491f, 0.000335962696f, 0.000331920761f,
+    0.000327867843f, 0.000323804099f, 0.000319729685f, 0.000315644758f,
+    0.000311549478f, 0.000307444001f, 0.000303328486f, 0.000299203092f,
+    0.000295067978f, 0.000290923304f, 0.000286769228f, 0.000282605912f,
+    0.000278433514f, 0.000274252196f, 0.000270062119f, 0.000265863443f,
+    0.00026165633f, 0.000257440941f, 0.000253217439f, 0.000248985985f,
+    0.000244746742f, 0.000240499871f, 0.000236245537f, 0.000231983902f,
+    0.000227715129f, 0.000223439381f, 0.000219156823f, 0.000214867617f,
+    0.000210571929f, 0.000206269922f, 0.00020196176f, 0.000197647608f,
+    0.000193327631f, 0.000189001994f, 0.000184670861f, 0.000180334398f,
+    0.00017599277f, 0.000171646142f, 0.00016729468f, 0.00016293855f,
+    0.000158577917f, 0.000154212948f, 0.000149843807f, 0.000145470662f,
+    0.000141093679f, 0.000136713023f, 0.000132328861f, 0.000127941359f,
+    0.000123550684f, 0.000119157003f, 0.000114760482f, 0.000110361287f,
+    0.000105959585f, 0.000101555543f, 9.71493275e-05f, 9.27411052e-05f,
+    8.8331043e-05f, 8.39193075e-05f, 7.95060653e-05f, 7.50914834e-05f,
+    7.06757283e-05f, 6.62589669e-05f, 6.18413656e-05f, 5.74230913e-05f,
+    5.30043105e-05f, 4.85851897e-05f, 4.41658955e-05f, 3.97465944e-05f,
+    3.53274527e-05f, 3.09086367e-05f, 2.64903127e-05f, 2.20726469e-05f,
+    1.76558054e-05f, 1.32399541e-05f, 8.82525892e-06f, 4.41188567e-06f,
+    -2.81992718e-18f, -4.41023253e-06f, -8.81864649e-06f, -1.32250766e-05f,
+    -1.76293577e-05f, -2.20313247e-05f, -2.64308128e-05f, -3.08276573e-05f,
+    -3.52216936e-05f, -3.96127573e-05f, -4.40006843e-05f, -4.83853105e-05f,
+    -5.2766472e-05f, -5.71440052e-05f, -6.15177466e-05f, -6.5887533e-05f,
+    -7.02532014e-05f, -7.46145889e-05f, -7.89715328e-05f, -8.3323871e-05f,
+    -8.76714411e-05f, -9.20140813e-05f, -9.635163e-05f, -0.000100683926f,
+    -0.000105010807f, -0.000109332114f, -0.000113647685f, -0.00011795736f,
+    -0.000122260979f, -0.000126558383f, -0.000130849411f, -0.000135133905f,
+    -0.000139411705f, -0.000143682654f, -0.000147946593f, -0.000152203364f,
+    -0.000156452809f, -0.000160694772f, -0.000164929094f, -0.000169155621f,
+    -0.000173374195f, -0.000177584661f, -0.000181786863f, -0.000185980646f,
+    -0.000190165856f, -0.000194342337f, -0.000198509937f, -0.000202668501f,
+    -0.000206817876f, -0.00021095791f, -0.00021508845f, -0.000219209344f,
+    -0.00022332044f, -0.000227421588f, -0.000231512637f, -0.000235593436f,
+    -0.000239663836f, -0.000243723687f, -0.000247772841f, -0.000251811149f,
+    -0.000255838463f, -0.000259854636f, -0.000263859519f, -0.000267852968f,
+    -0.000271834836f, -0.000275804977f, -0.000279763246f, -0.000283709499f,
+    -0.000287643591f, -0.00029156538f, -0.000295474721f, -0.000299371472f,
+    -0.000303255492f, -0.000307126639f, -0.000310984772f, -0.00031482975f,
+    -0.000318661434f, -0.000322479684f, -0.000326284363f, -0.00033007533f,
+    -0.00033385245f, -0.000337615584f, -0.000341364597f, -0.000345099353f,
+    -0.000348819716f, -0.000352525551f, -0.000356216725f, -0.000359893104f,
+    -0.000363554555f, -0.000367200946f, -0.000370832146f, -0.000374448022f,
+    -0.000378048445f, -0.000381633285f, -0.000385202413f, -0.000388755701f,
+    -0.000392293019f, -0.000395814242f, -0.000399319243f, -0.000402807896f,
+    -0.000406280075f, -0.000409735656f, -0.000413174515f, -0.000416596529f,
+    -0.000420001575f, -0.000423389532f, -0.000426760278f, -0.000430113692f,
+    -0.000433449656f, -0.00043676805f, -0.000440068755f, -0.000443351654f,
+    -0.00044661663f, -0.000449863567f, -0.000453092349f, -0.000456302861f,
+    -0.00045949499f, -0.000462668622f, -0.000465823644f, -0.000468959945f,
+    -0.000472077413f, -0.000475175938f, -0.000478255411f, -0.000481315723f,
+    -0.000484356765f, -0.000487378431f, -0.000490380614f, -0.000493363207f,
+    -0.000496326107f, -0.000499269209f, -0.000502192409f, -0.000505095604f,
+    -0.000507978694f, -0.000510841577f, -0.000513684152f, -0.000516506321f,
+    -0.000519307984f, -0.000522089044f, -0.000524849404f, -0.000527588967f,
+    -0.000530307638f, -0.000533005323f, -0.000535681927f, -0.000538337359f,
+    -0.000540971525f, -0.000543584335f, -0.000546175698f, -0.000548745524f,
+    -0.000551293725f, -0.000553820214f, -0.000556324902f, -0.000558807704f,
+    -0.000561268534f, -0.000563707308f, -0.000566123943f, -0.000568518355f,
+    -0.000570890463f, -0.000573240186f, -0.000575567443f, -0.000577872156f,
+    -0.000580154245f, -0.000582413634f, -0.000584650246f, -0.000586864005f,
+    -0.000589054837f, -0.000591222666f, -0.000593367421f, -0.000595489029f,
+    -0.000597587419f, -0.000599662521f, -0.000601714264f, -0.000603742581f,
+    -0.000605747404f, -0.000607728666f, -0.000609686301f, -0.000611620244f,
+    -0.000613530432f, -0.000615416801f, -0.000617279289f, -0.000619117835f,
+    -0.000620932379f, -0.000622722861f, -0.000624489222f, -0.000626231405f,
+    -0.000627949355f, -0.000629643014f, -0.000631312328f, -0.000632957243f,
+    -0.000634577707f, -0.000636173668f, -0.000637745074f, -0.000639291875f,
+    -0.000640814024f, -0.00064231147f, -0.000643784167f, -0.00064523207f,
+    -0.000646655132f, -0.000648053309f, -0.000649426558f, -0.000650774836f,
+    -0.000652098102f, -0.000653396316f, -0.000654669437f, -0.000655917427f,
+    -0.000657140249f, -0.000658337866f, -0.000659510241f, -0.000660657341f,
+    -0.000661779132f, -0.00066287558f, -0.000663946654f, -0.000664992323f,
+    -0.000666012557f, -0.000667007326f, -0.000667976604f, -0.000668920363f,
+    -0.000669838576f, -0.000670731219f, -0.000671598268f, -0.000672439699f,
+    -0.000673255491f, -0.000674045622f, -0.000674810071f, -0.00067554882f,
+    -0.000676261851f, -0.000676949145f, -0.000677610688f, -0.000678246462f,
+    -0.000678856455f, -0.000679440652f, -0.000679999041f, -0.00068053161f,
+    -0.00068103835f, -0.000681519251f, -0.000681974303f, -0.000682403501f,
+    -0.000682806836f, -0.000683184303f, -0.000683535899f, -0.000683861618f,
+    -0.000684161459f, -0.000684435419f, -0.000684683499f, -0.000684905697f,
+    -0.000685102016f, -0.000685272458f, -0.000685417026f, -0.000685535723f,
+    -0.000685628556f, -0.000685695529f, -0.000685736651f, -0.000685751929f,
+    -0.000685741372f, -0.00068570499f, -0.000685642794f, -0.000685554796f,
+    -0.000685441009f, -0.000685301447f, -0.000685136124f, -0.000684945056f,
+    -0.00068472826f, -0.000684485754f, -0.000684217555f, -0.000683923685f,
+    -0.000683604163f, -0.00068325901f, -0.00068288825f, -0.000682491906f,
+    -0.000682070002f, -0.000681622563f, -0.000681149616f, -0.000680651188f,
+    -0.000680127307f, -0.000679578002f, -0.000679003304f, -0.000678403243f,
+    -0.000677777851f, -0.000677127161f, -0.000676451208f, -0.000675750025f,
+    -0.000675023649f, -0.000674272116f, -0.000673495464f, -0.000672693731f,
+    -0.000671866957f, -0.000671015182f, -0.000670138448f, -0.000669236796f,
+    -0.000668310269f, -0.000667358913f, -0.000666382771f, -0.00066538189f,
+    -0.000664356316f, -0.000663306098f, -0.000662231284f, -0.000661131922f,
+    -0.000660008065f, -0.000658859763f, -0.000657687068f, -0.000656490034f,
+    -0.000655268714f, -0.000654023164f, -0.000652753439f, -0.000651459596f,
+    -0.000650141693f, -0.000648799788f, -0.000647433941f, -0.000646044211f,
+    -0.00064463066f, -0.00064319335f, -0.000641732343f, -0.000640247704f,
+    -0.000638739497f, -0.000637207788f, -0.000635652642f, -0.000634074128f,
+    -0.000632472312f, -0.000630847264f, -0.000629199054f, -0.000627527752f,
+    -0.00062583343f, -0.00062411616f, -0.000622376014f, -0.000620613068f,
+    -0.000618827395f, -0.000617019071f, -0.000615188173f, -0.000613334778f,
+    -0.000611458964f, -0.00060956081f, -0.000607640395f, -0.0006056978f,
+    -0.000603733107f, -0.000601746396f, -0.000599737752f, -0.000597707258f,
+    -0.000595654999f, -0.000593581058f, -0.000591485524f, -0.000589368482f,
+    -0.00058723002f, -0.000585070227f, -0.000582889191f, -0.000580687003f,
+    -0.000578463753f, -0.000576219533f, -0.000573954435f, -0.000571668551f,
+    -0.000569361976f, -0.000567034804f, -0.000564687129f, -0.000562319049f,
+    -0.00055993066f, -0.000557522058f, -0.000555093342f, -0.000552644612f,
+    -0.000550175965f, -0.000547687504f, -0.000545179328f, -0.000542651539f,
+    -0.00054010424f, -0.000537537533f, -0.000534951523f, -0.000532346314f,
+    -0.00052972201f, -0.000527078719f, -0.000524416545f, -0.000521735597f,
+    -0.000519035982f, -0.000516317809f, -0.000513581187f, -0.000510826225f,
+    -0.000508053034f, -0.000505261725f, -0.000502452409f, -0.0004996252f,
+    -0.00049678021f, -0.000493917553f, -0.000491037342f, -0.000488139694f,
+    -0.000485224722f, -0.000482292544f, -0.000479343276f, -0.000476377036f,
+    -0.00047339394f, -0.000470394108f, -0.000467377659f, -0.000464344712f,
+    -0.000461295388f, -0.000458229806f, -0.00045514809f, -0.00045205036f,
+    -0.000448936739f, -0.00044580735f, -0.000442662317f, -0.000439501764f,
+    -0.000436325815f, -0.000433134595f, -0.000429928231f, -0.000426706848f,
+    -0.000423470574f, -0.000420219535f, -0.000416953859f, -0.000413673675f,
+    -0.000410379112f, -0.000407070298f, -0.000403747363f, -0.000400410438f,
+    -0.000397059654f, -0.000393695141f, -0.000390317031f, -0.000386925457f,
+    -0.00038352055f, -0.000380102444f, -0.000376671273f, -0.000373227171f,
+    -0.000369770271f, -0.000366300708f, -0.000362818619f, -0.000359324137f,
+    -0.000355817401f, -0.000352298545f, -0.000348767707f, -0.000345225024f,
+    -0.000341670634f, -0.000338104675f, -0.000334527285f, -0.000330938603f,
+    -0.000327338768f, -0.000323727921f, -0.0003201062f, -0.000316473746f,
+    -0.0003128307f, -0.000309177203f, -0.000305513396f, -0.00030183942f,
+    -0.000298155419f, -0.000294461533f, -0.000290757906f, -0.000287044681f,
+    -0.000283322f, -0.000279590009f, -0.000275848849f, -0.000272098666f,
+    -0.000268339604f, -0.000264571808f, -0.000260795422f, -0.000257010592f,
+    -0.000253217464f, -0.000249416183f, -0.000245606895f, -0.000241789747f,
+    -0.000237964885f, -0.000234132456f, -0.000230292607f, -0.000226445486f,
+    -0.000222591238f, -0.000218730013f, -0.000214861959f, -0.000210987222f,
+    -0.000207105952f, -0.000203218297f, -0.000199324405f, -0.000195424426f,
+    -0.000191518508f, -0.000187606801f, -0.000183689454f, -0.000179766616f,
+    -0.000175838438f, -0.000171905068f, -0.000167966657f, -0.000164023355f,
+    -0.000160075312f, -0.000156122678f, -0.000152165604f, -0.000148204241f,
+    -0.000144238739f, -0.000140269248f, -0.00013629592f, -0.000132318905f,
+    -0.000128338355f, -0.000124354421f, -0.000120367254f, -0.000116377005f,
+    -0.000112383825f, -0.000108387866f, -0.000104389279f, -0.000100388215f,
+    -9.63848271e-05f, -9.23792655e-05f, -8.83716819e-05f, -8.43622282e-05f,
+    -8.03510557e-05f, -7.6338316e-05f, -7.23241609e-05f, -6.83087418e-05f,
+    -6.42922104e-05f, -6.02747181e-05f, -5.62564167e-05f, -5.22374575e-05f,
+    -4.82179921e-05f, -4.4198172e-05f, -4.01781485e-05f, -3.6158073e-05f,
+    -3.21380969e-05f, -2.81183714e-05f, -2.40990477e-05f, -2.00802768e-05f,
+    -1.606221e-05f, -1.2044998e-05f, -8.02879187e-06f, -4.0137423e-06f,
+    -4.4853082e-18f, 4.01228446e-06f, 8.02296059e-06f, 1.20318781e-05f,
+    1.60388866e-05f, 2.00438361e-05f, 2.40465767e-05f, 2.80469584e-05f,
+    3.20448315e-05f, 3.60400466e-05f, 4.00324542e-05f, 4.40219052e-05f,
+    4.80082503e-05f, 5.19913408e-05f, 5.59710279e-05f, 5.99471631e-05f,
+    6.3919598e-05f, 6.78881845e-05f, 7.18527745e-05f, 7.58132205e-05f,
+    7.97693748e-05f, 8.37210901e-05f, 8.76682192e-05f, 9.16106154e-05f,
+    9.55481319e-05f, 9.94806223e-05f, 0.000103407941f, 0.000107329941f,
+    0.000111246477f, 0.000115157404f, 0.000119062576f, 0.00012296185f,
+    0.000126855079f, 0.00013074212f, 0.000134622829f, 0.000138497062f,
+    0.000142364676f, 0.000146225527f, 0.000150079473f, 0.00015392637f,
+    0.000157766078f, 0.000161598453f, 0.000165423355f, 0.000169240641f,
+    0.000173050172f, 0.000176851807f, 0.000180645405f, 0.000184430827f,
+    0.000188207933f, 0.000191976583f, 0.00019573664f, 0.000199487965f,
+    0.00020323042f, 0.000206963867f, 0.000210688169f, 0.000214403188f,
+    0.00021810879f, 0.000221804837f, 0.000225491194f, 0.000229167726f,
+    0.000232834298f, 0.000236490775f, 0.000240137024f, 0.000243772911f,
+    0.000247398304f, 0.000251013068f, 0.000254617073f, 0.000258210186f,
+    0.000261792277f, 0.000265363213f, 0.000268922866f, 0.000272471105f,
+    0.000276007801f, 0.000279532825f, 0.000283046048f, 0.000286547342f,
+    0.00029003658f, 0.000293513636f, 0.000296978382f, 0.000300430693f,
+    0.000303870443f, 0.000307297507f, 0.000310711761f, 0.000314113082f,
+    0.000317501345f, 0.000320876428f, 0.000324238209f, 0.000327586566f,
+    0.000330921378f, 0.000334242524f, 0.000337549884f, 0.000340843339f,
+    0.00034412277f, 0.000347388059f, 0.000350639087f, 0.000353875737f,
+    0.000357097894f, 0.00036030544f, 0.000363498261f, 0.000366676241f,
+    0.000369839267f, 0.000372987225f, 0.000376120001f, 0.000379237483f,
+    0.00038233956f, 0.000385426121f, 0.000388497054f, 0.00039155225f,
+    0.000394591599f, 0.000397614994f, 0.000400622325f, 0.000403613486f,
+    0.000406588369f, 0.000409546869f, 0.000412488881f, 0.000415414299f,
+    0.000418323019f, 0.000421214938f, 0.000424089954f, 0.000426947963f,
+    0.000429788865f, 0.000432612559f, 0.000435418945f, 0.000438207923f,
+    0.000440979395f, 0.000443733263f, 0.00044646943f, 0.000449187798f,
+    0.000451888272f, 0.000454570757f, 0.000457235159f, 0.000459881383f,
+    0.000462509337f, 0.000465118928f, 0.000467710065f, 0.000470282656f,
+    0.000472836613f, 0.000475371844f, 0.000477888262f, 0.000480385779f,
+    0.000482864308f, 0.000485323761f, 0.000487764054f, 0.000490185101f,
+    0.000492586819f, 0.000494969123f, 0.000497331932f, 0.000499675163f,
+    0.000501998735f, 0.000504302567f, 0.000506586581f, 0.000508850698f,
+    0.000511094838f, 0.000513318926f, 0.000515522884f, 0.000517706636f,
+    0.000519870109f, 0.000522013228f, 0.000524135919f, 0.00052623811f,
+    0.000528319729f, 0.000530380705f, 0.000532420968f, 0.00053444045f,
+    0.00053643908f, 0.000538416792f, 0.000540373518f, 0.000542309193f,
+    0.000544223751f, 0.000546117128f, 0.00054798926f, 0.000549840084f,
+    0.000551669538f, 0.000553477561f, 0.000555264094f, 0.000557029075f,
+    0.000558772447f, 0.000560494151f, 0.000562194132f, 0.000563872331f,
+    0.000565528695f, 0.000567163168f, 0.000568775698f, 0.00057036623f,
+    0.000571934714f, 0.000573481098f, 0.000575005332f, 0.000576507366f,
+    0.000577987152f, 0.000579444642f, 0.000580879789f, 0.000582292547f,
+    0.000583682872f, 0.000585050718f, 0.000586396043f, 0.000587718803f,
+    0.000589018958f, 0.000590296466f, 0.000591551288f, 0.000592783383f,
+    0.000593992715f, 0.000595179245f, 0.000596342938f, 0.000597483757f,
+    0.000598601668f, 0.000599696637f, 0.000600768631f, 0.000601817617f,
+    0.000602843565f, 0.000603846445f, 0.000604826226f, 0.00060578288f,
+    0.00060671638f, 0.000607626698f, 0.000608513809f, 0.000609377687f,
+    0.000610218309f, 0.00061103565f, 0.000611829689f, 0.000612600404f,
+    0.000613347775f, 0.00061407178f, 0.000614772403f, 0.000615449624f,
+    0.000616103427f, 0.000616733794f, 0.000617340712f, 0.000617924165f,
+    0.00061848414f, 0.000619020624f, 0.000619533606f, 0.000620023074f,
+    0.000620489018f, 0.00062093143f, 0.000621350301f, 0.000621745623f,
+    0.00062211739f, 0.000622465598f, 0.00062279024f, 0.000623091313f,
+    0.000623368814f, 0.000623622742f, 0.000623853094f, 0.000624059871f,
+    0.000624243074f, 0.000624402703f, 0.000624538762f, 0.000624651253f,
+    0.000624740181f, 0.00062480555f, 0.000624847368f, 0.000624865639f,
+    0.000624860373f, 0.000624831578f, 0.000624779263f, 0.000624703438f,
+    0.000624604116f, 0.000624481307f, 0.000624335025f, 0.000624165284f,
+    0.000623972098f, 0.000623755484f, 0.000623515457f, 0.000623252035f,
+    0.000622965236f, 0.000622655079f, 0.000622321585f, 0.000621964774f,
+    0.000621584668f, 0.000621181289f, 0.000620754661f, 0.000620304808f,
+    0.000619831756f, 0.00061933553f, 0.000618816157f, 0.000618273665f,
+    0.000617708083f, 0.000617119441f, 0.000616507768f, 0.000615873095f,
+    0.000615215456f, 0.000614534882f, 0.000613831408f, 0.000613105067f,
+    0.000612355897f, 0.000611583932f, 0.00061078921f, 0.000609971768f,
+    0.000609131647f, 0.000608268885f, 0.000607383523f, 0.000606475602f,
+    0.000605545165f, 0.000604592254f, 0.000603616913f, 0.000602619187f,
+    0.000601599122f, 0.000600556763f, 0.000599492158f, 0.000598405355f,
+    0.000597296402f, 0.000596165349f, 0.000595012247f, 0.000593837146f,
+    0.0005926401f, 0.000591421159f, 0.000590180379f, 0.000588917813f,
+    0.000587633517f, 0.000586327547f, 0.000584999959f, 0.000583650812f,
+    0.000582280163f, 0.000580888072f, 0.000579474599f, 0.000578039804f,
+    0.000576583749f, 0.000575106497f, 0.00057360811f, 0.000572088652f,
+    0.000570548189f, 0.000568986784f, 0.000567404505f, 0.000565801418f,
+    0.000564177592f, 0.000562533094f, 0.000560867993f, 0.000559182361f,
+    0.000557476266f, 0.000555749781f, 0.000554002978f, 0.00055223593f,
+    0.00055044871f, 0.000548641393f, 0.000546814054f, 0.000544966769f,
+    0.000543099614f, 0.000541212666f, 0.000539306004f, 0.000537379706f,
+    0.000535433852f, 0.000533468522f, 0.000531483796f, 0.000529479756f,
+    0.000527456484f, 0.000525414064f, 0.000523352579f, 0.000521272112f,
+    0.00051917275f, 0.000517054577f, 0.000514917681f, 0.000512762147f,
+    0.000510588065f, 0.000508395521f, 0.000506184605f, 0.000503955407f,
+    0.000501708018f, 0.000499442527f, 0.000497159027f, 0.000494857609f,
+    0.000492538368f, 0.000490201396f, 0.000487846787f, 0.000485474637f,
+    0.00048308504f, 0.000480678093f, 0.000478253893f, 0.000475812536f,
+    0.000473354121f, 0.000470878746f, 0.00046838651f, 0.000465877513f,
+    0.000463351856f, 0.000460809638f, 0.000458250962f, 0.00045567593f,
+    0.000453084644f, 0.000450477207f, 0.000447853724f, 0.000445214298f,
+    0.000442559035f, 0.00043988804f, 0.000437201419f, 0.000434499278f,
+    0.000431781725f, 0.000429048867f, 0.000426300813f, 0.000423537671f,
+    0.000420759551f, 0.000417966562f, 0.000415158814f, 0.000412336419f,
+    0.000409499488f, 0.000406648132f, 0.000403782464f, 0.000400902597f,
+    0.000398008644f, 0.000395100719f, 0.000392178936f, 0.000389243411f,
+    0.000386294257f, 0.000383331591f, 0.00038035553f, 0.000377366189f,
+    0.000374363687f, 0.00037134814f, 0.000368319666f, 0.000365278385f,
+    0.000362224415f, 0.000359157874f, 0.000356078884f, 0.000352987564f,
+    0.000349884035f, 0.000346768418f, 0.000343640835f, 0.000340501406f,
+    0.000337350255f, 0.000334187505f, 0.000331013277f, 0.000327827696f,
+    0.000324630886f, 0.00032142297f, 0.000318204073f, 0.00031497432f,
+    0.000311733837f, 0.000308482749f, 0.000305221183f, 0.000301949263f,
+    0.000298667118f, 0.000295374874f, 0.000292072659f, 0.0002887606f,
+    0.000285438826f, 0.000282107464f, 0.000278766644f, 0.000275416495f,
+    0.000272057145f, 0.000268688724f, 0.000265311363f, 0.000261925191f,
+    0.000258530339f, 0.000255126937f, 0.000251715117f, 0.00024829501f,
+    0.000244866748f, 0.000241430462f, 0.000237986284f, 0.000234534347f,
+    0.000231074783f, 0.000227607726f, 0.000224133307f, 0.000220651661f,
+    0.000217162921f, 0.00021366722f, 0.000210164693f, 0.000206655473f,
+    0.000203139696f, 0.000199617495f, 0.000196089006f, 0.000192554362f,
+    0.0001890137f, 0.000185467155f, 0.000181914862f, 0.000178356957f,
+    0.000174793575f, 0.000171224853f, 0.000167650926f, 0.000164071931f,
+    0.000160488005f, 0.000156899283f, 0.000153305903f, 0.000149708001f,
+    0.000146105715f, 0.00014249918f, 0.000138888535f, 0.000135273917f,
+    0.000131655462f, 0.00012803331f, 0.000124407596f, 0.000120778459f,
+    0.000117146036f, 0.000113510465f, 0.000109871884f, 0.000106230432f,
+    0.000102586245f, 9.89394616e-05f, 9.52902207e-05f, 9.16386598e-05f,
+    8.79849173e-05f, 8.43291313e-05f, 8.06714401e-05f, 7.70119818e-05f,
+    7.33508948e-05f, 6.96883174e-05f, 6.60243878e-05f, 6.23592444e-05f,
+    5.86930254e-05f, 5.50258691e-05f, 5.13579138e-05f, 4.76892977e-05f,
+    4.40201591e-05f, 4.03506362e-05f, 3.66808671e-05f, 3.301099e-05f,
+    2.93411429e-05f, 2.5671464e-05f, 2.20020911e-05f, 1.83331622e-05f,
+    1.46648151e-05f, 1.09971877e-05f, 7.33041765e-06f, 3.66464256e-06f,
+    1.0532803e-17f, -3.66337258e-06f, -7.32533782e-06f, -1.09857585e-05f,
+    -1.46444973e-05f, -1.83014174e-05f, -2.19563818e-05f, -2.56092536e-05f,
+    -2.92598962e-05f, -3.29081731e-05f, -3.65539477e-05f, -4.0197084e-05f,
+    -4.38374457e-05f, -4.74748968e-05f, -5.11093016e-05f, -5.47405244e-05f,
+    -5.83684297e-05f, -6.19928821e-05f, -6.56137467e-05f, -6.92308883e-05f,
+    -7.28441722e-05f, -7.64534639e-05f, -8.0058629e-05f, -8.36595332e-05f,
+    -8.72560427e-05f, -9.08480236e-05f, -9.44353424e-05f, -9.80178658e-05f,
+    -0.000101595461f, -0.000105167994f, -0.000108735334f, -0.000112297347f,
+    -0.000115853901f, -0.000119404866f, -0.000122950108f, -0.000126489496f,
+    -0.0001300229f, -0.000133550189f, -0.000137071232f, -0.000140585898f,
+    -0.000144094059f, -0.000147595583f, -0.000151090342f, -0.000154578206f,
+    -0.000158059048f, -0.000161532737f, -0.000164999146f, -0.000168458148f,
+    -0.000171909614f, -0.000175353418f, -0.000178789432f, -0.00018221753f,
+    -0.000185637586f, -0.000189049473f, -0.000192453067f, -0.000195848242f,
+    -0.000199234874f, -0.000202612837f, -0.000205982009f, -0.000209342264f,
+    -0.00021269348f, -0.000216035535f, -0.000219368304f, -0.000222691667f,
+    -0.000226005502f, -0.000229309686f, -0.000232604099f, -0.000235888622f,
+    -0.000239163132f, -0.000242427512f, -0.00024568164f, -0.0002489254f,
+    -0.000252158671f, -0.000255381337f, -0.000258593279f, -0.000261794381f,
+    -0.000264984525f, -0.000268163596f, -0.000271331478f, -0.000274488055f,
+    -0.000277633213f, -0.000280766838f, -0.000283888814f, -0.00028699903f,
+    -0.000290097372f, -0.000293183727f, -0.000296257984f, -0.000299320031f,
+    -0.000302369757f, -0.000305407052f, -0.000308431805f, -0.000311443908f,
+    -0.000314443251f, -0.000317429726f, -0.000320403225f, -0.00032336364f,
+    -0.000326310866f, -0.000329244794f, -0.000332165321f, -0.000335072339f,
+    -0.000337965746f, -0.000340845436f, -0.000343711305f, -0.000346563252f,
+    -0.000349401173f, -0.000352224967f, -0.000355034531f, -0.000357829766f,
+    -0.000360610571f, -0.000363376846f, -0.000366128493f, -0.000368865413f,
+    -0.000371587507f, -0.000374294679f, -0.000376986833f, -0.000379663871f,
+    -0.000382325698f, -0.00038497222f, -0.000387603342f, -0.000390218971f,
+    -0.000392819013f, -0.000395403376f, -0.000397971968f, -0.000400524698f,
+    -0.000403061475f, -0.000405582209f, -0.000408086812f, -0.000410575194f,
+    -0.000413047267f, -0.000415502945f, -0.000417942139f, -0.000420364765f,
+    -0.000422770736f, -0.000425159968f, -0.000427532376f, -0.000429887878f,
+    -0.00043222639f, -0.000434547831f, -0.000436852118f, -0.000439139171f,
+    -0.00044140891f, -0.000443661255f, -0.000445896128f, -0.000448113451f,
+    -0.000450313145f, -0.000452495135f, -0.000454659345f, -0.000456805698f,
+    -0.000458934121f, -0.000461044539f, -0.00046313688f, -0.00046521107f,
+    -0.000467267038f, -0.000469304713f, -0.000471324025f, -0.000473324903f,
+    -0.000475307278f, -0.000477271084f, -0.000479216251f, -0.000481142714f,
+    -0.000483050405f, -0.00048493926f, -0.000486809215f, -0.000488660204f,
+    -0.000490492166f, -0.000492305037f, -0.000494098756f, -0.000495873263f,
+    -0.000497628496f, -0.000499364396f, -0.000501080905f, -0.000502777965f,
+    -0.000504455518f, -0.000506113509f, -0.00050775188f, -0.000509370579f,
+    -0.000510969549f, -0.000512548738f, -0.000514108093f, -0.000515647562f,
+    -0.000517167095f, -0.00051866664f, -0.000520146148f, -0.000521605571f,
+    -0.000523044859f, -0.000524463967f, -0.000525862847f, -0.000527241454f,
+    -0.000528599742f, -0.000529937668f, -0.000531255188f, -0.000532552259f,
+    -0.00053382884f, -0.00053508489f, -0.000536320368f, -0.000537535234f,
+    -0.000538729451f, -0.00053990298f, -0.000541055784f, -0.000542187827f,
+    -0.000543299073f, -0.000544389488f, -0.000545459037f, -0.000546507688f,
+    -0.000547535408f, -0.000548542165f, -0.000549527929f, -0.000550492669f,
+    -0.000551436357f, -0.000552358965f, -0.000553260464f, -0.000554140828f,
+    -0.000555000031f, -0.000555838048f, -0.000556654854f, -0.000557450426f,
+    -0.000558224742f, -0.000558977778f, -0.000559709515f, -0.000560419932f,
+    -0.000561109009f, -0.000561776728f, -0.00056242307f, -0.000563048019f,
+    -0.000563651558f, -0.000564233673f, -0.000564794347f, -0.000565333568f,
+    -0.000565851323f, -0.000566347599f, -0.000566822384f, -0.000567275669f,
+    -0.000567707443f, -0.000568117697f, -0.000568506424f, -0.000568873615f,
+    -0.000569219265f, -0.000569543368f, -0.000569845918f, -0.000570126912f,
+    -0.000570386346f, -0.000570624218f, -0.000570840527f, -0.00057103527f,
+    -0.000571208449f, -0.000571360063f, -0.000571490116f, -0.000571598608f,
+    -0.000571685543f, -0.000571750926f, -0.00057179476f, -0.000571817052f,
+    -0.000571817808f, -0.000571797035f, -0.000571754741f, -0.000571690935f,
+    -0.000571605627f, -0.000571498827f, -0.000571370546f, -0.000571220797f,
+    -0.000571049592f, -0.000570856945f, -0.00057064287f, -0.000570407383f,
+    -0.0005701505f, -0.000569872237f, -0.000569572613f, -0.000569251645f,
+    -0.000568909353f, -0.000568545756f, -0.000568160877f, -0.000567754736f,
+    -0.000567327356f, -0.00056687876f, -0.000566408972f, -0.000565918016f,
+    -0.000565405919f, -0.000564872707f, -0.000564318407f, -0.000563743046f,
+    -0.000563146654f, -0.000562529259f, -0.000561890893f, -0.000561231587f,
+    -0.000560551371f, -0.000559850279f, -0.000559128344f, -0.0005583856f,
+    -0.000557622082f, -0.000556837826f, -0.000556032868f, -0.000555207245f,
+    -0.000554360996f, -0.000553494159f, -0.000552606773f, -0.00055169888f,
+    -0.000550770519f, -0.000549821732f, -0.000548852563f, -0.000547863054f,
+    -0.00054685325f, -0.000545823195f, -0.000544772934f, -0.000543702514f,
+    -0.000542611983f, -0.000541501387f, -0.000540370775f, -0.000539220196f,
+    -0.0005380497f, -0.000536859339f, -0.000535649163f, -0.000534419224f,
+    -0.000533169576f, -0.000531900271f, -0.000530611365f, -0.000529302912f,
+    -0.000527974968f, -0.000526627589f, -0.000525260833f, -0.000523874757f,
+    -0.00052246942f, -0.000521044881f, -0.000519601201f, -0.000518138439f,
+    -0.000516656658f, -0.000515155919f, -0.000513636285f, -0.000512097819f,
+    -0.000510540586f, -0.000508964651f, -0.000507370078f, -0.000505756935f,
+    -0.000504125287f, -0.000502475203f, -0.000500806751f, -0.000499119999f,
+    -0.000497415017f, -0.000495691876f, -0.000493950645f, -0.000492191397f,
+    -0.000490414204f, -0.000488619138f, -0.000486806273f, -0.000484975683f,
+    -0.000483127443f, -0.000481261628f, -0.000479378314f, -0.000477477578f,
+    -0.000475559497f, -0.000473624149f, -0.000471671612f, -0.000469701966f,
+    -0.00046771529f, -0.000465711665f, -0.000463691171f, -0.000461653891f,
+    -0.000459599906f, -0.000457529299f, -0.000455442153f, -0.000453338553f,
+    -0.000451218584f, -0.000449082329f, -0.000446929875f, -0.000444761309f,
+    -0.000442576717f, -0.000440376186f, -0.000438159805f, -0.000435927662f,
+    -0.000433679846f, -0.000431416448f, -0.000429137557f, -0.000426843264f,
+    -0.00042453366f, -0.000422208839f, -0.00041986889f, -0.000417513909f,
+    -0.000415143989f, -0.000412759222f, -0.000410359705f, -0.000407945532f,
+    -0.000405516799f, -0.000403073602f, -0.000400616037f, -0.000398144202f,
+    -0.000395658195f, -0.000393158113f, -0.000390644055f, -0.000388116121f,
+    -0.00038557441f, -0.000383019022f, -0.000380450057f, -0.000377867617f,
+    -0.000375271804f, -0.000372662719f, -0.000370040465f, -0.000367405145f,
+    -0.000364756862f, -0.00036209572f, -0.000359421824f, -0.000356735277f,
+    -0.000354036186f, -0.000351324656f, -0.000348600793f, -0.000345864703f,
+    -0.000343116494f, -0.000340356272f, -0.000337584146f, -0.000334800223f,
+    -0.000332004613f, -0.000329197423f, -0.000326378764f, -0.000323548746f,
+    -0.000320707478f, -0.00031785507f, -0.000314991635f, -0.000312117282f,
+    -0.000309232125f, -0.000306336274f, -0.000303429843f, -0.000300512943f,
+    -0.000297585689f, -0.000294648193f, -0.00029170057f, -0.000288742933f,
+    -0.000285775397f, -0.000282798077f, -0.000279811088f, -0.000276814546f,
+    -0.000273808566f, -0.000270793264f, -0.000267768757f, -0.000264735162f,
+    -0.000261692596f, -0.000258641175f, -0.000255581018f, -0.000252512243f,
+    -0.000249434967f, -0.00024634931f, -0.00024325539f, -0.000240153325f,
+    -0.000237043237f, -0.000233925243f, -0.000230799463f, -0.000227666019f,
+    -0.000224525029f, -0.000221376616f, -0.000218220899f, -0.000215057999f,
+    -0.000211888038f, -0.000208711138f, -0.000205527419f, -0.000202337005f,
+    -0.000199140016f, -0.000195936576f, -0.000192726807f, -0.000189510832f,
+    -0.000186288774f, -0.000183060755f, -0.0001798269f, -0.000176587331f,
+    -0.000173342172f, -0.000170091547f, -0.000166835581f, -0.000163574397f,
+    -0.000160308119f, -0.000157036873f, -0.000153760782f, -0.000150479972f,
+    -0.000147194567f, -0.000143904692f, -0.000140610473f, -0.000137312035f,
+    -0.000134009502f, -0.000130703002f, -0.000127392658f, -0.000124078598f,
+    -0.000120760946f, -0.000117439829f, -0.000114115373f, -0.000110787703f,
+    -0.000107456946f, -0.000104123229f, -0.000100786676f, -9.74474158e-05f,
+    -9.41055735e-05f, -9.07612759e-05f, -8.74146495e-05f, -8.40658209e-05f,
+    -8.07149167e-05f, -7.73620636e-05f, -7.40073882e-05f, -7.06510172e-05f,
+    -6.72930775e-05f, -6.39336957e-05f, -6.05729986e-05f, -5.72111129e-05f,
+    -5.38481656e-05f, -5.04842833e-05f, -4.71195928e-05f, -4.37542208e-05f,
+    -4.03882942e-05f, -3.70219395e-05f, -3.36552836e-05f, -3.02884531e-05f,
+    -2.69215746e-05f, -2.35547748e-05f, -2.018818e-05f, -1.6821917e-05f,
+    -1.3456112e-05f, -1.00908916e-05f, -6.72638191e-06f, -3.36270933e-06f,
+    1.35668441e-21f, 3.36161997e-06f, 6.72202455e-06f, 1.00810878e-05f,
+    1.34386839e-05f, 1.67946871e-05f, 2.01489717e-05f, 2.35014122e-05f,
+    2.68518832e-05f, 3.02002593e-05f, 3.35464154e-05f, 3.68902263e-05f,
+    4.02315671e-05f, 4.3570313e-05f, 4.69063394e-05f, 5.02395217e-05f,
+    5.35697354e-05f, 5.68968565e-05f, 6.02207607e-05f, 6.35413243e-05f,
+    6.68584234e-05f, 7.01719344e-05f, 7.3481734e-05f, 7.67876989e-05f,
+    8.0089706e-05f, 8.33876326e-05f, 8.6681356e-05f, 8.99707537e-05f,
+    9.32557034e-05f, 9.65360832e-05f, 9.9811771e-05f, 0.000103082645f,
+    0.000106348585f, 0.000109609468f, 0.000112865175f, 0.000116115583f,
+    0.000119360574f, 0.000122600026f, 0.000125833819f, 0.000129061835f,
+    0.000132283952f, 0.000135500053f, 0.000138710018f, 0.000141913728f,
+    0.000145111066f, 0.000148301912f, 0.000151486149f, 0.00015466366f,
+    0.000157834327f, 0.000160998033f, 0.000164154662f, 0.000167304096f,
+    0.000170446221f, 0.00017358092f, 0.000176708078f, 0.000179827579f,
+    0.000182939309f, 0.000186043154f, 0.000189138999f, 0.000192226731f,
+    0.000195306235f, 0.000198377399f, 0.000201440111f, 0.000204494257f,
+    0.000207539726f, 0.000210576405f, 0.000213604184f, 0.000216622952f,
+    0.000219632598f, 0.000222633012f, 0.000225624084f, 0.000228605705f,
+    0.000231577765f, 0.000234540156f, 0.000237492769f, 0.000240435497f,
+    0.000243368233f, 0.000246290869f, 0.000249203298f, 0.000252105415f,
+    0.000254997114f, 0.000257878289f, 0.000260748835f, 0.000263608648f,
+    0.000266457624f, 0.00026929566f, 0.000272122651f, 0.000274938495f,
+    0.000277743091f, 0.000280536335f, 0.000283318127f, 0.000286088367f,
+    0.000288846952f, 0.000291593784f, 0.000294328764f, 0.000297051791f,
+    0.000299762767f, 0.000302461595f, 0.000305148177f, 0.000307822415f,
+    0.000310484214f, 0.000313133476f, 0.000315770108f, 0.000318394012f,
+    0.000321005095f, 0.000323603264f, 0.000326188423f, 0.00032876048f,
+    0.000331319344f, 0.000333864921f, 0.00033639712f, 0.000338915851f,
+    0.000341421022f, 0.000343912545f, 0.00034639033f, 0.000348854287f,
+    0.00035130433f, 0.00035374037f, 0.00035616232f, 0.000358570093f,
+    0.000360963604f, 0.000363342767f, 0.000365707497f, 0.00036805771f,
+    0.000370393323f, 0.000372714251f, 0.000375020413f, 0.000377311727f,
+    0.000379588111f, 0.000381849484f, 0.000384095766f, 0.000386326877f,
+    0.000388542739f, 0.000390743273f, 0.000392928401f, 0.000395098046f,
+    0.000397252131f, 0.00039939058f, 0.000401513318f, 0.00040362027f,
+    0.000405711361f, 0.000407786519f, 0.000409845671f, 0.000411888743f,
+    0.000413915664f, 0.000415926364f, 0.000417920771f, 0.000419898816f,
+    0.00042186043f, 0.000423805544f, 0.000425734091f, 0.000427646003f,
+    0.000429541213f, 0.000431419656f, 0.000433281266f, 0.000435125979f,
+    0.00043695373f, 0.000438764457f, 0.000440558096f, 0.000442334586f,
+    0.000444093866f, 0.000445835873f, 0.00044756055f, 0.000449267835f,
+    0.000450957672f, 0.00045263f, 0.000454284764f, 0.000455921907f,
+    0.000457541372f, 0.000459143104f, 0.00046072705f, 0.000462293153f,
+    0.000463841363f, 0.000465371625f, 0.000466883889f, 0.000468378103f,
+    0.000469854216f, 0.000471312179f, 0.000472751942f, 0.000474173458f,
+    0.000475576678f, 0.000476961556f, 0.000478328046f, 0.000479676101f,
+    0.000481005677f, 0.00048231673f, 0.000483609216f, 0.000484883093f,
+    0.000486138318f, 0.000487374851f, 0.00048859265f, 0.000489791676f,
+    0.00049097189f, 0.000492133252f, 0.000493275727f, 0.000494399275f,
+    0.000495503862f, 0.000496589452f, 0.000497656009f, 0.0004987035f,
+    0.000499731891f, 0.00050074115f, 0.000501731244f, 0.000502702143f,
+    0.000503653816f, 0.000504586233f, 0.000505499366f, 0.000506393186f,
+    0.000507267665f, 0.000508122776f, 0.000508958495f, 0.000509774794f,
+    0.000510571651f, 0.00051134904f, 0.000512106939f, 0.000512845325f,
+    0.000513564177f, 0.000514263473f, 0.000514943195f, 0.000515603321f,
+    0.000516243834f, 0.000516864716f, 0.000517465948f, 0.000518047516f,
+    0.000518609403f, 0.000519151595f, 0.000519674076f, 0.000520176834f,
+    0.000520659856f, 0.00052112313f, 0.000521566644f, 0.000521990388f,
+    0.000522394353f, 0.000522778529f, 0.000523142908f, 0.000523487483f,
+    0.000523812246f, 0.000524117192f, 0.000524402316f, 0.000524667613f,
+    0.000524913079f, 0.000525138711f, 0.000525344506f, 0.000525530464f,
+    0.000525696584f, 0.000525842865f, 0.000525969308f, 0.000526075914f,
+    0.000526162687f, 0.000526229627f, 0.000526276741f, 0.00052630403f,
+    0.000526311502f, 0.000526299161f, 0.000526267014f, 0.000526215069f,
+    0.000526143334f, 0.000526051818f, 0.000525940529f, 0.00052580948f,
+    0.00052565868f, 0.000525488141f, 0.000525297876f, 0.000525087898f,
+    0.000524858222f, 0.000524608862f, 0.000524339833f, 0.000524051151f,
+    0.000523742835f, 0.0005234149f, 0.000523067367f, 0.000522700253f,
+    0.000522313578f, 0.000521907365f, 0.000521481632f, 0.000521036404f,
+    0.000520571702f, 0.000520087549f, 0.000519583971f, 0.000519060992f,
+    0.000518518638f, 0.000517956935f, 0.00051737591f, 0.000516775591f,
+    0.000516156007f, 0.000515517186f, 0.000514859159f, 0.000514181957f,
+    0.000513485611f, 0.000512770152f, 0.000512035614f, 0.00051128203f,
+    0.000510509435f, 0.000509717863f, 0.000508907349f, 0.000508077931f,
+    0.000507229646f, 0.00050636253f, 0.000505476622f, 0.000504571962f,
+    0.000503648589f, 0.000502706543f, 0.000501745867f, 0.000500766601f,
+    0.000499768788f, 0.000498752472f, 0.000497717695f, 0.000496664504f,
+    0.000495592943f, 0.000494503058f, 0.000493394895f, 0.000492268503f,
+    0.000491123928f, 0.000489961219f, 0.000488780427f, 0.0004875816f,
+    0.000486364789f, 0.000485130046f, 0.000483877422f, 0.00048260697f,
+    0.000481318743f, 0.000480012796f, 0.000478689182f, 0.000477347956f,
+    0.000475989176f, 0.000474612896f, 0.000473219174f, 0.000471808068f,
+    0.000470379637f, 0.000468933938f, 0.000467471033f, 0.00046599098f,
+    0.000464493842f, 0.000462979678f, 0.000461448553f, 0.000459900527f,
+    0.000458335665f, 0.000456754031f, 0.000455155689f, 0.000453540705f,
+    0.000451909143f, 0.000450261071f, 0.000448596555f, 0.000446915664f,
+    0.000445218465f, 0.000443505026f, 0.000441775418f, 0.000440029711f,
+    0.000438267974f, 0.000436490279f, 0.000434696698f, 0.000432887302f,
+    0.000431062166f, 0.000429221361f, 0.000427364962f, 0.000425493044f,
+    0.000423605681f, 0.00042170295f, 0.000419784926f, 0.000417851686f,
+    0.000415903308f, 0.000413939869f, 0.000411961448f, 0.000409968123f,
+    0.000407959974f, 0.000405937081f, 0.000403899525f, 0.000401847386f,
+    0.000399780747f, 0.000397699688f, 0.000395604293f, 0.000393494645f,
+    0.000391370828f, 0.000389232925f, 0.000387081021f, 0.000384915201f,
+    0.000382735552f, 0.000380542158f, 0.000378335107f, 0.000376114486f,
+    0.000373880382f, 0.000371632883f, 0.000369372078f, 0.000367098056f,
+    0.000364810907f, 0.000362510719f, 0.000360197584f, 0.000357871592f,
+    0.000355532836f, 0.000353181405f, 0.000350817394f, 0.000348440893f,
+    0.000346051997f, 0.000343650799f, 0.000341237393f, 0.000338811874f,
+    0.000336374335f, 0.000333924872f, 0.000331463582f, 0.00032899056f,
+    0.000326505902f, 0.000324009705f, 0.000321502067f, 0.000318983086f,
+    0.000316452859f, 0.000313911484f, 0.000311359062f, 0.000308795691f,
+    0.00030622147f, 0.0003036365f, 0.00030104088f, 0.000298434713f,
+    0.000295818099f, 0.000293191138f, 0.000290553934f, 0.000287906589f,
+    0.000285249204f, 0.000282581883f, 0.000279904729f, 0.000277217846f,
+    0.000274521337f, 0.000271815306f, 0.000269099859f, 0.0002663751f,
+    0.000263641134f, 0.000260898067f, 0.000258146005f, 0.000255385053f,
+    0.000252615318f, 0.000249836907f, 0.000247049927f, 0.000244254485f,
+    0.000241450688f, 0.000238638646f, 0.000235818464f, 0.000232990253f,
+    0.000230154121f, 0.000227310177f, 0.000224458529f, 0.000221599288f,
+    0.000218732562f, 0.000215858463f, 0.0002129771f, 0.000210088584f,
+    0.000207193025f, 0.000204290535f, 0.000201381224f, 0.000198465203f,
+    0.000195542585f, 0.000192613481f, 0.000189678004f, 0.000186736264f,
+    0.000183788376f, 0.00018083445f, 0.000177874601f, 0.000174908941f,
+    0.000171937583f, 0.000168960641f, 0.000165978228f, 0.000162990458f,
+    0.000159997445f, 0.000156999302f, 0.000153996144f, 0.000150988086f,
+    0.000147975241f, 0.000144957725f, 0.000141935651f, 0.000138909136f,
+    0.000135878294f, 0.00013284324f, 0.00012980409f, 0.000126760959f,
+    0.000123713962f, 0.000120663215f, 0.000117608834f, 0.000114550935f,
+    0.000111489633f, 0.000108425045f, 0.000105357287f, 0.000102286475f,
+    9.92127255e-05f, 9.61361543e-05f, 9.30568782e-05f, 8.99750137e-05f,
+    8.68906773e-05f, 8.38039857e-05f, 8.07150555e-05f, 7.76240035e-05f,
+    7.45309464e-05f, 7.1436001e-05f, 6.83392842e-05f, 6.52409129e-05f,
+    6.21410039e-05f, 5.90396741e-05f, 5.59370406e-05f, 5.28332202e-05f,
+    4.972833e-05f, 4.66224869e-05f, 4.35158079e-05f, 4.04084099e-05f,
+    3.73004099e-05f, 3.4191925e-05f, 3.10830719e-05f, 2.79739676e-05f,
+    2.4864729e-05f, 2.1755473e-05f, 1.86463163e-05f, 1.55373758e-05f,
+    1.24287682e-05f, 9.32061025e-06f, 6.21301849e-06f, 3.10610957e-06f,
+    5.45530396e-18f, -3.10519375e-06f, -6.2093553e-06f, -9.31236831e-06f,
+    -1.24141166e-05f, -1.55144839e-05f, -1.86133542e-05f, -2.17106115e-05f,
+    -2.48061399e-05f, -2.78998237e-05f, -3.09915471e-05f, -3.40811945e-05f,
+    -3.71686506e-05f, -4.02537999e-05f, -4.33365272e-05f, -4.64167175e-05f,
+    -4.94942557e-05f, -5.2569027e-05f, -5.56409166e-05f, -5.87098101e-05f,
+    -6.17755931e-05f, -6.48381511e-05f, -6.78973702e-05f, -7.09531364e-05f,
+    -7.40053359e-05f, -7.70538551e-05f, -8.00985805e-05f, -8.31393989e-05f,
+    -8.61761971e-05f, -8.92088623e-05f, -9.22372817e-05f, -9.52613428e-05f,
+    -9.82809332e-05f, -0.000101295941f, -0.000104306254f, -0.000107311761f,
+    -0.000110312349f, -0.000113307909f, -0.000116298328f, -0.000119283496f,
+    -0.000122263302f, -0.000125237637f, -0.000128206389f, -0.000131169449f,
+    -0.000134126707f, -0.000137078054f, -0.000140023381f, -0.000142962578f,
+    -0.000145895538f, -0.000148822151f, -0.00015174231f, -0.000154655907f,
+    -0.000157562834f, -0.000160462985f, -0.000163356251f, -0.000166242527f,
+    -0.000169121706f, -0.000171993682f, -0.000174858349f, -0.000177715601f,
+    -0.000180565334f, -0.000183407443f, -0.000186241823f, -0.000189068369f,
+    -0.000191886979f, -0.000194697548f, -0.000197499973f, -0.000200294151f,
+    -0.00020307998f, -0.000205857357f, -0.000208626181f, -0.000211386349f,
+    -0.000214137762f, -0.000216880317f, -0.000219613916f, -0.000222338456f,
+    -0.00022505384f, -0.000227759966f, -0.000230456737f, -0.000233144054f,
+    -0.000235821819f, -0.000238489933f, -0.0002411483f, -0.000243796822f,
+    -0.000246435403f, -0.000249063946f, -0.000251682356f, -0.000254290537f,
+    -0.000256888394f, -0.000259475833f, -0.000262052759f, -0.000264619079f,
+    -0.000267174699f, -0.000269719527f, -0.000272253469f, -0.000274776434f,
+    -0.000277288331f, -0.000279789067f, -0.000282278553f, -0.000284756699f,
+    -0.000287223413f, -0.000289678607f, -0.000292122193f, -0.000294554081f,
+    -0.000296974184f, -0.000299382414f, -0.000301778683f, -0.000304162907f,
+    -0.000306534998f, -0.00030889487f, -0.00031124244f, -0.000313577621f,
+    -0.00031590033f, -0.000318210484f, -0.000320507998f, -0.000322792791f,
+    -0.000325064781f, -0.000327323884f, -0.000329570022f, -0.000331803112f,
+    -0.000334023075f, -0.00033622983f, -0.0003384233f, -0.000340603405f,
+    -0.000342770067f, -0.000344923209f, -0.000347062754f, -0.000349188626f,
+    -0.000351300747f, -0.000353399044f, -0.000355483441f, -0.000357553863f,
+    -0.000359610238f, -0.000361652491f, -0.000363680551f, -0.000365694345f,
+    -0.000367693801f, -0.000369678849f, -0.000371649418f, -0.000373605438f,
+    -0.00037554684f, -0.000377473555f, -0.000379385515f, -0.000381282653f,
+    -0.000383164901f, -0.000385032192f, -0.000386884462f, -0.000388721645f,
+    -0.000390543676f, -0.00039235049f, -0.000394142025f, -0.000395918218f,
+    -0.000397679006f, -0.000399424327f, -0.00040115412f, -0.000402868326f,
+    -0.000404566883f, -0.000406249732f, -0.000407916815f, -0.000409568074f,
+    -0.000411203451f, -0.000412822889f, -0.000414426332f, -0.000416013724f,
+    -0.00041758501f, -0.000419140136f, -0.000420679048f, -0.000422201693f,
+    -0.000423708018f, -0.000425197971f, -0.0004266715f, -0.000428128557f,
+    -0.000429569089f, -0.000430993048f, -0.000432400385f, -0.000433791052f,
+    -0.000435165001f, -0.000436522185f, -0.000437862559f, -0.000439186077f,
+    -0.000440492693f, -0.000441782364f, -0.000443055045f, -0.000444310695f,
+    -0.00044554927f, -0.000446770728f, -0.00044797503f, -0.000449162134f,
+    -0.000450332f, -0.00045148459f, -0.000452619866f, -0.000453737788f,
+    -0.000454838322f, -0.000455921429f, -0.000456987074f, -0.000458035223f,
+    -0.00045906584f, -0.000460078892f, -0.000461074346f, -0.000462052169f,
+    -0.000463012331f, -0.000463954798f, -0.000464879542f, -0.000465786532f,
+    -0.00046667574f, -0.000467547137f, -0.000468400695f, -0.000469236387f,
+    -0.000470054187f, -0.00047085407f, -0.00047163601f, -0.000472399982f,
+    -0.000473145964f, -0.000473873932f, -0.000474583865f, -0.000475275739f,
+    -0.000475949536f, -0.000476605233f, -0.000477242813f, -0.000477862255f,
+    -0.000478463542f, -0.000479046657f, -0.000479611581f, -0.000480158301f,
+    -0.000480686799f, -0.000481197061f, -0.000481689074f, -0.000482162823f,
+    -0.000482618297f, -0.000483055482f, -0.000483474369f, -0.000483874945f,
+    -0.000484257202f, -0.00048462113f, -0.000484966721f, -0.000485293966f,
+    -0.000485602859f, -0.000485893393f, -0.000486165562f, -0.000486419362f,
+    -0.000486654787f, -0.000486871835f, -0.000487070501f, -0.000487250785f,
+    -0.000487412683f, -0.000487556196f, -0.000487681322f, -0.000487788063f,
+    -0.00048787642f, -0.000487946393f, -0.000487997987f, -0.000488031203f,
+    -0.000488046047f, -0.000488042521f, -0.000488020633f, -0.000487980387f,
+    -0.00048792179f, -0.00048784485f, -0.000487749574f, -0.000487635972f,
+    -0.000487504052f, -0.000487353824f, -0.000487185301f, -0.000486998491f,
+    -0.000486793409f, -0.000486570066f, -0.000486328477f, -0.000486068655f,
+    -0.000485790614f, -0.000485494372f, -0.000485179943f, -0.000484847345f,
+    -0.000484496594f, -0.000484127711f, -0.000483740712f, -0.000483335618f,
+    -0.000482912449f, -0.000482471226f, -0.000482011971f, -0.000481534705f,
+    -0.000481039452f, -0.000480526235f, -0.000479995079f, -0.000479446008f,
+    -0.000478879047f, -0.000478294224f, -0.000477691565f, -0.000477071098f,
+    -0.00047643285f, -0.000475776852f, -0.000475103131f, -0.000474411719f,
+    -0.000473702646f, -0.000472975945f, -0.000472231646f, -0.000471469782f,
+    -0.000470690388f, -0.000469893498f, -0.000469079145f, -0.000468247366f,
+    -0.000467398197f, -0.000466531673f, -0.000465647833f, -0.000464746715f,
+    -0.000463828357f, -0.000462892798f, -0.000461940078f, -0.000460970237f,
+    -0.000459983318f, -0.000458979361f, -0.000457958409f, -0.000456920505f,
+    -0.000455865692f, -0.000454794016f, -0.00045370552f, -0.00045260025f,
+    -0.000451478252f, -0.000450339574f, -0.000449184262f, -0.000448012364f,
+    -0.000446823929f, -0.000445619006f, -0.000444397645f, -0.000443159896f,
+    -0.00044190581f, -0.000440635438f, -0.000439348834f, -0.000438046049f,
+    -0.000436727137f, -0.000435392152f, -0.000434041149f, -0.000432674182f,
+    -0.000431291307f, -0.000429892581f, -0.00042847806f, -0.000427047802f,
+    -0.000425601864f, -0.000424140306f, -0.000422663187f, -0.000421170565f,
+    -0.000419662503f, -0.000418139059f, -0.000416600297f, -0.000415046277f,
+    -0.000413477062f, -0.000411892716f, -0.000410293301f, -0.000408678883f,
+    -0.000407049525f, -0.000405405294f, -0.000403746254f, -0.000402072472f,
+    -0.000400384016f, -0.000398680951f, -0.000396963347f, -0.000395231272f,
+    -0.000393484795f, -0.000391723985f, -0.000389948912f, -0.000388159647f,
+    -0.00038635626f, -0.000384538824f, -0.000382707411f, -0.000380862092f,
+    -0.000379002942f, -0.000377130033f, -0.00037524344f, -0.000373343237f,
+    -0.000371429499f, -0.000369502302f, -0.000367561722f, -0.000365607835f,
+    -0.000363640718f, -0.000361660449f, -0.000359667106f, -0.000357660767f,
+    -0.00035564151f, -0.000353609416f, -0.000351564563f, -0.000349507033f,
+    -0.000347436906f, -0.000345354262f, -0.000343259185f, -0.000341151754f,
+    -0.000339032054f, -0.000336900167f, -0.000334756176f, -0.000332600165f,
+    -0.000330432219f, -0.000328252421f, -0.000326060857f, -0.000323857613f,
+    -0.000321642774f, -0.000319416426f, -0.000317178657f, -0.000314929553f,
+    -0.000312669202f, -0.000310397691f, -0.00030811511f, -0.000305821546f,
+    -0.000303517089f, -0.000301201829f, -0.000298875854f, -0.000296539256f,
+    -0.000294192125f, -0.000291834551f, -0.000289466627f, -0.000287088443f,
+    -0.000284700093f, -0.000282301668f, -0.00027989326f, -0.000277474964f,
+    -0.000275046873f, -0.00027260908f, -0.00027016168f, -0.000267704766f,
+    -0.000265238435f, -0.00026276278f, -0.000260277898f, -0.000257783884f,
+    -0.000255280834f, -0.000252768845f, -0.000250248013f, -0.000247718436f,
+    -0.00024518021f, -0.000242633434f, -0.000240078205f, -0.000237514621f,
+    -0.000234942781f, -0.000232362784f, -0.000229774729f, -0.000227178715f,
+    -0.000224574841f, -0.000221963208f, -0.000219343915f, -0.000216717064f,
+    -0.000214082754f, -0.000211441087f, -0.000208792163f, -0.000206136085f,
+    -0.000203472953f, -0.00020080287f, -0.000198125937f, -0.000195442258f,
+    -0.000192751934f, -0.000190055069f, -0.000187351765f, -0.000184642126f,
+    -0.000181926254f, -0.000179204255f, -0.000176476231f, -0.000173742286f,
+    -0.000171002525f, -0.000168257052f, -0.000165505972f, -0.000162749389f,
+    -0.000159987409f, -0.000157220137f, -0.000154447677f, -0.000151670136f,
+    -0.000148887619f, -0.000146100231f, -0.00014330808f, -0.00014051127f,
+    -0.000137709908f, -0.000134904101f, -0.000132093955f, -0.000129279576f,
+    -0.000126461072f, -0.00012363855f, -0.000120812116f, -0.000117981877f,
+    -0.000115147941f, -0.000112310415f, -0.000109469408f, -0.000106625025f,
+    -0.000103777375f, -0.000100926566f, -9.80727063e-05f, -9.52159026e-05f,
+    -9.23562636e-05f, -8.94938974e-05f, -8.66289121e-05f, -8.3761416e-05f,
+    -8.08915174e-05f, -7.80193248e-05f, -7.51449465e-05f, -7.2268491e-05f,
+    -6.9390067e-05f, -6.65097829e-05f, -6.36277475e-05f, -6.07440694e-05f,
+    -5.78588573e-05f, -5.49722199e-05f, -5.2084266e-05f, -4.91951044e-05f,
+    -4.63048439e-05f, -4.34135933e-05f, -4.05214613e-05f, -3.76285569e-05f,
+    -3.47349888e-05f, -3.18408659e-05f, -2.89462969e-05f, -2.60513907e-05f,
+    -2.3156256e-05f, -2.02610017e-05f, -1.73657364e-05f, -1.44705689e-05f,
+    -1.15756078e-05f, -8.68096174e-06f, -5.78673942e-06f, -2.89304933e-06f,
+    -1.01635561e-17f, 2.89230012e-06f, 5.78374263e-06f, 8.67421918e-06f,
+    1.15636215e-05f, 1.44518414e-05f, 1.73387707e-05f, 2.02243014e-05f,
+    2.31083255e-05f, 2.5990735e-05f, 2.88714223e-05f, 3.17502795e-05f,
+    3.46271991e-05f, 3.75020736e-05f, 4.03747954e-05f, 4.32452574e-05f,
+    4.61133524e-05f, 4.89789732e-05f, 5.1842013e-05f, 5.47023648e-05f,
+    5.7559922e-05f, 6.0414578e-05f, 6.32662264e-05f, 6.6114761e-05f,
+    6.89600754e-05f, 7.18020638e-05f, 7.46406204e-05f, 7.74756393e-05f,
+    8.03070151e-05f, 8.31346425e-05f, 8.59584162e-05f, 8.87782311e-05f,
+    9.15939825e-05f, 9.44055657e-05f, 9.72128761e-05f, 0.00010001581f,
+    0.000102814262f, 0.000105608129f, 0.000108397307f, 0.000111181694f,
+    0.000113961184f, 0.000116735676f, 0.000119505066f, 0.000122269252f,
+    0.000125028132f, 0.000127781602f, 0.000130529562f, 0.000133271909f,
+    0.000136008541f, 0.000138739358f, 0.000141464259f, 0.000144183142f,
+    0.000146895908f, 0.000149602455f, 0.000152302685f, 0.000154996496f,
+    0.00015768379f, 0.000160364467f, 0.000163038429f, 0.000165705576f,
+    0.000168365811f, 0.000171019035f, 0.00017366515f, 0.000176304059f,
+    0.000178935665f, 0.00018155987f, 0.000184176579f, 0.000186785694f,
+    0.00018938712f, 0.000191980761f, 0.000194566521f, 0.000197144306f,
+    0.000199714021f, 0.000202275571f, 0.000204828862f, 0.000207373801f,
+    0.000209910293f, 0.000212438247f, 0.000214957569f, 0.000217468167f,
+    0.000219969948f, 0.000222462822f, 0.000224946696f, 0.00022742148f,
+    0.000229887084f, 0.000232343416f, 0.000234790387f, 0.000237227908f,
+    0.000239655889f, 0.000242074242f, 0.000244482878f, 0.00024688171f,
+    0.00024927065f, 0.00025164961f, 0.000254018504f, 0.000256377245f,
+    0.000258725748f, 0.000261063926f, 0.000263391695f, 0.00026570897f,
+    0.000268015667f, 0.000270311701f, 0.000272596989f, 0.000274871449f,
+    0.000277134996f, 0.00027938755f, 0.000281629028f, 0.000283859349f,
+    0.000286078432f, 0.000288286197f, 0.000290482563f, 0.000292667451f,
+    0.000294840781f, 0.000297002476f, 0.000299152456f, 0.000301290645f,
+    0.000303416964f, 0.000305531337f, 0.000307633688f, 0.00030972394f,
+    0.000311802019f, 0.000313867848f, 0.000315921354f, 0.000317962463f,
+    0.000319991101f, 0.000322007196f, 0.000324010673f, 0.000326001463f,
+    0.000327979492f, 0.00032994469f, 0.000331896986f, 0.00033383631f,
+    0.000335762594f, 0.000337675766f, 0.00033957576f, 0.000341462507f,
+    0.000343335939f, 0.00034519599f, 0.000347042592f, 0.000348875681f,
+    0.00035069519f, 0.000352501054f, 0.00035429321f, 0.000356071593f,
+    0.00035783614f, 0.000359586788f, 0.000361323475f, 0.00036304614f,
+    0.00036475472f, 0.000366449155f, 0.000368129386f, 0.000369795353f,
+    0.000371446996f, 0.000373084257f, 0.000374707079f, 0.000376315403f,
+    0.000377909174f, 0.000379488335f, 0.00038105283f, 0.000382602604f,
+    0.000384137603f, 0.000385657772f, 0.000387163059f, 0.00038865341f,
+    0.000390128773f, 0.000391589097f, 0.00039303433f, 0.000394464422f,
+    0.000395879323f, 0.000397278983f, 0.000398663354f, 0.000400032388f,
+    0.000401386036f, 0.000402724252f, 0.00040404699f, 0.000405354203f,
+    0.000406645847f, 0.000407921876f, 0.000409182247f, 0.000410426916f,
+    0.000411655841f, 0.000412868978f, 0.000414066287f, 0.000415247726f,
+    0.000416413254f, 0.000417562833f, 0.000418696422f, 0.000419813984f,
+    0.00042091548f, 0.000422000872f, 0.000423070124f, 0.000424123199f,
+    0.000425160063f, 0.00042618068f, 0.000427185016f, 0.000428173036f,
+    0.000429144709f, 0.000430100001f, 0.00043103888f, 0.000431961316f,
+    0.000432867278f, 0.000433756736f, 0.000434629659f, 0.000435486021f,
+    0.000436325792f, 0.000437148945f, 0.000437955453f, 0.00043874529f,
+    0.000439518431f, 0.00044027485f, 0.000441014523f, 0.000441737426f,
+    0.000442443537f, 0.000443132833f, 0.000443805292f, 0.000444460892f,
+    0.000445099614f, 0.000445721438f, 0.000446326344f, 0.000446914314f,
+    0.000447485329f, 0.000448039373f, 0.000448576428f, 0.000449096479f,
+    0.000449599511f, 0.000450085507f, 0.000450554456f, 0.000451006342f,
+    0.000451441153f, 0.000451858877f, 0.000452259502f, 0.000452643017f,
+    0.000453009413f, 0.000453358679f, 0.000453690807f, 0.000454005788f,
+    0.000454303614f, 0.000454584278f, 0.000454847775f, 0.000455094098f,
+    0.000455323242f, 0.000455535203f, 0.000455729976f, 0.00045590756f,
+    0.00045606795f, 0.000456211145f, 0.000456337145f, 0.000456445948f,
+    0.000456537554f, 0.000456611965f, 0.000456669181f, 0.000456709204f,
+    0.000456732038f, 0.000456737684f, 0.000456726148f, 0.000456697434f,
+    0.000456651546f, 0.000456588492f, 0.000456508276f, 0.000456410907f,
+    0.000456296392f, 0.00045616474f, 0.000456015959f, 0.000455850059f,
+    0.00045566705f, 0.000455466945f, 0.000455249753f, 0.000455015487f,
+    0.000454764161f, 0.000454495787f, 0.00045421038f, 0.000453907954f,
+    0.000453588526f, 0.00045325211f, 0.000452898724f, 0.000452528385f,
+    0.000452141111f, 0.00045173692f, 0.000451315832f, 0.000450877866f,
+    0.000450423043f, 0.000449951384f, 0.00044946291f, 0.000448957645f,
+    0.00044843561f, 0.00044789683f, 0.000447341328f, 0.00044676913f,
+    0.000446180261f, 0.000445574747f, 0.000444952614f, 0.00044431389f,
+    0.000443658603f, 0.000442986781f, 0.000442298453f, 0.00044159365f,
+    0.000440872401f, 0.000440134737f, 0.00043938069f, 0.000438610293f,
+    0.000437823577f, 0.000437020576f, 0.000436201325f, 0.000435365858f,
+    0.000434514209f, 0.000433646415f, 0.000432762513f, 0.000431862538f,
+    0.000430946529f, 0.000430014524f, 0.000429066561f, 0.00042810268f,
+    0.000427122921f, 0.000426127324f, 0.00042511593f, 0.000424088781f,
+    0.00042304592f, 0.000421987388f, 0.00042091323f, 0.00041982349f,
+    0.000418718211f, 0.000417597439f, 0.00041646122f, 0.0004153096f,
+    0.000414142626f, 0.000412960345f, 0.000411762805f, 0.000410550055f,
+    0.000409322144f, 0.000408079121f, 0.000406821036f, 0.000405547941f,
+    0.000404259886f, 0.000402956923f, 0.000401639106f, 0.000400306485f,
+    0.000398959116f, 0.000397597052f, 0.000396220348f, 0.000394829058f,
+    0.000393423239f, 0.000392002946f, 0.000390568236f, 0.000389119166f,
+    0.000387655795f, 0.000386178179f, 0.000384686379f, 0.000383180452f,
+    0.00038166046f, 0.000380126463f, 0.00037857852f, 0.000377016694f,
+    0.000375441046f, 0.000373851639f, 0.000372248535f, 0.000370631798f,
+    0.000369001492f, 0.00036735768f, 0.000365700429f, 0.000364029802f,
+    0.000362345866f, 0.000360648688f, 0.000358938333f, 0.000357214869f,
+    0.000355478364f, 0.000353728886f, 0.000351966503f, 0.000350191285f,
+    0.000348403302f, 0.000346602623f, 0.000344789318f, 0.000342963459f,
+    0.000341125118f, 0.000339274365f, 0.000337411274f, 0.000335535916f,
+    0.000333648366f, 0.000331748697f, 0.000329836983f, 0.000327913298f,
+    0.000325977718f, 0.000324030317f, 0.000322071172f, 0.000320100358f,
+    0.000318117953f, 0.000316124034f, 0.000314118677f, 0.000312101961f,
+    0.000310073964f, 0.000308034765f, 0.000305984442f, 0.000303923076f,
+    0.000301850746f, 0.000299767532f, 0.000297673515f, 0.000295568777f,
+    0.000293453398f, 0.00029132746f, 0.000289191046f, 0.000287044238f,
+    0.000284887119f, 0.000282719772f, 0.000280542281f, 0.000278354731f,
+    0.000276157204f, 0.000273949787f, 0.000271732564f, 0.00026950562f,
+    0.000267269042f, 0.000265022915f, 0.000262767326f, 0.000260502362f,
+    0.00025822811f, 0.000255944657f, 0.000253652091f, 0.000251350501f,
+    0.000249039973f, 0.000246720599f, 0.000244392465f, 0.000242055662f,
+    0.00023971028f, 0.000237356407f, 0.000234994136f, 0.000232623555f,
+    0.000230244756f, 0.000227857831f, 0.000225462869f, 0.000223059964f,
+    0.000220649207f, 0.00021823069f, 0.000215804506f, 0.000213370747f,
+    0.000210929507f, 0.000208480879f, 0.000206024957f, 0.000203561833f,
+    0.000201091603f, 0.000198614361f, 0.0001961302f, 0.000193639216f,
+    0.000191141505f, 0.00018863716f, 0.000186126278f, 0.000183608954f,
+    0.000181085285f, 0.000178555365f, 0.000176019293f, 0.000173477163f,
+    0.000170929073f, 0.000168375121f, 0.000165815402f, 0.000163250014f,
+    0.000160679056f, 0.000158102624f, 0.000155520816f, 0.000152933732f,
+    0.000150341467f, 0.000147744123f, 0.000145141796f, 0.000142534585f,
+    0.000139922591f, 0.00013730591f, 0.000134684644f, 0.000132058891f,
+    0.000129428751f, 0.000126794323f, 0.000124155707f, 0.000121513004f,
+    0.000118866313f, 0.000116215734f, 0.000113561368f, 0.000110903315f,
+    0.000108241676f, 0.000105576552f, 0.000102908042f, 0.000100236249f,
+    9.75612733e-05f, 9.48832155e-05f, 9.2202177e-05f, 8.95182591e-05f,
+    8.68315633e-05f, 8.41421908e-05f, 8.14502432e-05f, 7.87558221e-05f,
+    7.60590292e-05f, 7.33599661e-05f, 7.06587347e-05f, 6.79554367e-05f,
+    6.52501741e-05f, 6.25430489e-05f, 5.9834163e-05f, 5.71236184e-05f,
+    5.44115172e-05f, 5.16979616e-05f, 4.89830537e-05f, 4.62668956e-05f,
+    4.35495896e-05f, 4.08312379e-05f, 3.81119426e-05f, 3.53918061e-05f,
+    3.26709307e-05f, 2.99494184e-05f, 2.72273718e-05f, 2.45048929e-05f,
+    2.1782084e-05f, 1.90590474e-05f, 1.63358854e-05f, 1.36127e-05f,
+    1.08895936e-05f, 8.1666683e-06f, 5.44402619e-06f, 2.7217694e-06f,
+    1.73760364e-18f, -2.72117999e-06f, -5.44166858e-06f, -8.16136384e-06f,
+    -1.08801639e-05f, -1.35979669e-05f, -1.63146711e-05f, -1.90301748e-05f,
+    -2.17443764e-05f, -2.44571742e-05f, -2.71684669e-05f, -2.98781529e-05f,
+    -3.25861311e-05f, -3.52923e-05f, -3.79965586e-05f, -4.06988058e-05f,
+    -4.33989406e-05f, -4.60968622e-05f, -4.87924699e-05f, -5.14856629e-05f,
+    -5.41763407e-05f, -5.6864403e-05f, -5.95497493e-05f, -6.22322796e-05f,
+    -6.49118938e-05f, -6.75884919e-05f, -7.02619742e-05f, -7.29322411e-05f,
+    -7.55991929e-05f, -7.82627304e-05f, -8.09227544e-05f, -8.35791658e-05f,
+    -8.62318656e-05f, -8.88807552e-05f, -9.1525736e-05f, -9.41667096e-05f,
+    -9.68035776e-05f, -9.94362422e-05f, -0.000102064605f, -0.000104688569f,
+    -0.000107308037f, -0.00010992291f, -0.000112533092f, -0.000115138486f,
+    -0.000117738996f, -0.000120334524f, -0.000122924974f, -0.000125510251f,
+    -0.000128090258f, -0.0001306649f, -0.000133234081f, -0.000135797705f,
+    -0.000138355679f, -0.000140907907f, -0.000143454294f, -0.000145994747f,
+    -0.000148529171f, -0.000151057473f, -0.000153579558f, -0.000156095334f,
+    -0.000158604707f, -0.000161107585f, -0.000163603875f, -0.000166093485f,
+    -0.000168576323f, -0.000171052297f, -0.000173521316f, -0.000175983288f,
+    -0.000178438123f, -0.000180885729f, -0.000183326018f, -0.000185758898f,
+    -0.000188184281f, -0.000190602075f, -0.000193012194f, -0.000195414547f,
+    -0.000197809045f, -0.000200195602f, -0.000202574129f, -0.000204944539f,
+    -0.000207306743f, -0.000209660656f, -0.000212006191f, -0.000214343261f,
+    -0.000216671781f, -0.000218991665f, -0.000221302828f, -0.000223605185f,
+    -0.000225898651f, -0.000228183142f, -0.000230458574f, -0.000232724865f,
+    -0.00023498193f, -0.000237229687f, -0.000239468053f, -0.000241696947f,
+    -0.000243916287f, -0.000246125992f, -0.00024832598f, -0.000250516172f,
+    -0.000252696487f, -0.000254866845f, -0.000257027167f, -0.000259177373f,
+    -0.000261317387f, -0.000263447128f, -0.00026556652f, -0.000267675485f,
+    -0.000269773947f, -0.000271861828f, -0.000273939052f, -0.000276005544f,
+    -0.000278061228f, -0.00028010603f, -0.000282139875f, -0.000284162689f,
+    -0.000286174398f, -0.00028817493f, -0.00029016421f, -0.000292142168f,
+    -0.000294108732f, -0.000296063829f, -0.000298007389f, -0.000299939341f,
+    -0.000301859616f, -0.000303768143f, -0.000305664853f, -0.000307549678f,
+    -0.00030942255f, -0.0003112834f, -0.000313132161f, -0.000314968766f,
+    -0.00031679315f, -0.000318605245f, -0.000320404987f, -0.000322192311f,
+    -0.000323967151f, -0.000325729445f, -0.000327479127f, -0.000329216137f,
+    -0.00033094041f, -0.000332651884f, -0.000334350499f, -0.000336036193f,
+    -0.000337708905f, -0.000339368576f, -0.000341015145f, -0.000342648554f,
+    -0.000344268744f, -0.000345875656f, -0.000347469234f, -0.00034904942f,
+    -0.000350616158f, -0.000352169392f, -0.000353709065f, -0.000355235124f,
+    -0.000356747513f, -0.000358246179f, -0.000359731068f, -0.000361202127f,
+    -0.000362659304f, -0.000364102547f, -0.000365531805f, -0.000366947027f,
+    -0.000368348162f, -0.000369735162f, -0.000371107976f, -0.000372466556f,
+    -0.000373810855f, -0.000375140823f, -0.000376456415f, -0.000377757585f,
+    -0.000379044285f, -0.000380316471f, -0.000381574098f, -0.000382817122f,
+    -0.000384045498f, -0.000385259185f, -0.000386458139f, -0.000387642318f,
+    -0.000388811681f, -0.000389966187f, -0.000391105795f, -0.000392230466f,
+    -0.000393340161f, -0.00039443484f, -0.000395514467f, -0.000396579003f,
+    -0.000397628412f, -0.000398662656f, -0.000399681701f, -0.000400685512f,
+    -0.000401674052f, -0.00040264729f, -0.00040360519f, -0.000404547721f,
+    -0.00040547485f, -0.000406386544f, -0.000407282774f, -0.000408163509f,
+    -0.000409028718f, -0.000409878372f, -0.000410712442f, -0.000411530901f,
+    -0.000412333721f, -0.000413120874f, -0.000413892334f, -0.000414648075f,
+    -0.000415388073f, -0.000416112302f, -0.000416820739f, -0.000417513359f,
+    -0.000418190141f, -0.000418851062f, -0.000419496099f, -0.000420125233f,
+    -0.000420738443f, -0.000421335708f, -0.00042191701f, -0.00042248233f,
+    -0.00042303165f, -0.000423564952f, -0.00042408222f, -0.000424583437f,
+    -0.000425068587f, -0.000425537656f, -0.00042599063f, -0.000426427494f,
+    -0.000426848234f, -0.00042725284f, -0.000427641298f, -0.000428013596f,
+    -0.000428369726f, -0.000428709675f, -0.000429033435f, -0.000429340996f,
+    -0.000429632351f, -0.00042990749f, -0.000430166409f, -0.000430409098f,
+    -0.000430635554f, -0.00043084577f, -0.000431039742f, -0.000431217465f,
+    -0.000431378937f, -0.000431524153f, -0.000431653113f, -0.000431765814f,
+    -0.000431862255f, -0.000431942436f, -0.000432006356f, -0.000432054018f,
+    -0.000432085421f, -0.000432100569f, -0.000432099463f, -0.000432082106f,
+    -0.000432048504f, -0.000431998659f, -0.000431932577f, -0.000431850264f,
+    -0.000431751726f, -0.00043163697f, -0.000431506002f, -0.000431358832f,
+    -0.000431195467f, -0.000431015918f, -0.000430820194f, -0.000430608304f,
+    -0.000430380262f, -0.000430136077f, -0.000429875763f, -0.000429599332f,
+    -0.000429306798f, -0.000428998174f, -0.000428673476f, -0.000428332719f,
+    -0.000427975918f, -0.000427603091f, -0.000427214253f, -0.000426809423f,
+    -0.00042638862f, -0.000425951861f, -0.000425499166f, -0.000425030555f,
+    -0.00042454605f, -0.000424045671f, -0.000423529439f, -0.000422997378f,
+    -0.00042244951f, -0.00042188586f, -0.00042130645f, -0.000420711306f,
+    -0.000420100453f, -0.000419473917f, -0.000418831724f, -0.000418173902f,
+    -0.000417500478f, -0.000416811481f, -0.000416106939f, -0.000415386881f,
+    -0.000414651338f, -0.00041390034f, -0.000413133918f, -0.000412352104f,
+    -0.00041155493f, -0.000410742429f, -0.000409914635f, -0.00040907158f,
+    -0.0004082133f, -0.00040733983f, -0.000406451206f, -0.000405547463f,
+    -0.000404628638f, -0.000403694769f, -0.000402745893f, -0.00040178205f,
+    -0.000400803277f, -0.000399809615f, -0.000398801104f, -0.000397777783f,
+    -0.000396739695f, -0.000395686881f, -0.000394619383f, -0.000393537244f,
+    -0.000392440507f, -0.000391329217f, -0.000390203417f, -0.000389063153f,
+    -0.000387908471f, -0.000386739415f, -0.000385556033f, -0.000384358371f,
+    -0.000383146478f, -0.000381920401f, -0.00038068019f, -0.000379425892f,
+    -0.000378157559f, -0.000376875239f, -0.000375578984f, -0.000374268846f,
+    -0.000372944874f, -0.000371607123f, -0.000370255645f, -0.000368890492f,
+    -0.000367511719f, -0.00036611938f, -0.00036471353f, -0.000363294223f,
+    -0.000361861516f, -0.000360415465f, -0.000358956126f, -0.000357483558f,
+    -0.000355997816f, -0.00035449896f, -0.000352987048f, -0.00035146214f,
+    -0.000349924295f, -0.000348373572f, -0.000346810033f, -0.000345233739f,
+    -0.00034364475f, -0.00034204313f, -0.00034042894f, -0.000338802243f,
+    -0.000337163103f, -0.000335511582f, -0.000333847747f, -0.00033217166f,
+    -0.000330483388f, -0.000328782996f, -0.000327070549f, -0.000325346115f,
+    -0.00032360976f, -0.000321861551f, -0.000320101556f, -0.000318329844f,
+    -0.000316546483f, -0.000314751542f, -0.00031294509f, -0.000311127197f,
+    -0.000309297934f, -0.000307457371f, -0.00030560558f, -0.000303742631f,
+    -0.000301868597f, -0.00029998355f, -0.000298087562f, -0.000296180708f,
+    -0.000294263059f, -0.000292334691f, -0.000290395678f, -0.000288446093f,
+    -0.000286486013f, -0.000284515512f, -0.000282534666f, -0.000280543553f,
+    -0.000278542247f, -0.000276530826f, -0.000274509367f, -0.000272477948f,
+    -0.000270436648f, -0.000268385543f, -0.000266324713f, -0.000264254237f,
+    -0.000262174195f, -0.000260084665f, -0.000257985729f, -0.000255877467f,
+    -0.000253759958f, -0.000251633285f, -0.000249497529f, -0.000247352772f,
+    -0.000245199095f, -0.000243036581f, -0.000240865312f, -0.000238685373f,
+    -0.000236496845f, -0.000234299813f, -0.000232094361f, -0.000229880572f,
+    -0.000227658532f, -0.000225428324f, -0.000223190035f, -0.000220943749f,
+    -0.000218689553f, -0.000216427532f, -0.000214157772f, -0.000211880361f,
+    -0.000209595384f, -0.000207302928f, -0.000205003082f, -0.000202695933f,
+    -0.000200381568f, -0.000198060075f, -0.000195731544f, -0.000193396062f,
+    -0.000191053718f, -0.000188704602f, -0.000186348802f, -0.000183986409f,
+    -0.000181617511f, -0.0001792422f, -0.000176860564f, -0.000174472696f,
+    -0.000172078684f, -0.000169678621f, -0.000167272597f, -0.000164860704f,
+    -0.000162443033f, -0.000160019675f, -0.000157590723f, -0.000155156269f,
+    -0.000152716404f, -0.000150271223f, -0.000147820816f, -0.000145365277f,
+    -0.000142904699f, -0.000140439175f, -0.000137968798f, -0.000135493663f,
+    -0.000133013862f, -0.000130529489f, -0.000128040639f, -0.000125547405f,
+    -0.000123049882f, -0.000120548164f, -0.000118042345f, -0.000115532522f,
+    -0.000113018787f, -0.000110501237f, -0.000107979966f, -0.000105455069f,
+    -0.000102926643f, -0.000100394782f, -9.78595812e-05f, -9.53211372e-05f,
+    -9.27795455e-05f, -9.0234902e-05f, -8.76873026e-05f, -8.51368433e-05f,
+    -8.25836204e-05f, -8.00277301e-05f, -7.74692686e-05f, -7.49083324e-05f,
+    -7.23450179e-05f, -6.97794218e-05f, -6.72116406e-05f, -6.4641771e-05f,
+    -6.20699097e-05f, -5.94961536e-05f, -5.69205995e-05f, -5.43433443e-05f,
+    -5.1764485e-05f, -4.91841185e-05f, -4.66023419e-05f, -4.40192523e-05f,
+    -4.14349468e-05f, -3.88495225e-05f, -3.62630765e-05f, -3.36757061e-05f,
+    -3.10875085e-05f, -2.84985808e-05f, -2.59090203e-05f, -2.33189242e-05f,
+    -2.07283898e-05f, -1.81375142e-05f, -1.55463948e-05f, -1.29551287e-05f,
+    -1.03638131e-05f, -7.77254531e-06f, -5.18142242e-06f, -2.5905416e-06f,
+    -6.2050039e-18f, 2.59010529e-06f, 5.1796772e-06f, 7.7686187e-06f,
+    1.03568328e-05f, 1.29442225e-05f, 1.5530691e-05f, 1.81161414e-05f,
+    2.07004769e-05f, 2.32836007e-05f, 2.58654162e-05f, 2.84458268e-05f,
+    3.10247359e-05f, 3.36020471e-05f, 3.61776639e-05f, 3.87514901e-05f,
+    4.13234294e-05f, 4.38933857e-05f, 4.64612629e-05f, 4.9026965e-05f,
+    5.15903963e-05f, 5.41514609e-05f, 5.67100631e-05f, 5.92661075e-05f,
+    6.18194986e-05f, 6.43701411e-05f, 6.69179397e-05f, 6.94627994e-05f,
+    7.20046253e-05f, 7.45433224e-05f, 7.70787962e-05f, 7.9610952e-05f,
+    8.21396955e-05f, 8.46649323e-05f, 8.71865684e-05f, 8.97045097e-05f,
+    9.22186625e-05f, 9.4728933e-05f, 9.72352278e-05f, 9.97374536e-05f,
+    0.000102235517f, 0.000104729325f, 0.000107218786f, 0.000109703805f,
+    0.000112184291f, 0.000114660152f, 0.000117131296f, 0.000119597629f,
+    0.000122059062f, 0.000124515502f, 0.000126966858f, 0.000129413039f,
+    0.000131853954f, 0.000134289512f, 0.000136719623f, 0.000139144197f,
+    0.000141563143f, 0.000143976373f, 0.000146383795f, 0.000148785321f,
+    0.000151180862f, 0.000153570329f, 0.000155953634f, 0.000158330687f,
+    0.000160701401f, 0.000163065688f, 0.00016542346f, 0.00016777463f,
+    0.000170119111f, 0.000172456816f, 0.000174787658f, 0.000177111552f,
+    0.00017942841f, 0.000181738148f, 0.00018404068f, 0.00018633592f,
+    0.000188623784f, 0.000190904187f, 0.000193177045f, 0.000195442274f,
+    0.00019769979f, 0.000199949509f, 0.000202191349f, 0.000204425227f,
+    0.00020665106f, 0.000208868766f, 0.000211078263f, 0.00021327947f,
+    0.000215472306f, 0.000217656688f, 0.000219832538f, 0.000221999775f,
+    0.000224158318f, 0.000226308088f, 0.000228449007f, 0.000230580995f,
+    0.000232703973f, 0.000234817864f, 0.000236922589f, 0.000239018071f,
+    0.000241104234f, 0.000243181f, 0.000245248292f, 0.000247306036f,
+    0.000249354155f, 0.000251392573f, 0.000253421217f, 0.000255440011f,
+    0.000257448881f, 0.000259447754f, 0.000261436557f, 0.000263415215f,
+    0.000265383657f, 0.00026734181f, 0.000269289603f, 0.000271226964f,
+    0.000273153822f, 0.000275070107f, 0.000276975748f, 0.000278870675f,
+    0.00028075482f, 0.000282628112f, 0.000284490485f, 0.000286341869f,
+    0.000288182196f, 0.000290011401f, 0.000291829414f, 0.000293636172f,
+    0.000295431606f, 0.000297215652f, 0.000298988244f, 0.000300749319f,
+    0.00030249881f, 0.000304236656f, 0.000305962792f, 0.000307677156f,
+    0.000309379684f, 0.000311070316f, 0.000312748989f, 0.000314415643f,
+    0.000316070216f, 0.000317712649f, 0.000319342882f, 0.000320960855f,
+    0.000322566511f, 0.000324159789f, 0.000325740634f, 0.000327308986f,
+    0.000328864791f, 0.00033040799f, 0.000331938528f, 0.00033345635f,
+    0.000334961401f, 0.000336453625f, 0.00033793297f, 0.000339399382f,
+    0.000340852808f, 0.000342293194f, 0.00034372049f, 0.000345134643f,
+    0.000346535603f, 0.00034792332f, 0.000349297742f, 0.000350658821f,
+    0.000352006507f, 0.000353340752f, 0.000354661509f, 0.000355968729f,
+    0.000357262366f, 0.000358542373f, 0.000359808704f, 0.000361061314f,
+    0.000362300158f, 0.000363525192f, 0.000364736372f, 0.000365933654f,
+    0.000367116995f, 0.000368286354f, 0.000369441689f, 0.000370582958f,
+    0.00037171012f, 0.000372823137f, 0.000373921967f, 0.000375006573f,
+    0.000376076914f, 0.000377132954f, 0.000378174655f, 0.000379201981f,
+    0.000380214893f, 0.000381213358f, 0.000382197339f, 0.000383166803f,
+    0.000384121713f, 0.000385062038f, 0.000385987744f, 0.000386898798f,
+    0.000387795169f, 0.000388676825f, 0.000389543735f, 0.000390395869f,
+    0.000391233197f, 0.000392055689f, 0.000392863319f, 0.000393656056f,
+    0.000394433874f, 0.000395196745f, 0.000395944644f, 0.000396677545f,
+    0.000397395422f, 0.00039809825f, 0.000398786006f, 0.000399458665f,
+    0.000400116206f, 0.000400758605f, 0.00040138584f, 0.000401997891f,
+    0.000402594736f, 0.000403176356f, 0.00040374273f, 0.000404293841f,
+    0.000404829669f, 0.000405350196f, 0.000405855406f, 0.000406345281f,
+    0.000406819806f, 0.000407278965f, 0.000407722743f, 0.000408151125f,
+    0.000408564098f, 0.000408961649f, 0.000409343764f, 0.000409710433f,
+    0.000410061642f, 0.000410397382f, 0.000410717642f, 0.000411022412f,
+    0.000411311684f, 0.000411585448f, 0.000411843696f, 0.000412086421f,
+    0.000412313617f, 0.000412525276f, 0.000412721394f, 0.000412901964f,
+    0.000413066984f, 0.000413216448f, 0.000413350353f, 0.000413468697f,
+    0.000413571477f, 0.000413658691f, 0.00041373034f, 0.000413786421f,
+    0.000413826936f, 0.000413851885f, 0.000413861269f, 0.000413855091f,
+    0.000413833352f, 0.000413796056f, 0.000413743206f, 0.000413674807f,
+    0.000413590863f, 0.00041349138f, 0.000413376364f, 0.00041324582f,
+    0.000413099757f, 0.000412938182f, 0.000412761103f, 0.00041256853f,
+    0.00041236047f, 0.000412136936f, 0.000411897936f, 0.000411643482f,
+    0.000411373587f, 0.000411088261f, 0.000410787519f, 0.000410471374f,
+    0.000410139838f, 0.000409792929f, 0.000409430659f, 0.000409053046f,
+    0.000408660105f, 0.000408251854f, 0.000407828309f, 0.000407389489f,
+    0.000406935413f, 0.000406466099f, 0.000405981567f, 0.000405481838f,
+    0.000404966933f, 0.000404436872f, 0.000403891679f, 0.000403331374f,
+    0.000402755983f, 0.000402165528f, 0.000401560033f, 0.000400939523f,
+    0.000400304024f, 0.000399653562f, 0.000398988163f, 0.000398307854f,
+    0.000397612662f, 0.000396902616f, 0.000396177745f, 0.000395438077f,
+    0.000394683643f, 0.000393914472f, 0.000393130596f, 0.000392332046f,
+    0.000391518855f, 0.000390691053f, 0.000389848676f, 0.000388991755f,
+    0.000388120326f, 0.000387234423f, 0.000386334081f, 0.000385419336f,
+    0.000384490224f, 0.000383546782f, 0.000382589048f, 0.000381617059f,
+    0.000380630853f, 0.00037963047f, 0.000378615949f, 0.00037758733f,
+    0.000376544653f, 0.000375487959f, 0.000374417291f, 0.000373332689f,
+    0.000372234198f, 0.000371121858f, 0.000369995715f, 0.000368855813f,
+    0.000367702195f, 0.000366534907f, 0.000365353995f, 0.000364159505f,
+    0.000362951483f, 0.000361729976f, 0.000360495033f, 0.000359246701f,
+    0.000357985029f, 0.000356710065f, 0.000355421861f, 0.000354120464f,
+    0.000352805927f, 0.000351478301f, 0.000350137636f, 0.000348783985f,
+    0.0003474174f, 0.000346037934f, 0.000344645641f, 0.000343240575f,
+    0.000341822789f, 0.00034039234f, 0.000338949281f, 0.00033749367f,
+    0.000336025562f, 0.000334545013f, 0.000333052082f, 0.000331546826f,
+    0.000330029302f, 0.000328499569f, 0.000326957687f, 0.000325403714f,
+    0.000323837711f, 0.000322259738f, 0.000320669855f, 0.000319068124f,
+    0.000317454607f, 0.000315829365f, 0.000314192461f, 0.000312543957f,
+    0.000310883918f, 0.000309212407f, 0.000307529487f, 0.000305835225f,
+    0.000304129684f, 0.00030241293f, 0.000300685029f, 0.000298946048f,
+    0.000297196052f, 0.000295435109f, 0.000293663287f, 0.000291880652f,
+    0.000290087274f, 0.000288283221f, 0.000286468563f, 0.000284643367f,
+    0.000282807705f, 0.000280961647f, 0.000279105262f, 0.000277238623f,
+    0.0002753618f, 0.000273474865f, 0.00027157789f, 0.000269670947f,
+    0.00026775411f, 0.000265827451f, 0.000263891044f, 0.000261944962f,
+    0.000259989281f, 0.000258024074f, 0.000256049417f, 0.000254065384f,
+    0.000252072052f, 0.000250069495f, 0.000248057792f, 0.000246037017f,
+    0.000244007248f, 0.000241968562f, 0.000239921038f, 0.000237864751f,
+    0.000235799782f, 0.000233726208f, 0.000231644109f, 0.000229553563f,
+    0.00022745465f, 0.000225347449f, 0.000223232041f, 0.000221108506f,
+    0.000218976925f, 0.000216837378f, 0.000214689947f, 0.000212534714f,
+    0.00021037176f, 0.000208201167f, 0.000206023017f, 0.000203837394f,
+    0.000201644379f, 0.000199444057f, 0.000197236511f, 0.000195021823f,
+    0.000192800079f, 0.000190571363f, 0.000188335758f, 0.00018609335f,
+    0.000183844223f, 0.000181588463f, 0.000179326154f, 0.000177057384f,
+    0.000174782237f, 0.000172500799f, 0.000170213158f, 0.000167919398f,
+    0.000165619609f, 0.000163313875f, 0.000161002285f, 0.000158684925f,
+    0.000156361884f, 0.000154033249f, 0.000151699108f, 0.000149359549f,
+    0.000147014662f, 0.000144664533f, 0.000142309253f, 0.00013994891f,
+    0.000137583592f, 0.000135213391f, 0.000132838394f, 0.000130458691f,
+    0.000128074373f, 0.000125685529f, 0.00012329225f, 0.000120894625f,
+    0.000118492746f, 0.000116086702f, 0.000113676584f, 0.000111262484f,
+    0.000108844492f, 0.000106422699f, 0.000103997197f, 0.000101568076f,
+    9.91354298e-05f, 9.66993483e-05f, 9.42599237e-05f, 9.18172479e-05f,
+    8.93714129e-05f, 8.69225107e-05f, 8.44706335e-05f, 8.20158736e-05f,
+    7.95583233e-05f, 7.70980753e-05f, 7.46352219e-05f, 7.2169856e-05f,
+    6.97020701e-05f, 6.72319572e-05f, 6.47596101e-05f, 6.22851218e-05f,
+    5.98085852e-05f, 5.73300936e-05f, 5.48497401e-05f, 5.23676178e-05f,
+    4.98838201e-05f, 4.73984402e-05f, 4.49115716e-05f, 4.24233077e-05f,
+    3.99337419e-05f, 3.74429677e-05f, 3.49510787e-05f, 3.24581683e-05f,
+    2.99643303e-05f, 2.74696582e-05f, 2.49742456e-05f, 2.24781861e-05f,
+    1.99815736e-05f, 1.74845015e-05f, 1.49870636e-05f, 1.24893536e-05f,
+    9.99146511e-06f, 7.49349186e-06f, 4.99552748e-06f, 2.49766565e-06f,
+    -1.19784996e-18f, -2.49737585e-06f, -4.99436831e-06f, -7.49088379e-06f,
+    -9.98682875e-06f, -1.24821097e-05f, -1.49766331e-05f, -1.74703056e-05f,
+    -1.99630337e-05f, -2.24547241e-05f, -2.49452835e-05f, -2.74346187e-05f,
+    -2.99226365e-05f, -3.24092437e-05f, -3.48943472e-05f, -3.73778542e-05f,
+    -3.98596716e-05f, -4.23397065e-05f, -4.48178663e-05f, -4.72940582e-05f,
+    -4.97681895e-05f, -5.22401679e-05f, -5.47099007e-05f, -5.71772958e-05f,
+    -5.96422608e-05f, -6.21047037e-05f, -6.45645323e-05f, -6.70216548e-05f,
+    -6.94759793e-05f, -7.19274141e-05f, -7.43758677e-05f, -7.68212485e-05f,
+    -7.92634654e-05f, -8.17024269e-05f, -8.41380422e-05f, -8.65702201e-05f,
+    -8.89988701e-05f, -9.14239012e-05f, -9.38452232e-05f, -9.62627455e-05f,
+    -9.86763781e-05f, -0.000101086031f, -0.000103491614f, -0.000105893037f,
+    -0.000108290211f, -0.000110683047f, -0.000113071455f, -0.000115455347f,
+    -0.000117834633f, -0.000120209224f, -0.000122579033f, -0.00012494397f,
+    -0.000127303949f, -0.00012965888f, -0.000132008676f, -0.000134353249f,
+    -0.000136692513f, -0.00013902638f, -0.000141354764f, -0.000143677576f,
+    -0.000145994732f, -0.000148306145f, -0.000150611728f, -0.000152911396f,
+    -0.000155205064f, -0.000157492645f, -0.000159774056f, -0.000162049211f,
+    -0.000164318025f, -0.000166580414f, -0.000168836294f, -0.000171085582f,
+    -0.000173328193f, -0.000175564044f, -0.000177793052f, -0.000180015134f,
+    -0.000182230208f, -0.000184438192f, -0.000186639002f, -0.000188832559f,
+    -0.00019101878f, -0.000193197583f, -0.000195368889f, -0.000197532616f,
+    -0.000199688685f, -0.000201837014f, -0.000203977526f, -0.000206110139f,
+    -0.000208234775f, -0.000210351356f, -0.000212459802f, -0.000214560035f,
+    -0.000216651979f, -0.000218735554f, -0.000220810684f, -0.000222877292f,
+    -0.000224935302f, -0.000226984637f, -0.000229025221f, -0.000231056978f,
+    -0.000233079834f, -0.000235093714f, -0.000237098542f, -0.000239094246f,
+    -0.00024108075f, -0.000243057982f, -0.000245025867f, -0.000246984335f,
+    -0.000248933311f, -0.000250872724f, -0.000252802503f, -0.000254722575f,
+    -0.00025663287f, -0.000258533318f, -0.000260423848f, -0.00026230439f,
+    -0.000264174875f, -0.000266035233f, -0.000267885397f, -0.000269725297f,
+    -0.000271554866f, -0.000273374036f, -0.00027518274f, -0.000276980912f,
+    -0.000278768485f, -0.000280545393f, -0.000282311571f, -0.000284066954f,
+    -0.000285811476f, -0.000287545074f, -0.000289267683f, -0.000290979241f,
+    -0.000292679683f, -0.000294368949f, -0.000296046975f, -0.000297713699f,
+    -0.000299369061f, -0.000301012999f, -0.000302645453f, -0.000304266363f,
+    -0.000305875669f, -0.000307473313f, -0.000309059235f, -0.000310633377f,
+    -0.000312195681f, -0.00031374609f, -0.000315284548f, -0.000316810996f,
+    -0.000318325381f, -0.000319827645f, -0.000321317735f, -0.000322795594f,
+    -0.00032426117f, -0.000325714408f, -0.000327155255f, -0.000328583658f,
+    -0.000329999565f, -0.000331402925f, -0.000332793685f, -0.000334171795f,
+    -0.000335537205f, -0.000336889865f, -0.000338229724f, -0.000339556735f,
+    -0.000340870848f, -0.000342172016f, -0.000343460192f, -0.000344735327f,
+    -0.000345997376f, -0.000347246293f, -0.000348482032f, -0.000349704548f,
+    -0.000350913797f, -0.000352109734f, -0.000353292317f, -0.000354461501f,
+    -0.000355617244f, -0.000356759505f, -0.000357888242f, -0.000359003414f,
+    -0.00036010498f, -0.000361192901f, -0.000362267137f, -0.000363327649f,
+    -0.000364374398f, -0.000365407347f, -0.000366426459f, -0.000367431696f,
+    -0.000368423022f, -0.000369400401f, -0.000370363798f, -0.000371313178f,
+    -0.000372248508f, -0.000373169753f, -0.000374076879f, -0.000374969855f,
+    -0.000375848649f, -0.000376713228f, -0.000377563561f, -0.000378399619f,
+    -0.000379221371f, -0.000380028788f, -0.00038082184f, -0.0003816005f,
+    -0.000382364739f, -0.000383114531f, -0.000383849848f, -0.000384570664f,
+    -0.000385276954f, -0.000385968693f, -0.000386645856f, -0.000387308418f,
+    -0.000387956357f, -0.00038858965f, -0.000389208274f, -0.000389812208f,
+    -0.000390401429f, -0.000390975918f, -0.000391535655f, -0.000392080619f,
+    -0.000392610791f, -0.000393126154f, -0.000393626689f, -0.000394112378f,
+    -0.000394583206f, -0.000395039155f, -0.00039548021f, -0.000395906356f,
+    -0.000396317578f, -0.000396713862f, -0.000397095194f, -0.000397461563f,
+    -0.000397812955f, -0.000398149358f, -0.000398470762f, -0.000398777155f,
+    -0.000399068528f, -0.000399344871f, -0.000399606175f, -0.000399852432f,
+    -0.000400083633f, -0.000400299771f, -0.00040050084f, -0.000400686834f,
+    -0.000400857747f, -0.000401013573f, -0.000401154309f, -0.00040127995f,
+    -0.000401390493f, -0.000401485935f, -0.000401566275f, -0.00040163151f,
+    -0.000401681639f, -0.000401716662f, -0.000401736579f, -0.000401741391f,
+    -0.000401731098f, -0.000401705702f, -0.000401665206f, -0.000401609613f,
+    -0.000401538925f, -0.000401453147f, -0.000401352284f, -0.00040123634f,
+    -0.000401105322f, -0.000400959235f, -0.000400798086f, -0.000400621883f,
+    -0.000400430634f, -0.000400224346f, -0.00040000303f, -0.000399766695f,
+    -0.00039951535f, -0.000399249007f, -0.000398967677f, -0.000398671372f,
+    -0.000398360104f, -0.000398033886f, -0.000397692732f, -0.000397336656f,
+    -0.000396965672f, -0.000396579796f, -0.000396179043f, -0.00039576343f,
+    -0.000395332973f, -0.000394887691f, -0.0003944276f, -0.00039395272f,
+    -0.000393463069f, -0.000392958668f, -0.000392439535f, -0.000391905693f,
+    -0.000391357162f, -0.000390793965f, -0.000390216122f, -0.000389623659f,
+    -0.000389016596f, -0.00038839496f, -0.000387758774f, -0.000387108064f,
+    -0.000386442855f, -0.000385763173f, -0.000385069045f, -0.000384360498f,
+    -0.00038363756f, -0.000382900259f, -0.000382148624f, -0.000381382685f,
+    -0.000380602472f, -0.000379808014f, -0.000378999343f, -0.00037817649f,
+    -0.000377339487f, -0.000376488368f, -0.000375623164f, -0.00037474391f,
+    -0.00037385064f, -0.000372943388f, -0.000372022189f, -0.00037108708f,
+    -0.000370138096f, -0.000369175274f, -0.000368198651f, -0.000367208266f,
+    -0.000366204156f, -0.00036518636f, -0.000364154917f, -0.000363109868f,
+    -0.000362051252f, -0.00036097911f, -0.000359893484f, -0.000358794415f,
+    -0.000357681945f, -0.000356556118f, -0.000355416977f, -0.000354264565f,
+    -0.000353098927f, -0.000351920107f, -0.000350728151f, -0.000349523105f,
+    -0.000348305014f, -0.000347073926f, -0.000345829887f, -0.000344572945f,
+    -0.000343303149f, -0.000342020547f, -0.000340725189f, -0.000339417123f,
+    -0.000338096399f, -0.000336763069f, -0.000335417183f, -0.000334058793f,
+    -0.000332687951f, -0.000331304709f, -0.000329909119f, -0.000328501235f,
+    -0.000327081112f, -0.000325648802f, -0.000324204361f, -0.000322747844f,
+    -0.000321279306f, -0.000319798804f, -0.000318306393f, -0.000316802131f,
+    -0.000315286075f, -0.000313758283f, -0.000312218813f, -0.000310667723f,
+    -0.000309105072f, -0.000307530921f, -0.000305945328f, -0.000304348355f,
+    -0.000302740062f, -0.000301120509f, -0.00029948976f, -0.000297847875f,
+    -0.000296194917f, -0.00029453095f, -0.000292856035f, -0.000291170237f,
+    -0.00028947362f, -0.000287766248f, -0.000286048186f, -0.000284319499f,
+    -0.000282580253f, -0.000280830514f, -0.000279070348f, -0.000277299822f,
+    -0.000275519004f, -0.00027372796f, -0.000271926758f, -0.000270115467f,
+    -0.000268294156f, -0.000266462893f, -0.000264621749f, -0.000262770792f,
+    -0.000260910092f, -0.000259039721f, -0.000257159749f, -0.000255270248f,
+    -0.000253371288f, -0.000251462942f, -0.000249545282f, -0.00024761838f,
+    -0.00024568231f, -0.000243737144f, -0.000241782957f, -0.000239819822f,
+    -0.000237847813f, -0.000235867005f, -0.000233877473f, -0.000231879293f,
+    -0.000229872539f, -0.000227857287f, -0.000225833614f, -0.000223801596f,
+    -0.00022176131f, -0.000219712833f, -0.000217656243f, -0.000215591616f,
+    -0.000213519031f, -0.000211438567f, -0.000209350302f, -0.000207254314f,
+    -0.000205150683f, -0.000203039488f, -0.000200920809f, -0.000198794726f,
+    -0.000196661319f, -0.000194520668f, -0.000192372855f, -0.00019021796f,
+    -0.000188056065f, -0.000185887251f, -0.0001837116f, -0.000181529194f,
+    -0.000179340115f, -0.000177144446f, -0.000174942269f, -0.000172733668f,
+    -0.000170518726f, -0.000168297526f, -0.000166070152f, -0.000163836688f,
+    -0.000161597218f, -0.000159351827f, -0.000157100599f, -0.000154843618f,
+    -0.00015258097f, -0.00015031274f, -0.000148039014f, -0.000145759877f,
+    -0.000143475414f, -0.000141185712f, -0.000138890858f, -0.000136590937f,
+    -0.000134286036f, -0.000131976241f, -0.00012966164f, -0.00012734232f,
+    -0.000125018368f, -0.000122689872f, -0.000120356918f, -0.000118019595f,
+    -0.000115677991f, -0.000113332194f, -0.000110982292f, -0.000108628373f,
+    -0.000106270526f, -0.000103908839f, -0.000101543402f, -9.91743029e-05f,
+    -9.68016312e-05f, -9.44254759e-05f, -9.20459264e-05f, -8.96630721e-05f,
+    -8.72770025e-05f, -8.48878074e-05f, -8.24955764e-05f, -8.01003994e-05f,
+    -7.77023665e-05f, -7.53015677e-05f, -7.28980932e-05f, -7.04920333e-05f,
+    -6.80834783e-05f, -6.56725187e-05f, -6.3259245e-05f, -6.08437478e-05f,
+    -5.84261179e-05f, -5.6006446e-05f, -5.3584823e-05f, -5.11613397e-05f,
+    -4.87360871e-05f, -4.63091562e-05f, -4.38806382e-05f, -4.14506242e-05f,
+    -3.90192053e-05f, -3.65864729e-05f, -3.41525181e-05f, -3.17174324e-05f,
+    -2.9281307e-05f, -2.68442334e-05f, -2.44063029e-05f, -2.19676071e-05f,
+    -1.95282373e-05f, -1.70882852e-05f, -1.46478421e-05f, -1.22069997e-05f,
+    -9.76584934e-06f, -7.32448267e-06f, -4.8829912e-06f, -2.44146647e-06f,
+    0.0f, 0.0f,
+};
+
+// Precomputed sinc table
+struct SincTableData {
+    size_t window_size;
+    size_t window_interp;
+    const sample_t* samples;
+};
+
+// All precomputed sinc tables
+const SincTableData sinc_tables[] = {
+    { 16, 64, sinc_table_16_64 },
+    { 32, 128, sinc_table_32_128 },
+    { 64, 512, sinc_table_64_512 },
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_TABLES_H_
@@ -0,0 +1,87 @@
+#! /usr/bin/env python3
+import math
+
+# (window_size, window_interp) for every ResamplerProfile,
+# should match get_window_size() and get_window_interp() in resampler_builtin.cpp
+PROFILES = [
+    ('Low', 16, 64),
+    ('Medium', 32, 128),
+    ('High', 64, 512),
+]
+
+VALUES_PER_LINE = 4
+
+# should match SincTableMap::make_table_()
+def make_table(window_size, window_interp):
+    size = window_size * window_interp + 2
+
+    table = [0.0] * size
+    table[0] = 1.0
+
+    sinc_step = 1.0 / window_interp
+    sinc_t = sinc_step
+
+    for i in range(1, size):
+        window = 0.54 - 0.46 * math.cos(
+            2 * math.pi * ((i - 1) / 2.0 / size + 0.5))
+        table[i] = math.sin(math.pi * sinc_t) / math.pi / sinc_t * window
+        sinc_t += sinc_step
+
+    table[size - 2] = 0.0
+    table[size - 1] = 0.0
+
+    return table
+
+def format_value(value):
+    text = '%.9g' % value
+    if not any(c in text for c in '.en'):
+        text += '.0'
+    return text + 'f'
+
+def table_name(window_size, window_interp):
+    return 'sinc_table_{}_{}'.format(window_size, window_interp)
+
+print('''/*
+ * THIS FILE IS AUTO-GENERATED USING `sinc_tables_gen.py'
+ */
+
+#ifndef ROC_AUDIO_SINC_TABLES_H_
+#define ROC_AUDIO_SINC_TABLES_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+''')
+
+for profile, window_size, window_interp in PROFILES:
+    table = make_table(window_size, window_interp)
+
+    print('// ResamplerProfile_{}'.format(profile))
+    print('const sample_t {}[{}] = {{'.format(
+        table_name(window_size, window_interp), len(table)))
+    for n in range(0, len(table), VALUES_PER_LINE):
+        print('    ' + ', '.join(
+            map(format_value, table[n:n + VALUES_PER_LINE])) + ',')
+    print('};')
+    print()
+
+print('''// Precomputed sinc table
+struct SincTableData {
+    size_t window_size;
+    size_t window_interp;
+    const sample_t* samples;
+};
+
+// All precomputed sinc tables
+const SincTableData sinc_tables[] = {''')
+for profile, window_size, window_interp in PROFILES:
+    print('    {{ {}, {}, {} }},'.format(
+        window_size, window_interp, table_name(window_size, window_interp)))
+print('''};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_TABLES_H_''')
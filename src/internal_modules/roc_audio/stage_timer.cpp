@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/stage_timer.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+const core::nanoseconds_t ReportInterval = 20 * core::Second;
+
+// Weight of every frame in smoothed load.
+// With 10ms frames, load follows changes in about a second.
+const float LoadSmoothing = 0.01f;
+
+size_t duration_2_bucket(core::nanoseconds_t duration) {
+    size_t bucket = 0;
+
+    for (core::nanoseconds_t us = duration / core::Microsecond; us > 0; us >>= 1) {
+        bucket++;
+    }
+
+    if (bucket >= StageTimer::NumBuckets) {
+        bucket = StageTimer::NumBuckets - 1;
+    }
+
+    return bucket;
+}
+
+core::nanoseconds_t bucket_2_duration(size_t bucket) {
+    return ((core::nanoseconds_t)1 << bucket) * core::Microsecond;
+}
+
+double ns_2_ms(core::nanoseconds_t ns) {
+    return (double)ns / core::Millisecond;
+}
+
+} // namespace
+
+StageTimer::StageTimer(const char* name, const SampleSpec& sample_spec)
+    : name_(name)
+    , sample_spec_(sample_spec)
+    , load_(0)
+    , has_load_(false)
+    , rate_limiter_(ReportInterval) {
+    roc_panic_if(!name);
+
+    // first report after the first interval
+    (void)rate_limiter_.allow();
+
+    reset_();
+}
+
+void StageTimer::add_frame(size_t n_samples, core::nanoseconds_t elapsed) {
+    if (elapsed < 0) {
+        elapsed = 0;
+    }
+
+    buckets_[duration_2_bucket(elapsed)]++;
+
+    num_frames_++;
+    sum_time_ += elapsed;
+
+    if (elapsed > max_time_) {
+        max_time_ = elapsed;
+    }
+
+    const core::nanoseconds_t duration = sample_spec_.samples_overall_2_ns(n_samples);
+
+    if (elapsed > duration) {
+        num_late_++;
+    }
+
+    if (duration > 0) {
+        const float frame_load = (float)elapsed / (float)duration;
+        if (!has_load_) {
+            load_ = frame_load;
+            has_load_ = true;
+        } else {
+            load_ += (frame_load - load_) * LoadSmoothing;
+        }
+    }
+
+    if (rate_limiter_.allow()) {
+        report_();
+        reset_();
+    }
+}
+
+size_t StageTimer::num_frames() const {
+    return num_frames_;
+}
+
+size_t StageTimer::num_late_frames() const {
+    return num_late_;
+}
+
+core::nanoseconds_t StageTimer::max_time() const {
+    return max_time_;
+}
+
+core::nanoseconds_t StageTimer::percentile(double ratio) const {
+    if (num_frames_ == 0) {
+        return 0;
+    }
+
+    const size_t threshold = (size_t)(ratio * (double)num_frames_ + 0.5);
+
+    size_t count = 0;
+    for (size_t n = 0; n < NumBuckets; n++) {
+        count += buckets_[n];
+        if (count >= threshold && count != 0) {
+            if (n == NumBuckets - 1) {
+                // last bucket has no upper bound
+                break;
+            }
+            return std::min(bucket_2_duration(n), max_time_);
+        }
+    }
+
+    return max_time_;
+}
+
+float StageTimer::load() const {
+    return load_;
+}
+
+void StageTimer::report_() {
+    if (num_frames_ == 0) {
+        return;
+    }
+
+    roc_log(LogDebug,
+            "stage timer: %s: frames=%lu late=%lu avg=%.3fms p50=%.3fms p99=%.3fms"
+            " max=%.3fms load=%.3f",
+            name_, (unsigned long)num_frames_, (unsigned long)num_late_,
+            ns_2_ms(sum_time_ / (core::nanoseconds_t)num_frames_),
+            ns_2_ms(percentile(0.5)), ns_2_ms(percentile(0.99)), ns_2_ms(max_time_),
+            (double)load_);
+}
+
+void StageTimer::reset_() {
+    for (size_t n = 0; n < NumBuckets; n++) {
+        buckets_[n] = 0;
+    }
+
+    num_frames_ = 0;
+    num_late_ = 0;
+    sum_time_ = 0;
+    max_time_ = 0;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/stage_timer.h
+//! @brief Pipeline stage timer.
+
+#ifndef ROC_AUDIO_STAGE_TIMER_H_
+#define ROC_AUDIO_STAGE_TIMER_H_
+
+#include "roc_audio/sample_spec.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace audio {
+
+//! Pipeline stage timer.
+//!
+//! Collects histogram of per-frame processing time of a pipeline stage,
+//! and periodically reports its percentiles and the number of frames which
+//! took longer than frame duration, i.e. missed the real-time deadline.
+//! Also maintains smoothed load, which can be used for admission control.
+//!
+//! Histogram has fixed power-of-two buckets, so adding a frame is O(1) and
+//! doesn't allocate. Timer is not thread-safe; every pipeline stage is used
+//! by one thread at a time, and each stage has its own timer, so no
+//! synchronization is needed.
+class StageTimer : public core::NonCopyable<> {
+public:
+    enum {
+        //! Number of histogram buckets.
+        //! Bucket N holds durations below 2^N microseconds.
+        NumBuckets = 24
+    };
+
+    //! Initialize.
+    //! @remarks
+    //!  @p name should be a string literal, it's used in reports.
+    StageTimer(const char* name, const SampleSpec& sample_spec);
+
+    //! Add processed frame.
+    //! @remarks
+    //!  @p n_samples is total number of samples in frame for all channels.
+    void add_frame(size_t n_samples, core::nanoseconds_t elapsed);
+
+    //! Get number of frames in current report window.
+    size_t num_frames() const;
+
+    //! Get number of frames that took longer than their duration.
+    size_t num_late_frames() const;
+
+    //! Get maximum frame processing time.
+    core::nanoseconds_t max_time() const;
+
+    //! Get upper bound of given percentile of frame processing time.
+    //! @remarks
+    //!  @p ratio is from 0 to 1. Returns upper bound of histogram bucket.
+    core::nanoseconds_t percentile(double ratio) const;
+
+    //! Get smoothed load of the stage.
+    //! @remarks
+    //!  Exponential moving average of processing time divided by frame
+    //!  duration, e.g. 0.1 means that the stage takes 10% of real time.
+    //!  Unlike other metrics, is not reset at the end of report window.
+    float load() const;
+
+private:
+    void report_();
+    void reset_();
+
+    const char* name_;
+    const SampleSpec sample_spec_;
+
+    size_t buckets_[NumBuckets];
+
+    size_t num_frames_;
+    size_t num_late_;
+    core::nanoseconds_t sum_time_;
+    core::nanoseconds_t max_time_;
+
+    float load_;
+    bool has_load_;
+
+    core::RateLimiter rate_limiter_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_STAGE_TIMER_H_
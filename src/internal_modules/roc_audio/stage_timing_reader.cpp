@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/stage_timing_reader.h"
+#include "roc_core/fast_clock.h"
+
+namespace roc {
+namespace audio {
+
+StageTimingReader::StageTimingReader(IFrameReader& reader,
+                                     const char* stage_name,
+                                     const audio::SampleSpec& sample_spec)
+    : reader_(reader)
+    , timer_(stage_name, sample_spec) {
+}
+
+bool StageTimingReader::read(Frame& frame) {
+    const core::nanoseconds_t start = core::fast_timestamp();
+
+    if (!reader_.read(frame)) {
+        return false;
+    }
+
+    timer_.add_frame(frame.num_samples(), core::fast_timestamp() - start);
+
+    return true;
+}
+
+const StageTimer& StageTimingReader::timer() const {
+    return timer_;
+}
+
+} // namespace audio
+} // namespace roc
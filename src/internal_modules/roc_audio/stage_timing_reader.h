@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/stage_timing_reader.h
+//! @brief Stage timing reader.
+
+#ifndef ROC_AUDIO_STAGE_TIMING_READER_H_
+#define ROC_AUDIO_STAGE_TIMING_READER_H_
+
+#include "roc_audio/iframe_reader.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_audio/stage_timer.h"
+#include "roc_core/noncopyable.h"
+
+namespace roc {
+namespace audio {
+
+//! Stage timing reader.
+//! @remarks
+//!  Measures time of every read() call of nested reader and passes it to
+//!  StageTimer. Measured time includes time spent in all stages that are
+//!  called by nested reader.
+class StageTimingReader : public IFrameReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p stage_name should be a string literal.
+    StageTimingReader(IFrameReader& reader,
+                      const char* stage_name,
+                      const audio::SampleSpec& sample_spec);
+
+    //! Read audio frame.
+    virtual bool read(Frame& frame);
+
+    //! Get timer.
+    const StageTimer& timer() const;
+
+private:
+    IFrameReader& reader_;
+    StageTimer timer_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_STAGE_TIMING_READER_H_
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/stage_timing_writer.h"
+#include "roc_core/fast_clock.h"
+
+namespace roc {
+namespace audio {
+
+StageTimingWriter::StageTimingWriter(IFrameWriter& writer,
+                                     const char* stage_name,
+                                     const audio::SampleSpec& sample_spec)
+    : writer_(writer)
+    , timer_(stage_name, sample_spec) {
+}
+
+void StageTimingWriter::write(Frame& frame) {
+    const size_t n_samples = frame.num_samples();
+    const core::nanoseconds_t start = core::fast_timestamp();
+
+    writer_.write(frame);
+
+    timer_.add_frame(n_samples, core::fast_timestamp() - start);
+}
+
+const StageTimer& StageTimingWriter::timer() const {
+    return timer_;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/stage_timing_writer.h
+//! @brief Stage timing writer.
+
+#ifndef ROC_AUDIO_STAGE_TIMING_WRITER_H_
+#define ROC_AUDIO_STAGE_TIMING_WRITER_H_
+
+#include "roc_audio/iframe_writer.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_audio/stage_timer.h"
+#include "roc_core/noncopyable.h"
+
+namespace roc {
+namespace audio {
+
+//! Stage timing writer.
+//! @remarks
+//!  Measures time of every write() call of nested writer and passes it to
+//!  StageTimer. Measured time includes time spent in all stages that are
+//!  called by nested writer.
+class StageTimingWriter : public IFrameWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p stage_name should be a string literal.
+    StageTimingWriter(IFrameWriter& writer,
+                      const char* stage_name,
+                      const audio::SampleSpec& sample_spec);
+
+    //! Write audio frame.
+    virtual void write(Frame& frame);
+
+    //! Get timer.
+    const StageTimer& timer() const;
+
+private:
+    IFrameWriter& writer_;
+    StageTimer timer_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_STAGE_TIMING_WRITER_H_
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/opus_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+OpusDecoder::OpusDecoder(const SampleSpec& sample_spec)
+    : decoder_(NULL)
+    , sample_rate_(sample_spec.sample_rate())
+    , n_chans_(sample_spec.num_channels())
+    , stream_pos_(0)
+    , stream_avail_(0)
+    , frame_end_(0)
+    , has_frame_end_(false)
+    , in_frame_(false)
+    , buffer_pos_(0)
+    , valid_(false) {
+    if (n_chans_ == 0 || n_chans_ > MaxChannels) {
+        roc_log(LogError, "opus decoder: unsupported number of channels: n_channels=%lu",
+                (unsigned long)n_chans_);
+        return;
+    }
+
+    roc_log(LogDebug, "opus decoder: initializing: sample_rate=%lu n_channels=%lu",
+            (unsigned long)sample_rate_, (unsigned long)n_chans_);
+
+    int err = OPUS_OK;
+    decoder_ = opus_decoder_create((opus_int32)sample_rate_, (int)n_chans_, &err);
+    if (err != OPUS_OK || !decoder_) {
+        roc_log(LogError, "opus decoder: opus_decoder_create(): [%d] %s", err,
+                opus_strerror(err));
+        return;
+    }
+
+    valid_ = true;
+}
+
+OpusDecoder::~OpusDecoder() {
+    if (decoder_) {
+        opus_decoder_destroy(decoder_);
+    }
+}
+
+bool OpusDecoder::valid() const {
+    return valid_;
+}
+
+packet::timestamp_t OpusDecoder::position() const {
+    return stream_pos_;
+}
+
+packet::timestamp_t OpusDecoder::available() const {
+    return stream_avail_;
+}
+
+size_t OpusDecoder::decoded_sample_count(const void* frame_data,
+                                         size_t frame_size) const {
+    roc_panic_if_not(frame_data);
+
+    const int ret = opus_packet_get_nb_samples((const unsigned char*)frame_data,
+                                               (opus_int32)frame_size,
+                                               (opus_int32)sample_rate_);
+    if (ret < 0) {
+        return 0;
+    }
+
+    return (size_t)ret;
+}
+
+void OpusDecoder::begin(packet::timestamp_t frame_position,
+                        const void* frame_data,
+                        size_t frame_size) {
+    roc_panic_if_not(frame_data);
+
+    if (in_frame_) {
+        roc_panic("opus decoder: unpaired begin/end");
+    }
+
+    in_frame_ = true;
+    buffer_pos_ = 0;
+
+    stream_pos_ = frame_position;
+    stream_avail_ = 0;
+
+    if (!valid_) {
+        return;
+    }
+
+    const unsigned char* data = (const unsigned char*)frame_data;
+
+    size_t n_concealed = 0;
+
+    if (has_frame_end_ && packet::timestamp_lt(frame_end_, frame_position)) {
+        n_concealed =
+            conceal_((size_t)packet::timestamp_diff(frame_position, frame_end_), data,
+                     frame_size);
+    }
+
+    const int ret =
+        opus_decode_float(decoder_, data, (opus_int32)frame_size,
+                          buffer_ + n_concealed * n_chans_, MaxFrameSamples, 0);
+
+    size_t n_decoded = 0;
+
+    if (ret < 0) {
+        roc_log(LogDebug, "opus decoder: can't decode frame: [%d] %s", ret,
+                opus_strerror(ret));
+    } else {
+        n_decoded = (size_t)ret;
+    }
+
+    stream_pos_ = frame_position - (packet::timestamp_t)n_concealed;
+    stream_avail_ = (packet::timestamp_t)(n_concealed + n_decoded);
+
+    frame_end_ = frame_position + (packet::timestamp_t)n_decoded;
+    has_frame_end_ = true;
+}
+
+size_t OpusDecoder::read(audio::sample_t* samples, size_t n_samples) {
+    if (!in_frame_) {
+        roc_panic("opus decoder: read should be called only between begin/end");
+    }
+
+    n_samples = std::min(n_samples, (size_t)stream_avail_);
+
+    memcpy(samples, buffer_ + buffer_pos_ * n_chans_,
+           n_samples * n_chans_ * sizeof(sample_t));
+
+    return shift(n_samples);
+}
+
+size_t OpusDecoder::shift(size_t n_samples) {
+    if (!in_frame_) {
+        roc_panic("opus decoder: shift should be called only between begin/end");
+    }
+
+    n_samples = std::min(n_samples, (size_t)stream_avail_);
+
+    buffer_pos_ += n_samples;
+
+    stream_pos_ += (packet::timestamp_t)n_samples;
+    stream_avail_ -= (packet::timestamp_t)n_samples;
+
+    return n_samples;
+}
+
+void OpusDecoder::end() {
+    if (!in_frame_) {
+        roc_panic("opus decoder: unpaired begin/end");
+    }
+
+    in_frame_ = false;
+    buffer_pos_ = 0;
+    stream_avail_ = 0;
+}
+
+// restore gap before current frame, returns number of concealed samples
+size_t OpusDecoder::conceal_(size_t gap,
+                             const unsigned char* frame_data,
+                             size_t frame_size) {
+    // opus can conceal only multiples of 2.5 ms
+    const size_t unit = sample_rate_ / 400;
+    const size_t max_concealed =
+        std::min(sample_rate_ * 3 / 50, (size_t)MaxConcealSamples);
+
+    if (gap > max_concealed) {
+        return 0;
+    }
+
+    const size_t n_concealed = gap / unit * unit;
+    if (n_concealed == 0) {
+        return 0;
+    }
+
+    // last lost frame is restored from fec data of current frame, and the
+    // rest of the gap is extrapolated from previous frames
+    size_t n_fec = decoded_sample_count(frame_data, frame_size);
+    if (n_fec > n_concealed) {
+        n_fec = n_concealed;
+    }
+
+    const size_t n_plc = n_concealed - n_fec;
+
+    if (n_plc != 0) {
+        const int ret = opus_decode_float(decoder_, NULL, 0, buffer_, (int)n_plc, 0);
+        if (ret < 0) {
+            roc_log(LogDebug, "opus decoder: can't conceal gap: [%d] %s", ret,
+                    opus_strerror(ret));
+            return 0;
+        }
+    }
+
+    if (n_fec != 0) {
+        const int ret =
+            opus_decode_float(decoder_, frame_data, (opus_int32)frame_size,
+                              buffer_ + n_plc * n_chans_, (int)n_fec, 1);
+        if (ret < 0) {
+            roc_log(LogDebug, "opus decoder: can't restore frame from fec: [%d] %s",
+                    ret, opus_strerror(ret));
+            return 0;
+        }
+    }
+
+    roc_log(LogTrace, "opus decoder: concealed gap: gap=%lu plc=%lu fec=%lu",
+            (unsigned long)gap, (unsigned long)n_plc, (unsigned long)n_fec);
+
+    return n_concealed;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/target_opus/roc_audio/opus_decoder.h
+//! @brief Opus decoder.
+
+#ifndef ROC_AUDIO_OPUS_DECODER_H_
+#define ROC_AUDIO_OPUS_DECODER_H_
+
+#include "roc_audio/iframe_decoder.h"
+#include "roc_audio/sample.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+#include <opus/opus.h>
+
+namespace roc {
+namespace audio {
+
+//! Opus decoder.
+//!
+//! Decodes the whole frame in begin() and then returns decoded samples from
+//! read() and shift().
+//!
+//! When there is a gap between the previous frame and the new one, decoder
+//! conceals it: the part of the gap right before the new frame is restored
+//! from in-band FEC data of the new frame, and the rest is extrapolated by
+//! Opus packet loss concealment. Concealed samples are returned before the
+//! samples of the new frame, i.e. position() after begin() is moved back by
+//! the number of concealed samples, so that Depacketizer renders them instead
+//! of silence.
+class OpusDecoder : public IFrameDecoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p sample_spec defines sample rate and channels of decoded frames;
+    //!    sample rate should be one of 8000, 12000, 16000, 24000, or 48000,
+    //!    and there should be one or two channels
+    explicit OpusDecoder(const SampleSpec& sample_spec);
+
+    ~OpusDecoder();
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get current stream position.
+    virtual packet::timestamp_t position() const;
+
+    //! Get number of samples available for decoding.
+    virtual packet::timestamp_t available() const;
+
+    //! Get number of samples per channel, that can be decoded from given frame.
+    virtual size_t decoded_sample_count(const void* frame_data, size_t frame_size) const;
+
+    //! Start decoding a new frame.
+    virtual void
+    begin(packet::timestamp_t frame_position, const void* frame_data, size_t frame_size);
+
+    //! Read samples from current frame.
+    virtual size_t read(sample_t* samples, size_t n_samples);
+
+    //! Shift samples from current frame.
+    virtual size_t shift(size_t n_samples);
+
+    //! Finish decoding current frame.
+    virtual void end();
+
+private:
+    enum {
+        MaxChannels = 2,
+
+        // 120 ms at 48000 Hz, maximum duration of Opus packet
+        MaxFrameSamples = 5760,
+
+        // 60 ms at 48000 Hz, longer gaps are not concealed
+        MaxConcealSamples = 2880
+    };
+
+    size_t conceal_(size_t gap, const unsigned char* frame_data, size_t frame_size);
+
+    ::OpusDecoder* decoder_;
+
+    const size_t sample_rate_;
+    const size_t n_chans_;
+
+    packet::timestamp_t stream_pos_;
+    packet::timestamp_t stream_avail_;
+
+    // end of last decoded frame, used to detect gaps
+    packet::timestamp_t frame_end_;
+    bool has_frame_end_;
+
+    bool in_frame_;
+
+    // concealed and decoded samples of current frame
+    sample_t buffer_[(MaxConcealSamples + MaxFrameSamples) * MaxChannels];
+    size_t buffer_pos_;
+
+    bool valid_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_OPUS_DECODER_H_
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/opus_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+// supported frame durations, in units of 2.5 ms
+const size_t FrameDurations[] = { 1, 2, 4, 8, 16, 24 };
+
+// maximum size of Opus packet with a single frame
+const size_t MaxPacketBytes = 1275;
+
+// expected packet loss percentage; makes encoder include in-band FEC data
+const int LossPercentage = 10;
+
+} // namespace
+
+OpusEncoder::OpusEncoder(const SampleSpec& sample_spec, size_t bitrate)
+    : encoder_(NULL)
+    , sample_rate_(sample_spec.sample_rate())
+    , n_chans_(sample_spec.num_channels())
+    , bitrate_(bitrate)
+    , frame_data_(NULL)
+    , frame_size_(0)
+    , n_samples_(0)
+    , valid_(false) {
+    if (n_chans_ == 0 || n_chans_ > MaxChannels) {
+        roc_log(LogError, "opus encoder: unsupported number of channels: n_channels=%lu",
+                (unsigned long)n_chans_);
+        return;
+    }
+
+    roc_log(LogDebug,
+            "opus encoder: initializing: sample_rate=%lu n_channels=%lu bitrate=%lu",
+            (unsigned long)sample_rate_, (unsigned long)n_chans_,
+            (unsigned long)bitrate_);
+
+    int err = OPUS_OK;
+    encoder_ = opus_encoder_create((opus_int32)sample_rate_, (int)n_chans_,
+                                   OPUS_APPLICATION_AUDIO, &err);
+    if (err != OPUS_OK || !encoder_) {
+        roc_log(LogError, "opus encoder: opus_encoder_create(): [%d] %s", err,
+                opus_strerror(err));
+        return;
+    }
+
+    // constant bitrate makes frame size depend only on frame duration,
+    // which is required by encoded_byte_count()
+    if ((err = opus_encoder_ctl(encoder_, OPUS_SET_VBR(0))) != OPUS_OK
+        || (err = opus_encoder_ctl(encoder_, OPUS_SET_BITRATE((opus_int32)bitrate_)))
+            != OPUS_OK) {
+        roc_log(LogError, "opus encoder: can't set bitrate: [%d] %s", err,
+                opus_strerror(err));
+        return;
+    }
+
+    if ((err = opus_encoder_ctl(encoder_, OPUS_SET_INBAND_FEC(1))) != OPUS_OK
+        || (err = opus_encoder_ctl(encoder_, OPUS_SET_PACKET_LOSS_PERC(LossPercentage)))
+            != OPUS_OK) {
+        roc_log(LogError, "opus encoder: can't enable in-band fec: [%d] %s", err,
+                opus_strerror(err));
+        return;
+    }
+
+    valid_ = true;
+}
+
+OpusEncoder::~OpusEncoder() {
+    if (encoder_) {
+        opus_encoder_destroy(encoder_);
+    }
+}
+
+bool OpusEncoder::valid() const {
+    return valid_;
+}
+
+size_t OpusEncoder::encoded_byte_count(size_t num_samples) const {
+    const size_t frame_length = frame_length_(num_samples);
+    if (frame_length == 0) {
+        return 0;
+    }
+
+    return std::min(bitrate_ * frame_length / (sample_rate_ * 8), MaxPacketBytes);
+}
+
+void OpusEncoder::begin(void* frame_data, size_t frame_size) {
+    roc_panic_if_not(frame_data);
+
+    if (frame_data_) {
+        roc_panic("opus encoder: unpaired begin/end");
+    }
+
+    frame_data_ = frame_data;
+    frame_size_ = frame_size;
+    n_samples_ = 0;
+}
+
+size_t OpusEncoder::write(const sample_t* samples, size_t n_samples) {
+    if (!frame_data_) {
+        roc_panic("opus encoder: write should be called only between begin/end");
+    }
+
+    n_samples = std::min(n_samples, (size_t)MaxFrameSamples - n_samples_);
+
+    memcpy(buffer_ + n_samples_ * n_chans_, samples,
+           n_samples * n_chans_ * sizeof(sample_t));
+
+    n_samples_ += n_samples;
+
+    return n_samples;
+}
+
+void OpusEncoder::end() {
+    if (!frame_data_) {
+        roc_panic("opus encoder: unpaired begin/end");
+    }
+
+    const size_t frame_length = frame_length_(n_samples_);
+    const size_t frame_size = std::min(encoded_byte_count(n_samples_), frame_size_);
+
+    if (valid_ && frame_length != 0 && frame_size != 0) {
+        memset(buffer_ + n_samples_ * n_chans_, 0,
+               (frame_length - n_samples_) * n_chans_ * sizeof(sample_t));
+
+        unsigned char* data = (unsigned char*)frame_data_;
+
+        int ret = opus_encode_float(encoder_, buffer_, (int)frame_length, data,
+                                    (opus_int32)frame_size);
+        if (ret < 0) {
+            roc_log(LogError, "opus encoder: opus_encode_float(): [%d] %s", ret,
+                    opus_strerror(ret));
+            memset(data, 0, frame_size);
+        } else if ((size_t)ret < frame_size) {
+            // packetizer expects exactly encoded_byte_count() bytes
+            if ((ret = opus_packet_pad(data, ret, (opus_int32)frame_size)) != OPUS_OK) {
+                roc_log(LogError, "opus encoder: opus_packet_pad(): [%d] %s", ret,
+                        opus_strerror(ret));
+            }
+        }
+    }
+
+    frame_data_ = NULL;
+    frame_size_ = 0;
+    n_samples_ = 0;
+}
+
+// get nearest supported frame duration, in samples per channel
+size_t OpusEncoder::frame_length_(size_t num_samples) const {
+    const size_t unit = sample_rate_ / 400;
+
+    if (num_samples == 0) {
+        return 0;
+    }
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(FrameDurations); n++) {
+        if (num_samples <= FrameDurations[n] * unit) {
+            return FrameDurations[n] * unit;
+        }
+    }
+
+    return 0;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/target_opus/roc_audio/opus_encoder.h
+//! @brief Opus encoder.
+
+#ifndef ROC_AUDIO_OPUS_ENCODER_H_
+#define ROC_AUDIO_OPUS_ENCODER_H_
+
+#include "roc_audio/iframe_encoder.h"
+#include "roc_audio/sample.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+#include <opus/opus.h>
+
+namespace roc {
+namespace audio {
+
+//! Opus encoder.
+//!
+//! Encodes every frame into a single Opus packet. Frames are encoded with
+//! constant bitrate, so that the frame size depends only on its duration.
+//! Opus supports frame durations of 2.5, 5, 10, 20, 40, and 60 ms; shorter
+//! frames are padded with silence up to the nearest supported duration.
+//!
+//! Every packet also carries in-band FEC data for the previous frame, which
+//! is used by OpusDecoder to restore a lost packet. In-band FEC is produced
+//! only in SILK and hybrid modes, i.e. for frames of 10 ms and longer.
+class OpusEncoder : public IFrameEncoder, public core::NonCopyable<> {
+public:
+    //! Default bitrate, bits per second.
+    enum { DefaultBitrate = 96000 };
+
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p sample_spec defines sample rate and channels of encoded frames;
+    //!    sample rate should be one of 8000, 12000, 16000, 24000, or 48000,
+    //!    and there should be one or two channels
+    //!  - @p bitrate defines encoded bitrate in bits per second
+    explicit OpusEncoder(const SampleSpec& sample_spec, size_t bitrate = DefaultBitrate);
+
+    ~OpusEncoder();
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get encoded frame size in bytes for given number of samples per channel.
+    //! @remarks
+    //!  Returns zero if the number of samples is zero or exceeds maximum Opus
+    //!  frame duration.
+    virtual size_t encoded_byte_count(size_t num_samples) const;
+
+    //! Start encoding a new frame.
+    virtual void begin(void* frame, size_t frame_size);
+
+    //! Encode samples.
+    virtual size_t write(const sample_t* samples, size_t n_samples);
+
+    //! Finish encoding frame.
+    virtual void end();
+
+private:
+    enum {
+        MaxChannels = 2,
+
+        // 60 ms at 48000 Hz
+        MaxFrameSamples = 2880
+    };
+
+    size_t frame_length_(size_t num_samples) const;
+
+    ::OpusEncoder* encoder_;
+
+    const size_t sample_rate_;
+    const size_t n_chans_;
+    const size_t bitrate_;
+
+    void* frame_data_;
+    size_t frame_size_;
+
+    // samples of current frame, encoded all at once in end()
+    sample_t buffer_[MaxFrameSamples * MaxChannels];
+    size_t n_samples_;
+
+    bool valid_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_OPUS_ENCODER_H_
@@ -18,6 +18,16 @@ namespace {
 
 const core::nanoseconds_t LogReportInterval = 20 * core::Second;
 
+// Maximum possible precision for reasanoble rate and scaling values.
+// Not ideal, but larger precision will cause overflow error in speex.
+const spx_uint32_t RatioPrecision = 50000;
+
+// Changes of ratio numerator not exceeding this number of quantization steps
+// are ignored. Every accepted change makes speex rebuild its filter, which is
+// expensive, and without hysteresis scaling jittering around step boundary
+// would trigger rebuild on almost every frame.
+const spx_uint32_t RatioHysteresis = 1;
+
 inline const char* get_error_msg(int err) {
     if (err == 5) {
         return "Ratio overflow.";
@@ -51,6 +61,10 @@ SpeexResampler::SpeexResampler(core::IAllocator&,
     , in_frame_size_((spx_uint32_t)sample_spec.ns_2_samples_overall(frame_length))
     , in_frame_pos_(in_frame_size_)
     , num_ch_((spx_uint32_t)sample_spec.num_channels())
+    , ratio_num_(0)
+    , ratio_den_(0)
+    , num_updates_(0)
+    , num_skipped_updates_(0)
     , rate_limiter_(LogReportInterval)
     , valid_(false) {
     if (num_ch_ == 0 || in_frame_size_ == 0) {
@@ -94,30 +108,36 @@ bool SpeexResampler::valid() const {
 }
 
 bool SpeexResampler::set_scaling(size_t input_rate, size_t output_rate, float mult) {
-    // Maximum possible precision for reasanoble rate and scaling values.
-    // Not ideal, but larger precision will cause overflow error in speex.
-    enum { Precision = 50000 };
-
     if (input_rate == 0 || output_rate == 0) {
         roc_log(LogError, "speex resampler: invalid rate");
         return false;
     }
 
-    if (mult <= 0 || mult > (0xffffffff / Precision)) {
+    if (mult <= 0 || mult > (0xffffffff / RatioPrecision)) {
         roc_log(LogError, "speex resampler: invalid scaling");
         return false;
     }
 
-    const spx_uint32_t ratio_num = spx_uint32_t(mult * Precision);
+    const spx_uint32_t ratio_num = spx_uint32_t(mult * RatioPrecision);
 
     const spx_uint32_t ratio_den =
-        spx_uint32_t(float(output_rate) / float(input_rate) * Precision);
+        spx_uint32_t(float(output_rate) / float(input_rate) * RatioPrecision);
 
     if (ratio_num == 0 || ratio_den == 0) {
         roc_log(LogError, "speex resampler: invalid scaling");
         return false;
     }
 
+    if (ratio_den == ratio_den_) {
+        const spx_uint32_t num_delta =
+            ratio_num > ratio_num_ ? ratio_num - ratio_num_ : ratio_num_ - ratio_num;
+
+        if (num_delta <= RatioHysteresis) {
+            num_skipped_updates_++;
+            return true;
+        }
+    }
+
     const int err = speex_resampler_set_rate_frac(speex_state_, ratio_num, ratio_den,
                                                   spx_uint32_t(float(input_rate) * mult),
                                                   spx_uint32_t(output_rate));
@@ -130,6 +150,26 @@ bool SpeexResampler::set_scaling(size_t input_rate, size_t output_rate, float mu
         return false;
     }
 
+    ratio_num_ = ratio_num;
+    ratio_den_ = ratio_den;
+    num_updates_++;
+
+    return true;
+}
+
+bool SpeexResampler::set_profile(ResamplerProfile profile) {
+    const int quality = get_quality(profile);
+
+    const int err = speex_resampler_set_quality(speex_state_, quality);
+
+    if (err != RESAMPLER_ERR_SUCCESS) {
+        roc_log(LogError, "speex resampler: speex_resampler_set_quality(%d): [%d] %s",
+                quality, err, get_error_msg(err));
+        return false;
+    }
+
+    roc_log(LogDebug, "speex resampler: switched profile: quality=%d", quality);
+
     return true;
 }
 
@@ -202,9 +242,11 @@ void SpeexResampler::report_stats_() {
     roc_log(
         LogDebug,
         "speex resampler:"
-        " ratio_num=%u ratio_den=%u in_rate=%u out_rate=%u in_latency=%d out_latency=%d",
+        " ratio_num=%u ratio_den=%u in_rate=%u out_rate=%u in_latency=%d out_latency=%d"
+        " rate_updates=%lu skipped_updates=%lu",
         (unsigned int)ratio_num, (unsigned int)ratio_den, (unsigned int)in_rate,
-        (unsigned int)out_rate, (int)in_latency, (int)out_latency);
+        (unsigned int)out_rate, (int)in_latency, (int)out_latency,
+        (unsigned long)num_updates_, (unsigned long)num_skipped_updates_);
 }
 
 } // namespace audio
@@ -47,8 +47,16 @@ public:
     virtual bool valid() const;
 
     //! Set new resample factor.
+    //! @remarks
+    //!  Changes smaller than one quantization step of speex ratio are ignored,
+    //!  since every accepted change rebuilds speex filter.
     virtual bool set_scaling(size_t input_rate, size_t output_rate, float multiplier);
 
+    //! Switch to another quality profile.
+    //! @remarks
+    //!  Changes speex quality, which rebuilds speex filter.
+    virtual bool set_profile(ResamplerProfile profile);
+
     //! Get buffer to be filled with input data.
     virtual const core::Slice<sample_t>& begin_push_input();
 
@@ -69,6 +77,12 @@ private:
 
     const spx_uint32_t num_ch_;
 
+    spx_uint32_t ratio_num_;
+    spx_uint32_t ratio_den_;
+
+    size_t num_updates_;
+    size_t num_skipped_updates_;
+
     core::RateLimiter rate_limiter_;
 
     bool valid_;
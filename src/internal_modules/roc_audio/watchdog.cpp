@@ -117,6 +117,10 @@ bool Watchdog::update() {
     return true;
 }
 
+bool Watchdog::alive() const {
+    return alive_;
+}
+
 void Watchdog::update_blank_timeout_(const Frame& frame,
                                      packet::timestamp_t next_read_pos) {
     if (max_blank_duration_ == 0) {
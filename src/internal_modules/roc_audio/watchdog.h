@@ -86,6 +86,12 @@ public:
     //!  filled and contain dropped packets was exceeded.
     bool update();
 
+    //! Check if stream is still considered alive.
+    //! @remarks
+    //!  Becomes false when one of the timeouts expires and never becomes
+    //!  true again.
+    bool alive() const;
+
 private:
     void update_blank_timeout_(const Frame& frame, packet::timestamp_t next_read_pos);
     bool check_blank_timeout_() const;
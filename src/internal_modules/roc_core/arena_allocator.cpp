@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/arena_allocator.h"
+#include "roc_core/align_ops.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+ArenaAllocator::ArenaAllocator(IAllocator& allocator, size_t size)
+    : allocator_(allocator)
+    , data_(NULL)
+    , size_(0)
+    , offset_(0)
+    , num_allocations_(0)
+    , num_overflows_(0) {
+    if (size == 0) {
+        return;
+    }
+
+    size = AlignOps::align_max(size);
+
+    data_ = (char*)allocator_.allocate(size);
+    if (!data_) {
+        roc_log(LogError, "arena allocator: can't allocate arena: size=%lu",
+                (unsigned long)size);
+        return;
+    }
+
+    size_ = size;
+}
+
+ArenaAllocator::~ArenaAllocator() {
+    if (num_allocations_ != 0) {
+        roc_panic("arena allocator: detected leak: blocks=%lu",
+                  (unsigned long)num_allocations_);
+    }
+
+    if (data_) {
+        allocator_.deallocate(data_);
+    }
+}
+
+size_t ArenaAllocator::capacity() const {
+    return size_;
+}
+
+size_t ArenaAllocator::used_bytes() const {
+    Mutex::Lock lock(mutex_);
+
+    return offset_;
+}
+
+size_t ArenaAllocator::num_overflows() const {
+    Mutex::Lock lock(mutex_);
+
+    return num_overflows_;
+}
+
+void* ArenaAllocator::allocate(size_t size) {
+    // zero-sized blocks still get a unique address inside arena
+    const size_t aligned_size = AlignOps::align_max(size != 0 ? size : 1);
+
+    {
+        Mutex::Lock lock(mutex_);
+
+        if (aligned_size >= size && aligned_size <= size_ - offset_) {
+            void* ptr = data_ + offset_;
+
+            offset_ += aligned_size;
+            num_allocations_++;
+
+            return ptr;
+        }
+
+        if (data_) {
+            num_overflows_++;
+        }
+    }
+
+    return allocator_.allocate(size);
+}
+
+void ArenaAllocator::deallocate(void* ptr) {
+    if (ptr == NULL) {
+        roc_panic("arena allocator: deallocating null pointer");
+    }
+
+    if (!owns_(ptr)) {
+        allocator_.deallocate(ptr);
+        return;
+    }
+
+    Mutex::Lock lock(mutex_);
+
+    if (num_allocations_ == 0) {
+        roc_panic("arena allocator: unpaired deallocate");
+    }
+
+    if (--num_allocations_ == 0) {
+        // everything was released, arena can be reused from the beginning
+        offset_ = 0;
+    }
+}
+
+bool ArenaAllocator::owns_(void* ptr) const {
+    return data_ && (char*)ptr >= data_ && (char*)ptr < data_ + size_;
+}
+
+} // namespace core
+} // namespace roc
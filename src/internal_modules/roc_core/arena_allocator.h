@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/arena_allocator.h
+//! @brief Arena allocator.
+
+#ifndef ROC_CORE_ARENA_ALLOCATOR_H_
+#define ROC_CORE_ARENA_ALLOCATOR_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Arena allocator.
+//!
+//! Allocates a single block of fixed size from another allocator during
+//! construction and serves allocations from it by bumping a pointer. Objects
+//! allocated from arena are laid out contiguously, and the whole block is
+//! returned to the underlying allocator at once in destructor.
+//!
+//! Deallocating memory from arena doesn't make it available for reuse, until
+//! all allocations from arena are deallocated. When arena is exhausted, or
+//! its block couldn't be allocated, requests are forwarded to the underlying
+//! allocator, so that arena never causes allocation failures by itself.
+//!
+//! Intended for groups of objects which are created and destroyed together,
+//! e.g. components of a pipeline session.
+//!
+//! The returned memory is always maximum aligned. Thread-safe.
+class ArenaAllocator : public IAllocator, public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Allocates @p size bytes from @p allocator. Zero size disables arena,
+    //!  and all requests are forwarded to @p allocator.
+    ArenaAllocator(IAllocator& allocator, size_t size);
+
+    //! Deinitialize.
+    //! @remarks
+    //!  All memory allocated from arena should be deallocated at this point.
+    ~ArenaAllocator();
+
+    //! Get arena size in bytes.
+    size_t capacity() const;
+
+    //! Get number of arena bytes currently occupied.
+    size_t used_bytes() const;
+
+    //! Get number of allocations forwarded to the underlying allocator
+    //! because arena was exhausted.
+    size_t num_overflows() const;
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void*);
+
+private:
+    bool owns_(void* ptr) const;
+
+    IAllocator& allocator_;
+
+    mutable Mutex mutex_;
+
+    char* data_;
+    size_t size_;
+    size_t offset_;
+
+    size_t num_allocations_;
+    size_t num_overflows_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_ARENA_ALLOCATOR_H_
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/async_log_writer.h"
+#include "roc_core/atomic_ops.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+// Background thread wakes up at least this often, in case it missed a wakeup.
+const nanoseconds_t PollInterval = 100 * Millisecond;
+
+} // namespace
+
+AsyncLogWriter::AsyncLogWriter(Handler handler, void* handler_arg)
+    : handler_(handler)
+    , handler_arg_(handler_arg)
+    , alloc_owner_(0)
+    , total_drops_(0)
+    , waiting_(false)
+    , stop_(false) {
+    roc_panic_if_not(handler);
+
+    for (size_t n = 0; n < MaxRings; n++) {
+        rings_[n] = NULL;
+        ring_locks_[n] = 0;
+        drops_[n] = 0;
+    }
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    stop_writer();
+
+    for (size_t n = 0; n < MaxRings; n++) {
+        if (rings_[n]) {
+            allocator_.destroy_object(*rings_[n]);
+        }
+    }
+}
+
+bool AsyncLogWriter::start_writer() {
+    if (joinable()) {
+        return true;
+    }
+
+    stop_ = false;
+
+    return start();
+}
+
+void AsyncLogWriter::stop_writer() {
+    if (!joinable()) {
+        return;
+    }
+
+    stop_ = true;
+
+    if (waiting_.compare_exchange(true, false)) {
+        wakeup_sem_.post();
+    }
+
+    join();
+}
+
+bool AsyncLogWriter::push(const AsyncLogRecord& record) {
+    const size_t thread_index = Thread::get_index();
+    const size_t index = thread_index % MaxRings;
+
+    SpscRingBuffer<AsyncLogRecord>* ring = get_ring_(index, thread_index);
+    if (!ring) {
+        return false;
+    }
+
+    // Threads with the same index modulo MaxRings share a ring, so producer
+    // side of the ring is serialized. There is no contention unless there
+    // are more than MaxRings threads logging at the same time.
+    while (AtomicOps::exchange_acquire(ring_locks_[index], 1) != 0) {
+    }
+
+    const bool written = ring->write(&record, 1) == 1;
+
+    AtomicOps::store_release(ring_locks_[index], 0);
+
+    if (!written) {
+        AtomicOps::fetch_add_relaxed(drops_[index], (size_t)1);
+        return true;
+    }
+
+    if (waiting_.compare_exchange(true, false)) {
+        wakeup_sem_.post();
+    }
+
+    return true;
+}
+
+size_t AsyncLogWriter::num_drops() const {
+    return total_drops_;
+}
+
+void AsyncLogWriter::run() {
+    for (;;) {
+        if (drain_()) {
+            continue;
+        }
+
+        // exit only when all rings are drained
+        if (stop_) {
+            break;
+        }
+
+        waiting_ = true;
+        if (!drain_() && !stop_) {
+            (void)wakeup_sem_.timed_wait(timestamp(ClockMonotonic) + PollInterval);
+        }
+        waiting_ = false;
+    }
+}
+
+SpscRingBuffer<AsyncLogRecord>* AsyncLogWriter::get_ring_(size_t index,
+                                                          size_t thread_index) {
+    SpscRingBuffer<AsyncLogRecord>* ring = AtomicOps::load_acquire(rings_[index]);
+    if (ring) {
+        return ring;
+    }
+
+    // First message to this ring. Ring allocation may log itself, which would
+    // recurse here; such messages are handled synchronously.
+    if (AtomicOps::load_relaxed(alloc_owner_) == thread_index + 1) {
+        return NULL;
+    }
+
+    alloc_mutex_.lock();
+    AtomicOps::store_relaxed(alloc_owner_, thread_index + 1);
+
+    ring = AtomicOps::load_acquire(rings_[index]);
+
+    if (!ring) {
+        ring = new (allocator_) SpscRingBuffer<AsyncLogRecord>(allocator_, RingSize);
+
+        if (ring && !ring->valid()) {
+            allocator_.destroy_object(*ring);
+            ring = NULL;
+        }
+
+        if (ring) {
+            AtomicOps::store_release(rings_[index], ring);
+        }
+    }
+
+    AtomicOps::store_relaxed(alloc_owner_, (size_t)0);
+    alloc_mutex_.unlock();
+
+    return ring;
+}
+
+bool AsyncLogWriter::drain_() {
+    bool drained = false;
+
+    for (size_t index = 0; index < MaxRings; index++) {
+        SpscRingBuffer<AsyncLogRecord>* ring = AtomicOps::load_acquire(rings_[index]);
+        if (!ring) {
+            continue;
+        }
+
+        AsyncLogRecord record;
+
+        while (ring->read(&record, 1) == 1) {
+            handler_(record, handler_arg_);
+            drained = true;
+        }
+
+        const size_t n_drops = AtomicOps::exchange_relaxed(drops_[index], (size_t)0);
+        if (n_drops != 0) {
+            report_drops_(index, n_drops);
+            drained = true;
+        }
+    }
+
+    return drained;
+}
+
+void AsyncLogWriter::report_drops_(size_t index, size_t n_drops) {
+    total_drops_ += n_drops;
+
+    AsyncLogRecord record;
+    memset(&record, 0, sizeof(record));
+
+    record.level = LogError;
+    record.module = "roc_core";
+    record.file = __FILE__;
+    record.line = __LINE__;
+    record.time = timestamp(ClockUnix);
+    record.pid = Thread::get_pid();
+    record.tid = Thread::get_tid();
+
+    snprintf(record.text, sizeof(record.text) - 1,
+             "async log writer: log ring overflow, dropped messages:"
+             " thread_index=%lu n_dropped=%lu n_total_dropped=%lu",
+             (unsigned long)index, (unsigned long)n_drops,
+             (unsigned long)(size_t)total_drops_);
+
+    handler_(record, handler_arg_);
+}
+
+} // namespace core
+} // namespace roc
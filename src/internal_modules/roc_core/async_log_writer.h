@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/async_log_writer.h
+//! @brief Asynchronous log writer.
+
+#ifndef ROC_CORE_ASYNC_LOG_WRITER_H_
+#define ROC_CORE_ASYNC_LOG_WRITER_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/spsc_ring_buffer.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+//! Log record passed from logging thread to background thread.
+//! @remarks
+//!  Text is already formatted. Module and file are static strings.
+struct AsyncLogRecord {
+    LogLevel level;     //!< Logging level.
+    const char* module; //!< Module name.
+    const char* file;   //!< File path.
+    int line;           //!< Line number.
+    nanoseconds_t time; //!< Timestamp, nanoseconds since Unix epoch.
+    uint64_t pid;       //!< Process ID.
+    uint64_t tid;       //!< Thread ID.
+    char text[256];     //!< Message text.
+};
+
+//! Asynchronous log writer.
+//!
+//! Every thread that logs gets its own lock-free SPSC ring of records, selected
+//! by Thread::get_index() modulo number of rings. Logging thread only copies
+//! record into its ring and never blocks or performs I/O, except when the ring
+//! is allocated on the first message to it. If there are more threads than
+//! rings, threads sharing a ring serialize on a per-ring spinlock. Background
+//! thread drains all rings and passes records to the logger, which invokes log
+//! handler.
+//!
+//! If a ring is full, the record is dropped and per-ring drop counter is
+//! incremented. Background thread reports number of dropped records.
+class AsyncLogWriter : public Thread {
+public:
+    //! Handler invoked on background thread for every record.
+    typedef void (*Handler)(const AsyncLogRecord& record, void* arg);
+
+    //! Initialize.
+    AsyncLogWriter(Handler handler, void* handler_arg);
+
+    virtual ~AsyncLogWriter();
+
+    //! Start background thread.
+    bool start_writer();
+
+    //! Stop background thread.
+    //! @remarks
+    //!  Handles all pending records before returning.
+    void stop_writer();
+
+    //! Put record into current thread ring.
+    //! @returns
+    //!  false if the record can't be handled asynchronously, because ring
+    //!  allocation failed; the caller should handle it synchronously then.
+    //!  If the ring is full, record is dropped and true is returned.
+    bool push(const AsyncLogRecord& record);
+
+    //! Get total number of dropped records.
+    size_t num_drops() const;
+
+private:
+    enum { MaxRings = 64, RingSize = 128 };
+
+    virtual void run();
+
+    SpscRingBuffer<AsyncLogRecord>* get_ring_(size_t index, size_t thread_index);
+
+    bool drain_();
+    void report_drops_(size_t index, size_t n_drops);
+
+    const Handler handler_;
+    void* const handler_arg_;
+
+    HeapAllocator allocator_;
+    Mutex alloc_mutex_;
+
+    // index of thread holding alloc_mutex_ plus one, zero if none;
+    // accessed using AtomicOps
+    size_t alloc_owner_;
+
+    // accessed using AtomicOps; rings are never freed, since logging threads
+    // may use them at any moment
+    SpscRingBuffer<AsyncLogRecord>* rings_[MaxRings];
+    int ring_locks_[MaxRings];
+    size_t drops_[MaxRings];
+    Atomic<size_t> total_drops_;
+
+    Semaphore wakeup_sem_;
+    Atomic<int> waiting_;
+    Atomic<int> stop_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_ASYNC_LOG_WRITER_H_
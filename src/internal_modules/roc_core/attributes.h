@@ -66,4 +66,10 @@
 #define ROC_ATTR_NO_SANITIZE_UB
 #endif
 
+#if HEDLEY_HAS_ATTRIBUTE(target)
+//! Compile function for given instruction set, e.g. "avx2".
+//! Caller is responsible to check at run time that CPU supports it.
+#define ROC_ATTR_TARGET(isa) __attribute__((target(isa)))
+#endif
+
 #endif // ROC_CORE_ATTRIBUTES_H_
@@ -12,8 +12,10 @@
 #ifndef ROC_CORE_BUFFER_FACTORY_H_
 #define ROC_CORE_BUFFER_FACTORY_H_
 
+#include "roc_core/align_ops.h"
 #include "roc_core/allocation_policy.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
 #include "roc_core/shared_ptr.h"
 #include "roc_core/slab_pool.h"
 
@@ -26,9 +28,23 @@ template <class T> class Buffer;
 template <class T> class BufferFactory : public core::NonCopyable<> {
 public:
     //! Initialization.
-    BufferFactory(IAllocator& allocator, size_t buff_size, bool poison)
-        : pool_(allocator, sizeof(Buffer<T>) + sizeof(T) * buff_size, poison)
-        , buff_size_(buff_size) {
+    //! @remarks
+    //!  If @p header_size is non-zero, every buffer is preceded by a header of
+    //!  the given size, allocated in the same memory chunk. The header can be
+    //!  used by the caller to co-allocate an object tied to the buffer.
+    BufferFactory(IAllocator& allocator,
+                  size_t buff_size,
+                  bool poison,
+                  size_t header_size = 0)
+        : pool_(allocator,
+                AlignOps::align_max(header_size) + sizeof(Buffer<T>)
+                    + sizeof(T) * buff_size,
+                poison,
+                0,
+                0,
+                true)
+        , buff_size_(buff_size)
+        , header_size_(AlignOps::align_max(header_size)) {
     }
 
     //! Get buffer size (number of elements in buffer).
@@ -36,20 +52,73 @@ public:
         return buff_size_;
     }
 
+    //! Preallocate memory for given number of buffers.
+    //! @returns
+    //!  false if allocation failed.
+    bool reserve(size_t n_buffers) {
+        return pool_.reserve(n_buffers);
+    }
+
+    //! Limit total number of buffers.
+    //! @remarks
+    //!  Zero means no limit. See SlabPool::set_limit().
+    void set_limit(size_t max_buffers) {
+        pool_.set_limit(max_buffers);
+    }
+
+    //! Get number of failed allocations.
+    size_t num_failed_allocations() const {
+        return pool_.num_failed_allocations();
+    }
+
+    //! Get statistics of underlying pool.
+    SlabPoolStats pool_stats() const {
+        return pool_.stats();
+    }
+
     //! Allocate new buffer.
     SharedPtr<Buffer<T> > new_buffer() {
-        return new (pool_) Buffer<T>(*this);
+        if (header_size_ == 0) {
+            return new (pool_) Buffer<T>(*this);
+        }
+
+        void* memory = pool_.allocate();
+        if (!memory) {
+            return NULL;
+        }
+
+        return new ((char*)memory + header_size_) Buffer<T>(*this);
+    }
+
+    //! Get header preceding buffer.
+    //! @remarks
+    //!  Header memory is valid until the buffer is destroyed.
+    //! @pre
+    //!  Factory should be constructed with non-zero header size, and @p buffer
+    //!  should be allocated by this factory.
+    void* buffer_header(Buffer<T>& buffer) const {
+        roc_panic_if_not(header_size_ != 0);
+        return (char*)&buffer - header_size_;
     }
 
 private:
     friend class FactoryAllocation<BufferFactory>;
 
     void destroy(Buffer<T>& buffer) {
-        pool_.destroy_object(buffer);
+        if (header_size_ == 0) {
+            pool_.destroy_object(buffer);
+            return;
+        }
+
+        void* memory = buffer_header(buffer);
+
+        buffer.~Buffer<T>();
+        pool_.deallocate(memory);
     }
 
     SlabPool pool_;
     size_t buff_size_;
+    size_t header_size_;
 };
 
 } // namespace core
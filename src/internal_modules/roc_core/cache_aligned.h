@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/cache_aligned.h
+//! @brief Cache line padding.
+
+#ifndef ROC_CORE_CACHE_ALIGNED_H_
+#define ROC_CORE_CACHE_ALIGNED_H_
+
+#include "roc_core/cpu_traits.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Cache line size, in bytes.
+const size_t CacheLineSize = ROC_CPU_CACHE_LINE;
+
+//! Padding of cache line size.
+//! @remarks
+//!  Placed between fields to ensure that fields before and after it never
+//!  share a cache line, e.g. when they are written by different threads.
+struct CachePadding {
+    //! Padding bytes.
+    char data[ROC_CPU_CACHE_LINE];
+
+    CachePadding() {
+    }
+};
+
+//! Object occupying its own cache line.
+//!
+//! Wraps an object and surrounds it with padding of cache line size, so that
+//! it never shares a cache line with neighbour fields or objects, regardless
+//! of alignment of the enclosing object. Used for hot variables written by
+//! different threads, to avoid false sharing.
+//!
+//! The object is accessed using operator* and operator->.
+//!
+//! @tparam T defines object type.
+template <class T> class CacheAligned : public NonCopyable<> {
+public:
+    //! Initialize object with default constructor.
+    CacheAligned()
+        : storage_() {
+    }
+
+    //! Initialize object with constructor taking one argument.
+    template <class Arg>
+    explicit CacheAligned(const Arg& arg)
+        : storage_(arg) {
+    }
+
+    //! Get object.
+    T& operator*() {
+        return storage_.value;
+    }
+
+    //! Get object.
+    const T& operator*() const {
+        return storage_.value;
+    }
+
+    //! Get object.
+    T* operator->() {
+        return &storage_.value;
+    }
+
+    //! Get object.
+    const T* operator->() const {
+        return &storage_.value;
+    }
+
+private:
+    struct Storage {
+        CachePadding pad_before;
+        T value;
+        CachePadding pad_after;
+
+        Storage()
+            : value() {
+        }
+
+        template <class Arg>
+        explicit Storage(const Arg& arg)
+            : value(arg) {
+        }
+    };
+
+    Storage storage_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CACHE_ALIGNED_H_
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/caching_allocator.h"
+#include "roc_core/align_ops.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+CachingAllocator::CachingAllocator(IAllocator& allocator,
+                                   size_t block_size,
+                                   size_t max_blocks)
+    : allocator_(allocator)
+    , header_size_(AlignOps::align_max(sizeof(Header)))
+    , block_size_(block_size)
+    , max_blocks_(block_size != 0 ? max_blocks : 0)
+    , cached_(NULL)
+    , num_cached_(0) {
+}
+
+CachingAllocator::~CachingAllocator() {
+    release_cached();
+}
+
+size_t CachingAllocator::num_cached() const {
+    Mutex::Lock lock(mutex_);
+
+    return num_cached_;
+}
+
+void CachingAllocator::release_cached() {
+    Header* cached = NULL;
+
+    {
+        Mutex::Lock lock(mutex_);
+
+        cached = cached_;
+        cached_ = NULL;
+        num_cached_ = 0;
+    }
+
+    while (cached) {
+        Header* next = cached->next;
+        allocator_.deallocate(cached);
+        cached = next;
+    }
+}
+
+void* CachingAllocator::allocate(size_t size) {
+    Header* header = NULL;
+
+    if (size == block_size_ && max_blocks_ != 0) {
+        Mutex::Lock lock(mutex_);
+
+        if ((header = cached_)) {
+            cached_ = header->next;
+            num_cached_--;
+        }
+    }
+
+    if (!header) {
+        header = (Header*)allocator_.allocate(header_size_ + size);
+    }
+
+    if (!header && num_cached() != 0) {
+        // memory pressure, give cached blocks back and retry
+        release_cached();
+        header = (Header*)allocator_.allocate(header_size_ + size);
+    }
+
+    if (!header) {
+        return NULL;
+    }
+
+    header->size = size;
+    header->next = NULL;
+
+    return (char*)header + header_size_;
+}
+
+void CachingAllocator::deallocate(void* ptr) {
+    if (ptr == NULL) {
+        roc_panic("caching allocator: deallocating null pointer");
+    }
+
+    Header* header = (Header*)((char*)ptr - header_size_);
+
+    if (header->size == block_size_ && max_blocks_ != 0) {
+        Mutex::Lock lock(mutex_);
+
+        if (num_cached_ < max_blocks_) {
+            header->next = cached_;
+            cached_ = header;
+            num_cached_++;
+            return;
+        }
+    }
+
+    allocator_.deallocate(header);
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/caching_allocator.h
+//! @brief Caching allocator.
+
+#ifndef ROC_CORE_CACHING_ALLOCATOR_H_
+#define ROC_CORE_CACHING_ALLOCATOR_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Caching allocator.
+//!
+//! Forwards requests to another allocator, but instead of deallocating blocks
+//! of one particular size, keeps up to a given number of them and reuses them
+//! for subsequent allocations of the same size. Blocks of other sizes are
+//! forwarded as is.
+//!
+//! Intended for large blocks that are repeatedly allocated and deallocated,
+//! e.g. memory arenas of pipeline sessions, which come and go when senders
+//! reconnect.
+//!
+//! If the underlying allocator fails, cached blocks are released and the
+//! request is retried, so that cache never causes allocation failures by
+//! itself. The rest of cached blocks are released in destructor.
+//!
+//! The returned memory is always maximum aligned. Thread-safe.
+class CachingAllocator : public IAllocator, public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Caches up to @p max_blocks deallocated blocks of @p block_size bytes.
+    //!  If either is zero, caching is disabled.
+    CachingAllocator(IAllocator& allocator, size_t block_size, size_t max_blocks);
+
+    //! Deinitialize.
+    //! @remarks
+    //!  Releases cached blocks.
+    ~CachingAllocator();
+
+    //! Get number of blocks currently kept in cache.
+    size_t num_cached() const;
+
+    //! Return cached blocks to the underlying allocator.
+    void release_cached();
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void*);
+
+private:
+    struct Header {
+        size_t size;
+        Header* next;
+    };
+
+    IAllocator& allocator_;
+
+    const size_t header_size_;
+    const size_t block_size_;
+    const size_t max_blocks_;
+
+    mutable Mutex mutex_;
+
+    Header* cached_;
+    size_t num_cached_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CACHING_ALLOCATOR_H_
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/counting_allocator.h"
+#include "roc_core/align_ops.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+CountingAllocator::CountingAllocator(IAllocator& allocator, size_t max_bytes)
+    : allocator_(allocator)
+    , header_size_(AlignOps::align_max(sizeof(size_t)))
+    , max_bytes_(max_bytes)
+    , num_allocations_(0)
+    , num_bytes_(0)
+    , peak_bytes_(0)
+    , total_allocations_(0)
+    , failed_allocations_(0)
+    , limited_allocations_(0) {
+}
+
+CountingAllocator::~CountingAllocator() {
+    if (num_allocations_ != 0) {
+        roc_panic("counting allocator: detected leak: blocks=%lu bytes=%lu",
+                  (unsigned long)num_allocations_, (unsigned long)num_bytes_);
+    }
+}
+
+AllocationStats CountingAllocator::stats() const {
+    AllocationStats stats;
+
+    stats.num_allocations = num_allocations_;
+    stats.num_bytes = num_bytes_;
+    stats.peak_bytes = peak_bytes_;
+    stats.total_allocations = total_allocations_;
+    stats.failed_allocations = failed_allocations_;
+    stats.limited_allocations = limited_allocations_;
+
+    return stats;
+}
+
+void* CountingAllocator::allocate(size_t size) {
+    size_t num_bytes = 0;
+    if (!reserve_bytes_(size, num_bytes)) {
+        ++limited_allocations_;
+        return NULL;
+    }
+
+    void* memory = allocator_.allocate(header_size_ + size);
+    if (!memory) {
+        num_bytes_ -= size;
+        ++failed_allocations_;
+        return NULL;
+    }
+
+    *(size_t*)memory = size;
+
+    ++num_allocations_;
+    ++total_allocations_;
+    update_peak_(num_bytes);
+
+    return (char*)memory + header_size_;
+}
+
+void CountingAllocator::deallocate(void* ptr) {
+    if (ptr == NULL) {
+        roc_panic("counting allocator: deallocating null pointer");
+    }
+
+    void* memory = (char*)ptr - header_size_;
+    const size_t size = *(size_t*)memory;
+
+    if (num_allocations_ == 0) {
+        roc_panic("counting allocator: unpaired deallocate");
+    }
+
+    --num_allocations_;
+    num_bytes_ -= size;
+
+    allocator_.deallocate(memory);
+}
+
+bool CountingAllocator::reserve_bytes_(size_t size, size_t& num_bytes) {
+    if (max_bytes_ == 0) {
+        num_bytes = (num_bytes_ += size);
+        return true;
+    }
+
+    for (;;) {
+        const size_t prev_bytes = num_bytes_;
+        if (size > max_bytes_ || prev_bytes > max_bytes_ - size) {
+            return false;
+        }
+        if (num_bytes_.compare_exchange(prev_bytes, prev_bytes + size)) {
+            num_bytes = prev_bytes + size;
+            return true;
+        }
+    }
+}
+
+void CountingAllocator::update_peak_(size_t num_bytes) {
+    for (;;) {
+        const size_t peak_bytes = peak_bytes_;
+        if (num_bytes <= peak_bytes) {
+            break;
+        }
+        if (peak_bytes_.compare_exchange(peak_bytes, num_bytes)) {
+            break;
+        }
+    }
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/counting_allocator.h
+//! @brief Counting allocator.
+
+#ifndef ROC_CORE_COUNTING_ALLOCATOR_H_
+#define ROC_CORE_COUNTING_ALLOCATOR_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Allocation statistics.
+struct AllocationStats {
+    //! Number of currently allocated blocks.
+    size_t num_allocations;
+
+    //! Number of bytes in currently allocated blocks.
+    size_t num_bytes;
+
+    //! Maximum number of bytes allocated at the same time.
+    size_t peak_bytes;
+
+    //! Total number of successful allocations since creation.
+    size_t total_allocations;
+
+    //! Number of allocations failed by the underlying allocator.
+    size_t failed_allocations;
+
+    //! Number of allocations rejected because memory limit was reached.
+    size_t limited_allocations;
+
+    AllocationStats()
+        : num_allocations(0)
+        , num_bytes(0)
+        , peak_bytes(0)
+        , total_allocations(0)
+        , failed_allocations(0)
+        , limited_allocations(0) {
+    }
+};
+
+//! Counting allocator.
+//!
+//! Forwards requests to another allocator and keeps track of the number of
+//! allocated blocks and bytes. Each block is prepended with a small header
+//! holding its size, so that deallocations can be accounted as well.
+//!
+//! Optionally, total number of allocated bytes may be limited. Allocations that
+//! would exceed the limit fail without reaching the underlying allocator.
+//!
+//! The returned memory is always maximum aligned. Thread-safe.
+class CountingAllocator : public IAllocator, public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  All requests are forwarded to @p allocator. If @p max_bytes is non-zero,
+    //!  it specifies maximum number of bytes allocated at the same time.
+    explicit CountingAllocator(IAllocator& allocator, size_t max_bytes = 0);
+
+    //! Deinitialize.
+    ~CountingAllocator();
+
+    //! Get allocation statistics.
+    //! @remarks
+    //!  Counters are updated independently, so when there are concurrent
+    //!  allocations, returned values may be slightly inconsistent.
+    AllocationStats stats() const;
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void*);
+
+private:
+    bool reserve_bytes_(size_t size, size_t& num_bytes);
+    void update_peak_(size_t num_bytes);
+
+    IAllocator& allocator_;
+
+    const size_t header_size_;
+    const size_t max_bytes_;
+
+    Atomic<size_t> num_allocations_;
+    Atomic<size_t> num_bytes_;
+    Atomic<size_t> peak_bytes_;
+    Atomic<size_t> total_allocations_;
+    Atomic<size_t> failed_allocations_;
+    Atomic<size_t> limited_allocations_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_COUNTING_ALLOCATOR_H_
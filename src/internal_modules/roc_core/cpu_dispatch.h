@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/cpu_dispatch.h
+//! @brief CPU-specific function dispatch.
+
+#ifndef ROC_CORE_CPU_DISPATCH_H_
+#define ROC_CORE_CPU_DISPATCH_H_
+
+#include "roc_core/cpu_features.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Variant of function table for specific instruction set.
+//! @tparam Table is a struct of function pointers.
+template <class Table> struct CpuVariant {
+    //! Feature required by this variant.
+    CpuFeature feature;
+
+    //! Functions implemented using this feature.
+    Table table;
+};
+
+//! Select best variant for CPU we're running on.
+//! @remarks
+//!  @p variants is an array of @p n_variants elements, ordered from the most
+//!  preferred to the least preferred. The last variant should require
+//!  CpuFeature_Generic. Returns the first variant supported by CPU.
+template <class Table>
+const CpuVariant<Table>& cpu_select(const CpuVariant<Table>* variants,
+                                    size_t n_variants) {
+    roc_panic_if_msg(n_variants == 0, "cpu dispatch: no variants");
+
+    for (size_t n = 0; n < n_variants - 1; n++) {
+        if (cpu_supports(variants[n].feature)) {
+            return variants[n];
+        }
+    }
+
+    roc_panic_if_msg(variants[n_variants - 1].feature != CpuFeature_Generic,
+                     "cpu dispatch: last variant should be generic");
+
+    return variants[n_variants - 1];
+}
+
+//! Function table resolved once per process.
+//! @tparam Variants is a class with the following members:
+//!  - `Table`, type of the function table
+//!  - `static const char* name()`, name used in logs
+//!  - `static const CpuVariant<Table>* variants(size_t& n_variants)`, returns
+//!    array of variants suitable for cpu_select()
+//! @remarks
+//!  Variants are usually implemented in one translation unit using
+//!  ROC_ATTR_TARGET, which allows to compile every function for its own
+//!  instruction set without enabling that instruction set globally.
+template <class Variants> class CpuDispatch : public NonCopyable<> {
+public:
+    //! Function table type.
+    typedef typename Variants::Table Table;
+
+    //! Get function table for CPU we're running on.
+    static const Table& table() {
+        return Singleton<CpuDispatch>::instance().table_;
+    }
+
+private:
+    friend class Singleton<CpuDispatch>;
+
+    CpuDispatch() {
+        size_t n_variants = 0;
+        const CpuVariant<Table>* variants = Variants::variants(n_variants);
+
+        const CpuVariant<Table>& variant = cpu_select(variants, n_variants);
+        table_ = variant.table;
+
+        roc_log(LogDebug, "cpu dispatch: selected implementation: name=%s impl=%s",
+                Variants::name(), cpu_feature_to_str(variant.feature));
+    }
+
+    Table table_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CPU_DISPATCH_H_
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/cpu_features.h"
+#include "roc_core/singleton.h"
+
+#if ROC_CPU_FAMILY == ROC_CPU_FAMILY_X86 && defined(__GNUC__)
+#define ROC_CPU_FEATURES_CPUID
+#include <cpuid.h>
+#endif
+
+#if ROC_CPU_FAMILY == ROC_CPU_FAMILY_ARM && defined(__linux__) && !defined(__aarch64__)
+#define ROC_CPU_FEATURES_HWCAP
+#include <sys/auxv.h>
+#endif
+
+namespace roc {
+namespace core {
+
+namespace {
+
+#ifdef ROC_CPU_FEATURES_HWCAP
+// from <asm/hwcap.h>
+const unsigned long HwcapNeon = (1 << 12);
+#endif
+
+bool detect_feature(CpuFeature feature) {
+    switch (feature) {
+    case CpuFeature_Generic:
+        return true;
+
+    case CpuFeature_SSE2:
+#if defined(ROC_CPU_FEATURES_CPUID)
+        return __builtin_cpu_supports("sse2");
+#elif defined(__SSE2__)
+        return true;
+#else
+        return false;
+#endif
+
+    case CpuFeature_SSSE3:
+#if defined(ROC_CPU_FEATURES_CPUID)
+        return __builtin_cpu_supports("ssse3");
+#elif defined(__SSSE3__)
+        return true;
+#else
+        return false;
+#endif
+
+    case CpuFeature_AVX2:
+#if defined(ROC_CPU_FEATURES_CPUID)
+        return __builtin_cpu_supports("avx2");
+#elif defined(__AVX2__)
+        return true;
+#else
+        return false;
+#endif
+
+    case CpuFeature_NEON:
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        return true;
+#elif defined(ROC_CPU_FEATURES_HWCAP)
+        return (getauxval(AT_HWCAP) & HwcapNeon) != 0;
+#else
+        return false;
+#endif
+
+    case CpuFeature_InvariantTSC: {
+#if defined(ROC_CPU_FEATURES_CPUID)
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        // advanced power management leaf, bit 8 of edx
+        if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+            return false;
+        }
+        return (edx & (1u << 8)) != 0;
+#else
+        return false;
+#endif
+    }
+
+    case CpuFeature_Max:
+        break;
+    }
+
+    return false;
+}
+
+class CpuFeatureSet : public NonCopyable<> {
+public:
+    bool has(CpuFeature feature) const {
+        if ((unsigned)feature >= (unsigned)CpuFeature_Max) {
+            return false;
+        }
+        return (mask_ & (1u << feature)) != 0;
+    }
+
+private:
+    friend class Singleton<CpuFeatureSet>;
+
+    CpuFeatureSet()
+        : mask_(0) {
+#if defined(ROC_CPU_FEATURES_CPUID)
+        __builtin_cpu_init();
+#endif
+        for (int n = 0; n < CpuFeature_Max; n++) {
+            if (detect_feature((CpuFeature)n)) {
+                mask_ |= (1u << n);
+            }
+        }
+    }
+
+    unsigned mask_;
+};
+
+} // namespace
+
+bool cpu_supports(CpuFeature feature) {
+    return Singleton<CpuFeatureSet>::instance().has(feature);
+}
+
+const char* cpu_feature_to_str(CpuFeature feature) {
+    switch (feature) {
+    case CpuFeature_Generic:
+        return "generic";
+    case CpuFeature_SSE2:
+        return "sse2";
+    case CpuFeature_SSSE3:
+        return "ssse3";
+    case CpuFeature_AVX2:
+        return "avx2";
+    case CpuFeature_NEON:
+        return "neon";
+    case CpuFeature_InvariantTSC:
+        return "invariant_tsc";
+    case CpuFeature_Max:
+        break;
+    }
+
+    return "<invalid>";
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/cpu_features.h
+//! @brief CPU features.
+
+#ifndef ROC_CORE_CPU_FEATURES_H_
+#define ROC_CORE_CPU_FEATURES_H_
+
+#include "roc_core/cpu_traits.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! CPU instruction set extension.
+enum CpuFeature {
+    //! Baseline instruction set, always supported.
+    CpuFeature_Generic,
+
+    //! x86 SSE2.
+    CpuFeature_SSE2,
+
+    //! x86 SSSE3.
+    CpuFeature_SSSE3,
+
+    //! x86 AVX2.
+    CpuFeature_AVX2,
+
+    //! ARM NEON.
+    CpuFeature_NEON,
+
+    //! x86 invariant TSC, which runs at constant rate in all power states.
+    CpuFeature_InvariantTSC,
+
+    //! Number of features.
+    CpuFeature_Max
+};
+
+//! Check if CPU we're running on supports given feature.
+//! @remarks
+//!  Performs run time detection when it's supported by compiler and platform,
+//!  using CPUID on x86 and HWCAP on 32-bit ARM Linux. Otherwise, reports
+//!  features enabled at compile time. Detection is performed once per process.
+bool cpu_supports(CpuFeature feature);
+
+//! Get feature name.
+const char* cpu_feature_to_str(CpuFeature feature);
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CPU_FEATURES_H_
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/fast_clock.h"
+#include "roc_core/atomic_ops.h"
+#include "roc_core/cpu_features.h"
+#include "roc_core/cpu_traits.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+// Longer period gives more precise counter rate.
+const nanoseconds_t CalibrationPeriod = 100 * Millisecond;
+
+enum State {
+    // first call didn't happen yet
+    StateInitial,
+    // some thread is updating parameters
+    StateBusy,
+    // waiting until calibration period passes
+    StateSampling,
+    // counter rate is known
+    StateReady,
+    // counter is not supported
+    StateUnsupported
+};
+
+#if ROC_CPU_FAMILY == ROC_CPU_FAMILY_X86 && defined(__GNUC__)
+
+bool counter_supported() {
+    return cpu_supports(CpuFeature_InvariantTSC);
+}
+
+inline uint64_t read_counter() {
+    return __builtin_ia32_rdtsc();
+}
+
+#elif defined(__aarch64__) && defined(__GNUC__)
+
+// Generic timer runs at constant rate by architecture.
+bool counter_supported() {
+    return true;
+}
+
+inline uint64_t read_counter() {
+    uint64_t value;
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+}
+
+#else
+
+bool counter_supported() {
+    return false;
+}
+
+inline uint64_t read_counter() {
+    return 0;
+}
+
+#endif
+
+// Written before state is switched with release barrier, and read
+// after state is read with acquire barrier.
+struct Params {
+    uint64_t base_counter;
+    nanoseconds_t base_time;
+    double ns_per_tick;
+};
+
+int state = StateInitial;
+Params params;
+
+// Read counter and monotonic time at (almost) the same moment.
+void sample(uint64_t& counter, nanoseconds_t& time) {
+    const nanoseconds_t before = timestamp(ClockMonotonic);
+    counter = read_counter();
+    const nanoseconds_t after = timestamp(ClockMonotonic);
+
+    time = before + (after - before) / 2;
+}
+
+nanoseconds_t calibrate(int cur_state) {
+    const nanoseconds_t now = timestamp(ClockMonotonic);
+
+    if (cur_state == StateInitial) {
+        int expected = StateInitial;
+        if (AtomicOps::compare_exchange_relaxed(state, expected, (int)StateBusy)) {
+            if (!counter_supported()) {
+                roc_log(LogDebug, "fast clock: cpu counter not supported");
+                AtomicOps::store_release(state, (int)StateUnsupported);
+            } else {
+                sample(params.base_counter, params.base_time);
+                AtomicOps::store_release(state, (int)StateSampling);
+            }
+        }
+    } else if (cur_state == StateSampling
+               && now - params.base_time >= CalibrationPeriod) {
+        int expected = StateSampling;
+        if (AtomicOps::compare_exchange_relaxed(state, expected, (int)StateBusy)) {
+            uint64_t counter = 0;
+            nanoseconds_t time = 0;
+            sample(counter, time);
+
+            if (counter <= params.base_counter || time <= params.base_time) {
+                roc_log(LogDebug, "fast clock: cpu counter is not monotonic");
+                AtomicOps::store_release(state, (int)StateUnsupported);
+            } else {
+                params.ns_per_tick = double(time - params.base_time)
+                    / double(counter - params.base_counter);
+                params.base_counter = counter;
+                params.base_time = time;
+
+                roc_log(LogDebug, "fast clock: calibrated cpu counter: rate=%.3fMHz",
+                        1000. / params.ns_per_tick);
+
+                AtomicOps::store_release(state, (int)StateReady);
+            }
+        }
+    }
+
+    return now;
+}
+
+} // namespace
+
+nanoseconds_t fast_timestamp() {
+    const int cur_state = AtomicOps::load_acquire(state);
+
+    if (cur_state == StateReady) {
+        return params.base_time
+            + nanoseconds_t(double(read_counter() - params.base_counter)
+                            * params.ns_per_tick);
+    }
+
+    if (cur_state == StateUnsupported || cur_state == StateBusy) {
+        return timestamp(ClockMonotonic);
+    }
+
+    return calibrate(cur_state);
+}
+
+bool fast_clock_calibrated() {
+    return AtomicOps::load_acquire(state) == StateReady;
+}
+
+} // namespace core
+} // namespace roc
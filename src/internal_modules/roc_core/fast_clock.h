@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/fast_clock.h
+//! @brief Fast monotonic clock.
+
+#ifndef ROC_CORE_FAST_CLOCK_H_
+#define ROC_CORE_FAST_CLOCK_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+//! Get current timestamp from fast monotonic clock, in nanoseconds.
+//!
+//! @remarks
+//!  Reads CPU counter instead of performing a system call: invariant TSC on
+//!  x86, or virtual counter of generic timer on 64-bit ARM. Counter rate is
+//!  calibrated against ClockMonotonic during first 100 milliseconds after
+//!  the first call; until then, and on CPUs without suitable counter, the
+//!  function falls back to timestamp(ClockMonotonic).
+//!
+//!  The clock starts at the same point as ClockMonotonic, but it's not
+//!  adjusted by NTP daemon, so the two clocks slowly diverge over time.
+//!  Intended for measuring intervals and scheduling within a component, e.g.
+//!  by pipeline loop and profiling; timestamps shouldn't be mixed with ones
+//!  returned by timestamp(ClockMonotonic).
+//!
+//!  Thread-safe.
+nanoseconds_t fast_timestamp();
+
+//! Check if fast_timestamp() currently uses CPU counter.
+//! @remarks
+//!  Returns false before calibration is finished and if the counter is not
+//!  supported.
+bool fast_clock_calibrated();
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_FAST_CLOCK_H_
@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/flat_hashmap.h
+//! @brief Open-addressing hash table.
+
+#ifndef ROC_CORE_FLAT_HASHMAP_H_
+#define ROC_CORE_FLAT_HASHMAP_H_
+
+#include "roc_core/aligned_storage.h"
+#include "roc_core/hashsum.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Default key traits for FlatHashmap.
+//! @remarks
+//!  Suitable for integer keys supported by hashsum_int().
+template <class Key> struct FlatHashmapKeyTraits {
+    //! Compute key hash.
+    static hashsum_t key_hash(const Key& key) {
+        return hashsum_int(key);
+    }
+
+    //! Compare two keys for equality.
+    static bool key_equal(const Key& key1, const Key& key2) {
+        return key1 == key2;
+    }
+};
+
+//! Open-addressing hash table.
+//!
+//! Characteristics:
+//!  1) Non-intrusive. Keys and values are copied into the table. Suitable for
+//!     small keys and values, like integers and pointers.
+//!  2) Open addressing with Robin Hood linear probing and backward-shift
+//!     deletion. Key hash and probe distance are stored inline in every slot,
+//!     so lookup scans a contiguous array and compares keys only when hashes
+//!     match. Probe sequences are short and lookup of a missing key stops as
+//!     soon as a slot with smaller probe distance is met.
+//!  3) Controllable allocations. Allocations and deallocations are performed only
+//!     when the hash table is explicitly growed. All other operations don't touch
+//!     allocator.
+//!  4) Zero allocations for small hash tables. A fixed number of slots can be
+//!     embedded directly into hash table object.
+//!
+//! Unlike Hashmap, rehashing is not incremental: grow() reinserts all elements
+//! into the new slot array.
+//!
+//! @tparam Key defines key type, it should be copyable.
+//!
+//! @tparam Value defines value type, it should be copyable.
+//!
+//! @tparam EmbeddedCapacity defines the capacity embedded directly into
+//! FlatHashmap. It is used instead of dynamic memory while the number of elements
+//! is smaller than this capacity. The actual object size occupied to provide the
+//! requested capacity is implementation defined.
+//!
+//! @tparam KeyTraits defines how keys are hashed and compared, it should
+//! implement two methods:
+//!
+//! @code
+//!   // compute key hash
+//!   static core::hashsum_t key_hash(const Key& key);
+//!
+//!   // compare two keys for equality
+//!   static bool key_equal(const Key& key1, const Key& key2);
+//! @endcode
+template <class Key,
+          class Value,
+          size_t EmbeddedCapacity = 0,
+          class KeyTraits = FlatHashmapKeyTraits<Key> >
+class FlatHashmap : public NonCopyable<> {
+public:
+    //! Initialize empty hashmap.
+    FlatHashmap(IAllocator& allocator)
+        : slots_(NULL)
+        , n_slots_(0)
+        , size_(0)
+        , allocator_(allocator) {
+        if (EmbeddedCapacity != 0) {
+            slots_ = (Slot*)embedded_slots_.memory();
+            n_slots_ = NumEmbeddedSlots;
+            memset(slots_, 0, n_slots_ * sizeof(Slot));
+        }
+    }
+
+    //! Destroy all elements.
+    ~FlatHashmap() {
+        clear();
+        dealloc_slots_(slots_);
+    }
+
+    //! Get maximum number of elements that can be added to hashmap before
+    //! grow() should be called.
+    size_t capacity() const {
+        return slots_capacity_(n_slots_);
+    }
+
+    //! Get number of elements added to hashmap.
+    size_t size() const {
+        return size_;
+    }
+
+    //! Check if hashmap has element with given key.
+    //!
+    //! @note
+    //!  - has O(1) complexity in average
+    //!  - computes key hash
+    bool contains(const Key& key) const {
+        return find_slot_(key) != NULL;
+    }
+
+    //! Find value in the hashmap by key.
+    //!
+    //! @returns
+    //!  Pointer to the value stored in hashmap, or NULL if key is not found.
+    //!  The pointer is invalidated by insert(), remove() and grow().
+    //!
+    //! @note
+    //!  - has O(1) complexity in average and O(n) in the worst case
+    //!  - computes key hash
+    Value* find(const Key& key) const {
+        Slot* slot = find_slot_(key);
+        if (!slot) {
+            return NULL;
+        }
+
+        return slot_value_(*slot);
+    }
+
+    //! Insert element into hashmap.
+    //!
+    //! @pre
+    //!  - hashmap size() should be smaller than hashmap capacity()
+    //!  - hashmap shouldn't have an element with the same key
+    //!
+    //! @note
+    //!  - has O(1) complexity in average and O(n) in the worst case
+    //!  - computes key hash
+    //!  - doesn't make allocations or deallocations
+    void insert(const Key& key, const Value& value) {
+        if (size_ >= slots_capacity_(n_slots_)) {
+            roc_panic("flat hashmap: attempt to insert into full hashmap"
+                      " before calling grow()");
+        }
+
+        if (find_slot_(key)) {
+            roc_panic("flat hashmap: attempt to insert an element with duplicate key");
+        }
+
+        insert_slot_(slots_, n_slots_, KeyTraits::key_hash(key), key, value);
+
+        size_++;
+    }
+
+    //! Remove element from hashmap.
+    //!
+    //! @returns
+    //!  false if there is no element with given key.
+    //!
+    //! @note
+    //!  - has O(1) complexity in average and O(n) in the worst case
+    //!  - computes key hash
+    //!  - doesn't make allocations or deallocations
+    bool remove(const Key& key) {
+        Slot* slot = find_slot_(key);
+        if (!slot) {
+            return false;
+        }
+
+        destroy_slot_(*slot);
+
+        // backward-shift deletion: move following elements one slot back until
+        // an empty slot or an element at its home slot is met
+        const size_t mask = n_slots_ - 1;
+        size_t pos = size_t(slot - slots_);
+
+        for (;;) {
+            Slot& next = slots_[(pos + 1) & mask];
+            if (next.dist <= 1) {
+                break;
+            }
+
+            move_slot_(slots_[pos], next);
+            slots_[pos].dist--;
+
+            pos = (pos + 1) & mask;
+        }
+
+        size_--;
+
+        return true;
+    }
+
+    //! Remove all elements.
+    //!
+    //! @note
+    //!  - has O(n) complexity
+    //!  - doesn't make allocations or deallocations
+    void clear() {
+        for (size_t n = 0; n < n_slots_; n++) {
+            if (slots_[n].dist != 0) {
+                destroy_slot_(slots_[n]);
+            }
+        }
+
+        size_ = 0;
+    }
+
+    //! Grow hashtable capacity.
+    //!
+    //! @remarks
+    //!  Check if hash table is full (size is equal to capacity), and if so, increase
+    //!  hash table capacity and reinsert all elements.
+    //!
+    //! @returns
+    //!  - true if no growth needed or growth succeeded
+    //!  - false if allocation failed
+    //!
+    //! @note
+    //!  - has O(n) complexity
+    //!  - doesn't compute key hashes
+    //!  - makes allocations and deallocations
+    bool grow() {
+        const size_t cap = slots_capacity_(n_slots_);
+        roc_panic_if_not(size_ <= cap);
+
+        if (size_ < cap) {
+            return true;
+        }
+
+        size_t n_slots = n_slots_ != 0 ? n_slots_ : (size_t)MinSlots;
+        while (size_ >= slots_capacity_(n_slots)) {
+            n_slots *= 2;
+        }
+
+        Slot* slots = (Slot*)allocator_.allocate(n_slots * sizeof(Slot));
+        if (!slots) {
+            return false;
+        }
+
+        memset(slots, 0, n_slots * sizeof(Slot));
+
+        for (size_t n = 0; n < n_slots_; n++) {
+            Slot& slot = slots_[n];
+            if (slot.dist == 0) {
+                continue;
+            }
+
+            insert_slot_(slots, n_slots, slot.hash, *slot_key_(slot),
+                         *slot_value_(slot));
+            destroy_slot_(slot);
+        }
+
+        dealloc_slots_(slots_);
+
+        slots_ = slots;
+        n_slots_ = n_slots;
+
+        roc_panic_if_not(size_ < slots_capacity_(n_slots_));
+
+        return true;
+    }
+
+private:
+    enum {
+        // growth happens when n_elements >= n_slots * LoadFactorNum / LoadFactorDen
+        LoadFactorNum = 7,
+        LoadFactorDen = 8,
+
+        // minimum number of dynamically allocated slots
+        MinSlots = 16,
+
+        // number of slots needed for embedded capacity, rounded up to power of two
+        EmbeddedSlots0 =
+            ((int)EmbeddedCapacity * LoadFactorDen + LoadFactorNum - 1) / LoadFactorNum,
+        EmbeddedSlots1 = (EmbeddedSlots0 > 0 ? EmbeddedSlots0 : 1) - 1,
+        EmbeddedSlots2 = EmbeddedSlots1 | (EmbeddedSlots1 >> 1),
+        EmbeddedSlots3 = EmbeddedSlots2 | (EmbeddedSlots2 >> 2),
+        EmbeddedSlots4 = EmbeddedSlots3 | (EmbeddedSlots3 >> 4),
+        EmbeddedSlots5 = EmbeddedSlots4 | (EmbeddedSlots4 >> 8),
+        EmbeddedSlots6 = EmbeddedSlots5 | (EmbeddedSlots5 >> 16),
+
+        // how much slots are embedded directly into FlatHashmap object
+        NumEmbeddedSlots = EmbeddedCapacity != 0 ? EmbeddedSlots6 + 1 : 0
+    };
+
+    struct Slot {
+        // key hash, valid if dist != 0
+        hashsum_t hash;
+        // probe distance plus one, zero if slot is empty
+        size_t dist;
+
+        AlignedStorage<sizeof(Key)> key;
+        AlignedStorage<sizeof(Value)> value;
+    };
+
+    static Key* slot_key_(Slot& slot) {
+        return (Key*)slot.key.memory();
+    }
+
+    static Value* slot_value_(Slot& slot) {
+        return (Value*)slot.value.memory();
+    }
+
+    static void destroy_slot_(Slot& slot) {
+        slot_key_(slot)->~Key();
+        slot_value_(slot)->~Value();
+        slot.dist = 0;
+    }
+
+    static void move_slot_(Slot& dst, Slot& src) {
+        new (dst.key.memory()) Key(*slot_key_(src));
+        new (dst.value.memory()) Value(*slot_value_(src));
+        dst.hash = src.hash;
+        dst.dist = src.dist;
+
+        destroy_slot_(src);
+    }
+
+    static void swap_slots_(Slot& slot, hashsum_t& hash, size_t& dist, Key& key,
+                            Value& value) {
+        const Key tmp_key = *slot_key_(slot);
+        const Value tmp_value = *slot_value_(slot);
+        const hashsum_t tmp_hash = slot.hash;
+        const size_t tmp_dist = slot.dist;
+
+        *slot_key_(slot) = key;
+        *slot_value_(slot) = value;
+        slot.hash = hash;
+        slot.dist = dist;
+
+        key = tmp_key;
+        value = tmp_value;
+        hash = tmp_hash;
+        dist = tmp_dist;
+    }
+
+    static size_t slots_capacity_(size_t n_slots) {
+        return n_slots * LoadFactorNum / LoadFactorDen;
+    }
+
+    Slot* find_slot_(const Key& key) const {
+        if (size_ == 0) {
+            return NULL;
+        }
+
+        const hashsum_t hash = KeyTraits::key_hash(key);
+        const size_t mask = n_slots_ - 1;
+
+        size_t pos = hash & mask;
+
+        for (size_t dist = 1;; dist++) {
+            Slot& slot = slots_[pos];
+
+            // Robin Hood invariant: if the key were here, it would be placed
+            // before any element with smaller probe distance
+            if (slot.dist < dist) {
+                return NULL;
+            }
+
+            if (slot.hash == hash && KeyTraits::key_equal(*slot_key_(slot), key)) {
+                return &slot;
+            }
+
+            pos = (pos + 1) & mask;
+        }
+    }
+
+    static void insert_slot_(Slot* slots,
+                             size_t n_slots,
+                             hashsum_t hash,
+                             const Key& key,
+                             const Value& value) {
+        const size_t mask = n_slots - 1;
+
+        size_t pos = hash & mask;
+        size_t dist = 1;
+
+        Key ins_key = key;
+        Value ins_value = value;
+
+        for (;;) {
+            Slot& slot = slots[pos];
+
+            if (slot.dist == 0) {
+                new (slot.key.memory()) Key(ins_key);
+                new (slot.value.memory()) Value(ins_value);
+                slot.hash = hash;
+                slot.dist = dist;
+                return;
+            }
+
+            // take the slot from element which is closer to its home slot
+            if (slot.dist < dist) {
+                swap_slots_(slot, hash, dist, ins_key, ins_value);
+            }
+
+            pos = (pos + 1) & mask;
+            dist++;
+        }
+    }
+
+    void dealloc_slots_(Slot* slots) {
+        if (slots && slots != (Slot*)embedded_slots_.memory()) {
+            allocator_.deallocate(slots);
+        }
+    }
+
+    Slot* slots_;
+    size_t n_slots_;
+
+    size_t size_;
+
+    IAllocator& allocator_;
+
+    AlignedStorage<NumEmbeddedSlots * sizeof(Slot)> embedded_slots_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_FLAT_HASHMAP_H_
@@ -6,7 +6,11 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <stdlib.h>
+
 #include "roc_core/log.h"
+#include "roc_core/aligned_storage.h"
+#include "roc_core/async_log_writer.h"
 #include "roc_core/global_destructor.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
@@ -24,10 +28,21 @@ void backend_handler(const LogMessage& msg, void** args) {
     ((LogBackend*)args[0])->handle(msg);
 }
 
+// Async writer is created once and never destroyed, because logging threads
+// may still use its rings at any moment, even after async mode is disabled.
+AlignedStorage<sizeof(AsyncLogWriter)> async_writer_storage;
+AsyncLogWriter* async_writer_instance;
+bool async_atexit_registered;
+
+void disable_async_at_exit() {
+    (void)Logger::instance().set_async(false);
+}
+
 } // namespace
 
 Logger::Logger()
     : level_(LogError)
+    , async_writer_(NULL)
     , colors_mode_(ColorsDisabled)
     , location_mode_(LocationDisabled) {
     handler_ = &backend_handler;
@@ -103,12 +118,80 @@ void Logger::set_handler(LogHandler handler, void** args, size_t n_args) {
     }
 }
 
+bool Logger::set_async(bool enabled) {
+    Mutex::Lock async_lock(async_mutex_);
+
+    if (enabled) {
+        if (AtomicOps::load_relaxed(async_writer_)) {
+            return true;
+        }
+
+        if (!async_writer_instance) {
+            async_writer_instance = new (async_writer_storage.memory())
+                AsyncLogWriter(&Logger::async_handler_, this);
+        }
+
+        if (!async_writer_instance->start_writer()) {
+            return false;
+        }
+
+        if (!async_atexit_registered) {
+            async_atexit_registered = true;
+            (void)atexit(&disable_async_at_exit);
+        }
+
+        AtomicOps::store_release(async_writer_, async_writer_instance);
+    } else {
+        AsyncLogWriter* writer = AtomicOps::load_relaxed(async_writer_);
+        if (!writer) {
+            return true;
+        }
+
+        AtomicOps::store_release(async_writer_, (AsyncLogWriter*)NULL);
+
+        // mutex_ is not held here, since background thread takes it to
+        // invoke handler for pending messages
+        writer->stop_writer();
+    }
+
+    return true;
+}
+
 void Logger::writef(LogLevel level,
                     const char* module,
                     const char* file,
                     int line,
                     const char* format,
                     ...) {
+    if (AsyncLogWriter* writer = AtomicOps::load_acquire(async_writer_)) {
+        if (level > get_level() || level == LogNone) {
+            return;
+        }
+
+        AsyncLogRecord record;
+        record.level = level;
+        record.module = module;
+        record.file = file;
+        record.line = line;
+        record.time = timestamp(ClockUnix);
+        record.pid = Thread::get_pid();
+        record.tid = Thread::get_tid();
+
+        va_list args;
+        va_start(args, format);
+        if (vsnprintf(record.text, sizeof(record.text) - 1, format, args) < 0) {
+            record.text[0] = '\0';
+        }
+        va_end(args);
+        record.text[sizeof(record.text) - 1] = '\0';
+
+        if (!writer->push(record)) {
+            // thread can't have its own ring, handle synchronously
+            async_handler_(record, this);
+        }
+        return;
+    }
+
     Mutex::Lock lock(mutex_);
 
     if (level > level_ || level == LogNone) {
@@ -147,5 +230,29 @@ void Logger::writef(LogLevel level,
     handler_(msg, handler_args_);
 }
 
+void Logger::async_handler_(const AsyncLogRecord& record, void* arg) {
+    Logger& self = *(Logger*)arg;
+
+    Mutex::Lock lock(self.mutex_);
+
+    if (self.handler_ != &backend_handler && GlobalDestructor::is_destroying()) {
+        return;
+    }
+
+    LogMessage msg;
+    msg.level = record.level;
+    msg.module = record.module;
+    msg.file = record.file;
+    msg.line = record.line;
+    msg.time = record.time;
+    msg.pid = record.pid;
+    msg.tid = record.tid;
+    msg.text = record.text;
+    msg.location_mode = self.location_mode_;
+    msg.colors_mode = self.colors_mode_;
+
+    self.handler_(msg, self.handler_args_);
+}
+
 } // namespace core
 } // namespace roc
@@ -97,6 +97,9 @@ struct LogMessage {
 //! Log handler.
 typedef void (*LogHandler)(const LogMessage& message, void** args);
 
+class AsyncLogWriter;
+struct AsyncLogRecord;
+
 //! Logger.
 class Logger : public NonCopyable<> {
 public:
@@ -144,6 +147,21 @@ public:
     //!  Other threads will see the change immediately.
     void set_handler(LogHandler handler, void** args, size_t n_args);
 
+    //! Enable or disable asynchronous mode.
+    //! @remarks
+    //!  In asynchronous mode, message is formatted on the calling thread and
+    //!  put into a lock-free ring of that thread, and log handler is invoked on
+    //!  a background thread. Calling thread never blocks on the logger mutex or
+    //!  on handler I/O. If the ring is full, message is dropped, and number of
+    //!  dropped messages is reported later. Messages from different threads may
+    //!  be handled out of order, but timestamps are taken on calling thread.
+    //! @remarks
+    //!  Disabling waits until pending messages are handled. Asynchronous mode is
+    //!  disabled automatically at process exit.
+    //! @returns
+    //!  false if background thread can't be started.
+    bool set_async(bool enabled);
+
 private:
     friend class Singleton<Logger>;
 
@@ -151,10 +169,15 @@ private:
 
     Logger();
 
+    static void async_handler_(const AsyncLogRecord& record, void* arg);
+
     int level_;
 
     Mutex mutex_;
 
+    AsyncLogWriter* async_writer_;
+    Mutex async_mutex_;
+
     LogHandler handler_;
     void* handler_args_[MaxArgs];
 
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/mpmc_queue.h
+//! @brief Bounded multi-producer multi-consumer queue.
+
+#ifndef ROC_CORE_MPMC_QUEUE_H_
+#define ROC_CORE_MPMC_QUEUE_H_
+
+#include "roc_core/aligned_storage.h"
+#include "roc_core/atomic_ops.h"
+#include "roc_core/cache_aligned.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Thread-safe lock-free bounded multi-producer multi-consumer queue.
+//!
+//! Stores up to a fixed number of elements in memory allocated once during
+//! construction. Any number of threads may push and pop elements concurrently.
+//! When the queue is full, try_push() fails, so producers can apply backpressure;
+//! when it's empty, try_pop() fails.
+//!
+//! Implementation is based on Dmitry Vyukov's bounded MPMC queue. Every cell has
+//! a sequence number, which tells whether the cell is ready for the producer or
+//! consumer at given position. Producers and consumers contend only on their own
+//! position counter, and each operation performs a single CAS in the absence of
+//! contention. Cells and counters are padded to cache line size to avoid false
+//! sharing.
+//!
+//! Capacity is rounded up to a power of two.
+//!
+//! @tparam T defines element type. It should have copy constructor and
+//! destructor.
+template <class T> class MpmcQueue : public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Allocates memory for @p capacity elements.
+    MpmcQueue(IAllocator& allocator, size_t capacity)
+        : allocator_(allocator)
+        , memory_(NULL)
+        , cells_(NULL)
+        , mask_(0)
+        , enqueue_pos_(size_t(0))
+        , dequeue_pos_(size_t(0)) {
+        if (capacity == 0) {
+            roc_panic("mpmc queue: capacity should be non-zero");
+        }
+
+        size_t n_cells = 1;
+        while (n_cells < capacity) {
+            n_cells *= 2;
+        }
+
+        memory_ = allocator_.allocate(n_cells * CellStride + CacheLine);
+        if (!memory_) {
+            roc_log(LogError, "mpmc queue: can't allocate memory: capacity=%lu",
+                    (unsigned long)n_cells);
+            return;
+        }
+
+        // align first cell to cache line
+        cells_ = (char*)memory_ + CacheLine - (size_t)memory_ % CacheLine;
+        mask_ = n_cells - 1;
+
+        for (size_t n = 0; n < n_cells; n++) {
+            cell_(n).seq = n;
+        }
+    }
+
+    //! Destroy remaining elements.
+    //! @pre
+    //!  Should not be called concurrently with other methods.
+    ~MpmcQueue() {
+        if (!memory_) {
+            return;
+        }
+
+        for (size_t pos = *dequeue_pos_; pos != *enqueue_pos_; pos++) {
+            ((T*)cell_(pos).value.memory())->~T();
+        }
+
+        allocator_.deallocate(memory_);
+    }
+
+    //! Check if the queue was successfully constructed.
+    bool valid() const {
+        return cells_ != NULL;
+    }
+
+    //! Get maximum number of elements.
+    size_t capacity() const {
+        return valid() ? mask_ + 1 : 0;
+    }
+
+    //! Get approximate number of elements.
+    //! @remarks
+    //!  May be called from any thread; the result may be outdated.
+    size_t size() const {
+        const size_t dp = AtomicOps::load_acquire(*dequeue_pos_);
+        const size_t ep = AtomicOps::load_acquire(*enqueue_pos_);
+
+        return ep - dp < capacity() ? ep - dp : capacity();
+    }
+
+    //! Copy element to the tail of the queue.
+    //! @returns
+    //!  false if the queue is full.
+    //! @note
+    //!  May be called from any thread. Lock-free.
+    bool try_push(const T& value) {
+        roc_panic_if(!valid());
+
+        size_t pos = AtomicOps::load_relaxed(*enqueue_pos_);
+        Cell* cell;
+
+        for (;;) {
+            cell = &cell_(pos);
+
+            const size_t seq = AtomicOps::load_acquire(cell->seq);
+            const ptrdiff_t diff = (ptrdiff_t)(seq - pos);
+
+            if (diff == 0) {
+                // cell is free, try to claim it; on failure, pos is updated
+                if (AtomicOps::compare_exchange_relaxed(*enqueue_pos_, pos,
+                                                        pos + 1)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // cell wasn't released by consumer of previous round
+                return false;
+            } else {
+                // another producer claimed this position
+                pos = AtomicOps::load_relaxed(*enqueue_pos_);
+            }
+        }
+
+        new (cell->value.memory()) T(value);
+
+        // publish element to consumer
+        AtomicOps::store_release(cell->seq, pos + 1);
+
+        return true;
+    }
+
+    //! Move element from the head of the queue to @p value.
+    //! @returns
+    //!  false if the queue is empty.
+    //! @note
+    //!  May be called from any thread. Lock-free.
+    bool try_pop(T& value) {
+        roc_panic_if(!valid());
+
+        size_t pos = AtomicOps::load_relaxed(*dequeue_pos_);
+        Cell* cell;
+
+        for (;;) {
+            cell = &cell_(pos);
+
+            const size_t seq = AtomicOps::load_acquire(cell->seq);
+            const ptrdiff_t diff = (ptrdiff_t)(seq - (pos + 1));
+
+            if (diff == 0) {
+                // cell is published, try to claim it; on failure, pos is updated
+                if (AtomicOps::compare_exchange_relaxed(*dequeue_pos_, pos,
+                                                        pos + 1)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // cell wasn't published by producer yet
+                return false;
+            } else {
+                // another consumer claimed this position
+                pos = AtomicOps::load_relaxed(*dequeue_pos_);
+            }
+        }
+
+        T* elem = (T*)cell->value.memory();
+        value = *elem;
+        elem->~T();
+
+        // release cell to producer of next round
+        AtomicOps::store_release(cell->seq, pos + mask_ + 1);
+
+        return true;
+    }
+
+private:
+    enum { CacheLine = ROC_CPU_CACHE_LINE };
+
+    struct Cell {
+        size_t seq;
+        AlignedStorage<sizeof(T)> value;
+    };
+
+    enum { CellStride = (sizeof(Cell) + CacheLine - 1) / CacheLine * CacheLine };
+
+    Cell& cell_(size_t pos) const {
+        return *(Cell*)((char*)cells_ + (pos & mask_) * CellStride);
+    }
+
+    IAllocator& allocator_;
+
+    void* memory_;
+    void* cells_;
+    size_t mask_;
+
+    // position counters, occupying their own cache lines
+    CacheAligned<size_t> enqueue_pos_;
+    CacheAligned<size_t> dequeue_pos_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_MPMC_QUEUE_H_
@@ -80,6 +80,45 @@ public:
         push_node_(node);
     }
 
+    //! Move all objects from the list to the end of the queue.
+    //! Can be called concurrently.
+    //! Acquires ownership of the objects and removes them from @p list.
+    //! @remarks
+    //!  Objects are linked together before being published, so the whole list
+    //!  is added using a single atomic exchange, as if push_back() was called
+    //!  for every object, but without interleaving with concurrent objects.
+    template <class List> void push_back_list(List& list) {
+        MpscQueueData* first = NULL;
+        MpscQueueData* last = NULL;
+
+        while (typename List::Pointer obj = list.front()) {
+            list.remove(*obj);
+
+            OwnershipPolicy<T>::acquire(*obj);
+
+            MpscQueueData* node = obj->mpsc_queue_data();
+
+            change_owner_(node, NULL, this);
+
+            AtomicOps::store_relaxed(node->next, (MpscQueueData*)NULL);
+
+            if (last) {
+                AtomicOps::store_relaxed(last->next, node);
+            } else {
+                first = node;
+            }
+            last = node;
+        }
+
+        if (!first) {
+            return;
+        }
+
+        MpscQueueData* prev = AtomicOps::exchange_seq_cst(tail_, last);
+
+        AtomicOps::store_release(prev->next, first);
+    }
+
     //! Try to remove object from the beginning of the queue (non-blocking version).
     //! Should NOT be called concurrently.
     //! Releases ownership of the returned object.
@@ -12,47 +12,62 @@
 #ifndef ROC_CORE_RATE_LIMITER_H_
 #define ROC_CORE_RATE_LIMITER_H_
 
+#include "roc_core/fast_clock.h"
 #include "roc_core/noncopyable.h"
-#include "roc_core/ticker.h"
+#include "roc_core/panic.h"
+#include "roc_core/time.h"
 
 namespace roc {
 namespace core {
 
 //! Rate limiter.
+//! @remarks
+//!  Allows one event per period. Periods are aligned to the time of the first
+//!  allow() call.
+//!
+//!  Rate limiters are checked on hot paths, often once per frame or packet,
+//!  so the check is just a read of fast_timestamp() and a comparison with the
+//!  precomputed deadline. Division is performed only when event is allowed.
 class RateLimiter : public NonCopyable<> {
 public:
     //! Initialize rate limiter.
     //! @remarks
     //!  @p period is tick duration in nanoseconds.
     explicit RateLimiter(nanoseconds_t period)
-        : period_(Ticker::ticks_t(period))
-        , pos_(0)
-        , ticker_(Second / Nanosecond) {
+        : period_(period)
+        , start_(0)
+        , deadline_(0)
+        , started_(false) {
         if (period <= 0) {
             roc_panic("rate limiter: expected positive period, got %ld", (long)period);
         }
     }
 
     //! Check whether allow() would succeed.
-    bool would_allow() {
-        return ticker_.elapsed() >= pos_;
+    bool would_allow() const {
+        return !started_ || fast_timestamp() >= deadline_;
     }
 
     //! Check whether an event is allowed to occur now, and if yes, mark it as occurred.
     bool allow() {
-        const Ticker::ticks_t elapsed = ticker_.elapsed();
-        if (elapsed >= pos_) {
-            pos_ = (elapsed / period_ + 1) * period_;
-            return true;
-        } else {
+        const nanoseconds_t now = fast_timestamp();
+
+        if (!started_) {
+            start_ = now;
+            started_ = true;
+        } else if (now < deadline_) {
             return false;
         }
+
+        deadline_ = start_ + ((now - start_) / period_ + 1) * period_;
+        return true;
     }
 
 private:
-    const Ticker::ticks_t period_;
-    Ticker::ticks_t pos_;
-    Ticker ticker_;
+    const nanoseconds_t period_;
+    nanoseconds_t start_;
+    nanoseconds_t deadline_;
+    bool started_;
 };
 
 } // namespace core
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/ring_buffer.h
+//! @brief Ring buffer.
+
+#ifndef ROC_CORE_RING_BUFFER_H_
+#define ROC_CORE_RING_BUFFER_H_
+
+#include "roc_core/aligned_storage.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Ring buffer.
+//!
+//! Single-threaded FIFO of elements stored in a contiguous circular memory
+//! chunk allocated using IAllocator. Capacity is always a power of two, so
+//! indexing is O(1) and uses only masking. Small chunks can be stored directly
+//! in RingBuffer object, without extra allocation. Ring buffer can be resized
+//! only by explicitly calling grow(). Elements are copied during grow and old
+//! copies are destroyed.
+//!
+//! For a lock-free ring shared between two threads, see SpscRingBuffer.
+//!
+//! @tparam T defines element type. It should have copy constructor and
+//! destructor.
+//!
+//! @tparam EmbeddedCapacity defines the size of the fixed-size array embedded
+//! directly into RingBuffer object; it is used instead of dynamic memory if
+//! the requested capacity is small enough. Should be zero or a power of two.
+template <class T, size_t EmbeddedCapacity = 0> class RingBuffer : public NonCopyable<> {
+public:
+    //! Initialize empty ring buffer without allocator.
+    //! @remarks
+    //!  Ring buffer maximum size will be limited to the embedded capacity.
+    RingBuffer()
+        : data_(NULL)
+        , begin_(0)
+        , size_(0)
+        , max_size_(0)
+        , allocator_(NULL) {
+    }
+
+    //! Initialize empty ring buffer.
+    explicit RingBuffer(IAllocator& allocator)
+        : data_(NULL)
+        , begin_(0)
+        , size_(0)
+        , max_size_(0)
+        , allocator_(&allocator) {
+    }
+
+    ~RingBuffer() {
+        clear();
+
+        if (data_) {
+            deallocate_(data_);
+        }
+    }
+
+    //! Get maximum number of elements.
+    //! If ring buffer has allocator, capacity can be grown.
+    size_t capacity() const {
+        return max_size_;
+    }
+
+    //! Get number of elements.
+    size_t size() const {
+        return size_;
+    }
+
+    //! Check if ring buffer has no elements.
+    bool is_empty() const {
+        return size_ == 0;
+    }
+
+    //! Check if ring buffer size is equal to its capacity.
+    bool is_full() const {
+        return size_ == max_size_;
+    }
+
+    //! Get element at given position, counting from the front.
+    T& operator[](size_t index) {
+        if (index >= size_) {
+            roc_panic("ring buffer: subscript out of range: index=%lu size=%lu",
+                      (unsigned long)index, (unsigned long)size_);
+        }
+        return data_[(begin_ + index) & (max_size_ - 1)];
+    }
+
+    //! Get element at given position, counting from the front.
+    const T& operator[](size_t index) const {
+        if (index >= size_) {
+            roc_panic("ring buffer: subscript out of range: index=%lu size=%lu",
+                      (unsigned long)index, (unsigned long)size_);
+        }
+        return data_[(begin_ + index) & (max_size_ - 1)];
+    }
+
+    //! Get first element.
+    //! @pre
+    //!  Ring buffer should not be empty.
+    T& front() {
+        return (*this)[0];
+    }
+
+    //! Get first element.
+    //! @pre
+    //!  Ring buffer should not be empty.
+    const T& front() const {
+        return (*this)[0];
+    }
+
+    //! Get last element.
+    //! @pre
+    //!  Ring buffer should not be empty.
+    T& back() {
+        return (*this)[size_ - 1];
+    }
+
+    //! Get last element.
+    //! @pre
+    //!  Ring buffer should not be empty.
+    const T& back() const {
+        return (*this)[size_ - 1];
+    }
+
+    //! Append element to the back.
+    //! @pre
+    //!  Ring buffer should not be full.
+    void push_back(const T& value) {
+        if (size_ >= max_size_) {
+            roc_panic("ring buffer: attempting to append element to full buffer:"
+                      " size=%lu",
+                      (unsigned long)size_);
+        }
+        new (data_ + ((begin_ + size_) & (max_size_ - 1))) T(value);
+        size_++;
+    }
+
+    //! Remove element from the front.
+    //! @pre
+    //!  Ring buffer should not be empty.
+    void pop_front() {
+        if (size_ == 0) {
+            roc_panic("ring buffer: attempting to remove element from empty buffer");
+        }
+        data_[begin_].~T();
+        begin_ = (begin_ + 1) & (max_size_ - 1);
+        size_--;
+    }
+
+    //! Append multiple elements to the back.
+    //! @returns
+    //!  number of appended elements, which is less than @p n_elems if
+    //!  there is not enough space.
+    size_t push_back_many(const T* elems, size_t n_elems) {
+        if (n_elems > max_size_ - size_) {
+            n_elems = max_size_ - size_;
+        }
+
+        size_t pos = (begin_ + size_) & (max_size_ - 1);
+
+        for (size_t n = 0; n < n_elems; n++) {
+            new (data_ + pos) T(elems[n]);
+            pos = (pos + 1) & (max_size_ - 1);
+        }
+
+        size_ += n_elems;
+
+        return n_elems;
+    }
+
+    //! Remove multiple elements from the front.
+    //! @remarks
+    //!  Copies removed elements to @p elems, if it's not null.
+    //! @returns
+    //!  number of removed elements, which is less than @p n_elems if
+    //!  there are not enough elements.
+    size_t pop_front_many(T* elems, size_t n_elems) {
+        if (n_elems > size_) {
+            n_elems = size_;
+        }
+
+        for (size_t n = 0; n < n_elems; n++) {
+            if (elems) {
+                elems[n] = data_[begin_];
+            }
+            data_[begin_].~T();
+            begin_ = (begin_ + 1) & (max_size_ - 1);
+        }
+
+        size_ -= n_elems;
+
+        return n_elems;
+    }
+
+    //! Remove all elements.
+    void clear() {
+        while (size_ != 0) {
+            pop_front();
+        }
+        begin_ = 0;
+    }
+
+    //! Increase ring buffer capacity.
+    //! @remarks
+    //!  If @p max_sz is greater than the current maximum size, a larger memory
+    //!  region is allocated and the elements are copied there. Capacity is
+    //!  rounded up to a power of two.
+    //! @returns
+    //!  false if the allocation failed
+    bool grow(size_t max_sz) {
+        if (max_sz <= max_size_) {
+            return true;
+        }
+
+        size_t new_max_size = 1;
+        while (new_max_size < max_sz) {
+            new_max_size *= 2;
+        }
+
+        T* new_data = allocate_(new_max_size);
+        if (!new_data) {
+            roc_log(LogError,
+                    "ring buffer: can't allocate memory: old_size=%lu new_size=%lu",
+                    (unsigned long)max_size_, (unsigned long)new_max_size);
+            return false;
+        }
+
+        if (new_data != data_) {
+            // Copy old objects to new memory, unwrapping them.
+            for (size_t n = 0; n < size_; n++) {
+                new (new_data + n) T(data_[(begin_ + n) & (max_size_ - 1)]);
+            }
+
+            // Destruct objects in old memory.
+            for (size_t n = 0; n < size_; n++) {
+                data_[(begin_ + n) & (max_size_ - 1)].~T();
+            }
+
+            // Free old memory.
+            if (data_) {
+                deallocate_(data_);
+            }
+
+            data_ = new_data;
+            begin_ = 0;
+        } else if (begin_ + size_ > max_size_) {
+            // Same memory (embedded), but larger mask. Move wrapped part right
+            // after the old end, it's free since capacity at least doubled.
+            const size_t n_wrapped = begin_ + size_ - max_size_;
+
+            for (size_t n = 0; n < n_wrapped; n++) {
+                new (data_ + max_size_ + n) T(data_[n]);
+                data_[n].~T();
+            }
+        }
+
+        max_size_ = new_max_size;
+        return true;
+    }
+
+private:
+    T* allocate_(size_t n_elems) {
+        if (n_elems <= EmbeddedCapacity) {
+            return (T*)embedded_data_.memory();
+        } else if (allocator_) {
+            return (T*)allocator_->allocate(n_elems * sizeof(T));
+        } else {
+            return NULL;
+        }
+    }
+
+    void deallocate_(T* data) {
+        if ((void*)data != (void*)embedded_data_.memory()) {
+            roc_panic_if(!allocator_);
+            allocator_->deallocate(data);
+        }
+    }
+
+    T* data_;
+    size_t begin_;
+    size_t size_;
+    size_t max_size_;
+
+    IAllocator* allocator_;
+
+    AlignedStorage<EmbeddedCapacity * sizeof(T)> embedded_data_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_RING_BUFFER_H_
@@ -8,8 +8,10 @@
 
 #include "roc_core/slab_pool.h"
 #include "roc_core/align_ops.h"
+#include "roc_core/atomic_ops.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/thread.h"
 
 namespace roc {
 namespace core {
@@ -18,9 +20,16 @@ SlabPool::SlabPool(IAllocator& allocator,
                    size_t object_size,
                    bool poison,
                    size_t min_alloc_bytes,
-                   size_t max_alloc_bytes)
+                   size_t max_alloc_bytes,
+                   bool thread_cache)
     : allocator_(allocator)
     , n_used_slots_(0)
+    , n_peak_used_slots_(0)
+    , n_total_slots_(0)
+    , n_slabs_(0)
+    , n_slab_bytes_(0)
+    , max_total_slots_(0)
+    , n_failed_allocs_(0)
     , slab_min_bytes_(min_alloc_bytes)
     , slab_max_bytes_(max_alloc_bytes == 0 ? 0
                                            : std::max(min_alloc_bytes, max_alloc_bytes))
@@ -29,19 +38,24 @@ SlabPool::SlabPool(IAllocator& allocator,
     , slab_cur_slots_(slab_min_bytes_ == 0 ? 1 : slots_per_slab_(slab_min_bytes_, true))
     , slab_max_slots_(slab_max_bytes_ == 0 ? 0 : slots_per_slab_(slab_max_bytes_, false))
     , object_size_(object_size)
-    , poison_(poison) {
+    , poison_(poison)
+    , thread_cache_(thread_cache) {
     roc_log(LogDebug,
             "slab pool: initializing: object_size=%lu min_slab=%luB(%luS) "
-            "max_slab=%luB(%luS) poison=%d",
+            "max_slab=%luB(%luS) poison=%d thread_cache=%d",
             (unsigned long)slot_size_, (unsigned long)slab_min_bytes_,
             (unsigned long)slab_cur_slots_, (unsigned long)slab_max_bytes_,
-            (unsigned long)slab_max_slots_, (int)poison);
+            (unsigned long)slab_max_slots_, (int)poison, (int)thread_cache);
 
     roc_panic_if_not(slab_cur_slots_ > 0);
     roc_panic_if_not(slab_cur_slots_ <= slab_max_slots_ || slab_max_slots_ == 0);
 }
 
 SlabPool::~SlabPool() {
+    for (size_t n = 0; n < NumCaches; n++) {
+        flush_cache_(caches_[n], caches_[n].n_slots);
+    }
+
     deallocate_everything_();
 }
 
@@ -55,16 +69,67 @@ bool SlabPool::reserve(size_t n_objects) {
     return reserve_slots_(n_objects);
 }
 
+void SlabPool::set_limit(size_t max_objects) {
+    Mutex::Lock lock(mutex_);
+
+    max_total_slots_ = max_objects;
+}
+
+size_t SlabPool::num_failed_allocations() const {
+    return n_failed_allocs_;
+}
+
+SlabPoolStats SlabPool::stats() const {
+    SlabPoolStats stats;
+
+    {
+        Mutex::Lock lock(mutex_);
+
+        stats.num_slabs = n_slabs_;
+        stats.num_bytes = n_slab_bytes_;
+        stats.total_slots = n_total_slots_;
+        stats.used_slots = n_used_slots_;
+        stats.free_slots = n_total_slots_ - n_used_slots_;
+        stats.peak_used_slots = n_peak_used_slots_;
+    }
+
+    stats.failed_allocations = n_failed_allocs_;
+
+    return stats;
+}
+
 void* SlabPool::allocate() {
-    Slot* slot;
+    Slot* slot = NULL;
+
+    if (ThreadCache* cache = lock_cache_()) {
+        if (cache->n_slots == 0) {
+            refill_cache_(*cache);
+        }
+        if (cache->n_slots != 0) {
+            slot = cache->slots[--cache->n_slots];
+        }
+        unlock_cache_(*cache);
+
+        if (slot != NULL) {
+            return give_slot_to_user_(slot);
+        }
+    }
 
     {
         Mutex::Lock lock(mutex_);
 
         slot = acquire_slot_();
+
+        if (slot == NULL && thread_cache_) {
+            // pool is exhausted, but free slots may be kept in caches of other
+            // threads, e.g. when one thread allocates and another deallocates
+            steal_cached_slots_();
+            slot = acquire_slot_();
+        }
     }
 
     if (slot == NULL) {
+        ++n_failed_allocs_;
         return NULL;
     }
 
@@ -78,6 +143,16 @@ void SlabPool::deallocate(void* memory) {
 
     Slot* slot = take_slot_from_user_(memory);
 
+    if (ThreadCache* cache = lock_cache_()) {
+        if (cache->n_slots == CacheSize) {
+            flush_cache_(*cache, CacheSize / 2);
+        }
+        cache->slots[cache->n_slots++] = slot;
+        unlock_cache_(*cache);
+
+        return;
+    }
+
     {
         Mutex::Lock lock(mutex_);
 
@@ -85,6 +160,70 @@ void SlabPool::deallocate(void* memory) {
     }
 }
 
+SlabPool::ThreadCache* SlabPool::lock_cache_() {
+    if (!thread_cache_) {
+        return NULL;
+    }
+
+    ThreadCache& cache = caches_[Thread::get_index() % NumCaches];
+
+    // if another thread shares this cache and is using it right now,
+    // fall back to the shared list instead of waiting
+    if (AtomicOps::exchange_acquire(cache.busy, 1) != 0) {
+        return NULL;
+    }
+
+    return &cache;
+}
+
+void SlabPool::unlock_cache_(ThreadCache& cache) {
+    AtomicOps::store_release(cache.busy, 0);
+}
+
+void SlabPool::refill_cache_(ThreadCache& cache) {
+    Mutex::Lock lock(mutex_);
+
+    while (cache.n_slots < CacheSize / 2) {
+        Slot* slot = acquire_slot_();
+        if (slot == NULL) {
+            break;
+        }
+        cache.slots[cache.n_slots++] = slot;
+    }
+}
+
+void SlabPool::flush_cache_(ThreadCache& cache, size_t n_slots) {
+    roc_panic_if(n_slots > cache.n_slots);
+
+    if (n_slots == 0) {
+        return;
+    }
+
+    Mutex::Lock lock(mutex_);
+
+    while (n_slots-- > 0) {
+        release_slot_(cache.slots[--cache.n_slots]);
+    }
+}
+
+void SlabPool::steal_cached_slots_() {
+    for (size_t n = 0; n < NumCaches; n++) {
+        ThreadCache& cache = caches_[n];
+
+        // mutex is held, and thread using cache may wait for mutex in
+        // refill or flush, so skip busy caches instead of waiting
+        if (AtomicOps::exchange_acquire(cache.busy, 1) != 0) {
+            continue;
+        }
+
+        while (cache.n_slots > 0) {
+            release_slot_(cache.slots[--cache.n_slots]);
+        }
+
+        unlock_cache_(cache);
+    }
+}
+
 void* SlabPool::give_slot_to_user_(Slot* slot) {
     slot->~Slot();
 
@@ -116,6 +255,9 @@ SlabPool::Slot* SlabPool::acquire_slot_() {
     if (slot != NULL) {
         free_slots_.remove(*slot);
         n_used_slots_++;
+        if (n_peak_used_slots_ < n_used_slots_) {
+            n_peak_used_slots_ = n_used_slots_;
+        }
     }
 
     return slot;
@@ -160,7 +302,16 @@ void SlabPool::increase_slab_size_(size_t desired_slots) {
 }
 
 bool SlabPool::allocate_new_slab_() {
-    const size_t slab_size_bytes = slot_offset_(slab_cur_slots_);
+    size_t n_slots = slab_cur_slots_;
+
+    if (max_total_slots_ != 0) {
+        if (n_total_slots_ >= max_total_slots_) {
+            return false;
+        }
+        n_slots = std::min(n_slots, max_total_slots_ - n_total_slots_);
+    }
+
+    const size_t slab_size_bytes = slot_offset_(n_slots);
 
     void* memory = allocator_.allocate(slab_size_bytes);
     if (memory == NULL) {
@@ -170,11 +321,15 @@ bool SlabPool::allocate_new_slab_() {
     Slab* slab = new (memory) Slab;
     slabs_.push_back(*slab);
 
-    for (size_t n = 0; n < slab_cur_slots_; n++) {
+    for (size_t n = 0; n < n_slots; n++) {
         Slot* slot = new ((char*)slab + slot_offset_(n)) Slot;
         free_slots_.push_back(*slot);
     }
 
+    n_total_slots_ += n_slots;
+    n_slabs_++;
+    n_slab_bytes_ += slab_size_bytes;
+
     increase_slab_size_(slab_cur_slots_ * 2);
     return true;
 }
@@ -12,6 +12,8 @@
 #ifndef ROC_CORE_SLAB_POOL_H_
 #define ROC_CORE_SLAB_POOL_H_
 
+#include "roc_core/atomic.h"
+#include "roc_core/cache_aligned.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
 #include "roc_core/mutex.h"
@@ -21,6 +23,42 @@
 namespace roc {
 namespace core {
 
+//! Slab pool statistics.
+struct SlabPoolStats {
+    //! Number of slabs allocated from allocator.
+    size_t num_slabs;
+
+    //! Number of bytes allocated from allocator.
+    size_t num_bytes;
+
+    //! Total number of slots in all slabs.
+    size_t total_slots;
+
+    //! Number of slots currently in use.
+    //! @remarks
+    //!  Slots kept in per-thread caches are counted as used.
+    size_t used_slots;
+
+    //! Number of currently free slots.
+    size_t free_slots;
+
+    //! Maximum number of slots that were in use at the same time.
+    size_t peak_used_slots;
+
+    //! Number of allocations failed because of limit or allocator failure.
+    size_t failed_allocations;
+
+    SlabPoolStats()
+        : num_slabs(0)
+        , num_bytes(0)
+        , total_slots(0)
+        , used_slots(0)
+        , free_slots(0)
+        , peak_used_slots(0)
+        , failed_allocations(0) {
+    }
+};
+
 //! Slab pool.
 //!
 //! Allocates large chunks of memory ("slabs") from given allocator suitable to hold
@@ -32,7 +70,15 @@ namespace core {
 //! Automatically grows size of new slabs exponentially. The user can also specify the
 //! minimum and maximum limits for the slab.
 //!
+//! Optionally, the total number of slots may be limited. When the limit is reached,
+//! allocations fail until some slots are returned to the pool.
+//!
 //! The return memory is always maximum aligned. Thread-safe.
+//!
+//! Optionally, keeps per-thread caches ("magazines") of free slots in front of
+//! the shared list of free slots. Threads allocate and deallocate slots using
+//! their own cache without locking the pool mutex, and the cache is refilled
+//! from or flushed to the shared list in batches.
 class SlabPool : public NonCopyable<> {
 public:
     //! Initialize.
@@ -43,11 +89,13 @@ public:
     //!  - @p min_alloc_bytes defines minimum size in bytes per request to allocator
     //!  - @p max_alloc_bytes defines maximum size in bytes per request to allocator
     //!  - @p poison enables memory poisoning for debugging
+    //!  - @p thread_cache enables per-thread caches of free slots
     SlabPool(IAllocator& allocator,
              size_t object_size,
              bool poison,
              size_t min_alloc_bytes = 0,
-             size_t max_alloc_bytes = 0);
+             size_t max_alloc_bytes = 0,
+             bool thread_cache = false);
 
     //! Deinitialize.
     ~SlabPool();
@@ -60,6 +108,20 @@ public:
     //!  false if allocation failed.
     bool reserve(size_t n_objects);
 
+    //! Limit total number of objects in pool.
+    //! @remarks
+    //!  Limits the number of slots allocated from the allocator, including the
+    //!  ones already reserved. Zero means no limit.
+    //!  When thread cache is enabled and the limit is reached, free slots kept
+    //!  in per-thread caches are returned to the pool before allocation fails.
+    void set_limit(size_t max_objects);
+
+    //! Get number of allocations failed because of limit or allocator failure.
+    size_t num_failed_allocations() const;
+
+    //! Get pool statistics.
+    SlabPoolStats stats() const;
+
     //! Allocate memory for an object.
     //! @returns
     //!  pointer to a maximum aligned uninitialized memory for a new object
@@ -82,9 +144,39 @@ private:
     // loudly when trying to play them on sound card.
     enum { PoisonAllocated = 0x7a, PoisonDeallocated = 0x7d };
 
+    // Number of per-thread caches; threads with the same index modulo this
+    // value share one cache.
+    enum { NumCaches = 8 };
+
+    // Maximum number of slots in per-thread cache; refill and flush move half
+    // of this number at once.
+    enum { CacheSize = 32 };
+
     struct Slab : ListNode {};
     struct Slot : ListNode {};
 
+    struct ThreadCache {
+        // non-zero while cache is used by some thread
+        int busy;
+
+        size_t n_slots;
+        Slot* slots[CacheSize];
+
+        // prevent false sharing between caches used from different threads
+        CachePadding pad;
+
+        ThreadCache()
+            : busy(0)
+            , n_slots(0) {
+        }
+    };
+
+    ThreadCache* lock_cache_();
+    void unlock_cache_(ThreadCache& cache);
+    void refill_cache_(ThreadCache& cache);
+    void flush_cache_(ThreadCache& cache, size_t n_slots);
+    void steal_cached_slots_();
+
     void* give_slot_to_user_(Slot* slot);
     Slot* take_slot_from_user_(void* memory);
 
@@ -106,6 +198,13 @@ private:
     List<Slab, NoOwnership> slabs_;
     List<Slot, NoOwnership> free_slots_;
     size_t n_used_slots_;
+    size_t n_peak_used_slots_;
+    size_t n_total_slots_;
+    size_t n_slabs_;
+    size_t n_slab_bytes_;
+    size_t max_total_slots_;
+
+    Atomic<size_t> n_failed_allocs_;
 
     const size_t slab_min_bytes_;
     const size_t slab_max_bytes_;
@@ -118,6 +217,9 @@ private:
 
     const size_t object_size_;
     const bool poison_;
+
+    const bool thread_cache_;
+    ThreadCache caches_[NumCaches];
 };
 
 } // namespace core
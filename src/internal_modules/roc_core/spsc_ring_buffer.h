@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/spsc_ring_buffer.h
+//! @brief Single-producer single-consumer ring buffer.
+
+#ifndef ROC_CORE_SPSC_RING_BUFFER_H_
+#define ROC_CORE_SPSC_RING_BUFFER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/atomic_ops.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Thread-safe lock-free wait-free single-producer single-consumer ring buffer.
+//!
+//! Stores up to a fixed number of elements in memory allocated once during
+//! construction. One thread may write elements and another thread may read them
+//! concurrently, without locks and without blocking. Both operations copy as many
+//! elements as possible and return immediately.
+//!
+//! @tparam T defines element type. It should be trivially copyable, since
+//! elements are copied using memcpy().
+template <class T> class SpscRingBuffer : public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Allocates memory for @p capacity elements.
+    SpscRingBuffer(IAllocator& allocator, size_t capacity)
+        : data_(allocator)
+        , read_pos_(0)
+        , write_pos_(0) {
+        if (capacity == 0) {
+            roc_panic("spsc ring buffer: capacity should be non-zero");
+        }
+        if (!data_.resize(capacity)) {
+            return;
+        }
+    }
+
+    //! Check if the buffer was successfully constructed.
+    bool valid() const {
+        return data_.size() != 0;
+    }
+
+    //! Get maximum number of elements.
+    size_t capacity() const {
+        return data_.size();
+    }
+
+    //! Get number of elements available for reading.
+    //! @remarks
+    //!  May be called from any thread; the result may be outdated.
+    size_t size() const {
+        return AtomicOps::load_acquire(write_pos_) - AtomicOps::load_acquire(read_pos_);
+    }
+
+    //! Copy up to @p n_elems elements from @p elems to the buffer.
+    //! @returns
+    //!  number of copied elements, which is less than @p n_elems if there is not
+    //!  enough free space.
+    //! @note
+    //!  Should be called only from the producer thread.
+    size_t write(const T* elems, size_t n_elems) {
+        roc_panic_if(!valid());
+
+        const size_t rp = AtomicOps::load_acquire(read_pos_);
+        const size_t wp = AtomicOps::load_relaxed(write_pos_);
+
+        const size_t n_free = data_.size() - (wp - rp);
+        if (n_elems > n_free) {
+            n_elems = n_free;
+        }
+
+        copy_to_ring_(wp, elems, n_elems);
+
+        // publish elements to consumer
+        AtomicOps::store_release(write_pos_, wp + n_elems);
+
+        return n_elems;
+    }
+
+    //! Copy up to @p n_elems elements from the buffer to @p elems.
+    //! @returns
+    //!  number of copied elements, which is less than @p n_elems if there is not
+    //!  enough elements in the buffer.
+    //! @note
+    //!  Should be called only from the consumer thread.
+    size_t read(T* elems, size_t n_elems) {
+        roc_panic_if(!valid());
+
+        const size_t wp = AtomicOps::load_acquire(write_pos_);
+        const size_t rp = AtomicOps::load_relaxed(read_pos_);
+
+        if (n_elems > wp - rp) {
+            n_elems = wp - rp;
+        }
+
+        copy_from_ring_(rp, elems, n_elems);
+
+        // release space to producer
+        AtomicOps::store_release(read_pos_, rp + n_elems);
+
+        return n_elems;
+    }
+
+private:
+    void copy_to_ring_(size_t pos, const T* elems, size_t n_elems) {
+        T* ring = data_.data();
+
+        const size_t off = pos % data_.size();
+        const size_t n_first = ROC_MIN(n_elems, data_.size() - off);
+
+        memcpy(ring + off, elems, n_first * sizeof(T));
+        memcpy(ring, elems + n_first, (n_elems - n_first) * sizeof(T));
+    }
+
+    void copy_from_ring_(size_t pos, T* elems, size_t n_elems) {
+        const T* ring = data_.data();
+
+        const size_t off = pos % data_.size();
+        const size_t n_first = ROC_MIN(n_elems, data_.size() - off);
+
+        memcpy(elems, ring + off, n_first * sizeof(T));
+        memcpy(elems + n_first, ring, (n_elems - n_first) * sizeof(T));
+    }
+
+    Array<T> data_;
+
+    // positions only grow; index in ring is position modulo capacity
+    size_t read_pos_;
+    size_t write_pos_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_SPSC_RING_BUFFER_H_
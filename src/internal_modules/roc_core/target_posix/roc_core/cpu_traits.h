@@ -183,4 +183,42 @@
 #define ROC_CPU_BITS 32
 #endif
 
+//! Value of ROC_CPU_FAMILY indicating unknown CPU family.
+#define ROC_CPU_FAMILY_UNKNOWN 0
+
+//! Value of ROC_CPU_FAMILY indicating x86 or x86_64 CPU.
+#define ROC_CPU_FAMILY_X86 1
+
+//! Value of ROC_CPU_FAMILY indicating 32-bit or 64-bit ARM CPU.
+#define ROC_CPU_FAMILY_ARM 2
+
+// Detect CPU family.
+
+#ifndef ROC_CPU_FAMILY
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_AMD64)     \
+    || defined(_M_IX86)
+#define ROC_CPU_FAMILY ROC_CPU_FAMILY_X86
+#elif defined(__aarch64__) || defined(__arm__) || defined(_M_ARM) || defined(_M_ARM64)
+#define ROC_CPU_FAMILY ROC_CPU_FAMILY_ARM
+#else
+#define ROC_CPU_FAMILY ROC_CPU_FAMILY_UNKNOWN
+#endif
+#endif
+
+// Detect CPU cache line size.
+//
+// This is the size used to separate data written by different threads, so if
+// the exact value is unknown, it's better to overestimate it. Apple ARM and
+// 64-bit POWER CPUs have 128-byte lines; 64 bytes is used for everything else.
+
+#ifndef ROC_CPU_CACHE_LINE
+#if defined(__APPLE__) && defined(__aarch64__)
+#define ROC_CPU_CACHE_LINE 128
+#elif defined(__powerpc64__) || defined(__ppc64__)
+#define ROC_CPU_CACHE_LINE 128
+#else
+#define ROC_CPU_CACHE_LINE 64
+#endif
+#endif
+
 #endif // ROC_CORE_CPU_TRAITS_H_
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "roc_core/align_ops.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/mmap_allocator.h"
+#include "roc_core/panic.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+namespace roc {
+namespace core {
+
+namespace {
+
+size_t get_page_size() {
+    const long sz = sysconf(_SC_PAGESIZE);
+    if (sz <= 0) {
+        return 4096;
+    }
+    return (size_t)sz;
+}
+
+} // namespace
+
+MmapAllocator::MmapAllocator(bool hugepages, bool lock_memory)
+    : page_size_(get_page_size())
+    , header_size_(AlignOps::align_max(sizeof(Header)))
+    , hugepages_(hugepages)
+    , lock_memory_(lock_memory)
+    , num_allocations_(0)
+    , num_mapped_(0) {
+    roc_log(LogDebug, "mmap allocator: initializing: page_size=%lu hugepages=%d mlock=%d",
+            (unsigned long)page_size_, (int)hugepages, (int)lock_memory);
+}
+
+MmapAllocator::~MmapAllocator() {
+    if (num_allocations_ != 0) {
+        roc_panic("mmap allocator: detected leak(s): %d objects was not freed",
+                  (int)num_allocations_);
+    }
+}
+
+bool MmapAllocator::lock_all_memory() {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        roc_log(LogError, "mmap allocator: can't lock process memory: mlockall(): %s",
+                errno_to_str().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+size_t MmapAllocator::num_allocations() const {
+    return (size_t)num_allocations_;
+}
+
+size_t MmapAllocator::num_mapped_allocations() const {
+    return (size_t)num_mapped_;
+}
+
+void* MmapAllocator::allocate(size_t size) {
+    const size_t total_size = header_size_ + size;
+
+    void* memory = NULL;
+    size_t map_size = 0;
+
+    if (total_size >= MinMapSize) {
+        memory = map_(total_size, map_size);
+    }
+
+    if (memory) {
+        ++num_mapped_;
+    } else {
+        // small block or mmap() failed
+        memory = new char[total_size];
+        if (!memory) {
+            return NULL;
+        }
+    }
+
+    Header* header = (Header*)memory;
+    header->map_size = map_size;
+    header->mapped = (map_size != 0);
+
+    ++num_allocations_;
+
+    return (char*)memory + header_size_;
+}
+
+void MmapAllocator::deallocate(void* ptr) {
+    if (ptr == NULL) {
+        roc_panic("mmap allocator: deallocating null pointer");
+    }
+
+    if (num_allocations_ <= 0) {
+        roc_panic("mmap allocator: unpaired deallocate");
+    }
+    --num_allocations_;
+
+    Header* header = (Header*)((char*)ptr - header_size_);
+
+    if (!header->mapped) {
+        delete[](char*) header;
+        return;
+    }
+
+    --num_mapped_;
+
+    if (munmap(header, header->map_size) != 0) {
+        roc_panic("mmap allocator: munmap(): %s", errno_to_str().c_str());
+    }
+}
+
+void* MmapAllocator::map_(size_t size, size_t& map_size) {
+    void* memory = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    // smaller blocks would waste most of the huge page
+    if (hugepages_ && size >= HugePageSize) {
+        map_size = AlignOps::align_as(size, HugePageSize);
+
+        memory = mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+        if (memory == MAP_FAILED) {
+            roc_log(LogDebug,
+                    "mmap allocator: can't map huge pages, falling back to regular"
+                    " pages: size=%lu: %s",
+                    (unsigned long)map_size, errno_to_str().c_str());
+        }
+    }
+#endif
+
+    if (memory == MAP_FAILED) {
+        map_size = AlignOps::align_as(size, page_size_);
+
+        memory = mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (memory == MAP_FAILED) {
+            roc_log(LogError, "mmap allocator: mmap(): size=%lu: %s",
+                    (unsigned long)map_size, errno_to_str().c_str());
+            map_size = 0;
+            return NULL;
+        }
+
+#if defined(MADV_HUGEPAGE)
+        if (hugepages_) {
+            // ask kernel to back the region with transparent huge pages
+            (void)madvise(memory, map_size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    if (lock_memory_) {
+        // also prefaults all pages
+        if (mlock(memory, map_size) != 0) {
+            roc_log(LogDebug, "mmap allocator: can't lock memory: size=%lu: %s",
+                    (unsigned long)map_size, errno_to_str().c_str());
+        }
+    }
+
+    return memory;
+}
+
+} // namespace core
+} // namespace roc
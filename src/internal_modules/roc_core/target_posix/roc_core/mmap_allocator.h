@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/mmap_allocator.h
+//! @brief Mmap allocator implementation.
+
+#ifndef ROC_CORE_MMAP_ALLOCATOR_H_
+#define ROC_CORE_MMAP_ALLOCATOR_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Mmap allocator implementation.
+//!
+//! Maps large blocks directly from the OS using mmap(), and allocates small
+//! blocks from heap. Intended to be used as backend for slab pools, which
+//! allocate memory in large chunks.
+//!
+//! Optionally, uses huge pages for large blocks, which reduces TLB misses
+//! when many objects are accessed. Blocks of huge page size or larger are
+//! mapped with MAP_HUGETLB, if supported; other blocks, or if there are no
+//! free huge pages, use regular pages with transparent huge pages hint.
+//!
+//! Optionally, locks mapped blocks in memory using mlock(), so that accessing
+//! them never causes page faults.
+//!
+//! The memory is always maximum aligned. Thread-safe.
+class MmapAllocator : public IAllocator, public NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p hugepages enables huge pages for mapped blocks
+    //!  - @p lock_memory enables locking mapped blocks in memory
+    MmapAllocator(bool hugepages, bool lock_memory);
+
+    ~MmapAllocator();
+
+    //! Lock all current and future memory of the process.
+    //! @remarks
+    //!  Uses mlockall(), so that no memory of the process, including heap and
+    //!  thread stacks, is ever paged out.
+    //! @returns
+    //!  false if memory can't be locked, e.g. because of limits.
+    static bool lock_all_memory();
+
+    //! Get number of allocated blocks.
+    size_t num_allocations() const;
+
+    //! Get number of blocks allocated using mmap().
+    size_t num_mapped_allocations() const;
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void*);
+
+private:
+    // Blocks smaller than this are allocated from heap.
+    enum { MinMapSize = 64 * 1024 };
+
+    // Size of huge page used with MAP_HUGETLB.
+    enum { HugePageSize = 2 * 1024 * 1024 };
+
+    struct Header {
+        size_t map_size;
+        bool mapped;
+    };
+
+    void* map_(size_t size, size_t& map_size);
+
+    const size_t page_size_;
+    const size_t header_size_;
+
+    const bool hugepages_;
+    const bool lock_memory_;
+
+    Atomic<int> num_allocations_;
+    Atomic<int> num_mapped_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_MMAP_ALLOCATOR_H_
@@ -14,8 +14,10 @@
 #include <lwp.h>
 #endif
 
+#include <sched.h>
 #include <unistd.h>
 
+#include "roc_core/atomic_ops.h"
 #include "roc_core/errno_to_str.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
@@ -24,6 +26,16 @@
 namespace roc {
 namespace core {
 
+namespace {
+
+// Number of threads that called get_index().
+size_t thread_counter;
+
+// Index of current thread plus one, or zero if not assigned yet.
+__thread size_t thread_index;
+
+} // namespace
+
 uint64_t Thread::get_pid() {
     return (uint64_t)getpid();
 }
@@ -46,6 +58,14 @@ uint64_t Thread::get_tid() {
 #endif
 }
 
+size_t Thread::get_index() {
+    if (thread_index == 0) {
+        thread_index = AtomicOps::fetch_add_relaxed(thread_counter, (size_t)1) + 1;
+    }
+
+    return thread_index - 1;
+}
+
 bool Thread::set_realtime() {
     sched_param param;
     memset(&param, 0, sizeof(param));
@@ -61,11 +81,67 @@ bool Thread::set_realtime() {
     return true;
 }
 
+bool Thread::set_config(const ThreadConfig& config) {
+    bool ok = true;
+
+    if (config.policy != ThreadPolicy_Default) {
+        const int policy = config.policy == ThreadPolicy_Fifo ? SCHED_FIFO : SCHED_RR;
+
+        sched_param param;
+        memset(&param, 0, sizeof(param));
+        param.sched_priority =
+            config.priority ? config.priority : sched_get_priority_max(policy);
+
+        if (int err = pthread_setschedparam(pthread_self(), policy, &param)) {
+            roc_log(LogError,
+                    "thread: can't set scheduling policy: policy=%s priority=%d:"
+                    " pthread_setschedparam(): %s",
+                    policy == SCHED_FIFO ? "fifo" : "rr", param.sched_priority,
+                    errno_to_str(err).c_str());
+            ok = false;
+        }
+    }
+
+    if (config.cpu_mask != 0) {
+#if defined(__linux__) && defined(CPU_SET)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+
+        for (size_t n = 0; n < 64 && n < CPU_SETSIZE; n++) {
+            if (config.cpu_mask & ((uint64_t)1 << n)) {
+                CPU_SET(n, &cpu_set);
+            }
+        }
+
+        if (int err =
+                pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set)) {
+            roc_log(LogError,
+                    "thread: can't set cpu affinity: mask=0x%llx:"
+                    " pthread_setaffinity_np(): %s",
+                    (unsigned long long)config.cpu_mask, errno_to_str(err).c_str());
+            ok = false;
+        }
+#else
+        roc_log(LogError,
+                "thread: can't set cpu affinity: not supported on this platform");
+        ok = false;
+#endif
+    }
+
+    return ok;
+}
+
 Thread::Thread()
     : started_(0)
     , joinable_(0) {
 }
 
+Thread::Thread(const ThreadConfig& config)
+    : config_(config)
+    , started_(0)
+    , joinable_(0) {
+}
+
 Thread::~Thread() {
     if (joinable()) {
         roc_panic("thread: thread was not joined before calling destructor");
@@ -111,7 +187,13 @@ void Thread::join() {
 }
 
 void* Thread::thread_runner_(void* ptr) {
-    static_cast<Thread*>(ptr)->run();
+    Thread& self = *static_cast<Thread*>(ptr);
+
+    if (self.config_.policy != ThreadPolicy_Default || self.config_.cpu_mask != 0) {
+        (void)set_config(self.config_);
+    }
+
+    self.run();
     return NULL;
 }
 
@@ -22,6 +22,40 @@
 namespace roc {
 namespace core {
 
+//! Thread scheduling policy.
+enum ThreadPolicy {
+    //! Default scheduling policy of the system.
+    ThreadPolicy_Default,
+
+    //! Realtime first-in first-out scheduling (SCHED_FIFO).
+    ThreadPolicy_Fifo,
+
+    //! Realtime round-robin scheduling (SCHED_RR).
+    ThreadPolicy_RoundRobin
+};
+
+//! Thread scheduling parameters.
+struct ThreadConfig {
+    //! Scheduling policy.
+    ThreadPolicy policy;
+
+    //! Realtime priority.
+    //! Ignored for default policy.
+    //! Zero means maximum priority allowed for the policy.
+    int priority;
+
+    //! CPU affinity mask.
+    //! N-th bit allows thread to run on N-th CPU.
+    //! Zero means no affinity.
+    uint64_t cpu_mask;
+
+    ThreadConfig()
+        : policy(ThreadPolicy_Default)
+        , priority(0)
+        , cpu_mask(0) {
+    }
+};
+
 //! Base class for thread objects.
 class Thread : public NonCopyable<Thread> {
 public:
@@ -31,9 +65,22 @@ public:
     //! Get numeric identifier of current thread.
     static uint64_t get_tid();
 
+    //! Get small sequential index of current thread.
+    //! @remarks
+    //!  Indices are assigned to threads on first call, starting from zero.
+    //!  Unlike get_tid(), doesn't perform system calls and is cheap enough
+    //!  to be used on hot paths.
+    static size_t get_index();
+
     //! Raise current thread priority to realtime.
     static bool set_realtime();
 
+    //! Apply scheduling parameters to current thread.
+    //! @returns
+    //!  false if some of the parameters can't be applied, e.g. because
+    //!  of insufficient privileges.
+    static bool set_config(const ThreadConfig& config);
+
     //! Check if thread was started and can be joined.
     //! @returns
     //!  true if start() was called and join() was not called yet.
@@ -52,14 +99,22 @@ public:
 protected:
     virtual ~Thread();
 
+    //! Initialize with default scheduling parameters.
     Thread();
 
+    //! Initialize with given scheduling parameters.
+    //! @remarks
+    //!  Parameters are applied to the new thread when it's started.
+    explicit Thread(const ThreadConfig& config);
+
     //! Method to be executed in thread.
     virtual void run() = 0;
 
 private:
     static void* thread_runner_(void* ptr);
 
+    const ThreadConfig config_;
+
     pthread_t thread_;
 
     int started_;
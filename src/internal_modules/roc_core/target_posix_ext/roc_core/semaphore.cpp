@@ -39,9 +39,18 @@ bool Semaphore::timed_wait(nanoseconds_t deadline) {
     }
 
     for (;;) {
+        // deadline is in monotonic clock domain, but sem_timedwait() expects
+        // absolute time in CLOCK_REALTIME domain
+        const nanoseconds_t rt_deadline =
+            deadline - timestamp(ClockMonotonic) + timestamp(ClockUnix);
+
+        if (rt_deadline < 0) {
+            return false;
+        }
+
         timespec ts;
-        ts.tv_sec = long(deadline / Second);
-        ts.tv_nsec = long(deadline % Second);
+        ts.tv_sec = long(rt_deadline / Second);
+        ts.tv_nsec = long(rt_deadline % Second);
 
         if (sem_timedwait(&sem_, &ts) == 0) {
             return true;
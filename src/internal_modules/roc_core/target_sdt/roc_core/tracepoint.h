@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_sdt/roc_core/tracepoint.h
+//! @brief Static tracepoints.
+
+#ifndef ROC_CORE_TRACEPOINT_H_
+#define ROC_CORE_TRACEPOINT_H_
+
+#include <sys/sdt.h>
+
+//! Static tracepoint.
+//!
+//! @b Parameters
+//!  - first argument is tracepoint name
+//!  - other arguments, up to 12, are integers or pointers passed to tracer
+//!
+//! Expands to USDT probe "roc:<name>" which can be attached to by tools like
+//! bpftrace, perf, or SystemTap. When no tracer is attached, the probe site is
+//! a single nop instruction, but the arguments are still evaluated.
+#define roc_tracepoint(...) STAP_PROBEV(roc, __VA_ARGS__)
+
+#endif // ROC_CORE_TRACEPOINT_H_
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/task_scheduler.h"
+#include "roc_core/atomic_ops.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+// Sleeping threads wake up at least this often, in case they missed a wakeup.
+const nanoseconds_t WorkerPollInterval = 10 * Millisecond;
+const nanoseconds_t JoinPollInterval = Millisecond;
+
+const size_t NoThreadIndex = (size_t)-1;
+
+// Tasks without deadline go after tasks with deadline.
+bool has_earlier_deadline(nanoseconds_t a, nanoseconds_t b) {
+    return a != 0 && (b == 0 || a < b);
+}
+
+} // namespace
+
+SchedulerTask::SchedulerTask()
+    : state_(StateIdle)
+    , deadline_(0) {
+}
+
+SchedulerTask::~SchedulerTask() {
+    if (state_ == StateScheduled) {
+        roc_panic("task scheduler: attempt to destroy task which is still scheduled");
+    }
+}
+
+bool SchedulerTask::finished() const {
+    return state_ == StateFinished;
+}
+
+nanoseconds_t SchedulerTask::deadline() const {
+    return deadline_;
+}
+
+TaskScheduler::Worker::Worker(TaskScheduler& sched,
+                              const ThreadConfig& config,
+                              IAllocator& allocator,
+                              size_t queue_size)
+    : Thread(config)
+    , sched_(sched)
+    , deque_(allocator, queue_size)
+    , thread_index_(NoThreadIndex) {
+}
+
+TaskScheduler::Worker::~Worker() {
+}
+
+bool TaskScheduler::Worker::valid() const {
+    return deque_.valid();
+}
+
+size_t TaskScheduler::Worker::thread_index() const {
+    return AtomicOps::load_acquire(thread_index_);
+}
+
+WorkStealingDeque<SchedulerTask>& TaskScheduler::Worker::deque() {
+    return deque_;
+}
+
+void TaskScheduler::Worker::run() {
+    AtomicOps::store_release(thread_index_, Thread::get_index());
+
+    sched_.worker_loop_(*this);
+}
+
+TaskScheduler::TaskScheduler(size_t num_threads,
+                             const ThreadConfig& thread_config,
+                             IAllocator& allocator,
+                             size_t queue_size)
+    : allocator_(allocator)
+    , workers_(allocator)
+    , shared_size_(0)
+    , n_sleeping_(0)
+    , n_joiners_(0)
+    , steal_pos_(0)
+    , n_late_(0)
+    , stop_(0)
+    , valid_(false) {
+    roc_log(LogDebug, "task scheduler: initializing: num_threads=%lu queue_size=%lu",
+            (unsigned long)num_threads, (unsigned long)queue_size);
+
+    if (!workers_.grow(num_threads)) {
+        roc_log(LogError, "task scheduler: can't allocate workers");
+        return;
+    }
+
+    for (size_t n = 0; n < num_threads; n++) {
+        Worker* worker = new (allocator_) Worker(*this, thread_config, allocator_,
+                                                 queue_size);
+        if (!worker) {
+            roc_log(LogError, "task scheduler: can't allocate worker");
+            return;
+        }
+
+        if (!worker->valid()) {
+            roc_log(LogError, "task scheduler: can't allocate worker deque");
+            allocator_.destroy_object(*worker);
+            return;
+        }
+
+        workers_.push_back(worker);
+    }
+
+    // Start threads only after all workers are created, since workers
+    // access each other's deques.
+    for (size_t n = 0; n < workers_.size(); n++) {
+        if (!workers_[n]->start()) {
+            roc_log(LogError, "task scheduler: can't start worker thread");
+            return;
+        }
+    }
+
+    valid_ = true;
+}
+
+TaskScheduler::~TaskScheduler() {
+    stop_workers_();
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        allocator_.destroy_object(*workers_[n]);
+    }
+}
+
+bool TaskScheduler::valid() const {
+    return valid_;
+}
+
+size_t TaskScheduler::num_threads() const {
+    return workers_.size();
+}
+
+size_t TaskScheduler::num_late_tasks() const {
+    return n_late_;
+}
+
+void TaskScheduler::schedule(SchedulerTask& task, nanoseconds_t deadline) {
+    roc_panic_if(!valid_);
+
+    if (task.state_ == SchedulerTask::StateScheduled) {
+        roc_panic("task scheduler: attempt to schedule task which is already scheduled");
+    }
+
+    task.deadline_ = deadline;
+    task.state_ = SchedulerTask::StateScheduled;
+
+    if (Worker* worker = current_worker_()) {
+        if (!worker->deque().push(&task)) {
+            // Deque is full, no point in queueing more.
+            execute_(task);
+            return;
+        }
+    } else {
+        push_shared_(task);
+    }
+
+    wakeup_workers_();
+}
+
+bool TaskScheduler::join(SchedulerTask& task, nanoseconds_t deadline) {
+    roc_panic_if(!valid_);
+
+    if (task.state_ == SchedulerTask::StateIdle) {
+        roc_panic("task scheduler: attempt to join task which is not scheduled");
+    }
+
+    Worker* worker = current_worker_();
+
+    for (;;) {
+        if (task.state_ == SchedulerTask::StateFinished) {
+            return true;
+        }
+
+        const nanoseconds_t now = timestamp(ClockMonotonic);
+
+        if (deadline != 0 && now >= deadline) {
+            return false;
+        }
+
+        // Help other threads instead of sleeping.
+        if (SchedulerTask* other = fetch_task_(worker)) {
+            execute_(*other);
+            continue;
+        }
+
+        // Task is being executed by another thread, wait until it finishes.
+        n_joiners_++;
+
+        if (task.state_ != SchedulerTask::StateFinished) {
+            nanoseconds_t wait_deadline = now + JoinPollInterval;
+            if (deadline != 0 && deadline < wait_deadline) {
+                wait_deadline = deadline;
+            }
+            (void)done_sem_.timed_wait(wait_deadline);
+        }
+
+        n_joiners_--;
+    }
+}
+
+void TaskScheduler::worker_loop_(Worker& worker) {
+    roc_log(LogDebug, "task scheduler: starting worker thread");
+
+    while (!stop_) {
+        if (SchedulerTask* task = fetch_task_(&worker)) {
+            execute_(*task);
+            continue;
+        }
+
+        n_sleeping_++;
+
+        // Re-check after announcing that we're sleeping, pairs with the fence
+        // in wakeup_workers_().
+        AtomicOps::fence_seq_cst();
+
+        if (!stop_ && !has_work_()) {
+            (void)work_sem_.timed_wait(timestamp(ClockMonotonic) + WorkerPollInterval);
+        }
+
+        n_sleeping_--;
+    }
+
+    roc_log(LogDebug, "task scheduler: finishing worker thread");
+}
+
+TaskScheduler::Worker* TaskScheduler::current_worker_() const {
+    const size_t index = Thread::get_index();
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        if (workers_[n]->thread_index() == index) {
+            return workers_[n];
+        }
+    }
+
+    return NULL;
+}
+
+SchedulerTask* TaskScheduler::fetch_task_(Worker* worker) {
+    // Own tasks first, they're likely still in cache.
+    if (worker) {
+        if (SchedulerTask* task = worker->deque().pop()) {
+            return task;
+        }
+    }
+
+    if (SchedulerTask* task = pop_shared_()) {
+        return task;
+    }
+
+    return steal_(worker);
+}
+
+SchedulerTask* TaskScheduler::pop_shared_() {
+    if (shared_size_ == 0) {
+        return NULL;
+    }
+
+    Mutex::Lock lock(shared_mutex_);
+
+    SchedulerTask* task = shared_queue_.front();
+    if (task) {
+        shared_queue_.remove(*task);
+        shared_size_--;
+    }
+
+    return task;
+}
+
+SchedulerTask* TaskScheduler::steal_(Worker* worker) {
+    const size_t n_workers = workers_.size();
+    if (n_workers == 0) {
+        return NULL;
+    }
+
+    // Start from different victims to spread contention.
+    const size_t start = steal_pos_++;
+
+    for (size_t n = 0; n < n_workers; n++) {
+        Worker* victim = workers_[(start + n) % n_workers];
+        if (victim == worker) {
+            continue;
+        }
+
+        if (SchedulerTask* task = victim->deque().steal()) {
+            return task;
+        }
+    }
+
+    return NULL;
+}
+
+bool TaskScheduler::has_work_() {
+    if (shared_size_ != 0) {
+        return true;
+    }
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        if (workers_[n]->deque().size() != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TaskScheduler::push_shared_(SchedulerTask& task) {
+    Mutex::Lock lock(shared_mutex_);
+
+    // Keep queue sorted by deadline; tasks with the same deadline are FIFO.
+    for (SchedulerTask* pos = shared_queue_.front(); pos;
+         pos = shared_queue_.nextof(*pos)) {
+        if (has_earlier_deadline(task.deadline_, pos->deadline_)) {
+            shared_queue_.insert_before(task, *pos);
+            shared_size_++;
+            return;
+        }
+    }
+
+    shared_queue_.push_back(task);
+    shared_size_++;
+}
+
+void TaskScheduler::execute_(SchedulerTask& task) {
+    task.execute();
+
+    if (task.deadline_ != 0 && timestamp(ClockMonotonic) > task.deadline_) {
+        n_late_++;
+    }
+
+    task.state_ = SchedulerTask::StateFinished;
+
+    wakeup_joiners_();
+}
+
+void TaskScheduler::wakeup_workers_() {
+    // Pairs with the fence in worker_loop_().
+    AtomicOps::fence_seq_cst();
+
+    if (n_sleeping_ > 0) {
+        work_sem_.post();
+    }
+}
+
+void TaskScheduler::wakeup_joiners_() {
+    if (n_joiners_ > 0) {
+        done_sem_.post();
+    }
+}
+
+void TaskScheduler::stop_workers_() {
+    stop_ = 1;
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        work_sem_.post();
+    }
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        if (workers_[n]->joinable()) {
+            workers_[n]->join();
+        }
+    }
+}
+
+} // namespace core
+} // namespace roc
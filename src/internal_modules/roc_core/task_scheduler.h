@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/task_scheduler.h
+//! @brief Work-stealing task scheduler.
+
+#ifndef ROC_CORE_TASK_SCHEDULER_H_
+#define ROC_CORE_TASK_SCHEDULER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+#include "roc_core/work_stealing_deque.h"
+
+namespace roc {
+namespace core {
+
+class TaskScheduler;
+
+//! Task executed by TaskScheduler.
+//! @remarks
+//!  Derived class implements execute(), which is invoked by TaskScheduler on
+//!  one of its threads, or on a thread that waits for a task in join(). Task
+//!  object is owned by the caller and should not be destroyed until it's
+//!  finished.
+class SchedulerTask : public ListNode {
+public:
+    //! Initialize.
+    SchedulerTask();
+
+    virtual ~SchedulerTask();
+
+    //! Check if task was executed.
+    //! @remarks
+    //!  Thread-safe. Returns false if task was never scheduled.
+    bool finished() const;
+
+    //! Get task deadline hint.
+    //! @remarks
+    //!  Zero if task has no deadline.
+    nanoseconds_t deadline() const;
+
+protected:
+    //! Perform work.
+    virtual void execute() = 0;
+
+private:
+    friend class TaskScheduler;
+
+    enum State { StateIdle, StateScheduled, StateFinished };
+
+    Atomic<int> state_;
+    nanoseconds_t deadline_;
+};
+
+//! Work-stealing task scheduler.
+//!
+//! Executes tasks on a pool of background threads. Intended to be shared by
+//! components that need to fan out work and collect results within a deadline,
+//! e.g. per-session processing or FEC decoding.
+//!
+//! Every worker thread has its own lock-free work-stealing deque. Tasks
+//! scheduled from a worker thread, e.g. nested tasks, are pushed to its deque
+//! and are executed by the same worker in LIFO order, unless idle workers steal
+//! them in FIFO order. Tasks scheduled from other threads are put to a shared
+//! queue ordered by deadline hint, so that tasks with earlier deadline are
+//! picked first. Idle workers sleep on a semaphore.
+//!
+//! join() waits for a task until given deadline. While waiting, the calling
+//! thread executes other pending tasks instead of sleeping, so that fanning
+//! out work never makes the caller slower than doing all work itself.
+//!
+//! Thread-safe.
+class TaskScheduler : public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Starts @p num_threads background threads with scheduling parameters
+    //!  from @p thread_config. Every worker deque can hold up to
+    //!  @p queue_size tasks.
+    TaskScheduler(size_t num_threads,
+                  const ThreadConfig& thread_config,
+                  IAllocator& allocator,
+                  size_t queue_size = DefaultQueueSize);
+
+    //! Destroy.
+    //! @remarks
+    //!  Stops and joins background threads. There should be no scheduled
+    //!  tasks at this point.
+    ~TaskScheduler();
+
+    //! Check if the scheduler was successfully constructed.
+    bool valid() const;
+
+    //! Get number of background threads.
+    size_t num_threads() const;
+
+    //! Get number of tasks which were finished after their deadline.
+    size_t num_late_tasks() const;
+
+    //! Enqueue task for execution.
+    //! @remarks
+    //!  @p deadline is a hint, in the same clock as timestamp(ClockMonotonic);
+    //!  tasks are not dropped when it expires. Zero means no deadline; such
+    //!  tasks are picked after tasks with deadline.
+    //!  If the task can't be enqueued because worker deque is full, it is
+    //!  executed immediately on the calling thread.
+    //! @pre
+    //!  Task should not be already scheduled and not finished.
+    void schedule(SchedulerTask& task, nanoseconds_t deadline = 0);
+
+    //! Wait until task is finished, but not longer than until deadline.
+    //! @remarks
+    //!  While waiting, executes pending tasks on the calling thread, including
+    //!  this task if no thread picked it yet. Deadline is checked between
+    //!  tasks; a task which is executing is not interrupted. Zero deadline
+    //!  means wait indefinitely.
+    //! @returns
+    //!  true if the task is finished, false if deadline expired; in the latter
+    //!  case, the task is still scheduled, and join() should be called again
+    //!  before destroying it.
+    //! @pre
+    //!  Task should be scheduled or finished.
+    bool join(SchedulerTask& task, nanoseconds_t deadline = 0);
+
+private:
+    enum { DefaultQueueSize = 256 };
+
+    class Worker : public Thread {
+    public:
+        Worker(TaskScheduler& sched,
+               const ThreadConfig& config,
+               IAllocator& allocator,
+               size_t queue_size);
+
+        virtual ~Worker();
+
+        bool valid() const;
+
+        size_t thread_index() const;
+
+        WorkStealingDeque<SchedulerTask>& deque();
+
+    private:
+        virtual void run();
+
+        TaskScheduler& sched_;
+        WorkStealingDeque<SchedulerTask> deque_;
+
+        // index from Thread::get_index(), accessed using AtomicOps
+        size_t thread_index_;
+    };
+
+    void worker_loop_(Worker& worker);
+
+    Worker* current_worker_() const;
+
+    SchedulerTask* fetch_task_(Worker* worker);
+    SchedulerTask* pop_shared_();
+    SchedulerTask* steal_(Worker* worker);
+    bool has_work_();
+
+    void push_shared_(SchedulerTask& task);
+    void execute_(SchedulerTask& task);
+
+    void wakeup_workers_();
+    void wakeup_joiners_();
+
+    void stop_workers_();
+
+    IAllocator& allocator_;
+
+    Array<Worker*> workers_;
+
+    Mutex shared_mutex_;
+    List<SchedulerTask, NoOwnership> shared_queue_;
+    Atomic<size_t> shared_size_;
+
+    Atomic<int> n_sleeping_;
+    Atomic<int> n_joiners_;
+
+    Semaphore work_sem_;
+    Semaphore done_sem_;
+
+    Atomic<size_t> steal_pos_;
+    Atomic<size_t> n_late_;
+
+    Atomic<int> stop_;
+    bool valid_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_TASK_SCHEDULER_H_
@@ -20,6 +20,10 @@ namespace roc {
 namespace core {
 
 //! Ticker.
+//!
+//! Converts between ticks and monotonic time using exact integer arithmetic.
+//! Deadlines are always computed from the start time rather than accumulated
+//! from previous waits, so rounding and wakeup errors don't add up over time.
 class Ticker : public NonCopyable<> {
 public:
     //! Number of ticks.
@@ -29,20 +33,36 @@ public:
     //! @remarks
     //!  @p freq defines the number of ticks per second.
     explicit Ticker(ticks_t freq)
-        : ratio_(double(freq) / Second)
+        : freq_(freq)
         , start_(0)
         , started_(false) {
+        if (freq == 0 || freq > ticks_t(Second)) {
+            roc_panic("ticker: frequency out of range: freq=%lu", (unsigned long)freq);
+        }
     }
 
     //! Start ticker.
     void start() {
+        start_at(timestamp(ClockMonotonic));
+    }
+
+    //! Start ticker at given time.
+    //! @remarks
+    //!  @p start_time is in the same domain as core::timestamp(ClockMonotonic).
+    //!  It may be in future, then elapsed() returns zero until it comes.
+    void start_at(nanoseconds_t start_time) {
         if (started_) {
             roc_panic("ticker: can't start ticker twice");
         }
-        start_ = timestamp(ClockMonotonic);
+        start_ = start_time;
         started_ = true;
     }
 
+    //! Check if ticker was started.
+    bool started() const {
+        return started_;
+    }
+
     //! Returns number of ticks elapsed since start.
     //! If ticker is not started yet, it is started automatically.
     ticks_t elapsed() {
@@ -50,21 +70,64 @@ public:
             start();
             return 0;
         } else {
-            return ticks_t(double(timestamp(ClockMonotonic) - start_) * ratio_);
+            return ns_2_ticks_(timestamp(ClockMonotonic) - start_);
         }
     }
 
     //! Wait until the given number of ticks elapses since start.
     //! If ticker is not started yet, it is started automatically.
-    void wait(ticks_t ticks) {
+    //! @remarks
+    //!  Uses absolute deadline, so that time spent between waits, e.g. for
+    //!  processing frames, is compensated automatically.
+    //! @returns
+    //!  how late we woke up after the deadline, or zero.
+    nanoseconds_t wait(ticks_t ticks) {
         if (!started_) {
             start();
         }
-        sleep_until(ClockMonotonic, start_ + nanoseconds_t(ticks / ratio_));
+        const nanoseconds_t deadline = start_ + ticks_2_ns_(ticks);
+        sleep_until(ClockMonotonic, deadline);
+
+        const nanoseconds_t delay = timestamp(ClockMonotonic) - deadline;
+        return delay > 0 ? delay : 0;
+    }
+
+    //! Get time left until the given number of ticks elapses since start.
+    //! @remarks
+    //!  Unlike wait(), doesn't block and doesn't start the ticker.
+    //! @returns
+    //!  zero if ticks already elapsed or if ticker is not started yet.
+    nanoseconds_t remaining(ticks_t ticks) const {
+        if (!started_) {
+            return 0;
+        }
+        const nanoseconds_t delay =
+            start_ + ticks_2_ns_(ticks) - timestamp(ClockMonotonic);
+        return delay > 0 ? delay : 0;
     }
 
 private:
-    const double ratio_;
+    // Split into whole seconds and remainder to avoid both overflow and
+    // loss of precision; remainder product fits into 64 bits since both
+    // factors are not greater than one second in nanoseconds.
+    ticks_t ns_2_ticks_(nanoseconds_t ns) const {
+        if (ns <= 0) {
+            return 0;
+        }
+        const ticks_t secs = ticks_t(ns / Second);
+        const ticks_t rem = ticks_t(ns % Second);
+        return secs * freq_ + rem * freq_ / ticks_t(Second);
+    }
+
+    // Rounds up, so that waiting for a tick never returns before it elapses.
+    nanoseconds_t ticks_2_ns_(ticks_t ticks) const {
+        const ticks_t secs = ticks / freq_;
+        const ticks_t rem = ticks % freq_;
+        return nanoseconds_t(secs) * Second
+            + nanoseconds_t((rem * ticks_t(Second) + freq_ - 1) / freq_);
+    }
+
+    const ticks_t freq_;
     nanoseconds_t start_;
     bool started_;
 };
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/work_stealing_deque.h
+//! @brief Work-stealing deque.
+
+#ifndef ROC_CORE_WORK_STEALING_DEQUE_H_
+#define ROC_CORE_WORK_STEALING_DEQUE_H_
+
+#include "roc_core/array.h"
+#include "roc_core/atomic_ops.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Thread-safe lock-free bounded work-stealing deque of pointers.
+//!
+//! Chase-Lev deque, using memory orderings from "Correct and Efficient
+//! Work-Stealing for Weak Memory Models" by Lê et al.
+//!
+//! One thread, the owner, pushes and pops elements at the bottom end, in LIFO
+//! order. Any number of other threads, the thieves, concurrently steal elements
+//! at the top end, in FIFO order. Owner operations don't perform atomic
+//! read-modify-write, except when taking the last element.
+//!
+//! Capacity is fixed and rounded up to a power of two; memory is allocated once
+//! during construction.
+//!
+//! @tparam T defines element type; deque stores pointers to T and doesn't own them.
+template <class T> class WorkStealingDeque : public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Allocates memory for @p capacity elements.
+    WorkStealingDeque(IAllocator& allocator, size_t capacity)
+        : slots_(allocator)
+        , mask_(0)
+        , top_(0)
+        , bottom_(0) {
+        if (capacity == 0) {
+            roc_panic("work stealing deque: capacity should be non-zero");
+        }
+
+        size_t n_slots = 1;
+        while (n_slots < capacity) {
+            n_slots *= 2;
+        }
+
+        if (!slots_.resize(n_slots)) {
+            return;
+        }
+
+        for (size_t n = 0; n < n_slots; n++) {
+            slots_[n] = NULL;
+        }
+
+        mask_ = n_slots - 1;
+    }
+
+    //! Check if the deque was successfully constructed.
+    bool valid() const {
+        return slots_.size() != 0;
+    }
+
+    //! Get maximum number of elements.
+    size_t capacity() const {
+        return slots_.size();
+    }
+
+    //! Get approximate number of elements.
+    //! @remarks
+    //!  May be called from any thread; the result may be outdated.
+    size_t size() const {
+        const size_t t = AtomicOps::load_acquire(top_);
+        const size_t b = AtomicOps::load_acquire(bottom_);
+
+        return (ptrdiff_t)(b - t) > 0 ? b - t : 0;
+    }
+
+    //! Push element to the bottom.
+    //! @returns
+    //!  false if the deque is full.
+    //! @note
+    //!  Should be called only from the owner thread.
+    bool push(T* elem) {
+        roc_panic_if(!valid());
+        roc_panic_if(!elem);
+
+        const size_t b = AtomicOps::load_relaxed(bottom_);
+        const size_t t = AtomicOps::load_acquire(top_);
+
+        if (b - t > mask_) {
+            return false;
+        }
+
+        AtomicOps::store_relaxed(slots_[b & mask_], elem);
+
+        // publish element to thieves
+        AtomicOps::fence_release();
+        AtomicOps::store_relaxed(bottom_, b + 1);
+
+        return true;
+    }
+
+    //! Pop element from the bottom.
+    //! @returns
+    //!  NULL if the deque is empty.
+    //! @note
+    //!  Should be called only from the owner thread.
+    T* pop() {
+        roc_panic_if(!valid());
+
+        const size_t b = AtomicOps::load_relaxed(bottom_) - 1;
+        AtomicOps::store_relaxed(bottom_, b);
+
+        // order bottom store before top load, pairs with fence in steal()
+        AtomicOps::fence_seq_cst();
+
+        size_t t = AtomicOps::load_relaxed(top_);
+
+        if ((ptrdiff_t)(b - t) < 0) {
+            // empty
+            AtomicOps::store_relaxed(bottom_, b + 1);
+            return NULL;
+        }
+
+        T* elem = AtomicOps::load_relaxed(slots_[b & mask_]);
+
+        if (b == t) {
+            // last element, race with thieves
+            if (!AtomicOps::compare_exchange_seq_cst(top_, t, t + 1)) {
+                elem = NULL;
+            }
+            AtomicOps::store_relaxed(bottom_, b + 1);
+        }
+
+        return elem;
+    }
+
+    //! Steal element from the top.
+    //! @returns
+    //!  NULL if the deque is empty or another thread won the race for
+    //!  the element.
+    //! @note
+    //!  May be called from any thread.
+    T* steal() {
+        roc_panic_if(!valid());
+
+        size_t t = AtomicOps::load_acquire(top_);
+
+        // order top load before bottom load, pairs with fence in pop()
+        AtomicOps::fence_seq_cst();
+
+        const size_t b = AtomicOps::load_acquire(bottom_);
+
+        if ((ptrdiff_t)(b - t) <= 0) {
+            return NULL;
+        }
+
+        T* elem = AtomicOps::load_relaxed(slots_[t & mask_]);
+
+        if (!AtomicOps::compare_exchange_seq_cst(top_, t, t + 1)) {
+            return NULL;
+        }
+
+        return elem;
+    }
+
+private:
+    Array<T*> slots_;
+    size_t mask_;
+
+    // positions only grow; index in slots is position modulo capacity
+    size_t top_;
+    size_t bottom_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_WORK_STEALING_DEQUE_H_
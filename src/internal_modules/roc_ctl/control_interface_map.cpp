@@ -8,6 +8,7 @@
 
 #include "roc_ctl/control_interface_map.h"
 #include "roc_core/log.h"
+#include "roc_ctl/rtsp_control_endpoint.h"
 
 namespace roc {
 namespace ctl {
@@ -22,6 +23,21 @@ ControlInterfaceMap::new_endpoint(address::Interface iface,
                                   netio::NetworkLoop& network_loop,
                                   core::IAllocator& allocator) {
     switch (iface) {
+    case address::Iface_Consolidated:
+        switch (proto) {
+        case address::Proto_RTSP:
+            return new (allocator)
+                RtspControlEndpoint(task_queue, network_loop, allocator);
+
+        default:
+            break;
+        }
+
+        roc_log(LogError,
+                "control endpoint map: unsupported protocol %s for interface %s",
+                address::proto_to_str(proto), address::interface_to_str(iface));
+        return NULL;
+
     case address::Iface_AudioControl:
         switch (proto) {
         default:
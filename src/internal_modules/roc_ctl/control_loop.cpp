@@ -86,13 +86,16 @@ ControlLoop::Tasks::DetachSource::DetachSource(EndpointHandle endpoint,
 
 ControlLoop::Tasks::PipelineProcessing::PipelineProcessing(
     pipeline::PipelineLoop& pipeline)
-    : ControlTask(&ControlLoop::task_pipeline_processing_)
+    : ControlTask(&ControlLoop::task_pipeline_processing_, ControlTaskHighPriority)
     , pipeline_(pipeline) {
 }
 
-ControlLoop::ControlLoop(netio::NetworkLoop& network_loop, core::IAllocator& allocator)
+ControlLoop::ControlLoop(netio::NetworkLoop& network_loop,
+                         core::IAllocator& allocator,
+                         const core::ThreadConfig& thread_config)
     : network_loop_(network_loop)
-    , allocator_(allocator) {
+    , allocator_(allocator)
+    , task_queue_(thread_config) {
 }
 
 ControlLoop::~ControlLoop() {
@@ -106,6 +109,12 @@ void ControlLoop::schedule(ControlTask& task, IControlTaskCompleter* completer)
     task_queue_.schedule(task, *this, completer);
 }
 
+void ControlLoop::schedule_batch(ControlTask* const* tasks,
+                                 size_t n_tasks,
+                                 IControlTaskCompleter* completer) {
+    task_queue_.schedule_batch(tasks, n_tasks, *this, completer);
+}
+
 void ControlLoop::schedule_at(ControlTask& task,
                               core::nanoseconds_t deadline,
                               IControlTaskCompleter* completer) {
@@ -160,6 +160,9 @@ public:
         };
 
         //! Process pending pipeline tasks on control thread.
+        //! @remarks
+        //!  Has high priority, so that pipeline tasks and timers (like RTCP report
+        //!  generation) are not delayed by pending endpoint operations.
         class PipelineProcessing : public ControlTask {
         public:
             //! Set task parameters.
@@ -173,7 +176,11 @@ public:
     };
 
     //! Initialize.
-    ControlLoop(netio::NetworkLoop& network_loop, core::IAllocator& allocator);
+    //! @remarks
+    //!  Starts background thread with given scheduling parameters.
+    ControlLoop(netio::NetworkLoop& network_loop,
+                core::IAllocator& allocator,
+                const core::ThreadConfig& thread_config = core::ThreadConfig());
 
     virtual ~ControlLoop();
 
@@ -185,6 +192,13 @@ public:
     //! @see ControlTaskQueue::schedule for details.
     void schedule(ControlTask& task, IControlTaskCompleter* completer);
 
+    //! Enqueue multiple tasks for asynchronous execution as soon as possible.
+    //! @p completer will be invoked on control thread when each task completes.
+    //! @see ControlTaskQueue::schedule_batch for details.
+    void schedule_batch(ControlTask* const* tasks,
+                        size_t n_tasks,
+                        IControlTaskCompleter* completer);
+
     //! Enqueue a task for asynchronous execution at given point of time.
     //! @p deadline defines the absolute point of time when to execute the task.
     //! @p completer will be invoked on control thread when the task completes.
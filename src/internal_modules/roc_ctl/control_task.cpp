@@ -41,6 +41,10 @@ bool ControlTask::cancelled() const {
     return task_flags & FlagCancelled;
 }
 
+ControlTaskPriority ControlTask::priority() const {
+    return priority_;
+}
+
 void ControlTask::validate_flags(unsigned task_flags) {
     roc_panic_if_msg(
         task_flags & FlagDestroyed,
@@ -45,6 +45,16 @@ enum ControlTaskResult {
     ControlTaskPause
 };
 
+//! Control task priority.
+enum ControlTaskPriority {
+    //! Task is executed in order with other normal priority tasks.
+    ControlTaskNormalPriority,
+
+    //! Task is executed before normal priority tasks that are ready at the same time.
+    //! Should be used for short latency-critical tasks, like pipeline processing.
+    ControlTaskHighPriority
+};
+
 //! Control task implementation function.
 //! Holds a pointer to method of a class derived from IControlTaskExecutor.
 typedef ControlTaskResult (IControlTaskExecutor::*ControlTaskFunc)(ControlTask&);
@@ -63,12 +73,17 @@ public:
     //! True if the task cancelled.
     bool cancelled() const;
 
+    //! Get task priority.
+    ControlTaskPriority priority() const;
+
 protected:
     //! Initialize task.
     //! @tparam E is a class derived from IControlTaskExecutor.
     //! @p task_func is a method of E which implements the task.
+    //! @p priority defines order in which ready tasks are fetched from queue.
     template <class E>
-    ControlTask(ControlTaskResult (E::*task_func)(ControlTask&))
+    ControlTask(ControlTaskResult (E::*task_func)(ControlTask&),
+                ControlTaskPriority priority = ControlTaskNormalPriority)
         : state_(StateCompleted)
         , flags_(0)
         , renew_guard_(false)
@@ -76,6 +91,7 @@ protected:
         , renewed_deadline_(0)
         , effective_deadline_(0)
         , effective_version_(0)
+        , priority_(priority)
         , func_(reinterpret_cast<ControlTaskFunc>(task_func))
         , executor_(NULL)
         , completer_(NULL)
@@ -155,6 +171,9 @@ private:
     // version of currently active task deadline
     core::seqlock_version_t effective_version_;
 
+    // defines whether the task goes to high or normal priority ready queue
+    const ControlTaskPriority priority_;
+
     // function to be executed
     ControlTaskFunc func_;
 
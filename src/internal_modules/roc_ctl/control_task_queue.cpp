@@ -14,8 +14,9 @@
 namespace roc {
 namespace ctl {
 
-ControlTaskQueue::ControlTaskQueue()
-    : started_(false)
+ControlTaskQueue::ControlTaskQueue(const core::ThreadConfig& thread_config)
+    : core::Thread(thread_config)
+    , started_(false)
     , stop_(false)
     , fetch_ready_(true)
     , ready_queue_size_(0) {
@@ -43,7 +44,42 @@ void ControlTaskQueue::schedule(ControlTask& task,
 
     setup_task_(task, executor, completer);
 
-    request_renew_(task, 0);
+    if (request_renew_(task, 0)) {
+        wakeup_event_loop_();
+    }
+}
+
+void ControlTaskQueue::schedule_batch(ControlTask* const* tasks,
+                                      size_t n_tasks,
+                                      IControlTaskExecutor& executor,
+                                      IControlTaskCompleter* completer) {
+    if (!valid()) {
+        roc_panic("control task queue: attempt to use invalid queue");
+    }
+
+    if (stop_) {
+        roc_panic("control task queue: attempt to use queue after stop");
+    }
+
+    roc_panic_if(!tasks && n_tasks != 0);
+
+    bool need_wakeup = false;
+
+    // Enqueue all tasks first and wake up event loop thread only once, so that
+    // it will fetch the whole batch at once instead of waking up per task.
+    for (size_t n = 0; n < n_tasks; n++) {
+        roc_panic_if(!tasks[n]);
+
+        setup_task_(*tasks[n], executor, completer);
+
+        if (request_renew_(*tasks[n], 0)) {
+            need_wakeup = true;
+        }
+    }
+
+    if (need_wakeup) {
+        wakeup_event_loop_();
+    }
 }
 
 void ControlTaskQueue::schedule_at(ControlTask& task,
@@ -64,7 +100,9 @@ void ControlTaskQueue::schedule_at(ControlTask& task,
 
     setup_task_(task, executor, completer);
 
-    request_renew_(task, deadline);
+    if (request_renew_(task, deadline)) {
+        wakeup_event_loop_();
+    }
 }
 
 void ControlTaskQueue::resume(ControlTask& task) {
@@ -80,7 +118,9 @@ void ControlTaskQueue::async_cancel(ControlTask& task) {
         roc_panic("control task queue: attempt to use invalid queue");
     }
 
-    request_renew_(task, -1);
+    if (request_renew_(task, -1)) {
+        wakeup_event_loop_();
+    }
 }
 
 void ControlTaskQueue::wait(ControlTask& task) {
@@ -120,6 +160,12 @@ void ControlTaskQueue::stop_thread_() {
     Thread::join();
 }
 
+void ControlTaskQueue::wakeup_event_loop_() {
+    // This wakeup will either succeed or handled by concurrent call to
+    // update_wakeup_timer_().
+    wakeup_timer_.try_set_deadline(0);
+}
+
 void ControlTaskQueue::setup_task_(ControlTask& task,
                                    IControlTaskExecutor& executor,
                                    IControlTaskCompleter* completer) {
@@ -162,30 +208,30 @@ void ControlTaskQueue::request_resume_(ControlTask& task) {
     ++ready_queue_size_;
 
     // Add task to the ready queue.
-    ready_queue_.push_back(task);
+    push_ready_task_(task);
 
     // Wake up event loop thread.
-    // This wakeup will either succeed or handled by concurrent call to
-    // update_wakeup_timer_().
-    wakeup_timer_.try_set_deadline(0);
+    wakeup_event_loop_();
 }
 
-void ControlTaskQueue::request_renew_(ControlTask& task, core::nanoseconds_t deadline) {
+bool ControlTaskQueue::request_renew_(ControlTask& task, core::nanoseconds_t deadline) {
     // Cut off concurrent task renewals. This simplifies implementation.
     // If there are concurrent schedule and/or async_cancel calls, only one of them
     // wins, and other give up and do nothing. This is okay, since if they were
     // serialized, only one of them (the last one) would take effect.
     if (!task.renew_guard_.compare_exchange(false, true)) {
-        return;
+        return false;
     }
 
-    request_renew_guarded_(task, deadline);
+    const bool need_wakeup = request_renew_guarded_(task, deadline);
 
     // Finish operation.
     task.renew_guard_ = false;
+
+    return need_wakeup;
 }
 
-void ControlTaskQueue::request_renew_guarded_(ControlTask& task,
+bool ControlTaskQueue::request_renew_guarded_(ControlTask& task,
                                               core::nanoseconds_t deadline) {
     // Set the new desired deadline.
     // Allowed deadline values are:
@@ -206,7 +252,7 @@ void ControlTaskQueue::request_renew_guarded_(ControlTask& task,
         // will check renewed deadline before going to sleep.
         if (!task.state_.compare_exchange(ControlTask::StateSleeping,
                                           ControlTask::StateReady)) {
-            return;
+            return false;
         }
     } else {
         // Do nothing if the task is paused.
@@ -218,12 +264,12 @@ void ControlTaskQueue::request_renew_guarded_(ControlTask& task,
         ControlTask::validate_flags(task_flags);
 
         if (task_flags & ControlTask::FlagPaused) {
-            return;
+            return false;
         }
 
         // Do nothing if the task is already in the ready queue.
         if (task.state_.exchange(ControlTask::StateReady) == ControlTask::StateReady) {
-            return;
+            return false;
         }
     }
 
@@ -247,17 +293,15 @@ void ControlTaskQueue::request_renew_guarded_(ControlTask& task,
     if (++ready_queue_size_ == 1
         && (deadline > 0 || (deadline < 0 && !task.completer_))) {
         if (try_renew_inplace_(task, deadline, version)) {
-            return;
+            return false;
         }
     }
 
     // Add task to the ready queue.
-    ready_queue_.push_back(task);
+    push_ready_task_(task);
 
-    // Wake up event loop thread.
-    // This wakeup will either succeed or handled by concurrent call to
-    // update_wakeup_timer_().
-    wakeup_timer_.try_set_deadline(0);
+    // Caller should wake up event loop thread.
+    return true;
 }
 
 bool ControlTaskQueue::try_renew_inplace_(ControlTask& task,
@@ -401,11 +445,12 @@ void ControlTaskQueue::cancel_task_(ControlTask& task, core::seqlock_version_t v
             (void*)&task, (unsigned long long)task.effective_version_,
             (unsigned long long)version);
 
-    // This should not happend. If the task was already cancelled, its completer was
-    // already called and the task may be already destroyed. The upper code should
-    // prevent cancelling a task twice even if the user calls async_cancel() twice.
-    roc_panic_if_msg(task.effective_deadline_ == -1,
-                     "control task queue: unexpected already cancelled task in cancel");
+    // Note that effective deadline may be already negative here. This happens when
+    // the task was cancelled, then re-scheduled, and then cancelled again before
+    // the event loop fetched it from the ready queue. In this case the event loop
+    // never saw the new deadline, but the task still should be completed once more,
+    // since the user has scheduled it again. A real double cancellation is not
+    // possible because request_renew_() ignores cancellation of completed tasks.
 
     if (paused_queue_.contains(task)) {
         paused_queue_.remove(task);
@@ -434,7 +479,7 @@ void ControlTaskQueue::reborn_task_(ControlTask& task, ControlTask::State from_s
 
     ++ready_queue_size_;
 
-    ready_queue_.push_back(task);
+    push_ready_task_(task);
 }
 
 void ControlTaskQueue::pause_task_(ControlTask& task, ControlTask::State from_state) {
@@ -670,23 +715,33 @@ bool ControlTaskQueue::process_tasks_() {
 }
 
 ControlTask* ControlTaskQueue::fetch_task_() {
-    ControlTask* task = NULL;
+    // High priority tasks go first, both ready and sleeping ones whose
+    // deadline has expired.
+    ControlTask* task = fetch_ready_task_(high_ready_queue_);
+    if (task) {
+        return task;
+    }
+
+    task = fetch_sleeping_task_(ControlTaskHighPriority);
+    if (task) {
+        return task;
+    }
 
     // Interleave ready and sleeping tasks to prevent starvation
     // of one of the categories.
     if (fetch_ready_) {
-        task = fetch_ready_task_();
+        task = fetch_ready_task_(ready_queue_);
 
         if (!task) {
-            task = fetch_sleeping_task_();
+            task = fetch_sleeping_task_(ControlTaskNormalPriority);
         } else {
             fetch_ready_ = !fetch_ready_;
         }
     } else {
-        task = fetch_sleeping_task_();
+        task = fetch_sleeping_task_(ControlTaskNormalPriority);
 
         if (!task) {
-            task = fetch_ready_task_();
+            task = fetch_ready_task_(ready_queue_);
         } else {
             fetch_ready_ = !fetch_ready_;
         }
@@ -695,12 +750,20 @@ ControlTask* ControlTaskQueue::fetch_task_() {
     return task;
 }
 
-ControlTask* ControlTaskQueue::fetch_ready_task_() {
+void ControlTaskQueue::push_ready_task_(ControlTask& task) {
+    if (task.priority_ == ControlTaskHighPriority) {
+        high_ready_queue_.push_back(task);
+    } else {
+        ready_queue_.push_back(task);
+    }
+}
+
+ControlTask* ControlTaskQueue::fetch_ready_task_(ReadyQueue& queue) {
     for (;;) {
         // try_pop_front_exclusive() returns NULL if queue is empty or push_back() is
         // in progress; in the later case ready_queue_size_ is guaranteed to be
         // non-zero and process_tasks_() will call us again soon.
-        ControlTask* task = ready_queue_.try_pop_front_exclusive();
+        ControlTask* task = queue.try_pop_front_exclusive();
         if (!task) {
             roc_log(LogTrace,
                     "control task queue: ready task queue is empty or being pushed");
@@ -723,7 +786,7 @@ ControlTask* ControlTaskQueue::fetch_ready_task_() {
                     " re-adding task to ready queue after first read: ptr=%p",
                     (void*)task);
 
-            ready_queue_.push_back(*task);
+            push_ready_task_(*task);
             continue;
         }
 
@@ -744,7 +807,7 @@ ControlTask* ControlTaskQueue::fetch_ready_task_() {
                     (void*)task);
 
             if (task->state_.compare_exchange(new_state, ControlTask::StateReady)) {
-                ready_queue_.push_back(*task);
+                push_ready_task_(*task);
             } else {
                 --ready_queue_size_;
             }
@@ -776,13 +839,23 @@ ControlTask* ControlTaskQueue::fetch_ready_task_() {
     }
 }
 
-ControlTask* ControlTaskQueue::fetch_sleeping_task_() {
+ControlTask* ControlTaskQueue::fetch_sleeping_task_(ControlTaskPriority min_priority) {
+    const core::nanoseconds_t now = core::timestamp(core::ClockMonotonic);
+
+    // Sleeping queue is sorted by deadline, so all expired tasks are at the head.
+    // Find first expired task with sufficient priority.
     ControlTask* task = sleeping_queue_.front();
-    if (!task) {
-        return NULL;
+
+    for (; task; task = sleeping_queue_.nextof(*task)) {
+        if (task->effective_deadline_ > now) {
+            return NULL;
+        }
+        if (task->priority_ >= min_priority) {
+            break;
+        }
     }
 
-    if (task->effective_deadline_ > core::timestamp(core::ClockMonotonic)) {
+    if (!task) {
         return NULL;
     }
 
@@ -804,10 +877,15 @@ void ControlTaskQueue::insert_sleeping_task_(ControlTask& task) {
 
     ControlTask* pos = sleeping_queue_.front();
 
+    // Tasks with equal deadlines are ordered by priority.
     for (; pos; pos = sleeping_queue_.nextof(*pos)) {
         if (pos->effective_deadline_ > task.effective_deadline_) {
             break;
         }
+        if (pos->effective_deadline_ == task.effective_deadline_
+            && pos->priority_ < task.priority_) {
+            break;
+        }
     }
 
     if (pos) {
@@ -841,7 +919,7 @@ core::nanoseconds_t ControlTaskQueue::update_wakeup_timer_() {
     wakeup_timer_.try_set_deadline(deadline);
 
     // We should check whether new tasks were added while we were updating the timer.
-    // In this case, try_set_deadline(0) in request_renew_() was probably failed, and
+    // In this case, try_set_deadline(0) in wakeup_event_loop_() was probably failed, and
     // we should call it by ourselves to wake up the event loop thread.
     if (deadline != 0 && ready_queue_size_ != 0) {
         deadline = 0;
@@ -47,7 +47,7 @@ namespace ctl {
 //! network and pipeline threads, which should never block and use the task queue to
 //! schedule low-priority delayed work.
 //!
-//! The implementation uses three queues internally:
+//! The implementation uses four queues internally:
 //!
 //!  - ready_queue_ - a lock-free queue of tasks of three kinds:
 //!    - tasks to be resumed after pause (flags_ & FlagResumed != 0)
@@ -55,8 +55,12 @@ namespace ctl {
 //!    - tasks to be re-scheduled with another deadline (renewed_deadline_ > 0)
 //!    - tasks to be cancelled                          (renewed_deadline_ < 0)
 //!
+//!  - high_ready_queue_ - same as ready_queue_, but for tasks with
+//!    ControlTaskHighPriority;
+//!
 //!  - sleeping_queue_ - a sorted queue of tasks with non-zero deadline, scheduled for
 //!    execution in future; the task at the head has the smallest (nearest) deadline;
+//!    tasks with equal deadline are ordered by priority;
 //!
 //!  - pause_queue_ - an unsorted queue to keep track of all currently paused tasks.
 //!
@@ -83,6 +87,16 @@ namespace ctl {
 //!    thread. The event loop thread will fetch the task from ready_queue_ soon and
 //!    complete the operation by manipulating the sleeping_queue_.
 //!
+//! The event loop thread fetches tasks in the following order: high priority ready
+//! tasks, then high priority sleeping tasks whose deadline has expired, and then
+//! normal priority ready and expired sleeping tasks, interleaved to prevent starvation
+//! of one of the categories. ready_queue_size_ counts tasks in both ready queues.
+//!
+//! When many tasks are scheduled at once using schedule_batch(), all of them are
+//! pushed to ready_queue_ first, and the timer wakeup time is set only once after
+//! that. The event loop thread then drains the whole ready_queue_ during a single
+//! wakeup, instead of being woken up and going to sleep again for every task.
+//!
 //! The current task state is defined by its atomic field "state_". Various task queue
 //! operations move task from one state to another. The move is always performed using
 //! atomic CAS or exchange to handle concurrent lock-free updates correctly.
@@ -126,8 +140,9 @@ class ControlTaskQueue : private core::Thread {
 public:
     //! Initialize.
     //! @remarks
-    //!  Starts background thread.
-    ControlTaskQueue();
+    //!  Starts background thread with given scheduling parameters.
+    explicit ControlTaskQueue(
+        const core::ThreadConfig& thread_config = core::ThreadConfig());
 
     //! Destroy.
     //! @remarks
@@ -144,6 +159,19 @@ public:
                   IControlTaskExecutor& executor,
                   IControlTaskCompleter* completer);
 
+    //! Enqueue multiple tasks for asynchronous execution as soon as possible.
+    //!
+    //! This is like calling schedule() for every task, but the event loop thread is
+    //! woken up only once, after all tasks are enqueued, and then executes the whole
+    //! batch without going to sleep between tasks. This avoids a thread switch per
+    //! task when many tasks are submitted at once.
+    //!
+    //! All tasks share the same @p executor and @p completer.
+    void schedule_batch(ControlTask* const* tasks,
+                        size_t n_tasks,
+                        IControlTaskExecutor& executor,
+                        IControlTaskCompleter* completer);
+
     //! Enqueue a task for asynchronous execution at given point of time.
     //!
     //! - If the task is already completed, it's scheduled with given deadline.
@@ -226,13 +254,15 @@ private:
     void start_thread_();
     void stop_thread_();
 
+    void wakeup_event_loop_();
+
     void setup_task_(ControlTask& task,
                      IControlTaskExecutor& executor,
                      IControlTaskCompleter* completer);
 
     void request_resume_(ControlTask& task);
-    void request_renew_(ControlTask& task, core::nanoseconds_t deadline);
-    void request_renew_guarded_(ControlTask& task, core::nanoseconds_t deadline);
+    bool request_renew_(ControlTask& task, core::nanoseconds_t deadline);
+    bool request_renew_guarded_(ControlTask& task, core::nanoseconds_t deadline);
 
     bool try_renew_inplace_(ControlTask& task,
                             core::nanoseconds_t deadline,
@@ -260,9 +290,13 @@ private:
 
     bool process_tasks_();
 
+    typedef core::MpscQueue<ControlTask, core::NoOwnership> ReadyQueue;
+
     ControlTask* fetch_task_();
-    ControlTask* fetch_ready_task_();
-    ControlTask* fetch_sleeping_task_();
+    ControlTask* fetch_ready_task_(ReadyQueue& queue);
+    ControlTask* fetch_sleeping_task_(ControlTaskPriority min_priority);
+
+    void push_ready_task_(ControlTask& task);
 
     void insert_sleeping_task_(ControlTask& task);
     void remove_sleeping_task_(ControlTask& task);
@@ -274,7 +308,8 @@ private:
     bool fetch_ready_;
 
     core::Atomic<int> ready_queue_size_;
-    core::MpscQueue<ControlTask, core::NoOwnership> ready_queue_;
+    ReadyQueue high_ready_queue_;
+    ReadyQueue ready_queue_;
     core::List<ControlTask, core::NoOwnership> sleeping_queue_;
     core::List<ControlTask, core::NoOwnership> paused_queue_;
 
@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_ctl/rtsp_control_endpoint.h"
+#include "roc_address/endpoint_uri_to_str.h"
+#include "roc_address/protocol_map.h"
+#include "roc_address/socket_addr_to_str.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/string_builder.h"
+
+namespace roc {
+namespace ctl {
+
+RtspControlEndpoint::RtspControlEndpoint(ControlTaskQueue& task_queue,
+                                         netio::NetworkLoop& network_loop,
+                                         core::IAllocator& allocator)
+    : BasicControlEndpoint(allocator)
+    , task_queue_(task_queue)
+    , network_loop_(network_loop)
+    , allocator_(allocator)
+    , bind_uri_(allocator)
+    , port_handle_(NULL)
+    , notify_task_(NULL)
+    , source_(NULL) {
+}
+
+RtspControlEndpoint::~RtspControlEndpoint() {
+    roc_panic_if_msg(notify_task_,
+                     "rtsp endpoint: attempt to destroy endpoint during async operation");
+
+    if (port_handle_) {
+        // endpoint was not closed via async_close()
+        netio::NetworkLoop::Tasks::RemovePort task(port_handle_);
+        if (!network_loop_.schedule_and_wait(task)) {
+            roc_panic("rtsp endpoint: can't remove port");
+        }
+    }
+}
+
+bool RtspControlEndpoint::is_bound() const {
+    return port_handle_ != NULL;
+}
+
+bool RtspControlEndpoint::is_connected() const {
+    return false;
+}
+
+bool RtspControlEndpoint::async_bind(const address::EndpointUri& uri,
+                                     ControlTask& notify_task) {
+    if (notify_task_ || port_handle_) {
+        roc_log(LogError, "rtsp endpoint: can't bind: endpoint is busy or already bound");
+        return false;
+    }
+
+    if (uri.proto() != address::Proto_RTSP) {
+        roc_log(LogError, "rtsp endpoint: can't bind: unexpected protocol %s",
+                address::proto_to_str(uri.proto()));
+        return false;
+    }
+
+    if (!bind_uri_.assign(uri)) {
+        roc_log(LogError, "rtsp endpoint: can't bind: failed to copy uri");
+        return false;
+    }
+
+    roc_log(LogDebug, "rtsp endpoint: binding to %s",
+            address::endpoint_uri_to_str(bind_uri_).c_str());
+
+    notify_task_ = &notify_task;
+
+    // continued in network_task_completed()
+    resolve_task_.reset();
+    resolve_task_.reset(new (resolve_task_)
+                            netio::NetworkLoop::Tasks::ResolveEndpointAddress(bind_uri_));
+    network_loop_.schedule(*resolve_task_, *this);
+
+    return true;
+}
+
+bool RtspControlEndpoint::async_connect(const address::EndpointUri& uri,
+                                        ControlTask&) {
+    roc_log(LogError, "rtsp endpoint: can't connect to %s: client mode not supported",
+            address::endpoint_uri_to_str(uri).c_str());
+    return false;
+}
+
+void RtspControlEndpoint::async_close(ControlTask& notify_task) {
+    roc_panic_if_msg(notify_task_,
+                     "rtsp endpoint: attempt to close endpoint during async operation");
+
+    if (!port_handle_) {
+        task_queue_.resume(notify_task);
+        return;
+    }
+
+    roc_log(LogDebug, "rtsp endpoint: closing");
+
+    notify_task_ = &notify_task;
+
+    // server port terminates all its connections before closing
+    remove_port_task_.reset();
+    remove_port_task_.reset(new (remove_port_task_)
+                                netio::NetworkLoop::Tasks::RemovePort(port_handle_));
+    network_loop_.schedule(*remove_port_task_, *this);
+}
+
+bool RtspControlEndpoint::attach_sink(const address::EndpointUri& uri,
+                                      pipeline::SenderLoop&) {
+    roc_log(LogError, "rtsp endpoint: can't attach sink %s: not supported",
+            address::endpoint_uri_to_str(uri).c_str());
+    return false;
+}
+
+bool RtspControlEndpoint::detach_sink(pipeline::SenderLoop&) {
+    roc_log(LogError, "rtsp endpoint: can't detach sink: not supported");
+    return false;
+}
+
+bool RtspControlEndpoint::attach_source(const address::EndpointUri& uri,
+                                        pipeline::ReceiverLoop& source) {
+    core::Mutex::Lock lock(mutex_);
+
+    if (source_ && source_ != &source) {
+        roc_log(LogError,
+                "rtsp endpoint: can't attach source: another source already attached");
+        return false;
+    }
+
+    const address::ProtocolAttrs* attrs =
+        address::ProtocolMap::instance().find_proto_by_id(uri.proto());
+    if (!attrs) {
+        roc_log(LogError, "rtsp endpoint: can't attach source: unknown protocol");
+        return false;
+    }
+
+    if (uri.port() <= 0) {
+        roc_log(LogError, "rtsp endpoint: can't attach source: port is not bound: %s",
+                address::endpoint_uri_to_str(uri).c_str());
+        return false;
+    }
+
+    switch (attrs->iface) {
+    case address::Iface_AudioSource:
+        media_.source_port = uri.port();
+        media_.source_proto = uri.proto();
+        break;
+
+    case address::Iface_AudioRepair:
+        media_.repair_port = uri.port();
+        break;
+
+    case address::Iface_AudioControl:
+        media_.control_port = uri.port();
+        break;
+
+    default:
+        roc_log(LogError, "rtsp endpoint: can't attach source: unsupported interface %s",
+                address::interface_to_str(attrs->iface));
+        return false;
+    }
+
+    roc_log(LogDebug, "rtsp endpoint: announcing %s interface at %s",
+            address::interface_to_str(attrs->iface),
+            address::endpoint_uri_to_str(uri).c_str());
+
+    source_ = &source;
+
+    return true;
+}
+
+bool RtspControlEndpoint::detach_source(pipeline::ReceiverLoop& source) {
+    core::Mutex::Lock lock(mutex_);
+
+    if (source_ != &source) {
+        roc_log(LogError, "rtsp endpoint: can't detach source: source not attached");
+        return false;
+    }
+
+    media_ = RtspMediaInfo();
+    source_ = NULL;
+
+    return true;
+}
+
+netio::IConnHandler* RtspControlEndpoint::add_connection(netio::IConn& conn) {
+    roc_log(LogDebug, "rtsp endpoint: accepted connection from %s",
+            address::socket_addr_to_str(conn.remote_address()).c_str());
+
+    char session_id[16];
+    core::StringBuilder b(session_id, sizeof(session_id));
+    b.append_uint(core::fast_random(0x10000000, 0xffffffff), 16);
+
+    Connection* handler = new (allocator_) Connection(*this, session_id);
+    if (!handler) {
+        roc_log(LogError, "rtsp endpoint: can't allocate connection");
+        return NULL;
+    }
+
+    if (!handler->valid()) {
+        allocator_.destroy_object(*handler);
+        return NULL;
+    }
+
+    return handler;
+}
+
+void RtspControlEndpoint::remove_connection(netio::IConnHandler& handler) {
+    allocator_.destroy_object((Connection&)handler);
+}
+
+void RtspControlEndpoint::network_task_completed(netio::NetworkTask& task) {
+    if (&task == resolve_task_.get()) {
+        if (!task.success()) {
+            roc_log(LogError, "rtsp endpoint: can't bind: can't resolve %s",
+                    address::endpoint_uri_to_str(bind_uri_).c_str());
+            complete_async_op_();
+            return;
+        }
+
+        server_config_.bind_address = resolve_task_->get_address();
+
+        add_port_task_.reset();
+        add_port_task_.reset(new (add_port_task_)
+                                 netio::NetworkLoop::Tasks::AddTcpServerPort(
+                                     server_config_, *this));
+        network_loop_.schedule(*add_port_task_, *this);
+        return;
+    }
+
+    if (&task == add_port_task_.get()) {
+        if (!task.success()) {
+            roc_log(LogError, "rtsp endpoint: can't bind: can't open tcp server at %s",
+                    address::socket_addr_to_str(server_config_.bind_address).c_str());
+            complete_async_op_();
+            return;
+        }
+
+        port_handle_ = add_port_task_->get_handle();
+
+        roc_log(LogInfo, "rtsp endpoint: bound to %s",
+                address::socket_addr_to_str(server_config_.bind_address).c_str());
+
+        complete_async_op_();
+        return;
+    }
+
+    if (&task == remove_port_task_.get()) {
+        if (!task.success()) {
+            roc_panic("rtsp endpoint: can't remove port");
+        }
+
+        port_handle_ = NULL;
+
+        complete_async_op_();
+        return;
+    }
+
+    roc_panic("rtsp endpoint: unexpected network task");
+}
+
+void RtspControlEndpoint::complete_async_op_() {
+    roc_panic_if(!notify_task_);
+
+    ControlTask* task = notify_task_;
+    notify_task_ = NULL;
+
+    task_queue_.resume(*task);
+}
+
+RtspMediaInfo RtspControlEndpoint::get_media_() {
+    core::Mutex::Lock lock(mutex_);
+
+    return media_;
+}
+
+RtspControlEndpoint::Connection::Connection(RtspControlEndpoint& endpoint,
+                                            const char* session_id)
+    : endpoint_(endpoint)
+    , session_(endpoint.bind_uri_.path(), session_id)
+    , in_len_(0)
+    , out_pos_(0)
+    , out_len_(0)
+    , close_after_flush_(false)
+    , terminating_(false) {
+}
+
+bool RtspControlEndpoint::Connection::valid() const {
+    return session_.valid();
+}
+
+void RtspControlEndpoint::Connection::connection_refused(netio::IConn&) {
+    roc_panic("rtsp endpoint: unexpected refused connection on server side");
+}
+
+void RtspControlEndpoint::Connection::connection_established(netio::IConn& conn) {
+    process_io_(conn);
+}
+
+void RtspControlEndpoint::Connection::connection_writable(netio::IConn& conn) {
+    process_io_(conn);
+}
+
+void RtspControlEndpoint::Connection::connection_readable(netio::IConn& conn) {
+    process_io_(conn);
+}
+
+void RtspControlEndpoint::Connection::connection_terminated(netio::IConn& conn) {
+    roc_log(LogDebug, "rtsp endpoint: closed connection from %s",
+            address::socket_addr_to_str(conn.remote_address()).c_str());
+}
+
+void RtspControlEndpoint::Connection::process_io_(netio::IConn& conn) {
+    if (terminating_) {
+        return;
+    }
+
+    for (;;) {
+        // send pending response before handling next request
+        if (!flush_(conn)) {
+            return;
+        }
+
+        if (close_after_flush_) {
+            terminate_(conn, netio::Term_Normal);
+            return;
+        }
+
+        // handle requests already in buffer, one at a time
+        if (in_len_ != 0 && process_request_(conn)) {
+            continue;
+        }
+
+        if (terminating_) {
+            return;
+        }
+
+        const ssize_t ret = conn.try_read(in_buf_ + in_len_, sizeof(in_buf_) - in_len_);
+
+        if (ret == netio::IOErr_WouldBlock) {
+            return;
+        }
+
+        if (ret == netio::IOErr_StreamEnd || ret == 0) {
+            terminate_(conn, netio::Term_Normal);
+            return;
+        }
+
+        if (ret < 0) {
+            roc_log(LogDebug, "rtsp endpoint: can't read from connection");
+            terminate_(conn, netio::Term_Failure);
+            return;
+        }
+
+        in_len_ += (size_t)ret;
+    }
+}
+
+bool RtspControlEndpoint::Connection::process_request_(netio::IConn& conn) {
+    RtspRequest request;
+    const ssize_t request_len = parse_rtsp_request(in_buf_, in_len_, request);
+
+    if (request_len == 0 && in_len_ < sizeof(in_buf_)) {
+        // need more data
+        return false;
+    }
+
+    core::StringBuilder b(out_buf_, sizeof(out_buf_));
+
+    if (request_len <= 0) {
+        // malformed or too large request, connection can't be resynchronized
+        roc_log(LogDebug, "rtsp endpoint: received malformed request from %s",
+                address::socket_addr_to_str(conn.remote_address()).c_str());
+
+        in_len_ = 0;
+        close_after_flush_ = true;
+
+        if (!session_.handle_bad_request(b)) {
+            terminate_(conn, netio::Term_Failure);
+            return false;
+        }
+    } else {
+        memmove(in_buf_, in_buf_ + request_len, in_len_ - (size_t)request_len);
+        in_len_ -= (size_t)request_len;
+
+        char local_host[address::SocketAddr::MaxStrLen];
+        if (!conn.local_address().get_host(local_host, sizeof(local_host))) {
+            roc_log(LogError, "rtsp endpoint: can't format local address");
+            terminate_(conn, netio::Term_Failure);
+            return false;
+        }
+
+        if (!session_.handle_request(request, endpoint_.get_media_(), local_host, b)) {
+            roc_log(LogError, "rtsp endpoint: can't format response");
+            terminate_(conn, netio::Term_Failure);
+            return false;
+        }
+    }
+
+    out_pos_ = 0;
+    out_len_ = b.actual_size() - 1;
+
+    return true;
+}
+
+bool RtspControlEndpoint::Connection::flush_(netio::IConn& conn) {
+    while (out_pos_ != out_len_) {
+        const ssize_t ret = conn.try_write(out_buf_ + out_pos_, out_len_ - out_pos_);
+
+        if (ret == netio::IOErr_WouldBlock) {
+            // continued in connection_writable()
+            return false;
+        }
+
+        if (ret < 0) {
+            roc_log(LogDebug, "rtsp endpoint: can't write to connection");
+            terminate_(conn, netio::Term_Failure);
+            return false;
+        }
+
+        out_pos_ += (size_t)ret;
+    }
+
+    out_pos_ = out_len_ = 0;
+
+    return true;
+}
+
+void RtspControlEndpoint::Connection::terminate_(netio::IConn& conn,
+                                                 netio::TerminationMode mode) {
+    if (terminating_) {
+        return;
+    }
+
+    terminating_ = true;
+    conn.async_terminate(mode);
+}
+
+} // namespace ctl
+} // namespace roc
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_ctl/rtsp_control_endpoint.h
+//! @brief RTSP control endpoint.
+
+#ifndef ROC_CTL_RTSP_CONTROL_ENDPOINT_H_
+#define ROC_CTL_RTSP_CONTROL_ENDPOINT_H_
+
+#include "roc_address/endpoint_uri.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/optional.h"
+#include "roc_ctl/basic_control_endpoint.h"
+#include "roc_ctl/control_task_queue.h"
+#include "roc_ctl/rtsp_server_session.h"
+#include "roc_netio/iconn_acceptor.h"
+#include "roc_netio/iconn_handler.h"
+#include "roc_netio/inetwork_task_completer.h"
+#include "roc_netio/network_loop.h"
+#include "roc_netio/tcp_server_port.h"
+
+namespace roc {
+namespace ctl {
+
+//! RTSP control endpoint.
+//! @remarks
+//!  Implements server side of consolidated interface: binds TCP server port and
+//!  announces source, repair, and control ports of attached receiver to RTSP
+//!  clients. Ports are announced using URIs passed to attach_source(), one call
+//!  per interface, so they should be already bound.
+//!
+//!  Client side (connecting to remote RTSP server and configuring sender
+//!  from its SDP) is not supported yet.
+class RtspControlEndpoint : public BasicControlEndpoint,
+                            private netio::IConnAcceptor,
+                            private netio::INetworkTaskCompleter {
+public:
+    //! Initialize.
+    RtspControlEndpoint(ControlTaskQueue& task_queue,
+                        netio::NetworkLoop& network_loop,
+                        core::IAllocator& allocator);
+
+    virtual ~RtspControlEndpoint();
+
+    //! Check if endpoint is successfully bound to local URI.
+    virtual bool is_bound() const;
+
+    //! Check if endpoint is successfully connected to remote URI.
+    virtual bool is_connected() const;
+
+    //! Initiate asynchronous binding to local URI.
+    virtual bool async_bind(const address::EndpointUri& uri, ControlTask& notify_task);
+
+    //! Initiate asynchronous connecting to remote URI.
+    //! @remarks
+    //!  Not supported, always fails.
+    virtual bool async_connect(const address::EndpointUri& uri,
+                               ControlTask& notify_task);
+
+    //! Initiate asynchronous closing of endpoint.
+    virtual void async_close(ControlTask& notify_task);
+
+    //! Add sink pipeline controlled by this endpoint.
+    //! @remarks
+    //!  Not supported, always fails.
+    virtual bool attach_sink(const address::EndpointUri& uri,
+                             pipeline::SenderLoop& sink);
+
+    //! Remove sink pipeline.
+    virtual bool detach_sink(pipeline::SenderLoop& sink);
+
+    //! Add source pipeline controlled by this endpoint.
+    //! @remarks
+    //!  @p uri is local URI of one of source, repair, or control interfaces
+    //!  of @p source, with actual bound port.
+    virtual bool attach_source(const address::EndpointUri& uri,
+                               pipeline::ReceiverLoop& source);
+
+    //! Remove source pipeline.
+    virtual bool detach_source(pipeline::ReceiverLoop& source);
+
+private:
+    class Connection : public netio::IConnHandler {
+    public:
+        Connection(RtspControlEndpoint& endpoint, const char* session_id);
+
+        bool valid() const;
+
+        virtual void connection_refused(netio::IConn& conn);
+        virtual void connection_established(netio::IConn& conn);
+        virtual void connection_writable(netio::IConn& conn);
+        virtual void connection_readable(netio::IConn& conn);
+        virtual void connection_terminated(netio::IConn& conn);
+
+    private:
+        enum { MaxRequestLen = 4096, MaxResponseLen = 4096 };
+
+        void process_io_(netio::IConn& conn);
+        bool process_request_(netio::IConn& conn);
+        bool flush_(netio::IConn& conn);
+        void terminate_(netio::IConn& conn, netio::TerminationMode mode);
+
+        RtspControlEndpoint& endpoint_;
+        RtspServerSession session_;
+
+        char in_buf_[MaxRequestLen];
+        size_t in_len_;
+
+        char out_buf_[MaxResponseLen];
+        size_t out_pos_;
+        size_t out_len_;
+
+        bool close_after_flush_;
+        bool terminating_;
+    };
+
+    virtual netio::IConnHandler* add_connection(netio::IConn& conn);
+    virtual void remove_connection(netio::IConnHandler& handler);
+
+    virtual void network_task_completed(netio::NetworkTask& task);
+
+    void complete_async_op_();
+
+    RtspMediaInfo get_media_();
+
+    ControlTaskQueue& task_queue_;
+    netio::NetworkLoop& network_loop_;
+    core::IAllocator& allocator_;
+
+    address::EndpointUri bind_uri_;
+    netio::TcpServerConfig server_config_;
+    netio::NetworkLoop::PortHandle port_handle_;
+
+    core::Optional<netio::NetworkLoop::Tasks::ResolveEndpointAddress> resolve_task_;
+    core::Optional<netio::NetworkLoop::Tasks::AddTcpServerPort> add_port_task_;
+    core::Optional<netio::NetworkLoop::Tasks::RemovePort> remove_port_task_;
+
+    ControlTask* notify_task_;
+
+    core::Mutex mutex_;
+    RtspMediaInfo media_;
+    pipeline::ReceiverLoop* source_;
+};
+
+} // namespace ctl
+} // namespace roc
+
+#endif // ROC_CTL_RTSP_CONTROL_ENDPOINT_H_
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_ctl/rtsp_request.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace ctl {
+
+namespace {
+
+const char* skip_spaces(const char* begin, const char* end) {
+    while (begin != end && (*begin == ' ' || *begin == '\t')) {
+        begin++;
+    }
+    return begin;
+}
+
+const char* trim_spaces(const char* begin, const char* end) {
+    while (end != begin && (end[-1] == ' ' || end[-1] == '\t')) {
+        end--;
+    }
+    return end;
+}
+
+const char* find_char(const char* begin, const char* end, char ch) {
+    while (begin != end && *begin != ch) {
+        begin++;
+    }
+    return begin;
+}
+
+// Method names are case-sensitive (RFC 2326, 6.1).
+bool token_equal(const char* begin, const char* end, const char* token) {
+    const size_t len = strlen(token);
+    return size_t(end - begin) == len && memcmp(begin, token, len) == 0;
+}
+
+// Header names are case-insensitive (RFC 2326, 4.2).
+bool name_equal(const char* begin, const char* end, const char* name) {
+    for (; begin != end && *name; begin++, name++) {
+        if (tolower((unsigned char)*begin) != tolower((unsigned char)*name)) {
+            return false;
+        }
+    }
+    return begin == end && *name == '\0';
+}
+
+bool copy_field(const char* begin, const char* end, char* dst, size_t dst_size) {
+    const size_t len = size_t(end - begin);
+    if (len >= dst_size) {
+        return false;
+    }
+    memcpy(dst, begin, len);
+    dst[len] = '\0';
+    return true;
+}
+
+bool parse_ulong(const char* begin, const char* end, unsigned long& result) {
+    if (begin == end) {
+        return false;
+    }
+
+    unsigned long value = 0;
+
+    for (; begin != end; begin++) {
+        if (*begin < '0' || *begin > '9') {
+            return false;
+        }
+        const unsigned long digit = (unsigned long)(*begin - '0');
+        if (value > (ULONG_MAX - digit) / 10) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+
+    result = value;
+    return true;
+}
+
+RtspMethod parse_method(const char* begin, const char* end) {
+    if (token_equal(begin, end, "OPTIONS")) {
+        return RtspMethod_Options;
+    }
+    if (token_equal(begin, end, "DESCRIBE")) {
+        return RtspMethod_Describe;
+    }
+    if (token_equal(begin, end, "SETUP")) {
+        return RtspMethod_Setup;
+    }
+    if (token_equal(begin, end, "PLAY")) {
+        return RtspMethod_Play;
+    }
+    if (token_equal(begin, end, "TEARDOWN")) {
+        return RtspMethod_Teardown;
+    }
+    return RtspMethod_Unknown;
+}
+
+// Request-Line = Method SP Request-URI SP RTSP-Version
+bool parse_request_line(const char* begin, const char* end, RtspRequest& request) {
+    const char* method_end = find_char(begin, end, ' ');
+    if (method_end == begin || method_end == end) {
+        roc_log(LogDebug, "rtsp request: missing method");
+        return false;
+    }
+
+    const char* uri_begin = method_end + 1;
+    const char* uri_end = find_char(uri_begin, end, ' ');
+    if (uri_end == uri_begin || uri_end == end) {
+        roc_log(LogDebug, "rtsp request: missing uri");
+        return false;
+    }
+
+    if (!token_equal(uri_end + 1, end, "RTSP/1.0")) {
+        roc_log(LogDebug, "rtsp request: unsupported version");
+        return false;
+    }
+
+    if (!copy_field(uri_begin, uri_end, request.uri, sizeof(request.uri))) {
+        roc_log(LogDebug, "rtsp request: uri too long");
+        return false;
+    }
+
+    request.method = parse_method(begin, method_end);
+
+    return true;
+}
+
+// message-header = field-name ":" [ field-value ] CRLF
+bool parse_header(const char* begin,
+                  const char* end,
+                  RtspRequest& request,
+                  bool& has_cseq) {
+    const char* name_end = find_char(begin, end, ':');
+    if (name_end == end) {
+        roc_log(LogDebug, "rtsp request: missing colon in header");
+        return false;
+    }
+
+    const char* value_begin = skip_spaces(name_end + 1, end);
+    const char* value_end = trim_spaces(value_begin, end);
+
+    name_end = trim_spaces(begin, name_end);
+
+    if (name_equal(begin, name_end, "CSeq")) {
+        if (!parse_ulong(value_begin, value_end, request.cseq)) {
+            roc_log(LogDebug, "rtsp request: invalid CSeq header");
+            return false;
+        }
+        has_cseq = true;
+        return true;
+    }
+
+    if (name_equal(begin, name_end, "Content-Length")) {
+        unsigned long content_length = 0;
+        if (!parse_ulong(value_begin, value_end, content_length)) {
+            roc_log(LogDebug, "rtsp request: invalid Content-Length header");
+            return false;
+        }
+        request.content_length = (size_t)content_length;
+        return true;
+    }
+
+    if (name_equal(begin, name_end, "Transport")) {
+        if (!copy_field(value_begin, value_end, request.transport,
+                        sizeof(request.transport))) {
+            roc_log(LogDebug, "rtsp request: Transport header too long");
+            return false;
+        }
+        return true;
+    }
+
+    if (name_equal(begin, name_end, "Session")) {
+        // session-id is followed by optional ";timeout=" parameter
+        value_end = trim_spaces(value_begin, find_char(value_begin, value_end, ';'));
+        if (!copy_field(value_begin, value_end, request.session,
+                        sizeof(request.session))) {
+            roc_log(LogDebug, "rtsp request: Session header too long");
+            return false;
+        }
+        return true;
+    }
+
+    return true;
+}
+
+} // namespace
+
+const char* rtsp_method_to_str(RtspMethod method) {
+    switch (method) {
+    case RtspMethod_Options:
+        return "OPTIONS";
+    case RtspMethod_Describe:
+        return "DESCRIBE";
+    case RtspMethod_Setup:
+        return "SETUP";
+    case RtspMethod_Play:
+        return "PLAY";
+    case RtspMethod_Teardown:
+        return "TEARDOWN";
+    case RtspMethod_Unknown:
+        break;
+    }
+
+    return "unknown";
+}
+
+ssize_t parse_rtsp_request(const char* buf, size_t len, RtspRequest& request) {
+    request = RtspRequest();
+
+    const char* const end = buf + len;
+    const char* line = buf;
+
+    const char* body = NULL;
+
+    bool has_request_line = false;
+    bool has_cseq = false;
+
+    for (;;) {
+        const char* next_line = find_char(line, end, '\n');
+        if (next_line == end) {
+            return 0;
+        }
+        next_line++;
+
+        const char* line_end = next_line - 1;
+        if (line_end != line && line_end[-1] == '\r') {
+            line_end--;
+        }
+
+        if (!has_request_line) {
+            // empty lines before request line are allowed (RFC 2616, 4.1)
+            if (line != line_end) {
+                if (!parse_request_line(line, line_end, request)) {
+                    return -1;
+                }
+                has_request_line = true;
+            }
+        } else if (line == line_end) {
+            body = next_line;
+            break;
+        } else if (*line == ' ' || *line == '\t') {
+            // folded header values are not used by supported headers
+        } else {
+            if (!parse_header(line, line_end, request, has_cseq)) {
+                return -1;
+            }
+        }
+
+        line = next_line;
+    }
+
+    if (!has_cseq) {
+        roc_log(LogDebug, "rtsp request: missing CSeq header");
+        return -1;
+    }
+
+    const size_t header_len = size_t(body - buf);
+
+    if (request.content_length > len - header_len) {
+        return 0;
+    }
+
+    return ssize_t(header_len + request.content_length);
+}
+
+} // namespace ctl
+} // namespace roc
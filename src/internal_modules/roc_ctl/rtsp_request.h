@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_ctl/rtsp_request.h
+//! @brief RTSP request.
+
+#ifndef ROC_CTL_RTSP_REQUEST_H_
+#define ROC_CTL_RTSP_REQUEST_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace ctl {
+
+//! RTSP request method.
+enum RtspMethod {
+    //! Method not supported by server.
+    RtspMethod_Unknown,
+
+    //! OPTIONS.
+    RtspMethod_Options,
+
+    //! DESCRIBE.
+    RtspMethod_Describe,
+
+    //! SETUP.
+    RtspMethod_Setup,
+
+    //! PLAY.
+    RtspMethod_Play,
+
+    //! TEARDOWN.
+    RtspMethod_Teardown
+};
+
+//! Get RTSP method name.
+const char* rtsp_method_to_str(RtspMethod method);
+
+//! RTSP request.
+//! @remarks
+//!  Only fields used by server are kept, other headers are skipped.
+struct RtspRequest {
+    //! Maximum length of string fields.
+    enum { MaxUriLen = 255, MaxHeaderLen = 127 };
+
+    //! Request method.
+    RtspMethod method;
+
+    //! Request URI, zero-terminated.
+    char uri[MaxUriLen + 1];
+
+    //! CSeq header.
+    unsigned long cseq;
+
+    //! Transport header, zero-terminated.
+    //! Empty if header is missing.
+    char transport[MaxHeaderLen + 1];
+
+    //! Session identifier from Session header, zero-terminated.
+    //! Parameters following identifier are stripped.
+    //! Empty if header is missing.
+    char session[MaxHeaderLen + 1];
+
+    //! Content-Length header.
+    //! Zero if header is missing.
+    size_t content_length;
+
+    //! Initialize.
+    RtspRequest()
+        : method(RtspMethod_Unknown)
+        , cseq(0)
+        , content_length(0) {
+        uri[0] = '\0';
+        transport[0] = '\0';
+        session[0] = '\0';
+    }
+};
+
+//! Parse RTSP request from buffer.
+//! @remarks
+//!  Buffer may contain partial request or multiple requests. Lines may be terminated
+//!  with CRLF or LF. Request body, if any, is skipped.
+//! @returns
+//!  number of bytes occupied by request, including body, if @p buf starts with a
+//!  complete request; zero if more data is needed; -1 if request is malformed or
+//!  some of the fields is too long.
+ssize_t parse_rtsp_request(const char* buf, size_t len, RtspRequest& request);
+
+} // namespace ctl
+} // namespace roc
+
+#endif // ROC_CTL_RTSP_REQUEST_H_
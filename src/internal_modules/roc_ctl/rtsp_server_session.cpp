@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_ctl/rtsp_server_session.h"
+#include "roc_address/protocol_map.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_rtp/headers.h"
+
+namespace roc {
+namespace ctl {
+
+namespace {
+
+enum { MaxSdpLen = 1024 };
+
+const char* SourceTrack = "source";
+const char* RepairTrack = "repair";
+
+const char* status_reason(int code) {
+    switch (code) {
+    case 200:
+        return "OK";
+    case 400:
+        return "Bad Request";
+    case 404:
+        return "Not Found";
+    case 454:
+        return "Session Not Found";
+    case 459:
+        return "Aggregate Operation Not Allowed";
+    case 461:
+        return "Unsupported Transport";
+    case 501:
+        return "Not Implemented";
+    case 503:
+        return "Service Unavailable";
+    default:
+        break;
+    }
+
+    roc_panic("rtsp server session: unexpected status code %d", code);
+}
+
+// FEC encoding ids from IANA "FEC Framework (FECFRAME) FEC Encoding IDs" registry.
+int fec_encoding_id(address::Protocol source_proto) {
+    const address::ProtocolAttrs* attrs =
+        address::ProtocolMap::instance().find_proto_by_id(source_proto);
+    if (!attrs) {
+        return -1;
+    }
+
+    switch (attrs->fec_scheme) {
+    case packet::FEC_LDPC_Staircase:
+        return 7;
+    case packet::FEC_ReedSolomon_M8:
+        return 8;
+    case packet::FEC_RLC:
+        return 10;
+    default:
+        break;
+    }
+
+    return -1;
+}
+
+// Repair media is announced only if FEC scheme is known.
+bool has_repair_media(const RtspMediaInfo& media) {
+    return media.repair_port >= 0 && fec_encoding_id(media.source_proto) >= 0;
+}
+
+// Only UDP unicast RTP transport is supported, TCP interleaving and
+// multicast require per-session ports.
+bool is_supported_transport(const char* transport) {
+    if (strncmp(transport, "RTP/AVP", 7) != 0) {
+        return false;
+    }
+    if (strncmp(transport + 7, "/TCP", 4) == 0) {
+        return false;
+    }
+    if (strstr(transport, "multicast") || strstr(transport, "interleaved")) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+RtspServerSession::RtspServerSession(const char* path, const char* session_id)
+    : state_(State_Init)
+    , valid_(false) {
+    roc_panic_if(!session_id);
+
+    path_[0] = '\0';
+    session_id_[0] = '\0';
+
+    // path is stored without trailing slash, so that root is empty string
+    size_t path_len = path ? strlen(path) : 0;
+    while (path_len > 0 && path[path_len - 1] == '/') {
+        path_len--;
+    }
+
+    const size_t session_id_len = strlen(session_id);
+
+    if (path_len > MaxPathLen || session_id_len == 0
+        || session_id_len > MaxSessionIdLen) {
+        roc_log(LogError, "rtsp server session: invalid path or session id");
+        return;
+    }
+
+    memcpy(path_, path, path_len);
+    path_[path_len] = '\0';
+
+    memcpy(session_id_, session_id, session_id_len);
+    session_id_[session_id_len] = '\0';
+
+    valid_ = true;
+}
+
+bool RtspServerSession::valid() const {
+    return valid_;
+}
+
+bool RtspServerSession::is_playing() const {
+    roc_panic_if_not(valid());
+
+    return state_ == State_Playing;
+}
+
+bool RtspServerSession::handle_request(const RtspRequest& request,
+                                       const RtspMediaInfo& media,
+                                       const char* local_host,
+                                       core::StringBuilder& response) {
+    roc_panic_if_not(valid());
+    roc_panic_if(!local_host);
+
+    roc_log(LogDebug, "rtsp server session: handling request: method=%s uri=%s cseq=%lu",
+            rtsp_method_to_str(request.method), request.uri, request.cseq);
+
+    switch (request.method) {
+    case RtspMethod_Options:
+        return handle_options_(request, response);
+
+    case RtspMethod_Describe:
+        return handle_describe_(request, media, local_host, response);
+
+    case RtspMethod_Setup:
+        return handle_setup_(request, media, response);
+
+    case RtspMethod_Play:
+        return handle_play_(request, response);
+
+    case RtspMethod_Teardown:
+        return handle_teardown_(request, response);
+
+    case RtspMethod_Unknown:
+        break;
+    }
+
+    return format_error_(request, 501, response);
+}
+
+bool RtspServerSession::handle_bad_request(core::StringBuilder& response) {
+    RtspRequest request;
+    return format_error_(request, 400, response);
+}
+
+bool RtspServerSession::handle_options_(const RtspRequest& request,
+                                        core::StringBuilder& response) {
+    format_status_(request, 200, response);
+    response.append_str("Public: OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN\r\n");
+    response.append_str("\r\n");
+
+    return response.ok();
+}
+
+bool RtspServerSession::handle_describe_(const RtspRequest& request,
+                                         const RtspMediaInfo& media,
+                                         const char* local_host,
+                                         core::StringBuilder& response) {
+    char track[8];
+    if (!match_path_(request.uri, track, sizeof(track)) || *track) {
+        return format_error_(request, 404, response);
+    }
+
+    if (media.source_port < 0) {
+        roc_log(LogDebug, "rtsp server session: can't describe: no source attached");
+        return format_error_(request, 503, response);
+    }
+
+    char sdp[MaxSdpLen];
+    core::StringBuilder sdp_builder(sdp, sizeof(sdp));
+
+    if (!format_sdp_(media, local_host, sdp_builder)) {
+        roc_log(LogError, "rtsp server session: can't describe: sdp too long");
+        return false;
+    }
+
+    format_status_(request, 200, response);
+
+    // relative a=control URIs are resolved against Content-Base
+    response.append_str("Content-Base: ");
+    response.append_str(request.uri);
+    const size_t uri_len = strlen(request.uri);
+    if (uri_len == 0 || request.uri[uri_len - 1] != '/') {
+        response.append_char('/');
+    }
+    response.append_str("\r\n");
+
+    response.append_str("Content-Type: application/sdp\r\n");
+    response.append_str("Content-Length: ");
+    response.append_uint(strlen(sdp), 10);
+    response.append_str("\r\n\r\n");
+    response.append_str(sdp);
+
+    return response.ok();
+}
+
+bool RtspServerSession::handle_setup_(const RtspRequest& request,
+                                      const RtspMediaInfo& media,
+                                      core::StringBuilder& response) {
+    char track[8];
+    if (!match_path_(request.uri, track, sizeof(track))) {
+        return format_error_(request, 404, response);
+    }
+
+    if (*request.session && !check_session_(request)) {
+        return format_error_(request, 454, response);
+    }
+
+    int server_port = -1, server_rtcp_port = -1;
+
+    if (*track == '\0' || strcmp(track, SourceTrack) == 0) {
+        // aggregate URI may be used to setup the only media
+        if (*track == '\0' && has_repair_media(media)) {
+            return format_error_(request, 459, response);
+        }
+        server_port = media.source_port;
+        server_rtcp_port = media.control_port;
+    } else if (strcmp(track, RepairTrack) == 0 && has_repair_media(media)) {
+        server_port = media.repair_port;
+    }
+
+    if (server_port < 0) {
+        return format_error_(request, 404, response);
+    }
+
+    if (!is_supported_transport(request.transport)) {
+        roc_log(LogDebug, "rtsp server session: unsupported transport: %s",
+                request.transport);
+        return format_error_(request, 461, response);
+    }
+
+    if (state_ == State_Init) {
+        state_ = State_Ready;
+    }
+
+    format_status_(request, 200, response);
+
+    response.append_str("Transport: ");
+    response.append_str(request.transport);
+    response.append_str(";server_port=");
+    response.append_uint((uint64_t)server_port, 10);
+    if (server_rtcp_port >= 0) {
+        response.append_char('-');
+        response.append_uint((uint64_t)server_rtcp_port, 10);
+    }
+    response.append_str("\r\n");
+
+    response.append_str("Session: ");
+    response.append_str(session_id_);
+    response.append_str("\r\n\r\n");
+
+    return response.ok();
+}
+
+bool RtspServerSession::handle_play_(const RtspRequest& request,
+                                     core::StringBuilder& response) {
+    if (!check_session_(request)) {
+        return format_error_(request, 454, response);
+    }
+
+    state_ = State_Playing;
+
+    format_status_(request, 200, response);
+
+    response.append_str("Session: ");
+    response.append_str(session_id_);
+    response.append_str("\r\n");
+    response.append_str("Range: npt=0.000-\r\n\r\n");
+
+    return response.ok();
+}
+
+bool RtspServerSession::handle_teardown_(const RtspRequest& request,
+                                         core::StringBuilder& response) {
+    if (!check_session_(request)) {
+        return format_error_(request, 454, response);
+    }
+
+    state_ = State_Init;
+
+    format_status_(request, 200, response);
+    response.append_str("\r\n");
+
+    return response.ok();
+}
+
+bool RtspServerSession::format_sdp_(const RtspMediaInfo& media,
+                                    const char* local_host,
+                                    core::StringBuilder& sdp) {
+    const char* addrtype = strchr(local_host, ':') ? "IP6" : "IP4";
+
+    sdp.append_str("v=0\r\n");
+
+    sdp.append_str("o=- ");
+    sdp.append_str(session_id_);
+    sdp.append_str(" 1 IN ");
+    sdp.append_str(addrtype);
+    sdp.append_char(' ');
+    sdp.append_str(local_host);
+    sdp.append_str("\r\n");
+
+    sdp.append_str("s=Roc Streaming\r\n");
+
+    sdp.append_str("c=IN ");
+    sdp.append_str(addrtype);
+    sdp.append_char(' ');
+    sdp.append_str(local_host);
+    sdp.append_str("\r\n");
+
+    sdp.append_str("t=0 0\r\n");
+
+    // built-in payload types, which are always known to receiver
+    sdp.append_str("m=audio ");
+    sdp.append_uint((uint64_t)media.source_port, 10);
+    sdp.append_str(" RTP/AVP ");
+    sdp.append_uint(rtp::PayloadType_L16_Stereo, 10);
+    sdp.append_char(' ');
+    sdp.append_uint(rtp::PayloadType_L16_Mono, 10);
+    sdp.append_str("\r\n");
+
+    sdp.append_str("a=rtpmap:");
+    sdp.append_uint(rtp::PayloadType_L16_Stereo, 10);
+    sdp.append_str(" L16/44100/2\r\n");
+
+    sdp.append_str("a=rtpmap:");
+    sdp.append_uint(rtp::PayloadType_L16_Mono, 10);
+    sdp.append_str(" L16/44100/1\r\n");
+
+    if (media.control_port >= 0) {
+        // RFC 3605
+        sdp.append_str("a=rtcp:");
+        sdp.append_uint((uint64_t)media.control_port, 10);
+        sdp.append_str("\r\n");
+    }
+
+    if (has_repair_media(media)) {
+        // RFC 6364
+        sdp.append_str("a=fec-source-flow: id=0\r\n");
+    }
+
+    sdp.append_str("a=control:");
+    sdp.append_str(SourceTrack);
+    sdp.append_str("\r\n");
+
+    if (has_repair_media(media)) {
+        sdp.append_str("m=application ");
+        sdp.append_uint((uint64_t)media.repair_port, 10);
+        sdp.append_str(" UDP/FEC\r\n");
+
+        sdp.append_str("a=fec-repair-flow: encoding-id=");
+        sdp.append_uint((uint64_t)fec_encoding_id(media.source_proto), 10);
+        sdp.append_str("\r\n");
+
+        sdp.append_str("a=control:");
+        sdp.append_str(RepairTrack);
+        sdp.append_str("\r\n");
+    }
+
+    return sdp.ok();
+}
+
+bool RtspServerSession::format_status_(const RtspRequest& request,
+                                       int code,
+                                       core::StringBuilder& response) {
+    response.append_str("RTSP/1.0 ");
+    response.append_uint((uint64_t)code, 10);
+    response.append_char(' ');
+    response.append_str(status_reason(code));
+    response.append_str("\r\n");
+
+    response.append_str("CSeq: ");
+    response.append_uint(request.cseq, 10);
+    response.append_str("\r\n");
+
+    return response.ok();
+}
+
+bool RtspServerSession::format_error_(const RtspRequest& request,
+                                      int code,
+                                      core::StringBuilder& response) {
+    roc_log(LogDebug, "rtsp server session: replying with error: method=%s code=%d",
+            rtsp_method_to_str(request.method), code);
+
+    format_status_(request, code, response);
+    response.append_str("\r\n");
+
+    return response.ok();
+}
+
+bool RtspServerSession::match_path_(const char* uri,
+                                    char* track,
+                                    size_t track_size) const {
+    // absolute "rtsp://host[:port]/path" or relative "/path"
+    const char* path = strstr(uri, "://");
+    if (path) {
+        path = strchr(path + 3, '/');
+        if (!path) {
+            path = "";
+        }
+    } else if (*uri == '/') {
+        path = uri;
+    } else {
+        return false;
+    }
+
+    size_t path_len = strcspn(path, "?");
+    while (path_len > 0 && path[path_len - 1] == '/') {
+        path_len--;
+    }
+
+    const size_t served_len = strlen(path_);
+
+    if (path_len < served_len || memcmp(path, path_, served_len) != 0) {
+        return false;
+    }
+
+    if (path_len == served_len) {
+        *track = '\0';
+        return true;
+    }
+
+    // path may be followed by track name from a=control
+    const char* track_begin = path + served_len;
+    if (*track_begin != '/') {
+        return false;
+    }
+    track_begin++;
+
+    const size_t track_len = path_len - served_len - 1;
+    if (track_len >= track_size || memchr(track_begin, '/', track_len)) {
+        return false;
+    }
+
+    memcpy(track, track_begin, track_len);
+    track[track_len] = '\0';
+
+    return true;
+}
+
+bool RtspServerSession::check_session_(const RtspRequest& request) const {
+    return state_ != State_Init && strcmp(request.session, session_id_) == 0;
+}
+
+} // namespace ctl
+} // namespace roc
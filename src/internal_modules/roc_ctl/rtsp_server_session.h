@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_ctl/rtsp_server_session.h
+//! @brief RTSP server session.
+
+#ifndef ROC_CTL_RTSP_SERVER_SESSION_H_
+#define ROC_CTL_RTSP_SERVER_SESSION_H_
+
+#include "roc_address/protocol.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/string_builder.h"
+#include "roc_ctl/rtsp_request.h"
+
+namespace roc {
+namespace ctl {
+
+//! Media announced by RTSP server.
+//! @remarks
+//!  Describes receiver ports bound for consolidated interface. A negative port
+//!  means that corresponding interface is not bound.
+struct RtspMediaInfo {
+    //! Port of audio source interface.
+    int source_port;
+
+    //! Protocol of audio source interface.
+    //! Defines FEC scheme announced for repair interface.
+    address::Protocol source_proto;
+
+    //! Port of audio repair interface.
+    int repair_port;
+
+    //! Port of audio control interface.
+    int control_port;
+
+    //! Initialize.
+    RtspMediaInfo()
+        : source_port(-1)
+        , source_proto(address::Proto_None)
+        , repair_port(-1)
+        , control_port(-1) {
+    }
+};
+
+//! RTSP server session.
+//! @remarks
+//!  Handles requests of a single RTSP connection. Supports OPTIONS, DESCRIBE,
+//!  SETUP, PLAY, and TEARDOWN methods, with UDP unicast transport only.
+//!
+//!  DESCRIBE returns SDP with audio source media and, if bound, repair media
+//!  with a=fec-repair-flow attribute and control port in a=rtcp attribute.
+//!  Ports are not allocated per session: receiver ports are shared by all
+//!  senders and sessions are distinguished by source address, so SETUP just
+//!  reports the already bound ports.
+class RtspServerSession : public core::NonCopyable<> {
+public:
+    //! Maximum length of session identifier and path.
+    enum { MaxSessionIdLen = 31, MaxPathLen = 255 };
+
+    //! Initialize.
+    //! @remarks
+    //!  @p path is resource path served by endpoint. @p session_id is reported
+    //!  in Session header after SETUP.
+    RtspServerSession(const char* path, const char* session_id);
+
+    //! Check if session was successfully constructed.
+    bool valid() const;
+
+    //! Check if PLAY was requested and TEARDOWN was not.
+    bool is_playing() const;
+
+    //! Handle request and format response.
+    //! @remarks
+    //!  @p local_host is address on which client reached server; it is announced
+    //!  in SDP, so that it is reachable by client even if receiver ports are
+    //!  bound to a wildcard address.
+    //! @returns
+    //!  false if response doesn't fit into @p response.
+    bool handle_request(const RtspRequest& request,
+                        const RtspMediaInfo& media,
+                        const char* local_host,
+                        core::StringBuilder& response);
+
+    //! Format response to malformed request.
+    //! @returns
+    //!  false if response doesn't fit into @p response.
+    bool handle_bad_request(core::StringBuilder& response);
+
+private:
+    enum State { State_Init, State_Ready, State_Playing };
+
+    bool handle_options_(const RtspRequest&, core::StringBuilder&);
+    bool handle_describe_(const RtspRequest&,
+                          const RtspMediaInfo&,
+                          const char* local_host,
+                          core::StringBuilder&);
+    bool handle_setup_(const RtspRequest&, const RtspMediaInfo&, core::StringBuilder&);
+    bool handle_play_(const RtspRequest&, core::StringBuilder&);
+    bool handle_teardown_(const RtspRequest&, core::StringBuilder&);
+
+    bool format_sdp_(const RtspMediaInfo&, const char* local_host, core::StringBuilder&);
+
+    bool format_status_(const RtspRequest&, int code, core::StringBuilder&);
+    bool format_error_(const RtspRequest&, int code, core::StringBuilder&);
+
+    bool match_path_(const char* uri, char* track, size_t track_size) const;
+    bool check_session_(const RtspRequest&) const;
+
+    char path_[MaxPathLen + 1];
+    char session_id_[MaxSessionIdLen + 1];
+
+    State state_;
+    bool valid_;
+};
+
+} // namespace ctl
+} // namespace roc
+
+#endif // ROC_CTL_RTSP_SERVER_SESSION_H_
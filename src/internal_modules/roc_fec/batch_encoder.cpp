@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/batch_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/scoped_lock.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+BatchEncoderJob::BatchEncoderJob(core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , payload_size_(0)
+    , buffers_(allocator)
+    , encoded_(false) {
+}
+
+bool BatchEncoderJob::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    if (!buffers_.resize(sblen + rblen)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    payload_size_ = payload_size;
+    encoded_ = false;
+
+    return true;
+}
+
+void BatchEncoderJob::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    if (index >= sblen_ + rblen_) {
+        roc_panic("batch encoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("batch encoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("batch encoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    buffers_[index] = buffer;
+}
+
+bool BatchEncoderJob::encoded() const {
+    return encoded_;
+}
+
+void BatchEncoderJob::end() {
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        buffers_[i] = core::Slice<uint8_t>();
+    }
+    encoded_ = false;
+}
+
+BatchEncoder::BatchEncoder(core::IAllocator& allocator)
+    : matrix_(allocator) {
+}
+
+BatchEncoder::~BatchEncoder() {
+    if (jobs_.size() != 0) {
+        roc_panic("batch encoder: jobs are still submitted when destroying: n_jobs=%lu",
+                  (unsigned long)jobs_.size());
+    }
+}
+
+size_t BatchEncoder::max_block_length() const {
+    return Rs8mMatrix::MaxBlockLength;
+}
+
+void BatchEncoder::submit(BatchEncoderJob& job) {
+    for (size_t i = 0; i < job.buffers_.size(); i++) {
+        if (!job.buffers_[i]) {
+            roc_panic("batch encoder: buffer not set: index=%lu", (unsigned long)i);
+        }
+    }
+
+    core::Mutex::Lock lock(mutex_);
+
+    job.encoded_ = false;
+    jobs_.push_back(job);
+}
+
+void BatchEncoder::flush() {
+    core::Mutex::Lock lock(mutex_);
+
+    BatchEncoderJob* batch[MaxBatchSize];
+
+    for (;;) {
+        const size_t batch_size = take_batch_(batch);
+        if (batch_size == 0) {
+            break;
+        }
+        encode_batch_(batch, batch_size);
+    }
+}
+
+void BatchEncoder::cancel(BatchEncoderJob& job) {
+    core::Mutex::Lock lock(mutex_);
+
+    if (jobs_.contains(job)) {
+        jobs_.remove(job);
+    }
+}
+
+// take first submitted job and other jobs with same sizes
+size_t BatchEncoder::take_batch_(BatchEncoderJob** batch) {
+    BatchEncoderJob* first = jobs_.front();
+    if (!first) {
+        return 0;
+    }
+
+    size_t batch_size = 0;
+
+    for (BatchEncoderJob* job = first; job && batch_size < MaxBatchSize;) {
+        BatchEncoderJob* next_job = jobs_.nextof(*job);
+
+        if (job->sblen_ == first->sblen_ && job->rblen_ == first->rblen_
+            && job->payload_size_ == first->payload_size_) {
+            jobs_.remove(*job);
+            batch[batch_size++] = job;
+        }
+
+        job = next_job;
+    }
+
+    return batch_size;
+}
+
+void BatchEncoder::encode_batch_(BatchEncoderJob** batch, size_t batch_size) {
+    const size_t sblen = batch[0]->sblen_;
+    const size_t rblen = batch[0]->rblen_;
+    const size_t payload_size = batch[0]->payload_size_;
+
+    if (!matrix_.build(sblen, rblen)) {
+        roc_log(LogError,
+                "batch encoder: can't build matrix, dropping batch:"
+                " sblen=%lu rblen=%lu n_jobs=%lu",
+                (unsigned long)sblen, (unsigned long)rblen, (unsigned long)batch_size);
+        return;
+    }
+
+    roc_log(LogTrace,
+            "batch encoder: encoding batch: sblen=%lu rblen=%lu payload_size=%lu"
+            " n_jobs=%lu",
+            (unsigned long)sblen, (unsigned long)rblen, (unsigned long)payload_size,
+            (unsigned long)batch_size);
+
+    const Gf256& gf = Gf256::instance();
+
+    for (size_t r = 0; r < rblen; r++) {
+        const uint8_t* coeffs = matrix_.repair_row(r);
+
+        for (size_t s = 0; s < sblen; s++) {
+            for (size_t n = 0; n < batch_size; n++) {
+                uint8_t* repair = batch[n]->buffers_[sblen + r].data();
+                const uint8_t* source = batch[n]->buffers_[s].data();
+
+                // first product overwrites repair buffer, so it needn't be cleared
+                if (s == 0) {
+                    gf.mul_region(repair, source, coeffs[s], payload_size);
+                } else {
+                    gf.mul_add_region(repair, source, coeffs[s], payload_size);
+                }
+            }
+        }
+    }
+
+    for (size_t n = 0; n < batch_size; n++) {
+        batch[n]->encoded_ = true;
+    }
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/batch_encoder.h
+//! @brief Batched Reed-Solomon encoder.
+
+#ifndef ROC_FEC_BATCH_ENCODER_H_
+#define ROC_FEC_BATCH_ENCODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_fec/rs8m_matrix.h"
+
+namespace roc {
+namespace fec {
+
+class BatchEncoder;
+
+//! Encoding job for BatchEncoder.
+//! @remarks
+//!  Holds source and repair buffers of one block. Job object is owned by the
+//!  caller and should not be destroyed while it's submitted.
+class BatchEncoderJob : public core::ListNode, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit BatchEncoderJob(core::IAllocator& allocator);
+
+    //! Start block.
+    //! @returns
+    //!  false if allocation failed.
+    bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store source or repair buffer for current block.
+    //! @pre
+    //!  This method may be called only between begin() and end() calls.
+    void set(size_t index, const core::Slice<uint8_t>& buffer);
+
+    //! Check if repair buffers were filled.
+    //! @remarks
+    //!  Valid after the job was flushed by BatchEncoder.
+    bool encoded() const;
+
+    //! Finish block.
+    //! @remarks
+    //!  Releases stored buffers.
+    void end();
+
+private:
+    friend class BatchEncoder;
+
+    size_t sblen_;
+    size_t rblen_;
+    size_t payload_size_;
+
+    core::Array<core::Slice<uint8_t> > buffers_;
+
+    bool encoded_;
+};
+
+//! Batched Reed-Solomon encoder over GF(2^8).
+//!
+//! Produces the same repair symbols as Rs8mEncoder, but encodes blocks of
+//! many streams together. Submitted jobs are accumulated until flush(), then
+//! jobs with the same block and payload size are processed in batches: every
+//! coefficient of generator matrix is applied to the corresponding source
+//! symbols of all blocks of the batch in a row, while its lookup tables are
+//! hot. The matrix itself is computed once and shared by all streams.
+//!
+//! Thread-safe. Jobs are encoded under a lock, so that when flush() returns,
+//! all jobs submitted before it are encoded, no matter which thread encoded
+//! them.
+class BatchEncoder : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit BatchEncoder(core::IAllocator& allocator);
+
+    //! Destroy.
+    //! @remarks
+    //!  There should be no submitted jobs at this point.
+    ~BatchEncoder();
+
+    //! Get the maximum number of encoding symbols in block.
+    size_t max_block_length() const;
+
+    //! Add job to the next batch.
+    //! @pre
+    //!  All buffers of the job should be set. Job should not be already submitted.
+    void submit(BatchEncoderJob& job);
+
+    //! Encode all submitted jobs.
+    void flush();
+
+    //! Remove job if it's still submitted.
+    void cancel(BatchEncoderJob& job);
+
+private:
+    enum { MaxBatchSize = 32 };
+
+    size_t take_batch_(BatchEncoderJob** batch);
+    void encode_batch_(BatchEncoderJob** batch, size_t batch_size);
+
+    core::Mutex mutex_;
+
+    core::List<BatchEncoderJob, core::NoOwnership> jobs_;
+
+    Rs8mMatrix matrix_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_BATCH_ENCODER_H_
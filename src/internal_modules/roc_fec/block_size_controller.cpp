@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/block_size_controller.h"
+#include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace fec {
+
+BlockSizeController::BlockSizeController(const BlockSizeControllerConfig& config,
+                                         const WriterConfig& writer_config,
+                                         size_t max_block_length)
+    : config_(config)
+    , max_source_packets_(writer_config.n_source_packets)
+    , min_source_packets_(ROC_MIN(config.min_source_packets,
+                                  writer_config.n_source_packets))
+    , max_block_length_(max_block_length)
+    , loss_(0)
+    , has_loss_(false)
+    , n_source_packets_(writer_config.n_source_packets)
+    , n_repair_packets_(writer_config.n_repair_packets) {
+    if (config.loss_smoothing <= 0 || config.loss_smoothing > 1) {
+        roc_panic("fec block size controller: loss_smoothing should be in (0; 1]");
+    }
+    if (max_source_packets_ == 0) {
+        roc_panic("fec block size controller: n_source_packets should be non-zero");
+    }
+}
+
+void BlockSizeController::update(float fract_loss) {
+    if (!(fract_loss >= 0)) {
+        fract_loss = 0;
+    }
+    if (fract_loss > 1) {
+        fract_loss = 1;
+    }
+
+    if (has_loss_) {
+        loss_ += (fract_loss - loss_) * config_.loss_smoothing;
+    } else {
+        loss_ = fract_loss;
+        has_loss_ = true;
+    }
+
+    const size_t prev_sblen = n_source_packets_;
+    const size_t prev_rblen = n_repair_packets_;
+
+    compute_sizes_();
+
+    if (n_source_packets_ != prev_sblen || n_repair_packets_ != prev_rblen) {
+        roc_log(LogDebug,
+                "fec block size controller: update: loss=%.4f sbl=%lu rbl=%lu",
+                (double)loss_, (unsigned long)n_source_packets_,
+                (unsigned long)n_repair_packets_);
+    }
+}
+
+float BlockSizeController::loss() const {
+    return loss_;
+}
+
+size_t BlockSizeController::n_source_packets() const {
+    return n_source_packets_;
+}
+
+size_t BlockSizeController::n_repair_packets() const {
+    return n_repair_packets_;
+}
+
+void BlockSizeController::compute_sizes_() {
+    // shorten block linearly while loss grows up to high_loss
+    float shortening = 1;
+    if (config_.high_loss > 0 && loss_ < config_.high_loss) {
+        shortening = loss_ / config_.high_loss;
+    }
+
+    size_t sblen = max_source_packets_
+        - (size_t)(shortening * float(max_source_packets_ - min_source_packets_) + 0.5f);
+
+    if (max_block_length_ > config_.min_repair_packets
+        && sblen > max_block_length_ - config_.min_repair_packets) {
+        sblen = max_block_length_ - config_.min_repair_packets;
+    }
+
+    // repair packets should cover expected losses in the whole block, including
+    // repair packets themselves: rblen >= redundancy * loss * (sblen + rblen)
+    const float expected = config_.redundancy * loss_;
+
+    size_t rblen = sblen;
+    if (expected < 1) {
+        const float exact = expected * float(sblen) / (1 - expected);
+        rblen = (size_t)exact;
+        if (float(rblen) < exact) {
+            rblen++;
+        }
+    }
+
+    // overhead is limited to 100%
+    rblen = ROC_MIN(rblen, sblen);
+    rblen = ROC_MAX(rblen, config_.min_repair_packets);
+
+    if (sblen + rblen > max_block_length_) {
+        rblen = max_block_length_ > sblen ? max_block_length_ - sblen : 0;
+    }
+
+    n_source_packets_ = sblen;
+    n_repair_packets_ = rblen;
+}
+
+} // namespace fec
+} // namespace roc
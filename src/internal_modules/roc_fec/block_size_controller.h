@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/block_size_controller.h
+//! @brief Adaptive FEC block size controller.
+
+#ifndef ROC_FEC_BLOCK_SIZE_CONTROLLER_H_
+#define ROC_FEC_BLOCK_SIZE_CONTROLLER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_fec/writer.h"
+
+namespace roc {
+namespace fec {
+
+//! Adaptive FEC block size parameters.
+struct BlockSizeControllerConfig {
+    //! Adapt block size to reported losses.
+    bool enabled;
+
+    //! Minimum number of source packets in block.
+    //! Maximum number is defined by WriterConfig::n_source_packets.
+    size_t min_source_packets;
+
+    //! Minimum number of repair packets in block.
+    size_t min_repair_packets;
+
+    //! Loss fraction at which block is shortened to minimum length.
+    float high_loss;
+
+    //! Ratio between repair packets and expected lost packets in block.
+    float redundancy;
+
+    //! Weight of a new loss report in moving average, in range (0; 1].
+    float loss_smoothing;
+
+    BlockSizeControllerConfig()
+        : enabled(false)
+        , min_source_packets(10)
+        , min_repair_packets(1)
+        , high_loss(0.2f)
+        , redundancy(2.0f)
+        , loss_smoothing(0.25f) {
+    }
+};
+
+//! Adaptive FEC block size controller.
+//!
+//! Computes block size from the fraction of lost packets reported by receiver.
+//! Starts with the block size from writer config.
+//!
+//! On a clean link, uses the maximum number of source packets and the minimum
+//! number of repair packets, to keep bandwidth overhead minimal. When losses
+//! grow, the number of repair packets grows to cover expected losses with the
+//! configured margin, and the block is shortened gradually, to reduce the time
+//! needed to recover a lost packet.
+class BlockSizeController : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p max_block_length defines maximum number of source and repair packets
+    //!  in block supported by encoder.
+    BlockSizeController(const BlockSizeControllerConfig& config,
+                        const WriterConfig& writer_config,
+                        size_t max_block_length);
+
+    //! Update controller with fraction of lost packets reported by receiver.
+    void update(float fract_loss);
+
+    //! Get smoothed fraction of lost packets.
+    float loss() const;
+
+    //! Get current number of source packets per block.
+    size_t n_source_packets() const;
+
+    //! Get current number of repair packets per block.
+    size_t n_repair_packets() const;
+
+private:
+    void compute_sizes_();
+
+    const BlockSizeControllerConfig config_;
+
+    const size_t max_source_packets_;
+    const size_t min_source_packets_;
+    const size_t max_block_length_;
+
+    float loss_;
+    bool has_loss_;
+
+    size_t n_source_packets_;
+    size_t n_repair_packets_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_BLOCK_SIZE_CONTROLLER_H_
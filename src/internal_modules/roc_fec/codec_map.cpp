@@ -11,6 +11,8 @@
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_fec/rs8m_decoder.h"
+#include "roc_fec/rs8m_encoder.h"
 #include "roc_packet/fec_scheme_to_str.h"
 
 #ifdef ROC_TARGET_OPENFEC
@@ -39,14 +41,21 @@ ROC_ATTR_UNUSED I* ctor_func(const CodecConfig& config,
 
 CodecMap::CodecMap()
     : n_codecs_(0) {
-#ifdef ROC_TARGET_OPENFEC
     {
+        // built-in implementation is used instead of OpenFEC because it
+        // uses SIMD instructions and is considerably faster
         Codec codec;
-        codec.encoder_ctor = ctor_func<IBlockEncoder, OpenfecEncoder>;
-        codec.decoder_ctor = ctor_func<IBlockDecoder, OpenfecDecoder>;
+        codec.encoder_ctor = ctor_func<IBlockEncoder, Rs8mEncoder>;
+        codec.decoder_ctor = ctor_func<IBlockDecoder, Rs8mDecoder>;
 
         codec.scheme = packet::FEC_ReedSolomon_M8;
         add_codec_(codec);
+    }
+#ifdef ROC_TARGET_OPENFEC
+    {
+        Codec codec;
+        codec.encoder_ctor = ctor_func<IBlockEncoder, OpenfecEncoder>;
+        codec.decoder_ctor = ctor_func<IBlockDecoder, OpenfecDecoder>;
 
         codec.scheme = packet::FEC_LDPC_Staircase;
         add_codec_(codec);
@@ -55,6 +64,10 @@ CodecMap::CodecMap()
 }
 
 bool CodecMap::is_supported(packet::FecScheme scheme) const {
+    if (scheme == packet::FEC_RLC) {
+        // sliding window scheme doesn't use block codecs
+        return true;
+    }
     return find_codec_(scheme);
 }
 
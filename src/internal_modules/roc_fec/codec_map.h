@@ -32,6 +32,9 @@ public:
     }
 
     //! Check whether given FEC scheme is supported.
+    //! @remarks
+    //!  Sliding window schemes are always supported, but have no block
+    //!  encoder and decoder, and are not listed by nth_scheme().
     bool is_supported(packet::FecScheme scheme) const;
 
     //! Get number of supported FEC schemes.
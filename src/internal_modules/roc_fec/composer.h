@@ -145,8 +145,8 @@ public:
 
         payload_id.clear();
 
-        roc_panic_if((fec.encoding_symbol_id >> 16) != 0);
-        payload_id.set_esi((uint16_t)fec.encoding_symbol_id);
+        roc_panic_if(fec.encoding_symbol_id > PayloadID::max_esi());
+        payload_id.set_esi((uint32_t)fec.encoding_symbol_id);
 
         payload_id.set_sbn(fec.source_block_number);
 
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/gf256.h"
+#include "roc_core/attributes.h"
+#include "roc_core/cpu_dispatch.h"
+#include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/panic.h"
+
+#if ROC_CPU_FAMILY == ROC_CPU_FAMILY_X86 && defined(ROC_ATTR_TARGET)
+#define ROC_GF256_X86
+#include <immintrin.h>
+#endif
+
+// vqtbl1q_u8() is available only on AArch64
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && defined(__aarch64__)
+#define ROC_GF256_NEON
+#include <arm_neon.h>
+#endif
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+// when Add is true, adds product to dst, otherwise overwrites dst
+template <bool Add>
+void mul_generic(uint8_t* dst,
+                 const uint8_t* src,
+                 const uint8_t* mul_tab,
+                 const uint8_t*,
+                 const uint8_t*,
+                 size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        dst[n] = Add ? uint8_t(dst[n] ^ mul_tab[src[n]]) : mul_tab[src[n]];
+    }
+}
+
+#ifdef ROC_GF256_X86
+
+template <bool Add>
+ROC_ATTR_TARGET("ssse3")
+void mul_ssse3(uint8_t* dst,
+               const uint8_t* src,
+               const uint8_t* mul_tab,
+               const uint8_t* lo_tab,
+               const uint8_t* hi_tab,
+               size_t size) {
+    const __m128i lo = _mm_loadu_si128((const __m128i*)lo_tab);
+    const __m128i hi = _mm_loadu_si128((const __m128i*)hi_tab);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+
+    size_t n = 0;
+
+    for (; n + 16 <= size; n += 16) {
+        const __m128i x = _mm_loadu_si128((const __m128i*)(src + n));
+
+        const __m128i x_lo = _mm_and_si128(x, mask);
+        const __m128i x_hi = _mm_and_si128(_mm_srli_epi64(x, 4), mask);
+
+        __m128i prod =
+            _mm_xor_si128(_mm_shuffle_epi8(lo, x_lo), _mm_shuffle_epi8(hi, x_hi));
+
+        if (Add) {
+            prod = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(dst + n)), prod);
+        }
+
+        _mm_storeu_si128((__m128i*)(dst + n), prod);
+    }
+
+    mul_generic<Add>(dst + n, src + n, mul_tab, lo_tab, hi_tab, size - n);
+}
+
+template <bool Add>
+ROC_ATTR_TARGET("avx2")
+void mul_avx2(uint8_t* dst,
+              const uint8_t* src,
+              const uint8_t* mul_tab,
+              const uint8_t* lo_tab,
+              const uint8_t* hi_tab,
+              size_t size) {
+    const __m256i lo =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)lo_tab));
+    const __m256i hi =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)hi_tab));
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+
+    size_t n = 0;
+
+    for (; n + 32 <= size; n += 32) {
+        const __m256i x = _mm256_loadu_si256((const __m256i*)(src + n));
+
+        const __m256i x_lo = _mm256_and_si256(x, mask);
+        const __m256i x_hi = _mm256_and_si256(_mm256_srli_epi64(x, 4), mask);
+
+        __m256i prod = _mm256_xor_si256(_mm256_shuffle_epi8(lo, x_lo),
+                                        _mm256_shuffle_epi8(hi, x_hi));
+
+        if (Add) {
+            prod = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(dst + n)), prod);
+        }
+
+        _mm256_storeu_si256((__m256i*)(dst + n), prod);
+    }
+
+    mul_generic<Add>(dst + n, src + n, mul_tab, lo_tab, hi_tab, size - n);
+}
+
+#endif // ROC_GF256_X86
+
+#ifdef ROC_GF256_NEON
+
+template <bool Add>
+void mul_neon(uint8_t* dst,
+              const uint8_t* src,
+              const uint8_t* mul_tab,
+              const uint8_t* lo_tab,
+              const uint8_t* hi_tab,
+              size_t size) {
+    const uint8x16_t lo = vld1q_u8(lo_tab);
+    const uint8x16_t hi = vld1q_u8(hi_tab);
+    const uint8x16_t mask = vdupq_n_u8(0x0f);
+
+    size_t n = 0;
+
+    for (; n + 16 <= size; n += 16) {
+        const uint8x16_t x = vld1q_u8(src + n);
+
+        uint8x16_t prod = veorq_u8(vqtbl1q_u8(lo, vandq_u8(x, mask)),
+                                   vqtbl1q_u8(hi, vshrq_n_u8(x, 4)));
+
+        if (Add) {
+            prod = veorq_u8(vld1q_u8(dst + n), prod);
+        }
+
+        vst1q_u8(dst + n, prod);
+    }
+
+    mul_generic<Add>(dst + n, src + n, mul_tab, lo_tab, hi_tab, size - n);
+}
+
+#endif // ROC_GF256_NEON
+
+struct Gf256Table {
+    void (*mul)(uint8_t* dst,
+                const uint8_t* src,
+                const uint8_t* mul_tab,
+                const uint8_t* lo_tab,
+                const uint8_t* hi_tab,
+                size_t size);
+    void (*mul_add)(uint8_t* dst,
+                    const uint8_t* src,
+                    const uint8_t* mul_tab,
+                    const uint8_t* lo_tab,
+                    const uint8_t* hi_tab,
+                    size_t size);
+};
+
+const core::CpuVariant<Gf256Table> gf256_variants[] = {
+#ifdef ROC_GF256_X86
+    { core::CpuFeature_AVX2, { mul_avx2<false>, mul_avx2<true> } },
+    { core::CpuFeature_SSSE3, { mul_ssse3<false>, mul_ssse3<true> } },
+#endif
+#ifdef ROC_GF256_NEON
+    { core::CpuFeature_NEON, { mul_neon<false>, mul_neon<true> } },
+#endif
+    { core::CpuFeature_Generic, { mul_generic<false>, mul_generic<true> } },
+};
+
+} // namespace
+
+Gf256::Gf256()
+    : mul_fn_(mul_generic<false>)
+    , mul_add_fn_(mul_generic<true>) {
+    unsigned x = 1;
+    for (size_t n = 0; n < FieldSize - 1; n++) {
+        exp_tab_[n] = (uint8_t)x;
+        log_tab_[x] = (uint8_t)n;
+
+        x <<= 1;
+        if (x & FieldSize) {
+            x ^= Polynomial;
+        }
+    }
+    for (size_t n = FieldSize - 1; n < FieldSize * 2; n++) {
+        exp_tab_[n] = exp_tab_[n - (FieldSize - 1)];
+    }
+    log_tab_[0] = 0;
+
+    for (size_t a = 0; a < FieldSize; a++) {
+        for (size_t b = 0; b < FieldSize; b++) {
+            mul_tab_[a][b] = (a == 0 || b == 0)
+                ? 0
+                : exp_tab_[(size_t)log_tab_[a] + (size_t)log_tab_[b]];
+        }
+        for (size_t b = 0; b < 16; b++) {
+            lo_tab_[a][b] = mul_tab_[a][b];
+            hi_tab_[a][b] = mul_tab_[a][b << 4];
+        }
+    }
+
+    const core::CpuVariant<Gf256Table>& variant =
+        core::cpu_select(gf256_variants, ROC_ARRAY_SIZE(gf256_variants));
+
+    mul_fn_ = variant.table.mul;
+    mul_add_fn_ = variant.table.mul_add;
+
+    roc_log(LogDebug, "gf256: initialized: impl=%s",
+            core::cpu_feature_to_str(variant.feature));
+}
+
+uint8_t Gf256::exp(size_t power) const {
+    return exp_tab_[power % (FieldSize - 1)];
+}
+
+uint8_t Gf256::mul(uint8_t a, uint8_t b) const {
+    return mul_tab_[a][b];
+}
+
+uint8_t Gf256::div(uint8_t a, uint8_t b) const {
+    roc_panic_if_msg(b == 0, "gf256: division by zero");
+
+    if (a == 0) {
+        return 0;
+    }
+    return exp_tab_[(size_t)log_tab_[a] + (FieldSize - 1) - (size_t)log_tab_[b]];
+}
+
+uint8_t Gf256::inv(uint8_t a) const {
+    return div(1, a);
+}
+
+void Gf256::mul_region(uint8_t* dst,
+                       const uint8_t* src,
+                       uint8_t c,
+                       size_t size) const {
+    roc_panic_if(!dst);
+    roc_panic_if(!src);
+
+    if (c == 0) {
+        memset(dst, 0, size);
+        return;
+    }
+
+    mul_fn_(dst, src, mul_tab_[c], lo_tab_[c], hi_tab_[c], size);
+}
+
+void Gf256::mul_add_region(uint8_t* dst,
+                           const uint8_t* src,
+                           uint8_t c,
+                           size_t size) const {
+    roc_panic_if(!dst);
+    roc_panic_if(!src);
+
+    if (c == 0) {
+        return;
+    }
+
+    mul_add_fn_(dst, src, mul_tab_[c], lo_tab_[c], hi_tab_[c], size);
+}
+
+} // namespace fec
+} // namespace roc
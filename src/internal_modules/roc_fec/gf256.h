@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/gf256.h
+//! @brief GF(2^8) arithmetic.
+
+#ifndef ROC_FEC_GF256_H_
+#define ROC_FEC_GF256_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! GF(2^8) arithmetic.
+//!
+//! Uses primitive polynomial x^8 + x^4 + x^3 + x^2 + 1 and primitive element 2,
+//! as specified for Reed-Solomon codes over GF(2^8) in RFC 5510.
+//!
+//! Region operations use split 4-bit lookup tables: for every constant,
+//! products with all low nibbles and with all high nibbles are precomputed, so
+//! that a byte can be multiplied with two table lookups and a xor. On CPUs with
+//! byte shuffle instructions (SSSE3, AVX2, NEON on AArch64), 16 or 32 lookups
+//! are performed at once. The implementation is selected at run time.
+class Gf256 : public core::NonCopyable<> {
+public:
+    //! Get instance.
+    static Gf256& instance() {
+        return core::Singleton<Gf256>::instance();
+    }
+
+    //! Get a power of primitive element.
+    uint8_t exp(size_t power) const;
+
+    //! Multiply two elements.
+    uint8_t mul(uint8_t a, uint8_t b) const;
+
+    //! Divide two elements.
+    //! @pre
+    //!  @p b should be non-zero.
+    uint8_t div(uint8_t a, uint8_t b) const;
+
+    //! Get multiplicative inverse.
+    //! @pre
+    //!  @p a should be non-zero.
+    uint8_t inv(uint8_t a) const;
+
+    //! Multiply region by constant and store result to another region.
+    //! @remarks
+    //!  Computes dst[i] = c * src[i] for every i in [0; size).
+    //!  Regions should either be the same or not overlap, and don't need
+    //!  to be aligned.
+    void mul_region(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) const;
+
+    //! Multiply region by constant and add it to another region.
+    //! @remarks
+    //!  Computes dst[i] = dst[i] + c * src[i] for every i in [0; size).
+    //!  Regions should not overlap and don't need to be aligned.
+    void mul_add_region(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) const;
+
+private:
+    friend class core::Singleton<Gf256>;
+
+    enum { FieldSize = 256, Polynomial = 0x11D };
+
+    typedef void (*mul_func_t)(uint8_t* dst,
+                               const uint8_t* src,
+                               const uint8_t* mul_tab,
+                               const uint8_t* lo_tab,
+                               const uint8_t* hi_tab,
+                               size_t size);
+
+    Gf256();
+
+    // log and anti-log tables; exp table is doubled to avoid modulo
+    uint8_t exp_tab_[FieldSize * 2];
+    uint8_t log_tab_[FieldSize];
+
+    // full multiplication table, used for scalar operations
+    uint8_t mul_tab_[FieldSize][FieldSize];
+
+    // products of every constant with every low and high nibble
+    uint8_t lo_tab_[FieldSize][16];
+    uint8_t hi_tab_[FieldSize][16];
+
+    mul_func_t mul_fn_;
+    mul_func_t mul_add_fn_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_GF256_H_
@@ -61,6 +61,11 @@ public:
         return packet::FEC_LDPC_Staircase;
     }
 
+    //! Get maximum encoding symbol ID.
+    static size_t max_esi() {
+        return 0xffff;
+    }
+
     //! Clear header.
     void clear() {
         memset(this, 0, sizeof(*this));
@@ -137,6 +142,11 @@ public:
         return packet::FEC_LDPC_Staircase;
     }
 
+    //! Get maximum encoding symbol ID.
+    static size_t max_esi() {
+        return 0xffff;
+    }
+
     //! Clear header.
     void clear() {
         memset(this, 0, sizeof(*this));
@@ -211,6 +221,11 @@ public:
         return packet::FEC_ReedSolomon_M8;
     }
 
+    //! Get maximum encoding symbol ID.
+    static size_t max_esi() {
+        return 0xff;
+    }
+
     //! Clear header.
     void clear() {
         memset(this, 0, sizeof(*this));
@@ -260,6 +275,184 @@ public:
     }
 } ROC_ATTR_PACKED_END;
 
+//! RLC Source FEC Payload ID.
+//!
+//! @code
+//!    0                   1                   2                   3
+//!    0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |                   Encoding Symbol ID (ESI)                    |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+//!
+//! @remarks
+//!  Defined in RFC 8681, section 4.1.1.
+ROC_ATTR_PACKED_BEGIN class RLC_Source_PayloadID {
+private:
+    //! Encoding symbol ID.
+    uint32_t esi_;
+
+public:
+    //! Get FEC scheme to which these packets belong to.
+    static packet::FecScheme fec_scheme() {
+        return packet::FEC_RLC;
+    }
+
+    //! Get maximum encoding symbol ID.
+    static size_t max_esi() {
+        return 0xffffffff;
+    }
+
+    //! Clear header.
+    void clear() {
+        memset(this, 0, sizeof(*this));
+    }
+
+    //! Get source block number.
+    uint16_t sbn() const {
+        return 0;
+    }
+
+    //! Set source block number.
+    void set_sbn(uint16_t) {
+    }
+
+    //! Get encoding symbol ID.
+    uint32_t esi() const {
+        return core::ntoh32u(esi_);
+    }
+
+    //! Set encoding symbol ID.
+    void set_esi(uint32_t val) {
+        esi_ = core::hton32u(val);
+    }
+
+    //! Get source block length.
+    uint16_t k() const {
+        return 0;
+    }
+
+    //! Set source block length.
+    void set_k(uint16_t) {
+    }
+
+    //! Get number encoding symbols.
+    uint16_t n() const {
+        return 0;
+    }
+
+    //! Set number encoding symbols.
+    void set_n(uint16_t) {
+    }
+} ROC_ATTR_PACKED_END;
+
+//! RLC Repair FEC Payload ID.
+//!
+//! @code
+//!    0                   1                   2                   3
+//!    0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |       Repair_Key              |  DT   |NSS (# src symb in ew) |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |                            FSS_ESI                            |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+//!
+//! @remarks
+//!  Defined in RFC 8681, section 4.1.3. Fields are mapped to generic accessors:
+//!  sbn() is Repair_Key, esi() is FSS_ESI (ESI of first source symbol in
+//!  window), k() is NSS (number of source symbols in window), and n() is DT
+//!  (density threshold of coding coefficients).
+ROC_ATTR_PACKED_BEGIN class RLC_Repair_PayloadID {
+private:
+    enum {
+        //! @name Density threshold.
+        // @{
+        DtNss_DT_shift = 12,
+        DtNss_DT_mask = 0x0F,
+        // @}
+
+        //! @name Number of source symbols in window.
+        // @{
+        DtNss_NSS_shift = 0,
+        DtNss_NSS_mask = 0x0FFF
+        // @}
+    };
+
+    //! Repair key.
+    uint16_t repair_key_;
+
+    //! Density threshold and number of source symbols.
+    uint16_t dt_nss_;
+
+    //! ESI of first source symbol.
+    uint32_t fss_esi_;
+
+public:
+    //! Get FEC scheme to which these packets belong to.
+    static packet::FecScheme fec_scheme() {
+        return packet::FEC_RLC;
+    }
+
+    //! Get maximum encoding symbol ID.
+    static size_t max_esi() {
+        return 0xffffffff;
+    }
+
+    //! Clear header.
+    void clear() {
+        memset(this, 0, sizeof(*this));
+    }
+
+    //! Get repair key.
+    uint16_t sbn() const {
+        return core::ntoh16u(repair_key_);
+    }
+
+    //! Set repair key.
+    void set_sbn(uint16_t val) {
+        repair_key_ = core::hton16u(val);
+    }
+
+    //! Get ESI of first source symbol in window.
+    uint32_t esi() const {
+        return core::ntoh32u(fss_esi_);
+    }
+
+    //! Set ESI of first source symbol in window.
+    void set_esi(uint32_t val) {
+        fss_esi_ = core::hton32u(val);
+    }
+
+    //! Get number of source symbols in window.
+    uint16_t k() const {
+        return (core::ntoh16u(dt_nss_) >> DtNss_NSS_shift) & DtNss_NSS_mask;
+    }
+
+    //! Set number of source symbols in window.
+    void set_k(uint16_t val) {
+        roc_panic_if((val & ~DtNss_NSS_mask) != 0);
+        uint16_t dt_nss = core::ntoh16u(dt_nss_);
+        dt_nss &= uint16_t(~(DtNss_NSS_mask << DtNss_NSS_shift));
+        dt_nss |= uint16_t(val << DtNss_NSS_shift);
+        dt_nss_ = core::hton16u(dt_nss);
+    }
+
+    //! Get density threshold.
+    uint16_t n() const {
+        return (core::ntoh16u(dt_nss_) >> DtNss_DT_shift) & DtNss_DT_mask;
+    }
+
+    //! Set density threshold.
+    void set_n(uint16_t val) {
+        roc_panic_if((val & ~DtNss_DT_mask) != 0);
+        uint16_t dt_nss = core::ntoh16u(dt_nss_);
+        dt_nss &= uint16_t(~(DtNss_DT_mask << DtNss_DT_shift));
+        dt_nss |= uint16_t(val << DtNss_DT_shift);
+        dt_nss_ = core::hton16u(dt_nss);
+    }
+} ROC_ATTR_PACKED_END;
+
 } // namespace fec
 } // namespace roc
 
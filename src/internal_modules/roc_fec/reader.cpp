@@ -9,6 +9,7 @@
 #include "roc_fec/reader.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/tracepoint.h"
 #include "roc_packet/fec_scheme_to_str.h"
 
 namespace roc {
@@ -21,8 +22,10 @@ Reader::Reader(const ReaderConfig& config,
                packet::IReader& repair_reader,
                packet::IParser& parser,
                packet::PacketFactory& packet_factory,
-               core::IAllocator& allocator)
+               core::IAllocator& allocator,
+               RepairPool* repair_pool)
     : decoder_(decoder)
+    , repair_pool_(repair_pool)
     , source_reader_(source_reader)
     , repair_reader_(repair_reader)
     , parser_(parser)
@@ -31,22 +34,44 @@ Reader::Reader(const ReaderConfig& config,
     , repair_queue_(0)
     , source_block_(allocator)
     , repair_block_(allocator)
+    , decode_task_(*this)
+    , task_running_(false)
+    , lost_(allocator)
+    , repaired_(allocator)
+    , deferred_(allocator)
     , valid_(false)
     , alive_(true)
     , started_(false)
     , can_repair_(false)
+    , decoding_(false)
     , next_packet_(0)
     , cur_sbn_(0)
     , payload_size_(0)
     , source_block_resized_(false)
     , repair_block_resized_(false)
     , payload_resized_(false)
+    , n_source_packets_(0)
+    , n_repair_packets_(0)
+    , max_source_esi_(0)
     , n_packets_(0)
+    , n_repaired_packets_(0)
     , max_sbn_jump_(config.max_sbn_jump)
     , fec_scheme_(fec_scheme) {
     valid_ = true;
 }
 
+Reader::~Reader() {
+    end_decoding_();
+}
+
+Reader::DecodeTask::DecodeTask(Reader& reader)
+    : reader_(reader) {
+}
+
+void Reader::DecodeTask::execute() {
+    reader_.run_decoding_();
+}
+
 bool Reader::valid() const {
     return valid_;
 }
@@ -59,6 +84,10 @@ bool Reader::alive() const {
     return alive_;
 }
 
+size_t Reader::num_repaired_packets() const {
+    return n_repaired_packets_;
+}
+
 packet::PacketPtr Reader::read() {
     roc_panic_if_not(valid());
     if (!alive_) {
@@ -160,13 +189,13 @@ packet::PacketPtr Reader::get_next_packet_() {
 void Reader::next_block_() {
     roc_log(LogTrace, "fec reader: next block: sbn=%lu", (unsigned long)cur_sbn_);
 
+    end_decoding_();
+
     for (size_t n = 0; n < source_block_.size(); n++) {
         source_block_[n] = NULL;
     }
 
-    for (size_t n = 0; n < repair_block_.size(); n++) {
-        repair_block_[n] = NULL;
-    }
+    drop_repair_packets_();
 
     cur_sbn_++;
     next_packet_ = 0;
@@ -175,20 +204,70 @@ void Reader::next_block_() {
     repair_block_resized_ = false;
     payload_resized_ = false;
 
+    n_source_packets_ = 0;
+    max_source_esi_ = 0;
+
     can_repair_ = false;
 
     fill_block_();
 }
 
 void Reader::try_repair_() {
+    if (task_running_) {
+        // lost packet is needed right now
+        repair_pool_->wait(decode_task_);
+        finish_decoding_();
+    }
+
     if (!can_repair_) {
         return;
     }
 
-    if (!source_block_resized_ || !repair_block_resized_ || !payload_resized_) {
+    if (!begin_decoding_()) {
         return;
     }
 
+    for (size_t n = 0; n < source_block_.size(); n++) {
+        if (source_block_[n]) {
+            continue;
+        }
+
+        core::Slice<uint8_t> buffer = decoder_.repair(n);
+        if (!buffer) {
+            continue;
+        }
+
+        packet::PacketPtr pp = parse_repaired_packet_(buffer);
+        if (!pp) {
+            continue;
+        }
+
+        source_block_[n] = pp;
+    }
+
+    can_repair_ = false;
+}
+
+// returns true if some source packet of current block is missing, while a
+// packet that was sent after it is already received
+bool Reader::has_losses_() const {
+    if (n_source_packets_ == source_block_.size()) {
+        return false;
+    }
+
+    return n_repair_packets_ != 0
+        || (n_source_packets_ != 0 && max_source_esi_ + 1 > n_source_packets_);
+}
+
+bool Reader::begin_decoding_() {
+    if (decoding_) {
+        return true;
+    }
+
+    if (!source_block_resized_ || !repair_block_resized_ || !payload_resized_) {
+        return false;
+    }
+
     if (!decoder_.begin(source_block_.size(), repair_block_.size(), payload_size_)) {
         roc_log(LogDebug,
                 "fec reader: can't begin decoder block, shutting down:"
@@ -196,9 +275,13 @@ void Reader::try_repair_() {
                 (unsigned long)source_block_.size(), (unsigned long)repair_block_.size(),
                 (unsigned long)payload_size_);
         alive_ = false;
-        return;
+        return false;
     }
 
+    decoding_ = true;
+
+    // pass packets received so far; following packets are passed to decoder
+    // when they're added to block
     for (size_t n = 0; n < source_block_.size(); n++) {
         if (!source_block_[n]) {
             continue;
@@ -213,26 +296,142 @@ void Reader::try_repair_() {
         decoder_.set(source_block_.size() + n, repair_block_[n]->fec()->payload);
     }
 
-    for (size_t n = 0; n < source_block_.size(); n++) {
-        if (source_block_[n]) {
-            continue;
+    return true;
+}
+
+void Reader::end_decoding_() {
+    if (!decoding_) {
+        return;
+    }
+
+    cancel_decoding_();
+
+    decoder_.end();
+    decoding_ = false;
+}
+
+void Reader::drop_repair_packets_() {
+    for (size_t n = 0; n < repair_block_.size(); n++) {
+        repair_block_[n] = NULL;
+    }
+    n_repair_packets_ = 0;
+}
+
+void Reader::set_decoder_packet_(size_t index, const core::Slice<uint8_t>& buffer) {
+    if (task_running_) {
+        // can't touch decoder until background task finishes
+        deferred_.push_back(index);
+        return;
+    }
+
+    decoder_.set(index, buffer);
+}
+
+// start background decoding of packets received so far
+void Reader::schedule_decoding_() {
+    const size_t sblen = source_block_.size();
+
+    // decoding can't succeed until there are at least sblen packets
+    if (n_source_packets_ + n_repair_packets_ < sblen) {
+        return;
+    }
+
+    if (!lost_.resize(0) || !lost_.grow(sblen) || !repaired_.resize(sblen)
+        || !deferred_.resize(0) || !deferred_.grow(sblen + repair_block_.size())) {
+        roc_log(LogError,
+                "fec reader: can't allocate decoding task, falling back to"
+                " synchronous decoding");
+        return;
+    }
+
+    for (size_t n = 0; n < sblen; n++) {
+        if (!source_block_[n]) {
+            lost_.push_back(n);
         }
+    }
 
-        core::Slice<uint8_t> buffer = decoder_.repair(n);
-        if (!buffer) {
+    roc_log(LogTrace, "fec reader: scheduling decoding: sbn=%lu n_lost=%lu",
+            (unsigned long)cur_sbn_, (unsigned long)lost_.size());
+
+    task_running_ = true;
+    can_repair_ = false;
+
+    repair_pool_->schedule(decode_task_);
+}
+
+// invoked on repair pool thread
+void Reader::run_decoding_() {
+    for (size_t i = 0; i < lost_.size(); i++) {
+        repaired_[lost_[i]] = decoder_.repair(lost_[i]);
+    }
+}
+
+void Reader::finish_decoding_() {
+    roc_panic_if_not(task_running_);
+    roc_panic_if_not(decode_task_.finished());
+
+    task_running_ = false;
+
+    unsigned n_restored = 0;
+
+    for (size_t i = 0; i < lost_.size(); i++) {
+        const size_t n = lost_[i];
+
+        // packet may have arrived while decoding
+        if (!repaired_[n] || source_block_[n]) {
             continue;
         }
 
-        packet::PacketPtr pp = parse_repaired_packet_(buffer);
+        packet::PacketPtr pp = parse_repaired_packet_(repaired_[n]);
         if (!pp) {
             continue;
         }
 
         source_block_[n] = pp;
+        n_restored++;
     }
 
-    decoder_.end();
-    can_repair_ = false;
+    const size_t sblen = source_block_.size();
+
+    for (size_t i = 0; i < deferred_.size(); i++) {
+        const size_t n = deferred_[i];
+
+        if (n < sblen) {
+            // decoder already has this buffer if it restored it
+            if (!repaired_[n]) {
+                decoder_.set(n, source_block_[n]->fec()->payload);
+            }
+        } else {
+            decoder_.set(n, repair_block_[n - sblen]->fec()->payload);
+        }
+    }
+
+    roc_log(LogTrace,
+            "fec reader: finished decoding: sbn=%lu n_lost=%lu n_restored=%u"
+            " n_deferred=%lu",
+            (unsigned long)cur_sbn_, (unsigned long)lost_.size(), n_restored,
+            (unsigned long)deferred_.size());
+
+    clear_decoding_();
+}
+
+void Reader::cancel_decoding_() {
+    if (task_running_) {
+        repair_pool_->wait(decode_task_);
+        task_running_ = false;
+    }
+
+    clear_decoding_();
+}
+
+void Reader::clear_decoding_() {
+    for (size_t n = 0; n < repaired_.size(); n++) {
+        repaired_[n] = core::Slice<uint8_t>();
+    }
+
+    if (!lost_.resize(0) || !deferred_.resize(0)) {
+        roc_panic("fec reader: can't resize array");
+    }
 }
 
 packet::PacketPtr Reader::parse_repaired_packet_(const core::Slice<uint8_t>& buffer) {
@@ -250,6 +449,11 @@ packet::PacketPtr Reader::parse_repaired_packet_(const core::Slice<uint8_t>& buf
     pp->set_data(buffer);
     pp->add_flags(packet::Packet::FlagRestored);
 
+    n_repaired_packets_++;
+
+    roc_tracepoint(fec_repair, (const void*)this, (const void*)pp.get(),
+                   (unsigned)(pp->rtp() ? pp->rtp()->seqnum : 0));
+
     return pp;
 }
 
@@ -278,8 +482,24 @@ void Reader::fetch_packets_() {
 }
 
 void Reader::fill_block_() {
+    if (task_running_ && decode_task_.finished()) {
+        finish_decoding_();
+    }
+
     fill_source_block_();
     fill_repair_block_();
+
+    // start decoding as soon as we know that block has losses, to let decoder
+    // process packets as they arrive, instead of doing all work when a lost
+    // packet is requested
+    if (!decoding_ && has_losses_()) {
+        (void)begin_decoding_();
+    }
+
+    // with repair pool, also run decoding itself ahead of time
+    if (repair_pool_ && decoding_ && !task_running_ && can_repair_) {
+        schedule_decoding_();
+    }
 }
 
 void Reader::fill_source_block_() {
@@ -338,6 +558,19 @@ void Reader::fill_source_block_() {
             can_repair_ = true;
             source_block_[p_num] = pp;
             n_added++;
+
+            n_source_packets_++;
+            if (max_source_esi_ < p_num) {
+                max_source_esi_ = p_num;
+            }
+
+            if (n_source_packets_ == source_block_.size()) {
+                // late packet completed the block, decoding is not needed anymore
+                end_decoding_();
+                drop_repair_packets_();
+            } else if (decoding_) {
+                set_decoder_packet_(p_num, fec.payload);
+            }
         }
     }
 
@@ -348,7 +581,7 @@ void Reader::fill_source_block_() {
 }
 
 void Reader::fill_repair_block_() {
-    unsigned n_fetched = 0, n_added = 0, n_dropped = 0;
+    unsigned n_fetched = 0, n_added = 0, n_dropped = 0, n_skipped = 0;
 
     for (;;) {
         packet::PacketPtr pp = repair_queue_.head();
@@ -398,18 +631,31 @@ void Reader::fill_repair_block_() {
         roc_panic_if_not(fec.encoding_symbol_id
                          < source_block_.size() + repair_block_.size());
 
+        if (n_source_packets_ == source_block_.size()) {
+            // all source packets are here, repair packet will never be used
+            n_skipped++;
+            continue;
+        }
+
         const size_t p_num = fec.encoding_symbol_id - fec.source_block_length;
 
         if (!repair_block_[p_num]) {
             can_repair_ = true;
             repair_block_[p_num] = pp;
             n_added++;
+
+            n_repair_packets_++;
+
+            if (decoding_) {
+                set_decoder_packet_(fec.encoding_symbol_id, fec.payload);
+            }
         }
     }
 
-    if (n_dropped != 0 || n_fetched != n_added) {
-        roc_log(LogDebug, "fec reader: repair queue: fetched=%u added=%u dropped=%u",
-                n_fetched, n_added, n_dropped);
+    if (n_dropped != 0 || n_fetched != n_added + n_skipped) {
+        roc_log(LogDebug,
+                "fec reader: repair queue: fetched=%u added=%u dropped=%u skipped=%u",
+                n_fetched, n_added, n_dropped, n_skipped);
     }
 }
 
@@ -17,6 +17,7 @@
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
 #include "roc_fec/iblock_decoder.h"
+#include "roc_fec/repair_pool.h"
 #include "roc_packet/iparser.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/packet.h"
@@ -48,6 +49,7 @@ public:
     //!  - @p repair_reader specifies input queue with FEC packets;
     //!  - @p parser specifies packet parser for restored packets.
     //!  - @p allocator is used to initialize a packet array
+    //!  - @p repair_pool, if non-NULL, is used to run decoding in background
     Reader(const ReaderConfig& config,
            packet::FecScheme fec_scheme,
            IBlockDecoder& decoder,
@@ -55,7 +57,10 @@ public:
            packet::IReader& repair_reader,
            packet::IParser& parser,
            packet::PacketFactory& packet_factory,
-           core::IAllocator& allocator);
+           core::IAllocator& allocator,
+           RepairPool* repair_pool = NULL);
+
+    ~Reader();
 
     //! Check if object is successfully constructed.
     bool valid() const;
@@ -69,9 +74,31 @@ public:
     //! Read packet.
     //! @remarks
     //!  When a packet loss is detected, try to restore it from repair packets.
+    //!  Packets of a block with losses are passed to decoder as soon as they
+    //!  arrive, so that most decoding work is done before the lost packet is
+    //!  actually needed.
+    //!
+    //!  If repair pool is used, decoding is started in background as soon as
+    //!  the block has enough packets, and packets preceding the loss are
+    //!  returned meanwhile. Since packets usually arrive a latency ahead of
+    //!  their playback, restored packets are usually ready when they are
+    //!  needed; otherwise, read() waits for decoding to finish.
     virtual packet::PacketPtr read();
 
+    //! Get number of source packets restored from repair packets so far.
+    size_t num_repaired_packets() const;
+
 private:
+    class DecodeTask : public RepairTask {
+    public:
+        explicit DecodeTask(Reader& reader);
+
+    private:
+        virtual void execute();
+
+        Reader& reader_;
+    };
+
     packet::PacketPtr read_();
 
     packet::PacketPtr get_first_packet_();
@@ -80,6 +107,19 @@ private:
     void next_block_();
     void try_repair_();
 
+    bool has_losses_() const;
+    bool begin_decoding_();
+    void end_decoding_();
+    void drop_repair_packets_();
+
+    void set_decoder_packet_(size_t index, const core::Slice<uint8_t>& buffer);
+
+    void schedule_decoding_();
+    void run_decoding_();
+    void finish_decoding_();
+    void cancel_decoding_();
+    void clear_decoding_();
+
     packet::PacketPtr parse_repaired_packet_(const core::Slice<uint8_t>& buffer);
 
     void fetch_packets_();
@@ -108,6 +148,7 @@ private:
     void drop_repair_packets_from_prev_blocks_();
 
     IBlockDecoder& decoder_;
+    RepairPool* repair_pool_;
 
     packet::IReader& source_reader_;
     packet::IReader& repair_reader_;
@@ -120,11 +161,21 @@ private:
     core::Array<packet::PacketPtr> source_block_;
     core::Array<packet::PacketPtr> repair_block_;
 
+    // background decoding state; while task is running, decoder and arrays
+    // below are accessed only by task, and packets added to block are
+    // remembered to be passed to decoder after it finishes
+    DecodeTask decode_task_;
+    bool task_running_;
+    core::Array<size_t> lost_;
+    core::Array<core::Slice<uint8_t> > repaired_;
+    core::Array<size_t> deferred_;
+
     bool valid_;
 
     bool alive_;
     bool started_;
     bool can_repair_;
+    bool decoding_;
 
     size_t next_packet_;
     packet::blknum_t cur_sbn_;
@@ -135,7 +186,13 @@ private:
     bool repair_block_resized_;
     bool payload_resized_;
 
+    // packets added to current block
+    size_t n_source_packets_;
+    size_t n_repair_packets_;
+    size_t max_source_esi_;
+
     unsigned n_packets_;
+    size_t n_repaired_packets_;
 
     const size_t max_sbn_jump_;
     const packet::FecScheme fec_scheme_;
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/repair_pool.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/scoped_lock.h"
+
+namespace roc {
+namespace fec {
+
+RepairTask::RepairTask()
+    : finished_(0) {
+}
+
+RepairTask::~RepairTask() {
+}
+
+bool RepairTask::finished() const {
+    return finished_;
+}
+
+RepairPool::Worker::Worker(RepairPool& pool, const core::ThreadConfig& config)
+    : core::Thread(config)
+    , pool_(pool) {
+}
+
+RepairPool::Worker::~Worker() {
+}
+
+void RepairPool::Worker::run() {
+    pool_.worker_loop_();
+}
+
+RepairPool::RepairPool(size_t num_threads,
+                       const core::ThreadConfig& thread_config,
+                       core::IAllocator& allocator)
+    : allocator_(allocator)
+    , workers_(allocator)
+    , work_cond_(mutex_)
+    , done_cond_(mutex_)
+    , stop_(false)
+    , valid_(false) {
+    roc_log(LogDebug, "fec repair pool: initializing: num_threads=%lu",
+            (unsigned long)num_threads);
+
+    if (!workers_.grow(num_threads)) {
+        roc_log(LogError, "fec repair pool: can't allocate workers");
+        return;
+    }
+
+    for (size_t n = 0; n < num_threads; n++) {
+        Worker* worker = new (allocator_) Worker(*this, thread_config);
+        if (!worker) {
+            roc_log(LogError, "fec repair pool: can't allocate worker");
+            return;
+        }
+
+        workers_.push_back(worker);
+
+        if (!worker->start()) {
+            roc_log(LogError, "fec repair pool: can't start worker thread");
+            return;
+        }
+    }
+
+    valid_ = true;
+}
+
+RepairPool::~RepairPool() {
+    stop_workers_();
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        allocator_.destroy_object(*workers_[n]);
+    }
+
+    if (queue_.size() != 0) {
+        roc_panic("fec repair pool: destroying pool with scheduled tasks");
+    }
+}
+
+bool RepairPool::valid() const {
+    return valid_;
+}
+
+size_t RepairPool::num_threads() const {
+    return workers_.size();
+}
+
+void RepairPool::schedule(RepairTask& task) {
+    roc_panic_if(!valid_);
+
+    core::ScopedLock<core::Mutex> lock(mutex_);
+
+    task.finished_ = 0;
+
+    queue_.push_back(task);
+    work_cond_.signal();
+}
+
+void RepairPool::wait(RepairTask& task) {
+    roc_panic_if(!valid_);
+
+    mutex_.lock();
+
+    if (queue_.contains(task)) {
+        // Task is not started yet, execute it here instead of sleeping.
+        queue_.remove(task);
+
+        mutex_.unlock();
+        execute_(task);
+
+        return;
+    }
+
+    while (!task.finished()) {
+        done_cond_.wait();
+    }
+
+    mutex_.unlock();
+}
+
+void RepairPool::worker_loop_() {
+    roc_log(LogDebug, "fec repair pool: starting worker thread");
+
+    mutex_.lock();
+
+    for (;;) {
+        while (!stop_ && queue_.size() == 0) {
+            work_cond_.wait();
+        }
+
+        if (stop_) {
+            break;
+        }
+
+        RepairTask* task = queue_.front();
+        queue_.remove(*task);
+
+        mutex_.unlock();
+        execute_(*task);
+        mutex_.lock();
+    }
+
+    mutex_.unlock();
+
+    roc_log(LogDebug, "fec repair pool: finishing worker thread");
+}
+
+void RepairPool::execute_(RepairTask& task) {
+    task.execute();
+
+    core::ScopedLock<core::Mutex> lock(mutex_);
+
+    task.finished_ = 1;
+    done_cond_.broadcast();
+}
+
+void RepairPool::stop_workers_() {
+    {
+        core::ScopedLock<core::Mutex> lock(mutex_);
+
+        stop_ = true;
+        work_cond_.broadcast();
+    }
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        if (workers_[n]->joinable()) {
+            workers_[n]->join();
+        }
+    }
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/repair_pool.h
+//! @brief FEC repair thread pool.
+
+#ifndef ROC_FEC_REPAIR_POOL_H_
+#define ROC_FEC_REPAIR_POOL_H_
+
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace fec {
+
+class RepairPool;
+
+//! FEC repair task.
+//! @remarks
+//!  Derived class implements execute(), which is invoked by RepairPool on
+//!  one of its threads. Task object is owned by the caller and should not
+//!  be destroyed until it's finished.
+class RepairTask : public core::ListNode {
+public:
+    //! Initialize.
+    RepairTask();
+
+    virtual ~RepairTask();
+
+    //! Check if task was executed.
+    //! @remarks
+    //!  Thread-safe. Returns false if task was never scheduled.
+    bool finished() const;
+
+protected:
+    //! Perform repair.
+    virtual void execute() = 0;
+
+private:
+    friend class RepairPool;
+
+    core::Atomic<int> finished_;
+};
+
+//! FEC repair thread pool.
+//!
+//! Executes repair tasks in background threads, so that expensive decoding
+//! doesn't delay the pipeline thread. One pool may be shared by many readers.
+//!
+//! Thread-safe.
+class RepairPool : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Starts @p num_threads background threads with scheduling parameters
+    //!  from @p thread_config.
+    RepairPool(size_t num_threads,
+               const core::ThreadConfig& thread_config,
+               core::IAllocator& allocator);
+
+    //! Destroy.
+    //! @remarks
+    //!  Stops and joins background threads. There should be no scheduled
+    //!  tasks at this point.
+    ~RepairPool();
+
+    //! Check if the pool was successfully constructed.
+    bool valid() const;
+
+    //! Get number of background threads.
+    size_t num_threads() const;
+
+    //! Enqueue task for execution.
+    //! @pre
+    //!  Task should not be already scheduled and not finished.
+    void schedule(RepairTask& task);
+
+    //! Wait until task is finished.
+    //! @remarks
+    //!  If none of the threads picked the task yet, executes it on the
+    //!  calling thread instead of waiting.
+    //! @pre
+    //!  Task should be scheduled.
+    void wait(RepairTask& task);
+
+private:
+    class Worker : public core::Thread {
+    public:
+        Worker(RepairPool& pool, const core::ThreadConfig& config);
+
+        virtual ~Worker();
+
+    private:
+        virtual void run();
+
+        RepairPool& pool_;
+    };
+
+    void worker_loop_();
+    void execute_(RepairTask& task);
+
+    void stop_workers_();
+
+    core::IAllocator& allocator_;
+
+    core::Array<Worker*> workers_;
+
+    core::Mutex mutex_;
+    core::Cond work_cond_;
+    core::Cond done_cond_;
+
+    core::List<RepairTask, core::NoOwnership> queue_;
+
+    bool stop_;
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_REPAIR_POOL_H_
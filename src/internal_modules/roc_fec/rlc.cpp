@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rlc.h"
+#include "roc_core/panic.h"
+#include "roc_fec/tinymt32.h"
+
+namespace roc {
+namespace fec {
+
+void rlc_coefficients(uint16_t repair_key, size_t dt, uint8_t* coeffs, size_t n_coeffs) {
+    roc_panic_if(!coeffs && n_coeffs != 0);
+    roc_panic_if(dt > RlcDenseThreshold);
+
+    TinyMT32 prng(repair_key);
+
+    for (size_t n = 0; n < n_coeffs; n++) {
+        if (dt == RlcDenseThreshold) {
+            // zero is avoided to make all source packets contribute
+            do {
+                coeffs[n] = (uint8_t)prng.next_u8();
+            } while (coeffs[n] == 0);
+        } else if (prng.next_u4() <= dt) {
+            coeffs[n] = (uint8_t)prng.next_u8();
+        } else {
+            coeffs[n] = 0;
+        }
+    }
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rlc.h
+//! @brief Sliding window RLC scheme helpers.
+
+#ifndef ROC_FEC_RLC_H_
+#define ROC_FEC_RLC_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! Sliding window RLC limits.
+enum {
+    //! Maximum number of source packets in window of a repair packet.
+    //! The protocol allows up to 4095, but decoding complexity grows
+    //! quadratically with window length.
+    RlcMaxWindowLength = 255,
+
+    //! Density threshold of dense codes, where all coefficients are non-zero.
+    RlcDenseThreshold = 15
+};
+
+//! Generate coding coefficients of RLC repair packet.
+//! @remarks
+//!  Follows RFC 8681, section 3.6, for GF(2^8). Coefficient with index i
+//!  corresponds to source packet (FSS_ESI + i) of the window.
+//! @pre
+//!  @p dt should be in range [0; RlcDenseThreshold].
+void rlc_coefficients(uint16_t repair_key, size_t dt, uint8_t* coeffs, size_t n_coeffs);
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RLC_H_
@@ -0,0 +1,618 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rlc_reader.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+#include "roc_packet/fec_scheme_to_str.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const size_t NoPivot = (size_t)-1;
+
+// distance between two encoding symbol IDs, taking wrapping into account
+inline int32_t esi_diff(uint32_t a, uint32_t b) {
+    return int32_t(a - b);
+}
+
+inline uint32_t packet_esi(const packet::Packet& packet) {
+    return (uint32_t)packet.fec()->encoding_symbol_id;
+}
+
+} // namespace
+
+RlcReader::RlcReader(packet::IReader& source_reader,
+                     packet::IReader& repair_reader,
+                     packet::IParser& parser,
+                     packet::PacketFactory& packet_factory,
+                     core::BufferFactory<uint8_t>& buffer_factory,
+                     core::IAllocator& allocator)
+    : source_reader_(source_reader)
+    , repair_reader_(repair_reader)
+    , parser_(parser)
+    , packet_factory_(packet_factory)
+    , buffer_factory_(buffer_factory)
+    , source_queue_(0)
+    , repair_queue_(0)
+    , symbols_(allocator)
+    , repairs_(allocator)
+    , n_repairs_(0)
+    , coeffs_(allocator)
+    , matrix_(allocator)
+    , rows_(allocator)
+    , unknowns_(allocator)
+    , unknown_cols_(allocator)
+    , pivots_(allocator)
+    , valid_(false)
+    , started_(false)
+    , can_repair_(false)
+    , next_esi_(0)
+    , last_esi_(0)
+    , n_packets_(0)
+    , n_repaired_packets_(0) {
+    if (!symbols_.resize(MaxSymbols) || !repairs_.resize(MaxRepairs)
+        || !coeffs_.resize(RlcMaxWindowLength)
+        || !matrix_.resize((size_t)MaxRepairs * MaxUnknowns)
+        || !rows_.resize(MaxRepairs) || !unknowns_.resize(MaxUnknowns)
+        || !unknown_cols_.resize(MaxSymbols) || !pivots_.resize(MaxUnknowns)) {
+        roc_log(LogError, "rlc reader: can't allocate decoding state");
+        return;
+    }
+
+    valid_ = true;
+}
+
+bool RlcReader::valid() const {
+    return valid_;
+}
+
+bool RlcReader::started() const {
+    return started_;
+}
+
+size_t RlcReader::num_repaired_packets() const {
+    return n_repaired_packets_;
+}
+
+packet::PacketPtr RlcReader::read() {
+    roc_panic_if_not(valid());
+
+    fetch_packets_();
+
+    if (!started_) {
+        const packet::Packet* pp = source_queue_.head();
+        if (!pp) {
+            return NULL;
+        }
+
+        next_esi_ = last_esi_ = packet_esi(*pp);
+        started_ = true;
+
+        roc_log(LogDebug, "rlc reader: got first packet: esi=%lu",
+                (unsigned long)next_esi_);
+    }
+
+    fill_source_symbols_();
+    fill_repair_packets_();
+
+    for (;;) {
+        if (Symbol* symbol = find_symbol_(next_esi_)) {
+            next_esi_++;
+            n_packets_++;
+            return symbol->packet;
+        }
+
+        if (can_repair_) {
+            try_repair_();
+            can_repair_ = false;
+
+            if (find_symbol_(next_esi_)) {
+                continue;
+            }
+        }
+
+        if (!has_later_packets_()) {
+            return NULL;
+        }
+
+        skip_lost_packets_();
+
+        fill_source_symbols_();
+        fill_repair_packets_();
+    }
+}
+
+void RlcReader::fetch_packets_() {
+    while (packet::PacketPtr pp = source_reader_.read()) {
+        if (!pp->fec() || pp->fec()->fec_scheme != packet::FEC_RLC) {
+            roc_log(LogDebug, "rlc reader: dropping source packet with bad fec scheme");
+            continue;
+        }
+        source_queue_.write(pp);
+    }
+
+    while (packet::PacketPtr pp = repair_reader_.read()) {
+        if (!validate_repair_packet_(pp)) {
+            continue;
+        }
+        repair_queue_.write(pp);
+    }
+}
+
+void RlcReader::fill_source_symbols_() {
+    unsigned n_added = 0, n_dropped = 0;
+
+    while (packet::PacketPtr pp = source_queue_.head()) {
+        const uint32_t esi = packet_esi(*pp);
+
+        if (esi_diff(esi, next_esi_) < 0) {
+            (void)source_queue_.read();
+
+            if (esi_diff(esi, next_esi_) < -(int32_t)MaxSymbols) {
+                // sender restarted numbering; repair packets of previous
+                // numbering are useless
+                roc_log(LogDebug,
+                        "rlc reader: detected esi jump, restarting:"
+                        " next_esi=%lu pkt_esi=%lu",
+                        (unsigned long)next_esi_, (unsigned long)esi);
+
+                next_esi_ = last_esi_ = esi;
+                n_repairs_ = 0;
+                for (size_t n = 0; n < repairs_.size(); n++) {
+                    repairs_[n] = NULL;
+                }
+            } else {
+                roc_log(LogTrace,
+                        "rlc reader: dropping late source packet:"
+                        " next_esi=%lu pkt_esi=%lu",
+                        (unsigned long)next_esi_, (unsigned long)esi);
+                n_dropped++;
+                continue;
+            }
+        }
+
+        if (!can_store_(esi)) {
+            // too far ahead, wait until reader moves forward
+            break;
+        }
+
+        (void)source_queue_.read();
+
+        if (!find_symbol_(esi)) {
+            add_symbol_(esi, pp, pp->fec()->payload);
+            n_added++;
+        }
+    }
+
+    if (n_dropped != 0) {
+        roc_log(LogDebug, "rlc reader: source queue: added=%u dropped=%u", n_added,
+                n_dropped);
+    }
+}
+
+void RlcReader::fill_repair_packets_() {
+    drop_outdated_repair_packets_();
+
+    while (packet::PacketPtr pp = repair_queue_.head()) {
+        const packet::FEC& fec = *pp->fec();
+
+        const uint32_t fss = (uint32_t)fec.encoding_symbol_id;
+        const uint32_t lss = fss + (uint32_t)fec.source_block_length - 1;
+
+        if (esi_diff(fss, next_esi_) < -(int32_t)MaxHistory) {
+            (void)repair_queue_.read();
+            roc_log(LogTrace,
+                    "rlc reader: dropping outdated repair packet:"
+                    " next_esi=%lu fss_esi=%lu",
+                    (unsigned long)next_esi_, (unsigned long)fss);
+            continue;
+        }
+
+        if (!can_store_(lss)) {
+            // window is too far ahead, wait until reader moves forward
+            break;
+        }
+
+        (void)repair_queue_.read();
+
+        if (n_repairs_ == MaxRepairs) {
+            // forget oldest repair packet
+            for (size_t n = 1; n < n_repairs_; n++) {
+                repairs_[n - 1] = repairs_[n];
+            }
+            n_repairs_--;
+        }
+
+        repairs_[n_repairs_++] = pp;
+        can_repair_ = true;
+    }
+}
+
+// repair packets are useless when their windows refer to forgotten packets
+void RlcReader::drop_outdated_repair_packets_() {
+    size_t n_kept = 0;
+
+    for (size_t n = 0; n < n_repairs_; n++) {
+        const uint32_t fss = packet_esi(*repairs_[n]);
+
+        if (esi_diff(fss, next_esi_) >= -(int32_t)MaxHistory) {
+            repairs_[n_kept++] = repairs_[n];
+        }
+    }
+
+    for (size_t n = n_kept; n < n_repairs_; n++) {
+        repairs_[n] = NULL;
+    }
+
+    n_repairs_ = n_kept;
+}
+
+// symbol can be stored if it won't overwrite symbols that are still needed
+bool RlcReader::can_store_(uint32_t esi) const {
+    const int32_t diff = esi_diff(esi, next_esi_);
+
+    return diff >= -(int32_t)MaxHistory && diff < (int32_t)(MaxSymbols - MaxHistory);
+}
+
+RlcReader::Symbol* RlcReader::find_symbol_(uint32_t esi) {
+    if (!can_store_(esi)) {
+        return NULL;
+    }
+
+    Symbol& symbol = symbols_[esi % MaxSymbols];
+
+    if (!symbol.packet || symbol.esi != esi) {
+        return NULL;
+    }
+
+    return &symbol;
+}
+
+void RlcReader::add_symbol_(uint32_t esi,
+                            const packet::PacketPtr& pp,
+                            const core::Slice<uint8_t>& data) {
+    roc_panic_if_not(can_store_(esi));
+
+    Symbol& symbol = symbols_[esi % MaxSymbols];
+
+    symbol.packet = pp;
+    symbol.data = data;
+    symbol.esi = esi;
+
+    if (esi_diff(esi, last_esi_) > 0) {
+        last_esi_ = esi;
+    }
+
+    can_repair_ = true;
+}
+
+bool RlcReader::has_later_packets_() const {
+    return esi_diff(last_esi_, next_esi_) > 0 || source_queue_.size() != 0;
+}
+
+// move to the next source packet that we have
+void RlcReader::skip_lost_packets_() {
+    const uint32_t from_esi = next_esi_;
+
+    uint32_t esi = next_esi_ + 1;
+
+    for (; esi_diff(esi, last_esi_) <= 0; esi++) {
+        if (find_symbol_(esi)) {
+            break;
+        }
+    }
+
+    if (esi_diff(esi, last_esi_) > 0) {
+        if (const packet::Packet* pp = source_queue_.head()) {
+            esi = packet_esi(*pp);
+        }
+    }
+
+    next_esi_ = esi;
+
+    roc_log(LogTrace, "rlc reader: skipping lost packets: from_esi=%lu to_esi=%lu",
+            (unsigned long)from_esi, (unsigned long)next_esi_);
+}
+
+void RlcReader::try_repair_() {
+    // decode symbols of the same size as the first repair covering the loss
+    size_t payload_size = 0;
+
+    for (size_t n = 0; n < n_repairs_; n++) {
+        const packet::FEC& fec = *repairs_[n]->fec();
+
+        const int32_t off = esi_diff(next_esi_, (uint32_t)fec.encoding_symbol_id);
+
+        if (off >= 0 && (size_t)off < fec.source_block_length) {
+            payload_size = fec.payload.size();
+            break;
+        }
+    }
+
+    if (payload_size == 0) {
+        return;
+    }
+
+    size_t n_rows = 0, n_cols = 0;
+
+    if (build_system_(payload_size, n_rows, n_cols)) {
+        solve_system_(n_rows, n_cols, payload_size);
+        restore_packets_(n_cols);
+    }
+
+    for (size_t n = 0; n < n_rows; n++) {
+        rows_[n] = core::Slice<uint8_t>();
+    }
+}
+
+// each repair packet gives an equation:
+//  repair = sum(coeff[i] * source[i]), for i in window
+// known source packets are moved to the left side, so that each row of matrix
+// contains coefficients of unknown source packets, and each row buffer contains
+// the sum of their products
+bool RlcReader::build_system_(size_t payload_size, size_t& n_rows, size_t& n_cols) {
+    n_rows = 0;
+    n_cols = 0;
+
+    for (size_t n = 0; n < n_repairs_; n++) {
+        const packet::PacketPtr& rp = repairs_[n];
+
+        if (rp->fec()->payload.size() != payload_size) {
+            continue;
+        }
+
+        core::Slice<uint8_t> buffer = buffer_factory_.new_buffer();
+        if (!buffer) {
+            roc_log(LogError, "rlc reader: can't allocate buffer");
+            return false;
+        }
+
+        if (buffer.capacity() < payload_size) {
+            roc_log(LogError,
+                    "rlc reader: buffer too small for payload: size=%lu cap=%lu",
+                    (unsigned long)payload_size, (unsigned long)buffer.capacity());
+            return false;
+        }
+
+        buffer.reslice(0, payload_size);
+        rows_[n_rows] = buffer;
+
+        if (add_row_(rp, n_rows, n_cols)) {
+            n_rows++;
+        } else {
+            rows_[n_rows] = core::Slice<uint8_t>();
+        }
+    }
+
+    return n_rows != 0 && n_cols != 0;
+}
+
+bool RlcReader::add_row_(const packet::PacketPtr& rp, size_t row, size_t& n_cols) {
+    const packet::FEC& fec = *rp->fec();
+
+    const uint32_t fss = (uint32_t)fec.encoding_symbol_id;
+    const size_t nss = fec.source_block_length;
+    const size_t payload_size = fec.payload.size();
+
+    rlc_coefficients(fec.source_block_number, fec.block_length, coeffs_.data(), nss);
+
+    // check that row is usable before touching decoding state
+    size_t n_new_cols = 0;
+
+    for (size_t i = 0; i < nss; i++) {
+        if (coeffs_[i] == 0) {
+            continue;
+        }
+
+        const uint32_t esi = fss + (uint32_t)i;
+
+        if (const Symbol* symbol = find_symbol_(esi)) {
+            if (symbol->data.size() != payload_size) {
+                return false;
+            }
+            continue;
+        }
+
+        const size_t col = unknown_cols_[esi % MaxSymbols];
+        if (col >= n_cols || unknowns_[col] != esi) {
+            n_new_cols++;
+        }
+    }
+
+    if (n_cols + n_new_cols > MaxUnknowns) {
+        return false;
+    }
+
+    uint8_t* matrix_row = matrix_.data() + row * MaxUnknowns;
+    memset(matrix_row, 0, MaxUnknowns);
+
+    uint8_t* row_data = rows_[row].data();
+    memcpy(row_data, fec.payload.data(), payload_size);
+
+    const Gf256& gf = Gf256::instance();
+
+    bool has_unknowns = false;
+
+    for (size_t i = 0; i < nss; i++) {
+        if (coeffs_[i] == 0) {
+            continue;
+        }
+
+        const uint32_t esi = fss + (uint32_t)i;
+
+        if (const Symbol* symbol = find_symbol_(esi)) {
+            gf.mul_add_region(row_data, symbol->data.data(), coeffs_[i], payload_size);
+            continue;
+        }
+
+        size_t col = unknown_cols_[esi % MaxSymbols];
+        if (col >= n_cols || unknowns_[col] != esi) {
+            col = n_cols++;
+            unknowns_[col] = esi;
+            unknown_cols_[esi % MaxSymbols] = col;
+        }
+
+        matrix_row[col] = coeffs_[i];
+        has_unknowns = true;
+    }
+
+    return has_unknowns;
+}
+
+// Gauss-Jordan elimination; every column which pivot row has no other
+// non-zero coefficients is solved
+void RlcReader::solve_system_(size_t n_rows, size_t n_cols, size_t payload_size) {
+    const Gf256& gf = Gf256::instance();
+
+    size_t n_pivots = 0;
+
+    for (size_t col = 0; col < n_cols; col++) {
+        pivots_[col] = NoPivot;
+
+        size_t p = n_pivots;
+        while (p < n_rows && matrix_[p * MaxUnknowns + col] == 0) {
+            p++;
+        }
+        if (p == n_rows) {
+            continue;
+        }
+
+        if (p != n_pivots) {
+            for (size_t c = 0; c < n_cols; c++) {
+                const uint8_t tmp = matrix_[p * MaxUnknowns + c];
+                matrix_[p * MaxUnknowns + c] = matrix_[n_pivots * MaxUnknowns + c];
+                matrix_[n_pivots * MaxUnknowns + c] = tmp;
+            }
+
+            const core::Slice<uint8_t> tmp = rows_[p];
+            rows_[p] = rows_[n_pivots];
+            rows_[n_pivots] = tmp;
+
+            p = n_pivots;
+        }
+
+        uint8_t* pivot_row = matrix_.data() + p * MaxUnknowns;
+
+        const uint8_t inv = gf.inv(pivot_row[col]);
+        for (size_t c = col; c < n_cols; c++) {
+            pivot_row[c] = gf.mul(pivot_row[c], inv);
+        }
+        gf.mul_region(rows_[p].data(), rows_[p].data(), inv, payload_size);
+
+        for (size_t r = 0; r < n_rows; r++) {
+            uint8_t* row = matrix_.data() + r * MaxUnknowns;
+            const uint8_t factor = row[col];
+
+            if (r == p || factor == 0) {
+                continue;
+            }
+
+            for (size_t c = col; c < n_cols; c++) {
+                row[c] ^= gf.mul(factor, pivot_row[c]);
+            }
+            gf.mul_add_region(rows_[r].data(), rows_[p].data(), factor, payload_size);
+        }
+
+        pivots_[col] = p;
+        n_pivots++;
+    }
+}
+
+void RlcReader::restore_packets_(size_t n_cols) {
+    for (size_t col = 0; col < n_cols; col++) {
+        const size_t p = pivots_[col];
+        if (p == NoPivot) {
+            continue;
+        }
+
+        const uint8_t* row = matrix_.data() + p * MaxUnknowns;
+
+        bool solved = true;
+        for (size_t c = 0; c < n_cols; c++) {
+            if (c != col && row[c] != 0) {
+                solved = false;
+                break;
+            }
+        }
+        if (!solved) {
+            continue;
+        }
+
+        const uint32_t esi = unknowns_[col];
+
+        if (!can_store_(esi) || find_symbol_(esi)) {
+            continue;
+        }
+
+        packet::PacketPtr pp = parse_repaired_packet_(rows_[p]);
+        if (!pp) {
+            continue;
+        }
+
+        roc_log(LogTrace, "rlc reader: repaired packet: esi=%lu", (unsigned long)esi);
+
+        add_symbol_(esi, pp, rows_[p]);
+    }
+}
+
+packet::PacketPtr RlcReader::parse_repaired_packet_(const core::Slice<uint8_t>& buffer) {
+    packet::PacketPtr pp = packet_factory_.new_packet();
+    if (!pp) {
+        roc_log(LogError, "rlc reader: can't allocate packet");
+        return NULL;
+    }
+
+    if (!parser_.parse(*pp, buffer)) {
+        roc_log(LogDebug, "rlc reader: can't parse repaired packet");
+        return NULL;
+    }
+
+    pp->set_data(buffer);
+    pp->add_flags(packet::Packet::FlagRestored);
+
+    n_repaired_packets_++;
+
+    return pp;
+}
+
+bool RlcReader::validate_repair_packet_(const packet::PacketPtr& pp) const {
+    const packet::FEC* fec = pp->fec();
+
+    if (!fec || fec->fec_scheme != packet::FEC_RLC) {
+        roc_log(LogDebug, "rlc reader: dropping repair packet with bad fec scheme");
+        return false;
+    }
+
+    if (fec->source_block_length == 0
+        || fec->source_block_length > RlcMaxWindowLength) {
+        roc_log(LogDebug, "rlc reader: dropping repair packet with bad window: nss=%lu",
+                (unsigned long)fec->source_block_length);
+        return false;
+    }
+
+    if (fec->block_length > RlcDenseThreshold) {
+        roc_log(LogDebug,
+                "rlc reader: dropping repair packet with bad density: dt=%lu",
+                (unsigned long)fec->block_length);
+        return false;
+    }
+
+    if (fec->payload.size() == 0) {
+        roc_log(LogDebug, "rlc reader: dropping repair packet with empty payload");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace fec
+} // namespace roc
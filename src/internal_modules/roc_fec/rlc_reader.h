@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rlc_reader.h
+//! @brief Sliding window FEC reader.
+
+#ifndef ROC_FEC_RLC_READER_H_
+#define ROC_FEC_RLC_READER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_fec/rlc.h"
+#include "roc_packet/iparser.h"
+#include "roc_packet/ireader.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/sorted_queue.h"
+
+namespace roc {
+namespace fec {
+
+//! Sliding window FEC reader.
+//!
+//! Reads source packets in order of their encoding symbol IDs. When a source
+//! packet is missing, tries to restore it by solving a system of linear
+//! equations formed by received repair packets which windows cover it.
+//!
+//! Recent source packets, including already returned ones, are kept as long
+//! as they may be covered by windows of future repair packets. Unlike block
+//! FEC, a loss can be repaired as soon as enough repair packets covering it
+//! arrive, so the receiver latency should cover about one window instead of
+//! a whole block.
+class RlcReader : public packet::IReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p source_reader specifies input queue with data packets
+    //!  - @p repair_reader specifies input queue with FEC packets
+    //!  - @p parser specifies packet parser for restored packets
+    //!  - @p packet_factory is used to allocate restored packets
+    //!  - @p buffer_factory is used to allocate buffers for restored packets
+    //!  - @p allocator is used to initialize internal arrays
+    RlcReader(packet::IReader& source_reader,
+              packet::IReader& repair_reader,
+              packet::IParser& parser,
+              packet::PacketFactory& packet_factory,
+              core::BufferFactory<uint8_t>& buffer_factory,
+              core::IAllocator& allocator);
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Did reader receive first source packet?
+    bool started() const;
+
+    //! Read packet.
+    //! @remarks
+    //!  When a packet loss is detected, try to restore it from repair packets.
+    virtual packet::PacketPtr read();
+
+    //! Get number of source packets restored from repair packets so far.
+    size_t num_repaired_packets() const;
+
+private:
+    enum {
+        // number of kept source packets; power of two, so that symbol
+        // positions don't jump when 32-bit ESI wraps
+        MaxSymbols = 512,
+
+        // number of source packets kept after they were returned
+        MaxHistory = RlcMaxWindowLength,
+
+        // number of kept repair packets
+        MaxRepairs = 64,
+
+        // maximum number of unknown source packets in decoded system
+        MaxUnknowns = RlcMaxWindowLength
+    };
+
+    struct Symbol {
+        packet::PacketPtr packet;
+        core::Slice<uint8_t> data;
+        uint32_t esi;
+
+        Symbol()
+            : esi(0) {
+        }
+    };
+
+    void fetch_packets_();
+
+    void fill_source_symbols_();
+    void fill_repair_packets_();
+    void drop_outdated_repair_packets_();
+
+    bool can_store_(uint32_t esi) const;
+    Symbol* find_symbol_(uint32_t esi);
+    void add_symbol_(uint32_t esi,
+                     const packet::PacketPtr& pp,
+                     const core::Slice<uint8_t>& data);
+
+    bool has_later_packets_() const;
+
+    void try_repair_();
+    bool build_system_(size_t payload_size, size_t& n_rows, size_t& n_cols);
+    bool add_row_(const packet::PacketPtr& rp, size_t row, size_t& n_cols);
+    void solve_system_(size_t n_rows, size_t n_cols, size_t payload_size);
+    void restore_packets_(size_t n_cols);
+    void skip_lost_packets_();
+
+    packet::PacketPtr parse_repaired_packet_(const core::Slice<uint8_t>& buffer);
+
+    bool validate_repair_packet_(const packet::PacketPtr& pp) const;
+
+    packet::IReader& source_reader_;
+    packet::IReader& repair_reader_;
+    packet::IParser& parser_;
+
+    packet::PacketFactory& packet_factory_;
+    core::BufferFactory<uint8_t>& buffer_factory_;
+
+    packet::SortedQueue source_queue_;
+    packet::SortedQueue repair_queue_;
+
+    core::Array<Symbol> symbols_;
+    core::Array<packet::PacketPtr> repairs_;
+    size_t n_repairs_;
+
+    // decoding state, allocated once
+    core::Array<uint8_t> coeffs_;
+    core::Array<uint8_t> matrix_;
+    core::Array<core::Slice<uint8_t> > rows_;
+    core::Array<uint32_t> unknowns_;
+    core::Array<size_t> unknown_cols_;
+    core::Array<size_t> pivots_;
+
+    bool valid_;
+    bool started_;
+    bool can_repair_;
+
+    uint32_t next_esi_;
+    uint32_t last_esi_;
+
+    unsigned n_packets_;
+    size_t n_repaired_packets_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RLC_READER_H_
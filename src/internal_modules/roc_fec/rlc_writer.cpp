@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rlc_writer.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+#include "roc_fec/rlc.h"
+#include "roc_packet/fec_scheme_to_str.h"
+
+namespace roc {
+namespace fec {
+
+RlcWriter::RlcWriter(const WriterConfig& config,
+                     packet::IWriter& writer,
+                     packet::IComposer& source_composer,
+                     packet::IComposer& repair_composer,
+                     packet::PacketFactory& packet_factory,
+                     core::BufferFactory<uint8_t>& buffer_factory,
+                     core::IAllocator& allocator)
+    : writer_(writer)
+    , source_composer_(source_composer)
+    , repair_composer_(repair_composer)
+    , packet_factory_(packet_factory)
+    , buffer_factory_(buffer_factory)
+    , window_(allocator)
+    , window_pos_(0)
+    , window_size_(0)
+    , coeffs_(allocator)
+    , n_source_packets_(config.n_source_packets)
+    , n_repair_packets_(config.n_repair_packets)
+    , n_period_source_(0)
+    , n_period_repair_(0)
+    , payload_size_(0)
+    , valid_(false) {
+    next_esi_ = (uint32_t)core::fast_random(0, uint32_t(-1));
+    next_repair_key_ = (uint16_t)core::fast_random(0, uint16_t(-1));
+
+    if (n_source_packets_ == 0 || n_source_packets_ > RlcMaxWindowLength) {
+        roc_log(LogError,
+                "rlc writer: invalid window length: n_source_packets=%lu max=%lu",
+                (unsigned long)n_source_packets_, (unsigned long)RlcMaxWindowLength);
+        return;
+    }
+
+    if (!window_.resize(n_source_packets_) || !coeffs_.resize(n_source_packets_)) {
+        roc_log(LogError, "rlc writer: can't allocate window");
+        return;
+    }
+
+    roc_log(LogDebug, "rlc writer: initializing: window=%lu repair_rate=%lu/%lu",
+            (unsigned long)n_source_packets_, (unsigned long)n_repair_packets_,
+            (unsigned long)n_source_packets_);
+
+    valid_ = true;
+}
+
+bool RlcWriter::valid() const {
+    return valid_;
+}
+
+void RlcWriter::write(const packet::PacketPtr& pp) {
+    roc_panic_if_not(valid());
+    roc_panic_if_not(pp);
+
+    validate_fec_packet_(pp);
+
+    write_source_packet_(pp);
+
+    // spread repair packets evenly over the period
+    n_period_source_++;
+
+    if (window_size_ != 0) {
+        write_repair_packets_();
+    }
+
+    if (n_period_source_ == n_source_packets_) {
+        n_period_source_ = 0;
+        n_period_repair_ = 0;
+    }
+}
+
+void RlcWriter::write_source_packet_(const packet::PacketPtr& pp) {
+    const size_t payload_size = pp->fec()->payload.size();
+
+    if (payload_size != payload_size_) {
+        if (window_size_ != 0) {
+            roc_log(LogDebug,
+                    "rlc writer: payload size changed, restarting window:"
+                    " old_size=%lu new_size=%lu",
+                    (unsigned long)payload_size_, (unsigned long)payload_size);
+        }
+        for (size_t n = 0; n < window_.size(); n++) {
+            window_[n] = NULL;
+        }
+        window_size_ = 0;
+        payload_size_ = payload_size;
+    }
+
+    packet::FEC& fec = *pp->fec();
+
+    fec.encoding_symbol_id = next_esi_;
+    fec.source_block_number = 0;
+    fec.source_block_length = 0;
+    fec.block_length = 0;
+
+    pp->add_flags(packet::Packet::FlagComposed);
+
+    if (!source_composer_.compose(*pp)) {
+        roc_panic("rlc writer: can't compose source packet");
+    }
+
+    writer_.write(pp);
+
+    next_esi_++;
+
+    if (payload_size == 0) {
+        return;
+    }
+
+    window_[window_pos_] = pp;
+    window_pos_ = (window_pos_ + 1) % window_.size();
+
+    if (window_size_ < window_.size()) {
+        window_size_++;
+    }
+}
+
+void RlcWriter::write_repair_packets_() {
+    const size_t n_due = n_period_source_ * n_repair_packets_ / n_source_packets_;
+
+    for (; n_period_repair_ < n_due; n_period_repair_++) {
+        packet::PacketPtr rp = make_repair_packet_();
+        if (!rp) {
+            continue;
+        }
+        writer_.write(rp);
+    }
+}
+
+packet::PacketPtr RlcWriter::make_repair_packet_() {
+    packet::PacketPtr packet = packet_factory_.new_packet();
+    if (!packet) {
+        roc_log(LogError, "rlc writer: can't allocate packet");
+        return NULL;
+    }
+
+    core::Slice<uint8_t> data = buffer_factory_.new_buffer();
+    if (!data) {
+        roc_log(LogError, "rlc writer: can't allocate buffer");
+        return NULL;
+    }
+
+    if (!repair_composer_.prepare(*packet, data, payload_size_)) {
+        roc_log(LogError, "rlc writer: can't prepare packet");
+        return NULL;
+    }
+
+    if (!packet->fec()) {
+        roc_log(LogError, "rlc writer: unexpected non-fec packet");
+        return NULL;
+    }
+
+    packet->set_data(data);
+
+    validate_fec_packet_(packet);
+
+    const uint16_t repair_key = next_repair_key_++;
+
+    rlc_coefficients(repair_key, RlcDenseThreshold, coeffs_.data(), window_size_);
+
+    packet::FEC& fec = *packet->fec();
+
+    const Gf256& gf = Gf256::instance();
+
+    for (size_t n = 0; n < window_size_; n++) {
+        const core::Slice<uint8_t>& source = window_packet_(n)->fec()->payload;
+
+        // first product overwrites repair payload, so it needn't be cleared
+        if (n == 0) {
+            gf.mul_region(fec.payload.data(), source.data(), coeffs_[n], payload_size_);
+        } else {
+            gf.mul_add_region(fec.payload.data(), source.data(), coeffs_[n],
+                              payload_size_);
+        }
+    }
+
+    fec.encoding_symbol_id = (uint32_t)(next_esi_ - window_size_);
+    fec.source_block_number = repair_key;
+    fec.source_block_length = window_size_;
+    fec.block_length = RlcDenseThreshold;
+
+    packet->add_flags(packet::Packet::FlagComposed);
+
+    if (!repair_composer_.compose(*packet)) {
+        roc_panic("rlc writer: can't compose repair packet");
+    }
+
+    return packet;
+}
+
+void RlcWriter::validate_fec_packet_(const packet::PacketPtr& pp) {
+    const packet::FEC* fec = pp->fec();
+
+    if (!fec) {
+        roc_panic("rlc writer: unexpected non-fec packet");
+    }
+
+    if (fec->fec_scheme != packet::FEC_RLC) {
+        roc_panic("rlc writer: unexpected packet fec scheme: packet_scheme=%s",
+                  packet::fec_scheme_to_str(fec->fec_scheme));
+    }
+}
+
+// get n-th packet of window, counting from the oldest one
+const packet::PacketPtr& RlcWriter::window_packet_(size_t n) const {
+    roc_panic_if(n >= window_size_);
+
+    return window_[(window_pos_ + window_.size() - window_size_ + n) % window_.size()];
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rlc_writer.h
+//! @brief Sliding window FEC writer.
+
+#ifndef ROC_FEC_RLC_WRITER_H_
+#define ROC_FEC_RLC_WRITER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_fec/writer.h"
+#include "roc_packet/icomposer.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace fec {
+
+//! Sliding window FEC writer.
+//!
+//! Implements sliding window Random Linear Codes (RFC 8681). Every repair
+//! packet is a random linear combination of the last source packets, which
+//! form the encoding window. Repair packets are spread evenly among source
+//! packets, so that the receiver can recover a loss as soon as enough repair
+//! packets arrive, instead of waiting for the end of a block.
+//!
+//! WriterConfig is interpreted as follows: the window covers up to
+//! n_source_packets last source packets, and n_repair_packets repair packets
+//! are generated per every n_source_packets source packets.
+//!
+//! All source packets covered by a window should have the same payload size.
+//! When the size changes, the window is restarted from the new packet.
+class RlcWriter : public packet::IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p config contains window length and repair rate
+    //!  - @p writer is used to write source and repair packets
+    //!  - @p source_composer is used to format source packets
+    //!  - @p repair_composer is used to format repair packets
+    //!  - @p packet_factory is used to allocate repair packets
+    //!  - @p buffer_factory is used to allocate buffers for repair packets
+    //!  - @p allocator is used to initialize window
+    RlcWriter(const WriterConfig& config,
+              packet::IWriter& writer,
+              packet::IComposer& source_composer,
+              packet::IComposer& repair_composer,
+              packet::PacketFactory& packet_factory,
+              core::BufferFactory<uint8_t>& buffer_factory,
+              core::IAllocator& allocator);
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Write packet.
+    //! @remarks
+    //!  - writes the given source packet to the output writer
+    //!  - when it's time, generates repair packets for current window and
+    //!    also writes them to the output writer
+    virtual void write(const packet::PacketPtr&);
+
+private:
+    void write_source_packet_(const packet::PacketPtr&);
+    void write_repair_packets_();
+    packet::PacketPtr make_repair_packet_();
+
+    void validate_fec_packet_(const packet::PacketPtr&);
+
+    const packet::PacketPtr& window_packet_(size_t n) const;
+
+    packet::IWriter& writer_;
+
+    packet::IComposer& source_composer_;
+    packet::IComposer& repair_composer_;
+
+    packet::PacketFactory& packet_factory_;
+    core::BufferFactory<uint8_t>& buffer_factory_;
+
+    // ring of last source packets
+    core::Array<packet::PacketPtr> window_;
+    size_t window_pos_;
+    size_t window_size_;
+
+    core::Array<uint8_t> coeffs_;
+
+    const size_t n_source_packets_;
+    const size_t n_repair_packets_;
+
+    // packets written since beginning of current repair period
+    size_t n_period_source_;
+    size_t n_period_repair_;
+
+    size_t payload_size_;
+
+    uint32_t next_esi_;
+    uint16_t next_repair_key_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RLC_WRITER_H_
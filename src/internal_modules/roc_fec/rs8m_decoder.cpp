@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rs8m_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+Rs8mDecoder::Rs8mDecoder(const CodecConfig& config,
+                         core::BufferFactory<uint8_t>& buffer_factory,
+                         core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , payload_size_(0)
+    , matrix_(allocator)
+    , buffer_factory_(buffer_factory)
+    , buff_tab_(allocator)
+    , recv_tab_(allocator)
+    , reduced_tab_(allocator)
+    , lost_(allocator)
+    , rows_(allocator)
+    , decode_mat_(allocator)
+    , n_source_received_(0)
+    , n_repair_received_(0)
+    , n_reduced_(0)
+    , has_new_packets_(false)
+    , decoding_finished_(false)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_ReedSolomon_M8) {
+        roc_panic("rs8m decoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "rs8m decoder: initializing: m=%u", (unsigned)config.rs_m);
+
+    if (config.rs_m != 8) {
+        roc_log(LogError, "rs8m decoder: unsupported m: m=%u", (unsigned)config.rs_m);
+        return;
+    }
+
+    valid_ = true;
+}
+
+Rs8mDecoder::~Rs8mDecoder() {
+}
+
+bool Rs8mDecoder::valid() const {
+    return valid_;
+}
+
+size_t Rs8mDecoder::max_block_length() const {
+    roc_panic_if_not(valid());
+
+    return Rs8mMatrix::MaxBlockLength;
+}
+
+bool Rs8mDecoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(valid());
+
+    sblen_ = rblen_ = payload_size_ = 0;
+
+    if (!matrix_.build(sblen, rblen)) {
+        return false;
+    }
+
+    // we never need more reduced repair packets than min(sblen, rblen)
+    const size_t max_lost = sblen < rblen ? sblen : rblen;
+
+    if (!buff_tab_.resize(sblen + rblen)) {
+        return false;
+    }
+    if (!recv_tab_.resize(sblen + rblen)) {
+        return false;
+    }
+    if (!reduced_tab_.resize(rblen)) {
+        return false;
+    }
+    if (!lost_.resize(sblen)) {
+        return false;
+    }
+    if (!rows_.resize(max_lost)) {
+        return false;
+    }
+    if (!decode_mat_.resize(max_lost * max_lost * 2)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    payload_size_ = payload_size;
+
+    return true;
+}
+
+void Rs8mDecoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rs8m decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("rs8m decoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("rs8m decoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    if (buff_tab_[index]) {
+        roc_panic("rs8m decoder: can't overwrite buffer: index=%lu",
+                  (unsigned long)index);
+    }
+
+    buff_tab_[index] = buffer;
+    recv_tab_[index] = true;
+
+    has_new_packets_ = true;
+
+    if (decoding_finished_) {
+        return;
+    }
+
+    const Gf256& gf = Gf256::instance();
+
+    if (index < sblen_) {
+        n_source_received_++;
+
+        // eliminate new source packet from already reduced repair packets
+        for (size_t r = 0; r < rblen_ && n_reduced_ != 0; r++) {
+            if (reduced_tab_[r]) {
+                gf.mul_add_region(reduced_tab_[r].data(), buffer.data(),
+                                  matrix_.repair_row(r)[index], payload_size_);
+            }
+        }
+    } else {
+        n_repair_received_++;
+
+        // reduce repair packet only if it may be needed to restore
+        // currently missing source packets
+        if (n_reduced_ < sblen_ - n_source_received_) {
+            (void)reduce_(index - sblen_);
+        }
+    }
+}
+
+core::Slice<uint8_t> Rs8mDecoder::repair(size_t index) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rs8m decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    // repair packets are never restored
+    if (!buff_tab_[index] && index < sblen_) {
+        decode_();
+    }
+
+    return buff_tab_[index];
+}
+
+void Rs8mDecoder::end() {
+    roc_panic_if_not(valid());
+
+    report_();
+
+    for (size_t i = 0; i < buff_tab_.size(); ++i) {
+        buff_tab_[i] = core::Slice<uint8_t>();
+        recv_tab_[i] = false;
+    }
+
+    for (size_t i = 0; i < reduced_tab_.size(); ++i) {
+        reduced_tab_[i] = core::Slice<uint8_t>();
+    }
+
+    n_source_received_ = 0;
+    n_repair_received_ = 0;
+    n_reduced_ = 0;
+
+    has_new_packets_ = false;
+    decoding_finished_ = false;
+}
+
+// reduced = repair - sum(coeff[s] * source[s]) for all received sources
+bool Rs8mDecoder::reduce_(size_t repair_index) {
+    roc_panic_if(reduced_tab_[repair_index]);
+
+    core::Slice<uint8_t> reduced = make_buffer_();
+    if (!reduced) {
+        return false;
+    }
+
+    memcpy(reduced.data(), buff_tab_[sblen_ + repair_index].data(), payload_size_);
+
+    const Gf256& gf = Gf256::instance();
+    const uint8_t* coeffs = matrix_.repair_row(repair_index);
+
+    for (size_t s = 0; s < sblen_; s++) {
+        if (recv_tab_[s]) {
+            gf.mul_add_region(reduced.data(), buff_tab_[s].data(), coeffs[s],
+                              payload_size_);
+        }
+    }
+
+    reduced_tab_[repair_index] = reduced;
+    n_reduced_++;
+
+    return true;
+}
+
+void Rs8mDecoder::decode_() {
+    // all lost source packets are restored at once, so there's nothing
+    // to do if decoding already succeeded or nothing changed since last try
+    if (decoding_finished_ || !has_new_packets_) {
+        return;
+    }
+
+    has_new_packets_ = false;
+
+    const size_t n_lost = sblen_ - n_source_received_;
+
+    if (n_repair_received_ < n_lost) {
+        return;
+    }
+
+    // usually enough repair packets are already reduced when they arrived;
+    // reduce more if some of them were received before we knew about losses
+    for (size_t r = 0; r < rblen_ && n_reduced_ < n_lost; r++) {
+        if (recv_tab_[sblen_ + r] && !reduced_tab_[r]) {
+            if (!reduce_(r)) {
+                return;
+            }
+        }
+    }
+
+    size_t n_rows = 0;
+    for (size_t r = 0; r < rblen_ && n_rows < n_lost; r++) {
+        if (reduced_tab_[r]) {
+            rows_[n_rows++] = r;
+        }
+    }
+    roc_panic_if(n_rows != n_lost);
+
+    size_t n_cols = 0;
+    for (size_t s = 0; s < sblen_; s++) {
+        if (!recv_tab_[s]) {
+            lost_[n_cols++] = s;
+        }
+    }
+    roc_panic_if(n_cols != n_lost);
+
+    // reduced[i] = sum(mat[i][j] * lost[j])
+    uint8_t* mat = decode_mat_.data();
+    uint8_t* work = mat + n_lost * n_lost;
+
+    for (size_t i = 0; i < n_lost; i++) {
+        const uint8_t* coeffs = matrix_.repair_row(rows_[i]);
+        for (size_t j = 0; j < n_lost; j++) {
+            mat[i * n_lost + j] = coeffs[lost_[j]];
+        }
+    }
+
+    if (!Rs8mMatrix::invert(mat, work, n_lost)) {
+        roc_panic("rs8m decoder: decoding matrix is singular");
+    }
+
+    const Gf256& gf = Gf256::instance();
+
+    // lost[j] = sum(inv[j][i] * reduced[i])
+    for (size_t j = 0; j < n_lost; j++) {
+        core::Slice<uint8_t> buffer = make_buffer_();
+        if (!buffer) {
+            return;
+        }
+
+        memset(buffer.data(), 0, payload_size_);
+
+        for (size_t i = 0; i < n_lost; i++) {
+            gf.mul_add_region(buffer.data(), reduced_tab_[rows_[i]].data(),
+                              mat[j * n_lost + i], payload_size_);
+        }
+
+        buff_tab_[lost_[j]] = buffer;
+    }
+
+    decoding_finished_ = true;
+}
+
+void Rs8mDecoder::report_() {
+    size_t n_lost = 0, n_repaired = 0;
+
+    for (size_t i = 0; i < sblen_; i++) {
+        if (!recv_tab_[i]) {
+            n_lost++;
+            if (buff_tab_[i]) {
+                n_repaired++;
+            }
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    roc_log(LogDebug, "rs8m decoder: repaired %u/%u/%u reduced=%u", (unsigned)n_repaired,
+            (unsigned)n_lost, (unsigned)buff_tab_.size(), (unsigned)n_reduced_);
+}
+
+core::Slice<uint8_t> Rs8mDecoder::make_buffer_() {
+    core::Slice<uint8_t> buffer = buffer_factory_.new_buffer();
+
+    if (!buffer) {
+        roc_log(LogError, "rs8m decoder: can't allocate buffer");
+        return core::Slice<uint8_t>();
+    }
+
+    if (buffer.capacity() < payload_size_) {
+        roc_log(LogError, "rs8m decoder: packet size too large: size=%lu max=%lu",
+                (unsigned long)payload_size_, (unsigned long)buffer.capacity());
+        return core::Slice<uint8_t>();
+    }
+
+    buffer.reslice(0, payload_size_);
+
+    return buffer;
+}
+
+} // namespace fec
+} // namespace roc
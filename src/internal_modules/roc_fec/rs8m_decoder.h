@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rs8m_decoder.h
+//! @brief Built-in Reed-Solomon decoder.
+
+#ifndef ROC_FEC_RS8M_DECODER_H_
+#define ROC_FEC_RS8M_DECODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/iblock_decoder.h"
+#include "roc_fec/rs8m_matrix.h"
+
+namespace roc {
+namespace fec {
+
+//! Built-in Reed-Solomon decoder over GF(2^8).
+//!
+//! Decoding is incremental. When a repair packet arrives while some source
+//! packets are missing, contributions of all received source packets are
+//! eliminated from a copy of it right away, and source packets arriving later
+//! are eliminated as they come. Reduced repair packets depend only on missing
+//! source packets, so when a lost packet is requested, the decoder only has
+//! to invert a small matrix with one row per lost packet and combine reduced
+//! repair packets.
+class Rs8mDecoder : public IBlockDecoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit Rs8mDecoder(const CodecConfig& config,
+                         core::BufferFactory<uint8_t>& buffer_factory,
+                         core::IAllocator& allocator);
+
+    virtual ~Rs8mDecoder();
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get the maximum number of encoding symbols for the scheme being used.
+    virtual size_t max_block_length() const;
+
+    //! Start block.
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store source or repair packet buffer for current block.
+    virtual void set(size_t index, const core::Slice<uint8_t>& buffer);
+
+    //! Repair source packet buffer.
+    virtual core::Slice<uint8_t> repair(size_t index);
+
+    //! Finish block.
+    virtual void end();
+
+private:
+    bool reduce_(size_t repair_index);
+    void decode_();
+    void report_();
+
+    core::Slice<uint8_t> make_buffer_();
+
+    size_t sblen_;
+    size_t rblen_;
+    size_t payload_size_;
+
+    Rs8mMatrix matrix_;
+
+    core::BufferFactory<uint8_t>& buffer_factory_;
+
+    // received and repaired source and repair packets
+    core::Array<core::Slice<uint8_t> > buff_tab_;
+
+    // true if packet is received, false if it's is lost or repaired
+    core::Array<bool> recv_tab_;
+
+    // repair packets with contributions of received source packets eliminated;
+    // indexed by repair packet number, null if not reduced
+    core::Array<core::Slice<uint8_t> > reduced_tab_;
+
+    // indices of lost source packets and of reduced repair packets used
+    // for decoding
+    core::Array<size_t> lost_;
+    core::Array<size_t> rows_;
+
+    // decoding matrix and work space for its inversion
+    core::Array<uint8_t> decode_mat_;
+
+    size_t n_source_received_;
+    size_t n_repair_received_;
+    size_t n_reduced_;
+
+    bool has_new_packets_;
+    bool decoding_finished_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RS8M_DECODER_H_
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rs8m_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+Rs8mEncoder::Rs8mEncoder(const CodecConfig& config,
+                         core::BufferFactory<uint8_t>&,
+                         core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , payload_size_(0)
+    , matrix_(allocator)
+    , buff_tab_(allocator)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_ReedSolomon_M8) {
+        roc_panic("rs8m encoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "rs8m encoder: initializing: m=%u", (unsigned)config.rs_m);
+
+    if (config.rs_m != 8) {
+        roc_log(LogError, "rs8m encoder: unsupported m: m=%u", (unsigned)config.rs_m);
+        return;
+    }
+
+    valid_ = true;
+}
+
+Rs8mEncoder::~Rs8mEncoder() {
+}
+
+bool Rs8mEncoder::valid() const {
+    return valid_;
+}
+
+size_t Rs8mEncoder::alignment() const {
+    return Alignment;
+}
+
+size_t Rs8mEncoder::max_block_length() const {
+    roc_panic_if_not(valid());
+
+    return Rs8mMatrix::MaxBlockLength;
+}
+
+bool Rs8mEncoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(valid());
+
+    if (sblen_ == sblen && rblen_ == rblen && payload_size_ == payload_size) {
+        return true;
+    }
+
+    sblen_ = rblen_ = payload_size_ = 0;
+
+    if (!matrix_.build(sblen, rblen)) {
+        return false;
+    }
+
+    if (!buff_tab_.resize(sblen + rblen)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    payload_size_ = payload_size;
+
+    return true;
+}
+
+void Rs8mEncoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rs8m encoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("rs8m encoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("rs8m encoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    buff_tab_[index] = buffer;
+}
+
+void Rs8mEncoder::fill() {
+    roc_panic_if_not(valid());
+
+    const Gf256& gf = Gf256::instance();
+
+    for (size_t r = 0; r < rblen_; r++) {
+        core::Slice<uint8_t>& repair = buff_tab_[sblen_ + r];
+        if (!repair) {
+            roc_panic("rs8m encoder: repair buffer not set: index=%lu",
+                      (unsigned long)(sblen_ + r));
+        }
+
+        const uint8_t* coeffs = matrix_.repair_row(r);
+
+        for (size_t s = 0; s < sblen_; s++) {
+            const core::Slice<uint8_t>& source = buff_tab_[s];
+            if (!source) {
+                roc_panic("rs8m encoder: source buffer not set: index=%lu",
+                          (unsigned long)s);
+            }
+
+            // first product overwrites repair buffer, so it needn't be cleared
+            if (s == 0) {
+                gf.mul_region(repair.data(), source.data(), coeffs[s], payload_size_);
+            } else {
+                gf.mul_add_region(repair.data(), source.data(), coeffs[s],
+                                  payload_size_);
+            }
+        }
+    }
+}
+
+void Rs8mEncoder::end() {
+    roc_panic_if_not(valid());
+
+    for (size_t i = 0; i < buff_tab_.size(); ++i) {
+        buff_tab_[i] = core::Slice<uint8_t>();
+    }
+}
+
+} // namespace fec
+} // namespace roc
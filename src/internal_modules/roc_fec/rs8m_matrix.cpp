@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rs8m_matrix.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+Rs8mMatrix::Rs8mMatrix(core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , repair_rows_(allocator)
+    , work_(allocator) {
+}
+
+bool Rs8mMatrix::build(size_t sblen, size_t rblen) {
+    if (sblen == 0 || sblen + rblen > MaxBlockLength) {
+        roc_log(LogError, "rs8m matrix: invalid block size: sblen=%lu rblen=%lu max=%lu",
+                (unsigned long)sblen, (unsigned long)rblen,
+                (unsigned long)MaxBlockLength);
+        return false;
+    }
+
+    if (sblen == sblen_ && rblen == rblen_) {
+        return true;
+    }
+
+    sblen_ = rblen_ = 0;
+
+    // top square of vandermonde matrix, followed by work space for inversion
+    if (!work_.resize(sblen * sblen * 2)) {
+        return false;
+    }
+    if (!repair_rows_.resize(rblen * sblen)) {
+        return false;
+    }
+
+    const Gf256& gf = Gf256::instance();
+
+    uint8_t* top = work_.data();
+
+    for (size_t row = 0; row < sblen; row++) {
+        for (size_t col = 0; col < sblen; col++) {
+            top[row * sblen + col] =
+                row == 0 ? (col == 0 ? 1 : 0) : gf.exp((row - 1) * col);
+        }
+    }
+
+    if (!invert(top, top + sblen * sblen, sblen)) {
+        roc_panic("rs8m matrix: vandermonde matrix is singular");
+    }
+
+    // repair row = vandermonde row * inverse of top square
+    for (size_t r = 0; r < rblen; r++) {
+        uint8_t* out = repair_rows_.data() + r * sblen;
+        memset(out, 0, sblen);
+
+        for (size_t i = 0; i < sblen; i++) {
+            gf.mul_add_region(out, top + i * sblen, gf.exp((sblen + r - 1) * i), sblen);
+        }
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+
+    return true;
+}
+
+size_t Rs8mMatrix::sblen() const {
+    return sblen_;
+}
+
+size_t Rs8mMatrix::rblen() const {
+    return rblen_;
+}
+
+const uint8_t* Rs8mMatrix::repair_row(size_t index) const {
+    roc_panic_if_msg(index >= rblen_,
+                     "rs8m matrix: index out of bounds: index=%lu size=%lu",
+                     (unsigned long)index, (unsigned long)rblen_);
+
+    return repair_rows_.data() + index * sblen_;
+}
+
+// Gauss-Jordan elimination on [matrix | identity]
+bool Rs8mMatrix::invert(uint8_t* matrix, uint8_t* work, size_t size) {
+    const Gf256& gf = Gf256::instance();
+
+    uint8_t* inv = work;
+
+    memset(inv, 0, size * size);
+    for (size_t n = 0; n < size; n++) {
+        inv[n * size + n] = 1;
+    }
+
+    for (size_t col = 0; col < size; col++) {
+        size_t pivot = col;
+        while (pivot < size && matrix[pivot * size + col] == 0) {
+            pivot++;
+        }
+        if (pivot == size) {
+            return false;
+        }
+
+        if (pivot != col) {
+            for (size_t n = 0; n < size; n++) {
+                uint8_t tmp = matrix[pivot * size + n];
+                matrix[pivot * size + n] = matrix[col * size + n];
+                matrix[col * size + n] = tmp;
+
+                tmp = inv[pivot * size + n];
+                inv[pivot * size + n] = inv[col * size + n];
+                inv[col * size + n] = tmp;
+            }
+        }
+
+        uint8_t* m_row = matrix + col * size;
+        uint8_t* i_row = inv + col * size;
+
+        const uint8_t scale = gf.inv(m_row[col]);
+        if (scale != 1) {
+            for (size_t n = 0; n < size; n++) {
+                m_row[n] = gf.mul(m_row[n], scale);
+                i_row[n] = gf.mul(i_row[n], scale);
+            }
+        }
+
+        for (size_t row = 0; row < size; row++) {
+            if (row == col) {
+                continue;
+            }
+            const uint8_t factor = matrix[row * size + col];
+            if (factor == 0) {
+                continue;
+            }
+            gf.mul_add_region(matrix + row * size, m_row, factor, size);
+            gf.mul_add_region(inv + row * size, i_row, factor, size);
+        }
+    }
+
+    memcpy(matrix, inv, size * size);
+
+    return true;
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rs8m_matrix.h
+//! @brief Reed-Solomon generator matrix.
+
+#ifndef ROC_FEC_RS8M_MATRIX_H_
+#define ROC_FEC_RS8M_MATRIX_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! Reed-Solomon generator matrix over GF(2^8).
+//!
+//! Systematic generator matrix is derived from n x k Vandermonde matrix, where
+//! row 0 corresponds to point 0 and row i > 0 corresponds to point alpha^(i-1),
+//! by multiplying it by the inverse of its top k x k square. Top k rows of the
+//! result form identity matrix and are not stored; only repair rows are kept.
+//! Any k rows of the matrix are linearly independent, so any k symbols of a
+//! block are enough to recover the source symbols.
+class Rs8mMatrix : public core::NonCopyable<> {
+public:
+    //! Maximum number of source and repair symbols in block.
+    enum { MaxBlockLength = 255 };
+
+    //! Initialize empty matrix.
+    explicit Rs8mMatrix(core::IAllocator& allocator);
+
+    //! Compute matrix for given number of source and repair symbols.
+    //! @returns
+    //!  false if block size is invalid or allocation failed.
+    bool build(size_t sblen, size_t rblen);
+
+    //! Get number of source symbols.
+    size_t sblen() const;
+
+    //! Get number of repair symbols.
+    size_t rblen() const;
+
+    //! Get coefficients for repair symbol.
+    //! @returns
+    //!  array of sblen() coefficients, one per source symbol.
+    const uint8_t* repair_row(size_t index) const;
+
+    //! Invert square matrix in place.
+    //! @remarks
+    //!  @p matrix and @p work should point to size * size elements.
+    //!  @p work is used as temporary storage.
+    //! @returns
+    //!  false if matrix is singular.
+    static bool invert(uint8_t* matrix, uint8_t* work, size_t size);
+
+private:
+    size_t sblen_;
+    size_t rblen_;
+
+    core::Array<uint8_t> repair_rows_;
+    core::Array<uint8_t> work_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RS8M_MATRIX_H_
@@ -34,6 +34,7 @@ OpenfecDecoder::OpenfecDecoder(const CodecConfig& config,
     , recv_tab_(allocator)
     , status_(allocator)
     , has_new_packets_(false)
+    , decoding_attempted_(false)
     , decoding_finished_(false)
     , valid_(false) {
     if (config.scheme == packet::FEC_ReedSolomon_M8) {
@@ -129,12 +130,17 @@ void OpenfecDecoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
     recv_tab_[index] = true;
 
     // register new packet and try to repair more packets
-    roc_log(LogTrace, "openfec decoder: of_decode_with_new_symbol(): index=%lu",
-            (unsigned long)index);
+    // if decoding was already attempted, session will be recreated with all
+    // available packets during next decoding, since OpenFEC doesn't allow
+    // to add packets after of_finish_decoding()
+    if (!decoding_attempted_) {
+        roc_log(LogTrace, "openfec decoder: of_decode_with_new_symbol(): index=%lu",
+                (unsigned long)index);
 
-    if (of_decode_with_new_symbol(of_sess_, data_tab_[index], (unsigned int)index)
-        != OF_STATUS_OK) {
-        roc_panic("openfec decoder: can't add packet to OF session");
+        if (of_decode_with_new_symbol(of_sess_, data_tab_[index], (unsigned int)index)
+            != OF_STATUS_OK) {
+            roc_panic("openfec decoder: can't add packet to OF session");
+        }
     }
 
     if (max_index_ < index) {
@@ -162,6 +168,7 @@ void OpenfecDecoder::end() {
     reset_tabs_();
 
     has_new_packets_ = false;
+    decoding_attempted_ = false;
     decoding_finished_ = false;
 }
 
@@ -223,7 +230,7 @@ void OpenfecDecoder::decode_() {
         return;
     }
 
-    if (decoding_finished_) {
+    if (decoding_attempted_) {
         // it's not allowed to decode twice, so we recreate the session
         reset_session_();
 
@@ -237,6 +244,8 @@ void OpenfecDecoder::decode_() {
     // try to repair more packets
     roc_log(LogTrace, "openfec decoder: of_finish_decoding()");
 
+    decoding_attempted_ = true;
+
     if (of_finish_decoding(of_sess_) != OF_STATUS_OK) {
         roc_log(LogTrace, "openfec decoder: of_finish_decoding() returned error");
         return;
@@ -126,6 +126,7 @@ private:
     core::Array<char> status_;
 
     bool has_new_packets_;
+    bool decoding_attempted_;
     bool decoding_finished_;
 
     size_t max_block_length_;
@@ -30,6 +30,8 @@ OpenfecEncoder::OpenfecEncoder(const CodecConfig& config,
         codec_id_ = OF_CODEC_REED_SOLOMON_GF_2_M_STABLE;
         codec_params_.rs_params_.m = config.rs_m;
 
+        of_sess_key_.rs_m = config.rs_m;
+
         of_sess_params_ = (of_parameters_t*)&codec_params_.rs_params_;
 
         max_block_length_ = OF_REED_SOLOMON_MAX_NB_ENCODING_SYMBOLS_DEFAULT;
@@ -41,6 +43,9 @@ OpenfecEncoder::OpenfecEncoder(const CodecConfig& config,
         codec_params_.ldpc_params_.prng_seed = config.ldpc_prng_seed;
         codec_params_.ldpc_params_.N1 = config.ldpc_N1;
 
+        of_sess_key_.ldpc_prng_seed = config.ldpc_prng_seed;
+        of_sess_key_.ldpc_n1 = config.ldpc_N1;
+
         of_sess_params_ = (of_parameters_t*)&codec_params_.ldpc_params_;
 
         max_block_length_ = OF_LDPC_STAIRCASE_MAX_NB_ENCODING_SYMBOLS_DEFAULT;
@@ -48,15 +53,15 @@ OpenfecEncoder::OpenfecEncoder(const CodecConfig& config,
         roc_panic("openfec encoder: unexpected fec scheme");
     }
 
+    of_sess_key_.codec_id = codec_id_;
+
     of_verbosity = 0;
 
     valid_ = true;
 }
 
 OpenfecEncoder::~OpenfecEncoder() {
-    if (of_sess_) {
-        of_release_codec_instance(of_sess_);
-    }
+    release_session_();
 }
 
 bool OpenfecEncoder::valid() const {
@@ -88,8 +93,9 @@ bool OpenfecEncoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
     rblen_ = rblen;
     payload_size_ = payload_size;
 
+    release_session_();
     update_session_params_(sblen, rblen, payload_size);
-    reset_session_();
+    acquire_session_();
 
     return true;
 }
@@ -161,6 +167,29 @@ void OpenfecEncoder::update_session_params_(size_t sblen,
     of_sess_params_->nb_source_symbols = (uint32_t)sblen;
     of_sess_params_->nb_repair_symbols = (uint32_t)rblen;
     of_sess_params_->encoding_symbol_length = (uint32_t)payload_size;
+
+    of_sess_key_.sblen = sblen;
+    of_sess_key_.rblen = rblen;
+    of_sess_key_.payload_size = payload_size;
+}
+
+void OpenfecEncoder::acquire_session_() {
+    roc_panic_if(of_sess_ != NULL);
+
+    of_sess_ = OpenfecSessionCache::instance().take(of_sess_key_);
+
+    if (of_sess_ == NULL) {
+        reset_session_();
+    }
+}
+
+void OpenfecEncoder::release_session_() {
+    if (of_sess_ == NULL) {
+        return;
+    }
+
+    OpenfecSessionCache::instance().put(of_sess_key_, of_sess_);
+    of_sess_ = NULL;
 }
 
 void OpenfecEncoder::reset_session_() {
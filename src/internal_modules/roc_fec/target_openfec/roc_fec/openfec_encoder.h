@@ -19,6 +19,7 @@
 #include "roc_core/slice.h"
 #include "roc_fec/codec_config.h"
 #include "roc_fec/iblock_encoder.h"
+#include "roc_fec/openfec_session_cache.h"
 #include "roc_packet/units.h"
 
 extern "C" {
@@ -77,6 +78,8 @@ public:
 
 private:
     bool resize_tabs_(size_t size);
+    void acquire_session_();
+    void release_session_();
     void reset_session_();
     void update_session_params_(size_t sblen, size_t rblen, size_t payload_size);
 
@@ -87,8 +90,10 @@ private:
 
     size_t payload_size_;
 
+    // session is shared via cache with encoders with same parameters
     of_session_t* of_sess_;
     of_parameters_t* of_sess_params_;
+    OpenfecSessionKey of_sess_key_;
 
     of_codec_id_t codec_id_;
     union {
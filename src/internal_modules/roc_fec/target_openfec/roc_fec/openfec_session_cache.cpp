@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/openfec_session_cache.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace fec {
+
+OpenfecSessionCache::OpenfecSessionCache()
+    : n_entries_(0) {
+}
+
+of_session_t* OpenfecSessionCache::take(const OpenfecSessionKey& key) {
+    core::Mutex::Lock lock(mutex_);
+
+    // take most recently added session, it's more likely to be in cache
+    for (size_t n = n_entries_; n > 0; n--) {
+        if (!(entries_[n - 1].key == key)) {
+            continue;
+        }
+
+        of_session_t* session = entries_[n - 1].session;
+
+        for (size_t i = n; i < n_entries_; i++) {
+            entries_[i - 1] = entries_[i];
+        }
+        n_entries_--;
+
+        roc_log(LogTrace,
+                "openfec session cache: reusing session: sblen=%lu rblen=%lu"
+                " payload_size=%lu",
+                (unsigned long)key.sblen, (unsigned long)key.rblen,
+                (unsigned long)key.payload_size);
+
+        return session;
+    }
+
+    return NULL;
+}
+
+void OpenfecSessionCache::put(const OpenfecSessionKey& key, of_session_t* session) {
+    roc_panic_if(session == NULL);
+
+    core::Mutex::Lock lock(mutex_);
+
+    if (n_entries_ == MaxSessions) {
+        roc_log(LogTrace, "openfec session cache: cache is full, releasing session");
+
+        of_release_codec_instance(entries_[0].session);
+
+        for (size_t i = 1; i < n_entries_; i++) {
+            entries_[i - 1] = entries_[i];
+        }
+        n_entries_--;
+    }
+
+    entries_[n_entries_].key = key;
+    entries_[n_entries_].session = session;
+    n_entries_++;
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/target_openfec/roc_fec/openfec_session_cache.h
+//! @brief Cache of prepared OpenFEC sessions.
+
+#ifndef ROC_FEC_OPENFEC_SESSION_CACHE_H_
+#define ROC_FEC_OPENFEC_SESSION_CACHE_H_
+
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+extern "C" {
+#include <of_openfec_api.h>
+}
+
+namespace roc {
+namespace fec {
+
+//! Parameters of prepared OpenFEC session.
+struct OpenfecSessionKey {
+    //! OpenFEC codec.
+    of_codec_id_t codec_id;
+
+    //! Number of source symbols in block.
+    size_t sblen;
+
+    //! Number of repair symbols in block.
+    size_t rblen;
+
+    //! Symbol size.
+    size_t payload_size;
+
+    //! Reed-Solomon m parameter, zero for other codecs.
+    unsigned rs_m;
+
+    //! LDPC-Staircase PRNG seed, zero for other codecs.
+    long ldpc_prng_seed;
+
+    //! LDPC-Staircase N1 parameter, zero for other codecs.
+    int ldpc_n1;
+
+    OpenfecSessionKey()
+        : codec_id(OF_CODEC_NIL)
+        , sblen(0)
+        , rblen(0)
+        , payload_size(0)
+        , rs_m(0)
+        , ldpc_prng_seed(0)
+        , ldpc_n1(0) {
+    }
+
+    //! Check if two keys are equal.
+    bool operator==(const OpenfecSessionKey& other) const {
+        return codec_id == other.codec_id && sblen == other.sblen
+            && rblen == other.rblen && payload_size == other.payload_size
+            && rs_m == other.rs_m && ldpc_prng_seed == other.ldpc_prng_seed
+            && ldpc_n1 == other.ldpc_n1;
+    }
+};
+
+//! Process-wide cache of prepared OpenFEC encoder sessions.
+//!
+//! Creating OpenFEC session and setting its FEC parameters is expensive,
+//! especially for LDPC-Staircase, which generates parity check matrix.
+//! Encoder sessions keep no per-block state, so instead of being released,
+//! session can be put to the cache when its encoder is destroyed or switches
+//! to other block parameters, and then taken by another encoder with the same
+//! parameters.
+//!
+//! Decoder sessions are modified by decoding and can't be reused, so they're
+//! not cached.
+//!
+//! Thread-safe.
+class OpenfecSessionCache : public core::NonCopyable<> {
+public:
+    //! Get instance.
+    static OpenfecSessionCache& instance() {
+        return core::Singleton<OpenfecSessionCache>::instance();
+    }
+
+    //! Take session with given parameters from cache.
+    //! @returns
+    //!  NULL if there is no such session.
+    of_session_t* take(const OpenfecSessionKey& key);
+
+    //! Put session with given parameters to cache.
+    //! @remarks
+    //!  If cache is full, the least recently added session is released.
+    void put(const OpenfecSessionKey& key, of_session_t* session);
+
+private:
+    friend class core::Singleton<OpenfecSessionCache>;
+
+    enum { MaxSessions = 32 };
+
+    struct Entry {
+        OpenfecSessionKey key;
+        of_session_t* session;
+    };
+
+    OpenfecSessionCache();
+
+    core::Mutex mutex_;
+
+    Entry entries_[MaxSessions];
+    size_t n_entries_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_OPENFEC_SESSION_CACHE_H_
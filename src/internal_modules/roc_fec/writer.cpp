@@ -23,12 +23,16 @@ Writer::Writer(const WriterConfig& config,
                packet::IComposer& repair_composer,
                packet::PacketFactory& packet_factory,
                core::BufferFactory<uint8_t>& buffer_factory,
-               core::IAllocator& allocator)
+               core::IAllocator& allocator,
+               BatchEncoder* batch_encoder)
     : cur_sblen_(0)
     , next_sblen_(0)
     , cur_rblen_(0)
     , next_rblen_(0)
     , cur_payload_size_(0)
+    , cur_silent_packets_(0)
+    , cur_needed_rblen_(0)
+    , skip_silence_(config.skip_silence)
     , encoder_(encoder)
     , writer_(writer)
     , source_composer_(source_composer)
@@ -36,6 +40,9 @@ Writer::Writer(const WriterConfig& config,
     , packet_factory_(packet_factory)
     , buffer_factory_(buffer_factory)
     , repair_block_(allocator)
+    , batch_encoder_(batch_encoder)
+    , batch_job_(allocator)
+    , batch_pending_(false)
     , first_packet_(true)
     , cur_packet_(0)
     , fec_scheme_(fec_scheme)
@@ -43,12 +50,23 @@ Writer::Writer(const WriterConfig& config,
     , alive_(true) {
     cur_sbn_ = (packet::blknum_t)core::fast_random(0, packet::blknum_t(-1));
     cur_block_repair_sn_ = (packet::seqnum_t)core::fast_random(0, packet::seqnum_t(-1));
+    if (batch_encoder_ && fec_scheme_ != packet::FEC_ReedSolomon_M8) {
+        roc_log(LogError, "fec writer: batch encoder doesn't support scheme: scheme=%s",
+                packet::fec_scheme_to_str(fec_scheme_));
+        return;
+    }
     if (!resize(config.n_source_packets, config.n_repair_packets)) {
         return;
     }
     valid_ = true;
 }
 
+Writer::~Writer() {
+    if (batch_pending_) {
+        batch_encoder_->cancel(batch_job_);
+    }
+}
+
 bool Writer::valid() const {
     return valid_;
 }
@@ -57,6 +75,10 @@ bool Writer::alive() const {
     return alive_;
 }
 
+bool Writer::is_block_boundary() const {
+    return cur_packet_ == 0;
+}
+
 bool Writer::resize(size_t sblen, size_t rblen) {
     if (next_sblen_ == sblen && next_rblen_ == rblen) {
         return true;
@@ -125,7 +147,33 @@ void Writer::write(const packet::PacketPtr& pp) {
     }
 }
 
+void Writer::flush() {
+    roc_panic_if_not(valid());
+
+    if (!batch_pending_) {
+        return;
+    }
+
+    batch_encoder_->flush();
+    batch_pending_ = false;
+
+    if (batch_job_.encoded()) {
+        drop_unneeded_repair_packets_();
+        compose_repair_packets_();
+        write_repair_packets_();
+    } else {
+        for (size_t i = 0; i < cur_rblen_; i++) {
+            repair_block_[i] = NULL;
+        }
+    }
+
+    batch_job_.end();
+}
+
 bool Writer::begin_block_(const packet::PacketPtr& pp) {
+    // repair packets of previous block still refer to block state
+    flush();
+
     if (!apply_sizes_(next_sblen_, next_rblen_, pp->fec()->payload.size())) {
         return false;
     }
@@ -135,7 +183,7 @@ bool Writer::begin_block_(const packet::PacketPtr& pp) {
             (unsigned long)cur_sbn_, (unsigned long)cur_sblen_, (unsigned long)cur_rblen_,
             (unsigned long)cur_payload_size_);
 
-    if (!encoder_.begin(cur_sblen_, cur_rblen_, cur_payload_size_)) {
+    if (!begin_encoding_()) {
         roc_log(LogError,
                 "fec writer: can't begin encoder block, shutting down:"
                 " sblen=%lu rblen=%lu",
@@ -146,19 +194,59 @@ bool Writer::begin_block_(const packet::PacketPtr& pp) {
     return true;
 }
 
+bool Writer::begin_encoding_() {
+    if (batch_encoder_) {
+        return batch_job_.begin(cur_sblen_, cur_rblen_, cur_payload_size_);
+    }
+
+    return encoder_.begin(cur_sblen_, cur_rblen_, cur_payload_size_);
+}
+
 void Writer::end_block_() {
+    cur_needed_rblen_ = num_needed_repair_packets_();
+
+    if (cur_needed_rblen_ != cur_rblen_) {
+        roc_log(LogTrace,
+                "fec writer: reducing repair packets for silence:"
+                " sbn=%lu silent_packets=%lu/%lu repair_packets=%lu/%lu",
+                (unsigned long)cur_sbn_, (unsigned long)cur_silent_packets_,
+                (unsigned long)cur_sblen_, (unsigned long)cur_needed_rblen_,
+                (unsigned long)cur_rblen_);
+    }
+
+    if (cur_needed_rblen_ == 0) {
+        end_encoding_();
+        return;
+    }
+
     make_repair_packets_();
+
+    if (batch_encoder_) {
+        submit_repair_packets_();
+        return;
+    }
+
     encode_repair_packets_();
+    drop_unneeded_repair_packets_();
     compose_repair_packets_();
     write_repair_packets_();
 
     encoder_.end();
 }
 
+void Writer::end_encoding_() {
+    if (batch_encoder_) {
+        batch_job_.end();
+    } else {
+        encoder_.end();
+    }
+}
+
 void Writer::next_block_() {
     cur_block_repair_sn_ += (packet::seqnum_t)cur_rblen_;
     cur_sbn_++;
     cur_packet_ = 0;
+    cur_silent_packets_ = 0;
 }
 
 bool Writer::apply_sizes_(size_t sblen, size_t rblen, size_t payload_size) {
@@ -185,7 +273,15 @@ bool Writer::apply_sizes_(size_t sblen, size_t rblen, size_t payload_size) {
 }
 
 void Writer::write_source_packet_(const packet::PacketPtr& pp) {
-    encoder_.set(cur_packet_, pp->fec()->payload);
+    if (batch_encoder_) {
+        batch_job_.set(cur_packet_, pp->fec()->payload);
+    } else {
+        encoder_.set(cur_packet_, pp->fec()->payload);
+    }
+
+    if (pp->flags() & packet::Packet::FlagZeros) {
+        cur_silent_packets_++;
+    }
 
     pp->add_flags(packet::Packet::FlagComposed);
     fill_packet_fec_fields_(pp, (packet::seqnum_t)cur_packet_);
@@ -197,6 +293,25 @@ void Writer::write_source_packet_(const packet::PacketPtr& pp) {
     writer_.write(pp);
 }
 
+// keep ratio between repair packets and source packets which need protection
+size_t Writer::num_needed_repair_packets_() const {
+    if (!skip_silence_) {
+        return cur_rblen_;
+    }
+
+    const size_t n_audible = cur_sblen_ - cur_silent_packets_;
+
+    return (cur_rblen_ * n_audible + cur_sblen_ - 1) / cur_sblen_;
+}
+
+// all repair packets are needed for encoding, but only first of them are sent;
+// others look like lost to receiver
+void Writer::drop_unneeded_repair_packets_() {
+    for (size_t i = cur_needed_rblen_; i < cur_rblen_; i++) {
+        repair_block_[i] = NULL;
+    }
+}
+
 void Writer::make_repair_packets_() {
     for (size_t i = 0; i < cur_rblen_; i++) {
         packet::PacketPtr rp = make_repair_packet_((packet::seqnum_t)i);
@@ -253,6 +368,24 @@ void Writer::encode_repair_packets_() {
     encoder_.fill();
 }
 
+void Writer::submit_repair_packets_() {
+    for (size_t i = 0; i < cur_rblen_; i++) {
+        packet::PacketPtr rp = repair_block_[i];
+        if (!rp) {
+            // can't encode block without all buffers
+            batch_job_.end();
+            for (size_t j = 0; j < cur_rblen_; j++) {
+                repair_block_[j] = NULL;
+            }
+            return;
+        }
+        batch_job_.set(cur_sblen_ + i, rp->fec()->payload);
+    }
+
+    batch_encoder_->submit(batch_job_);
+    batch_pending_ = true;
+}
+
 void Writer::compose_repair_packets_() {
     for (size_t i = 0; i < cur_rblen_; i++) {
         packet::PacketPtr rp = repair_block_[i];
@@ -17,6 +17,7 @@
 #include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
+#include "roc_fec/batch_encoder.h"
 #include "roc_fec/iblock_encoder.h"
 #include "roc_packet/icomposer.h"
 #include "roc_packet/iwriter.h"
@@ -34,9 +35,17 @@ struct WriterConfig {
     //! Number of FEC packets in block.
     size_t n_repair_packets;
 
+    //! Reduce number of FEC packets for silence.
+    //! If enabled, number of FEC packets in block is reduced proportionally to
+    //! the number of data packets with packet::Packet::FlagZeros, and blocks
+    //! with only such packets get no FEC packets at all. Losses of silent
+    //! packets need no repair, since receiver plays silence instead of them.
+    bool skip_silence;
+
     WriterConfig()
         : n_source_packets(20)
-        , n_repair_packets(10) {
+        , n_repair_packets(10)
+        , skip_silence(false) {
     }
 };
 
@@ -54,6 +63,8 @@ public:
     //!  - @p packet_factory is used to allocate repair packets
     //!  - @p buffer_factory is used to allocate buffers for repair packets
     //!  - @p allocator is used to initialize a packet array
+    //!  - @p batch_encoder, if non-NULL, is used to encode repair packets together
+    //!    with other writers instead of @p encoder; see flush()
     Writer(const WriterConfig& config,
            packet::FecScheme fec_scheme,
            IBlockEncoder& encoder,
@@ -62,7 +73,11 @@ public:
            packet::IComposer& repair_composer,
            packet::PacketFactory& packet_factory,
            core::BufferFactory<uint8_t>& buffer_factory,
-           core::IAllocator& allocator);
+           core::IAllocator& allocator,
+           BatchEncoder* batch_encoder = NULL);
+
+    //! Deinitialize.
+    ~Writer();
 
     //! Check if object is successfully constructed.
     bool valid() const;
@@ -70,6 +85,12 @@ public:
     //! Check if writer is still working.
     bool alive() const;
 
+    //! Check if next source packet will begin a new block.
+    //! @remarks
+    //!  All source packets of a block should have the same payload size, so
+    //!  payload size may be changed only at block boundary.
+    bool is_block_boundary() const;
+
     //! Set number of source packets per block.
     bool resize(size_t sblen, size_t rblen);
 
@@ -79,6 +100,17 @@ public:
     //!  - generates repair packets and also writes them to the output writer
     virtual void write(const packet::PacketPtr&);
 
+    //! Write repair packets of last block.
+    //! @remarks
+    //!  When batch encoder is used, repair packets are not written when a block
+    //!  ends; instead, the block is submitted to the batch encoder and its repair
+    //!  packets are written by this method. It should be called after the
+    //!  source packets of the last frame were written to all writers sharing
+    //!  the batch encoder, so that their blocks can be encoded together. If a
+    //!  new block begins before flush() is called, it's called automatically.
+    //!  Without batch encoder, does nothing.
+    void flush();
+
 private:
     bool begin_block_(const packet::PacketPtr& pp);
     void end_block_();
@@ -86,10 +118,15 @@ private:
 
     bool apply_sizes_(size_t sblen, size_t rblen, size_t payload_size);
 
+    bool begin_encoding_();
+    void end_encoding_();
     void write_source_packet_(const packet::PacketPtr&);
+    size_t num_needed_repair_packets_() const;
+    void drop_unneeded_repair_packets_();
     void make_repair_packets_();
     packet::PacketPtr make_repair_packet_(packet::seqnum_t n);
     void encode_repair_packets_();
+    void submit_repair_packets_();
     void compose_repair_packets_();
     void write_repair_packets_();
     void fill_packet_fec_fields_(const packet::PacketPtr& packet, packet::seqnum_t n);
@@ -105,6 +142,13 @@ private:
 
     size_t cur_payload_size_;
 
+    // number of silent source packets and of repair packets to be sent
+    // in current block
+    size_t cur_silent_packets_;
+    size_t cur_needed_rblen_;
+
+    const bool skip_silence_;
+
     IBlockEncoder& encoder_;
     packet::IWriter& writer_;
 
@@ -116,6 +160,10 @@ private:
 
     core::Array<packet::PacketPtr> repair_block_;
 
+    BatchEncoder* batch_encoder_;
+    BatchEncoderJob batch_job_;
+    bool batch_pending_;
+
     bool first_packet_;
 
     packet::blknum_t cur_sbn_;
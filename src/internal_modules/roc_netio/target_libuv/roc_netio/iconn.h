@@ -13,6 +13,7 @@
 #define ROC_NETIO_ICONN_H_
 
 #include "roc_address/socket_addr.h"
+#include "roc_core/slice.h"
 #include "roc_core/stddefs.h"
 #include "roc_netio/io_error.h"
 #include "roc_netio/termination_mode.h"
@@ -54,6 +55,15 @@ public:
     //!  number of bytes written (>= 0) or IOError (< 0);
     virtual ssize_t try_write(const void* buf, size_t len) = 0;
 
+    //! Try writing @p n_bufs slices to the connection without blocking.
+    //! @remarks
+    //!  - @p bufs should not be NULL.
+    //!  - Slices are written in order using single system call, without
+    //!    concatenating them; they may be written partially.
+    //! @returns
+    //!  total number of bytes written (>= 0) or IOError (< 0);
+    virtual ssize_t try_write_vec(const core::Slice<uint8_t>* bufs, size_t n_bufs) = 0;
+
     //! Try reading @p len bytes from the the connection to @p buf without blocking.
     //! @remarks
     //!  - @p buf should not be NULL.
@@ -62,6 +72,16 @@ public:
     //!  number of bytes read (>= 0) or IOError (< 0);
     virtual ssize_t try_read(void* buf, size_t len) = 0;
 
+    //! Try reading bytes from the connection to @p buf without blocking.
+    //! @remarks
+    //!  - @p buf should not be empty.
+    //!  - Bytes are appended to the slice, up to its capacity, and the slice
+    //!    is extended accordingly. This allows to read directly into buffers
+    //!    allocated from buffer factory.
+    //! @returns
+    //!  number of bytes read (>= 0) or IOError (< 0);
+    virtual ssize_t try_read_slice(core::Slice<uint8_t>& buf) = 0;
+
     //! Initiate asynchronous connection termination.
     //! @remarks
     //!  When termination is complete, IConnHandler::connection_terminated()
@@ -35,6 +35,7 @@ NetworkLoop::Tasks::AddUdpSenderPort::AddUdpSenderPort(UdpSenderConfig& config)
     func_ = &NetworkLoop::task_add_udp_sender_;
     config_ = &config;
     writer_ = NULL;
+    max_payload_size_ = 0;
 }
 
 NetworkLoop::PortHandle NetworkLoop::Tasks::AddUdpSenderPort::get_handle() const {
@@ -53,6 +54,13 @@ packet::IWriter* NetworkLoop::Tasks::AddUdpSenderPort::get_writer() const {
     return writer_;
 }
 
+size_t NetworkLoop::Tasks::AddUdpSenderPort::get_max_payload_size() const {
+    if (!success()) {
+        return 0;
+    }
+    return max_payload_size_;
+}
+
 NetworkLoop::Tasks::AddTcpServerPort::AddTcpServerPort(TcpServerConfig& config,
                                                        IConnAcceptor& conn_acceptor) {
     func_ = &NetworkLoop::task_add_tcp_server_;
@@ -104,8 +112,10 @@ NetworkLoop::Tasks::ResolveEndpointAddress::get_address() const {
 
 NetworkLoop::NetworkLoop(packet::PacketFactory& packet_factory,
                          core::BufferFactory<uint8_t>& buffer_factory,
-                         core::IAllocator& allocator)
-    : packet_factory_(packet_factory)
+                         core::IAllocator& allocator,
+                         const core::ThreadConfig& thread_config)
+    : core::Thread(thread_config)
+    , packet_factory_(packet_factory)
     , buffer_factory_(buffer_factory)
     , allocator_(allocator)
     , started_(false)
@@ -459,6 +469,7 @@ void NetworkLoop::task_add_udp_sender_(NetworkTask& base_task) {
     task.config_->bind_address = port->bind_address();
     task.port_handle_ = port.get();
     task.writer_ = port.get();
+    task.max_payload_size_ = port->max_payload_size();
 
     task.success_ = true;
     task.state_ = NetworkTask::StateFinishing;
@@ -100,11 +100,19 @@ public:
             //!  Should be called only if success() is true.
             packet::IWriter* get_writer() const;
 
+            //! Get maximum UDP payload size fitting into path MTU.
+            //! @remarks
+            //!  Zero if unknown. See UdpSenderPort::max_payload_size().
+            //! @pre
+            //!  Should be called only if success() is true.
+            size_t get_max_payload_size() const;
+
         private:
             friend class NetworkLoop;
 
             UdpSenderConfig* config_;
             packet::IWriter* writer_;
+            size_t max_payload_size_;
         };
 
         //! Add TCP server port.
@@ -187,7 +195,8 @@ public:
     //!  Start background thread if the object was successfully constructed.
     NetworkLoop(packet::PacketFactory& packet_factory,
                 core::BufferFactory<uint8_t>& buffer_factory,
-                core::IAllocator& allocator);
+                core::IAllocator& allocator,
+                const core::ThreadConfig& thread_config = core::ThreadConfig());
 
     //! Destroy. Stop all receivers and senders.
     //! @remarks
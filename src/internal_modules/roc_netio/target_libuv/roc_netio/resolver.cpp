@@ -13,13 +13,27 @@
 #include "roc_core/log.h"
 #include "roc_core/macro_helpers.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
 
 namespace roc {
 namespace netio {
 
+namespace {
+
+// How long resolved addresses are kept in cache.
+const core::nanoseconds_t CacheTtl = 30 * core::Second;
+
+bool same_endpoint(const ResolverRequest& a, const ResolverRequest& b) {
+    return strcmp(a.endpoint_uri->host(), b.endpoint_uri->host()) == 0
+        && strcmp(a.endpoint_uri->service(), b.endpoint_uri->service()) == 0;
+}
+
+} // namespace
+
 Resolver::Resolver(IResolverRequestHandler& req_handler, uv_loop_t& event_loop)
     : loop_(event_loop)
-    , req_handler_(req_handler) {
+    , req_handler_(req_handler)
+    , inflight_(NULL) {
 }
 
 bool Resolver::async_resolve(ResolverRequest& req) {
@@ -42,6 +56,23 @@ bool Resolver::async_resolve(ResolverRequest& req) {
         return false;
     }
 
+    if (lookup_cache_(req)) {
+        finish_resolving_(req, 0);
+        return false;
+    }
+
+    req.next_inflight = NULL;
+    req.next_waiter = NULL;
+
+    if (ResolverRequest* leader = find_inflight_(req)) {
+        roc_log(LogTrace, "resolver: joining in-flight request: endpoint=%s",
+                address::endpoint_uri_to_str(*req.endpoint_uri).c_str());
+
+        req.next_waiter = leader->next_waiter;
+        leader->next_waiter = &req;
+        return true;
+    }
+
     req.handle.data = this;
 
     if (int err =
@@ -51,6 +82,9 @@ bool Resolver::async_resolve(ResolverRequest& req) {
         return false;
     }
 
+    req.next_inflight = inflight_;
+    inflight_ = &req;
+
     return true;
 }
 
@@ -73,8 +107,29 @@ void Resolver::getaddrinfo_cb_(uv_getaddrinfo_t* req_handle,
 
     uv_freeaddrinfo(addrinfo);
 
+    self.remove_inflight_(req);
+
     self.finish_resolving_(req, status);
-    self.req_handler_.handle_resolved(req);
+
+    if (req.success) {
+        self.update_cache_(req);
+    }
+
+    // Handler may destroy request, so we fill waiters before reporting
+    // any of them.
+    for (ResolverRequest* waiter = req.next_waiter; waiter;
+         waiter = waiter->next_waiter) {
+        waiter->resolved_address = req.resolved_address;
+        waiter->success = req.success;
+    }
+
+    ResolverRequest* waiter = &req;
+
+    while (waiter) {
+        ResolverRequest* next_waiter = waiter->next_waiter;
+        self.req_handler_.handle_resolved(*waiter);
+        waiter = next_waiter;
+    }
 }
 
 void Resolver::finish_resolving_(ResolverRequest& req, int status) {
@@ -95,5 +150,85 @@ void Resolver::finish_resolving_(ResolverRequest& req, int status) {
     req.success = true;
 }
 
+bool Resolver::lookup_cache_(ResolverRequest& req) {
+    const core::nanoseconds_t now = core::timestamp(core::ClockMonotonic);
+
+    for (size_t n = 0; n < MaxCacheEntries; n++) {
+        CacheEntry& entry = cache_[n];
+
+        if (entry.expiration <= now) {
+            continue;
+        }
+        if (strcmp(entry.host, req.endpoint_uri->host()) != 0
+            || strcmp(entry.service, req.endpoint_uri->service()) != 0) {
+            continue;
+        }
+
+        roc_log(LogTrace, "resolver: found cached address: endpoint=%s address=%s",
+                address::endpoint_uri_to_str(*req.endpoint_uri).c_str(),
+                address::socket_addr_to_str(entry.address).c_str());
+
+        req.resolved_address = entry.address;
+        return true;
+    }
+
+    return false;
+}
+
+void Resolver::update_cache_(const ResolverRequest& req) {
+    const char* host = req.endpoint_uri->host();
+    const char* service = req.endpoint_uri->service();
+
+    if (strlen(host) > MaxHostLen || strlen(service) > MaxServiceLen) {
+        return;
+    }
+
+    // Reuse entry with same hostname, or expired entry, or the one that
+    // expires first.
+    CacheEntry* victim = &cache_[0];
+
+    for (size_t n = 0; n < MaxCacheEntries; n++) {
+        CacheEntry& entry = cache_[n];
+
+        if (strcmp(entry.host, host) == 0 && strcmp(entry.service, service) == 0) {
+            victim = &entry;
+            break;
+        }
+        if (entry.expiration < victim->expiration) {
+            victim = &entry;
+        }
+    }
+
+    strcpy(victim->host, host);
+    strcpy(victim->service, service);
+    victim->address = req.resolved_address;
+    victim->expiration = core::timestamp(core::ClockMonotonic) + CacheTtl;
+}
+
+ResolverRequest* Resolver::find_inflight_(const ResolverRequest& req) {
+    for (ResolverRequest* leader = inflight_; leader; leader = leader->next_inflight) {
+        if (same_endpoint(*leader, req)) {
+            return leader;
+        }
+    }
+
+    return NULL;
+}
+
+void Resolver::remove_inflight_(ResolverRequest& req) {
+    ResolverRequest** link = &inflight_;
+
+    while (*link) {
+        if (*link == &req) {
+            *link = req.next_inflight;
+            req.next_inflight = NULL;
+            return;
+        }
+        link = &(*link)->next_inflight;
+    }
+
+    roc_panic("resolver: request is not in in-flight list");
+}
+
 } // namespace netio
 } // namespace roc
@@ -15,6 +15,7 @@
 #include <uv.h>
 
 #include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
 #include "roc_netio/iresolver_request_handler.h"
 #include "roc_netio/resolver_request.h"
 
@@ -22,6 +23,13 @@ namespace roc {
 namespace netio {
 
 //! Hostname resolver.
+//!
+//! Successfully resolved addresses are cached for a while, so that opening
+//! many endpoints with the same hostname doesn't call getaddrinfo() for each
+//! of them. If a request for the same hostname is already in progress, new
+//! request waits for its completion instead of starting a new one.
+//!
+//! Resolver is not thread-safe and should be used only from event loop thread.
 class Resolver : public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -35,18 +43,52 @@ public:
     //! When resolving is finished, IRequestHandler::handle_resolved() will be
     //! called on the event loop thread.
     //!
-    //! If there is no need for resolving or asynchronous request can't be started,
-    //! fills @p req and returns false.
+    //! If there is no need for resolving, address was found in cache, or
+    //! asynchronous request can't be started, fills @p req and returns false.
     bool async_resolve(ResolverRequest& req);
 
 private:
+    enum {
+        // Maximum number of cached hostnames.
+        MaxCacheEntries = 32,
+
+        // Maximum length of cached hostname; DNS names are at most 253 bytes.
+        MaxHostLen = 255,
+
+        // Maximum length of service (port number).
+        MaxServiceLen = 7
+    };
+
+    struct CacheEntry {
+        char host[MaxHostLen + 1];
+        char service[MaxServiceLen + 1];
+        address::SocketAddr address;
+        core::nanoseconds_t expiration;
+
+        CacheEntry()
+            : expiration(0) {
+            host[0] = '\0';
+            service[0] = '\0';
+        }
+    };
+
     static void getaddrinfo_cb_(uv_getaddrinfo_t* req, int status, struct addrinfo* res);
 
     void finish_resolving_(ResolverRequest& req, int status);
 
+    bool lookup_cache_(ResolverRequest& req);
+    void update_cache_(const ResolverRequest& req);
+
+    ResolverRequest* find_inflight_(const ResolverRequest& req);
+    void remove_inflight_(ResolverRequest& req);
+
     uv_loop_t& loop_;
 
     IResolverRequestHandler& req_handler_;
+
+    CacheEntry cache_[MaxCacheEntries];
+
+    ResolverRequest* inflight_;
 };
 
 } // namespace netio
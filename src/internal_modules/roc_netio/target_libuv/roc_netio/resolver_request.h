@@ -34,9 +34,17 @@ struct ResolverRequest {
     //! libuv request handle.
     uv_getaddrinfo_t handle;
 
+    //! Next in-flight request in resolver (used by resolver).
+    ResolverRequest* next_inflight;
+
+    //! Next request waiting for the same hostname (used by resolver).
+    ResolverRequest* next_waiter;
+
     ResolverRequest()
         : endpoint_uri(NULL)
-        , success(false) {
+        , success(false)
+        , next_inflight(NULL)
+        , next_waiter(NULL) {
         memset(&handle, 0, sizeof(handle));
     }
 };
@@ -301,35 +301,32 @@ ssize_t TcpConnectionPort::try_write(const void* buf, size_t len) {
 
     roc_panic_if_not(buf);
 
-    const ConnectionState conn_state = get_state_();
-
-    check_usable_for_io_(conn_state);
-
-    if (conn_state != State_Established) {
-        return IOErr_Failure;
-    }
+    SocketBuffer buffer;
+    buffer.buf = buf;
+    buffer.bufsz = len;
 
-    writable_status_ = Io_InProgress;
+    return write_(&buffer, 1);
+}
 
-    const ssize_t ret = socket_try_send(socket_, buf, len);
+ssize_t TcpConnectionPort::try_write_vec(const core::Slice<uint8_t>* bufs,
+                                         size_t n_bufs) {
+    core::ScopedLock<core::Mutex> lock(io_mutex_);
 
-    writable_status_.compare_exchange(Io_InProgress,
-                                      ret >= 0 ? Io_Available : Io_NotAvailable);
+    roc_panic_if_not(bufs);
 
-    if (ret < 0 && ret != IOErr_WouldBlock) {
-        maybe_switch_state_(State_Established, State_Broken);
+    // remaining slices are written by subsequent calls, since write may be
+    // partial anyway
+    if (n_bufs > MaxWriteSlices) {
+        n_bufs = MaxWriteSlices;
     }
 
-    io_stats_.wr_calls++;
-    if (ret > 0) {
-        io_stats_.wr_bytes += (size_t)ret;
-    } else if (ret == IOErr_WouldBlock) {
-        io_stats_.wr_wouldblock++;
+    SocketBuffer buffers[MaxWriteSlices];
+    for (size_t n = 0; n < n_bufs; n++) {
+        buffers[n].buf = bufs[n] ? bufs[n].data() : NULL;
+        buffers[n].bufsz = bufs[n].size();
     }
 
-    report_io_stats_();
-
-    return ret;
+    return write_(buffers, n_bufs);
 }
 
 ssize_t TcpConnectionPort::try_read(void* buf, size_t len) {
@@ -337,42 +334,22 @@ ssize_t TcpConnectionPort::try_read(void* buf, size_t len) {
 
     roc_panic_if_not(buf);
 
-    const ConnectionState conn_state = get_state_();
-
-    check_usable_for_io_(conn_state);
-
-    if (conn_state != State_Established) {
-        return IOErr_Failure;
-    }
-
-    if (got_stream_end_) {
-        return IOErr_StreamEnd;
-    }
+    return read_(buf, len);
+}
 
-    readable_status_ = Io_InProgress;
+ssize_t TcpConnectionPort::try_read_slice(core::Slice<uint8_t>& buf) {
+    core::ScopedLock<core::Mutex> lock(io_mutex_);
 
-    const ssize_t ret = socket_try_recv(socket_, buf, len);
+    roc_panic_if_not(buf);
 
-    readable_status_.compare_exchange(Io_InProgress,
-                                      ret >= 0 ? Io_Available : Io_NotAvailable);
+    const size_t pos = buf.size();
 
-    if (ret < 0 && ret != IOErr_WouldBlock) {
-        if (ret == IOErr_StreamEnd) {
-            got_stream_end_ = true;
-        } else {
-            maybe_switch_state_(State_Established, State_Broken);
-        }
-    }
+    const ssize_t ret = read_(buf.data() + pos, buf.capacity() - pos);
 
-    io_stats_.rd_calls++;
     if (ret > 0) {
-        io_stats_.rd_bytes += (size_t)ret;
-    } else if (ret == IOErr_WouldBlock) {
-        io_stats_.rd_wouldblock++;
+        buf.reslice(0, pos + (size_t)ret);
     }
 
-    report_io_stats_();
-
     return ret;
 }
 
@@ -783,6 +760,78 @@ void TcpConnectionPort::check_usable_for_io_(ConnectionState conn_state) const {
     }
 }
 
+ssize_t TcpConnectionPort::write_(const SocketBuffer* buffers, size_t n_buffers) {
+    const ConnectionState conn_state = get_state_();
+
+    check_usable_for_io_(conn_state);
+
+    if (conn_state != State_Established) {
+        return IOErr_Failure;
+    }
+
+    writable_status_ = Io_InProgress;
+
+    const ssize_t ret = socket_try_send_vec(socket_, buffers, n_buffers);
+
+    writable_status_.compare_exchange(Io_InProgress,
+                                      ret >= 0 ? Io_Available : Io_NotAvailable);
+
+    if (ret < 0 && ret != IOErr_WouldBlock) {
+        maybe_switch_state_(State_Established, State_Broken);
+    }
+
+    io_stats_.wr_calls++;
+    if (ret > 0) {
+        io_stats_.wr_bytes += (size_t)ret;
+    } else if (ret == IOErr_WouldBlock) {
+        io_stats_.wr_wouldblock++;
+    }
+
+    report_io_stats_();
+
+    return ret;
+}
+
+ssize_t TcpConnectionPort::read_(void* buf, size_t len) {
+    const ConnectionState conn_state = get_state_();
+
+    check_usable_for_io_(conn_state);
+
+    if (conn_state != State_Established) {
+        return IOErr_Failure;
+    }
+
+    if (got_stream_end_) {
+        return IOErr_StreamEnd;
+    }
+
+    readable_status_ = Io_InProgress;
+
+    const ssize_t ret = socket_try_recv(socket_, buf, len);
+
+    readable_status_.compare_exchange(Io_InProgress,
+                                      ret >= 0 ? Io_Available : Io_NotAvailable);
+
+    if (ret < 0 && ret != IOErr_WouldBlock) {
+        if (ret == IOErr_StreamEnd) {
+            got_stream_end_ = true;
+        } else {
+            maybe_switch_state_(State_Established, State_Broken);
+        }
+    }
+
+    io_stats_.rd_calls++;
+    if (ret > 0) {
+        io_stats_.rd_bytes += (size_t)ret;
+    } else if (ret == IOErr_WouldBlock) {
+        io_stats_.rd_wouldblock++;
+    }
+
+    report_io_stats_();
+
+    return ret;
+}
+
 void TcpConnectionPort::report_io_stats_() {
     if (!report_limiter_.allow()) {
         return;
@@ -191,11 +191,21 @@ public:
     //!  Can be called from any thread.
     virtual ssize_t try_write(const void* buf, size_t len);
 
+    //! Write @p n_bufs slices to the connection.
+    //! @remarks
+    //!  Can be called from any thread.
+    virtual ssize_t try_write_vec(const core::Slice<uint8_t>* bufs, size_t n_bufs);
+
     //! Read @p len bytes from the the connection to @p buf.
     //! @remarks
     //!  Can be called from any thread.
     virtual ssize_t try_read(void* buf, size_t len);
 
+    //! Read bytes from the connection to the end of @p buf.
+    //! @remarks
+    //!  Can be called from any thread.
+    virtual ssize_t try_read_slice(core::Slice<uint8_t>& buf);
+
     //! Initiate asynchronous graceful shutdown.
     //! @remarks
     //!  Can be called from any thread.
@@ -251,13 +261,18 @@ private:
         Io_InProgress
     };
 
+    enum {
+        // Maximum number of slices written by single try_write_vec() call.
+        MaxWriteSlices = 16
+    };
+
     // I/O statistics.
     struct IoStats {
         // number of IConnHandler events
         core::Seqlock<uint64_t> rd_events;
         core::Seqlock<uint64_t> wr_events;
 
-        // number of try_read() and try_write() calls
+        // number of read and write calls
         uint64_t rd_calls;
         uint64_t wr_calls;
 
@@ -310,6 +325,9 @@ private:
     void check_usable_(ConnectionState conn_state) const;
     void check_usable_for_io_(ConnectionState conn_state) const;
 
+    ssize_t write_(const SocketBuffer* buffers, size_t n_buffers);
+    ssize_t read_(void* buf, size_t len);
+
     void report_io_stats_();
 
     uv_loop_t& loop_;
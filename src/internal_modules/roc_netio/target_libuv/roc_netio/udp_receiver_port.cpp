@@ -11,11 +11,29 @@
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/shared_ptr.h"
+#include "roc_core/stddefs.h"
 #include "roc_core/string_builder.h"
+#include "roc_core/time.h"
+#include "roc_core/tracepoint.h"
+#include "roc_netio/socket_ops.h"
 
 namespace roc {
 namespace netio {
 
+namespace {
+
+// Maximum datagram size expected by libuv in recvmmsg() mode,
+// received buffer is split into chunks of this size.
+const size_t MmsgChunkSize = 64 * 1024;
+
+// Number of datagrams received by one recvmmsg() call.
+const size_t MmsgNumChunks = 16;
+
+// How often to report receiver statistics.
+const core::nanoseconds_t StatsReportInterval = 20 * core::Second;
+
+} // namespace
+
 UdpReceiverPort::UdpReceiverPort(const UdpReceiverConfig& config,
                                  packet::IWriter& writer,
                                  uv_loop_t& event_loop,
@@ -29,17 +47,22 @@ UdpReceiverPort::UdpReceiverPort(const UdpReceiverConfig& config,
     , close_handler_arg_(NULL)
     , loop_(event_loop)
     , handle_initialized_(false)
+    , flush_handle_initialized_(false)
+    , mmsg_buf_(allocator)
     , multicast_group_joined_(false)
     , recv_started_(false)
     , closed_(false)
     , packet_factory_(packet_factory)
     , buffer_factory_(buffer_factory)
-    , packet_counter_(0) {
+    , packet_counter_(0)
+    , fd_(-1)
+    , kernel_drops_(0)
+    , rate_limiter_(StatsReportInterval) {
     BasicPort::update_descriptor();
 }
 
 UdpReceiverPort::~UdpReceiverPort() {
-    if (handle_initialized_) {
+    if (handle_initialized_ || flush_handle_initialized_) {
         roc_panic(
             "udp receiver: %s: receiver was not fully closed before calling destructor",
             descriptor());
@@ -51,15 +74,34 @@ const address::SocketAddr& UdpReceiverPort::bind_address() const {
 }
 
 bool UdpReceiverPort::open() {
-    if (int err = uv_udp_init(&loop_, &handle_)) {
-        roc_log(LogError, "udp receiver: %s: uv_udp_init(): [%s] %s", descriptor(),
-                uv_err_name(err), uv_strerror(err));
+    if (!init_handle_()) {
         return false;
     }
 
     handle_.data = this;
     handle_initialized_ = true;
 
+    if (int err = uv_check_init(&loop_, &flush_handle_)) {
+        roc_log(LogError, "udp receiver: %s: uv_check_init(): [%s] %s", descriptor(),
+                uv_err_name(err), uv_strerror(err));
+        return false;
+    }
+
+    flush_handle_.data = this;
+    flush_handle_initialized_ = true;
+
+    // check handles are invoked after polling for I/O on every loop iteration,
+    // so this flushes packets received during the iteration
+    if (int err = uv_check_start(&flush_handle_, flush_cb_)) {
+        roc_log(LogError, "udp receiver: %s: uv_check_start(): [%s] %s", descriptor(),
+                uv_err_name(err), uv_strerror(err));
+        return false;
+    }
+
+    if (!setup_socket_()) {
+        return false;
+    }
+
     unsigned flags = 0;
     if ((config_.reuseaddr || config_.bind_address.multicast())
         && config_.bind_address.port() > 0) {
@@ -97,6 +139,10 @@ bool UdpReceiverPort::open() {
         return false;
     }
 
+    if (!tune_socket_()) {
+        return false;
+    }
+
     if (config_.multicast_interface[0]) {
         if (!join_multicast_group_()) {
             return false;
@@ -126,7 +172,7 @@ AsyncOperationStatus UdpReceiverPort::async_close(ICloseHandler& handler,
     close_handler_ = &handler;
     close_handler_arg_ = handler_arg;
 
-    if (!handle_initialized_) {
+    if (!handle_initialized_ && !flush_handle_initialized_) {
         return AsyncOp_Completed;
     }
 
@@ -148,10 +194,14 @@ AsyncOperationStatus UdpReceiverPort::async_close(ICloseHandler& handler,
         leave_multicast_group_();
     }
 
-    if (!uv_is_closing((uv_handle_t*)&handle_)) {
+    if (handle_initialized_ && !uv_is_closing((uv_handle_t*)&handle_)) {
         uv_close((uv_handle_t*)&handle_, close_cb_);
     }
 
+    if (flush_handle_initialized_ && !uv_is_closing((uv_handle_t*)&flush_handle_)) {
+        uv_close((uv_handle_t*)&flush_handle_, close_cb_);
+    }
+
     return AsyncOp_Started;
 }
 
@@ -160,7 +210,15 @@ void UdpReceiverPort::close_cb_(uv_handle_t* handle) {
 
     UdpReceiverPort& self = *(UdpReceiverPort*)handle->data;
 
-    self.handle_initialized_ = false;
+    if (handle == (uv_handle_t*)&self.handle_) {
+        self.handle_initialized_ = false;
+    } else {
+        self.flush_handle_initialized_ = false;
+    }
+
+    if (self.handle_initialized_ || self.flush_handle_initialized_) {
+        return;
+    }
 
     roc_log(LogDebug, "udp receiver: %s: closed port", self.descriptor());
 
@@ -176,6 +234,39 @@ void UdpReceiverPort::alloc_cb_(uv_handle_t* handle, size_t size, uv_buf_t* buf)
 
     UdpReceiverPort& self = *(UdpReceiverPort*)handle->data;
 
+    if (self.mmsg_buf_.size() != 0) {
+        // the whole buffer is reused by every recvmmsg() call
+        buf->base = (char*)self.mmsg_buf_.data();
+        buf->len = self.mmsg_buf_.size();
+        return;
+    }
+
+    if (self.packet_factory_.inline_buffer_size() != 0) {
+        packet::PacketPtr pp = self.packet_factory_.new_packet_with_buffer();
+        if (!pp) {
+            roc_log(LogError, "udp receiver: %s: can't allocate packet",
+                    self.descriptor());
+
+            buf->base = NULL;
+            buf->len = 0;
+
+            return;
+        }
+
+        core::Slice<uint8_t> bp = pp->inline_buffer();
+
+        if (size > bp.size()) {
+            size = bp.size();
+        }
+
+        pp->incref(); // will be decremented in recv_cb_()
+
+        buf->base = (char*)bp.data();
+        buf->len = size;
+
+        return;
+    }
+
     core::SharedPtr<core::Buffer<uint8_t> > bp = self.buffer_factory_.new_buffer();
     if (!bp) {
         roc_log(LogError, "udp receiver: %s: can't allocate buffer", self.descriptor());
@@ -218,15 +309,34 @@ void UdpReceiverPort::recv_cb_(uv_udp_t* handle,
         }
     }
 
-    core::SharedPtr<core::Buffer<uint8_t> > bp =
-        core::Buffer<uint8_t>::container_of(buf->base);
+    const bool mmsg_mode = self.mmsg_buf_.size() != 0;
+
+    const bool inline_mode = self.packet_factory_.inline_buffer_size() != 0;
 
-    // one reference for incref() called from alloc_cb_()
-    // one reference for the shared pointer above
-    roc_panic_if(bp->getref() != 2);
+    core::SharedPtr<core::Buffer<uint8_t> > bp;
+    packet::PacketPtr pp;
+
+    if (!mmsg_mode) {
+        bp = core::Buffer<uint8_t>::container_of(buf->base);
+
+        if (inline_mode) {
+            pp = &self.packet_factory_.inline_buffer_owner(*bp);
+
+            // one reference for incref() called from alloc_cb_()
+            // one reference for the shared pointer above
+            roc_panic_if(pp->getref() != 2);
+
+            // decrement reference counter incremented in alloc_cb_()
+            pp->decref();
+        } else {
+            // one reference for incref() called from alloc_cb_()
+            // one reference for the shared pointer above
+            roc_panic_if(bp->getref() != 2);
 
-    // decrement reference counter incremented in alloc_cb_()
-    bp->decref();
+            // decrement reference counter incremented in alloc_cb_()
+            bp->decref();
+        }
+    }
 
     if (nread < 0) {
         roc_log(
@@ -240,11 +350,11 @@ void UdpReceiverPort::recv_cb_(uv_udp_t* handle,
     if (nread == 0) {
         if (!sockaddr) {
             // no more data for now
+            self.flush_batch_();
         } else {
-            roc_log(LogTrace, "udp receiver: %s: empty packet: num=%u src=%s dst=%s",
+            roc_log(LogTrace, "udp receiver: %s: empty packet: num=%u src=%s",
                     self.descriptor(), self.packet_counter_,
-                    address::socket_addr_to_str(src_addr).c_str(),
-                    address::socket_addr_to_str(self.config_.bind_address).c_str());
+                    address::socket_addr_to_str(src_addr).c_str());
         }
         return;
     }
@@ -265,31 +375,245 @@ void UdpReceiverPort::recv_cb_(uv_udp_t* handle,
     }
 
     self.packet_counter_++;
+    self.report_stats_();
 
-    roc_log(LogTrace, "udp receiver: %s: received packet: num=%u src=%s dst=%s nread=%ld",
+    // bind address is part of descriptor, which is formatted only once
+    roc_log(LogTrace, "udp receiver: %s: received packet: num=%u src=%s nread=%ld",
             self.descriptor(), self.packet_counter_,
-            address::socket_addr_to_str(src_addr).c_str(),
-            address::socket_addr_to_str(self.config_.bind_address).c_str(), (long)nread);
+            address::socket_addr_to_str(src_addr).c_str(), (long)nread);
 
-    if ((size_t)nread > bp->size()) {
-        roc_panic("udp receiver: %s: unexpected buffer size: got %ld, max %ld",
-                  self.descriptor(), (long)nread, (long)bp->size());
-    }
+    if (mmsg_mode) {
+        if (!(pp = self.copy_datagram_((const uint8_t*)buf->base, (size_t)nread))) {
+            return;
+        }
+    } else {
+        if ((size_t)nread > bp->size()) {
+            roc_panic("udp receiver: %s: unexpected buffer size: got %ld, max %ld",
+                      self.descriptor(), (long)nread, (long)bp->size());
+        }
 
-    packet::PacketPtr pp = self.packet_factory_.new_packet();
-    if (!pp) {
-        roc_log(LogError, "udp receiver: %s: can't allocate packet", self.descriptor());
-        return;
+        if (!pp) {
+            if (!(pp = self.packet_factory_.new_packet())) {
+                roc_log(LogError, "udp receiver: %s: can't allocate packet",
+                        self.descriptor());
+                return;
+            }
+        }
+
+        pp->set_data(core::Slice<uint8_t>(*bp, 0, (size_t)nread));
     }
 
     pp->add_flags(packet::Packet::FlagUDP);
 
     pp->udp()->src_addr = src_addr;
     pp->udp()->dst_addr = self.config_.bind_address;
+    // libuv doesn't pass SO_TIMESTAMPNS control messages to callback,
+    // so the best we can do is to read the clock as soon as we get it
+    pp->udp()->receive_timestamp = core::timestamp(core::ClockUnix);
+
+    roc_tracepoint(udp_receive, (const void*)&self, (const void*)pp.get(),
+                   (long)nread, pp->udp()->receive_timestamp);
+
+    if (self.config_.capture_writer) {
+        self.config_.capture_writer->write(*pp, self.config_.capture_stream);
+    }
+
+    self.batch_.push_back(*pp);
+}
+
+void UdpReceiverPort::flush_cb_(uv_check_t* handle) {
+    roc_panic_if_not(handle);
+
+    UdpReceiverPort& self = *(UdpReceiverPort*)handle->data;
+
+    self.flush_batch_();
+}
+
+void UdpReceiverPort::flush_batch_() {
+    if (batch_.size() == 0) {
+        return;
+    }
+
+    roc_log(LogTrace, "udp receiver: %s: flushing packets: n_packets=%lu", descriptor(),
+            (unsigned long)batch_.size());
+
+    writer_.write_batch(batch_);
+}
+
+bool UdpReceiverPort::init_handle_() {
+    // By default, socket is created lazily during bind. If we need to set socket
+    // options before bind, we ask libuv to create socket immediately.
+    unsigned int domain = AF_UNSPEC;
+    if (config_.reuseport || config_.incoming_cpu >= 0) {
+        domain =
+            config_.bind_address.family() == address::Family_IPv6 ? AF_INET6 : AF_INET;
+    }
+
+    if (config_.enable_recvmmsg) {
+#if UV_VERSION_HEX >= 0x012800
+        if (!mmsg_buf_.resize(MmsgChunkSize * MmsgNumChunks)) {
+            roc_log(LogError, "udp receiver: %s: can't allocate recvmmsg buffer",
+                    descriptor());
+            return false;
+        }
+
+        if (int err = uv_udp_init_ex(&loop_, &handle_, domain | UV_UDP_RECVMMSG)) {
+            roc_log(LogError, "udp receiver: %s: uv_udp_init_ex(): [%s] %s",
+                    descriptor(), uv_err_name(err), uv_strerror(err));
+            return false;
+        }
+
+        roc_log(LogDebug, "udp receiver: %s: using recvmmsg: n_chunks=%lu",
+                descriptor(), (unsigned long)MmsgNumChunks);
+
+        return true;
+#else
+        roc_log(LogDebug,
+                "udp receiver: %s: recvmmsg not supported by libuv version,"
+                " using regular receive",
+                descriptor());
+#endif
+    }
+
+    if (domain != AF_UNSPEC) {
+        if (int err = uv_udp_init_ex(&loop_, &handle_, domain)) {
+            roc_log(LogError, "udp receiver: %s: uv_udp_init_ex(): [%s] %s",
+                    descriptor(), uv_err_name(err), uv_strerror(err));
+            return false;
+        }
+
+        return true;
+    }
+
+    if (int err = uv_udp_init(&loop_, &handle_)) {
+        roc_log(LogError, "udp receiver: %s: uv_udp_init(): [%s] %s", descriptor(),
+                uv_err_name(err), uv_strerror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool UdpReceiverPort::setup_socket_() {
+    if (!config_.reuseport && config_.incoming_cpu < 0) {
+        return true;
+    }
+
+    uv_os_fd_t fd;
+    if (int err = uv_fileno((uv_handle_t*)&handle_, &fd)) {
+        roc_log(LogError, "udp receiver: %s: uv_fileno(): [%s] %s", descriptor(),
+                uv_err_name(err), uv_strerror(err));
+        return false;
+    }
+
+    if (config_.reuseport) {
+        if (!socket_set_reuseport(fd)) {
+            roc_log(LogError, "udp receiver: %s: can't enable SO_REUSEPORT",
+                    descriptor());
+            return false;
+        }
+    }
+
+    if (config_.incoming_cpu >= 0) {
+        // not fatal, only affects which receiver gets datagrams
+        if (!socket_set_incoming_cpu(fd, config_.incoming_cpu)) {
+            roc_log(LogDebug, "udp receiver: %s: can't set SO_INCOMING_CPU",
+                    descriptor());
+        }
+    }
+
+    return true;
+}
+
+bool UdpReceiverPort::tune_socket_() {
+    if (int err = uv_fileno((uv_handle_t*)&handle_, &fd_)) {
+        roc_log(LogError, "udp receiver: %s: uv_fileno(): [%s] %s", descriptor(),
+                uv_err_name(err), uv_strerror(err));
+        return false;
+    }
+
+    if (config_.recv_buffer_size > (size_t)INT_MAX) {
+        roc_log(LogError, "udp receiver: %s: invalid buffer size: got=%lu max=%lu",
+                descriptor(), (unsigned long)config_.recv_buffer_size,
+                (unsigned long)INT_MAX);
+        return false;
+    }
+
+    if (config_.recv_buffer_size != 0) {
+        if (!socket_set_recv_buffer_size(fd_, config_.recv_buffer_size)) {
+            roc_log(LogError, "udp receiver: %s: can't set SO_RCVBUF to %lu",
+                    descriptor(), (unsigned long)config_.recv_buffer_size);
+            return false;
+        }
+    }
+
+    if (config_.busy_poll_us > 0) {
+        // not fatal, only affects latency
+        if (!socket_set_busy_poll(fd_, config_.busy_poll_us)) {
+            roc_log(LogDebug, "udp receiver: %s: can't set SO_BUSY_POLL", descriptor());
+        }
+    }
+
+    return true;
+}
+
+void UdpReceiverPort::report_stats_() {
+    if (fd_ < 0 || !rate_limiter_.allow()) {
+        return;
+    }
+
+    size_t kernel_drops = 0;
+    if (!socket_get_drops(fd_, kernel_drops)) {
+        return;
+    }
+
+    if (kernel_drops != kernel_drops_) {
+        roc_log(LogInfo,
+                "udp receiver: %s: kernel dropped datagrams, consider increasing"
+                " receive buffer size: new_drops=%lu total_drops=%lu",
+                descriptor(), (unsigned long)(kernel_drops - kernel_drops_),
+                (unsigned long)kernel_drops);
+        kernel_drops_ = kernel_drops;
+    }
+
+    roc_log(LogDebug, "udp receiver: %s: total=%u kernel_drops=%lu", descriptor(),
+            packet_counter_, (unsigned long)kernel_drops_);
+}
+
+packet::PacketPtr UdpReceiverPort::copy_datagram_(const uint8_t* data, size_t size) {
+    packet::PacketPtr pp;
+    core::Slice<uint8_t> bp;
+
+    if (packet_factory_.inline_buffer_size() != 0) {
+        if (!(pp = packet_factory_.new_packet_with_buffer())) {
+            roc_log(LogError, "udp receiver: %s: can't allocate packet", descriptor());
+            return NULL;
+        }
+        bp = pp->inline_buffer();
+    } else {
+        if (!(bp = buffer_factory_.new_buffer())) {
+            roc_log(LogError, "udp receiver: %s: can't allocate buffer", descriptor());
+            return NULL;
+        }
+        if (!(pp = packet_factory_.new_packet())) {
+            roc_log(LogError, "udp receiver: %s: can't allocate packet", descriptor());
+            return NULL;
+        }
+    }
+
+    if (size > bp.capacity()) {
+        roc_log(LogDebug,
+                "udp receiver: %s: dropping too large datagram: size=%lu max=%lu",
+                descriptor(), (unsigned long)size, (unsigned long)bp.capacity());
+        return NULL;
+    }
+
+    bp.reslice(0, size);
+    memcpy(bp.data(), data, size);
 
-    pp->set_data(core::Slice<uint8_t>(*bp, 0, (size_t)nread));
+    pp->set_data(bp);
 
-    self.writer_.write(pp);
+    return pp;
 }
 
 bool UdpReceiverPort::join_multicast_group_() {
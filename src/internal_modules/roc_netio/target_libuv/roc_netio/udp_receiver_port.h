@@ -15,12 +15,16 @@
 #include <uv.h>
 
 #include "roc_address/socket_addr.h"
+#include "roc_core/array.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
 #include "roc_core/list_node.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/shared_ptr.h"
 #include "roc_netio/basic_port.h"
 #include "roc_netio/iclose_handler.h"
+#include "roc_packet/capture_writer.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet_factory.h"
 
@@ -43,13 +47,55 @@ struct UdpReceiverConfig {
     //! binding to non-ephemeral port.
     bool reuseaddr;
 
+    //! If set, enable SO_REUSEPORT, so that multiple receivers, usually served
+    //! by different network loops, may bind to the same address and port.
+    //! Kernel distributes incoming datagrams between them.
+    bool reuseport;
+
+    //! If non-negative, set SO_INCOMING_CPU to this CPU.
+    //! When used with reuseport, kernel prefers this receiver for datagrams
+    //! processed on given CPU. Usually it's the CPU of the network loop thread.
+    int incoming_cpu;
+
+    //! If set, receive multiple datagrams per system call using recvmmsg().
+    //! Requires libuv 1.40 or later and is effective only on platforms where
+    //! libuv supports it (Linux and FreeBSD). Otherwise, ignored.
+    bool enable_recvmmsg;
+
+    //! If non-zero, set SO_RCVBUF to this size in bytes.
+    //! Larger buffer allows to survive bursts when the network loop is
+    //! temporarily late. If zero, kernel default is used.
+    size_t recv_buffer_size;
+
+    //! If positive, set SO_BUSY_POLL to this number of microseconds.
+    //! Kernel will busy-poll device queue when socket is empty, trading
+    //! CPU time for latency. Ignored where not supported.
+    int busy_poll_us;
+
+    //! If set, every received datagram is also written to this capture.
+    //! Used to record traffic for later replay with packet::CaptureReader.
+    packet::CaptureWriter* capture_writer;
+
+    //! Stream identifier passed to capture writer with every datagram.
+    unsigned capture_stream;
+
     UdpReceiverConfig()
-        : reuseaddr(false) {
+        : reuseaddr(false)
+        , reuseport(false)
+        , incoming_cpu(-1)
+        , enable_recvmmsg(false)
+        , recv_buffer_size(0)
+        , busy_poll_us(0)
+        , capture_writer(NULL)
+        , capture_stream(0) {
         multicast_interface[0] = '\0';
     }
 };
 
 //! UDP receiver.
+//! @remarks
+//!  Packets received during one event loop iteration are accumulated and
+//!  passed to the writer in a single write_batch() call.
 class UdpReceiverPort : public BasicPort {
 public:
     //! Initialize.
@@ -84,6 +130,15 @@ private:
                          const uv_buf_t* buf,
                          const sockaddr* addr,
                          unsigned flags);
+    static void flush_cb_(uv_check_t* handle);
+
+    void flush_batch_();
+
+    bool init_handle_();
+    bool setup_socket_();
+    bool tune_socket_();
+    void report_stats_();
+    packet::PacketPtr copy_datagram_(const uint8_t* data, size_t size);
 
     bool join_multicast_group_();
     void leave_multicast_group_();
@@ -99,6 +154,15 @@ private:
     uv_udp_t handle_;
     bool handle_initialized_;
 
+    uv_check_t flush_handle_;
+    bool flush_handle_initialized_;
+
+    core::List<packet::Packet> batch_;
+
+    // if non-empty, recvmmsg() mode is used and datagrams are received into
+    // this buffer and then copied into buffers from buffer_factory_
+    core::Array<uint8_t> mmsg_buf_;
+
     bool multicast_group_joined_;
     bool recv_started_;
     bool closed_;
@@ -107,6 +171,10 @@ private:
     core::BufferFactory<uint8_t>& buffer_factory_;
 
     unsigned packet_counter_;
+
+    uv_os_fd_t fd_;
+    size_t kernel_drops_;
+    core::RateLimiter rate_limiter_;
 };
 
 } // namespace netio
@@ -11,6 +11,8 @@
 #include "roc_core/log.h"
 #include "roc_core/macro_helpers.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/tracepoint.h"
 #include "roc_netio/socket_ops.h"
 
 namespace roc {
@@ -20,6 +22,14 @@ namespace {
 
 const core::nanoseconds_t PacketLogInterval = 20 * core::Second;
 
+// Maximum number of packets sent by one sendmmsg() call.
+const size_t MaxBatchSize = 32;
+
+// Sizes of IP headers without options, and of UDP header.
+const size_t IPv4HeaderSize = 20;
+const size_t IPv6HeaderSize = 40;
+const size_t UdpHeaderSize = 8;
+
 } // namespace
 
 UdpSenderPort::UdpSenderPort(const UdpSenderConfig& config,
@@ -33,8 +43,13 @@ UdpSenderPort::UdpSenderPort(const UdpSenderConfig& config,
     , write_sem_initialized_(false)
     , handle_initialized_(false)
     , pending_packets_(0)
+    , wakeup_pending_(0)
     , sent_packets_(0)
     , sent_packets_blk_(0)
+    , sent_batches_(0)
+    , sent_packets_batched_(0)
+    , gso_enabled_(config.gso_enabled)
+    , connected_(false)
     , stopped_(true)
     , closed_(false)
     , fd_()
@@ -48,7 +63,7 @@ UdpSenderPort::~UdpSenderPort() {
                   descriptor());
     }
 
-    if (pending_packets_) {
+    if (*pending_packets_) {
         roc_panic("udp sender: %s: packets weren't fully sent before calling destructor",
                   descriptor());
     }
@@ -58,6 +73,27 @@ const address::SocketAddr& UdpSenderPort::bind_address() const {
     return config_.bind_address;
 }
 
+size_t UdpSenderPort::max_payload_size() const {
+    if (!connected_) {
+        return 0;
+    }
+
+    size_t mtu = 0;
+    if (!socket_get_path_mtu(fd_, config_.bind_address.family(), mtu)) {
+        return 0;
+    }
+
+    const size_t ip_header_size = config_.bind_address.family() == address::Family_IPv6
+        ? IPv6HeaderSize
+        : IPv4HeaderSize;
+
+    if (mtu <= ip_header_size + UdpHeaderSize) {
+        return 0;
+    }
+
+    return mtu - ip_header_size - UdpHeaderSize;
+}
+
 bool UdpSenderPort::open() {
     if (int err = uv_async_init(&loop_, &write_sem_, write_sem_cb_)) {
         roc_log(LogError, "udp sender: %s: uv_async_init(): [%s] %s", descriptor(),
@@ -124,6 +160,14 @@ bool UdpSenderPort::open() {
                   uv_err_name(fd_err), uv_strerror(fd_err));
     }
 
+    if (!tune_socket_()) {
+        return false;
+    }
+
+    if (!connect_socket_()) {
+        return false;
+    }
+
     stopped_ = false;
     update_descriptor();
 
@@ -147,7 +191,7 @@ AsyncOperationStatus UdpSenderPort::async_close(ICloseHandler& handler,
         return AsyncOp_Completed;
     }
 
-    if (pending_packets_ == 0) {
+    if (*pending_packets_ == 0) {
         start_closing_();
     }
 
@@ -155,6 +199,45 @@ AsyncOperationStatus UdpSenderPort::async_close(ICloseHandler& handler,
 }
 
 void UdpSenderPort::write(const packet::PacketPtr& pp) {
+    check_packet_(pp);
+
+    if (!check_destination_(pp)) {
+        return;
+    }
+
+    if (enqueue_(pp)) {
+        wakeup_();
+    }
+
+    report_stats_();
+}
+
+void UdpSenderPort::write_batch(core::List<packet::Packet>& packets) {
+    bool need_wakeup = false;
+
+    while (packet::PacketPtr pp = packets.front()) {
+        packets.remove(*pp);
+
+        check_packet_(pp);
+
+        if (!check_destination_(pp)) {
+            continue;
+        }
+
+        if (enqueue_(pp)) {
+            need_wakeup = true;
+        }
+    }
+
+    // one notification for the whole batch
+    if (need_wakeup) {
+        wakeup_();
+    }
+
+    report_stats_();
+}
+
+void UdpSenderPort::check_packet_(const packet::PacketPtr& pp) {
     if (!pp) {
         roc_panic("udp sender: %s: unexpected null packet", descriptor());
     }
@@ -170,23 +253,44 @@ void UdpSenderPort::write(const packet::PacketPtr& pp) {
     if (stopped_) {
         roc_panic("udp sender: %s: attempt to use stopped sender", descriptor());
     }
+}
 
-    write_(pp);
+bool UdpSenderPort::check_destination_(const packet::PacketPtr& pp) {
+    if (!connected_ || pp->udp()->dst_addr == config_.connect_address) {
+        return true;
+    }
 
-    report_stats_();
+    roc_log(LogError,
+            "udp sender: %s: dropping packet: destination differs from connected"
+            " address: dst=%s connected=%s",
+            descriptor(), address::socket_addr_to_str(pp->udp()->dst_addr).c_str(),
+            address::socket_addr_to_str(config_.connect_address).c_str());
+
+    return false;
 }
 
-void UdpSenderPort::write_(const packet::PacketPtr& pp) {
-    const bool had_pending = (++pending_packets_ > 1);
+bool UdpSenderPort::enqueue_(const packet::PacketPtr& pp) {
+    const bool had_pending = (++*pending_packets_ > 1);
 
     if (!had_pending) {
         if (try_nonblocking_send_(pp)) {
-            --pending_packets_;
-            return;
+            --*pending_packets_;
+            return false;
         }
     }
 
     queue_.push_back(*pp);
+    return true;
+}
+
+void UdpSenderPort::wakeup_() {
+    // If a wakeup is already pending, event loop has not started draining the
+    // queue yet, and will see our packets when it does. write_sem_cb_() clears
+    // the flag before draining, so a packet pushed after that will trigger
+    // a new wakeup.
+    if (!wakeup_pending_->compare_exchange(0, 1)) {
+        return;
+    }
 
     if (int err = uv_async_send(&write_sem_)) {
         roc_panic("udp sender: %s: uv_async_send(): [%s] %s", descriptor(),
@@ -222,39 +326,143 @@ void UdpSenderPort::write_sem_cb_(uv_async_t* handle) {
 
     UdpSenderPort& self = *(UdpSenderPort*)handle->data;
 
+    // Clear flag before draining the queue, see wakeup_().
+    *self.wakeup_pending_ = 0;
+
+    if (self.config_.batching_enabled) {
+        self.send_batches_();
+        return;
+    }
+
     // Using try_pop_front_exclusive() makes this method lock-free and wait-free.
     // try_pop_front_exclusive() may return NULL if the queue is not empty, but
     // push_back() is currently in progress. In this case we can exit the loop
-    // before processing all packets, but write() always calls uv_async_send()
-    // after push_back(), so we'll wake up soon and process the rest packets.
+    // before processing all packets, but writer always calls wakeup_() after
+    // push_back(), so we'll wake up soon and process the rest packets.
     while (packet::PacketPtr pp = self.queue_.try_pop_front_exclusive()) {
-        packet::UDP& udp = *pp->udp();
+        self.async_send_(pp);
+    }
+}
 
-        const int packet_num = ++self.sent_packets_;
-        ++self.sent_packets_blk_;
+void UdpSenderPort::async_send_(const packet::PacketPtr& pp) {
+    packet::UDP& udp = *pp->udp();
 
-        roc_log(LogTrace, "udp sender: %s: sending packet: num=%d src=%s dst=%s sz=%ld",
-                self.descriptor(), packet_num,
-                address::socket_addr_to_str(self.config_.bind_address).c_str(),
-                address::socket_addr_to_str(udp.dst_addr).c_str(),
-                (long)pp->data().size());
+    const int packet_num = ++sent_packets_;
+    ++sent_packets_blk_;
 
-        uv_buf_t buf;
-        buf.base = (char*)pp->data().data();
-        buf.len = pp->data().size();
+    // bind address is part of descriptor, which is formatted only once
+    roc_log(LogTrace, "udp sender: %s: sending packet: num=%d dst=%s sz=%ld",
+            descriptor(), packet_num, address::socket_addr_to_str(udp.dst_addr).c_str(),
+            (long)pp->data().size());
 
-        udp.request.data = &self;
+    uv_buf_t buf;
+    buf.base = (char*)pp->data().data();
+    buf.len = pp->data().size();
 
-        if (int err = uv_udp_send(&udp.request, &self.handle_, &buf, 1,
-                                  udp.dst_addr.saddr(), send_cb_)) {
-            roc_log(LogError, "udp sender: %s: uv_udp_send(): [%s] %s", self.descriptor(),
-                    uv_err_name(err), uv_strerror(err));
-            continue;
+    udp.request.data = this;
+
+    // connected socket uses default destination
+    const sockaddr* dst_addr = connected_ ? NULL : udp.dst_addr.saddr();
+
+    if (int err = uv_udp_send(&udp.request, &handle_, &buf, 1, dst_addr, send_cb_)) {
+        roc_log(LogError, "udp sender: %s: uv_udp_send(): [%s] %s", descriptor(),
+                uv_err_name(err), uv_strerror(err));
+        return;
+    }
+
+    // will be decremented in send_cb_()
+    pp->incref();
+}
+
+void UdpSenderPort::send_batches_() {
+    packet::PacketPtr packets[MaxBatchSize];
+
+    for (;;) {
+        // See comment in write_sem_cb_() regarding try_pop_front_exclusive().
+        size_t n_packets = 0;
+        while (n_packets < MaxBatchSize) {
+            if (!(packets[n_packets] = queue_.try_pop_front_exclusive())) {
+                break;
+            }
+            n_packets++;
+        }
+
+        if (n_packets == 0) {
+            break;
+        }
+
+        // Writing to socket directly while libuv has queued datagrams would
+        // reorder packets, so in this case we pass everything to libuv.
+        size_t n_sent = 0;
+        if (handle_.send_queue_count == 0) {
+            n_sent = try_send_batch_(packets, n_packets);
         }
 
-        // will be decremented in send_cb_()
-        pp->incref();
+        // Packets that weren't sent without blocking are sent asynchronously.
+        for (size_t n = n_sent; n < n_packets; n++) {
+            async_send_(packets[n]);
+        }
+
+        for (size_t n = 0; n < n_packets; n++) {
+            packets[n] = NULL;
+        }
+
+        if (n_sent != 0) {
+            const int pending_packets = (*pending_packets_ -= (int)n_sent);
+
+            if (pending_packets == 0 && stopped_) {
+                start_closing_();
+            }
+        }
+
+        if (n_packets < MaxBatchSize) {
+            break;
+        }
+    }
+}
+
+size_t UdpSenderPort::try_send_batch_(const packet::PacketPtr* packets,
+                                      size_t n_packets) {
+    SocketDatagram datagrams[MaxBatchSize];
+
+    for (size_t n = 0; n < n_packets; n++) {
+        datagrams[n].buf = packets[n]->data().data();
+        datagrams[n].bufsz = packets[n]->data().size();
+        datagrams[n].remote_address = connected_ ? NULL : &packets[n]->udp()->dst_addr;
+    }
+
+    ssize_t ret = socket_try_send_batch_to(fd_, datagrams, n_packets, gso_enabled_);
+
+    if (ret == IOErr_Failure && gso_enabled_) {
+        // kernel or network interface may not support GSO
+        roc_log(LogInfo, "udp sender: %s: batch send failed, disabling gso",
+                descriptor());
+        gso_enabled_ = false;
+
+        ret = socket_try_send_batch_to(fd_, datagrams, n_packets, gso_enabled_);
+    }
+
+    if (ret <= 0) {
+        return 0;
     }
+
+    const size_t n_sent = (size_t)ret;
+
+    for (size_t n = 0; n < n_sent; n++) {
+        roc_tracepoint(udp_send, (const void*)this, (const void*)packets[n].get(),
+                       (long)packets[n]->data().size());
+    }
+
+    const int packet_num = (sent_packets_ += (int)n_sent);
+    sent_packets_blk_ += (int)n_sent;
+    sent_packets_batched_ += (int)n_sent;
+    ++sent_batches_;
+
+    roc_log(LogTrace,
+            "udp sender: %s: sent packet batch: last_num=%d n_packets=%lu n_sent=%lu",
+            descriptor(), packet_num, (unsigned long)n_packets, (unsigned long)n_sent);
+
+    return n_sent;
 }
 
 void UdpSenderPort::send_cb_(uv_udp_send_t* req, int status) {
@@ -275,14 +483,16 @@ void UdpSenderPort::send_cb_(uv_udp_send_t* req, int status) {
     if (status < 0) {
         roc_log(LogError,
                 "udp sender: %s:"
-                " can't send packet: src=%s dst=%s sz=%ld: [%s] %s",
+                " can't send packet: dst=%s sz=%ld: [%s] %s",
                 self.descriptor(),
-                address::socket_addr_to_str(self.config_.bind_address).c_str(),
                 address::socket_addr_to_str(pp->udp()->dst_addr).c_str(),
                 (long)pp->data().size(), uv_err_name(status), uv_strerror(status));
+    } else {
+        roc_tracepoint(udp_send, (const void*)&self, (const void*)pp.get(),
+                       (long)pp->data().size());
     }
 
-    const int pending_packets = --self.pending_packets_;
+    const int pending_packets = --*self.pending_packets_;
 
     if (pending_packets == 0 && self.stopped_) {
         self.start_closing_();
@@ -323,15 +533,20 @@ bool UdpSenderPort::try_nonblocking_send_(const packet::PacketPtr& pp) {
     }
 
     const packet::UDP& udp = *pp->udp();
-    const bool success =
-        socket_try_send_to(fd_, pp->data().data(), pp->data().size(), udp.dst_addr);
+    const ssize_t ret = connected_
+        ? socket_try_send(fd_, pp->data().data(), pp->data().size())
+        : socket_try_send_to(fd_, pp->data().data(), pp->data().size(), udp.dst_addr);
+
+    const bool success = ret > 0;
 
     if (success) {
+        roc_tracepoint(udp_send, (const void*)this, (const void*)pp.get(),
+                       (long)pp->data().size());
+
         const int packet_num = ++sent_packets_;
         roc_log(LogTrace,
-                "udp sender: %s: sent packet non-blocking: num=%d src=%s dst=%s sz=%ld",
+                "udp sender: %s: sent packet non-blocking: num=%d dst=%s sz=%ld",
                 descriptor(), packet_num,
-                address::socket_addr_to_str(config_.bind_address).c_str(),
                 address::socket_addr_to_str(udp.dst_addr).c_str(),
                 (long)pp->data().size());
     }
@@ -339,6 +554,100 @@ bool UdpSenderPort::try_nonblocking_send_(const packet::PacketPtr& pp) {
     return success;
 }
 
+bool UdpSenderPort::tune_socket_() {
+    if (config_.send_buffer_size > (size_t)INT_MAX) {
+        roc_log(LogError, "udp sender: %s: invalid buffer size: got=%lu max=%lu",
+                descriptor(), (unsigned long)config_.send_buffer_size,
+                (unsigned long)INT_MAX);
+        return false;
+    }
+
+    if (config_.send_buffer_size != 0) {
+        if (!socket_set_send_buffer_size(fd_, config_.send_buffer_size)) {
+            roc_log(LogError, "udp sender: %s: can't set SO_SNDBUF to %lu", descriptor(),
+                    (unsigned long)config_.send_buffer_size);
+            return false;
+        }
+    }
+
+    if (config_.dscp > 63) {
+        roc_log(LogError, "udp sender: %s: invalid DSCP: got=%d max=63", descriptor(),
+                config_.dscp);
+        return false;
+    }
+
+    if (config_.dscp >= 0) {
+        if (!socket_set_dscp(fd_, config_.bind_address.family(), config_.dscp)) {
+            roc_log(LogError, "udp sender: %s: can't set DSCP to %d", descriptor(),
+                    config_.dscp);
+            return false;
+        }
+    }
+
+    if (config_.pacing_rate > (size_t)INT_MAX) {
+        roc_log(LogError, "udp sender: %s: invalid pacing rate: got=%lu max=%lu",
+                descriptor(), (unsigned long)config_.pacing_rate,
+                (unsigned long)INT_MAX);
+        return false;
+    }
+
+    if (config_.pacing_rate != 0) {
+        if (!socket_set_pacing_rate(fd_, config_.pacing_rate)) {
+            roc_log(LogError, "udp sender: %s: can't set SO_MAX_PACING_RATE to %lu",
+                    descriptor(), (unsigned long)config_.pacing_rate);
+            return false;
+        }
+    }
+
+    if (config_.priority >= 0) {
+        // not fatal, only affects local scheduling
+        if (!socket_set_priority(fd_, config_.priority)) {
+            roc_log(LogDebug, "udp sender: %s: can't set SO_PRIORITY", descriptor());
+        }
+    }
+
+    if (config_.mtu_discovery) {
+        // not fatal, path mtu is just not reported
+        if (!socket_set_mtu_discovery(fd_, config_.bind_address.family())) {
+            roc_log(LogDebug, "udp sender: %s: can't enable path mtu discovery",
+                    descriptor());
+        }
+    }
+
+    return true;
+}
+
+bool UdpSenderPort::connect_socket_() {
+    if (!config_.connect_address.has_host_port()) {
+        return true;
+    }
+
+    if (config_.connect_address.family() != config_.bind_address.family()) {
+        roc_log(LogError,
+                "udp sender: %s: connect address family differs from bind address",
+                descriptor());
+        return false;
+    }
+
+#if UV_VERSION_HEX >= 0x011b00
+    if (int err = uv_udp_connect(&handle_, config_.connect_address.saddr())) {
+        roc_log(LogError, "udp sender: %s: uv_udp_connect(): [%s] %s", descriptor(),
+                uv_err_name(err), uv_strerror(err));
+        return false;
+    }
+
+    connected_ = true;
+
+    roc_log(LogDebug, "udp sender: %s: connected socket to %s", descriptor(),
+            address::socket_addr_to_str(config_.connect_address).c_str());
+#else
+    roc_log(LogDebug, "udp sender: %s: uv_udp_connect() not supported, not connecting",
+            descriptor());
+#endif
+
+    return true;
+}
+
 void UdpSenderPort::report_stats_() {
     if (!rate_limiter_.allow()) {
         return;
@@ -350,8 +659,14 @@ void UdpSenderPort::report_stats_() {
     const double nb_ratio =
         sent_packets_nb != 0 ? (double)sent_packets_ / sent_packets_nb : 0.;
 
-    roc_log(LogDebug, "udp sender: %s: total=%u nb=%u nb_ratio=%.5f", descriptor(),
-            sent_packets, sent_packets_nb, nb_ratio);
+    const int sent_batches = sent_batches_;
+    const double avg_batch =
+        sent_batches != 0 ? (double)sent_packets_batched_ / sent_batches : 0.;
+
+    roc_log(LogDebug,
+            "udp sender: %s: total=%u nb=%u nb_ratio=%.5f batches=%u avg_batch=%.3f",
+            descriptor(), sent_packets, sent_packets_nb, nb_ratio, sent_batches,
+            avg_batch);
 }
 
 void UdpSenderPort::format_descriptor(core::StringBuilder& b) {
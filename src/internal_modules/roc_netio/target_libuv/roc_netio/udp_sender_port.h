@@ -16,6 +16,7 @@
 
 #include "roc_address/socket_addr.h"
 #include "roc_core/atomic.h"
+#include "roc_core/cache_aligned.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/mpsc_queue.h"
 #include "roc_core/rate_limiter.h"
@@ -42,15 +43,71 @@ struct UdpSenderConfig {
     //! regular asynchronous write.
     bool non_blocking_enabled;
 
+    //! If true, packets queued for asynchronous write are sent in batches
+    //! using sendmmsg(), when available.
+    bool batching_enabled;
+
+    //! If true, batches may be sent using UDP GSO (UDP_SEGMENT) when
+    //! consecutive packets have the same destination and size. Used only
+    //! when batching is enabled. Disabled automatically if not supported.
+    bool gso_enabled;
+
+    //! If non-zero, set SO_SNDBUF to this size in bytes.
+    //! If zero, kernel default is used.
+    size_t send_buffer_size;
+
+    //! If non-negative, mark outgoing packets with this DSCP (0..63).
+    //! Uses IP_TOS or IPV6_TCLASS. If negative, kernel default is used.
+    int dscp;
+
+    //! If non-negative, set SO_PRIORITY of outgoing packets.
+    //! Affects packet scheduling in local queueing disciplines.
+    //! Ignored where not supported.
+    int priority;
+
+    //! If non-zero, pace outgoing packets to this rate, in bytes per second.
+    //! Kernel spreads packets evenly instead of sending bursts of frame or
+    //! FEC block back to back. Uses SO_MAX_PACING_RATE and needs fq qdisc on
+    //! the outgoing interface. Should be somewhat higher than stream bitrate,
+    //! including FEC and headers, otherwise packets will accumulate in qdisc.
+    size_t pacing_rate;
+
+    //! If set, connect socket to this address.
+    //! Kernel then doesn't need to look up route and neighbour for every
+    //! packet, and ICMP errors are reported for the socket. All packets
+    //! written to the port should have this destination address; packets
+    //! with other destinations are dropped. Ignored if not supported by libuv.
+    address::SocketAddr connect_address;
+
+    //! If true, enable path MTU discovery.
+    //! Packets that fit into known path MTU are sent with DF bit, and larger
+    //! packets are fragmented by kernel instead of being dropped.
+    //! When socket is connected, kernel reports path MTU to the connected
+    //! address, see UdpSenderPort::max_payload_size(). Ignored if not supported.
+    bool mtu_discovery;
+
     UdpSenderConfig()
         : reuseaddr(false)
-        , non_blocking_enabled(true) {
+        , non_blocking_enabled(true)
+        , batching_enabled(false)
+        , gso_enabled(false)
+        , send_buffer_size(0)
+        , dscp(-1)
+        , priority(-1)
+        , pacing_rate(0)
+        , mtu_discovery(false) {
     }
 
     //! Check two configs for equality.
     bool operator==(const UdpSenderConfig& other) const {
         return bind_address == other.bind_address
-            && non_blocking_enabled == other.non_blocking_enabled;
+            && non_blocking_enabled == other.non_blocking_enabled
+            && batching_enabled == other.batching_enabled
+            && gso_enabled == other.gso_enabled
+            && send_buffer_size == other.send_buffer_size && dscp == other.dscp
+            && priority == other.priority && pacing_rate == other.pacing_rate
+            && connect_address == other.connect_address
+            && mtu_discovery == other.mtu_discovery;
     }
 };
 
@@ -68,6 +125,12 @@ public:
     //! Get bind address.
     const address::SocketAddr& bind_address() const;
 
+    //! Get maximum size of UDP payload which fits into path MTU.
+    //! @remarks
+    //!  Path MTU minus IP and UDP headers. Known only when socket is connected
+    //!  and kernel supports path MTU query. Returns zero if unknown.
+    size_t max_payload_size() const;
+
     //! Open sender.
     virtual bool open();
 
@@ -79,6 +142,12 @@ public:
     //!  May be called from any thread.
     virtual void write(const packet::PacketPtr&);
 
+    //! Write multiple packets.
+    //! @remarks
+    //!  May be called from any thread. Wakes up network loop at most once
+    //!  per batch.
+    virtual void write_batch(core::List<packet::Packet>& packets);
+
 protected:
     //! Format descriptor.
     virtual void format_descriptor(core::StringBuilder& b);
@@ -88,11 +157,21 @@ private:
     static void write_sem_cb_(uv_async_t* handle);
     static void send_cb_(uv_udp_send_t* req, int status);
 
-    void write_(const packet::PacketPtr&);
+    void check_packet_(const packet::PacketPtr& pp);
+    bool check_destination_(const packet::PacketPtr& pp);
+    bool enqueue_(const packet::PacketPtr& pp);
+    void wakeup_();
+
+    void async_send_(const packet::PacketPtr& pp);
+    void send_batches_();
+    size_t try_send_batch_(const packet::PacketPtr* packets, size_t n_packets);
 
     bool fully_closed_() const;
     void start_closing_();
 
+    bool tune_socket_();
+    bool connect_socket_();
+
     bool try_nonblocking_send_(const packet::PacketPtr& pp);
     void report_stats_();
 
@@ -113,9 +192,17 @@ private:
 
     core::MpscQueue<packet::Packet> queue_;
 
-    core::Atomic<int> pending_packets_;
+    // written by both writer and event loop threads
+    core::CacheAligned<core::Atomic<int> > pending_packets_;
+    core::CacheAligned<core::Atomic<int> > wakeup_pending_;
+
     core::Atomic<int> sent_packets_;
     core::Atomic<int> sent_packets_blk_;
+    core::Atomic<int> sent_batches_;
+    core::Atomic<int> sent_packets_batched_;
+
+    bool gso_enabled_;
+    bool connected_;
 
     bool stopped_;
     bool closed_;
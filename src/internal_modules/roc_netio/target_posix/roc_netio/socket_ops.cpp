@@ -10,9 +10,11 @@
 #include <fcntl.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <signal.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -343,6 +345,200 @@ bool socket_setup(SocketHandle sock, const SocketOptions& options) {
     return true;
 }
 
+bool socket_set_reuseport(SocketHandle sock) {
+    roc_panic_if(sock < 0);
+
+#if defined(SO_REUSEPORT)
+    return set_int_option(sock, SOL_SOCKET, SO_REUSEPORT, "SO_REUSEPORT", 1);
+#else
+    roc_log(LogError, "socket: SO_REUSEPORT is not supported on this platform");
+    return false;
+#endif
+}
+
+bool socket_set_incoming_cpu(SocketHandle sock, int cpu) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(cpu < 0);
+
+#if defined(SO_INCOMING_CPU)
+    return set_int_option(sock, SOL_SOCKET, SO_INCOMING_CPU, "SO_INCOMING_CPU", cpu);
+#else
+    roc_log(LogError, "socket: SO_INCOMING_CPU is not supported on this platform");
+    return false;
+#endif
+}
+
+bool socket_set_recv_buffer_size(SocketHandle sock, size_t size) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(size == 0 || size > (size_t)INT_MAX);
+
+    return set_int_option(sock, SOL_SOCKET, SO_RCVBUF, "SO_RCVBUF", (int)size);
+}
+
+bool socket_set_send_buffer_size(SocketHandle sock, size_t size) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(size == 0 || size > (size_t)INT_MAX);
+
+    return set_int_option(sock, SOL_SOCKET, SO_SNDBUF, "SO_SNDBUF", (int)size);
+}
+
+bool socket_set_busy_poll(SocketHandle sock, int usec) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(usec < 0);
+
+#if defined(SO_BUSY_POLL)
+    return set_int_option(sock, SOL_SOCKET, SO_BUSY_POLL, "SO_BUSY_POLL", usec);
+#else
+    roc_log(LogError, "socket: SO_BUSY_POLL is not supported on this platform");
+    return false;
+#endif
+}
+
+bool socket_set_dscp(SocketHandle sock, address::AddrFamily family, int dscp) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(dscp < 0 || dscp > 63);
+
+    const int tclass = dscp << 2;
+
+    if (family == address::Family_IPv6) {
+#if defined(IPV6_TCLASS)
+        return set_int_option(sock, IPPROTO_IPV6, IPV6_TCLASS, "IPV6_TCLASS", tclass);
+#else
+        roc_log(LogError, "socket: IPV6_TCLASS is not supported on this platform");
+        return false;
+#endif
+    }
+
+    return set_int_option(sock, IPPROTO_IP, IP_TOS, "IP_TOS", tclass);
+}
+
+bool socket_set_priority(SocketHandle sock, int priority) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(priority < 0);
+
+#if defined(SO_PRIORITY)
+    return set_int_option(sock, SOL_SOCKET, SO_PRIORITY, "SO_PRIORITY", priority);
+#else
+    roc_log(LogError, "socket: SO_PRIORITY is not supported on this platform");
+    return false;
+#endif
+}
+
+bool socket_set_pacing_rate(SocketHandle sock, size_t rate) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(rate == 0 || rate > (size_t)INT_MAX);
+
+#if defined(SO_MAX_PACING_RATE)
+    return set_int_option(sock, SOL_SOCKET, SO_MAX_PACING_RATE, "SO_MAX_PACING_RATE",
+                          (int)rate);
+#else
+    roc_log(LogError, "socket: SO_MAX_PACING_RATE is not supported on this platform");
+    return false;
+#endif
+}
+
+bool socket_set_mtu_discovery(SocketHandle sock, address::AddrFamily family) {
+    roc_panic_if(sock < 0);
+
+    if (family == address::Family_IPv6) {
+#if defined(IPV6_MTU_DISCOVER) && defined(IPV6_PMTUDISC_WANT)
+        return set_int_option(sock, IPPROTO_IPV6, IPV6_MTU_DISCOVER, "IPV6_MTU_DISCOVER",
+                              IPV6_PMTUDISC_WANT);
+#else
+        roc_log(LogError, "socket: IPV6_MTU_DISCOVER is not supported on this platform");
+        return false;
+#endif
+    }
+
+#if defined(IP_MTU_DISCOVER) && defined(IP_PMTUDISC_WANT)
+    return set_int_option(sock, IPPROTO_IP, IP_MTU_DISCOVER, "IP_MTU_DISCOVER",
+                          IP_PMTUDISC_WANT);
+#else
+    roc_log(LogError, "socket: IP_MTU_DISCOVER is not supported on this platform");
+    return false;
+#endif
+}
+
+bool socket_get_path_mtu(SocketHandle sock, address::AddrFamily family, size_t& mtu) {
+    roc_panic_if(sock < 0);
+
+    int level = 0, opt = 0;
+    const char* opt_name = NULL;
+
+    if (family == address::Family_IPv6) {
+#if defined(IPV6_MTU)
+        level = IPPROTO_IPV6;
+        opt = IPV6_MTU;
+        opt_name = "IPV6_MTU";
+#endif
+    } else {
+#if defined(IP_MTU)
+        level = IPPROTO_IP;
+        opt = IP_MTU;
+        opt_name = "IP_MTU";
+#endif
+    }
+
+    if (!opt_name) {
+        roc_log(LogDebug, "socket: path mtu query is not supported on this platform");
+        return false;
+    }
+
+    int opt_val = 0;
+    socklen_t opt_len = sizeof(opt_val);
+
+    if (getsockopt(sock, level, opt, &opt_val, &opt_len) == -1) {
+        roc_panic_if(is_malformed(errno));
+
+        // ENOTCONN is expected for sockets which are not connected
+        roc_log(LogDebug, "socket: getsockopt(%s): %s", opt_name,
+                core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (opt_val <= 0) {
+        return false;
+    }
+
+    mtu = (size_t)opt_val;
+    return true;
+}
+
+bool socket_get_drops(SocketHandle sock, size_t& drops) {
+    roc_panic_if(sock < 0);
+
+#if defined(SO_MEMINFO)
+    // Layout of SO_MEMINFO array is fixed by kernel ABI (see SK_MEMINFO_*
+    // in linux/sock_diag.h); drops counter is the last element.
+    enum { MemInfoDrops = 8, MemInfoSize = 9 };
+
+    uint32_t meminfo[MemInfoSize];
+    memset(meminfo, 0, sizeof(meminfo));
+
+    socklen_t opt_len = sizeof(meminfo);
+
+    if (getsockopt(sock, SOL_SOCKET, SO_MEMINFO, meminfo, &opt_len) == -1) {
+        roc_panic_if(is_malformed(errno));
+
+        roc_log(LogError, "socket: getsockopt(SO_MEMINFO): %s",
+                core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (opt_len < sizeof(meminfo)) {
+        roc_log(LogError, "socket: getsockopt(SO_MEMINFO): unexpected len: got=%lu",
+                (unsigned long)opt_len);
+        return false;
+    }
+
+    drops = meminfo[MemInfoDrops];
+    return true;
+#else
+    (void)drops;
+    return false;
+#endif
+}
+
 bool socket_bind(SocketHandle sock, address::SocketAddr& local_address) {
     roc_panic_if(sock < 0);
     roc_panic_if(!local_address.has_host_port());
@@ -467,6 +663,46 @@ ssize_t socket_try_recv(SocketHandle sock, void* buf, size_t bufsz) {
     return ret;
 }
 
+namespace {
+
+// Maximum number of buffers passed to single sendmsg() call.
+// POSIX guarantees that IOV_MAX is at least 16.
+enum { MaxSendBuffers = 16 };
+
+// Fill message header with non-empty buffers.
+// Remaining buffers, if any, would be written by subsequent calls.
+// Returns false if there is nothing to send.
+bool fill_msghdr(struct msghdr& msg,
+                 struct iovec* iov,
+                 const SocketBuffer* buffers,
+                 size_t n_buffers) {
+    size_t n_iov = 0;
+
+    for (size_t n = 0; n < n_buffers && n_iov < MaxSendBuffers; n++) {
+        if (buffers[n].bufsz == 0) {
+            continue;
+        }
+
+        roc_panic_if(!buffers[n].buf);
+
+        iov[n_iov].iov_base = const_cast<void*>(buffers[n].buf);
+        iov[n_iov].iov_len = buffers[n].bufsz;
+        n_iov++;
+    }
+
+    if (n_iov == 0) {
+        return false;
+    }
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = n_iov;
+
+    return true;
+}
+
+} // namespace
+
 #if defined(SO_NOSIGPIPE) || defined(MSG_NOSIGNAL)
 
 // This version is used if either SO_NOSIGPIPE or MSG_NOSIGNAL is available
@@ -477,12 +713,15 @@ ssize_t socket_try_recv(SocketHandle sock, void* buf, size_t bufsz) {
 // If SO_NOSIGPIPE is available (e.g. on macOS and BSD), it was enabled for
 // the socket in socket_setup().
 //
-// If MSG_NOSIGNAL is available (e.g. on Linux), we pass it to send().
-ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
+// If MSG_NOSIGNAL is available (e.g. on Linux), we pass it to sendmsg().
+ssize_t
+socket_try_send_vec(SocketHandle sock, const SocketBuffer* buffers, size_t n_buffers) {
     roc_panic_if(sock < 0);
-    roc_panic_if(!buf);
+    roc_panic_if(!buffers);
 
-    if (bufsz == 0) {
+    struct iovec iov[MaxSendBuffers];
+    struct msghdr msg;
+    if (!fill_msghdr(msg, iov, buffers, n_buffers)) {
         return 0;
     }
 
@@ -492,7 +731,7 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
 #endif
 
     ssize_t ret;
-    while ((ret = send(sock, buf, bufsz, flags)) == -1) {
+    while ((ret = sendmsg(sock, &msg, flags)) == -1) {
         roc_panic_if(is_malformed(errno));
 
         if (errno != EINTR) {
@@ -505,12 +744,12 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
     }
 
     if (ret < 0) {
-        roc_log(LogError, "socket: send(): %s", core::errno_to_str().c_str());
+        roc_log(LogError, "socket: sendmsg(): %s", core::errno_to_str().c_str());
         return IOErr_Failure;
     }
 
     if (ret == 0) {
-        roc_log(LogError, "socket: send(): unexpected zero return code");
+        roc_log(LogError, "socket: sendmsg(): unexpected zero return code");
         return IOErr_Failure;
     }
 
@@ -522,9 +761,9 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
 // This version is used when both SO_NOSIGPIPE and MSG_NOSIGNAL aren't available.
 //
 // In this case, we modify the signal mask of the current thread to block SIGPIPE,
-// then call send(), and the restore the mask back.
+// then call sendmsg(), and the restore the mask back.
 //
-// If SIGPIPE was generated during send(), we clear the pending signal before
+// If SIGPIPE was generated during sendmsg(), we clear the pending signal before
 // restoring the mask.
 //
 // We don't want to mess with signal handlers because we're not controlling them.
@@ -532,16 +771,19 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
 // handlers for its own purposes, and may have SIGPIPE handler as well.
 //
 // This implementation requires POSIX 2001.
-ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
+ssize_t
+socket_try_send_vec(SocketHandle sock, const SocketBuffer* buffers, size_t n_buffers) {
     roc_panic_if(sock < 0);
-    roc_panic_if(!buf);
+    roc_panic_if(!buffers);
 
-    if (bufsz == 0) {
+    struct iovec iov[MaxSendBuffers];
+    struct msghdr msg;
+    if (!fill_msghdr(msg, iov, buffers, n_buffers)) {
         return 0;
     }
 
     // Block SIGPIPE for this thread.
-    // This works since kernel sends SIGPIPE to the thread that called send(),
+    // This works since kernel sends SIGPIPE to the thread that called sendmsg(),
     // not to the whole process.
     sigset_t sig_block, sig_restore;
     if (sigemptyset(&sig_block) == -1) {
@@ -554,7 +796,7 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
         roc_panic("socket: pthread_sigmask(): %s", core::errno_to_str(err).c_str());
     }
 
-    // Remember if SIGPIPE was already pending before calling send().
+    // Remember if SIGPIPE was already pending before calling sendmsg().
     int sigpipe_pending = -1;
     sigset_t sig_pending;
     if (sigpending(&sig_pending) == -1) {
@@ -565,7 +807,7 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
     }
 
     ssize_t ret;
-    while ((ret = send(sock, buf, bufsz, MSG_DONTWAIT)) == -1) {
+    while ((ret = sendmsg(sock, &msg, MSG_DONTWAIT)) == -1) {
         roc_panic_if(is_malformed(errno));
 
         if (errno != EINTR) {
@@ -575,8 +817,8 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
 
     const int saved_errno = errno;
 
-    // If send() failed with EPIPE, and SIGPIPE was not already pending before calling
-    // send(), then fetch SIGPIPE from pending signal mask.
+    // If sendmsg() failed with EPIPE, and SIGPIPE was not already pending before
+    // calling sendmsg(), then fetch SIGPIPE from pending signal mask.
     if (ret == -1 && saved_errno == EPIPE && sigpipe_pending == 0) {
         struct timespec ts;
         ts.tv_sec = 0;
@@ -600,12 +842,12 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
     }
 
     if (ret < 0) {
-        roc_log(LogError, "socket: send(): %s", core::errno_to_str().c_str());
+        roc_log(LogError, "socket: sendmsg(): %s", core::errno_to_str().c_str());
         return IOErr_Failure;
     }
 
     if (ret == 0) {
-        roc_log(LogError, "socket: send(): unexpected zero return code");
+        roc_log(LogError, "socket: sendmsg(): unexpected zero return code");
         return IOErr_Failure;
     }
 
@@ -614,6 +856,17 @@ ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
 
 #endif // defined(SO_NOSIGPIPE) || defined(MSG_NOSIGNAL)
 
+ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(!buf);
+
+    SocketBuffer buffer;
+    buffer.buf = buf;
+    buffer.bufsz = bufsz;
+
+    return socket_try_send_vec(sock, &buffer, 1);
+}
+
 ssize_t socket_try_send_to(SocketHandle sock,
                            const void* buf,
                            size_t bufsz,
@@ -653,6 +906,194 @@ ssize_t socket_try_send_to(SocketHandle sock,
     return ret;
 }
 
+#if defined(__linux__)
+
+namespace {
+
+bool same_destination(const SocketDatagram& a, const SocketDatagram& b) {
+    if (!a.remote_address || !b.remote_address) {
+        return a.remote_address == b.remote_address;
+    }
+    return *a.remote_address == *b.remote_address;
+}
+
+} // namespace
+
+// This version is used on Linux, where sendmmsg() is available.
+//
+// If UDP_SEGMENT is available too, runs of datagrams with the same destination
+// and size are sent as a single message with UDP_SEGMENT control message, and
+// kernel splits it into datagrams of given size (the last one may be shorter).
+ssize_t socket_try_send_batch_to(SocketHandle sock,
+                                 const SocketDatagram* datagrams,
+                                 size_t n_datagrams,
+                                 bool enable_gso) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(!datagrams);
+
+    enum {
+        // Maximum number of datagrams per call.
+        MaxDatagrams = 64,
+
+        // Maximum number of datagrams merged into one GSO message.
+        MaxSegments = 64,
+
+        // Maximum total payload of one GSO message.
+        MaxGsoBytes = 65507
+    };
+
+    if (n_datagrams > MaxDatagrams) {
+        n_datagrams = MaxDatagrams;
+    }
+
+    if (n_datagrams == 0) {
+        return 0;
+    }
+
+    struct mmsghdr msgs[MaxDatagrams];
+    struct iovec iovs[MaxDatagrams];
+    size_t msg_datagrams[MaxDatagrams];
+
+#if defined(UDP_SEGMENT)
+    union {
+        char buf[CMSG_SPACE(sizeof(uint16_t))];
+        struct cmsghdr align;
+    } ctrl[MaxDatagrams];
+#else
+    (void)enable_gso;
+#endif
+
+    memset(msgs, 0, sizeof(msgs));
+
+    size_t n_msgs = 0;
+
+    for (size_t n = 0; n < n_datagrams;) {
+        const SocketDatagram& first = datagrams[n];
+
+        roc_panic_if(!first.buf);
+        roc_panic_if(first.remote_address && !first.remote_address->has_host_port());
+
+        size_t n_segments = 1;
+
+#if defined(UDP_SEGMENT)
+        if (enable_gso) {
+            size_t n_bytes = first.bufsz;
+
+            while (n + n_segments < n_datagrams && n_segments < MaxSegments) {
+                const SocketDatagram& next = datagrams[n + n_segments];
+
+                // only the last segment may be shorter
+                if (next.bufsz == 0 || next.bufsz > first.bufsz
+                    || n_bytes + next.bufsz > MaxGsoBytes
+                    || !same_destination(next, first)) {
+                    break;
+                }
+
+                n_bytes += next.bufsz;
+                n_segments++;
+
+                if (next.bufsz < first.bufsz) {
+                    break;
+                }
+            }
+        }
+#endif
+
+        for (size_t k = 0; k < n_segments; k++) {
+            iovs[n + k].iov_base = const_cast<void*>(datagrams[n + k].buf);
+            iovs[n + k].iov_len = datagrams[n + k].bufsz;
+        }
+
+        struct msghdr& hdr = msgs[n_msgs].msg_hdr;
+
+        if (first.remote_address) {
+            hdr.msg_name = const_cast<sockaddr*>(first.remote_address->saddr());
+            hdr.msg_namelen = first.remote_address->slen();
+        }
+        hdr.msg_iov = &iovs[n];
+        hdr.msg_iovlen = n_segments;
+
+#if defined(UDP_SEGMENT)
+        if (n_segments > 1) {
+            hdr.msg_control = ctrl[n_msgs].buf;
+            hdr.msg_controllen = sizeof(ctrl[n_msgs].buf);
+
+            struct cmsghdr* cm = CMSG_FIRSTHDR(&hdr);
+            cm->cmsg_level = IPPROTO_UDP;
+            cm->cmsg_type = UDP_SEGMENT;
+            cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+
+            const uint16_t gso_size = (uint16_t)first.bufsz;
+            memcpy(CMSG_DATA(cm), &gso_size, sizeof(gso_size));
+        }
+#endif
+
+        msg_datagrams[n_msgs] = n_segments;
+
+        n_msgs++;
+        n += n_segments;
+    }
+
+    int ret;
+    while ((ret = sendmmsg(sock, msgs, (unsigned)n_msgs, MSG_DONTWAIT)) == -1) {
+        roc_panic_if(is_malformed(errno));
+
+        if (errno != EINTR) {
+            break;
+        }
+    }
+
+    if (ret < 0 && is_ewouldblock(errno)) {
+        return IOErr_WouldBlock;
+    }
+
+    if (ret < 0) {
+        roc_log(LogError, "socket: sendmmsg(): %s", core::errno_to_str().c_str());
+        return IOErr_Failure;
+    }
+
+    size_t n_sent = 0;
+    for (int m = 0; m < ret; m++) {
+        n_sent += msg_datagrams[m];
+    }
+
+    return (ssize_t)n_sent;
+}
+
+#else // !defined(__linux__)
+
+// This version is used when sendmmsg() is not available.
+//
+// Datagrams are sent one by one until all are sent or an error occurs.
+ssize_t socket_try_send_batch_to(SocketHandle sock,
+                                 const SocketDatagram* datagrams,
+                                 size_t n_datagrams,
+                                 bool) {
+    roc_panic_if(sock < 0);
+    roc_panic_if(!datagrams);
+
+    size_t n_sent = 0;
+
+    for (; n_sent < n_datagrams; n_sent++) {
+        const SocketDatagram& dgram = datagrams[n_sent];
+
+        const ssize_t ret = dgram.remote_address
+            ? socket_try_send_to(sock, dgram.buf, dgram.bufsz, *dgram.remote_address)
+            : socket_try_send(sock, dgram.buf, dgram.bufsz);
+
+        if (ret < 0) {
+            if (n_sent == 0) {
+                return ret;
+            }
+            break;
+        }
+    }
+
+    return (ssize_t)n_sent;
+}
+
+#endif // defined(__linux__)
+
 bool socket_shutdown(SocketHandle sock) {
     roc_panic_if(sock < 0);
 
@@ -43,6 +43,83 @@ bool socket_accept(SocketHandle sock,
 //! Set socket options.
 bool socket_setup(SocketHandle sock, const SocketOptions& options);
 
+//! Allow multiple sockets to bind to the same address and port.
+//! @remarks
+//!  Enables SO_REUSEPORT. Incoming datagrams are distributed between all
+//!  sockets bound to the same address and port by kernel.
+//! @returns false if the option is not supported or can't be set.
+bool socket_set_reuseport(SocketHandle sock);
+
+//! Prefer given CPU when selecting socket for incoming datagrams.
+//! @remarks
+//!  Sets SO_INCOMING_CPU. When used with SO_REUSEPORT, allows kernel to deliver
+//!  datagrams to the socket served on the same CPU that processed them.
+//! @returns false if the option is not supported or can't be set.
+bool socket_set_incoming_cpu(SocketHandle sock, int cpu);
+
+//! Set size of kernel receive buffer.
+//! @remarks
+//!  Sets SO_RCVBUF. Kernel may round or double the size.
+//! @returns false if the option can't be set.
+bool socket_set_recv_buffer_size(SocketHandle sock, size_t size);
+
+//! Set size of kernel send buffer.
+//! @remarks
+//!  Sets SO_SNDBUF. Kernel may round or double the size.
+//! @returns false if the option can't be set.
+bool socket_set_send_buffer_size(SocketHandle sock, size_t size);
+
+//! Enable busy polling of device queue on blocking receive.
+//! @remarks
+//!  Sets SO_BUSY_POLL to given number of microseconds.
+//! @returns false if the option is not supported or can't be set.
+bool socket_set_busy_poll(SocketHandle sock, int usec);
+
+//! Set DSCP of outgoing packets.
+//! @remarks
+//!  Sets IP_TOS or IPV6_TCLASS, depending on @p family. Two lower bits
+//!  of the traffic class (ECN) are left zero.
+//! @returns false if the option is not supported or can't be set.
+bool socket_set_dscp(SocketHandle sock, address::AddrFamily family, int dscp);
+
+//! Set priority of outgoing packets in local queueing disciplines.
+//! @remarks
+//!  Sets SO_PRIORITY.
+//! @returns false if the option is not supported or can't be set.
+bool socket_set_priority(SocketHandle sock, int priority);
+
+//! Limit rate at which kernel transmits packets of the socket.
+//! @remarks
+//!  Sets SO_MAX_PACING_RATE, in bytes per second. For UDP sockets, pacing
+//!  is performed by fq queueing discipline, which should be configured on
+//!  the outgoing interface; otherwise the option has no effect.
+//! @returns false if the option is not supported or can't be set.
+bool socket_set_pacing_rate(SocketHandle sock, size_t rate);
+
+//! Enable path MTU discovery for outgoing datagrams.
+//! @remarks
+//!  Sets IP_MTU_DISCOVER or IPV6_MTU_DISCOVER to "want". Datagrams that fit
+//!  into known path MTU are sent with DF bit, and kernel tracks path MTU using
+//!  ICMP "fragmentation needed" messages. Larger datagrams are fragmented by
+//!  kernel instead of being dropped.
+//! @returns false if the option is not supported or can't be set.
+bool socket_set_mtu_discovery(SocketHandle sock, address::AddrFamily family);
+
+//! Get path MTU of connected socket.
+//! @remarks
+//!  Uses IP_MTU or IPV6_MTU. Reports MTU known by kernel for the route to
+//!  connected address, which is updated by path MTU discovery.
+//! @returns false if the option is not supported, socket is not connected,
+//!  or the option can't be read.
+bool socket_get_path_mtu(SocketHandle sock, address::AddrFamily family, size_t& mtu);
+
+//! Get number of datagrams dropped by kernel because of full receive buffer.
+//! @remarks
+//!  Uses SO_MEMINFO, which reports the same counter as SO_RXQ_OVFL, but
+//!  doesn't require receiving ancillary data.
+//! @returns false if the option is not supported or can't be read.
+bool socket_get_drops(SocketHandle sock, size_t& drops);
+
 //! Bind socket to local address.
 bool socket_bind(SocketHandle sock, address::SocketAddr& local_address);
 
@@ -69,6 +146,24 @@ ssize_t socket_try_recv(SocketHandle sock, void* buf, size_t bufsz);
 //! @returns number of bytes written (>= 0) or IOError (< 0).
 ssize_t socket_try_send(SocketHandle sock, const void* buf, size_t bufsz);
 
+//! Buffer for socket_try_send_vec().
+struct SocketBuffer {
+    //! Buffer data.
+    const void* buf;
+
+    //! Buffer size.
+    size_t bufsz;
+};
+
+//! Try to write multiple buffers to socket without blocking.
+//! @remarks
+//!  Uses single sendmsg() call, so that buffers are written without
+//!  concatenating them. Buffers may be written partially, in which case
+//!  caller should retry with remaining bytes.
+//! @returns number of bytes written (>= 0) or IOError (< 0).
+ssize_t
+socket_try_send_vec(SocketHandle sock, const SocketBuffer* buffers, size_t n_buffers);
+
 //! Try to send datagram via socket to given address, without blocking.
 //! @returns number of bytes written (>= 0) or IOError (< 0).
 ssize_t socket_try_send_to(SocketHandle sock,
@@ -76,6 +171,30 @@ ssize_t socket_try_send_to(SocketHandle sock,
                            size_t bufsz,
                            const address::SocketAddr& remote_address);
 
+//! Datagram for socket_try_send_batch_to().
+struct SocketDatagram {
+    //! Datagram payload.
+    const void* buf;
+
+    //! Payload size.
+    size_t bufsz;
+
+    //! Destination address.
+    //! May be NULL if socket is connected.
+    const address::SocketAddr* remote_address;
+};
+
+//! Try to send multiple datagrams via socket, without blocking.
+//! @remarks
+//!  Uses single sendmmsg() call when available. If @p enable_gso is true and
+//!  UDP GSO is supported, consecutive datagrams with the same destination and
+//!  size are additionally merged into one message segmented by kernel.
+//! @returns number of datagrams sent (>= 0) or IOError (< 0).
+ssize_t socket_try_send_batch_to(SocketHandle sock,
+                                 const SocketDatagram* datagrams,
+                                 size_t n_datagrams,
+                                 bool enable_gso);
+
 //! Gracefully shutdown connection.
 bool socket_shutdown(SocketHandle sock);
 
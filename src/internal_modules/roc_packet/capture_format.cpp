@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/capture_format.h"
+
+namespace roc {
+namespace packet {
+
+const char CaptureFormat::Magic[4] = { 'R', 'C', 'A', 'P' };
+
+} // namespace packet
+} // namespace roc
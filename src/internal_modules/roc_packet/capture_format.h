@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/capture_format.h
+//! @brief Packet capture file format.
+
+#ifndef ROC_PACKET_CAPTURE_FORMAT_H_
+#define ROC_PACKET_CAPTURE_FORMAT_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace packet {
+
+//! Packet capture file format.
+//!
+//! File starts with a header:
+//!  - 4 bytes: magic "RCAP"
+//!  - 2 bytes: format version
+//!  - 2 bytes: reserved, zero
+//!
+//! Header is followed by records, one per datagram:
+//!  - 8 bytes: receive timestamp, unix time in nanoseconds
+//!  - 1 byte: stream identifier, chosen by the writer (e.g. interface)
+//!  - 1 byte: source address family (address::AddrFamily)
+//!  - 2 bytes: source port
+//!  - 1 byte: length of source host
+//!  - source host as text, without terminating zero
+//!  - 2 bytes: length of datagram
+//!  - datagram
+//!
+//! All integers are big-endian.
+struct CaptureFormat {
+    enum {
+        //! Current format version.
+        Version = 1,
+
+        //! Size of file header.
+        FileHeaderSize = 8,
+
+        //! Size of record header, without host and datagram.
+        RecordHeaderSize = 15,
+
+        //! Maximum length of source host.
+        MaxHostSize = 64,
+
+        //! Maximum length of datagram.
+        MaxDataSize = 65535
+    };
+
+    //! File magic.
+    static const char Magic[4];
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_CAPTURE_FORMAT_H_
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/capture_reader.h"
+#include "roc_address/addr_family.h"
+#include "roc_core/endian_ops.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_packet/capture_format.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+template <class T> const uint8_t* get(const uint8_t* ptr, T& value) {
+    memcpy(&value, ptr, sizeof(value));
+    value = core::EndianOps::swap_native_be(value);
+    return ptr + sizeof(value);
+}
+
+} // namespace
+
+CaptureReader::CaptureReader(PacketFactory& packet_factory,
+                             core::BufferFactory<uint8_t>& buffer_factory)
+    : packet_factory_(packet_factory)
+    , buffer_factory_(buffer_factory)
+    , file_(NULL)
+    , failed_(false) {
+}
+
+CaptureReader::~CaptureReader() {
+    if (file_) {
+        fclose(file_);
+    }
+}
+
+bool CaptureReader::open(const char* path) {
+    if (file_) {
+        roc_panic("capture reader: can't open file twice");
+    }
+
+    if (!(file_ = fopen(path, "rb"))) {
+        roc_log(LogError, "capture reader: can't open file: path=%s: %s", path,
+                core::errno_to_str(errno).c_str());
+        failed_ = true;
+        return false;
+    }
+
+    uint8_t header[CaptureFormat::FileHeaderSize];
+    if (!read_bytes_(header, sizeof(header), false)) {
+        roc_log(LogError, "capture reader: can't read file header: path=%s", path);
+        return false;
+    }
+
+    if (memcmp(header, CaptureFormat::Magic, sizeof(CaptureFormat::Magic)) != 0) {
+        roc_log(LogError, "capture reader: not a capture file: path=%s", path);
+        failed_ = true;
+        return false;
+    }
+
+    uint16_t version = 0;
+    get(header + sizeof(CaptureFormat::Magic), version);
+
+    if (version != CaptureFormat::Version) {
+        roc_log(LogError, "capture reader: unsupported version: path=%s version=%u",
+                path, (unsigned)version);
+        failed_ = true;
+        return false;
+    }
+
+    roc_log(LogInfo, "capture reader: opened file: path=%s", path);
+
+    return true;
+}
+
+PacketPtr CaptureReader::read(unsigned& stream_id) {
+    if (!file_ || failed_) {
+        return NULL;
+    }
+
+    uint8_t header[CaptureFormat::RecordHeaderSize];
+
+    // fixed part before host
+    if (!read_bytes_(header, CaptureFormat::RecordHeaderSize - 2, true)) {
+        return NULL;
+    }
+
+    uint64_t timestamp = 0;
+    uint8_t stream = 0, family = 0, host_size = 0;
+    uint16_t port = 0, data_size = 0;
+
+    const uint8_t* ptr = header;
+    ptr = get(ptr, timestamp);
+    ptr = get(ptr, stream);
+    ptr = get(ptr, family);
+    ptr = get(ptr, port);
+    ptr = get(ptr, host_size);
+
+    if (host_size > CaptureFormat::MaxHostSize) {
+        roc_log(LogError, "capture reader: bad record: host_size=%u",
+                (unsigned)host_size);
+        failed_ = true;
+        return NULL;
+    }
+
+    char host[CaptureFormat::MaxHostSize + 1];
+    if (!read_bytes_(host, host_size, false)) {
+        return NULL;
+    }
+    host[host_size] = '\0';
+
+    uint8_t size_buf[2];
+    if (!read_bytes_(size_buf, sizeof(size_buf), false)) {
+        return NULL;
+    }
+    get(size_buf, data_size);
+
+    core::Slice<uint8_t> buffer = buffer_factory_.new_buffer();
+    if (!buffer) {
+        roc_log(LogError, "capture reader: can't allocate buffer");
+        failed_ = true;
+        return NULL;
+    }
+
+    if (data_size > buffer.capacity()) {
+        roc_log(LogError, "capture reader: datagram too large: size=%u max=%lu",
+                (unsigned)data_size, (unsigned long)buffer.capacity());
+        failed_ = true;
+        return NULL;
+    }
+
+    buffer.reslice(0, data_size);
+
+    if (!read_bytes_(buffer.data(), data_size, false)) {
+        return NULL;
+    }
+
+    PacketPtr pp = packet_factory_.new_packet();
+    if (!pp) {
+        roc_log(LogError, "capture reader: can't allocate packet");
+        failed_ = true;
+        return NULL;
+    }
+
+    pp->add_flags(Packet::FlagUDP);
+
+    if (!pp->udp()->src_addr.set_host_port((address::AddrFamily)family, host,
+                                           (int)port)) {
+        roc_log(LogError, "capture reader: bad record: can't parse address: host=%s",
+                host);
+        failed_ = true;
+        return NULL;
+    }
+
+    pp->udp()->receive_timestamp = (core::nanoseconds_t)timestamp;
+    pp->set_data(buffer);
+
+    stream_id = stream;
+
+    return pp;
+}
+
+bool CaptureReader::failed() const {
+    return failed_;
+}
+
+bool CaptureReader::read_bytes_(void* buf, size_t size, bool allow_eof) {
+    if (size == 0) {
+        return true;
+    }
+
+    const size_t n_read = fread(buf, 1, size, file_);
+
+    if (n_read == size) {
+        return true;
+    }
+
+    if (ferror(file_)) {
+        roc_log(LogError, "capture reader: can't read file: %s",
+                core::errno_to_str(errno).c_str());
+        failed_ = true;
+    } else if (n_read != 0 || !allow_eof) {
+        roc_log(LogError, "capture reader: unexpected end of file");
+        failed_ = true;
+    }
+
+    return false;
+}
+
+} // namespace packet
+} // namespace roc
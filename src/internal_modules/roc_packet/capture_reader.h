@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/capture_reader.h
+//! @brief Packet capture reader.
+
+#ifndef ROC_PACKET_CAPTURE_READER_H_
+#define ROC_PACKET_CAPTURE_READER_H_
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+//! Packet capture reader.
+//!
+//! Reads datagrams from a file written by CaptureWriter. Every datagram is
+//! returned as a packet with UDP header (source address and receive timestamp)
+//! and data, i.e. the same way as it was produced by the receiver port.
+class CaptureReader : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Buffers from @p buffer_factory should be large enough to hold datagrams.
+    CaptureReader(PacketFactory& packet_factory,
+                  core::BufferFactory<uint8_t>& buffer_factory);
+
+    //! Close file if it's opened.
+    ~CaptureReader();
+
+    //! Open file and check header.
+    //! @returns
+    //!  false if file can't be opened or has unsupported format.
+    bool open(const char* path);
+
+    //! Read next datagram.
+    //! @returns
+    //!  a new packet and sets @p stream_id to the value passed to writer,
+    //!  or NULL if end of file is reached or an error occurred.
+    PacketPtr read(unsigned& stream_id);
+
+    //! Check if reading failed because of an error.
+    //! @remarks
+    //!  Distinguishes errors from end of file after read() returned NULL.
+    bool failed() const;
+
+private:
+    bool read_bytes_(void* buf, size_t size, bool allow_eof);
+
+    PacketFactory& packet_factory_;
+    core::BufferFactory<uint8_t>& buffer_factory_;
+
+    FILE* file_;
+    bool failed_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_CAPTURE_READER_H_
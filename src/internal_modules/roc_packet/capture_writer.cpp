@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/capture_writer.h"
+#include "roc_core/endian_ops.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_packet/capture_format.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+template <class T> uint8_t* put(uint8_t* ptr, T value) {
+    value = core::EndianOps::swap_native_be(value);
+    memcpy(ptr, &value, sizeof(value));
+    return ptr + sizeof(value);
+}
+
+} // namespace
+
+CaptureWriter::CaptureWriter()
+    : file_(NULL)
+    , n_packets_(0)
+    , failed_(false) {
+}
+
+CaptureWriter::~CaptureWriter() {
+    close_();
+}
+
+bool CaptureWriter::open(const char* path) {
+    core::Mutex::Lock lock(mutex_);
+
+    if (file_) {
+        roc_panic("capture writer: can't open file twice");
+    }
+
+    if (!(file_ = fopen(path, "wb"))) {
+        roc_log(LogError, "capture writer: can't open file: path=%s: %s", path,
+                core::errno_to_str(errno).c_str());
+        return false;
+    }
+
+    uint8_t header[CaptureFormat::FileHeaderSize];
+    memcpy(header, CaptureFormat::Magic, sizeof(CaptureFormat::Magic));
+
+    uint8_t* ptr = header + sizeof(CaptureFormat::Magic);
+    ptr = put(ptr, (uint16_t)CaptureFormat::Version);
+    ptr = put(ptr, (uint16_t)0);
+
+    if (fwrite(header, sizeof(header), 1, file_) != 1) {
+        roc_log(LogError, "capture writer: can't write file header: path=%s: %s", path,
+                core::errno_to_str(errno).c_str());
+        close_();
+        return false;
+    }
+
+    roc_log(LogInfo, "capture writer: opened file: path=%s", path);
+
+    return true;
+}
+
+bool CaptureWriter::write(const Packet& packet, unsigned stream_id) {
+    if (!packet.udp()) {
+        roc_panic("capture writer: unexpected non-udp packet");
+    }
+
+    if (!packet.data()) {
+        roc_panic("capture writer: unexpected packet without data");
+    }
+
+    const UDP& udp = *packet.udp();
+
+    char host[CaptureFormat::MaxHostSize + 1];
+    if (!udp.src_addr.get_host(host, sizeof(host))) {
+        roc_log(LogDebug, "capture writer: can't format source address");
+        return false;
+    }
+
+    const size_t host_size = strlen(host);
+    const size_t data_size = packet.data().size();
+
+    if (data_size > CaptureFormat::MaxDataSize) {
+        roc_log(LogDebug, "capture writer: datagram too large: size=%lu",
+                (unsigned long)data_size);
+        return false;
+    }
+
+    uint8_t header[CaptureFormat::RecordHeaderSize + CaptureFormat::MaxHostSize];
+
+    uint8_t* ptr = header;
+    ptr = put(ptr, (uint64_t)udp.receive_timestamp);
+    ptr = put(ptr, (uint8_t)stream_id);
+    ptr = put(ptr, (uint8_t)udp.src_addr.family());
+    ptr = put(ptr, (uint16_t)udp.src_addr.port());
+    ptr = put(ptr, (uint8_t)host_size);
+    memcpy(ptr, host, host_size);
+    ptr += host_size;
+    ptr = put(ptr, (uint16_t)data_size);
+
+    core::Mutex::Lock lock(mutex_);
+
+    if (!file_ || failed_) {
+        return false;
+    }
+
+    if (fwrite(header, size_t(ptr - header), 1, file_) != 1
+        || fwrite(packet.data().data(), data_size, 1, file_) != 1) {
+        roc_log(LogError, "capture writer: can't write file, stopping capture: %s",
+                core::errno_to_str(errno).c_str());
+        failed_ = true;
+        return false;
+    }
+
+    n_packets_++;
+
+    return true;
+}
+
+size_t CaptureWriter::num_packets() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return n_packets_;
+}
+
+void CaptureWriter::close_() {
+    if (!file_) {
+        return;
+    }
+
+    if (fclose(file_) != 0) {
+        roc_log(LogError, "capture writer: can't close file: %s",
+                core::errno_to_str(errno).c_str());
+    }
+
+    roc_log(LogDebug, "capture writer: closed file: n_packets=%lu",
+            (unsigned long)n_packets_);
+
+    file_ = NULL;
+}
+
+} // namespace packet
+} // namespace roc
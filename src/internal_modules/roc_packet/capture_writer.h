@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/capture_writer.h
+//! @brief Packet capture writer.
+
+#ifndef ROC_PACKET_CAPTURE_WRITER_H_
+#define ROC_PACKET_CAPTURE_WRITER_H_
+
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/packet.h"
+
+namespace roc {
+namespace packet {
+
+//! Packet capture writer.
+//!
+//! Writes incoming datagrams, together with their source address and receive
+//! timestamp, to a file in CaptureFormat. The file can be later replayed
+//! using CaptureReader.
+//!
+//! Thread-safe, so the same writer may be shared by multiple network threads.
+class CaptureWriter : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    CaptureWriter();
+
+    //! Close file if it's opened.
+    ~CaptureWriter();
+
+    //! Create or truncate file and write header.
+    //! @returns
+    //!  false if file can't be opened or written.
+    bool open(const char* path);
+
+    //! Write datagram to file.
+    //! @remarks
+    //!  @p packet should have UDP header and data. @p stream_id is stored as is
+    //!  and returned by CaptureReader.
+    //! @returns
+    //!  false if file is not opened or writing failed. After the first failure,
+    //!  all subsequent writes fail as well.
+    bool write(const Packet& packet, unsigned stream_id);
+
+    //! Get number of written datagrams.
+    size_t num_packets() const;
+
+private:
+    void close_();
+
+    core::Mutex mutex_;
+
+    FILE* file_;
+    size_t n_packets_;
+    bool failed_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_CAPTURE_WRITER_H_
@@ -12,19 +12,26 @@
 namespace roc {
 namespace packet {
 
-ConcurrentQueue::ConcurrentQueue()
-    : cond_(mutex_) {
+ConcurrentQueue::ConcurrentQueue(Mode mode)
+    : mode_(mode)
+    , size_(0) {
 }
 
 PacketPtr ConcurrentQueue::read() {
-    core::Mutex::Lock lock(mutex_);
+    if (mode_ == NonBlocking) {
+        return queue_.pop_front_exclusive();
+    }
 
-    PacketPtr packet;
-    while (!(packet = list_.front())) {
-        cond_.wait();
+    if (--size_ < 0) {
+        sem_.wait();
     }
 
-    list_.remove(*packet);
+    // counter is incremented after packet is pushed, so queue can't be empty
+    // here; pop_front_exclusive() also waits for concurrent push to complete
+    PacketPtr packet = queue_.pop_front_exclusive();
+    if (!packet) {
+        roc_panic("concurrent queue: unexpected empty queue");
+    }
 
     return packet;
 }
@@ -34,10 +41,11 @@ void ConcurrentQueue::write(const PacketPtr& packet) {
         roc_panic("concurrent queue: packet is null");
     }
 
-    core::Mutex::Lock lock(mutex_);
+    queue_.push_back(*packet);
 
-    list_.push_back(*packet);
-    cond_.broadcast();
+    if (mode_ == Blocking && ++size_ <= 0) {
+        sem_.post();
+    }
 }
 
 } // namespace packet
@@ -12,10 +12,10 @@
 #ifndef ROC_PACKET_CONCURRENT_QUEUE_H_
 #define ROC_PACKET_CONCURRENT_QUEUE_H_
 
-#include "roc_core/cond.h"
-#include "roc_core/list.h"
-#include "roc_core/mutex.h"
+#include "roc_core/atomic.h"
+#include "roc_core/mpsc_queue.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/semaphore.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet.h"
@@ -24,25 +24,49 @@ namespace roc {
 namespace packet {
 
 //! Concurrent blocking packet queue.
+//! @remarks
+//!  Built on top of lock-free core::MpscQueue. Writers never block and never
+//!  take locks. In blocking mode, a semaphore is posted only when a writer adds
+//!  a packet while the reader is waiting for the queue to become non-empty.
+//!  Any number of threads may write to the queue concurrently, but only one
+//!  thread may read from it at a time.
 class ConcurrentQueue : public IReader, public IWriter, public core::NonCopyable<> {
 public:
-    ConcurrentQueue();
+    //! Queue mode.
+    enum Mode {
+        //! Read blocks until queue becomes non-empty.
+        Blocking,
+
+        //! Read returns null if queue is empty.
+        NonBlocking
+    };
+
+    //! Initialize.
+    explicit ConcurrentQueue(Mode mode = Blocking);
 
     //! Read next packet.
     //! @remarks
-    //!  Blocks until the queue becomes non-empty and returns the first
-    //!  packet from the queue.
+    //!  In blocking mode, blocks until the queue becomes non-empty. In non-blocking
+    //!  mode, returns null if the queue is empty. Removes returned packet from
+    //!  the queue.
+    //! @note
+    //!  Should not be called concurrently.
     virtual PacketPtr read();
 
     //! Add packet to the queue.
     //! @remarks
-    //!  Adds packet to the end of the queue.
+    //!  Adds packet to the end of the queue. Lock-free.
     virtual void write(const PacketPtr& packet);
 
 private:
-    core::Mutex mutex_;
-    core::Cond cond_;
-    core::List<Packet> list_;
+    const Mode mode_;
+
+    core::MpscQueue<Packet> queue_;
+
+    // number of packets in queue; becomes negative when the reader
+    // is about to block waiting for next packet
+    core::Atomic<long> size_;
+    core::Semaphore sem_;
 };
 
 } // namespace packet
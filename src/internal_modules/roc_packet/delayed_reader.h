@@ -25,6 +25,9 @@ namespace packet {
 //! Delayed reader.
 //! @remarks
 //!  Delays audio packet reader for given amount of samples.
+//!  If more than the delay is accumulated when reading starts, e.g. when the
+//!  session starts from a burst of packets, stale packets from the head are
+//!  discarded, so that playback starts right at the target latency.
 class DelayedReader : public IReader, public core::NonCopyable<> {
 public:
     //! Initialize.
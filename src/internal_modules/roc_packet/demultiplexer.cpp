@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/demultiplexer.h"
+#include "roc_core/log.h"
+#include "roc_packet/multiplexer.h"
+
+namespace roc {
+namespace packet {
+
+Demultiplexer::Demultiplexer(PacketFactory& packet_factory)
+    : packet_factory_(packet_factory) {
+}
+
+bool Demultiplexer::demultiplex(const Packet& datagram, IWriter& writer) {
+    const core::Slice<uint8_t>& data = datagram.data();
+
+    if (!data || data.size() < 2 || data.data()[0] != Multiplexer::Marker) {
+        roc_log(LogDebug, "demultiplexer: unexpected datagram header");
+        return false;
+    }
+
+    const uint8_t* ptr = data.data();
+    size_t pos = 1;
+
+    while (pos < data.size()) {
+        size_t packet_size = ptr[pos++];
+
+        if (packet_size & 0x80) {
+            if (pos == data.size()) {
+                roc_log(LogDebug, "demultiplexer: truncated sub-packet header");
+                return false;
+            }
+            packet_size = ((packet_size & 0x7f) << 8) | ptr[pos++];
+        }
+
+        if (packet_size == 0 || packet_size > data.size() - pos) {
+            roc_log(LogDebug,
+                    "demultiplexer: bad sub-packet size: size=%lu available=%lu",
+                    (unsigned long)packet_size, (unsigned long)(data.size() - pos));
+            return false;
+        }
+
+        PacketPtr packet = packet_factory_.new_packet();
+        if (!packet) {
+            roc_log(LogError, "demultiplexer: can't allocate packet");
+            return false;
+        }
+
+        if (datagram.udp()) {
+            packet->add_flags(Packet::FlagUDP);
+            packet->udp()->src_addr = datagram.udp()->src_addr;
+            packet->udp()->dst_addr = datagram.udp()->dst_addr;
+            packet->udp()->receive_timestamp = datagram.udp()->receive_timestamp;
+        }
+
+        packet->set_data(data.subslice(pos, pos + packet_size));
+
+        writer.write(packet);
+
+        pos += packet_size;
+    }
+
+    return true;
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/demultiplexer.h
+//! @brief Splits datagrams into packets.
+
+#ifndef ROC_PACKET_DEMULTIPLEXER_H_
+#define ROC_PACKET_DEMULTIPLEXER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+//! Splits datagrams produced by Multiplexer into packets.
+class Demultiplexer : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p packet_factory is used to allocate sub-packets.
+    explicit Demultiplexer(PacketFactory& packet_factory);
+
+    //! Split datagram into packets and write them to @p writer.
+    //! @remarks
+    //!  Sub-packets reference datagram buffer, so that no data is copied.
+    //!  They get UDP addresses and receive timestamp of the datagram.
+    //! @returns
+    //!  false if datagram is malformed; sub-packets that preceded the
+    //!  malformed part are still written.
+    bool demultiplex(const Packet& datagram, IWriter& writer);
+
+private:
+    PacketFactory& packet_factory_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_DEMULTIPLEXER_H_
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/fanout.h"
+#include "roc_core/list.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace packet {
+
+Fanout::Fanout(IWriter& writer,
+               PacketFactory& packet_factory,
+               core::IAllocator& allocator)
+    : writer_(writer)
+    , packet_factory_(packet_factory)
+    , destinations_(allocator) {
+}
+
+size_t Fanout::num_destinations() const {
+    return destinations_.size();
+}
+
+bool Fanout::add_destination(const address::SocketAddr& address) {
+    if (!destinations_.grow_exp(destinations_.size() + 1)) {
+        roc_log(LogError, "fanout: can't allocate destination");
+        return false;
+    }
+
+    destinations_.push_back(address);
+    return true;
+}
+
+void Fanout::write(const PacketPtr& packet) {
+    if (!packet) {
+        roc_panic("fanout: packet is null");
+    }
+
+    const UDP* udp = packet->udp();
+
+    if (!udp || destinations_.size() == 0) {
+        writer_.write(packet);
+        return;
+    }
+
+    // packet and its copies are passed to writer in one batch, so that
+    // network port is notified once per packet, not once per destination
+    core::List<Packet> batch;
+
+    for (size_t n = 0; n < destinations_.size(); n++) {
+        PacketPtr copy = packet_factory_.new_packet();
+        if (!copy) {
+            roc_log(LogError, "fanout: can't allocate packet");
+            break;
+        }
+
+        copy->add_flags(Packet::FlagUDP | Packet::FlagComposed
+                        | (packet->flags() & Packet::FlagRepair));
+
+        copy->udp()->src_addr = udp->src_addr;
+        copy->udp()->dst_addr = destinations_[n];
+
+        copy->set_data(packet->data());
+
+        batch.push_back(*copy);
+    }
+
+    if (packet->list_node_data()->list != NULL) {
+        // packet is already member of some list and can't be added to batch
+        writer_.write_batch(batch);
+        writer_.write(packet);
+        return;
+    }
+
+    batch.push_back(*packet);
+    writer_.write_batch(batch);
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/fanout.h
+//! @brief Sends packets to multiple destinations.
+
+#ifndef ROC_PACKET_FANOUT_H_
+#define ROC_PACKET_FANOUT_H_
+
+#include "roc_address/socket_addr.h"
+#include "roc_core/array.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+//! Sends every composed packet to additional destination addresses.
+//!
+//! For every additional destination, a new packet is created. It shares the
+//! data buffer of the original packet and has its own UDP header. The original
+//! packet is written last, with its own destination address unchanged.
+//! The original packet and its copies are passed to the writer in a single
+//! write_batch() call, so that every destination costs one small packet copy
+//! and no extra hand-off to the network port.
+//!
+//! Only packet data and UDP header are preserved in copies, so fanout should
+//! be placed after the composer, right before the network port.
+class Fanout : public IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p writer is used to write original packets and their copies
+    //!  - @p packet_factory is used to allocate copies
+    //!  - @p allocator is used to allocate address list
+    Fanout(IWriter& writer, PacketFactory& packet_factory, core::IAllocator& allocator);
+
+    //! Get number of additional destinations.
+    size_t num_destinations() const;
+
+    //! Add destination address.
+    //! @returns
+    //!  false if allocation failed.
+    bool add_destination(const address::SocketAddr& address);
+
+    //! Write packet to original and additional destinations.
+    virtual void write(const PacketPtr& packet);
+
+private:
+    IWriter& writer_;
+    PacketFactory& packet_factory_;
+
+    core::Array<address::SocketAddr, 1> destinations_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_FANOUT_H_
@@ -28,7 +28,13 @@ enum FecScheme {
     FEC_ReedSolomon_M8,
 
     //! LDPC-Staircase.
-    FEC_LDPC_Staircase
+    FEC_LDPC_Staircase,
+
+    //! Sliding window Random Linear Codes over GF(2^8).
+    //! @remarks
+    //!  Unlike block schemes, repair packets protect a window of recent source
+    //!  packets, which moves forward with every repair packet.
+    FEC_RLC
 };
 
 //! FECFRAME packet.
@@ -46,6 +52,10 @@ struct FEC {
     //!  Repair packets are numbered in range [k; k + n), where
     //!  k is a number of source packets per block (source_block_length)
     //!  n is a number of repair packets per block.
+    //!
+    //!  For sliding window schemes, source packets are numbered sequentially
+    //!  through the whole stream, and for repair packets this is the number
+    //!  of the first source packet in the window.
     size_t encoding_symbol_id;
 
     //! Number of a source block in a packet stream.
@@ -54,12 +64,18 @@ struct FEC {
     //!  Source block is formed from the source packets.
     //!  Blocks are numbered sequentially starting from a random number.
     //!  Block number can wrap.
+    //!
+    //!  For sliding window schemes, this is the repair key of repair packets,
+    //!  used to derive coding coefficients.
     blknum_t source_block_number;
 
     //! Number of source packets in the block to which this packet belongs to.
     //!
     //! @remarks
     //!  Different blocks can have different number of source packets.
+    //!
+    //!  For sliding window schemes, this is the number of source packets in
+    //!  the window of a repair packet.
     size_t source_block_length;
 
     //! Number of source packets and repair in the block to which this packet belongs to.
@@ -68,6 +84,9 @@ struct FEC {
     //!  Different blocks can have different number of packets.
     //!  Always larger than source_block_length.
     //!  This field is not supported on all FEC schemes.
+    //!
+    //!  For sliding window schemes, this is the density threshold of coding
+    //!  coefficients of a repair packet.
     size_t block_length;
 
     //! FECFRAME header or footer.
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/impairer.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+bool is_probability(float p) {
+    return p >= 0 && p <= 1;
+}
+
+} // namespace
+
+bool ImpairerConfig::set_loss(float loss_rate, float burst_length) {
+    if (loss_rate < 0 || loss_rate >= 1 || burst_length < 1) {
+        return false;
+    }
+
+    // Stationary probability of bad state is p / (p + r), and number of
+    // consecutive packets in bad state is geometric with mean 1 / r.
+    const float r = 1 / burst_length;
+    const float p = loss_rate * r / (1 - loss_rate);
+
+    if (p > 1) {
+        return false;
+    }
+
+    good_to_bad = p;
+    bad_to_good = r;
+    good_loss = 0;
+    bad_loss = 1;
+
+    return true;
+}
+
+bool ImpairerConfig::enabled() const {
+    return (good_to_bad > 0 && bad_loss > 0) || good_loss > 0 || delay > 0 || jitter > 0
+        || reorder > 0 || duplicate > 0;
+}
+
+bool ImpairerConfig::valid() const {
+    return is_probability(good_to_bad) && is_probability(bad_to_good)
+        && is_probability(good_loss) && is_probability(bad_loss)
+        && is_probability(reorder) && is_probability(duplicate) && delay >= 0
+        && jitter >= 0;
+}
+
+Impairer::Impairer(IWriter& writer,
+                   PacketFactory& packet_factory,
+                   core::IAllocator& allocator,
+                   const ImpairerConfig& config)
+    : writer_(writer)
+    , packet_factory_(packet_factory)
+    , config_(config)
+    , delayed_(allocator)
+    , now_(0)
+    , random_state_(config.seed)
+    , bad_state_(false)
+    , valid_(false) {
+    if (!config_.valid()) {
+        roc_log(LogError, "impairer: invalid config");
+        return;
+    }
+
+    if (random_state_ == 0) {
+        random_state_ = core::fast_random(1, (uint32_t)-1);
+    }
+
+    roc_log(LogDebug,
+            "impairer: initializing:"
+            " good_to_bad=%.4f bad_to_good=%.4f good_loss=%.4f bad_loss=%.4f"
+            " delay=%.3fms jitter=%.3fms reorder=%.4f duplicate=%.4f",
+            (double)config_.good_to_bad, (double)config_.bad_to_good,
+            (double)config_.good_loss, (double)config_.bad_loss,
+            (double)config_.delay / core::Millisecond,
+            (double)config_.jitter / core::Millisecond, (double)config_.reorder,
+            (double)config_.duplicate);
+
+    valid_ = true;
+}
+
+bool Impairer::valid() const {
+    return valid_;
+}
+
+size_t Impairer::num_delayed() const {
+    return delayed_.size();
+}
+
+void Impairer::advance(core::nanoseconds_t now) {
+    roc_panic_if(!valid());
+
+    now_ = now;
+
+    size_t n_due = 0;
+    while (n_due < delayed_.size() && delayed_[n_due].deadline <= now_) {
+        writer_.write(delayed_[n_due].packet);
+        n_due++;
+    }
+
+    if (n_due == 0) {
+        return;
+    }
+
+    for (size_t n = n_due; n < delayed_.size(); n++) {
+        delayed_[n - n_due] = delayed_[n];
+    }
+
+    if (!delayed_.resize(delayed_.size() - n_due)) {
+        roc_panic("impairer: can't shrink delay line");
+    }
+}
+
+void Impairer::write(const PacketPtr& packet) {
+    roc_panic_if(!valid());
+
+    if (!packet) {
+        roc_panic("impairer: packet is null");
+    }
+
+    if (lose_()) {
+        return;
+    }
+
+    PacketPtr copy;
+    if (config_.duplicate > 0 && random_() < config_.duplicate) {
+        copy = duplicate_(*packet);
+    }
+
+    delay_(packet);
+
+    if (copy) {
+        delay_(copy);
+    }
+}
+
+bool Impairer::lose_() {
+    if (bad_state_) {
+        if (random_() < config_.bad_to_good) {
+            bad_state_ = false;
+        }
+    } else {
+        if (random_() < config_.good_to_bad) {
+            bad_state_ = true;
+        }
+    }
+
+    const float loss = bad_state_ ? config_.bad_loss : config_.good_loss;
+
+    return loss > 0 && random_() < loss;
+}
+
+void Impairer::delay_(const PacketPtr& packet) {
+    core::nanoseconds_t delay = config_.delay;
+
+    if (config_.jitter > 0) {
+        delay += core::nanoseconds_t((random_() * 2 - 1) * (float)config_.jitter);
+        if (delay < 0) {
+            delay = 0;
+        }
+    }
+
+    if (config_.reorder > 0 && random_() < config_.reorder) {
+        delay = 0;
+    }
+
+    if (delay == 0) {
+        writer_.write(packet);
+        return;
+    }
+
+    const core::nanoseconds_t deadline = now_ + delay;
+
+    if (!delayed_.grow_exp(delayed_.size() + 1)
+        || !delayed_.resize(delayed_.size() + 1)) {
+        roc_log(LogError, "impairer: can't allocate delay line, dropping packet");
+        return;
+    }
+
+    // Keep delay line sorted by deadline. Packets with equal deadlines are kept
+    // in order of writing, so constant delay doesn't reorder packets.
+    size_t pos = delayed_.size() - 1;
+    while (pos > 0 && delayed_[pos - 1].deadline > deadline) {
+        delayed_[pos] = delayed_[pos - 1];
+        pos--;
+    }
+
+    delayed_[pos].packet = packet;
+    delayed_[pos].deadline = deadline;
+}
+
+PacketPtr Impairer::duplicate_(const Packet& packet) {
+    PacketPtr copy = packet_factory_.new_packet();
+    if (!copy) {
+        roc_log(LogError, "impairer: can't allocate packet");
+        return NULL;
+    }
+
+    copy->add_flags(packet.flags()
+                    & (Packet::FlagUDP | Packet::FlagComposed | Packet::FlagRepair));
+
+    if (const UDP* udp = packet.udp()) {
+        copy->udp()->src_addr = udp->src_addr;
+        copy->udp()->dst_addr = udp->dst_addr;
+        copy->udp()->receive_timestamp = udp->receive_timestamp;
+    }
+
+    copy->set_data(packet.data());
+
+    return copy;
+}
+
+// Xorshift32, see "Xorshift RNGs" by George Marsaglia.
+float Impairer::random_() {
+    uint32_t x = random_state_;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random_state_ = x;
+
+    // Use upper 24 bits, which fit exactly into float mantissa.
+    return (float)(x >> 8) / (float)(1 << 24);
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/impairer.h
+//! @brief Network impairment simulator.
+
+#ifndef ROC_PACKET_IMPAIRER_H_
+#define ROC_PACKET_IMPAIRER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+//! Impairer parameters.
+//! @remarks
+//!  Loss is simulated using Gilbert-Elliott model: a two-state Markov chain with
+//!  "good" and "bad" states, each having its own loss probability. State is
+//!  updated for every packet. All probabilities are in range [0; 1].
+struct ImpairerConfig {
+    //! Probability of transition from good to bad state.
+    float good_to_bad;
+
+    //! Probability of transition from bad to good state.
+    float bad_to_good;
+
+    //! Probability of packet loss in good state.
+    float good_loss;
+
+    //! Probability of packet loss in bad state.
+    float bad_loss;
+
+    //! Constant packet delay, nanoseconds.
+    core::nanoseconds_t delay;
+
+    //! Maximum random deviation from delay, nanoseconds.
+    //! Actual delay is uniformly distributed in [delay - jitter; delay + jitter].
+    //! Packets that got different delays may be reordered.
+    core::nanoseconds_t jitter;
+
+    //! Probability of sending packet without delay.
+    //! Such packet overtakes packets that are currently delayed.
+    float reorder;
+
+    //! Probability of sending packet twice.
+    float duplicate;
+
+    //! Seed of random number generator.
+    //! If zero, random seed is used. Same non-zero seed and same input
+    //! produce same impairments.
+    uint32_t seed;
+
+    ImpairerConfig()
+        : good_to_bad(0)
+        , bad_to_good(1)
+        , good_loss(0)
+        , bad_loss(1)
+        , delay(0)
+        , jitter(0)
+        , reorder(0)
+        , duplicate(0)
+        , seed(0) {
+    }
+
+    //! Configure simple Gilbert model from loss rate and mean burst length.
+    //! @remarks
+    //!  All packets are lost in bad state and none in good state. @p loss_rate is
+    //!  the long-term fraction of lost packets, in range [0; 1), and
+    //!  @p burst_length is the mean number of consecutive lost packets, >= 1.
+    //!  Loss rate can't exceed burst_length / (burst_length + 1).
+    //! @returns
+    //!  false if parameters are out of range.
+    bool set_loss(float loss_rate, float burst_length);
+
+    //! Check if any impairment is enabled.
+    bool enabled() const;
+
+    //! Check if parameters are in valid ranges.
+    bool valid() const;
+};
+
+//! Network impairment simulator.
+//!
+//! Drops, delays, reorders, and duplicates packets written to it, and writes
+//! the rest to the output writer. Packets are dropped and duplicated as they
+//! are written; delayed packets are held and written to output when advance()
+//! reaches their deadline.
+//!
+//! Only packet data and UDP header are preserved in duplicates, so impairer
+//! should be placed before parser on receiver, and after composer on sender.
+class Impairer : public IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p writer is used to write packets that passed impairment
+    //!  - @p packet_factory is used to allocate duplicates
+    //!  - @p allocator is used to allocate delay line
+    //!  - @p config defines impairment parameters
+    Impairer(IWriter& writer,
+             PacketFactory& packet_factory,
+             core::IAllocator& allocator,
+             const ImpairerConfig& config);
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get number of packets currently held in delay line.
+    size_t num_delayed() const;
+
+    //! Advance current time.
+    //! @remarks
+    //!  Writes delayed packets whose deadline is not after @p now to output.
+    //!  Delays of packets written afterwards are counted from @p now.
+    void advance(core::nanoseconds_t now);
+
+    //! Write packet.
+    virtual void write(const PacketPtr& packet);
+
+private:
+    struct Entry {
+        PacketPtr packet;
+        core::nanoseconds_t deadline;
+
+        Entry()
+            : deadline(0) {
+        }
+    };
+
+    bool lose_();
+    void delay_(const PacketPtr& packet);
+    PacketPtr duplicate_(const Packet& packet);
+
+    float random_();
+
+    IWriter& writer_;
+    PacketFactory& packet_factory_;
+
+    const ImpairerConfig config_;
+
+    core::Array<Entry> delayed_;
+
+    core::nanoseconds_t now_;
+
+    uint32_t random_state_;
+    bool bad_state_;
+
+    bool valid_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_IMPAIRER_H_
@@ -13,9 +13,13 @@
 namespace roc {
 namespace packet {
 
-Interleaver::Interleaver(IWriter& writer, core::IAllocator& allocator, size_t block_sz)
+Interleaver::Interleaver(IWriter& writer,
+                         core::IAllocator& allocator,
+                         size_t block_sz,
+                         size_t max_delay)
     : writer_(writer)
     , block_size_(block_sz)
+    , max_delay_(block_sz - 1)
     , send_seq_(allocator)
     , packets_(allocator)
     , next_2_put_(0)
@@ -30,9 +34,18 @@ Interleaver::Interleaver(IWriter& writer, core::IAllocator& allocator, size_t bl
         return;
     }
 
-    reinit_seq_();
+    if (max_delay != 0 && max_delay < max_delay_) {
+        max_delay_ = max_delay;
 
-    roc_log(LogDebug, "initializing interleaver: block_size=%u", (unsigned)block_size_);
+        if (!reinit_bounded_seq_(allocator)) {
+            return;
+        }
+    } else {
+        reinit_seq_();
+    }
+
+    roc_log(LogDebug, "initializing interleaver: block_size=%u max_delay=%u",
+            (unsigned)block_size_, (unsigned)max_delay_);
 
     for (size_t i = 0; i < block_size_; ++i) {
         roc_log(LogTrace, "  interleaver_seq[%u]: %u", (unsigned)i,
@@ -76,6 +89,10 @@ size_t Interleaver::block_size() const {
     return block_size_;
 }
 
+size_t Interleaver::max_delay() const {
+    return max_delay_;
+}
+
 void Interleaver::reinit_seq_() {
     for (size_t i = 0; i < block_size_; ++i) {
         send_seq_[i] = i;
@@ -88,5 +105,54 @@ void Interleaver::reinit_seq_() {
     }
 }
 
+bool Interleaver::reinit_bounded_seq_(core::IAllocator& allocator) {
+    core::Array<bool> used(allocator);
+    if (!used.resize(block_size_)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < block_size_; ++i) {
+        used[i] = false;
+    }
+
+    // Packet at position n of the sequence is sent when all packets before it
+    // are sent, i.e. when the largest of them is written. Picking every next
+    // packet among unsent ones not further than max_delay_ from the first
+    // unsent one guarantees that the largest packet sent so far is never more
+    // than max_delay_ ahead of the current one.
+    size_t first_unused = 0;
+
+    for (size_t n = 0; n < block_size_; ++n) {
+        while (used[first_unused]) {
+            first_unused++;
+        }
+
+        const size_t last = std::min(first_unused + max_delay_, block_size_ - 1);
+
+        size_t n_candidates = 0;
+        for (size_t i = first_unused; i <= last; ++i) {
+            if (!used[i]) {
+                n_candidates++;
+            }
+        }
+
+        size_t pick = core::fast_random(0, (unsigned int)n_candidates - 1);
+
+        for (size_t i = first_unused; i <= last; ++i) {
+            if (used[i]) {
+                continue;
+            }
+            if (pick == 0) {
+                used[i] = true;
+                send_seq_[n] = i;
+                break;
+            }
+            pick--;
+        }
+    }
+
+    return true;
+}
+
 } // namespace packet
 } // namespace roc
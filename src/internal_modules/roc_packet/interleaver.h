@@ -22,13 +22,25 @@ namespace roc {
 namespace packet {
 
 //! Interleaves packets to transmit them in pseudo random order.
+//! @remarks
+//!  Packets are reordered within blocks of fixed size, using the same pseudo
+//!  random permutation for every block, computed once on construction.
+//!  Optionally, the permutation can be constrained so that every packet is
+//!  delayed by at most given number of packets, which allows to use large
+//!  blocks without adding a whole block of latency.
 class Interleaver : public IWriter, public core::NonCopyable<> {
 public:
     //! Initialize.
     //! @remarks
     //!  Interleaver reorders packets passed to write() and writes
     //!  them to @p output.
-    Interleaver(IWriter& writer, core::IAllocator& allocator, size_t block_size);
+    //!  If @p max_delay is non-zero, every packet is written to output
+    //!  at most @p max_delay packets after it was passed to write().
+    //!  Otherwise, delay is limited only by @p block_size.
+    Interleaver(IWriter& writer,
+                core::IAllocator& allocator,
+                size_t block_size,
+                size_t max_delay = 0);
 
     //! Check if object is successfully constructed.
     bool valid() const;
@@ -46,16 +58,26 @@ public:
     //! in terms of packets number.
     size_t block_size() const;
 
+    //! Maximum delay between writing packet and moment we get it in output
+    //! in terms of packets number, taking delay limit into account.
+    size_t max_delay() const;
+
 private:
-    //! Initialize tx_seq_ to a new randomized sequence.
+    //! Initialize send_seq_ to a new randomized sequence.
     void reinit_seq_();
 
+    //! Initialize send_seq_ to a new randomized sequence with limited delay.
+    bool reinit_bounded_seq_(core::IAllocator& allocator);
+
     // Output writer.
     IWriter& writer_;
 
     // Number of packets in block.
     size_t block_size_;
 
+    // Maximum delay of a packet, in packets.
+    size_t max_delay_;
+
     // Output sequence.
     core::Array<size_t> send_seq_;
 
@@ -14,5 +14,12 @@ namespace packet {
 IWriter::~IWriter() {
 }
 
+void IWriter::write_batch(core::List<Packet>& packets) {
+    while (PacketPtr packet = packets.front()) {
+        packets.remove(*packet);
+        write(packet);
+    }
+}
+
 } // namespace packet
 } // namespace roc
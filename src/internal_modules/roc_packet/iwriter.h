@@ -12,6 +12,7 @@
 #ifndef ROC_PACKET_IWRITER_H_
 #define ROC_PACKET_IWRITER_H_
 
+#include "roc_core/list.h"
 #include "roc_packet/packet.h"
 
 namespace roc {
@@ -24,6 +25,13 @@ public:
 
     //! Write packet.
     virtual void write(const PacketPtr&) = 0;
+
+    //! Write multiple packets.
+    //! @remarks
+    //!  Removes all packets from @p packets and writes them in the same order.
+    //!  Default implementation calls write() for every packet. Writers for which
+    //!  per-packet hand-off is expensive may override it.
+    virtual void write_batch(core::List<Packet>& packets);
 };
 
 } // namespace packet
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/multiplexer.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+size_t subheader_size(size_t packet_size) {
+    return packet_size < 0x80 ? 1 : 2;
+}
+
+} // namespace
+
+Multiplexer::Multiplexer(IWriter& writer,
+                         PacketFactory& packet_factory,
+                         core::BufferFactory<uint8_t>& buffer_factory,
+                         size_t max_size)
+    : writer_(writer)
+    , packet_factory_(packet_factory)
+    , buffer_factory_(buffer_factory)
+    , max_size_(max_size)
+    , buffer_limit_(0)
+    , n_packets_(0) {
+    roc_log(LogDebug, "multiplexer: initializing: max_size=%lu",
+            (unsigned long)max_size_);
+}
+
+void Multiplexer::write(const PacketPtr& packet) {
+    if (!packet) {
+        roc_panic("multiplexer: packet is null");
+    }
+
+    const size_t packet_size = packet->data().size();
+
+    if (packet_size == 0 || packet_size > MaxSubpacketSize) {
+        roc_log(LogError, "multiplexer: unexpected packet size: size=%lu",
+                (unsigned long)packet_size);
+        return;
+    }
+
+    const size_t entry_size = subheader_size(packet_size) + packet_size;
+
+    if (datagram_ && buffer_.size() + entry_size > buffer_limit_) {
+        end_datagram_();
+    }
+
+    if (!datagram_) {
+        if (!begin_datagram_(*packet)) {
+            return;
+        }
+
+        if (buffer_.size() + entry_size > buffer_limit_) {
+            roc_log(LogError,
+                    "multiplexer: packet doesn't fit into datagram:"
+                    " packet_size=%lu max_datagram_size=%lu",
+                    (unsigned long)packet_size, (unsigned long)buffer_limit_);
+            datagram_ = NULL;
+            buffer_ = core::Slice<uint8_t>();
+            return;
+        }
+    }
+
+    const size_t pos = buffer_.size();
+    buffer_.reslice(0, pos + entry_size);
+
+    uint8_t* entry = buffer_.data() + pos;
+
+    if (packet_size < 0x80) {
+        *entry++ = uint8_t(packet_size);
+    } else {
+        *entry++ = uint8_t(0x80 | (packet_size >> 8));
+        *entry++ = uint8_t(packet_size & 0xff);
+    }
+
+    memcpy(entry, packet->data().data(), packet_size);
+
+    n_packets_++;
+}
+
+void Multiplexer::flush() {
+    if (datagram_) {
+        end_datagram_();
+    }
+}
+
+bool Multiplexer::begin_datagram_(const Packet& packet) {
+    datagram_ = packet_factory_.new_packet();
+    if (!datagram_) {
+        roc_log(LogError, "multiplexer: can't allocate packet");
+        return false;
+    }
+
+    buffer_ = buffer_factory_.new_buffer();
+    if (!buffer_) {
+        roc_log(LogError, "multiplexer: can't allocate buffer");
+        datagram_ = NULL;
+        return false;
+    }
+
+    buffer_limit_ = std::min(max_size_, buffer_.capacity());
+
+    buffer_.reslice(0, 1);
+    buffer_.data()[0] = Marker;
+
+    if (packet.udp()) {
+        datagram_->add_flags(Packet::FlagUDP);
+        datagram_->udp()->src_addr = packet.udp()->src_addr;
+        datagram_->udp()->dst_addr = packet.udp()->dst_addr;
+    }
+
+    if (packet.flags() & Packet::FlagRepair) {
+        datagram_->add_flags(Packet::FlagRepair);
+    }
+
+    datagram_->add_flags(Packet::FlagComposed);
+
+    n_packets_ = 0;
+
+    return true;
+}
+
+void Multiplexer::end_datagram_() {
+    roc_log(LogTrace, "multiplexer: writing datagram: n_packets=%lu size=%lu",
+            (unsigned long)n_packets_, (unsigned long)buffer_.size());
+
+    datagram_->set_data(buffer_);
+
+    writer_.write(datagram_);
+
+    datagram_ = NULL;
+    buffer_ = core::Slice<uint8_t>();
+}
+
+} // namespace packet
+} // namespace roc
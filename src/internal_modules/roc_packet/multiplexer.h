@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/multiplexer.h
+//! @brief Combines packets into datagrams.
+
+#ifndef ROC_PACKET_MULTIPLEXER_H_
+#define ROC_PACKET_MULTIPLEXER_H_
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+//! Combines consecutive composed packets into multiplexed datagrams.
+//!
+//! Datagram format:
+//!  - one byte marker, which has zero in the two bits where RTP and RTCP
+//!    packets have version 2, so it can't be confused with them
+//!  - one or more sub-packets, each prefixed with its length, encoded
+//!    in one byte if it's below 128, and in two bytes otherwise
+//!
+//! Sub-packets are copied into datagram unchanged. Datagram inherits UDP
+//! addresses and repair flag of its first sub-packet, so all packets written
+//! to the same multiplexer are expected to have the same destination and type.
+class Multiplexer : public IWriter, public core::NonCopyable<> {
+public:
+    enum {
+        //! First byte of multiplexed datagram.
+        Marker = 0x20,
+
+        //! Maximum size of sub-packet.
+        MaxSubpacketSize = 0x7FFF
+    };
+
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p writer is used to write datagrams
+    //!  - @p packet_factory and @p buffer_factory are used to allocate datagrams
+    //!  - @p max_size defines maximum datagram size; it's also limited by
+    //!    buffer size of @p buffer_factory
+    Multiplexer(IWriter& writer,
+                PacketFactory& packet_factory,
+                core::BufferFactory<uint8_t>& buffer_factory,
+                size_t max_size);
+
+    //! Add packet to current datagram.
+    //! @remarks
+    //!  If packet doesn't fit into current datagram, the datagram is
+    //!  written to output writer and a new one is started.
+    virtual void write(const PacketPtr& packet);
+
+    //! Write current datagram, if any.
+    void flush();
+
+private:
+    bool begin_datagram_(const Packet& packet);
+    void end_datagram_();
+
+    IWriter& writer_;
+
+    PacketFactory& packet_factory_;
+    core::BufferFactory<uint8_t>& buffer_factory_;
+
+    const size_t max_size_;
+
+    PacketPtr datagram_;
+    core::Slice<uint8_t> buffer_;
+    size_t buffer_limit_;
+    size_t n_packets_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_MULTIPLEXER_H_
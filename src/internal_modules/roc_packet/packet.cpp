@@ -13,13 +13,34 @@ namespace packet {
 
 Packet::Packet(PacketFactory& factory)
     : RefCounted(factory)
-    , flags_(0) {
+    , flags_(0)
+    , inline_buffer_(NULL) {
+}
+
+Packet::~Packet() {
+    if (FEC* f = fec()) {
+        f->~FEC();
+    }
+    if (RTCP* r = rtcp()) {
+        r->~RTCP();
+    }
 }
 
 void Packet::add_flags(unsigned fl) {
     if (flags_ & fl) {
         roc_panic("packet: can't add flag more than once");
     }
+    if (((flags_ | fl) & FlagFEC) && ((flags_ | fl) & FlagRTCP)) {
+        roc_panic("packet: can't combine fec and rtcp flags");
+    }
+
+    if (fl & FlagFEC) {
+        new (proto_.memory()) FEC();
+    }
+    if (fl & FlagRTCP) {
+        new (proto_.memory()) RTCP();
+    }
+
     flags_ |= fl;
 }
 
@@ -57,28 +78,28 @@ RTP* Packet::rtp() {
 
 const FEC* Packet::fec() const {
     if (flags_ & FlagFEC) {
-        return &fec_;
+        return (const FEC*)proto_.memory();
     }
     return NULL;
 }
 
 FEC* Packet::fec() {
     if (flags_ & FlagFEC) {
-        return &fec_;
+        return (FEC*)proto_.memory();
     }
     return NULL;
 }
 
 const RTCP* Packet::rtcp() const {
     if (flags_ & FlagRTCP) {
-        return &rtcp_;
+        return (const RTCP*)proto_.memory();
     }
     return NULL;
 }
 
 RTCP* Packet::rtcp() {
     if (flags_ & FlagRTCP) {
-        return &rtcp_;
+        return (RTCP*)proto_.memory();
     }
     return NULL;
 }
@@ -97,6 +118,13 @@ void Packet::set_data(const core::Slice<uint8_t>& d) {
     data_ = d;
 }
 
+core::Slice<uint8_t> Packet::inline_buffer() const {
+    if (!inline_buffer_) {
+        return core::Slice<uint8_t>();
+    }
+    return core::Slice<uint8_t>(*inline_buffer_, 0, inline_buffer_->size());
+}
+
 source_t Packet::source() const {
     if (const RTP* r = rtp()) {
         return r->source;
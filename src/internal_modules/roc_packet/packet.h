@@ -12,6 +12,7 @@
 #ifndef ROC_PACKET_PACKET_H_
 #define ROC_PACKET_PACKET_H_
 
+#include "roc_core/aligned_storage.h"
 #include "roc_core/list_node.h"
 #include "roc_core/macro_helpers.h"
 #include "roc_core/mpsc_queue_node.h"
@@ -42,20 +43,27 @@ public:
     //! Constructor.
     explicit Packet(PacketFactory&);
 
+    //! Destructor.
+    ~Packet();
+
     //! Packet flags.
     enum {
         FlagUDP = (1 << 0),      //!< Packet contains UDP header.
         FlagRTP = (1 << 1),      //!< Packet contains RTP header.
         FlagFEC = (1 << 2),      //!< Packet contains FEC header.
         FlagRTCP = (1 << 3),     //!< Packet contains RTCP compound packet.
+                                 //!< Can't be combined with FlagFEC.
         FlagAudio = (1 << 4),    //!< Packet contains audio samples.
         FlagRepair = (1 << 5),   //!< Packet contains repair FEC symbols.
         FlagControl = (1 << 6),  //!< Packet contains control message.
         FlagComposed = (1 << 7), //!< Packet is already composed.
-        FlagRestored = (1 << 8)  //!< Packet was restored using FEC decoder.
+        FlagRestored = (1 << 8), //!< Packet was restored using FEC decoder.
+        FlagZeros = (1 << 9)     //!< Packet audio samples are all zero.
     };
 
     //! Add flags.
+    //! @remarks
+    //!  Adding FlagFEC or FlagRTCP constructs corresponding zero header.
     void add_flags(unsigned flags);
 
     //! Get flags.
@@ -91,6 +99,13 @@ public:
     //! Set packet data.
     void set_data(const core::Slice<uint8_t>& data);
 
+    //! Get inline buffer.
+    //! @returns
+    //!  slice of the whole buffer allocated together with the packet by
+    //!  PacketFactory::new_packet_with_buffer(), or empty slice if packet
+    //!  has no inline buffer.
+    core::Slice<uint8_t> inline_buffer() const;
+
     //! Return packet stream identifier.
     //! @remarks
     //!  The returning value depends on packet type. For some packet types, may
@@ -127,14 +142,28 @@ public:
     }
 
 private:
+    friend class PacketFactory;
+
+    // Fields are ordered by access frequency. Flags and RTP header fields used
+    // by queues and depacketizer on every packet (source, seqnum, timestamp,
+    // duration, payload) are placed right after list hooks, so that they
+    // occupy first two cache lines.
+
     unsigned flags_;
 
-    UDP udp_;
     RTP rtp_;
-    FEC fec_;
-    RTCP rtcp_;
 
     core::Slice<uint8_t> data_;
+
+    // FEC and RTCP are never used together, so they share storage; the
+    // active header is determined by flags and constructed by add_flags()
+    core::AlignedStorage<ROC_MAX(sizeof(FEC), sizeof(RTCP))> proto_;
+
+    // UDP addresses are used only by network and routing code
+    UDP udp_;
+
+    // set if packet was allocated in the same chunk as this buffer
+    core::Buffer<uint8_t>* inline_buffer_;
 };
 
 } // namespace packet
@@ -7,20 +7,92 @@
  */
 
 #include "roc_packet/packet_factory.h"
+#include "roc_core/buffer.h"
+#include "roc_core/panic.h"
 #include "roc_packet/packet.h"
 
 namespace roc {
 namespace packet {
 
 PacketFactory::PacketFactory(core::IAllocator& allocator, bool poison)
-    : pool_(allocator, sizeof(Packet), poison) {
+    : pool_(allocator, sizeof(Packet), poison, 0, 0, true)
+    , inline_buffers_(allocator, 0, poison, sizeof(Packet)) {
+}
+
+PacketFactory::PacketFactory(core::IAllocator& allocator,
+                             size_t buffer_size,
+                             bool poison)
+    : pool_(allocator, sizeof(Packet), poison, 0, 0, true)
+    , inline_buffers_(allocator, buffer_size, poison, sizeof(Packet)) {
+}
+
+size_t PacketFactory::inline_buffer_size() const {
+    return inline_buffers_.buffer_size();
+}
+
+bool PacketFactory::reserve(size_t n_packets) {
+    if (inline_buffers_.buffer_size() != 0) {
+        return inline_buffers_.reserve(n_packets);
+    }
+    return pool_.reserve(n_packets);
+}
+
+void PacketFactory::set_limit(size_t max_packets) {
+    pool_.set_limit(max_packets);
+    inline_buffers_.set_limit(max_packets);
+}
+
+size_t PacketFactory::num_failed_allocations() const {
+    return pool_.num_failed_allocations() + inline_buffers_.num_failed_allocations();
+}
+
+core::SlabPoolStats PacketFactory::pool_stats() const {
+    return pool_.stats();
+}
+
+core::SlabPoolStats PacketFactory::inline_pool_stats() const {
+    return inline_buffers_.pool_stats();
 }
 
 core::SharedPtr<Packet> PacketFactory::new_packet() {
     return new (pool_) Packet(*this);
 }
 
+core::SharedPtr<Packet> PacketFactory::new_packet_with_buffer() {
+    if (inline_buffers_.buffer_size() == 0) {
+        roc_panic("packet factory: inline buffers are disabled");
+    }
+
+    core::SharedPtr<core::Buffer<uint8_t> > buffer = inline_buffers_.new_buffer();
+    if (!buffer) {
+        return NULL;
+    }
+
+    Packet* packet = new (inline_buffers_.buffer_header(*buffer)) Packet(*this);
+
+    // packet holds a reference to its own memory, released in destroy()
+    buffer->incref();
+    packet->inline_buffer_ = buffer.get();
+
+    return packet;
+}
+
+Packet& PacketFactory::inline_buffer_owner(core::Buffer<uint8_t>& buffer) {
+    Packet* packet = (Packet*)inline_buffers_.buffer_header(buffer);
+    roc_panic_if_not(packet->inline_buffer_ == &buffer);
+
+    return *packet;
+}
+
 void PacketFactory::destroy(Packet& packet) {
+    if (core::Buffer<uint8_t>* buffer = packet.inline_buffer_) {
+        // memory is freed when the last reference to the buffer is released,
+        // which may happen later if there are other slices of the buffer
+        packet.~Packet();
+        buffer->decref();
+        return;
+    }
+
     pool_.destroy_object(packet);
 }
 
@@ -13,6 +13,7 @@
 #define ROC_PACKET_PACKET_FACTORY_H_
 
 #include "roc_core/allocation_policy.h"
+#include "roc_core/buffer_factory.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/shared_ptr.h"
 #include "roc_core/slab_pool.h"
@@ -23,20 +24,75 @@ namespace packet {
 class Packet;
 
 //! Packet factory.
+//! @remarks
+//!  Optionally, can allocate packets with inline buffers, when packet and its
+//!  payload buffer are placed into the same memory chunk. This requires one
+//!  allocation instead of two per every packet and improves locality.
 class PacketFactory : public core::NonCopyable<> {
 public:
     //! Constructor.
     PacketFactory(core::IAllocator& allocator, bool poison);
 
+    //! Constructor with inline buffers.
+    //! @remarks
+    //!  @p buffer_size defines size of inline buffers allocated by
+    //!  new_packet_with_buffer().
+    PacketFactory(core::IAllocator& allocator, size_t buffer_size, bool poison);
+
+    //! Get size of inline buffers.
+    //! @returns
+    //!  zero if inline buffers are disabled.
+    size_t inline_buffer_size() const;
+
+    //! Preallocate memory for given number of packets.
+    //! @remarks
+    //!  If inline buffers are enabled, reserves packets with inline buffers,
+    //!  otherwise reserves regular packets.
+    //! @returns
+    //!  false if allocation failed.
+    bool reserve(size_t n_packets);
+
+    //! Limit total number of packets.
+    //! @remarks
+    //!  Zero means no limit. The limit is applied separately to regular packets
+    //!  and to packets with inline buffers.
+    void set_limit(size_t max_packets);
+
+    //! Get number of failed allocations.
+    size_t num_failed_allocations() const;
+
+    //! Get statistics of pool for packets without inline buffers.
+    core::SlabPoolStats pool_stats() const;
+
+    //! Get statistics of pool for packets with inline buffers.
+    core::SlabPoolStats inline_pool_stats() const;
+
     //! Create new packet;
     core::SharedPtr<Packet> new_packet();
 
+    //! Create new packet with inline buffer.
+    //! @remarks
+    //!  Packet and buffer are allocated using single allocation. Packet data
+    //!  is not set; the buffer can be accessed using Packet::inline_buffer().
+    //!  Buffer will be kept alive while the packet or any slice of the buffer
+    //!  exists.
+    //! @pre
+    //!  Factory should be constructed with non-zero buffer size.
+    core::SharedPtr<Packet> new_packet_with_buffer();
+
+    //! Get packet owning inline buffer.
+    //! @pre
+    //!  @p buffer should be allocated by new_packet_with_buffer() and the packet
+    //!  should still exist.
+    Packet& inline_buffer_owner(core::Buffer<uint8_t>& buffer);
+
 private:
     friend class core::FactoryAllocation<PacketFactory>;
 
     void destroy(Packet&);
 
     core::SlabPool pool_;
+    core::BufferFactory<uint8_t> inline_buffers_;
 };
 
 } // namespace packet
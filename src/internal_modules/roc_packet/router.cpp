@@ -7,14 +7,24 @@
  */
 
 #include "roc_packet/router.h"
+#include "roc_core/hashsum.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 
 namespace roc {
 namespace packet {
 
+namespace {
+
+size_t cache_index(unsigned flags, source_t source, size_t cache_size) {
+    return (size_t)(core::hashsum_int((uint32_t)source) ^ flags) & (cache_size - 1);
+}
+
+} // namespace
+
 Router::Router(core::IAllocator& allocator)
     : routes_(allocator) {
+    invalidate_cache_();
 }
 
 bool Router::add_route(IWriter& writer, unsigned flags) {
@@ -30,6 +40,11 @@ bool Router::add_route(IWriter& writer, unsigned flags) {
     r.has_source = false;
 
     routes_.push_back(r);
+
+    // routes could be reallocated, and packets that were dropped before
+    // may now match new route
+    invalidate_cache_();
+
     return true;
 }
 
@@ -38,19 +53,36 @@ void Router::write(const PacketPtr& packet) {
         roc_panic("router: unexpected null packet");
     }
 
+    const unsigned pkt_flags = packet->flags();
+    const source_t pkt_source = packet->source();
+
+    CacheEntry& entry = cache_[cache_index(pkt_flags, pkt_source, CacheSize)];
+
+    if (!entry.valid || entry.flags != pkt_flags || entry.source != pkt_source) {
+        entry.flags = pkt_flags;
+        entry.source = pkt_source;
+        entry.route = find_route_(pkt_flags, pkt_source);
+        entry.valid = true;
+    }
+
+    if (!entry.route) {
+        roc_log(LogDebug, "router: can't route packet, dropping");
+        return;
+    }
+
+    entry.route->writer->write(packet);
+}
+
+Router::Route* Router::find_route_(unsigned pkt_flags, source_t pkt_source) {
     for (size_t n = 0; n < routes_.size(); n++) {
         Route& r = routes_[n];
 
-        const unsigned pkt_flags = packet->flags();
-
         if (r.flags != 0) {
             if ((r.flags & pkt_flags) != r.flags) {
                 continue;
             }
         }
 
-        const source_t pkt_source = packet->source();
-
         if (r.has_source) {
             if (r.source != pkt_source) {
                 continue;
@@ -63,11 +95,16 @@ void Router::write(const PacketPtr& packet) {
                     (unsigned long)r.source, (unsigned int)r.flags);
         }
 
-        r.writer->write(packet);
-        return;
+        return &r;
     }
 
-    roc_log(LogDebug, "router: can't route packet, dropping");
+    return NULL;
+}
+
+void Router::invalidate_cache_() {
+    for (size_t n = 0; n < CacheSize; n++) {
+        cache_[n].valid = false;
+    }
 }
 
 } // namespace packet
@@ -23,6 +23,15 @@ namespace roc {
 namespace packet {
 
 //! Route packets to writers.
+//! @remarks
+//!  Every route is bound to the source of the first packet routed to it.
+//!  A packet is routed to the first route which flags are set in packet
+//!  and which is unbound or bound to packet source.
+//!
+//!  Since routes are never unbound, the route selected for given packet flags
+//!  and source never changes until new route is added. Router remembers recent
+//!  decisions in a small direct-mapped cache, so that the routes are scanned
+//!  only for the first packet of every stream.
 class Router : public IWriter, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -39,6 +48,8 @@ public:
     virtual void write(const PacketPtr& packet);
 
 private:
+    enum { CacheSize = 16 };
+
     struct Route {
         IWriter* writer;
         unsigned flags;
@@ -46,7 +57,20 @@ private:
         bool has_source;
     };
 
+    struct CacheEntry {
+        unsigned flags;
+        source_t source;
+        Route* route;
+        bool valid;
+    };
+
+    Route* find_route_(unsigned pkt_flags, source_t pkt_source);
+
+    void invalidate_cache_();
+
     core::Array<Route, 2> routes_;
+
+    CacheEntry cache_[CacheSize];
 };
 
 } // namespace packet
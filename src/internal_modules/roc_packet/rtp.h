@@ -53,6 +53,12 @@ struct RTP {
     //! Packet payload type.
     unsigned int payload_type;
 
+    //! Capture time of the first sample in packet.
+    //! @remarks
+    //!  NTP timestamp in sender clock, transferred in RTP header extension.
+    //!  Zero if unknown.
+    ntp_timestamp_t capture_timestamp;
+
     //! Packet header.
     core::Slice<uint8_t> header;
 
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/seqnum_queue.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace packet {
+
+SeqnumQueue::SeqnumQueue(core::IAllocator& allocator, size_t max_size)
+    : ring_(allocator)
+    , begin_(0)
+    , end_(0)
+    , size_(0)
+    , max_size_(max_size)
+    , valid_(false) {
+    if (!ring_.resize(InitialWindow)) {
+        roc_log(LogError, "seqnum queue: can't allocate window: size=%u",
+                (unsigned)InitialWindow);
+        return;
+    }
+
+    valid_ = true;
+}
+
+bool SeqnumQueue::valid() const {
+    return valid_;
+}
+
+PacketPtr SeqnumQueue::read() {
+    roc_panic_if(!valid_);
+
+    if (size_ == 0) {
+        return NULL;
+    }
+
+    PacketPtr packet = ring_[slot_(begin_)];
+    roc_panic_if(!packet);
+
+    ring_[slot_(begin_)] = NULL;
+    size_--;
+
+    if (size_ == 0) {
+        begin_ = end_;
+        return packet;
+    }
+
+    // skip lost packets; every slot is skipped at most once
+    do {
+        begin_++;
+    } while (!ring_[slot_(begin_)]);
+
+    return packet;
+}
+
+void SeqnumQueue::write(const PacketPtr& packet) {
+    roc_panic_if(!valid_);
+
+    if (!packet) {
+        roc_panic("seqnum queue: attempting to add null packet");
+    }
+
+    const RTP* rtp = packet->rtp();
+    if (!rtp) {
+        roc_log(LogDebug, "seqnum queue: dropping packet without rtp header");
+        return;
+    }
+
+    if (max_size_ > 0 && size_ == max_size_) {
+        roc_log(LogDebug,
+                "seqnum queue: queue is full, dropping packet:"
+                " max_size=%u",
+                (unsigned)max_size_);
+        return;
+    }
+
+    const seqnum_t sn = rtp->seqnum;
+
+    if (size_ == 0) {
+        begin_ = sn;
+        end_ = sn + 1;
+    } else if (seqnum_lt(sn, begin_)) {
+        if (!grow_((size_t)(seqnum_t)(end_ - sn))) {
+            return;
+        }
+        begin_ = sn;
+    } else if (!seqnum_lt(sn, end_)) {
+        if (!grow_((size_t)(seqnum_t)(sn - begin_) + 1)) {
+            return;
+        }
+        end_ = sn + 1;
+    } else if (ring_[slot_(sn)]) {
+        roc_log(LogDebug, "seqnum queue: dropping duplicate packet");
+        return;
+    }
+
+    if (!latest_ || latest_->compare(*packet) <= 0) {
+        latest_ = packet;
+    }
+
+    ring_[slot_(sn)] = packet;
+    size_++;
+}
+
+size_t SeqnumQueue::size() const {
+    return size_;
+}
+
+Packet* SeqnumQueue::head() const {
+    if (size_ == 0) {
+        return NULL;
+    }
+    return ring_[slot_(begin_)].get();
+}
+
+Packet* SeqnumQueue::tail() const {
+    if (size_ == 0) {
+        return NULL;
+    }
+    return ring_[slot_(seqnum_t(end_ - 1))].get();
+}
+
+Packet* SeqnumQueue::latest() const {
+    return latest_.get();
+}
+
+size_t SeqnumQueue::slot_(seqnum_t sn) const {
+    return (size_t)sn & (ring_.size() - 1);
+}
+
+bool SeqnumQueue::grow_(size_t span) {
+    if (span <= ring_.size()) {
+        return true;
+    }
+
+    if (span > MaxWindow) {
+        roc_log(LogDebug,
+                "seqnum queue: packet doesn't fit into window, dropping packet:"
+                " span=%lu max_window=%lu",
+                (unsigned long)span, (unsigned long)MaxWindow);
+        return false;
+    }
+
+    size_t new_size = ring_.size();
+    while (new_size < span) {
+        new_size *= 2;
+    }
+
+    const size_t old_size = ring_.size();
+
+    if (!ring_.resize(new_size)) {
+        roc_log(LogError, "seqnum queue: can't grow window: size=%lu",
+                (unsigned long)new_size);
+        return false;
+    }
+
+    roc_log(LogDebug, "seqnum queue: growing window: old_size=%lu new_size=%lu",
+            (unsigned long)old_size, (unsigned long)new_size);
+
+    // current window fits into old ring, so every slot holds at most one packet
+    // and new slots are empty; move packets which slot changed with new mask
+    for (size_t n = 0; n < old_size; n++) {
+        if (!ring_[n]) {
+            continue;
+        }
+        const size_t new_slot = slot_(ring_[n]->rtp()->seqnum);
+        if (new_slot != n) {
+            ring_[new_slot] = ring_[n];
+            ring_[n] = NULL;
+        }
+    }
+
+    return true;
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/seqnum_queue.h
+//! @brief Seqnum-indexed packet queue.
+
+#ifndef ROC_PACKET_SEQNUM_QUEUE_H_
+#define ROC_PACKET_SEQNUM_QUEUE_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_packet/ireader.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace packet {
+
+//! Packet queue sorted by RTP seqnum.
+//! @remarks
+//!  Provides the same interface as SortedQueue, but instead of a sorted list,
+//!  stores packets in a circular window indexed by seqnum. Insertion, duplicate
+//!  detection and removal of the first packet take constant time regardless of
+//!  queue size and reordering. Window grows when packets don't fit into it.
+//!  Only packets with RTP header are accepted. Like in SortedQueue, peeked
+//!  packets are returned as borrowed pointers.
+class SeqnumQueue : public IWriter, public IReader, public core::NonCopyable<> {
+public:
+    //! Construct empty queue.
+    //! @remarks
+    //!  If @p max_size is non-zero, it specifies maximum number of packets in queue.
+    SeqnumQueue(core::IAllocator& allocator, size_t max_size);
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Add packet to the queue.
+    //! @remarks
+    //!  - if the maximum queue size is reached, packet is dropped
+    //!  - if packet has the same seqnum as another packet in the queue, it is dropped
+    //!  - if packet doesn't fit into maximum window size, it is dropped
+    //!  - otherwise, packet is inserted into the queue, keeping the queue sorted
+    virtual void write(const PacketPtr& packet);
+
+    //! Read next packet.
+    //! @returns
+    //!  the first packet in the queue or null if there are no packets
+    //! @remarks
+    //!  Removes returned packet from the queue.
+    virtual PacketPtr read();
+
+    //! Get number of packets in queue.
+    size_t size() const;
+
+    //! Get first packet in the queue.
+    //! @returns
+    //!  the first packet in the queue or null if there are no packets
+    //! @remarks
+    //!  Returned packet is not removed from the queue. Returned pointer is
+    //!  borrowed and is valid until the packet is removed.
+    Packet* head() const;
+
+    //! Get last packet in the queue.
+    //! @returns
+    //!  the last packet in the queue or null if there are no packets
+    //! @remarks
+    //!  Returned packet is not removed from the queue. Returned pointer is
+    //!  borrowed and is valid until the packet is removed.
+    Packet* tail() const;
+
+    //! Get the latest packet that were ever added to the queue.
+    //! @remarks
+    //!  Returns null if the queue never has any packets. Otherwise, returns
+    //!  the latest ever added packet, even if that packet is not currently
+    //!  in the queue. Returned packet is not removed from the queue. Returned
+    //!  pointer is borrowed and is valid until the next write() call.
+    Packet* latest() const;
+
+private:
+    enum {
+        // Initial window size, in packets.
+        InitialWindow = 256,
+
+        // Maximum window size, in packets. Larger distance between seqnums
+        // can't be ordered unambiguously.
+        MaxWindow = 1 << 15
+    };
+
+    size_t slot_(seqnum_t sn) const;
+    bool grow_(size_t span);
+
+    core::Array<PacketPtr> ring_;
+
+    // seqnum of the first packet and seqnum following the last packet
+    seqnum_t begin_;
+    seqnum_t end_;
+
+    size_t size_;
+
+    PacketPtr latest_;
+
+    const size_t max_size_;
+
+    bool valid_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_SEQNUM_QUEUE_H_
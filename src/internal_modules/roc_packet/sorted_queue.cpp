@@ -9,6 +9,7 @@
 #include "roc_packet/sorted_queue.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/tracepoint.h"
 
 namespace roc {
 namespace packet {
@@ -17,13 +18,25 @@ SortedQueue::SortedQueue(size_t max_size)
     : max_size_(max_size) {
 }
 
-PacketPtr SortedQueue::read() {
-    if (PacketPtr packet = list_.back()) {
+SortedQueue::~SortedQueue() {
+    while (Packet* packet = list_.back()) {
         list_.remove(*packet);
-        return packet;
+        packet->decref();
+    }
+}
+
+PacketPtr SortedQueue::read() {
+    Packet* packet = list_.back();
+    if (!packet) {
+        return NULL;
     }
 
-    return NULL;
+    list_.remove(*packet);
+
+    PacketPtr pp = packet;
+    packet->decref();
+
+    return pp;
 }
 
 void SortedQueue::write(const PacketPtr& packet) {
@@ -43,7 +56,7 @@ void SortedQueue::write(const PacketPtr& packet) {
         latest_ = packet;
     }
 
-    PacketPtr pos = list_.front();
+    Packet* pos = list_.front();
 
     for (; pos; pos = list_.nextof(*pos)) {
         const int cmp = packet->compare(*pos);
@@ -60,27 +73,32 @@ void SortedQueue::write(const PacketPtr& packet) {
         break;
     }
 
+    packet->incref();
+
     if (pos) {
         list_.insert_before(*packet, *pos);
     } else {
         list_.push_back(*packet);
     }
+
+    roc_tracepoint(queue_write, (const void*)this, (const void*)packet.get(),
+                   (unsigned long)list_.size());
 }
 
 size_t SortedQueue::size() const {
     return list_.size();
 }
 
-PacketPtr SortedQueue::head() const {
+Packet* SortedQueue::head() const {
     return list_.back();
 }
 
-PacketPtr SortedQueue::tail() const {
+Packet* SortedQueue::tail() const {
     return list_.front();
 }
 
-PacketPtr SortedQueue::latest() const {
-    return latest_;
+Packet* SortedQueue::latest() const {
+    return latest_.get();
 }
 
 } // namespace packet
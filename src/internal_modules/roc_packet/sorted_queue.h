@@ -24,6 +24,10 @@ namespace packet {
 //! Sorted packet queue.
 //! @remarks
 //!  Packets order is determined by Packet::compare() method.
+//! @remarks
+//!  Methods that peek packets without removing them return borrowed pointers,
+//!  which don't touch packet reference counter. Such pointer remains valid
+//!  until the packet is removed from the queue.
 class SortedQueue : public IWriter, public IReader, public core::NonCopyable<> {
 public:
     //! Construct empty queue.
@@ -31,6 +35,9 @@ public:
     //!  If @p max_size is non-zero, it specifies maximum number of packets in queue.
     explicit SortedQueue(size_t max_size);
 
+    //! Release packets remaining in queue.
+    ~SortedQueue();
+
     //! Add packet to the queue.
     //! @remarks
     //!  - if the maximum queue size is reached, packet is dropped
@@ -52,25 +59,30 @@ public:
     //! @returns
     //!  the first packet in the queue or null if there are no packets
     //! @remarks
-    //!  Returned packet is not removed from the queue.
-    PacketPtr head() const;
+    //!  Returned packet is not removed from the queue. Returned pointer is
+    //!  borrowed and is valid until the packet is removed.
+    Packet* head() const;
 
     //! Get last packet in the queue.
     //! @returns
     //!  the last packet in the queue or null if there are no packets
     //! @remarks
-    //!  Returned packet is not removed from the queue.
-    PacketPtr tail() const;
+    //!  Returned packet is not removed from the queue. Returned pointer is
+    //!  borrowed and is valid until the packet is removed.
+    Packet* tail() const;
 
     //! Get the latest packet that were ever added to the queue.
     //! @remarks
     //!  Returns null if the queue never has any packets. Otherwise, returns
     //!  the latest ever added packet, even if that packet is not currently
-    //!  in the queue. Returned packet is not removed from the queue.
-    PacketPtr latest() const;
+    //!  in the queue. Returned packet is not removed from the queue. Returned
+    //!  pointer is borrowed and is valid until the next write() call.
+    Packet* latest() const;
 
 private:
-    core::List<Packet> list_;
+    // Packets are referenced manually when added to and removed from list,
+    // which allows to traverse the list without touching reference counters.
+    core::List<Packet, core::NoOwnership> list_;
     PacketPtr latest_;
     const size_t max_size_;
 };
@@ -91,7 +91,9 @@ inline bool blknum_le(blknum_t a, blknum_t b) {
 typedef uint64_t ntp_timestamp_t;
 
 //! Bitmask of channels present in audio packet.
-typedef uint32_t channel_mask_t;
+//! @remarks
+//!  Up to 64 channels are supported.
+typedef uint64_t channel_mask_t;
 
 //! Compute number of channels in mask.
 inline size_t num_channels(channel_mask_t ch_mask) {
@@ -13,29 +13,185 @@
 namespace roc {
 namespace peer {
 
+namespace {
+
+size_t num_network_threads(const ContextConfig& config) {
+    return config.network_threads > 1 ? config.network_threads : 1;
+}
+
+// Select CPU for network thread, by taking CPUs from the mask in round-robin.
+int network_thread_cpu(const ContextConfig& config, size_t index) {
+    const uint64_t mask = config.network_thread.cpu_mask;
+
+    if (num_network_threads(config) == 1 || mask == 0) {
+        return -1;
+    }
+
+    size_t n_cpus = 0;
+    for (int cpu = 0; cpu < 64; cpu++) {
+        if (mask & ((uint64_t)1 << cpu)) {
+            n_cpus++;
+        }
+    }
+
+    size_t pos = index % n_cpus;
+    for (int cpu = 0; cpu < 64; cpu++) {
+        if (mask & ((uint64_t)1 << cpu)) {
+            if (pos == 0) {
+                return cpu;
+            }
+            pos--;
+        }
+    }
+
+    return -1;
+}
+
+core::ThreadConfig network_thread_config(const ContextConfig& config, size_t index) {
+    core::ThreadConfig thread_config = config.network_thread;
+
+    const int cpu = network_thread_cpu(config, index);
+    if (cpu >= 0) {
+        thread_config.cpu_mask = (uint64_t)1 << cpu;
+    }
+
+    return thread_config;
+}
+
+} // namespace
+
 Context::Context(const ContextConfig& config, core::IAllocator& allocator)
     : allocator_(allocator)
-    , packet_factory_(allocator_, false)
-    , byte_buffer_factory_(allocator_, config.max_packet_size, config.poisoning)
-    , sample_buffer_factory_(
-          allocator_, config.max_frame_size / sizeof(audio::sample_t), config.poisoning)
-    , network_loop_(packet_factory_, byte_buffer_factory_, allocator_)
-    , control_loop_(network_loop_, allocator_)
-    , ref_counter_(0) {
-    roc_log(LogDebug, "context: initializing");
+    , mmap_allocator_(config.enable_hugepages, config.lock_memory)
+    , pool_allocator_(config.enable_mmap ? (core::IAllocator&)mmap_allocator_
+                                         : allocator_,
+                      config.max_pool_memory)
+    , packet_factory_(pool_allocator_, config.max_packet_size, false)
+    , byte_buffer_factory_(pool_allocator_, config.max_packet_size, config.poisoning)
+    , sample_buffer_factory_(pool_allocator_,
+                             config.max_frame_size / sizeof(audio::sample_t),
+                             config.poisoning)
+    , network_loop_(packet_factory_,
+                    byte_buffer_factory_,
+                    allocator_,
+                    network_thread_config(config, 0))
+    , control_loop_(network_loop_, allocator_, config.control_thread)
+    , n_network_loops_(0)
+    , enable_shared_clock_(config.enable_shared_clock)
+    , batch_encoder_(allocator_)
+    , enable_batch_fec_(config.enable_batch_fec)
+    , ref_counter_(0)
+    , pools_reserved_(false) {
+    roc_log(LogDebug,
+            "context: initializing: mmap=%d hugepages=%d mlock=%d mlockall=%d"
+            " reserved_packets=%lu reserved_byte_buffers=%lu"
+            " reserved_sample_buffers=%lu max_packets=%lu max_byte_buffers=%lu"
+            " max_sample_buffers=%lu max_pool_memory=%lu network_threads=%lu"
+            " batch_fec=%d",
+            (int)config.enable_mmap, (int)config.enable_hugepages,
+            (int)config.lock_memory, (int)config.lock_all_memory,
+            (unsigned long)config.reserved_packets,
+            (unsigned long)config.reserved_byte_buffers,
+            (unsigned long)config.reserved_sample_buffers,
+            (unsigned long)config.max_packets, (unsigned long)config.max_byte_buffers,
+            (unsigned long)config.max_sample_buffers,
+            (unsigned long)config.max_pool_memory,
+            (unsigned long)num_network_threads(config), (int)config.enable_batch_fec);
+
+    if (config.lock_all_memory) {
+        // not fatal, the only consequence is possible page faults
+        (void)core::MmapAllocator::lock_all_memory();
+    }
+
+    if (num_network_threads(config) > MaxNetworkThreads) {
+        roc_log(LogError, "context: too many network threads: requested=%lu max=%lu",
+                (unsigned long)config.network_threads,
+                (unsigned long)MaxNetworkThreads);
+        return;
+    }
+
+    network_loops_[0] = &network_loop_;
+    network_cpus_[0] = network_thread_cpu(config, 0);
+    n_network_loops_ = 1;
+
+    for (size_t n = 1; n < num_network_threads(config); n++) {
+        netio::NetworkLoop* loop = new (allocator_)
+            netio::NetworkLoop(packet_factory_, byte_buffer_factory_, allocator_,
+                               network_thread_config(config, n));
+        if (!loop) {
+            roc_log(LogError, "context: can't allocate network loop");
+            return;
+        }
+
+        network_loops_[n_network_loops_] = loop;
+        network_cpus_[n_network_loops_] = network_thread_cpu(config, n);
+        n_network_loops_++;
+
+        if (!loop->valid()) {
+            roc_log(LogError, "context: can't initialize network loop");
+            return;
+        }
+    }
+
+    packet_factory_.set_limit(config.max_packets);
+    byte_buffer_factory_.set_limit(config.max_byte_buffers);
+    sample_buffer_factory_.set_limit(config.max_sample_buffers);
+
+    if (!packet_factory_.reserve(config.reserved_packets)) {
+        roc_log(LogError, "context: can't reserve packets: n_packets=%lu",
+                (unsigned long)config.reserved_packets);
+        return;
+    }
+
+    if (!byte_buffer_factory_.reserve(config.reserved_byte_buffers)) {
+        roc_log(LogError, "context: can't reserve byte buffers: n_buffers=%lu",
+                (unsigned long)config.reserved_byte_buffers);
+        return;
+    }
+
+    if (!sample_buffer_factory_.reserve(config.reserved_sample_buffers)) {
+        roc_log(LogError, "context: can't reserve sample buffers: n_buffers=%lu",
+                (unsigned long)config.reserved_sample_buffers);
+        return;
+    }
+
+    pools_reserved_ = true;
 }
 
 Context::~Context() {
-    roc_log(LogDebug, "context: deinitializing");
+    const ContextMemoryStats stats = memory_stats();
+
+    roc_log(LogDebug,
+            "context: deinitializing:"
+            " packet_alloc_failures=%lu byte_buffer_alloc_failures=%lu"
+            " sample_buffer_alloc_failures=%lu",
+            (unsigned long)stats.packet_alloc_failures,
+            (unsigned long)stats.byte_buffer_alloc_failures,
+            (unsigned long)stats.sample_buffer_alloc_failures);
 
     if (is_used()) {
         roc_panic("context: still in use when destroying: refcounter=%u",
                   (unsigned)ref_counter_);
     }
+
+    // first loop is a member and is destroyed automatically
+    for (size_t n = 1; n < n_network_loops_; n++) {
+        allocator_.destroy_object(*network_loops_[n]);
+    }
 }
 
 bool Context::valid() {
-    return network_loop_.valid() && control_loop_.valid();
+    if (!pools_reserved_ || !control_loop_.valid()) {
+        return false;
+    }
+
+    for (size_t n = 0; n < n_network_loops_; n++) {
+        if (!network_loops_[n]->valid()) {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void Context::incref() {
@@ -56,6 +212,23 @@ bool Context::is_used() {
     return ref_counter_ != 0;
 }
 
+ContextMemoryStats Context::memory_stats() const {
+    ContextMemoryStats stats;
+
+    stats.packet_alloc_failures = packet_factory_.num_failed_allocations();
+    stats.byte_buffer_alloc_failures = byte_buffer_factory_.num_failed_allocations();
+    stats.sample_buffer_alloc_failures = sample_buffer_factory_.num_failed_allocations();
+
+    stats.pool_memory = pool_allocator_.stats();
+
+    stats.packet_pool = packet_factory_.pool_stats();
+    stats.inline_packet_pool = packet_factory_.inline_pool_stats();
+    stats.byte_buffer_pool = byte_buffer_factory_.pool_stats();
+    stats.sample_buffer_pool = sample_buffer_factory_.pool_stats();
+
+    return stats;
+}
+
 core::IAllocator& Context::allocator() {
     return allocator_;
 }
@@ -72,13 +245,45 @@ core::BufferFactory<audio::sample_t>& Context::sample_buffer_factory() {
     return sample_buffer_factory_;
 }
 
+size_t Context::num_network_loops() const {
+    return n_network_loops_;
+}
+
 netio::NetworkLoop& Context::network_loop() {
     return network_loop_;
 }
 
+netio::NetworkLoop& Context::network_loop(size_t index) {
+    if (index >= n_network_loops_) {
+        roc_panic("context: network loop index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)n_network_loops_);
+    }
+    return *network_loops_[index];
+}
+
+int Context::network_loop_cpu(size_t index) const {
+    if (index >= n_network_loops_) {
+        roc_panic("context: network loop index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)n_network_loops_);
+    }
+    return network_cpus_[index];
+}
+
 ctl::ControlLoop& Context::control_loop() {
     return control_loop_;
 }
 
+pipeline::ClockDomain* Context::clock_domain() {
+    return enable_shared_clock_ ? &clock_domain_ : NULL;
+}
+
+fec::BatchEncoder* Context::batch_encoder() {
+    return enable_batch_fec_ ? &batch_encoder_ : NULL;
+}
+
+rtp::FormatMap& Context::format_map() {
+    return format_map_;
+}
+
 } // namespace peer
 } // namespace roc
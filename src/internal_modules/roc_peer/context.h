@@ -15,14 +15,23 @@
 #include "roc_audio/sample.h"
 #include "roc_core/atomic.h"
 #include "roc_core/buffer_factory.h"
+#include "roc_core/counting_allocator.h"
 #include "roc_core/iallocator.h"
+#include "roc_core/mmap_allocator.h"
+#include "roc_core/thread.h"
 #include "roc_ctl/control_loop.h"
+#include "roc_fec/batch_encoder.h"
 #include "roc_netio/network_loop.h"
 #include "roc_packet/packet_factory.h"
+#include "roc_pipeline/clock_domain.h"
+#include "roc_rtp/format_map.h"
 
 namespace roc {
 namespace peer {
 
+//! Maximum number of network threads per context.
+const size_t MaxNetworkThreads = 16;
+
 //! Peer context config.
 struct ContextConfig {
     //! Maximum size in bytes of a network packet.
@@ -34,10 +43,125 @@ struct ContextConfig {
     //! Enable memory poisoning.
     bool poisoning;
 
+    //! Number of packets to preallocate.
+    size_t reserved_packets;
+
+    //! Number of byte buffers to preallocate.
+    size_t reserved_byte_buffers;
+
+    //! Number of sample buffers to preallocate.
+    size_t reserved_sample_buffers;
+
+    //! Maximum number of packets.
+    //! Zero means no limit.
+    size_t max_packets;
+
+    //! Maximum number of byte buffers.
+    //! Zero means no limit.
+    size_t max_byte_buffers;
+
+    //! Maximum number of sample buffers.
+    //! Zero means no limit.
+    size_t max_sample_buffers;
+
+    //! Maximum number of bytes allocated for all pools of the context.
+    //! Covers packets, byte buffers, and sample buffers. When the limit is
+    //! reached, new packets are dropped until memory is returned to pools.
+    //! Zero means no limit.
+    size_t max_pool_memory;
+
+    //! Allocate memory for packets and buffers using mmap().
+    //! If false, memory is allocated using context allocator.
+    bool enable_mmap;
+
+    //! Use huge pages for mmap-backed memory.
+    bool enable_hugepages;
+
+    //! Lock mmap-backed memory with mlock().
+    bool lock_memory;
+
+    //! Lock all process memory with mlockall().
+    //! Unlike lock_memory, also covers heap and thread stacks.
+    bool lock_all_memory;
+
+    //! Number of network threads.
+    //! If greater than one, every receiver port is bound on all network threads
+    //! using SO_REUSEPORT, and kernel distributes incoming packets between them.
+    //! Other ports are served by the first network thread.
+    //! Zero means one thread. Can't be greater than MaxNetworkThreads.
+    size_t network_threads;
+
+    //! Scheduling parameters for network threads.
+    //! If there are multiple network threads and cpu_mask is set, each thread is
+    //! pinned to one of the CPUs from the mask, in round-robin order.
+    core::ThreadConfig network_thread;
+
+    //! Scheduling parameters for control thread.
+    core::ThreadConfig control_thread;
+
+    //! Align timing of all peers of the context.
+    //! If enabled, peers with timing enabled share one clock domain and process
+    //! frames at common frame boundaries, so that a single thread serving many
+    //! peers wakes up once per frame instead of once per peer.
+    bool enable_shared_clock;
+
+    //! Encode FEC blocks of all senders of the context together.
+    //! If enabled, Reed-Solomon repair packets of all sender slots are encoded
+    //! in batches by one shared encoder, which makes better use of CPU caches
+    //! when there are many streams.
+    bool enable_batch_fec;
+
     ContextConfig()
         : max_packet_size(2048)
         , max_frame_size(4096)
-        , poisoning(false) {
+        , poisoning(false)
+        , reserved_packets(0)
+        , reserved_byte_buffers(0)
+        , reserved_sample_buffers(0)
+        , max_packets(0)
+        , max_byte_buffers(0)
+        , max_sample_buffers(0)
+        , max_pool_memory(0)
+        , enable_mmap(false)
+        , enable_hugepages(false)
+        , lock_memory(false)
+        , lock_all_memory(false)
+        , network_threads(1)
+        , enable_shared_clock(false)
+        , enable_batch_fec(false) {
+    }
+};
+
+//! Peer context memory statistics.
+struct ContextMemoryStats {
+    //! Number of packets that couldn't be allocated.
+    size_t packet_alloc_failures;
+
+    //! Number of byte buffers that couldn't be allocated.
+    size_t byte_buffer_alloc_failures;
+
+    //! Number of sample buffers that couldn't be allocated.
+    size_t sample_buffer_alloc_failures;
+
+    //! Memory allocated for all pools of the context.
+    core::AllocationStats pool_memory;
+
+    //! Pool of packets without inline buffers.
+    core::SlabPoolStats packet_pool;
+
+    //! Pool of packets with inline buffers.
+    core::SlabPoolStats inline_packet_pool;
+
+    //! Pool of byte buffers.
+    core::SlabPoolStats byte_buffer_pool;
+
+    //! Pool of sample buffers.
+    core::SlabPoolStats sample_buffer_pool;
+
+    ContextMemoryStats()
+        : packet_alloc_failures(0)
+        , byte_buffer_alloc_failures(0)
+        , sample_buffer_alloc_failures(0) {
     }
 };
 
@@ -62,6 +186,13 @@ public:
     //! Check if context is still in use.
     bool is_used();
 
+    //! Get memory statistics.
+    //! @remarks
+    //!  Allocation failures happen when limits from ContextConfig are reached
+    //!  or allocator fails; the corresponding packets or frames are dropped.
+    //!  Pool statistics may be queried from any thread at any time.
+    ContextMemoryStats memory_stats() const;
+
     //! Get allocator.
     core::IAllocator& allocator();
 
@@ -74,15 +205,47 @@ public:
     //! Get sample buffer factory.
     core::BufferFactory<audio::sample_t>& sample_buffer_factory();
 
-    //! Get network event loop.
+    //! Get number of network event loops.
+    size_t num_network_loops() const;
+
+    //! Get first network event loop.
+    //! @remarks
+    //!  Serves all ports except additional receiver port shards.
     netio::NetworkLoop& network_loop();
 
+    //! Get network event loop by index.
+    netio::NetworkLoop& network_loop(size_t index);
+
+    //! Get CPU of network event loop thread.
+    //! @returns
+    //!  CPU index, or -1 if the thread is not pinned to one CPU.
+    int network_loop_cpu(size_t index) const;
+
     //! Get control event loop.
     ctl::ControlLoop& control_loop();
 
+    //! Get clock domain shared by peers.
+    //! @returns
+    //!  NULL if shared clock is disabled.
+    pipeline::ClockDomain* clock_domain();
+
+    //! Get FEC encoder shared by senders.
+    //! @returns
+    //!  NULL if batch FEC encoding is disabled.
+    fec::BatchEncoder* batch_encoder();
+
+    //! Get RTP payload formats shared by peers.
+    //! @remarks
+    //!  Formats registered here are available to all senders and receivers
+    //!  of the context.
+    rtp::FormatMap& format_map();
+
 private:
     core::IAllocator& allocator_;
 
+    core::MmapAllocator mmap_allocator_;
+    core::CountingAllocator pool_allocator_;
+
     packet::PacketFactory packet_factory_;
     core::BufferFactory<uint8_t> byte_buffer_factory_;
     core::BufferFactory<audio::sample_t> sample_buffer_factory_;
@@ -90,7 +253,21 @@ private:
     netio::NetworkLoop network_loop_;
     ctl::ControlLoop control_loop_;
 
+    netio::NetworkLoop* network_loops_[MaxNetworkThreads];
+    int network_cpus_[MaxNetworkThreads];
+    size_t n_network_loops_;
+
+    pipeline::ClockDomain clock_domain_;
+    const bool enable_shared_clock_;
+
+    fec::BatchEncoder batch_encoder_;
+    const bool enable_batch_fec_;
+
+    rtp::FormatMap format_map_;
+
     core::Atomic<int> ref_counter_;
+
+    bool pools_reserved_;
 };
 
 } // namespace peer
@@ -10,23 +10,79 @@
 #include "roc_address/endpoint_uri_to_str.h"
 #include "roc_address/socket_addr.h"
 #include "roc_address/socket_addr_to_str.h"
+#include "roc_core/atomic.h"
 #include "roc_core/log.h"
 #include "roc_core/macro_helpers.h"
 #include "roc_core/panic.h"
+#include "roc_core/semaphore.h"
+#include "roc_netio/inetwork_task_completer.h"
+#include "roc_pipeline/ipipeline_task_completer.h"
 
 namespace roc {
 namespace peer {
 
-Receiver::Receiver(Context& context, const pipeline::ReceiverConfig& pipeline_config)
+namespace {
+
+// Maximum number of bindings processed by bind_many() in one batch.
+enum { MaxBindBatch = 32 };
+
+// Waits until all asynchronous tasks scheduled after previous wait() complete.
+class TaskBarrier : public netio::INetworkTaskCompleter,
+                    public pipeline::IPipelineTaskCompleter {
+public:
+    TaskBarrier()
+        : pending_(1) {
+    }
+
+    // Should be called before scheduling every task.
+    void add() {
+        ++pending_;
+    }
+
+    void wait() {
+        if (--pending_ != 0) {
+            sem_.wait();
+        }
+        pending_ = 1;
+    }
+
+    virtual void network_task_completed(netio::NetworkTask&) {
+        complete_();
+    }
+
+    virtual void pipeline_task_completed(pipeline::PipelineTask&) {
+        complete_();
+    }
+
+private:
+    void complete_() {
+        if (--pending_ == 0) {
+            sem_.post();
+        }
+    }
+
+    core::Atomic<int> pending_;
+    core::Semaphore sem_;
+};
+
+} // namespace
+
+Receiver::Receiver(Context& context,
+                   const pipeline::ReceiverConfig& pipeline_config,
+                   audio::PcmEncoding frame_encoding)
     : BasicPeer(context)
     , pipeline_(*this,
                 pipeline_config,
-                format_map_,
+                context.format_map(),
                 context.packet_factory(),
                 context.byte_buffer_factory(),
                 context.sample_buffer_factory(),
-                context.allocator())
-    , processing_task_(pipeline_) {
+                context.allocator(),
+                context.clock_domain())
+    , processing_task_(pipeline_)
+    , frame_buf_(context.allocator())
+    , capture_writer_(NULL)
+    , event_handler_(NULL) {
     roc_log(LogDebug, "receiver peer: initializing");
 
     memset(used_interfaces_, 0, sizeof(used_interfaces_));
@@ -36,12 +92,39 @@ Receiver::Receiver(Context& context, const pipeline::ReceiverConfig& pipeline_co
         return;
     }
 
+    if (frame_encoding != audio::PcmEncoding_Float32) {
+        frame_mapper_.reset(new (frame_mapper_) audio::PcmMapper(
+            audio::PcmFormat(audio::PcmEncoding_Float32, audio::PcmEndian_Native),
+            audio::PcmFormat(frame_encoding, audio::PcmEndian_Native)));
+
+        const size_t frame_size =
+            pipeline_config.common.output_sample_spec.ns_2_samples_overall(
+                pipeline_config.common.internal_frame_length);
+
+        if (frame_size == 0 || !frame_buf_.resize(frame_size)) {
+            roc_log(LogError, "receiver peer: can't allocate frame buffer");
+            return;
+        }
+    }
+
+    if (pipeline_config.common.decoupling_buffer_length > 0) {
+        decoupled_source_.reset(new (decoupled_source_) pipeline::DecoupledSource(
+            pipeline_.source(), pipeline_config.common.internal_frame_length,
+            pipeline_config.common.decoupling_buffer_length, context.allocator()));
+        if (!decoupled_source_ || !decoupled_source_->valid()) {
+            return;
+        }
+    }
+
     valid_ = true;
 }
 
 Receiver::~Receiver() {
     roc_log(LogDebug, "receiver peer: deinitializing");
 
+    // stop pipeline thread before waiting for tasks it could schedule
+    decoupled_source_.reset();
+
     context().control_loop().wait(processing_task_);
 
     for (size_t s = 0; s < slots_.size(); s++) {
@@ -49,15 +132,15 @@ Receiver::~Receiver() {
             continue;
         }
 
-        for (size_t p = 0; p < address::Iface_Max; p++) {
-            if (!slots_[s].ports[p].handle) {
-                continue;
+        if (slots_[s].control_endpoint) {
+            ctl::ControlLoop::Tasks::DeleteEndpoint task(slots_[s].control_endpoint);
+            if (!context().control_loop().schedule_and_wait(task)) {
+                roc_panic("receiver peer: can't remove control endpoint");
             }
+        }
 
-            netio::NetworkLoop::Tasks::RemovePort task(slots_[s].ports[p].handle);
-            if (!context().network_loop().schedule_and_wait(task)) {
-                roc_panic("sender peer: can't remove port");
-            }
+        for (size_t p = 0; p < address::Iface_Max; p++) {
+            remove_port_(slots_[s].ports[p]);
         }
     }
 }
@@ -91,7 +174,7 @@ bool Receiver::set_multicast_group(size_t slot_index,
         return false;
     }
 
-    if (slot->ports[iface].handle) {
+    if (slot->ports[iface].n_handles != 0) {
         roc_log(LogError,
                 "receiver peer:"
                 " can't set multicast group for %s interface of slot %lu:"
@@ -150,7 +233,7 @@ bool Receiver::set_reuseaddr(size_t slot_index, address::Interface iface, bool e
         return false;
     }
 
-    if (slot->ports[iface].handle) {
+    if (slot->ports[iface].n_handles != 0) {
         roc_log(LogError,
                 "receiver peer:"
                 " can't set reuseaddr option for %s interface of slot %lu:"
@@ -164,6 +247,96 @@ bool Receiver::set_reuseaddr(size_t slot_index, address::Interface iface, bool e
     return true;
 }
 
+bool Receiver::set_socket_buffer_size(size_t slot_index,
+                                      address::Interface iface,
+                                      size_t size) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogDebug,
+            "receiver peer: setting socket buffer size for %s interface of slot %lu"
+            " to %lu",
+            address::interface_to_str(iface), (unsigned long)slot_index,
+            (unsigned long)size);
+
+    Slot* slot = get_slot_(slot_index);
+    if (!slot) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't set socket buffer size for %s interface of slot %lu:"
+                " can't create slot",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (slot->ports[iface].n_handles != 0) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't set socket buffer size for %s interface of slot %lu:"
+                " interface is already bound",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    slot->ports[iface].config.recv_buffer_size = size;
+
+    return true;
+}
+
+void Receiver::set_capture_writer(packet::CaptureWriter* writer) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    capture_writer_ = writer;
+}
+
+bool Receiver::set_event_handler(pipeline::IReceiverEventHandler& handler) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    if (event_handler_) {
+        roc_log(LogError, "receiver peer: can't set event handler: already set");
+        return false;
+    }
+
+    event_handler_ = &handler;
+    pipeline_.set_event_handler(event_handler_);
+
+    return true;
+}
+
+pipeline::IReceiverEventHandler* Receiver::event_handler() const {
+    return event_handler_;
+}
+
+void Receiver::set_session_store(pipeline::SessionStateStore* store) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    pipeline_.set_session_store(store);
+}
+
+bool Receiver::prepare_slot(size_t slot_index) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    if (!get_slot_(slot_index)) {
+        roc_log(LogError, "receiver peer: can't prepare slot %lu",
+                (unsigned long)slot_index);
+        return false;
+    }
+
+    return true;
+}
+
 bool Receiver::bind(size_t slot_index,
                     address::Interface iface,
                     address::EndpointUri& uri) {
@@ -187,6 +360,89 @@ bool Receiver::bind(size_t slot_index,
         return false;
     }
 
+    if (iface == address::Iface_Consolidated) {
+        return bind_consolidated_(slot_index, uri);
+    }
+
+    if (slot_index < slots_.size() && slots_[slot_index].control_endpoint) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " slot already uses consolidated interface",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    return bind_port_(slot_index, iface, uri);
+}
+
+bool Receiver::bind_many(const Binding* bindings, size_t n_bindings) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+    roc_panic_if(!bindings && n_bindings != 0);
+
+    roc_log(LogInfo, "receiver peer: binding %lu interfaces", (unsigned long)n_bindings);
+
+    bool saved_interfaces[address::Iface_Max];
+    address::Protocol saved_protocols[address::Iface_Max];
+
+    memcpy(saved_interfaces, used_interfaces_, sizeof(used_interfaces_));
+    memcpy(saved_protocols, used_protocols_, sizeof(used_protocols_));
+
+    bool ok = true;
+
+    // Bindings are checked in order, so that every binding is also checked
+    // for compatibility with the preceding ones.
+    for (size_t n = 0; n < n_bindings; n++) {
+        if (!check_binding_(bindings[n])) {
+            ok = false;
+            break;
+        }
+        update_compatibility_(bindings[n].iface, *bindings[n].uri);
+    }
+
+    size_t n_bound = 0;
+
+    while (ok && n_bound < n_bindings) {
+        const size_t batch_size =
+            std::min(n_bindings - n_bound, (size_t)MaxBindBatch);
+
+        if (!bind_batch_(bindings + n_bound, batch_size)) {
+            ok = false;
+            break;
+        }
+
+        n_bound += batch_size;
+    }
+
+    if (!ok) {
+        for (size_t n = 0; n < n_bound; n++) {
+            unbind_port_(bindings[n].slot_index, bindings[n].iface);
+        }
+
+        memcpy(used_interfaces_, saved_interfaces, sizeof(used_interfaces_));
+        memcpy(used_protocols_, saved_protocols, sizeof(used_protocols_));
+
+        return false;
+    }
+
+    for (size_t n = 0; n < n_bindings; n++) {
+        address::EndpointUri& uri = *bindings[n].uri;
+
+        if (uri.port() == 0) {
+            // Report back the port number we've selected.
+            const Port& port = slots_[bindings[n].slot_index].ports[bindings[n].iface];
+            uri.set_port(port.config.bind_address.port());
+        }
+    }
+
+    return true;
+}
+
+bool Receiver::bind_port_(size_t slot_index,
+                          address::Interface iface,
+                          address::EndpointUri& uri) {
     if (!check_compatibility_(iface, uri)) {
         roc_log(LogError,
                 "receiver peer:"
@@ -230,11 +486,22 @@ bool Receiver::bind(size_t slot_index,
         return false;
     }
 
-    slot->ports[iface].config.bind_address = resolve_task.get_address();
+    Port& port = slot->ports[iface];
+
+    port.config.bind_address = resolve_task.get_address();
+
+    port.config.capture_writer = capture_writer_;
+    port.config.capture_stream = (unsigned)iface;
+
+    if (context().num_network_loops() > 1) {
+        // all loops bind the same address, and kernel balances packets between them
+        port.config.reuseport = true;
+        port.config.incoming_cpu = context().network_loop_cpu(0);
+    }
 
-    netio::NetworkLoop::Tasks::AddUdpReceiverPort port_task(slot->ports[iface].config,
+    netio::NetworkLoop::Tasks::AddUdpReceiverPort port_task(port.config,
                                                             *endpoint_task.get_writer());
-    if (!context().network_loop().schedule_and_wait(port_task)) {
+    if (!context().network_loop(0).schedule_and_wait(port_task)) {
         roc_log(LogError,
                 "receiver peer:"
                 " can't bind %s interface of slot %lu:"
@@ -250,22 +517,576 @@ bool Receiver::bind(size_t slot_index,
         return false;
     }
 
-    slot->ports[iface].handle = port_task.get_handle();
+    port.handles[0] = port_task.get_handle();
+    port.n_handles = 1;
+
+    if (!add_port_shards_(port, *endpoint_task.get_writer())) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " can't bind interface to local port on all network threads",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+
+        remove_port_(port);
+
+        pipeline::ReceiverLoop::Tasks::DeleteEndpoint delete_endpoint_task(slot->slot,
+                                                                           iface);
+        if (!pipeline_.schedule_and_wait(delete_endpoint_task)) {
+            roc_panic("receiver peer: can't remove newly created endpoint");
+        }
+
+        return false;
+    }
 
     if (uri.port() == 0) {
         // Report back the port number we've selected.
-        uri.set_port(slot->ports[iface].config.bind_address.port());
+        uri.set_port(port.config.bind_address.port());
+    }
+
+    update_compatibility_(iface, uri);
+
+    return true;
+}
+
+bool Receiver::bind_consolidated_(size_t slot_index, address::EndpointUri& uri) {
+    const address::Interface iface = address::Iface_Consolidated;
+
+    if (uri.proto() != address::Proto_RTSP) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " unsupported protocol %s",
+                address::interface_to_str(iface), (unsigned long)slot_index,
+                address::proto_to_str(uri.proto()));
+        return false;
+    }
+
+    // Senders have to know the port in advance, and control endpoint doesn't
+    // report back the port selected by kernel.
+    if (uri.port() == 0) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " zero port is not supported",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (!check_compatibility_(iface, uri)) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " incompatible with other slots",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    Slot* slot = get_slot_(slot_index);
+    if (!slot) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " can't create slot",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    bool has_ports = slot->control_endpoint != NULL;
+    for (size_t p = 0; p < address::Iface_Max; p++) {
+        has_ports = has_ports || slot->ports[p].n_handles != 0;
+    }
+
+    if (has_ports) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " slot already has bound interfaces",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    // source and control ports are bound to random ports on the same host,
+    // and then announced to senders by control endpoint
+    address::EndpointUri source_uri(context().allocator());
+    address::EndpointUri control_uri(context().allocator());
+
+    if (!source_uri.set_proto(address::Proto_RTP) || !source_uri.set_host(uri.host())
+        || !source_uri.set_port(0) || !control_uri.set_proto(address::Proto_RTCP)
+        || !control_uri.set_host(uri.host()) || !control_uri.set_port(0)) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " can't construct interface uris",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    // If binding fails, underlying interfaces are unbound, and compatibility
+    // recorded for them is forgotten, so that binding can be retried.
+    bool saved_interfaces[address::Iface_Max];
+    address::Protocol saved_protocols[address::Iface_Max];
+
+    memcpy(saved_interfaces, used_interfaces_, sizeof(used_interfaces_));
+    memcpy(saved_protocols, used_protocols_, sizeof(used_protocols_));
+
+    const bool source_bound =
+        bind_port_(slot_index, address::Iface_AudioSource, source_uri);
+    const bool control_bound = source_bound
+        && bind_port_(slot_index, address::Iface_AudioControl, control_uri);
+
+    ctl::ControlLoop::EndpointHandle endpoint = NULL;
+    bool ok = true;
+
+    if (!control_bound) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " can't bind underlying interfaces",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        ok = false;
     }
 
+    if (ok) {
+        ctl::ControlLoop::Tasks::CreateEndpoint create_task(iface, uri.proto());
+        if (context().control_loop().schedule_and_wait(create_task)) {
+            endpoint = create_task.get_handle();
+        } else {
+            roc_log(LogError,
+                    "receiver peer:"
+                    " can't bind %s interface of slot %lu:"
+                    " can't create control endpoint",
+                    address::interface_to_str(iface), (unsigned long)slot_index);
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        ctl::ControlLoop::Tasks::BindEndpoint bind_task(endpoint, uri);
+        ctl::ControlLoop::Tasks::AttachSource attach_source_task(endpoint, source_uri,
+                                                                 pipeline_);
+        ctl::ControlLoop::Tasks::AttachSource attach_control_task(endpoint, control_uri,
+                                                                  pipeline_);
+
+        if (!context().control_loop().schedule_and_wait(bind_task)
+            || !context().control_loop().schedule_and_wait(attach_source_task)
+            || !context().control_loop().schedule_and_wait(attach_control_task)) {
+            roc_log(LogError,
+                    "receiver peer:"
+                    " can't bind %s interface of slot %lu:"
+                    " can't bind control endpoint",
+                    address::interface_to_str(iface), (unsigned long)slot_index);
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        if (endpoint) {
+            ctl::ControlLoop::Tasks::DeleteEndpoint delete_task(endpoint);
+            if (!context().control_loop().schedule_and_wait(delete_task)) {
+                roc_panic("receiver peer: can't remove newly created control endpoint");
+            }
+        }
+
+        if (control_bound) {
+            unbind_port_(slot_index, address::Iface_AudioControl);
+        }
+        if (source_bound) {
+            unbind_port_(slot_index, address::Iface_AudioSource);
+        }
+
+        memcpy(used_interfaces_, saved_interfaces, sizeof(used_interfaces_));
+        memcpy(used_protocols_, saved_protocols, sizeof(used_protocols_));
+
+        return false;
+    }
+
+    slot->control_endpoint = endpoint;
+
     update_compatibility_(iface, uri);
 
     return true;
 }
 
+bool Receiver::check_binding_(const Binding& binding) {
+    const size_t slot_index = binding.slot_index;
+    const address::Interface iface = binding.iface;
+
+    roc_panic_if(!binding.uri);
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogInfo, "receiver peer: binding %s interface of slot %lu to %s",
+            address::interface_to_str(iface), (unsigned long)slot_index,
+            address::endpoint_uri_to_str(*binding.uri).c_str());
+
+    if (!binding.uri->verify(address::EndpointUri::Subset_Full)) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " invalid uri",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (iface == address::Iface_Consolidated) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " interface can't be bound together with other interfaces",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (slot_index < slots_.size() && slots_[slot_index].control_endpoint) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " slot already uses consolidated interface",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (!check_compatibility_(iface, *binding.uri)) {
+        roc_log(LogError,
+                "receiver peer:"
+                " can't bind %s interface of slot %lu:"
+                " incompatible with other slots",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    return true;
+}
+
+bool Receiver::bind_batch_(const Binding* bindings, size_t n_bindings) {
+    roc_panic_if(n_bindings > MaxBindBatch);
+
+    typedef netio::NetworkLoop::Tasks::ResolveEndpointAddress ResolveTask;
+    typedef netio::NetworkLoop::Tasks::AddUdpReceiverPort PortTask;
+    typedef pipeline::ReceiverLoop::Tasks::CreateSlot SlotTask;
+    typedef pipeline::ReceiverLoop::Tasks::CreateEndpoint EndpointTask;
+
+    core::Optional<ResolveTask> resolve_tasks[MaxBindBatch];
+    core::Optional<SlotTask> slot_tasks[MaxBindBatch];
+    core::Optional<EndpointTask> endpoint_tasks[MaxBindBatch];
+    core::Optional<PortTask> port_tasks[MaxBindBatch];
+    netio::UdpReceiverConfig shard_configs[MaxBindBatch];
+
+    TaskBarrier barrier;
+
+    for (size_t n = 0; n < n_bindings; n++) {
+        if (slots_.size() <= bindings[n].slot_index) {
+            if (!slots_.resize(bindings[n].slot_index + 1)) {
+                roc_log(LogError, "receiver peer: failed to allocate slot");
+                return false;
+            }
+        }
+    }
+
+    // Resolve addresses and create missing slots.
+    for (size_t n = 0; n < n_bindings; n++) {
+        resolve_tasks[n].reset(new (resolve_tasks[n]) ResolveTask(*bindings[n].uri));
+        barrier.add();
+        context().network_loop().schedule(*resolve_tasks[n], barrier);
+
+        if (slots_[bindings[n].slot_index].slot) {
+            continue;
+        }
+
+        bool slot_pending = false;
+        for (size_t prev = 0; prev < n; prev++) {
+            if (bindings[prev].slot_index == bindings[n].slot_index
+                && slot_tasks[prev]) {
+                slot_pending = true;
+                break;
+            }
+        }
+
+        if (!slot_pending) {
+            slot_tasks[n].reset(new (slot_tasks[n]) SlotTask());
+            barrier.add();
+            pipeline_.schedule(*slot_tasks[n], barrier);
+        }
+    }
+
+    barrier.wait();
+
+    bool ok = true;
+
+    for (size_t n = 0; n < n_bindings; n++) {
+        if (slot_tasks[n]) {
+            if (slot_tasks[n]->success()) {
+                slots_[bindings[n].slot_index].slot = slot_tasks[n]->get_handle();
+            } else {
+                roc_log(LogError, "receiver peer: failed to create slot");
+                ok = false;
+            }
+        }
+
+        if (!resolve_tasks[n]->success()) {
+            roc_log(LogError,
+                    "receiver peer:"
+                    " can't bind %s interface of slot %lu:"
+                    " can't resolve endpoint address",
+                    address::interface_to_str(bindings[n].iface),
+                    (unsigned long)bindings[n].slot_index);
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        return false;
+    }
+
+    // Add endpoints to pipeline.
+    for (size_t n = 0; n < n_bindings; n++) {
+        endpoint_tasks[n].reset(new (endpoint_tasks[n]) EndpointTask(
+            slots_[bindings[n].slot_index].slot, bindings[n].iface,
+            bindings[n].uri->proto()));
+        barrier.add();
+        pipeline_.schedule(*endpoint_tasks[n], barrier);
+    }
+
+    barrier.wait();
+
+    for (size_t n = 0; n < n_bindings; n++) {
+        if (!endpoint_tasks[n]->success()) {
+            roc_log(LogError,
+                    "receiver peer:"
+                    " can't bind %s interface of slot %lu:"
+                    " can't add endpoint to pipeline",
+                    address::interface_to_str(bindings[n].iface),
+                    (unsigned long)bindings[n].slot_index);
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        for (size_t n = 0; n < n_bindings; n++) {
+            if (endpoint_tasks[n]->success()) {
+                unbind_port_(bindings[n].slot_index, bindings[n].iface);
+            }
+        }
+        return false;
+    }
+
+    // Bind ports on first network loop.
+    for (size_t n = 0; n < n_bindings; n++) {
+        Port& port = slots_[bindings[n].slot_index].ports[bindings[n].iface];
+
+        port.config.bind_address = resolve_tasks[n]->get_address();
+
+        port.config.capture_writer = capture_writer_;
+        port.config.capture_stream = (unsigned)bindings[n].iface;
+
+        if (context().num_network_loops() > 1) {
+            // all loops bind the same address, and kernel balances packets between them
+            port.config.reuseport = true;
+            port.config.incoming_cpu = context().network_loop_cpu(0);
+        }
+
+        port_tasks[n].reset(new (port_tasks[n])
+                                PortTask(port.config, *endpoint_tasks[n]->get_writer()));
+        barrier.add();
+        context().network_loop(0).schedule(*port_tasks[n], barrier);
+    }
+
+    barrier.wait();
+
+    for (size_t n = 0; n < n_bindings; n++) {
+        if (port_tasks[n]->success()) {
+            Port& port = slots_[bindings[n].slot_index].ports[bindings[n].iface];
+
+            port.handles[0] = port_tasks[n]->get_handle();
+            port.n_handles = 1;
+        } else {
+            roc_log(LogError,
+                    "receiver peer:"
+                    " can't bind %s interface of slot %lu:"
+                    " can't bind interface to local port",
+                    address::interface_to_str(bindings[n].iface),
+                    (unsigned long)bindings[n].slot_index);
+            ok = false;
+        }
+    }
+
+    // Bind same ports on other network loops. First loop already bound the
+    // ports, so configs contain actual port numbers even if zero port was
+    // requested.
+    for (size_t loop = 1; ok && loop < context().num_network_loops(); loop++) {
+        for (size_t n = 0; n < n_bindings; n++) {
+            const Port& port = slots_[bindings[n].slot_index].ports[bindings[n].iface];
+
+            shard_configs[n] = port.config;
+            shard_configs[n].incoming_cpu = context().network_loop_cpu(loop);
+
+            port_tasks[n].reset(new (port_tasks[n]) PortTask(
+                shard_configs[n], *endpoint_tasks[n]->get_writer()));
+            barrier.add();
+            context().network_loop(loop).schedule(*port_tasks[n], barrier);
+        }
+
+        barrier.wait();
+
+        for (size_t n = 0; n < n_bindings; n++) {
+            if (port_tasks[n]->success()) {
+                Port& port = slots_[bindings[n].slot_index].ports[bindings[n].iface];
+
+                port.handles[port.n_handles++] = port_tasks[n]->get_handle();
+            } else {
+                roc_log(LogError,
+                        "receiver peer:"
+                        " can't bind %s interface of slot %lu:"
+                        " can't bind interface to local port on all network threads",
+                        address::interface_to_str(bindings[n].iface),
+                        (unsigned long)bindings[n].slot_index);
+                ok = false;
+            }
+        }
+    }
+
+    if (!ok) {
+        for (size_t n = 0; n < n_bindings; n++) {
+            unbind_port_(bindings[n].slot_index, bindings[n].iface);
+        }
+        return false;
+    }
+
+    return true;
+}
+
+void Receiver::unbind_port_(size_t slot_index, address::Interface iface) {
+    Slot& slot = slots_[slot_index];
+
+    remove_port_(slot.ports[iface]);
+
+    pipeline::ReceiverLoop::Tasks::DeleteEndpoint delete_endpoint_task(slot.slot, iface);
+    if (!pipeline_.schedule_and_wait(delete_endpoint_task)) {
+        roc_panic("receiver peer: can't remove newly created endpoint");
+    }
+}
+
+bool Receiver::get_metrics(size_t slot_index, pipeline::ReceiverSlotMetrics& metrics) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    if (slots_.size() <= slot_index || !slots_[slot_index].slot) {
+        roc_log(LogError, "receiver peer: can't get metrics of slot %lu: no such slot",
+                (unsigned long)slot_index);
+        return false;
+    }
+
+    pipeline_.get_metrics(slots_[slot_index].slot, metrics);
+
+    return true;
+}
+
 sndio::ISource& Receiver::source() {
+    if (decoupled_source_) {
+        return *decoupled_source_;
+    }
+
     return pipeline_.source();
 }
 
+size_t Receiver::frame_sample_size() {
+    roc_panic_if_not(valid());
+
+    if (frame_mapper_) {
+        return frame_mapper_->output_byte_count(1);
+    }
+
+    return sizeof(audio::sample_t);
+}
+
+bool Receiver::read_pcm(void* bytes, size_t n_bytes) {
+    roc_panic_if_not(valid());
+
+    if (!frame_mapper_) {
+        audio::Frame frame((audio::sample_t*)bytes, n_bytes / sizeof(audio::sample_t));
+        return source().read(frame);
+    }
+
+    const size_t n_samples = frame_mapper_->output_sample_count(n_bytes);
+
+    size_t out_bit_off = 0;
+
+    for (size_t pos = 0; pos < n_samples;) {
+        audio::Frame frame(frame_buf_.data(),
+                           std::min(frame_buf_.size(), n_samples - pos));
+        if (!source().read(frame)) {
+            return false;
+        }
+
+        size_t in_bit_off = 0;
+
+        pos += frame_mapper_->map(frame.samples(),
+                                  frame.num_samples() * sizeof(audio::sample_t),
+                                  in_bit_off, bytes, n_bytes, out_bit_off,
+                                  frame.num_samples());
+    }
+
+    return true;
+}
+
+bool Receiver::read_frames(audio::sample_t* const* frames,
+                           size_t n_frames,
+                           size_t frame_size) {
+    roc_panic_if_not(valid());
+
+    if (decoupled_source_) {
+        for (size_t n = 0; n < n_frames; n++) {
+            audio::Frame frame(frames[n], frame_size);
+            if (!decoupled_source_->read(frame)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    return pipeline_.read_frames(frames, n_frames, frame_size);
+}
+
+bool Receiver::read_sessions(pipeline::ReceiverSessionFrame* frames,
+                             size_t max_frames,
+                             size_t& n_frames,
+                             size_t n_samples) {
+    roc_panic_if_not(valid());
+
+    if (decoupled_source_) {
+        roc_log(LogError,
+                "receiver peer: can't read sessions: not supported with decoupling");
+        return false;
+    }
+
+    if (frame_mapper_) {
+        roc_log(LogError,
+                "receiver peer: can't read sessions: supported only with float frames");
+        return false;
+    }
+
+    return pipeline_.read_sessions(frames, max_frames, n_frames, n_samples);
+}
+
+core::nanoseconds_t Receiver::read_delay() {
+    roc_panic_if_not(valid());
+
+    if (decoupled_source_) {
+        return 0;
+    }
+
+    return pipeline_.read_delay();
+}
+
+bool Receiver::wait_active(core::nanoseconds_t timeout) {
+    roc_panic_if_not(valid());
+
+    // doesn't lock mutex, to not block other operations while waiting
+    return pipeline_.wait_active(timeout);
+}
+
 bool Receiver::check_compatibility_(address::Interface iface,
                                     const address::EndpointUri& uri) {
     if (used_interfaces_[iface] && used_protocols_[iface] != uri.proto()) {
@@ -306,6 +1127,36 @@ Receiver::Slot* Receiver::get_slot_(size_t slot_index) {
     return &slots_[slot_index];
 }
 
+bool Receiver::add_port_shards_(Port& port, packet::IWriter& writer) {
+    // first loop already bound the port, so config contains actual port number
+    // even if zero port was requested
+    for (size_t n = 1; n < context().num_network_loops(); n++) {
+        netio::UdpReceiverConfig config = port.config;
+        config.incoming_cpu = context().network_loop_cpu(n);
+
+        netio::NetworkLoop::Tasks::AddUdpReceiverPort port_task(config, writer);
+        if (!context().network_loop(n).schedule_and_wait(port_task)) {
+            return false;
+        }
+
+        port.handles[port.n_handles++] = port_task.get_handle();
+    }
+
+    return true;
+}
+
+void Receiver::remove_port_(Port& port) {
+    for (size_t n = 0; n < port.n_handles; n++) {
+        netio::NetworkLoop::Tasks::RemovePort task(port.handles[n]);
+        if (!context().network_loop(n).schedule_and_wait(task)) {
+            roc_panic("receiver peer: can't remove port");
+        }
+        port.handles[n] = NULL;
+    }
+
+    port.n_handles = 0;
+}
+
 void Receiver::schedule_task_processing(pipeline::PipelineLoop&,
                                         core::nanoseconds_t deadline) {
     context().control_loop().schedule_at(processing_task_, deadline, NULL);
@@ -15,13 +15,20 @@
 #include "roc_address/endpoint_uri.h"
 #include "roc_address/interface.h"
 #include "roc_address/protocol.h"
+#include "roc_audio/pcm_mapper.h"
+#include "roc_audio/sample.h"
+#include "roc_core/array.h"
 #include "roc_core/mutex.h"
+#include "roc_core/optional.h"
 #include "roc_ctl/control_loop.h"
+#include "roc_packet/capture_writer.h"
 #include "roc_peer/basic_peer.h"
 #include "roc_peer/context.h"
+#include "roc_pipeline/decoupled_source.h"
+#include "roc_pipeline/ireceiver_event_handler.h"
 #include "roc_pipeline/ipipeline_task_scheduler.h"
 #include "roc_pipeline/receiver_loop.h"
-#include "roc_rtp/format_map.h"
+#include "roc_pipeline/session_state_store.h"
 
 namespace roc {
 namespace peer {
@@ -30,7 +37,11 @@ namespace peer {
 class Receiver : public BasicPeer, private pipeline::IPipelineTaskScheduler {
 public:
     //! Initialize.
-    Receiver(Context& context, const pipeline::ReceiverConfig& pipeline_config);
+    //! @remarks
+    //!  @p frame_encoding defines encoding of samples returned by read_pcm().
+    Receiver(Context& context,
+             const pipeline::ReceiverConfig& pipeline_config,
+             audio::PcmEncoding frame_encoding = audio::PcmEncoding_Float32);
 
     //! Deinitialize.
     ~Receiver();
@@ -44,19 +55,127 @@ public:
     //! Set reuseaddr option for given endpoint type.
     bool set_reuseaddr(size_t slot_index, address::Interface iface, bool enabled);
 
+    //! Set kernel socket buffer size for given endpoint type.
+    bool set_socket_buffer_size(size_t slot_index, address::Interface iface, size_t size);
+
+    //! Set writer for capturing incoming datagrams.
+    //! @remarks
+    //!  Affects interfaces bound after this call. Datagrams are captured with
+    //!  interface identifier as stream identifier. Writer should be alive until
+    //!  receiver is destroyed.
+    void set_capture_writer(packet::CaptureWriter* writer);
+
+    //! Set handler for session events.
+    //! @remarks
+    //!  Can be set only once. Handler should be alive until receiver is destroyed.
+    //!  See pipeline::IReceiverEventHandler.
+    bool set_event_handler(pipeline::IReceiverEventHandler& handler);
+
+    //! Get handler installed by set_event_handler().
+    //! @returns
+    //!  NULL if no handler is set.
+    pipeline::IReceiverEventHandler* event_handler() const;
+
+    //! Set store used to save and restore session state.
+    //! @remarks
+    //!  Sessions created after this call restore clock drift estimation and
+    //!  adaptive latency state of known senders from @p store, and save their
+    //!  state into it when removed or when receiver is destroyed. Store should
+    //!  be alive until receiver is destroyed. NULL disables it.
+    void set_session_store(pipeline::SessionStateStore* store);
+
+    //! Create slot in advance.
+    //! @remarks
+    //!  Slots are normally created on first use, e.g. by bind(). Creating a slot
+    //!  requires a round-trip to the pipeline, which this call allows to do ahead
+    //!  of time.
+    bool prepare_slot(size_t slot_index);
+
     //! Bind peer to local endpoint.
+    //! @remarks
+    //!  Binding consolidated interface binds source and control interfaces
+    //!  to random ports on the same host and announces them via control
+    //!  endpoint, e.g. RTSP server. It can't be combined with other interfaces
+    //!  in the same slot, and its port can't be zero. If binding fails, all
+    //!  interfaces bound by the call are unbound.
     bool bind(size_t slot_index, address::Interface iface, address::EndpointUri& uri);
 
+    //! Parameters of one bind() call, see bind_many().
+    struct Binding {
+        //! Slot index.
+        size_t slot_index;
+
+        //! Interface type.
+        address::Interface iface;
+
+        //! Local URI; port is updated if zero port was requested.
+        address::EndpointUri* uri;
+    };
+
+    //! Bind multiple interfaces at once.
+    //! @remarks
+    //!  Same as calling bind() for every binding, but network and pipeline
+    //!  tasks of bindings are scheduled together and waited for once per
+    //!  stage, instead of a round-trip per task. Either all bindings succeed,
+    //!  or interfaces bound by this call are unbound back. Consolidated
+    //!  interface is not supported here.
+    bool bind_many(const Binding* bindings, size_t n_bindings);
+
+    //! Get metrics of given slot.
+    //! @remarks
+    //!  Doesn't wait for the pipeline thread.
+    bool get_metrics(size_t slot_index, pipeline::ReceiverSlotMetrics& metrics);
+
     //! Get receiver source.
     sndio::ISource& source();
 
+    //! Get time left until next frame can be read without blocking.
+    //! @remarks
+    //!  Always zero when decoupling buffer is enabled.
+    core::nanoseconds_t read_delay();
+
+    //! Wait until receiver has sessions or pending packets.
+    //! @returns
+    //!  false if @p timeout expired and receiver is still idle.
+    bool wait_active(core::nanoseconds_t timeout);
+
+    //! Get size of one sample returned by read_pcm(), in bytes.
+    size_t frame_sample_size();
+
+    //! Read samples in frame encoding.
+    //! @remarks
+    //!  If frame encoding is not Float32, samples are read from source() in
+    //!  chunks of internal frame length and converted.
+    //!  @p n_bytes should be multiple of frame_sample_size() times number of
+    //!  channels.
+    bool read_pcm(void* bytes, size_t n_bytes);
+
+    //! Read multiple frames at once.
+    //! @remarks
+    //!  Same as reading frames from source() one by one, but when possible,
+    //!  the pipeline is entered only once. See ReceiverLoop::read_frames().
+    bool read_frames(audio::sample_t* const* frames, size_t n_frames, size_t frame_size);
+
+    //! Read next frame of every session separately, without mixing.
+    //! @remarks
+    //!  Used instead of reading from source(). Not supported when decoupling
+    //!  buffer is enabled or frame encoding is not Float32.
+    bool read_sessions(pipeline::ReceiverSessionFrame* frames,
+                       size_t max_frames,
+                       size_t& n_frames,
+                       size_t n_samples);
+
 private:
     struct Port {
         netio::UdpReceiverConfig config;
-        netio::NetworkLoop::PortHandle handle;
+
+        // one handle per network loop, all bound to the same address
+        netio::NetworkLoop::PortHandle handles[MaxNetworkThreads];
+        size_t n_handles;
 
         Port()
-            : handle(NULL) {
+            : n_handles(0) {
+            memset(handles, 0, sizeof(handles));
         }
     };
 
@@ -64,32 +183,55 @@ private:
         pipeline::ReceiverLoop::SlotHandle slot;
         Port ports[address::Iface_Max];
 
+        // set if consolidated interface is bound
+        ctl::ControlLoop::EndpointHandle control_endpoint;
+
         Slot()
-            : slot(NULL) {
+            : slot(NULL)
+            , control_endpoint(NULL) {
         }
     };
 
+    bool bind_port_(size_t slot_index,
+                    address::Interface iface,
+                    address::EndpointUri& uri);
+    bool bind_consolidated_(size_t slot_index, address::EndpointUri& uri);
+
+    bool check_binding_(const Binding& binding);
+    bool bind_batch_(const Binding* bindings, size_t n_bindings);
+    void unbind_port_(size_t slot_index, address::Interface iface);
+
     bool check_compatibility_(address::Interface iface, const address::EndpointUri& uri);
     void update_compatibility_(address::Interface iface, const address::EndpointUri& uri);
 
     Slot* get_slot_(size_t slot_index);
 
+    bool add_port_shards_(Port& port, packet::IWriter& writer);
+    void remove_port_(Port& port);
+
     virtual void schedule_task_processing(pipeline::PipelineLoop&,
                                           core::nanoseconds_t delay);
     virtual void cancel_task_processing(pipeline::PipelineLoop&);
 
     core::Mutex mutex_;
 
-    rtp::FormatMap format_map_;
-
     pipeline::ReceiverLoop pipeline_;
     ctl::ControlLoop::Tasks::PipelineProcessing processing_task_;
 
+    core::Optional<pipeline::DecoupledSource> decoupled_source_;
+
+    core::Optional<audio::PcmMapper> frame_mapper_;
+    core::Array<audio::sample_t> frame_buf_;
+
     core::Array<Slot, 8> slots_;
 
     bool used_interfaces_[address::Iface_Max];
     address::Protocol used_protocols_[address::Iface_Max];
 
+    packet::CaptureWriter* capture_writer_;
+
+    pipeline::IReceiverEventHandler* event_handler_;
+
     bool valid_;
 };
 
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_peer/receiver_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace peer {
+
+namespace {
+
+pipeline::ReceiverConfig make_pipeline_config(const pipeline::ReceiverConfig& config) {
+    pipeline::ReceiverConfig pipeline_config = config;
+
+    // user pulls frames at its own pace
+    pipeline_config.common.timing = false;
+
+    return pipeline_config;
+}
+
+} // namespace
+
+ReceiverDecoder::ReceiverDecoder(Context& context,
+                                 const pipeline::ReceiverConfig& pipeline_config)
+    : BasicPeer(context)
+    , pipeline_(*this,
+                make_pipeline_config(pipeline_config),
+                context.format_map(),
+                context.packet_factory(),
+                context.byte_buffer_factory(),
+                context.sample_buffer_factory(),
+                context.allocator())
+    , processing_task_(pipeline_)
+    , slot_(NULL)
+    , valid_(false) {
+    roc_log(LogDebug, "receiver decoder: initializing");
+
+    memset(writers_, 0, sizeof(writers_));
+
+    if (!pipeline_.valid()) {
+        return;
+    }
+
+    if (!src_address_.set_host_port(address::Family_IPv4, "127.0.0.1", 0)) {
+        roc_log(LogError, "receiver decoder: can't set source address");
+        return;
+    }
+
+    pipeline::ReceiverLoop::Tasks::CreateSlot task;
+    if (!pipeline_.schedule_and_wait(task)) {
+        roc_log(LogError, "receiver decoder: failed to create slot");
+        return;
+    }
+    slot_ = task.get_handle();
+
+    valid_ = true;
+}
+
+ReceiverDecoder::~ReceiverDecoder() {
+    roc_log(LogDebug, "receiver decoder: deinitializing");
+
+    context().control_loop().wait(processing_task_);
+}
+
+bool ReceiverDecoder::valid() const {
+    return valid_;
+}
+
+bool ReceiverDecoder::activate(address::Interface iface, address::Protocol proto) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogInfo, "receiver decoder: activating %s interface with protocol %s",
+            address::interface_to_str(iface), address::proto_to_str(proto));
+
+    if (writers_[iface]) {
+        roc_log(LogError, "receiver decoder: %s interface is already activated",
+                address::interface_to_str(iface));
+        return false;
+    }
+
+    pipeline::ReceiverLoop::Tasks::CreateEndpoint endpoint_task(slot_, iface, proto);
+    if (!pipeline_.schedule_and_wait(endpoint_task)) {
+        roc_log(LogError, "receiver decoder: can't add %s endpoint to pipeline",
+                address::interface_to_str(iface));
+        return false;
+    }
+
+    writers_[iface] = endpoint_task.get_writer();
+
+    return true;
+}
+
+bool ReceiverDecoder::write_packet(address::Interface iface,
+                                   const void* bytes,
+                                   size_t size) {
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    packet::IWriter* writer = NULL;
+
+    {
+        core::Mutex::Lock lock(mutex_);
+        writer = writers_[iface];
+    }
+
+    if (!writer) {
+        roc_log(LogError,
+                "receiver decoder: can't write packet: %s interface not activated",
+                address::interface_to_str(iface));
+        return false;
+    }
+
+    core::Slice<uint8_t> buffer = context().byte_buffer_factory().new_buffer();
+    if (!buffer) {
+        roc_log(LogError, "receiver decoder: can't allocate buffer");
+        return false;
+    }
+
+    if (size > buffer.capacity()) {
+        roc_log(LogError,
+                "receiver decoder: can't write packet: packet too large:"
+                " packet_size=%lu max_size=%lu",
+                (unsigned long)size, (unsigned long)buffer.capacity());
+        return false;
+    }
+
+    buffer.reslice(0, size);
+    memcpy(buffer.data(), bytes, size);
+
+    packet::PacketPtr pp = context().packet_factory().new_packet();
+    if (!pp) {
+        roc_log(LogError, "receiver decoder: can't allocate packet");
+        return false;
+    }
+
+    pp->set_data(buffer);
+
+    pp->add_flags(packet::Packet::FlagUDP);
+    pp->udp()->src_addr = src_address_;
+    pp->udp()->receive_timestamp = core::timestamp(core::ClockUnix);
+
+    writer->write(pp);
+
+    return true;
+}
+
+sndio::ISource& ReceiverDecoder::source() {
+    roc_panic_if_not(valid());
+
+    return pipeline_.source();
+}
+
+void ReceiverDecoder::schedule_task_processing(pipeline::PipelineLoop&,
+                                               core::nanoseconds_t deadline) {
+    context().control_loop().schedule_at(processing_task_, deadline, NULL);
+}
+
+void ReceiverDecoder::cancel_task_processing(pipeline::PipelineLoop&) {
+    context().control_loop().async_cancel(processing_task_);
+}
+
+} // namespace peer
+} // namespace roc
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_peer/receiver_decoder.h
+//! @brief Receiver decoder.
+
+#ifndef ROC_PEER_RECEIVER_DECODER_H_
+#define ROC_PEER_RECEIVER_DECODER_H_
+
+#include "roc_address/interface.h"
+#include "roc_address/protocol.h"
+#include "roc_address/socket_addr.h"
+#include "roc_core/mutex.h"
+#include "roc_packet/iwriter.h"
+#include "roc_peer/basic_peer.h"
+#include "roc_peer/context.h"
+#include "roc_pipeline/ipipeline_task_scheduler.h"
+#include "roc_pipeline/receiver_loop.h"
+
+namespace roc {
+namespace peer {
+
+//! Receiver decoder.
+//!
+//! Same as Receiver, but instead of receiving packets from network ports, gets
+//! them from the user, who receives them using its own transport.
+//!
+//! Doesn't use clock: frames are decoded as soon as they are read. All packets
+//! are assumed to come from the same sender and are routed to one session.
+class ReceiverDecoder : public BasicPeer, private pipeline::IPipelineTaskScheduler {
+public:
+    //! Initialize.
+    ReceiverDecoder(Context& context, const pipeline::ReceiverConfig& pipeline_config);
+
+    //! Deinitialize.
+    ~ReceiverDecoder();
+
+    //! Check if successfully constructed.
+    bool valid() const;
+
+    //! Activate interface.
+    //! @remarks
+    //!  Creates endpoint for given interface, to which packets are then passed
+    //!  by write_packet().
+    bool activate(address::Interface iface, address::Protocol proto);
+
+    //! Write packet to given interface.
+    //! @remarks
+    //!  Copies @p size bytes from @p bytes into a new packet and enqueues it
+    //!  to the pipeline. Packet is parsed when next frame is read.
+    //! @returns
+    //!  false if interface is not activated or allocation failed.
+    bool write_packet(address::Interface iface, const void* bytes, size_t size);
+
+    //! Get decoder source.
+    //! @remarks
+    //!  Samples decoded from written packets become available in this source.
+    sndio::ISource& source();
+
+private:
+    virtual void schedule_task_processing(pipeline::PipelineLoop&,
+                                          core::nanoseconds_t delay);
+    virtual void cancel_task_processing(pipeline::PipelineLoop&);
+
+    core::Mutex mutex_;
+
+    pipeline::ReceiverLoop pipeline_;
+    ctl::ControlLoop::Tasks::PipelineProcessing processing_task_;
+
+    pipeline::ReceiverLoop::SlotHandle slot_;
+
+    packet::IWriter* writers_[address::Iface_Max];
+
+    // address used as source of all packets, to route them to one session
+    address::SocketAddr src_address_;
+
+    bool valid_;
+};
+
+} // namespace peer
+} // namespace roc
+
+#endif // ROC_PEER_RECEIVER_DECODER_H_
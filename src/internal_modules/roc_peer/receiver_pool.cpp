@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_peer/receiver_pool.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/scoped_ptr.h"
+
+namespace roc {
+namespace peer {
+
+ReceiverPool::ReceiverPool(Context& context,
+                           const pipeline::ReceiverConfig& pipeline_config,
+                           audio::PcmEncoding frame_encoding,
+                           size_t size)
+    : context_(context)
+    , pipeline_config_(pipeline_config)
+    , frame_encoding_(frame_encoding)
+    , size_(size)
+    , idle_(context.allocator())
+    , valid_(false) {
+    roc_log(LogDebug, "receiver pool: initializing: size=%lu", (unsigned long)size_);
+
+    context_.incref();
+
+    if (!idle_.grow(size_)) {
+        roc_log(LogError, "receiver pool: can't allocate pool");
+        return;
+    }
+
+    if (!refill()) {
+        return;
+    }
+
+    valid_ = true;
+}
+
+ReceiverPool::~ReceiverPool() {
+    roc_log(LogDebug, "receiver pool: deinitializing");
+
+    for (size_t n = 0; n < idle_.size(); n++) {
+        close_receiver_(idle_[n]);
+    }
+    idle_.resize(0);
+
+    context_.decref();
+}
+
+bool ReceiverPool::valid() const {
+    return valid_;
+}
+
+Context& ReceiverPool::context() {
+    return context_;
+}
+
+size_t ReceiverPool::num_idle() {
+    core::Mutex::Lock lock(mutex_);
+
+    return idle_.size();
+}
+
+Receiver* ReceiverPool::acquire() {
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        if (idle_.size() != 0) {
+            Receiver* receiver = idle_[idle_.size() - 1];
+            idle_.resize(idle_.size() - 1);
+            return receiver;
+        }
+    }
+
+    roc_log(LogDebug, "receiver pool: no idle receivers, opening new one");
+
+    return open_receiver_();
+}
+
+bool ReceiverPool::refill() {
+    for (;;) {
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            if (idle_.size() >= size_) {
+                return true;
+            }
+        }
+
+        // receiver is opened without holding the lock, so that concurrent
+        // acquire() calls are not blocked
+        Receiver* receiver = open_receiver_();
+        if (!receiver) {
+            return false;
+        }
+
+        core::Mutex::Lock lock(mutex_);
+
+        if (idle_.size() >= size_) {
+            close_receiver_(receiver);
+            return true;
+        }
+
+        idle_.push_back(receiver);
+    }
+}
+
+Receiver* ReceiverPool::open_receiver_() {
+    core::ScopedPtr<Receiver> receiver(
+        new (context_.allocator()) Receiver(context_, pipeline_config_, frame_encoding_),
+        context_.allocator());
+
+    if (!receiver) {
+        roc_log(LogError, "receiver pool: can't allocate receiver");
+        return NULL;
+    }
+
+    if (!receiver->valid()) {
+        roc_log(LogError, "receiver pool: can't initialize receiver");
+        return NULL;
+    }
+
+    // default slot is used by almost every receiver
+    if (!receiver->prepare_slot(0)) {
+        return NULL;
+    }
+
+    return receiver.release();
+}
+
+void ReceiverPool::close_receiver_(Receiver* receiver) {
+    context_.allocator().destroy_object(*receiver);
+}
+
+} // namespace peer
+} // namespace roc
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_peer/receiver_pool.h
+//! @brief Pool of pre-opened receivers.
+
+#ifndef ROC_PEER_RECEIVER_POOL_H_
+#define ROC_PEER_RECEIVER_POOL_H_
+
+#include "roc_audio/pcm_format.h"
+#include "roc_core/array.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_peer/context.h"
+#include "roc_peer/receiver.h"
+#include "roc_pipeline/config.h"
+
+namespace roc {
+namespace peer {
+
+//! Pool of pre-opened receivers.
+//! @remarks
+//!  Constructing a receiver requires many allocations and a round-trip to the
+//!  pipeline to create its slot. The pool does this ahead of time, so that
+//!  acquiring a receiver is just taking a pointer from the array.
+//!
+//!  Acquired receivers are owned by the caller and are destroyed as usual.
+//!  Idle receivers are destroyed together with the pool.
+class ReceiverPool : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Pre-opens @p size receivers with given configuration.
+    ReceiverPool(Context& context,
+                 const pipeline::ReceiverConfig& pipeline_config,
+                 audio::PcmEncoding frame_encoding,
+                 size_t size);
+
+    //! Deinitialize.
+    //! @remarks
+    //!  Destroys idle receivers.
+    ~ReceiverPool();
+
+    //! Check if successfully constructed.
+    bool valid() const;
+
+    //! Pool's context.
+    Context& context();
+
+    //! Get number of idle receivers.
+    size_t num_idle();
+
+    //! Take receiver from the pool.
+    //! @remarks
+    //!  If there are no idle receivers, opens a new one.
+    //! @returns
+    //!  NULL if a new receiver can't be opened.
+    Receiver* acquire();
+
+    //! Pre-open receivers until there are as many idle receivers as pool size.
+    //! @remarks
+    //!  Intended to be called outside of latency-sensitive paths, e.g. from a
+    //!  background thread after acquire(). May be called concurrently with
+    //!  acquire().
+    bool refill();
+
+private:
+    Receiver* open_receiver_();
+    void close_receiver_(Receiver* receiver);
+
+    Context& context_;
+
+    const pipeline::ReceiverConfig pipeline_config_;
+    const audio::PcmEncoding frame_encoding_;
+    const size_t size_;
+
+    core::Mutex mutex_;
+    core::Array<Receiver*> idle_;
+
+    bool valid_;
+};
+
+} // namespace peer
+} // namespace roc
+
+#endif // ROC_PEER_RECEIVER_POOL_H_
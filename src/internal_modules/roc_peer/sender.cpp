@@ -16,16 +16,24 @@
 namespace roc {
 namespace peer {
 
-Sender::Sender(Context& context, const pipeline::SenderConfig& pipeline_config)
+Sender::Sender(Context& context,
+               const pipeline::SenderConfig& pipeline_config,
+               audio::PcmEncoding frame_encoding)
     : BasicPeer(context)
     , pipeline_(*this,
                 pipeline_config,
-                format_map_,
+                context.format_map(),
                 context.packet_factory(),
                 context.byte_buffer_factory(),
                 context.sample_buffer_factory(),
-                context.allocator())
+                context.allocator(),
+                context.clock_domain(),
+                context.batch_encoder())
     , processing_task_(pipeline_)
+    , frame_buf_(context.allocator())
+    , pull_callback_(NULL)
+    , frame_length_(pipeline_config.internal_frame_length)
+    , timing_(pipeline_config.timing)
     , slots_(context.allocator())
     , valid_(false) {
     roc_log(LogDebug, "sender peer: initializing");
@@ -37,12 +45,39 @@ Sender::Sender(Context& context, const pipeline::SenderConfig& pipeline_config)
         return;
     }
 
+    if (frame_encoding != audio::PcmEncoding_Float32) {
+        frame_mapper_.reset(new (frame_mapper_) audio::PcmMapper(
+            audio::PcmFormat(frame_encoding, audio::PcmEndian_Native),
+            audio::PcmFormat(audio::PcmEncoding_Float32, audio::PcmEndian_Native)));
+
+        const size_t frame_size = pipeline_config.input_sample_spec.ns_2_samples_overall(
+            pipeline_config.internal_frame_length);
+
+        if (frame_size == 0 || !frame_buf_.resize(frame_size)) {
+            roc_log(LogError, "sender peer: can't allocate frame buffer");
+            return;
+        }
+    }
+
+    if (pipeline_config.decoupling_buffer_length > 0) {
+        decoupled_sink_.reset(new (decoupled_sink_) pipeline::DecoupledSink(
+            pipeline_.sink(), pipeline_config.internal_frame_length,
+            pipeline_config.decoupling_buffer_length, context.allocator()));
+        if (!decoupled_sink_ || !decoupled_sink_->valid()) {
+            return;
+        }
+    }
+
     valid_ = true;
 }
 
 Sender::~Sender() {
     roc_log(LogDebug, "sender peer: deinitializing");
 
+    // stop pipeline threads before waiting for tasks they could schedule
+    puller_.reset();
+    decoupled_sink_.reset();
+
     context().control_loop().wait(processing_task_);
 
     for (size_t s = 0; s < slots_.size(); s++) {
@@ -154,6 +189,156 @@ bool Sender::set_reuseaddr(size_t slot_index, address::Interface iface, bool ena
     return true;
 }
 
+bool Sender::set_socket_buffer_size(size_t slot_index,
+                                    address::Interface iface,
+                                    size_t size) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogDebug,
+            "sender peer: setting socket buffer size for %s interface of slot %lu"
+            " to %lu",
+            address::interface_to_str(iface), (unsigned long)slot_index,
+            (unsigned long)size);
+
+    Slot* slot = get_slot_(slot_index);
+    if (!slot) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set socket buffer size for %s interface of slot %lu:"
+                " can't create slot",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (slot->ports[iface].handle) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set socket buffer size for %s interface of slot %lu:"
+                " interface is already bound",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    slot->ports[iface].config.send_buffer_size = size;
+
+    return true;
+}
+
+bool Sender::set_dscp(size_t slot_index, address::Interface iface, int dscp) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogDebug, "sender peer: setting dscp for %s interface of slot %lu to %d",
+            address::interface_to_str(iface), (unsigned long)slot_index, dscp);
+
+    Slot* slot = get_slot_(slot_index);
+    if (!slot) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set dscp for %s interface of slot %lu:"
+                " can't create slot",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (slot->ports[iface].handle) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set dscp for %s interface of slot %lu:"
+                " interface is already bound",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    slot->ports[iface].config.dscp = dscp;
+
+    return true;
+}
+
+bool Sender::set_pacing_rate(size_t slot_index, address::Interface iface, size_t rate) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogDebug,
+            "sender peer: setting pacing rate for %s interface of slot %lu to %lu",
+            address::interface_to_str(iface), (unsigned long)slot_index,
+            (unsigned long)rate);
+
+    Slot* slot = get_slot_(slot_index);
+    if (!slot) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set pacing rate for %s interface of slot %lu:"
+                " can't create slot",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (slot->ports[iface].handle) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set pacing rate for %s interface of slot %lu:"
+                " interface is already bound",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    slot->ports[iface].config.pacing_rate = rate;
+
+    return true;
+}
+
+bool Sender::set_connect_socket(size_t slot_index,
+                                address::Interface iface,
+                                bool enabled) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogDebug,
+            "sender peer: setting connect socket for %s interface of slot %lu to %d",
+            address::interface_to_str(iface), (unsigned long)slot_index, (int)enabled);
+
+    Slot* slot = get_slot_(slot_index);
+    if (!slot) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set connect socket for %s interface of slot %lu:"
+                " can't create slot",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (slot->ports[iface].handle) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't set connect socket for %s interface of slot %lu:"
+                " interface is already bound",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    slot->ports[iface].connect_enabled = enabled;
+
+    return true;
+}
+
 bool Sender::connect(size_t slot_index,
                      address::Interface iface,
                      const address::EndpointUri& uri) {
@@ -207,6 +392,19 @@ bool Sender::connect(size_t slot_index,
 
     const address::SocketAddr& address = resolve_task.get_address();
 
+    if (slot->endpoints[iface]) {
+        return add_destination_(*slot, slot_index, iface, address);
+    }
+
+    // Connected port has a different config, so it is never shared with
+    // other interfaces by select_outgoing_port_().
+    // Path mtu is not needed for control interface, since its packet size
+    // is not tuned to it.
+    if (slot->ports[iface].connect_enabled) {
+        slot->ports[iface].config.connect_address = address;
+        slot->ports[iface].config.mtu_discovery = iface != address::Iface_AudioControl;
+    }
+
     Port& port = select_outgoing_port_(*slot, iface, address.family());
 
     if (!setup_outgoing_port_(port, iface, address.family())) {
@@ -253,6 +451,22 @@ bool Sender::connect(size_t slot_index,
         return false;
     }
 
+    if (port.max_payload_size != 0 && iface != address::Iface_AudioControl) {
+        pipeline::SenderLoop::Tasks::SetSlotMaxPacketSize size_task(
+            slot->slot, port.max_payload_size);
+
+        // not fatal: packets that don't fit path mtu are fragmented by kernel
+        if (!pipeline_.schedule_and_wait(size_task)) {
+            roc_log(LogError,
+                    "sender peer:"
+                    " can't fit packets of slot %lu into path mtu: max_size=%lu",
+                    (unsigned long)slot_index, (unsigned long)port.max_payload_size);
+        }
+    }
+
+    slot->endpoints[iface] = endpoint_task.get_handle();
+    slot->families[iface] = address.family();
+
     update_compatibility_(iface, uri);
 
     return true;
@@ -281,12 +495,139 @@ bool Sender::is_ready() {
     return true;
 }
 
+bool Sender::get_metrics(size_t slot_index, pipeline::SenderSlotMetrics& metrics) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    if (slots_.size() <= slot_index || !slots_[slot_index].slot) {
+        roc_log(LogError, "sender peer: can't get metrics of slot %lu: no such slot",
+                (unsigned long)slot_index);
+        return false;
+    }
+
+    pipeline_.get_metrics(slots_[slot_index].slot, metrics);
+
+    return true;
+}
+
 sndio::ISink& Sender::sink() {
     roc_panic_if_not(valid());
 
+    if (decoupled_sink_) {
+        return *decoupled_sink_;
+    }
+
     return pipeline_.sink();
 }
 
+size_t Sender::frame_sample_size() const {
+    roc_panic_if_not(valid());
+
+    if (frame_mapper_) {
+        return frame_mapper_->input_byte_count(1);
+    }
+
+    return sizeof(audio::sample_t);
+}
+
+void Sender::write_pcm(void* bytes, size_t n_bytes) {
+    roc_panic_if_not(valid());
+
+    if (!frame_mapper_) {
+        audio::Frame frame((audio::sample_t*)bytes, n_bytes / sizeof(audio::sample_t));
+        sink().write(frame);
+        return;
+    }
+
+    const size_t n_samples = frame_mapper_->input_sample_count(n_bytes);
+
+    size_t in_bit_off = 0;
+
+    for (size_t pos = 0; pos < n_samples;) {
+        size_t out_bit_off = 0;
+
+        const size_t n_mapped = frame_mapper_->map(
+            bytes, n_bytes, in_bit_off, frame_buf_.data(),
+            frame_buf_.size() * sizeof(audio::sample_t), out_bit_off,
+            std::min(frame_buf_.size(), n_samples - pos));
+
+        audio::Frame frame(frame_buf_.data(), n_mapped);
+        sink().write(frame);
+
+        pos += n_mapped;
+    }
+}
+
+void Sender::write_frames(audio::sample_t* const* frames,
+                          size_t n_frames,
+                          size_t frame_size) {
+    roc_panic_if_not(valid());
+
+    if (decoupled_sink_) {
+        for (size_t n = 0; n < n_frames; n++) {
+            audio::Frame frame(frames[n], frame_size);
+            decoupled_sink_->write(frame);
+        }
+        return;
+    }
+
+    pipeline_.write_frames(frames, n_frames, frame_size);
+}
+
+core::nanoseconds_t Sender::write_delay() {
+    roc_panic_if_not(valid());
+
+    if (decoupled_sink_) {
+        return 0;
+    }
+
+    return pipeline_.write_delay();
+}
+
+bool Sender::start_pulling(pipeline::IFrameCallback& callback) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    if (puller_) {
+        roc_log(LogError, "sender peer: can't start pulling: already started");
+        return false;
+    }
+
+    if (!timing_) {
+        roc_log(LogError, "sender peer: can't start pulling: internal clock is disabled");
+        return false;
+    }
+
+    if (decoupled_sink_) {
+        roc_log(LogError,
+                "sender peer: can't start pulling: not supported with decoupling");
+        return false;
+    }
+
+    if (frame_mapper_) {
+        roc_log(LogError,
+                "sender peer: can't start pulling: supported only with float frames");
+        return false;
+    }
+
+    puller_.reset(new (puller_) pipeline::SenderPuller(pipeline_, callback, frame_length_,
+                                                       context().allocator()));
+    if (!puller_ || !puller_->valid()) {
+        puller_.reset();
+        return false;
+    }
+
+    pull_callback_ = &callback;
+
+    return true;
+}
+
+pipeline::IFrameCallback* Sender::pull_callback() const {
+    return pull_callback_;
+}
+
 bool Sender::check_compatibility_(address::Interface iface,
                                   const address::EndpointUri& uri) {
     if (used_interfaces_[iface] && used_protocols_[iface] != uri.proto()) {
@@ -327,6 +668,47 @@ Sender::Slot* Sender::get_slot_(size_t slot_index) {
     return &slots_[slot_index];
 }
 
+bool Sender::add_destination_(Slot& slot,
+                              size_t slot_index,
+                              address::Interface iface,
+                              const address::SocketAddr& address) {
+    // Interface is already connected. Instead of creating one more endpoint,
+    // which would compose every packet again, we add one more destination
+    // address to the existing endpoint, so that packets are composed once
+    // and sent to all addresses through the same outgoing port.
+    if (slot.ports[iface].connect_enabled) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't connect %s interface of slot %lu:"
+                " interface uses connected socket and is already connected",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    if (address.family() != slot.families[iface]) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't connect %s interface of slot %lu:"
+                " address family differs from already connected address",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    pipeline::SenderLoop::Tasks::AddEndpointDestinationAddress address_task(
+        slot.endpoints[iface], address);
+
+    if (!pipeline_.schedule_and_wait(address_task)) {
+        roc_log(LogError,
+                "sender peer:"
+                " can't connect %s interface of slot %lu:"
+                " can't add endpoint destination address",
+                address::interface_to_str(iface), (unsigned long)slot_index);
+        return false;
+    }
+
+    return true;
+}
+
 Sender::Port& Sender::select_outgoing_port_(Slot& slot,
                                             address::Interface iface,
                                             address::AddrFamily family) {
@@ -403,6 +785,7 @@ bool Sender::setup_outgoing_port_(Port& port,
 
         port.handle = port_task.get_handle();
         port.writer = port_task.get_writer();
+        port.max_payload_size = port_task.get_max_payload_size();
 
         roc_log(LogInfo, "sender peer: bound %s interface to %s",
                 address::interface_to_str(iface),
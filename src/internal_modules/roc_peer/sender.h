@@ -15,14 +15,20 @@
 #include "roc_address/endpoint_uri.h"
 #include "roc_address/interface.h"
 #include "roc_address/protocol.h"
+#include "roc_audio/pcm_mapper.h"
+#include "roc_audio/sample.h"
+#include "roc_core/array.h"
 #include "roc_core/mutex.h"
+#include "roc_core/optional.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_packet/iwriter.h"
 #include "roc_peer/basic_peer.h"
 #include "roc_peer/context.h"
+#include "roc_pipeline/decoupled_sink.h"
+#include "roc_pipeline/iframe_callback.h"
 #include "roc_pipeline/ipipeline_task_scheduler.h"
 #include "roc_pipeline/sender_loop.h"
-#include "roc_rtp/format_map.h"
+#include "roc_pipeline/sender_puller.h"
 
 namespace roc {
 namespace peer {
@@ -31,7 +37,11 @@ namespace peer {
 class Sender : public BasicPeer, private pipeline::IPipelineTaskScheduler {
 public:
     //! Initialize.
-    Sender(Context& context, const pipeline::SenderConfig& pipeline_config);
+    //! @remarks
+    //!  @p frame_encoding defines encoding of samples passed to write_pcm().
+    Sender(Context& context,
+           const pipeline::SenderConfig& pipeline_config,
+           audio::PcmEncoding frame_encoding = audio::PcmEncoding_Float32);
 
     //! Deinitialize.
     ~Sender();
@@ -46,6 +56,21 @@ public:
     //! Set reuseaddr option for given endpoint type.
     bool set_reuseaddr(size_t slot_index, address::Interface iface, bool enabled);
 
+    //! Set kernel socket buffer size for given endpoint type.
+    bool set_socket_buffer_size(size_t slot_index, address::Interface iface, size_t size);
+
+    //! Set DSCP of outgoing packets for given endpoint type.
+    bool set_dscp(size_t slot_index, address::Interface iface, int dscp);
+
+    //! Set pacing rate of outgoing packets for given endpoint type.
+    bool set_pacing_rate(size_t slot_index, address::Interface iface, size_t rate);
+
+    //! Enable or disable connected socket for given endpoint type.
+    //! @remarks
+    //!  Connected socket avoids per-packet route lookups, but can't be shared
+    //!  with other interfaces and can't send to multiple destinations.
+    bool set_connect_socket(size_t slot_index, address::Interface iface, bool enabled);
+
     //! Connect peer to remote endpoint.
     bool
     connect(size_t slot_index, address::Interface iface, const address::EndpointUri& uri);
@@ -53,28 +78,76 @@ public:
     //! Check if all necessary bind and connect calls were made.
     bool is_ready();
 
+    //! Get metrics of given slot.
+    //! @remarks
+    //!  Doesn't wait for the pipeline thread.
+    bool get_metrics(size_t slot_index, pipeline::SenderSlotMetrics& metrics);
+
     //! Get sender sink.y
     sndio::ISink& sink();
 
+    //! Get time left until next frame can be written without blocking.
+    //! @remarks
+    //!  Always zero when decoupling buffer is enabled.
+    core::nanoseconds_t write_delay();
+
+    //! Get size of one sample passed to write_pcm(), in bytes.
+    size_t frame_sample_size() const;
+
+    //! Write samples in frame encoding.
+    //! @remarks
+    //!  If frame encoding is not Float32, samples are converted in chunks of
+    //!  internal frame length and written to sink().
+    //!  @p n_bytes should be multiple of frame_sample_size() times number of
+    //!  channels.
+    void write_pcm(void* bytes, size_t n_bytes);
+
+    //! Write multiple frames at once.
+    //! @remarks
+    //!  Same as writing frames to sink() one by one, but when possible,
+    //!  the pipeline is entered only once. See SenderLoop::write_frames().
+    void write_frames(audio::sample_t* const* frames, size_t n_frames, size_t frame_size);
+
+    //! Start pulling frames from callback.
+    //! @remarks
+    //!  Starts a thread which invokes @p callback every time the next frame is
+    //!  due according to the internal clock, and writes returned samples to the
+    //!  pipeline. Requires timing and can't be used with decoupling buffer.
+    //!  The callback should be alive until the sender is destroyed.
+    bool start_pulling(pipeline::IFrameCallback& callback);
+
+    //! Get callback passed to start_pulling(), or NULL.
+    pipeline::IFrameCallback* pull_callback() const;
+
 private:
     struct Port {
         netio::UdpSenderConfig config;
         netio::UdpSenderConfig orig_config;
         netio::NetworkLoop::PortHandle handle;
         packet::IWriter* writer;
+        size_t max_payload_size;
+        bool connect_enabled;
 
         Port()
             : handle(NULL)
-            , writer(NULL) {
+            , writer(NULL)
+            , max_payload_size(0)
+            , connect_enabled(false) {
         }
     };
 
     struct Slot {
         pipeline::SenderLoop::SlotHandle slot;
         Port ports[address::Iface_Max];
+        pipeline::SenderLoop::EndpointHandle endpoints[address::Iface_Max];
+        address::AddrFamily families[address::Iface_Max];
 
         Slot()
             : slot(NULL) {
+            for (size_t i = 0; i < address::Iface_Max; i++) {
+                endpoints[i] = NULL;
+                families[i] = address::Family_Unknown;
+            }
         }
     };
 
@@ -87,6 +160,10 @@ private:
     bool setup_outgoing_port_(Port& port,
                               address::Interface iface,
                               address::AddrFamily family);
+    bool add_destination_(Slot& slot,
+                          size_t slot_index,
+                          address::Interface iface,
+                          const address::SocketAddr& address);
 
     virtual void schedule_task_processing(pipeline::PipelineLoop&,
                                           core::nanoseconds_t delay);
@@ -94,11 +171,19 @@ private:
 
     core::Mutex mutex_;
 
-    rtp::FormatMap format_map_;
-
     pipeline::SenderLoop pipeline_;
     ctl::ControlLoop::Tasks::PipelineProcessing processing_task_;
 
+    core::Optional<pipeline::DecoupledSink> decoupled_sink_;
+    core::Optional<audio::PcmMapper> frame_mapper_;
+    core::Array<audio::sample_t> frame_buf_;
+
+    core::Optional<pipeline::SenderPuller> puller_;
+    pipeline::IFrameCallback* pull_callback_;
+
+    const core::nanoseconds_t frame_length_;
+    const bool timing_;
+
     core::Array<Slot, 8> slots_;
 
     bool used_interfaces_[address::Iface_Max];
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_peer/sender_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace peer {
+
+namespace {
+
+pipeline::SenderConfig make_pipeline_config(const pipeline::SenderConfig& config) {
+    pipeline::SenderConfig pipeline_config = config;
+
+    // user pushes frames at its own pace
+    pipeline_config.timing = false;
+
+    return pipeline_config;
+}
+
+} // namespace
+
+SenderEncoder::SenderEncoder(Context& context,
+                             const pipeline::SenderConfig& pipeline_config)
+    : BasicPeer(context)
+    , pipeline_(*this,
+                make_pipeline_config(pipeline_config),
+                context.format_map(),
+                context.packet_factory(),
+                context.byte_buffer_factory(),
+                context.sample_buffer_factory(),
+                context.allocator(),
+                NULL,
+                context.batch_encoder())
+    , processing_task_(pipeline_)
+    , slot_(NULL)
+    , valid_(false) {
+    roc_log(LogDebug, "sender encoder: initializing");
+
+    if (!pipeline_.valid()) {
+        return;
+    }
+
+    pipeline::SenderLoop::Tasks::CreateSlot task;
+    if (!pipeline_.schedule_and_wait(task)) {
+        roc_log(LogError, "sender encoder: failed to create slot");
+        return;
+    }
+    slot_ = task.get_handle();
+
+    valid_ = true;
+}
+
+SenderEncoder::~SenderEncoder() {
+    roc_log(LogDebug, "sender encoder: deinitializing");
+
+    context().control_loop().wait(processing_task_);
+}
+
+bool SenderEncoder::valid() const {
+    return valid_;
+}
+
+bool SenderEncoder::activate(address::Interface iface, address::Protocol proto) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    roc_log(LogInfo, "sender encoder: activating %s interface with protocol %s",
+            address::interface_to_str(iface), address::proto_to_str(proto));
+
+    if (queues_[iface]) {
+        roc_log(LogError, "sender encoder: %s interface is already activated",
+                address::interface_to_str(iface));
+        return false;
+    }
+
+    queues_[iface].reset(new (queues_[iface]) packet::ConcurrentQueue(
+        packet::ConcurrentQueue::NonBlocking));
+
+    pipeline::SenderLoop::Tasks::CreateEndpoint endpoint_task(slot_, iface, proto);
+    if (!pipeline_.schedule_and_wait(endpoint_task)) {
+        roc_log(LogError, "sender encoder: can't add %s endpoint to pipeline",
+                address::interface_to_str(iface));
+        queues_[iface].reset();
+        return false;
+    }
+
+    pipeline::SenderLoop::Tasks::SetEndpointDestinationWriter writer_task(
+        endpoint_task.get_handle(), *queues_[iface]);
+    if (!pipeline_.schedule_and_wait(writer_task)) {
+        roc_log(LogError,
+                "sender encoder: can't set destination writer for %s endpoint",
+                address::interface_to_str(iface));
+        return false;
+    }
+
+    return true;
+}
+
+bool SenderEncoder::is_ready() {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    pipeline::SenderLoop::Tasks::CheckSlotIsReady task(slot_);
+    return pipeline_.schedule_and_wait(task);
+}
+
+sndio::ISink& SenderEncoder::sink() {
+    roc_panic_if_not(valid());
+
+    return pipeline_.sink();
+}
+
+bool SenderEncoder::read_packet(address::Interface iface, void* bytes, size_t& size) {
+    core::Mutex::Lock lock(mutex_);
+
+    roc_panic_if_not(valid());
+
+    roc_panic_if(iface < 0);
+    roc_panic_if(iface >= (int)address::Iface_Max);
+
+    if (!queues_[iface]) {
+        roc_log(LogError, "sender encoder: can't read packet: %s interface not activated",
+                address::interface_to_str(iface));
+        return false;
+    }
+
+    packet::PacketPtr pp = pending_packets_[iface];
+    if (!pp) {
+        pp = queues_[iface]->read();
+    }
+    pending_packets_[iface] = NULL;
+
+    if (!pp) {
+        return false;
+    }
+
+    const core::Slice<uint8_t>& data = pp->data();
+
+    if (data.size() > size) {
+        roc_log(LogError,
+                "sender encoder: can't read packet: buffer too small:"
+                " buffer_size=%lu packet_size=%lu",
+                (unsigned long)size, (unsigned long)data.size());
+        // keep packet, so that it can be read again into a larger buffer
+        pending_packets_[iface] = pp;
+        size = data.size();
+        return false;
+    }
+
+    memcpy(bytes, data.data(), data.size());
+    size = data.size();
+
+    return true;
+}
+
+void SenderEncoder::schedule_task_processing(pipeline::PipelineLoop&,
+                                             core::nanoseconds_t deadline) {
+    context().control_loop().schedule_at(processing_task_, deadline, NULL);
+}
+
+void SenderEncoder::cancel_task_processing(pipeline::PipelineLoop&) {
+    context().control_loop().async_cancel(processing_task_);
+}
+
+} // namespace peer
+} // namespace roc
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_peer/sender_encoder.h
+//! @brief Sender encoder.
+
+#ifndef ROC_PEER_SENDER_ENCODER_H_
+#define ROC_PEER_SENDER_ENCODER_H_
+
+#include "roc_address/interface.h"
+#include "roc_address/protocol.h"
+#include "roc_core/mutex.h"
+#include "roc_core/optional.h"
+#include "roc_packet/concurrent_queue.h"
+#include "roc_peer/basic_peer.h"
+#include "roc_peer/context.h"
+#include "roc_pipeline/ipipeline_task_scheduler.h"
+#include "roc_pipeline/sender_loop.h"
+
+namespace roc {
+namespace peer {
+
+//! Sender encoder.
+//!
+//! Same as Sender, but instead of sending packets to network ports, keeps them
+//! in per-interface queues, from which the user takes them and delivers using
+//! its own transport.
+//!
+//! Doesn't use clock: frames are encoded as soon as they are written.
+class SenderEncoder : public BasicPeer, private pipeline::IPipelineTaskScheduler {
+public:
+    //! Initialize.
+    SenderEncoder(Context& context, const pipeline::SenderConfig& pipeline_config);
+
+    //! Deinitialize.
+    ~SenderEncoder();
+
+    //! Check if successfully constructed.
+    bool valid() const;
+
+    //! Activate interface.
+    //! @remarks
+    //!  Creates endpoint for given interface, packets of which are then returned
+    //!  by read_packet().
+    bool activate(address::Interface iface, address::Protocol proto);
+
+    //! Check if all necessary interfaces were activated.
+    bool is_ready();
+
+    //! Get encoder sink.
+    //! @remarks
+    //!  Samples written to the sink are encoded into packets.
+    sndio::ISink& sink();
+
+    //! Read next encoded packet of given interface.
+    //! @remarks
+    //!  Copies packet bytes to @p bytes, which has room for @p size bytes,
+    //!  and updates @p size to the actual packet size.
+    //! @returns
+    //!  false if there are no packets or the buffer is too small.
+    bool read_packet(address::Interface iface, void* bytes, size_t& size);
+
+private:
+    virtual void schedule_task_processing(pipeline::PipelineLoop&,
+                                          core::nanoseconds_t delay);
+    virtual void cancel_task_processing(pipeline::PipelineLoop&);
+
+    core::Mutex mutex_;
+
+    // declared before pipeline, which writes to them until destroyed
+    core::Optional<packet::ConcurrentQueue> queues_[address::Iface_Max];
+
+    // packet which didn't fit into user buffer, returned by next read
+    packet::PacketPtr pending_packets_[address::Iface_Max];
+
+    pipeline::SenderLoop pipeline_;
+    ctl::ControlLoop::Tasks::PipelineProcessing processing_task_;
+
+    pipeline::SenderLoop::SlotHandle slot_;
+
+    bool valid_;
+};
+
+} // namespace peer
+} // namespace roc
+
+#endif // ROC_PEER_SENDER_ENCODER_H_
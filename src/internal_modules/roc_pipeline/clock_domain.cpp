@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/clock_domain.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+ClockDomain::ClockDomain()
+    : epoch_(-1) {
+}
+
+core::nanoseconds_t ClockDomain::join(core::nanoseconds_t now,
+                                      core::nanoseconds_t frame_length) {
+    if (frame_length <= 0) {
+        roc_panic("clock domain: frame length should be positive: frame_length=%lld",
+                  (long long)frame_length);
+    }
+
+    core::Mutex::Lock lock(mutex_);
+
+    if (epoch_ < 0) {
+        epoch_ = now;
+        roc_log(LogDebug, "clock domain: setting epoch: epoch=%lld", (long long)now);
+        return now;
+    }
+
+    if (now <= epoch_) {
+        return epoch_;
+    }
+
+    const core::nanoseconds_t n_frames = (now - epoch_ + frame_length - 1) / frame_length;
+
+    return epoch_ + n_frames * frame_length;
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/clock_domain.h
+//! @brief Clock domain.
+
+#ifndef ROC_PIPELINE_CLOCK_DOMAIN_H_
+#define ROC_PIPELINE_CLOCK_DOMAIN_H_
+
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Clock domain.
+//!
+//! Common time base for pipelines with timing enabled. By default, every pipeline
+//! starts its ticker when the first frame is processed, so pipelines started at
+//! different times wake up at unrelated moments. Pipelines attached to the same
+//! clock domain instead start their tickers at frame boundaries counted from the
+//! common epoch. If they use the same frame duration, all of them wake up at the
+//! same moments, and a single thread serving them all needs one wakeup per frame.
+//!
+//! Thread-safe.
+class ClockDomain : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    ClockDomain();
+
+    //! Get start time for a pipeline joining the domain.
+    //! @remarks
+    //!  Returns the nearest frame boundary not before @p now. Frame boundaries
+    //!  are multiples of @p frame_length counted from the epoch. The epoch is
+    //!  set to @p now when the domain is joined first time.
+    core::nanoseconds_t join(core::nanoseconds_t now, core::nanoseconds_t frame_length);
+
+private:
+    core::Mutex mutex_;
+    core::nanoseconds_t epoch_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_CLOCK_DOMAIN_H_
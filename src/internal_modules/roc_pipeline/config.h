@@ -13,20 +13,28 @@
 #define ROC_PIPELINE_CONFIG_H_
 
 #include "roc_address/protocol.h"
+#include "roc_audio/channel_layout.h"
 #include "roc_audio/freq_estimator.h"
 #include "roc_audio/latency_monitor.h"
+#include "roc_audio/mixer.h"
+#include "roc_audio/packetizer.h"
 #include "roc_audio/profiler.h"
 #include "roc_audio/resampler_backend.h"
 #include "roc_audio/resampler_profile.h"
 #include "roc_audio/sample_spec.h"
 #include "roc_audio/watchdog.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
 #include "roc_core/time.h"
+#include "roc_fec/block_size_controller.h"
 #include "roc_fec/codec_config.h"
 #include "roc_fec/reader.h"
 #include "roc_fec/writer.h"
+#include "roc_packet/impairer.h"
 #include "roc_packet/units.h"
+#include "roc_rtcp/session.h"
 #include "roc_rtp/headers.h"
+#include "roc_rtp/srtp_config.h"
 #include "roc_rtp/validator.h"
 
 namespace roc {
@@ -47,12 +55,24 @@ const core::nanoseconds_t DefaultLatency = 200 * core::Millisecond;
 //! Default internal frame length.
 const core::nanoseconds_t DefaultInternalFrameLength = 7 * core::Millisecond;
 
+//! Internal frame length used in low-latency mode.
+const core::nanoseconds_t LowLatencyInternalFrameLength = 1 * core::Millisecond;
+
+//! Receiver control interval used in low-latency mode.
+const core::nanoseconds_t LowLatencyControlInterval = 5 * core::Millisecond;
+
 //! Default minum latency relative to target latency.
 const int DefaultMinLatencyFactor = -1;
 
 //! Default maximum latency relative to target latency.
 const int DefaultMaxLatencyFactor = 2;
 
+//! Default size of per-session memory arena, in bytes.
+const size_t DefaultSessionArenaSize = 64 * 1024;
+
+//! Default number of cached session arenas per receiver slot.
+const size_t DefaultCachedSessionArenas = 2;
+
 //! Task processing parameters.
 struct TaskConfig {
     //! Enable precise task scheduling mode (default).
@@ -74,6 +94,14 @@ struct TaskConfig {
     //! Set to zero to disable frame splitting.
     core::nanoseconds_t max_frame_length_between_tasks;
 
+    //! Enable adaptive frame splitting.
+    //! When enabled, pipeline measures how much time it takes to process one sample,
+    //! and estimates how much time is needed to process the rest of the frame. Tasks
+    //! between sub-frames are then processed until the rest of the frame still fits
+    //! before the next frame deadline, instead of max_inframe_task_processing.
+    //! Also, frame is not split into sub-frames if there are no pending tasks.
+    bool enable_adaptive_frame_splitting;
+
     //! Mximum task processing duration happening immediatelly after processing a frame.
     //! If this period expires and there are still pending tasks, asynchronous
     //! task processing is scheduled.
@@ -92,6 +120,7 @@ struct TaskConfig {
         : enable_precise_task_scheduling(true)
         , min_frame_length_between_tasks(200 * core::Microsecond)
         , max_frame_length_between_tasks(DefaultInternalFrameLength)
+        , enable_adaptive_frame_splitting(false)
         , max_inframe_task_processing(20 * core::Microsecond)
         , task_processing_prohibited_interval(200 * core::Microsecond) {
     }
@@ -114,6 +143,12 @@ struct SenderConfig {
     //! FEC encoder parameters.
     fec::CodecConfig fec_encoder;
 
+    //! FEC block size adaptation parameters.
+    fec::BlockSizeControllerConfig fec_block_sizing;
+
+    //! RTCP session parameters.
+    rtcp::SessionConfig rtcp;
+
     //! Input sample spec
     audio::SampleSpec input_sample_spec;
 
@@ -123,15 +158,62 @@ struct SenderConfig {
     //! Packet length, in nanoseconds.
     core::nanoseconds_t packet_length;
 
+    //! Maximum packet length when it's tuned to path MTU, in nanoseconds.
+    //! When path MTU becomes known, packet length is set to the largest length
+    //! for which packets fit into one MTU, but not larger than this value,
+    //! which thus defines latency budget of packetization. If zero, packet
+    //! length is only reduced below packet_length if packets don't fit MTU.
+    core::nanoseconds_t max_packet_length;
+
     //! RTP payload type for audio packets.
     rtp::PayloadType payload_type;
 
     //! Resample frames with a constant ratio.
     bool resampling;
 
+    //! Packetize at input sample rate when possible.
+    //! If the format of payload_type has other sample rate than input, look for
+    //! a registered PCM format with same encoding and channels and input sample
+    //! rate, and use it instead of resampling. RTP timestamps then run at input
+    //! sample rate. Receiver should have the same format registered.
+    bool match_input_rate;
+
     //! Interleave packets.
     bool interleaving;
 
+    //! Maximum delay added by interleaving, in nanoseconds.
+    //! If non-zero, packets are reordered so that every packet is delayed by at
+    //! most this duration, converted to number of packets using packet_length,
+    //! but by at least one packet. If zero, packets may be delayed by up to a
+    //! whole FEC block.
+    core::nanoseconds_t interleaving_max_delay;
+
+    //! Add capture time to every packet using RTP header extension.
+    //! Allows receiver to map packets to sender NTP time without waiting
+    //! for RTCP reports.
+    bool capture_timestamps;
+
+    //! Discontinuous transmission parameters.
+    //! If enabled, packets are not sent during silence, except rare keepalive
+    //! packets. Receiver detects such pauses automatically.
+    audio::DtxConfig dtx;
+
+    //! Maximum size of multiplexed datagrams, in bytes.
+    //! If non-zero, consecutive audio and repair packets of a frame are combined
+    //! into datagrams of up to this size, to reduce packet rate and per-packet
+    //! UDP/IP overhead. Receiver should have multiplexing enabled.
+    size_t multiplexed_packet_size;
+
+    //! Simulated network impairments.
+    //! Applied to outgoing packets of every endpoint independently, after
+    //! multiplexing. Intended for testing only.
+    packet::ImpairerConfig impairment;
+
+    //! SRTP and SRTCP parameters.
+    //! If enabled, packets of RTP and RTCP endpoints are encrypted and
+    //! authenticated. Not supported with FEC.
+    rtp::SrtpConfig srtp;
+
     //! Constrain receiver speed using a CPU timer according to the sample rate.
     bool timing;
 
@@ -144,18 +226,37 @@ struct SenderConfig {
     //! Profiler configuration.
     audio::ProfilerConfig profiler_config;
 
+    //! Length of ring buffer between the writer and pipeline, in nanoseconds.
+    //! If non-zero, pipeline runs on a separate thread and the writer only copies
+    //! frames into the ring buffer. If zero, pipeline runs on the writer thread.
+    core::nanoseconds_t decoupling_buffer_length;
+
+    //! Number of worker threads for processing slots in parallel.
+    //! If zero, all slots are processed sequentially on pipeline thread.
+    size_t worker_threads;
+
+    //! Scheduling parameters for worker threads.
+    core::ThreadConfig worker_thread;
+
     SenderConfig()
         : resampler_backend(audio::ResamplerBackend_Default)
         , resampler_profile(audio::ResamplerProfile_Medium)
         , input_sample_spec(DefaultSampleRate, DefaultChannelMask)
         , internal_frame_length(DefaultInternalFrameLength)
         , packet_length(DefaultPacketLength)
+        , max_packet_length(0)
         , payload_type(rtp::PayloadType_L16_Stereo)
         , resampling(false)
+        , match_input_rate(false)
         , interleaving(false)
+        , interleaving_max_delay(0)
+        , capture_timestamps(false)
+        , multiplexed_packet_size(0)
         , timing(false)
         , poisoning(false)
-        , profiling(false) {
+        , profiling(false)
+        , decoupling_buffer_length(0)
+        , worker_threads(0) {
     }
 };
 
@@ -193,17 +294,74 @@ struct ReceiverSessionConfig {
     //! Resampler profile.
     audio::ResamplerProfile resampler_profile;
 
+    //! Gain and ducking of session in the mix.
+    audio::MixerInputConfig mixing;
+
+    //! Size of memory arena for session components, in bytes.
+    //! @remarks
+    //!  Components of the session are allocated from one contiguous block of
+    //!  this size. When it's exhausted, the rest is allocated individually.
+    //!  Zero disables the arena.
+    size_t arena_size;
+
+    //! Maximum number of packets queued in session.
+    //! @remarks
+    //!  Applied separately to source and repair packets. When the queue is
+    //!  full, new packets are dropped, so that a single misbehaving sender
+    //!  can't take all packets of the receiver. Zero means no limit.
+    size_t max_queued_packets;
+
     ReceiverSessionConfig()
         : target_latency(DefaultLatency)
         , payload_type(0)
         , freq_estimator_config()
         , resampler_backend(audio::ResamplerBackend_Default)
-        , resampler_profile(audio::ResamplerProfile_Medium) {
+        , resampler_profile(audio::ResamplerProfile_Medium)
+        , arena_size(DefaultSessionArenaSize)
+        , max_queued_packets(0) {
         latency_monitor.min_latency = target_latency * DefaultMinLatencyFactor;
         latency_monitor.max_latency = target_latency * DefaultMaxLatencyFactor;
     }
 };
 
+//! Receiver slot parameters.
+//! @remarks
+//!  Overrides default session parameters for sessions routed to one slot,
+//!  e.g. to use tight latency for talkback and large latency for music
+//!  on the same receiver.
+struct ReceiverSlotConfig {
+    //! Target latency, nanoseconds.
+    //! @remarks
+    //!  If zero, default session target latency is used. Otherwise, minimum
+    //!  and maximum latency are scaled accordingly.
+    core::nanoseconds_t target_latency;
+
+    //! Override resampler profile.
+    //! @remarks
+    //!  If false, default session resampler profile is used.
+    bool override_resampler_profile;
+
+    //! Resampler profile.
+    audio::ResamplerProfile resampler_profile;
+
+    //! Override mixing parameters.
+    //! @remarks
+    //!  If false, default session mixing parameters are used.
+    //!  E.g. sessions of an announcement slot may have higher ducking
+    //!  priority, so that music from other slots is ducked while they play.
+    bool override_mixing;
+
+    //! Gain and ducking of sessions in the mix.
+    audio::MixerInputConfig mixing;
+
+    ReceiverSlotConfig()
+        : target_latency(0)
+        , override_resampler_profile(false)
+        , resampler_profile(audio::ResamplerProfile_Medium)
+        , override_mixing(false) {
+    }
+};
+
 //! Receiver common parameters.
 //! @remarks
 //!  Defines receiver parameters common for all sessions.
@@ -232,6 +390,106 @@ struct ReceiverCommonConfig {
     //! Insert weird beeps instead of silence on packet loss.
     bool beeping;
 
+    //! Fill packet losses with signal synthesized from preceding samples.
+    //! Ignored if beeping is enabled.
+    bool concealment;
+
+    //! Expect audio and repair packets combined into multiplexed datagrams.
+    //! Should match sender multiplexing setting.
+    bool multiplexing;
+
+    //! Simulated network impairments.
+    //! Applied to incoming datagrams of every endpoint independently, before
+    //! demultiplexing and parsing. Intended for testing only.
+    packet::ImpairerConfig impairment;
+
+    //! SRTP and SRTCP parameters.
+    //! If enabled, packets of RTP and RTCP endpoints should be encrypted and
+    //! authenticated; other packets are dropped. Not supported with FEC.
+    rtp::SrtpConfig srtp;
+
+    //! How to mix channels when session and output channel masks differ.
+    audio::ChannelMixing channel_mixing;
+
+    //! Number of worker threads for processing sessions in parallel.
+    //! If zero, all sessions are processed sequentially on pipeline thread.
+    size_t worker_threads;
+
+    //! Scheduling parameters for worker threads.
+    core::ThreadConfig worker_thread;
+
+    //! RTCP session parameters.
+    rtcp::SessionConfig rtcp;
+
+    //! Number of threads for FEC decoding.
+    //! If non-zero, FEC blocks with losses are decoded in background on this
+    //! number of threads shared by all sessions, using worker_thread scheduling
+    //! parameters. If zero, blocks are decoded on the session thread when a
+    //! lost packet is needed.
+    size_t fec_repair_threads;
+
+    //! Length of ring buffer between pipeline and the reader, in nanoseconds.
+    //! If non-zero, pipeline runs on a separate thread and the reader only copies
+    //! frames from the ring buffer. If zero, pipeline runs on the reader thread.
+    core::nanoseconds_t decoupling_buffer_length;
+
+    //! Don't run the pipeline while receiver is idle.
+    //! If enabled, while there are no sessions and pending packets, frames are
+    //! filled with zeros without entering the pipeline.
+    bool power_saving;
+
+    //! Share clock drift compensation between sessions of one sender.
+    //! If enabled, sessions of a slot which have the same CNAME, reported by
+    //! sender via RTCP, are assumed to share sender clock. Only the oldest of
+    //! them runs FreqEstimator, and resamplers of others follow its scaling.
+    //! Has effect only if resampling is enabled.
+    bool shared_clock;
+
+    //! Number of session memory arenas kept by every slot for reuse.
+    //! When a session ends, its arena is not freed but reused by the next session
+    //! of the same slot, e.g. when an intermittent sender reconnects. Cached arenas
+    //! are released when memory is low. Zero disables caching.
+    size_t cached_session_arenas;
+
+    //! Release memory of idle slots after this timeout, in nanoseconds.
+    //! When a slot has no sessions during this time, cached session arenas and
+    //! other per-slot state kept for reuse are freed, and allocated again only
+    //! when traffic resumes. If zero, memory is kept until slot is removed.
+    //! Timeout is counted only while pipeline is running, i.e. not paused
+    //! by power saving.
+    core::nanoseconds_t idle_release_timeout;
+
+    //! How often to run session control, in nanoseconds.
+    //! Control includes session watchdogs, latency monitors, clock sharing,
+    //! and metrics publishing. Packets are still delivered to sessions every
+    //! frame. If zero, control runs every frame. A non-zero value allows to use
+    //! very short internal frames without multiplying control overhead.
+    core::nanoseconds_t control_interval;
+
+    //! Directory for recording incoming streams.
+    //! If set, every session writes its packets, after FEC recovery and in
+    //! order, to a new rtpdump file in this directory, without decoding them.
+    //! The string should remain valid while receiver exists.
+    const char* recording_dir;
+
+    //! CPU budget for all sessions, as a fraction of real time.
+    //! Enables admission control of new sessions. Load of every session is
+    //! measured, and when the projected load with a new session exceeds this
+    //! budget, multiplied by the number of worker threads if any, the session
+    //! is created with low resampler profile if that is enough, or is rejected,
+    //! so that existing sessions keep real-time guarantees. If resampling is
+    //! enabled and load exceeds the budget, existing sessions are switched to
+    //! low resampler profile, and back when load drops. E.g. 0.8 means 80%
+    //! of frame duration. If zero, load is not limited.
+    float cpu_budget;
+
+    //! Maximum number of sessions mixed at the same time.
+    //! For large conferences. Mixer tracks energy of every session and mixes
+    //! only the given number of loudest ones, i.e. active speakers, at their
+    //! full level. Other sessions are still decoded to stay in sync. If zero,
+    //! all sessions are mixed.
+    size_t max_active_sessions;
+
     ReceiverCommonConfig()
         : output_sample_spec(DefaultSampleRate, DefaultChannelMask)
         , internal_frame_length(DefaultInternalFrameLength)
@@ -239,7 +497,21 @@ struct ReceiverCommonConfig {
         , timing(false)
         , poisoning(false)
         , profiling(false)
-        , beeping(false) {
+        , beeping(false)
+        , concealment(false)
+        , multiplexing(false)
+        , channel_mixing(audio::ChannelMixing_None)
+        , worker_threads(0)
+        , fec_repair_threads(0)
+        , decoupling_buffer_length(0)
+        , power_saving(false)
+        , shared_clock(false)
+        , cached_session_arenas(DefaultCachedSessionArenas)
+        , idle_release_timeout(0)
+        , control_interval(0)
+        , recording_dir(NULL)
+        , cpu_budget(0)
+        , max_active_sessions(0) {
     }
 };
 
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/decoupled_sink.h"
+#include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+DecoupledSink::DecoupledSink(sndio::ISink& out_sink,
+                             core::nanoseconds_t frame_length,
+                             core::nanoseconds_t buffer_length,
+                             core::IAllocator& allocator)
+    : out_sink_(out_sink)
+    , sample_spec_(out_sink.sample_spec())
+    , ring_(allocator,
+            ROC_MAX(sample_spec_.ns_2_samples_overall(buffer_length),
+                    sample_spec_.ns_2_samples_overall(frame_length)))
+    , frame_buf_(allocator)
+    , waiting_(false)
+    , stop_(false)
+    , n_overruns_(0)
+    , valid_(false) {
+    const size_t frame_size = sample_spec_.ns_2_samples_overall(frame_length);
+
+    roc_log(LogDebug, "decoupled sink: initializing: frame_size=%lu buffer_size=%lu",
+            (unsigned long)frame_size, (unsigned long)ring_.capacity());
+
+    if (frame_size == 0) {
+        roc_log(LogError, "decoupled sink: frame length is too small");
+        return;
+    }
+
+    if (!ring_.valid()) {
+        roc_log(LogError, "decoupled sink: can't allocate ring buffer");
+        return;
+    }
+
+    if (!frame_buf_.resize(frame_size)) {
+        roc_log(LogError, "decoupled sink: can't allocate frame buffer");
+        return;
+    }
+
+    if (!core::Thread::start()) {
+        roc_log(LogError, "decoupled sink: can't start thread");
+        return;
+    }
+
+    valid_ = true;
+}
+
+DecoupledSink::~DecoupledSink() {
+    if (core::Thread::joinable()) {
+        stop_ = true;
+        wakeup_sem_.post();
+        core::Thread::join();
+    }
+}
+
+bool DecoupledSink::valid() const {
+    return valid_;
+}
+
+size_t DecoupledSink::num_overruns() const {
+    return (size_t)n_overruns_;
+}
+
+sndio::DeviceType DecoupledSink::type() const {
+    return out_sink_.type();
+}
+
+sndio::DeviceState DecoupledSink::state() const {
+    return out_sink_.state();
+}
+
+void DecoupledSink::pause() {
+    out_sink_.pause();
+}
+
+bool DecoupledSink::resume() {
+    return out_sink_.resume();
+}
+
+bool DecoupledSink::restart() {
+    return out_sink_.restart();
+}
+
+audio::SampleSpec DecoupledSink::sample_spec() const {
+    return sample_spec_;
+}
+
+core::nanoseconds_t DecoupledSink::latency() const {
+    return out_sink_.latency() + sample_spec_.samples_overall_2_ns(ring_.size());
+}
+
+bool DecoupledSink::has_clock() const {
+    return out_sink_.has_clock();
+}
+
+void DecoupledSink::write(audio::Frame& frame) {
+    roc_panic_if(!valid());
+
+    const size_t n_written = ring_.write(frame.samples(), frame.num_samples());
+
+    if (n_written < frame.num_samples()) {
+        ++n_overruns_;
+    }
+
+    if (ring_.size() >= frame_buf_.size()) {
+        wakeup_();
+    }
+}
+
+void DecoupledSink::run() {
+    roc_log(LogDebug, "decoupled sink: starting thread");
+
+    while (!stop_) {
+        if (ring_.size() < frame_buf_.size()) {
+            // Not enough samples for next frame, wait until producer writes more.
+            // Timeout protects from missing a wakeup that happens between the
+            // check above and setting the flag.
+            waiting_ = true;
+            if (ring_.size() < frame_buf_.size()) {
+                (void)wakeup_sem_.timed_wait(
+                    core::timestamp(core::ClockMonotonic)
+                    + sample_spec_.samples_overall_2_ns(frame_buf_.size()));
+            }
+            waiting_ = false;
+            continue;
+        }
+
+        (void)ring_.read(frame_buf_.data(), frame_buf_.size());
+
+        audio::Frame frame(frame_buf_.data(), frame_buf_.size());
+        out_sink_.write(frame);
+    }
+
+    roc_log(LogDebug, "decoupled sink: finishing thread");
+}
+
+void DecoupledSink::wakeup_() {
+    if (waiting_.compare_exchange(true, false)) {
+        wakeup_sem_.post();
+    }
+}
+
+} // namespace pipeline
+} // namespace roc
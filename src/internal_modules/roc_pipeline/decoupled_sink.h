@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/decoupled_sink.h
+//! @brief Decoupled sink.
+
+#ifndef ROC_PIPELINE_DECOUPLED_SINK_H_
+#define ROC_PIPELINE_DECOUPLED_SINK_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/spsc_ring_buffer.h"
+#include "roc_core/thread.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Decoupled sink.
+//!
+//! Runs writing to the wrapped sink on a separate thread. write() just copies
+//! samples into a pre-allocated lock-free ring buffer, and the thread takes
+//! frames from the ring buffer and writes them to the wrapped sink.
+//!
+//! This allows to call write() from a real-time thread, e.g. from an audio
+//! callback: it never blocks, never waits for the pipeline mutex and never
+//! performs pipeline processing. If the ring buffer is full, samples that
+//! don't fit are dropped.
+//!
+//! The cost is additional latency, up to the ring buffer length.
+class DecoupledSink : public sndio::ISink, private core::Thread {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  The thread writes frames of @p frame_length to @p out_sink, and the
+    //!  ring buffer can hold up to @p buffer_length of samples.
+    DecoupledSink(sndio::ISink& out_sink,
+                  core::nanoseconds_t frame_length,
+                  core::nanoseconds_t buffer_length,
+                  core::IAllocator& allocator);
+
+    //! Stop thread.
+    virtual ~DecoupledSink();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Get number of writes that didn't fit into the ring buffer.
+    size_t num_overruns() const;
+
+    //! Get device type.
+    virtual sndio::DeviceType type() const;
+
+    //! Get device state.
+    virtual sndio::DeviceState state() const;
+
+    //! Pause writing.
+    virtual void pause();
+
+    //! Resume paused writing.
+    virtual bool resume();
+
+    //! Restart writing from the beginning.
+    virtual bool restart();
+
+    //! Get sample specification of the sink.
+    virtual audio::SampleSpec sample_spec() const;
+
+    //! Get latency of the sink.
+    //! @remarks
+    //!  Includes samples buffered in the ring buffer.
+    virtual core::nanoseconds_t latency() const;
+
+    //! Check if the sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Write frame to ring buffer.
+    //! @remarks
+    //!  Never blocks.
+    virtual void write(audio::Frame& frame);
+
+private:
+    virtual void run();
+
+    void wakeup_();
+
+    sndio::ISink& out_sink_;
+    const audio::SampleSpec sample_spec_;
+
+    core::SpscRingBuffer<audio::sample_t> ring_;
+    core::Array<audio::sample_t> frame_buf_;
+
+    core::Semaphore wakeup_sem_;
+    core::Atomic<int> waiting_;
+    core::Atomic<int> stop_;
+
+    core::Atomic<int> n_overruns_;
+
+    bool valid_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_DECOUPLED_SINK_H_
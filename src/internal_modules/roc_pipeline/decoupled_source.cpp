@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/decoupled_source.h"
+#include "roc_core/log.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/panic.h"
+#include "roc_packet/ntp.h"
+
+namespace roc {
+namespace pipeline {
+
+DecoupledSource::DecoupledSource(sndio::ISource& in_source,
+                                 core::nanoseconds_t frame_length,
+                                 core::nanoseconds_t buffer_length,
+                                 core::IAllocator& allocator)
+    : in_source_(in_source)
+    , sample_spec_(in_source.sample_spec())
+    , ring_(allocator,
+            ROC_MAX(sample_spec_.ns_2_samples_overall(buffer_length),
+                    sample_spec_.ns_2_samples_overall(frame_length)))
+    , frame_buf_(allocator)
+    , waiting_(false)
+    , stop_(false)
+    , eof_(false)
+    , reclock_ts_(0)
+    , n_underruns_(0)
+    , valid_(false) {
+    const size_t frame_size = sample_spec_.ns_2_samples_overall(frame_length);
+
+    roc_log(LogDebug,
+            "decoupled source: initializing: frame_size=%lu buffer_size=%lu",
+            (unsigned long)frame_size, (unsigned long)ring_.capacity());
+
+    if (frame_size == 0) {
+        roc_log(LogError, "decoupled source: frame length is too small");
+        return;
+    }
+
+    if (!ring_.valid()) {
+        roc_log(LogError, "decoupled source: can't allocate ring buffer");
+        return;
+    }
+
+    if (!frame_buf_.resize(frame_size)) {
+        roc_log(LogError, "decoupled source: can't allocate frame buffer");
+        return;
+    }
+
+    if (!core::Thread::start()) {
+        roc_log(LogError, "decoupled source: can't start thread");
+        return;
+    }
+
+    valid_ = true;
+}
+
+DecoupledSource::~DecoupledSource() {
+    if (core::Thread::joinable()) {
+        stop_ = true;
+        wakeup_sem_.post();
+        core::Thread::join();
+    }
+}
+
+bool DecoupledSource::valid() const {
+    return valid_;
+}
+
+size_t DecoupledSource::num_underruns() const {
+    return (size_t)n_underruns_;
+}
+
+sndio::DeviceType DecoupledSource::type() const {
+    return in_source_.type();
+}
+
+sndio::DeviceState DecoupledSource::state() const {
+    return in_source_.state();
+}
+
+void DecoupledSource::pause() {
+    in_source_.pause();
+}
+
+bool DecoupledSource::resume() {
+    return in_source_.resume();
+}
+
+bool DecoupledSource::restart() {
+    return in_source_.restart();
+}
+
+audio::SampleSpec DecoupledSource::sample_spec() const {
+    return sample_spec_;
+}
+
+core::nanoseconds_t DecoupledSource::latency() const {
+    return in_source_.latency() + sample_spec_.samples_overall_2_ns(ring_.size());
+}
+
+bool DecoupledSource::has_clock() const {
+    return in_source_.has_clock();
+}
+
+void DecoupledSource::reclock(packet::ntp_timestamp_t timestamp) {
+    reclock_ts_.exclusive_store(timestamp);
+}
+
+bool DecoupledSource::read(audio::Frame& frame) {
+    roc_panic_if(!valid());
+
+    const size_t n_read = ring_.read(frame.samples(), frame.num_samples());
+
+    if (n_read < frame.num_samples()) {
+        if (n_read == 0 && eof_) {
+            return false;
+        }
+
+        memset(frame.samples() + n_read, 0,
+               (frame.num_samples() - n_read) * sizeof(audio::sample_t));
+
+        ++n_underruns_;
+    }
+
+    if (n_read != 0) {
+        wakeup_();
+    }
+
+    return true;
+}
+
+void DecoupledSource::run() {
+    roc_log(LogDebug, "decoupled source: starting thread");
+
+    packet::ntp_timestamp_t last_ts = 0;
+
+    while (!stop_) {
+        if (ring_.capacity() - ring_.size() < frame_buf_.size()) {
+            // No space for next frame, wait until consumer reads something.
+            // Timeout protects from missing a wakeup that happens between the
+            // check above and setting the flag.
+            waiting_ = true;
+            if (ring_.capacity() - ring_.size() < frame_buf_.size()) {
+                (void)wakeup_sem_.timed_wait(
+                    core::timestamp(core::ClockMonotonic)
+                    + sample_spec_.samples_overall_2_ns(frame_buf_.size()));
+            }
+            waiting_ = false;
+            continue;
+        }
+
+        packet::ntp_timestamp_t ts = 0;
+        if (reclock_ts_.try_load(ts) && ts != 0 && ts != last_ts) {
+            // Consumer timestamp refers to the last sample it has read, while
+            // the wrapped source is ahead by the number of buffered samples.
+            in_source_.reclock(ts
+                               + packet::nanoseconds_2_ntp(
+                                   sample_spec_.samples_overall_2_ns(ring_.size())));
+            last_ts = ts;
+        }
+
+        audio::Frame frame(frame_buf_.data(), frame_buf_.size());
+
+        if (!in_source_.read(frame)) {
+            roc_log(LogDebug, "decoupled source: got eof from source");
+            eof_ = true;
+            break;
+        }
+
+        (void)ring_.write(frame_buf_.data(), frame_buf_.size());
+    }
+
+    roc_log(LogDebug, "decoupled source: finishing thread");
+}
+
+void DecoupledSource::wakeup_() {
+    if (waiting_.compare_exchange(true, false)) {
+        wakeup_sem_.post();
+    }
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/decoupled_source.h
+//! @brief Decoupled source.
+
+#ifndef ROC_PIPELINE_DECOUPLED_SOURCE_H_
+#define ROC_PIPELINE_DECOUPLED_SOURCE_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/seqlock.h"
+#include "roc_core/spsc_ring_buffer.h"
+#include "roc_core/thread.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Decoupled source.
+//!
+//! Runs reading from the wrapped source on a separate thread. The thread reads
+//! frames ahead of time and puts samples into a pre-allocated lock-free ring
+//! buffer, and read() just copies samples from the ring buffer.
+//!
+//! This allows to call read() from a real-time thread, e.g. from an audio
+//! callback: it never blocks, never waits for the pipeline mutex and never
+//! performs pipeline processing. If the ring buffer does not have enough
+//! samples, the rest of the frame is filled with zeros.
+//!
+//! The cost is additional latency, equal to the ring buffer length.
+class DecoupledSource : public sndio::ISource, private core::Thread {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  The thread reads frames of @p frame_length from @p in_source and keeps
+    //!  up to @p buffer_length of samples in the ring buffer.
+    DecoupledSource(sndio::ISource& in_source,
+                    core::nanoseconds_t frame_length,
+                    core::nanoseconds_t buffer_length,
+                    core::IAllocator& allocator);
+
+    //! Stop thread.
+    virtual ~DecoupledSource();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Get number of reads that found not enough samples in the ring buffer.
+    size_t num_underruns() const;
+
+    //! Get device type.
+    virtual sndio::DeviceType type() const;
+
+    //! Get device state.
+    virtual sndio::DeviceState state() const;
+
+    //! Pause reading.
+    virtual void pause();
+
+    //! Resume paused reading.
+    virtual bool resume();
+
+    //! Restart reading from the beginning.
+    virtual bool restart();
+
+    //! Get sample specification of the source.
+    virtual audio::SampleSpec sample_spec() const;
+
+    //! Get latency of the source.
+    //! @remarks
+    //!  Includes samples buffered in the ring buffer.
+    virtual core::nanoseconds_t latency() const;
+
+    //! Check if the source has own clock.
+    virtual bool has_clock() const;
+
+    //! Adjust source clock to match consumer clock.
+    //! @remarks
+    //!  Doesn't block; the timestamp is passed to the wrapped source by the
+    //!  background thread before it reads next frame.
+    virtual void reclock(packet::ntp_timestamp_t timestamp);
+
+    //! Read frame from ring buffer.
+    //! @remarks
+    //!  Never blocks. Returns false only if the wrapped source reported end of
+    //!  stream and all buffered samples were already read.
+    virtual bool read(audio::Frame& frame);
+
+private:
+    virtual void run();
+
+    void wakeup_();
+
+    sndio::ISource& in_source_;
+    const audio::SampleSpec sample_spec_;
+
+    core::SpscRingBuffer<audio::sample_t> ring_;
+    core::Array<audio::sample_t> frame_buf_;
+
+    core::Semaphore wakeup_sem_;
+    core::Atomic<int> waiting_;
+    core::Atomic<int> stop_;
+    core::Atomic<int> eof_;
+
+    core::Seqlock<packet::ntp_timestamp_t> reclock_ts_;
+
+    core::Atomic<int> n_underruns_;
+
+    bool valid_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_DECOUPLED_SOURCE_H_
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/iframe_callback.h
+//! @brief Frame callback interface.
+
+#ifndef ROC_PIPELINE_IFRAME_CALLBACK_H_
+#define ROC_PIPELINE_IFRAME_CALLBACK_H_
+
+#include "roc_audio/frame.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Frame callback interface.
+//! @remarks
+//!  Used by SenderPuller to obtain samples from the user.
+class IFrameCallback {
+public:
+    virtual ~IFrameCallback();
+
+    //! Fill frame with samples.
+    //! @remarks
+    //!  Invoked when the frame is due. The frame is zeroed before the call.
+    //! @returns
+    //!  false to stop pulling.
+    virtual bool fill_frame(audio::Frame& frame) = 0;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_IFRAME_CALLBACK_H_
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/ireceiver_event_handler.h
+//! @brief Receiver event handler interface.
+
+#ifndef ROC_PIPELINE_IRECEIVER_EVENT_HANDLER_H_
+#define ROC_PIPELINE_IRECEIVER_EVENT_HANDLER_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Receiver event handler interface.
+//! @remarks
+//!  Methods are invoked from pipeline thread, while the pipeline is locked.
+//!  They should be fast and should not call back into the receiver.
+class IReceiverEventHandler {
+public:
+    virtual ~IReceiverEventHandler();
+
+    //! Invoked when a new session is created.
+    virtual void on_session_added(size_t session_id) = 0;
+
+    //! Invoked when a session is removed.
+    virtual void on_session_removed(size_t session_id) = 0;
+
+    //! Invoked once per session, when its latency first reaches the target.
+    virtual void on_session_latency_stable(size_t session_id) = 0;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_IRECEIVER_EVENT_HANDLER_H_
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/metrics.h
+//! @brief Pipeline metrics.
+
+#ifndef ROC_PIPELINE_METRICS_H_
+#define ROC_PIPELINE_METRICS_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Pipeline loop metrics.
+//! @remarks
+//!  Describe frame processing timings of the whole sender or receiver, shared
+//!  by all its slots.
+struct PipelineLoopMetrics {
+    //! Number of processed frames.
+    uint64_t frames;
+
+    //! Number of frames that missed their deadline.
+    //! Frame misses deadline if wakeup delay plus processing time exceeds
+    //! frame duration.
+    uint64_t missed_deadlines;
+
+    //! Worst deadline overrun, nanoseconds.
+    core::nanoseconds_t max_overrun;
+
+    //! Number of times when pipeline timer woke up late.
+    uint64_t late_wakeups;
+
+    //! Worst pipeline timer wakeup delay, nanoseconds.
+    core::nanoseconds_t max_wakeup_delay;
+
+    PipelineLoopMetrics()
+        : frames(0)
+        , missed_deadlines(0)
+        , max_overrun(0)
+        , late_wakeups(0)
+        , max_wakeup_delay(0) {
+    }
+};
+
+//! Receiver session metrics.
+struct ReceiverSessionMetrics {
+    //! Session identifier, unique within receiver.
+    size_t session_id;
+
+    //! Latency of network incoming queue, nanoseconds.
+    core::nanoseconds_t niq_latency;
+
+    //! Current target latency, nanoseconds.
+    //! Changes over time if adaptive latency is enabled.
+    core::nanoseconds_t target_latency;
+
+    //! Estimated end-to-end latency, nanoseconds.
+    //! Zero if packets don't carry capture time.
+    core::nanoseconds_t e2e_latency;
+
+    //! Estimated interarrival jitter, nanoseconds.
+    core::nanoseconds_t jitter;
+
+    //! Estimated round-trip time to sender, nanoseconds.
+    //! Zero until sender replies to our RTCP XR reports.
+    core::nanoseconds_t rtt;
+
+    //! Current resampler scaling factor.
+    float scaling;
+
+    //! Number of packets in source queue.
+    size_t queue_size;
+
+    //! Number of bytes allocated by session components.
+    //! @remarks
+    //!  Includes memory allocated from session arena and outside of it when the
+    //!  arena is exhausted. Doesn't include packets and buffers, which are
+    //!  allocated from pools shared by all sessions.
+    size_t memory_bytes;
+
+    //! Processing time of session divided by duration of produced audio.
+    //! @remarks
+    //!  Smoothed over recent frames. E.g. 0.05 means that session takes 5% of
+    //!  real time of one CPU.
+    float cpu_load;
+
+    //! Root mean square of samples of last decoded frame.
+    //! Ranges from 0 to 1.
+    float rms_level;
+
+    //! Maximum absolute value of samples of last decoded frame.
+    //! Ranges from 0 to 1, or more if signal is clipped.
+    float peak_level;
+
+    //! Number of packets that were lost and not restored.
+    size_t lost_packets;
+
+    //! Number of packets restored using FEC.
+    size_t repaired_packets;
+
+    //! Number of packets dropped because they were late.
+    size_t late_packets;
+
+    //! Number of packets dropped to catch up when latency became too high.
+    size_t skipped_packets;
+
+    //! Whether watchdog still considers session alive.
+    bool alive;
+
+    ReceiverSessionMetrics()
+        : session_id(0)
+        , niq_latency(0)
+        , target_latency(0)
+        , e2e_latency(0)
+        , jitter(0)
+        , rtt(0)
+        , scaling(1.0f)
+        , queue_size(0)
+        , memory_bytes(0)
+        , cpu_load(0)
+        , rms_level(0)
+        , peak_level(0)
+        , lost_packets(0)
+        , repaired_packets(0)
+        , late_packets(0)
+        , skipped_packets(0)
+        , alive(true) {
+    }
+};
+
+//! Receiver slot metrics.
+struct ReceiverSlotMetrics {
+    enum {
+        //! Maximum number of sessions for which metrics are reported.
+        MaxSessions = 16
+    };
+
+    //! Number of alive sessions.
+    //! May be greater than MaxSessions.
+    size_t num_sessions;
+
+    //! Metrics of first min(num_sessions, MaxSessions) sessions.
+    ReceiverSessionMetrics sessions[MaxSessions];
+
+    //! Metrics of receiver pipeline loop.
+    PipelineLoopMetrics pipeline;
+
+    ReceiverSlotMetrics()
+        : num_sessions(0) {
+    }
+};
+
+//! Sender session metrics.
+struct SenderSessionMetrics {
+    //! Fraction of lost packets, as reported by receiver.
+    float fract_loss;
+
+    //! Length of the longest run of lost packets in last receiver report.
+    //! Reported by receiver via RTCP XR Loss RLE block.
+    size_t loss_burst;
+
+    //! Number of duplicate packets in last receiver report.
+    //! Reported by receiver via RTCP XR Statistics Summary block.
+    size_t dup_packets;
+
+    //! Estimated round-trip time, nanoseconds.
+    core::nanoseconds_t rtt;
+
+    SenderSessionMetrics()
+        : fract_loss(0)
+        , loss_burst(0)
+        , dup_packets(0)
+        , rtt(0) {
+    }
+};
+
+//! Sender slot metrics.
+struct SenderSlotMetrics {
+    //! Number of sessions, zero or one.
+    size_t num_sessions;
+
+    //! Session metrics, valid if num_sessions is non-zero.
+    SenderSessionMetrics session;
+
+    //! Metrics of sender pipeline loop.
+    PipelineLoopMetrics pipeline;
+
+    SenderSlotMetrics()
+        : num_sessions(0) {
+    }
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_METRICS_H_
@@ -17,6 +17,15 @@ namespace {
 
 const core::nanoseconds_t StatsReportInterval = core::Minute;
 
+// How often to log new frame deadline misses.
+const core::nanoseconds_t DeadlineReportInterval = core::Second * 5;
+
+// Wakeup is considered late if it's delayed by more than this fraction of frame.
+const double LateWakeupRatio = 0.5;
+
+// How fast per-sample cost estimate decays when frames become cheaper.
+const double SampleCostDecay = 0.1;
+
 } // namespace
 
 PipelineLoop::PipelineLoop(IPipelineTaskScheduler& scheduler,
@@ -37,11 +46,16 @@ PipelineLoop::PipelineLoop(IPipelineTaskScheduler& scheduler,
     , subframe_tasks_deadline_(0)
     , samples_processed_(0)
     , enough_samples_to_process_tasks_(false)
-    , rate_limiter_(StatsReportInterval) {
+    , sample_cost_(-1)
+    , rate_limiter_(StatsReportInterval)
+    , published_metrics_(PipelineLoopMetrics())
+    , deadline_rate_limiter_(DeadlineReportInterval)
+    , reported_missed_deadlines_(0)
+    , reported_late_wakeups_(0) {
 }
 
 PipelineLoop::~PipelineLoop() {
-    if (pending_tasks_ != 0) {
+    if (*pending_tasks_ != 0) {
         roc_panic(
             "pipeline loop: attempt to destroy pipeline before finishing all tasks");
     }
@@ -51,12 +65,16 @@ const PipelineLoop::Stats& PipelineLoop::get_stats_ref() const {
     return stats_;
 }
 
+void PipelineLoop::get_pipeline_metrics(PipelineLoopMetrics& metrics) const {
+    metrics = published_metrics_.wait_load();
+}
+
 size_t PipelineLoop::num_pending_tasks() const {
-    return (size_t)pending_tasks_;
+    return (size_t)*pending_tasks_;
 }
 
 size_t PipelineLoop::num_pending_frames() const {
-    return (size_t)pending_frames_;
+    return (size_t)*pending_frames_;
 }
 
 void PipelineLoop::schedule(PipelineTask& task, IPipelineTaskCompleter& completer) {
@@ -92,13 +110,13 @@ bool PipelineLoop::schedule_and_wait(PipelineTask& task) {
 bool PipelineLoop::schedule_and_maybe_process_task_(PipelineTask& task) {
     task.state_ = PipelineTask::StateScheduled;
 
-    if (++pending_tasks_ != 1) {
+    if (++*pending_tasks_ != 1) {
         task_queue_.push_back(task);
         return false;
     }
 
     core::nanoseconds_t next_frame_deadline;
-    if (!next_frame_deadline_.try_load(next_frame_deadline)) {
+    if (!next_frame_deadline_->try_load(next_frame_deadline)) {
         task_queue_.push_back(task);
         return false;
     }
@@ -106,7 +124,7 @@ bool PipelineLoop::schedule_and_maybe_process_task_(PipelineTask& task) {
     if (!interframe_task_processing_allowed_(next_frame_deadline)) {
         task_queue_.push_back(task);
 
-        if (pending_frames_ == 0) {
+        if (*pending_frames_ == 0) {
             schedule_async_task_processing_();
         }
 
@@ -119,19 +137,19 @@ bool PipelineLoop::schedule_and_maybe_process_task_(PipelineTask& task) {
     }
 
     process_task_(task, false);
-    --pending_tasks_;
+    --*pending_tasks_;
 
     stats_.task_processed_total++;
     stats_.task_processed_in_place++;
 
-    const int n_pending_frames = pending_frames_;
+    const int n_pending_frames = *pending_frames_;
     if (n_pending_frames != 0) {
         stats_.preemptions++;
     }
 
     pipeline_mutex_.unlock();
 
-    if (n_pending_frames == 0 && pending_tasks_ != 0) {
+    if (n_pending_frames == 0 && *pending_tasks_ != 0) {
         schedule_async_task_processing_();
     }
 
@@ -141,7 +159,7 @@ bool PipelineLoop::schedule_and_maybe_process_task_(PipelineTask& task) {
 void PipelineLoop::process_tasks() {
     const bool need_reschedule = maybe_process_tasks_();
 
-    processing_state_ = ProcNotScheduled;
+    *processing_state_ = ProcNotScheduled;
 
     if (need_reschedule) {
         schedule_async_task_processing_();
@@ -150,7 +168,7 @@ void PipelineLoop::process_tasks() {
 
 bool PipelineLoop::maybe_process_tasks_() {
     core::nanoseconds_t next_frame_deadline;
-    if (!next_frame_deadline_.try_load(next_frame_deadline)) {
+    if (!next_frame_deadline_->try_load(next_frame_deadline)) {
         return false;
     }
 
@@ -158,7 +176,7 @@ bool PipelineLoop::maybe_process_tasks_() {
         return false;
     }
 
-    processing_state_ = ProcRunning;
+    *processing_state_ = ProcRunning;
 
     int n_pending_frames = 0;
 
@@ -167,7 +185,7 @@ bool PipelineLoop::maybe_process_tasks_() {
             break;
         }
 
-        if ((n_pending_frames = pending_frames_) != 0) {
+        if ((n_pending_frames = *pending_frames_) != 0) {
             break;
         }
 
@@ -177,7 +195,7 @@ bool PipelineLoop::maybe_process_tasks_() {
         }
 
         process_task_(*task, true);
-        --pending_tasks_;
+        --*pending_tasks_;
 
         stats_.task_processed_total++;
     }
@@ -188,18 +206,80 @@ bool PipelineLoop::maybe_process_tasks_() {
 
     pipeline_mutex_.unlock();
 
-    return (n_pending_frames == 0 && pending_tasks_ != 0);
+    return (n_pending_frames == 0 && *pending_tasks_ != 0);
 }
 
-bool PipelineLoop::process_subframes_and_tasks(audio::Frame& frame) {
+bool PipelineLoop::process_subframes_and_tasks(audio::Frame& frame,
+                                               core::nanoseconds_t wakeup_delay) {
     if (config_.enable_precise_task_scheduling) {
-        return process_subframes_and_tasks_precise_(frame);
+        return process_subframes_and_tasks_precise_(frame, wakeup_delay);
     }
-    return process_subframes_and_tasks_simple_(frame);
+    return process_subframes_and_tasks_simple_(frame, wakeup_delay);
+}
+
+bool PipelineLoop::process_frame_and_tasks(audio::Frame& frame,
+                                           core::nanoseconds_t wakeup_delay) {
+    return process_subframes_and_tasks_simple_(frame, wakeup_delay);
 }
 
-bool PipelineLoop::process_subframes_and_tasks_simple_(audio::Frame& frame) {
-    ++pending_frames_;
+bool PipelineLoop::process_frames_and_tasks(audio::sample_t* const* frames,
+                                            size_t n_frames,
+                                            size_t frame_size,
+                                            size_t& n_processed,
+                                            core::nanoseconds_t wakeup_delay) {
+    roc_panic_if_not(frames || n_frames == 0);
+
+    n_processed = 0;
+
+    ++*pending_frames_;
+
+    const core::nanoseconds_t frame_start_time = timestamp_imp();
+
+    cancel_async_task_processing_();
+
+    pipeline_mutex_.lock();
+
+    bool frame_res = true;
+
+    while (n_processed < n_frames) {
+        audio::Frame frame(frames[n_processed], frame_size);
+
+        if (!(frame_res = process_subframe_imp(frame))) {
+            break;
+        }
+
+        n_processed++;
+
+        // Since the lock is held for the whole batch, don't make tasks wait
+        // until the end of it.
+        if (n_processed < n_frames && *pending_tasks_ != 0) {
+            while (PipelineTask* task = task_queue_.try_pop_front_exclusive()) {
+                process_task_(*task, true);
+                --*pending_tasks_;
+
+                stats_.task_processed_total++;
+                stats_.task_processed_in_frame++;
+            }
+        }
+    }
+
+    update_deadline_metrics_(frame_start_time, wakeup_delay, frame_size * n_processed,
+                             n_processed);
+
+    pipeline_mutex_.unlock();
+
+    if (--*pending_frames_ == 0 && *pending_tasks_ != 0) {
+        schedule_async_task_processing_();
+    }
+
+    return frame_res;
+}
+
+bool PipelineLoop::process_subframes_and_tasks_simple_(audio::Frame& frame,
+                                                       core::nanoseconds_t wakeup_delay) {
+    ++*pending_frames_;
+
+    const core::nanoseconds_t frame_start_time = timestamp_imp();
 
     cancel_async_task_processing_();
 
@@ -207,17 +287,20 @@ bool PipelineLoop::process_subframes_and_tasks_simple_(audio::Frame& frame) {
 
     const bool frame_res = process_subframe_imp(frame);
 
+    update_deadline_metrics_(frame_start_time, wakeup_delay, frame.num_samples());
+
     pipeline_mutex_.unlock();
 
-    if (--pending_frames_ == 0 && pending_tasks_ != 0) {
+    if (--*pending_frames_ == 0 && *pending_tasks_ != 0) {
         schedule_async_task_processing_();
     }
 
     return frame_res;
 }
 
-bool PipelineLoop::process_subframes_and_tasks_precise_(audio::Frame& frame) {
-    ++pending_frames_;
+bool PipelineLoop::process_subframes_and_tasks_precise_(
+    audio::Frame& frame, core::nanoseconds_t wakeup_delay) {
+    ++*pending_frames_;
 
     const core::nanoseconds_t frame_start_time = timestamp_imp();
 
@@ -240,10 +323,15 @@ bool PipelineLoop::process_subframes_and_tasks_precise_(audio::Frame& frame) {
                 update_next_frame_deadline_(frame_start_time, frame.num_samples());
         }
 
+        if (config_.enable_adaptive_frame_splitting) {
+            subframe_tasks_deadline_ = estimate_subframe_tasks_deadline_(
+                next_frame_deadline, frame.num_samples() - frame_pos);
+        }
+
         if (start_subframe_task_processing_()) {
             while (PipelineTask* task = task_queue_.try_pop_front_exclusive()) {
                 process_task_(*task, true);
-                --pending_tasks_;
+                --*pending_tasks_;
 
                 stats_.task_processed_total++;
                 stats_.task_processed_in_frame++;
@@ -259,11 +347,13 @@ bool PipelineLoop::process_subframes_and_tasks_precise_(audio::Frame& frame) {
         }
     }
 
+    update_deadline_metrics_(frame_start_time, wakeup_delay, frame.num_samples());
+
     report_stats_();
 
     pipeline_mutex_.unlock();
 
-    if (--pending_frames_ == 0 && pending_tasks_ != 0) {
+    if (--*pending_frames_ == 0 && *pending_tasks_ != 0) {
         schedule_async_task_processing_();
     }
 
@@ -272,7 +362,7 @@ bool PipelineLoop::process_subframes_and_tasks_precise_(audio::Frame& frame) {
 
 void PipelineLoop::schedule_async_task_processing_() {
     core::nanoseconds_t next_frame_deadline;
-    if (!next_frame_deadline_.try_load(next_frame_deadline)) {
+    if (!next_frame_deadline_->try_load(next_frame_deadline)) {
         return;
     }
 
@@ -280,7 +370,7 @@ void PipelineLoop::schedule_async_task_processing_() {
         return;
     }
 
-    if (processing_state_ == ProcNotScheduled) {
+    if (*processing_state_ == ProcNotScheduled) {
         core::nanoseconds_t deadline = 0;
 
         if (config_.enable_precise_task_scheduling) {
@@ -298,12 +388,12 @@ void PipelineLoop::schedule_async_task_processing_() {
         scheduler_.schedule_task_processing(*this, deadline);
         stats_.scheduler_calls++;
 
-        processing_state_ = ProcScheduled;
+        *processing_state_ = ProcScheduled;
     }
 
     scheduler_mutex_.unlock();
 
-    if (pending_frames_ != 0) {
+    if (*pending_frames_ != 0) {
         cancel_async_task_processing_();
     }
 }
@@ -313,11 +403,11 @@ void PipelineLoop::cancel_async_task_processing_() {
         return;
     }
 
-    if (processing_state_ == ProcScheduled) {
+    if (*processing_state_ == ProcScheduled) {
         scheduler_.cancel_task_processing(*this);
         stats_.scheduler_cancellations++;
 
-        processing_state_ = ProcNotScheduled;
+        *processing_state_ = ProcNotScheduled;
     }
 
     scheduler_mutex_.unlock();
@@ -337,15 +427,30 @@ void PipelineLoop::process_task_(PipelineTask& task, bool notify) {
 }
 
 bool PipelineLoop::process_next_subframe_(audio::Frame& frame, size_t* frame_pos) {
-    const size_t subframe_size = max_samples_between_tasks_
-        ? std::min(frame.num_samples() - *frame_pos, max_samples_between_tasks_)
-        : frame.num_samples();
+    size_t subframe_size = frame.num_samples() - *frame_pos;
+
+    if (max_samples_between_tasks_ && subframe_size > max_samples_between_tasks_) {
+        // in adaptive mode, don't split frame if there is nothing to do between
+        // sub-frames
+        if (!config_.enable_adaptive_frame_splitting || *pending_tasks_ != 0) {
+            subframe_size = max_samples_between_tasks_;
+        }
+    }
 
     audio::Frame sub_frame(frame.samples() + *frame_pos, subframe_size);
 
+    const core::nanoseconds_t subframe_start_time =
+        config_.enable_adaptive_frame_splitting ? timestamp_imp() : 0;
+
     const bool ret = process_subframe_imp(sub_frame);
 
-    subframe_tasks_deadline_ = timestamp_imp() + config_.max_inframe_task_processing;
+    const core::nanoseconds_t subframe_end_time = timestamp_imp();
+
+    if (config_.enable_adaptive_frame_splitting) {
+        update_sample_cost_(subframe_end_time - subframe_start_time, subframe_size);
+    }
+
+    subframe_tasks_deadline_ = subframe_end_time + config_.max_inframe_task_processing;
 
     *frame_pos += subframe_size;
 
@@ -359,8 +464,37 @@ bool PipelineLoop::process_next_subframe_(audio::Frame& frame, size_t* frame_pos
     return ret;
 }
 
+void PipelineLoop::update_sample_cost_(core::nanoseconds_t duration, size_t n_samples) {
+    if (n_samples == 0) {
+        return;
+    }
+
+    const double cost = double(duration) / n_samples;
+
+    if (sample_cost_ < 0 || cost > sample_cost_) {
+        // grow immediately, to never underestimate frame processing time
+        sample_cost_ = cost;
+    } else {
+        // decay slowly, to smooth out occasional cheap frames
+        sample_cost_ += (cost - sample_cost_) * SampleCostDecay;
+    }
+}
+
+core::nanoseconds_t PipelineLoop::estimate_subframe_tasks_deadline_(
+    core::nanoseconds_t next_frame_deadline, size_t n_remaining_samples) const {
+    if (sample_cost_ < 0) {
+        // no estimate yet, keep fixed deadline
+        return subframe_tasks_deadline_;
+    }
+
+    const core::nanoseconds_t remaining_duration =
+        core::nanoseconds_t(sample_cost_ * n_remaining_samples);
+
+    return next_frame_deadline - no_task_proc_half_interval_ - remaining_duration;
+}
+
 bool PipelineLoop::start_subframe_task_processing_() {
-    if (pending_tasks_ == 0) {
+    if (*pending_tasks_ == 0) {
         return false;
     }
 
@@ -397,7 +531,7 @@ PipelineLoop::update_next_frame_deadline_(core::nanoseconds_t frame_start_time,
 
     const core::nanoseconds_t next_frame_deadline = frame_start_time + frame_duration;
 
-    next_frame_deadline_.exclusive_store(next_frame_deadline);
+    next_frame_deadline_->exclusive_store(next_frame_deadline);
 
     return next_frame_deadline;
 }
@@ -414,6 +548,63 @@ bool PipelineLoop::interframe_task_processing_allowed_(
         || now >= (next_frame_deadline + no_task_proc_half_interval_);
 }
 
+void PipelineLoop::update_deadline_metrics_(core::nanoseconds_t frame_start_time,
+                                            core::nanoseconds_t wakeup_delay,
+                                            size_t frame_size,
+                                            size_t n_frames) {
+    const core::nanoseconds_t frame_duration =
+        sample_spec_.samples_overall_2_ns(frame_size);
+
+    const core::nanoseconds_t overrun =
+        wakeup_delay + (timestamp_imp() - frame_start_time) - frame_duration;
+
+    metrics_.frames += n_frames;
+
+    if (overrun > 0) {
+        metrics_.missed_deadlines++;
+        if (overrun > metrics_.max_overrun) {
+            metrics_.max_overrun = overrun;
+        }
+    }
+
+    if (wakeup_delay > core::nanoseconds_t(frame_duration * LateWakeupRatio)) {
+        metrics_.late_wakeups++;
+    }
+
+    if (wakeup_delay > metrics_.max_wakeup_delay) {
+        metrics_.max_wakeup_delay = wakeup_delay;
+    }
+
+    published_metrics_.exclusive_store(metrics_);
+
+    report_deadline_misses_();
+}
+
+void PipelineLoop::report_deadline_misses_() {
+    if (metrics_.missed_deadlines == reported_missed_deadlines_
+        && metrics_.late_wakeups == reported_late_wakeups_) {
+        return;
+    }
+
+    if (!deadline_rate_limiter_.allow()) {
+        return;
+    }
+
+    roc_log(LogInfo,
+            "pipeline loop: frame deadlines missed:"
+            " missed=%lu(+%lu)/%lu late_wakeups=%lu(+%lu)"
+            " max_overrun=%.3fms max_wakeup_delay=%.3fms",
+            (unsigned long)metrics_.missed_deadlines,
+            (unsigned long)(metrics_.missed_deadlines - reported_missed_deadlines_),
+            (unsigned long)metrics_.frames, (unsigned long)metrics_.late_wakeups,
+            (unsigned long)(metrics_.late_wakeups - reported_late_wakeups_),
+            (double)metrics_.max_overrun / core::Millisecond,
+            (double)metrics_.max_wakeup_delay / core::Millisecond);
+
+    reported_missed_deadlines_ = metrics_.missed_deadlines;
+    reported_late_wakeups_ = metrics_.late_wakeups;
+}
+
 void PipelineLoop::report_stats_() {
     if (!rate_limiter_.would_allow()) {
         return;
@@ -15,6 +15,7 @@
 #include "roc_audio/frame.h"
 #include "roc_audio/sample_spec.h"
 #include "roc_core/atomic.h"
+#include "roc_core/cache_aligned.h"
 #include "roc_core/mpsc_queue.h"
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
@@ -26,6 +27,7 @@
 #include "roc_pipeline/config.h"
 #include "roc_pipeline/ipipeline_task_completer.h"
 #include "roc_pipeline/ipipeline_task_scheduler.h"
+#include "roc_pipeline/metrics.h"
 #include "roc_pipeline/pipeline_task.h"
 
 namespace roc {
@@ -73,6 +75,19 @@ namespace pipeline {
 //! of after every frame. This is needed to reduce task processing overhead when using
 //! tiny frames.
 //!
+//! Adaptive frame splitting
+//! ------------------------
+//!
+//! By default, in-frame task processing between sub-frames is limited by a fixed
+//! duration. When adaptive frame splitting is enabled, the pipeline instead learns
+//! how much time it takes to process one sample, and lets tasks run between
+//! sub-frames until the estimated time needed for the rest of the frame still fits
+//! before the next frame deadline. The per-sample cost estimate grows immediately
+//! and decays slowly, so that frame processing time is not underestimated.
+//!
+//! In this mode, frames are split into sub-frames only if there are pending tasks,
+//! to avoid splitting overhead when there is nothing to process between sub-frames.
+//!
 //! There are two types of time slices dedicated for task processing:
 //!  - in-frame task processing: short intervals between sub-frames
 //!    (inside process_frame_and_tasks())
@@ -179,6 +194,17 @@ namespace pipeline {
 //! mostly wait-free, so that one thread is never or almost never blocked when another
 //! thead is blocked, preempted, or busy.
 //!
+//! Deadline monitoring
+//! -------------------
+//!
+//! Every frame has a deadline: it should be processed within frame duration after
+//! the moment when it was due. If the caller is driven by a timer, it reports how
+//! late the timer woke up, and this delay is counted too. Frames that missed their
+//! deadline, timer wakeups that were late by more than a fraction of frame, and the
+//! worst overrun and delay are tracked in PipelineLoopMetrics, which can be read
+//! concurrently without blocking the pipeline. New misses are logged, but not more
+//! often than once per a few seconds.
+//!
 //! Benchmarks
 //! ----------
 //!
@@ -250,8 +276,36 @@ protected:
     //! Returned object can't be accessed concurrently with other methods.
     const Stats& get_stats_ref() const;
 
+    //! Get pipeline metrics.
+    //! @remarks
+    //!  Lock-free, may be called concurrently with other methods.
+    void get_pipeline_metrics(PipelineLoopMetrics& metrics) const;
+
     //! Split frame and process subframes and some of the enqueued tasks.
-    bool process_subframes_and_tasks(audio::Frame& frame);
+    //! @remarks
+    //!  @p wakeup_delay defines how late the caller started processing the frame
+    //!  compared to the moment it was due, if known.
+    bool process_subframes_and_tasks(audio::Frame& frame,
+                                     core::nanoseconds_t wakeup_delay = 0);
+
+    //! Process frame as a whole, without splitting, and some of the enqueued tasks.
+    //! @remarks
+    //!  Same as process_subframes_and_tasks(), but tasks are processed only before
+    //!  and after the frame, never in the middle of it.
+    bool process_frame_and_tasks(audio::Frame& frame,
+                                 core::nanoseconds_t wakeup_delay = 0);
+
+    //! Process multiple frames and enqueued tasks under a single pipeline lock.
+    //! @remarks
+    //!  @p frames is an array of @p n_frames pointers to buffers of @p frame_size
+    //!  samples each. Intended for processing faster than real time. Frames are
+    //!  not split; tasks are processed between frames. Stops at the first frame
+    //!  which fails and reports number of processed frames in @p n_processed.
+    bool process_frames_and_tasks(audio::sample_t* const* frames,
+                                  size_t n_frames,
+                                  size_t frame_size,
+                                  size_t& n_processed,
+                                  core::nanoseconds_t wakeup_delay = 0);
 
     //! Get current time.
     virtual core::nanoseconds_t timestamp_imp() const = 0;
@@ -265,8 +319,10 @@ protected:
 private:
     enum ProcState { ProcNotScheduled, ProcScheduled, ProcRunning };
 
-    bool process_subframes_and_tasks_simple_(audio::Frame& frame);
-    bool process_subframes_and_tasks_precise_(audio::Frame& frame);
+    bool process_subframes_and_tasks_simple_(audio::Frame& frame,
+                                             core::nanoseconds_t wakeup_delay);
+    bool process_subframes_and_tasks_precise_(audio::Frame& frame,
+                                              core::nanoseconds_t wakeup_delay);
 
     bool schedule_and_maybe_process_task_(PipelineTask& task);
     bool maybe_process_tasks_();
@@ -277,6 +333,11 @@ private:
     void process_task_(PipelineTask& task, bool notify);
     bool process_next_subframe_(audio::Frame& frame, size_t* frame_pos);
 
+    void update_sample_cost_(core::nanoseconds_t duration, size_t n_samples);
+    core::nanoseconds_t
+    estimate_subframe_tasks_deadline_(core::nanoseconds_t next_frame_deadline,
+                                      size_t n_remaining_samples) const;
+
     bool start_subframe_task_processing_();
     bool subframe_task_processing_allowed_(core::nanoseconds_t next_frame_deadline) const;
 
@@ -285,6 +346,12 @@ private:
     bool
     interframe_task_processing_allowed_(core::nanoseconds_t next_frame_deadline) const;
 
+    void update_deadline_metrics_(core::nanoseconds_t frame_start_time,
+                                  core::nanoseconds_t wakeup_delay,
+                                  size_t frame_size,
+                                  size_t n_frames = 1);
+    void report_deadline_misses_();
+
     void report_stats_();
 
     // configuration
@@ -309,17 +376,21 @@ private:
     // lock-free queue of pending tasks
     core::MpscQueue<PipelineTask, core::NoOwnership> task_queue_;
 
+    // Fields below are accessed from both frame and task threads, and each one
+    // occupies its own cache line to avoid false sharing with each other and
+    // with fields used only by frame thread.
+
     // counter of pending tasks
-    core::Atomic<int> pending_tasks_;
+    core::CacheAligned<core::Atomic<int> > pending_tasks_;
 
     // counter of pending process_frame_and_tasks() calls blocked on pipeline_mutex_
-    core::Atomic<int> pending_frames_;
+    core::CacheAligned<core::Atomic<int> > pending_frames_;
 
     // asynchronous processing state
-    core::Atomic<int> processing_state_;
+    core::CacheAligned<core::Atomic<int> > processing_state_;
 
     // when next frame is expected to be started
-    core::Seqlock<core::nanoseconds_t> next_frame_deadline_;
+    core::CacheAligned<core::Seqlock<core::nanoseconds_t> > next_frame_deadline_;
 
     // when task processing before next sub-frame ends
     core::nanoseconds_t subframe_tasks_deadline_;
@@ -330,9 +401,21 @@ private:
     // did we accumulate enough samples in samples_processed_
     bool enough_samples_to_process_tasks_;
 
+    // estimated time to process one sample, negative if unknown
+    double sample_cost_;
+
     // task processing statistics
     core::RateLimiter rate_limiter_;
     Stats stats_;
+
+    // frame deadline metrics, updated and published by frame processing
+    PipelineLoopMetrics metrics_;
+    core::Seqlock<PipelineLoopMetrics> published_metrics_;
+
+    // deadline misses already reported to log
+    core::RateLimiter deadline_rate_limiter_;
+    uint64_t reported_missed_deadlines_;
+    uint64_t reported_late_wakeups_;
 };
 
 } // namespace pipeline
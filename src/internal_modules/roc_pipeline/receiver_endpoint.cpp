@@ -9,10 +9,15 @@
 #include "roc_pipeline/receiver_endpoint.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/time.h"
 #include "roc_fec/composer.h"
 #include "roc_fec/headers.h"
 #include "roc_fec/parser.h"
 
+#ifdef ROC_TARGET_OPENSSL
+#include "roc_rtp/srtp_parser.h"
+#endif // ROC_TARGET_OPENSSL
+
 namespace roc {
 namespace pipeline {
 
@@ -20,18 +25,24 @@ ReceiverEndpoint::ReceiverEndpoint(address::Protocol proto,
                                    ReceiverState& receiver_state,
                                    ReceiverSessionGroup& session_group,
                                    const rtp::FormatMap& format_map,
-                                   core::IAllocator& allocator)
+                                   packet::PacketFactory& packet_factory,
+                                   const packet::ImpairerConfig& impairer_config,
+                                   const rtp::SrtpConfig& srtp_config,
+                                   core::IAllocator& allocator,
+                                   packet::Demultiplexer* demultiplexer)
     : RefCounted(allocator)
     , proto_(proto)
     , receiver_state_(receiver_state)
     , session_group_(session_group)
-    , parser_(NULL) {
+    , parser_(NULL)
+    , demultiplexer_(demultiplexer) {
     packet::IParser* parser = NULL;
 
     switch (proto) {
     case address::Proto_RTP:
     case address::Proto_RTP_LDPC_Source:
     case address::Proto_RTP_RS8M_Source:
+    case address::Proto_RTP_RLC_Source:
         rtp_parser_.reset(new (rtp_parser_) rtp::Parser(format_map, NULL));
         if (!rtp_parser_) {
             return;
@@ -83,6 +94,28 @@ ReceiverEndpoint::ReceiverEndpoint(address::Protocol proto,
         }
         parser = fec_parser_.get();
         break;
+    case address::Proto_RTP_RLC_Source:
+        fec_parser_.reset(
+            new (allocator)
+                fec::Parser<fec::RLC_Source_PayloadID, fec::Source, fec::Footer>(
+                    parser),
+            allocator);
+        if (!fec_parser_) {
+            return;
+        }
+        parser = fec_parser_.get();
+        break;
+    case address::Proto_RLC_Repair:
+        fec_parser_.reset(
+            new (allocator)
+                fec::Parser<fec::RLC_Repair_PayloadID, fec::Repair, fec::Header>(
+                    parser),
+            allocator);
+        if (!fec_parser_) {
+            return;
+        }
+        parser = fec_parser_.get();
+        break;
     default:
         break;
     }
@@ -99,6 +132,42 @@ ReceiverEndpoint::ReceiverEndpoint(address::Protocol proto,
         break;
     }
 
+    if (srtp_config.enabled) {
+        // fec decoder uses received packets as they are, so it can't work
+        // with packets decrypted in place
+        if (proto != address::Proto_RTP && proto != address::Proto_RTCP) {
+            roc_log(LogError,
+                    "receiver endpoint: srtp is supported only for rtp and rtcp:"
+                    " proto=%s",
+                    address::proto_to_str(proto));
+            return;
+        }
+
+#ifdef ROC_TARGET_OPENSSL
+        rtp::SrtpParser* srtp_parser = new (allocator) rtp::SrtpParser(
+            srtp_config,
+            proto == address::Proto_RTCP ? rtp::SrtpProto_RTCP : rtp::SrtpProto_RTP,
+            *parser);
+        srtp_parser_.reset(srtp_parser, allocator);
+        if (!srtp_parser_ || !srtp_parser->valid()) {
+            return;
+        }
+        parser = srtp_parser_.get();
+#else
+        roc_log(LogError,
+                "receiver endpoint: srtp is not supported (built without openssl)");
+        return;
+#endif // ROC_TARGET_OPENSSL
+    }
+
+    if (impairer_config.enabled()) {
+        impairer_.reset(new (impairer_) packet::Impairer(
+            impaired_packets_, packet_factory, allocator, impairer_config));
+        if (!impairer_ || !impairer_->valid()) {
+            return;
+        }
+    }
+
     parser_ = parser;
 }
 
@@ -121,20 +190,28 @@ packet::IWriter& ReceiverEndpoint::writer() {
 void ReceiverEndpoint::pull_packets() {
     roc_panic_if(!valid());
 
+    if (impairer_) {
+        impairer_->advance(core::timestamp(core::ClockMonotonic));
+    }
+
     // Using try_pop_front_exclusive() makes this method lock-free and wait-free.
     // It may return NULL either if the queue is empty or if the packets in the
     // queue were added in a very short time or are being added currently. It's
     // acceptable to consider such packets late and to be pulled next time.
     while (packet::PacketPtr packet = queue_.try_pop_front_exclusive()) {
-        if (!parser_->parse(*packet, packet->data())) {
-            roc_log(LogDebug, "receiver endpoint: can't parse packet");
-            continue;
+        if (impairer_) {
+            impairer_->write(packet);
+        } else {
+            process_packet_(packet);
         }
 
-        session_group_.route_packet(packet);
-
         receiver_state_.add_pending_packets(-1);
     }
+
+    // Packets released by impairer, either delayed or just passed through.
+    while (packet::PacketPtr packet = impaired_packets_.read()) {
+        process_packet_(packet);
+    }
 }
 
 void ReceiverEndpoint::write(const packet::PacketPtr& packet) {
@@ -149,5 +226,47 @@ void ReceiverEndpoint::write(const packet::PacketPtr& packet) {
     queue_.push_back(*packet);
 }
 
+void ReceiverEndpoint::write_batch(core::List<packet::Packet>& packets) {
+    roc_panic_if(!valid());
+
+    const size_t n_packets = packets.size();
+    if (n_packets == 0) {
+        return;
+    }
+
+    receiver_state_.add_pending_packets((int)n_packets);
+
+    queue_.push_back_list(packets);
+}
+
+void ReceiverEndpoint::process_packet_(const packet::PacketPtr& packet) {
+    if (demultiplexer_) {
+        route_datagram_(*packet);
+        return;
+    }
+
+    if (!parser_->parse(*packet, packet->data())) {
+        roc_log(LogDebug, "receiver endpoint: can't parse packet");
+        return;
+    }
+
+    session_group_.route_packet(packet);
+}
+
+void ReceiverEndpoint::route_datagram_(const packet::Packet& datagram) {
+    if (!demultiplexer_->demultiplex(datagram, subpackets_)) {
+        roc_log(LogDebug, "receiver endpoint: can't demultiplex datagram");
+    }
+
+    while (packet::PacketPtr packet = subpackets_.read()) {
+        if (!parser_->parse(*packet, packet->data())) {
+            roc_log(LogDebug, "receiver endpoint: can't parse packet");
+            continue;
+        }
+
+        session_group_.route_packet(packet);
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
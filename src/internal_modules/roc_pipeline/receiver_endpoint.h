@@ -15,12 +15,17 @@
 #include "roc_address/interface.h"
 #include "roc_address/protocol.h"
 #include "roc_core/iallocator.h"
+#include "roc_core/list.h"
 #include "roc_core/mpsc_queue.h"
 #include "roc_core/optional.h"
 #include "roc_core/ref_counted.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_packet/demultiplexer.h"
+#include "roc_packet/impairer.h"
 #include "roc_packet/iparser.h"
 #include "roc_packet/iwriter.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
 #include "roc_pipeline/config.h"
 #include "roc_pipeline/receiver_session_group.h"
 #include "roc_pipeline/receiver_state.h"
@@ -44,11 +49,20 @@ class ReceiverEndpoint
 
 public:
     //! Initialize.
+    //! @remarks
+    //!  If @p demultiplexer is non-NULL, every received datagram is expected
+    //!  to be multiplexed and is split into packets before parsing.
+    //!  If @p impairer_config enables any impairment, received datagrams are
+    //!  passed through impairer before anything else.
     ReceiverEndpoint(address::Protocol proto,
                      ReceiverState& receiver_state,
                      ReceiverSessionGroup& session_group,
                      const rtp::FormatMap& format_map,
-                     core::IAllocator& allocator);
+                     packet::PacketFactory& packet_factory,
+                     const packet::ImpairerConfig& impairer_config,
+                     const rtp::SrtpConfig& srtp_config,
+                     core::IAllocator& allocator,
+                     packet::Demultiplexer* demultiplexer = NULL);
 
     //! Check if the port pipeline was succefully constructed.
     bool valid() const;
@@ -59,7 +73,8 @@ public:
     //! Get endpoint writer.
     //! @remarks
     //!  Packets passed to this writer will be pulled by endpoint pipeline.
-    //!  This writer is thread-safe and lock-free.
+    //!  This writer is thread-safe and lock-free. Batches passed to write_batch()
+    //!  are added to the queue in a single operation.
     //!  The writer is passed to netio thread.
     packet::IWriter& writer();
 
@@ -68,6 +83,10 @@ public:
 
 private:
     virtual void write(const packet::PacketPtr& packet);
+    virtual void write_batch(core::List<packet::Packet>& packets);
+
+    void process_packet_(const packet::PacketPtr& packet);
+    void route_datagram_(const packet::Packet& datagram);
 
     const address::Protocol proto_;
 
@@ -79,8 +98,15 @@ private:
     core::Optional<rtp::Parser> rtp_parser_;
     core::ScopedPtr<packet::IParser> fec_parser_;
     core::Optional<rtcp::Parser> rtcp_parser_;
+    core::ScopedPtr<packet::IParser> srtp_parser_;
 
     core::MpscQueue<packet::Packet> queue_;
+
+    packet::Queue impaired_packets_;
+    core::Optional<packet::Impairer> impairer_;
+
+    packet::Demultiplexer* demultiplexer_;
+    packet::Queue subpackets_;
 };
 
 } // namespace pipeline
@@ -7,6 +7,7 @@
  */
 
 #include "roc_pipeline/receiver_loop.h"
+#include "roc_core/fast_clock.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/shared_ptr.h"
@@ -22,8 +23,9 @@ ReceiverLoop::Task::Task()
     , writer_(NULL) {
 }
 
-ReceiverLoop::Tasks::CreateSlot::CreateSlot() {
+ReceiverLoop::Tasks::CreateSlot::CreateSlot(const ReceiverSlotConfig& slot_config) {
     func_ = &ReceiverLoop::task_create_slot_;
+    slot_config_ = slot_config;
 }
 
 ReceiverLoop::SlotHandle ReceiverLoop::Tasks::CreateSlot::get_handle() const {
@@ -70,7 +72,8 @@ ReceiverLoop::ReceiverLoop(IPipelineTaskScheduler& scheduler,
                            packet::PacketFactory& packet_factory,
                            core::BufferFactory<uint8_t>& byte_buffer_factory,
                            core::BufferFactory<audio::sample_t>& sample_buffer_factory,
-                           core::IAllocator& allocator)
+                           core::IAllocator& allocator,
+                           ClockDomain* clock_domain)
     : PipelineLoop(scheduler, config.tasks, config.common.output_sample_spec)
     , source_(config,
               format_map,
@@ -78,7 +81,12 @@ ReceiverLoop::ReceiverLoop(IPipelineTaskScheduler& scheduler,
               byte_buffer_factory,
               sample_buffer_factory,
               allocator)
+    , clock_domain_(clock_domain)
     , timestamp_(0)
+    , power_saving_(config.common.power_saving)
+    , sess_frames_(NULL)
+    , sess_max_frames_(0)
+    , sess_n_frames_(NULL)
     , valid_(false) {
     if (!source_.valid()) {
         return;
@@ -105,6 +113,36 @@ sndio::ISource& ReceiverLoop::source() {
     return *this;
 }
 
+bool ReceiverLoop::wait_active(core::nanoseconds_t timeout) {
+    roc_panic_if(!valid());
+
+    return source_.wait_active(timeout);
+}
+
+void ReceiverLoop::set_event_handler(IReceiverEventHandler* handler) {
+    roc_panic_if(!valid());
+
+    source_.set_event_handler(handler);
+}
+
+void ReceiverLoop::set_session_store(SessionStateStore* store) {
+    roc_panic_if(!valid());
+
+    source_.set_session_store(store);
+}
+
+void ReceiverLoop::get_metrics(SlotHandle slot, ReceiverSlotMetrics& metrics) const {
+    roc_panic_if(!valid());
+
+    if (!slot) {
+        roc_panic("receiver source: slot handle is null");
+    }
+
+    ((const ReceiverSlot*)slot)->get_metrics(metrics);
+
+    get_pipeline_metrics(metrics.pipeline);
+}
+
 sndio::DeviceType ReceiverLoop::type() const {
     roc_panic_if(!valid());
 
@@ -182,13 +220,18 @@ bool ReceiverLoop::read(audio::Frame& frame) {
 
     core::Mutex::Lock lock(source_mutex_);
 
+    core::nanoseconds_t wakeup_delay = 0;
     if (ticker_) {
-        ticker_->wait(timestamp_);
+        wakeup_delay = wait_ticker_(frame);
     }
 
-    // Invokes process_subframe_imp() and process_task_imp().
-    if (!process_subframes_and_tasks(frame)) {
-        return false;
+    if (is_idle_()) {
+        skip_frame_(frame);
+    } else {
+        // Invokes process_subframe_imp() and process_task_imp().
+        if (!process_subframes_and_tasks(frame, wakeup_delay)) {
+            return false;
+        }
     }
 
     timestamp_ +=
@@ -197,11 +240,153 @@ bool ReceiverLoop::read(audio::Frame& frame) {
     return true;
 }
 
+bool ReceiverLoop::read_frames(audio::sample_t* const* frames,
+                               size_t n_frames,
+                               size_t frame_size) {
+    roc_panic_if(!valid());
+
+    roc_panic_if_not(frames || n_frames == 0);
+
+    core::Mutex::Lock lock(source_mutex_);
+
+    const size_t num_channels = source_.sample_spec().num_channels();
+
+    if (ticker_) {
+        // Every frame has its own deadline, so frames are processed one by one.
+        for (size_t n = 0; n < n_frames; n++) {
+            audio::Frame frame(frames[n], frame_size);
+
+            const core::nanoseconds_t wakeup_delay = wait_ticker_(frame);
+
+            if (is_idle_()) {
+                skip_frame_(frame);
+            } else if (!process_subframes_and_tasks(frame, wakeup_delay)) {
+                return false;
+            }
+
+            timestamp_ += packet::timestamp_t(frame_size / num_channels);
+        }
+        return true;
+    }
+
+    if (is_idle_()) {
+        for (size_t n = 0; n < n_frames; n++) {
+            audio::Frame frame(frames[n], frame_size);
+            skip_frame_(frame);
+        }
+
+        timestamp_ += packet::timestamp_t(frame_size / num_channels * n_frames);
+
+        return true;
+    }
+
+    size_t n_processed = 0;
+
+    // Invokes process_subframe_imp() and process_task_imp().
+    const bool ret =
+        process_frames_and_tasks(frames, n_frames, frame_size, n_processed);
+
+    timestamp_ += packet::timestamp_t(frame_size / num_channels * n_processed);
+
+    return ret;
+}
+
+bool ReceiverLoop::read_sessions(ReceiverSessionFrame* frames,
+                                 size_t max_frames,
+                                 size_t& n_frames,
+                                 size_t n_samples) {
+    roc_panic_if(!valid());
+
+    roc_panic_if_not(frames && max_frames > 0);
+
+    core::Mutex::Lock lock(source_mutex_);
+
+    n_frames = 0;
+
+    // Used by pipeline loop only to carry frame size and timing;
+    // actual samples are written by process_subframe_imp() into all frames.
+    audio::Frame frame(frames[0].samples, n_samples);
+
+    core::nanoseconds_t wakeup_delay = 0;
+    if (ticker_) {
+        wakeup_delay = wait_ticker_(frame);
+    }
+
+    if (is_idle_()) {
+        // No sessions, nothing to return.
+        timestamp_ +=
+            packet::timestamp_t(n_samples / source_.sample_spec().num_channels());
+
+        return true;
+    }
+
+    sess_frames_ = frames;
+    sess_max_frames_ = max_frames;
+    sess_n_frames_ = &n_frames;
+
+    // Invokes process_subframe_imp() and process_task_imp().
+    // Frame is not split, because sessions are read into user buffers directly.
+    const bool ret = process_frame_and_tasks(frame, wakeup_delay);
+
+    sess_frames_ = NULL;
+    sess_max_frames_ = 0;
+    sess_n_frames_ = NULL;
+
+    if (!ret) {
+        return false;
+    }
+
+    timestamp_ += packet::timestamp_t(n_samples / source_.sample_spec().num_channels());
+
+    return true;
+}
+
+core::nanoseconds_t ReceiverLoop::read_delay() {
+    roc_panic_if(!valid());
+
+    core::Mutex::Lock lock(source_mutex_);
+
+    if (!ticker_) {
+        return 0;
+    }
+
+    return ticker_->remaining(timestamp_);
+}
+
+core::nanoseconds_t ReceiverLoop::wait_ticker_(const audio::Frame& frame) {
+    if (clock_domain_ && !ticker_->started()) {
+        const audio::SampleSpec& sample_spec = source_.sample_spec();
+
+        const core::nanoseconds_t frame_length = sample_spec.samples_overall_2_ns(
+            frame.num_samples() ? frame.num_samples() : sample_spec.num_channels());
+
+        ticker_->start_at(
+            clock_domain_->join(core::timestamp(core::ClockMonotonic), frame_length));
+    }
+
+    return ticker_->wait(timestamp_);
+}
+
+bool ReceiverLoop::is_idle_() const {
+    return power_saving_ && source_.state() == sndio::DeviceState_Idle;
+}
+
+void ReceiverLoop::skip_frame_(audio::Frame& frame) {
+    // Receiver has neither sessions nor packets that could create them,
+    // so the pipeline would produce silence anyway.
+    memset(frame.samples(), 0, frame.num_samples() * sizeof(audio::sample_t));
+    frame.set_flags(audio::Frame::FlagZeros);
+}
+
 core::nanoseconds_t ReceiverLoop::timestamp_imp() const {
-    return core::timestamp(core::ClockMonotonic);
+    return core::fast_timestamp();
 }
 
 bool ReceiverLoop::process_subframe_imp(audio::Frame& frame) {
+    if (sess_frames_) {
+        return source_.read_sessions(sess_frames_, sess_max_frames_, *sess_n_frames_,
+                                     frame.num_samples());
+    }
     return source_.read(frame);
 }
 
@@ -213,7 +398,7 @@ bool ReceiverLoop::process_task_imp(PipelineTask& basic_task) {
 }
 
 bool ReceiverLoop::task_create_slot_(Task& task) {
-    task.slot_ = source_.create_slot();
+    task.slot_ = source_.create_slot(task.slot_config_);
     return (bool)task.slot_;
 }
 
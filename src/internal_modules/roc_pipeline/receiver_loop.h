@@ -17,10 +17,15 @@
 #include "roc_core/mutex.h"
 #include "roc_core/optional.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/ticker.h"
 #include "roc_packet/packet_factory.h"
+#include "roc_pipeline/clock_domain.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/ireceiver_event_handler.h"
+#include "roc_pipeline/metrics.h"
 #include "roc_pipeline/pipeline_loop.h"
 #include "roc_pipeline/receiver_source.h"
+#include "roc_pipeline/session_state_store.h"
 #include "roc_sndio/isource.h"
 
 namespace roc {
@@ -57,10 +62,11 @@ public:
 
         bool (ReceiverLoop::*func_)(Task&); //!< Task implementation method.
 
-        ReceiverSlot* slot_;       //!< Slot.
-        address::Interface iface_; //!< Interface.
-        address::Protocol proto_;  //!< Protocol.
-        packet::IWriter* writer_;  //!< Packet writer.
+        ReceiverSlot* slot_;             //!< Slot.
+        ReceiverSlotConfig slot_config_; //!< Slot config.
+        address::Interface iface_;       //!< Interface.
+        address::Protocol proto_;        //!< Protocol.
+        packet::IWriter* writer_;        //!< Packet writer.
     };
 
     //! Subclasses for specific tasks.
@@ -70,7 +76,10 @@ public:
         class CreateSlot : public Task {
         public:
             //! Set task parameters.
-            CreateSlot();
+            //! @remarks
+            //!  @p slot_config overrides default session parameters for
+            //!  sessions of the slot.
+            CreateSlot(const ReceiverSlotConfig& slot_config = ReceiverSlotConfig());
 
             //! Get created slot handle.
             SlotHandle get_handle() const;
@@ -102,13 +111,17 @@ public:
     };
 
     //! Initialize.
+    //! @remarks
+    //!  If @p clock_domain is non-NULL and timing is enabled, the pipeline aligns its
+    //!  timing to other pipelines of the same domain.
     ReceiverLoop(IPipelineTaskScheduler& scheduler,
                  const ReceiverConfig& config,
                  const rtp::FormatMap& format_map,
                  packet::PacketFactory& packet_factory,
                  core::BufferFactory<uint8_t>& byte_buffer_factory,
                  core::BufferFactory<audio::sample_t>& sample_buffer_factory,
-                 core::IAllocator& allocator);
+                 core::IAllocator& allocator,
+                 ClockDomain* clock_domain = NULL);
 
     //! Check if the pipeline was successfully constructed.
     bool valid() const;
@@ -118,6 +131,55 @@ public:
     //!  Samples received from remote peers become available in this source.
     sndio::ISource& source();
 
+    //! Wait until receiver becomes active.
+    //! @remarks
+    //!  Can be called from any thread. Intended for power saving mode, to park
+    //!  reader thread while there are no sessions and packets.
+    //!  See ReceiverSource::wait_active().
+    bool wait_active(core::nanoseconds_t timeout);
+
+    //! Set handler for session events.
+    //! @remarks
+    //!  Can be called from any thread. See IReceiverEventHandler.
+    void set_event_handler(IReceiverEventHandler* handler);
+
+    //! Set store used to save and restore session state.
+    //! @remarks
+    //!  Can be called from any thread. See ReceiverSource::set_session_store().
+    void set_session_store(SessionStateStore* store);
+
+    //! Get metrics of given slot.
+    //! @remarks
+    //!  Can be called from any thread. Doesn't schedule a task and doesn't wait
+    //!  for the pipeline; returns metrics published during last frame.
+    void get_metrics(SlotHandle slot, ReceiverSlotMetrics& metrics) const;
+
+    //! Get time left until next frame can be read without blocking.
+    //! @remarks
+    //!  Returns zero if timing is disabled or the next frame is already due.
+    //!  Should be called from the same thread that reads frames.
+    core::nanoseconds_t read_delay();
+
+    //! Read multiple frames at once.
+    //! @remarks
+    //!  @p frames is an array of @p n_frames pointers to buffers of @p frame_size
+    //!  samples each. Same as reading frames from source() one by one, but if
+    //!  timing is disabled, all frames are processed during a single pipeline loop
+    //!  entry. Useful when reading faster than real time.
+    bool read_frames(audio::sample_t* const* frames,
+                     size_t n_frames,
+                     size_t frame_size);
+
+    //! Read next frame of every session separately, without mixing.
+    //! @remarks
+    //!  Should be used from sndio thread instead of source().read().
+    //!  @p max_frames should be non-zero.
+    //!  See ReceiverSource::read_sessions() for details.
+    bool read_sessions(ReceiverSessionFrame* frames,
+                       size_t max_frames,
+                       size_t& n_frames,
+                       size_t n_samples);
+
 private:
     // Methods of sndio::ISource
     virtual sndio::DeviceType type() const;
@@ -143,9 +205,22 @@ private:
 
     ReceiverSource source_;
 
+    core::nanoseconds_t wait_ticker_(const audio::Frame& frame);
+
+    bool is_idle_() const;
+    void skip_frame_(audio::Frame& frame);
+
+    ClockDomain* clock_domain_;
     core::Optional<core::Ticker> ticker_;
     packet::timestamp_t timestamp_;
 
+    const bool power_saving_;
+
+    // Pending read_sessions() request, used by process_subframe_imp().
+    ReceiverSessionFrame* sess_frames_;
+    size_t sess_max_frames_;
+    size_t* sess_n_frames_;
+
     core::Mutex source_mutex_;
 
     bool valid_;
@@ -7,38 +7,87 @@
  */
 
 #include "roc_pipeline/receiver_session.h"
+#include "roc_audio/resampler_cubic.h"
 #include "roc_audio/resampler_map.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_fec/codec_map.h"
+#include "roc_packet/ntp.h"
 
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+const core::nanoseconds_t E2eLatencyLogInterval = 5 * core::Second;
+const core::nanoseconds_t JitterLogInterval = 5 * core::Second;
+
+// When rates are equal, resampler only compensates clock drift, and scaling
+// never leaves [1 - max_scaling_delta; 1 + max_scaling_delta]. In this case,
+// if user didn't request specific backend or high quality, use much cheaper
+// cubic interpolation instead of sinc.
+audio::ResamplerBackend select_resampler_backend(const ReceiverSessionConfig& config,
+                                                 size_t input_rate,
+                                                 size_t output_rate) {
+    if (config.resampler_backend == audio::ResamplerBackend_Default
+        && config.resampler_profile != audio::ResamplerProfile_High
+        && input_rate == output_rate
+        && config.latency_monitor.max_scaling_delta
+            <= audio::CubicResampler::MaxScalingDelta) {
+        return audio::ResamplerBackend_Cubic;
+    }
+
+    return config.resampler_backend;
+}
+
+} // namespace
+
 ReceiverSession::ReceiverSession(
     const ReceiverSessionConfig& session_config,
     const ReceiverCommonConfig& common_config,
     const address::SocketAddr& src_address,
+    size_t session_id,
     const rtp::FormatMap& format_map,
     packet::PacketFactory& packet_factory,
     core::BufferFactory<uint8_t>& byte_buffer_factory,
     core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+    fec::RepairPool* repair_pool,
     core::IAllocator& allocator)
     : RefCounted(allocator)
     , src_address_(src_address)
-    , audio_reader_(NULL) {
+    , session_id_(session_id)
+    , source_id_(0)
+    , has_source_id_(false)
+    , resampler_profile_(session_config.resampler_profile)
+    , degraded_quality_(false)
+    , arena_(allocator, session_config.arena_size)
+    , memory_(arena_)
+    , audio_reader_(NULL)
+    , latency_stable_(false)
+    , state_restored_(false)
+    , e2e_latency_(0)
+    , report_ntp_(0)
+    , report_rtp_(0)
+    , rtt_(0)
+    , e2e_latency_limiter_(E2eLatencyLogInterval)
+    , jitter_limiter_(JitterLogInterval) {
+    cname_[0] = '\0';
+
     const rtp::Format* format = format_map.format(session_config.payload_type);
     if (!format) {
         return;
     }
 
-    queue_router_.reset(new (queue_router_) packet::Router(allocator));
+    payload_sample_spec_ = format->sample_spec;
+
+    queue_router_.reset(new (queue_router_) packet::Router(memory_));
     if (!queue_router_) {
         return;
     }
 
-    source_queue_.reset(new (source_queue_) packet::SortedQueue(0));
-    if (!source_queue_) {
+    source_queue_.reset(new (source_queue_) packet::SeqnumQueue(
+        memory_, session_config.max_queued_packets));
+    if (!source_queue_ || !source_queue_->valid()) {
         return;
     }
 
@@ -50,11 +99,16 @@ ReceiverSession::ReceiverSession(
 
     packet::IReader* preader = source_queue_.get();
 
-    payload_decoder_.reset(format->new_decoder(allocator), allocator);
+    payload_decoder_.reset(format->new_decoder(memory_, *format), memory_);
     if (!payload_decoder_) {
         return;
     }
 
+    jitter_meter_.reset(new (jitter_meter_) rtp::JitterMeter(format->sample_spec));
+    if (!jitter_meter_) {
+        return;
+    }
+
     validator_.reset(new (validator_) rtp::Validator(
         *preader, session_config.rtp_validator, format->sample_spec));
     if (!validator_) {
@@ -77,7 +131,8 @@ ReceiverSession::ReceiverSession(
     preader = delayed_reader_.get();
 
     if (session_config.fec_decoder.scheme != packet::FEC_None) {
-        repair_queue_.reset(new (repair_queue_) packet::SortedQueue(0));
+        repair_queue_.reset(new (repair_queue_)
+                                packet::SortedQueue(session_config.max_queued_packets));
         if (!repair_queue_) {
             return;
         }
@@ -85,26 +140,37 @@ ReceiverSession::ReceiverSession(
             return;
         }
 
-        fec_decoder_.reset(
-            fec::CodecMap::instance().new_decoder(session_config.fec_decoder,
-                                                  byte_buffer_factory, allocator),
-            allocator);
-        if (!fec_decoder_) {
-            return;
-        }
-
         fec_parser_.reset(new (fec_parser_) rtp::Parser(format_map, NULL));
         if (!fec_parser_) {
             return;
         }
 
-        fec_reader_.reset(new (fec_reader_) fec::Reader(
-            session_config.fec_reader, session_config.fec_decoder.scheme, *fec_decoder_,
-            *preader, *repair_queue_, *fec_parser_, packet_factory, allocator));
-        if (!fec_reader_ || !fec_reader_->valid()) {
-            return;
+        if (session_config.fec_decoder.scheme == packet::FEC_RLC) {
+            rlc_reader_.reset(new (rlc_reader_) fec::RlcReader(
+                *preader, *repair_queue_, *fec_parser_, packet_factory,
+                byte_buffer_factory, memory_));
+            if (!rlc_reader_ || !rlc_reader_->valid()) {
+                return;
+            }
+            preader = rlc_reader_.get();
+        } else {
+            fec_decoder_.reset(
+                fec::CodecMap::instance().new_decoder(session_config.fec_decoder,
+                                                      byte_buffer_factory, memory_),
+                memory_);
+            if (!fec_decoder_) {
+                return;
+            }
+
+            fec_reader_.reset(new (fec_reader_) fec::Reader(
+                session_config.fec_reader, session_config.fec_decoder.scheme,
+                *fec_decoder_, *preader, *repair_queue_, *fec_parser_, packet_factory,
+                memory_, repair_pool));
+            if (!fec_reader_ || !fec_reader_->valid()) {
+                return;
+            }
+            preader = fec_reader_.get();
         }
-        preader = fec_reader_.get();
 
         fec_validator_.reset(new (fec_validator_) rtp::Validator(
             *preader, session_config.rtp_validator, format->sample_spec));
@@ -114,33 +180,63 @@ ReceiverSession::ReceiverSession(
         preader = fec_validator_.get();
     }
 
+    if (common_config.recording_dir) {
+        start_recording_(common_config.recording_dir, *preader, format->sample_spec);
+        if (recorder_) {
+            preader = recorder_.get();
+        }
+    }
+
+    if (common_config.concealment && !common_config.beeping) {
+        loss_concealer_.reset(new (loss_concealer_)
+                                  audio::LossConcealer(format->sample_spec, memory_));
+        if (!loss_concealer_ || !loss_concealer_->valid()) {
+            return;
+        }
+    }
+
     depacketizer_.reset(new (depacketizer_) audio::Depacketizer(
-        *preader, *payload_decoder_, format->sample_spec, common_config.beeping));
+        *preader, *payload_decoder_, format->sample_spec, common_config.beeping,
+        loss_concealer_.get()));
     if (!depacketizer_) {
         return;
     }
 
     audio::IFrameReader* areader = depacketizer_.get();
 
+    depacketizer_timer_.reset(new (depacketizer_timer_) audio::StageTimingReader(
+        *areader, "depacketizer", format->sample_spec));
+    if (!depacketizer_timer_) {
+        return;
+    }
+    areader = depacketizer_timer_.get();
+
     if (session_config.watchdog.no_playback_timeout != 0
         || session_config.watchdog.broken_playback_timeout != 0
         || session_config.watchdog.frame_status_window != 0) {
         watchdog_.reset(new (watchdog_) audio::Watchdog(
-            *areader, format->sample_spec, session_config.watchdog, allocator));
+            *areader, format->sample_spec, session_config.watchdog, memory_));
         if (!watchdog_ || !watchdog_->valid()) {
             return;
         }
         areader = watchdog_.get();
     }
 
-    if (format->sample_spec.channel_mask()
-        != common_config.output_sample_spec.channel_mask()) {
+    // In the common case, channel mapping is performed by resampler reader in
+    // the same pass with resampling. When poisoning is enabled, stages are kept
+    // separate, so that every one of them is checked by poisoner.
+    const bool fused_mapping = common_config.resampling && !common_config.poisoning;
+
+    if (!fused_mapping
+        && format->sample_spec.channel_mask()
+            != common_config.output_sample_spec.channel_mask()) {
         channel_mapper_reader_.reset(
             new (channel_mapper_reader_) audio::ChannelMapperReader(
                 *areader, sample_buffer_factory, common_config.internal_frame_length,
                 format->sample_spec,
                 audio::SampleSpec(format->sample_spec.sample_rate(),
-                                  common_config.output_sample_spec.channel_mask())));
+                                  common_config.output_sample_spec.channel_mask()),
+                common_config.channel_mixing));
         if (!channel_mapper_reader_ || !channel_mapper_reader_->valid()) {
             return;
         }
@@ -157,28 +253,47 @@ ReceiverSession::ReceiverSession(
             areader = resampler_poisoner_.get();
         }
 
+        const audio::SampleSpec in_spec = fused_mapping
+            ? format->sample_spec
+            : audio::SampleSpec(format->sample_spec.sample_rate(),
+                                common_config.output_sample_spec.channel_mask());
+
         resampler_.reset(
             audio::ResamplerMap::instance().new_resampler(
-                session_config.resampler_backend, allocator, sample_buffer_factory,
+                select_resampler_backend(session_config,
+                                         format->sample_spec.sample_rate(),
+                                         common_config.output_sample_spec.sample_rate()),
+                memory_, sample_buffer_factory,
                 session_config.resampler_profile, common_config.internal_frame_length,
                 audio::SampleSpec(format->sample_spec.sample_rate(),
-                                  common_config.output_sample_spec.channel_mask())),
-            allocator);
+                                  audio::ResamplerReader::resampler_channels(
+                                      in_spec, common_config.output_sample_spec))),
+            memory_);
 
         if (!resampler_) {
             return;
         }
 
-        resampler_reader_.reset(new (resampler_reader_) audio::ResamplerReader(
-            *areader, *resampler_,
-            audio::SampleSpec(format->sample_spec.sample_rate(),
-                              common_config.output_sample_spec.channel_mask()),
-            common_config.output_sample_spec));
+        if (fused_mapping) {
+            resampler_reader_.reset(new (resampler_reader_) audio::ResamplerReader(
+                *areader, *resampler_, sample_buffer_factory, in_spec,
+                common_config.output_sample_spec, common_config.channel_mixing));
+        } else {
+            resampler_reader_.reset(new (resampler_reader_) audio::ResamplerReader(
+                *areader, *resampler_, in_spec, common_config.output_sample_spec));
+        }
 
         if (!resampler_reader_ || !resampler_reader_->valid()) {
             return;
         }
         areader = resampler_reader_.get();
+
+        resampler_timer_.reset(new (resampler_timer_) audio::StageTimingReader(
+            *areader, "resampler", common_config.output_sample_spec));
+        if (!resampler_timer_) {
+            return;
+        }
+        areader = resampler_timer_.get();
     }
 
     if (common_config.poisoning) {
@@ -189,6 +304,24 @@ ReceiverSession::ReceiverSession(
         areader = session_poisoner_.get();
     }
 
+    // measures cost of the whole session chain, in worker thread if prefetching
+    session_timer_.reset(new (session_timer_) audio::StageTimingReader(
+        *areader, "session", common_config.output_sample_spec));
+    if (!session_timer_) {
+        return;
+    }
+    areader = session_timer_.get();
+
+    if (common_config.worker_threads != 0) {
+        prefetch_reader_.reset(new (prefetch_reader_) audio::PrefetchReader(
+            *areader, sample_buffer_factory, common_config.internal_frame_length,
+            common_config.output_sample_spec));
+        if (!prefetch_reader_ || !prefetch_reader_->valid()) {
+            return;
+        }
+        areader = prefetch_reader_.get();
+    }
+
     latency_monitor_.reset(new (latency_monitor_) audio::LatencyMonitor(
         *source_queue_, *depacketizer_, resampler_reader_.get(),
         session_config.latency_monitor, session_config.target_latency,
@@ -198,13 +331,48 @@ ReceiverSession::ReceiverSession(
         return;
     }
 
+    mixer_input_.reset(new (mixer_input_)
+                           audio::MixerInput(*areader, session_config.mixing));
+    if (!mixer_input_) {
+        return;
+    }
+
     audio_reader_ = areader;
+
+    roc_log(LogDebug,
+            "receiver session: initialized: memory=%lu arena_used=%lu arena_size=%lu"
+            " arena_overflows=%lu",
+            (unsigned long)memory_.stats().num_bytes, (unsigned long)arena_.used_bytes(),
+            (unsigned long)arena_.capacity(), (unsigned long)arena_.num_overflows());
 }
 
 bool ReceiverSession::valid() const {
     return audio_reader_;
 }
 
+const address::SocketAddr& ReceiverSession::key() const {
+    return src_address_;
+}
+
+size_t ReceiverSession::session_id() const {
+    return session_id_;
+}
+
+float ReceiverSession::cpu_load() const {
+    roc_panic_if(!valid());
+
+    return session_timer_->timer().load();
+}
+
+core::hashsum_t ReceiverSession::key_hash(const address::SocketAddr& addr) {
+    return addr.hash();
+}
+
+bool ReceiverSession::key_equal(const address::SocketAddr& addr1,
+                                const address::SocketAddr& addr2) {
+    return addr1 == addr2;
+}
+
 bool ReceiverSession::handle(const packet::PacketPtr& packet) {
     roc_panic_if(!valid());
 
@@ -217,6 +385,16 @@ bool ReceiverSession::handle(const packet::PacketPtr& packet) {
         return false;
     }
 
+    if (packet->flags() & packet::Packet::FlagAudio) {
+        jitter_meter_->update(*packet);
+        loss_meter_.update(*packet);
+
+        if (!has_source_id_ && packet->rtp()) {
+            source_id_ = packet->rtp()->source;
+            has_source_id_ = true;
+        }
+    }
+
     queue_router_->write(packet);
     return true;
 }
@@ -231,18 +409,55 @@ bool ReceiverSession::advance(packet::timestamp_t timestamp) {
     }
 
     if (latency_monitor_) {
+        if (jitter_meter_->has_peaks()) {
+            latency_monitor_->set_network_delay(jitter_meter_->peak_delay()
+                                                + jitter_meter_->peak_burst());
+        }
         if (!latency_monitor_->update(timestamp)) {
             return false;
         }
     }
 
+    if (!latency_stable_ && depacketizer_->started()) {
+        // delayed reader releases packets when target latency is accumulated
+        latency_stable_ = true;
+    }
+
+    if (jitter_limiter_.allow()) {
+        roc_log(LogDebug,
+                "receiver session: jitter=%.3fms peak_delay=%.3fms peak_burst=%.3fms",
+                double(jitter_meter_->jitter()) / core::Millisecond,
+                double(jitter_meter_->peak_delay()) / core::Millisecond,
+                double(jitter_meter_->peak_burst()) / core::Millisecond);
+    }
+
     return true;
 }
 
-bool ReceiverSession::reclock(packet::ntp_timestamp_t) {
+bool ReceiverSession::reclock(packet::ntp_timestamp_t playback_time) {
     roc_panic_if(!valid());
 
-    // no-op
+    const packet::ntp_timestamp_t capture_time = capture_timestamp_();
+
+    if (playback_time == 0 || capture_time == 0) {
+        return true;
+    }
+
+    // sender and receiver clocks should be synchronized, otherwise only
+    // changes of this value are meaningful
+    e2e_latency_ = playback_time >= capture_time
+        ? packet::ntp_2_nanoseconds(playback_time - capture_time)
+        : -packet::ntp_2_nanoseconds(capture_time - playback_time);
+
+    if (latency_monitor_) {
+        latency_monitor_->set_e2e_latency(e2e_latency_);
+    }
+
+    if (e2e_latency_limiter_.allow()) {
+        roc_log(LogDebug, "receiver session: e2e_latency=%.3fms",
+                double(e2e_latency_) / core::Millisecond);
+    }
+
     return true;
 }
 
@@ -252,14 +467,244 @@ audio::IFrameReader& ReceiverSession::reader() {
     return *audio_reader_;
 }
 
+audio::MixerInput& ReceiverSession::mixer_input() {
+    roc_panic_if(!valid());
+
+    return *mixer_input_;
+}
+
+audio::PrefetchReader* ReceiverSession::prefetch_reader() {
+    roc_panic_if(!valid());
+
+    return prefetch_reader_.get();
+}
+
+bool ReceiverSession::latency_stable() const {
+    return latency_stable_;
+}
+
+void ReceiverSession::set_degraded_quality(bool degraded) {
+    roc_panic_if(!valid());
+
+    if (!resampler_ || degraded == degraded_quality_
+        || resampler_profile_ == audio::ResamplerProfile_Low) {
+        return;
+    }
+
+    if (!resampler_->set_profile(degraded ? audio::ResamplerProfile_Low
+                                          : resampler_profile_)) {
+        roc_log(LogDebug, "receiver session: can't switch resampler profile");
+        return;
+    }
+
+    roc_log(LogInfo, "receiver session: %s resampler quality: session_id=%lu",
+            degraded ? "degraded" : "restored", (unsigned long)session_id_);
+
+    degraded_quality_ = degraded;
+}
+
+ReceiverSessionMetrics ReceiverSession::get_metrics() const {
+    roc_panic_if(!valid());
+
+    ReceiverSessionMetrics metrics;
+    metrics.session_id = session_id_;
+
+    if (latency_monitor_) {
+        const audio::LatencyMonitorMetrics latency_metrics = latency_monitor_->metrics();
+        metrics.niq_latency = latency_metrics.niq_latency;
+        metrics.target_latency = latency_metrics.target_latency;
+        metrics.scaling = latency_metrics.scaling;
+    }
+
+    metrics.e2e_latency = e2e_latency_;
+    metrics.jitter = jitter_meter_->jitter();
+    metrics.rtt = rtt_;
+    metrics.queue_size = source_queue_->size();
+    metrics.memory_bytes = memory_.stats().num_bytes;
+    metrics.cpu_load = cpu_load();
+
+    const audio::DepacketizerMetrics depacketizer_metrics = depacketizer_->metrics();
+    metrics.lost_packets = depacketizer_metrics.lost_packets;
+    metrics.late_packets = depacketizer_metrics.late_packets;
+    metrics.skipped_packets = depacketizer_metrics.skipped_packets;
+    metrics.rms_level = depacketizer_metrics.rms_level;
+    metrics.peak_level = depacketizer_metrics.peak_level;
+
+    if (fec_reader_) {
+        metrics.repaired_packets = fec_reader_->num_repaired_packets();
+    } else if (rlc_reader_) {
+        metrics.repaired_packets = rlc_reader_->num_repaired_packets();
+    }
+
+    if (watchdog_) {
+        metrics.alive = watchdog_->alive();
+    }
+
+    return metrics;
+}
+
+bool ReceiverSession::has_source(packet::source_t ssrc) const {
+    return has_source_id_ && source_id_ == ssrc;
+}
+
+bool ReceiverSession::has_reception_metrics() const {
+    return has_source_id_ && loss_meter_.started();
+}
+
+rtcp::ReceptionMetrics ReceiverSession::generate_reception_metrics() {
+    roc_panic_if(!valid());
+
+    rtcp::ReceptionMetrics metrics;
+    metrics.ssrc = source_id_;
+    metrics.fract_loss = loss_meter_.report_fract_loss();
+    metrics.cum_loss = loss_meter_.cum_loss();
+    metrics.ext_last_seqnum = loss_meter_.ext_seqnum();
+    metrics.jitter = (packet::timestamp_t)payload_sample_spec_.ns_2_rtp_timestamp(
+        jitter_meter_->jitter());
+    metrics.n_loss_runs = loss_meter_.report_loss_runs(
+        metrics.ext_first_seqnum, metrics.loss_runs, rtcp::ReceptionMetrics::MaxLossRuns);
+    metrics.dup_packets = loss_meter_.report_dup_packets();
+
+    return metrics;
+}
+
+const char* ReceiverSession::cname() const {
+    return cname_;
+}
+
+void ReceiverSession::set_cname(const char* cname) {
+    if (!cname) {
+        cname_[0] = '\0';
+        return;
+    }
+
+    if (strcmp(cname_, cname) == 0) {
+        return;
+    }
+
+    roc_log(LogDebug, "receiver session: updating cname: session_id=%lu cname=%s",
+            (unsigned long)session_id_, cname);
+
+    strncpy(cname_, cname, sizeof(cname_) - 1);
+    cname_[sizeof(cname_) - 1] = '\0';
+}
+
+float ReceiverSession::scaling() const {
+    roc_panic_if(!valid());
+
+    if (!latency_monitor_) {
+        return 1.0f;
+    }
+
+    return latency_monitor_->metrics().scaling;
+}
+
+void ReceiverSession::follow_scaling(bool enabled, float scaling) {
+    roc_panic_if(!valid());
+
+    if (latency_monitor_) {
+        latency_monitor_->set_external_scaling(enabled, scaling);
+    }
+}
+
+bool ReceiverSession::restore_state(const SessionStateStore& store) {
+    roc_panic_if(!valid());
+
+    if (state_restored_ || !latency_monitor_ || !has_source_id_) {
+        return false;
+    }
+
+    audio::LatencyMonitorState state;
+    if (!store.find(source_id_, cname_, state)) {
+        return false;
+    }
+
+    roc_log(LogInfo,
+            "receiver session: restoring state: session_id=%lu ssrc=%lu cname=%s",
+            (unsigned long)session_id_, (unsigned long)source_id_, cname_);
+
+    if (!latency_monitor_->restore_state(state)) {
+        roc_log(LogDebug, "receiver session: can't restore state: session_id=%lu",
+                (unsigned long)session_id_);
+        return false;
+    }
+
+    state_restored_ = true;
+
+    return true;
+}
+
+bool ReceiverSession::save_state(SessionStateStore& store) const {
+    roc_panic_if(!valid());
+
+    if (!latency_monitor_ || !has_source_id_ || !latency_stable_) {
+        return false;
+    }
+
+    store.update(source_id_, cname_, latency_monitor_->state());
+
+    return true;
+}
+
 void ReceiverSession::add_sending_metrics(const rtcp::SendingMetrics& metrics) {
-    // TODO
-    (void)metrics;
+    if (metrics.origin_ntp == 0) {
+        return;
+    }
+
+    report_ntp_ = metrics.origin_ntp;
+    report_rtp_ = metrics.origin_rtp;
 }
 
 void ReceiverSession::add_link_metrics(const rtcp::LinkMetrics& metrics) {
-    // TODO
-    (void)metrics;
+    rtt_ = metrics.rtt;
+}
+
+packet::ntp_timestamp_t ReceiverSession::capture_timestamp_() const {
+    // capture time from packets is the most precise
+    const packet::ntp_timestamp_t capture_time = depacketizer_->capture_timestamp();
+    if (capture_time != 0) {
+        return capture_time;
+    }
+
+    if (report_ntp_ == 0 || !depacketizer_->started()) {
+        return 0;
+    }
+
+    // otherwise, extrapolate from last sender report
+    const core::nanoseconds_t delta = payload_sample_spec_.rtp_timestamp_2_ns(
+        packet::timestamp_diff(depacketizer_->timestamp(), report_rtp_));
+
+    return delta >= 0 ? report_ntp_ + packet::nanoseconds_2_ntp(delta)
+                      : report_ntp_ - packet::nanoseconds_2_ntp(-delta);
+}
+
+void ReceiverSession::start_recording_(const char* dir,
+                                       packet::IReader& reader,
+                                       const audio::SampleSpec& sample_spec) {
+    char path[PATH_MAX];
+    if (snprintf(path, sizeof(path), "%s/roc-%lu-%lu.rtpdump", dir,
+                 (unsigned long)(core::timestamp(core::ClockUnix) / core::Second),
+                 (unsigned long)session_id_)
+        >= (int)sizeof(path)) {
+        roc_log(LogError, "receiver session: recording path too long: dir=%s", dir);
+        return;
+    }
+
+    char host[address::SocketAddr::MaxStrLen];
+    if (!src_address_.get_host(host, sizeof(host))) {
+        host[0] = '\0';
+    }
+
+    recorder_.reset(new (recorder_) rtp::Recorder(reader, path, host,
+                                                  src_address_.port(), sample_spec));
+    if (!recorder_ || !recorder_->valid()) {
+        // recording is optional, session still plays the stream
+        roc_log(LogError,
+                "receiver session: can't start recording, continuing without it:"
+                " session_id=%lu",
+                (unsigned long)session_id_);
+        recorder_.reset();
+    }
 }
 
 } // namespace pipeline
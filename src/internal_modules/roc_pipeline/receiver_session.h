@@ -19,29 +19,46 @@
 #include "roc_audio/iframe_reader.h"
 #include "roc_audio/iresampler.h"
 #include "roc_audio/latency_monitor.h"
+#include "roc_audio/mixer.h"
 #include "roc_audio/poison_reader.h"
+#include "roc_audio/prefetch_reader.h"
 #include "roc_audio/resampler_reader.h"
+#include "roc_audio/stage_timing_reader.h"
 #include "roc_audio/watchdog.h"
+#include "roc_core/arena_allocator.h"
 #include "roc_core/buffer_factory.h"
+#include "roc_core/counting_allocator.h"
+#include "roc_core/hashmap_node.h"
+#include "roc_core/hashsum.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list_node.h"
 #include "roc_core/optional.h"
+#include "roc_core/rate_limiter.h"
 #include "roc_core/ref_counted.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_fec/iblock_decoder.h"
 #include "roc_fec/reader.h"
+#include "roc_fec/repair_pool.h"
+#include "roc_fec/rlc_reader.h"
 #include "roc_packet/delayed_reader.h"
 #include "roc_packet/iparser.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/packet.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_packet/router.h"
+#include "roc_packet/seqnum_queue.h"
 #include "roc_packet/sorted_queue.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/metrics.h"
+#include "roc_pipeline/session_state_store.h"
+#include "roc_rtcp/headers.h"
 #include "roc_rtcp/metrics.h"
 #include "roc_rtp/format_map.h"
+#include "roc_rtp/jitter_meter.h"
+#include "roc_rtp/loss_meter.h"
 #include "roc_rtp/parser.h"
 #include "roc_rtp/populator.h"
+#include "roc_rtp/recorder.h"
 #include "roc_rtp/validator.h"
 
 namespace roc {
@@ -52,9 +69,13 @@ namespace pipeline {
 //! Contains:
 //!  - a pipeline for processing packets from single sender and converting
 //!    them into audio frames
+//!
+//! Session is identified by sender source address, which is used as a key
+//! when session is stored in a hashmap.
 class ReceiverSession
     : public core::RefCounted<ReceiverSession, core::StandardAllocation>,
-      public core::ListNode {
+      public core::ListNode,
+      public core::HashmapNode {
     typedef core::RefCounted<ReceiverSession, core::StandardAllocation> RefCounted;
 
 public:
@@ -62,15 +83,37 @@ public:
     ReceiverSession(const ReceiverSessionConfig& session_config,
                     const ReceiverCommonConfig& common_config,
                     const address::SocketAddr& src_address,
+                    size_t session_id,
                     const rtp::FormatMap& format_map,
                     packet::PacketFactory& packet_factory,
                     core::BufferFactory<uint8_t>& byte_buffer_factory,
                     core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+                    fec::RepairPool* repair_pool,
                     core::IAllocator& allocator);
 
     //! Check if the session pipeline was succefully constructed.
     bool valid() const;
 
+    //! Get sender source address.
+    const address::SocketAddr& key() const;
+
+    //! Get session identifier.
+    //! @remarks
+    //!  Identifier is unique within receiver.
+    size_t session_id() const;
+
+    //! Get smoothed CPU load of session.
+    //! @remarks
+    //!  Processing time of session frames divided by their duration.
+    float cpu_load() const;
+
+    //! Compute hash of source address.
+    static core::hashsum_t key_hash(const address::SocketAddr& addr);
+
+    //! Compare source addresses.
+    static bool key_equal(const address::SocketAddr& addr1,
+                          const address::SocketAddr& addr2);
+
     //! Try to route a packet to this session.
     //! @returns
     //!  true if the packet is dedicated for this session
@@ -82,6 +125,11 @@ public:
     bool advance(packet::timestamp_t timestamp);
 
     //! Adjust session clock to match consumer clock.
+    //! @remarks
+    //!  @p timestamp defines playback time of the last frame read from session.
+    //!  If packets carry capture time, or sender reports map RTP timestamps to
+    //!  sender clock, it is used to estimate end-to-end latency, which is then
+    //!  steered if synchronized playback is enabled.
     //! @returns
     //!  false if the session is ended
     bool reclock(packet::ntp_timestamp_t timestamp);
@@ -89,6 +137,77 @@ public:
     //! Get audio reader.
     audio::IFrameReader& reader();
 
+    //! Get mixer input.
+    //! @remarks
+    //!  Wraps reader() with mixing parameters of the session.
+    audio::MixerInput& mixer_input();
+
+    //! Get prefetch reader.
+    //! @returns
+    //!  NULL if parallel processing is disabled.
+    audio::PrefetchReader* prefetch_reader();
+
+    //! Check if session latency has reached the target latency.
+    //! @remarks
+    //!  Becomes true during advance() after enough packets were accumulated to
+    //!  start playback, and remains true afterwards.
+    bool latency_stable() const;
+
+    //! Switch resampler to low profile, or back to configured one.
+    //! @remarks
+    //!  Reduces CPU load at the cost of SNR, without interrupting playback.
+    //!  Does nothing if resampling is disabled.
+    void set_degraded_quality(bool degraded);
+
+    //! Get session metrics.
+    ReceiverSessionMetrics get_metrics() const;
+
+    //! Check if session packets have given SSRC.
+    bool has_source(packet::source_t ssrc) const;
+
+    //! Check if session has received packets to report reception metrics for.
+    bool has_reception_metrics() const;
+
+    //! Generate reception metrics to be sent to sender.
+    //! @remarks
+    //!  Fraction of lost packets is computed since previous call.
+    rtcp::ReceptionMetrics generate_reception_metrics();
+
+    //! Get sender CNAME.
+    //! @remarks
+    //!  Empty string until set using set_cname().
+    const char* cname() const;
+
+    //! Set sender CNAME, reported by sender via RTCP.
+    //! @remarks
+    //!  Sessions with the same CNAME share sender clock. NULL clears CNAME.
+    void set_cname(const char* cname);
+
+    //! Get current resampler scaling factor.
+    float scaling() const;
+
+    //! Follow scaling factor of another session with the same sender clock.
+    //! @remarks
+    //!  If @p enabled is false, session computes its own scaling factor.
+    //! @see audio::LatencyMonitor::set_external_scaling().
+    void follow_scaling(bool enabled, float scaling);
+
+    //! Restore state saved by previous session from the same sender.
+    //! @remarks
+    //!  Sender is looked up by SSRC and CNAME, so the call may succeed only
+    //!  after CNAME is known. State is restored at most once.
+    //! @returns
+    //!  true if state was found and restored.
+    bool restore_state(const SessionStateStore& store);
+
+    //! Save state for future sessions from the same sender.
+    //! @remarks
+    //!  Does nothing until latency becomes stable, so that the store is not
+    //!  updated by transient state of short sessions.
+    //! @returns
+    //!  true if state was saved.
+    bool save_state(SessionStateStore& store) const;
+
     //! Handle metrics obtained from sender.
     void add_sending_metrics(const rtcp::SendingMetrics& metrics);
 
@@ -96,17 +215,39 @@ public:
     void add_link_metrics(const rtcp::LinkMetrics& metrics);
 
 private:
+    packet::ntp_timestamp_t capture_timestamp_() const;
+    void start_recording_(const char* dir,
+                          packet::IReader& reader,
+                          const audio::SampleSpec& sample_spec);
+
     const address::SocketAddr src_address_;
+    const size_t session_id_;
+
+    packet::source_t source_id_;
+    bool has_source_id_;
+
+    char cname_[rtcp::header::SdesItemHeader::MaxTextLen + 1];
+
+    audio::SampleSpec payload_sample_spec_;
+
+    audio::ResamplerProfile resampler_profile_;
+    bool degraded_quality_;
+
+    // should be declared before components allocated from it
+    core::ArenaAllocator arena_;
+    core::CountingAllocator memory_;
 
     audio::IFrameReader* audio_reader_;
 
     core::Optional<packet::Router> queue_router_;
 
-    core::Optional<packet::SortedQueue> source_queue_;
+    core::Optional<packet::SeqnumQueue> source_queue_;
     core::Optional<packet::SortedQueue> repair_queue_;
 
     core::ScopedPtr<audio::IFrameDecoder> payload_decoder_;
 
+    core::Optional<rtp::JitterMeter> jitter_meter_;
+    rtp::LossMeter loss_meter_;
     core::Optional<rtp::Validator> validator_;
     core::Optional<rtp::Populator> populator_;
     core::Optional<packet::DelayedReader> delayed_reader_;
@@ -115,19 +256,46 @@ private:
     core::Optional<rtp::Parser> fec_parser_;
     core::ScopedPtr<fec::IBlockDecoder> fec_decoder_;
     core::Optional<fec::Reader> fec_reader_;
+    core::Optional<fec::RlcReader> rlc_reader_;
     core::Optional<rtp::Validator> fec_validator_;
 
+    core::Optional<rtp::Recorder> recorder_;
+
+    core::Optional<audio::LossConcealer> loss_concealer_;
     core::Optional<audio::Depacketizer> depacketizer_;
+    core::Optional<audio::StageTimingReader> depacketizer_timer_;
 
     core::Optional<audio::ChannelMapperReader> channel_mapper_reader_;
 
     core::Optional<audio::PoisonReader> resampler_poisoner_;
     core::Optional<audio::ResamplerReader> resampler_reader_;
+    core::Optional<audio::StageTimingReader> resampler_timer_;
+
+    core::Optional<audio::StageTimingReader> session_timer_;
     core::ScopedPtr<audio::IResampler> resampler_;
 
     core::Optional<audio::PoisonReader> session_poisoner_;
 
+    core::Optional<audio::PrefetchReader> prefetch_reader_;
+
     core::Optional<audio::LatencyMonitor> latency_monitor_;
+
+    core::Optional<audio::MixerInput> mixer_input_;
+
+    bool latency_stable_;
+    bool state_restored_;
+
+    core::nanoseconds_t e2e_latency_;
+
+    // mapping of RTP timestamps to sender clock from last sender report
+    packet::ntp_timestamp_t report_ntp_;
+    packet::timestamp_t report_rtp_;
+
+    // round-trip time estimated from RTCP XR
+    core::nanoseconds_t rtt_;
+
+    core::RateLimiter e2e_latency_limiter_;
+    core::RateLimiter jitter_limiter_;
 };
 
 } // namespace pipeline
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/receiver_session_frame.h
+//! @brief Frame of a single receiver session.
+
+#ifndef ROC_PIPELINE_RECEIVER_SESSION_FRAME_H_
+#define ROC_PIPELINE_RECEIVER_SESSION_FRAME_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Frame of a single receiver session.
+//! @remarks
+//!  Used to read sessions separately, without mixing them.
+struct ReceiverSessionFrame {
+    //! Session identifier, unique within receiver.
+    //! Set by receiver.
+    size_t session_id;
+
+    //! Buffer for session samples.
+    //! Set by caller, should have room for the requested number of samples.
+    audio::sample_t* samples;
+
+    ReceiverSessionFrame()
+        : session_id(0)
+        , samples(NULL) {
+    }
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_RECEIVER_SESSION_FRAME_H_
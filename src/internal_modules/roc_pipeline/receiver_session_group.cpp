@@ -8,28 +8,85 @@
 
 #include "roc_pipeline/receiver_session_group.h"
 #include "roc_address/socket_addr_to_str.h"
+#include "roc_core/align_ops.h"
 #include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/tracepoint.h"
 
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+// How often state of sessions is copied to session state store.
+const core::nanoseconds_t StateSaveInterval = core::Second;
+
+// How often rejection of new sessions is logged.
+const core::nanoseconds_t RejectLogInterval = 5 * core::Second;
+
+// Rough ratio of session load with low and default resampler profiles.
+// Resampler dominates session load when it's enabled.
+const float LowProfileLoadRatio = 0.5f;
+
+// Minimum time between switching resampler quality of sessions.
+// Gives smoothed loads time to settle after previous switch.
+const core::nanoseconds_t QualitySwitchInterval = 2 * core::Second;
+
+} // namespace
+
 ReceiverSessionGroup::ReceiverSessionGroup(
     const ReceiverConfig& receiver_config,
+    const ReceiverSlotConfig& slot_config,
     ReceiverState& receiver_state,
     audio::Mixer& mixer,
     const rtp::FormatMap& format_map,
     packet::PacketFactory& packet_factory,
     core::BufferFactory<uint8_t>& byte_buffer_factory,
     core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+    fec::RepairPool* repair_pool,
+    ReceiverWorkerPool* worker_pool,
     core::IAllocator& allocator)
     : allocator_(allocator)
+    , session_allocator_(allocator,
+                         core::AlignOps::align_max(
+                             receiver_config.default_session.arena_size),
+                         receiver_config.common.cached_session_arenas)
     , packet_factory_(packet_factory)
     , byte_buffer_factory_(byte_buffer_factory)
     , sample_buffer_factory_(sample_buffer_factory)
     , format_map_(format_map)
+    , repair_pool_(repair_pool)
+    , worker_pool_(worker_pool)
     , mixer_(mixer)
     , receiver_state_(receiver_state)
-    , receiver_config_(receiver_config) {
+    , receiver_config_(receiver_config)
+    , slot_config_(slot_config)
+    , session_map_(allocator)
+    , idle_timeout_((packet::timestamp_t)receiver_config.common.output_sample_spec
+                        .ns_2_rtp_timestamp(receiver_config.common.idle_release_timeout))
+    , idle_pos_(0)
+    , has_idle_pos_(false)
+    , idle_released_(false)
+    , state_save_interval_(
+          (packet::timestamp_t)receiver_config.common.output_sample_spec
+              .ns_2_rtp_timestamp(StateSaveInterval))
+    , state_save_pos_(0)
+    , has_state_save_pos_(false)
+    , cpu_load_(0)
+    , reject_limiter_(RejectLogInterval)
+    , degraded_quality_(false)
+    , quality_switch_interval_(
+          (packet::timestamp_t)receiver_config.common.output_sample_spec
+              .ns_2_rtp_timestamp(QualitySwitchInterval))
+    , quality_switch_pos_(0)
+    , has_quality_switch_pos_(false) {
+}
+
+ReceiverSessionGroup::~ReceiverSessionGroup() {
+    // sessions are destroyed without being removed, save their state
+    save_sessions_();
+
+    receiver_state_.add_cpu_load(-cpu_load_);
 }
 
 void ReceiverSessionGroup::route_packet(const packet::PacketPtr& packet) {
@@ -47,11 +104,44 @@ void ReceiverSessionGroup::advance_sessions(packet::timestamp_t timestamp) {
     for (curr = sessions_.front(); curr; curr = next) {
         next = sessions_.nextof(*curr);
 
+        const bool was_stable = curr->latency_stable();
+
         if (!curr->advance(timestamp)) {
             // Session ended.
             remove_session_(*curr);
+            continue;
+        }
+
+        if (!was_stable && curr->latency_stable()) {
+            if (IReceiverEventHandler* handler = receiver_state_.event_handler()) {
+                handler->on_session_latency_stable(curr->session_id());
+            }
         }
     }
+
+    if (receiver_config_.common.shared_clock && receiver_config_.common.resampling) {
+        share_clocks_();
+    }
+
+    if (receiver_config_.common.cpu_budget > 0) {
+        update_cpu_load_();
+
+        if (receiver_config_.common.resampling) {
+            update_quality_(timestamp);
+        }
+    }
+
+    if (idle_timeout_ != 0) {
+        release_idle_(timestamp);
+    }
+
+    if (!has_state_save_pos_ || !packet::timestamp_lt(timestamp, state_save_pos_)) {
+        // keep store up to date in case if process is killed
+        save_sessions_();
+
+        state_save_pos_ = timestamp + state_save_interval_;
+        has_state_save_pos_ = true;
+    }
 }
 
 void ReceiverSessionGroup::reclock_sessions(packet::ntp_timestamp_t timestamp) {
@@ -67,31 +157,117 @@ void ReceiverSessionGroup::reclock_sessions(packet::ntp_timestamp_t timestamp) {
     }
 }
 
+void ReceiverSessionGroup::schedule_sessions(ReceiverWorkerPool& worker_pool) {
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        audio::PrefetchReader* prefetch_reader = sess->prefetch_reader();
+        if (!prefetch_reader) {
+            continue;
+        }
+
+        // Can't fail, since pool is reserved for all sessions in create_session_().
+        if (!worker_pool.schedule(*prefetch_reader)) {
+            roc_panic("session group: can't schedule session");
+        }
+    }
+}
+
+bool ReceiverSessionGroup::read_sessions(ReceiverSessionFrame* frames,
+                                         size_t max_frames,
+                                         size_t& n_frames,
+                                         size_t n_samples) {
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        if (n_frames == max_frames) {
+            if (!discard_session_(*sess, n_samples)) {
+                return false;
+            }
+            continue;
+        }
+
+        ReceiverSessionFrame& sess_frame = frames[n_frames++];
+        sess_frame.session_id = sess->session_id();
+
+        audio::Frame frame(sess_frame.samples, n_samples);
+        if (!sess->reader().read(frame)) {
+            memset(sess_frame.samples, 0, n_samples * sizeof(audio::sample_t));
+        }
+    }
+
+    return true;
+}
+
 size_t ReceiverSessionGroup::num_sessions() const {
     return sessions_.size();
 }
 
+void ReceiverSessionGroup::get_metrics(ReceiverSlotMetrics& metrics) const {
+    metrics.num_sessions = sessions_.size();
+
+    core::SharedPtr<ReceiverSession> sess;
+    size_t n = 0;
+
+    for (sess = sessions_.front(); sess && n < ReceiverSlotMetrics::MaxSessions;
+         sess = sessions_.nextof(*sess)) {
+        metrics.sessions[n++] = sess->get_metrics();
+    }
+}
+
 void ReceiverSessionGroup::on_update_source(packet::source_t ssrc, const char* cname) {
-    // TODO
-    (void)ssrc;
-    (void)cname;
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        if (sess->has_source(ssrc)) {
+            sess->set_cname(cname);
+
+            // sender may have been restarted with new SSRC, try to find it by CNAME
+            if (SessionStateStore* store = receiver_state_.session_store()) {
+                sess->restore_state(*store);
+            }
+        }
+    }
 }
 
 void ReceiverSessionGroup::on_remove_source(packet::source_t ssrc) {
-    // TODO
-    (void)ssrc;
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        if (sess->has_source(ssrc)) {
+            sess->set_cname(NULL);
+        }
+    }
 }
 
 size_t ReceiverSessionGroup::on_get_num_sources() {
-    // TODO
-    return 0;
+    core::SharedPtr<ReceiverSession> sess;
+    size_t n_sources = 0;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        if (sess->has_reception_metrics()) {
+            n_sources++;
+        }
+    }
+
+    return n_sources;
 }
 
 rtcp::ReceptionMetrics
 ReceiverSessionGroup::on_get_reception_metrics(size_t source_index) {
-    // TODO
-    (void)source_index;
-    return rtcp::ReceptionMetrics();
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        if (!sess->has_reception_metrics()) {
+            continue;
+        }
+        if (source_index == 0) {
+            return sess->generate_reception_metrics();
+        }
+        source_index--;
+    }
+
+    roc_panic("session group: source index out of bounds");
 }
 
 void ReceiverSessionGroup::on_add_sending_metrics(const rtcp::SendingMetrics& metrics) {
@@ -110,11 +286,39 @@ void ReceiverSessionGroup::on_add_link_metrics(const rtcp::LinkMetrics& metrics)
     }
 }
 
-void ReceiverSessionGroup::route_transport_packet_(const packet::PacketPtr& packet) {
-    core::SharedPtr<ReceiverSession> sess;
+void ReceiverSessionGroup::share_clocks_() {
+    core::SharedPtr<ReceiverSession> sess, leader;
 
     for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
-        if (sess->handle(packet)) {
+        if (*sess->cname() == '\0') {
+            sess->follow_scaling(false, 1.0f);
+            continue;
+        }
+
+        // oldest session with the same sender clock drives the others
+        for (leader = sessions_.front(); leader != sess;
+             leader = sessions_.nextof(*leader)) {
+            if (strcmp(leader->cname(), sess->cname()) == 0) {
+                break;
+            }
+        }
+
+        if (leader != sess) {
+            sess->follow_scaling(true, leader->scaling());
+        } else {
+            sess->follow_scaling(false, 1.0f);
+        }
+    }
+}
+
+void ReceiverSessionGroup::route_transport_packet_(const packet::PacketPtr& packet) {
+    if (packet->udp()) {
+        core::SharedPtr<ReceiverSession> sess =
+            session_map_.find(packet->udp()->src_addr);
+
+        if (sess && sess->handle(packet)) {
+            roc_tracepoint(session_route, (const void*)sess.get(),
+                           (const void*)packet.get());
             return;
         }
     }
@@ -131,7 +335,8 @@ void ReceiverSessionGroup::route_control_packet_(const packet::PacketPtr& packet
 
     if (!rtcp_session_) {
         rtcp_session_.reset(new (rtcp_session_) rtcp::Session(
-            this, NULL, NULL, *rtcp_composer_, packet_factory_, byte_buffer_factory_));
+            receiver_config_.common.rtcp, this, NULL, NULL, *rtcp_composer_,
+            packet_factory_, byte_buffer_factory_));
     }
 
     if (!rtcp_session_->valid()) {
@@ -151,6 +356,51 @@ bool ReceiverSessionGroup::can_create_session_(const packet::PacketPtr& packet)
     return true;
 }
 
+bool ReceiverSessionGroup::admit_session_(ReceiverSessionConfig& sess_config) {
+    const ReceiverCommonConfig& common_config = receiver_config_.common;
+
+    if (common_config.cpu_budget <= 0) {
+        return true;
+    }
+
+    const size_t n_sessions = receiver_state_.num_sessions();
+    if (n_sessions == 0) {
+        return true;
+    }
+
+    const float budget = cpu_budget_();
+    const float load = receiver_state_.cpu_load();
+
+    // new session is expected to cost as much as an average existing one
+    const float session_load = load / (float)n_sessions;
+
+    if (load + session_load <= budget) {
+        return true;
+    }
+
+    if (common_config.resampling
+        && sess_config.resampler_profile != audio::ResamplerProfile_Low
+        && load + session_load * LowProfileLoadRatio <= budget) {
+        roc_log(LogInfo,
+                "session group: cpu budget is almost exhausted,"
+                " using low resampler profile for new session: load=%.3f budget=%.3f",
+                (double)load, (double)budget);
+        sess_config.resampler_profile = audio::ResamplerProfile_Low;
+        return true;
+    }
+
+    // packets of rejected sender are dropped, and every packet retries
+    if (reject_limiter_.allow()) {
+        roc_log(LogInfo,
+                "session group: cpu budget is exhausted, rejecting new session:"
+                " load=%.3f session_load=%.3f budget=%.3f n_sessions=%lu",
+                (double)load, (double)session_load, (double)budget,
+                (unsigned long)n_sessions);
+    }
+
+    return false;
+}
+
 void ReceiverSessionGroup::create_session_(const packet::PacketPtr& packet) {
     if (!packet->udp()) {
         roc_log(LogError,
@@ -164,18 +414,26 @@ void ReceiverSessionGroup::create_session_(const packet::PacketPtr& packet) {
         return;
     }
 
-    const ReceiverSessionConfig sess_config = make_session_config_(packet);
+    ReceiverSessionConfig sess_config = make_session_config_(packet);
+
+    if (!admit_session_(sess_config)) {
+        return;
+    }
 
     const address::SocketAddr src_address = packet->udp()->src_addr;
     const address::SocketAddr dst_address = packet->udp()->dst_addr;
 
-    roc_log(LogInfo, "session group: creating session: src_addr=%s dst_addr=%s",
-            address::socket_addr_to_str(src_address).c_str(),
+    const size_t session_id = receiver_state_.next_session_id();
+
+    roc_log(LogInfo,
+            "session group: creating session: session_id=%lu src_addr=%s dst_addr=%s",
+            (unsigned long)session_id, address::socket_addr_to_str(src_address).c_str(),
             address::socket_addr_to_str(dst_address).c_str());
 
-    core::SharedPtr<ReceiverSession> sess = new (allocator_) ReceiverSession(
-        sess_config, receiver_config_.common, src_address, format_map_, packet_factory_,
-        byte_buffer_factory_, sample_buffer_factory_, allocator_);
+    core::SharedPtr<ReceiverSession> sess = new (session_allocator_) ReceiverSession(
+        sess_config, receiver_config_.common, src_address, session_id, format_map_,
+        packet_factory_, byte_buffer_factory_, sample_buffer_factory_, repair_pool_,
+        session_allocator_);
 
     if (!sess || !sess->valid()) {
         roc_log(LogError, "session group: can't create session, initialization failed");
@@ -188,25 +446,215 @@ void ReceiverSessionGroup::create_session_(const packet::PacketPtr& packet) {
         return;
     }
 
-    mixer_.add_input(sess->reader());
+    roc_tracepoint(session_route, (const void*)sess.get(), (const void*)packet.get());
+
+    if (!session_map_.grow()) {
+        roc_log(LogError, "session group: can't create session, allocation failed");
+        return;
+    }
+
+    if (worker_pool_ && !worker_pool_->reserve(receiver_state_.num_sessions() + 1)) {
+        roc_log(LogError, "session group: can't create session, allocation failed");
+        return;
+    }
+
+    if (SessionStateStore* store = receiver_state_.session_store()) {
+        sess->restore_state(*store);
+    }
+
+    if (degraded_quality_) {
+        sess->set_degraded_quality(true);
+    }
+
+    mixer_.add_input(sess->mixer_input());
     sessions_.push_back(*sess);
+    session_map_.insert(*sess);
 
     receiver_state_.add_sessions(+1);
+
+    if (IReceiverEventHandler* handler = receiver_state_.event_handler()) {
+        handler->on_session_added(session_id);
+    }
 }
 
 void ReceiverSessionGroup::remove_session_(ReceiverSession& sess) {
-    roc_log(LogInfo, "session group: removing session");
+    const size_t session_id = sess.session_id();
 
-    mixer_.remove_input(sess.reader());
+    roc_log(LogInfo, "session group: removing session: session_id=%lu",
+            (unsigned long)session_id);
+
+    if (SessionStateStore* store = receiver_state_.session_store()) {
+        sess.save_state(*store);
+    }
+
+    mixer_.remove_input(sess.mixer_input());
+    session_map_.remove(sess);
     sessions_.remove(sess);
 
     receiver_state_.add_sessions(-1);
+
+    if (IReceiverEventHandler* handler = receiver_state_.event_handler()) {
+        handler->on_session_removed(session_id);
+    }
+}
+
+bool ReceiverSessionGroup::discard_session_(ReceiverSession& sess, size_t n_samples) {
+    if (!discard_buffer_) {
+        discard_buffer_ = sample_buffer_factory_.new_buffer();
+        if (!discard_buffer_) {
+            roc_log(LogError, "session group: can't allocate buffer");
+            return false;
+        }
+    }
+
+    const size_t num_ch = receiver_config_.common.output_sample_spec.num_channels();
+    const size_t max_samples = discard_buffer_.capacity() / num_ch * num_ch;
+
+    while (n_samples != 0) {
+        const size_t n_read = n_samples < max_samples ? n_samples : max_samples;
+
+        audio::Frame frame(discard_buffer_.data(), n_read);
+        sess.reader().read(frame);
+
+        n_samples -= n_read;
+    }
+
+    return true;
+}
+
+void ReceiverSessionGroup::save_sessions_() {
+    SessionStateStore* store = receiver_state_.session_store();
+    if (!store) {
+        return;
+    }
+
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        sess->save_state(*store);
+    }
+}
+
+void ReceiverSessionGroup::release_idle_(packet::timestamp_t timestamp) {
+    if (sessions_.size() != 0) {
+        has_idle_pos_ = false;
+        idle_released_ = false;
+        return;
+    }
+
+    if (idle_released_) {
+        return;
+    }
+
+    if (!has_idle_pos_) {
+        has_idle_pos_ = true;
+        idle_pos_ = timestamp + idle_timeout_;
+        return;
+    }
+
+    if (packet::timestamp_lt(timestamp, idle_pos_)) {
+        return;
+    }
+
+    roc_log(LogDebug, "session group: releasing memory of idle group: cached_arenas=%lu",
+            (unsigned long)session_allocator_.num_cached());
+
+    // everything below is allocated again on demand when traffic resumes
+    session_allocator_.release_cached();
+    discard_buffer_ = core::Slice<audio::sample_t>();
+    rtcp_session_.reset(NULL);
+
+    idle_released_ = true;
+}
+
+float ReceiverSessionGroup::cpu_budget_() const {
+    const ReceiverCommonConfig& common_config = receiver_config_.common;
+
+    // sessions are processed in parallel by workers, if any
+    return common_config.cpu_budget
+        * (float)std::max(common_config.worker_threads, (size_t)1);
+}
+
+void ReceiverSessionGroup::update_cpu_load_() {
+    float load = 0;
+
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        load += sess->cpu_load();
+    }
+
+    const int new_cpu_load = (int)(load * ReceiverState::CpuLoadScale + 0.5f);
+
+    receiver_state_.add_cpu_load(new_cpu_load - cpu_load_);
+    cpu_load_ = new_cpu_load;
+}
+
+void ReceiverSessionGroup::update_quality_(packet::timestamp_t timestamp) {
+    if (has_quality_switch_pos_
+        && packet::timestamp_lt(timestamp, quality_switch_pos_)) {
+        return;
+    }
+
+    const float budget = cpu_budget_();
+    const float load = receiver_state_.cpu_load();
+
+    // Hysteresis: restore quality only when load is low enough to stay within
+    // budget after restoring.
+    bool degraded = degraded_quality_;
+    if (!degraded && load > budget) {
+        degraded = true;
+    } else if (degraded && load < budget * LowProfileLoadRatio) {
+        degraded = false;
+    }
+
+    if (degraded == degraded_quality_) {
+        return;
+    }
+
+    roc_log(LogInfo,
+            "session group: %s resampler quality of sessions: load=%.3f budget=%.3f"
+            " n_sessions=%lu",
+            degraded ? "degrading" : "restoring", (double)load, (double)budget,
+            (unsigned long)sessions_.size());
+
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        sess->set_degraded_quality(degraded);
+    }
+
+    degraded_quality_ = degraded;
+
+    quality_switch_pos_ = timestamp + quality_switch_interval_;
+    has_quality_switch_pos_ = true;
 }
 
 ReceiverSessionConfig
 ReceiverSessionGroup::make_session_config_(const packet::PacketPtr& packet) const {
     ReceiverSessionConfig config = receiver_config_.default_session;
 
+    if (slot_config_.target_latency != 0 && config.target_latency != 0) {
+        // Keep latency bounds proportional to target latency.
+        const double scale =
+            (double)slot_config_.target_latency / (double)config.target_latency;
+
+        config.latency_monitor.min_latency =
+            core::nanoseconds_t(config.latency_monitor.min_latency * scale);
+        config.latency_monitor.max_latency =
+            core::nanoseconds_t(config.latency_monitor.max_latency * scale);
+
+        config.target_latency = slot_config_.target_latency;
+    }
+
+    if (slot_config_.override_resampler_profile) {
+        config.resampler_profile = slot_config_.resampler_profile;
+    }
+
+    if (slot_config_.override_mixing) {
+        config.mixing = slot_config_.mixing;
+    }
+
     packet::RTP* rtp = packet->rtp();
     if (rtp) {
         config.payload_type = rtp->payload_type;
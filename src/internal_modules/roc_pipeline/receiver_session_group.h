@@ -13,11 +13,18 @@
 #define ROC_PIPELINE_RECEIVER_SESSION_GROUP_H_
 
 #include "roc_audio/mixer.h"
+#include "roc_core/caching_allocator.h"
+#include "roc_core/hashmap.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
+#include "roc_core/slice.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_pipeline/metrics.h"
 #include "roc_pipeline/receiver_session.h"
+#include "roc_pipeline/receiver_session_frame.h"
 #include "roc_pipeline/receiver_state.h"
+#include "roc_pipeline/receiver_worker_pool.h"
 #include "roc_rtcp/composer.h"
 #include "roc_rtcp/session.h"
 
@@ -28,18 +35,33 @@ namespace pipeline {
 //!
 //! Contains:
 //!  - a set of related receiver sessions
+//!  - an index of sessions by source address, used to route packets
+//!
+//! Sessions and RTCP state are created on first packet. Memory kept
+//! for reuse is released after the group stays without sessions for
+//! configured idle timeout.
+//!
+//! If session state store is set in receiver state, sessions restore
+//! state of known senders when created, and save it periodically, when
+//! removed, and when the group is destroyed.
 class ReceiverSessionGroup : public core::NonCopyable<>, private rtcp::IReceiverHooks {
 public:
     //! Initialize.
     ReceiverSessionGroup(const ReceiverConfig& receiver_config,
+                         const ReceiverSlotConfig& slot_config,
                          ReceiverState& receiver_state,
                          audio::Mixer& mixer,
                          const rtp::FormatMap& format_map,
                          packet::PacketFactory& packet_factory,
                          core::BufferFactory<uint8_t>& byte_buffer_factory,
                          core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+                         fec::RepairPool* repair_pool,
+                         ReceiverWorkerPool* worker_pool,
                          core::IAllocator& allocator);
 
+    //! Save state of remaining sessions, if session state store is set.
+    ~ReceiverSessionGroup();
+
     //! Route packet to session.
     void route_packet(const packet::PacketPtr& packet);
 
@@ -49,9 +71,28 @@ public:
     //! Adjust session clock to match consumer clock.
     void reclock_sessions(packet::ntp_timestamp_t timestamp);
 
+    //! Schedule sessions to be processed in parallel by worker pool.
+    void schedule_sessions(ReceiverWorkerPool& worker_pool);
+
+    //! Read next frame of every session separately, without mixing.
+    //! @remarks
+    //!  Fills @p frames starting from index @p n_frames, one per session, until
+    //!  @p max_frames is reached, and increments @p n_frames accordingly. Every
+    //!  frame gets @p n_samples samples. Sessions that don't fit into @p frames
+    //!  are read anyway, to keep them in sync, and their samples are discarded.
+    //! @returns
+    //!  false if allocation failed.
+    bool read_sessions(ReceiverSessionFrame* frames,
+                       size_t max_frames,
+                       size_t& n_frames,
+                       size_t n_samples);
+
     //! Get number of alive sessions.
     size_t num_sessions() const;
 
+    //! Get metrics of all sessions.
+    void get_metrics(ReceiverSlotMetrics& metrics) const;
+
 private:
     // Implementation of rtcp::IReceiverHooks interface.
     // These methods are invoked by rtcp::Session.
@@ -67,28 +108,71 @@ private:
 
     bool can_create_session_(const packet::PacketPtr& packet);
 
+    void share_clocks_();
+
+    bool admit_session_(ReceiverSessionConfig& sess_config);
     void create_session_(const packet::PacketPtr& packet);
     void remove_session_(ReceiverSession& sess);
 
+    bool discard_session_(ReceiverSession& sess, size_t n_samples);
+
+    void save_sessions_();
+
+    float cpu_budget_() const;
+    void update_cpu_load_();
+    void update_quality_(packet::timestamp_t timestamp);
+
+    void release_idle_(packet::timestamp_t timestamp);
+
     ReceiverSessionConfig make_session_config_(const packet::PacketPtr& packet) const;
 
     core::IAllocator& allocator_;
 
+    // keeps arenas of ended sessions for new sessions, should outlive sessions
+    core::CachingAllocator session_allocator_;
+
     packet::PacketFactory& packet_factory_;
     core::BufferFactory<uint8_t>& byte_buffer_factory_;
     core::BufferFactory<audio::sample_t>& sample_buffer_factory_;
 
     const rtp::FormatMap& format_map_;
 
+    fec::RepairPool* repair_pool_;
+    ReceiverWorkerPool* worker_pool_;
+
     audio::Mixer& mixer_;
 
     ReceiverState& receiver_state_;
     const ReceiverConfig& receiver_config_;
+    const ReceiverSlotConfig slot_config_;
 
     core::Optional<rtcp::Composer> rtcp_composer_;
     core::Optional<rtcp::Session> rtcp_session_;
 
     core::List<ReceiverSession> sessions_;
+    // most slots have a single session, keep it without allocating buckets
+    core::Hashmap<ReceiverSession, 1> session_map_;
+
+    core::Slice<audio::sample_t> discard_buffer_;
+
+    const packet::timestamp_t idle_timeout_;
+    packet::timestamp_t idle_pos_;
+    bool has_idle_pos_;
+    bool idle_released_;
+
+    const packet::timestamp_t state_save_interval_;
+    packet::timestamp_t state_save_pos_;
+    bool has_state_save_pos_;
+
+    // load of our sessions added to receiver state
+    int cpu_load_;
+    core::RateLimiter reject_limiter_;
+
+    // whether sessions use low resampler profile because of cpu pressure
+    bool degraded_quality_;
+    const packet::timestamp_t quality_switch_interval_;
+    packet::timestamp_t quality_switch_pos_;
+    bool has_quality_switch_pos_;
 };
 
 } // namespace pipeline
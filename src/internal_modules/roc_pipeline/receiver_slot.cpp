@@ -14,25 +14,43 @@ namespace roc {
 namespace pipeline {
 
 ReceiverSlot::ReceiverSlot(const ReceiverConfig& receiver_config,
+                           const ReceiverSlotConfig& slot_config,
                            ReceiverState& receiver_state,
                            audio::Mixer& mixer,
                            const rtp::FormatMap& format_map,
                            packet::PacketFactory& packet_factory,
                            core::BufferFactory<uint8_t>& byte_buffer_factory,
                            core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+                           fec::RepairPool* repair_pool,
+                           ReceiverWorkerPool* worker_pool,
                            core::IAllocator& allocator)
     : RefCounted(allocator)
     , format_map_(format_map)
+    , packet_factory_(packet_factory)
+    , impairer_config_(receiver_config.common.impairment)
+    , srtp_config_(receiver_config.common.srtp)
     , receiver_state_(receiver_state)
     , session_group_(receiver_config,
+                     slot_config,
                      receiver_state,
                      mixer,
                      format_map,
                      packet_factory,
                      byte_buffer_factory,
                      sample_buffer_factory,
-                     allocator) {
+                     repair_pool,
+                     worker_pool,
+                     allocator)
+    , metrics_(ReceiverSlotMetrics())
+    , control_interval_((packet::timestamp_t)receiver_config.common.output_sample_spec
+                            .ns_2_rtp_timestamp(receiver_config.common.control_interval))
+    , control_pos_(0)
+    , has_control_pos_(false) {
     roc_log(LogDebug, "receiver slot: initializing");
+
+    if (receiver_config.common.multiplexing) {
+        demultiplexer_.reset(new (demultiplexer_) packet::Demultiplexer(packet_factory));
+    }
 }
 
 ReceiverEndpoint* ReceiverSlot::create_endpoint(address::Interface iface,
@@ -93,17 +111,60 @@ void ReceiverSlot::advance(packet::timestamp_t timestamp) {
         repair_endpoint_->pull_packets();
     }
 
+    if (!control_due_(timestamp)) {
+        return;
+    }
+
     session_group_.advance_sessions(timestamp);
+
+    publish_metrics_();
 }
 
 void ReceiverSlot::reclock(packet::ntp_timestamp_t timestamp) {
     session_group_.reclock_sessions(timestamp);
 }
 
+void ReceiverSlot::schedule_sessions(ReceiverWorkerPool& worker_pool) {
+    session_group_.schedule_sessions(worker_pool);
+}
+
+bool ReceiverSlot::read_sessions(ReceiverSessionFrame* frames,
+                                 size_t max_frames,
+                                 size_t& n_frames,
+                                 size_t n_samples) {
+    return session_group_.read_sessions(frames, max_frames, n_frames, n_samples);
+}
+
 size_t ReceiverSlot::num_sessions() const {
     return session_group_.num_sessions();
 }
 
+void ReceiverSlot::get_metrics(ReceiverSlotMetrics& metrics) const {
+    metrics = metrics_.wait_load();
+}
+
+bool ReceiverSlot::control_due_(packet::timestamp_t timestamp) {
+    if (control_interval_ == 0) {
+        return true;
+    }
+
+    if (has_control_pos_ && packet::timestamp_lt(timestamp, control_pos_)) {
+        return false;
+    }
+
+    has_control_pos_ = true;
+    control_pos_ = timestamp + control_interval_;
+
+    return true;
+}
+
+void ReceiverSlot::publish_metrics_() {
+    ReceiverSlotMetrics metrics;
+    session_group_.get_metrics(metrics);
+
+    metrics_.exclusive_store(metrics);
+}
+
 ReceiverEndpoint* ReceiverSlot::create_source_endpoint_(address::Protocol proto) {
     if (source_endpoint_) {
         roc_log(LogError, "receiver slot: audio source endpoint is already set");
@@ -121,7 +182,8 @@ ReceiverEndpoint* ReceiverSlot::create_source_endpoint_(address::Protocol proto)
     }
 
     source_endpoint_.reset(new (source_endpoint_) ReceiverEndpoint(
-        proto, receiver_state_, session_group_, format_map_, allocator()));
+        proto, receiver_state_, session_group_, format_map_, packet_factory_,
+        impairer_config_, srtp_config_, allocator(), demultiplexer_.get()));
 
     if (!source_endpoint_ || !source_endpoint_->valid()) {
         roc_log(LogError, "receiver slot: can't create source endpoint");
@@ -149,7 +211,8 @@ ReceiverEndpoint* ReceiverSlot::create_repair_endpoint_(address::Protocol proto)
     }
 
     repair_endpoint_.reset(new (repair_endpoint_) ReceiverEndpoint(
-        proto, receiver_state_, session_group_, format_map_, allocator()));
+        proto, receiver_state_, session_group_, format_map_, packet_factory_,
+        impairer_config_, srtp_config_, allocator(), demultiplexer_.get()));
 
     if (!repair_endpoint_ || !repair_endpoint_->valid()) {
         roc_log(LogError, "receiver slot: can't create repair endpoint");
@@ -171,7 +234,8 @@ ReceiverEndpoint* ReceiverSlot::create_control_endpoint_(address::Protocol proto
     }
 
     control_endpoint_.reset(new (control_endpoint_) ReceiverEndpoint(
-        proto, receiver_state_, session_group_, format_map_, allocator()));
+        proto, receiver_state_, session_group_, format_map_, packet_factory_,
+        impairer_config_, srtp_config_, allocator()));
 
     if (!control_endpoint_ || !control_endpoint_->valid()) {
         roc_log(LogError, "receiver slot: can't create control endpoint");
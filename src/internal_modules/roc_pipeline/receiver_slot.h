@@ -19,8 +19,11 @@
 #include "roc_core/list.h"
 #include "roc_core/list_node.h"
 #include "roc_core/ref_counted.h"
+#include "roc_core/seqlock.h"
 #include "roc_packet/packet_factory.h"
+#include "roc_pipeline/metrics.h"
 #include "roc_pipeline/receiver_endpoint.h"
+#include "roc_pipeline/receiver_session_frame.h"
 #include "roc_pipeline/receiver_session_group.h"
 #include "roc_pipeline/receiver_state.h"
 #include "roc_rtp/format_map.h"
@@ -40,12 +43,15 @@ class ReceiverSlot : public core::RefCounted<ReceiverSlot, core::StandardAllocat
 public:
     //! Initialize.
     ReceiverSlot(const ReceiverConfig& receiver_config,
+                 const ReceiverSlotConfig& slot_config,
                  ReceiverState& receiver_state,
                  audio::Mixer& mixer,
                  const rtp::FormatMap& format_map,
                  packet::PacketFactory& packet_factory,
                  core::BufferFactory<uint8_t>& byte_buffer_factory,
                  core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+                 fec::RepairPool* repair_pool,
+                 ReceiverWorkerPool* worker_pool,
                  core::IAllocator& allocator);
 
     //! Create endpoint.
@@ -55,27 +61,60 @@ public:
     void delete_endpoint(address::Interface iface);
 
     //! Pull packets from queues and advance session timestamp.
+    //! @remarks
+    //!  Sessions are advanced and metrics are published only once per control
+    //!  interval, if it's configured.
     void advance(packet::timestamp_t timestamp);
 
     //! Adjust session clock to match consumer clock.
     void reclock(packet::ntp_timestamp_t timestamp);
 
+    //! Schedule sessions to be processed in parallel by worker pool.
+    void schedule_sessions(ReceiverWorkerPool& worker_pool);
+
+    //! Read next frame of every session separately, without mixing.
+    //! @see ReceiverSessionGroup::read_sessions().
+    bool read_sessions(ReceiverSessionFrame* frames,
+                       size_t max_frames,
+                       size_t& n_frames,
+                       size_t n_samples);
+
     //! Get number of alive sessions.
     size_t num_sessions() const;
 
+    //! Get metrics published during last advance().
+    //! @remarks
+    //!  Can be called from any thread. Doesn't block pipeline thread.
+    void get_metrics(ReceiverSlotMetrics& metrics) const;
+
 private:
     ReceiverEndpoint* create_source_endpoint_(address::Protocol proto);
     ReceiverEndpoint* create_repair_endpoint_(address::Protocol proto);
     ReceiverEndpoint* create_control_endpoint_(address::Protocol proto);
 
+    bool control_due_(packet::timestamp_t timestamp);
+    void publish_metrics_();
+
     const rtp::FormatMap& format_map_;
 
+    packet::PacketFactory& packet_factory_;
+    const packet::ImpairerConfig impairer_config_;
+    const rtp::SrtpConfig srtp_config_;
+
     ReceiverState& receiver_state_;
     ReceiverSessionGroup session_group_;
 
+    core::Optional<packet::Demultiplexer> demultiplexer_;
+
     core::Optional<ReceiverEndpoint> source_endpoint_;
     core::Optional<ReceiverEndpoint> repair_endpoint_;
     core::Optional<ReceiverEndpoint> control_endpoint_;
+
+    core::Seqlock<ReceiverSlotMetrics> metrics_;
+
+    const packet::timestamp_t control_interval_;
+    packet::timestamp_t control_pos_;
+    bool has_control_pos_;
 };
 
 } // namespace pipeline
@@ -30,14 +30,38 @@ ReceiverSource::ReceiverSource(
     , audio_reader_(NULL)
     , config_(config)
     , timestamp_(0) {
+    if (config.common.worker_threads != 0) {
+        worker_pool_.reset(new (worker_pool_) ReceiverWorkerPool(
+            config.common.worker_threads, config.common.worker_thread, allocator));
+        if (!worker_pool_ || !worker_pool_->valid()) {
+            return;
+        }
+    }
+
+    if (config.common.fec_repair_threads != 0) {
+        repair_pool_.reset(new (repair_pool_) fec::RepairPool(
+            config.common.fec_repair_threads, config.common.worker_thread, allocator));
+        if (!repair_pool_ || !repair_pool_->valid()) {
+            return;
+        }
+    }
+
     mixer_.reset(new (mixer_) audio::Mixer(sample_buffer_factory,
                                            config.common.internal_frame_length,
-                                           config.common.output_sample_spec));
+                                           config.common.output_sample_spec,
+                                           config.common.max_active_sessions));
     if (!mixer_ || !mixer_->valid()) {
         return;
     }
     audio::IFrameReader* areader = mixer_.get();
 
+    mixer_timer_.reset(new (mixer_timer_) audio::StageTimingReader(
+        *areader, "mixer", config.common.output_sample_spec));
+    if (!mixer_timer_) {
+        return;
+    }
+    areader = mixer_timer_.get();
+
     if (config.common.poisoning) {
         poisoner_.reset(new (poisoner_) audio::PoisonReader(*areader));
         if (!poisoner_) {
@@ -63,10 +87,11 @@ bool ReceiverSource::valid() const {
     return audio_reader_;
 }
 
-ReceiverSlot* ReceiverSource::create_slot() {
+ReceiverSlot* ReceiverSource::create_slot(const ReceiverSlotConfig& slot_config) {
     core::SharedPtr<ReceiverSlot> slot = new (allocator_)
-        ReceiverSlot(config_, state_, *mixer_, format_map_, packet_factory_,
-                     byte_buffer_factory_, sample_buffer_factory_, allocator_);
+        ReceiverSlot(config_, slot_config, state_, *mixer_, format_map_,
+                     packet_factory_, byte_buffer_factory_, sample_buffer_factory_,
+                     repair_pool_.get(), worker_pool_.get(), allocator_);
     if (!slot) {
         return NULL;
     }
@@ -79,6 +104,20 @@ size_t ReceiverSource::num_sessions() const {
     return state_.num_sessions();
 }
 
+bool ReceiverSource::wait_active(core::nanoseconds_t timeout) {
+    roc_panic_if(!valid());
+
+    return state_.wait_active(timeout);
+}
+
+void ReceiverSource::set_event_handler(IReceiverEventHandler* handler) {
+    state_.set_event_handler(handler);
+}
+
+void ReceiverSource::set_session_store(SessionStateStore* store) {
+    state_.set_session_store(store);
+}
+
 sndio::DeviceType ReceiverSource::type() const {
     return sndio::DeviceType_Source;
 }
@@ -136,10 +175,7 @@ void ReceiverSource::reclock(packet::ntp_timestamp_t timestamp) {
 bool ReceiverSource::read(audio::Frame& frame) {
     roc_panic_if(!valid());
 
-    for (core::SharedPtr<ReceiverSlot> slot = slots_.front(); slot;
-         slot = slots_.nextof(*slot)) {
-        slot->advance(timestamp_);
-    }
+    advance_(frame.num_samples());
 
     if (!audio_reader_->read(frame)) {
         return false;
@@ -151,5 +187,51 @@ bool ReceiverSource::read(audio::Frame& frame) {
     return true;
 }
 
+bool ReceiverSource::read_sessions(ReceiverSessionFrame* frames,
+                                   size_t max_frames,
+                                   size_t& n_frames,
+                                   size_t n_samples) {
+    roc_panic_if(!valid());
+
+    roc_panic_if_not(frames || max_frames == 0);
+    roc_panic_if_not(n_samples % config_.common.output_sample_spec.num_channels() == 0);
+
+    advance_(n_samples);
+
+    n_frames = 0;
+
+    bool ret = true;
+
+    for (core::SharedPtr<ReceiverSlot> slot = slots_.front(); slot;
+         slot = slots_.nextof(*slot)) {
+        if (!slot->read_sessions(frames, max_frames, n_frames, n_samples)) {
+            ret = false;
+        }
+    }
+
+    timestamp_ +=
+        packet::timestamp_t(n_samples / config_.common.output_sample_spec.num_channels());
+
+    return ret;
+}
+
+void ReceiverSource::advance_(size_t n_samples) {
+    for (core::SharedPtr<ReceiverSlot> slot = slots_.front(); slot;
+         slot = slots_.nextof(*slot)) {
+        slot->advance(timestamp_);
+    }
+
+    if (worker_pool_) {
+        // Compute next frame of every session in parallel, so that
+        // mixer will only need to join them.
+        for (core::SharedPtr<ReceiverSlot> slot = slots_.front(); slot;
+             slot = slots_.nextof(*slot)) {
+            slot->schedule_sessions(*worker_pool_);
+        }
+
+        worker_pool_->process(n_samples);
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -16,18 +16,24 @@
 #include "roc_audio/mixer.h"
 #include "roc_audio/poison_reader.h"
 #include "roc_audio/profiling_reader.h"
+#include "roc_audio/stage_timing_reader.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/mutex.h"
 #include "roc_core/optional.h"
 #include "roc_core/stddefs.h"
+#include "roc_fec/repair_pool.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/ireceiver_event_handler.h"
 #include "roc_pipeline/receiver_endpoint.h"
+#include "roc_pipeline/receiver_session_frame.h"
 #include "roc_pipeline/receiver_slot.h"
 #include "roc_pipeline/receiver_state.h"
+#include "roc_pipeline/receiver_worker_pool.h"
+#include "roc_pipeline/session_state_store.h"
 #include "roc_rtp/format_map.h"
 #include "roc_sndio/isource.h"
 
@@ -57,11 +63,34 @@ public:
     bool valid() const;
 
     //! Create slot.
-    ReceiverSlot* create_slot();
+    //! @remarks
+    //!  @p slot_config overrides default session parameters for sessions
+    //!  of the slot.
+    ReceiverSlot*
+    create_slot(const ReceiverSlotConfig& slot_config = ReceiverSlotConfig());
 
     //! Get number of connected sessions.
     size_t num_sessions() const;
 
+    //! Wait until receiver becomes active.
+    //! @remarks
+    //!  Blocks while state() is DeviceState_Idle, until a packet arrives or
+    //!  @p timeout expires. Can be called from any thread.
+    //! @returns
+    //!  false if timeout expired and receiver is still idle.
+    bool wait_active(core::nanoseconds_t timeout);
+
+    //! Set handler for session events.
+    //! @remarks
+    //!  @p handler may be NULL. Can be called from any thread.
+    void set_event_handler(IReceiverEventHandler* handler);
+
+    //! Set store used to save and restore session state.
+    //! @remarks
+    //!  @p store may be NULL. Can be called from any thread. Sessions restore
+    //!  state when created and save it when removed.
+    void set_session_store(SessionStateStore* store);
+
     //! Get device type.
     virtual sndio::DeviceType type() const;
 
@@ -92,7 +121,22 @@ public:
     //! Read audio frame.
     virtual bool read(audio::Frame&);
 
+    //! Read next frame of every session separately, without mixing.
+    //! @remarks
+    //!  Advances receiver by @p n_samples, same as read(). Instead of mixing
+    //!  sessions, fills one element of @p frames per session, from all slots,
+    //!  and sets @p n_frames to the number of filled elements. Sessions that
+    //!  don't fit into @p max_frames elements are read and discarded.
+    //! @returns
+    //!  false if allocation failed.
+    bool read_sessions(ReceiverSessionFrame* frames,
+                       size_t max_frames,
+                       size_t& n_frames,
+                       size_t n_samples);
+
 private:
+    void advance_(size_t n_samples);
+
     const rtp::FormatMap& format_map_;
 
     packet::PacketFactory& packet_factory_;
@@ -101,9 +145,16 @@ private:
     core::IAllocator& allocator_;
 
     ReceiverState state_;
+
+    // should outlive sessions
+    core::Optional<fec::RepairPool> repair_pool_;
+
     core::List<ReceiverSlot> slots_;
 
+    core::Optional<ReceiverWorkerPool> worker_pool_;
+
     core::Optional<audio::Mixer> mixer_;
+    core::Optional<audio::StageTimingReader> mixer_timer_;
     core::Optional<audio::PoisonReader> poisoner_;
     core::Optional<audio::ProfilingReader> profiler_;
 
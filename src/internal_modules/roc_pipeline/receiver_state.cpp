@@ -14,7 +14,13 @@ namespace pipeline {
 
 ReceiverState::ReceiverState()
     : pending_packets_(0)
-    , sessions_(0) {
+    , sessions_(0)
+    , cpu_load_(0)
+    , last_session_id_(0)
+    , event_handler_(NULL)
+    , session_store_(NULL)
+    , wait_cond_(wait_mutex_)
+    , n_waiters_(0) {
 }
 
 bool ReceiverState::has_pending_packets() const {
@@ -24,6 +30,12 @@ bool ReceiverState::has_pending_packets() const {
 void ReceiverState::add_pending_packets(int increment) {
     const long result = pending_packets_ += increment;
     roc_panic_if(result < 0);
+
+    // lock is taken only when counter leaves zero and someone waits for it
+    if (increment > 0 && result == increment && n_waiters_ != 0) {
+        core::Mutex::Lock lock(wait_mutex_);
+        wait_cond_.broadcast();
+    }
 }
 
 size_t ReceiverState::num_sessions() const {
@@ -35,5 +47,78 @@ void ReceiverState::add_sessions(int increment) {
     roc_panic_if(result < 0);
 }
 
+float ReceiverState::cpu_load() const {
+    return (float)cpu_load_ / CpuLoadScale;
+}
+
+void ReceiverState::add_cpu_load(int increment) {
+    const long result = cpu_load_ += increment;
+    roc_panic_if(result < 0);
+}
+
+bool ReceiverState::wait_active(core::nanoseconds_t timeout) {
+    if (is_active_()) {
+        return true;
+    }
+
+    if (timeout <= 0) {
+        return false;
+    }
+
+    const core::nanoseconds_t deadline =
+        core::timestamp(core::ClockMonotonic) + timeout;
+
+    core::Mutex::Lock lock(wait_mutex_);
+
+    // counter is incremented before checking state, so that add_pending_packets()
+    // either sees the waiter or its increment is seen by us
+    n_waiters_++;
+
+    bool active = false;
+
+    for (;;) {
+        if ((active = is_active_())) {
+            break;
+        }
+
+        const core::nanoseconds_t remaining =
+            deadline - core::timestamp(core::ClockMonotonic);
+
+        if (remaining <= 0) {
+            break;
+        }
+
+        wait_cond_.timed_wait(remaining);
+    }
+
+    n_waiters_--;
+
+    return active;
+}
+
+bool ReceiverState::is_active_() const {
+    return sessions_ != 0 || pending_packets_ != 0;
+}
+
+size_t ReceiverState::next_session_id() {
+    return ++last_session_id_;
+}
+
+IReceiverEventHandler* ReceiverState::event_handler() const {
+    return event_handler_;
+}
+
+void ReceiverState::set_event_handler(IReceiverEventHandler* handler) {
+    event_handler_ = handler;
+}
+
+SessionStateStore* ReceiverState::session_store() const {
+    return session_store_;
+}
+
+void ReceiverState::set_session_store(SessionStateStore* store) {
+    session_store_ = store;
+}
+
 } // namespace pipeline
 } // namespace roc
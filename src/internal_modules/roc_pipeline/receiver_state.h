@@ -13,8 +13,13 @@
 #define ROC_PIPELINE_RECEIVER_STATE_H_
 
 #include "roc_core/atomic.h"
+#include "roc_core/cond.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_pipeline/ireceiver_event_handler.h"
+#include "roc_pipeline/session_state_store.h"
 
 namespace roc {
 namespace pipeline {
@@ -23,6 +28,9 @@ namespace pipeline {
 //! Thread-safe.
 class ReceiverState : public core::NonCopyable<> {
 public:
+    //! Fixed-point scale of CPU load counter.
+    enum { CpuLoadScale = 10000 };
+
     //! Initialize.
     ReceiverState();
 
@@ -38,9 +46,59 @@ public:
     //! Add given number to sessions counter.
     void add_sessions(int increment);
 
+    //! Get total CPU load of sessions of all slots.
+    //! @remarks
+    //!  Sum of smoothed loads of sessions, as published by session groups.
+    float cpu_load() const;
+
+    //! Add given number to total CPU load of sessions.
+    //! @remarks
+    //!  @p increment is in units of 1/CpuLoadScale.
+    void add_cpu_load(int increment);
+
+    //! Allocate identifier for new session.
+    //! @remarks
+    //!  Identifiers are unique within receiver and start from one.
+    size_t next_session_id();
+
+    //! Wait until there are sessions or pending packets.
+    //! @returns
+    //!  false if @p timeout expired and there are still no sessions and packets.
+    bool wait_active(core::nanoseconds_t timeout);
+
+    //! Get event handler.
+    //! @returns
+    //!  NULL if no handler is set.
+    IReceiverEventHandler* event_handler() const;
+
+    //! Set event handler.
+    //! @remarks
+    //!  @p handler may be NULL.
+    void set_event_handler(IReceiverEventHandler* handler);
+
+    //! Get session state store.
+    //! @returns
+    //!  NULL if no store is set.
+    SessionStateStore* session_store() const;
+
+    //! Set session state store.
+    //! @remarks
+    //!  @p store may be NULL.
+    void set_session_store(SessionStateStore* store);
+
 private:
+    bool is_active_() const;
+
     core::Atomic<int> pending_packets_;
     core::Atomic<int> sessions_;
+    core::Atomic<int> cpu_load_;
+    core::Atomic<size_t> last_session_id_;
+    core::Atomic<IReceiverEventHandler*> event_handler_;
+    core::Atomic<SessionStateStore*> session_store_;
+
+    core::Mutex wait_mutex_;
+    core::Cond wait_cond_;
+    core::Atomic<int> n_waiters_;
 };
 
 } // namespace pipeline
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/receiver_worker_pool.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/scoped_lock.h"
+
+namespace roc {
+namespace pipeline {
+
+ReceiverWorkerPool::Worker::Worker(ReceiverWorkerPool& pool,
+                                   const core::ThreadConfig& config)
+    : core::Thread(config)
+    , pool_(pool) {
+}
+
+ReceiverWorkerPool::Worker::~Worker() {
+}
+
+void ReceiverWorkerPool::Worker::run() {
+    pool_.worker_loop_();
+}
+
+ReceiverWorkerPool::ReceiverWorkerPool(size_t num_threads,
+                                       const core::ThreadConfig& thread_config,
+                                       core::IAllocator& allocator)
+    : allocator_(allocator)
+    , workers_(allocator)
+    , jobs_(allocator)
+    , work_cond_(mutex_)
+    , done_cond_(mutex_)
+    , n_jobs_(0)
+    , n_samples_(0)
+    , next_job_(0)
+    , generation_(0)
+    , n_active_(0)
+    , running_(false)
+    , stop_(false)
+    , valid_(false) {
+    roc_log(LogDebug, "receiver worker pool: initializing: num_threads=%lu",
+            (unsigned long)num_threads);
+
+    if (!workers_.grow(num_threads)) {
+        roc_log(LogError, "receiver worker pool: can't allocate workers");
+        return;
+    }
+
+    for (size_t n = 0; n < num_threads; n++) {
+        Worker* worker = new (allocator_) Worker(*this, thread_config);
+        if (!worker) {
+            roc_log(LogError, "receiver worker pool: can't allocate worker");
+            return;
+        }
+
+        workers_.push_back(worker);
+
+        if (!worker->start()) {
+            roc_log(LogError, "receiver worker pool: can't start worker thread");
+            return;
+        }
+    }
+
+    valid_ = true;
+}
+
+ReceiverWorkerPool::~ReceiverWorkerPool() {
+    stop_workers_();
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        allocator_.destroy_object(*workers_[n]);
+    }
+}
+
+bool ReceiverWorkerPool::valid() const {
+    return valid_;
+}
+
+size_t ReceiverWorkerPool::num_threads() const {
+    return workers_.size();
+}
+
+bool ReceiverWorkerPool::reserve(size_t num_readers) {
+    roc_panic_if(!valid_);
+
+    return jobs_.grow(num_readers);
+}
+
+bool ReceiverWorkerPool::schedule(audio::PrefetchReader& reader) {
+    roc_panic_if(!valid_);
+
+    if (!jobs_.grow_exp(jobs_.size() + 1)) {
+        return false;
+    }
+
+    jobs_.push_back(&reader);
+    return true;
+}
+
+void ReceiverWorkerPool::process(size_t num_samples) {
+    roc_panic_if(!valid_);
+
+    if (jobs_.size() == 0) {
+        return;
+    }
+
+    {
+        core::ScopedLock<core::Mutex> lock(mutex_);
+
+        n_jobs_ = jobs_.size();
+        n_samples_ = num_samples;
+        next_job_ = 0;
+
+        running_ = true;
+        generation_++;
+
+        work_cond_.broadcast();
+    }
+
+    // Calling thread processes jobs too, instead of sleeping.
+    run_jobs_();
+
+    {
+        core::ScopedLock<core::Mutex> lock(mutex_);
+
+        // All jobs are fetched at this point, wait until workers finish them.
+        while (n_active_ != 0) {
+            done_cond_.wait();
+        }
+
+        // Workers that didn't wake up in time will skip this generation.
+        running_ = false;
+    }
+
+    if (!jobs_.resize(0)) {
+        roc_panic("receiver worker pool: can't resize array");
+    }
+}
+
+void ReceiverWorkerPool::worker_loop_() {
+    roc_log(LogDebug, "receiver worker pool: starting worker thread");
+
+    unsigned seen_generation = 0;
+
+    mutex_.lock();
+
+    for (;;) {
+        while (!stop_ && (!running_ || generation_ == seen_generation)) {
+            work_cond_.wait();
+        }
+
+        if (stop_) {
+            break;
+        }
+
+        seen_generation = generation_;
+        n_active_++;
+
+        mutex_.unlock();
+        run_jobs_();
+        mutex_.lock();
+
+        if (--n_active_ == 0) {
+            done_cond_.signal();
+        }
+    }
+
+    mutex_.unlock();
+
+    roc_log(LogDebug, "receiver worker pool: finishing worker thread");
+}
+
+void ReceiverWorkerPool::run_jobs_() {
+    for (;;) {
+        const size_t n = next_job_++;
+        if (n >= n_jobs_) {
+            break;
+        }
+
+        jobs_[n]->prefetch(n_samples_);
+    }
+}
+
+void ReceiverWorkerPool::stop_workers_() {
+    {
+        core::ScopedLock<core::Mutex> lock(mutex_);
+
+        stop_ = true;
+        work_cond_.broadcast();
+    }
+
+    for (size_t n = 0; n < workers_.size(); n++) {
+        if (workers_[n]->joinable()) {
+            workers_[n]->join();
+        }
+    }
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/receiver_worker_pool.h
+//! @brief Receiver worker pool.
+
+#ifndef ROC_PIPELINE_RECEIVER_WORKER_POOL_H_
+#define ROC_PIPELINE_RECEIVER_WORKER_POOL_H_
+
+#include "roc_audio/prefetch_reader.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Receiver worker pool.
+//!
+//! Runs session sub-pipelines in parallel on a pool of threads. On every
+//! pipeline tick, sessions are scheduled, and then process() prefetches
+//! next frame of every session into session's own buffer, using worker
+//! threads and the calling thread. When process() returns, the mixer can
+//! read and join prefetched frames without blocking.
+//!
+//! Scheduling and processing is not thread-safe and should be done from
+//! the pipeline thread.
+class ReceiverWorkerPool : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Starts @p num_threads background threads with scheduling parameters
+    //!  from @p thread_config.
+    ReceiverWorkerPool(size_t num_threads,
+                       const core::ThreadConfig& thread_config,
+                       core::IAllocator& allocator);
+
+    //! Destroy.
+    //! @remarks
+    //!  Stops and joins background threads.
+    ~ReceiverWorkerPool();
+
+    //! Check if the pool was successfully constructed.
+    bool valid() const;
+
+    //! Get number of background threads.
+    size_t num_threads() const;
+
+    //! Preallocate space for @p num_readers scheduled readers.
+    //! @returns
+    //!  false if allocation failed.
+    bool reserve(size_t num_readers);
+
+    //! Schedule reader to be prefetched by next process() call.
+    //! @returns
+    //!  false if allocation failed; can't happen if no more readers are
+    //!  scheduled than were reserved.
+    bool schedule(audio::PrefetchReader& reader);
+
+    //! Prefetch @p num_samples for every scheduled reader.
+    //! @remarks
+    //!  Blocks until all scheduled readers are prefetched, and then clears
+    //!  the list of scheduled readers.
+    void process(size_t num_samples);
+
+private:
+    class Worker : public core::Thread {
+    public:
+        Worker(ReceiverWorkerPool& pool, const core::ThreadConfig& config);
+
+        virtual ~Worker();
+
+    private:
+        virtual void run();
+
+        ReceiverWorkerPool& pool_;
+    };
+
+    void worker_loop_();
+    void run_jobs_();
+
+    void stop_workers_();
+
+    core::IAllocator& allocator_;
+
+    core::Array<Worker*> workers_;
+    core::Array<audio::PrefetchReader*> jobs_;
+
+    core::Mutex mutex_;
+    core::Cond work_cond_;
+    core::Cond done_cond_;
+
+    size_t n_jobs_;
+    size_t n_samples_;
+    core::Atomic<size_t> next_job_;
+
+    unsigned generation_;
+    size_t n_active_;
+    bool running_;
+    bool stop_;
+
+    bool valid_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_RECEIVER_WORKER_POOL_H_
@@ -9,15 +9,31 @@
 #include "roc_pipeline/sender_endpoint.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/time.h"
 #include "roc_fec/composer.h"
 #include "roc_fec/headers.h"
 
+#ifdef ROC_TARGET_OPENSSL
+#include "roc_rtp/srtp_composer.h"
+#endif // ROC_TARGET_OPENSSL
+
 namespace roc {
 namespace pipeline {
 
-SenderEndpoint::SenderEndpoint(address::Protocol proto, core::IAllocator& allocator)
+SenderEndpoint::SenderEndpoint(address::Protocol proto,
+                               const SenderConfig& config,
+                               packet::PacketFactory& packet_factory,
+                               core::BufferFactory<uint8_t>& byte_buffer_factory,
+                               core::IAllocator& allocator)
     : proto_(proto)
     , dst_writer_(NULL)
+    , packet_factory_(packet_factory)
+    , byte_buffer_factory_(byte_buffer_factory)
+    , allocator_(allocator)
+    , impairer_config_(config.impairment)
+    , multiplexed_packet_size_(proto == address::Proto_RTCP
+                                   ? 0
+                                   : config.multiplexed_packet_size)
     , composer_(NULL) {
     packet::IComposer* composer = NULL;
 
@@ -25,7 +41,9 @@ SenderEndpoint::SenderEndpoint(address::Protocol proto, core::IAllocator& alloca
     case address::Proto_RTP:
     case address::Proto_RTP_LDPC_Source:
     case address::Proto_RTP_RS8M_Source:
-        rtp_composer_.reset(new (rtp_composer_) rtp::Composer(NULL));
+    case address::Proto_RTP_RLC_Source:
+        rtp_composer_.reset(new (rtp_composer_)
+                                rtp::Composer(NULL, config.capture_timestamps));
         if (!rtp_composer_) {
             return;
         }
@@ -78,6 +96,28 @@ SenderEndpoint::SenderEndpoint(address::Protocol proto, core::IAllocator& alloca
         }
         composer = fec_composer_.get();
         break;
+    case address::Proto_RTP_RLC_Source:
+        fec_composer_.reset(
+            new (allocator)
+                fec::Composer<fec::RLC_Source_PayloadID, fec::Source, fec::Footer>(
+                    composer),
+            allocator);
+        if (!fec_composer_) {
+            return;
+        }
+        composer = fec_composer_.get();
+        break;
+    case address::Proto_RLC_Repair:
+        fec_composer_.reset(
+            new (allocator)
+                fec::Composer<fec::RLC_Repair_PayloadID, fec::Repair, fec::Header>(
+                    composer),
+            allocator);
+        if (!fec_composer_) {
+            return;
+        }
+        composer = fec_composer_.get();
+        break;
     default:
         break;
     }
@@ -94,6 +134,38 @@ SenderEndpoint::SenderEndpoint(address::Protocol proto, core::IAllocator& alloca
         break;
     }
 
+    if (config.srtp.enabled) {
+        // fec encoder uses source packets after they are composed,
+        // so they can't be encrypted in place
+        if (proto != address::Proto_RTP && proto != address::Proto_RTCP) {
+            roc_log(LogError,
+                    "sender endpoint: srtp is supported only for rtp and rtcp: proto=%s",
+                    address::proto_to_str(proto));
+            return;
+        }
+
+#ifdef ROC_TARGET_OPENSSL
+        rtp::SrtpComposer* srtp_composer = new (allocator) rtp::SrtpComposer(
+            config.srtp,
+            proto == address::Proto_RTCP ? rtp::SrtpProto_RTCP : rtp::SrtpProto_RTP,
+            *composer);
+        srtp_composer_.reset(srtp_composer, allocator);
+        if (!srtp_composer_ || !srtp_composer->valid()) {
+            return;
+        }
+        composer = srtp_composer_.get();
+#else
+        roc_log(LogError,
+                "sender endpoint: srtp is not supported (built without openssl)");
+        return;
+#endif // ROC_TARGET_OPENSSL
+    }
+
+    if (impairer_config_.enabled() && !impairer_config_.valid()) {
+        roc_log(LogError, "sender endpoint: invalid impairment config");
+        return;
+    }
+
     composer_ = composer;
 }
 
@@ -132,7 +204,29 @@ void SenderEndpoint::set_destination_writer(packet::IWriter& writer) {
         roc_panic("sender endpoint: attempt to set destination writer twice");
     }
 
-    dst_writer_ = &writer;
+    packet::IWriter* out_writer = &writer;
+
+    // impairer goes after fanout, so that every destination is impaired
+    // independently, as it would be in the network
+    if (impairer_config_.enabled()) {
+        impairer_.reset(new (impairer_) packet::Impairer(
+            *out_writer, packet_factory_, allocator_, impairer_config_));
+        roc_panic_if_not(impairer_->valid());
+        out_writer = impairer_.get();
+    }
+
+    // fanout goes after multiplexer, so that every destination gets the
+    // same datagrams
+    fanout_.reset(new (fanout_)
+                      packet::Fanout(*out_writer, packet_factory_, allocator_));
+
+    if (multiplexed_packet_size_ != 0) {
+        multiplexer_.reset(new (multiplexer_) packet::Multiplexer(
+            *fanout_, packet_factory_, byte_buffer_factory_, multiplexed_packet_size_));
+        dst_writer_ = multiplexer_.get();
+    } else {
+        dst_writer_ = fanout_.get();
+    }
 }
 
 void SenderEndpoint::set_destination_address(const address::SocketAddr& addr) {
@@ -145,6 +239,29 @@ void SenderEndpoint::set_destination_address(const address::SocketAddr& addr) {
     dst_address_ = addr;
 }
 
+bool SenderEndpoint::add_destination_address(const address::SocketAddr& addr) {
+    roc_panic_if(!valid());
+
+    if (!dst_address_.has_host_port() || !fanout_) {
+        roc_panic("sender endpoint: attempt to add destination address"
+                  " before setting destination address and writer");
+    }
+
+    return fanout_->add_destination(addr);
+}
+
+void SenderEndpoint::flush() {
+    roc_panic_if(!valid());
+
+    if (impairer_) {
+        impairer_->advance(core::timestamp(core::ClockMonotonic));
+    }
+
+    if (multiplexer_) {
+        multiplexer_->flush();
+    }
+}
+
 void SenderEndpoint::write(const packet::PacketPtr& packet) {
     roc_panic_if(!valid());
 
@@ -164,6 +281,10 @@ void SenderEndpoint::write(const packet::PacketPtr& packet) {
         packet->add_flags(packet::Packet::FlagComposed);
     }
 
+    if (impairer_) {
+        impairer_->advance(core::timestamp(core::ClockMonotonic));
+    }
+
     dst_writer_->write(packet);
 }
 
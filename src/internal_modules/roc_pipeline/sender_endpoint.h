@@ -12,13 +12,18 @@
 #ifndef ROC_PIPELINE_SENDER_ENDPOINT_H_
 #define ROC_PIPELINE_SENDER_ENDPOINT_H_
 
+#include "roc_core/buffer_factory.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/optional.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_packet/fanout.h"
 #include "roc_packet/icomposer.h"
+#include "roc_packet/impairer.h"
 #include "roc_packet/iwriter.h"
+#include "roc_packet/multiplexer.h"
+#include "roc_packet/packet_factory.h"
 #include "roc_pipeline/config.h"
 #include "roc_rtcp/composer.h"
 #include "roc_rtp/composer.h"
@@ -33,7 +38,11 @@ namespace pipeline {
 class SenderEndpoint : public core::NonCopyable<>, private packet::IWriter {
 public:
     //! Initialize.
-    SenderEndpoint(address::Protocol proto, core::IAllocator& allocator);
+    SenderEndpoint(address::Protocol proto,
+                   const SenderConfig& config,
+                   packet::PacketFactory& packet_factory,
+                   core::BufferFactory<uint8_t>& byte_buffer_factory,
+                   core::IAllocator& allocator);
 
     //! Check if pipeline was succefully constructed.
     bool valid() const;
@@ -68,6 +77,25 @@ public:
     //!  the specified destination address.
     void set_destination_address(const address::SocketAddr&);
 
+    //! Add one more destination address.
+    //! @remarks
+    //!  Packets are composed once and then sent to every destination address,
+    //!  sharing the same data buffer. All destinations use the same
+    //!  destination writer, i.e. the same network port.
+    //! @pre
+    //!  Should be called after set_destination_address() and
+    //!  set_destination_writer().
+    //! @returns
+    //!  false if allocation failed.
+    bool add_destination_address(const address::SocketAddr&);
+
+    //! Write pending packets.
+    //! @remarks
+    //!  If multiplexing is enabled, writes current multiplexed datagram
+    //!  to the destination writer. If impairment is enabled, writes delayed
+    //!  packets which are due.
+    void flush();
+
 private:
     virtual void write(const packet::PacketPtr& packet);
 
@@ -76,11 +104,24 @@ private:
     packet::IWriter* dst_writer_;
     address::SocketAddr dst_address_;
 
+    packet::PacketFactory& packet_factory_;
+    core::BufferFactory<uint8_t>& byte_buffer_factory_;
+    core::IAllocator& allocator_;
+
+    const packet::ImpairerConfig impairer_config_;
+    core::Optional<packet::Impairer> impairer_;
+
+    core::Optional<packet::Fanout> fanout_;
+
+    const size_t multiplexed_packet_size_;
+    core::Optional<packet::Multiplexer> multiplexer_;
+
     packet::IComposer* composer_;
 
     core::Optional<rtp::Composer> rtp_composer_;
     core::ScopedPtr<packet::IComposer> fec_composer_;
     core::Optional<rtcp::Composer> rtcp_composer_;
+    core::ScopedPtr<packet::IComposer> srtp_composer_;
 };
 
 } // namespace pipeline
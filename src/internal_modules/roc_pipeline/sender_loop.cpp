@@ -8,6 +8,7 @@
 
 #include "roc_pipeline/sender_loop.h"
 #include "roc_audio/resampler_map.h"
+#include "roc_core/fast_clock.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 
@@ -20,7 +21,8 @@ SenderLoop::Task::Task()
     , endpoint_(NULL)
     , iface_(address::Iface_Invalid)
     , proto_(address::Proto_None)
-    , writer_(NULL) {
+    , writer_(NULL)
+    , max_packet_size_(0) {
 }
 
 SenderLoop::Tasks::CreateSlot::CreateSlot() {
@@ -75,6 +77,26 @@ SenderLoop::Tasks::SetEndpointDestinationAddress::SetEndpointDestinationAddress(
     addr_ = addr;
 }
 
+SenderLoop::Tasks::AddEndpointDestinationAddress::AddEndpointDestinationAddress(
+    EndpointHandle endpoint, const address::SocketAddr& addr) {
+    func_ = &SenderLoop::task_add_endpoint_destination_address_;
+    if (!endpoint) {
+        roc_panic("sender sink: endpoint handle is null");
+    }
+    endpoint_ = (SenderEndpoint*)endpoint;
+    addr_ = addr;
+}
+
+SenderLoop::Tasks::SetSlotMaxPacketSize::SetSlotMaxPacketSize(SlotHandle slot,
+                                                               size_t max_packet_size) {
+    func_ = &SenderLoop::task_set_slot_max_packet_size_;
+    if (!slot) {
+        roc_panic("sender sink: slot handle is null");
+    }
+    slot_ = (SenderSlot*)slot;
+    max_packet_size_ = max_packet_size;
+}
+
 SenderLoop::Tasks::CheckSlotIsReady::CheckSlotIsReady(SlotHandle slot) {
     func_ = &SenderLoop::task_check_slot_is_ready_;
     if (!slot) {
@@ -89,14 +111,18 @@ SenderLoop::SenderLoop(IPipelineTaskScheduler& scheduler,
                        packet::PacketFactory& packet_factory,
                        core::BufferFactory<uint8_t>& byte_buffer_factory,
                        core::BufferFactory<audio::sample_t>& sample_buffer_factory,
-                       core::IAllocator& allocator)
+                       core::IAllocator& allocator,
+                       ClockDomain* clock_domain,
+                       fec::BatchEncoder* batch_encoder)
     : PipelineLoop(scheduler, config.tasks, config.input_sample_spec)
     , sink_(config,
             format_map,
             packet_factory,
             byte_buffer_factory,
             sample_buffer_factory,
-            allocator)
+            allocator,
+            batch_encoder)
+    , clock_domain_(clock_domain)
     , timestamp_(0)
     , valid_(false) {
     if (!sink_.valid()) {
@@ -123,6 +149,18 @@ sndio::ISink& SenderLoop::sink() {
     return *this;
 }
 
+void SenderLoop::get_metrics(SlotHandle slot, SenderSlotMetrics& metrics) const {
+    roc_panic_if_not(valid());
+
+    if (!slot) {
+        roc_panic("sender sink: slot handle is null");
+    }
+
+    ((const SenderSlot*)slot)->get_metrics(metrics);
+
+    get_pipeline_metrics(metrics.pipeline);
+}
+
 sndio::DeviceType SenderLoop::type() const {
     roc_panic_if(!valid());
 
@@ -192,12 +230,13 @@ void SenderLoop::write(audio::Frame& frame) {
 
     core::Mutex::Lock lock(sink_mutex_);
 
+    core::nanoseconds_t wakeup_delay = 0;
     if (ticker_) {
-        ticker_->wait(timestamp_);
+        wakeup_delay = wait_ticker_(frame);
     }
 
     // Invokes process_subframe_imp() and process_task_imp().
-    if (!process_subframes_and_tasks(frame)) {
+    if (!process_subframes_and_tasks(frame, wakeup_delay)) {
         return;
     }
 
@@ -205,8 +244,69 @@ void SenderLoop::write(audio::Frame& frame) {
         packet::timestamp_t(frame.num_samples() / sink_.sample_spec().num_channels());
 }
 
+void SenderLoop::write_frames(audio::sample_t* const* frames,
+                              size_t n_frames,
+                              size_t frame_size) {
+    roc_panic_if_not(valid());
+
+    roc_panic_if_not(frames || n_frames == 0);
+
+    core::Mutex::Lock lock(sink_mutex_);
+
+    const size_t num_channels = sink_.sample_spec().num_channels();
+
+    if (ticker_) {
+        // Every frame has its own deadline, so frames are processed one by one.
+        for (size_t n = 0; n < n_frames; n++) {
+            audio::Frame frame(frames[n], frame_size);
+
+            const core::nanoseconds_t wakeup_delay = wait_ticker_(frame);
+
+            if (!process_subframes_and_tasks(frame, wakeup_delay)) {
+                return;
+            }
+
+            timestamp_ += packet::timestamp_t(frame_size / num_channels);
+        }
+        return;
+    }
+
+    size_t n_processed = 0;
+
+    // Invokes process_subframe_imp() and process_task_imp().
+    process_frames_and_tasks(frames, n_frames, frame_size, n_processed);
+
+    timestamp_ += packet::timestamp_t(frame_size / num_channels * n_processed);
+}
+
+core::nanoseconds_t SenderLoop::write_delay() {
+    roc_panic_if_not(valid());
+
+    core::Mutex::Lock lock(sink_mutex_);
+
+    if (!ticker_) {
+        return 0;
+    }
+
+    return ticker_->remaining(timestamp_);
+}
+
+core::nanoseconds_t SenderLoop::wait_ticker_(const audio::Frame& frame) {
+    if (clock_domain_ && !ticker_->started()) {
+        const audio::SampleSpec& sample_spec = sink_.sample_spec();
+
+        const core::nanoseconds_t frame_length = sample_spec.samples_overall_2_ns(
+            frame.num_samples() ? frame.num_samples() : sample_spec.num_channels());
+
+        ticker_->start_at(
+            clock_domain_->join(core::timestamp(core::ClockMonotonic), frame_length));
+    }
+
+    return ticker_->wait(timestamp_);
+}
+
 core::nanoseconds_t SenderLoop::timestamp_imp() const {
-    return core::timestamp(core::ClockMonotonic);
+    return core::fast_timestamp();
 }
 
 bool SenderLoop::process_subframe_imp(audio::Frame& frame) {
@@ -253,6 +353,18 @@ bool SenderLoop::task_set_endpoint_destination_address_(Task& task) {
     return true;
 }
 
+bool SenderLoop::task_add_endpoint_destination_address_(Task& task) {
+    roc_panic_if(!task.endpoint_);
+
+    return task.endpoint_->add_destination_address(task.addr_);
+}
+
+bool SenderLoop::task_set_slot_max_packet_size_(Task& task) {
+    roc_panic_if(!task.slot_);
+
+    return task.slot_->set_max_packet_size(task.max_packet_size_);
+}
+
 bool SenderLoop::task_check_slot_is_ready_(Task& task) {
     roc_panic_if(!task.slot_);
 
@@ -16,7 +16,9 @@
 #include "roc_core/iallocator.h"
 #include "roc_core/mutex.h"
 #include "roc_core/ticker.h"
+#include "roc_pipeline/clock_domain.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/metrics.h"
 #include "roc_pipeline/pipeline_loop.h"
 #include "roc_pipeline/sender_sink.h"
 #include "roc_sndio/isink.h"
@@ -63,6 +65,7 @@ public:
         address::Protocol proto_;  //!< Protocol.
         packet::IWriter* writer_;  //!< Packet writer.
         address::SocketAddr addr_; //!< Endpoint address.
+        size_t max_packet_size_;   //!< Maximum packet size.
     };
 
     //! Subclasses for specific tasks.
@@ -109,6 +112,23 @@ public:
                                           const address::SocketAddr& addr);
         };
 
+        //! Add one more UDP address for output packets of endpoint.
+        //! Packets are composed once and sent to all addresses.
+        class AddEndpointDestinationAddress : public Task {
+        public:
+            //! Set task parameters.
+            AddEndpointDestinationAddress(EndpointHandle endpoint,
+                                          const address::SocketAddr& addr);
+        };
+
+        //! Set maximum size of packet that can be sent without fragmentation.
+        //! Packet length is tuned so that packets fit this size.
+        class SetSlotMaxPacketSize : public Task {
+        public:
+            //! Set task parameters.
+            SetSlotMaxPacketSize(SlotHandle slot, size_t max_packet_size);
+        };
+
         //! Check if the slot configuration is done.
         //! This is true when all necessary endpoints are added and configured.
         class CheckSlotIsReady : public Task {
@@ -119,13 +139,20 @@ public:
     };
 
     //! Initialize.
+    //! @remarks
+    //!  If @p clock_domain is non-NULL and timing is enabled, the pipeline aligns its
+    //!  timing to other pipelines of the same domain.
+    //!  If @p batch_encoder is non-NULL, it's used to encode Reed-Solomon repair
+    //!  packets together with other pipelines.
     SenderLoop(IPipelineTaskScheduler& scheduler,
                const SenderConfig& config,
                const rtp::FormatMap& format_map,
                packet::PacketFactory& packet_factory,
                core::BufferFactory<uint8_t>& byte_buffer_factory,
                core::BufferFactory<audio::sample_t>& sample_buffer_factory,
-               core::IAllocator& allocator);
+               core::IAllocator& allocator,
+               ClockDomain* clock_domain = NULL,
+               fec::BatchEncoder* batch_encoder = NULL);
 
     //! Check if the pipeline was successfully constructed.
     bool valid() const;
@@ -135,6 +162,28 @@ public:
     //!  Samples written to the sink are sent to remote peers.
     sndio::ISink& sink();
 
+    //! Get metrics of given slot.
+    //! @remarks
+    //!  Can be called from any thread. Doesn't schedule a task and doesn't wait
+    //!  for the pipeline; returns metrics published during last update.
+    void get_metrics(SlotHandle slot, SenderSlotMetrics& metrics) const;
+
+    //! Get time left until next frame can be written without blocking.
+    //! @remarks
+    //!  Returns zero if timing is disabled or the next frame is already due.
+    //!  Should be called from the same thread that writes frames.
+    core::nanoseconds_t write_delay();
+
+    //! Write multiple frames at once.
+    //! @remarks
+    //!  @p frames is an array of @p n_frames pointers to buffers of @p frame_size
+    //!  samples each. Same as writing frames to sink() one by one, but if timing
+    //!  is disabled, all frames are processed during a single pipeline loop entry.
+    //!  Useful when writing faster than real time.
+    void write_frames(audio::sample_t* const* frames,
+                      size_t n_frames,
+                      size_t frame_size);
+
 private:
     // Methods of sndio::ISink
     virtual sndio::DeviceType type() const;
@@ -157,10 +206,15 @@ private:
     bool task_create_endpoint_(Task&);
     bool task_set_endpoint_destination_writer_(Task&);
     bool task_set_endpoint_destination_address_(Task&);
+    bool task_add_endpoint_destination_address_(Task&);
+    bool task_set_slot_max_packet_size_(Task&);
     bool task_check_slot_is_ready_(Task&);
 
     SenderSink sink_;
 
+    core::nanoseconds_t wait_ticker_(const audio::Frame& frame);
+
+    ClockDomain* clock_domain_;
     core::Optional<core::Ticker> ticker_;
     packet::timestamp_t timestamp_;
 
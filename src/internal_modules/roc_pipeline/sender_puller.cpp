@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/sender_puller.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+SenderPuller::SenderPuller(SenderLoop& loop,
+                           IFrameCallback& callback,
+                           core::nanoseconds_t frame_length,
+                           core::IAllocator& allocator)
+    : loop_(loop)
+    , callback_(callback)
+    , frame_buf_(allocator)
+    , stop_(false)
+    , running_(false)
+    , valid_(false) {
+    const size_t frame_size =
+        loop_.sink().sample_spec().ns_2_samples_overall(frame_length);
+
+    roc_log(LogDebug, "sender puller: initializing: frame_size=%lu",
+            (unsigned long)frame_size);
+
+    if (frame_size == 0) {
+        roc_log(LogError, "sender puller: frame length is too small");
+        return;
+    }
+
+    if (!frame_buf_.resize(frame_size)) {
+        roc_log(LogError, "sender puller: can't allocate frame buffer");
+        return;
+    }
+
+    running_ = true;
+
+    if (!core::Thread::start()) {
+        roc_log(LogError, "sender puller: can't start thread");
+        running_ = false;
+        return;
+    }
+
+    valid_ = true;
+}
+
+SenderPuller::~SenderPuller() {
+    if (core::Thread::joinable()) {
+        stop_ = true;
+        core::Thread::join();
+    }
+}
+
+bool SenderPuller::valid() const {
+    return valid_;
+}
+
+bool SenderPuller::running() const {
+    return running_;
+}
+
+void SenderPuller::run() {
+    roc_log(LogDebug, "sender puller: starting thread");
+
+    while (!stop_) {
+        // Wait for the frame boundary before obtaining samples, so that
+        // write() below doesn't need to wait and samples are as fresh as possible.
+        const core::nanoseconds_t delay = loop_.write_delay();
+        if (delay > 0) {
+            core::sleep_for(core::ClockMonotonic, delay);
+            continue;
+        }
+
+        memset(frame_buf_.data(), 0, frame_buf_.size() * sizeof(audio::sample_t));
+
+        audio::Frame frame(frame_buf_.data(), frame_buf_.size());
+
+        if (!callback_.fill_frame(frame)) {
+            roc_log(LogDebug, "sender puller: callback requested stop");
+            break;
+        }
+
+        loop_.sink().write(frame);
+    }
+
+    running_ = false;
+
+    roc_log(LogDebug, "sender puller: exiting thread");
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/sender_puller.h
+//! @brief Sender puller.
+
+#ifndef ROC_PIPELINE_SENDER_PULLER_H_
+#define ROC_PIPELINE_SENDER_PULLER_H_
+
+#include "roc_audio/sample.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+#include "roc_pipeline/iframe_callback.h"
+#include "roc_pipeline/sender_loop.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Sender puller.
+//!
+//! Runs a thread which pulls frames from a callback and writes them to the
+//! sender pipeline, paced by the pipeline clock.
+//!
+//! The thread first waits until the next frame is due, then invokes the
+//! callback, and then writes the frame, so that samples are obtained exactly at
+//! the frame boundary and are not buffered before the pipeline.
+class SenderPuller : public core::NonCopyable<>, private core::Thread {
+public:
+    //! Initialize and start thread.
+    //! @remarks
+    //!  Frames of @p frame_length are obtained from @p callback and written to
+    //!  @p loop. The pipeline should have timing enabled.
+    SenderPuller(SenderLoop& loop,
+                 IFrameCallback& callback,
+                 core::nanoseconds_t frame_length,
+                 core::IAllocator& allocator);
+
+    //! Stop thread.
+    ~SenderPuller();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Check if the thread is still pulling frames.
+    //! @remarks
+    //!  Becomes false when callback asks to stop.
+    bool running() const;
+
+private:
+    virtual void run();
+
+    SenderLoop& loop_;
+    IFrameCallback& callback_;
+
+    core::Array<audio::sample_t> frame_buf_;
+
+    core::Atomic<int> stop_;
+    core::Atomic<int> running_;
+
+    bool valid_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_SENDER_PULLER_H_
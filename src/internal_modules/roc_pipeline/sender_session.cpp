@@ -19,6 +19,7 @@ SenderSession::SenderSession(const SenderConfig& config,
                              packet::PacketFactory& packet_factory,
                              core::BufferFactory<uint8_t>& byte_buffer_factory,
                              core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+                             fec::BatchEncoder* batch_encoder,
                              core::IAllocator& allocator)
     : allocator_(allocator)
     , config_(config)
@@ -26,7 +27,10 @@ SenderSession::SenderSession(const SenderConfig& config,
     , packet_factory_(packet_factory)
     , byte_buffer_factory_(byte_buffer_factory)
     , sample_buffer_factory_(sample_buffer_factory)
+    , batch_encoder_(batch_encoder)
     , audio_writer_(NULL)
+    , pending_packet_length_(0)
+    , max_packet_size_(0)
     , num_sources_(0) {
 }
 
@@ -48,6 +52,24 @@ bool SenderSession::create_transport_pipeline(SenderEndpoint* source_endpoint,
         return false;
     }
 
+    if (config_.match_input_rate
+        && format->sample_spec.sample_rate() != config_.input_sample_spec.sample_rate()) {
+        const rtp::Format* matched_format = format_map_.find_pcm_format(
+            format->pcm_format,
+            audio::SampleSpec(config_.input_sample_spec.sample_rate(),
+                              format->sample_spec.channel_mask()));
+        if (matched_format) {
+            roc_log(LogDebug,
+                    "sender session: using format matching input rate: pt=%u rate=%lu",
+                    (unsigned)matched_format->payload_type,
+                    (unsigned long)matched_format->sample_spec.sample_rate());
+            format = matched_format;
+        } else {
+            roc_log(LogDebug, "sender session: no format matching input rate: rate=%lu",
+                    (unsigned long)config_.input_sample_spec.sample_rate());
+        }
+    }
+
     router_.reset(new (router_) packet::Router(allocator_));
     if (!router_) {
         return false;
@@ -64,48 +86,104 @@ bool SenderSession::create_transport_pipeline(SenderEndpoint* source_endpoint,
         }
 
         if (config_.interleaving) {
+            size_t max_delay = 0;
+            if (config_.interleaving_max_delay > 0 && config_.packet_length > 0) {
+                max_delay = std::max(
+                    (size_t)(config_.interleaving_max_delay / config_.packet_length),
+                    (size_t)1);
+            }
+
             interleaver_.reset(new (interleaver_) packet::Interleaver(
                 *pwriter, allocator_,
-                config_.fec_writer.n_source_packets
-                    + config_.fec_writer.n_repair_packets));
+                config_.fec_writer.n_source_packets + config_.fec_writer.n_repair_packets,
+                max_delay));
             if (!interleaver_ || !interleaver_->valid()) {
                 return false;
             }
             pwriter = interleaver_.get();
         }
 
-        fec_encoder_.reset(fec::CodecMap::instance().new_encoder(
-                               config_.fec_encoder, byte_buffer_factory_, allocator_),
-                           allocator_);
-        if (!fec_encoder_) {
-            return false;
+        if (config_.fec_encoder.scheme == packet::FEC_RLC) {
+            rlc_writer_.reset(new (rlc_writer_) fec::RlcWriter(
+                config_.fec_writer, *pwriter, source_endpoint->composer(),
+                repair_endpoint->composer(), packet_factory_, byte_buffer_factory_,
+                allocator_));
+            if (!rlc_writer_ || !rlc_writer_->valid()) {
+                return false;
+            }
+            pwriter = rlc_writer_.get();
+        } else {
+            fec_encoder_.reset(fec::CodecMap::instance().new_encoder(
+                                   config_.fec_encoder, byte_buffer_factory_, allocator_),
+                               allocator_);
+            if (!fec_encoder_) {
+                return false;
+            }
+
+            // batching is implemented only for built-in Reed-Solomon codec
+            fec::BatchEncoder* batch_encoder =
+                config_.fec_encoder.scheme == packet::FEC_ReedSolomon_M8 ? batch_encoder_
+                                                                         : NULL;
+
+            fec_writer_.reset(new (fec_writer_) fec::Writer(
+                config_.fec_writer, config_.fec_encoder.scheme, *fec_encoder_, *pwriter,
+                source_endpoint->composer(), repair_endpoint->composer(),
+                packet_factory_, byte_buffer_factory_, allocator_, batch_encoder));
+            if (!fec_writer_ || !fec_writer_->valid()) {
+                return false;
+            }
+            pwriter = fec_writer_.get();
         }
 
-        fec_writer_.reset(new (fec_writer_) fec::Writer(
-            config_.fec_writer, config_.fec_encoder.scheme, *fec_encoder_, *pwriter,
-            source_endpoint->composer(), repair_endpoint->composer(), packet_factory_,
-            byte_buffer_factory_, allocator_));
-        if (!fec_writer_ || !fec_writer_->valid()) {
-            return false;
+        if (config_.fec_block_sizing.enabled && fec_writer_) {
+            fec_block_sizer_.reset(new (fec_block_sizer_) fec::BlockSizeController(
+                config_.fec_block_sizing, config_.fec_writer,
+                fec_encoder_->max_block_length()));
+            if (!fec_block_sizer_) {
+                return false;
+            }
         }
-        pwriter = fec_writer_.get();
     }
 
-    payload_encoder_.reset(format->new_encoder(allocator_), allocator_);
+    payload_encoder_.reset(format->new_encoder(allocator_, *format), allocator_);
     if (!payload_encoder_) {
         return false;
     }
 
+    if (fec_writer_) {
+        // intercept packets to change packet length only at block boundary
+        pwriter = this;
+    }
+
     packetizer_.reset(new (packetizer_) audio::Packetizer(
         *pwriter, source_endpoint->composer(), *payload_encoder_, packet_factory_,
         byte_buffer_factory_, config_.packet_length, format->sample_spec,
-        config_.payload_type));
+        format->payload_type, config_.dtx));
     if (!packetizer_ || !packetizer_->valid()) {
         return false;
     }
 
+    if (max_packet_size_ != 0) {
+        const core::nanoseconds_t packet_length = fit_packet_length_();
+        if (packet_length != 0) {
+            packetizer_->set_packet_length(packet_length);
+        } else {
+            roc_log(LogError,
+                    "sender session: no packet length fits max packet size,"
+                    " keeping configured length: max_size=%lu",
+                    (unsigned long)max_packet_size_);
+        }
+    }
+
     audio::IFrameWriter* awriter = packetizer_.get();
 
+    packetizer_timer_.reset(new (packetizer_timer_) audio::StageTimingWriter(
+        *awriter, "packetizer", format->sample_spec));
+    if (!packetizer_timer_) {
+        return false;
+    }
+    awriter = packetizer_timer_.get();
+
     if (format->sample_spec.channel_mask() != config_.input_sample_spec.channel_mask()) {
         channel_mapper_writer_.reset(
             new (channel_mapper_writer_) audio::ChannelMapperWriter(
@@ -150,6 +228,13 @@ bool SenderSession::create_transport_pipeline(SenderEndpoint* source_endpoint,
             return false;
         }
         awriter = resampler_writer_.get();
+
+        resampler_timer_.reset(new (resampler_timer_) audio::StageTimingWriter(
+            *awriter, "resampler", config_.input_sample_spec));
+        if (!resampler_timer_) {
+            return false;
+        }
+        awriter = resampler_timer_.get();
     }
 
     audio_writer_ = awriter;
@@ -161,14 +246,10 @@ bool SenderSession::create_control_pipeline(SenderEndpoint* control_endpoint) {
     roc_panic_if(rtcp_session_);
     roc_panic_if(!control_endpoint);
 
-    rtcp_composer_.reset(new (rtcp_composer_) rtcp::Composer());
-    if (!rtcp_composer_) {
-        return false;
-    }
-
+    // use endpoint composer, which may wrap rtcp into srtcp
     rtcp_session_.reset(new (rtcp_session_) rtcp::Session(
-        NULL, this, &control_endpoint->writer(), *rtcp_composer_, packet_factory_,
-        byte_buffer_factory_));
+        config_.rtcp, NULL, this, &control_endpoint->writer(),
+        control_endpoint->composer(), packet_factory_, byte_buffer_factory_));
     if (!rtcp_session_ || !rtcp_session_->valid()) {
         return false;
     }
@@ -194,6 +275,81 @@ void SenderSession::update() {
     }
 }
 
+void SenderSession::flush() {
+    if (fec_writer_) {
+        fec_writer_->flush();
+    }
+}
+
+bool SenderSession::set_packet_length(core::nanoseconds_t packet_length) {
+    roc_panic_if(!packetizer_);
+
+    if (!fec_writer_) {
+        return packetizer_->set_packet_length(packet_length);
+    }
+
+    if (!packetizer_->is_packet_length_supported(packet_length)) {
+        roc_log(LogError, "sender session: unsupported packet length: length=%.3fms",
+                double(packet_length) / core::Millisecond);
+        return false;
+    }
+
+    // applied when fec writer reaches block boundary
+    pending_packet_length_ = packet_length;
+
+    return true;
+}
+
+bool SenderSession::set_max_packet_size(size_t max_packet_size) {
+    roc_panic_if(max_packet_size == 0);
+
+    max_packet_size_ = max_packet_size;
+
+    if (!packetizer_) {
+        return true;
+    }
+
+    const core::nanoseconds_t packet_length = fit_packet_length_();
+    if (packet_length == 0) {
+        roc_log(LogError,
+                "sender session: no packet length fits max packet size: max_size=%lu",
+                (unsigned long)max_packet_size_);
+        return false;
+    }
+
+    roc_log(LogDebug,
+            "sender session: fitting packets into max packet size:"
+            " max_size=%lu packet_length=%.3fms",
+            (unsigned long)max_packet_size_, double(packet_length) / core::Millisecond);
+
+    return set_packet_length(packet_length);
+}
+
+SenderSessionMetrics SenderSession::get_metrics() const {
+    return metrics_;
+}
+
+core::nanoseconds_t SenderSession::fit_packet_length_() const {
+    roc_panic_if(!packetizer_);
+
+    const core::nanoseconds_t max_packet_length = config_.max_packet_length > 0
+        ? config_.max_packet_length
+        : config_.packet_length;
+
+    return packetizer_->fit_packet_length(max_packet_size_, max_packet_length);
+}
+
+void SenderSession::write(const packet::PacketPtr& packet) {
+    roc_panic_if(!fec_writer_);
+
+    fec_writer_->write(packet);
+
+    if (pending_packet_length_ != 0 && fec_writer_->is_block_boundary()) {
+        packetizer_->set_packet_length(pending_packet_length_);
+        pending_packet_length_ = 0;
+    }
+}
+
 size_t SenderSession::on_get_num_sources() {
     return num_sources_;
 }
@@ -215,22 +371,38 @@ packet::source_t SenderSession::on_get_sending_source(size_t source_index) {
 
 rtcp::SendingMetrics
 SenderSession::on_get_sending_metrics(packet::ntp_timestamp_t report_time) {
-    // TODO
-
     rtcp::SendingMetrics metrics;
     metrics.origin_ntp = report_time;
 
+    if (packetizer_) {
+        // allows receivers to map stream timeline to sender clock
+        packetizer_->map_ntp_timestamp(report_time, metrics.origin_rtp);
+    }
+
     return metrics;
 }
 
 void SenderSession::on_add_reception_metrics(const rtcp::ReceptionMetrics& metrics) {
-    // TODO
-    (void)metrics;
+    metrics_.fract_loss = metrics.fract_loss;
+
+    metrics_.loss_burst = 0;
+    for (size_t n = 1; n < metrics.n_loss_runs; n += 2) {
+        metrics_.loss_burst = std::max(metrics_.loss_burst, (size_t)metrics.loss_runs[n]);
+    }
+    metrics_.dup_packets = metrics.dup_packets;
+
+    if (fec_block_sizer_) {
+        fec_block_sizer_->update(metrics.fract_loss);
+
+        if (!fec_writer_->resize(fec_block_sizer_->n_source_packets(),
+                                 fec_block_sizer_->n_repair_packets())) {
+            roc_log(LogDebug, "sender session: can't resize fec block");
+        }
+    }
 }
 
 void SenderSession::on_add_link_metrics(const rtcp::LinkMetrics& metrics) {
-    // TODO
-    (void)metrics;
+    metrics_.rtt = metrics.rtt;
 }
 
 } // namespace pipeline
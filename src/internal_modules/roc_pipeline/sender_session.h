@@ -19,19 +19,23 @@
 #include "roc_audio/poison_writer.h"
 #include "roc_audio/resampler_map.h"
 #include "roc_audio/resampler_writer.h"
+#include "roc_audio/stage_timing_writer.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/optional.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_fec/block_size_controller.h"
 #include "roc_fec/iblock_encoder.h"
+#include "roc_fec/rlc_writer.h"
+#include "roc_fec/batch_encoder.h"
 #include "roc_fec/writer.h"
 #include "roc_packet/interleaver.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_packet/router.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/metrics.h"
 #include "roc_pipeline/sender_endpoint.h"
-#include "roc_rtcp/composer.h"
 #include "roc_rtcp/session.h"
 #include "roc_rtp/format_map.h"
 
@@ -43,14 +47,19 @@ namespace pipeline {
 //! Contains:
 //!  - a pipeline for processing audio frames from single sender and converting
 //!    them into packets
-class SenderSession : public core::NonCopyable<>, private rtcp::ISenderHooks {
+class SenderSession : public core::NonCopyable<>,
+                      private rtcp::ISenderHooks,
+                      private packet::IWriter {
 public:
     //! Initialize.
+    //! @remarks
+    //!  If @p batch_encoder is non-NULL, it's used for Reed-Solomon FEC.
     SenderSession(const SenderConfig& config,
                   const rtp::FormatMap& format_map,
                   packet::PacketFactory& packet_factory,
                   core::BufferFactory<uint8_t>& byte_buffer_factory,
                   core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+                  fec::BatchEncoder* batch_encoder,
                   core::IAllocator& allocator);
 
     //! Create transport sub-pipeline.
@@ -69,7 +78,40 @@ public:
     //! Update pipeline.
     void update();
 
+    //! Write packets delayed by batch encoder.
+    void flush();
+
+    //! Change duration of packets.
+    //! @remarks
+    //!  Smaller packets reduce latency, larger ones reduce per-packet overhead.
+    //!  With block FEC, the change is delayed until the current block is
+    //!  completed, because all packets of a block should have the same size.
+    //! @returns
+    //!  false if the length isn't supported by payload encoder.
+    bool set_packet_length(core::nanoseconds_t packet_length);
+
+    //! Set maximum size of packet that can be sent without fragmentation.
+    //! @remarks
+    //!  Typically it's path MTU minus IP and UDP headers. Packet length is
+    //!  changed to the largest one for which packets fit this size, but not
+    //!  larger than SenderConfig::max_packet_length (or packet_length if it's
+    //!  zero). If transport pipeline is not created yet, the size is applied
+    //!  when it's created.
+    //! @returns
+    //!  false if even the shortest packet doesn't fit the size.
+    bool set_max_packet_size(size_t max_packet_size);
+
+    //! Get session metrics.
+    SenderSessionMetrics get_metrics() const;
+
 private:
+    core::nanoseconds_t fit_packet_length_() const;
+
+    // Implementation of packet::IWriter interface.
+    // Invoked by packetizer when block FEC is used, to apply pending packet
+    // length at block boundary.
+    virtual void write(const packet::PacketPtr& packet);
+
     // Implementation of rtcp::ISenderHooks interface.
     // These methods are invoked by rtcp::Session.
     virtual size_t on_get_num_sources();
@@ -89,28 +131,41 @@ private:
     core::BufferFactory<uint8_t>& byte_buffer_factory_;
     core::BufferFactory<audio::sample_t>& sample_buffer_factory_;
 
+    fec::BatchEncoder* batch_encoder_;
+
     core::Optional<packet::Router> router_;
 
     core::Optional<packet::Interleaver> interleaver_;
 
     core::ScopedPtr<fec::IBlockEncoder> fec_encoder_;
     core::Optional<fec::Writer> fec_writer_;
+    core::Optional<fec::BlockSizeController> fec_block_sizer_;
+    core::Optional<fec::RlcWriter> rlc_writer_;
 
     core::ScopedPtr<audio::IFrameEncoder> payload_encoder_;
     core::Optional<audio::Packetizer> packetizer_;
+    core::Optional<audio::StageTimingWriter> packetizer_timer_;
 
     core::Optional<audio::ChannelMapperWriter> channel_mapper_writer_;
 
     core::Optional<audio::PoisonWriter> resampler_poisoner_;
     core::Optional<audio::ResamplerWriter> resampler_writer_;
+    core::Optional<audio::StageTimingWriter> resampler_timer_;
     core::ScopedPtr<audio::IResampler> resampler_;
 
-    core::Optional<rtcp::Composer> rtcp_composer_;
     core::Optional<rtcp::Session> rtcp_session_;
 
     audio::IFrameWriter* audio_writer_;
 
+    // packet length to be applied when fec block is completed
+    core::nanoseconds_t pending_packet_length_;
+
+    // packet size limit derived from path mtu, zero if unknown
+    size_t max_packet_size_;
+
     size_t num_sources_;
+
+    SenderSessionMetrics metrics_;
 };
 
 } // namespace pipeline
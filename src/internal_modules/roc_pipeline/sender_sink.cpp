@@ -16,23 +16,55 @@
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+bool is_zero(const audio::sample_t* samples, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        if (samples[n] > 0 || samples[n] < 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
 SenderSink::SenderSink(const SenderConfig& config,
                        const rtp::FormatMap& format_map,
                        packet::PacketFactory& packet_factory,
                        core::BufferFactory<uint8_t>& byte_buffer_factory,
                        core::BufferFactory<audio::sample_t>& sample_buffer_factory,
-                       core::IAllocator& allocator)
+                       core::IAllocator& allocator,
+                       fec::BatchEncoder* batch_encoder)
     : config_(config)
     , format_map_(format_map)
     , packet_factory_(packet_factory)
     , byte_buffer_factory_(byte_buffer_factory)
     , sample_buffer_factory_(sample_buffer_factory)
     , allocator_(allocator)
+    , batch_encoder_(batch_encoder)
     , audio_writer_(NULL)
     , update_deadline_valid_(false)
     , update_deadline_(0) {
     audio::IFrameWriter* awriter = &fanout_;
 
+    if (config_.worker_threads != 0) {
+        worker_pool_.reset(new (worker_pool_) SenderWorkerPool(
+            config_.worker_threads, config_.worker_thread, allocator));
+        if (!worker_pool_ || !worker_pool_->valid()) {
+            return;
+        }
+        awriter = worker_pool_.get();
+    }
+
+    sink_timer_.reset(new (sink_timer_) audio::StageTimingWriter(
+        *awriter, "sink", config.input_sample_spec));
+    if (!sink_timer_) {
+        return;
+    }
+    awriter = sink_timer_.get();
+
     if (config_.poisoning) {
         pipeline_poisoner_.reset(new (pipeline_poisoner_) audio::PoisonWriter(*awriter));
         if (!pipeline_poisoner_) {
@@ -64,13 +96,18 @@ SenderSlot* SenderSink::create_slot() {
 
     core::SharedPtr<SenderSlot> slot = new (allocator_)
         SenderSlot(config_, format_map_, fanout_, packet_factory_, byte_buffer_factory_,
-                   sample_buffer_factory_, allocator_);
+                   sample_buffer_factory_, batch_encoder_, allocator_);
 
     if (!slot) {
         roc_log(LogError, "sender sink: can't allocate slot");
         return NULL;
     }
 
+    if (worker_pool_ && !worker_pool_->reserve(slots_.size() + 1)) {
+        roc_log(LogError, "sender sink: can't allocate worker pool jobs");
+        return NULL;
+    }
+
     slots_.push_back(*slot);
 
     invalidate_update_deadline_();
@@ -131,7 +168,46 @@ bool SenderSink::has_clock() const {
 void SenderSink::write(audio::Frame& frame) {
     roc_panic_if(!valid());
 
+    if (slots_.size() > 1 && !(frame.flags() & audio::Frame::FlagZeros)) {
+        // The frame is shared by all slots; check for silence once here, so that
+        // every slot can rely on the flag instead of scanning samples itself.
+        if (is_zero(frame.samples(), frame.num_samples())) {
+            frame.set_flags(frame.flags() | audio::Frame::FlagZeros);
+        }
+    }
+
+    if (worker_pool_) {
+        schedule_slots_();
+    }
+
     audio_writer_->write(frame);
+
+    if (batch_encoder_ || config_.multiplexed_packet_size != 0) {
+        // write repair packets of blocks completed by this frame; the first slot
+        // encodes blocks of all slots in one batch; then write datagrams
+        // multiplexing packets of this frame
+        core::SharedPtr<SenderSlot> slot;
+
+        for (slot = slots_.front(); slot; slot = slots_.nextof(*slot)) {
+            slot->flush();
+        }
+    }
+}
+
+void SenderSink::schedule_slots_() {
+    core::SharedPtr<SenderSlot> slot;
+
+    for (slot = slots_.front(); slot; slot = slots_.nextof(*slot)) {
+        audio::IFrameWriter* writer = slot->writer();
+        if (!writer || !fanout_.has_output(*writer)) {
+            continue;
+        }
+
+        // Can't fail, since pool is reserved for all slots in create_slot().
+        if (!worker_pool_->schedule(*writer)) {
+            roc_panic("sender sink: can't schedule slot");
+        }
+    }
 }
 
 void SenderSink::compute_update_deadline_() {
@@ -18,6 +18,7 @@
 #include "roc_audio/packetizer.h"
 #include "roc_audio/poison_writer.h"
 #include "roc_audio/profiling_writer.h"
+#include "roc_audio/stage_timing_writer.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
@@ -25,11 +26,13 @@
 #include "roc_fec/iblock_encoder.h"
 #include "roc_fec/writer.h"
 #include "roc_packet/interleaver.h"
+#include "roc_fec/batch_encoder.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_packet/router.h"
 #include "roc_pipeline/config.h"
 #include "roc_pipeline/sender_endpoint.h"
 #include "roc_pipeline/sender_slot.h"
+#include "roc_pipeline/sender_worker_pool.h"
 #include "roc_rtp/format_map.h"
 #include "roc_sndio/isink.h"
 
@@ -41,6 +44,7 @@ namespace pipeline {
 //! Contains:
 //!  - one or more sender slots
 //!  - fanout, to duplicate audio to all slots
+//!  - optional worker pool, to process slots in parallel
 //!
 //! Pipeline:
 //!  - input: frames
@@ -48,12 +52,17 @@ namespace pipeline {
 class SenderSink : public sndio::ISink, public core::NonCopyable<> {
 public:
     //! Initialize.
+    //! @remarks
+    //!  If @p batch_encoder is non-NULL, Reed-Solomon repair packets of all slots,
+    //!  and of other pipelines sharing the encoder, are encoded together after
+    //!  every frame.
     SenderSink(const SenderConfig& config,
                const rtp::FormatMap& format_map,
                packet::PacketFactory& packet_factory,
                core::BufferFactory<uint8_t>& byte_buffer_factory,
                core::BufferFactory<audio::sample_t>& sample_buffer_factory,
-               core::IAllocator& allocator);
+               core::IAllocator& allocator,
+               fec::BatchEncoder* batch_encoder = NULL);
 
     //! Check if the pipeline was successfully constructed.
     bool valid() const;
@@ -95,6 +104,8 @@ public:
     virtual void write(audio::Frame& frame);
 
 private:
+    void schedule_slots_();
+
     void compute_update_deadline_();
     void invalidate_update_deadline_();
 
@@ -108,10 +119,14 @@ private:
 
     core::IAllocator& allocator_;
 
+    fec::BatchEncoder* batch_encoder_;
+
     core::List<SenderSlot> slots_;
 
     audio::Fanout fanout_;
+    core::Optional<SenderWorkerPool> worker_pool_;
 
+    core::Optional<audio::StageTimingWriter> sink_timer_;
     core::Optional<audio::PoisonWriter> pipeline_poisoner_;
     core::Optional<audio::ProfilingWriter> profiler_;
 
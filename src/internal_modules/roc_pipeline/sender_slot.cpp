@@ -20,16 +20,22 @@ SenderSlot::SenderSlot(const SenderConfig& config,
                        packet::PacketFactory& packet_factory,
                        core::BufferFactory<uint8_t>& byte_buffer_factory,
                        core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+                       fec::BatchEncoder* batch_encoder,
                        core::IAllocator& allocator)
     : RefCounted(allocator)
     , config_(config)
     , fanout_(fanout)
+    , packet_factory_(packet_factory)
+    , byte_buffer_factory_(byte_buffer_factory)
     , session_(config,
                format_map,
                packet_factory,
                byte_buffer_factory,
                sample_buffer_factory,
-               allocator) {
+               batch_encoder,
+               allocator)
+    , max_packet_size_(0)
+    , metrics_(SenderSlotMetrics()) {
 }
 
 SenderEndpoint* SenderSlot::create_endpoint(address::Interface iface,
@@ -92,6 +98,8 @@ SenderEndpoint* SenderSlot::create_endpoint(address::Interface iface,
         break;
     }
 
+    publish_metrics_();
+
     return endpoint;
 }
 
@@ -110,6 +118,38 @@ core::nanoseconds_t SenderSlot::get_update_deadline() const {
 
 void SenderSlot::update() {
     session_.update();
+
+    publish_metrics_();
+}
+
+bool SenderSlot::set_max_packet_size(size_t max_packet_size) {
+    if (max_packet_size == 0) {
+        roc_log(LogError, "sender slot: max packet size should be non-zero");
+        return false;
+    }
+
+    if (max_packet_size_ != 0 && max_packet_size_ <= max_packet_size) {
+        return true;
+    }
+
+    max_packet_size_ = max_packet_size;
+
+    return session_.set_max_packet_size(max_packet_size_);
+}
+
+void SenderSlot::flush() {
+    session_.flush();
+
+    if (source_endpoint_) {
+        source_endpoint_->flush();
+    }
+    if (repair_endpoint_) {
+        repair_endpoint_->flush();
+    }
+}
+
+void SenderSlot::get_metrics(SenderSlotMetrics& metrics) const {
+    metrics = metrics_.wait_load();
 }
 
 SenderEndpoint* SenderSlot::create_source_endpoint_(address::Protocol proto) {
@@ -133,7 +173,8 @@ SenderEndpoint* SenderSlot::create_source_endpoint_(address::Protocol proto) {
         return NULL;
     }
 
-    source_endpoint_.reset(new (source_endpoint_) SenderEndpoint(proto, allocator()));
+    source_endpoint_.reset(new (source_endpoint_) SenderEndpoint(
+        proto, config_, packet_factory_, byte_buffer_factory_, allocator()));
     if (!source_endpoint_ || !source_endpoint_->valid()) {
         roc_log(LogError, "sender slot: can't create source endpoint");
         source_endpoint_.reset(NULL);
@@ -164,7 +205,8 @@ SenderEndpoint* SenderSlot::create_repair_endpoint_(address::Protocol proto) {
         return NULL;
     }
 
-    repair_endpoint_.reset(new (repair_endpoint_) SenderEndpoint(proto, allocator()));
+    repair_endpoint_.reset(new (repair_endpoint_) SenderEndpoint(
+        proto, config_, packet_factory_, byte_buffer_factory_, allocator()));
     if (!repair_endpoint_ || !repair_endpoint_->valid()) {
         roc_log(LogError, "sender slot: can't create repair endpoint");
         repair_endpoint_.reset(NULL);
@@ -184,7 +226,8 @@ SenderEndpoint* SenderSlot::create_control_endpoint_(address::Protocol proto) {
         return NULL;
     }
 
-    control_endpoint_.reset(new (control_endpoint_) SenderEndpoint(proto, allocator()));
+    control_endpoint_.reset(new (control_endpoint_) SenderEndpoint(
+        proto, config_, packet_factory_, byte_buffer_factory_, allocator()));
     if (!control_endpoint_ || !control_endpoint_->valid()) {
         roc_log(LogError, "sender slot: can't create control endpoint");
         control_endpoint_.reset(NULL);
@@ -194,5 +237,16 @@ SenderEndpoint* SenderSlot::create_control_endpoint_(address::Protocol proto) {
     return control_endpoint_.get();
 }
 
+void SenderSlot::publish_metrics_() {
+    SenderSlotMetrics metrics;
+
+    if (session_.writer()) {
+        metrics.num_sessions = 1;
+        metrics.session = session_.get_metrics();
+    }
+
+    metrics_.exclusive_store(metrics);
+}
+
 } // namespace pipeline
 } // namespace roc
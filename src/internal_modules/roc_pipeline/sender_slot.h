@@ -20,8 +20,10 @@
 #include "roc_core/noncopyable.h"
 #include "roc_core/optional.h"
 #include "roc_core/ref_counted.h"
+#include "roc_core/seqlock.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/metrics.h"
 #include "roc_pipeline/sender_endpoint.h"
 #include "roc_pipeline/sender_session.h"
 
@@ -45,6 +47,7 @@ public:
                packet::PacketFactory& packet_factory,
                core::BufferFactory<uint8_t>& byte_buffer_factory,
                core::BufferFactory<audio::sample_t>& sample_buffer_factory,
+               fec::BatchEncoder* batch_encoder,
                core::IAllocator& allocator);
 
     //! Add endpoint.
@@ -63,20 +66,43 @@ public:
     //! Update pipeline.
     void update();
 
+    //! Set maximum size of packet that can be sent without fragmentation.
+    //! @remarks
+    //!  If called multiple times, e.g. for source and repair ports, the
+    //!  smallest size is used.
+    bool set_max_packet_size(size_t max_packet_size);
+
+    //! Write packets delayed by batch encoder and multiplexer.
+    void flush();
+
+    //! Get metrics published during last update.
+    //! @remarks
+    //!  Can be called from any thread. Doesn't block pipeline thread.
+    void get_metrics(SenderSlotMetrics& metrics) const;
+
 private:
     SenderEndpoint* create_source_endpoint_(address::Protocol proto);
     SenderEndpoint* create_repair_endpoint_(address::Protocol proto);
     SenderEndpoint* create_control_endpoint_(address::Protocol proto);
 
+    void publish_metrics_();
+
     const SenderConfig& config_;
 
     audio::Fanout& fanout_;
 
+    packet::PacketFactory& packet_factory_;
+    core::BufferFactory<uint8_t>& byte_buffer_factory_;
+
     core::Optional<SenderEndpoint> source_endpoint_;
     core::Optional<SenderEndpoint> repair_endpoint_;
     core::Optional<SenderEndpoint> control_endpoint_;
 
     SenderSession session_;
+
+    size_t max_packet_size_;
+
+    core::Seqlock<SenderSlotMetrics> metrics_;
 };
 
 } // namespace pipeline
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/sender_worker_pool.h
+//! @brief Sender worker pool.
+
+#ifndef ROC_PIPELINE_SENDER_WORKER_POOL_H_
+#define ROC_PIPELINE_SENDER_WORKER_POOL_H_
+
+#include "roc_audio/frame.h"
+#include "roc_audio/iframe_writer.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Sender worker pool.
+//!
+//! Runs session sub-pipelines in parallel on a pool of threads. Before every
+//! frame, session writers are scheduled, and then write() passes the frame to
+//! every scheduled writer, using worker threads and the calling thread. The
+//! frame is shared by all writers and should not be modified by them.
+//!
+//! Scheduling and writing is not thread-safe and should be done from the
+//! pipeline thread.
+class SenderWorkerPool : public audio::IFrameWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Starts @p num_threads background threads with scheduling parameters
+    //!  from @p thread_config.
+    SenderWorkerPool(size_t num_threads,
+                     const core::ThreadConfig& thread_config,
+                     core::IAllocator& allocator);
+
+    //! Destroy.
+    //! @remarks
+    //!  Stops and joins background threads.
+    virtual ~SenderWorkerPool();
+
+    //! Check if the pool was successfully constructed.
+    bool valid() const;
+
+    //! Get number of background threads.
+    size_t num_threads() const;
+
+    //! Preallocate space for @p num_writers scheduled writers.
+    //! @returns
+    //!  false if allocation failed.
+    bool reserve(size_t num_writers);
+
+    //! Schedule writer to receive frame passed to next write() call.
+    //! @returns
+    //!  false if allocation failed; can't happen if no more writers are
+    //!  scheduled than were reserved.
+    bool schedule(audio::IFrameWriter& writer);
+
+    //! Write audio frame to every scheduled writer.
+    //! @remarks
+    //!  Blocks until all scheduled writers return, and then clears the list
+    //!  of scheduled writers.
+    virtual void write(audio::Frame& frame);
+
+private:
+    class Worker : public core::Thread {
+    public:
+        Worker(SenderWorkerPool& pool, const core::ThreadConfig& config);
+
+        virtual ~Worker();
+
+    private:
+        virtual void run();
+
+        SenderWorkerPool& pool_;
+    };
+
+    void worker_loop_();
+    void run_jobs_();
+
+    void stop_workers_();
+
+    core::IAllocator& allocator_;
+
+    core::Array<Worker*> workers_;
+    core::Array<audio::IFrameWriter*> jobs_;
+
+    core::Mutex mutex_;
+    core::Cond work_cond_;
+    core::Cond done_cond_;
+
+    size_t n_jobs_;
+    audio::Frame* frame_;
+    core::Atomic<size_t> next_job_;
+
+    unsigned generation_;
+    size_t n_active_;
+    bool running_;
+    bool stop_;
+
+    bool valid_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_SENDER_WORKER_POOL_H_
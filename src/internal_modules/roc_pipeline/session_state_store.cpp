@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/session_state_store.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+// First line of file. Following lines have format:
+//  <ssrc> <drift> <scaling> <target_latency_ns> [<cname>]
+const char* FileHeader = "# roc session state v1";
+
+enum { MaxLineLen = rtcp::header::SdesItemHeader::MaxTextLen + 128 };
+
+} // namespace
+
+SessionStateStore::SessionStateStore()
+    : n_entries_(0)
+    , seq_(0) {
+}
+
+bool SessionStateStore::load(const char* path) {
+    core::Mutex::Lock lock(mutex_);
+
+    n_entries_ = 0;
+
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        if (errno == ENOENT) {
+            roc_log(LogDebug, "session state store: no file, starting empty: path=%s",
+                    path);
+            return true;
+        }
+        roc_log(LogError, "session state store: can't open file: path=%s: %s", path,
+                core::errno_to_str(errno).c_str());
+        return false;
+    }
+
+    char line[MaxLineLen];
+    size_t line_num = 0;
+
+    while (fgets(line, sizeof(line), fp)) {
+        line_num++;
+
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (line[0] == '\0' || line[0] == '#') {
+            continue;
+        }
+
+        unsigned long ssrc = 0;
+        float drift = 0;
+        float scaling = 0;
+        long long target_latency = 0;
+        int cname_pos = 0;
+
+        if (sscanf(line, "%lu %f %f %lld %n", &ssrc, &drift, &scaling, &target_latency,
+                   &cname_pos)
+                < 4
+            || scaling <= 0 || target_latency < 0) {
+            roc_log(LogDebug, "session state store: skipping malformed line: line=%lu",
+                    (unsigned long)line_num);
+            continue;
+        }
+
+        audio::LatencyMonitorState state;
+        state.drift = drift;
+        state.scaling = scaling;
+        state.target_latency = (core::nanoseconds_t)target_latency;
+
+        update_((packet::source_t)ssrc, line + cname_pos, state);
+    }
+
+    const bool failed = ferror(fp);
+    fclose(fp);
+
+    if (failed) {
+        roc_log(LogError, "session state store: can't read file: path=%s", path);
+        n_entries_ = 0;
+        return false;
+    }
+
+    roc_log(LogInfo, "session state store: loaded file: path=%s n_entries=%lu", path,
+            (unsigned long)n_entries_);
+
+    return true;
+}
+
+bool SessionStateStore::save(const char* path) const {
+    // Copy entries and write them without holding the lock, so that pipeline
+    // thread is not blocked on file I/O.
+    Entry entries[MaxEntries];
+    size_t n_entries = 0;
+
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        for (; n_entries < n_entries_; n_entries++) {
+            entries[n_entries] = entries_[n_entries];
+        }
+    }
+
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        roc_log(LogError, "session state store: can't open file: path=%s: %s", path,
+                core::errno_to_str(errno).c_str());
+        return false;
+    }
+
+    bool ok = fprintf(fp, "%s\n", FileHeader) > 0;
+
+    for (size_t n = 0; ok && n < n_entries; n++) {
+        const Entry& entry = entries[n];
+
+        ok = fprintf(fp, "%lu %.9g %.9g %lld %s\n", (unsigned long)entry.ssrc,
+                     (double)entry.state.drift, (double)entry.state.scaling,
+                     (long long)entry.state.target_latency, entry.cname)
+            > 0;
+    }
+
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+
+    if (!ok) {
+        roc_log(LogError, "session state store: can't write file: path=%s", path);
+        return false;
+    }
+
+    roc_log(LogInfo, "session state store: saved file: path=%s n_entries=%lu", path,
+            (unsigned long)n_entries);
+
+    return true;
+}
+
+size_t SessionStateStore::num_entries() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return n_entries_;
+}
+
+bool SessionStateStore::find(packet::source_t ssrc,
+                             const char* cname,
+                             audio::LatencyMonitorState& state) const {
+    roc_panic_if(!cname);
+
+    core::Mutex::Lock lock(mutex_);
+
+    const Entry* entry = find_(ssrc, cname);
+    if (!entry) {
+        return false;
+    }
+
+    state = entry->state;
+    return true;
+}
+
+void SessionStateStore::update(packet::source_t ssrc,
+                               const char* cname,
+                               const audio::LatencyMonitorState& state) {
+    roc_panic_if(!cname);
+
+    core::Mutex::Lock lock(mutex_);
+
+    update_(ssrc, cname, state);
+}
+
+const SessionStateStore::Entry* SessionStateStore::find_(packet::source_t ssrc,
+                                                         const char* cname) const {
+    const Entry* by_cname = NULL;
+
+    for (size_t n = 0; n < n_entries_; n++) {
+        const Entry& entry = entries_[n];
+
+        if (entry.ssrc == ssrc
+            && (*cname == '\0' || *entry.cname == '\0'
+                || strcmp(entry.cname, cname) == 0)) {
+            return &entry;
+        }
+
+        if (*cname != '\0' && strcmp(entry.cname, cname) == 0
+            && (!by_cname || entry.seq > by_cname->seq)) {
+            by_cname = &entry;
+        }
+    }
+
+    return by_cname;
+}
+
+void SessionStateStore::update_(packet::source_t ssrc,
+                                const char* cname,
+                                const audio::LatencyMonitorState& state) {
+    Entry* entry = NULL;
+
+    for (size_t n = 0; n < n_entries_; n++) {
+        if (entries_[n].ssrc == ssrc) {
+            entry = &entries_[n];
+            break;
+        }
+    }
+
+    if (entry) {
+        // keep known cname if it's not reported yet by new session
+        if (*cname == '\0') {
+            cname = entry->cname;
+        }
+    } else {
+        if (n_entries_ < MaxEntries) {
+            entry = &entries_[n_entries_++];
+        } else {
+            entry = &entries_[0];
+            for (size_t n = 1; n < n_entries_; n++) {
+                if (entries_[n].seq < entry->seq) {
+                    entry = &entries_[n];
+                }
+            }
+        }
+    }
+
+    entry->ssrc = ssrc;
+    if (cname != entry->cname) {
+        strncpy(entry->cname, cname, sizeof(entry->cname) - 1);
+        entry->cname[sizeof(entry->cname) - 1] = '\0';
+    }
+    entry->state = state;
+    entry->seq = ++seq_;
+}
+
+} // namespace pipeline
+} // namespace roc
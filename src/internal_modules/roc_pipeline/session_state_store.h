@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/session_state_store.h
+//! @brief Store of receiver session state.
+
+#ifndef ROC_PIPELINE_SESSION_STATE_STORE_H_
+#define ROC_PIPELINE_SESSION_STATE_STORE_H_
+
+#include "roc_audio/latency_monitor.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+#include "roc_rtcp/headers.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Store of receiver session state.
+//!
+//! Keeps latency monitor state of recently seen senders, keyed by SSRC and
+//! CNAME, and allows to save it to a small text file and load it back. When
+//! receiver is restarted, new sessions from the same senders restore their
+//! state, and resume with steady-state scaling, without converging clock
+//! drift estimation from scratch.
+//!
+//! Thread-safe. Lookups and updates are performed by pipeline thread and
+//! don't touch the file; load() and save() are invoked by the user.
+class SessionStateStore : public core::NonCopyable<> {
+public:
+    //! Maximum number of senders kept in store.
+    //! When exceeded, the least recently updated sender is forgotten.
+    enum { MaxEntries = 64 };
+
+    //! Initialize empty store.
+    SessionStateStore();
+
+    //! Load store from file.
+    //! @remarks
+    //!  Replaces current contents. Missing file is not an error and leaves
+    //!  store empty; malformed lines are skipped.
+    //! @returns
+    //!  false if file exists but can't be read.
+    bool load(const char* path);
+
+    //! Save store to file.
+    //! @remarks
+    //!  Takes a snapshot of current contents and writes it without holding
+    //!  the lock, so that concurrent lookups and updates are not blocked.
+    //! @returns
+    //!  false if file can't be written.
+    bool save(const char* path) const;
+
+    //! Get number of senders in store.
+    size_t num_entries() const;
+
+    //! Find state of sender.
+    //! @remarks
+    //!  Sender is matched by @p ssrc, unless entry has different non-empty
+    //!  CNAME, or by non-empty @p cname, if sender was restarted and has new
+    //!  SSRC. @p cname may be empty when it's not known yet.
+    //! @returns
+    //!  false if sender is not found.
+    bool find(packet::source_t ssrc,
+              const char* cname,
+              audio::LatencyMonitorState& state) const;
+
+    //! Add or update state of sender.
+    void update(packet::source_t ssrc,
+                const char* cname,
+                const audio::LatencyMonitorState& state);
+
+private:
+    struct Entry {
+        packet::source_t ssrc;
+        char cname[rtcp::header::SdesItemHeader::MaxTextLen + 1];
+        audio::LatencyMonitorState state;
+        uint64_t seq;
+    };
+
+    const Entry* find_(packet::source_t ssrc, const char* cname) const;
+    void update_(packet::source_t ssrc,
+                 const char* cname,
+                 const audio::LatencyMonitorState& state);
+
+    core::Mutex mutex_;
+
+    Entry entries_[MaxEntries];
+    size_t n_entries_;
+    uint64_t seq_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_SESSION_STATE_STORE_H_
@@ -261,6 +261,54 @@ void Builder::end_xr_dlrr() {
     state_ = XR_HEAD;
 }
 
+void Builder::begin_xr_loss_rle(const header::XrLossRleBlock& loss_rle) {
+    roc_panic_if_not(state_ == XR_HEAD);
+
+    header::XrLossRleBlock* p =
+        (header::XrLossRleBlock*)cur_slice_.extend(sizeof(header::XrLossRleBlock));
+    memcpy(p, &loss_rle, sizeof(loss_rle));
+    xr_header_ = &p->header();
+
+    state_ = XR_LOSS_RLE_HEAD;
+}
+
+void Builder::add_xr_loss_rle_chunk(const header::XrLossRleChunk& chunk) {
+    roc_panic_if_not(state_ == XR_LOSS_RLE_HEAD || state_ == XR_LOSS_RLE_CHUNK);
+
+    header::XrLossRleChunk* p =
+        (header::XrLossRleChunk*)cur_slice_.extend(sizeof(header::XrLossRleChunk));
+    memcpy(p, &chunk, sizeof(chunk));
+
+    state_ = XR_LOSS_RLE_CHUNK;
+}
+
+void Builder::end_xr_loss_rle() {
+    roc_panic_if_not(state_ == XR_LOSS_RLE_HEAD || state_ == XR_LOSS_RLE_CHUNK);
+
+    size_t block_size = size_t(cur_slice_.data_end() - (uint8_t*)xr_header_);
+
+    if (block_size % 4 != 0) {
+        header::XrLossRleChunk* p =
+            (header::XrLossRleChunk*)cur_slice_.extend(sizeof(header::XrLossRleChunk));
+        p->reset();
+        block_size += sizeof(header::XrLossRleChunk);
+    }
+
+    xr_header_->set_len_bytes(block_size);
+
+    state_ = XR_HEAD;
+}
+
+void Builder::add_xr_stat_summary(const header::XrStatSummaryBlock& stat_summary) {
+    roc_panic_if_not(state_ == XR_HEAD);
+
+    header::XrStatSummaryBlock* p = (header::XrStatSummaryBlock*)cur_slice_.extend(
+        sizeof(header::XrStatSummaryBlock));
+    memcpy(p, &stat_summary, sizeof(stat_summary));
+    xr_header_ = &p->header();
+    xr_header_->set_len_bytes(sizeof(stat_summary));
+}
+
 void Builder::end_xr() {
     roc_panic_if_not(state_ == XR_HEAD);
 
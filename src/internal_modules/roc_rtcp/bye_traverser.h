@@ -58,7 +58,7 @@ public:
         const ByeTraverser& traverser_;
 
         State state_;
-        core::Slice<uint8_t> data_;
+        const core::Slice<uint8_t>& data_;
         uint8_t* pcur_;
         size_t cur_ssrc_;
 
@@ -75,6 +75,8 @@ public:
 
     //! Construct iterator.
     //! @pre Can be used if parse() returned true.
+    //! @remarks
+    //!  Iterator refers to traverser and should not outlive it.
     Iterator iter() const;
 
     //! Get number of SSRC elements in packet.
@@ -290,7 +290,7 @@ private:
         //! @name Fraction lost since last SR/RR.
         // @{
         Losses_FractLost_shift = 24,
-        Losses_FractLost_mask = 0x0F,
+        Losses_FractLost_mask = 0xFF,
         // @}
 
         //! @name cumul. no. pkts lost (signed!).
@@ -343,7 +343,7 @@ public:
     float fract_loss() const {
         const uint32_t tmp = core::ntoh32u(losses_);
         uint8_t losses8 = (tmp >> Losses_FractLost_shift) & Losses_FractLost_mask;
-        float res = float(losses8) / float(1 << Losses_FractLost_shift);
+        float res = float(losses8) / float(1 << 8);
 
         return res;
     }
@@ -1275,6 +1275,348 @@ public:
     }
 } ROC_ATTR_PACKED_END;
 
+//! XR Loss RLE Report chunk.
+//!
+//! RFC 3611 4.1. "Run Length Chunk" and "Null Chunk"
+//!
+//! @code
+//!  0                   1
+//!  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |C|R|        run length         |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+//!
+//! Bit-vector chunks (C=1) are recognized but not decoded.
+ROC_ATTR_PACKED_BEGIN class XrLossRleChunk {
+private:
+    enum {
+        Chunk_BitVector = (1 << 15),
+        Chunk_Received = (1 << 14),
+        Chunk_RunLengthMask = 0x3FFF
+    };
+
+    uint16_t chunk_;
+
+public:
+    //! Maximum run length that fits into one chunk.
+    enum { MaxRunLength = Chunk_RunLengthMask };
+
+    XrLossRleChunk() {
+        reset();
+    }
+
+    //! Reset to null chunk.
+    void reset() {
+        chunk_ = 0;
+    }
+
+    //! Check if this is a null chunk, used for padding.
+    bool is_null() const {
+        return chunk_ == 0;
+    }
+
+    //! Check if this is a bit-vector chunk.
+    bool is_bit_vector() const {
+        return (core::ntoh16u(chunk_) & Chunk_BitVector) != 0;
+    }
+
+    //! Check if run length chunk describes received packets.
+    bool run_received() const {
+        return (core::ntoh16u(chunk_) & Chunk_Received) != 0;
+    }
+
+    //! Get number of packets in run length chunk.
+    size_t run_length() const {
+        return core::ntoh16u(chunk_) & Chunk_RunLengthMask;
+    }
+
+    //! Set run length chunk.
+    void set_run(const bool received, const size_t length) {
+        roc_panic_if_not(length > 0 && length <= (size_t)MaxRunLength);
+        chunk_ = core::hton16u(
+            (uint16_t)((received ? Chunk_Received : 0) | (uint16_t)length));
+    }
+} ROC_ATTR_PACKED_END;
+
+//! XR Loss RLE Report block.
+//!
+//! RFC 3611 4.1. "Loss RLE Report Block"
+//!
+//! @code
+//!  0                   1                   2                   3
+//!  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |     BT=1      | rsvd. |   T   |         block length          |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                        SSRC of source                         |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |          begin_seq            |             end_seq           |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |          chunk 1              |             chunk 2           |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! :                              ...                              :
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+ROC_ATTR_PACKED_BEGIN class XrLossRleBlock {
+private:
+    XrBlockHeader header_;
+    uint32_t ssrc_;
+    uint16_t begin_seq_;
+    uint16_t end_seq_;
+
+public:
+    XrLossRleBlock() {
+        reset();
+    }
+
+    //! Reset to initial state (all zeros).
+    void reset() {
+        header_.reset(XR_LOSS_RLE);
+        ssrc_ = 0;
+        begin_seq_ = end_seq_ = 0;
+    }
+
+    //! Get common block header.
+    const XrBlockHeader& header() const {
+        return header_;
+    }
+
+    //! Get common block header.
+    XrBlockHeader& header() {
+        return header_;
+    }
+
+    //! Get SSRC of source.
+    uint32_t ssrc() const {
+        return core::ntoh32u(ssrc_);
+    }
+
+    //! Set SSRC of source.
+    void set_ssrc(const uint32_t ssrc) {
+        ssrc_ = core::hton32u(ssrc);
+    }
+
+    //! Get first sequence number covered by the report.
+    uint16_t begin_seq() const {
+        return core::ntoh16u(begin_seq_);
+    }
+
+    //! Set first sequence number covered by the report.
+    void set_begin_seq(const uint16_t seq) {
+        begin_seq_ = core::hton16u(seq);
+    }
+
+    //! Get sequence number following the last one covered by the report.
+    uint16_t end_seq() const {
+        return core::ntoh16u(end_seq_);
+    }
+
+    //! Set sequence number following the last one covered by the report.
+    void set_end_seq(const uint16_t seq) {
+        end_seq_ = core::hton16u(seq);
+    }
+
+    //! Get number of chunks, including null chunks.
+    size_t num_chunks() const {
+        if (header_.len_bytes() < sizeof(*this)) {
+            return 0;
+        }
+        return (header_.len_bytes() - sizeof(*this)) / sizeof(XrLossRleChunk);
+    }
+
+    //! Get chunk by index.
+    const XrLossRleChunk& get_chunk(const size_t i) const {
+        return get_block_by_index<const XrLossRleChunk>(this, i, num_chunks(),
+                                                        "rtcp xr_loss_rle");
+    }
+
+    //! Get chunk by index.
+    XrLossRleChunk& get_chunk(const size_t i) {
+        return get_block_by_index<XrLossRleChunk>(this, i, num_chunks(),
+                                                  "rtcp xr_loss_rle");
+    }
+} ROC_ATTR_PACKED_END;
+
+//! XR Statistics Summary Report block.
+//!
+//! RFC 3611 4.6. "Statistics Summary Report Block"
+//!
+//! @code
+//!  0                   1                   2                   3
+//!  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |     BT=6      |L|D|J|ToH|rsvd.|       block length = 9        |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                        SSRC of source                         |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |          begin_seq            |             end_seq           |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                        lost_packets                           |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                        dup_packets                            |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                         min_jitter                            |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                         max_jitter                            |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                         mean_jitter                           |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! |                         dev_jitter                            |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! | min_ttl_or_hl | max_ttl_or_hl |mean_ttl_or_hl | dev_ttl_or_hl |
+//! +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+//!
+//! TTL and hop limit fields are not used and always zero.
+ROC_ATTR_PACKED_BEGIN class XrStatSummaryBlock {
+private:
+    enum {
+        Flag_Loss = (1 << 7),
+        Flag_Dup = (1 << 6),
+        Flag_Jitter = (1 << 5)
+    };
+
+    XrBlockHeader header_;
+    uint32_t ssrc_;
+    uint16_t begin_seq_;
+    uint16_t end_seq_;
+    uint32_t lost_packets_;
+    uint32_t dup_packets_;
+    uint32_t min_jitter_;
+    uint32_t max_jitter_;
+    uint32_t mean_jitter_;
+    uint32_t dev_jitter_;
+    uint8_t min_ttl_;
+    uint8_t max_ttl_;
+    uint8_t mean_ttl_;
+    uint8_t dev_ttl_;
+
+public:
+    XrStatSummaryBlock() {
+        reset();
+    }
+
+    //! Reset to initial state (all zeros).
+    void reset() {
+        header_.reset(XR_STAT_SUMMARY);
+        ssrc_ = 0;
+        begin_seq_ = end_seq_ = 0;
+        lost_packets_ = dup_packets_ = 0;
+        min_jitter_ = max_jitter_ = mean_jitter_ = dev_jitter_ = 0;
+        min_ttl_ = max_ttl_ = mean_ttl_ = dev_ttl_ = 0;
+    }
+
+    //! Get common block header.
+    const XrBlockHeader& header() const {
+        return header_;
+    }
+
+    //! Get common block header.
+    XrBlockHeader& header() {
+        return header_;
+    }
+
+    //! Check if lost_packets field is valid.
+    bool has_loss() const {
+        return (header_.type_specific() & Flag_Loss) != 0;
+    }
+
+    //! Check if dup_packets field is valid.
+    bool has_dup() const {
+        return (header_.type_specific() & Flag_Dup) != 0;
+    }
+
+    //! Check if jitter fields are valid.
+    bool has_jitter() const {
+        return (header_.type_specific() & Flag_Jitter) != 0;
+    }
+
+    //! Get SSRC of source.
+    uint32_t ssrc() const {
+        return core::ntoh32u(ssrc_);
+    }
+
+    //! Set SSRC of source.
+    void set_ssrc(const uint32_t ssrc) {
+        ssrc_ = core::hton32u(ssrc);
+    }
+
+    //! Get first sequence number covered by the report.
+    uint16_t begin_seq() const {
+        return core::ntoh16u(begin_seq_);
+    }
+
+    //! Set first sequence number covered by the report.
+    void set_begin_seq(const uint16_t seq) {
+        begin_seq_ = core::hton16u(seq);
+    }
+
+    //! Get sequence number following the last one covered by the report.
+    uint16_t end_seq() const {
+        return core::ntoh16u(end_seq_);
+    }
+
+    //! Set sequence number following the last one covered by the report.
+    void set_end_seq(const uint16_t seq) {
+        end_seq_ = core::hton16u(seq);
+    }
+
+    //! Get number of lost packets.
+    uint32_t lost_packets() const {
+        return core::ntoh32u(lost_packets_);
+    }
+
+    //! Set number of lost packets and mark the field valid.
+    void set_lost_packets(const uint32_t n) {
+        lost_packets_ = core::hton32u(n);
+        header_.set_type_specific((uint8_t)(header_.type_specific() | Flag_Loss));
+    }
+
+    //! Get number of duplicate packets.
+    uint32_t dup_packets() const {
+        return core::ntoh32u(dup_packets_);
+    }
+
+    //! Set number of duplicate packets and mark the field valid.
+    void set_dup_packets(const uint32_t n) {
+        dup_packets_ = core::hton32u(n);
+        header_.set_type_specific((uint8_t)(header_.type_specific() | Flag_Dup));
+    }
+
+    //! Get minimum jitter, in timestamp units.
+    uint32_t min_jitter() const {
+        return core::ntoh32u(min_jitter_);
+    }
+
+    //! Get maximum jitter, in timestamp units.
+    uint32_t max_jitter() const {
+        return core::ntoh32u(max_jitter_);
+    }
+
+    //! Get mean jitter, in timestamp units.
+    uint32_t mean_jitter() const {
+        return core::ntoh32u(mean_jitter_);
+    }
+
+    //! Get standard deviation of jitter, in timestamp units.
+    uint32_t dev_jitter() const {
+        return core::ntoh32u(dev_jitter_);
+    }
+
+    //! Set jitter statistics and mark the fields valid.
+    void set_jitter(const uint32_t min_j,
+                    const uint32_t max_j,
+                    const uint32_t mean_j,
+                    const uint32_t dev_j) {
+        min_jitter_ = core::hton32u(min_j);
+        max_jitter_ = core::hton32u(max_j);
+        mean_jitter_ = core::hton32u(mean_j);
+        dev_jitter_ = core::hton32u(dev_j);
+        header_.set_type_specific((uint8_t)(header_.type_specific() | Flag_Jitter));
+    }
+} ROC_ATTR_PACKED_END;
+
 } // namespace header
 } // namespace rtcp
 } // namespace roc
@@ -35,15 +35,50 @@ struct SendingMetrics {
 
 //! Metrics sent from receiver to sender per source.
 struct ReceptionMetrics {
+    //! Maximum number of loss runs in one report.
+    enum { MaxLossRuns = 32 };
+
     //! To which source there metrics apply.
     packet::source_t ssrc;
 
-    //! Fraction of lost packets.
+    //! Fraction of packets lost since previous report.
     float fract_loss;
 
+    //! Cumulative number of lost packets.
+    //! May be negative if packets are duplicated.
+    int64_t cum_loss;
+
+    //! Extended highest sequence number received.
+    uint32_t ext_last_seqnum;
+
+    //! Interarrival jitter, in RTP timestamp units.
+    packet::timestamp_t jitter;
+
+    //! Extended sequence number of first packet covered by loss runs.
+    uint32_t ext_first_seqnum;
+
+    //! Loss runs since previous report.
+    //! Even elements are runs of received packets, odd elements are runs
+    //! of lost packets. Transferred via RTCP XR Loss RLE block.
+    uint16_t loss_runs[MaxLossRuns];
+
+    //! Number of elements in loss_runs.
+    size_t n_loss_runs;
+
+    //! Number of duplicate packets since previous report.
+    //! Transferred via RTCP XR Statistics Summary block.
+    uint32_t dup_packets;
+
     ReceptionMetrics()
         : ssrc(0)
-        , fract_loss(0) {
+        , fract_loss(0)
+        , cum_loss(0)
+        , ext_last_seqnum(0)
+        , jitter(0)
+        , ext_first_seqnum(0)
+        , n_loss_runs(0)
+        , dup_packets(0) {
+        memset(loss_runs, 0, sizeof(loss_runs));
     }
 };
 
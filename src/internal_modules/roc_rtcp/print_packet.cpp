@@ -124,6 +124,52 @@ void print_xr_dlrr(core::Printer& p, const header::XrDlrrBlock& blk) {
     }
 }
 
+void print_xr_loss_rle(core::Printer& p, const header::XrLossRleBlock& blk) {
+    p.writef("|- loss_rle:\n");
+
+    print_xr_block_header(p, blk.header());
+
+    p.writef("|-- block body:\n");
+    p.writef("|--- ssrc: %lu\n", (unsigned long)blk.ssrc());
+    p.writef("|--- begin_seq: %lu\n", (unsigned long)blk.begin_seq());
+    p.writef("|--- end_seq: %lu\n", (unsigned long)blk.end_seq());
+
+    for (size_t n = 0; n < blk.num_chunks(); n++) {
+        const header::XrLossRleChunk& chunk = blk.get_chunk(n);
+
+        if (chunk.is_null()) {
+            p.writef("|--- chunk: null\n");
+        } else if (chunk.is_bit_vector()) {
+            p.writef("|--- chunk: bit_vector\n");
+        } else {
+            p.writef("|--- chunk: %s %lu\n", chunk.run_received() ? "received" : "lost",
+                     (unsigned long)chunk.run_length());
+        }
+    }
+}
+
+void print_xr_stat_summary(core::Printer& p, const header::XrStatSummaryBlock& blk) {
+    p.writef("|- stat_summary:\n");
+
+    print_xr_block_header(p, blk.header());
+
+    p.writef("|-- block body:\n");
+    p.writef("|--- ssrc: %lu\n", (unsigned long)blk.ssrc());
+    p.writef("|--- begin_seq: %lu\n", (unsigned long)blk.begin_seq());
+    p.writef("|--- end_seq: %lu\n", (unsigned long)blk.end_seq());
+    if (blk.has_loss()) {
+        p.writef("|--- lost_packets: %lu\n", (unsigned long)blk.lost_packets());
+    }
+    if (blk.has_dup()) {
+        p.writef("|--- dup_packets: %lu\n", (unsigned long)blk.dup_packets());
+    }
+    if (blk.has_jitter()) {
+        p.writef("|--- jitter: min=%lu max=%lu mean=%lu dev=%lu\n",
+                 (unsigned long)blk.min_jitter(), (unsigned long)blk.max_jitter(),
+                 (unsigned long)blk.mean_jitter(), (unsigned long)blk.dev_jitter());
+    }
+}
+
 void print_xr(core::Printer& p, const XrTraverser& xr) {
     p.writef("+ xr:\n");
 
@@ -148,6 +194,14 @@ void print_xr(core::Printer& p, const XrTraverser& xr) {
         case XrTraverser::Iterator::DRLL_BLOCK:
             print_xr_dlrr(p, iter.get_dlrr());
             break;
+
+        case XrTraverser::Iterator::LOSS_RLE_BLOCK:
+            print_xr_loss_rle(p, iter.get_loss_rle());
+            break;
+
+        case XrTraverser::Iterator::STAT_SUMMARY_BLOCK:
+            print_xr_stat_summary(p, iter.get_stat_summary());
+            break;
         }
     }
 }
@@ -74,7 +74,9 @@ SdesTraverser::Iterator::Iterator(const SdesTraverser& traverser)
     , pcur_(traverser.data_.data() + sizeof(header::PacketHeader))
     , cur_chunk_(0)
     , parsed_ssrc_(0)
-    , parsed_item_type_() {
+    , parsed_item_type_()
+    , parsed_item_data_(NULL)
+    , parsed_item_len_(0) {
     parsed_item_text_[0] = '\0';
 }
 
@@ -154,12 +156,26 @@ SdesChunk SdesTraverser::Iterator::chunk() const {
     return chunk;
 }
 
+header::SdesItemType SdesTraverser::Iterator::item_type() const {
+    roc_panic_if_msg(state_ != ITEM,
+                     "sdes traverser:"
+                     " attempt to access getter of iterator in inapropriate state %d",
+                     (int)state_);
+
+    return parsed_item_type_;
+}
+
 SdesItem SdesTraverser::Iterator::item() const {
     roc_panic_if_msg(state_ != ITEM,
                      "sdes traverser:"
                      " attempt to access getter of iterator in inapropriate state %d",
                      (int)state_);
 
+    if (parsed_item_len_) {
+        memcpy(parsed_item_text_, parsed_item_data_, parsed_item_len_);
+    }
+    parsed_item_text_[parsed_item_len_] = '\0';
+
     SdesItem item;
     item.type = parsed_item_type_;
     item.text = parsed_item_text_;
@@ -181,10 +197,9 @@ void SdesTraverser::Iterator::parse_item_() {
     text_len = std::min(text_len, size_t(data_.data_end() - p->text()));
     text_len = std::min(text_len, sizeof(parsed_item_text_) - 1);
 
-    if (text_len) {
-        memcpy(parsed_item_text_, p->text(), text_len);
-    }
-    parsed_item_text_[text_len] = '\0';
+    // text is copied lazily in item()
+    parsed_item_data_ = p->text();
+    parsed_item_len_ = text_len;
     parsed_item_type_ = p->type();
 }
 
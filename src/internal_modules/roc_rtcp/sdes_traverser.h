@@ -42,8 +42,15 @@ public:
         //! @pre Can be used if next() returned CHUNK.
         SdesChunk chunk() const;
 
+        //! Get SDES item type.
+        //! Cheaper than item(), since it doesn't copy item text.
+        //! @pre Can be used if next() returned ITEM.
+        header::SdesItemType item_type() const;
+
         //! Get SDES item.
         //! Item is valid only until next() call.
+        //! @remarks
+        //!  Copies item text to internal buffer to zero-terminate it.
         //! @pre Can be used if next() returned ITEM.
         SdesItem item() const;
 
@@ -57,13 +64,16 @@ public:
         const SdesTraverser& traverser_;
 
         State state_;
-        core::Slice<uint8_t> data_;
+        const core::Slice<uint8_t>& data_;
         uint8_t* pcur_;
         size_t cur_chunk_;
 
         packet::source_t parsed_ssrc_;
         header::SdesItemType parsed_item_type_;
-        char parsed_item_text_[header::SdesItemHeader::MaxTextLen + 1];
+        const uint8_t* parsed_item_data_;
+        size_t parsed_item_len_;
+
+        mutable char parsed_item_text_[header::SdesItemHeader::MaxTextLen + 1];
     };
 
     //! Initialize traverser.
@@ -75,6 +85,8 @@ public:
 
     //! Construct iterator.
     //! @pre Can be used if parse() returned true.
+    //! @remarks
+    //!  Iterator refers to traverser and should not outlive it.
     Iterator iter() const;
 
     //! Get number of SDES chunks in packet.
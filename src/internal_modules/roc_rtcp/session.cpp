@@ -15,13 +15,29 @@
 namespace roc {
 namespace rtcp {
 
-Session::Session(IReceiverHooks* recv_hooks,
+namespace {
+
+const int32_t MaxCumLoss = 0x7FFFFF;
+
+// Typical size of UDP and IPv4 headers, accounted in report size.
+const size_t UdpIpOverhead = 28;
+
+// Middle 32 bits of NTP timestamp, used in LRR and DLRR fields.
+uint32_t ntp_middle(packet::ntp_timestamp_t ntp) {
+    return (uint32_t)(ntp >> 16);
+}
+
+} // namespace
+
+Session::Session(const SessionConfig& config,
+                 IReceiverHooks* recv_hooks,
                  ISenderHooks* send_hooks,
                  packet::IWriter* packet_writer,
                  packet::IComposer& packet_composer,
                  packet::PacketFactory& packet_factory,
                  core::BufferFactory<uint8_t>& buffer_factory)
-    : packet_factory_(packet_factory)
+    : config_(config)
+    , packet_factory_(packet_factory)
     , buffer_factory_(buffer_factory)
     , packet_writer_(packet_writer)
     , packet_composer_(packet_composer)
@@ -29,6 +45,13 @@ Session::Session(IReceiverHooks* recv_hooks,
     , send_hooks_(send_hooks)
     , next_deadline_(0)
     , ssrc_(0)
+    , n_rrtr_(0)
+    , n_sources_(0)
+    , report_offset_(0)
+    , avg_report_size_(0)
+    , n_report_metrics_(0)
+    , n_xr_metrics_(0)
+    , xr_cursor_(0)
     , valid_(false) {
     ssrc_ = (packet::source_t)core::fast_random(0, packet::source_t(-1));
 
@@ -57,7 +80,13 @@ void Session::process_packet(const packet::PacketPtr& packet) {
         return;
     }
 
-    parse_events_(traverser);
+    const packet::ntp_timestamp_t recv_time = packet::ntp_timestamp();
+
+    update_report_size_(packet->rtcp()->data.size());
+
+    // two passes: source events and extended reports go first, so that
+    // reports can be merged with XR blocks and refer to updated sources
+    parse_events_(traverser, recv_time);
     parse_reports_(traverser);
 }
 
@@ -76,18 +105,26 @@ void Session::generate_packets() {
         next_deadline_ = core::timestamp(core::ClockMonotonic);
     }
 
+    packet::PacketPtr packet = generate_packet_();
+
+    const core::nanoseconds_t interval = report_interval_();
+
     do {
-        next_deadline_ += core::Millisecond * 200;
+        next_deadline_ += interval;
     } while (next_deadline_ <= core::timestamp(core::ClockMonotonic));
 
-    packet::PacketPtr packet = generate_packet_();
-
     if (packet) {
         packet_writer_->write(packet);
     }
 }
 
-void Session::parse_events_(const Traverser& traverser) {
+void Session::parse_events_(const Traverser& traverser,
+                            packet::ntp_timestamp_t recv_time) {
+    // extended reports follow SR or RR in compound packet, but they complement
+    // reception blocks, so they're parsed here, before reports
+    n_xr_metrics_ = 0;
+    xr_cursor_ = 0;
+
     Traverser::Iterator iter = traverser.iter();
     Traverser::Iterator::State state;
 
@@ -111,6 +148,15 @@ void Session::parse_events_(const Traverser& traverser) {
             parse_goodbye_(bye);
         } break;
 
+        case Traverser::Iterator::XR: {
+            XrTraverser xr = iter.get_xr();
+            if (!xr.parse()) {
+                roc_log(LogTrace, "rtcp session: can't parse xr packet");
+                break;
+            }
+            parse_extended_report_(xr, recv_time);
+        } break;
+
         default:
             break;
         }
@@ -137,6 +183,181 @@ void Session::parse_reports_(const Traverser& traverser) {
     }
 }
 
+void Session::parse_extended_report_(const XrTraverser& xr,
+                                     packet::ntp_timestamp_t recv_time) {
+    XrTraverser::Iterator iter = xr.iter();
+    XrTraverser::Iterator::State state;
+
+    while ((state = iter.next()) != XrTraverser::Iterator::END) {
+        switch (state) {
+        case XrTraverser::Iterator::RRTR_BLOCK:
+            parse_rrtr_(xr.packet().ssrc(), iter.get_rrtr(), recv_time);
+            break;
+
+        case XrTraverser::Iterator::DRLL_BLOCK:
+            parse_dlrr_(iter.get_dlrr(), recv_time);
+            break;
+
+        case XrTraverser::Iterator::LOSS_RLE_BLOCK:
+            parse_loss_rle_(iter.get_loss_rle());
+            break;
+
+        case XrTraverser::Iterator::STAT_SUMMARY_BLOCK:
+            parse_stat_summary_(iter.get_stat_summary());
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+void Session::parse_rrtr_(packet::source_t ssrc,
+                          const header::XrRrtrBlock& blk,
+                          packet::ntp_timestamp_t recv_time) {
+    if (ssrc == ssrc_) {
+        return;
+    }
+
+    size_t idx = 0;
+
+    for (; idx < n_rrtr_; idx++) {
+        if (rrtr_[idx].ssrc == ssrc) {
+            break;
+        }
+    }
+
+    if (idx == n_rrtr_) {
+        if (n_rrtr_ < MaxRrtrSources) {
+            n_rrtr_++;
+        } else {
+            // replace participant that we didn't hear from for longest time
+            idx = 0;
+            for (size_t n = 1; n < n_rrtr_; n++) {
+                if (rrtr_[n].recv_time < rrtr_[idx].recv_time) {
+                    idx = n;
+                }
+            }
+        }
+    }
+
+    rrtr_[idx].ssrc = ssrc;
+    rrtr_[idx].last_rr = ntp_middle(blk.ntp_timestamp());
+    rrtr_[idx].recv_time = recv_time;
+}
+
+void Session::parse_dlrr_(const header::XrDlrrBlock& blk,
+                          packet::ntp_timestamp_t recv_time) {
+    for (size_t n = 0; n < blk.num_subblocks(); n++) {
+        const header::XrDlrrSubblock& sub_blk = blk.get_subblock(n);
+
+        if (sub_blk.ssrc() != ssrc_ || sub_blk.last_rr() == 0) {
+            continue;
+        }
+
+        // RFC 3611 4.5: rtt = A - LRR - DLRR, in units of 1/65536 seconds
+        const int32_t rtt = (int32_t)(ntp_middle(recv_time) - sub_blk.last_rr()
+                                      - sub_blk.delay_last_rr());
+        if (rtt < 0) {
+            roc_log(LogTrace, "rtcp session: ignoring dlrr with negative rtt");
+            continue;
+        }
+
+        LinkMetrics metrics;
+        metrics.rtt = packet::ntp_2_nanoseconds((packet::ntp_timestamp_t)rtt << 16);
+
+        if (recv_hooks_) {
+            recv_hooks_->on_add_link_metrics(metrics);
+        }
+        if (send_hooks_) {
+            send_hooks_->on_add_link_metrics(metrics);
+        }
+    }
+}
+
+void Session::parse_loss_rle_(const header::XrLossRleBlock& blk) {
+    ReceptionMetrics* metrics = find_xr_metrics_(blk.ssrc(), true);
+    if (!metrics) {
+        return;
+    }
+
+    // only low 16 bits are known here, extended when matched with reception block
+    metrics->ext_first_seqnum = blk.begin_seq();
+    metrics->n_loss_runs = 0;
+
+    for (size_t n = 0; n < blk.num_chunks(); n++) {
+        const header::XrLossRleChunk& chunk = blk.get_chunk(n);
+
+        if (chunk.is_null()) {
+            continue;
+        }
+        if (chunk.is_bit_vector()) {
+            // not produced by us, stop at first one
+            break;
+        }
+
+        const bool want_received = (metrics->n_loss_runs % 2 == 0);
+
+        if (chunk.run_received() != want_received && metrics->n_loss_runs != 0) {
+            // same type as previous run, continue it
+            uint16_t& run = metrics->loss_runs[metrics->n_loss_runs - 1];
+            run = (uint16_t)std::min((size_t)run + chunk.run_length(), (size_t)0xFFFF);
+            continue;
+        }
+
+        if (chunk.run_received() != want_received) {
+            // report starts with lost packets
+            metrics->loss_runs[metrics->n_loss_runs++] = 0;
+        }
+
+        if (metrics->n_loss_runs == ReceptionMetrics::MaxLossRuns) {
+            break;
+        }
+
+        metrics->loss_runs[metrics->n_loss_runs++] = (uint16_t)chunk.run_length();
+    }
+}
+
+void Session::parse_stat_summary_(const header::XrStatSummaryBlock& blk) {
+    ReceptionMetrics* metrics = find_xr_metrics_(blk.ssrc(), true);
+    if (!metrics) {
+        return;
+    }
+
+    if (blk.has_dup()) {
+        metrics->dup_packets = blk.dup_packets();
+    }
+}
+
+ReceptionMetrics* Session::find_xr_metrics_(packet::source_t ssrc, bool create) {
+    // blocks of one source are adjacent, and reception blocks usually follow
+    // in the same order as XR blocks, so search starts from last match and
+    // typically finishes in one or two steps; SSRCs are kept in separate
+    // compact array to make full scan of new sources cheap
+    for (size_t i = 0, n = xr_cursor_; i < n_xr_metrics_; i++, n++) {
+        if (n == n_xr_metrics_) {
+            n = 0;
+        }
+        if (xr_ssrcs_[n] == ssrc) {
+            xr_cursor_ = n;
+            return &xr_metrics_[n];
+        }
+    }
+
+    if (!create || n_xr_metrics_ == MaxReportSources) {
+        return NULL;
+    }
+
+    xr_cursor_ = n_xr_metrics_;
+    xr_ssrcs_[n_xr_metrics_] = ssrc;
+
+    ReceptionMetrics& metrics = xr_metrics_[n_xr_metrics_++];
+    metrics = ReceptionMetrics();
+    metrics.ssrc = ssrc;
+
+    return &metrics;
+}
+
 void Session::parse_session_description_(const SdesTraverser& sdes) {
     SdesTraverser::Iterator iter = sdes.iter();
     SdesTraverser::Iterator::State state;
@@ -150,14 +371,13 @@ void Session::parse_session_description_(const SdesTraverser& sdes) {
         } break;
 
         case SdesTraverser::Iterator::ITEM: {
-            const SdesItem item = iter.item();
-            if (item.type != header::SDES_CNAME) {
+            // check type before item(), which copies text
+            if (iter.item_type() != header::SDES_CNAME || !recv_hooks_) {
                 continue;
             }
 
-            if (recv_hooks_) {
-                recv_hooks_->on_update_source(chunk.ssrc, item.text);
-            }
+            const SdesItem item = iter.item();
+            recv_hooks_->on_update_source(chunk.ssrc, item.text);
         } break;
 
         default:
@@ -208,6 +428,20 @@ void Session::parse_reception_block_(const header::ReceptionReportBlock& blk) {
     ReceptionMetrics metrics;
     metrics.ssrc = blk.ssrc();
     metrics.fract_loss = blk.fract_loss();
+    metrics.cum_loss = blk.cumloss();
+    metrics.ext_last_seqnum = blk.last_seqnum();
+    metrics.jitter = blk.jitter();
+
+    if (const ReceptionMetrics* xr_metrics = find_xr_metrics_(metrics.ssrc, false)) {
+        // negative difference wraps, so the unsigned sum is still correct
+        metrics.ext_first_seqnum = metrics.ext_last_seqnum
+            + (uint32_t)packet::seqnum_diff(
+                (packet::seqnum_t)xr_metrics->ext_first_seqnum,
+                (packet::seqnum_t)metrics.ext_last_seqnum);
+        memcpy(metrics.loss_runs, xr_metrics->loss_runs, sizeof(metrics.loss_runs));
+        metrics.n_loss_runs = xr_metrics->n_loss_runs;
+        metrics.dup_packets = xr_metrics->dup_packets;
+    }
 
     if (send_hooks_) {
         send_hooks_->on_add_reception_metrics(metrics);
@@ -270,6 +504,8 @@ packet::PacketPtr Session::generate_packet_() {
     // copy our RTCP packet into that sub-slice
     memcpy(packet->rtcp()->data.data(), rtcp_data.data(), rtcp_data.size());
 
+    update_report_size_(rtcp_data.size());
+
     return packet;
 }
 
@@ -277,22 +513,42 @@ bool Session::build_packet_(core::Slice<uint8_t>& data) {
     // FIXME
     const packet::ntp_timestamp_t report_time = packet::ntp_timestamp();
 
+    // SDES and fixed part of XR should always fit; what remains is shared
+    // between reception blocks and per-source XR blocks
+    const size_t sdes_size = session_description_size_();
+    const size_t xr_size = extended_report_size_();
+
+    const size_t min_size = sizeof(header::SenderReportPacket) + xr_size + sdes_size;
+
+    if (data.capacity() < min_size) {
+        roc_log(LogError,
+                "rtcp session: buffer too small for report: capacity=%lu required=%lu",
+                (unsigned long)data.capacity(), (unsigned long)min_size);
+        return false;
+    }
+
+    const size_t report_budget = data.capacity() - xr_size - sdes_size;
+
     Builder bld(data);
 
     if (send_hooks_) {
         // if we're sending and probably also receiving
-        build_sender_report_(bld, report_time);
+        build_sender_report_(bld, report_time, report_budget);
     } else {
         // if we're only receiving
-        build_receiver_report_(bld, report_time);
+        build_receiver_report_(bld, report_budget);
     }
 
+    build_extended_report_(bld, report_time, data.capacity() - data.size() - sdes_size);
+
     build_session_description_(bld);
 
     return true;
 }
 
-void Session::build_sender_report_(Builder& bld, packet::ntp_timestamp_t report_time) {
+void Session::build_sender_report_(Builder& bld,
+                                   packet::ntp_timestamp_t report_time,
+                                   size_t budget) {
     roc_panic_if(!send_hooks_);
 
     const SendingMetrics metrics = send_hooks_->on_get_sending_metrics(report_time);
@@ -304,35 +560,111 @@ void Session::build_sender_report_(Builder& bld, packet::ntp_timestamp_t report_
 
     bld.begin_sr(sr);
 
-    if (recv_hooks_) {
-        const size_t num_sources = recv_hooks_->on_get_num_sources();
-
-        for (size_t n = 0; n < num_sources; n++) {
-            bld.add_sr_report(
-                build_reception_block_(recv_hooks_->on_get_reception_metrics(n)));
-        }
-    }
-
-    bld.end_sr();
+    build_reception_reports_(bld, true, sizeof(sr), budget);
 }
 
-void Session::build_receiver_report_(Builder& bld, packet::ntp_timestamp_t report_time) {
+void Session::build_receiver_report_(Builder& bld, size_t budget) {
     header::ReceiverReportPacket rr;
     rr.set_ssrc(ssrc_);
 
     bld.begin_rr(rr);
 
-    if (recv_hooks_) {
-        const size_t num_sources = recv_hooks_->on_get_num_sources();
+    build_reception_reports_(bld, false, sizeof(rr), budget);
+}
 
-        for (size_t n = 0; n < num_sources; n++) {
-            bld.add_rr_report(
-                build_reception_block_(recv_hooks_->on_get_reception_metrics(n)));
+void Session::build_reception_reports_(Builder& bld,
+                                       bool is_sr,
+                                       size_t header_size,
+                                       size_t budget) {
+    n_report_metrics_ = 0;
+
+    const size_t num_sources = recv_hooks_ ? recv_hooks_->on_get_num_sources() : 0;
+    n_sources_ = num_sources;
+
+    // RFC 3550 6.1: if there are more than 31 sources, additional RR packets
+    // follow in the same compound packet; if there are too many sources to
+    // fit into packet, we report a subset and rotate it between reports
+    size_t num_blocks = 0;
+    size_t used_size = header_size;
+
+    while (num_blocks < num_sources) {
+        size_t block_size = sizeof(header::ReceptionReportBlock);
+        if (num_blocks != 0 && num_blocks % header::PacketMaxBlocks == 0) {
+            block_size += sizeof(header::ReceiverReportPacket);
+        }
+        if (used_size + block_size > budget) {
+            break;
+        }
+        used_size += block_size;
+        num_blocks++;
+    }
+
+    if (num_blocks < num_sources) {
+        roc_log(LogTrace,
+                "rtcp session: reporting subset of sources: reported=%lu total=%lu",
+                (unsigned long)num_blocks, (unsigned long)num_sources);
+    }
+
+    const size_t first_source = num_sources != 0 ? report_offset_ % num_sources : 0;
+
+    for (size_t n = 0; n < num_blocks; n++) {
+        if (n != 0 && n % header::PacketMaxBlocks == 0) {
+            if (is_sr && n == header::PacketMaxBlocks) {
+                bld.end_sr();
+            } else {
+                bld.end_rr();
+            }
+
+            header::ReceiverReportPacket rr;
+            rr.set_ssrc(ssrc_);
+
+            bld.begin_rr(rr);
+        }
+
+        const ReceptionMetrics metrics =
+            recv_hooks_->on_get_reception_metrics((first_source + n) % num_sources);
+
+        if (is_sr && n < header::PacketMaxBlocks) {
+            bld.add_sr_report(build_reception_block_(metrics));
+        } else {
+            bld.add_rr_report(build_reception_block_(metrics));
+        }
+
+        if (n_report_metrics_ < MaxXrReportSources) {
+            report_metrics_[n_report_metrics_++] = metrics;
         }
     }
 
-    bld.end_rr();
+    report_offset_ = num_sources != 0 ? (first_source + num_blocks) % num_sources : 0;
 
+    if (is_sr && num_blocks <= header::PacketMaxBlocks) {
+        bld.end_sr();
+    } else {
+        bld.end_rr();
+    }
+}
+
+header::ReceptionReportBlock
+Session::build_reception_block_(const ReceptionMetrics& metrics) {
+    header::ReceptionReportBlock blk;
+
+    blk.set_ssrc(metrics.ssrc);
+
+    // fraction is stored in Q.8 format
+    blk.set_fract_loss((ssize_t)(metrics.fract_loss * 256), 256);
+
+    // cumulative loss is 24-bit signed integer
+    blk.set_cumloss((int32_t)std::max((int64_t)-MaxCumLoss,
+                                      std::min((int64_t)MaxCumLoss, metrics.cum_loss)));
+    blk.set_last_seqnum(metrics.ext_last_seqnum);
+    blk.set_jitter(metrics.jitter);
+
+    return blk;
+}
+
+void Session::build_extended_report_(Builder& bld,
+                                     packet::ntp_timestamp_t report_time,
+                                     size_t budget) {
     header::XrPacket xr;
     xr.set_ssrc(ssrc_);
 
@@ -345,16 +677,166 @@ void Session::build_receiver_report_(Builder& bld, packet::ntp_timestamp_t repor
         bld.add_xr_rrtr(rrtr);
     }
 
+    if (n_rrtr_ != 0) {
+        header::XrDlrrBlock dlrr;
+        bld.begin_xr_dlrr(dlrr);
+
+        for (size_t n = 0; n < n_rrtr_; n++) {
+            header::XrDlrrSubblock sub_blk;
+            sub_blk.set_ssrc(rrtr_[n].ssrc);
+            sub_blk.set_last_rr(rrtr_[n].last_rr);
+            sub_blk.set_delay_last_rr(report_time > rrtr_[n].recv_time
+                                          ? ntp_middle(report_time - rrtr_[n].recv_time)
+                                          : 0);
+
+            bld.add_xr_dlrr_report(sub_blk);
+        }
+
+        bld.end_xr_dlrr();
+    }
+
+    size_t used_size = extended_report_size_();
+
+    for (size_t n = 0; n < n_report_metrics_; n++) {
+        const size_t source_size =
+            loss_rle_size_(report_metrics_[n]) + sizeof(header::XrStatSummaryBlock);
+        if (used_size + source_size > budget) {
+            break;
+        }
+        used_size += source_size;
+
+        build_loss_rle_(bld, report_metrics_[n]);
+        build_stat_summary_(bld, report_metrics_[n]);
+    }
+
     bld.end_xr();
 }
 
-header::ReceptionReportBlock
-Session::build_reception_block_(const ReceptionMetrics& metrics) {
-    header::ReceptionReportBlock blk;
+void Session::build_loss_rle_(Builder& bld, const ReceptionMetrics& metrics) {
+    header::XrLossRleBlock blk;
+    blk.set_ssrc(metrics.ssrc);
+    blk.set_begin_seq((packet::seqnum_t)metrics.ext_first_seqnum);
+
+    uint32_t end_seqnum = metrics.ext_first_seqnum;
+    for (size_t n = 0; n < metrics.n_loss_runs; n++) {
+        end_seqnum += metrics.loss_runs[n];
+    }
+    blk.set_end_seq((packet::seqnum_t)end_seqnum);
+
+    bld.begin_xr_loss_rle(blk);
+
+    for (size_t n = 0; n < metrics.n_loss_runs; n++) {
+        // even runs are received packets, odd runs are lost packets
+        const bool received = (n % 2 == 0);
+
+        size_t run = metrics.loss_runs[n];
+        while (run != 0) {
+            const size_t chunk_run =
+                std::min(run, (size_t)header::XrLossRleChunk::MaxRunLength);
+
+            header::XrLossRleChunk chunk;
+            chunk.set_run(received, chunk_run);
+            bld.add_xr_loss_rle_chunk(chunk);
+
+            run -= chunk_run;
+        }
+    }
 
+    bld.end_xr_loss_rle();
+}
+
+void Session::build_stat_summary_(Builder& bld, const ReceptionMetrics& metrics) {
+    header::XrStatSummaryBlock blk;
     blk.set_ssrc(metrics.ssrc);
 
-    return blk;
+    // cover same range as loss RLE block
+    uint32_t end_seqnum = metrics.ext_first_seqnum;
+    uint32_t lost_packets = 0;
+    for (size_t n = 0; n < metrics.n_loss_runs; n++) {
+        end_seqnum += metrics.loss_runs[n];
+        if (n % 2 == 1) {
+            lost_packets += metrics.loss_runs[n];
+        }
+    }
+
+    blk.set_begin_seq((packet::seqnum_t)metrics.ext_first_seqnum);
+    blk.set_end_seq((packet::seqnum_t)end_seqnum);
+    blk.set_lost_packets(lost_packets);
+    blk.set_dup_packets(metrics.dup_packets);
+
+    bld.add_xr_stat_summary(blk);
+}
+
+size_t Session::extended_report_size_() const {
+    size_t size = sizeof(header::XrPacket) + sizeof(header::XrRrtrBlock);
+
+    if (n_rrtr_ != 0) {
+        size += sizeof(header::XrDlrrBlock) + n_rrtr_ * sizeof(header::XrDlrrSubblock);
+    }
+
+    return size;
+}
+
+size_t Session::loss_rle_size_(const ReceptionMetrics& metrics) const {
+    size_t n_chunks = 0;
+
+    for (size_t n = 0; n < metrics.n_loss_runs; n++) {
+        const size_t max_run = header::XrLossRleChunk::MaxRunLength;
+        n_chunks += ((size_t)metrics.loss_runs[n] + max_run - 1) / max_run;
+    }
+
+    // padded to 32-bit boundary with null chunk
+    n_chunks += n_chunks % 2;
+
+    return sizeof(header::XrLossRleBlock) + n_chunks * sizeof(header::XrLossRleChunk);
+}
+
+size_t Session::session_description_size_() const {
+    const size_t num_chunks = 1 + num_described_sources_();
+
+    // chunk header, CNAME item, and up to 4 bytes of terminating padding
+    const size_t chunk_size = sizeof(header::SdesChunkHeader)
+        + sizeof(header::SdesItemHeader)
+        + strnlen(cname_, header::SdesItemHeader::MaxTextLen) + 4;
+
+    return sizeof(header::PacketHeader) + num_chunks * chunk_size;
+}
+
+core::nanoseconds_t Session::report_interval_() const {
+    core::nanoseconds_t interval = config_.min_report_interval;
+
+    if (config_.report_bandwidth != 0 && avg_report_size_ != 0) {
+        // RFC 3550 6.3.1: all members share control bandwidth, so interval
+        // grows linearly with number of members
+        const size_t n_members = 1 + std::max(n_sources_, n_rrtr_);
+
+        const core::nanoseconds_t bandwidth_interval = core::nanoseconds_t(
+            (double)avg_report_size_ * n_members / config_.report_bandwidth
+            * core::Second);
+
+        interval = std::max(interval, bandwidth_interval);
+    }
+
+    // RFC 3550 6.3.1: randomize interval to [0.5, 1.5] range to avoid
+    // synchronization of members, and compensate for timer reconsideration
+    // which we don't implement
+    interval = core::nanoseconds_t((double)interval
+                                   * (double)core::fast_random(500, 1500) / 1000
+                                   / 1.21828);
+
+    return interval;
+}
+
+void Session::update_report_size_(size_t packet_size) {
+    // RFC 3550 6.3.3: avg_rtcp_size = 1/16 * packet_size + 15/16 * avg_rtcp_size,
+    // including lower-layer headers
+    packet_size += UdpIpOverhead;
+
+    if (avg_report_size_ == 0) {
+        avg_report_size_ = packet_size;
+    } else {
+        avg_report_size_ = (avg_report_size_ * 15 + packet_size) / 16;
+    }
 }
 
 void Session::build_session_description_(Builder& bld) {
@@ -363,7 +845,7 @@ void Session::build_session_description_(Builder& bld) {
     build_source_description_(bld, ssrc_);
 
     if (send_hooks_) {
-        const size_t num_sources = send_hooks_->on_get_num_sources();
+        const size_t num_sources = num_described_sources_();
 
         for (size_t n = 0; n < num_sources; n++) {
             build_source_description_(bld, send_hooks_->on_get_sending_source(n));
@@ -373,6 +855,15 @@ void Session::build_session_description_(Builder& bld) {
     bld.end_sdes();
 }
 
+size_t Session::num_described_sources_() const {
+    if (!send_hooks_) {
+        return 0;
+    }
+
+    // one SDES packet holds up to 31 chunks, and first one is our own
+    return std::min(send_hooks_->on_get_num_sources(), header::PacketMaxBlocks - 1);
+}
+
 void Session::build_source_description_(Builder& bld, packet::source_t ssrc) {
     SdesChunk chunk;
     chunk.ssrc = ssrc;
@@ -22,17 +22,54 @@
 #include "roc_rtcp/builder.h"
 #include "roc_rtcp/ireceiver_hooks.h"
 #include "roc_rtcp/isender_hooks.h"
+#include "roc_rtcp/metrics.h"
 #include "roc_rtcp/traverser.h"
+#include "roc_rtcp/xr_traverser.h"
 
 namespace roc {
 namespace rtcp {
 
+//! RTCP session parameters.
+struct SessionConfig {
+    //! Minimum interval between reports, nanoseconds.
+    //! @remarks
+    //!  RFC 3550 recommends 5 seconds; smaller default gives faster feedback
+    //!  for latency and FEC tuning.
+    core::nanoseconds_t min_report_interval;
+
+    //! Bandwidth available for RTCP traffic of all members, bytes per second.
+    //! @remarks
+    //!  If non-zero, report interval is scaled with number of members and
+    //!  average report size, so that control traffic stays within this
+    //!  bandwidth, as described in RFC 3550 6.3.1. If zero, only
+    //!  min_report_interval is used.
+    size_t report_bandwidth;
+
+    SessionConfig()
+        : min_report_interval(200 * core::Millisecond)
+        , report_bandwidth(8000) {
+    }
+};
+
 //! RTCP session.
 //! Processes incoming RTCP packets and generates outgoing RTCP packets.
+//!
+//! Besides SR and RR, session exchanges RFC 3611 extended reports:
+//!  - every report includes RRTR block, and DLRR block for RRTR blocks
+//!    received from other participants, which allows both sides to
+//!    estimate round-trip time without extra traffic
+//!  - reports about received sources are accompanied by Loss RLE and
+//!    Statistics Summary blocks, which describe loss patterns and duplicates
+//!
+//! Reports about all received sources are aggregated into one compound packet,
+//! with additional RR packets if there are more than 31 sources. If sources
+//! don't fit into one packet, they are reported in turns. Report interval
+//! is scaled with number of members according to RFC 3550.
 class Session {
 public:
     //! Initialize.
-    Session(IReceiverHooks* recv_hooks,
+    Session(const SessionConfig& config,
+            IReceiverHooks* recv_hooks,
             ISenderHooks* send_hooks,
             packet::IWriter* packet_writer,
             packet::IComposer& packet_composer,
@@ -55,8 +92,35 @@ public:
     void generate_packets();
 
 private:
-    void parse_events_(const Traverser& traverser);
+    enum {
+        // Maximum number of remote participants remembered for DLRR.
+        MaxRrtrSources = 8,
+        // Maximum number of sources with XR blocks accepted from one report.
+        MaxReportSources = header::PacketMaxBlocks,
+        // Maximum number of sources with Loss RLE and Statistics Summary
+        // blocks in one report, to keep packet size bounded.
+        MaxXrReportSources = 8
+    };
+
+    struct RrtrInfo {
+        // SSRC of participant that sent RRTR.
+        packet::source_t ssrc;
+        // Middle 32 bits of NTP timestamp from RRTR.
+        uint32_t last_rr;
+        // Local NTP time when RRTR was received.
+        packet::ntp_timestamp_t recv_time;
+    };
+
+    void parse_events_(const Traverser& traverser, packet::ntp_timestamp_t recv_time);
     void parse_reports_(const Traverser& traverser);
+    void parse_extended_report_(const XrTraverser& xr, packet::ntp_timestamp_t recv_time);
+    void parse_rrtr_(packet::source_t ssrc,
+                     const header::XrRrtrBlock& blk,
+                     packet::ntp_timestamp_t recv_time);
+    void parse_dlrr_(const header::XrDlrrBlock& blk, packet::ntp_timestamp_t recv_time);
+    void parse_loss_rle_(const header::XrLossRleBlock& blk);
+    void parse_stat_summary_(const header::XrStatSummaryBlock& blk);
+    ReceptionMetrics* find_xr_metrics_(packet::source_t ssrc, bool create);
 
     void parse_session_description_(const SdesTraverser& sdes);
     void parse_goodbye_(const ByeTraverser& bye);
@@ -67,11 +131,32 @@ private:
     packet::PacketPtr generate_packet_();
 
     bool build_packet_(core::Slice<uint8_t>& data);
-    void build_sender_report_(Builder& bld, packet::ntp_timestamp_t report_time);
-    void build_receiver_report_(Builder& bld, packet::ntp_timestamp_t report_time);
+    void build_sender_report_(Builder& bld,
+                              packet::ntp_timestamp_t report_time,
+                              size_t budget);
+    void build_receiver_report_(Builder& bld, size_t budget);
+    void build_reception_reports_(Builder& bld,
+                                  bool is_sr,
+                                  size_t header_size,
+                                  size_t budget);
     header::ReceptionReportBlock build_reception_block_(const ReceptionMetrics& metrics);
+    void build_extended_report_(Builder& bld,
+                                packet::ntp_timestamp_t report_time,
+                                size_t budget);
+    void build_loss_rle_(Builder& bld, const ReceptionMetrics& metrics);
+    void build_stat_summary_(Builder& bld, const ReceptionMetrics& metrics);
+
+    size_t extended_report_size_() const;
+    size_t loss_rle_size_(const ReceptionMetrics& metrics) const;
+    size_t session_description_size_() const;
+
+    core::nanoseconds_t report_interval_() const;
+    void update_report_size_(size_t packet_size);
     void build_session_description_(Builder& bld);
     void build_source_description_(Builder& bld, packet::source_t ssrc);
+    size_t num_described_sources_() const;
+
+    const SessionConfig config_;
 
     packet::PacketFactory& packet_factory_;
     core::BufferFactory<uint8_t>& buffer_factory_;
@@ -87,6 +172,21 @@ private:
     packet::source_t ssrc_;
     char cname_[header::SdesItemHeader::MaxTextLen + 1];
 
+    RrtrInfo rrtr_[MaxRrtrSources];
+    size_t n_rrtr_;
+
+    size_t n_sources_;
+    size_t report_offset_;
+    size_t avg_report_size_;
+
+    ReceptionMetrics report_metrics_[MaxXrReportSources];
+    size_t n_report_metrics_;
+
+    ReceptionMetrics xr_metrics_[MaxReportSources];
+    packet::source_t xr_ssrcs_[MaxReportSources];
+    size_t n_xr_metrics_;
+    size_t xr_cursor_;
+
     bool valid_;
 };
 
@@ -68,7 +68,7 @@ public:
         void skip_packet_();
 
         State state_;
-        const core::Slice<uint8_t> data_;
+        const core::Slice<uint8_t>& data_;
         core::Slice<uint8_t> cur_slice_;
         header::PacketHeader* cur_pkt_header_;
         size_t cur_pkt_len_;
@@ -87,6 +87,8 @@ public:
 
     //! Construct iterator.
     //! @pre Can be used if parse() returned true.
+    //! @remarks
+    //!  Iterator refers to traverser and should not outlive it.
     Iterator iter() const;
 
 private:
@@ -84,46 +84,55 @@ XrTraverser::Iterator::State XrTraverser::Iterator::next() {
 
     if (state_ == BEGIN) {
         pcur_ += sizeof(header::XrPacket);
-        if (pcur_ >= data_.data_end()) {
-            state_ = END;
-            return state_;
-        }
+    } else {
+        pcur_ += ((const header::XrBlockHeader*)pcur_)->len_bytes();
     }
 
-    header::XrBlockHeader* p_block_header = (header::XrBlockHeader*)pcur_;
-
-    if (state_ != BEGIN) {
+    // Walk through all blocks and seek for known types.
+    while (pcur_ + sizeof(header::XrBlockHeader) <= data_.data_end()) {
+        const header::XrBlockHeader* p_block_header = (header::XrBlockHeader*)pcur_;
         const size_t block_len = p_block_header->len_bytes();
-        pcur_ += block_len;
-        p_block_header = (header::XrBlockHeader*)pcur_;
-    }
 
-    // Walk through all block packets and seek for known types.
-    while (p_block_header->block_type() != header::XR_RRTR
-           && p_block_header->block_type() != header::XR_DLRR
-           && pcur_ < data_.data_end()) {
-        const size_t block_len = p_block_header->len_bytes();
         // If the block is incorrect, skip the whole packet.
         if (pcur_ + block_len > data_.data_end()) {
-            state_ = END;
+            break;
+        }
+
+        switch (p_block_header->block_type()) {
+        case header::XR_RRTR:
+            if (block_len >= sizeof(header::XrRrtrBlock)) {
+                state_ = RRTR_BLOCK;
+                return state_;
+            }
+            break;
+
+        case header::XR_DLRR:
+            state_ = DRLL_BLOCK;
             return state_;
-        } else {
-            pcur_ += block_len;
-            p_block_header = (header::XrBlockHeader*)pcur_;
+
+        case header::XR_LOSS_RLE:
+            if (block_len >= sizeof(header::XrLossRleBlock)) {
+                state_ = LOSS_RLE_BLOCK;
+                return state_;
+            }
+            break;
+
+        case header::XR_STAT_SUMMARY:
+            if (block_len >= sizeof(header::XrStatSummaryBlock)) {
+                state_ = STAT_SUMMARY_BLOCK;
+                return state_;
+            }
+            break;
+
+        default:
+            break;
         }
-    }
 
-    // No known block type in XR packet.
-    if (pcur_ >= data_.data_end()) {
-        state_ = END;
-    } else if (p_block_header->block_type() == header::XR_RRTR) {
-        state_ = RRTR_BLOCK;
-    } else if (p_block_header->block_type() == header::XR_DLRR) {
-        state_ = DRLL_BLOCK;
-    } else {
-        roc_panic("xr traverser: impossible branch");
+        pcur_ += block_len;
     }
 
+    // No more known blocks in XR packet.
+    state_ = END;
     return state_;
 }
 
@@ -141,5 +150,19 @@ const header::XrDlrrBlock& XrTraverser::Iterator::get_dlrr() const {
     return *(header::XrDlrrBlock*)pcur_;
 }
 
+const header::XrLossRleBlock& XrTraverser::Iterator::get_loss_rle() const {
+    roc_panic_if_msg(state_ != LOSS_RLE_BLOCK,
+                     "xt traverser:"
+                     " attempt to access block with wrong type or at wrong state");
+    return *(header::XrLossRleBlock*)pcur_;
+}
+
+const header::XrStatSummaryBlock& XrTraverser::Iterator::get_stat_summary() const {
+    roc_panic_if_msg(state_ != STAT_SUMMARY_BLOCK,
+                     "xt traverser:"
+                     " attempt to access block with wrong type or at wrong state");
+    return *(header::XrStatSummaryBlock*)pcur_;
+}
+
 } // namespace rtcp
 } // namespace roc
@@ -27,10 +27,12 @@ public:
     public:
         //! Iterator state.
         enum State {
-            BEGIN,      //!< Iterator created.
-            RRTR_BLOCK, //!< RRTR block (receiver reference time).
-            DRLL_BLOCK, //!< DLRR block (delay since last receiver report).
-            END         //!< Parsed whole packet.
+            BEGIN,              //!< Iterator created.
+            RRTR_BLOCK,         //!< RRTR block (receiver reference time).
+            DRLL_BLOCK,         //!< DLRR block (delay since last receiver report).
+            LOSS_RLE_BLOCK,     //!< Loss RLE block (run-length encoded losses).
+            STAT_SUMMARY_BLOCK, //!< Statistics Summary block.
+            END                 //!< Parsed whole packet.
         };
 
         //! Advance iterator.
@@ -44,13 +46,21 @@ public:
         //! @pre Can be used if next() returned DLRR_BLOCK.
         const header::XrDlrrBlock& get_dlrr() const;
 
+        //! Get Loss RLE block (run-length encoded losses).
+        //! @pre Can be used if next() returned LOSS_RLE_BLOCK.
+        const header::XrLossRleBlock& get_loss_rle() const;
+
+        //! Get Statistics Summary block.
+        //! @pre Can be used if next() returned STAT_SUMMARY_BLOCK.
+        const header::XrStatSummaryBlock& get_stat_summary() const;
+
     private:
         friend class XrTraverser;
 
         explicit Iterator(const XrTraverser& traverser);
 
         State state_;
-        core::Slice<uint8_t> data_;
+        const core::Slice<uint8_t>& data_;
         uint8_t* pcur_;
     };
 
@@ -63,6 +73,8 @@ public:
 
     //! Construct iterator.
     //! @pre Can be used if parse() returned true.
+    //! @remarks
+    //!  Iterator refers to traverser and should not outlive it.
     Iterator iter() const;
 
     //! Get number of XR blocks in packet.
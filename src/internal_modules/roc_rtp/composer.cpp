@@ -8,15 +8,36 @@
 
 #include "roc_rtp/composer.h"
 #include "roc_core/align_ops.h"
+#include "roc_core/endian.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
 #include "roc_rtp/headers.h"
 
 namespace roc {
 namespace rtp {
 
-Composer::Composer(packet::IComposer* inner_composer)
-    : inner_composer_(inner_composer) {
+namespace {
+
+// extension header followed by abs-capture-time element, padded to 32 bits
+const size_t CaptureExtDataSize =
+    (ExtSize_OneByteHeader + ExtSize_AbsCaptureTime + 3) / 4 * 4;
+
+const size_t CaptureExtSize = sizeof(ExtentionHeader) + CaptureExtDataSize;
+
+// offset of abs-capture-time value from the beginning of rtp header
+const size_t CaptureTsOffset =
+    sizeof(Header) + sizeof(ExtentionHeader) + ExtSize_OneByteHeader;
+
+} // namespace
+
+Composer::Composer(packet::IComposer* inner_composer, bool capture_timestamps)
+    : inner_composer_(inner_composer)
+    , capture_timestamps_(capture_timestamps)
+    , template_source_(0)
+    , template_payload_type_(0)
+    , template_valid_(false) {
+    roc_panic_if(header_size_() > MaxHeaderSize);
 }
 
 bool Composer::align(core::Slice<uint8_t>& buffer,
@@ -26,7 +47,7 @@ bool Composer::align(core::Slice<uint8_t>& buffer,
         roc_panic("rtp composer: unexpected non-aligned buffer");
     }
 
-    header_size += sizeof(Header);
+    header_size += header_size_();
 
     if (inner_composer_ == NULL) {
         const size_t padding = core::AlignOps::pad_as(header_size, payload_alignment);
@@ -50,13 +71,13 @@ bool Composer::prepare(packet::Packet& packet,
                        size_t payload_size) {
     core::Slice<uint8_t> header = buffer.subslice(0, 0);
 
-    if (header.capacity() < sizeof(Header)) {
+    if (header.capacity() < header_size_()) {
         roc_log(LogDebug,
                 "rtp composer: not enough space for rtp header: size=%lu cap=%lu",
-                (unsigned long)sizeof(Header), (unsigned long)header.capacity());
+                (unsigned long)header_size_(), (unsigned long)header.capacity());
         return false;
     }
-    header.reslice(0, sizeof(Header));
+    header.reslice(0, header_size_());
 
     core::Slice<uint8_t> payload = header.subslice(header.size(), header.size());
 
@@ -122,19 +143,27 @@ bool Composer::compose(packet::Packet& packet) {
         roc_panic("rtp composer: unexpected non-rtp packet");
     }
 
-    if (rtp->header.size() != sizeof(Header)) {
+    if (rtp->header.size() != header_size_()) {
         roc_panic("rtp composer: unexpected rtp header size");
     }
 
+    if (!template_valid_ || template_source_ != rtp->source
+        || template_payload_type_ != rtp->payload_type) {
+        build_template_(*rtp);
+    }
+
+    memcpy(rtp->header.data(), template_, header_size_());
+
     Header& header = *(Header*)rtp->header.data();
 
-    header.clear();
-    header.set_version(V2);
-    header.set_ssrc(rtp->source);
     header.set_seqnum(rtp->seqnum);
     header.set_timestamp(rtp->timestamp);
     header.set_marker(rtp->marker);
-    header.set_payload_type(PayloadType(rtp->payload_type));
+
+    if (capture_timestamps_) {
+        const uint64_t capture_ts = core::hton64u(rtp->capture_timestamp);
+        memcpy(rtp->header.data() + CaptureTsOffset, &capture_ts, sizeof(capture_ts));
+    }
 
     if (rtp->padding.size() > 0) {
         header.set_padding(true);
@@ -163,5 +192,41 @@ bool Composer::compose(packet::Packet& packet) {
     return true;
 }
 
+size_t Composer::header_size_() const {
+    return sizeof(Header) + (capture_timestamps_ ? CaptureExtSize : 0);
+}
+
+void Composer::build_template_(const packet::RTP& rtp) {
+    Header& header = *(Header*)template_;
+
+    header.clear();
+    header.set_version(V2);
+    header.set_ssrc(rtp.source);
+    header.set_payload_type(PayloadType(rtp.payload_type));
+
+    if (capture_timestamps_) {
+        header.set_extension(true);
+        compose_extension_(template_ + sizeof(Header));
+    }
+
+    template_source_ = rtp.source;
+    template_payload_type_ = rtp.payload_type;
+    template_valid_ = true;
+}
+
+void Composer::compose_extension_(uint8_t* data) {
+    ExtentionHeader& extension = *(ExtentionHeader*)data;
+
+    extension.set_type(ExtProfile_OneByte);
+    extension.set_data_size(CaptureExtDataSize);
+
+    uint8_t* element = data + sizeof(ExtentionHeader);
+
+    memset(element, 0, CaptureExtDataSize);
+
+    // one-byte element header: 4-bit id, 4-bit data length minus one
+    element[0] = uint8_t((ExtId_AbsCaptureTime << 4) | (ExtSize_AbsCaptureTime - 1));
+}
+
 } // namespace rtp
 } // namespace roc
@@ -13,18 +13,31 @@
 #define ROC_RTP_COMPOSER_H_
 
 #include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
 #include "roc_packet/icomposer.h"
+#include "roc_packet/units.h"
 
 namespace roc {
 namespace rtp {
 
 //! RTP packet composer.
+//! @remarks
+//!  Fields that are the same for all packets of a stream (version, source,
+//!  payload type, and header extension) are serialized once into a header
+//!  template, which is rebuilt only when source or payload type changes.
+//!  For every packet, composer copies the template and writes only fields
+//!  that change from packet to packet.
+//! @note
+//!  Not thread-safe.
 class Composer : public packet::IComposer, public core::NonCopyable<> {
 public:
     //! Initialization.
     //! @remarks
     //!  If @p inner_composer is not NULL, it is used to compose the packet payload.
-    Composer(packet::IComposer* inner_composer);
+    //!  If @p capture_timestamps is true, every packet gets header extension with
+    //!  packet::RTP::capture_timestamp (RFC 8285 abs-capture-time).
+    explicit Composer(packet::IComposer* inner_composer,
+                      bool capture_timestamps = false);
 
     //! Adjust buffer to align payload.
     virtual bool
@@ -41,7 +54,20 @@ public:
     virtual bool compose(packet::Packet& packet);
 
 private:
+    enum { MaxHeaderSize = 64 };
+
+    size_t header_size_() const;
+
+    void build_template_(const packet::RTP& rtp);
+    void compose_extension_(uint8_t* data);
+
     packet::IComposer* inner_composer_;
+    const bool capture_timestamps_;
+
+    uint8_t template_[MaxHeaderSize];
+    packet::source_t template_source_;
+    unsigned template_payload_type_;
+    bool template_valid_;
 };
 
 } // namespace rtp
@@ -37,10 +37,18 @@ struct Format {
     unsigned packet_flags;
 
     //! Create frame encoder.
-    audio::IFrameEncoder* (*new_encoder)(core::IAllocator& allocator);
+    //! @remarks
+    //!  Gets the format itself, so that the same function can be used for
+    //!  formats with different parameters.
+    audio::IFrameEncoder* (*new_encoder)(core::IAllocator& allocator,
+                                         const Format& format);
 
     //! Create frame decoder.
-    audio::IFrameDecoder* (*new_decoder)(core::IAllocator& allocator);
+    //! @remarks
+    //!  Gets the format itself, so that the same function can be used for
+    //!  formats with different parameters.
+    audio::IFrameDecoder* (*new_decoder)(core::IAllocator& allocator,
+                                         const Format& format);
 
     //! Initialize.
     Format()
@@ -9,64 +9,82 @@
 #include "roc_rtp/format_map.h"
 #include "roc_audio/pcm_decoder.h"
 #include "roc_audio/pcm_encoder.h"
+#include "roc_core/log.h"
 #include "roc_core/panic.h"
 
+#ifdef ROC_TARGET_OPUS
+#include "roc_audio/opus_decoder.h"
+#include "roc_audio/opus_encoder.h"
+#include "roc_core/scoped_ptr.h"
+#endif // ROC_TARGET_OPUS
+
 namespace roc {
 namespace rtp {
 
 namespace {
 
-template <audio::PcmEncoding Encoding,
-          audio::PcmEndian Endian,
-          size_t SampleRate,
-          packet::channel_mask_t ChMask>
-audio::IFrameEncoder* new_encoder(core::IAllocator& allocator) {
-    return new (allocator) audio::PcmEncoder(audio::PcmFormat(Encoding, Endian),
-                                             audio::SampleSpec(SampleRate, ChMask));
+audio::IFrameEncoder* new_pcm_encoder(core::IAllocator& allocator, const Format& fmt) {
+    return new (allocator) audio::PcmEncoder(fmt.pcm_format, fmt.sample_spec);
+}
+
+audio::IFrameDecoder* new_pcm_decoder(core::IAllocator& allocator, const Format& fmt) {
+    return new (allocator) audio::PcmDecoder(fmt.pcm_format, fmt.sample_spec);
 }
 
-template <audio::PcmEncoding Encoding,
-          audio::PcmEndian Endian,
-          size_t SampleRate,
-          packet::channel_mask_t ChMask>
-audio::IFrameDecoder* new_decoder(core::IAllocator& allocator) {
-    return new (allocator) audio::PcmDecoder(audio::PcmFormat(Encoding, Endian),
-                                             audio::SampleSpec(SampleRate, ChMask));
+#ifdef ROC_TARGET_OPUS
+
+audio::IFrameEncoder* new_opus_encoder(core::IAllocator& allocator, const Format& fmt) {
+    core::ScopedPtr<audio::OpusEncoder> encoder(
+        new (allocator) audio::OpusEncoder(fmt.sample_spec), allocator);
+    if (!encoder || !encoder->valid()) {
+        return NULL;
+    }
+    return encoder.release();
 }
 
+audio::IFrameDecoder* new_opus_decoder(core::IAllocator& allocator, const Format& fmt) {
+    core::ScopedPtr<audio::OpusDecoder> decoder(
+        new (allocator) audio::OpusDecoder(fmt.sample_spec), allocator);
+    if (!decoder || !decoder->valid()) {
+        return NULL;
+    }
+    return decoder.release();
+}
+
+#endif // ROC_TARGET_OPUS
+
 } // namespace
 
 FormatMap::FormatMap()
     : n_formats_(0) {
-    {
-        Format fmt;
-        fmt.payload_type = PayloadType_L16_Mono;
-        fmt.pcm_format =
-            audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big);
-        fmt.sample_spec = audio::SampleSpec(44100, 0x1);
-        fmt.packet_flags = packet::Packet::FlagAudio;
-        fmt.new_encoder =
-            &new_encoder<audio::PcmEncoding_SInt16, audio::PcmEndian_Big, 44100, 0x1>;
-        fmt.new_decoder =
-            &new_decoder<audio::PcmEncoding_SInt16, audio::PcmEndian_Big, 44100, 0x1>;
-        add_(fmt);
+    if (!add_pcm_format(PayloadType_L16_Mono,
+                        audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big),
+                        audio::SampleSpec(44100, 0x1))) {
+        roc_panic("format map: can't add built-in format");
+    }
+    if (!add_pcm_format(PayloadType_L16_Stereo,
+                        audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big),
+                        audio::SampleSpec(44100, 0x3))) {
+        roc_panic("format map: can't add built-in format");
     }
+#ifdef ROC_TARGET_OPUS
     {
         Format fmt;
-        fmt.payload_type = PayloadType_L16_Stereo;
-        fmt.pcm_format =
-            audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big);
-        fmt.sample_spec = audio::SampleSpec(44100, 0x3);
+        fmt.payload_type = PayloadType_Opus;
+        fmt.sample_spec = audio::SampleSpec(48000, 0x3);
         fmt.packet_flags = packet::Packet::FlagAudio;
-        fmt.new_encoder =
-            &new_encoder<audio::PcmEncoding_SInt16, audio::PcmEndian_Big, 44100, 0x3>;
-        fmt.new_decoder =
-            &new_decoder<audio::PcmEncoding_SInt16, audio::PcmEndian_Big, 44100, 0x3>;
-        add_(fmt);
+        fmt.new_encoder = &new_opus_encoder;
+        fmt.new_decoder = &new_opus_decoder;
+        if (!add_format(fmt)) {
+            roc_panic("format map: can't add built-in format");
+        }
     }
+#endif // ROC_TARGET_OPUS
 }
 
 const Format* FormatMap::format(unsigned int pt) const {
+    core::Mutex::Lock lock(mutex_);
+
     for (size_t n = 0; n < n_formats_; n++) {
         if ((unsigned int)formats_[n].payload_type == pt) {
             return &formats_[n];
@@ -76,9 +94,80 @@ const Format* FormatMap::format(unsigned int pt) const {
     return NULL;
 }
 
-void FormatMap::add_(const Format& fmt) {
-    roc_panic_if(n_formats_ == MaxFormats);
+const Format* FormatMap::find_pcm_format(const audio::PcmFormat& pcm_format,
+                                         const audio::SampleSpec& sample_spec) const {
+    core::Mutex::Lock lock(mutex_);
+
+    for (size_t n = 0; n < n_formats_; n++) {
+        const Format& fmt = formats_[n];
+
+        if (fmt.new_encoder != &new_pcm_encoder) {
+            continue;
+        }
+
+        if (fmt.pcm_format.encoding == pcm_format.encoding
+            && fmt.pcm_format.endian == pcm_format.endian
+            && fmt.sample_spec == sample_spec) {
+            return &fmt;
+        }
+    }
+
+    return NULL;
+}
+
+bool FormatMap::add_format(const Format& fmt) {
+    core::Mutex::Lock lock(mutex_);
+
+    if ((unsigned int)fmt.payload_type > 127) {
+        roc_log(LogError, "format map: invalid payload type: pt=%u",
+                (unsigned int)fmt.payload_type);
+        return false;
+    }
+
+    if (!fmt.new_encoder || !fmt.new_decoder || fmt.sample_spec.sample_rate() == 0
+        || fmt.sample_spec.num_channels() == 0) {
+        roc_log(LogError, "format map: invalid format: pt=%u",
+                (unsigned int)fmt.payload_type);
+        return false;
+    }
+
+    for (size_t n = 0; n < n_formats_; n++) {
+        if (formats_[n].payload_type == fmt.payload_type) {
+            roc_log(LogError, "format map: payload type already registered: pt=%u",
+                    (unsigned int)fmt.payload_type);
+            return false;
+        }
+    }
+
+    if (n_formats_ == MaxFormats) {
+        roc_log(LogError, "format map: too many formats: max=%lu",
+                (unsigned long)MaxFormats);
+        return false;
+    }
+
     formats_[n_formats_++] = fmt;
+
+    return true;
+}
+
+bool FormatMap::add_pcm_format(unsigned int pt,
+                               const audio::PcmFormat& pcm_format,
+                               const audio::SampleSpec& sample_spec) {
+    // check before casting to enum, which can't hold larger values
+    if (pt > 127) {
+        roc_log(LogError, "format map: invalid payload type: pt=%u", pt);
+        return false;
+    }
+
+    Format fmt;
+    fmt.payload_type = (PayloadType)pt;
+    fmt.pcm_format = pcm_format;
+    fmt.sample_spec = sample_spec;
+    fmt.packet_flags = packet::Packet::FlagAudio;
+    fmt.new_encoder = &new_pcm_encoder;
+    fmt.new_decoder = &new_pcm_decoder;
+
+    return add_format(fmt);
 }
 
 } // namespace rtp
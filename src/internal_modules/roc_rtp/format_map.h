@@ -12,6 +12,9 @@
 #ifndef ROC_RTP_FORMAT_MAP_H_
 #define ROC_RTP_FORMAT_MAP_H_
 
+#include "roc_audio/pcm_format.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_rtp/format.h"
 
@@ -19,8 +22,15 @@ namespace roc {
 namespace rtp {
 
 //! RTP payload format map.
+//! @remarks
+//!  Contains built-in formats and formats registered at runtime, e.g. for
+//!  dynamic payload types. Formats can't be removed, so pointers returned
+//!  by format() remain valid during the lifetime of the map.
+//! @note
+//!  Thread-safe.
 class FormatMap : public core::NonCopyable<> {
 public:
+    //! Initialize with built-in formats.
     FormatMap();
 
     //! Get format by payload type.
@@ -29,13 +39,36 @@ public:
     //!  registered for this payload type.
     const Format* format(unsigned int pt) const;
 
+    //! Find PCM format by sample encoding and sample spec.
+    //! @returns
+    //!  pointer to the first registered PCM format with given parameters, or
+    //!  null if there is no such format.
+    const Format* find_pcm_format(const audio::PcmFormat& pcm_format,
+                                  const audio::SampleSpec& sample_spec) const;
+
+    //! Register format.
+    //! @returns
+    //!  false if there is already a format with the same payload type,
+    //!  if the format is invalid, or if there are too many formats.
+    bool add_format(const Format& fmt);
+
+    //! Register PCM format.
+    //! @remarks
+    //!  Creates a format with given payload type, which encodes samples
+    //!  using PcmEncoder and PcmDecoder with given parameters.
+    //! @returns
+    //!  same as add_format().
+    bool add_pcm_format(unsigned int pt,
+                        const audio::PcmFormat& pcm_format,
+                        const audio::SampleSpec& sample_spec);
+
 private:
-    enum { MaxFormats = 2 };
+    enum { MaxFormats = 16 };
+
+    core::Mutex mutex_;
 
     Format formats_[MaxFormats];
     size_t n_formats_;
-
-    void add_(const Format& fmt);
 };
 
 } // namespace rtp
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/header_view.h"
+#include "roc_core/panic.h"
+#include "roc_rtp/headers.h"
+
+namespace roc {
+namespace rtp {
+
+HeaderView::HeaderView(const packet::RTP& rtp)
+    : header_(rtp.header) {
+    if (header_.size() < sizeof(Header)) {
+        roc_panic("rtp header view: header is not parsed");
+    }
+}
+
+size_t HeaderView::num_csrc() const {
+    return ((const Header*)header_.data())->num_csrc();
+}
+
+packet::source_t HeaderView::csrc(size_t index) const {
+    return ((const Header*)header_.data())->get_csrc(index);
+}
+
+bool HeaderView::has_extension() const {
+    return ((const Header*)header_.data())->has_extension();
+}
+
+uint16_t HeaderView::extension_type() const {
+    roc_panic_if_not(has_extension());
+
+    const Header& header = *(const Header*)header_.data();
+
+    return ((const ExtentionHeader*)(header_.data() + header.header_size()))->type();
+}
+
+core::Slice<uint8_t> HeaderView::extension_data() const {
+    const Header& header = *(const Header*)header_.data();
+
+    if (!header.has_extension()) {
+        return core::Slice<uint8_t>();
+    }
+
+    const size_t data_begin = header.header_size() + sizeof(ExtentionHeader);
+
+    return header_.subslice(data_begin, header_.size());
+}
+
+} // namespace rtp
+} // namespace roc
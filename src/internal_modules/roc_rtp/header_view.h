@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/header_view.h
+//! @brief RTP header view.
+
+#ifndef ROC_RTP_HEADER_VIEW_H_
+#define ROC_RTP_HEADER_VIEW_H_
+
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/rtp.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace rtp {
+
+//! RTP header view.
+//! @remarks
+//!  Parser decodes only fields needed on the receive path into packet::RTP,
+//!  and keeps the rest of the header in packet::RTP::header slice. This class
+//!  decodes CSRC list and extension from that slice on demand, directly from
+//!  packet buffer, without copying.
+//! @note
+//!  The header slice should be set by Parser, which validates it. View keeps
+//!  a reference to the slice and should not outlive the packet.
+class HeaderView {
+public:
+    //! Initialize view on header of parsed packet.
+    explicit HeaderView(const packet::RTP& rtp);
+
+    //! Get number of CSRC items.
+    size_t num_csrc() const;
+
+    //! Get CSRC item.
+    //! @pre
+    //!  @p index should be less than num_csrc().
+    packet::source_t csrc(size_t index) const;
+
+    //! Check if header has extension.
+    bool has_extension() const;
+
+    //! Get extension type.
+    //! @pre
+    //!  has_extension() should return true.
+    uint16_t extension_type() const;
+
+    //! Get extension data, without extension header.
+    //! @returns
+    //!  empty slice if there is no extension.
+    core::Slice<uint8_t> extension_data() const;
+
+private:
+    const core::Slice<uint8_t>& header_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_HEADER_VIEW_H_
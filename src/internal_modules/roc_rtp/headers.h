@@ -28,7 +28,8 @@ enum Version {
 //! RTP payload type.
 enum PayloadType {
     PayloadType_L16_Stereo = 10, //!< Audio, 16-bit samples, 2 channels, 44100 Hz.
-    PayloadType_L16_Mono = 11    //!< Audio, 16-bit samples, 1 channel, 44100 Hz.
+    PayloadType_L16_Mono = 11,   //!< Audio, 16-bit samples, 1 channel, 44100 Hz.
+    PayloadType_Opus = 96        //!< Audio, Opus, 2 channels, 48000 Hz (dynamic).
 };
 
 //! RTP header.
@@ -152,6 +153,12 @@ public:
         return (flags_ & (Flag_ExtensionMask << Flag_ExtensionShift));
     }
 
+    //! Set extension flag.
+    void set_extension(bool v) {
+        flags_ &= (uint8_t) ~(Flag_ExtensionMask << Flag_ExtensionShift);
+        flags_ |= ((v ? 1 : 0) << Flag_ExtensionShift);
+    }
+
     //! Get CSRC array size.
     uint8_t num_csrc() const {
         return ((flags_ >> Flag_CSRCShift) & Flag_CSRCMask);
@@ -246,12 +253,53 @@ public:
         return core::ntoh16u(type_);
     }
 
+    //! Set extension type.
+    void set_type(uint16_t t) {
+        type_ = core::hton16u(t);
+    }
+
     //! Get extension data size in bytes (without extension header itself).
     uint32_t data_size() const {
         return (uint32_t(core::ntoh16u(len_)) << 2);
     }
+
+    //! Set extension data size in bytes (without extension header itself).
+    //! @pre
+    //!  Size should be a multiple of 4.
+    void set_data_size(uint32_t size) {
+        roc_panic_if((size & 0x3) != 0 || (size >> 2) > (uint16_t)-1);
+        len_ = core::hton16u(uint16_t(size >> 2));
+    }
 } ROC_ATTR_PACKED_END;
 
+//! RTP header extension profiles.
+enum ExtensionProfile {
+    //! One-byte header extension elements (RFC 8285).
+    ExtProfile_OneByte = 0xBEDE
+};
+
+//! RTP header extension element IDs.
+//! @remarks
+//!  RFC 8285 maps IDs to extensions via signaling. Until it's implemented,
+//!  fixed IDs are used.
+enum ExtensionId {
+    //! Absolute capture time, NTP timestamp of the first sample in packet.
+    //! @remarks
+    //!  See http://www.webrtc.org/experiments/rtp-hdrext/abs-capture-time.
+    //!  Data is 64-bit NTP timestamp, optionally followed by 64-bit estimated
+    //!  capture clock offset, which isn't used.
+    ExtId_AbsCaptureTime = 1
+};
+
+//! Sizes of RTP header extension elements.
+enum ExtensionSize {
+    //! Size of one-byte element header.
+    ExtSize_OneByteHeader = 1,
+
+    //! Size of abs-capture-time data without clock offset.
+    ExtSize_AbsCaptureTime = 8
+};
+
 } // namespace rtp
 } // namespace roc
 
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/jitter_meter.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace rtp {
+
+JitterMeter::JitterMeter(const audio::SampleSpec& sample_spec,
+                         core::nanoseconds_t peak_window)
+    : sample_spec_(sample_spec)
+    , started_(false)
+    , prev_source_(0)
+    , prev_rtp_ts_(0)
+    , prev_recv_ts_(0)
+    , jitter_(0)
+    , transit_(0)
+    , max_seqnum_(0)
+    , max_rtp_ts_(0)
+    , peak_window_(peak_window)
+    , window_start_(0)
+    , has_prev_window_(false) {
+    if (peak_window_ <= 0) {
+        roc_panic("jitter meter: peak window should be positive");
+    }
+}
+
+void JitterMeter::update(const packet::Packet& packet) {
+    const packet::RTP* rtp = packet.rtp();
+    const packet::UDP* udp = packet.udp();
+
+    if (!rtp || !udp || udp->receive_timestamp == 0) {
+        return;
+    }
+
+    if (started_ && rtp->source == prev_source_) {
+        const core::nanoseconds_t recv_delta = udp->receive_timestamp - prev_recv_ts_;
+
+        const core::nanoseconds_t rtp_delta = sample_spec_.rtp_timestamp_2_ns(
+            packet::timestamp_diff(rtp->timestamp, prev_rtp_ts_));
+
+        core::nanoseconds_t transit_delta = recv_delta - rtp_delta;
+
+        transit_ += transit_delta;
+
+        if (transit_delta < 0) {
+            transit_delta = -transit_delta;
+        }
+
+        jitter_ += (transit_delta - jitter_) / 16;
+
+        update_peaks_(packet, transit_);
+    } else {
+        reset_(packet);
+    }
+
+    started_ = true;
+    prev_source_ = rtp->source;
+    prev_rtp_ts_ = rtp->timestamp;
+    prev_recv_ts_ = udp->receive_timestamp;
+}
+
+core::nanoseconds_t JitterMeter::jitter() const {
+    return jitter_;
+}
+
+bool JitterMeter::has_peaks() const {
+    return has_prev_window_;
+}
+
+core::nanoseconds_t JitterMeter::peak_delay() const {
+    return std::max(cur_window_.max_transit, prev_window_.max_transit)
+        - std::min(cur_window_.min_transit, prev_window_.min_transit);
+}
+
+core::nanoseconds_t JitterMeter::peak_burst() const {
+    return std::max(cur_window_.max_burst, prev_window_.max_burst);
+}
+
+void JitterMeter::reset_(const packet::Packet& packet) {
+    jitter_ = 0;
+    transit_ = 0;
+
+    max_seqnum_ = packet.rtp()->seqnum;
+    max_rtp_ts_ = packet.rtp()->timestamp;
+
+    window_start_ = packet.udp()->receive_timestamp;
+    cur_window_ = Window();
+    prev_window_ = Window();
+    has_prev_window_ = false;
+}
+
+void JitterMeter::update_peaks_(const packet::Packet& packet,
+                                core::nanoseconds_t transit) {
+    const core::nanoseconds_t now = packet.udp()->receive_timestamp;
+
+    if (now - window_start_ >= peak_window_) {
+        prev_window_ = cur_window_;
+        has_prev_window_ = true;
+
+        cur_window_ = Window();
+        cur_window_.min_transit = transit;
+        cur_window_.max_transit = transit;
+        window_start_ = now;
+    }
+
+    cur_window_.min_transit = std::min(cur_window_.min_transit, transit);
+    cur_window_.max_transit = std::max(cur_window_.max_transit, transit);
+
+    const packet::seqnum_diff_t seqnum_dist =
+        packet::seqnum_diff(packet.rtp()->seqnum, max_seqnum_);
+
+    if (seqnum_dist <= 0) {
+        return;
+    }
+
+    if (seqnum_dist > 1) {
+        // duration of missing packets between previous and this one
+        const core::nanoseconds_t gap = sample_spec_.rtp_timestamp_2_ns(
+            packet::timestamp_diff(packet.rtp()->timestamp, max_rtp_ts_));
+        const core::nanoseconds_t burst = gap - gap / seqnum_dist;
+
+        cur_window_.max_burst = std::max(cur_window_.max_burst, burst);
+    }
+
+    max_seqnum_ = packet.rtp()->seqnum;
+    max_rtp_ts_ = packet.rtp()->timestamp;
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/jitter_meter.h
+//! @brief RTP interarrival jitter meter.
+
+#ifndef ROC_RTP_JITTER_METER_H_
+#define ROC_RTP_JITTER_METER_H_
+
+#include "roc_audio/sample_spec.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
+#include "roc_packet/packet.h"
+
+namespace roc {
+namespace rtp {
+
+//! RTP interarrival jitter meter.
+//!
+//! Estimates interarrival jitter as defined in RFC 3550, section 6.4.1:
+//! a running average of the difference between spacing of packets at the
+//! receiver and spacing of their RTP timestamps, with gain 1/16.
+//!
+//! Uses receive timestamps stamped by network loop, so neither packet
+//! queueing inside the pipeline nor the moment when pipeline gets to the
+//! packet affect the result.
+//!
+//! Additionally computes peak values over a sliding window of receive time,
+//! which tell how much latency is needed to absorb network delays:
+//!  - peak delay variation, difference between maximum and minimum transit
+//!    time of packets within window
+//!  - peak loss burst, longest gap in sequence numbers of arrived packets;
+//!    packets that arrive out of order later are counted as lost too, since
+//!    they would be late without extra latency
+//!
+//! A peak is forgotten after one to two windows.
+class JitterMeter : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p sample_spec is used to convert RTP timestamps to nanoseconds.
+    //!  @p peak_window defines length of window for peak values.
+    explicit JitterMeter(const audio::SampleSpec& sample_spec,
+                         core::nanoseconds_t peak_window = 10 * core::Second);
+
+    //! Update jitter with next received packet.
+    //! @remarks
+    //!  Packets should be passed in order of arrival. Packets without RTP
+    //!  header or receive timestamp are ignored. When source id changes,
+    //!  the meter starts over.
+    void update(const packet::Packet& packet);
+
+    //! Get current jitter estimate.
+    core::nanoseconds_t jitter() const;
+
+    //! Check if peak values cover at least one full window.
+    bool has_peaks() const;
+
+    //! Get peak delay variation, nanoseconds.
+    core::nanoseconds_t peak_delay() const;
+
+    //! Get peak loss burst duration, nanoseconds.
+    core::nanoseconds_t peak_burst() const;
+
+private:
+    struct Window {
+        core::nanoseconds_t min_transit;
+        core::nanoseconds_t max_transit;
+        core::nanoseconds_t max_burst;
+
+        Window()
+            : min_transit(0)
+            , max_transit(0)
+            , max_burst(0) {
+        }
+    };
+
+    void reset_(const packet::Packet& packet);
+    void update_peaks_(const packet::Packet& packet, core::nanoseconds_t transit);
+
+    const audio::SampleSpec sample_spec_;
+
+    bool started_;
+    packet::source_t prev_source_;
+    packet::timestamp_t prev_rtp_ts_;
+    core::nanoseconds_t prev_recv_ts_;
+
+    core::nanoseconds_t jitter_;
+
+    // transit time relative to transit time of first packet
+    core::nanoseconds_t transit_;
+
+    // packet with highest seqnum so far
+    packet::seqnum_t max_seqnum_;
+    packet::timestamp_t max_rtp_ts_;
+
+    const core::nanoseconds_t peak_window_;
+    core::nanoseconds_t window_start_;
+    Window cur_window_;
+    Window prev_window_;
+    bool has_prev_window_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_JITTER_METER_H_
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/loss_meter.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace rtp {
+
+LossMeter::LossMeter()
+    : started_(false)
+    , source_(0)
+    , base_seqnum_(0)
+    , max_seqnum_(0)
+    , seqnum_cycles_(0)
+    , received_(0)
+    , expected_prior_(0)
+    , received_prior_(0)
+    , report_begin_(0)
+    , report_dups_(0) {
+    reset_report_(0);
+}
+
+void LossMeter::update(const packet::Packet& packet) {
+    const packet::RTP* rtp = packet.rtp();
+    if (!rtp) {
+        return;
+    }
+
+    if (!started_ || rtp->source != source_) {
+        started_ = true;
+        source_ = rtp->source;
+        base_seqnum_ = rtp->seqnum;
+        max_seqnum_ = rtp->seqnum;
+        seqnum_cycles_ = 0;
+        received_ = 0;
+        expected_prior_ = 0;
+        received_prior_ = 0;
+        reset_report_(base_seqnum_);
+        report_dups_ = 0;
+    } else if (packet::seqnum_lt(max_seqnum_, rtp->seqnum)) {
+        if (rtp->seqnum < max_seqnum_) {
+            // seqnum wrapped
+            seqnum_cycles_ += (uint32_t)1 << 16;
+        }
+        max_seqnum_ = rtp->seqnum;
+    }
+
+    received_++;
+
+    mark_received_(uint32_t((int64_t)ext_seqnum()
+                            + packet::seqnum_diff(rtp->seqnum, max_seqnum_)));
+}
+
+bool LossMeter::started() const {
+    return started_;
+}
+
+uint32_t LossMeter::ext_seqnum() const {
+    return seqnum_cycles_ + max_seqnum_;
+}
+
+int64_t LossMeter::cum_loss() const {
+    return (int64_t)expected_() - (int64_t)received_;
+}
+
+float LossMeter::report_fract_loss() {
+    const uint32_t expected = expected_();
+
+    const uint32_t expected_interval = expected - expected_prior_;
+    const uint32_t received_interval = received_ - received_prior_;
+
+    expected_prior_ = expected;
+    received_prior_ = received_;
+
+    if (expected_interval == 0 || received_interval >= expected_interval) {
+        return 0;
+    }
+
+    return float(expected_interval - received_interval) / float(expected_interval);
+}
+
+size_t LossMeter::report_loss_runs(uint32_t& begin_seqnum,
+                                   uint16_t* runs,
+                                   const size_t max_runs) {
+    roc_panic_if_not(runs);
+
+    begin_seqnum = report_begin_;
+
+    size_t n_packets = 0;
+    if (started_ && (int32_t)(ext_seqnum() - report_begin_) >= 0) {
+        n_packets = std::min((size_t)(ext_seqnum() - report_begin_) + 1,
+                             (size_t)MaxReportPackets);
+    }
+
+    size_t n_runs = 0;
+    size_t n_covered = 0;
+
+    while (n_covered < n_packets && n_runs < max_runs) {
+        // even runs are received packets, odd runs are lost packets
+        const bool received = (n_runs % 2 == 0);
+
+        size_t run = 0;
+        while (n_covered + run < n_packets && is_received_(n_covered + run) == received) {
+            run++;
+        }
+
+        runs[n_runs++] = (uint16_t)run;
+        n_covered += run;
+    }
+
+    advance_report_(n_covered);
+
+    return n_runs;
+}
+
+uint32_t LossMeter::report_dup_packets() {
+    const uint32_t dups = report_dups_;
+    report_dups_ = 0;
+    return dups;
+}
+
+void LossMeter::reset_report_(uint32_t begin_seqnum) {
+    report_begin_ = begin_seqnum;
+    memset(report_bits_, 0, sizeof(report_bits_));
+}
+
+void LossMeter::advance_report_(size_t n_packets) {
+    // keep reception state of packets that were not covered by report
+    for (size_t offset = 0; offset < (size_t)MaxReportPackets; offset++) {
+        const bool received = offset + n_packets < (size_t)MaxReportPackets
+            && is_received_(offset + n_packets);
+
+        uint32_t& word = report_bits_[offset / 32];
+        const uint32_t bit = (uint32_t)1 << (offset % 32);
+
+        word = received ? (word | bit) : (word & ~bit);
+    }
+
+    report_begin_ += (uint32_t)n_packets;
+}
+
+void LossMeter::mark_received_(uint32_t ext_seqnum) {
+    const int32_t offset = (int32_t)(ext_seqnum - report_begin_);
+    if (offset < 0 || offset >= (int32_t)MaxReportPackets) {
+        // already reported or too far ahead
+        return;
+    }
+
+    uint32_t& word = report_bits_[offset / 32];
+    const uint32_t bit = (uint32_t)1 << (offset % 32);
+
+    if (word & bit) {
+        report_dups_++;
+    }
+    word |= bit;
+}
+
+bool LossMeter::is_received_(size_t offset) const {
+    return (report_bits_[offset / 32] & ((uint32_t)1 << (offset % 32))) != 0;
+}
+
+uint32_t LossMeter::expected_() const {
+    if (!started_) {
+        return 0;
+    }
+    return ext_seqnum() - base_seqnum_ + 1;
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/loss_meter.h
+//! @brief RTP packet loss meter.
+
+#ifndef ROC_RTP_LOSS_METER_H_
+#define ROC_RTP_LOSS_METER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/packet.h"
+
+namespace roc {
+namespace rtp {
+
+//! RTP packet loss meter.
+//!
+//! Computes reception statistics as defined in RFC 3550, appendix A.3:
+//!  - extended highest sequence number, which counts seqnum wraps
+//!  - cumulative number of lost packets, i.e. the number of expected packets
+//!    minus the number of received packets; may be negative if packets are
+//!    duplicated
+//!  - fraction of packets lost since previous report
+//!
+//! Additionally keeps per-packet reception state since previous report, which
+//! is used for RTCP XR loss run-length and duplicate reporting (RFC 3611).
+class LossMeter : public core::NonCopyable<> {
+public:
+    //! Maximum number of packets covered by one loss runs report.
+    enum { MaxReportPackets = 2048 };
+
+    //! Initialize.
+    LossMeter();
+
+    //! Update statistics with next received packet.
+    //! @remarks
+    //!  Packets without RTP header are ignored. When source id changes,
+    //!  the meter starts over.
+    void update(const packet::Packet& packet);
+
+    //! Check if at least one packet was received.
+    bool started() const;
+
+    //! Get extended highest sequence number received.
+    uint32_t ext_seqnum() const;
+
+    //! Get cumulative number of lost packets.
+    int64_t cum_loss() const;
+
+    //! Get fraction of packets lost since previous call.
+    //! @remarks
+    //!  Intended to be called once per reception report. Returns zero if
+    //!  no packets were expected or if there were duplicates instead of losses.
+    float report_fract_loss();
+
+    //! Get loss runs since previous call.
+    //! @remarks
+    //!  Intended to be called once per reception report. Fills @p runs with
+    //!  lengths of alternating runs of received and lost packets, starting
+    //!  with a run of received packets, which may be empty. Sets @p begin_seqnum
+    //!  to extended seqnum of the first covered packet and returns number of
+    //!  runs. Covered range is truncated if it doesn't fit into @p max_runs
+    //!  or MaxReportPackets. Late packets are accounted if they arrive before
+    //!  the call.
+    size_t
+    report_loss_runs(uint32_t& begin_seqnum, uint16_t* runs, const size_t max_runs);
+
+    //! Get number of duplicate packets since previous call.
+    //! @remarks
+    //!  Only duplicates of packets not yet covered by report_loss_runs()
+    //!  can be detected.
+    uint32_t report_dup_packets();
+
+private:
+    enum { ReportWords = MaxReportPackets / 32 };
+
+    uint32_t expected_() const;
+
+    void reset_report_(uint32_t begin_seqnum);
+    void advance_report_(size_t n_packets);
+    void mark_received_(uint32_t ext_seqnum);
+    bool is_received_(size_t offset) const;
+
+    bool started_;
+    packet::source_t source_;
+
+    uint32_t base_seqnum_;
+    packet::seqnum_t max_seqnum_;
+    uint32_t seqnum_cycles_;
+
+    uint32_t received_;
+
+    uint32_t expected_prior_;
+    uint32_t received_prior_;
+
+    uint32_t report_begin_;
+    uint32_t report_bits_[ReportWords];
+    uint32_t report_dups_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_LOSS_METER_H_
@@ -7,7 +7,9 @@
  */
 
 #include "roc_rtp/parser.h"
+#include "roc_core/endian.h"
 #include "roc_core/log.h"
+#include "roc_core/stddefs.h"
 #include "roc_rtp/headers.h"
 
 namespace roc {
@@ -15,7 +17,8 @@ namespace rtp {
 
 Parser::Parser(const FormatMap& format_map, packet::IParser* inner_parser)
     : format_map_(format_map)
-    , inner_parser_(inner_parser) {
+    , inner_parser_(inner_parser)
+    , last_format_(NULL) {
 }
 
 bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
@@ -45,11 +48,12 @@ bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
         return false;
     }
 
+    const ExtentionHeader* extension = NULL;
+
     if (header.has_extension()) {
-        const ExtentionHeader& extension =
-            *(const ExtentionHeader*)(buffer.data() + header.header_size());
+        extension = (const ExtentionHeader*)(buffer.data() + header.header_size());
 
-        header_size += extension.data_size();
+        header_size += extension->data_size();
     }
 
     if (buffer.size() < header_size) {
@@ -96,6 +100,7 @@ bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
     rtp.timestamp = header.timestamp();
     rtp.marker = header.marker();
     rtp.payload_type = header.payload_type();
+    rtp.capture_timestamp = 0;
     rtp.header = buffer.subslice(0, header_size);
     rtp.payload = buffer.subslice(payload_begin, payload_end);
 
@@ -103,7 +108,12 @@ bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
         rtp.padding = buffer.subslice(payload_end, payload_end + pad_size);
     }
 
-    if (const Format* format = format_map_.format(header.payload_type())) {
+    if (extension && extension->type() == ExtProfile_OneByte) {
+        parse_extension_(rtp, (const uint8_t*)extension + sizeof(ExtentionHeader),
+                         extension->data_size());
+    }
+
+    if (const Format* format = find_format_(header.payload_type())) {
         packet.add_flags(format->packet_flags);
     }
 
@@ -114,5 +124,55 @@ bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
     return true;
 }
 
+// RFC 8285 one-byte elements; unknown elements are skipped
+void Parser::parse_extension_(packet::RTP& rtp, const uint8_t* data, size_t size) {
+    size_t pos = 0;
+
+    while (pos < size) {
+        if (data[pos] == 0) {
+            // padding
+            pos++;
+            continue;
+        }
+
+        const uint8_t id = data[pos] >> 4;
+        const size_t len = size_t(data[pos] & 0xf) + 1;
+
+        if (id == 0xf) {
+            // reserved, stop parsing
+            break;
+        }
+
+        pos += ExtSize_OneByteHeader;
+
+        if (pos + len > size) {
+            roc_log(LogDebug, "rtp parser: bad extension element: id=%u len=%lu",
+                    (unsigned)id, (unsigned long)len);
+            break;
+        }
+
+        if (id == ExtId_AbsCaptureTime && len >= ExtSize_AbsCaptureTime) {
+            uint64_t capture_ts = 0;
+            memcpy(&capture_ts, data + pos, sizeof(capture_ts));
+            rtp.capture_timestamp = core::ntoh64u(capture_ts);
+        }
+
+        pos += len;
+    }
+}
+
+const Format* Parser::find_format_(unsigned int pt) {
+    if (last_format_ && (unsigned int)last_format_->payload_type == pt) {
+        return last_format_;
+    }
+
+    const Format* format = format_map_.format(pt);
+    if (format) {
+        last_format_ = format;
+    }
+
+    return format;
+}
+
 } // namespace rtp
 } // namespace roc
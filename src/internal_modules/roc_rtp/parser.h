@@ -20,6 +20,11 @@ namespace roc {
 namespace rtp {
 
 //! RTP packet parser.
+//! @remarks
+//!  Decodes fixed header fields into packet::RTP and sets up header, payload,
+//!  and padding slices pointing into packet buffer. Known RFC 8285 header
+//!  extension elements are decoded too. CSRC list and raw header extension
+//!  are not decoded; use HeaderView to access them on demand.
 class Parser : public packet::IParser, public core::NonCopyable<> {
 public:
     //! Initialization.
@@ -35,8 +40,15 @@ public:
     virtual bool parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer);
 
 private:
+    void parse_extension_(packet::RTP& rtp, const uint8_t* data, size_t size);
+    const Format* find_format_(unsigned int pt);
+
     const FormatMap& format_map_;
     packet::IParser* inner_parser_;
+
+    // format of last parsed packet, to avoid locking the map every packet;
+    // formats are never removed from the map, so the pointer remains valid
+    const Format* last_format_;
 };
 
 } // namespace rtp
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/recorder.h"
+#include "roc_core/attributes.h"
+#include "roc_core/endian.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+// Size of stdio buffer of the file.
+// Packets are appended to the buffer and flushed to disk in large chunks.
+enum { FileBufferSize = 64 * 1024 };
+
+// Interval between index entries, in milliseconds of stream time.
+enum { IndexIntervalMs = 1000 };
+
+// First line of index. Following lines have format:
+//  <offset_ms> <rtp_timestamp> <seqnum> <file_offset>
+const char* IndexHeader = "# roc rtpdump index v1";
+
+// File header following the first text line, as defined by rtptools.
+ROC_ATTR_PACKED_BEGIN struct FileHeader {
+    uint32_t start_sec;
+    uint32_t start_usec;
+    uint32_t source;
+    uint16_t port;
+    uint16_t padding;
+} ROC_ATTR_PACKED_END;
+
+// Header of every record, as defined by rtptools.
+ROC_ATTR_PACKED_BEGIN struct RecordHeader {
+    uint16_t length;
+    uint16_t plen;
+    uint32_t offset;
+} ROC_ATTR_PACKED_END;
+
+} // namespace
+
+Recorder::Recorder(packet::IReader& reader,
+                   const char* path,
+                   const char* host,
+                   int port,
+                   const audio::SampleSpec& sample_spec)
+    : reader_(reader)
+    , sample_spec_(sample_spec)
+    , file_(NULL)
+    , index_(NULL)
+    , file_offset_(0)
+    , has_first_ts_(false)
+    , last_ts_(0)
+    , stream_offset_(0)
+    , next_index_ms_(0)
+    , n_packets_(0) {
+    roc_panic_if(!path);
+    roc_panic_if(!host);
+
+    if (snprintf(path_, sizeof(path_), "%s", path) >= (int)sizeof(path_)) {
+        roc_log(LogError, "rtp recorder: path too long: path=%s", path);
+        return;
+    }
+
+    char index_path[PathSize + 8];
+    snprintf(index_path, sizeof(index_path), "%s.idx", path_);
+
+    file_ = fopen(path_, "wb");
+    if (!file_) {
+        roc_log(LogError, "rtp recorder: can't open file: path=%s: %s", path_,
+                core::errno_to_str(errno).c_str());
+        return;
+    }
+
+    setvbuf(file_, NULL, _IOFBF, FileBufferSize);
+
+    index_ = fopen(index_path, "w");
+    if (!index_) {
+        roc_log(LogError, "rtp recorder: can't open index: path=%s: %s", index_path,
+                core::errno_to_str(errno).c_str());
+        close_();
+        return;
+    }
+
+    if (!write_header_(host, port) || fprintf(index_, "%s\n", IndexHeader) < 0) {
+        roc_log(LogError, "rtp recorder: can't write header: path=%s", path_);
+        close_();
+        return;
+    }
+
+    roc_log(LogInfo, "rtp recorder: started recording: path=%s", path_);
+}
+
+Recorder::~Recorder() {
+    if (file_) {
+        roc_log(LogInfo, "rtp recorder: finished recording: path=%s n_packets=%lu",
+                path_, (unsigned long)n_packets_);
+    }
+    close_();
+}
+
+bool Recorder::valid() const {
+    return file_;
+}
+
+size_t Recorder::num_packets() const {
+    return n_packets_;
+}
+
+packet::PacketPtr Recorder::read() {
+    packet::PacketPtr packet = reader_.read();
+    if (!packet) {
+        return NULL;
+    }
+
+    if (!packet->rtp()) {
+        roc_panic("rtp recorder: unexpected non-rtp packet");
+    }
+
+    if (file_) {
+        write_packet_(*packet);
+    }
+
+    return packet;
+}
+
+bool Recorder::write_header_(const char* host, int port) {
+    if (fprintf(file_, "#!rtpplay1.0 %s/%d\n", host, port) < 0) {
+        return false;
+    }
+
+    file_offset_ = (uint64_t)ftell(file_);
+
+    const core::nanoseconds_t start = core::timestamp(core::ClockUnix);
+
+    FileHeader hdr;
+    hdr.start_sec = core::hton32u(uint32_t(start / core::Second));
+    hdr.start_usec = core::hton32u(uint32_t(start % core::Second / core::Microsecond));
+    hdr.source = 0;
+    hdr.port = core::hton16u((uint16_t)port);
+    hdr.padding = 0;
+
+    return write_(&hdr, sizeof(hdr));
+}
+
+void Recorder::write_packet_(const packet::Packet& packet) {
+    const packet::RTP& rtp = *packet.rtp();
+
+    // header, payload, and padding are adjacent slices of the same buffer
+    const uint8_t* begin = rtp.header.data();
+    const uint8_t* end = rtp.padding ? rtp.padding.data() + rtp.padding.size()
+                                     : rtp.payload.data() + rtp.payload.size();
+
+    const size_t size = size_t(end - begin);
+
+    if (size + sizeof(RecordHeader) > (size_t)UINT16_MAX) {
+        roc_log(LogDebug, "rtp recorder: skipping too large packet: size=%lu",
+                (unsigned long)size);
+        return;
+    }
+
+    if (!has_first_ts_) {
+        has_first_ts_ = true;
+    } else {
+        // packets are ordered, but keep offsets monotonic anyway
+        const packet::timestamp_diff_t delta =
+            packet::timestamp_diff(rtp.timestamp, last_ts_);
+        if (delta > 0) {
+            stream_offset_ += (uint64_t)delta;
+        }
+    }
+    last_ts_ = rtp.timestamp;
+
+    const uint64_t offset_ms = stream_offset_ * 1000 / sample_spec_.sample_rate();
+
+    if (offset_ms >= next_index_ms_) {
+        if (fprintf(index_, "%lu %lu %u %llu\n", (unsigned long)offset_ms,
+                    (unsigned long)rtp.timestamp, (unsigned)rtp.seqnum,
+                    (unsigned long long)file_offset_)
+            < 0) {
+            roc_log(LogError, "rtp recorder: can't write index, stopping: path=%s",
+                    path_);
+            close_();
+            return;
+        }
+        next_index_ms_ = offset_ms - offset_ms % IndexIntervalMs + IndexIntervalMs;
+    }
+
+    RecordHeader hdr;
+    hdr.length = core::hton16u(uint16_t(size + sizeof(RecordHeader)));
+    hdr.plen = core::hton16u((uint16_t)size);
+    hdr.offset = core::hton32u((uint32_t)offset_ms);
+
+    if (!write_(&hdr, sizeof(hdr)) || !write_(begin, size)) {
+        roc_log(LogError, "rtp recorder: can't write file, stopping: path=%s", path_);
+        close_();
+        return;
+    }
+
+    n_packets_++;
+}
+
+bool Recorder::write_(const void* data, size_t size) {
+    if (fwrite(data, 1, size, file_) != size) {
+        return false;
+    }
+    file_offset_ += size;
+    return true;
+}
+
+void Recorder::close_() {
+    if (file_) {
+        if (fclose(file_) != 0) {
+            roc_log(LogError, "rtp recorder: can't close file: path=%s", path_);
+        }
+        file_ = NULL;
+    }
+    if (index_) {
+        fclose(index_);
+        index_ = NULL;
+    }
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/recorder.h
+//! @brief RTP recorder.
+
+#ifndef ROC_RTP_RECORDER_H_
+#define ROC_RTP_RECORDER_H_
+
+#include "roc_audio/sample_spec.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/ireader.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace rtp {
+
+//! RTP recorder.
+//! @remarks
+//!  Passes packets from nested reader through and writes them to a file in
+//!  rtpdump format, supported by rtptools and Wireshark. Packets are written
+//!  as is, including RTP header and padding, without decoding, so recording
+//!  costs about one memcpy per packet.
+//!
+//!  Offsets of records are computed from RTP timestamps, so that replaying
+//!  the file reproduces stream timing without network jitter.
+//!
+//!  Along with the file, a text index with ".idx" suffix is written, which
+//!  maps stream time to record position approximately every second, and
+//!  allows to seek in the file without scanning it.
+//!
+//!  If the file can't be written, recording stops, but packets are still
+//!  passed through.
+class Recorder : public packet::IReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Creates file at @p path and index at @p path with ".idx" suffix.
+    //!  @p host and @p port identify sender and are written to file header.
+    Recorder(packet::IReader& reader,
+             const char* path,
+             const char* host,
+             int port,
+             const audio::SampleSpec& sample_spec);
+
+    ~Recorder();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Read next packet.
+    //! @remarks
+    //!  Reads packet from nested reader and appends it to file.
+    virtual packet::PacketPtr read();
+
+    //! Get number of recorded packets.
+    size_t num_packets() const;
+
+private:
+    enum { PathSize = 512 };
+
+    bool write_header_(const char* host, int port);
+    void write_packet_(const packet::Packet& packet);
+    bool write_(const void* data, size_t size);
+    void close_();
+
+    packet::IReader& reader_;
+
+    const audio::SampleSpec sample_spec_;
+
+    FILE* file_;
+    FILE* index_;
+
+    char path_[PathSize];
+
+    uint64_t file_offset_;
+
+    bool has_first_ts_;
+    packet::timestamp_t last_ts_;
+    uint64_t stream_offset_;
+    uint64_t next_index_ms_;
+
+    size_t n_packets_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_RECORDER_H_
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/srtp_config.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { KeySaltSize = SrtpConfig::MasterKeySize + SrtpConfig::MasterSaltSize };
+
+int decode_base64_char(char c) {
+    if (c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    }
+    if (c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    }
+    if (c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    }
+    if (c == '+') {
+        return 62;
+    }
+    if (c == '/') {
+        return 63;
+    }
+    return -1;
+}
+
+} // namespace
+
+bool parse_srtp_key(const char* str, SrtpConfig& config) {
+    roc_panic_if(!str);
+
+    uint8_t key_salt[KeySaltSize];
+    size_t key_salt_size = 0;
+
+    uint32_t bits = 0;
+    size_t n_bits = 0;
+
+    const char* ptr = str;
+
+    for (; *ptr != '\0' && *ptr != '='; ptr++) {
+        const int value = decode_base64_char(*ptr);
+        if (value < 0) {
+            roc_log(LogError, "srtp config: invalid character in key: pos=%lu",
+                    (unsigned long)(ptr - str));
+            return false;
+        }
+
+        bits = (bits << 6) | (uint32_t)value;
+        n_bits += 6;
+
+        if (n_bits >= 8) {
+            n_bits -= 8;
+            if (key_salt_size == KeySaltSize) {
+                roc_log(LogError, "srtp config: key is too long: expected=%d bytes",
+                        (int)KeySaltSize);
+                return false;
+            }
+            key_salt[key_salt_size++] = (uint8_t)(bits >> n_bits);
+        }
+    }
+
+    for (; *ptr == '='; ptr++) {
+    }
+
+    if (*ptr != '\0') {
+        roc_log(LogError, "srtp config: invalid trailing characters in key");
+        return false;
+    }
+
+    if (key_salt_size != KeySaltSize) {
+        roc_log(LogError,
+                "srtp config: invalid key length: expected=%d bytes actual=%lu bytes",
+                (int)KeySaltSize, (unsigned long)key_salt_size);
+        return false;
+    }
+
+    memcpy(config.master_key, key_salt, SrtpConfig::MasterKeySize);
+    memcpy(config.master_salt, key_salt + SrtpConfig::MasterKeySize,
+           SrtpConfig::MasterSaltSize);
+    config.enabled = true;
+
+    return true;
+}
+
+} // namespace rtp
+} // namespace roc
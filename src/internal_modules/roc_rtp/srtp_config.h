@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/srtp_config.h
+//! @brief SRTP config.
+
+#ifndef ROC_RTP_SRTP_CONFIG_H_
+#define ROC_RTP_SRTP_CONFIG_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace rtp {
+
+//! SRTP parameters.
+//! @remarks
+//!  Uses AES_CM_128_HMAC_SHA1_80 crypto suite (RFC 3711) with pre-shared
+//!  master key and salt, and key derivation rate zero.
+struct SrtpConfig {
+    //! Sizes of master key parameters.
+    enum {
+        MasterKeySize = 16, //!< Master key size, in bytes.
+        MasterSaltSize = 14 //!< Master salt size, in bytes.
+    };
+
+    //! Enable SRTP and SRTCP.
+    bool enabled;
+
+    //! Master key.
+    uint8_t master_key[MasterKeySize];
+
+    //! Master salt.
+    uint8_t master_salt[MasterSaltSize];
+
+    SrtpConfig()
+        : enabled(false) {
+        memset(master_key, 0, sizeof(master_key));
+        memset(master_salt, 0, sizeof(master_salt));
+    }
+};
+
+//! Parse SRTP master key and salt.
+//! @remarks
+//!  @p str is base64 encoding of concatenated master key and salt, like in
+//!  "inline:" key parameter of SDP "crypto" attribute (RFC 4568). On success,
+//!  fills key and salt and enables SRTP in @p config.
+//! @returns
+//!  false if string has invalid format or length.
+bool parse_srtp_key(const char* str, SrtpConfig& config);
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_SRTP_CONFIG_H_
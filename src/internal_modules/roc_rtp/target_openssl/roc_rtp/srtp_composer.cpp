@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/srtp_composer.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace rtp {
+
+SrtpComposer::SrtpComposer(const SrtpConfig& config,
+                           SrtpProtocol proto,
+                           packet::IComposer& inner_composer)
+    : context_(config, proto)
+    , inner_composer_(inner_composer) {
+}
+
+bool SrtpComposer::valid() const {
+    return context_.valid();
+}
+
+bool SrtpComposer::align(core::Slice<uint8_t>& buffer,
+                         size_t header_size,
+                         size_t payload_alignment) {
+    roc_panic_if(!valid());
+
+    // srtp adds only trailer, so headers are not affected
+    return inner_composer_.align(buffer, header_size, payload_alignment);
+}
+
+bool SrtpComposer::prepare(packet::Packet& packet,
+                           core::Slice<uint8_t>& buffer,
+                           size_t payload_size) {
+    roc_panic_if(!valid());
+
+    if (!inner_composer_.prepare(packet, buffer, payload_size)) {
+        return false;
+    }
+
+    const size_t packet_size = buffer.size() + context_.overhead();
+
+    if (buffer.capacity() < packet_size) {
+        roc_log(LogDebug,
+                "srtp composer: not enough space for srtp trailer: size=%lu cap=%lu",
+                (unsigned long)packet_size, (unsigned long)buffer.capacity());
+        return false;
+    }
+
+    buffer.reslice(0, packet_size);
+
+    return true;
+}
+
+bool SrtpComposer::pad(packet::Packet& packet, size_t padding_size) {
+    roc_panic_if(!valid());
+
+    return inner_composer_.pad(packet, padding_size);
+}
+
+bool SrtpComposer::compose(packet::Packet& packet) {
+    roc_panic_if(!valid());
+
+    if (!inner_composer_.compose(packet)) {
+        return false;
+    }
+
+    core::Slice<uint8_t> data = packet.data();
+    if (!data) {
+        roc_panic("srtp composer: unexpected packet without data");
+    }
+
+    return context_.protect(data);
+}
+
+} // namespace rtp
+} // namespace roc
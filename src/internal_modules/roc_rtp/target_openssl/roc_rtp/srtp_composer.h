@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/target_openssl/roc_rtp/srtp_composer.h
+//! @brief SRTP packet composer.
+
+#ifndef ROC_RTP_SRTP_COMPOSER_H_
+#define ROC_RTP_SRTP_COMPOSER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_packet/icomposer.h"
+#include "roc_rtp/srtp_config.h"
+#include "roc_rtp/srtp_context.h"
+
+namespace roc {
+namespace rtp {
+
+//! SRTP packet composer.
+//! @remarks
+//!  Reserves space for SRTP or SRTCP trailer after the packet prepared by
+//!  @p inner_composer, and after @p inner_composer composes the packet,
+//!  encrypts and authenticates it in place.
+class SrtpComposer : public packet::IComposer, public core::NonCopyable<> {
+public:
+    //! Initialization.
+    SrtpComposer(const SrtpConfig& config,
+                 SrtpProtocol proto,
+                 packet::IComposer& inner_composer);
+
+    //! Check if composer was successfully initialized.
+    bool valid() const;
+
+    //! Adjust buffer to align payload.
+    virtual bool
+    align(core::Slice<uint8_t>& buffer, size_t header_size, size_t payload_alignment);
+
+    //! Prepare buffer for composing a packet.
+    virtual bool
+    prepare(packet::Packet& packet, core::Slice<uint8_t>& buffer, size_t payload_size);
+
+    //! Pad packet.
+    virtual bool pad(packet::Packet& packet, size_t padding_size);
+
+    //! Compose packet to buffer.
+    virtual bool compose(packet::Packet& packet);
+
+private:
+    SrtpContext context_;
+    packet::IComposer& inner_composer_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_SRTP_COMPOSER_H_
@@ -0,0 +1,643 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/srtp_context.h"
+#include "roc_core/endian.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_rtp/headers.h"
+
+#include <openssl/crypto.h>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+// key derivation labels, RFC 3711 4.3.1
+enum {
+    Label_RtpEncryption = 0x00,
+    Label_RtpAuth = 0x01,
+    Label_RtpSalt = 0x02,
+    Label_RtcpEncryption = 0x03,
+    Label_RtcpAuth = 0x04,
+    Label_RtcpSalt = 0x05
+};
+
+enum { IvSize = 16, DigestSize = 20 };
+
+// size of RTCP header and sender SSRC, which are not encrypted
+enum { RtcpPlainSize = 8 };
+
+// flag in SRTCP trailer telling that packet is encrypted
+const uint32_t SrtcpEncryptedFlag = 0x80000000;
+
+const uint32_t SrtcpIndexMask = 0x7FFFFFFF;
+
+// how many rollover counter values to try for an unknown stream, so that
+// receiver can join a sender that is already running for a while
+const uint32_t MaxRocSearch = 64;
+
+void write_u32(uint8_t* data, uint32_t value) {
+    const uint32_t be_value = core::hton32u(value);
+    memcpy(data, &be_value, sizeof(be_value));
+}
+
+uint32_t read_u32(const uint8_t* data) {
+    uint32_t be_value = 0;
+    memcpy(&be_value, data, sizeof(be_value));
+    return core::ntoh32u(be_value);
+}
+
+bool rtp_header_size(const uint8_t* data, size_t size, size_t& header_size) {
+    if (size < sizeof(Header)) {
+        return false;
+    }
+
+    const Header& header = *(const Header*)data;
+
+    if (header.version() != V2) {
+        return false;
+    }
+
+    header_size = header.header_size();
+
+    if (header.has_extension()) {
+        if (size < header_size + sizeof(ExtentionHeader)) {
+            return false;
+        }
+
+        const ExtentionHeader& extension =
+            *(const ExtentionHeader*)(data + header_size);
+
+        header_size += sizeof(ExtentionHeader) + extension.data_size();
+    }
+
+    return size >= header_size;
+}
+
+// AES-CM PRF from RFC 3711 4.3.3, with key derivation rate zero
+bool derive_key(const SrtpConfig& config, uint8_t label, uint8_t* key, size_t size) {
+    uint8_t iv[IvSize] = {};
+    memcpy(iv, config.master_salt, SrtpConfig::MasterSaltSize);
+    iv[7] ^= label;
+
+    memset(key, 0, size);
+
+    EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+    if (!ctx) {
+        return false;
+    }
+
+    int out_size = 0;
+
+    const bool ok =
+        EVP_EncryptInit_ex(ctx, EVP_aes_128_ctr(), NULL, config.master_key, iv) == 1
+        && EVP_EncryptUpdate(ctx, key, &out_size, key, (int)size) == 1
+        && out_size == (int)size;
+
+    EVP_CIPHER_CTX_free(ctx);
+
+    return ok;
+}
+
+} // namespace
+
+SrtpContext::SrtpContext(const SrtpConfig& config, SrtpProtocol proto)
+    : proto_(proto)
+    , cipher_ctx_(NULL)
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    , auth_mac_(NULL)
+#endif
+    , auth_ctx_(NULL)
+    , n_streams_(0)
+    , use_counter_(0)
+    , valid_(false) {
+    if (!derive_keys_(config)) {
+        roc_log(LogError, "srtp context: can't derive session keys");
+        return;
+    }
+
+    if (!init_crypto_()) {
+        roc_log(LogError, "srtp context: can't initialize crypto");
+        return;
+    }
+
+    roc_log(LogDebug, "srtp context: initialized: proto=%s overhead=%lu",
+            proto_ == SrtpProto_RTP ? "srtp" : "srtcp", (unsigned long)overhead());
+
+    valid_ = true;
+}
+
+SrtpContext::~SrtpContext() {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    if (auth_ctx_) {
+        EVP_MAC_CTX_free(auth_ctx_);
+    }
+    if (auth_mac_) {
+        EVP_MAC_free(auth_mac_);
+    }
+#else
+    if (auth_ctx_) {
+        HMAC_CTX_free(auth_ctx_);
+    }
+#endif
+    if (cipher_ctx_) {
+        EVP_CIPHER_CTX_free(cipher_ctx_);
+    }
+
+    OPENSSL_cleanse(session_key_, sizeof(session_key_));
+    OPENSSL_cleanse(session_salt_, sizeof(session_salt_));
+    OPENSSL_cleanse(session_auth_key_, sizeof(session_auth_key_));
+}
+
+bool SrtpContext::valid() const {
+    return valid_;
+}
+
+size_t SrtpContext::overhead() const {
+    return proto_ == SrtpProto_RTP ? (size_t)AuthTagSize
+                                   : (size_t)(SrtcpIndexSize + AuthTagSize);
+}
+
+bool SrtpContext::protect(core::Slice<uint8_t>& data) {
+    roc_panic_if(!valid());
+
+    if (proto_ == SrtpProto_RTP) {
+        return protect_rtp_(data);
+    } else {
+        return protect_rtcp_(data);
+    }
+}
+
+bool SrtpContext::unprotect(core::Slice<uint8_t>& data) {
+    roc_panic_if(!valid());
+
+    if (proto_ == SrtpProto_RTP) {
+        return unprotect_rtp_(data);
+    } else {
+        return unprotect_rtcp_(data);
+    }
+}
+
+const uint8_t* SrtpContext::session_key() const {
+    return session_key_;
+}
+
+const uint8_t* SrtpContext::session_salt() const {
+    return session_salt_;
+}
+
+const uint8_t* SrtpContext::session_auth_key() const {
+    return session_auth_key_;
+}
+
+bool SrtpContext::derive_keys_(const SrtpConfig& config) {
+    const bool rtp = proto_ == SrtpProto_RTP;
+
+    return derive_key(config, rtp ? Label_RtpEncryption : Label_RtcpEncryption,
+                      session_key_, sizeof(session_key_))
+        && derive_key(config, rtp ? Label_RtpSalt : Label_RtcpSalt, session_salt_,
+                      sizeof(session_salt_))
+        && derive_key(config, rtp ? Label_RtpAuth : Label_RtcpAuth, session_auth_key_,
+                      sizeof(session_auth_key_));
+}
+
+bool SrtpContext::init_crypto_() {
+    cipher_ctx_ = EVP_CIPHER_CTX_new();
+    if (!cipher_ctx_) {
+        return false;
+    }
+
+    // key schedule is computed once, only IV is changed for every packet
+    if (EVP_EncryptInit_ex(cipher_ctx_, EVP_aes_128_ctr(), NULL, session_key_, NULL)
+        != 1) {
+        return false;
+    }
+
+    // keyed HMAC state is computed once, and every packet resets
+    // state without recomputing key pads
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    auth_mac_ = EVP_MAC_fetch(NULL, "HMAC", NULL);
+    if (!auth_mac_) {
+        return false;
+    }
+
+    auth_ctx_ = EVP_MAC_CTX_new(auth_mac_);
+    if (!auth_ctx_) {
+        return false;
+    }
+
+    char digest_name[] = "SHA1";
+
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest_name, 0),
+        OSSL_PARAM_construct_end(),
+    };
+
+    if (EVP_MAC_init(auth_ctx_, session_auth_key_, sizeof(session_auth_key_), params)
+        != 1) {
+        return false;
+    }
+#else
+    auth_ctx_ = HMAC_CTX_new();
+    if (!auth_ctx_) {
+        return false;
+    }
+
+    if (HMAC_Init_ex(auth_ctx_, session_auth_key_, (int)sizeof(session_auth_key_),
+                     EVP_sha1(), NULL)
+        != 1) {
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+SrtpContext::Stream* SrtpContext::find_stream_(uint32_t ssrc) {
+    for (size_t n = 0; n < n_streams_; n++) {
+        if (streams_[n].ssrc == ssrc) {
+            streams_[n].last_use = ++use_counter_;
+            return &streams_[n];
+        }
+    }
+
+    return NULL;
+}
+
+SrtpContext::Stream& SrtpContext::add_stream_(const Stream& new_stream) {
+    Stream* stream = NULL;
+
+    if (n_streams_ < MaxStreams) {
+        stream = &streams_[n_streams_++];
+    } else {
+        stream = &streams_[0];
+        for (size_t n = 1; n < n_streams_; n++) {
+            if (streams_[n].last_use < stream->last_use) {
+                stream = &streams_[n];
+            }
+        }
+
+        roc_log(LogDebug, "srtp context: too many streams, dropping oldest: ssrc=%lu",
+                (unsigned long)stream->ssrc);
+    }
+
+    *stream = new_stream;
+    stream->last_use = ++use_counter_;
+
+    return *stream;
+}
+
+void SrtpContext::init_stream_(Stream& stream,
+                               uint32_t ssrc,
+                               uint32_t roc,
+                               uint16_t seqnum,
+                               uint64_t index) {
+    stream.ssrc = ssrc;
+    stream.roc = roc;
+    stream.last_seqnum = seqnum;
+    stream.max_index = index;
+    stream.replay_mask = 0;
+    stream.last_use = 0;
+}
+
+// RFC 3711 3.3.1
+uint64_t SrtpContext::guess_rtp_index_(const Stream& stream, uint16_t seqnum) const {
+    uint32_t roc = stream.roc;
+
+    if (stream.last_seqnum < 0x8000) {
+        if ((int)seqnum - (int)stream.last_seqnum > 0x8000 && roc > 0) {
+            roc--;
+        }
+    } else {
+        if ((int)stream.last_seqnum - 0x8000 > (int)seqnum) {
+            roc++;
+        }
+    }
+
+    return ((uint64_t)roc << 16) | seqnum;
+}
+
+// RFC 3711 3.3.2
+bool SrtpContext::check_replay_(const Stream& stream, uint64_t index) const {
+    if (index > stream.max_index) {
+        return true;
+    }
+
+    const uint64_t delta = stream.max_index - index;
+
+    if (delta >= ReplayWindowSize) {
+        return false;
+    }
+
+    return (stream.replay_mask & ((uint64_t)1 << delta)) == 0;
+}
+
+void SrtpContext::update_replay_(Stream& stream, uint64_t index) {
+    if (index > stream.max_index) {
+        const uint64_t delta = index - stream.max_index;
+
+        stream.replay_mask = delta < ReplayWindowSize ? stream.replay_mask << delta : 0;
+        stream.max_index = index;
+    }
+
+    stream.replay_mask |= (uint64_t)1 << (stream.max_index - index);
+}
+
+void SrtpContext::update_rtp_index_(Stream& stream, uint64_t index) {
+    if (index >= stream.max_index) {
+        stream.roc = (uint32_t)(index >> 16);
+        stream.last_seqnum = (uint16_t)index;
+    }
+
+    update_replay_(stream, index);
+}
+
+bool SrtpContext::protect_rtp_(core::Slice<uint8_t>& data) {
+    if (data.size() < AuthTagSize) {
+        roc_log(LogError, "srtp context: no space for srtp trailer: size=%lu",
+                (unsigned long)data.size());
+        return false;
+    }
+
+    uint8_t* packet = data.data();
+    const size_t packet_size = data.size() - AuthTagSize;
+
+    size_t header_size = 0;
+    if (!rtp_header_size(packet, packet_size, header_size)) {
+        roc_log(LogError, "srtp context: can't protect invalid rtp packet: size=%lu",
+                (unsigned long)packet_size);
+        return false;
+    }
+
+    const Header& header = *(const Header*)packet;
+
+    const uint32_t ssrc = header.ssrc();
+    const uint16_t seqnum = header.seqnum();
+
+    Stream* stream = find_stream_(ssrc);
+    if (!stream) {
+        Stream new_stream;
+        init_stream_(new_stream, ssrc, 0, seqnum, seqnum);
+        stream = &add_stream_(new_stream);
+    }
+
+    // sender may reorder packets (e.g. when interleaving is enabled),
+    // so the index is estimated in the same way as on receiver
+    const uint64_t index = guess_rtp_index_(*stream, seqnum);
+    update_rtp_index_(*stream, index);
+
+    if (!crypt_(packet + header_size, packet_size - header_size, ssrc, index)) {
+        return false;
+    }
+
+    uint8_t roc[4];
+    write_u32(roc, (uint32_t)(index >> 16));
+
+    return authenticate_(packet, packet_size, roc, sizeof(roc), packet + packet_size);
+}
+
+bool SrtpContext::unprotect_rtp_(core::Slice<uint8_t>& data) {
+    if (data.size() < AuthTagSize) {
+        roc_log(LogTrace, "srtp context: bad packet: size<%d (auth tag)",
+                (int)AuthTagSize);
+        return false;
+    }
+
+    uint8_t* packet = data.data();
+    const size_t packet_size = data.size() - AuthTagSize;
+
+    size_t header_size = 0;
+    if (!rtp_header_size(packet, packet_size, header_size)) {
+        roc_log(LogTrace, "srtp context: bad packet: invalid rtp header");
+        return false;
+    }
+
+    const Header& header = *(const Header*)packet;
+
+    const uint32_t ssrc = header.ssrc();
+    const uint16_t seqnum = header.seqnum();
+
+    uint8_t tag[DigestSize];
+    uint8_t roc[4];
+
+    Stream new_stream;
+    Stream* stream = find_stream_(ssrc);
+    uint64_t index = 0;
+
+    if (stream) {
+        index = guess_rtp_index_(*stream, seqnum);
+
+        if (!check_replay_(*stream, index)) {
+            roc_log(LogTrace, "srtp context: replayed packet: ssrc=%lu index=%llu",
+                    (unsigned long)ssrc, (unsigned long long)index);
+            return false;
+        }
+
+        write_u32(roc, (uint32_t)(index >> 16));
+
+        if (!authenticate_(packet, packet_size, roc, sizeof(roc), tag)
+            || CRYPTO_memcmp(tag, packet + packet_size, AuthTagSize) != 0) {
+            roc_log(LogTrace, "srtp context: authentication failed: ssrc=%lu",
+                    (unsigned long)ssrc);
+            return false;
+        }
+    } else {
+        // stream is not known yet, and we don't know for how long the sender
+        // is already running; find rollover counter for which packet is authentic
+        bool found = false;
+
+        for (uint32_t r = 0; r < MaxRocSearch && !found; r++) {
+            write_u32(roc, r);
+
+            if (!authenticate_(packet, packet_size, roc, sizeof(roc), tag)) {
+                return false;
+            }
+
+            if (CRYPTO_memcmp(tag, packet + packet_size, AuthTagSize) == 0) {
+                index = ((uint64_t)r << 16) | seqnum;
+                found = true;
+            }
+        }
+
+        if (!found) {
+            roc_log(LogTrace,
+                    "srtp context: authentication failed for new stream: ssrc=%lu",
+                    (unsigned long)ssrc);
+            return false;
+        }
+
+        // stream is added only after packet is authenticated, so that
+        // forged packets can't evict real streams
+        init_stream_(new_stream, ssrc, (uint32_t)(index >> 16), seqnum, index);
+        stream = &add_stream_(new_stream);
+    }
+
+    if (!crypt_(packet + header_size, packet_size - header_size, ssrc, index)) {
+        return false;
+    }
+
+    update_rtp_index_(*stream, index);
+
+    data.reslice(0, packet_size);
+
+    return true;
+}
+
+bool SrtpContext::protect_rtcp_(core::Slice<uint8_t>& data) {
+    if (data.size() < SrtcpIndexSize + AuthTagSize + RtcpPlainSize) {
+        roc_log(LogError, "srtp context: can't protect invalid rtcp packet: size=%lu",
+                (unsigned long)data.size());
+        return false;
+    }
+
+    uint8_t* packet = data.data();
+    const size_t packet_size = data.size() - SrtcpIndexSize - AuthTagSize;
+
+    const uint32_t ssrc = read_u32(packet + 4);
+
+    uint32_t index = 0;
+
+    Stream* stream = find_stream_(ssrc);
+    if (stream) {
+        index = (uint32_t)(stream->max_index + 1) & SrtcpIndexMask;
+        stream->max_index = index;
+    } else {
+        Stream new_stream;
+        init_stream_(new_stream, ssrc, 0, 0, index);
+        add_stream_(new_stream);
+    }
+
+    if (!crypt_(packet + RtcpPlainSize, packet_size - RtcpPlainSize, ssrc, index)) {
+        return false;
+    }
+
+    write_u32(packet + packet_size, SrtcpEncryptedFlag | index);
+
+    return authenticate_(packet, packet_size + SrtcpIndexSize, NULL, 0,
+                         packet + packet_size + SrtcpIndexSize);
+}
+
+bool SrtpContext::unprotect_rtcp_(core::Slice<uint8_t>& data) {
+    if (data.size() < SrtcpIndexSize + AuthTagSize + RtcpPlainSize) {
+        roc_log(LogTrace, "srtp context: bad packet: size<%d (rtcp header + trailer)",
+                (int)(SrtcpIndexSize + AuthTagSize + RtcpPlainSize));
+        return false;
+    }
+
+    uint8_t* packet = data.data();
+    const size_t packet_size = data.size() - SrtcpIndexSize - AuthTagSize;
+
+    const uint32_t ssrc = read_u32(packet + 4);
+    const uint32_t e_index = read_u32(packet + packet_size);
+    const uint32_t index = e_index & SrtcpIndexMask;
+
+    uint8_t tag[DigestSize];
+
+    if (!authenticate_(packet, packet_size + SrtcpIndexSize, NULL, 0, tag)
+        || CRYPTO_memcmp(tag, packet + packet_size + SrtcpIndexSize, AuthTagSize)
+            != 0) {
+        roc_log(LogTrace, "srtp context: authentication failed: ssrc=%lu",
+                (unsigned long)ssrc);
+        return false;
+    }
+
+    Stream* stream = find_stream_(ssrc);
+    if (stream) {
+        if (!check_replay_(*stream, index)) {
+            roc_log(LogTrace, "srtp context: replayed packet: ssrc=%lu index=%lu",
+                    (unsigned long)ssrc, (unsigned long)index);
+            return false;
+        }
+    } else {
+        Stream new_stream;
+        init_stream_(new_stream, ssrc, 0, 0, index);
+        stream = &add_stream_(new_stream);
+    }
+
+    if (e_index & SrtcpEncryptedFlag) {
+        if (!crypt_(packet + RtcpPlainSize, packet_size - RtcpPlainSize, ssrc, index)) {
+            return false;
+        }
+    }
+
+    update_replay_(*stream, index);
+
+    data.reslice(0, packet_size);
+
+    return true;
+}
+
+// RFC 3711 4.1.1
+bool SrtpContext::crypt_(uint8_t* data, size_t size, uint32_t ssrc, uint64_t index) {
+    uint8_t iv[IvSize] = {};
+    memcpy(iv, session_salt_, sizeof(session_salt_));
+
+    for (size_t n = 0; n < 4; n++) {
+        iv[4 + n] ^= (uint8_t)(ssrc >> (24 - n * 8));
+    }
+    for (size_t n = 0; n < 6; n++) {
+        iv[8 + n] ^= (uint8_t)(index >> (40 - n * 8));
+    }
+
+    int out_size = 0;
+
+    if (EVP_EncryptInit_ex(cipher_ctx_, NULL, NULL, NULL, iv) != 1
+        || EVP_EncryptUpdate(cipher_ctx_, data, &out_size, data, (int)size) != 1
+        || out_size != (int)size) {
+        roc_log(LogError, "srtp context: encryption failed");
+        return false;
+    }
+
+    return true;
+}
+
+// RFC 3711 4.2.1
+bool SrtpContext::authenticate_(const uint8_t* data,
+                                size_t size,
+                                const uint8_t* suffix,
+                                size_t suffix_size,
+                                uint8_t* tag) {
+    uint8_t digest[DigestSize];
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    size_t digest_size = 0;
+
+    const bool ok = EVP_MAC_init(auth_ctx_, NULL, 0, NULL) == 1
+        && EVP_MAC_update(auth_ctx_, data, size) == 1
+        && (suffix_size == 0 || EVP_MAC_update(auth_ctx_, suffix, suffix_size) == 1)
+        && EVP_MAC_final(auth_ctx_, digest, &digest_size, sizeof(digest)) == 1
+        && digest_size == sizeof(digest);
+#else
+    unsigned int digest_size = 0;
+
+    const bool ok = HMAC_Init_ex(auth_ctx_, NULL, 0, NULL, NULL) == 1
+        && HMAC_Update(auth_ctx_, data, size) == 1
+        && (suffix_size == 0 || HMAC_Update(auth_ctx_, suffix, suffix_size) == 1)
+        && HMAC_Final(auth_ctx_, digest, &digest_size) == 1
+        && digest_size == sizeof(digest);
+#endif
+
+    if (!ok) {
+        roc_log(LogError, "srtp context: authentication failed");
+        return false;
+    }
+
+    memcpy(tag, digest, AuthTagSize);
+
+    return true;
+}
+
+} // namespace rtp
+} // namespace roc
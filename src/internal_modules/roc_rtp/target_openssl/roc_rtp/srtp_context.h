@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/target_openssl/roc_rtp/srtp_context.h
+//! @brief SRTP crypto context.
+
+#ifndef ROC_RTP_SRTP_CONTEXT_H_
+#define ROC_RTP_SRTP_CONTEXT_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_rtp/srtp_config.h"
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/opensslv.h>
+
+namespace roc {
+namespace rtp {
+
+//! Protocol protected by SRTP context.
+enum SrtpProtocol {
+    SrtpProto_RTP, //!< SRTP, protects RTP packets.
+    SrtpProto_RTCP //!< SRTCP, protects RTCP compound packets.
+};
+
+//! SRTP crypto context.
+//! @remarks
+//!  Implements AES_CM_128_HMAC_SHA1_80 transform from RFC 3711 for one
+//!  direction of RTP or RTCP traffic. Session keys are derived from master
+//!  key once. Packets are encrypted and decrypted in place, and authentication
+//!  tag is written to the bytes following the packet, without copying.
+//!
+//!  Uses OpenSSL EVP interface, which selects AES-NI, ARMv8 Crypto Extensions,
+//!  and SHA instructions on CPUs that support them.
+//!
+//!  Keeps rollover counter and replay window for a limited number of
+//!  streams (SSRCs); least recently used stream is forgotten when the
+//!  limit is reached. When a new stream is seen by receiver, a few first
+//!  rollover counter values are tried, so that receiver can join a sender
+//!  which is already running.
+class SrtpContext : public core::NonCopyable<> {
+public:
+    //! Algorithm parameters.
+    enum {
+        //! Session authentication key size, in bytes.
+        AuthKeySize = 20,
+
+        //! Authentication tag size, in bytes.
+        AuthTagSize = 10,
+
+        //! SRTCP index size, in bytes.
+        SrtcpIndexSize = 4
+    };
+
+    //! Maximum number of tracked streams.
+    enum { MaxStreams = 16 };
+
+    //! Size of replay window, in packets.
+    enum { ReplayWindowSize = 64 };
+
+    //! Initialize.
+    SrtpContext(const SrtpConfig& config, SrtpProtocol proto);
+
+    ~SrtpContext();
+
+    //! Check if context was successfully initialized.
+    bool valid() const;
+
+    //! Get number of bytes appended to protected packet.
+    size_t overhead() const;
+
+    //! Protect packet in place.
+    //! @remarks
+    //!  @p data holds plaintext packet followed by overhead() reserved bytes.
+    //!  Encrypts packet payload and fills reserved bytes with trailer, i.e.
+    //!  SRTCP index and authentication tag.
+    //! @returns
+    //!  false if packet is invalid.
+    bool protect(core::Slice<uint8_t>& data);
+
+    //! Unprotect packet in place.
+    //! @remarks
+    //!  Verifies authentication tag and replay window, decrypts packet
+    //!  payload, and truncates @p data to plaintext packet.
+    //! @returns
+    //!  false if packet is invalid, not authentic, or replayed.
+    bool unprotect(core::Slice<uint8_t>& data);
+
+    //! Get session encryption key.
+    const uint8_t* session_key() const;
+
+    //! Get session salt.
+    const uint8_t* session_salt() const;
+
+    //! Get session authentication key.
+    const uint8_t* session_auth_key() const;
+
+private:
+    struct Stream {
+        uint32_t ssrc;
+        uint32_t roc;
+        uint16_t last_seqnum;
+        uint64_t max_index;
+        uint64_t replay_mask;
+        uint64_t last_use;
+    };
+
+    bool derive_keys_(const SrtpConfig& config);
+    bool init_crypto_();
+
+    Stream* find_stream_(uint32_t ssrc);
+    Stream& add_stream_(const Stream& new_stream);
+    void init_stream_(
+        Stream& stream, uint32_t ssrc, uint32_t roc, uint16_t seqnum, uint64_t index);
+
+    uint64_t guess_rtp_index_(const Stream& stream, uint16_t seqnum) const;
+    bool check_replay_(const Stream& stream, uint64_t index) const;
+    void update_replay_(Stream& stream, uint64_t index);
+    void update_rtp_index_(Stream& stream, uint64_t index);
+
+    bool protect_rtp_(core::Slice<uint8_t>& data);
+    bool unprotect_rtp_(core::Slice<uint8_t>& data);
+    bool protect_rtcp_(core::Slice<uint8_t>& data);
+    bool unprotect_rtcp_(core::Slice<uint8_t>& data);
+
+    bool crypt_(uint8_t* data, size_t size, uint32_t ssrc, uint64_t index);
+    bool authenticate_(const uint8_t* data,
+                       size_t size,
+                       const uint8_t* suffix,
+                       size_t suffix_size,
+                       uint8_t* tag);
+
+    const SrtpProtocol proto_;
+
+    uint8_t session_key_[SrtpConfig::MasterKeySize];
+    uint8_t session_salt_[SrtpConfig::MasterSaltSize];
+    uint8_t session_auth_key_[AuthKeySize];
+
+    EVP_CIPHER_CTX* cipher_ctx_;
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    EVP_MAC* auth_mac_;
+    EVP_MAC_CTX* auth_ctx_;
+#else
+    HMAC_CTX* auth_ctx_;
+#endif
+
+    Stream streams_[MaxStreams];
+    size_t n_streams_;
+    uint64_t use_counter_;
+
+    bool valid_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_SRTP_CONTEXT_H_
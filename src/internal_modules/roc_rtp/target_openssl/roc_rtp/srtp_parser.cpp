@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/srtp_parser.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace rtp {
+
+SrtpParser::SrtpParser(const SrtpConfig& config,
+                       SrtpProtocol proto,
+                       packet::IParser& inner_parser)
+    : context_(config, proto)
+    , inner_parser_(inner_parser) {
+}
+
+bool SrtpParser::valid() const {
+    return context_.valid();
+}
+
+bool SrtpParser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if(!valid());
+
+    core::Slice<uint8_t> data = buffer;
+
+    if (!context_.unprotect(data)) {
+        roc_log(LogDebug, "srtp parser: can't unprotect packet: size=%lu",
+                (unsigned long)buffer.size());
+        return false;
+    }
+
+    return inner_parser_.parse(packet, data);
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/target_openssl/roc_rtp/srtp_parser.h
+//! @brief SRTP packet parser.
+
+#ifndef ROC_RTP_SRTP_PARSER_H_
+#define ROC_RTP_SRTP_PARSER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_packet/iparser.h"
+#include "roc_rtp/srtp_config.h"
+#include "roc_rtp/srtp_context.h"
+
+namespace roc {
+namespace rtp {
+
+//! SRTP packet parser.
+//! @remarks
+//!  Authenticates and decrypts SRTP or SRTCP packet in place, and passes
+//!  the plaintext packet without trailer to @p inner_parser.
+class SrtpParser : public packet::IParser, public core::NonCopyable<> {
+public:
+    //! Initialization.
+    SrtpParser(const SrtpConfig& config,
+               SrtpProtocol proto,
+               packet::IParser& inner_parser);
+
+    //! Check if parser was successfully initialized.
+    bool valid() const;
+
+    //! Parse packet from buffer.
+    virtual bool parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer);
+
+private:
+    SrtpContext context_;
+    packet::IParser& inner_parser_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_SRTP_PARSER_H_
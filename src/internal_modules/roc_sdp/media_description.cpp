@@ -11,16 +11,30 @@
 namespace roc {
 namespace sdp {
 
+namespace {
+
+// FEC Encoding IDs registered for FECFRAME by IANA.
+enum {
+    FecEncodingId_LDPC_Staircase = 7, // RFC 6816
+    FecEncodingId_ReedSolomon_M8 = 8, // RFC 6865
+    FecEncodingId_RLC_GF2_8 = 10      // RFC 8681
+};
+
+} // namespace
+
 MediaDescription::MediaDescription(core::IAllocator& allocator)
     : RefCounted(allocator)
     , payload_ids_(allocator)
-    , connection_data_(allocator) {
+    , connection_data_(allocator)
+    , rtpmaps_(allocator) {
     clear();
 }
 
 void MediaDescription::clear() {
     payload_ids_.resize(0);
     connection_data_.resize(0);
+    rtpmaps_.resize(0);
+    fec_scheme_ = packet::FEC_None;
     type_ = MediaType_None;
     port_ = 0;
     nb_ports_ = 0;
@@ -68,6 +82,28 @@ const ConnectionData& MediaDescription::connection_data(size_t i) const {
     return connection_data_[i];
 }
 
+size_t MediaDescription::nb_rtpmaps() const {
+    return rtpmaps_.size();
+}
+
+const RtpMap& MediaDescription::rtpmap(size_t i) const {
+    return rtpmaps_[i];
+}
+
+const RtpMap* MediaDescription::find_rtpmap(unsigned payload_id) const {
+    for (size_t i = 0; i < rtpmaps_.size(); i++) {
+        if (rtpmaps_[i].payload_id == payload_id) {
+            return &rtpmaps_[i];
+        }
+    }
+
+    return NULL;
+}
+
+packet::FecScheme MediaDescription::fec_scheme() const {
+    return fec_scheme_;
+}
+
 bool MediaDescription::set_type(MediaType type) {
     type_ = type;
     return true;
@@ -122,5 +158,62 @@ bool MediaDescription::add_connection_data(address::AddrFamily addrtype,
     return true;
 }
 
+bool MediaDescription::add_rtpmap(long payload_id,
+                                  const char* encoding,
+                                  size_t encoding_len,
+                                  long clock_rate,
+                                  long num_channels) {
+    if (payload_id < 0 || payload_id > 127) {
+        return false;
+    }
+
+    if (encoding_len == 0 || encoding_len > RtpMap::MaxEncodingLen) {
+        return false;
+    }
+
+    if (clock_rate <= 0 || num_channels <= 0 || num_channels > 64) {
+        return false;
+    }
+
+    if (find_rtpmap((unsigned)payload_id)) {
+        return false;
+    }
+
+    RtpMap m;
+    m.payload_id = (unsigned)payload_id;
+    memcpy(m.encoding, encoding, encoding_len);
+    m.encoding[encoding_len] = '\0';
+    m.clock_rate = (size_t)clock_rate;
+    m.num_channels = (size_t)num_channels;
+
+    if (!rtpmaps_.grow_exp(rtpmaps_.size() + 1)) {
+        return false;
+    }
+
+    rtpmaps_.push_back(m);
+    return true;
+}
+
+bool MediaDescription::set_fec_encoding_id(long encoding_id) {
+    switch (encoding_id) {
+    case FecEncodingId_LDPC_Staircase:
+        fec_scheme_ = packet::FEC_LDPC_Staircase;
+        return true;
+
+    case FecEncodingId_ReedSolomon_M8:
+        fec_scheme_ = packet::FEC_ReedSolomon_M8;
+        return true;
+
+    case FecEncodingId_RLC_GF2_8:
+        fec_scheme_ = packet::FEC_RLC;
+        return true;
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
 } // namespace sdp
 } // namespace roc
@@ -21,9 +21,11 @@
 #include "roc_core/string_buffer.h"
 #include "roc_core/string_builder.h"
 #include "roc_core/string_list.h"
+#include "roc_packet/fec.h"
 #include "roc_sdp/connection_data.h"
 #include "roc_sdp/media_transport.h"
 #include "roc_sdp/media_type.h"
+#include "roc_sdp/rtpmap.h"
 
 namespace roc {
 namespace sdp {
@@ -72,6 +74,22 @@ public:
     //! description.
     const ConnectionData& connection_data(size_t i) const;
 
+    //! Number of payload format mappings.
+    size_t nb_rtpmaps() const;
+
+    //! Get the i-th payload format mapping, in order of a=rtpmap attributes.
+    const RtpMap& rtpmap(size_t i) const;
+
+    //! Find payload format mapping for given payload id.
+    //! @returns
+    //!  NULL if there is no a=rtpmap attribute for @p payload_id.
+    const RtpMap* find_rtpmap(unsigned payload_id) const;
+
+    //! FEC scheme of repair flow.
+    //! @remarks
+    //!  Defined by a=fec-repair-flow attribute (RFC 6364), FEC_None if omitted.
+    packet::FecScheme fec_scheme() const;
+
     //! Set media type.
     bool set_type(MediaType type);
 
@@ -91,6 +109,16 @@ public:
     bool
     add_connection_data(address::AddrFamily addrtype, const char* str, size_t str_len);
 
+    //! Add a payload format mapping.
+    bool add_rtpmap(long payload_id,
+                    const char* encoding,
+                    size_t encoding_len,
+                    long clock_rate,
+                    long num_channels);
+
+    //! Set FEC scheme from FEC Encoding ID of repair flow.
+    bool set_fec_encoding_id(long encoding_id);
+
 private:
     MediaType type_;
     int port_;
@@ -99,6 +127,8 @@ private:
     core::Array<unsigned, 2> payload_ids_;
 
     core::Array<ConnectionData, 1> connection_data_;
+    core::Array<RtpMap, 2> rtpmaps_;
+    packet::FecScheme fec_scheme_;
 };
 
 } // namespace sdp
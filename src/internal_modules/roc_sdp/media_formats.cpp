@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sdp/media_formats.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace sdp {
+
+namespace {
+
+// Encoding names are case-insensitive (RFC 4855).
+bool encoding_equal(const char* a, const char* b) {
+    for (; *a && *b; a++, b++) {
+        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) {
+            return false;
+        }
+    }
+    return *a == *b;
+}
+
+packet::channel_mask_t make_channel_mask(size_t num_channels) {
+    if (num_channels >= sizeof(packet::channel_mask_t) * 8) {
+        return ~packet::channel_mask_t(0);
+    }
+    return (packet::channel_mask_t(1) << num_channels) - 1;
+}
+
+bool same_format(const rtp::Format& a, const rtp::Format& b) {
+    return a.new_decoder == b.new_decoder && a.sample_spec == b.sample_spec
+        && a.pcm_format.encoding == b.pcm_format.encoding
+        && a.pcm_format.endian == b.pcm_format.endian;
+}
+
+bool register_format(const rtp::Format& fmt, rtp::FormatMap& format_map) {
+    if (const rtp::Format* existing = format_map.format(fmt.payload_type)) {
+        if (!same_format(*existing, fmt)) {
+            roc_log(LogError,
+                    "sdp: payload format conflicts with registered one: pt=%u",
+                    (unsigned)fmt.payload_type);
+            return false;
+        }
+        return true;
+    }
+
+    return format_map.add_format(fmt);
+}
+
+bool register_pcm_format(const RtpMap& rtpmap,
+                         audio::PcmEncoding encoding,
+                         rtp::FormatMap& format_map) {
+    // PCM formats differ only in encoding and sample spec, so take encoder and
+    // decoder from any built-in PCM format
+    const rtp::Format* proto = format_map.format(rtp::PayloadType_L16_Stereo);
+    if (!proto) {
+        roc_log(LogError, "sdp: can't find built-in pcm format");
+        return false;
+    }
+
+    rtp::Format fmt = *proto;
+    // payload id range is checked when rtpmap is added to media description
+    fmt.payload_type = (rtp::PayloadType)rtpmap.payload_id;
+    fmt.pcm_format = audio::PcmFormat(encoding, audio::PcmEndian_Big);
+    fmt.sample_spec = audio::SampleSpec(rtpmap.clock_rate,
+                                        make_channel_mask(rtpmap.num_channels));
+
+    return register_format(fmt, format_map);
+}
+
+#ifdef ROC_TARGET_OPUS
+bool register_opus_format(const RtpMap& rtpmap, rtp::FormatMap& format_map) {
+    // RFC 7587: opus is always announced as opus/48000/2, regardless of
+    // actual rate and channels
+    if (rtpmap.clock_rate != 48000 || rtpmap.num_channels != 2) {
+        roc_log(LogError, "sdp: invalid opus rtpmap: pt=%u rate=%lu channels=%lu",
+                rtpmap.payload_id, (unsigned long)rtpmap.clock_rate,
+                (unsigned long)rtpmap.num_channels);
+        return false;
+    }
+
+    const rtp::Format* proto = format_map.format(rtp::PayloadType_Opus);
+    if (!proto) {
+        roc_log(LogError, "sdp: can't find built-in opus format");
+        return false;
+    }
+
+    rtp::Format fmt = *proto;
+    fmt.payload_type = (rtp::PayloadType)rtpmap.payload_id;
+
+    return register_format(fmt, format_map);
+}
+#endif // ROC_TARGET_OPUS
+
+} // namespace
+
+bool register_media_formats(const MediaDescription& media, rtp::FormatMap& format_map) {
+    for (size_t n = 0; n < media.nb_payload_ids(); n++) {
+        const unsigned pt = media.payload_id(n);
+
+        const RtpMap* rtpmap = media.find_rtpmap(pt);
+        if (!rtpmap) {
+            if (!format_map.format(pt)) {
+                roc_log(LogError, "sdp: unknown payload id without rtpmap: pt=%u", pt);
+                return false;
+            }
+            continue;
+        }
+
+        bool ok = false;
+
+        if (encoding_equal(rtpmap->encoding, "L16")) {
+            ok = register_pcm_format(*rtpmap, audio::PcmEncoding_SInt16, format_map);
+        } else if (encoding_equal(rtpmap->encoding, "L24")) {
+            ok = register_pcm_format(*rtpmap, audio::PcmEncoding_SInt24, format_map);
+        } else if (encoding_equal(rtpmap->encoding, "opus")) {
+#ifdef ROC_TARGET_OPUS
+            ok = register_opus_format(*rtpmap, format_map);
+#else
+            roc_log(LogError, "sdp: opus support not enabled: pt=%u", pt);
+#endif // ROC_TARGET_OPUS
+        } else {
+            roc_log(LogError, "sdp: unsupported encoding: pt=%u encoding=%s", pt,
+                    rtpmap->encoding);
+        }
+
+        if (!ok) {
+            return false;
+        }
+
+        roc_log(LogDebug, "sdp: registered payload format: pt=%u encoding=%s/%lu/%lu",
+                pt, rtpmap->encoding, (unsigned long)rtpmap->clock_rate,
+                (unsigned long)rtpmap->num_channels);
+    }
+
+    return true;
+}
+
+void configure_media_fec(const MediaDescription& media, fec::CodecConfig& config) {
+    config.scheme = media.fec_scheme();
+}
+
+} // namespace sdp
+} // namespace roc
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sdp/media_formats.h
+//! @brief Apply SDP media description to RTP and FEC configuration.
+
+#ifndef ROC_SDP_MEDIA_FORMATS_H_
+#define ROC_SDP_MEDIA_FORMATS_H_
+
+#include "roc_fec/codec_config.h"
+#include "roc_rtp/format_map.h"
+#include "roc_sdp/media_description.h"
+
+namespace roc {
+namespace sdp {
+
+//! Register payload formats of media description in format map.
+//! @remarks
+//!  For every payload id listed in m= line, looks up a=rtpmap attribute and
+//!  registers corresponding format, so that receiver can decode payload types
+//!  assigned dynamically by sender, with sender's rate and channels, instead
+//!  of relying on pre-configured formats. Supported encodings are L16, L24
+//!  and, if enabled, opus. Payload ids without a=rtpmap should be already
+//!  known to format map, e.g. static payload types.
+//! @returns
+//!  false if some payload format is not supported or conflicts with a format
+//!  previously registered with the same payload id. Formats registered before
+//!  failure remain in map.
+bool register_media_formats(const MediaDescription& media, rtp::FormatMap& format_map);
+
+//! Configure FEC codec according to media description.
+//! @remarks
+//!  Sets FEC scheme from a=fec-repair-flow attribute. Other parameters are
+//!  kept, because they are not negotiated via SDP.
+void configure_media_fec(const MediaDescription& media, fec::CodecConfig& config);
+
+} // namespace sdp
+} // namespace roc
+
+#endif // ROC_SDP_MEDIA_FORMATS_H_
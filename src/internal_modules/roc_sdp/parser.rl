@@ -51,6 +51,13 @@ bool parse_sdp_imp(const char* str, SessionDescription& result) {
     // Address type of the current address being parsed.
     address::AddrFamily cur_addrtype = address::Family_Unknown;
 
+    // Fields of the current a=rtpmap attribute being parsed.
+    long rtpmap_payload_id = 0;
+    const char* start_p_rtpmap_encoding = NULL;
+    const char* end_p_rtpmap_encoding = NULL;
+    long rtpmap_clock_rate = 0;
+    long rtpmap_num_channels = 0;
+
     %%{
 
         action start_token {
@@ -152,6 +159,66 @@ bool parse_sdp_imp(const char* str, SessionDescription& result) {
             }
         }
 
+        action set_rtpmap_payload_id {
+            char* end_p = NULL;
+            rtpmap_payload_id = strtol(start_p, &end_p, 10);
+
+            if (rtpmap_payload_id == LONG_MAX || rtpmap_payload_id == LONG_MIN
+                || end_p != p) {
+                roc_log(LogError, "sdp: parse rtpmap: invalid payload id");
+                return false;
+            }
+        }
+
+        action set_rtpmap_clock_rate {
+            char* end_p = NULL;
+            rtpmap_clock_rate = strtol(start_p, &end_p, 10);
+
+            if (rtpmap_clock_rate == LONG_MAX || rtpmap_clock_rate == LONG_MIN
+                || end_p != p) {
+                roc_log(LogError, "sdp: parse rtpmap: invalid clock rate");
+                return false;
+            }
+        }
+
+        action set_rtpmap_num_channels {
+            char* end_p = NULL;
+            rtpmap_num_channels = strtol(start_p, &end_p, 10);
+
+            if (rtpmap_num_channels == LONG_MAX || rtpmap_num_channels == LONG_MIN
+                || end_p != p) {
+                roc_log(LogError, "sdp: parse rtpmap: invalid number of channels");
+                return false;
+            }
+        }
+
+        action add_media_rtpmap {
+            if (!result.last_media_description()->add_rtpmap(
+                    rtpmap_payload_id,
+                    start_p_rtpmap_encoding,
+                    size_t(end_p_rtpmap_encoding - start_p_rtpmap_encoding),
+                    rtpmap_clock_rate,
+                    rtpmap_num_channels)) {
+                roc_log(LogError, "sdp: parse rtpmap: invalid payload format");
+                return false;
+            }
+        }
+
+        action set_media_fec_encoding_id {
+            char* end_p = NULL;
+            long encoding_id = strtol(start_p, &end_p, 10);
+
+            if (encoding_id == LONG_MAX || encoding_id == LONG_MIN || end_p != p) {
+                roc_log(LogError, "sdp: parse fec-repair-flow: invalid encoding id");
+                return false;
+            }
+
+            if (!result.last_media_description()->set_fec_encoding_id(encoding_id)) {
+                roc_log(LogError, "sdp: parse fec-repair-flow: unsupported encoding id");
+                return false;
+            }
+        }
+
         ##### USEFUL GRAMMAR #####
         # ABNF: 1*(VCHAR/%x80-FF) -> string of visible characters
         non_ws_string = [!-~]+;      
@@ -163,20 +230,42 @@ bool parse_sdp_imp(const char* str, SessionDescription& result) {
         CRLF = "\r\n";
         SP = ' ';
 
-        ##### SDP ATTRIBUTES - NOT YET IMPLEMENTED #####
-        # <payload type> <encoding name>/<clock rate> [/<encoding parameters>]
+        ##### SDP ATTRIBUTES #####
+        # a=<attribute>:<value> or a=<attribute>
+        attribute_value = [^\r\n]*;
+
+        # a=rtpmap:<payload type> <encoding name>/<clock rate> [/<encoding parameters>]
         # (dynamic payload ID: encoding name, sample rate, channel set)
-        a_rtpmap = "a=rtpmap";
-
-        a_recvonly = "a=recvonly"; # (session mode / direction)
-        a_sendrecv = "a=sendrecv"; # (--//--)
-        a_sendonly = "a=sendonly"; # (--//--)
-        a_inactive = "a=inactive"; # (--//--)
-        a_type = "a=type"; # (session type; defines default session mode if omitted)
-        a_fmtp = "a=fmtp"; # (codec-specific parameters; we'll need it for Opus)
-        a_fec_source_flow = "a=fec-source-flow"; # (FECFRAME; see RFC 6364)
-        a_fec_repair_flow = "a=fec-repair-flow"; # (--//--)
-        a_repair_window = "a=repair-window"; # (--//--)
+        rtpmap_payload_id = digit+ >start_token %set_rtpmap_payload_id;
+
+        rtpmap_encoding = token >start_token %{
+            start_p_rtpmap_encoding = start_p;
+            end_p_rtpmap_encoding = p;
+            };
+
+        rtpmap_clock_rate = digit+ >start_token %set_rtpmap_clock_rate;
+
+        rtpmap_num_channels = digit+ >start_token %set_rtpmap_num_channels;
+
+        a_rtpmap = ("rtpmap:" rtpmap_payload_id SP rtpmap_encoding
+            '/' rtpmap_clock_rate %{ rtpmap_num_channels = 1; }
+            ('/' rtpmap_num_channels)?)
+            %add_media_rtpmap;
+
+        # a=fec-repair-flow: encoding-id=<id>[; <parameters>] (FECFRAME; see RFC 6364)
+        fec_encoding_id = digit+ >start_token %set_media_fec_encoding_id;
+
+        a_fec_repair_flow = "fec-repair-flow:" SP* "encoding-id=" fec_encoding_id
+            (';' attribute_value)?;
+
+        # Other attributes, e.g. a=sendonly, a=fmtp or a=fec-source-flow,
+        # are allowed but ignored.
+        a_other = attribute_value
+            - (("rtpmap:" | "fec-repair-flow:") attribute_value);
+
+        session_attribute = attribute_value;
+
+        media_attribute = a_rtpmap | a_fec_repair_flow | a_other;
 
         ##### SDP FIELDS #####
         version = digit+;
@@ -275,12 +364,18 @@ bool parse_sdp_imp(const char* str, SessionDescription& result) {
 
         media_connection_field = 'c=' media_connection_data;
 
-        media_fields = (CRLF media_field (CRLF media_connection_field)*)*;
+        media_attribute_field = 'a=' media_attribute;
+
+        media_fields = (CRLF media_field
+            (CRLF media_connection_field)*
+            (CRLF media_attribute_field)*)*;
 
         sdp_description = 'v=' version
         CRLF 'o=' origin
         (CRLF 'c=' session_connection_data)?
-        media_fields;
+        (CRLF 'a=' session_attribute)*
+        media_fields
+        CRLF?;
 
         main := sdp_description
                 %{ success = true; }
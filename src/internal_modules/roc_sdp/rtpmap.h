@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sdp/rtpmap.h
+//! @brief SDP payload format mapping.
+
+#ifndef ROC_SDP_RTPMAP_H_
+#define ROC_SDP_RTPMAP_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace sdp {
+
+//! SDP payload format mapping.
+//! @code
+//!  a=rtpmap:<payload type> <encoding name>/<clock rate>[/<encoding parameters>]
+//! @endcode
+struct RtpMap {
+    //! Maximum length of encoding name.
+    enum { MaxEncodingLen = 31 };
+
+    //! Payload id.
+    unsigned payload_id;
+
+    //! Encoding name, e.g. "L16" or "opus".
+    //! Zero-terminated, compared case-insensitively.
+    char encoding[MaxEncodingLen + 1];
+
+    //! Clock rate, which is sample rate for audio.
+    size_t clock_rate;
+
+    //! Number of channels.
+    //! One if omitted in SDP.
+    size_t num_channels;
+
+    //! Initialize.
+    RtpMap()
+        : payload_id(0)
+        , clock_rate(0)
+        , num_channels(0) {
+        encoding[0] = '\0';
+    }
+};
+
+} // namespace sdp
+} // namespace roc
+
+#endif // ROC_SDP_RTPMAP_H_
@@ -148,16 +148,19 @@ IDevice* BackendDispatcher::open_default_device_(DeviceType device_type,
                  | (device_type == DeviceType_Sink ? DriverFlag_SupportsSink
                                                    : DriverFlag_SupportsSource));
 
-    for (size_t n = 0; n < BackendMap::instance().num_drivers(); n++) {
-        const DriverInfo& driver_info = BackendMap::instance().nth_driver(n);
+    // drivers are discovered lazily, so that only backends up to the first
+    // one that can open default device are initialized
+    const DriverInfo* driver_info = NULL;
 
-        if (!match_driver(driver_info, NULL, DriverType_Device, driver_flags)) {
+    for (size_t n = 0; (driver_info = BackendMap::instance().find_nth_driver(n)); n++) {
+        if (!match_driver(*driver_info, NULL, DriverType_Device, driver_flags)) {
             continue;
         }
 
-        IDevice* device = BackendMap::instance().nth_driver(n).backend->open_device(
-            device_type, DriverType_Device, BackendMap::instance().nth_driver(n).name,
-            "default", config, allocator);
+        IDevice* device =
+            driver_info->backend->open_device(device_type, DriverType_Device,
+                                              driver_info->name, "default", config,
+                                              allocator);
         if (device) {
             return device;
         }
@@ -178,14 +181,15 @@ IDevice* BackendDispatcher::open_device_(DeviceType device_type,
                                         : DriverFlag_SupportsSource);
 
     if (driver_name != NULL) {
-        for (size_t n = 0; n < BackendMap::instance().num_drivers(); n++) {
-            const DriverInfo& driver_info = BackendMap::instance().nth_driver(n);
+        const DriverInfo* driver_info = NULL;
 
-            if (!match_driver(driver_info, driver_name, driver_type, driver_flags)) {
+        for (size_t n = 0; (driver_info = BackendMap::instance().find_nth_driver(n));
+             n++) {
+            if (!match_driver(*driver_info, driver_name, driver_type, driver_flags)) {
                 continue;
             }
 
-            IDevice* device = BackendMap::instance().nth_driver(n).backend->open_device(
+            IDevice* device = driver_info->backend->open_device(
                 device_type, driver_type, driver_name, path, config, allocator);
             if (device) {
                 return device;
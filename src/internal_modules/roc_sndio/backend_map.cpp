@@ -12,59 +12,150 @@
 namespace roc {
 namespace sndio {
 
-BackendMap::BackendMap() {
+BackendMap::BackendMap()
+    : n_backends_(0)
+    , n_discovered_backends_(0)
+    , frame_length_(0) {
     register_backends_();
-    register_drivers_();
 
-    roc_log(LogDebug, "backend map: initialized: n_backends=%d n_drivers=%d",
-            (int)backends_.size(), (int)drivers_.size());
+    roc_log(LogDebug, "backend map: initialized: n_backends=%d", (int)n_backends_);
 }
 
 size_t BackendMap::num_backends() const {
-    return backends_.size();
+    return n_backends_;
 }
 
-IBackend& BackendMap::nth_backend(size_t backend_index) const {
-    return *backends_[backend_index];
+IBackend& BackendMap::nth_backend(size_t backend_index) {
+    core::Mutex::Lock lock(mutex_);
+
+    return init_backend_(backend_index);
 }
 
-size_t BackendMap::num_drivers() const {
+size_t BackendMap::num_drivers() {
+    core::Mutex::Lock lock(mutex_);
+
+    while (n_discovered_backends_ < n_backends_) {
+        discover_next_backend_();
+    }
+
     return drivers_.size();
 }
 
-const DriverInfo& BackendMap::nth_driver(size_t driver_index) const {
+const DriverInfo& BackendMap::nth_driver(size_t driver_index) {
+    core::Mutex::Lock lock(mutex_);
+
+    while (n_discovered_backends_ < n_backends_) {
+        discover_next_backend_();
+    }
+
     return drivers_[driver_index];
 }
 
+const DriverInfo* BackendMap::find_nth_driver(size_t driver_index) {
+    core::Mutex::Lock lock(mutex_);
+
+    while (drivers_.size() <= driver_index && n_discovered_backends_ < n_backends_) {
+        discover_next_backend_();
+    }
+
+    if (driver_index >= drivers_.size()) {
+        return NULL;
+    }
+
+    return &drivers_[driver_index];
+}
+
 void BackendMap::set_frame_size(core::nanoseconds_t frame_length,
                                 const audio::SampleSpec& sample_spec) {
+    core::Mutex::Lock lock(mutex_);
+
+    frame_length_ = frame_length;
+    frame_sample_spec_ = sample_spec;
+
 #ifdef ROC_TARGET_SOX
-    sox_backend_->set_frame_size(frame_length, sample_spec);
+    if (sox_backend_) {
+        sox_backend_->set_frame_size(frame_length_, frame_sample_spec_);
+    }
 #endif // ROC_TARGET_SOX
-    (void)frame_length;
-    (void)sample_spec;
 }
 
+#ifdef ROC_TARGET_SOX
+SoxBackend& BackendMap::sox_backend() {
+    core::Mutex::Lock lock(mutex_);
+
+    init_sox_();
+
+    return *sox_backend_;
+}
+#endif // ROC_TARGET_SOX
+
 void BackendMap::register_backends_() {
-    if (!backends_.grow(MaxBackends)) {
+    // only remember backends in order of priority,
+    // they're initialized by init_backend_() on first use
+#ifdef ROC_TARGET_PULSEAUDIO
+    init_funcs_[n_backends_++] = &BackendMap::init_pulseaudio_;
+#endif // ROC_TARGET_PULSEAUDIO
+#ifdef ROC_TARGET_POSIX
+    init_funcs_[n_backends_++] = &BackendMap::init_wav_;
+#endif // ROC_TARGET_POSIX
+#ifdef ROC_TARGET_SOX
+    init_funcs_[n_backends_++] = &BackendMap::init_sox_;
+#endif // ROC_TARGET_SOX
+
+    if (!backends_.resize(n_backends_)) {
         roc_panic("backend map: can't grow backends array");
     }
+}
+
+IBackend& BackendMap::init_backend_(size_t backend_index) {
+    roc_panic_if_msg(backend_index >= n_backends_,
+                     "backend map: backend index out of bounds: index=%lu size=%lu",
+                     (unsigned long)backend_index, (unsigned long)n_backends_);
+
+    if (!backends_[backend_index]) {
+        backends_[backend_index] = (this->*init_funcs_[backend_index])();
+    }
+
+    return *backends_[backend_index];
+}
+
+void BackendMap::discover_next_backend_() {
+    init_backend_(n_discovered_backends_).discover_drivers(drivers_);
+    n_discovered_backends_++;
+
+    roc_log(LogDebug, "backend map: discovered drivers: n_backends=%d n_drivers=%d",
+            (int)n_discovered_backends_, (int)drivers_.size());
+}
 
 #ifdef ROC_TARGET_PULSEAUDIO
-    pulseaudio_backend_.reset(new (pulseaudio_backend_) PulseaudioBackend);
-    backends_.push_back(pulseaudio_backend_.get());
+IBackend* BackendMap::init_pulseaudio_() {
+    if (!pulseaudio_backend_) {
+        pulseaudio_backend_.reset(new (pulseaudio_backend_) PulseaudioBackend);
+    }
+    return pulseaudio_backend_.get();
+}
 #endif // ROC_TARGET_PULSEAUDIO
-#ifdef ROC_TARGET_SOX
-    sox_backend_.reset(new (sox_backend_) SoxBackend);
-    backends_.push_back(sox_backend_.get());
-#endif // ROC_TARGET_SOX
+
+#ifdef ROC_TARGET_POSIX
+IBackend* BackendMap::init_wav_() {
+    if (!wav_backend_) {
+        wav_backend_.reset(new (wav_backend_) WavBackend);
+    }
+    return wav_backend_.get();
 }
+#endif // ROC_TARGET_POSIX
 
-void BackendMap::register_drivers_() {
-    for (size_t n = 0; n < backends_.size(); n++) {
-        backends_[n]->discover_drivers(drivers_);
+#ifdef ROC_TARGET_SOX
+IBackend* BackendMap::init_sox_() {
+    if (!sox_backend_) {
+        sox_backend_.reset(new (sox_backend_) SoxBackend);
+        if (frame_length_ != 0) {
+            sox_backend_->set_frame_size(frame_length_, frame_sample_spec_);
+        }
     }
+    return sox_backend_.get();
 }
+#endif // ROC_TARGET_SOX
 
 } // namespace sndio
 } // namespace roc
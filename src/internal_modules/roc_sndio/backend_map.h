@@ -12,6 +12,7 @@
 #ifndef ROC_SNDIO_BACKEND_MAP_H_
 #define ROC_SNDIO_BACKEND_MAP_H_
 
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/optional.h"
 #include "roc_core/singleton.h"
@@ -22,6 +23,10 @@
 #include "roc_sndio/pulseaudio_backend.h"
 #endif // ROC_TARGET_PULSEAUDIO
 
+#ifdef ROC_TARGET_POSIX
+#include "roc_sndio/wav_backend.h"
+#endif // ROC_TARGET_POSIX
+
 #ifdef ROC_TARGET_SOX
 #include "roc_sndio/sox_backend.h"
 #endif // ROC_TARGET_SOX
@@ -30,6 +35,13 @@ namespace roc {
 namespace sndio {
 
 //! Backend map.
+//! @remarks
+//!  Backends are initialized lazily, in order of priority, when they are needed
+//!  for the first time. Opening a device of specific driver initializes only
+//!  backends up to the one providing that driver, and enumerating all drivers
+//!  initializes all backends. This way tools that use a single file or device
+//!  don't pay for initialization of backends they never touch.
+//!  Thread-safe.
 class BackendMap : public core::NonCopyable<> {
 public:
     //! Get instance.
@@ -41,36 +53,81 @@ public:
     size_t num_backends() const;
 
     //! Get backend by index.
-    IBackend& nth_backend(size_t backend_index) const;
+    //! @remarks
+    //!  Initializes backend if needed.
+    IBackend& nth_backend(size_t backend_index);
 
     //! Get number of drivers available.
-    size_t num_drivers() const;
+    //! @remarks
+    //!  Initializes all backends to discover their drivers.
+    size_t num_drivers();
 
     //! Get driver by index.
-    const DriverInfo& nth_driver(size_t driver_index) const;
+    //! @remarks
+    //!  Initializes all backends to discover their drivers.
+    const DriverInfo& nth_driver(size_t driver_index);
+
+    //! Get driver by index, discovering drivers of as few backends as possible.
+    //! @remarks
+    //!  Drivers are numbered in the same order as by nth_driver(). Backends are
+    //!  initialized one by one until driver with given index is discovered.
+    //! @returns
+    //!  NULL if there are less than @p driver_index + 1 drivers.
+    const DriverInfo* find_nth_driver(size_t driver_index);
 
     //! Set internal buffer size for all backends that need it.
+    //! @remarks
+    //!  Backends which are not initialized yet will use this size when they are.
     void set_frame_size(core::nanoseconds_t frame_length,
                         const audio::SampleSpec& sample_spec);
 
+#ifdef ROC_TARGET_SOX
+    //! Get SoX backend.
+    //! @remarks
+    //!  Initializes backend if needed. Used to ensure that SoX library is
+    //!  initialized before creating SoX sinks and sources.
+    SoxBackend& sox_backend();
+#endif // ROC_TARGET_SOX
+
 private:
     friend class core::Singleton<BackendMap>;
 
+    typedef IBackend* (BackendMap::*InitFunc)();
+
     BackendMap();
 
     void register_backends_();
-    void register_drivers_();
+
+    IBackend& init_backend_(size_t backend_index);
+    void discover_next_backend_();
 
 #ifdef ROC_TARGET_PULSEAUDIO
+    IBackend* init_pulseaudio_();
     core::Optional<PulseaudioBackend> pulseaudio_backend_;
 #endif // ROC_TARGET_PULSEAUDIO
 
+#ifdef ROC_TARGET_POSIX
+    IBackend* init_wav_();
+    core::Optional<WavBackend> wav_backend_;
+#endif // ROC_TARGET_POSIX
+
 #ifdef ROC_TARGET_SOX
+    IBackend* init_sox_();
     core::Optional<SoxBackend> sox_backend_;
 #endif // ROC_TARGET_SOX
 
+    core::Mutex mutex_;
+
+    InitFunc init_funcs_[MaxBackends];
+    size_t n_backends_;
+
     core::Array<IBackend*, MaxBackends> backends_;
+
     core::Array<DriverInfo, MaxDrivers> drivers_;
+    size_t n_discovered_backends_;
+
+    core::nanoseconds_t frame_length_;
+    audio::SampleSpec frame_sample_spec_;
 };
 
 } // namespace sndio
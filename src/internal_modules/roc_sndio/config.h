@@ -30,11 +30,20 @@ struct Config {
     //! Requested input or output latency.
     core::nanoseconds_t latency;
 
+    //! Length of asynchronous write queue.
+    //! @remarks
+    //!  If non-zero, sinks that support it don't block in write() on the sound
+    //!  server; instead, samples are put into a lock-free queue of this length,
+    //!  which is drained by the backend thread. write() blocks only when the
+    //!  queue is full. Ignored by other sinks and by sources.
+    core::nanoseconds_t queue_length;
+
     //! Initialize.
     Config()
         : sample_spec()
         , frame_length(0)
-        , latency(0) {
+        , latency(0)
+        , queue_length(0) {
     }
 };
 
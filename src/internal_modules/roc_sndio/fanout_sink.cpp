@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sndio/fanout_sink.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/shared_ptr.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+const core::nanoseconds_t ReportInterval = 10 * core::Second;
+
+const size_t MinQueueFrames = 2;
+
+} // namespace
+
+FanoutSink::Output::Output(ISink& sink, size_t queue_size, core::IAllocator& allocator)
+    : sink_(sink)
+    , queue_(allocator, queue_size)
+    , queued_samples_(0)
+    , reader_waiting_(false)
+    , writer_waiting_(false)
+    , stop_(false)
+    , n_drops_(0) {
+}
+
+FanoutSink::Output::~Output() {
+}
+
+bool FanoutSink::Output::valid() const {
+    return queue_.valid();
+}
+
+ISink& FanoutSink::Output::sink() const {
+    return sink_;
+}
+
+size_t FanoutSink::Output::num_queued_samples() const {
+    return queued_samples_;
+}
+
+size_t FanoutSink::Output::num_drops() const {
+    return n_drops_;
+}
+
+bool FanoutSink::Output::push(const Item& item, core::nanoseconds_t timeout) {
+    const core::nanoseconds_t deadline = timeout > 0
+        ? core::timestamp(core::ClockMonotonic) + timeout
+        : 0;
+
+    if (item.cmd == Cmd_Write) {
+        queued_samples_ += item.num_samples;
+    }
+
+    bool pushed = false;
+
+    for (;;) {
+        if (queue_.write(&item, 1) == 1) {
+            pushed = true;
+            break;
+        }
+
+        if (timeout <= 0) {
+            break;
+        }
+
+        // queue is full, wait until output thread processes something;
+        // flag is re-checked after setting to avoid missing a wakeup
+        writer_waiting_ = true;
+        if (queue_.size() == queue_.capacity()) {
+            if (!writer_sem_.timed_wait(deadline)) {
+                writer_waiting_ = false;
+                break;
+            }
+        }
+        writer_waiting_ = false;
+    }
+
+    if (!pushed) {
+        if (item.cmd == Cmd_Write) {
+            queued_samples_ -= item.num_samples;
+            n_drops_++;
+        }
+        return false;
+    }
+
+    if (reader_waiting_.compare_exchange(true, false)) {
+        reader_sem_.post();
+    }
+
+    return true;
+}
+
+void FanoutSink::Output::stop() {
+    stop_ = true;
+
+    if (reader_waiting_.compare_exchange(true, false)) {
+        reader_sem_.post();
+    }
+
+    if (joinable()) {
+        join();
+    }
+}
+
+void FanoutSink::Output::run() {
+    for (;;) {
+        Item item;
+
+        if (queue_.read(&item, 1) == 0) {
+            // queue is drained, exit only now, so that all frames written
+            // before stop() reach the sink
+            if (stop_) {
+                break;
+            }
+
+            reader_waiting_ = true;
+            if (queue_.size() == 0 && !stop_) {
+                reader_sem_.wait();
+            }
+            reader_waiting_ = false;
+
+            continue;
+        }
+
+        process_(item);
+
+        if (writer_waiting_.compare_exchange(true, false)) {
+            writer_sem_.post();
+        }
+    }
+}
+
+void FanoutSink::Output::process_(const Item& item) {
+    switch (item.cmd) {
+    case Cmd_Write: {
+        queued_samples_ -= item.num_samples;
+
+        audio::Frame frame(item.buffer->data(), item.num_samples);
+        frame.set_flags(item.flags);
+
+        sink_.write(frame);
+
+        item.buffer->decref();
+    } break;
+
+    case Cmd_Pause:
+        sink_.pause();
+        break;
+
+    case Cmd_Resume:
+        if (!sink_.resume()) {
+            roc_log(LogError, "fanout sink: can't resume output");
+        }
+        break;
+
+    case Cmd_Restart:
+        if (!sink_.restart()) {
+            roc_log(LogError, "fanout sink: can't restart output");
+        }
+        break;
+    }
+}
+
+FanoutSink::FanoutSink(const audio::SampleSpec& sample_spec,
+                       core::nanoseconds_t frame_length,
+                       core::nanoseconds_t queue_length,
+                       core::IAllocator& allocator)
+    : sample_spec_(sample_spec)
+    , allocator_(allocator)
+    , buffer_factory_(allocator,
+                      frame_length > 0 ? sample_spec.ns_2_samples_overall(frame_length)
+                                       : 0,
+                      false)
+    , outputs_(allocator)
+    , master_(NULL)
+    , queue_size_(0)
+    , timeout_(0)
+    , rate_limiter_(ReportInterval)
+    , valid_(false) {
+    if (buffer_factory_.buffer_size() == 0) {
+        roc_log(LogError, "fanout sink: invalid frame length: frame_length=%.3fms",
+                (double)frame_length / core::Millisecond);
+        return;
+    }
+
+    if (queue_length > 0) {
+        queue_size_ = (size_t)((queue_length + frame_length - 1) / frame_length);
+    }
+    if (queue_size_ < MinQueueFrames) {
+        queue_size_ = MinQueueFrames;
+    }
+
+    // if master doesn't free space for so long, it's stuck
+    timeout_ = (core::nanoseconds_t)queue_size_ * frame_length * 2;
+
+    roc_log(LogDebug,
+            "fanout sink: initializing: frame_length=%.3fms queue_size=%lu(%.3fms)",
+            (double)frame_length / core::Millisecond, (unsigned long)queue_size_,
+            (double)((core::nanoseconds_t)queue_size_ * frame_length)
+                / core::Millisecond);
+
+    valid_ = true;
+}
+
+FanoutSink::~FanoutSink() {
+    stop_outputs_();
+
+    for (size_t n = 0; n < outputs_.size(); n++) {
+        allocator_.destroy_object(*outputs_[n]);
+    }
+}
+
+bool FanoutSink::valid() const {
+    return valid_;
+}
+
+bool FanoutSink::add_output(ISink& sink) {
+    roc_panic_if(!valid_);
+
+    if (sink.sample_spec().sample_rate() != sample_spec_.sample_rate()
+        || sink.sample_spec().num_channels() != sample_spec_.num_channels()) {
+        roc_log(LogError,
+                "fanout sink: output sample spec mismatch:"
+                " expected_rate=%lu expected_chans=%lu actual_rate=%lu actual_chans=%lu",
+                (unsigned long)sample_spec_.sample_rate(),
+                (unsigned long)sample_spec_.num_channels(),
+                (unsigned long)sink.sample_spec().sample_rate(),
+                (unsigned long)sink.sample_spec().num_channels());
+        return false;
+    }
+
+    if (!outputs_.grow_exp(outputs_.size() + 1)) {
+        roc_log(LogError, "fanout sink: can't allocate outputs array");
+        return false;
+    }
+
+    // one extra slot for a command queued after a full queue of frames
+    Output* output = new (allocator_) Output(sink, queue_size_ + 1, allocator_);
+    if (!output) {
+        roc_log(LogError, "fanout sink: can't allocate output");
+        return false;
+    }
+
+    if (!output->valid()) {
+        roc_log(LogError, "fanout sink: can't allocate output queue");
+        allocator_.destroy_object(*output);
+        return false;
+    }
+
+    if (!output->start()) {
+        roc_log(LogError, "fanout sink: can't start output thread");
+        allocator_.destroy_object(*output);
+        return false;
+    }
+
+    outputs_.push_back(output);
+
+    if (!master_ && sink.has_clock()) {
+        master_ = output;
+    }
+
+    roc_log(LogDebug, "fanout sink: added output: index=%lu has_clock=%d is_master=%d",
+            (unsigned long)(outputs_.size() - 1), (int)sink.has_clock(),
+            (int)(master_ == output));
+
+    return true;
+}
+
+size_t FanoutSink::num_outputs() const {
+    return outputs_.size();
+}
+
+size_t FanoutSink::num_drops(size_t output_index) const {
+    return outputs_[output_index]->num_drops();
+}
+
+DeviceType FanoutSink::type() const {
+    return DeviceType_Sink;
+}
+
+DeviceState FanoutSink::state() const {
+    for (size_t n = 0; n < outputs_.size(); n++) {
+        if (outputs_[n]->sink().state() == DeviceState_Active) {
+            return DeviceState_Active;
+        }
+    }
+    return DeviceState_Paused;
+}
+
+void FanoutSink::pause() {
+    Item item = {};
+    item.cmd = Cmd_Pause;
+    push_(item);
+}
+
+bool FanoutSink::resume() {
+    Item item = {};
+    item.cmd = Cmd_Resume;
+    push_(item);
+    return true;
+}
+
+bool FanoutSink::restart() {
+    Item item = {};
+    item.cmd = Cmd_Restart;
+    push_(item);
+    return true;
+}
+
+audio::SampleSpec FanoutSink::sample_spec() const {
+    return sample_spec_;
+}
+
+core::nanoseconds_t FanoutSink::latency() const {
+    if (!master_) {
+        return 0;
+    }
+
+    return sample_spec_.samples_overall_2_ns(master_->num_queued_samples())
+        + master_->sink().latency();
+}
+
+bool FanoutSink::has_clock() const {
+    return master_ != NULL;
+}
+
+core::nanoseconds_t FanoutSink::preferred_frame_length() const {
+    if (!master_) {
+        return 0;
+    }
+
+    return master_->sink().preferred_frame_length();
+}
+
+void FanoutSink::write(audio::Frame& frame) {
+    roc_panic_if(!valid_);
+
+    const audio::sample_t* samples = frame.samples();
+    size_t n_samples = frame.num_samples();
+
+    while (n_samples != 0) {
+        const size_t chunk_size = std::min(n_samples, buffer_factory_.buffer_size());
+
+        core::SharedPtr<core::Buffer<audio::sample_t> > buffer =
+            buffer_factory_.new_buffer();
+        if (!buffer) {
+            if (rate_limiter_.allow()) {
+                roc_log(LogError, "fanout sink: can't allocate buffer, dropping frame");
+            }
+            return;
+        }
+
+        // the only copy; buffer is then shared by all output queues
+        memcpy(buffer->data(), samples, chunk_size * sizeof(audio::sample_t));
+
+        Item item = {};
+        item.cmd = Cmd_Write;
+        item.buffer = buffer.get();
+        item.num_samples = chunk_size;
+        item.flags = frame.flags();
+
+        push_(item);
+
+        samples += chunk_size;
+        n_samples -= chunk_size;
+    }
+}
+
+void FanoutSink::push_(const Item& item) {
+    for (size_t n = 0; n < outputs_.size(); n++) {
+        Output& output = *outputs_[n];
+
+        // only master may block writer; commands are never dropped for
+        // any output, so they wait too
+        const core::nanoseconds_t timeout =
+            &output == master_ || item.cmd != Cmd_Write ? timeout_ : 0;
+
+        if (item.buffer) {
+            // reference is transferred to the queue and released by output
+            item.buffer->incref();
+        }
+
+        if (!output.push(item, timeout)) {
+            if (item.buffer) {
+                item.buffer->decref();
+            }
+            if (rate_limiter_.allow()) {
+                roc_log(LogDebug,
+                        "fanout sink: output queue is full, dropping: index=%lu"
+                        " n_drops=%lu",
+                        (unsigned long)n, (unsigned long)output.num_drops());
+            }
+        }
+    }
+}
+
+void FanoutSink::stop_outputs_() {
+    for (size_t n = 0; n < outputs_.size(); n++) {
+        outputs_[n]->stop();
+    }
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/fanout_sink.h
+//! @brief Fanout sink.
+
+#ifndef ROC_SNDIO_FANOUT_SINK_H_
+#define ROC_SNDIO_FANOUT_SINK_H_
+
+#include "roc_audio/frame.h"
+#include "roc_audio/sample.h"
+#include "roc_audio/sample_spec.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/buffer.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/spsc_ring_buffer.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace sndio {
+
+//! Fanout sink.
+//! Duplicates audio stream to multiple output sinks.
+//! @remarks
+//!  Like audio::Fanout, every output gets every frame. Unlike audio::Fanout,
+//!  outputs are written asynchronously: each output has its own thread and its
+//!  own lock-free queue, so a slow output doesn't delay the others, and the
+//!  pipeline producing frames runs only once.
+//! @remarks
+//!  Every written frame is copied once into a pooled reference-counted buffer,
+//!  and the same buffer is shared by all output queues. The buffer is returned
+//!  to the pool when the last output has written it.
+//! @remarks
+//!  The first output that has its own clock becomes the clock master. While
+//!  its queue is full, write() blocks, so the writer is paced by the master
+//!  clock. If any other output queue is full, the frame is dropped for that
+//!  output only.
+//! @remarks
+//!  write(), pause(), resume() and restart() of output sinks are invoked only
+//!  on output threads. Getters like state() and latency() are forwarded to
+//!  outputs on the caller thread.
+class FanoutSink : public ISink, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p frame_length defines size of pooled buffers; larger frames are split.
+    //!  @p queue_length defines size of every output queue; it's rounded up to
+    //!  at least two frames.
+    FanoutSink(const audio::SampleSpec& sample_spec,
+               core::nanoseconds_t frame_length,
+               core::nanoseconds_t queue_length,
+               core::IAllocator& allocator);
+
+    //! Destroy.
+    //! @remarks
+    //!  Writes remaining queued frames to outputs, then stops and joins output
+    //!  threads. Output sinks are not destroyed.
+    ~FanoutSink();
+
+    //! Check if the sink was successfully constructed.
+    bool valid() const;
+
+    //! Add output sink.
+    //! @remarks
+    //!  Allocates queue and starts thread for the output. Should be called
+    //!  before the first write(). Output should have the same sample spec.
+    //! @returns
+    //!  false if allocation failed or thread can't be started.
+    bool add_output(ISink& sink);
+
+    //! Get number of outputs.
+    size_t num_outputs() const;
+
+    //! Get number of frames dropped by given output because its queue was full.
+    size_t num_drops(size_t output_index) const;
+
+    //! Get device type.
+    virtual DeviceType type() const;
+
+    //! Get device state.
+    //! @remarks
+    //!  Active if at least one output is active.
+    virtual DeviceState state() const;
+
+    //! Pause writing.
+    //! @remarks
+    //!  Forwarded to every output on its thread, in order with frames.
+    virtual void pause();
+
+    //! Resume paused writing.
+    //! @remarks
+    //!  Forwarded to every output on its thread, in order with frames.
+    //!  Failures are only logged.
+    virtual bool resume();
+
+    //! Restart writing from the beginning.
+    //! @remarks
+    //!  Forwarded to every output on its thread, in order with frames.
+    //!  Failures are only logged.
+    virtual bool restart();
+
+    //! Get sample specification of the sink.
+    virtual audio::SampleSpec sample_spec() const;
+
+    //! Get latency of the sink.
+    //! @remarks
+    //!  Includes samples queued for the clock master and master latency.
+    virtual core::nanoseconds_t latency() const;
+
+    //! Check if the sink has own clock.
+    //! @remarks
+    //!  True if there is a clock master.
+    virtual bool has_clock() const;
+
+    //! Get frame length preferred by the sink.
+    //! @remarks
+    //!  Returns frame length preferred by the clock master, if any.
+    virtual core::nanoseconds_t preferred_frame_length() const;
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+
+private:
+    enum Command { Cmd_Write, Cmd_Pause, Cmd_Resume, Cmd_Restart };
+
+    // Queue element. Trivially copyable, holds a reference to buffer.
+    struct Item {
+        Command cmd;
+        core::Buffer<audio::sample_t>* buffer;
+        size_t num_samples;
+        unsigned flags;
+    };
+
+    class Output : public core::Thread {
+    public:
+        Output(ISink& sink, size_t queue_size, core::IAllocator& allocator);
+
+        virtual ~Output();
+
+        bool valid() const;
+
+        ISink& sink() const;
+
+        size_t num_queued_samples() const;
+        size_t num_drops() const;
+
+        // If timeout is zero, returns false immediately when queue is full.
+        bool push(const Item& item, core::nanoseconds_t timeout);
+
+        void stop();
+
+    private:
+        virtual void run();
+
+        void process_(const Item& item);
+
+        ISink& sink_;
+
+        core::SpscRingBuffer<Item> queue_;
+        core::Atomic<size_t> queued_samples_;
+
+        core::Semaphore reader_sem_;
+        core::Atomic<int> reader_waiting_;
+
+        core::Semaphore writer_sem_;
+        core::Atomic<int> writer_waiting_;
+
+        core::Atomic<int> stop_;
+        core::Atomic<size_t> n_drops_;
+    };
+
+    void push_(const Item& item);
+    void stop_outputs_();
+
+    const audio::SampleSpec sample_spec_;
+
+    core::IAllocator& allocator_;
+    core::BufferFactory<audio::sample_t> buffer_factory_;
+
+    core::Array<Output*> outputs_;
+    Output* master_;
+
+    size_t queue_size_;
+    core::nanoseconds_t timeout_;
+
+    core::RateLimiter rate_limiter_;
+
+    bool valid_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_FANOUT_SINK_H_
@@ -14,5 +14,9 @@ namespace sndio {
 IDevice::~IDevice() {
 }
 
+core::nanoseconds_t IDevice::preferred_frame_length() const {
+    return 0;
+}
+
 } // namespace sndio
 } // namespace roc
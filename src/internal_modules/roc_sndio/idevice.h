@@ -55,6 +55,15 @@ public:
 
     //! Check if the device has own clock.
     virtual bool has_clock() const = 0;
+
+    //! Get frame length preferred by the device.
+    //! @remarks
+    //!  Returns duration of the device period, i.e. the chunk of samples that the
+    //!  device consumes or produces at once, or zero if the device has no
+    //!  preference. The pipeline may align its frame length to this value; see
+    //!  negotiate_frame_length().
+    //!  Default implementation returns zero.
+    virtual core::nanoseconds_t preferred_frame_length() const;
 };
 
 } // namespace sndio
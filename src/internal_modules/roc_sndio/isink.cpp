@@ -14,5 +14,16 @@ namespace sndio {
 ISink::~ISink() {
 }
 
+bool ISink::has_ready_wait() const {
+    return false;
+}
+
+bool ISink::wait_ready(size_t n_samples, core::nanoseconds_t timeout) {
+    (void)n_samples;
+    (void)timeout;
+
+    return true;
+}
+
 } // namespace sndio
 } // namespace roc
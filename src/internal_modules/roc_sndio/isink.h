@@ -13,6 +13,8 @@
 #define ROC_SNDIO_ISINK_H_
 
 #include "roc_audio/iframe_writer.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
 #include "roc_sndio/idevice.h"
 
 namespace roc {
@@ -22,6 +24,22 @@ namespace sndio {
 class ISink : public IDevice, public audio::IFrameWriter {
 public:
     virtual ~ISink();
+
+    //! Check if the sink can report when it's ready for more samples.
+    //! @remarks
+    //!  Returns true if the sink implements wait_ready(), i.e. it can block until
+    //!  its clock (e.g. period interrupt or poll fd) lets it accept more samples.
+    //!  Default implementation returns false.
+    virtual bool has_ready_wait() const;
+
+    //! Wait until the sink can accept given number of samples without blocking.
+    //! @remarks
+    //!  Allows the caller to produce next frame just in time, right when the
+    //!  device needs it, instead of producing it in advance and blocking in
+    //!  write(). Default implementation returns true immediately.
+    //! @returns
+    //!  false if timeout expired before the sink became ready.
+    virtual bool wait_ready(size_t n_samples, core::nanoseconds_t timeout);
 };
 
 } // namespace sndio
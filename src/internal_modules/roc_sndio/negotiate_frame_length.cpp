@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sndio/negotiate_frame_length.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace sndio {
+
+core::nanoseconds_t negotiate_frame_length(const IDevice& device,
+                                           core::nanoseconds_t frame_length) {
+    const core::nanoseconds_t period = device.preferred_frame_length();
+    const audio::SampleSpec sample_spec = device.sample_spec();
+
+    if (period <= 0 || frame_length <= 0 || sample_spec.sample_rate() == 0) {
+        return frame_length;
+    }
+
+    const size_t period_size = sample_spec.ns_2_samples_per_chan(period);
+    const size_t frame_size = sample_spec.ns_2_samples_per_chan(frame_length);
+
+    if (period_size == 0 || frame_size == 0) {
+        return frame_length;
+    }
+
+    // smallest number of frames per period that keeps frame within requested size
+    size_t n_frames = (period_size + frame_size - 1) / frame_size;
+
+    for (; period_size / n_frames * 2 >= frame_size; n_frames++) {
+        if (period_size % n_frames != 0) {
+            continue;
+        }
+
+        const core::nanoseconds_t aligned_length =
+            sample_spec.samples_per_chan_2_ns(period_size / n_frames);
+
+        roc_log(LogDebug,
+                "negotiate frame length: aligned to device period:"
+                " period=%lu requested_frame=%lu aligned_frame=%lu",
+                (unsigned long)period_size, (unsigned long)frame_size,
+                (unsigned long)(period_size / n_frames));
+
+        return aligned_length;
+    }
+
+    roc_log(LogDebug,
+            "negotiate frame length: can't align to device period:"
+            " period=%lu requested_frame=%lu",
+            (unsigned long)period_size, (unsigned long)frame_size);
+
+    return frame_length;
+}
+
+} // namespace sndio
+} // namespace roc
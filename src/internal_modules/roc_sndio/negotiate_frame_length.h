@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/negotiate_frame_length.h
+//! @brief Negotiate frame length with device.
+
+#ifndef ROC_SNDIO_NEGOTIATE_FRAME_LENGTH_H_
+#define ROC_SNDIO_NEGOTIATE_FRAME_LENGTH_H_
+
+#include "roc_core/time.h"
+#include "roc_sndio/idevice.h"
+
+namespace roc {
+namespace sndio {
+
+//! Align frame length to the period preferred by device.
+//! @remarks
+//!  Returns the largest integer divisor of the device period (in samples per
+//!  channel) that is not greater than @p frame_length, so that every period is
+//!  made of a whole number of frames. If the device has no preference, or the
+//!  only suitable divisors are less than half of @p frame_length, returns
+//!  @p frame_length unchanged.
+core::nanoseconds_t negotiate_frame_length(const IDevice& device,
+                                           core::nanoseconds_t frame_length);
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_NEGOTIATE_FRAME_LENGTH_H_
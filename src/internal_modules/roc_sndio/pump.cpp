@@ -18,13 +18,17 @@ Pump::Pump(core::BufferFactory<audio::sample_t>& buffer_factory,
            ISink& sink,
            core::nanoseconds_t frame_length,
            const audio::SampleSpec& sample_spec,
-           Mode mode)
+           Mode mode,
+           ClockMode clock_mode)
     : main_source_(source)
     , backup_source_(backup_source)
     , sink_(sink)
     , sample_spec_(sample_spec)
+    , frame_length_(frame_length)
     , n_bufs_(0)
     , oneshot_(mode == ModeOneshot)
+    , sink_clock_(false)
+    , no_clock_(false)
     , stop_(0) {
     size_t frame_size = sample_spec_.ns_2_samples_overall(frame_length);
     if (frame_size == 0) {
@@ -45,6 +49,26 @@ Pump::Pump(core::BufferFactory<audio::sample_t>& buffer_factory,
     }
 
     frame_buffer_.reslice(0, frame_size);
+
+    if (clock_mode == ClockSink) {
+        if (sink.has_clock() && sink.has_ready_wait()) {
+            roc_log(LogDebug, "pump: using sink clock");
+            sink_clock_ = true;
+        } else {
+            roc_log(LogInfo,
+                    "pump: sink can't report readiness, falling back to default clock");
+        }
+    }
+
+    if (clock_mode == ClockNone) {
+        if (!source.has_clock() && !sink.has_clock() && !backup_source) {
+            roc_log(LogDebug, "pump: running without clock");
+            no_clock_ = true;
+        } else {
+            roc_log(LogInfo,
+                    "pump: source or sink has clock, falling back to default clock");
+        }
+    }
 }
 
 bool Pump::valid() const {
@@ -52,6 +76,10 @@ bool Pump::valid() const {
 }
 
 bool Pump::run() {
+    if (no_clock_) {
+        return run_no_clock_();
+    }
+
     roc_log(LogDebug, "pump: starting main loop");
 
     ISource* current_source = &main_source_;
@@ -86,6 +114,15 @@ bool Pump::run() {
             }
         }
 
+        if (sink_clock_) {
+            // read frame only when device is ready to play it
+            const core::nanoseconds_t timeout = sink_.latency() + frame_length_ * 2;
+
+            if (!sink_.wait_ready(frame_buffer_.size(), timeout)) {
+                roc_log(LogDebug, "pump: timed out waiting for sink");
+            }
+        }
+
         audio::Frame frame(frame_buffer_.data(), frame_buffer_.size());
 
         if (!current_source->read(frame)) {
@@ -119,5 +156,32 @@ void Pump::stop() {
     stop_ = 1;
 }
 
+bool Pump::run_no_clock_() {
+    roc_log(LogDebug, "pump: starting main loop without clock");
+
+    while (!stop_) {
+        if (oneshot_ && n_bufs_ != 0 && main_source_.state() != DeviceState_Active) {
+            roc_log(LogInfo, "pump: main source become inactive in oneshot mode");
+            break;
+        }
+
+        audio::Frame frame(frame_buffer_.data(), frame_buffer_.size());
+
+        if (!main_source_.read(frame)) {
+            roc_log(LogDebug, "pump: got eof from source");
+            break;
+        }
+
+        sink_.write(frame);
+
+        n_bufs_++;
+    }
+
+    roc_log(LogDebug, "pump: exiting main loop, wrote %lu buffers from main source",
+            (unsigned long)n_bufs_);
+
+    return !stop_;
+}
+
 } // namespace sndio
 } // namespace roc
@@ -40,6 +40,29 @@ public:
         ModeOneshot = 1
     };
 
+    //! Pump clock mode.
+    enum ClockMode {
+        //! Timing comes from whichever of source and sink blocks.
+        //! Next frame is read from source while previous one is being
+        //! played, and then write() blocks until sink has room for it.
+        ClockDefault = 0,
+
+        //! Timing comes from sink clock.
+        //! Before reading next frame, pump waits until the sink is ready to
+        //! accept it, and then reads and writes it without blocking. Frames
+        //! are read deterministically at device pace and just in time, so
+        //! no extra frame is buffered between source and sink. Falls back
+        //! to ClockDefault if sink does not support ISink::wait_ready().
+        ClockSink = 1,
+
+        //! No clock at all.
+        //! Neither source nor sink has own clock, e.g. when converting files.
+        //! Pump moves frames as fast as possible: it doesn't poll source state
+        //! and doesn't compute timestamps for ISource::reclock(). Falls back to
+        //! ClockDefault if source or sink has clock, or backup source is used.
+        ClockNone = 2
+    };
+
     //! Initialize.
     Pump(core::BufferFactory<audio::sample_t>& buffer_factory,
          ISource& source,
@@ -47,7 +70,8 @@ public:
          ISink& sink,
          core::nanoseconds_t frame_length,
          const audio::SampleSpec& sample_spec,
-         Mode mode);
+         Mode mode,
+         ClockMode clock_mode = ClockDefault);
 
     //! Check if the object was successfulyl constructed.
     bool valid() const;
@@ -64,16 +88,21 @@ public:
     void stop();
 
 private:
+    bool run_no_clock_();
+
     ISource& main_source_;
     ISource* backup_source_;
     ISink& sink_;
 
     audio::SampleSpec sample_spec_;
+    core::nanoseconds_t frame_length_;
 
     core::Slice<audio::sample_t> frame_buffer_;
 
     size_t n_bufs_;
     const bool oneshot_;
+    bool sink_clock_;
+    bool no_clock_;
 
     core::Atomic<int> stop_;
 };
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sndio/switchable_sink.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace sndio {
+
+SwitchableSink::SwitchableSink(ISink& sink)
+    : sink_(&sink)
+    , paused_(false)
+    , n_switches_(0) {
+}
+
+SwitchableSink::~SwitchableSink() {
+}
+
+ISink* SwitchableSink::switch_sink(ISink& sink) {
+    core::Mutex::Lock lock(mutex_);
+
+    if (&sink == sink_) {
+        return sink_;
+    }
+
+    if (!is_compatible_(sink)) {
+        return NULL;
+    }
+
+    if (paused_) {
+        sink.pause();
+    }
+
+    ISink* old_sink = sink_;
+    sink_ = &sink;
+
+    n_switches_++;
+
+    roc_log(LogInfo, "switchable sink: switched to new sink: n_switches=%lu",
+            (unsigned long)n_switches_);
+
+    return old_sink;
+}
+
+size_t SwitchableSink::num_switches() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return n_switches_;
+}
+
+DeviceType SwitchableSink::type() const {
+    return DeviceType_Sink;
+}
+
+DeviceState SwitchableSink::state() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return sink_->state();
+}
+
+void SwitchableSink::pause() {
+    core::Mutex::Lock lock(mutex_);
+
+    paused_ = true;
+    sink_->pause();
+}
+
+bool SwitchableSink::resume() {
+    core::Mutex::Lock lock(mutex_);
+
+    if (!sink_->resume()) {
+        return false;
+    }
+
+    paused_ = false;
+    return true;
+}
+
+bool SwitchableSink::restart() {
+    core::Mutex::Lock lock(mutex_);
+
+    if (!sink_->restart()) {
+        return false;
+    }
+
+    paused_ = false;
+    return true;
+}
+
+audio::SampleSpec SwitchableSink::sample_spec() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return sink_->sample_spec();
+}
+
+core::nanoseconds_t SwitchableSink::latency() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return sink_->latency();
+}
+
+bool SwitchableSink::has_clock() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return sink_->has_clock();
+}
+
+core::nanoseconds_t SwitchableSink::preferred_frame_length() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return sink_->preferred_frame_length();
+}
+
+bool SwitchableSink::has_ready_wait() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return sink_->has_ready_wait();
+}
+
+bool SwitchableSink::wait_ready(size_t n_samples, core::nanoseconds_t timeout) {
+    core::Mutex::Lock lock(mutex_);
+
+    return sink_->wait_ready(n_samples, timeout);
+}
+
+void SwitchableSink::write(audio::Frame& frame) {
+    // lock is held during the whole write, so that old sink is not used after
+    // switch_sink() returns
+    core::Mutex::Lock lock(mutex_);
+
+    sink_->write(frame);
+}
+
+bool SwitchableSink::is_compatible_(const ISink& sink) const {
+    const audio::SampleSpec old_spec = sink_->sample_spec();
+    const audio::SampleSpec new_spec = sink.sample_spec();
+
+    if (old_spec.sample_rate() != new_spec.sample_rate()
+        || old_spec.num_channels() != new_spec.num_channels()) {
+        roc_log(LogError,
+                "switchable sink: can't switch to sink with different sample spec:"
+                " old_rate=%lu old_chans=%lu new_rate=%lu new_chans=%lu",
+                (unsigned long)old_spec.sample_rate(),
+                (unsigned long)old_spec.num_channels(),
+                (unsigned long)new_spec.sample_rate(),
+                (unsigned long)new_spec.num_channels());
+        return false;
+    }
+
+    if (sink_->has_clock() != sink.has_clock()) {
+        roc_log(LogError,
+                "switchable sink: can't switch to sink with different clock:"
+                " old_has_clock=%d new_has_clock=%d",
+                (int)sink_->has_clock(), (int)sink.has_clock());
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
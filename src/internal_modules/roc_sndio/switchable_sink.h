@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/switchable_sink.h
+//! @brief Switchable sink.
+
+#ifndef ROC_SNDIO_SWITCHABLE_SINK_H_
+#define ROC_SNDIO_SWITCHABLE_SINK_H_
+
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace sndio {
+
+//! Switchable sink.
+//! Forwards everything to a backing sink that can be replaced on the fly.
+//! @remarks
+//!  Allows to change output device without recreating the pump and the
+//!  pipeline that feeds it. E.g. when ReceiverSource is written to this sink,
+//!  its sessions keep running during the switch, and latency doesn't need to
+//!  reconverge.
+//! @remarks
+//!  Switch happens between frames: switch_sink() waits until ongoing write()
+//!  returns, and the next write() goes to the new sink.
+class SwitchableSink : public ISink, public core::NonCopyable<> {
+public:
+    //! Initialize with initial backing sink.
+    explicit SwitchableSink(ISink& sink);
+
+    ~SwitchableSink();
+
+    //! Replace backing sink.
+    //! @remarks
+    //!  Thread-safe. New sink should have the same sample rate, the same number
+    //!  of channels, and the same clock presence as the current one, because
+    //!  the pipeline was configured for them. If this sink is paused, the new
+    //!  sink is paused too.
+    //! @returns
+    //!  previous sink, which is not used anymore after this call and may be
+    //!  closed by the caller, or NULL if new sink is not compatible.
+    ISink* switch_sink(ISink& sink);
+
+    //! Get number of successful switches.
+    size_t num_switches() const;
+
+    //! Get device type.
+    virtual DeviceType type() const;
+
+    //! Get device state.
+    virtual DeviceState state() const;
+
+    //! Pause writing.
+    virtual void pause();
+
+    //! Resume paused writing.
+    virtual bool resume();
+
+    //! Restart writing from the beginning.
+    virtual bool restart();
+
+    //! Get sample specification of the sink.
+    virtual audio::SampleSpec sample_spec() const;
+
+    //! Get latency of the sink.
+    virtual core::nanoseconds_t latency() const;
+
+    //! Check if the sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Get frame length preferred by the sink.
+    virtual core::nanoseconds_t preferred_frame_length() const;
+
+    //! Check if the sink can report when it's ready for more samples.
+    virtual bool has_ready_wait() const;
+
+    //! Wait until the sink can accept given number of samples without blocking.
+    virtual bool wait_ready(size_t n_samples, core::nanoseconds_t timeout);
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+
+private:
+    bool is_compatible_(const ISink& sink) const;
+
+    ISink* sink_;
+
+    bool paused_;
+    size_t n_switches_;
+
+    core::Mutex mutex_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_SWITCHABLE_SINK_H_
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "roc_sndio/mmap_wav_sink.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+const audio::PcmEncoding FileEncoding = audio::PcmEncoding_SInt32;
+
+} // namespace
+
+MmapWavSink::MmapWavSink(const Config& config)
+    : sample_spec_(config.sample_spec)
+    , fd_(-1)
+    , map_data_(NULL)
+    , map_size_(0)
+    , header_(FileEncoding,
+              config.sample_spec.sample_rate(),
+              config.sample_spec.num_channels())
+    , mapper_(audio::PcmFormat(audio::PcmEncoding_Float32, audio::PcmEndian_Native),
+              audio::PcmFormat(FileEncoding, audio::PcmEndian_Little))
+    , data_size_(0)
+    , failed_(false)
+    , valid_(false) {
+    if (config.sample_spec.num_channels() == 0) {
+        roc_log(LogError, "mmap wav sink: # of channels is zero");
+        return;
+    }
+
+    if (config.sample_spec.sample_rate() == 0) {
+        roc_log(LogError, "mmap wav sink: sample rate is zero");
+        return;
+    }
+
+    if (config.latency != 0) {
+        roc_log(LogError, "mmap wav sink: setting io latency not supported");
+        return;
+    }
+
+    valid_ = true;
+}
+
+MmapWavSink::~MmapWavSink() {
+    close_();
+}
+
+bool MmapWavSink::valid() const {
+    return valid_;
+}
+
+bool MmapWavSink::open(const char* path) {
+    roc_panic_if(!valid_);
+    roc_panic_if(!path);
+
+    if (fd_ != -1) {
+        roc_panic("mmap wav sink: can't call open() more than once");
+    }
+
+    roc_log(LogDebug, "mmap wav sink: opening: path=%s", path);
+
+    if (strcmp(path, "-") == 0) {
+        roc_log(LogDebug, "mmap wav sink: can't map stdout");
+        return false;
+    }
+
+    struct stat st;
+    if (stat(path, &st) == 0 && !S_ISREG(st.st_mode)) {
+        roc_log(LogDebug, "mmap wav sink: not a regular file: %s", path);
+        return false;
+    }
+
+    fd_ = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ == -1) {
+        roc_log(LogDebug, "mmap wav sink: open(): %s: %s", path,
+                core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (!reserve_(WavHeader::WriteSize)) {
+        return false;
+    }
+
+    roc_log(LogInfo, "mmap wav sink: opened: path=%s rate=%lu n_channels=%lu", path,
+            (unsigned long)sample_spec_.sample_rate(),
+            (unsigned long)sample_spec_.num_channels());
+
+    return true;
+}
+
+DeviceType MmapWavSink::type() const {
+    return DeviceType_Sink;
+}
+
+DeviceState MmapWavSink::state() const {
+    return DeviceState_Active;
+}
+
+void MmapWavSink::pause() {
+    // no-op
+}
+
+bool MmapWavSink::resume() {
+    return true;
+}
+
+bool MmapWavSink::restart() {
+    return true;
+}
+
+audio::SampleSpec MmapWavSink::sample_spec() const {
+    roc_panic_if(!valid_);
+
+    return sample_spec_;
+}
+
+core::nanoseconds_t MmapWavSink::latency() const {
+    return 0;
+}
+
+bool MmapWavSink::has_clock() const {
+    return false;
+}
+
+void MmapWavSink::write(audio::Frame& frame) {
+    roc_panic_if(!valid_);
+
+    if (!map_data_) {
+        if (!failed_) {
+            roc_panic("mmap wav sink: write: non-open output file");
+        }
+        return;
+    }
+
+    const size_t n_bytes = mapper_.output_byte_count(frame.num_samples());
+
+    if (!reserve_(WavHeader::WriteSize + data_size_ + n_bytes)) {
+        return;
+    }
+
+    size_t in_bit_offset = 0;
+    size_t out_bit_offset = 0;
+
+    const size_t n_samples = mapper_.map(
+        frame.samples(), frame.num_samples() * sizeof(audio::sample_t), in_bit_offset,
+        map_data_ + WavHeader::WriteSize + data_size_, n_bytes, out_bit_offset,
+        frame.num_samples());
+
+    data_size_ += mapper_.output_byte_count(n_samples);
+}
+
+bool MmapWavSink::reserve_(size_t size) {
+    if (size <= map_size_) {
+        return true;
+    }
+
+    size_t new_size = map_size_ < MinMapSize ? (size_t)MinMapSize : map_size_;
+    while (new_size < size) {
+        new_size *= 2;
+    }
+
+    if (!remap_(new_size)) {
+        // stop writing, but keep what we've already written
+        failed_ = true;
+        close_();
+        return false;
+    }
+
+    return true;
+}
+
+bool MmapWavSink::remap_(size_t size) {
+    if (map_data_) {
+        if (munmap(map_data_, map_size_) != 0) {
+            roc_log(LogError, "mmap wav sink: munmap(): %s",
+                    core::errno_to_str().c_str());
+        }
+        map_data_ = NULL;
+    }
+
+    if (ftruncate(fd_, (off_t)size) != 0) {
+        roc_log(LogError, "mmap wav sink: ftruncate(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    void* data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (data == MAP_FAILED) {
+        roc_log(LogError, "mmap wav sink: mmap(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    map_data_ = (uint8_t*)data;
+    map_size_ = size;
+
+    return true;
+}
+
+void MmapWavSink::close_() {
+    if (fd_ == -1) {
+        return;
+    }
+
+    roc_log(LogDebug, "mmap wav sink: closing: data_size=%lu",
+            (unsigned long)data_size_);
+
+    if (map_data_) {
+        if (munmap(map_data_, map_size_) != 0) {
+            roc_log(LogError, "mmap wav sink: munmap(): %s",
+                    core::errno_to_str().c_str());
+        }
+        map_data_ = NULL;
+        map_size_ = 0;
+    }
+
+    if (ftruncate(fd_, off_t(WavHeader::WriteSize + data_size_)) != 0) {
+        roc_log(LogError, "mmap wav sink: ftruncate(): %s", core::errno_to_str().c_str());
+    }
+
+    // header is written last, when the size of data is known
+    uint8_t header[WavHeader::WriteSize];
+    header_.write(header, data_size_);
+
+    if (pwrite(fd_, header, sizeof(header), 0) != (ssize_t)sizeof(header)) {
+        roc_log(LogError, "mmap wav sink: pwrite(): %s", core::errno_to_str().c_str());
+    }
+
+    if (::close(fd_) != 0) {
+        roc_log(LogError, "mmap wav sink: close(): %s", core::errno_to_str().c_str());
+    }
+
+    fd_ = -1;
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_posix/roc_sndio/mmap_wav_sink.h
+//! @brief Memory-mapped WAV sink.
+
+#ifndef ROC_SNDIO_MMAP_WAV_SINK_H_
+#define ROC_SNDIO_MMAP_WAV_SINK_H_
+
+#include "roc_audio/pcm_mapper.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isink.h"
+#include "roc_sndio/wav_header.h"
+
+namespace roc {
+namespace sndio {
+
+//! Memory-mapped WAV sink.
+//! @remarks
+//!  Writes 32-bit integer PCM WAV file, same as SoX does by default. The file
+//!  is grown geometrically with ftruncate() and mapped into memory, and frames
+//!  are converted directly into the mapping using PcmMapper. When the sink is
+//!  closed, the file is truncated to the actual size and the header is updated.
+//!  Works only with regular files.
+class MmapWavSink : public ISink, private core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit MmapWavSink(const Config& config);
+
+    virtual ~MmapWavSink();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Open output file.
+    bool open(const char* path);
+
+    //! Get device type.
+    virtual DeviceType type() const;
+
+    //! Get device state.
+    virtual DeviceState state() const;
+
+    //! Pause writing.
+    virtual void pause();
+
+    //! Resume paused writing.
+    virtual bool resume();
+
+    //! Restart writing from the beginning.
+    virtual bool restart();
+
+    //! Get sample specification of the sink.
+    virtual audio::SampleSpec sample_spec() const;
+
+    //! Get latency of the sink.
+    virtual core::nanoseconds_t latency() const;
+
+    //! Check if the sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+
+private:
+    enum { MinMapSize = 1024 * 1024 };
+
+    bool reserve_(size_t size);
+    bool remap_(size_t size);
+    void close_();
+
+    audio::SampleSpec sample_spec_;
+
+    int fd_;
+    uint8_t* map_data_;
+    size_t map_size_;
+
+    WavHeader header_;
+    audio::PcmMapper mapper_;
+    size_t data_size_;
+
+    bool failed_;
+    bool valid_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_MMAP_WAV_SINK_H_
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "roc_sndio/mmap_wav_source.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace sndio {
+
+MmapWavSource::MmapWavSource(const Config& config)
+    : fd_(-1)
+    , map_data_(NULL)
+    , map_size_(0)
+    , bit_offset_(0)
+    , eof_(false)
+    , paused_(false)
+    , valid_(false) {
+    if (config.sample_spec.num_channels() == 0) {
+        roc_log(LogError, "mmap wav source: # of channels is zero");
+        return;
+    }
+
+    if (config.latency != 0) {
+        roc_log(LogError, "mmap wav source: setting io latency not supported");
+        return;
+    }
+
+    sample_spec_ = config.sample_spec;
+
+    valid_ = true;
+}
+
+MmapWavSource::~MmapWavSource() {
+    close_();
+}
+
+bool MmapWavSource::valid() const {
+    return valid_;
+}
+
+bool MmapWavSource::open(const char* path) {
+    roc_panic_if(!valid_);
+    roc_panic_if(!path);
+
+    if (fd_ != -1) {
+        roc_panic("mmap wav source: can't call open() more than once");
+    }
+
+    roc_log(LogDebug, "mmap wav source: opening: path=%s", path);
+
+    if (strcmp(path, "-") == 0) {
+        roc_log(LogDebug, "mmap wav source: can't map stdin");
+        return false;
+    }
+
+    fd_ = ::open(path, O_RDONLY);
+    if (fd_ == -1) {
+        roc_log(LogDebug, "mmap wav source: open(): %s: %s", path,
+                core::errno_to_str().c_str());
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        roc_log(LogDebug, "mmap wav source: fstat(): %s: %s", path,
+                core::errno_to_str().c_str());
+        close_();
+        return false;
+    }
+
+    if (!S_ISREG(st.st_mode) || st.st_size == 0) {
+        roc_log(LogDebug, "mmap wav source: not a regular non-empty file: %s", path);
+        close_();
+        return false;
+    }
+
+    void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (data == MAP_FAILED) {
+        roc_log(LogDebug, "mmap wav source: mmap(): %s: %s", path,
+                core::errno_to_str().c_str());
+        close_();
+        return false;
+    }
+
+    map_data_ = (uint8_t*)data;
+    map_size_ = (size_t)st.st_size;
+
+#ifdef MADV_SEQUENTIAL
+    // let the kernel read ahead aggressively and drop pages behind us
+    (void)madvise(map_data_, map_size_, MADV_SEQUENTIAL);
+#endif
+
+    if (!header_.parse(map_data_, map_size_)) {
+        roc_log(LogDebug, "mmap wav source: can't parse wav header: %s", path);
+        close_();
+        return false;
+    }
+
+    if (header_.num_channels() != sample_spec_.num_channels()) {
+        roc_log(LogError,
+                "mmap wav source: can't open: unsupported # of channels: "
+                "expected=%lu actual=%lu",
+                (unsigned long)sample_spec_.num_channels(),
+                (unsigned long)header_.num_channels());
+        close_();
+        return false;
+    }
+
+    sample_spec_.set_sample_rate(header_.sample_rate());
+
+    mapper_.reset(new (mapper_) audio::PcmMapper(
+        audio::PcmFormat(header_.encoding(), audio::PcmEndian_Little),
+        audio::PcmFormat(audio::PcmEncoding_Float32, audio::PcmEndian_Native)));
+
+    bit_offset_ = 0;
+
+    roc_log(LogInfo,
+            "mmap wav source: opened: path=%s rate=%lu n_channels=%lu sample_size=%lu"
+            " data_size=%lu",
+            path, (unsigned long)header_.sample_rate(),
+            (unsigned long)header_.num_channels(), (unsigned long)header_.sample_size(),
+            (unsigned long)header_.data_size());
+
+    return true;
+}
+
+DeviceType MmapWavSource::type() const {
+    return DeviceType_Source;
+}
+
+DeviceState MmapWavSource::state() const {
+    roc_panic_if(!valid_);
+
+    if (paused_) {
+        return DeviceState_Paused;
+    } else {
+        return DeviceState_Active;
+    }
+}
+
+void MmapWavSource::pause() {
+    roc_panic_if(!valid_);
+
+    paused_ = true;
+}
+
+bool MmapWavSource::resume() {
+    roc_panic_if(!valid_);
+
+    paused_ = false;
+    return true;
+}
+
+bool MmapWavSource::restart() {
+    roc_panic_if(!valid_);
+
+    if (!map_data_) {
+        roc_panic("mmap wav source: restart: non-open input file");
+    }
+
+    roc_log(LogDebug, "mmap wav source: restarting");
+
+    bit_offset_ = 0;
+    paused_ = false;
+    eof_ = false;
+
+    return true;
+}
+
+audio::SampleSpec MmapWavSource::sample_spec() const {
+    roc_panic_if(!valid_);
+
+    if (!map_data_) {
+        roc_panic("mmap wav source: sample_spec(): non-open input file");
+    }
+
+    return sample_spec_;
+}
+
+core::nanoseconds_t MmapWavSource::latency() const {
+    return 0;
+}
+
+bool MmapWavSource::has_clock() const {
+    return false;
+}
+
+void MmapWavSource::reclock(packet::ntp_timestamp_t) {
+    // no-op
+}
+
+bool MmapWavSource::read(audio::Frame& frame) {
+    roc_panic_if(!valid_);
+
+    if (paused_ || eof_) {
+        return false;
+    }
+
+    if (!map_data_) {
+        roc_panic("mmap wav source: read: non-open input file");
+    }
+
+    size_t out_bit_offset = 0;
+
+    const size_t n_samples =
+        mapper_->map(map_data_ + header_.data_offset(), header_.data_size(),
+                     bit_offset_, frame.samples(),
+                     frame.num_samples() * sizeof(audio::sample_t), out_bit_offset,
+                     frame.num_samples());
+
+    if (n_samples < frame.num_samples()) {
+        roc_log(LogDebug, "mmap wav source: got eof");
+        eof_ = true;
+    }
+
+    if (n_samples == 0) {
+        return false;
+    }
+
+    if (n_samples < frame.num_samples()) {
+        memset(frame.samples() + n_samples, 0,
+               (frame.num_samples() - n_samples) * sizeof(audio::sample_t));
+    }
+
+    return true;
+}
+
+void MmapWavSource::close_() {
+    if (map_data_) {
+        if (munmap(map_data_, map_size_) != 0) {
+            roc_log(LogError, "mmap wav source: munmap(): %s",
+                    core::errno_to_str().c_str());
+        }
+        map_data_ = NULL;
+        map_size_ = 0;
+    }
+
+    if (fd_ != -1) {
+        if (::close(fd_) != 0) {
+            roc_log(LogError, "mmap wav source: close(): %s",
+                    core::errno_to_str().c_str());
+        }
+        fd_ = -1;
+    }
+}
+
+} // namespace sndio
+} // namespace roc
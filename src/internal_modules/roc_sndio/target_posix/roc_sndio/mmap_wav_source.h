@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_posix/roc_sndio/mmap_wav_source.h
+//! @brief Memory-mapped WAV source.
+
+#ifndef ROC_SNDIO_MMAP_WAV_SOURCE_H_
+#define ROC_SNDIO_MMAP_WAV_SOURCE_H_
+
+#include "roc_audio/pcm_mapper.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/optional.h"
+#include "roc_core/stddefs.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isource.h"
+#include "roc_sndio/wav_header.h"
+
+namespace roc {
+namespace sndio {
+
+//! Memory-mapped WAV source.
+//! @remarks
+//!  Maps the whole input file into memory and converts samples from the mapping
+//!  directly into frames using PcmMapper, without intermediate buffering and
+//!  without a read() call per frame. Works only with regular files.
+class MmapWavSource : public ISource, private core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit MmapWavSource(const Config& config);
+
+    virtual ~MmapWavSource();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Open input file.
+    bool open(const char* path);
+
+    //! Get device type.
+    virtual DeviceType type() const;
+
+    //! Get device state.
+    virtual DeviceState state() const;
+
+    //! Pause reading.
+    virtual void pause();
+
+    //! Resume paused reading.
+    virtual bool resume();
+
+    //! Restart reading from the beginning.
+    virtual bool restart();
+
+    //! Get sample specification of the source.
+    virtual audio::SampleSpec sample_spec() const;
+
+    //! Get latency of the source.
+    virtual core::nanoseconds_t latency() const;
+
+    //! Check if the source has own clock.
+    virtual bool has_clock() const;
+
+    //! Adjust source clock to match consumer clock.
+    virtual void reclock(packet::ntp_timestamp_t timestamp);
+
+    //! Read frame.
+    virtual bool read(audio::Frame&);
+
+private:
+    void close_();
+
+    audio::SampleSpec sample_spec_;
+
+    int fd_;
+    uint8_t* map_data_;
+    size_t map_size_;
+
+    WavHeader header_;
+    core::Optional<audio::PcmMapper> mapper_;
+    size_t bit_offset_;
+
+    bool eof_;
+    bool paused_;
+    bool valid_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_MMAP_WAV_SOURCE_H_
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <strings.h>
+
+#include "roc_sndio/wav_backend.h"
+#include "roc_core/log.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_core/stddefs.h"
+#include "roc_sndio/driver.h"
+#include "roc_sndio/mmap_wav_sink.h"
+#include "roc_sndio/mmap_wav_source.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+bool has_wav_extension(const char* path) {
+    const char* dot = strrchr(path, '.');
+    return dot && strcasecmp(dot, ".wav") == 0;
+}
+
+} // namespace
+
+WavBackend::WavBackend() {
+    roc_log(LogDebug, "wav backend: initializing");
+}
+
+void WavBackend::discover_drivers(core::Array<DriverInfo, MaxDrivers>& driver_list) {
+    if (!driver_list.grow(driver_list.size() + 1)) {
+        roc_panic("wav backend: can't grow drivers array");
+    }
+
+    driver_list.push_back(DriverInfo(
+        "wav", DriverType_File, DriverFlag_SupportsSource | DriverFlag_SupportsSink,
+        this));
+}
+
+IDevice* WavBackend::open_device(DeviceType device_type,
+                                 DriverType driver_type,
+                                 const char* driver,
+                                 const char* path,
+                                 const Config& config,
+                                 core::IAllocator& allocator) {
+    if (driver_type != DriverType_File || !path) {
+        return NULL;
+    }
+
+    if (driver) {
+        if (strcmp(driver, "wav") != 0) {
+            return NULL;
+        }
+    } else {
+        // auto-detect format by extension, like SoX does
+        if (!has_wav_extension(path)) {
+            return NULL;
+        }
+    }
+
+    switch (device_type) {
+    case DeviceType_Sink: {
+        core::ScopedPtr<MmapWavSink> sink(new (allocator) MmapWavSink(config),
+                                          allocator);
+        if (!sink || !sink->valid()) {
+            roc_log(LogDebug, "wav backend: can't construct sink: path=%s", path);
+            return NULL;
+        }
+
+        if (!sink->open(path)) {
+            roc_log(LogDebug, "wav backend: can't open sink: path=%s", path);
+            return NULL;
+        }
+
+        return sink.release();
+    } break;
+
+    case DeviceType_Source: {
+        core::ScopedPtr<MmapWavSource> source(new (allocator) MmapWavSource(config),
+                                              allocator);
+        if (!source || !source->valid()) {
+            roc_log(LogDebug, "wav backend: can't construct source: path=%s", path);
+            return NULL;
+        }
+
+        if (!source->open(path)) {
+            roc_log(LogDebug, "wav backend: can't open source: path=%s", path);
+            return NULL;
+        }
+
+        return source.release();
+    } break;
+
+    default:
+        break;
+    }
+
+    roc_panic("wav backend: invalid device type");
+}
+
+} // namespace sndio
+} // namespace roc
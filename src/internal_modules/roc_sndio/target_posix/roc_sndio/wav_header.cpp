@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sndio/wav_header.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum {
+    FormatPcm = 0x0001,
+    FormatFloat = 0x0003,
+    FormatExtensible = 0xFFFE,
+
+    ChunkHeaderSize = 8,
+    RiffHeaderSize = 12,
+    FmtMinSize = 16,
+    FmtExtensibleSize = 40
+};
+
+uint16_t read_u16(const uint8_t* p) {
+    return uint16_t(p[0] | (p[1] << 8));
+}
+
+uint32_t read_u32(const uint8_t* p) {
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16)
+        | (uint32_t(p[3]) << 24);
+}
+
+void write_u16(uint8_t* p, uint16_t v) {
+    p[0] = uint8_t(v & 0xff);
+    p[1] = uint8_t((v >> 8) & 0xff);
+}
+
+void write_u32(uint8_t* p, uint32_t v) {
+    p[0] = uint8_t(v & 0xff);
+    p[1] = uint8_t((v >> 8) & 0xff);
+    p[2] = uint8_t((v >> 16) & 0xff);
+    p[3] = uint8_t((v >> 24) & 0xff);
+}
+
+bool match_id(const uint8_t* p, const char* id) {
+    return memcmp(p, id, 4) == 0;
+}
+
+bool select_encoding(unsigned format, size_t bits, audio::PcmEncoding& encoding) {
+    if (format == FormatPcm) {
+        switch (bits) {
+        case 8:
+            encoding = audio::PcmEncoding_UInt8;
+            return true;
+        case 16:
+            encoding = audio::PcmEncoding_SInt16;
+            return true;
+        case 24:
+            encoding = audio::PcmEncoding_SInt24;
+            return true;
+        case 32:
+            encoding = audio::PcmEncoding_SInt32;
+            return true;
+        default:
+            break;
+        }
+    } else if (format == FormatFloat) {
+        switch (bits) {
+        case 32:
+            encoding = audio::PcmEncoding_Float32;
+            return true;
+        case 64:
+            encoding = audio::PcmEncoding_Float64;
+            return true;
+        default:
+            break;
+        }
+    }
+
+    return false;
+}
+
+bool select_format(audio::PcmEncoding encoding, unsigned& format, size_t& bits) {
+    switch (encoding) {
+    case audio::PcmEncoding_UInt8:
+        format = FormatPcm;
+        bits = 8;
+        return true;
+    case audio::PcmEncoding_SInt16:
+        format = FormatPcm;
+        bits = 16;
+        return true;
+    case audio::PcmEncoding_SInt24:
+        format = FormatPcm;
+        bits = 24;
+        return true;
+    case audio::PcmEncoding_SInt32:
+        format = FormatPcm;
+        bits = 32;
+        return true;
+    case audio::PcmEncoding_Float32:
+        format = FormatFloat;
+        bits = 32;
+        return true;
+    case audio::PcmEncoding_Float64:
+        format = FormatFloat;
+        bits = 64;
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+} // namespace
+
+WavHeader::WavHeader()
+    : encoding_()
+    , sample_rate_(0)
+    , num_channels_(0)
+    , sample_size_(0)
+    , data_offset_(0)
+    , data_size_(0) {
+}
+
+WavHeader::WavHeader(audio::PcmEncoding encoding,
+                     size_t sample_rate,
+                     size_t num_channels)
+    : encoding_(encoding)
+    , sample_rate_(sample_rate)
+    , num_channels_(num_channels)
+    , sample_size_(0)
+    , data_offset_(WriteSize)
+    , data_size_(0) {
+    unsigned format = 0;
+    size_t bits = 0;
+    if (!select_format(encoding, format, bits)) {
+        roc_panic("wav header: unsupported encoding: encoding=%d", (int)encoding);
+    }
+    sample_size_ = bits / 8;
+}
+
+bool WavHeader::parse(const uint8_t* data, size_t size) {
+    roc_panic_if(!data);
+
+    if (size < RiffHeaderSize || !match_id(data, "RIFF")
+        || !match_id(data + 8, "WAVE")) {
+        roc_log(LogDebug, "wav header: not a riff/wave file");
+        return false;
+    }
+
+    bool has_fmt = false;
+    size_t pos = RiffHeaderSize;
+
+    while (size - pos >= ChunkHeaderSize) {
+        const uint8_t* chunk = data + pos;
+        const size_t chunk_size = read_u32(chunk + 4);
+
+        pos += ChunkHeaderSize;
+
+        if (match_id(chunk, "fmt ")) {
+            if (chunk_size > size - pos || !parse_fmt_(data + pos, chunk_size)) {
+                return false;
+            }
+            has_fmt = true;
+        } else if (match_id(chunk, "data")) {
+            if (!has_fmt) {
+                roc_log(LogDebug, "wav header: data chunk before fmt chunk");
+                return false;
+            }
+
+            // size of a data chunk which is still being written may be not
+            // updated yet, so clamp it to the actual file size
+            size_t avail = size - pos;
+            if (chunk_size < avail) {
+                avail = chunk_size;
+            }
+
+            const size_t block_size = sample_size_ * num_channels_;
+
+            data_offset_ = pos;
+            data_size_ = avail / block_size * block_size;
+
+            return true;
+        }
+
+        if (chunk_size > size - pos) {
+            break;
+        }
+        // chunks are padded to even size
+        pos += chunk_size + (chunk_size & 1);
+    }
+
+    roc_log(LogDebug, "wav header: missing fmt or data chunk");
+    return false;
+}
+
+void WavHeader::write(uint8_t* data, size_t data_size) const {
+    roc_panic_if(!data);
+
+    unsigned format = 0;
+    size_t bits = 0;
+    if (!select_format(encoding_, format, bits)) {
+        roc_panic("wav header: unsupported encoding: encoding=%d", (int)encoding_);
+    }
+
+    const size_t block_size = sample_size_ * num_channels_;
+
+    memcpy(data, "RIFF", 4);
+    write_u32(data + 4, uint32_t(WriteSize - ChunkHeaderSize + data_size));
+    memcpy(data + 8, "WAVE", 4);
+
+    memcpy(data + 12, "fmt ", 4);
+    write_u32(data + 16, FmtMinSize);
+    write_u16(data + 20, uint16_t(format));
+    write_u16(data + 22, uint16_t(num_channels_));
+    write_u32(data + 24, uint32_t(sample_rate_));
+    write_u32(data + 28, uint32_t(sample_rate_ * block_size));
+    write_u16(data + 32, uint16_t(block_size));
+    write_u16(data + 34, uint16_t(bits));
+
+    memcpy(data + 36, "data", 4);
+    write_u32(data + 40, uint32_t(data_size));
+}
+
+audio::PcmEncoding WavHeader::encoding() const {
+    return encoding_;
+}
+
+size_t WavHeader::sample_rate() const {
+    return sample_rate_;
+}
+
+size_t WavHeader::num_channels() const {
+    return num_channels_;
+}
+
+size_t WavHeader::sample_size() const {
+    return sample_size_;
+}
+
+size_t WavHeader::data_offset() const {
+    return data_offset_;
+}
+
+size_t WavHeader::data_size() const {
+    return data_size_;
+}
+
+bool WavHeader::parse_fmt_(const uint8_t* data, size_t size) {
+    if (size < FmtMinSize) {
+        roc_log(LogDebug, "wav header: fmt chunk too short: size=%lu",
+                (unsigned long)size);
+        return false;
+    }
+
+    unsigned format = read_u16(data);
+    const size_t num_channels = read_u16(data + 2);
+    const size_t sample_rate = read_u32(data + 4);
+    const size_t block_size = read_u16(data + 12);
+    const size_t bits = read_u16(data + 14);
+
+    if (format == FormatExtensible) {
+        if (size < FmtExtensibleSize) {
+            roc_log(LogDebug, "wav header: extensible fmt chunk too short: size=%lu",
+                    (unsigned long)size);
+            return false;
+        }
+        // first two bytes of sub-format GUID hold the actual format tag
+        format = read_u16(data + 24);
+    }
+
+    audio::PcmEncoding encoding = audio::PcmEncoding();
+    if (!select_encoding(format, bits, encoding)) {
+        roc_log(LogDebug, "wav header: unsupported sample format: format=0x%x bits=%lu",
+                format, (unsigned long)bits);
+        return false;
+    }
+
+    if (num_channels == 0 || sample_rate == 0
+        || block_size != bits / 8 * num_channels) {
+        roc_log(LogDebug,
+                "wav header: invalid fmt chunk: n_channels=%lu sample_rate=%lu"
+                " block_size=%lu",
+                (unsigned long)num_channels, (unsigned long)sample_rate,
+                (unsigned long)block_size);
+        return false;
+    }
+
+    encoding_ = encoding;
+    num_channels_ = num_channels;
+    sample_rate_ = sample_rate;
+    sample_size_ = bits / 8;
+
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_posix/roc_sndio/wav_header.h
+//! @brief WAV header.
+
+#ifndef ROC_SNDIO_WAV_HEADER_H_
+#define ROC_SNDIO_WAV_HEADER_H_
+
+#include "roc_audio/pcm_format.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace sndio {
+
+//! WAV header.
+//! @remarks
+//!  Parses and composes RIFF/WAVE headers with integer PCM or IEEE float
+//!  samples, including WAVE_FORMAT_EXTENSIBLE files. Samples in WAV files are
+//!  always little-endian and interleaved.
+class WavHeader {
+public:
+    //! Size of the header produced by write().
+    enum { WriteSize = 44 };
+
+    //! Initialize empty header.
+    WavHeader();
+
+    //! Initialize header with given format.
+    WavHeader(audio::PcmEncoding encoding, size_t sample_rate, size_t num_channels);
+
+    //! Parse header from the beginning of file.
+    //! @remarks
+    //!  @p data and @p size define the whole file contents. On success, fills
+    //!  format fields and position and size of the data chunk.
+    bool parse(const uint8_t* data, size_t size);
+
+    //! Compose header.
+    //! @remarks
+    //!  Writes WriteSize bytes to @p data, using @p data_size as the size of
+    //!  the data chunk that follows the header.
+    void write(uint8_t* data, size_t data_size) const;
+
+    //! Get PCM encoding of samples.
+    audio::PcmEncoding encoding() const;
+
+    //! Get sample rate.
+    size_t sample_rate() const;
+
+    //! Get number of channels.
+    size_t num_channels() const;
+
+    //! Get size of one sample in bytes.
+    size_t sample_size() const;
+
+    //! Get offset of the data chunk from the beginning of file.
+    size_t data_offset() const;
+
+    //! Get size of the data chunk in bytes.
+    //! @remarks
+    //!  Truncated to a whole number of samples for all channels.
+    size_t data_size() const;
+
+private:
+    bool parse_fmt_(const uint8_t* data, size_t size);
+
+    audio::PcmEncoding encoding_;
+    size_t sample_rate_;
+    size_t num_channels_;
+    size_t sample_size_;
+
+    size_t data_offset_;
+    size_t data_size_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_WAV_HEADER_H_
@@ -49,8 +49,8 @@ IDevice* PulseaudioBackend::open_device(DeviceType device_type,
 
     switch (device_type) {
     case DeviceType_Sink: {
-        core::ScopedPtr<PulseaudioSink> sink(new (allocator) PulseaudioSink(config),
-                                             allocator);
+        core::ScopedPtr<PulseaudioSink> sink(
+            new (allocator) PulseaudioSink(config, allocator), allocator);
         if (!sink) {
             roc_log(LogDebug, "pulseaudio backend: can't construct sink: path=%s", path);
             return NULL;
@@ -65,8 +65,8 @@ IDevice* PulseaudioBackend::open_device(DeviceType device_type,
     } break;
 
     case DeviceType_Source: {
-        core::ScopedPtr<PulseaudioSource> source(new (allocator) PulseaudioSource(config),
-                                                 allocator);
+        core::ScopedPtr<PulseaudioSource> source(
+            new (allocator) PulseaudioSource(config, allocator), allocator);
         if (!source) {
             roc_log(LogDebug, "pulseaudio backend: can't construct source: path=%s",
                     path);
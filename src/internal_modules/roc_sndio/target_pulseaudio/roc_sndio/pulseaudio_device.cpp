@@ -24,7 +24,9 @@ const core::nanoseconds_t MaxTimeout = core::Second * 2;
 
 } // namespace
 
-PulseaudioDevice::PulseaudioDevice(const Config& config, DeviceType device_type)
+PulseaudioDevice::PulseaudioDevice(const Config& config,
+                                   DeviceType device_type,
+                                   core::IAllocator& allocator)
     : device_type_(device_type)
     , device_(NULL)
     , config_(config)
@@ -32,6 +34,7 @@ PulseaudioDevice::PulseaudioDevice(const Config& config, DeviceType device_type)
     , record_frag_data_(NULL)
     , record_frag_size_(0)
     , record_frag_flag_(false)
+    , period_(0)
     , open_done_(false)
     , opened_(false)
     , mainloop_(NULL)
@@ -40,6 +43,10 @@ PulseaudioDevice::PulseaudioDevice(const Config& config, DeviceType device_type)
     , stream_(NULL)
     , timer_(NULL)
     , timer_deadline_(0)
+    , allocator_(allocator)
+    , drain_timer_(NULL)
+    , queue_waiting_(false)
+    , queue_broken_(false)
     , rate_limiter_(ReportInterval) {
     if (config.latency != 0) {
         latency_ = config.latency;
@@ -142,7 +149,11 @@ core::nanoseconds_t PulseaudioDevice::latency() const {
 
     pa_threaded_mainloop_lock(mainloop_);
 
-    const core::nanoseconds_t latency = config_.latency;
+    core::nanoseconds_t latency = config_.latency;
+
+    if (queue_) {
+        latency += config_.sample_spec.samples_overall_2_ns(queue_->size());
+    }
 
     pa_threaded_mainloop_unlock(mainloop_);
 
@@ -153,6 +164,18 @@ bool PulseaudioDevice::has_clock() const {
     return true;
 }
 
+core::nanoseconds_t PulseaudioDevice::preferred_frame_length() const {
+    want_mainloop_();
+
+    pa_threaded_mainloop_lock(mainloop_);
+
+    const core::nanoseconds_t period = period_;
+
+    pa_threaded_mainloop_unlock(mainloop_);
+
+    return period;
+}
+
 bool PulseaudioDevice::request(audio::Frame& frame) {
     want_mainloop_();
 
@@ -191,6 +214,62 @@ bool PulseaudioDevice::request(audio::Frame& frame) {
     return true;
 }
 
+bool PulseaudioDevice::has_queue() const {
+    return queue_;
+}
+
+bool PulseaudioDevice::enqueue(audio::Frame& frame) {
+    want_mainloop_();
+    roc_panic_if_not(queue_);
+
+    if (queue_broken_) {
+        roc_log(LogInfo, "pulseaudio %s: restarting stream",
+                device_type_to_str(device_type_));
+
+        close_();
+
+        queue_broken_ = false;
+
+        if (!open_()) {
+            roc_log(LogError, "pulseaudio %s: can't restart stream",
+                    device_type_to_str(device_type_));
+        }
+
+        return false;
+    }
+
+    const audio::sample_t* data = frame.samples();
+    size_t size = frame.num_samples();
+
+    while (size > 0) {
+        const size_t n_written = queue_->write(data, size);
+
+        data += n_written;
+        size -= n_written;
+
+        if (size == 0) {
+            break;
+        }
+
+        // queue is full, wait until mainloop thread drains something;
+        // flag is re-checked after setting to avoid missing a wakeup
+        queue_waiting_ = true;
+        if (queue_->size() == queue_->capacity()) {
+            if (!queue_sem_.timed_wait(core::timestamp(core::ClockMonotonic)
+                                       + timeout_)) {
+                queue_waiting_ = false;
+                roc_log(LogDebug,
+                        "pulseaudio %s: queue is full, dropping samples: n_samples=%lu",
+                        device_type_to_str(device_type_), (unsigned long)size);
+                return false;
+            }
+        }
+        queue_waiting_ = false;
+    }
+
+    return true;
+}
+
 bool PulseaudioDevice::check_stream_params_() const {
     if (config_.sample_spec.num_channels() == 0) {
         roc_log(LogError, "pulseaudio %s: # of channels is zero",
@@ -438,6 +517,11 @@ void PulseaudioDevice::device_info_cb_(pa_context*,
         return;
     }
 
+    if (!self.init_queue_()) {
+        self.set_opened_(false);
+        return;
+    }
+
     if (!self.open_stream_()) {
         self.set_opened_(false);
         return;
@@ -541,6 +625,8 @@ void PulseaudioDevice::close_stream_() {
 
     roc_log(LogTrace, "pulseaudio %s: closing stream", device_type_to_str(device_type_));
 
+    stop_drain_timer_();
+
     pa_stream_disconnect(stream_);
     pa_stream_unref(stream_);
 
@@ -715,6 +801,10 @@ void PulseaudioDevice::stream_state_cb_(pa_stream* stream, void* userdata) {
         roc_log(LogTrace, "pulseaudio %s: successfully opened stream",
                 device_type_to_str(self.device_type_));
 
+        self.update_period_(stream);
+        if (self.queue_) {
+            self.start_drain_timer_();
+        }
         self.set_opened_(true);
         break;
 
@@ -739,6 +829,11 @@ void PulseaudioDevice::stream_request_cb_(pa_stream*, size_t length, void* userd
     roc_log(LogTrace, "pulseaudio %s: stream request callback",
             device_type_to_str(self.device_type_));
 
+    if (self.queue_) {
+        self.drain_queue_();
+        return;
+    }
+
     if (length != 0) {
         pa_threaded_mainloop_signal(self.mainloop_, 0);
     }
@@ -777,6 +872,31 @@ void PulseaudioDevice::stream_latency_cb_(pa_stream* stream, void* userdata) {
                 / core::Millisecond);
 }
 
+void PulseaudioDevice::update_period_(pa_stream* stream) {
+    const pa_buffer_attr* attrs = pa_stream_get_buffer_attr(stream);
+    if (!attrs) {
+        return;
+    }
+
+    // server may adjust requested buffer attributes; the chunk it asks us to
+    // write, or delivers to us, is the device period
+    const uint32_t period_bytes =
+        device_type_ == DeviceType_Sink ? attrs->minreq : attrs->fragsize;
+
+    if (period_bytes == 0 || period_bytes == (uint32_t)-1) {
+        return;
+    }
+
+    const size_t period_size =
+        period_bytes / sizeof(audio::sample_t) / config_.sample_spec.num_channels();
+
+    period_ = config_.sample_spec.samples_per_chan_2_ns(period_size);
+
+    roc_log(LogDebug, "pulseaudio %s: device period: period=%lu(%.3fms)",
+            device_type_to_str(device_type_), (unsigned long)period_size,
+            (double)period_ / core::Millisecond);
+}
+
 void PulseaudioDevice::start_timer_(core::nanoseconds_t timeout) {
     roc_panic_if_not(context_);
 
@@ -823,5 +943,141 @@ void PulseaudioDevice::timer_cb_(pa_mainloop_api*,
     pa_threaded_mainloop_signal(self.mainloop_, 0);
 }
 
+bool PulseaudioDevice::init_queue_() {
+    if (device_type_ != DeviceType_Sink || config_.queue_length <= 0 || queue_) {
+        return true;
+    }
+
+    size_t queue_size = config_.sample_spec.ns_2_samples_overall(config_.queue_length);
+    if (queue_size < frame_size_ * 2) {
+        queue_size = frame_size_ * 2;
+    }
+
+    queue_.reset(new (queue_)
+                     core::SpscRingBuffer<audio::sample_t>(allocator_, queue_size));
+
+    if (!queue_->valid()) {
+        roc_log(LogError, "pulseaudio %s: can't allocate queue: size=%lu",
+                device_type_to_str(device_type_), (unsigned long)queue_size);
+        queue_.reset();
+        return false;
+    }
+
+    roc_log(LogDebug, "pulseaudio %s: using async queue: queue_size=%lu(%.3fms)",
+            device_type_to_str(device_type_), (unsigned long)queue_size,
+            (double)config_.sample_spec.samples_overall_2_ns(queue_size)
+                / core::Millisecond);
+
+    return true;
+}
+
+void PulseaudioDevice::start_drain_timer_() {
+    roc_panic_if_not(context_);
+
+    // besides write callback, queue is drained periodically, so that samples
+    // enqueued after server stopped requesting are not stuck in queue
+    const pa_usec_t pa_deadline =
+        pa_rtclock_now() + (pa_usec_t)(config_.frame_length / core::Microsecond);
+
+    if (!drain_timer_) {
+        drain_timer_ =
+            pa_context_rttime_new(context_, pa_deadline, drain_timer_cb_, this);
+        if (!drain_timer_) {
+            roc_panic("pulseaudio %s: can't create drain timer",
+                      device_type_to_str(device_type_));
+        }
+    } else {
+        pa_context_rttime_restart(context_, drain_timer_, pa_deadline);
+    }
+}
+
+void PulseaudioDevice::stop_drain_timer_() {
+    if (!drain_timer_) {
+        return;
+    }
+
+    pa_threaded_mainloop_get_api(mainloop_)->time_free(drain_timer_);
+    drain_timer_ = NULL;
+}
+
+// Invoked on mainloop thread, with mainloop lock held.
+void PulseaudioDevice::drain_queue_() {
+    if (!stream_ || !queue_ || pa_stream_get_state(stream_) != PA_STREAM_READY) {
+        return;
+    }
+
+    const size_t avail_bytes = pa_stream_writable_size(stream_);
+
+    if (avail_bytes == (size_t)-1) {
+        roc_log(LogError, "pulseaudio %s: stream is broken",
+                device_type_to_str(device_type_));
+        queue_broken_ = true;
+        wakeup_writer_();
+        return;
+    }
+
+    const size_t num_channels = config_.sample_spec.num_channels();
+
+    // write only whole samples for all channels
+    size_t size = std::min(avail_bytes / sizeof(audio::sample_t), queue_->size());
+    size -= size % num_channels;
+
+    bool drained = false;
+
+    while (size > 0) {
+        void* buf = NULL;
+        size_t buf_bytes = size * sizeof(audio::sample_t);
+
+        // get memory block owned by pulseaudio and read from queue
+        // directly into it
+        if (int err = pa_stream_begin_write(stream_, &buf, &buf_bytes)) {
+            roc_log(LogError, "pulseaudio %s: pa_stream_begin_write(): %s",
+                    device_type_to_str(device_type_), pa_strerror(err));
+            break;
+        }
+
+        size_t chunk = std::min(size, buf_bytes / sizeof(audio::sample_t));
+        chunk -= chunk % num_channels;
+
+        if (chunk == 0) {
+            pa_stream_cancel_write(stream_);
+            break;
+        }
+
+        const size_t n_read = queue_->read((audio::sample_t*)buf, chunk);
+
+        if (int err = pa_stream_write(stream_, buf, n_read * sizeof(audio::sample_t),
+                                      NULL, 0, PA_SEEK_RELATIVE)) {
+            roc_log(LogError, "pulseaudio %s: pa_stream_write(): %s",
+                    device_type_to_str(device_type_), pa_strerror(err));
+            queue_broken_ = true;
+            break;
+        }
+
+        drained = true;
+        size -= n_read;
+    }
+
+    if (drained || queue_broken_) {
+        wakeup_writer_();
+    }
+}
+
+void PulseaudioDevice::wakeup_writer_() {
+    if (queue_waiting_.compare_exchange(true, false)) {
+        queue_sem_.post();
+    }
+}
+
+void PulseaudioDevice::drain_timer_cb_(pa_mainloop_api*,
+                                       pa_time_event*,
+                                       const struct timeval*,
+                                       void* userdata) {
+    PulseaudioDevice& self = *(PulseaudioDevice*)userdata;
+
+    self.drain_queue_();
+    self.start_drain_timer_();
+}
+
 } // namespace sndio
 } // namespace roc
@@ -15,8 +15,13 @@
 #include <pulse/pulseaudio.h>
 
 #include "roc_audio/frame.h"
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/optional.h"
 #include "roc_core/rate_limiter.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/spsc_ring_buffer.h"
 #include "roc_core/stddefs.h"
 #include "roc_core/time.h"
 #include "roc_packet/units.h"
@@ -36,7 +41,9 @@ public:
 
 protected:
     //! Initialize.
-    PulseaudioDevice(const Config& config, DeviceType device_type);
+    PulseaudioDevice(const Config& config,
+                     DeviceType device_type,
+                     core::IAllocator& allocator);
     ~PulseaudioDevice();
 
     //! Get device state.
@@ -60,9 +67,20 @@ protected:
     //! Check if the sink has own clock.
     bool has_clock() const;
 
+    //! Get duration of the device period.
+    core::nanoseconds_t preferred_frame_length() const;
+
     //! Process audio frame.
     bool request(audio::Frame& frame);
 
+    //! Check if asynchronous write queue is enabled.
+    bool has_queue() const;
+
+    //! Put audio frame into asynchronous write queue.
+    //! @remarks
+    //!  Blocks only while the queue is full.
+    bool enqueue(audio::Frame& frame);
+
 private:
     static void context_state_cb_(pa_context* context, void* userdata);
 
@@ -78,6 +96,11 @@ private:
                           const struct timeval* tv,
                           void* userdata);
 
+    static void drain_timer_cb_(pa_mainloop_api* mainloop,
+                                pa_time_event* timer,
+                                const struct timeval* tv,
+                                void* userdata);
+
     bool request_frame_(audio::Frame& frame);
 
     void want_mainloop_() const;
@@ -103,9 +126,17 @@ private:
     ssize_t read_stream_(audio::sample_t* data, size_t size);
     ssize_t wait_stream_();
 
+    void update_period_(pa_stream* stream);
+
     void start_timer_(core::nanoseconds_t timeout);
     bool stop_timer_();
 
+    bool init_queue_();
+    void start_drain_timer_();
+    void stop_drain_timer_();
+    void drain_queue_();
+    void wakeup_writer_();
+
     const DeviceType device_type_;
     const char* device_;
 
@@ -118,6 +149,7 @@ private:
 
     core::nanoseconds_t latency_;
     core::nanoseconds_t timeout_;
+    core::nanoseconds_t period_;
 
     bool open_done_;
     bool opened_;
@@ -133,6 +165,14 @@ private:
     pa_sample_spec sample_spec_;
     pa_buffer_attr buffer_attrs_;
 
+    core::IAllocator& allocator_;
+
+    core::Optional<core::SpscRingBuffer<audio::sample_t> > queue_;
+    pa_time_event* drain_timer_;
+    core::Semaphore queue_sem_;
+    core::Atomic<int> queue_waiting_;
+    core::Atomic<int> queue_broken_;
+
     core::RateLimiter rate_limiter_;
 };
 
@@ -11,8 +11,8 @@
 namespace roc {
 namespace sndio {
 
-PulseaudioSink::PulseaudioSink(const Config& config)
-    : PulseaudioDevice(config, DeviceType_Sink) {
+PulseaudioSink::PulseaudioSink(const Config& config, core::IAllocator& allocator)
+    : PulseaudioDevice(config, DeviceType_Sink, allocator) {
 }
 
 PulseaudioSink::~PulseaudioSink() {
@@ -50,8 +50,16 @@ bool PulseaudioSink::has_clock() const {
     return PulseaudioDevice::has_clock();
 }
 
+core::nanoseconds_t PulseaudioSink::preferred_frame_length() const {
+    return PulseaudioDevice::preferred_frame_length();
+}
+
 void PulseaudioSink::write(audio::Frame& frame) {
-    PulseaudioDevice::request(frame);
+    if (PulseaudioDevice::has_queue()) {
+        PulseaudioDevice::enqueue(frame);
+    } else {
+        PulseaudioDevice::request(frame);
+    }
 }
 
 } // namespace sndio
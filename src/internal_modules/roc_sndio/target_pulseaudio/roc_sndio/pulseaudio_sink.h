@@ -22,7 +22,7 @@ namespace sndio {
 class PulseaudioSink : public ISink, public PulseaudioDevice {
 public:
     //! Initialize.
-    PulseaudioSink(const Config& config);
+    PulseaudioSink(const Config& config, core::IAllocator& allocator);
 
     ~PulseaudioSink();
 
@@ -50,7 +50,14 @@ public:
     //! Check if the sink has own clock.
     virtual bool has_clock() const;
 
+    //! Get frame length preferred by the sink.
+    virtual core::nanoseconds_t preferred_frame_length() const;
+
     //! Write audio frame.
+    //! @remarks
+    //!  If queue length is set in config, frame is put into the queue and is
+    //!  written to the stream asynchronously from the mainloop thread; the
+    //!  call blocks only while the queue is full.
     virtual void write(audio::Frame& frame);
 };
 
@@ -13,8 +13,8 @@
 namespace roc {
 namespace sndio {
 
-PulseaudioSource::PulseaudioSource(const Config& config)
-    : PulseaudioDevice(config, DeviceType_Source) {
+PulseaudioSource::PulseaudioSource(const Config& config, core::IAllocator& allocator)
+    : PulseaudioDevice(config, DeviceType_Source, allocator) {
 }
 
 PulseaudioSource::~PulseaudioSource() {
@@ -52,6 +52,10 @@ bool PulseaudioSource::has_clock() const {
     return PulseaudioDevice::has_clock();
 }
 
+core::nanoseconds_t PulseaudioSource::preferred_frame_length() const {
+    return PulseaudioDevice::preferred_frame_length();
+}
+
 void PulseaudioSource::reclock(packet::ntp_timestamp_t) {
     // no-op
 }
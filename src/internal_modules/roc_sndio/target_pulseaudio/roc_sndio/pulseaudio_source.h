@@ -22,7 +22,7 @@ namespace sndio {
 class PulseaudioSource : public ISource, public PulseaudioDevice {
 public:
     //! Initialize.
-    PulseaudioSource(const Config& config);
+    PulseaudioSource(const Config& config, core::IAllocator& allocator);
 
     ~PulseaudioSource();
 
@@ -50,6 +50,9 @@ public:
     //! Check if the source has own clock.
     virtual bool has_clock() const;
 
+    //! Get frame length preferred by the source.
+    virtual core::nanoseconds_t preferred_frame_length() const;
+
     //! Adjust source clock to match consumer clock.
     virtual void reclock(packet::ntp_timestamp_t timestamp);
 
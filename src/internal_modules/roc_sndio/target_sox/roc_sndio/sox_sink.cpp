@@ -20,7 +20,7 @@ SoxSink::SoxSink(core::IAllocator& allocator, const Config& config)
     , buffer_size_(0)
     , is_file_(false)
     , valid_(false) {
-    BackendMap::instance();
+    BackendMap::instance().sox_backend();
 
     if (config.sample_spec.num_channels() == 0) {
         roc_log(LogError, "sox sink: # of channels is zero");
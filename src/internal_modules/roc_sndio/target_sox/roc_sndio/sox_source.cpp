@@ -24,7 +24,7 @@ SoxSource::SoxSource(core::IAllocator& allocator, const Config& config)
     , eof_(false)
     , paused_(false)
     , valid_(false) {
-    BackendMap::instance();
+    BackendMap::instance().sox_backend();
 
     if (config.sample_spec.num_channels() == 0) {
         roc_log(LogError, "sox source: # of channels is zero");
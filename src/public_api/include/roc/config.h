@@ -96,6 +96,7 @@ typedef enum roc_interface {
      *  - \ref ROC_PROTO_RTP
      *  - \ref ROC_PROTO_RTP_RS8M_SOURCE
      *  - \ref ROC_PROTO_RTP_LDPC_SOURCE
+     *  - \ref ROC_PROTO_RTP_RLC_SOURCE
      */
     ROC_INTERFACE_AUDIO_SOURCE = 11,
 
@@ -108,6 +109,7 @@ typedef enum roc_interface {
      * Allowed protocols:
      *  - \ref ROC_PROTO_RS8M_REPAIR
      *  - \ref ROC_PROTO_LDPC_REPAIR
+     *  - \ref ROC_PROTO_RLC_REPAIR
      */
     ROC_INTERFACE_AUDIO_REPAIR = 12,
 
@@ -213,6 +215,35 @@ typedef enum roc_protocol {
      */
     ROC_PROTO_LDPC_REPAIR = 33,
 
+    /** RTP source packet (RFC 3550) + FECFRAME sliding window RLC footer (RFC 8681).
+     *
+     * Interfaces:
+     *  - \ref ROC_INTERFACE_AUDIO_SOURCE
+     *
+     * Transports:
+     *  - UDP
+     *
+     * Audio encodings:
+     *  - similar to \ref ROC_PROTO_RTP
+     *
+     * FEC encodings:
+     *  - \ref ROC_FEC_ENCODING_RLC
+     */
+    ROC_PROTO_RTP_RLC_SOURCE = 34,
+
+    /** FEC repair packet + FECFRAME sliding window RLC header (RFC 8681).
+     *
+     * Interfaces:
+     *  - \ref ROC_INTERFACE_AUDIO_REPAIR
+     *
+     * Transports:
+     *  - UDP
+     *
+     * FEC encodings:
+     *  - \ref ROC_FEC_ENCODING_RLC
+     */
+    ROC_PROTO_RLC_REPAIR = 35,
+
     /** RTCP over UDP (RFC 3550).
      *
      * Interfaces:
@@ -248,7 +279,16 @@ typedef enum roc_fec_encoding {
      * Compatible with \ref ROC_PROTO_RTP_LDPC_SOURCE and \ref ROC_PROTO_LDPC_REPAIR
      * protocols for source and repair endpoints.
      */
-    ROC_FEC_ENCODING_LDPC_STAIRCASE = 2
+    ROC_FEC_ENCODING_LDPC_STAIRCASE = 2,
+
+    /** Sliding window Random Linear Codes over GF(2^8) (RFC 8681).
+     * Good for low latency: a loss can be repaired as soon as a few following
+     * repair packets arrive, without waiting for the end of a block.
+     * Block size parameters define window length and repair rate.
+     * Compatible with \ref ROC_PROTO_RTP_RLC_SOURCE and \ref ROC_PROTO_RLC_REPAIR
+     * protocols for source and repair endpoints.
+     */
+    ROC_FEC_ENCODING_RLC = 3
 } roc_fec_encoding;
 
 /** Packet encoding. */
@@ -258,7 +298,16 @@ typedef enum roc_packet_encoding {
      * Uncompressed samples coded as interleaved 16-bit signed big-endian
      * integers in two's complement notation.
      */
-    ROC_PACKET_ENCODING_AVP_L16 = 2
+    ROC_PACKET_ENCODING_AVP_L16 = 2,
+
+    /** Opus.
+     * Compressed audio coded by Opus codec (RFC 6716) with constant bitrate,
+     * using 48000 Hz sample rate and dynamic RTP payload type 96.
+     * Packet length should be 2.5, 5, 10, 20, 40, or 60 ms; in-band FEC and
+     * packet loss concealment work best with 10 ms and longer packets.
+     * Available only if the library was built with Opus support.
+     */
+    ROC_PACKET_ENCODING_OPUS = 3
 } roc_packet_encoding;
 
 /** Frame encoding. */
@@ -267,17 +316,65 @@ typedef enum roc_frame_encoding {
      * Uncompressed samples coded as floats in range [-1; 1].
      * Channels are interleaved, e.g. two channels are encoded as "L R L R ...".
      */
-    ROC_FRAME_ENCODING_PCM_FLOAT = 1
+    ROC_FRAME_ENCODING_PCM_FLOAT = 1,
+
+    /** PCM 16-bit integers.
+     * Uncompressed samples coded as 16-bit signed integers in CPU byte order.
+     * Channels are interleaved.
+     */
+    ROC_FRAME_ENCODING_PCM_SINT16 = 2,
+
+    /** PCM 24-bit integers.
+     * Uncompressed samples coded as 24-bit signed integers packed into 3 bytes,
+     * in CPU byte order. Channels are interleaved.
+     */
+    ROC_FRAME_ENCODING_PCM_SINT24 = 3,
+
+    /** PCM 32-bit integers.
+     * Uncompressed samples coded as 32-bit signed integers in CPU byte order.
+     * Channels are interleaved.
+     */
+    ROC_FRAME_ENCODING_PCM_SINT32 = 4
 } roc_frame_encoding;
 
 /** Channel set. */
 typedef enum roc_channel_set {
+    /** Mono.
+     * One channel.
+     * Currently supported only in encodings registered using
+     * roc_context_register_encoding().
+     */
+    ROC_CHANNEL_SET_MONO = 0x1,
+
     /** Stereo.
      * Two channels: left and right.
      */
     ROC_CHANNEL_SET_STEREO = 0x3
 } roc_channel_set;
 
+/** Media encoding.
+ * Defines format and parameters of samples encoded in packets.
+ * Used to register custom encodings using roc_context_register_encoding().
+ */
+typedef struct roc_media_encoding {
+    /** Sample rate.
+     * Number of samples per channel per second.
+     * Should be set.
+     */
+    unsigned int rate;
+
+    /** Sample encoding.
+     * Currently only \ref ROC_PACKET_ENCODING_AVP_L16 is supported.
+     * Should be set.
+     */
+    roc_packet_encoding encoding;
+
+    /** Channel set.
+     * Should be set.
+     */
+    roc_channel_set channels;
+} roc_media_encoding;
+
 /** Resampler backend.
  * Affects speed and quality.
  * Some backends may be disabled at build time.
@@ -340,6 +437,52 @@ typedef enum roc_clock_source {
     ROC_CLOCK_INTERNAL = 1
 } roc_clock_source;
 
+/** Thread scheduling policy.
+ * \see roc_thread_config
+ */
+typedef enum roc_thread_policy {
+    /** Default scheduling policy of the operating system.
+     */
+    ROC_THREAD_POLICY_DEFAULT = 0,
+
+    /** Realtime first-in first-out policy (SCHED_FIFO).
+     * Usually requires elevated privileges.
+     */
+    ROC_THREAD_POLICY_FIFO = 1,
+
+    /** Realtime round-robin policy (SCHED_RR).
+     * Usually requires elevated privileges.
+     */
+    ROC_THREAD_POLICY_RR = 2
+} roc_thread_policy;
+
+/** Thread scheduling configuration.
+ *
+ * Defines scheduling parameters of a background thread. If the parameters can't be
+ * applied, e.g. because of insufficient privileges, an error is logged and the thread
+ * continues with default parameters.
+ *
+ * It is safe to memset() this struct with zeros to get a default config.
+ */
+typedef struct roc_thread_config {
+    /** Scheduling policy.
+     * If zero, default policy is used.
+     */
+    roc_thread_policy policy;
+
+    /** Realtime priority.
+     * Ignored for default policy.
+     * If zero, maximum priority allowed for the policy is used.
+     */
+    int priority;
+
+    /** CPU affinity mask.
+     * If N-th bit is set, the thread is allowed to run on N-th CPU.
+     * If zero, the thread is allowed to run on any CPU.
+     */
+    unsigned long long cpu_mask;
+} roc_thread_config;
+
 /** Context configuration.
  *
  * It is safe to memset() this struct with zeros to get a default config. It is also
@@ -361,6 +504,68 @@ typedef struct roc_context_config {
      * If zero, default value is used.
      */
     unsigned int max_frame_size;
+
+    /** Allocate network packets and audio frames using mmap().
+     * If non-zero, large memory chunks for packets and frames are mapped directly
+     * from the operating system instead of being allocated from heap.
+     */
+    unsigned int enable_mmap;
+
+    /** Use huge pages for packets and frames.
+     * If non-zero, memory mapped for packets and frames uses huge pages, when
+     * available, which reduces TLB misses. Ignored if \c enable_mmap is zero.
+     */
+    unsigned int enable_hugepages;
+
+    /** Lock memory for packets and frames.
+     * If non-zero, memory mapped for packets and frames is locked with mlock(),
+     * so that it's never paged out. Ignored if \c enable_mmap is zero.
+     */
+    unsigned int lock_memory;
+
+    /** Lock all process memory.
+     * If non-zero, all current and future memory of the process, including heap
+     * and thread stacks, is locked with mlockall(), so that accessing it never
+     * causes page faults.
+     */
+    unsigned int lock_all_memory;
+
+    /** Number of network threads.
+     * If greater than one, every receiver interface is bound on all network threads
+     * using SO_REUSEPORT, and the kernel distributes incoming packets between them.
+     * Senders are always served by the first network thread.
+     * If zero, one thread is used. Can't be greater than 16.
+     */
+    unsigned int network_threads;
+
+    /** Scheduling parameters of network threads.
+     * Network threads send and receive packets for all peers attached to context.
+     * If there are multiple network threads and \c cpu_mask is set, each thread is
+     * pinned to one CPU from the mask, in round-robin order.
+     */
+    roc_thread_config network_thread;
+
+    /** Scheduling parameters of the control thread.
+     * Control thread handles endpoint management and background pipeline tasks
+     * for all peers attached to context.
+     */
+    roc_thread_config control_thread;
+
+    /** Align timing of all peers of the context.
+     * If non-zero, senders and receivers with timing enabled process frames at
+     * common frame boundaries, counted from the moment when the first of them
+     * started. If all of them use the same frame size, a single thread that reads
+     * or writes all of them wakes up once per frame instead of once per peer.
+     */
+    unsigned int enable_shared_clock;
+
+    /** Encode FEC blocks of all senders together.
+     * If non-zero, Reed-Solomon repair packets of all senders and all their slots
+     * are encoded in batches by one shared encoder, after every written frame.
+     * This makes better use of CPU caches and vector instructions on senders with
+     * many streams. Has no effect on other FEC encodings.
+     */
+    unsigned int enable_batch_fec;
 } roc_context_config;
 
 /** Sender configuration.
@@ -385,7 +590,9 @@ typedef struct roc_sender_config {
     roc_channel_set frame_channels;
 
     /** The sample encoding in the frames passed to sender.
-     * Should be set.
+     * Should be set. Encodings other than \c ROC_FRAME_ENCODING_PCM_FLOAT are
+     * converted internally; they can't be used with roc_sender_set_frame_callback()
+     * and roc_sender_encoder_open().
      */
     roc_frame_encoding frame_encoding;
 
@@ -401,6 +608,10 @@ typedef struct roc_sender_config {
     roc_channel_set packet_channels;
 
     /** The sample encoding in the packets generated by sender.
+     * May be one of the built-in encodings or an identifier of an encoding
+     * registered using roc_context_register_encoding(). In the latter case,
+     * \c packet_sample_rate and \c packet_channels are ignored and packets
+     * use parameters of the registered encoding.
      * If zero, default value is used.
      */
     roc_packet_encoding packet_encoding;
@@ -456,6 +667,45 @@ typedef struct roc_sender_config {
      * If zero, default value is used.
      */
     unsigned int fec_block_repair_packets;
+
+    /** Reduce FEC redundancy for silence.
+     * If non-zero, fewer repair packets are sent for FEC blocks in which some
+     * source packets contain only zero samples, proportionally to the number of
+     * such packets, and no repair packets are sent for blocks of only silence.
+     * Losses of silent packets need no repair, since the receiver plays silence
+     * instead of them anyway. Used if a block FEC encoding is selected.
+     */
+    unsigned int fec_skip_silence;
+
+    /** Decoupling buffer length, in nanoseconds.
+     * If non-zero, the sender pipeline runs on its own background thread, and
+     * roc_sender_write() only copies samples into a pre-allocated lock-free ring
+     * buffer of this length, without blocking. This is useful when writing from
+     * a real-time audio callback. Samples that don't fit the buffer are dropped.
+     * If zero, the pipeline runs on the thread calling roc_sender_write().
+     */
+    unsigned long long decoupling_buffer_length;
+
+    /** Number of worker threads for processing slots.
+     * If non-zero, the sender resamples, encodes, and packetizes every slot in
+     * parallel on this number of background threads, in addition to the thread
+     * running the pipeline. This allows to feed many slots with different
+     * encodings from one sender using multiple cores.
+     * If zero, all slots are processed on the thread running the pipeline.
+     */
+    unsigned int worker_threads;
+
+    /** Scheduling parameters of worker threads.
+     */
+    roc_thread_config worker_thread;
+
+    /** Maximum delay added by packet interleaving, in nanoseconds.
+     * Used if packet interleaving is enabled. If non-zero, packets are reordered
+     * so that none of them is delayed by more than this duration, which allows
+     * to interleave large FEC blocks without adding a whole block of latency.
+     * If zero, packets may be delayed by up to a whole FEC block.
+     */
+    unsigned long long packet_interleaving_max_delay;
 } roc_sender_config;
 
 /** Receiver configuration.
@@ -478,7 +728,9 @@ typedef struct roc_receiver_config {
     roc_channel_set frame_channels;
 
     /** The sample encoding in the frames returned to the user.
-     * Should be set.
+     * Should be set. Encodings other than \c ROC_FRAME_ENCODING_PCM_FLOAT are
+     * converted internally; they can't be used with roc_receiver_read_sessions()
+     * and roc_receiver_decoder_open().
      */
     roc_frame_encoding frame_encoding;
 
@@ -546,6 +798,45 @@ typedef struct roc_receiver_config {
      * \see broken_playback_timeout.
      */
     unsigned long long breakage_detection_window;
+
+    /** Number of worker threads for processing sessions.
+     * If non-zero, the receiver decodes and resamples sessions in parallel on this
+     * number of background threads, in addition to the thread calling read.
+     * This allows to handle many senders on one receiver using multiple cores.
+     * If zero, all sessions are processed on the thread calling read.
+     */
+    unsigned int worker_threads;
+
+    /** Scheduling parameters of worker threads.
+     * Used for session worker threads and FEC repair threads.
+     */
+    roc_thread_config worker_thread;
+
+    /** Number of threads for FEC repair.
+     * If non-zero, blocks with packet losses are decoded in background on this
+     * number of threads shared by all sessions, as soon as enough packets of the
+     * block are received, so that expensive decoding doesn't delay frame reading.
+     * If zero, blocks are decoded when a lost packet is needed for playback.
+     */
+    unsigned int fec_repair_threads;
+
+    /** Decoupling buffer length, in nanoseconds.
+     * If non-zero, the receiver pipeline runs on its own background thread, and
+     * roc_receiver_read() only copies samples from a pre-allocated lock-free ring
+     * buffer of this length, without blocking. This is useful when reading from
+     * a real-time audio callback, at the cost of extra latency equal to the buffer
+     * length. If the buffer runs out of samples, the rest of the frame is zeroed.
+     * If zero, the pipeline runs on the thread calling roc_receiver_read().
+     */
+    unsigned long long decoupling_buffer_length;
+
+    /** Enable power saving mode.
+     * If non-zero, while the receiver has no sessions and no incoming packets,
+     * read functions return silence without running the pipeline. Combined with
+     * roc_receiver_wait_active(), this allows to park the reading thread until
+     * a packet arrives.
+     */
+    unsigned int power_saving;
 } roc_receiver_config;
 
 #ifdef __cplusplus
@@ -83,6 +83,37 @@ ROC_API int roc_context_open(const roc_context_config* config, roc_context** res
  */
 ROC_API int roc_context_close(roc_context* context);
 
+/** Register custom encoding.
+ *
+ * Registers \p encoding with given \p encoding_id. Registered encodings are
+ * available to all senders and receivers attached to the context, in addition
+ * to built-in encodings. The identifier is used as RTP payload type, so both
+ * sides should register the same encoding with the same identifier.
+ *
+ * Sender uses registered encoding if \c packet_encoding field of its config is
+ * set to \p encoding_id. Receiver decodes packets with this payload type
+ * automatically. If the registered sample rate matches the rate of the frames,
+ * no resampling is needed.
+ *
+ * Encodings should be registered before senders and receivers using them
+ * are created. Encodings can't be unregistered.
+ *
+ * **Parameters**
+ *  - \p context should point to an opened context
+ *  - \p encoding_id should be a dynamic RTP payload type, from 96 to 127,
+ *    not used by other encodings
+ *  - \p encoding should point to an initialized encoding description
+ *
+ * **Returns**
+ *  - returns zero if the encoding was successfully registered
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the identifier is already used
+ *  - returns a negative value if there are too many registered encodings
+ */
+ROC_API int roc_context_register_encoding(roc_context* context,
+                                          int encoding_id,
+                                          const roc_media_encoding* encoding);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -42,6 +42,28 @@ typedef struct roc_frame {
     size_t samples_size;
 } roc_frame;
 
+/** Audio frame of a single session.
+ *
+ * Used to read streams from multiple senders separately, without mixing them.
+ * See roc_receiver_read_sessions().
+ *
+ * **Thread safety**
+ *
+ * Should not be used concurrently.
+ */
+typedef struct roc_session_frame {
+    /** Session identifier.
+     * Set by receiver. Unique within receiver and stays the same while the session
+     * is alive, so it can be used to match frames of the same sender across reads.
+     */
+    unsigned long long session_id;
+
+    /** Session audio frame.
+     * Set by user. Filled by receiver with session samples.
+     */
+    roc_frame frame;
+} roc_session_frame;
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/**
+ * \file roc/metrics.h
+ * \brief Metrics.
+ */
+
+#ifndef ROC_METRICS_H_
+#define ROC_METRICS_H_
+
+#include "roc/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Receiver session metrics.
+ *
+ * Holds metrics of a single session, i.e. of a stream from one remote sender.
+ */
+typedef struct roc_session_metrics {
+    /** Session identifier.
+     * Unique within receiver, never reused. Same as \c session_id reported by
+     * roc_receiver_read_sessions().
+     */
+    unsigned long long session_id;
+
+    /** Network incoming queue latency, in nanoseconds.
+     * Difference between the last received sample and the next sample to be played.
+     * This is the latency which is kept close to the configured target latency.
+     */
+    long long niq_latency;
+
+    /** Estimated end-to-end latency, in nanoseconds.
+     * Delay from the moment a sample is captured on sender to the moment it is
+     * returned from receiver. Meaningful only if sender and receiver clocks are
+     * synchronized. Zero if it can't be estimated.
+     */
+    long long e2e_latency;
+
+    /** Estimated interarrival jitter, in nanoseconds.
+     */
+    unsigned long long jitter;
+
+    /** Current resampler scaling factor.
+     * Used to compensate clock drift between sender and receiver.
+     * Equal to one if clock drift compensation is disabled.
+     */
+    float scaling;
+
+    /** Number of packets in incoming queue.
+     */
+    unsigned int queue_size;
+
+    /** Number of packets that were lost and not restored, since session start.
+     */
+    unsigned long long lost_packets;
+
+    /** Number of packets restored using FEC, since session start.
+     */
+    unsigned long long repaired_packets;
+
+    /** Number of packets dropped because they arrived too late, since session start.
+     */
+    unsigned long long late_packets;
+
+    /** Watchdog state.
+     * Non-zero while the session is considered alive. When it becomes zero, the
+     * session is about to be terminated.
+     */
+    int alive;
+
+    /** Number of bytes allocated by session components.
+     * Doesn't include packets and buffers, which are allocated from pools shared
+     * by all sessions of the context.
+     */
+    unsigned long long memory_bytes;
+
+    /** Root mean square of samples of the last decoded frame.
+     * Ranges from 0 to 1. Computed during decoding, so it doesn't cost an extra
+     * pass over samples.
+     */
+    float rms_level;
+
+    /** Maximum absolute value of samples of the last decoded frame.
+     * Ranges from 0 to 1.
+     */
+    float peak_level;
+} roc_session_metrics;
+
+/** Receiver metrics.
+ *
+ * Holds metrics of one receiver slot: the total number of sessions, and metrics of
+ * individual sessions, written to user-provided array.
+ */
+typedef struct roc_receiver_metrics {
+    /** Number of alive sessions.
+     */
+    unsigned int num_sessions;
+
+    /** Array for session metrics.
+     * Should be allocated by the user. May be NULL if \c sessions_size is zero.
+     */
+    roc_session_metrics* sessions;
+
+    /** Number of elements in \c sessions array.
+     * Should be set by the user to the array size. After query, it's updated to the
+     * number of elements actually written, which may be less than \c num_sessions.
+     */
+    size_t sessions_size;
+
+    /** Number of frames that missed their deadline, since receiver start.
+     * Frame misses deadline if it isn't produced within frame duration after it
+     * was due, e.g. because of CPU starvation.
+     */
+    unsigned long long missed_deadlines;
+
+    /** Worst frame deadline overrun, in nanoseconds.
+     */
+    unsigned long long max_overrun;
+
+    /** Number of times when receiver clock woke up late, since receiver start.
+     * Always zero if receiver is not using its own clock.
+     */
+    unsigned long long late_wakeups;
+
+    /** Worst receiver clock wakeup delay, in nanoseconds.
+     */
+    unsigned long long max_wakeup_delay;
+} roc_receiver_metrics;
+
+/** Sender metrics.
+ *
+ * Holds metrics of one sender slot.
+ */
+typedef struct roc_sender_metrics {
+    /** Number of sessions.
+     * Zero until all interfaces required for sending are connected, one afterwards.
+     */
+    unsigned int num_sessions;
+
+    /** Fraction of packets lost on the way to receiver, as reported by receiver.
+     */
+    float fract_loss;
+
+    /** Estimated round-trip time, in nanoseconds.
+     * Zero if it can't be estimated.
+     */
+    unsigned long long rtt;
+
+    /** Number of frames that missed their deadline, since sender start.
+     * Frame misses deadline if it isn't processed within frame duration after it
+     * was due, e.g. because of CPU starvation.
+     */
+    unsigned long long missed_deadlines;
+
+    /** Worst frame deadline overrun, in nanoseconds.
+     */
+    unsigned long long max_overrun;
+
+    /** Number of times when sender clock woke up late, since sender start.
+     * Always zero if sender is not using its own clock.
+     */
+    unsigned long long late_wakeups;
+
+    /** Worst sender clock wakeup delay, in nanoseconds.
+     */
+    unsigned long long max_wakeup_delay;
+} roc_sender_metrics;
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ROC_METRICS_H_ */
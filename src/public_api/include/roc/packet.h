@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/**
+ * \file roc/packet.h
+ * \brief Network packet.
+ */
+
+#ifndef ROC_PACKET_H_
+#define ROC_PACKET_H_
+
+#include "roc/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Network packet.
+ *
+ * Represents encoded network packet, e.g. RTP or FECFRAME, as a sequence of bytes.
+ * Used to pass packets between encoder or decoder and user-provided transport. The
+ * user is responsible for allocating and deallocating the packet and the data it is
+ * pointing to.
+ *
+ * **Thread safety**
+ *
+ * Should not be used concurrently.
+ */
+typedef struct roc_packet {
+    /** Packet bytes.
+     */
+    void* bytes;
+
+    /** Packet bytes count.
+     * Defines the size of bytes buffer.
+     */
+    size_t bytes_size;
+} roc_packet;
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ROC_PACKET_H_ */
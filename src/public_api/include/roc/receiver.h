@@ -18,6 +18,7 @@
 #include "roc/context.h"
 #include "roc/endpoint.h"
 #include "roc/frame.h"
+#include "roc/metrics.h"
 #include "roc/platform.h"
 
 #ifdef __cplusplus
@@ -272,6 +273,37 @@ ROC_API int roc_receiver_set_reuseaddr(roc_receiver* receiver,
                                        roc_interface iface,
                                        int enabled);
 
+/** Set receiver interface socket buffer size.
+ *
+ * Optional.
+ *
+ * When set to non-zero, SO_RCVBUF of interface socket is set to given size in bytes.
+ * Kernel may round the value or limit it by system-wide maximum.
+ *
+ * Larger buffer allows to avoid losing packets during bursts, when receiver can't
+ * read them from the socket quickly enough. Number of packets dropped by kernel is
+ * reported in receiver logs, when this information is available.
+ *
+ * By default set to zero, which means that kernel default is used.
+ *
+ * Automatically initializes slot with given index if it's used first time.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p slot specifies the receiver slot
+ *  - \p iface specifies the receiver interface
+ *  - \p size defines buffer size in bytes
+ *
+ * **Returns**
+ *  - returns zero if the buffer size was successfully set
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if an error occurred
+ */
+ROC_API int roc_receiver_set_socket_buffer_size(roc_receiver* receiver,
+                                                roc_slot slot,
+                                                roc_interface iface,
+                                                size_t size);
+
 /** Bind the receiver interface to a local endpoint.
  *
  * Checks that the endpoint is valid and supported by the interface, allocates
@@ -284,7 +316,8 @@ ROC_API int roc_receiver_set_reuseaddr(roc_receiver* receiver,
  *
  * If \p endpoint has explicitly set zero port, the receiver is bound to a randomly
  * chosen ephemeral port. If the function succeeds, the actual port to which the
- * receiver was bound is written back to \p endpoint.
+ * receiver was bound is written back to \p endpoint. Zero port is not supported
+ * for \c ROC_INTERFACE_CONSOLIDATED.
  *
  * **Parameters**
  *  - \p receiver should point to an opened receiver
@@ -307,6 +340,55 @@ ROC_API int roc_receiver_bind(roc_receiver* receiver,
                               roc_interface iface,
                               roc_endpoint* endpoint);
 
+/** Receiver interface binding.
+ *
+ * Describes one interface to be bound. See roc_receiver_bind_many().
+ */
+typedef struct roc_receiver_binding {
+    /** Receiver slot. */
+    roc_slot slot;
+
+    /** Receiver interface. */
+    roc_interface iface;
+
+    /** Local endpoint.
+     * If it has explicitly set zero port, the actual port is written back to it.
+     */
+    roc_endpoint* endpoint;
+} roc_receiver_binding;
+
+/** Bind multiple receiver interfaces in one call.
+ *
+ * Same as invoking roc_receiver_bind() for every element of the array, but resolving
+ * addresses, creating slots and endpoints, and binding ports are performed for many
+ * interfaces at once, in background threads, and the function waits for each stage
+ * only once. This makes binding of hundreds or thousands of slots much faster.
+ *
+ * Either all interfaces are bound, or, if any of them can't be bound, interfaces
+ * bound by this call are unbound back and the function fails. Slots created by the
+ * call are not removed.
+ *
+ * \c ROC_INTERFACE_CONSOLIDATED can't be bound using this function.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p bindings should point to an array of \p bindings_count bindings
+ *  - \p bindings_count defines number of bindings
+ *
+ * **Returns**
+ *  - returns zero if all interfaces were successfully bound
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if any address can't be bound
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p bindings and endpoints; they may be
+ *    safely deallocated after the function returns
+ */
+ROC_API int roc_receiver_bind_many(roc_receiver* receiver,
+                                   roc_receiver_binding* bindings,
+                                   size_t bindings_count);
+
 /** Read samples from the receiver.
  *
  * Reads network packets received on bound ports, routes packets to sessions, repairs lost
@@ -335,6 +417,232 @@ ROC_API int roc_receiver_bind(roc_receiver* receiver,
  */
 ROC_API int roc_receiver_read(roc_receiver* receiver, roc_frame* frame);
 
+/** Read multiple frames in one call.
+ *
+ * Same as invoking roc_receiver_read() for every frame of the array, but has lower
+ * per-frame overhead. When \c ROC_CLOCK_EXTERNAL is used, all frames are produced
+ * during a single pass through the receiver pipeline, which is useful when the stream
+ * is consumed faster than real time, e.g. when recording to a file. When
+ * \c ROC_CLOCK_INTERNAL is used, the function still blocks before every frame.
+ *
+ * All frames should have the same size.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p frames should point to an array of initialized frames which will be filled
+ *    with samples
+ *  - \p frames_count defines the number of elements in \p frames array
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully decoded
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frames; they may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int
+roc_receiver_read_frames(roc_receiver* receiver, roc_frame* frames, size_t frames_count);
+
+/** Read samples from the receiver without blocking.
+ *
+ * Same as roc_receiver_read(), but if \c ROC_CLOCK_INTERNAL is used and it's not
+ * time to decode the next frame yet, returns immediately without reading anything.
+ * The user can then wait for the time reported by roc_receiver_read_delay() and
+ * call this function again. This allows driving many receivers and other event
+ * sources from a single thread.
+ *
+ * The function still performs the frame processing itself, so it takes as much time
+ * as decoding one frame.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p frame should point to an initialized frame which will be filled with samples;
+ *    the number of samples is defined by the frame size
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully decoded
+ *  - returns a positive value if the call would block; \p frame is not modified
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frame; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_receiver_try_read(roc_receiver* receiver, roc_frame* frame);
+
+/** Get time until the receiver is ready for the next read.
+ *
+ * Reports how long roc_receiver_read() would block waiting for the internal clock
+ * before decoding the next frame. Always zero if \c ROC_CLOCK_EXTERNAL is used, or
+ * if the decoupling buffer is enabled.
+ *
+ * Event-driven applications may use the reported delay to arm a timer in their own
+ * event loop, and call roc_receiver_try_read() when it expires.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p delay should point to a variable where to store the delay, in nanoseconds
+ *
+ * **Returns**
+ *  - returns zero if the delay was successfully retrieved
+ *  - returns a negative value if the arguments are invalid
+ */
+ROC_API int roc_receiver_read_delay(roc_receiver* receiver, unsigned long long* delay);
+
+/** Wait until the receiver becomes active.
+ *
+ * Blocks while the receiver has no sessions and no incoming packets, until a
+ * packet arrives on any interface or the timeout expires. With zero timeout, only
+ * checks the receiver state, without blocking.
+ *
+ * Intended for use with \c power_saving from receiver config: when the receiver is
+ * idle, the application may stop reading frames and park its thread here.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p timeout defines maximum wait time, in nanoseconds
+ *
+ * **Returns**
+ *  - returns zero if the receiver is active
+ *  - returns a positive value if the timeout expired and the receiver is still idle
+ *  - returns a negative value if the arguments are invalid
+ */
+ROC_API int roc_receiver_wait_active(roc_receiver* receiver, unsigned long long timeout);
+
+/** Read samples of every session separately.
+ *
+ * Same as roc_receiver_read(), but instead of mixing streams from all connected
+ * senders into one frame, stores samples of each session into its own frame. This
+ * allows the user to mix, spatialize, or record senders individually.
+ *
+ * Each call advances all sessions by the same number of samples, including sessions
+ * that don't fit into \p frames; samples of such sessions are dropped. At most 16
+ * sessions are returned per call.
+ *
+ * Should not be mixed with roc_receiver_read() on the same receiver. Not supported
+ * when decoupling buffer is enabled in receiver config.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p frames should point to an array of session frames; all frames should have
+ *    initialized \c frame fields with the same non-zero size, which defines the
+ *    number of samples to read
+ *  - \p frames_count should point to the number of elements in \p frames; after the
+ *    call, it's updated to the number of sessions actually written, which may be zero
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully decoded
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if decoupling is enabled
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frames; they may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_receiver_read_sessions(roc_receiver* receiver,
+                                       roc_session_frame* frames,
+                                       size_t* frames_count);
+
+/** Receiver event.
+ */
+typedef enum roc_receiver_event {
+    /** New session was created.
+     * Happens when the first packet from a new sender arrives.
+     */
+    ROC_RECEIVER_EVENT_SESSION_ADDED = 1,
+
+    /** Session was removed.
+     * Happens when the sender stops streaming, or when the session is terminated
+     * because of latency or watchdog failure.
+     */
+    ROC_RECEIVER_EVENT_SESSION_REMOVED = 2,
+
+    /** Session latency reached the target latency.
+     * Happens once per session, when enough packets are queued and the session
+     * starts producing sound.
+     */
+    ROC_RECEIVER_EVENT_SESSION_LATENCY_STABLE = 3
+} roc_receiver_event;
+
+/** Receiver event callback.
+ *
+ * Invoked by receiver when a session is added or removed, or when its latency
+ * becomes stable.
+ *
+ * The callback is invoked from the receiver thread which reads frames or processes
+ * incoming packets. It should return quickly and should not call receiver functions.
+ *
+ * **Parameters**
+ *  - \p arg is the argument passed to roc_receiver_set_event_callback()
+ *  - \p event defines what happened
+ *  - \p session_id identifies the session; same as \c session_id reported by
+ *    roc_receiver_read_sessions() and roc_receiver_query()
+ */
+typedef void (*roc_receiver_event_callback)(void* arg,
+                                            roc_receiver_event event,
+                                            unsigned long long session_id);
+
+/** Set receiver event callback.
+ *
+ * Allows the user to learn when senders come and go without reading frames and
+ * polling metrics. For example, the user may stop reading from the receiver while
+ * there are no sessions, and resume when a session is added.
+ *
+ * Should be called before binding the receiver, otherwise events of sessions
+ * created before this call are not reported. Can be called only once.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p callback should point to a callback function
+ *  - \p arg is an arbitrary pointer passed to the callback
+ *
+ * **Returns**
+ *  - returns zero if the callback was successfully installed
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the callback is already installed
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - the callback is invoked until the receiver is closed; the user should ensure
+ *    that \p arg remains valid during this time
+ */
+ROC_API int roc_receiver_set_event_callback(roc_receiver* receiver,
+                                            roc_receiver_event_callback callback,
+                                            void* arg);
+
+/** Query receiver slot metrics.
+ *
+ * Reports the number of sessions connected to the slot, and metrics of each session:
+ * latency, scaling factor, queue size, number of lost, repaired and late packets,
+ * and watchdog state.
+ *
+ * Metrics are updated by the receiver every time a frame is read, and this function
+ * returns metrics as of the last read. It doesn't block the thread which reads frames,
+ * and may be called from any thread.
+ *
+ * **Parameters**
+ *  - \p receiver should point to an opened receiver
+ *  - \p slot specifies the receiver slot
+ *  - \p metrics should point to metrics struct; its \c sessions and \c sessions_size
+ *    fields should be set by the user
+ *
+ * **Returns**
+ *  - returns zero if the metrics were successfully retrieved
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the slot doesn't exist
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p metrics; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_receiver_query(roc_receiver* receiver,
+                               roc_slot slot,
+                               roc_receiver_metrics* metrics);
+
 /** Close the receiver.
  *
  * Deinitializes and deallocates the receiver, and detaches it from the context. The user
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/**
+ * \file roc/receiver_decoder.h
+ * \brief Roc receiver decoder.
+ */
+
+#ifndef ROC_RECEIVER_DECODER_H_
+#define ROC_RECEIVER_DECODER_H_
+
+#include "roc/config.h"
+#include "roc/context.h"
+#include "roc/frame.h"
+#include "roc/packet.h"
+#include "roc/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Receiver decoder.
+ *
+ * Receiver decoder gets network packets from the user and decodes them into an audio
+ * stream, like receiver, but instead of receiving packets from the network, gets
+ * them from the user. The user can receive packets using arbitrary transport, e.g.
+ * from sender encoder on the other side.
+ *
+ * Decoder assumes that all packets come from a single sender, and handles them as
+ * one session. To handle multiple senders, use multiple decoders.
+ *
+ * **Context**
+ *
+ * Receiver decoder is automatically attached to a context when opened and detached
+ * from it when closed. The user should not close the context until the decoder is
+ * closed. Decoder doesn't use network threads of the context.
+ *
+ * **Life cycle**
+ *
+ * - Decoder is created using roc_receiver_decoder_open().
+ *
+ * - The user activates one or more interfaces using roc_receiver_decoder_activate().
+ *
+ * - Packets are pushed to the decoder using roc_receiver_decoder_push_packet(), and
+ *   the audio stream is iteratively retrieved using roc_receiver_decoder_pop_frame().
+ *
+ * - Decoder is destroyed using roc_receiver_decoder_close().
+ *
+ * **Clock source**
+ *
+ * Decoder never blocks: \c clock_source from receiver config is ignored, and the
+ * user is responsible to pop frames at the right pace.
+ *
+ * **Thread safety**
+ *
+ * Can be used concurrently.
+ */
+typedef struct roc_receiver_decoder roc_receiver_decoder;
+
+/** Open a new decoder.
+ *
+ * Allocates and initializes a new decoder, and attaches it to the context.
+ *
+ * **Parameters**
+ *  - \p context should point to an opened context
+ *  - \p config should point to an initialized config
+ *  - \p result should point to an unitialized roc_receiver_decoder pointer
+ *
+ * **Returns**
+ *  - returns zero if the decoder was successfully created
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p config; it may be safely deallocated
+ *    after the function returns
+ *  - passes the ownership of \p result to the user; the user is responsible to call
+ *    roc_receiver_decoder_close() to free it
+ */
+ROC_API int roc_receiver_decoder_open(roc_context* context,
+                                      const roc_receiver_config* config,
+                                      roc_receiver_decoder** result);
+
+/** Activate decoder interface.
+ *
+ * Starts accepting packets for given interface using given protocol. Each interface
+ * should be activated only once.
+ *
+ * **Parameters**
+ *  - \p decoder should point to an opened decoder
+ *  - \p iface specifies the decoder interface; \c ROC_INTERFACE_CONSOLIDATED is
+ *    not supported
+ *  - \p proto specifies the protocol of packets
+ *
+ * **Returns**
+ *  - returns zero if interface was successfully activated
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if interface is already activated
+ *  - returns a negative value on resource allocation failure
+ */
+ROC_API int roc_receiver_decoder_activate(roc_receiver_decoder* decoder,
+                                          roc_interface iface,
+                                          roc_protocol proto);
+
+/** Pass encoded packet to decoder.
+ *
+ * Copies the packet and enqueues it for decoding. The packet is parsed and routed
+ * when the next frame is retrieved.
+ *
+ * **Parameters**
+ *  - \p decoder should point to an opened decoder
+ *  - \p iface specifies the activated interface
+ *  - \p packet should point to a packet with bytes received from network
+ *
+ * **Returns**
+ *  - returns zero if the packet was successfully enqueued
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the packet is too large
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p packet; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_receiver_decoder_push_packet(roc_receiver_decoder* decoder,
+                                             roc_interface iface,
+                                             const roc_packet* packet);
+
+/** Decode samples from packets.
+ *
+ * Processes enqueued packets, repairs lost packets, decodes samples, resamples them,
+ * and stores samples into the provided frame. If there are not enough packets, the
+ * rest of the frame is filled with zeros.
+ *
+ * **Parameters**
+ *  - \p decoder should point to an opened decoder
+ *  - \p frame should point to an initialized frame which will be filled with samples;
+ *    the number of samples is defined by the frame size
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully decoded
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frame; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_receiver_decoder_pop_frame(roc_receiver_decoder* decoder,
+                                           roc_frame* frame);
+
+/** Close decoder.
+ *
+ * Deinitializes and deallocates the decoder, and detaches it from the context. The
+ * user should ensure that nobody uses the decoder during and after this call.
+ *
+ * **Parameters**
+ *  - \p decoder should point to an opened decoder
+ *
+ * **Returns**
+ *  - returns zero if the decoder was successfully closed
+ *  - returns a negative value if the arguments are invalid
+ *
+ * **Ownership**
+ *  - ends the user ownership of \p decoder; it can't be used anymore after the
+ *    function returns
+ */
+ROC_API int roc_receiver_decoder_close(roc_receiver_decoder* decoder);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ROC_RECEIVER_DECODER_H_ */
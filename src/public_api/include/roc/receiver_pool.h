@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/**
+ * \file roc/receiver_pool.h
+ * \brief Roc receiver pool.
+ */
+
+#ifndef ROC_RECEIVER_POOL_H_
+#define ROC_RECEIVER_POOL_H_
+
+#include "roc/config.h"
+#include "roc/context.h"
+#include "roc/platform.h"
+#include "roc/receiver.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Receiver pool.
+ *
+ * Receiver pool holds a number of pre-opened receivers with the same configuration.
+ * Opening a receiver involves many allocations and pipeline setup; the pool does
+ * this work ahead of time, so that acquiring a receiver from the pool is cheap.
+ * This is useful for applications that frequently open short-lived receivers.
+ *
+ * **Context**
+ *
+ * Receiver pool and all receivers opened by it are attached to the context. The user
+ * should not close the context until the pool and all acquired receivers are closed.
+ *
+ * **Life cycle**
+ *
+ * - Pool is created using roc_receiver_pool_open(), which pre-opens the requested
+ *   number of receivers.
+ *
+ * - Receivers are taken from the pool using roc_receiver_pool_acquire(). When the
+ *   pool is empty, a new receiver is opened on demand.
+ *
+ * - Optionally, roc_receiver_pool_refill() is called to pre-open receivers again,
+ *   e.g. from a background thread.
+ *
+ * - Acquired receivers are used and closed as usual, using roc_receiver_close().
+ *
+ * - Pool is destroyed using roc_receiver_pool_close(), together with receivers that
+ *   were not acquired.
+ *
+ * **Thread safety**
+ *
+ * Can be used concurrently.
+ */
+typedef struct roc_receiver_pool roc_receiver_pool;
+
+/** Open a new receiver pool.
+ *
+ * Allocates and initializes a new pool, attaches it to the context, and pre-opens
+ * \p size receivers.
+ *
+ * **Parameters**
+ *  - \p context should point to an opened context
+ *  - \p config should point to an initialized config, used for all receivers
+ *  - \p size defines how many idle receivers the pool keeps
+ *  - \p result should point to an unitialized roc_receiver_pool pointer
+ *
+ * **Returns**
+ *  - returns zero if the pool was successfully created
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p config; it may be safely deallocated
+ *    after the function returns
+ *  - passes the ownership of \p result to the user; the user is responsible to call
+ *    roc_receiver_pool_close() to free it
+ */
+ROC_API int roc_receiver_pool_open(roc_context* context,
+                                   const roc_receiver_config* config,
+                                   unsigned int size,
+                                   roc_receiver_pool** result);
+
+/** Take receiver from the pool.
+ *
+ * Removes a pre-opened receiver from the pool and returns it to the user. If there
+ * are no idle receivers, opens a new one.
+ *
+ * **Parameters**
+ *  - \p pool should point to an opened pool
+ *  - \p result should point to an unitialized roc_receiver pointer
+ *
+ * **Returns**
+ *  - returns zero if the receiver was successfully acquired
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - passes the ownership of \p result to the user; the user is responsible to call
+ *    roc_receiver_close() to free it
+ */
+ROC_API int roc_receiver_pool_acquire(roc_receiver_pool* pool, roc_receiver** result);
+
+/** Refill the pool.
+ *
+ * Pre-opens receivers until the number of idle receivers is equal to the pool size.
+ *
+ * **Parameters**
+ *  - \p pool should point to an opened pool
+ *
+ * **Returns**
+ *  - returns zero if the pool was successfully refilled
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ */
+ROC_API int roc_receiver_pool_refill(roc_receiver_pool* pool);
+
+/** Close the pool.
+ *
+ * Closes idle receivers, deinitializes and deallocates the pool, and detaches it from
+ * the context. Receivers acquired from the pool are not affected. The user should
+ * ensure that nobody uses the pool during and after this call.
+ *
+ * **Parameters**
+ *  - \p pool should point to an opened pool
+ *
+ * **Returns**
+ *  - returns zero if the pool was successfully closed
+ *  - returns a negative value if the arguments are invalid
+ *
+ * **Ownership**
+ *  - ends the user ownership of \p pool; it can't be used anymore after the
+ *    function returns
+ */
+ROC_API int roc_receiver_pool_close(roc_receiver_pool* pool);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ROC_RECEIVER_POOL_H_ */
@@ -18,6 +18,7 @@
 #include "roc/context.h"
 #include "roc/endpoint.h"
 #include "roc/frame.h"
+#include "roc/metrics.h"
 #include "roc/platform.h"
 
 #ifdef __cplusplus
@@ -239,14 +240,73 @@ ROC_API int roc_sender_set_reuseaddr(roc_sender* sender,
                                      roc_interface iface,
                                      int enabled);
 
+/** Set sender interface socket buffer size.
+ *
+ * Optional.
+ *
+ * When set to non-zero, SO_SNDBUF of interface socket is set to given size in bytes.
+ * Kernel may round the value or limit it by system-wide maximum.
+ *
+ * By default set to zero, which means that kernel default is used.
+ *
+ * Automatically initializes slot with given index if it's used first time.
+ *
+ * **Parameters**
+ *  - \p sender should point to an opened sender
+ *  - \p slot specifies the sender slot
+ *  - \p iface specifies the sender interface
+ *  - \p size defines buffer size in bytes
+ *
+ * **Returns**
+ *  - returns zero if the buffer size was successfully set
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if an error occurred
+ */
+ROC_API int roc_sender_set_socket_buffer_size(roc_sender* sender,
+                                              roc_slot slot,
+                                              roc_interface iface,
+                                              size_t size);
+
+/** Set sender interface DSCP.
+ *
+ * Optional.
+ *
+ * When set to non-negative value, outgoing packets of interface socket are marked
+ * with given Differentiated Services Code Point, so that network equipment can
+ * prioritize them. For example, 46 (Expedited Forwarding) is commonly used for
+ * real-time audio.
+ *
+ * By default set to -1, which means that kernel default is used.
+ *
+ * Automatically initializes slot with given index if it's used first time.
+ *
+ * **Parameters**
+ *  - \p sender should point to an opened sender
+ *  - \p slot specifies the sender slot
+ *  - \p iface specifies the sender interface
+ *  - \p dscp should be in range [0; 63] or -1
+ *
+ * **Returns**
+ *  - returns zero if the DSCP was successfully set
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if an error occurred
+ */
+ROC_API int roc_sender_set_dscp(roc_sender* sender,
+                                roc_slot slot,
+                                roc_interface iface,
+                                int dscp);
+
 /** Connect the sender interface to a remote receiver endpoint.
  *
  * Checks that the endpoint is valid and supported by the interface, allocates
  * a new outgoing port, and connects it to the remote endpoint.
  *
- * Each slot's interface can be bound or connected only once.
  * May be called multiple times for different slots or interfaces.
  *
+ * May be also called multiple times for the same slot and interface, with endpoints
+ * of the same protocol and address family. In this case, packets are composed once
+ * and sent to all connected endpoints through the same outgoing port.
+ *
  * Automatically initializes slot with given index if it's used first time.
  *
  * **Parameters**
@@ -297,6 +357,153 @@ ROC_API int roc_sender_connect(roc_sender* sender,
  */
 ROC_API int roc_sender_write(roc_sender* sender, const roc_frame* frame);
 
+/** Encode multiple frames in one call.
+ *
+ * Same as invoking roc_sender_write() for every frame of the array, but has lower
+ * per-frame overhead. When \c ROC_CLOCK_EXTERNAL is used, all frames are processed
+ * during a single pass through the sender pipeline, which is useful when the stream
+ * is produced faster than real time, e.g. when sending a file. When
+ * \c ROC_CLOCK_INTERNAL is used, the function still blocks before every frame.
+ *
+ * All frames should have the same size.
+ *
+ * **Parameters**
+ *  - \p sender should point to an opened, bound, and connected sender
+ *  - \p frames should point to an array of valid frames with samples to send
+ *  - \p frames_count defines the number of elements in \p frames array
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully encoded and enqueued
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frames; they may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int
+roc_sender_write_frames(roc_sender* sender, const roc_frame* frames, size_t frames_count);
+
+/** Encode samples to packets without blocking.
+ *
+ * Same as roc_sender_write(), but if \c ROC_CLOCK_INTERNAL is used and it's not
+ * time to transmit the next frame yet, returns immediately without consuming the
+ * samples. The user can then wait for the time reported by roc_sender_write_delay()
+ * and call this function again with the same frame. This allows driving many senders
+ * and other event sources from a single thread.
+ *
+ * The function still performs the frame processing itself, so it takes as much time
+ * as encoding one frame.
+ *
+ * **Parameters**
+ *  - \p sender should point to an opened, bound, and connected sender
+ *  - \p frame should point to a valid frame with an array of samples to send
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully encoded and enqueued
+ *  - returns a positive value if the call would block; samples are not consumed
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frame; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_sender_try_write(roc_sender* sender, const roc_frame* frame);
+
+/** Get time until the sender is ready for the next write.
+ *
+ * Reports how long roc_sender_write() would block waiting for the internal clock
+ * before encoding the next frame. Always zero if \c ROC_CLOCK_EXTERNAL is used, or
+ * if the decoupling buffer is enabled.
+ *
+ * Event-driven applications may use the reported delay to arm a timer in their own
+ * event loop, and call roc_sender_try_write() when it expires.
+ *
+ * **Parameters**
+ *  - \p sender should point to an opened sender
+ *  - \p delay should point to a variable where to store the delay, in nanoseconds
+ *
+ * **Returns**
+ *  - returns zero if the delay was successfully retrieved
+ *  - returns a negative value if the arguments are invalid
+ */
+ROC_API int roc_sender_write_delay(roc_sender* sender, unsigned long long* delay);
+
+/** Sender frame callback.
+ *
+ * Invoked by sender to obtain the next frame when callback-driven mode is used.
+ *
+ * **Parameters**
+ *  - \p arg is the argument passed to roc_sender_set_frame_callback()
+ *  - \p frame is a frame to be filled; \c samples and \c samples_size are set by
+ *    sender, and samples are zeroed before invocation
+ *
+ * **Returns**
+ *  - should return zero to continue streaming
+ *  - should return non-zero to stop invoking the callback
+ */
+typedef int (*roc_sender_frame_callback)(void* arg, roc_frame* frame);
+
+/** Switch sender to callback-driven mode.
+ *
+ * Instead of writing frames using roc_sender_write(), the user may provide a
+ * callback which is invoked by sender from its own thread every time the next
+ * frame should be encoded, according to the internal clock. The callback is invoked
+ * exactly at the frame deadline, so the samples it provides are not buffered before
+ * encoding, and the user doesn't need to run its own timing loop.
+ *
+ * Requires \c ROC_CLOCK_INTERNAL and can't be used together with the decoupling
+ * buffer. Can be called only once. After this call, roc_sender_write() and
+ * roc_sender_try_write() should not be used.
+ *
+ * **Parameters**
+ *  - \p sender should point to an opened sender
+ *  - \p callback should point to a callback function
+ *  - \p arg is an arbitrary pointer passed to the callback
+ *
+ * **Returns**
+ *  - returns zero if the callback was successfully installed
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if sender clock is external, decoupling buffer is
+ *    enabled, or callback is already installed
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - the callback is invoked until it returns non-zero or until the sender is closed;
+ *    the user should ensure that \p arg remains valid during this time
+ */
+ROC_API int roc_sender_set_frame_callback(roc_sender* sender,
+                                          roc_sender_frame_callback callback,
+                                          void* arg);
+
+/** Query sender slot metrics.
+ *
+ * Reports the number of sessions of the slot, and metrics reported by the remote
+ * receiver, like packet loss fraction and round-trip time.
+ *
+ * Metrics are updated by the sender when it exchanges control packets with receiver,
+ * and this function returns metrics as of the last update. It doesn't block the
+ * thread which writes frames, and may be called from any thread.
+ *
+ * **Parameters**
+ *  - \p sender should point to an opened sender
+ *  - \p slot specifies the sender slot
+ *  - \p metrics should point to metrics struct to be filled
+ *
+ * **Returns**
+ *  - returns zero if the metrics were successfully retrieved
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the slot doesn't exist
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p metrics; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_sender_query(roc_sender* sender,
+                             roc_slot slot,
+                             roc_sender_metrics* metrics);
+
 /** Close the sender.
  *
  * Deinitializes and deallocates the sender, and detaches it from the context. The user
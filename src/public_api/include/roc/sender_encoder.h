@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/**
+ * \file roc/sender_encoder.h
+ * \brief Roc sender encoder.
+ */
+
+#ifndef ROC_SENDER_ENCODER_H_
+#define ROC_SENDER_ENCODER_H_
+
+#include "roc/config.h"
+#include "roc/context.h"
+#include "roc/frame.h"
+#include "roc/packet.h"
+#include "roc/platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Sender encoder.
+ *
+ * Sender encoder gets an audio stream from the user and encodes it into network
+ * packets, like sender, but instead of sending packets to the network, returns them
+ * to the user. The user can then deliver packets using arbitrary transport, and pass
+ * them to receiver decoder on the other side.
+ *
+ * **Context**
+ *
+ * Sender encoder is automatically attached to a context when opened and detached
+ * from it when closed. The user should not close the context until the encoder is
+ * closed. Encoder doesn't use network threads of the context.
+ *
+ * **Life cycle**
+ *
+ * - Encoder is created using roc_sender_encoder_open().
+ *
+ * - The user activates one or more interfaces using roc_sender_encoder_activate().
+ *
+ * - The audio stream is iteratively pushed to the encoder using
+ *   roc_sender_encoder_push_frame(), and encoded packets are retrieved using
+ *   roc_sender_encoder_pop_packet().
+ *
+ * - Encoder is destroyed using roc_sender_encoder_close().
+ *
+ * **Clock source**
+ *
+ * Encoder never blocks: \c clock_source from sender config is ignored, and the user
+ * is responsible to push frames at the right pace.
+ *
+ * **Thread safety**
+ *
+ * Can be used concurrently.
+ */
+typedef struct roc_sender_encoder roc_sender_encoder;
+
+/** Open a new encoder.
+ *
+ * Allocates and initializes a new encoder, and attaches it to the context.
+ *
+ * **Parameters**
+ *  - \p context should point to an opened context
+ *  - \p config should point to an initialized config
+ *  - \p result should point to an unitialized roc_sender_encoder pointer
+ *
+ * **Returns**
+ *  - returns zero if the encoder was successfully created
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p config; it may be safely deallocated
+ *    after the function returns
+ *  - passes the ownership of \p result to the user; the user is responsible to call
+ *    roc_sender_encoder_close() to free it
+ */
+ROC_API int roc_sender_encoder_open(roc_context* context,
+                                    const roc_sender_config* config,
+                                    roc_sender_encoder** result);
+
+/** Activate encoder interface.
+ *
+ * Starts producing packets for given interface using given protocol. Each interface
+ * should be activated only once. Interfaces required by the protocols, e.g. repair
+ * interface when FEC is enabled, should be activated before pushing frames.
+ *
+ * **Parameters**
+ *  - \p encoder should point to an opened encoder
+ *  - \p iface specifies the encoder interface; \c ROC_INTERFACE_CONSOLIDATED is
+ *    not supported
+ *  - \p proto specifies the protocol of packets
+ *
+ * **Returns**
+ *  - returns zero if interface was successfully activated
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if interface is already activated
+ *  - returns a negative value on resource allocation failure
+ */
+ROC_API int roc_sender_encoder_activate(roc_sender_encoder* encoder,
+                                        roc_interface iface,
+                                        roc_protocol proto);
+
+/** Encode samples to packets.
+ *
+ * Encodes samples into packets and enqueues them into per-interface queues.
+ * Returns immediately after encoding.
+ *
+ * **Parameters**
+ *  - \p encoder should point to an opened encoder
+ *  - \p frame should point to a valid frame with an array of samples to encode
+ *
+ * **Returns**
+ *  - returns zero if all samples were successfully encoded and enqueued
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value on resource allocation failure
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p frame; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_sender_encoder_push_frame(roc_sender_encoder* encoder,
+                                          const roc_frame* frame);
+
+/** Retrieve encoded packet.
+ *
+ * Removes next packet of given interface from the queue and copies it into the
+ * provided buffer. If the buffer is too small, the packet is kept in the queue, and
+ * \c bytes_size is updated to the required size.
+ *
+ * **Parameters**
+ *  - \p encoder should point to an opened encoder
+ *  - \p iface specifies the activated interface
+ *  - \p packet should point to a packet with allocated \c bytes buffer; after the
+ *    call, \c bytes_size is updated to the actual packet size
+ *
+ * **Returns**
+ *  - returns zero if a packet was successfully copied
+ *  - returns a negative value if there are no more packets
+ *  - returns a negative value if the buffer is too small
+ *  - returns a negative value if the arguments are invalid
+ *
+ * **Ownership**
+ *  - doesn't take or share the ownership of \p packet; it may be safely deallocated
+ *    after the function returns
+ */
+ROC_API int roc_sender_encoder_pop_packet(roc_sender_encoder* encoder,
+                                          roc_interface iface,
+                                          roc_packet* packet);
+
+/** Close encoder.
+ *
+ * Deinitializes and deallocates the encoder, and detaches it from the context. The
+ * user should ensure that nobody uses the encoder during and after this call.
+ *
+ * **Parameters**
+ *  - \p encoder should point to an opened encoder
+ *
+ * **Returns**
+ *  - returns zero if the encoder was successfully closed
+ *  - returns a negative value if the arguments are invalid
+ *
+ * **Ownership**
+ *  - ends the user ownership of \p encoder; it can't be used anymore after the
+ *    function returns
+ */
+ROC_API int roc_sender_encoder_close(roc_sender_encoder* encoder);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ROC_SENDER_ENCODER_H_ */
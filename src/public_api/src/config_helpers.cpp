@@ -24,6 +24,33 @@ bool context_config_from_user(peer::ContextConfig& out, const roc_context_config
         out.max_frame_size = in.max_frame_size;
     }
 
+    out.enable_mmap = in.enable_mmap != 0;
+    out.enable_hugepages = in.enable_hugepages != 0;
+    out.lock_memory = in.lock_memory != 0;
+    out.lock_all_memory = in.lock_all_memory != 0;
+    out.enable_shared_clock = in.enable_shared_clock != 0;
+    out.enable_batch_fec = in.enable_batch_fec != 0;
+
+    if (in.network_threads > peer::MaxNetworkThreads) {
+        roc_log(LogError, "bad configuration: invalid network_threads: max=%lu",
+                (unsigned long)peer::MaxNetworkThreads);
+        return false;
+    }
+
+    if (in.network_threads != 0) {
+        out.network_threads = in.network_threads;
+    }
+
+    if (!thread_config_from_user(out.network_thread, in.network_thread)) {
+        roc_log(LogError, "bad configuration: invalid network_thread");
+        return false;
+    }
+
+    if (!thread_config_from_user(out.control_thread, in.control_thread)) {
+        roc_log(LogError, "bad configuration: invalid control_thread");
+        return false;
+    }
+
     return true;
 }
 
@@ -40,26 +67,51 @@ bool sender_config_from_user(pipeline::SenderConfig& out, const roc_sender_confi
         return false;
     }
 
-    if (in.frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT) {
+    audio::PcmEncoding frame_encoding;
+    if (!frame_encoding_from_user(frame_encoding, in.frame_encoding)) {
         roc_log(LogError, "bad configuration: invalid frame_encoding");
         return false;
     }
 
-    if (in.packet_sample_rate != 0 && in.packet_sample_rate != 44100) {
-        roc_log(LogError,
-                "bad configuration:"
-                " invalid packet_sample_rate, only 44100 is currently supported");
-        return false;
-    }
+    // for built-in encodings, sample rate and channels of packets are fixed;
+    // registered encodings define them by themselves
+    size_t packet_sample_rate = 0;
 
-    if (in.packet_channels != 0 && in.packet_channels != ROC_CHANNEL_SET_STEREO) {
-        roc_log(LogError, "bad configuration: invalid packet_channels");
-        return false;
+    switch ((unsigned)in.packet_encoding) {
+    case 0:
+    case ROC_PACKET_ENCODING_AVP_L16:
+        out.payload_type = rtp::PayloadType_L16_Stereo;
+        packet_sample_rate = 44100;
+        break;
+    case ROC_PACKET_ENCODING_OPUS:
+        out.payload_type = rtp::PayloadType_Opus;
+        // default packet length is not a valid opus frame duration
+        out.packet_length = 10 * core::Millisecond;
+        packet_sample_rate = 48000;
+        break;
+    default:
+        if ((int)in.packet_encoding < MinEncodingId
+            || (int)in.packet_encoding > MaxEncodingId) {
+            roc_log(LogError, "bad configuration: invalid packet_encoding");
+            return false;
+        }
+        out.payload_type = (rtp::PayloadType)in.packet_encoding;
+        break;
     }
 
-    if (in.packet_encoding != 0 && in.packet_encoding != ROC_PACKET_ENCODING_AVP_L16) {
-        roc_log(LogError, "bad configuration: invalid packet_encoding");
-        return false;
+    if (packet_sample_rate != 0) {
+        if (in.packet_sample_rate != 0 && in.packet_sample_rate != packet_sample_rate) {
+            roc_log(LogError,
+                    "bad configuration: invalid packet_sample_rate,"
+                    " only %lu is currently supported for selected packet_encoding",
+                    (unsigned long)packet_sample_rate);
+            return false;
+        }
+
+        if (in.packet_channels != 0 && in.packet_channels != ROC_CHANNEL_SET_STEREO) {
+            roc_log(LogError, "bad configuration: invalid packet_channels");
+            return false;
+        }
     }
 
     if (in.packet_length != 0) {
@@ -67,6 +119,7 @@ bool sender_config_from_user(pipeline::SenderConfig& out, const roc_sender_confi
     }
 
     out.interleaving = in.packet_interleaving;
+    out.interleaving_max_delay = (core::nanoseconds_t)in.packet_interleaving_max_delay;
     out.timing = (in.clock_source == ROC_CLOCK_INTERNAL);
 
     out.resampling = (in.resampler_profile != ROC_RESAMPLER_PROFILE_DISABLE);
@@ -115,6 +168,9 @@ bool sender_config_from_user(pipeline::SenderConfig& out, const roc_sender_confi
     case ROC_FEC_ENCODING_LDPC_STAIRCASE:
         out.fec_encoder.scheme = packet::FEC_LDPC_Staircase;
         break;
+    case ROC_FEC_ENCODING_RLC:
+        out.fec_encoder.scheme = packet::FEC_RLC;
+        break;
     default:
         roc_log(LogError, "bad configuration: invalid fec_scheme");
         return false;
@@ -125,6 +181,17 @@ bool sender_config_from_user(pipeline::SenderConfig& out, const roc_sender_confi
         out.fec_writer.n_repair_packets = in.fec_block_repair_packets;
     }
 
+    out.fec_writer.skip_silence = in.fec_skip_silence != 0;
+
+    out.decoupling_buffer_length = (core::nanoseconds_t)in.decoupling_buffer_length;
+
+    out.worker_threads = in.worker_threads;
+
+    if (!thread_config_from_user(out.worker_thread, in.worker_thread)) {
+        roc_log(LogError, "bad configuration: invalid worker_thread");
+        return false;
+    }
+
     return true;
 }
 
@@ -142,7 +209,8 @@ bool receiver_config_from_user(pipeline::ReceiverConfig& out,
         return false;
     }
 
-    if (in.frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT) {
+    audio::PcmEncoding frame_encoding;
+    if (!frame_encoding_from_user(frame_encoding, in.frame_encoding)) {
         roc_log(LogError, "bad configuration: invalid frame_encoding");
         return false;
     }
@@ -234,6 +302,96 @@ bool receiver_config_from_user(pipeline::ReceiverConfig& out,
             (core::nanoseconds_t)in.breakage_detection_window;
     }
 
+    out.common.worker_threads = in.worker_threads;
+    out.common.fec_repair_threads = in.fec_repair_threads;
+
+    if (!thread_config_from_user(out.common.worker_thread, in.worker_thread)) {
+        roc_log(LogError, "bad configuration: invalid worker_thread");
+        return false;
+    }
+
+    out.common.decoupling_buffer_length =
+        (core::nanoseconds_t)in.decoupling_buffer_length;
+
+    out.common.power_saving = in.power_saving;
+
+    return true;
+}
+
+ROC_ATTR_NO_SANITIZE_UB
+bool frame_encoding_from_user(audio::PcmEncoding& out, roc_frame_encoding in) {
+    switch ((unsigned)in) {
+    case ROC_FRAME_ENCODING_PCM_FLOAT:
+        out = audio::PcmEncoding_Float32;
+        return true;
+    case ROC_FRAME_ENCODING_PCM_SINT16:
+        out = audio::PcmEncoding_SInt16;
+        return true;
+    case ROC_FRAME_ENCODING_PCM_SINT24:
+        out = audio::PcmEncoding_SInt24;
+        return true;
+    case ROC_FRAME_ENCODING_PCM_SINT32:
+        out = audio::PcmEncoding_SInt32;
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+bool media_encoding_from_user(audio::PcmFormat& out_format,
+                              audio::SampleSpec& out_spec,
+                              const roc_media_encoding& in) {
+    if (in.rate == 0) {
+        roc_log(LogError, "bad encoding: invalid rate: should be > 0");
+        return false;
+    }
+
+    switch ((unsigned)in.encoding) {
+    case ROC_PACKET_ENCODING_AVP_L16:
+        out_format = audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big);
+        break;
+    default:
+        roc_log(LogError, "bad encoding: invalid encoding: only L16 is supported");
+        return false;
+    }
+
+    switch ((unsigned)in.channels) {
+    case ROC_CHANNEL_SET_MONO:
+    case ROC_CHANNEL_SET_STEREO:
+        out_spec = audio::SampleSpec(in.rate, (packet::channel_mask_t)in.channels);
+        break;
+    default:
+        roc_log(LogError, "bad encoding: invalid channels");
+        return false;
+    }
+
+    return true;
+}
+
+bool thread_config_from_user(core::ThreadConfig& out, const roc_thread_config& in) {
+    switch (in.policy) {
+    case ROC_THREAD_POLICY_DEFAULT:
+        out.policy = core::ThreadPolicy_Default;
+        break;
+    case ROC_THREAD_POLICY_FIFO:
+        out.policy = core::ThreadPolicy_Fifo;
+        break;
+    case ROC_THREAD_POLICY_RR:
+        out.policy = core::ThreadPolicy_RoundRobin;
+        break;
+    default:
+        return false;
+    }
+
+    if (in.priority < 0) {
+        return false;
+    }
+
+    out.priority = in.priority;
+    out.cpu_mask = (uint64_t)in.cpu_mask;
+
     return true;
 }
 
@@ -287,6 +445,14 @@ bool proto_from_user(address::Protocol& out, const roc_protocol& in) {
         out = address::Proto_LDPC_Repair;
         return true;
 
+    case ROC_PROTO_RTP_RLC_SOURCE:
+        out = address::Proto_RTP_RLC_Source;
+        return true;
+
+    case ROC_PROTO_RLC_REPAIR:
+        out = address::Proto_RLC_Repair;
+        return true;
+
     case ROC_PROTO_RTCP:
         out = address::Proto_RTCP;
         return true;
@@ -325,6 +491,14 @@ bool proto_to_user(roc_protocol& out, address::Protocol in) {
         out = ROC_PROTO_LDPC_REPAIR;
         return true;
 
+    case address::Proto_RTP_RLC_Source:
+        out = ROC_PROTO_RTP_RLC_SOURCE;
+        return true;
+
+    case address::Proto_RLC_Repair:
+        out = ROC_PROTO_RLC_REPAIR;
+        return true;
+
     case address::Proto_RTCP:
         out = ROC_PROTO_RTCP;
         return true;
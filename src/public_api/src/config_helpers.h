@@ -18,12 +18,23 @@
 namespace roc {
 namespace api {
 
+//! Range of identifiers of registered encodings (dynamic RTP payload types).
+enum { MinEncodingId = 96, MaxEncodingId = 127 };
+
 bool context_config_from_user(peer::ContextConfig& out, const roc_context_config& in);
 
 bool sender_config_from_user(pipeline::SenderConfig& out, const roc_sender_config& in);
 bool receiver_config_from_user(pipeline::ReceiverConfig& out,
                                const roc_receiver_config& in);
 
+bool frame_encoding_from_user(audio::PcmEncoding& out, roc_frame_encoding in);
+
+bool media_encoding_from_user(audio::PcmFormat& out_format,
+                              audio::SampleSpec& out_spec,
+                              const roc_media_encoding& in);
+
+bool thread_config_from_user(core::ThreadConfig& out, const roc_thread_config& in);
+
 bool interface_from_user(address::Interface& out, const roc_interface& in);
 
 bool proto_from_user(address::Protocol& out, const roc_protocol& in);
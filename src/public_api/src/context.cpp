@@ -73,3 +73,51 @@ int roc_context_close(roc_context* context) {
 
     return 0;
 }
+
+int roc_context_register_encoding(roc_context* context,
+                                  int encoding_id,
+                                  const roc_media_encoding* encoding) {
+    if (!context) {
+        roc_log(LogError,
+                "roc_context_register_encoding(): invalid arguments: context is null");
+        return -1;
+    }
+
+    if (encoding_id < api::MinEncodingId || encoding_id > api::MaxEncodingId) {
+        roc_log(LogError,
+                "roc_context_register_encoding(): invalid arguments:"
+                " encoding_id should be in range [%d; %d]",
+                api::MinEncodingId, api::MaxEncodingId);
+        return -1;
+    }
+
+    if (!encoding) {
+        roc_log(LogError,
+                "roc_context_register_encoding(): invalid arguments: encoding is null");
+        return -1;
+    }
+
+    audio::PcmFormat pcm_format;
+    audio::SampleSpec sample_spec;
+    if (!api::media_encoding_from_user(pcm_format, sample_spec, *encoding)) {
+        roc_log(LogError,
+                "roc_context_register_encoding(): invalid arguments: bad encoding");
+        return -1;
+    }
+
+    peer::Context* imp_context = (peer::Context*)context;
+
+    if (!imp_context->format_map().add_pcm_format((unsigned int)encoding_id,
+                                                  pcm_format, sample_spec)) {
+        roc_log(LogError, "roc_context_register_encoding(): can't register encoding");
+        return -1;
+    }
+
+    roc_log(LogInfo,
+            "roc_context_register_encoding(): registered encoding:"
+            " id=%d rate=%lu channels=%lu",
+            encoding_id, (unsigned long)sample_spec.sample_rate(),
+            (unsigned long)sample_spec.num_channels());
+
+    return 0;
+}
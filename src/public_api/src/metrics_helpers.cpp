@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "metrics_helpers.h"
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace api {
+
+namespace {
+
+unsigned long long nanoseconds_to_user(core::nanoseconds_t ns) {
+    return ns > 0 ? (unsigned long long)ns : 0;
+}
+
+void session_metrics_to_user(roc_session_metrics& out,
+                             const pipeline::ReceiverSessionMetrics& in) {
+    out.session_id = (unsigned long long)in.session_id;
+    out.niq_latency = (long long)in.niq_latency;
+    out.e2e_latency = (long long)in.e2e_latency;
+    out.jitter = nanoseconds_to_user(in.jitter);
+    out.scaling = in.scaling;
+    out.queue_size = (unsigned int)in.queue_size;
+    out.lost_packets = (unsigned long long)in.lost_packets;
+    out.repaired_packets = (unsigned long long)in.repaired_packets;
+    out.late_packets = (unsigned long long)in.late_packets;
+    out.alive = in.alive ? 1 : 0;
+    out.memory_bytes = (unsigned long long)in.memory_bytes;
+    out.rms_level = in.rms_level;
+    out.peak_level = in.peak_level;
+}
+
+} // namespace
+
+void receiver_metrics_to_user(roc_receiver_metrics& out,
+                              const pipeline::ReceiverSlotMetrics& in) {
+    out.num_sessions = (unsigned int)in.num_sessions;
+
+    size_t n_sessions = in.num_sessions;
+    if (n_sessions > pipeline::ReceiverSlotMetrics::MaxSessions) {
+        n_sessions = pipeline::ReceiverSlotMetrics::MaxSessions;
+    }
+    if (n_sessions > out.sessions_size) {
+        n_sessions = out.sessions_size;
+    }
+
+    for (size_t n = 0; n < n_sessions; n++) {
+        session_metrics_to_user(out.sessions[n], in.sessions[n]);
+    }
+
+    out.sessions_size = n_sessions;
+
+    out.missed_deadlines = (unsigned long long)in.pipeline.missed_deadlines;
+    out.max_overrun = nanoseconds_to_user(in.pipeline.max_overrun);
+    out.late_wakeups = (unsigned long long)in.pipeline.late_wakeups;
+    out.max_wakeup_delay = nanoseconds_to_user(in.pipeline.max_wakeup_delay);
+}
+
+void sender_metrics_to_user(roc_sender_metrics& out,
+                            const pipeline::SenderSlotMetrics& in) {
+    out.num_sessions = (unsigned int)in.num_sessions;
+    out.fract_loss = in.session.fract_loss;
+    out.rtt = nanoseconds_to_user(in.session.rtt);
+
+    out.missed_deadlines = (unsigned long long)in.pipeline.missed_deadlines;
+    out.max_overrun = nanoseconds_to_user(in.pipeline.max_overrun);
+    out.late_wakeups = (unsigned long long)in.pipeline.late_wakeups;
+    out.max_wakeup_delay = nanoseconds_to_user(in.pipeline.max_wakeup_delay);
+}
+
+} // namespace api
+} // namespace roc
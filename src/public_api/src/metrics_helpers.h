@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ROC_PUBLIC_API_METRICS_HELPERS_H_
+#define ROC_PUBLIC_API_METRICS_HELPERS_H_
+
+#include "roc/metrics.h"
+
+#include "roc_pipeline/metrics.h"
+
+namespace roc {
+namespace api {
+
+void receiver_metrics_to_user(roc_receiver_metrics& out,
+                              const pipeline::ReceiverSlotMetrics& in);
+
+void sender_metrics_to_user(roc_sender_metrics& out,
+                            const pipeline::SenderSlotMetrics& in);
+
+} // namespace api
+} // namespace roc
+
+#endif // ROC_PUBLIC_API_METRICS_HELPERS_H_
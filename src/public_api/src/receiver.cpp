@@ -9,13 +9,47 @@
 #include "roc/receiver.h"
 
 #include "config_helpers.h"
+#include "metrics_helpers.h"
 
+#include "roc_core/array.h"
 #include "roc_core/log.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_peer/receiver.h"
+#include "roc_pipeline/ireceiver_event_handler.h"
 
 using namespace roc;
 
+namespace {
+
+class EventCallbackAdapter : public pipeline::IReceiverEventHandler {
+public:
+    EventCallbackAdapter(roc_receiver_event_callback callback, void* arg)
+        : callback_(callback)
+        , arg_(arg) {
+    }
+
+    virtual void on_session_added(size_t session_id) {
+        callback_(arg_, ROC_RECEIVER_EVENT_SESSION_ADDED,
+                  (unsigned long long)session_id);
+    }
+
+    virtual void on_session_removed(size_t session_id) {
+        callback_(arg_, ROC_RECEIVER_EVENT_SESSION_REMOVED,
+                  (unsigned long long)session_id);
+    }
+
+    virtual void on_session_latency_stable(size_t session_id) {
+        callback_(arg_, ROC_RECEIVER_EVENT_SESSION_LATENCY_STABLE,
+                  (unsigned long long)session_id);
+    }
+
+private:
+    roc_receiver_event_callback callback_;
+    void* arg_;
+};
+
+} // namespace
+
 int roc_receiver_open(roc_context* context,
                       const roc_receiver_config* config,
                       roc_receiver** result) {
@@ -44,8 +78,15 @@ int roc_receiver_open(roc_context* context,
         return -1;
     }
 
+    audio::PcmEncoding imp_frame_encoding;
+    if (!api::frame_encoding_from_user(imp_frame_encoding, config->frame_encoding)) {
+        roc_log(LogError, "roc_receiver_open(): invalid arguments: bad frame encoding");
+        return -1;
+    }
+
     core::ScopedPtr<peer::Receiver> imp_receiver(
-        new (imp_context->allocator()) peer::Receiver(*imp_context, imp_config),
+        new (imp_context->allocator())
+            peer::Receiver(*imp_context, imp_config, imp_frame_encoding),
         imp_context->allocator());
 
     if (!imp_receiver) {
@@ -130,6 +171,35 @@ int roc_receiver_set_reuseaddr(roc_receiver* receiver,
     return 0;
 }
 
+int roc_receiver_set_socket_buffer_size(roc_receiver* receiver,
+                                        roc_slot slot,
+                                        roc_interface iface,
+                                        size_t size) {
+    if (!receiver) {
+        roc_log(
+            LogError,
+            "roc_receiver_set_socket_buffer_size(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    address::Interface imp_iface;
+    if (!api::interface_from_user(imp_iface, iface)) {
+        roc_log(
+            LogError,
+            "roc_receiver_set_socket_buffer_size(): invalid arguments: bad interface");
+        return -1;
+    }
+
+    if (!imp_receiver->set_socket_buffer_size(slot, imp_iface, size)) {
+        roc_log(LogError, "roc_receiver_set_socket_buffer_size(): operation failed");
+        return -1;
+    }
+
+    return 0;
+}
+
 int roc_receiver_bind(roc_receiver* receiver,
                       roc_slot slot,
                       roc_interface iface,
@@ -162,6 +232,56 @@ int roc_receiver_bind(roc_receiver* receiver,
     return 0;
 }
 
+int roc_receiver_bind_many(roc_receiver* receiver,
+                           roc_receiver_binding* bindings,
+                           size_t bindings_count) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_bind_many(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    if (!bindings && bindings_count != 0) {
+        roc_log(LogError,
+                "roc_receiver_bind_many(): invalid arguments: bindings is null");
+        return -1;
+    }
+
+    core::Array<peer::Receiver::Binding> imp_bindings(
+        imp_receiver->context().allocator());
+
+    if (!imp_bindings.resize(bindings_count)) {
+        roc_log(LogError, "roc_receiver_bind_many(): can't allocate bindings");
+        return -1;
+    }
+
+    for (size_t n = 0; n < bindings_count; n++) {
+        if (!bindings[n].endpoint) {
+            roc_log(LogError,
+                    "roc_receiver_bind_many(): invalid arguments: endpoint is null");
+            return -1;
+        }
+
+        if (!api::interface_from_user(imp_bindings[n].iface, bindings[n].iface)) {
+            roc_log(LogError,
+                    "roc_receiver_bind_many(): invalid arguments: bad interface");
+            return -1;
+        }
+
+        imp_bindings[n].slot_index = bindings[n].slot;
+        imp_bindings[n].uri = (address::EndpointUri*)bindings[n].endpoint;
+    }
+
+    if (!imp_receiver->bind_many(imp_bindings.data(), imp_bindings.size())) {
+        roc_log(LogError, "roc_receiver_bind_many(): operation failed");
+        return -1;
+    }
+
+    return 0;
+}
+
 int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
     if (!receiver) {
         roc_log(LogError, "roc_receiver_read(): invalid arguments: receiver is null");
@@ -181,7 +301,8 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
         return 0;
     }
 
-    const size_t factor = imp_source.sample_spec().num_channels() * sizeof(float);
+    const size_t factor =
+        imp_source.sample_spec().num_channels() * imp_receiver->frame_sample_size();
 
     if (frame->samples_size % factor != 0) {
         roc_log(LogError,
@@ -196,9 +317,7 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
         return -1;
     }
 
-    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
-
-    if (!imp_source.read(imp_frame)) {
+    if (!imp_receiver->read_pcm(frame->samples, frame->samples_size)) {
         roc_log(LogError, "roc_receiver_read(): got unexpected eof from source");
         return -1;
     }
@@ -208,6 +327,293 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
     return 0;
 }
 
+int roc_receiver_read_frames(roc_receiver* receiver,
+                             roc_frame* frames,
+                             size_t frames_count) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_read_frames(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    if (!frames) {
+        roc_log(LogError,
+                "roc_receiver_read_frames(): invalid arguments: frames is null");
+        return -1;
+    }
+
+    if (frames_count == 0 || frames[0].samples_size == 0) {
+        return 0;
+    }
+
+    const size_t factor = imp_receiver->source().sample_spec().num_channels()
+        * imp_receiver->frame_sample_size();
+
+    const size_t samples_size = frames[0].samples_size;
+
+    if (samples_size % factor != 0) {
+        roc_log(LogError,
+                "roc_receiver_read_frames(): invalid arguments: # of samples should be "
+                "multiple of # of %u",
+                (unsigned)factor);
+        return -1;
+    }
+
+    for (size_t n = 0; n < frames_count; n++) {
+        if (frames[n].samples_size != samples_size) {
+            roc_log(LogError,
+                    "roc_receiver_read_frames(): invalid arguments: all frames should "
+                    "have same size");
+            return -1;
+        }
+        if (!frames[n].samples) {
+            roc_log(LogError,
+                    "roc_receiver_read_frames(): invalid arguments: samples is null");
+            return -1;
+        }
+    }
+
+    if (imp_receiver->frame_sample_size() != sizeof(float)) {
+        // Frames should be converted one by one.
+        for (size_t n = 0; n < frames_count; n++) {
+            if (!imp_receiver->read_pcm(frames[n].samples, samples_size)) {
+                roc_log(LogError,
+                        "roc_receiver_read_frames(): got unexpected eof from source");
+                return -1;
+            }
+        }
+
+        imp_receiver->source().reclock(packet::ntp_timestamp());
+
+        return 0;
+    }
+
+    // Frames are passed to pipeline in chunks, to avoid allocations.
+    enum { MaxChunkFrames = 64 };
+    audio::sample_t* imp_frames[MaxChunkFrames];
+
+    for (size_t pos = 0; pos < frames_count;) {
+        size_t n_chunk = 0;
+        while (n_chunk < MaxChunkFrames && pos + n_chunk < frames_count) {
+            imp_frames[n_chunk] = (audio::sample_t*)frames[pos + n_chunk].samples;
+            n_chunk++;
+        }
+
+        if (!imp_receiver->read_frames(imp_frames, n_chunk,
+                                       samples_size / sizeof(float))) {
+            roc_log(LogError,
+                    "roc_receiver_read_frames(): got unexpected eof from source");
+            return -1;
+        }
+
+        pos += n_chunk;
+    }
+
+    imp_receiver->source().reclock(packet::ntp_timestamp());
+
+    return 0;
+}
+
+int roc_receiver_try_read(roc_receiver* receiver, roc_frame* frame) {
+    if (!receiver) {
+        roc_log(LogError, "roc_receiver_try_read(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    if (imp_receiver->read_delay() > 0) {
+        return 1;
+    }
+
+    return roc_receiver_read(receiver, frame);
+}
+
+int roc_receiver_read_delay(roc_receiver* receiver, unsigned long long* delay) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_read_delay(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    if (!delay) {
+        roc_log(LogError, "roc_receiver_read_delay(): invalid arguments: delay is null");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    *delay = (unsigned long long)imp_receiver->read_delay();
+
+    return 0;
+}
+
+int roc_receiver_wait_active(roc_receiver* receiver, unsigned long long timeout) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_wait_active(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    if (!imp_receiver->wait_active((core::nanoseconds_t)timeout)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+int roc_receiver_read_sessions(roc_receiver* receiver,
+                               roc_session_frame* frames,
+                               size_t* frames_count) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    if (!frames || !frames_count) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions(): invalid arguments:"
+                " frames or frames_count is null");
+        return -1;
+    }
+
+    if (*frames_count == 0) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions(): invalid arguments: frames_count is zero");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    sndio::ISource& imp_source = imp_receiver->source();
+
+    const size_t samples_size = frames[0].frame.samples_size;
+    const size_t factor =
+        imp_source.sample_spec().num_channels() * imp_receiver->frame_sample_size();
+
+    if (samples_size == 0 || samples_size % factor != 0) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions(): invalid arguments: # of samples should be "
+                "non-zero multiple of # of %u",
+                (unsigned)factor);
+        return -1;
+    }
+
+    pipeline::ReceiverSessionFrame imp_frames[pipeline::ReceiverSlotMetrics::MaxSessions];
+
+    size_t max_frames = *frames_count;
+    if (max_frames > pipeline::ReceiverSlotMetrics::MaxSessions) {
+        max_frames = pipeline::ReceiverSlotMetrics::MaxSessions;
+    }
+
+    for (size_t n = 0; n < max_frames; n++) {
+        if (frames[n].frame.samples_size != samples_size) {
+            roc_log(LogError,
+                    "roc_receiver_read_sessions(): invalid arguments:"
+                    " all frames should have same size");
+            return -1;
+        }
+        if (!frames[n].frame.samples) {
+            roc_log(LogError,
+                    "roc_receiver_read_sessions(): invalid arguments: samples is null");
+            return -1;
+        }
+        imp_frames[n].samples = (float*)frames[n].frame.samples;
+    }
+
+    size_t n_frames = 0;
+
+    if (!imp_receiver->read_sessions(imp_frames, max_frames, n_frames,
+                                     samples_size / sizeof(float))) {
+        roc_log(LogError, "roc_receiver_read_sessions(): operation failed");
+        return -1;
+    }
+
+    for (size_t n = 0; n < n_frames; n++) {
+        frames[n].session_id = (unsigned long long)imp_frames[n].session_id;
+    }
+
+    *frames_count = n_frames;
+
+    imp_source.reclock(packet::ntp_timestamp());
+
+    return 0;
+}
+
+int roc_receiver_query(roc_receiver* receiver,
+                       roc_slot slot,
+                       roc_receiver_metrics* metrics) {
+    if (!receiver) {
+        roc_log(LogError, "roc_receiver_query(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    if (!metrics) {
+        roc_log(LogError, "roc_receiver_query(): invalid arguments: metrics is null");
+        return -1;
+    }
+
+    if (metrics->sessions_size != 0 && !metrics->sessions) {
+        roc_log(LogError,
+                "roc_receiver_query(): invalid arguments:"
+                " sessions is null, but sessions_size is non-zero");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    pipeline::ReceiverSlotMetrics imp_metrics;
+    if (!imp_receiver->get_metrics(slot, imp_metrics)) {
+        roc_log(LogError, "roc_receiver_query(): operation failed");
+        return -1;
+    }
+
+    api::receiver_metrics_to_user(*metrics, imp_metrics);
+
+    return 0;
+}
+
+int roc_receiver_set_event_callback(roc_receiver* receiver,
+                                    roc_receiver_event_callback callback,
+                                    void* arg) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_set_event_callback(): invalid arguments: receiver is null");
+        return -1;
+    }
+
+    peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
+
+    if (!callback) {
+        roc_log(LogError,
+                "roc_receiver_set_event_callback(): invalid arguments: callback is null");
+        return -1;
+    }
+
+    core::IAllocator& allocator = imp_receiver->context().allocator();
+
+    core::ScopedPtr<EventCallbackAdapter> imp_callback(
+        new (allocator) EventCallbackAdapter(callback, arg), allocator);
+
+    if (!imp_callback) {
+        roc_log(LogError, "roc_receiver_set_event_callback(): can't allocate callback");
+        return -1;
+    }
+
+    if (!imp_receiver->set_event_handler(*imp_callback)) {
+        roc_log(LogError, "roc_receiver_set_event_callback(): can't set callback");
+        return -1;
+    }
+
+    imp_callback.release();
+    return 0;
+}
+
 int roc_receiver_close(roc_receiver* receiver) {
     if (!receiver) {
         roc_log(LogError, "roc_receiver_close(): invalid arguments: receiver is null");
@@ -215,7 +621,17 @@ int roc_receiver_close(roc_receiver* receiver) {
     }
 
     peer::Receiver* imp_receiver = (peer::Receiver*)receiver;
-    imp_receiver->context().allocator().destroy_object(*imp_receiver);
+
+    core::IAllocator& allocator = imp_receiver->context().allocator();
+
+    // receiver stops invoking handler in destructor, so handler is destroyed after it
+    pipeline::IReceiverEventHandler* imp_handler = imp_receiver->event_handler();
+
+    allocator.destroy_object(*imp_receiver);
+
+    if (imp_handler) {
+        allocator.destroy_object(*imp_handler);
+    }
 
     roc_log(LogInfo, "roc_receiver_close(): closed receiver");
 
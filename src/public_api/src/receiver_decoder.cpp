@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc/receiver_decoder.h"
+
+#include "config_helpers.h"
+
+#include "roc_core/log.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_peer/receiver_decoder.h"
+
+using namespace roc;
+
+int roc_receiver_decoder_open(roc_context* context,
+                              const roc_receiver_config* config,
+                              roc_receiver_decoder** result) {
+    roc_log(LogInfo, "roc_receiver_decoder_open(): opening decoder");
+
+    if (!result) {
+        roc_log(LogError,
+                "roc_receiver_decoder_open(): invalid arguments: result is null");
+        return -1;
+    }
+
+    if (!context) {
+        roc_log(LogError,
+                "roc_receiver_decoder_open(): invalid arguments: context is null");
+        return -1;
+    }
+
+    peer::Context* imp_context = (peer::Context*)context;
+
+    if (!config) {
+        roc_log(LogError,
+                "roc_receiver_decoder_open(): invalid arguments: config is null");
+        return -1;
+    }
+
+    pipeline::ReceiverConfig imp_config;
+    if (!api::receiver_config_from_user(imp_config, *config)) {
+        roc_log(LogError, "roc_receiver_decoder_open(): invalid arguments: bad config");
+        return -1;
+    }
+
+    if (config->frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT) {
+        roc_log(LogError,
+                "roc_receiver_decoder_open(): invalid arguments: "
+                "only float frame encoding is supported");
+        return -1;
+    }
+
+    core::ScopedPtr<peer::ReceiverDecoder> imp_decoder(
+        new (imp_context->allocator()) peer::ReceiverDecoder(*imp_context, imp_config),
+        imp_context->allocator());
+
+    if (!imp_decoder) {
+        roc_log(LogError, "roc_receiver_decoder_open(): can't allocate decoder");
+        return -1;
+    }
+
+    if (!imp_decoder->valid()) {
+        roc_log(LogError, "roc_receiver_decoder_open(): can't initialize decoder");
+        return -1;
+    }
+
+    *result = (roc_receiver_decoder*)imp_decoder.release();
+    return 0;
+}
+
+int roc_receiver_decoder_activate(roc_receiver_decoder* decoder,
+                                  roc_interface iface,
+                                  roc_protocol proto) {
+    if (!decoder) {
+        roc_log(LogError,
+                "roc_receiver_decoder_activate(): invalid arguments: decoder is null");
+        return -1;
+    }
+
+    peer::ReceiverDecoder* imp_decoder = (peer::ReceiverDecoder*)decoder;
+
+    address::Interface imp_iface;
+    if (!api::interface_from_user(imp_iface, iface)) {
+        roc_log(LogError,
+                "roc_receiver_decoder_activate(): invalid arguments: bad interface");
+        return -1;
+    }
+
+    address::Protocol imp_proto;
+    if (!api::proto_from_user(imp_proto, proto)) {
+        roc_log(LogError,
+                "roc_receiver_decoder_activate(): invalid arguments: bad protocol");
+        return -1;
+    }
+
+    if (!imp_decoder->activate(imp_iface, imp_proto)) {
+        roc_log(LogError, "roc_receiver_decoder_activate(): operation failed");
+        return -1;
+    }
+
+    return 0;
+}
+
+int roc_receiver_decoder_push_packet(roc_receiver_decoder* decoder,
+                                     roc_interface iface,
+                                     const roc_packet* packet) {
+    if (!decoder) {
+        roc_log(LogError,
+                "roc_receiver_decoder_push_packet(): invalid arguments: decoder is null");
+        return -1;
+    }
+
+    peer::ReceiverDecoder* imp_decoder = (peer::ReceiverDecoder*)decoder;
+
+    address::Interface imp_iface;
+    if (!api::interface_from_user(imp_iface, iface)) {
+        roc_log(LogError,
+                "roc_receiver_decoder_push_packet(): invalid arguments: bad interface");
+        return -1;
+    }
+
+    if (!packet) {
+        roc_log(LogError,
+                "roc_receiver_decoder_push_packet(): invalid arguments: packet is null");
+        return -1;
+    }
+
+    if (!packet->bytes || packet->bytes_size == 0) {
+        roc_log(LogError,
+                "roc_receiver_decoder_push_packet(): invalid arguments: packet is empty");
+        return -1;
+    }
+
+    if (!imp_decoder->write_packet(imp_iface, packet->bytes, packet->bytes_size)) {
+        roc_log(LogError, "roc_receiver_decoder_push_packet(): operation failed");
+        return -1;
+    }
+
+    return 0;
+}
+
+int roc_receiver_decoder_pop_frame(roc_receiver_decoder* decoder, roc_frame* frame) {
+    if (!decoder) {
+        roc_log(LogError,
+                "roc_receiver_decoder_pop_frame(): invalid arguments: decoder is null");
+        return -1;
+    }
+
+    peer::ReceiverDecoder* imp_decoder = (peer::ReceiverDecoder*)decoder;
+
+    sndio::ISource& imp_source = imp_decoder->source();
+
+    if (!frame) {
+        roc_log(LogError,
+                "roc_receiver_decoder_pop_frame(): invalid arguments: frame is null");
+        return -1;
+    }
+
+    if (frame->samples_size == 0) {
+        return 0;
+    }
+
+    const size_t factor = imp_source.sample_spec().num_channels() * sizeof(float);
+
+    if (frame->samples_size % factor != 0) {
+        roc_log(LogError,
+                "roc_receiver_decoder_pop_frame(): invalid arguments:"
+                " # of samples should be multiple of # of %u",
+                (unsigned)factor);
+        return -1;
+    }
+
+    if (!frame->samples) {
+        roc_log(LogError,
+                "roc_receiver_decoder_pop_frame(): invalid arguments: samples is null");
+        return -1;
+    }
+
+    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
+
+    if (!imp_source.read(imp_frame)) {
+        roc_log(LogError, "roc_receiver_decoder_pop_frame(): got unexpected eof");
+        return -1;
+    }
+
+    return 0;
+}
+
+int roc_receiver_decoder_close(roc_receiver_decoder* decoder) {
+    if (!decoder) {
+        roc_log(LogError,
+                "roc_receiver_decoder_close(): invalid arguments: decoder is null");
+        return -1;
+    }
+
+    peer::ReceiverDecoder* imp_decoder = (peer::ReceiverDecoder*)decoder;
+    imp_decoder->context().allocator().destroy_object(*imp_decoder);
+
+    roc_log(LogInfo, "roc_receiver_decoder_close(): closed decoder");
+
+    return 0;
+}
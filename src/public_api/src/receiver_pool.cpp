@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc/receiver_pool.h"
+
+#include "config_helpers.h"
+
+#include "roc_core/log.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_peer/receiver_pool.h"
+
+using namespace roc;
+
+int roc_receiver_pool_open(roc_context* context,
+                           const roc_receiver_config* config,
+                           unsigned int size,
+                           roc_receiver_pool** result) {
+    roc_log(LogInfo, "roc_receiver_pool_open(): opening receiver pool");
+
+    if (!result) {
+        roc_log(LogError, "roc_receiver_pool_open(): invalid arguments: result is null");
+        return -1;
+    }
+
+    if (!context) {
+        roc_log(LogError, "roc_receiver_pool_open(): invalid arguments: context is null");
+        return -1;
+    }
+
+    peer::Context* imp_context = (peer::Context*)context;
+
+    if (!config) {
+        roc_log(LogError, "roc_receiver_pool_open(): invalid arguments: config is null");
+        return -1;
+    }
+
+    pipeline::ReceiverConfig imp_config;
+    if (!api::receiver_config_from_user(imp_config, *config)) {
+        roc_log(LogError, "roc_receiver_pool_open(): invalid arguments: bad config");
+        return -1;
+    }
+
+    audio::PcmEncoding imp_frame_encoding;
+    if (!api::frame_encoding_from_user(imp_frame_encoding, config->frame_encoding)) {
+        roc_log(LogError,
+                "roc_receiver_pool_open(): invalid arguments: bad frame encoding");
+        return -1;
+    }
+
+    core::ScopedPtr<peer::ReceiverPool> imp_pool(
+        new (imp_context->allocator())
+            peer::ReceiverPool(*imp_context, imp_config, imp_frame_encoding, size),
+        imp_context->allocator());
+
+    if (!imp_pool) {
+        roc_log(LogError, "roc_receiver_pool_open(): can't allocate pool");
+        return -1;
+    }
+
+    if (!imp_pool->valid()) {
+        roc_log(LogError, "roc_receiver_pool_open(): can't initialize pool");
+        return -1;
+    }
+
+    *result = (roc_receiver_pool*)imp_pool.release();
+    return 0;
+}
+
+int roc_receiver_pool_acquire(roc_receiver_pool* pool, roc_receiver** result) {
+    if (!pool) {
+        roc_log(LogError, "roc_receiver_pool_acquire(): invalid arguments: pool is null");
+        return -1;
+    }
+
+    if (!result) {
+        roc_log(LogError,
+                "roc_receiver_pool_acquire(): invalid arguments: result is null");
+        return -1;
+    }
+
+    peer::ReceiverPool* imp_pool = (peer::ReceiverPool*)pool;
+
+    peer::Receiver* imp_receiver = imp_pool->acquire();
+    if (!imp_receiver) {
+        roc_log(LogError, "roc_receiver_pool_acquire(): can't open receiver");
+        return -1;
+    }
+
+    *result = (roc_receiver*)imp_receiver;
+    return 0;
+}
+
+int roc_receiver_pool_refill(roc_receiver_pool* pool) {
+    if (!pool) {
+        roc_log(LogError, "roc_receiver_pool_refill(): invalid arguments: pool is null");
+        return -1;
+    }
+
+    peer::ReceiverPool* imp_pool = (peer::ReceiverPool*)pool;
+
+    if (!imp_pool->refill()) {
+        roc_log(LogError, "roc_receiver_pool_refill(): can't refill pool");
+        return -1;
+    }
+
+    return 0;
+}
+
+int roc_receiver_pool_close(roc_receiver_pool* pool) {
+    if (!pool) {
+        roc_log(LogError, "roc_receiver_pool_close(): invalid arguments: pool is null");
+        return -1;
+    }
+
+    peer::ReceiverPool* imp_pool = (peer::ReceiverPool*)pool;
+    imp_pool->context().allocator().destroy_object(*imp_pool);
+
+    roc_log(LogInfo, "roc_receiver_pool_close(): closed receiver pool");
+
+    return 0;
+}
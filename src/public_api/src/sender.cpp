@@ -9,13 +9,39 @@
 #include "roc/sender.h"
 
 #include "config_helpers.h"
+#include "metrics_helpers.h"
 
 #include "roc_core/log.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_peer/sender.h"
+#include "roc_pipeline/iframe_callback.h"
 
 using namespace roc;
 
+namespace {
+
+class FrameCallbackAdapter : public pipeline::IFrameCallback {
+public:
+    FrameCallbackAdapter(roc_sender_frame_callback callback, void* arg)
+        : callback_(callback)
+        , arg_(arg) {
+    }
+
+    virtual bool fill_frame(audio::Frame& frame) {
+        roc_frame user_frame;
+        user_frame.samples = frame.samples();
+        user_frame.samples_size = frame.num_samples() * sizeof(float);
+
+        return callback_(arg_, &user_frame) == 0;
+    }
+
+private:
+    roc_sender_frame_callback callback_;
+    void* arg_;
+};
+
+} // namespace
+
 int roc_sender_open(roc_context* context,
                     const roc_sender_config* config,
                     roc_sender** result) {
@@ -44,9 +70,16 @@ int roc_sender_open(roc_context* context,
         return -1;
     }
 
-    core::ScopedPtr<peer::Sender> imp_sender(new (imp_context->allocator())
-                                                 peer::Sender(*imp_context, imp_config),
-                                             imp_context->allocator());
+    audio::PcmEncoding imp_frame_encoding;
+    if (!api::frame_encoding_from_user(imp_frame_encoding, config->frame_encoding)) {
+        roc_log(LogError, "roc_sender_open(): invalid arguments: bad frame encoding");
+        return -1;
+    }
+
+    core::ScopedPtr<peer::Sender> imp_sender(
+        new (imp_context->allocator())
+            peer::Sender(*imp_context, imp_config, imp_frame_encoding),
+        imp_context->allocator());
 
     if (!imp_sender) {
         roc_log(LogError, "roc_sender_open(): can't allocate sender");
@@ -128,6 +161,65 @@ int roc_sender_set_reuseaddr(roc_sender* sender,
     return 0;
 }
 
+int roc_sender_set_socket_buffer_size(roc_sender* sender,
+                                      roc_slot slot,
+                                      roc_interface iface,
+                                      size_t size) {
+    if (!sender) {
+        roc_log(LogError,
+                "roc_sender_set_socket_buffer_size(): invalid arguments: sender is null");
+        return -1;
+    }
+
+    peer::Sender* imp_sender = (peer::Sender*)sender;
+
+    address::Interface imp_iface;
+    if (!api::interface_from_user(imp_iface, iface)) {
+        roc_log(
+            LogError,
+            "roc_sender_set_socket_buffer_size(): invalid arguments: bad interface");
+        return -1;
+    }
+
+    if (!imp_sender->set_socket_buffer_size(slot, imp_iface, size)) {
+        roc_log(LogError, "roc_sender_set_socket_buffer_size(): operation failed");
+        return -1;
+    }
+
+    return 0;
+}
+
+int roc_sender_set_dscp(roc_sender* sender,
+                        roc_slot slot,
+                        roc_interface iface,
+                        int dscp) {
+    if (!sender) {
+        roc_log(LogError, "roc_sender_set_dscp(): invalid arguments: sender is null");
+        return -1;
+    }
+
+    peer::Sender* imp_sender = (peer::Sender*)sender;
+
+    address::Interface imp_iface;
+    if (!api::interface_from_user(imp_iface, iface)) {
+        roc_log(LogError, "roc_sender_set_dscp(): invalid arguments: bad interface");
+        return -1;
+    }
+
+    if (dscp < -1 || dscp > 63) {
+        roc_log(LogError,
+                "roc_sender_set_dscp(): invalid arguments: dscp should be in [-1; 63]");
+        return -1;
+    }
+
+    if (!imp_sender->set_dscp(slot, imp_iface, dscp)) {
+        roc_log(LogError, "roc_sender_set_dscp(): operation failed");
+        return -1;
+    }
+
+    return 0;
+}
+
 int roc_sender_connect(roc_sender* sender,
                        roc_slot slot,
                        roc_interface iface,
@@ -179,7 +271,8 @@ int roc_sender_write(roc_sender* sender, const roc_frame* frame) {
         return 0;
     }
 
-    const size_t factor = imp_sink.sample_spec().num_channels() * sizeof(float);
+    const size_t factor =
+        imp_sink.sample_spec().num_channels() * imp_sender->frame_sample_size();
 
     if (frame->samples_size % factor != 0) {
         roc_log(LogError,
@@ -194,9 +287,175 @@ int roc_sender_write(roc_sender* sender, const roc_frame* frame) {
         return -1;
     }
 
-    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
+    imp_sender->write_pcm(frame->samples, frame->samples_size);
+
+    return 0;
+}
+
+int roc_sender_write_frames(roc_sender* sender,
+                            const roc_frame* frames,
+                            size_t frames_count) {
+    if (!sender) {
+        roc_log(LogError, "roc_sender_write_frames(): invalid arguments: sender is null");
+        return -1;
+    }
+
+    peer::Sender* imp_sender = (peer::Sender*)sender;
+
+    if (!frames) {
+        roc_log(LogError, "roc_sender_write_frames(): invalid arguments: frames is null");
+        return -1;
+    }
+
+    if (frames_count == 0 || frames[0].samples_size == 0) {
+        return 0;
+    }
+
+    const size_t factor = imp_sender->sink().sample_spec().num_channels()
+        * imp_sender->frame_sample_size();
+
+    const size_t samples_size = frames[0].samples_size;
+
+    if (samples_size % factor != 0) {
+        roc_log(LogError,
+                "roc_sender_write_frames(): invalid arguments: # of samples should be "
+                "multiple of # of %u",
+                (unsigned)factor);
+        return -1;
+    }
+
+    for (size_t n = 0; n < frames_count; n++) {
+        if (frames[n].samples_size != samples_size) {
+            roc_log(LogError,
+                    "roc_sender_write_frames(): invalid arguments: all frames should "
+                    "have same size");
+            return -1;
+        }
+        if (!frames[n].samples) {
+            roc_log(LogError,
+                    "roc_sender_write_frames(): invalid arguments: samples is null");
+            return -1;
+        }
+    }
+
+    if (imp_sender->frame_sample_size() != sizeof(float)) {
+        // Frames should be converted one by one.
+        for (size_t n = 0; n < frames_count; n++) {
+            imp_sender->write_pcm(frames[n].samples, samples_size);
+        }
+        return 0;
+    }
+
+    // Frames are passed to pipeline in chunks, to avoid allocations.
+    enum { MaxChunkFrames = 64 };
+    audio::sample_t* imp_frames[MaxChunkFrames];
+
+    for (size_t pos = 0; pos < frames_count;) {
+        size_t n_chunk = 0;
+        while (n_chunk < MaxChunkFrames && pos + n_chunk < frames_count) {
+            imp_frames[n_chunk] = (audio::sample_t*)frames[pos + n_chunk].samples;
+            n_chunk++;
+        }
+
+        imp_sender->write_frames(imp_frames, n_chunk, samples_size / sizeof(float));
+
+        pos += n_chunk;
+    }
+
+    return 0;
+}
+
+int roc_sender_try_write(roc_sender* sender, const roc_frame* frame) {
+    if (!sender) {
+        roc_log(LogError, "roc_sender_try_write(): invalid arguments: sender is null");
+        return -1;
+    }
+
+    peer::Sender* imp_sender = (peer::Sender*)sender;
+
+    if (imp_sender->write_delay() > 0) {
+        return 1;
+    }
+
+    return roc_sender_write(sender, frame);
+}
+
+int roc_sender_write_delay(roc_sender* sender, unsigned long long* delay) {
+    if (!sender) {
+        roc_log(LogError, "roc_sender_write_delay(): invalid arguments: sender is null");
+        return -1;
+    }
+
+    if (!delay) {
+        roc_log(LogError, "roc_sender_write_delay(): invalid arguments: delay is null");
+        return -1;
+    }
+
+    peer::Sender* imp_sender = (peer::Sender*)sender;
 
-    imp_sink.write(imp_frame);
+    *delay = (unsigned long long)imp_sender->write_delay();
+
+    return 0;
+}
+
+int roc_sender_set_frame_callback(roc_sender* sender,
+                                  roc_sender_frame_callback callback,
+                                  void* arg) {
+    if (!sender) {
+        roc_log(LogError,
+                "roc_sender_set_frame_callback(): invalid arguments: sender is null");
+        return -1;
+    }
+
+    peer::Sender* imp_sender = (peer::Sender*)sender;
+
+    if (!callback) {
+        roc_log(LogError,
+                "roc_sender_set_frame_callback(): invalid arguments: callback is null");
+        return -1;
+    }
+
+    core::IAllocator& allocator = imp_sender->context().allocator();
+
+    core::ScopedPtr<FrameCallbackAdapter> imp_callback(
+        new (allocator) FrameCallbackAdapter(callback, arg), allocator);
+
+    if (!imp_callback) {
+        roc_log(LogError, "roc_sender_set_frame_callback(): can't allocate callback");
+        return -1;
+    }
+
+    if (!imp_sender->start_pulling(*imp_callback)) {
+        roc_log(LogError, "roc_sender_set_frame_callback(): can't start pulling frames");
+        return -1;
+    }
+
+    imp_callback.release();
+    return 0;
+}
+
+int roc_sender_query(roc_sender* sender,
+                     roc_slot slot,
+                     roc_sender_metrics* metrics) {
+    if (!sender) {
+        roc_log(LogError, "roc_sender_query(): invalid arguments: sender is null");
+        return -1;
+    }
+
+    if (!metrics) {
+        roc_log(LogError, "roc_sender_query(): invalid arguments: metrics is null");
+        return -1;
+    }
+
+    peer::Sender* imp_sender = (peer::Sender*)sender;
+
+    pipeline::SenderSlotMetrics imp_metrics;
+    if (!imp_sender->get_metrics(slot, imp_metrics)) {
+        roc_log(LogError, "roc_sender_query(): operation failed");
+        return -1;
+    }
+
+    api::sender_metrics_to_user(*metrics, imp_metrics);
 
     return 0;
 }
@@ -208,7 +467,17 @@ int roc_sender_close(roc_sender* sender) {
     }
 
     peer::Sender* imp_sender = (peer::Sender*)sender;
-    imp_sender->context().allocator().destroy_object(*imp_sender);
+
+    core::IAllocator& allocator = imp_sender->context().allocator();
+
+    // sender stops invoking callback in destructor, so callback is destroyed after it
+    pipeline::IFrameCallback* imp_callback = imp_sender->pull_callback();
+
+    allocator.destroy_object(*imp_sender);
+
+    if (imp_callback) {
+        allocator.destroy_object(*imp_callback);
+    }
 
     roc_log(LogInfo, "roc_sender_close(): closed sender");
 
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc/sender_encoder.h"
+
+#include "config_helpers.h"
+
+#include "roc_core/log.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_peer/sender_encoder.h"
+
+using namespace roc;
+
+int roc_sender_encoder_open(roc_context* context,
+                            const roc_sender_config* config,
+                            roc_sender_encoder** result) {
+    roc_log(LogInfo, "roc_sender_encoder_open(): opening encoder");
+
+    if (!result) {
+        roc_log(LogError, "roc_sender_encoder_open(): invalid arguments: result is null");
+        return -1;
+    }
+
+    if (!context) {
+        roc_log(LogError,
+                "roc_sender_encoder_open(): invalid arguments: context is null");
+        return -1;
+    }
+
+    peer::Context* imp_context = (peer::Context*)context;
+
+    if (!config) {
+        roc_log(LogError, "roc_sender_encoder_open(): invalid arguments: config is null");
+        return -1;
+    }
+
+    pipeline::SenderConfig imp_config;
+    if (!api::sender_config_from_user(imp_config, *config)) {
+        roc_log(LogError, "roc_sender_encoder_open(): invalid arguments: bad config");
+        return -1;
+    }
+
+    if (config->frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT) {
+        roc_log(LogError,
+                "roc_sender_encoder_open(): invalid arguments: "
+                "only float frame encoding is supported");
+        return -1;
+    }
+
+    core::ScopedPtr<peer::SenderEncoder> imp_encoder(
+        new (imp_context->allocator()) peer::SenderEncoder(*imp_context, imp_config),
+        imp_context->allocator());
+
+    if (!imp_encoder) {
+        roc_log(LogError, "roc_sender_encoder_open(): can't allocate encoder");
+        return -1;
+    }
+
+    if (!imp_encoder->valid()) {
+        roc_log(LogError, "roc_sender_encoder_open(): can't initialize encoder");
+        return -1;
+    }
+
+    *result = (roc_sender_encoder*)imp_encoder.release();
+    return 0;
+}
+
+int roc_sender_encoder_activate(roc_sender_encoder* encoder,
+                                roc_interface iface,
+                                roc_protocol proto) {
+    if (!encoder) {
+        roc_log(LogError,
+                "roc_sender_encoder_activate(): invalid arguments: encoder is null");
+        return -1;
+    }
+
+    peer::SenderEncoder* imp_encoder = (peer::SenderEncoder*)encoder;
+
+    address::Interface imp_iface;
+    if (!api::interface_from_user(imp_iface, iface)) {
+        roc_log(LogError,
+                "roc_sender_encoder_activate(): invalid arguments: bad interface");
+        return -1;
+    }
+
+    address::Protocol imp_proto;
+    if (!api::proto_from_user(imp_proto, proto)) {
+        roc_log(LogError,
+                "roc_sender_encoder_activate(): invalid arguments: bad protocol");
+        return -1;
+    }
+
+    if (!imp_encoder->activate(imp_iface, imp_proto)) {
+        roc_log(LogError, "roc_sender_encoder_activate(): operation failed");
+        return -1;
+    }
+
+    return 0;
+}
+
+int roc_sender_encoder_push_frame(roc_sender_encoder* encoder, const roc_frame* frame) {
+    if (!encoder) {
+        roc_log(LogError,
+                "roc_sender_encoder_push_frame(): invalid arguments: encoder is null");
+        return -1;
+    }
+
+    peer::SenderEncoder* imp_encoder = (peer::SenderEncoder*)encoder;
+
+    sndio::ISink& imp_sink = imp_encoder->sink();
+
+    if (!frame) {
+        roc_log(LogError,
+                "roc_sender_encoder_push_frame(): invalid arguments: frame is null");
+        return -1;
+    }
+
+    if (frame->samples_size == 0) {
+        return 0;
+    }
+
+    const size_t factor = imp_sink.sample_spec().num_channels() * sizeof(float);
+
+    if (frame->samples_size % factor != 0) {
+        roc_log(LogError,
+                "roc_sender_encoder_push_frame(): invalid arguments:"
+                " # of samples should be multiple of # of %u",
+                (unsigned)factor);
+        return -1;
+    }
+
+    if (!frame->samples) {
+        roc_log(LogError,
+                "roc_sender_encoder_push_frame(): invalid arguments: samples is null");
+        return -1;
+    }
+
+    audio::Frame imp_frame((float*)frame->samples, frame->samples_size / sizeof(float));
+
+    imp_sink.write(imp_frame);
+
+    return 0;
+}
+
+int roc_sender_encoder_pop_packet(roc_sender_encoder* encoder,
+                                  roc_interface iface,
+                                  roc_packet* packet) {
+    if (!encoder) {
+        roc_log(LogError,
+                "roc_sender_encoder_pop_packet(): invalid arguments: encoder is null");
+        return -1;
+    }
+
+    peer::SenderEncoder* imp_encoder = (peer::SenderEncoder*)encoder;
+
+    address::Interface imp_iface;
+    if (!api::interface_from_user(imp_iface, iface)) {
+        roc_log(LogError,
+                "roc_sender_encoder_pop_packet(): invalid arguments: bad interface");
+        return -1;
+    }
+
+    if (!packet) {
+        roc_log(LogError,
+                "roc_sender_encoder_pop_packet(): invalid arguments: packet is null");
+        return -1;
+    }
+
+    if (!packet->bytes) {
+        roc_log(LogError,
+                "roc_sender_encoder_pop_packet(): invalid arguments: bytes is null");
+        return -1;
+    }
+
+    size_t size = packet->bytes_size;
+
+    if (!imp_encoder->read_packet(imp_iface, packet->bytes, size)) {
+        // size is updated if buffer is too small
+        packet->bytes_size = size;
+        return -1;
+    }
+
+    packet->bytes_size = size;
+
+    return 0;
+}
+
+int roc_sender_encoder_close(roc_sender_encoder* encoder) {
+    if (!encoder) {
+        roc_log(LogError,
+                "roc_sender_encoder_close(): invalid arguments: encoder is null");
+        return -1;
+    }
+
+    peer::SenderEncoder* imp_encoder = (peer::SenderEncoder*)encoder;
+    imp_encoder->context().allocator().destroy_object(*imp_encoder);
+
+    roc_log(LogInfo, "roc_sender_encoder_close(): closed encoder");
+
+    return 0;
+}
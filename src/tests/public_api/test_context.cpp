@@ -30,6 +30,59 @@ TEST(context, open_close) {
     LONGS_EQUAL(0, roc_context_close(context));
 }
 
+TEST(context, open_thread_config) {
+    roc_context_config config;
+    memset(&config, 0, sizeof(config));
+
+    // threads should start even if there are no privileges to change policy
+    config.network_thread.policy = ROC_THREAD_POLICY_FIFO;
+    config.control_thread.policy = ROC_THREAD_POLICY_RR;
+    config.control_thread.priority = 1;
+
+    roc_context* context = NULL;
+    CHECK(roc_context_open(&config, &context) == 0);
+    CHECK(context);
+
+    LONGS_EQUAL(0, roc_context_close(context));
+}
+
+TEST(context, open_bad_thread_config) {
+    roc_context_config config;
+    memset(&config, 0, sizeof(config));
+
+    config.network_thread.policy = (roc_thread_policy)100;
+
+    roc_context* context = NULL;
+    LONGS_EQUAL(-1, roc_context_open(&config, &context));
+    CHECK(!context);
+
+    memset(&config, 0, sizeof(config));
+
+    config.control_thread.priority = -1;
+
+    LONGS_EQUAL(-1, roc_context_open(&config, &context));
+    CHECK(!context);
+}
+
+TEST(context, open_network_threads) {
+    roc_context_config config;
+    memset(&config, 0, sizeof(config));
+
+    config.network_threads = 2;
+
+    roc_context* context = NULL;
+    CHECK(roc_context_open(&config, &context) == 0);
+    CHECK(context);
+
+    LONGS_EQUAL(0, roc_context_close(context));
+
+    config.network_threads = 100;
+
+    context = NULL;
+    LONGS_EQUAL(-1, roc_context_open(&config, &context));
+    CHECK(!context);
+}
+
 TEST(context, open_null) {
     roc_context* context = NULL;
     LONGS_EQUAL(-1, roc_context_open(NULL, &context));
@@ -44,6 +97,82 @@ TEST(context, close_null) {
     LONGS_EQUAL(-1, roc_context_close(NULL));
 }
 
+TEST(context, register_encoding) {
+    roc_context_config config;
+    memset(&config, 0, sizeof(config));
+
+    roc_context* context = NULL;
+    CHECK(roc_context_open(&config, &context) == 0);
+    CHECK(context);
+
+    roc_media_encoding encoding;
+    memset(&encoding, 0, sizeof(encoding));
+    encoding.rate = 48000;
+    encoding.encoding = ROC_PACKET_ENCODING_AVP_L16;
+    encoding.channels = ROC_CHANNEL_SET_MONO;
+
+    LONGS_EQUAL(0, roc_context_register_encoding(context, 100, &encoding));
+
+    // already registered
+    LONGS_EQUAL(-1, roc_context_register_encoding(context, 100, &encoding));
+
+    {
+        roc_sender_config sender_config;
+        memset(&sender_config, 0, sizeof(sender_config));
+        sender_config.frame_sample_rate = 48000;
+        sender_config.frame_channels = ROC_CHANNEL_SET_STEREO;
+        sender_config.frame_encoding = ROC_FRAME_ENCODING_PCM_FLOAT;
+        sender_config.packet_encoding = (roc_packet_encoding)100;
+
+        roc_sender* sender = NULL;
+        CHECK(roc_sender_open(context, &sender_config, &sender) == 0);
+        CHECK(sender);
+
+        LONGS_EQUAL(0, roc_sender_close(sender));
+    }
+
+    LONGS_EQUAL(0, roc_context_close(context));
+}
+
+TEST(context, register_encoding_bad_args) {
+    roc_context_config config;
+    memset(&config, 0, sizeof(config));
+
+    roc_context* context = NULL;
+    CHECK(roc_context_open(&config, &context) == 0);
+    CHECK(context);
+
+    roc_media_encoding encoding;
+    memset(&encoding, 0, sizeof(encoding));
+    encoding.rate = 48000;
+    encoding.encoding = ROC_PACKET_ENCODING_AVP_L16;
+    encoding.channels = ROC_CHANNEL_SET_STEREO;
+
+    // null
+    LONGS_EQUAL(-1, roc_context_register_encoding(NULL, 100, &encoding));
+    LONGS_EQUAL(-1, roc_context_register_encoding(context, 100, NULL));
+
+    // not a dynamic payload type
+    LONGS_EQUAL(-1, roc_context_register_encoding(context, 10, &encoding));
+    LONGS_EQUAL(-1, roc_context_register_encoding(context, 128, &encoding));
+
+    // bad rate
+    encoding.rate = 0;
+    LONGS_EQUAL(-1, roc_context_register_encoding(context, 100, &encoding));
+    encoding.rate = 48000;
+
+    // bad channels
+    encoding.channels = (roc_channel_set)0;
+    LONGS_EQUAL(-1, roc_context_register_encoding(context, 100, &encoding));
+    encoding.channels = ROC_CHANNEL_SET_STEREO;
+
+    // bad encoding
+    encoding.encoding = (roc_packet_encoding)0;
+    LONGS_EQUAL(-1, roc_context_register_encoding(context, 100, &encoding));
+
+    LONGS_EQUAL(0, roc_context_close(context));
+}
+
 TEST(context, reference_counting) {
     roc_context_config context_config;
     memset(&context_config, 0, sizeof(context_config));
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "test_helpers/context.h"
+#include "test_helpers/utils.h"
+
+#include "roc_core/stddefs.h"
+
+#include "roc/receiver_decoder.h"
+#include "roc/sender_encoder.h"
+
+namespace roc {
+namespace api {
+
+TEST_GROUP(encoder_decoder) {
+    roc_sender_config sender_conf;
+    roc_receiver_config receiver_conf;
+
+    void setup() {
+        memset(&sender_conf, 0, sizeof(sender_conf));
+        sender_conf.frame_sample_rate = test::SampleRate;
+        sender_conf.frame_channels = ROC_CHANNEL_SET_STEREO;
+        sender_conf.frame_encoding = ROC_FRAME_ENCODING_PCM_FLOAT;
+        sender_conf.resampler_profile = ROC_RESAMPLER_PROFILE_DISABLE;
+        sender_conf.fec_encoding = ROC_FEC_ENCODING_DISABLE;
+        sender_conf.packet_length =
+            test::PacketSamples * 1000000000ul / (test::SampleRate * test::NumChans);
+
+        memset(&receiver_conf, 0, sizeof(receiver_conf));
+        receiver_conf.frame_sample_rate = test::SampleRate;
+        receiver_conf.frame_channels = ROC_CHANNEL_SET_STEREO;
+        receiver_conf.frame_encoding = ROC_FRAME_ENCODING_PCM_FLOAT;
+        receiver_conf.resampler_profile = ROC_RESAMPLER_PROFILE_DISABLE;
+        receiver_conf.target_latency = test::Latency * 1000000000ul / test::SampleRate;
+        receiver_conf.no_playback_timeout =
+            test::Timeout * 1000000000ul / test::SampleRate;
+    }
+};
+
+TEST(encoder_decoder, open_close) {
+    test::Context context;
+
+    roc_sender_encoder* encoder = NULL;
+    CHECK(roc_sender_encoder_open(context.get(), &sender_conf, &encoder) == 0);
+    CHECK(encoder);
+
+    roc_receiver_decoder* decoder = NULL;
+    CHECK(roc_receiver_decoder_open(context.get(), &receiver_conf, &decoder) == 0);
+    CHECK(decoder);
+
+    LONGS_EQUAL(0, roc_receiver_decoder_close(decoder));
+    LONGS_EQUAL(0, roc_sender_encoder_close(encoder));
+}
+
+TEST(encoder_decoder, activate) {
+    test::Context context;
+
+    roc_sender_encoder* encoder = NULL;
+    CHECK(roc_sender_encoder_open(context.get(), &sender_conf, &encoder) == 0);
+
+    CHECK(roc_sender_encoder_activate(encoder, ROC_INTERFACE_AUDIO_SOURCE, ROC_PROTO_RTP)
+          == 0);
+    // already activated
+    CHECK(roc_sender_encoder_activate(encoder, ROC_INTERFACE_AUDIO_SOURCE, ROC_PROTO_RTP)
+          == -1);
+    // not supported
+    CHECK(roc_sender_encoder_activate(encoder, ROC_INTERFACE_CONSOLIDATED, ROC_PROTO_RTP)
+          == -1);
+
+    roc_receiver_decoder* decoder = NULL;
+    CHECK(roc_receiver_decoder_open(context.get(), &receiver_conf, &decoder) == 0);
+
+    CHECK(
+        roc_receiver_decoder_activate(decoder, ROC_INTERFACE_AUDIO_SOURCE, ROC_PROTO_RTP)
+        == 0);
+    CHECK(
+        roc_receiver_decoder_activate(decoder, ROC_INTERFACE_AUDIO_SOURCE, ROC_PROTO_RTP)
+        == -1);
+    CHECK(
+        roc_receiver_decoder_activate(decoder, ROC_INTERFACE_CONSOLIDATED, ROC_PROTO_RTP)
+        == -1);
+
+    LONGS_EQUAL(0, roc_receiver_decoder_close(decoder));
+    LONGS_EQUAL(0, roc_sender_encoder_close(encoder));
+}
+
+TEST(encoder_decoder, push_pop) {
+    enum { NumFrames = test::Latency * test::NumChans / test::FrameSamples * 4 };
+
+    test::Context context;
+
+    roc_sender_encoder* encoder = NULL;
+    CHECK(roc_sender_encoder_open(context.get(), &sender_conf, &encoder) == 0);
+    CHECK(roc_sender_encoder_activate(encoder, ROC_INTERFACE_AUDIO_SOURCE, ROC_PROTO_RTP)
+          == 0);
+
+    roc_receiver_decoder* decoder = NULL;
+    CHECK(roc_receiver_decoder_open(context.get(), &receiver_conf, &decoder) == 0);
+    CHECK(
+        roc_receiver_decoder_activate(decoder, ROC_INTERFACE_AUDIO_SOURCE, ROC_PROTO_RTP)
+        == 0);
+
+    const float sample_step = 1. / 32768.;
+    float sample_value = sample_step;
+
+    size_t n_packets = 0;
+    bool got_samples = false;
+
+    for (size_t nf = 0; nf < NumFrames; nf++) {
+        float send_samples[test::FrameSamples];
+        for (size_t ns = 0; ns < test::FrameSamples; ns += test::NumChans) {
+            sample_value = test::increment_sample_value(sample_value, sample_step);
+            for (size_t nc = 0; nc < test::NumChans; nc++) {
+                send_samples[ns + nc] = sample_value;
+            }
+        }
+
+        roc_frame send_frame;
+        send_frame.samples = send_samples;
+        send_frame.samples_size = sizeof(send_samples);
+
+        CHECK(roc_sender_encoder_push_frame(encoder, &send_frame) == 0);
+
+        for (;;) {
+            uint8_t bytes[test::MaxBufSize];
+
+            roc_packet packet;
+            packet.bytes = bytes;
+            packet.bytes_size = sizeof(bytes);
+
+            if (roc_sender_encoder_pop_packet(encoder, ROC_INTERFACE_AUDIO_SOURCE,
+                                              &packet)
+                != 0) {
+                break;
+            }
+
+            CHECK(packet.bytes_size > 0);
+            CHECK(packet.bytes_size <= sizeof(bytes));
+
+            CHECK(roc_receiver_decoder_push_packet(decoder, ROC_INTERFACE_AUDIO_SOURCE,
+                                                   &packet)
+                  == 0);
+            n_packets++;
+        }
+
+        float recv_samples[test::FrameSamples];
+
+        roc_frame recv_frame;
+        recv_frame.samples = recv_samples;
+        recv_frame.samples_size = sizeof(recv_samples);
+
+        CHECK(roc_receiver_decoder_pop_frame(decoder, &recv_frame) == 0);
+
+        for (size_t ns = 0; ns < test::FrameSamples; ns++) {
+            if (recv_samples[ns] > sample_step / 2) {
+                got_samples = true;
+            }
+        }
+    }
+
+    CHECK(n_packets > 0);
+    CHECK(got_samples);
+
+    LONGS_EQUAL(0, roc_receiver_decoder_close(decoder));
+    LONGS_EQUAL(0, roc_sender_encoder_close(encoder));
+}
+
+TEST(encoder_decoder, small_buffer) {
+    test::Context context;
+
+    roc_sender_encoder* encoder = NULL;
+    CHECK(roc_sender_encoder_open(context.get(), &sender_conf, &encoder) == 0);
+    CHECK(roc_sender_encoder_activate(encoder, ROC_INTERFACE_AUDIO_SOURCE, ROC_PROTO_RTP)
+          == 0);
+
+    uint8_t bytes[test::MaxBufSize];
+
+    roc_packet packet;
+    packet.bytes = bytes;
+    packet.bytes_size = sizeof(bytes);
+
+    // no packets yet
+    CHECK(roc_sender_encoder_pop_packet(encoder, ROC_INTERFACE_AUDIO_SOURCE, &packet)
+          == -1);
+
+    float samples[test::PacketSamples * 2] = {};
+
+    roc_frame frame;
+    frame.samples = samples;
+    frame.samples_size = sizeof(samples);
+
+    CHECK(roc_sender_encoder_push_frame(encoder, &frame) == 0);
+
+    // too small, required size is reported and packet is kept
+    packet.bytes_size = 1;
+    CHECK(roc_sender_encoder_pop_packet(encoder, ROC_INTERFACE_AUDIO_SOURCE, &packet)
+          == -1);
+    CHECK(packet.bytes_size > 1);
+
+    CHECK(roc_sender_encoder_pop_packet(encoder, ROC_INTERFACE_AUDIO_SOURCE, &packet)
+          == 0);
+
+    // not activated
+    packet.bytes_size = sizeof(bytes);
+    CHECK(roc_sender_encoder_pop_packet(encoder, ROC_INTERFACE_AUDIO_REPAIR, &packet)
+          == -1);
+
+    LONGS_EQUAL(0, roc_sender_encoder_close(encoder));
+}
+
+TEST(encoder_decoder, bad_args) {
+    test::Context context;
+
+    roc_sender_encoder* encoder = NULL;
+    roc_receiver_decoder* decoder = NULL;
+
+    CHECK(roc_sender_encoder_open(NULL, &sender_conf, &encoder) == -1);
+    CHECK(roc_sender_encoder_open(context.get(), NULL, &encoder) == -1);
+    CHECK(roc_sender_encoder_open(context.get(), &sender_conf, NULL) == -1);
+
+    CHECK(roc_receiver_decoder_open(NULL, &receiver_conf, &decoder) == -1);
+    CHECK(roc_receiver_decoder_open(context.get(), NULL, &decoder) == -1);
+    CHECK(roc_receiver_decoder_open(context.get(), &receiver_conf, NULL) == -1);
+
+    CHECK(roc_sender_encoder_open(context.get(), &sender_conf, &encoder) == 0);
+    CHECK(roc_receiver_decoder_open(context.get(), &receiver_conf, &decoder) == 0);
+
+    CHECK(roc_sender_encoder_push_frame(encoder, NULL) == -1);
+    CHECK(roc_sender_encoder_pop_packet(encoder, ROC_INTERFACE_AUDIO_SOURCE, NULL) == -1);
+
+    CHECK(roc_receiver_decoder_push_packet(decoder, ROC_INTERFACE_AUDIO_SOURCE, NULL)
+          == -1);
+    CHECK(roc_receiver_decoder_pop_frame(decoder, NULL) == -1);
+
+    uint8_t bytes[16] = {};
+
+    roc_packet packet;
+    packet.bytes = bytes;
+    packet.bytes_size = sizeof(bytes);
+
+    // not activated
+    CHECK(roc_receiver_decoder_push_packet(decoder, ROC_INTERFACE_AUDIO_SOURCE, &packet)
+          == -1);
+
+    CHECK(roc_sender_encoder_close(NULL) == -1);
+    CHECK(roc_receiver_decoder_close(NULL) == -1);
+
+    LONGS_EQUAL(0, roc_receiver_decoder_close(decoder));
+    LONGS_EQUAL(0, roc_sender_encoder_close(encoder));
+}
+
+} // namespace api
+} // namespace roc
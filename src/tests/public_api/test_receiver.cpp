@@ -9,6 +9,7 @@
 #include <CppUTest/TestHarness.h>
 
 #include "roc_core/stddefs.h"
+#include "roc_core/time.h"
 
 #include "roc/receiver.h"
 
@@ -97,6 +98,45 @@ TEST(receiver, bind_slots) {
     LONGS_EQUAL(0, roc_receiver_close(receiver));
 }
 
+TEST(receiver, bind_many) {
+    enum { NumSlots = 4 };
+
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+    CHECK(receiver);
+
+    roc_receiver_binding bindings[NumSlots];
+
+    for (size_t n = 0; n < NumSlots; n++) {
+        bindings[n].slot = n;
+        bindings[n].iface = ROC_INTERFACE_AUDIO_SOURCE;
+        bindings[n].endpoint = NULL;
+
+        CHECK(roc_endpoint_allocate(&bindings[n].endpoint) == 0);
+        CHECK(roc_endpoint_set_uri(bindings[n].endpoint, "rtp://127.0.0.1:0") == 0);
+    }
+
+    CHECK(roc_receiver_bind_many(receiver, bindings, NumSlots) == 0);
+
+    for (size_t n = 0; n < NumSlots; n++) {
+        int port = 0;
+        CHECK(roc_endpoint_get_port(bindings[n].endpoint, &port) == 0);
+        CHECK(port != 0);
+    }
+
+    // interfaces are already bound
+    CHECK(roc_receiver_bind_many(receiver, bindings, NumSlots) == -1);
+
+    // nothing to bind
+    CHECK(roc_receiver_bind_many(receiver, NULL, 0) == 0);
+
+    for (size_t n = 0; n < NumSlots; n++) {
+        CHECK(roc_endpoint_deallocate(bindings[n].endpoint) == 0);
+    }
+
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
 TEST(receiver, bind_errors) {
     roc_receiver* receiver = NULL;
 
@@ -411,6 +451,169 @@ TEST(receiver, reuseaddr_slots) {
     LONGS_EQUAL(0, roc_receiver_close(receiver));
 }
 
+TEST(receiver, try_read) {
+    enum { FrameSize = 441 * 2 };
+
+    receiver_config.clock_source = ROC_CLOCK_INTERNAL;
+
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+    CHECK(receiver);
+
+    float samples[FrameSize];
+    memset(samples, 0, sizeof(samples));
+
+    roc_frame frame;
+    frame.samples = samples;
+    frame.samples_size = sizeof(samples);
+
+    unsigned long long delay = 0;
+
+    // first frame is due immediately
+    CHECK(roc_receiver_read_delay(receiver, &delay) == 0);
+    UNSIGNED_LONGS_EQUAL(0, delay);
+    CHECK(roc_receiver_try_read(receiver, &frame) == 0);
+
+    // next frame is due after the first one
+    CHECK(roc_receiver_read_delay(receiver, &delay) == 0);
+    CHECK(delay > 0);
+    CHECK(roc_receiver_try_read(receiver, &frame) > 0);
+
+    core::sleep_for(core::ClockMonotonic, (core::nanoseconds_t)delay);
+    CHECK(roc_receiver_try_read(receiver, &frame) == 0);
+
+    CHECK(roc_receiver_read_delay(receiver, NULL) == -1);
+    CHECK(roc_receiver_read_delay(NULL, &delay) == -1);
+    CHECK(roc_receiver_try_read(NULL, &frame) == -1);
+
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
+TEST(receiver, read_frames) {
+    enum { FrameSize = 441 * 2, NumFrames = 100 };
+
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+    CHECK(receiver);
+
+    static float samples[NumFrames][FrameSize];
+    memset(samples, 0, sizeof(samples));
+
+    roc_frame frames[NumFrames];
+    for (size_t n = 0; n < NumFrames; n++) {
+        frames[n].samples = samples[n];
+        frames[n].samples_size = sizeof(samples[n]);
+    }
+
+    CHECK(roc_receiver_read_frames(receiver, frames, NumFrames) == 0);
+    CHECK(roc_receiver_read_frames(receiver, frames, 0) == 0);
+
+    // frames of different size
+    frames[1].samples_size /= 2;
+    CHECK(roc_receiver_read_frames(receiver, frames, NumFrames) == -1);
+    frames[1].samples_size = sizeof(samples[1]);
+
+    // frame without samples
+    frames[1].samples = NULL;
+    CHECK(roc_receiver_read_frames(receiver, frames, NumFrames) == -1);
+    frames[1].samples = samples[1];
+
+    CHECK(roc_receiver_read_frames(NULL, frames, NumFrames) == -1);
+    CHECK(roc_receiver_read_frames(receiver, NULL, NumFrames) == -1);
+
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
+TEST(receiver, query) {
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+    CHECK(receiver);
+
+    roc_endpoint* source_endpoint = NULL;
+    CHECK(roc_endpoint_allocate(&source_endpoint) == 0);
+    CHECK(roc_endpoint_set_uri(source_endpoint, "rtp://127.0.0.1:0") == 0);
+
+    roc_session_metrics sessions[2];
+    memset(sessions, 0, sizeof(sessions));
+
+    roc_receiver_metrics metrics;
+    memset(&metrics, 0, sizeof(metrics));
+
+    // slot doesn't exist yet
+    CHECK(roc_receiver_query(receiver, ROC_SLOT_DEFAULT, &metrics) == -1);
+
+    CHECK(roc_receiver_bind(receiver, ROC_SLOT_DEFAULT, ROC_INTERFACE_AUDIO_SOURCE,
+                            source_endpoint)
+          == 0);
+
+    metrics.sessions = sessions;
+    metrics.sessions_size = 2;
+
+    CHECK(roc_receiver_query(receiver, ROC_SLOT_DEFAULT, &metrics) == 0);
+
+    UNSIGNED_LONGS_EQUAL(0, metrics.num_sessions);
+    UNSIGNED_LONGS_EQUAL(0, metrics.sessions_size);
+
+    metrics.sessions = NULL;
+    metrics.sessions_size = 2;
+
+    CHECK(roc_receiver_query(receiver, ROC_SLOT_DEFAULT, &metrics) == -1);
+    CHECK(roc_receiver_query(receiver, ROC_SLOT_DEFAULT, NULL) == -1);
+    CHECK(roc_receiver_query(NULL, ROC_SLOT_DEFAULT, &metrics) == -1);
+
+    CHECK(roc_endpoint_deallocate(source_endpoint) == 0);
+
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
+TEST(receiver, read_sessions) {
+    enum { FrameSize = 10 * 2 };
+
+    roc_receiver* receiver = NULL;
+    CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+    CHECK(receiver);
+
+    float samples[2][FrameSize];
+
+    roc_session_frame frames[2];
+    memset(frames, 0, sizeof(frames));
+
+    for (size_t n = 0; n < 2; n++) {
+        frames[n].frame.samples = samples[n];
+        frames[n].frame.samples_size = sizeof(samples[n]);
+    }
+
+    // no sessions yet
+    size_t frames_count = 2;
+    CHECK(roc_receiver_read_sessions(receiver, frames, &frames_count) == 0);
+    UNSIGNED_LONGS_EQUAL(0, frames_count);
+
+    // zero count
+    frames_count = 0;
+    CHECK(roc_receiver_read_sessions(receiver, frames, &frames_count) == -1);
+
+    // different sizes
+    frames_count = 2;
+    frames[1].frame.samples_size = sizeof(float) * 2;
+    CHECK(roc_receiver_read_sessions(receiver, frames, &frames_count) == -1);
+    frames[1].frame.samples_size = sizeof(samples[1]);
+
+    // null samples
+    frames[1].frame.samples = NULL;
+    CHECK(roc_receiver_read_sessions(receiver, frames, &frames_count) == -1);
+    frames[1].frame.samples = samples[1];
+
+    // bad size
+    frames[0].frame.samples_size = frames[1].frame.samples_size = sizeof(float);
+    CHECK(roc_receiver_read_sessions(receiver, frames, &frames_count) == -1);
+
+    CHECK(roc_receiver_read_sessions(receiver, NULL, &frames_count) == -1);
+    CHECK(roc_receiver_read_sessions(receiver, frames, NULL) == -1);
+    CHECK(roc_receiver_read_sessions(NULL, frames, &frames_count) == -1);
+
+    LONGS_EQUAL(0, roc_receiver_close(receiver));
+}
+
 TEST(receiver, bad_args) {
     roc_receiver* receiver = NULL;
 
@@ -446,6 +649,31 @@ TEST(receiver, bad_args) {
         CHECK(roc_endpoint_deallocate(source_endpoint) == 0);
         LONGS_EQUAL(0, roc_receiver_close(receiver));
     }
+    { // bind many
+        CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
+
+        roc_endpoint* source_endpoint = NULL;
+        CHECK(roc_endpoint_allocate(&source_endpoint) == 0);
+        CHECK(roc_endpoint_set_uri(source_endpoint, "rtp://127.0.0.1:0") == 0);
+
+        roc_receiver_binding binding;
+        binding.slot = ROC_SLOT_DEFAULT;
+        binding.iface = ROC_INTERFACE_AUDIO_SOURCE;
+        binding.endpoint = source_endpoint;
+
+        CHECK(roc_receiver_bind_many(NULL, &binding, 1) == -1);
+        CHECK(roc_receiver_bind_many(receiver, NULL, 1) == -1);
+
+        binding.iface = (roc_interface)-1;
+        CHECK(roc_receiver_bind_many(receiver, &binding, 1) == -1);
+
+        binding.iface = ROC_INTERFACE_AUDIO_SOURCE;
+        binding.endpoint = NULL;
+        CHECK(roc_receiver_bind_many(receiver, &binding, 1) == -1);
+
+        CHECK(roc_endpoint_deallocate(source_endpoint) == 0);
+        LONGS_EQUAL(0, roc_receiver_close(receiver));
+    }
     { // set multicast group
         CHECK(roc_receiver_open(context, &receiver_config, &receiver) == 0);
 
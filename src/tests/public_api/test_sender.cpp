@@ -8,7 +8,10 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "roc_core/atomic.h"
+#include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/time.h"
 
 #include "roc/sender.h"
 
@@ -362,6 +365,152 @@ TEST(sender, reuseaddr_slots) {
     LONGS_EQUAL(0, roc_sender_close(sender));
 }
 
+TEST(sender, try_write) {
+    enum { FrameSize = 441 * 2 };
+
+    sender_config.clock_source = ROC_CLOCK_INTERNAL;
+
+    roc_sender* sender = NULL;
+    CHECK(roc_sender_open(context, &sender_config, &sender) == 0);
+    CHECK(sender);
+
+    float samples[FrameSize];
+    memset(samples, 0, sizeof(samples));
+
+    roc_frame frame;
+    frame.samples = samples;
+    frame.samples_size = sizeof(samples);
+
+    unsigned long long delay = 0;
+
+    // first frame is due immediately
+    CHECK(roc_sender_write_delay(sender, &delay) == 0);
+    UNSIGNED_LONGS_EQUAL(0, delay);
+    CHECK(roc_sender_try_write(sender, &frame) == 0);
+
+    // next frame is due after the first one
+    CHECK(roc_sender_write_delay(sender, &delay) == 0);
+    CHECK(delay > 0);
+    CHECK(roc_sender_try_write(sender, &frame) > 0);
+
+    core::sleep_for(core::ClockMonotonic, (core::nanoseconds_t)delay);
+    CHECK(roc_sender_try_write(sender, &frame) == 0);
+
+    CHECK(roc_sender_write_delay(sender, NULL) == -1);
+    CHECK(roc_sender_write_delay(NULL, &delay) == -1);
+    CHECK(roc_sender_try_write(NULL, &frame) == -1);
+
+    LONGS_EQUAL(0, roc_sender_close(sender));
+}
+
+TEST(sender, frame_callback) {
+    struct Counter {
+        static int callback(void* arg, roc_frame* frame) {
+            roc_panic_if_not(frame && frame->samples && frame->samples_size > 0);
+            return ++*(core::Atomic<int>*)arg == 3;
+        }
+    };
+
+    core::Atomic<int> n_calls(0);
+
+    { // external clock is not supported
+        roc_sender* sender = NULL;
+        CHECK(roc_sender_open(context, &sender_config, &sender) == 0);
+        CHECK(sender);
+
+        CHECK(roc_sender_set_frame_callback(sender, &Counter::callback, &n_calls) == -1);
+
+        LONGS_EQUAL(0, roc_sender_close(sender));
+    }
+
+    sender_config.clock_source = ROC_CLOCK_INTERNAL;
+
+    { // callback is invoked until it returns non-zero
+        roc_sender* sender = NULL;
+        CHECK(roc_sender_open(context, &sender_config, &sender) == 0);
+        CHECK(sender);
+
+        CHECK(roc_sender_set_frame_callback(sender, &Counter::callback, &n_calls) == 0);
+        CHECK(roc_sender_set_frame_callback(sender, &Counter::callback, &n_calls) == -1);
+
+        while (n_calls < 3) {
+            core::sleep_for(core::ClockMonotonic, core::Millisecond);
+        }
+
+        LONGS_EQUAL(0, roc_sender_close(sender));
+    }
+
+    LONGS_EQUAL(3, (int)n_calls);
+
+    CHECK(roc_sender_set_frame_callback(NULL, &Counter::callback, &n_calls) == -1);
+}
+
+TEST(sender, write_frames) {
+    enum { FrameSize = 441 * 2, NumFrames = 100 };
+
+    roc_sender* sender = NULL;
+    CHECK(roc_sender_open(context, &sender_config, &sender) == 0);
+    CHECK(sender);
+
+    static float samples[NumFrames][FrameSize];
+    memset(samples, 0, sizeof(samples));
+
+    roc_frame frames[NumFrames];
+    for (size_t n = 0; n < NumFrames; n++) {
+        frames[n].samples = samples[n];
+        frames[n].samples_size = sizeof(samples[n]);
+    }
+
+    CHECK(roc_sender_write_frames(sender, frames, NumFrames) == 0);
+    CHECK(roc_sender_write_frames(sender, frames, 0) == 0);
+
+    // frames of different size
+    frames[1].samples_size /= 2;
+    CHECK(roc_sender_write_frames(sender, frames, NumFrames) == -1);
+    frames[1].samples_size = sizeof(samples[1]);
+
+    // frame without samples
+    frames[1].samples = NULL;
+    CHECK(roc_sender_write_frames(sender, frames, NumFrames) == -1);
+    frames[1].samples = samples[1];
+
+    CHECK(roc_sender_write_frames(NULL, frames, NumFrames) == -1);
+    CHECK(roc_sender_write_frames(sender, NULL, NumFrames) == -1);
+
+    LONGS_EQUAL(0, roc_sender_close(sender));
+}
+
+TEST(sender, query) {
+    roc_sender* sender = NULL;
+    CHECK(roc_sender_open(context, &sender_config, &sender) == 0);
+    CHECK(sender);
+
+    roc_endpoint* source_endpoint = NULL;
+    CHECK(roc_endpoint_allocate(&source_endpoint) == 0);
+    CHECK(roc_endpoint_set_uri(source_endpoint, "rtp://127.0.0.1:111") == 0);
+
+    roc_sender_metrics metrics;
+    memset(&metrics, 0, sizeof(metrics));
+
+    // slot doesn't exist yet
+    CHECK(roc_sender_query(sender, ROC_SLOT_DEFAULT, &metrics) == -1);
+
+    CHECK(roc_sender_connect(sender, ROC_SLOT_DEFAULT, ROC_INTERFACE_AUDIO_SOURCE,
+                             source_endpoint)
+          == 0);
+
+    CHECK(roc_sender_query(sender, ROC_SLOT_DEFAULT, &metrics) == 0);
+
+    UNSIGNED_LONGS_EQUAL(1, metrics.num_sessions);
+
+    CHECK(roc_sender_query(sender, ROC_SLOT_DEFAULT, NULL) == -1);
+    CHECK(roc_sender_query(NULL, ROC_SLOT_DEFAULT, &metrics) == -1);
+
+    CHECK(roc_endpoint_deallocate(source_endpoint) == 0);
+
+    LONGS_EQUAL(0, roc_sender_close(sender));
+}
+
 TEST(sender, bad_args) {
     roc_sender* sender = NULL;
 
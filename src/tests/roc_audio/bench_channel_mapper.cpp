@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_audio/channel_mapper.h"
+#include "roc_core/fast_random.h"
+#include "roc_packet/units.h"
+
+// Channel mapper throughput, in input samples (per channel) per second.
+//
+// Arguments are input and output channel masks.
+
+namespace roc {
+namespace audio {
+namespace {
+
+enum { NumSamples = 1024, MaxChannels = 8 };
+
+sample_t input[NumSamples * MaxChannels];
+sample_t output[NumSamples * MaxChannels];
+
+size_t num_channels(packet::channel_mask_t mask) {
+    size_t n = 0;
+    for (; mask != 0; mask >>= 1) {
+        n += (mask & 1);
+    }
+    return n;
+}
+
+void run_mapper(benchmark::State& state, ChannelMixing mixing) {
+    const packet::channel_mask_t in_chans = (packet::channel_mask_t)state.range(0);
+    const packet::channel_mask_t out_chans = (packet::channel_mask_t)state.range(1);
+
+    const size_t in_ch = num_channels(in_chans);
+    const size_t out_ch = num_channels(out_chans);
+
+    for (size_t n = 0; n < NumSamples * in_ch; n++) {
+        input[n] = (sample_t)core::fast_random(0, 1000) / 1000 - 0.5f;
+    }
+
+    ChannelMapper mapper(in_chans, out_chans, mixing);
+
+    while (state.KeepRunning()) {
+        Frame in_frame(input, NumSamples * in_ch);
+        Frame out_frame(output, NumSamples * out_ch);
+
+        mapper.map(in_frame, out_frame);
+        benchmark::DoNotOptimize(output[0]);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * NumSamples);
+}
+
+void mapper_args(benchmark::internal::Benchmark* b) {
+    b->ArgPair(0x1, 0x3);   // mono to stereo
+    b->ArgPair(0x3, 0x1);   // stereo to mono
+    b->ArgPair(0x3, 0x3);   // copy
+    b->ArgPair(0x3F, 0x3);  // 5.1 to stereo
+    b->ArgPair(0x3, 0x3F);  // stereo to 5.1
+    b->ArgPair(0x3F, 0x37); // 5.1 to 5.0
+    b->ArgPair(0xFF, 0x3F); // 7.1 to 5.1
+}
+
+void BM_ChannelMapper_None(benchmark::State& state) {
+    run_mapper(state, ChannelMixing_None);
+}
+
+BENCHMARK(BM_ChannelMapper_None)->Apply(mapper_args)->Unit(benchmark::kMicrosecond);
+
+void BM_ChannelMapper_Itu(benchmark::State& state) {
+    run_mapper(state, ChannelMixing_Itu);
+}
+
+BENCHMARK(BM_ChannelMapper_Itu)->Apply(mapper_args)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_audio/mixer.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_allocator.h"
+
+// Mixer throughput, in output samples (all channels) per second.
+//
+// Argument is the number of inputs. Total number of samples read from
+// inputs is the number of output samples multiplied by number of inputs.
+
+namespace roc {
+namespace audio {
+namespace {
+
+enum {
+    SampleRate = 44100,
+    ChMask = 0x3,
+    NumCh = 2,
+    FrameSize = 441 * NumCh,
+    MaxBufSize = 8192,
+    MaxInputs = 256
+};
+
+const SampleSpec sample_spec(SampleRate, ChMask);
+
+core::HeapAllocator allocator;
+core::BufferFactory<sample_t> buffer_factory(allocator, MaxBufSize, false);
+
+class NoiseReader : public IFrameReader {
+public:
+    NoiseReader() {
+        for (size_t n = 0; n < FrameSize; n++) {
+            samples_[n] = (sample_t)core::fast_random(0, 1000) / 1000 - 0.5f;
+        }
+    }
+
+    virtual bool read(Frame& frame) {
+        memcpy(frame.samples(), samples_, frame.num_samples() * sizeof(sample_t));
+        frame.set_flags(Frame::FlagNonblank);
+        return true;
+    }
+
+private:
+    sample_t samples_[FrameSize];
+};
+
+struct NoiseInput {
+    NoiseReader reader;
+    MixerInput input;
+
+    NoiseInput()
+        : input(reader, MixerInputConfig()) {
+    }
+};
+
+NoiseInput inputs[MaxInputs];
+
+void BM_Mixer_Read(benchmark::State& state) {
+    const size_t n_inputs = (size_t)state.range(0);
+
+    Mixer mixer(buffer_factory, sample_spec.samples_overall_2_ns(FrameSize),
+                sample_spec);
+
+    if (!mixer.valid()) {
+        state.SkipWithError("can't create mixer");
+        return;
+    }
+
+    for (size_t n = 0; n < n_inputs; n++) {
+        mixer.add_input(inputs[n].input);
+    }
+
+    sample_t samples[FrameSize];
+
+    while (state.KeepRunning()) {
+        Frame frame(samples, FrameSize);
+        mixer.read(frame);
+        benchmark::DoNotOptimize(samples[0]);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * FrameSize);
+
+    for (size_t n = 0; n < n_inputs; n++) {
+        mixer.remove_input(inputs[n].input);
+    }
+}
+
+BENCHMARK(BM_Mixer_Read)
+    ->RangeMultiplier(4)
+    ->Range(1, MaxInputs)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_audio/depacketizer.h"
+#include "roc_audio/pcm_decoder.h"
+#include "roc_audio/pcm_encoder.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/panic.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_packet/sorted_queue.h"
+#include "roc_rtp/composer.h"
+
+// These benchmarks measure how packet layout affects receiver hot paths.
+//
+// Packets are allocated in advance, and their memory order doesn't match the
+// order in which they're processed, so that accesses to packet headers miss
+// CPU caches, like on a real receiver with thousands of packets in flight.
+//
+// To see cache misses, run benchmarks with perf counters (requires google
+// benchmark built with libpfm):
+//
+//   bench-roc_audio --benchmark_perf_counters=CYCLES,CACHE-MISSES
+
+namespace roc {
+namespace audio {
+namespace {
+
+enum {
+    MaxPackets = 16384,
+    MaxReordering = 16,
+    MaxBufSize = 1000,
+    SamplesPerPacket = 64,
+    SampleRate = 44100,
+    ChMask = 0x3,
+    NumCh = 2
+};
+
+const SampleSpec sample_spec(SampleRate, ChMask);
+const PcmFormat pcm_format(PcmEncoding_SInt16, PcmEndian_Big);
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> byte_buffer_factory(allocator, MaxBufSize, false);
+packet::PacketFactory packet_factory(allocator, false);
+
+rtp::Composer rtp_composer(NULL);
+
+packet::PacketPtr packets[MaxPackets];
+
+void shuffle(size_t* indices, size_t n_indices) {
+    for (size_t i = 0; i < n_indices; i++) {
+        indices[i] = i;
+    }
+    for (size_t i = n_indices - 1; i > 0; i--) {
+        const size_t j = core::fast_random(0, (uint32_t)i);
+        const size_t tmp = indices[i];
+        indices[i] = indices[j];
+        indices[j] = tmp;
+    }
+}
+
+// Like network reordering: every packet is moved by less than MaxReordering
+// positions from its place in stream.
+void reorder(size_t* indices, size_t n_indices) {
+    for (size_t i = 0; i < n_indices; i++) {
+        indices[i] = i;
+    }
+    for (size_t i = 0; i + MaxReordering < n_indices; i += MaxReordering) {
+        shuffle(indices + i, MaxReordering);
+        for (size_t j = 0; j < MaxReordering; j++) {
+            indices[i + j] += i;
+        }
+    }
+}
+
+// Allocate packets in memory order, and assign seqnums and timestamps in
+// shuffled order, so that n-th packet in stream is at random location.
+void prepare_packets(size_t n_packets) {
+    static size_t order[MaxPackets];
+    shuffle(order, n_packets);
+
+    PcmEncoder encoder(pcm_format, sample_spec);
+
+    sample_t samples[SamplesPerPacket * NumCh] = {};
+
+    for (size_t n = 0; n < MaxPackets; n++) {
+        packets[n] = NULL;
+    }
+
+    for (size_t n = 0; n < n_packets; n++) {
+        packet::PacketPtr pp = packet_factory.new_packet();
+        core::Slice<uint8_t> bp = byte_buffer_factory.new_buffer();
+
+        if (!pp || !bp) {
+            roc_panic("bench: can't allocate packet");
+        }
+
+        if (!rtp_composer.prepare(*pp, bp,
+                                  encoder.encoded_byte_count(SamplesPerPacket))) {
+            roc_panic("bench: can't prepare packet");
+        }
+
+        pp->set_data(bp);
+
+        pp->rtp()->seqnum = (packet::seqnum_t)order[n];
+        pp->rtp()->timestamp = (packet::timestamp_t)(order[n] * SamplesPerPacket);
+        pp->rtp()->duration = SamplesPerPacket;
+
+        encoder.begin(pp->rtp()->payload.data(), pp->rtp()->payload.size());
+        encoder.write(samples, SamplesPerPacket);
+        encoder.end();
+
+        packets[order[n]] = pp;
+    }
+}
+
+void release_packets() {
+    for (size_t n = 0; n < MaxPackets; n++) {
+        packets[n] = NULL;
+    }
+}
+
+void BM_Packet_SortedQueue(benchmark::State& state) {
+    const size_t n_packets = (size_t)state.range(0);
+
+    prepare_packets(n_packets);
+
+    static size_t write_order[MaxPackets];
+    reorder(write_order, n_packets);
+
+    while (state.KeepRunning()) {
+        packet::SortedQueue queue(0);
+
+        for (size_t n = 0; n < n_packets; n++) {
+            queue.write(packets[write_order[n]]);
+        }
+
+        for (size_t n = 0; n < n_packets; n++) {
+            benchmark::DoNotOptimize(queue.read());
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n_packets));
+
+    release_packets();
+}
+
+BENCHMARK(BM_Packet_SortedQueue)
+    ->Arg(256)
+    ->Arg(MaxPackets)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_Packet_Depacketizer(benchmark::State& state) {
+    const size_t n_packets = (size_t)state.range(0);
+
+    prepare_packets(n_packets);
+
+    sample_t samples[SamplesPerPacket * NumCh];
+
+    while (state.KeepRunning()) {
+        packet::Queue queue;
+        PcmDecoder decoder(pcm_format, sample_spec);
+
+        for (size_t n = 0; n < n_packets; n++) {
+            queue.write(packets[n]);
+        }
+
+        Depacketizer depacketizer(queue, decoder, sample_spec, false);
+
+        for (size_t n = 0; n < n_packets; n++) {
+            Frame frame(samples, SamplesPerPacket * NumCh);
+            depacketizer.read(frame);
+            benchmark::DoNotOptimize(samples[0]);
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(n_packets));
+
+    release_packets();
+}
+
+BENCHMARK(BM_Packet_Depacketizer)
+    ->Arg(256)
+    ->Arg(MaxPackets)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace audio
+} // namespace roc
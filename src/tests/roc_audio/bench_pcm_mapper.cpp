@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_audio/pcm_mapper.h"
+#include "roc_core/fast_random.h"
+
+// PCM mapper throughput, in samples (all channels) per second.
+//
+// Argument is encoding, which is mapped from or to native Float32 (the format
+// used inside pipeline). Second argument, when present, is endian of that
+// encoding; Native and Big are benchmarked to cover byte swapping.
+
+namespace roc {
+namespace audio {
+namespace {
+
+enum { NumSamples = 2048, MaxBytesPerSample = 8 };
+
+float noise[NumSamples];
+uint8_t encoded[NumSamples * MaxBytesPerSample];
+uint8_t decoded[NumSamples * MaxBytesPerSample];
+
+void fill_noise() {
+    for (size_t n = 0; n < NumSamples; n++) {
+        noise[n] = (float)core::fast_random(0, 1000) / 1000 - 0.5f;
+    }
+}
+
+size_t run_map(PcmMapper& mapper,
+               const void* in,
+               size_t in_size,
+               void* out,
+               size_t out_size) {
+    size_t in_off = 0;
+    size_t out_off = 0;
+
+    return mapper.map(in, in_size, in_off, out, out_size, out_off, NumSamples);
+}
+
+void BM_PcmMapper_ToFloat(benchmark::State& state) {
+    const PcmFormat enc_fmt((PcmEncoding)state.range(0), (PcmEndian)state.range(1));
+    const PcmFormat raw_fmt(PcmEncoding_Float32, PcmEndian_Native);
+
+    fill_noise();
+
+    PcmMapper encoder(raw_fmt, enc_fmt);
+    run_map(encoder, noise, sizeof(noise), encoded, sizeof(encoded));
+
+    PcmMapper mapper(enc_fmt, raw_fmt);
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(
+            run_map(mapper, encoded, sizeof(encoded), decoded, sizeof(decoded)));
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * NumSamples);
+}
+
+void BM_PcmMapper_FromFloat(benchmark::State& state) {
+    const PcmFormat enc_fmt((PcmEncoding)state.range(0), (PcmEndian)state.range(1));
+    const PcmFormat raw_fmt(PcmEncoding_Float32, PcmEndian_Native);
+
+    fill_noise();
+
+    PcmMapper mapper(raw_fmt, enc_fmt);
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(
+            run_map(mapper, noise, sizeof(noise), encoded, sizeof(encoded)));
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * NumSamples);
+}
+
+void mapper_args(benchmark::internal::Benchmark* b) {
+    for (int enc = PcmEncoding_SInt8; enc <= PcmEncoding_Float64; enc++) {
+        b->ArgPair(enc, PcmEndian_Native);
+    }
+    b->ArgPair(PcmEncoding_SInt16, PcmEndian_Big);
+    b->ArgPair(PcmEncoding_SInt24, PcmEndian_Big);
+    b->ArgPair(PcmEncoding_SInt32, PcmEndian_Big);
+    b->ArgPair(PcmEncoding_Float32, PcmEndian_Big);
+}
+
+BENCHMARK(BM_PcmMapper_ToFloat)->Apply(mapper_args)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_PcmMapper_FromFloat)->Apply(mapper_args)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace audio
+} // namespace roc
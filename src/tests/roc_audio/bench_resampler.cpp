@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_audio/resampler_map.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+
+// Resampler throughput, in output samples (all channels) per second.
+//
+// Arguments are resampler profile and scaling factor multiplied by 10000.
+// Scaling 10000 is the common case when only clock drift is compensated,
+// 10010 is a typical drift correction, 10884 corresponds to 44100 -> 48000.
+//
+// Drift benchmarks additionally update scaling before every frame, slightly
+// moving it around base value, like latency monitor does during clock drift
+// compensation. They show the cost of frequent set_scaling() calls.
+
+namespace roc {
+namespace audio {
+namespace {
+
+enum {
+    SampleRate = 44100,
+    ChMask = 0x3,
+    NumCh = 2,
+    FrameSize = 441 * NumCh,
+    MaxBufSize = 8192,
+    ScalingDenom = 10000,
+    DriftPeriod = 100
+};
+
+// Maximum deviation of scaling in drift benchmarks.
+const float DriftAmplitude = 0.0001f;
+
+const SampleSpec sample_spec(SampleRate, ChMask);
+
+core::HeapAllocator allocator;
+core::BufferFactory<sample_t> buffer_factory(allocator, MaxBufSize, false);
+
+void fill_noise(sample_t* samples, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        samples[n] = (sample_t)core::fast_random(0, 1000) / 1000 - 0.5f;
+    }
+}
+
+bool is_supported(ResamplerBackend backend) {
+    for (size_t n = 0; n < ResamplerMap::instance().num_backends(); n++) {
+        if (ResamplerMap::instance().nth_backend(n) == backend) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void run_resampler(benchmark::State& state, ResamplerBackend backend, bool drift) {
+    if (!is_supported(backend)) {
+        state.SkipWithError("resampler backend not supported");
+        return;
+    }
+
+    const ResamplerProfile profile = (ResamplerProfile)state.range(0);
+    const float scaling = (float)state.range(1) / ScalingDenom;
+
+    core::ScopedPtr<IResampler> resampler(
+        ResamplerMap::instance().new_resampler(
+            backend, allocator, buffer_factory, profile,
+            sample_spec.samples_overall_2_ns(FrameSize), sample_spec),
+        allocator);
+
+    if (!resampler) {
+        state.SkipWithError("can't create resampler");
+        return;
+    }
+
+    if (!resampler->set_scaling(SampleRate, SampleRate, scaling)) {
+        state.SkipWithError("scaling not supported");
+        return;
+    }
+
+    sample_t input[MaxBufSize];
+    fill_noise(input, MaxBufSize);
+
+    sample_t output[FrameSize];
+
+    size_t frame_num = 0;
+
+    while (state.KeepRunning()) {
+        if (drift) {
+            // triangle wave around base scaling
+            const size_t phase = frame_num++ % DriftPeriod;
+            const size_t ramp = phase < DriftPeriod / 2 ? phase : DriftPeriod - phase;
+            const float delta =
+                DriftAmplitude * (4.0f * (float)ramp / DriftPeriod - 1.0f);
+
+            if (!resampler->set_scaling(SampleRate, SampleRate, scaling + delta)) {
+                state.SkipWithError("scaling not supported");
+                return;
+            }
+        }
+
+        size_t out_pos = 0;
+
+        while (out_pos < FrameSize) {
+            Frame out_part(output + out_pos, FrameSize - out_pos);
+
+            const size_t num_popped = resampler->pop_output(out_part);
+
+            if (num_popped < out_part.num_samples()) {
+                const core::Slice<sample_t>& buff = resampler->begin_push_input();
+                memcpy(buff.data(), input, buff.size() * sizeof(sample_t));
+                resampler->end_push_input();
+            }
+
+            out_pos += num_popped;
+        }
+
+        benchmark::DoNotOptimize(output[0]);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * FrameSize);
+}
+
+void resampler_args(benchmark::internal::Benchmark* b) {
+    const ResamplerProfile profiles[] = {
+        ResamplerProfile_Low,
+        ResamplerProfile_Medium,
+        ResamplerProfile_High,
+    };
+    const int64_t scalings[] = { 10000, 10010, 10884 };
+
+    for (size_t p = 0; p < sizeof(profiles) / sizeof(profiles[0]); p++) {
+        for (size_t s = 0; s < sizeof(scalings) / sizeof(scalings[0]); s++) {
+            b->ArgPair(profiles[p], scalings[s]);
+        }
+    }
+}
+
+void BM_Resampler_Builtin(benchmark::State& state) {
+    run_resampler(state, ResamplerBackend_Builtin, false);
+}
+
+BENCHMARK(BM_Resampler_Builtin)->Apply(resampler_args)->Unit(benchmark::kMicrosecond);
+
+void BM_ResamplerDrift_Builtin(benchmark::State& state) {
+    run_resampler(state, ResamplerBackend_Builtin, true);
+}
+
+BENCHMARK(BM_ResamplerDrift_Builtin)
+    ->Apply(resampler_args)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_Resampler_Speex(benchmark::State& state) {
+    run_resampler(state, ResamplerBackend_Speex, false);
+}
+
+BENCHMARK(BM_Resampler_Speex)->Apply(resampler_args)->Unit(benchmark::kMicrosecond);
+
+void BM_ResamplerDrift_Speex(benchmark::State& state) {
+    run_resampler(state, ResamplerBackend_Speex, true);
+}
+
+BENCHMARK(BM_ResamplerDrift_Speex)
+    ->Apply(resampler_args)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_Resampler_Cubic(benchmark::State& state) {
+    run_resampler(state, ResamplerBackend_Cubic, false);
+}
+
+BENCHMARK(BM_Resampler_Cubic)->Apply(resampler_args)->Unit(benchmark::kMicrosecond);
+
+void BM_ResamplerDrift_Cubic(benchmark::State& state) {
+    run_resampler(state, ResamplerBackend_Cubic, true);
+}
+
+BENCHMARK(BM_ResamplerDrift_Cubic)
+    ->Apply(resampler_args)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace audio
+} // namespace roc
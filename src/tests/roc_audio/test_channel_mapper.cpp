@@ -9,13 +9,14 @@
 #include <CppUTest/TestHarness.h>
 
 #include "roc_audio/channel_mapper.h"
+#include "roc_core/macro_helpers.h"
 
 namespace roc {
 namespace audio {
 
 namespace {
 
-enum { MaxSamples = 100 };
+enum { MaxSamples = 1000 };
 
 const double Epsilon = 0.000001;
 
@@ -32,11 +33,31 @@ void check(sample_t* input,
     ChannelMapper mapper(in_chans, out_chans);
     mapper.map(in_frame, out_frame);
 
-    for (size_t n = 0; n < n_samples; n++) {
+    for (size_t n = 0; n < n_samples * packet::num_channels(out_chans); n++) {
         DOUBLES_EQUAL(output[n], actual_output[n], Epsilon);
     }
 }
 
+// Straightforward per-sample mapping, used as reference.
+void map_reference(const sample_t* in,
+                   sample_t* out,
+                   size_t n_samples,
+                   packet::channel_mask_t in_chans,
+                   packet::channel_mask_t out_chans) {
+    for (size_t ns = 0; ns < n_samples; ns++) {
+        for (packet::channel_mask_t ch = 1; ch != 0; ch <<= 1) {
+            if (in_chans & ch) {
+                if (out_chans & ch) {
+                    *out++ = *in;
+                }
+                in++;
+            } else if (out_chans & ch) {
+                *out++ = 0;
+            }
+        }
+    }
+}
+
 } // namespace
 
 TEST_GROUP(channel_mapper) {};
@@ -129,5 +150,162 @@ TEST(channel_mapper, mask_overlap) {
     check(input, output, NumSamples, InChans, OutChans);
 }
 
+TEST(channel_mapper, itu_surround_to_stereo) {
+    enum { NumSamples = 5, InChans = 0x3f, OutChans = 0x3 };
+
+    // FL, FR, FC, LFE, BL, BR
+    sample_t input[NumSamples * 6];
+    for (size_t n = 0; n < NumSamples; n++) {
+        input[n * 6 + 0] = 0.1f;
+        input[n * 6 + 1] = 0.2f;
+        input[n * 6 + 2] = 0.3f;
+        input[n * 6 + 3] = 0.9f;
+        input[n * 6 + 4] = 0.4f;
+        input[n * 6 + 5] = 0.5f;
+    }
+
+    const sample_t norm = 1 + 0.7071068f * 2;
+
+    sample_t output[NumSamples * 2];
+    for (size_t n = 0; n < NumSamples; n++) {
+        output[n * 2 + 0] = (0.1f + 0.7071068f * 0.3f + 0.7071068f * 0.4f) / norm;
+        output[n * 2 + 1] = (0.2f + 0.7071068f * 0.3f + 0.7071068f * 0.5f) / norm;
+    }
+
+    Frame in_frame(input, NumSamples * 6);
+
+    sample_t actual_output[NumSamples * 2] = {};
+    Frame out_frame(actual_output, NumSamples * 2);
+
+    ChannelMapper mapper(InChans, OutChans, ChannelMixing_Itu);
+    mapper.map(in_frame, out_frame);
+
+    for (size_t n = 0; n < NumSamples * 2; n++) {
+        DOUBLES_EQUAL(output[n], actual_output[n], Epsilon);
+    }
+}
+
+TEST(channel_mapper, itu_mono_stereo) {
+    enum { NumSamples = 3 };
+
+    sample_t mono[NumSamples] = { 0.1f, 0.2f, 0.3f };
+    sample_t stereo[NumSamples * 2] = {
+        0.1f, 0.3f, //
+        0.2f, 0.4f, //
+        0.3f, 0.5f, //
+    };
+
+    { // upmix
+        sample_t actual_output[NumSamples * 2] = {};
+        Frame in_frame(mono, NumSamples);
+        Frame out_frame(actual_output, NumSamples * 2);
+
+        ChannelMapper mapper(0x1, 0x3, ChannelMixing_Itu);
+        mapper.map(in_frame, out_frame);
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            DOUBLES_EQUAL(mono[n], actual_output[n * 2], Epsilon);
+            DOUBLES_EQUAL(mono[n], actual_output[n * 2 + 1], Epsilon);
+        }
+    }
+
+    { // downmix
+        sample_t actual_output[NumSamples] = {};
+        Frame in_frame(stereo, NumSamples * 2);
+        Frame out_frame(actual_output, NumSamples);
+
+        ChannelMapper mapper(0x3, 0x1, ChannelMixing_Itu);
+        mapper.map(in_frame, out_frame);
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            DOUBLES_EQUAL((stereo[n * 2] + stereo[n * 2 + 1]) / 2, actual_output[n],
+                          Epsilon);
+        }
+    }
+}
+
+TEST(channel_mapper, custom_gains) {
+    enum { NumSamples = 7, InChans = 0x7, OutChans = 0x3 };
+
+    sample_t input[NumSamples * 3];
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(input); n++) {
+        input[n] = (sample_t)n / ROC_ARRAY_SIZE(input);
+    }
+
+    ChannelMapper mapper(InChans, OutChans);
+
+    DOUBLES_EQUAL(1, mapper.gain(ChannelPos_FrontLeft, ChannelPos_FrontLeft), Epsilon);
+    DOUBLES_EQUAL(0, mapper.gain(ChannelPos_FrontLeft, ChannelPos_FrontCenter), Epsilon);
+
+    mapper.set_gain(ChannelPos_FrontLeft, ChannelPos_FrontCenter, 0.5f);
+    mapper.set_gain(ChannelPos_FrontRight, ChannelPos_FrontCenter, 0.25f);
+    mapper.set_gain(ChannelPos_FrontRight, ChannelPos_FrontRight, 0.75f);
+
+    DOUBLES_EQUAL(1, mapper.gain(ChannelPos_FrontLeft, ChannelPos_FrontLeft), Epsilon);
+    DOUBLES_EQUAL(0.5, mapper.gain(ChannelPos_FrontLeft, ChannelPos_FrontCenter),
+                  Epsilon);
+
+    sample_t actual_output[NumSamples * 2] = {};
+    Frame in_frame(input, NumSamples * 3);
+    Frame out_frame(actual_output, NumSamples * 2);
+
+    mapper.map(in_frame, out_frame);
+
+    for (size_t n = 0; n < NumSamples; n++) {
+        DOUBLES_EQUAL(input[n * 3] + input[n * 3 + 2] * 0.5f, actual_output[n * 2],
+                      Epsilon);
+        DOUBLES_EQUAL(input[n * 3 + 1] * 0.75f + input[n * 3 + 2] * 0.25f,
+                      actual_output[n * 2 + 1], Epsilon);
+    }
+}
+
+TEST(channel_mapper, layouts) {
+    enum { NumSamples = 23 };
+
+    const packet::channel_mask_t masks[] = { 0x1, 0x2, 0x3, 0x5, 0x3f, 0xfc, 0x33 };
+
+    sample_t input[NumSamples * 32];
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(input); n++) {
+        input[n] = (sample_t)(n + 1) / ROC_ARRAY_SIZE(input);
+    }
+
+    for (size_t in_n = 0; in_n < ROC_ARRAY_SIZE(masks); in_n++) {
+        for (size_t out_n = 0; out_n < ROC_ARRAY_SIZE(masks); out_n++) {
+            sample_t output[MaxSamples] = {};
+            map_reference(input, output, NumSamples, masks[in_n], masks[out_n]);
+
+            check(input, output, NumSamples, masks[in_n], masks[out_n]);
+        }
+    }
+}
+
+TEST(channel_mapper, many_channels) {
+    enum { NumSamples = 10 };
+
+    const packet::channel_mask_t masks[] = {
+        0xffffffffffffffffull, // all 64 channels
+        0x7fffffffffffffffull, // last channel removed
+        0xffffffff0000ffffull, // gap in the middle
+        0x00000000ffffffffull, // lower half
+        0xffffffff00000000ull, // upper half
+        0x5555555555555555ull, // every other channel
+        0x3,
+    };
+
+    sample_t input[NumSamples * 64];
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(input); n++) {
+        input[n] = (sample_t)(n + 1) / ROC_ARRAY_SIZE(input);
+    }
+
+    for (size_t in_n = 0; in_n < ROC_ARRAY_SIZE(masks); in_n++) {
+        for (size_t out_n = 0; out_n < ROC_ARRAY_SIZE(masks); out_n++) {
+            sample_t output[MaxSamples] = {};
+            map_reference(input, output, NumSamples, masks[in_n], masks[out_n]);
+
+            check(input, output, NumSamples, masks[in_n], masks[out_n]);
+        }
+    }
+}
+
 } // namespace audio
 } // namespace roc
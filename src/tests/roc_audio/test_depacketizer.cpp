@@ -15,6 +15,7 @@
 #include "roc_audio/pcm_encoder.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_packet/ntp.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_packet/queue.h"
 #include "roc_rtp/composer.h"
@@ -180,6 +181,34 @@ TEST(depacketizer, multiple_packets_multiple_reads) {
     }
 }
 
+TEST(depacketizer, multiple_packets_frame_boundary) {
+    enum { NumPackets = 3 };
+
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false);
+
+    packet::PacketPtr packets[NumPackets];
+
+    for (packet::timestamp_t n = 0; n < NumPackets; n++) {
+        packets[n] = new_packet(encoder, n * SamplesPerPacket, 0.11f);
+        queue.write(packets[n]);
+    }
+
+    expect_output(dp, SamplesPerPacket * NumPackets, 0.11f);
+
+    // packets are released as soon as they're fully decoded,
+    // including the last one which ends exactly at frame boundary
+    for (size_t n = 0; n < NumPackets; n++) {
+        LONGS_EQUAL(1, packets[n]->getref());
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, queue.size());
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket * NumPackets, dp.timestamp());
+}
+
 TEST(depacketizer, timestamp_overflow) {
     PcmEncoder encoder(PcmFmt, SampleSpecs);
     PcmDecoder decoder(PcmFmt, SampleSpecs);
@@ -238,6 +267,52 @@ TEST(depacketizer, drop_late_packets_timestamp_overflow) {
     expect_output(dp, SamplesPerPacket, 0.33f);
 }
 
+TEST(depacketizer, skip_packets) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false);
+
+    queue.write(new_packet(encoder, SamplesPerPacket * 0, 0.11f));
+    queue.write(new_packet(encoder, SamplesPerPacket * 1, 0.22f));
+    queue.write(new_packet(encoder, SamplesPerPacket * 2, 0.33f));
+    queue.write(new_packet(encoder, SamplesPerPacket * 3, 0.44f));
+
+    expect_output(dp, SamplesPerPacket / 2, 0.11f);
+
+    // skip rest of first packet and whole second packet
+    dp.skip(SamplesPerPacket / 2 + SamplesPerPacket);
+
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket * 2, dp.timestamp());
+    UNSIGNED_LONGS_EQUAL(2, dp.metrics().skipped_packets);
+    UNSIGNED_LONGS_EQUAL(0, dp.metrics().late_packets);
+
+    expect_output(dp, SamplesPerPacket, 0.33f);
+    expect_output(dp, SamplesPerPacket, 0.44f);
+}
+
+TEST(depacketizer, skip_inside_packet) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false);
+
+    queue.write(new_packet(encoder, SamplesPerPacket * 0, 0.11f));
+    queue.write(new_packet(encoder, SamplesPerPacket * 1, 0.22f));
+
+    expect_output(dp, SamplesPerPacket / 4, 0.11f);
+
+    dp.skip(SamplesPerPacket / 4);
+
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket / 2, dp.timestamp());
+    UNSIGNED_LONGS_EQUAL(0, dp.metrics().skipped_packets);
+
+    expect_output(dp, SamplesPerPacket / 2, 0.11f);
+    expect_output(dp, SamplesPerPacket, 0.22f);
+}
+
 TEST(depacketizer, zeros_no_packets) {
     PcmEncoder encoder(PcmFmt, SampleSpecs);
     PcmDecoder decoder(PcmFmt, SampleSpecs);
@@ -415,8 +490,8 @@ TEST(depacketizer, frame_flags_incompltete_blank) {
         Frame::FlagIncomplete | Frame::FlagNonblank,
         Frame::FlagIncomplete | Frame::FlagNonblank,
         Frame::FlagIncomplete | Frame::FlagNonblank,
-        Frame::FlagIncomplete,
-        Frame::FlagIncomplete,
+        Frame::FlagIncomplete | Frame::FlagZeros,
+        Frame::FlagIncomplete | Frame::FlagZeros,
         Frame::FlagNonblank,
     };
 
@@ -451,11 +526,11 @@ TEST(depacketizer, frame_flags_drops) {
     };
 
     unsigned frame_flags[] = {
-        Frame::FlagNonblank,                      //
-        Frame::FlagNonblank | Frame::FlagDrops,   //
-        Frame::FlagNonblank,                      //
-        Frame::FlagIncomplete | Frame::FlagDrops, //
-        Frame::FlagNonblank,                      //
+        Frame::FlagNonblank,                                         //
+        Frame::FlagNonblank | Frame::FlagDrops,                      //
+        Frame::FlagNonblank,                                         //
+        Frame::FlagIncomplete | Frame::FlagDrops | Frame::FlagZeros, //
+        Frame::FlagNonblank,                                         //
     };
 
     for (size_t n = 0; n < ROC_ARRAY_SIZE(packets); n++) {
@@ -467,6 +542,256 @@ TEST(depacketizer, frame_flags_drops) {
     }
 }
 
+TEST(depacketizer, frame_flags_zeros_beep) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, true);
+
+    queue.write(new_packet(encoder, 0, 0.11f));
+
+    expect_flags(dp, SamplesPerPacket, Frame::FlagNonblank);
+
+    // blank frame is filled with beep instead of zeros
+    expect_flags(dp, SamplesPerPacket, Frame::FlagIncomplete);
+}
+
+TEST(depacketizer, concealment) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    LossConcealer concealer(SampleSpecs, allocator);
+    CHECK(concealer.valid());
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false, &concealer);
+
+    queue.write(new_packet(encoder, 0, 0.11f));
+    queue.write(new_packet(encoder, 2 * SamplesPerPacket, 0.33f));
+
+    expect_output(dp, SamplesPerPacket, 0.11f);
+
+    core::Slice<sample_t> buf = new_buffer(SamplesPerPacket);
+
+    Frame frame(buf.data(), buf.size());
+    CHECK(dp.read(frame));
+
+    // lost packet is filled with faded out copy of previous one
+    UNSIGNED_LONGS_EQUAL(Frame::FlagIncomplete, frame.flags());
+
+    expect_values(frame.samples(), NumCh, 0.11f);
+    expect_values(frame.samples() + SamplesSize - NumCh, NumCh, 0.00f);
+
+    for (size_t n = NumCh; n < SamplesSize; n++) {
+        CHECK(frame.samples()[n] <= frame.samples()[n - NumCh]);
+    }
+
+    Frame next_frame(buf.data(), buf.size());
+    CHECK(dp.read(next_frame));
+
+    UNSIGNED_LONGS_EQUAL(Frame::FlagNonblank, next_frame.flags());
+
+    expect_values(next_frame.samples() + SamplesSize - NumCh, NumCh, 0.33f);
+}
+
+TEST(depacketizer, concealment_beep) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    LossConcealer concealer(SampleSpecs, allocator);
+    CHECK(concealer.valid());
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, true, &concealer);
+
+    queue.write(new_packet(encoder, 0, 0.11f));
+
+    expect_output(dp, SamplesPerPacket, 0.11f);
+
+    // beep takes precedence over concealment
+    expect_flags(dp, SamplesPerPacket, Frame::FlagIncomplete);
+    CHECK(!concealer.concealing());
+}
+
+TEST(depacketizer, concealment_late_packet) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    LossConcealer concealer(SampleSpecs, allocator);
+    CHECK(concealer.valid());
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false, &concealer);
+
+    queue.write(new_packet(encoder, 0, 0.11f));
+
+    expect_output(dp, SamplesPerPacket, 0.11f);
+    expect_flags(dp, SamplesPerPacket, Frame::FlagIncomplete);
+
+    // second packet arrives after its samples were concealed
+    queue.write(new_packet(encoder, SamplesPerPacket, 0.22f));
+    queue.write(new_packet(encoder, 2 * SamplesPerPacket, 0.33f));
+
+    expect_flags(dp, SamplesPerPacket, Frame::FlagNonblank | Frame::FlagDrops);
+
+    // late packet is dropped, but is used to repair concealer history
+    UNSIGNED_LONGS_EQUAL(1, dp.metrics().late_packets);
+    UNSIGNED_LONGS_EQUAL(1, dp.metrics().salvaged_packets);
+}
+
+TEST(depacketizer, dtx_pause) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    LossConcealer concealer(SampleSpecs, allocator);
+    CHECK(concealer.valid());
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false, &concealer);
+
+    // adjacent seqnums, but timestamp jumps over two packets
+    packet::PacketPtr pp1 = new_packet(encoder, 0, 0.11f);
+    packet::PacketPtr pp2 = new_packet(encoder, 3 * SamplesPerPacket, 0.33f);
+
+    pp1->rtp()->seqnum = 10;
+    pp2->rtp()->seqnum = 11;
+
+    queue.write(pp1);
+    queue.write(pp2);
+
+    expect_output(dp, SamplesPerPacket, 0.11f);
+
+    // pause is filled with zeros and isn't reported as loss
+    core::Slice<sample_t> buf = new_buffer(SamplesPerPacket);
+
+    for (size_t n = 0; n < 2; n++) {
+        Frame frame(buf.data(), buf.size());
+        CHECK(dp.read(frame));
+
+        UNSIGNED_LONGS_EQUAL(Frame::FlagNonblank | Frame::FlagZeros, frame.flags());
+        expect_values(frame.samples(), SamplesSize, 0.0f);
+
+        CHECK(dp.in_dtx_pause() == (n == 0));
+    }
+
+    CHECK(!dp.in_dtx_pause());
+    CHECK(!concealer.concealing());
+
+    expect_flags(dp, SamplesPerPacket, Frame::FlagNonblank);
+    CHECK(!dp.in_dtx_pause());
+
+    UNSIGNED_LONGS_EQUAL(0, dp.metrics().lost_packets);
+}
+
+TEST(depacketizer, dtx_pause_after_concealment) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    LossConcealer concealer(SampleSpecs, allocator);
+    CHECK(concealer.valid());
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false, &concealer);
+
+    packet::PacketPtr pp1 = new_packet(encoder, 0, 0.11f);
+    packet::PacketPtr pp2 = new_packet(encoder, 3 * SamplesPerPacket, 0.33f);
+
+    pp1->rtp()->seqnum = 10;
+    pp2->rtp()->seqnum = 11;
+
+    queue.write(pp1);
+
+    expect_output(dp, SamplesPerPacket, 0.11f);
+
+    // packet after pause didn't arrive yet, so beginning of pause is concealed
+    expect_flags(dp, 1, Frame::FlagIncomplete);
+    CHECK(concealer.concealing());
+
+    queue.write(pp2);
+
+    core::Slice<sample_t> buf = new_buffer(SamplesPerPacket);
+
+    Frame frame(buf.data(), buf.size());
+    CHECK(dp.read(frame));
+
+    // pause is crossfaded with synthetic signal first, so it isn't zeros
+    CHECK(dp.in_dtx_pause());
+    CHECK(!concealer.concealing());
+
+    UNSIGNED_LONGS_EQUAL(Frame::FlagIncomplete, frame.flags());
+
+    CHECK(frame.samples()[0] > 0.0f);
+    expect_values(frame.samples() + SamplesSize - NumCh, NumCh, 0.0f);
+
+    // rest of pause is zeros
+    expect_flags(dp, SamplesPerPacket - 1, Frame::FlagNonblank | Frame::FlagZeros);
+    CHECK(!dp.in_dtx_pause());
+
+    UNSIGNED_LONGS_EQUAL(0, dp.metrics().lost_packets);
+}
+
+TEST(depacketizer, dtx_pause_vs_loss) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false);
+
+    // seqnums have gap, so timestamp gap is a loss
+    packet::PacketPtr pp1 = new_packet(encoder, 0, 0.11f);
+    packet::PacketPtr pp2 = new_packet(encoder, 2 * SamplesPerPacket, 0.33f);
+
+    pp1->rtp()->seqnum = 10;
+    pp2->rtp()->seqnum = 12;
+
+    queue.write(pp1);
+    queue.write(pp2);
+
+    expect_output(dp, SamplesPerPacket, 0.11f);
+    CHECK(!dp.in_dtx_pause());
+
+    expect_flags(dp, SamplesPerPacket, Frame::FlagIncomplete | Frame::FlagZeros);
+    expect_flags(dp, SamplesPerPacket, Frame::FlagNonblank);
+
+    UNSIGNED_LONGS_EQUAL(1, dp.metrics().lost_packets);
+}
+
+TEST(depacketizer, capture_timestamp) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false);
+
+    const packet::ntp_timestamp_t capture_ts = packet::nanoseconds_2_ntp(core::Second);
+
+    // 1 packet = 2 seconds
+    const packet::ntp_timestamp_t packet_len =
+        packet::nanoseconds_2_ntp(SamplesPerPacket * core::Second / SampleRate);
+
+    packet::PacketPtr pp1 = new_packet(encoder, 0, 0.11f);
+    packet::PacketPtr pp2 = new_packet(encoder, 2 * SamplesPerPacket, 0.33f);
+
+    pp1->rtp()->capture_timestamp = capture_ts;
+
+    UNSIGNED_LONGS_EQUAL(0, dp.capture_timestamp());
+
+    queue.write(pp1);
+    queue.write(pp2);
+
+    expect_output(dp, SamplesPerPacket / 2, 0.11f);
+    CHECK(packet::ntp_equal_delta(capture_ts + packet_len / 2, dp.capture_timestamp(),
+                                  packet::nanoseconds_2_ntp(core::Millisecond)));
+
+    // second packet doesn't have capture time, first one is used
+    expect_output(dp, SamplesPerPacket / 2, 0.11f);
+    expect_output(dp, SamplesPerPacket, 0.00f);
+    expect_output(dp, SamplesPerPacket / 2, 0.33f);
+    CHECK(packet::ntp_equal_delta(capture_ts + packet_len * 5 / 2, dp.capture_timestamp(),
+                                  packet::nanoseconds_2_ntp(core::Millisecond)));
+}
+
 TEST(depacketizer, timestamp) {
     enum {
         StartTimestamp = 1000,
@@ -516,5 +841,53 @@ TEST(depacketizer, timestamp) {
     }
 }
 
+TEST(depacketizer, frame_level) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, SampleSpecs, false);
+
+    queue.write(new_packet(encoder, 0, 0.4f));
+    queue.write(new_packet(encoder, SamplesPerPacket * 3, -0.2f));
+
+    // packet and loss
+    {
+        core::Slice<sample_t> buf = new_buffer(SamplesPerPacket * 2);
+        Frame frame(buf.data(), buf.size());
+        CHECK(dp.read(frame));
+
+        CHECK(frame.has_level());
+        UNSIGNED_LONGS_EQUAL(frame.num_samples(), frame.level().num_samples());
+        DOUBLES_EQUAL(0.08, (double)frame.level().mean_square(), 0.0001);
+        DOUBLES_EQUAL(0.4, (double)frame.level().peak(), 0.0001);
+
+        DOUBLES_EQUAL(0.2828, (double)dp.metrics().rms_level, 0.0001);
+        DOUBLES_EQUAL(0.4, (double)dp.metrics().peak_level, 0.0001);
+    }
+
+    // loss and packet
+    {
+        core::Slice<sample_t> buf = new_buffer(SamplesPerPacket * 2);
+        Frame frame(buf.data(), buf.size());
+        CHECK(dp.read(frame));
+
+        CHECK(frame.has_level());
+        DOUBLES_EQUAL(0.02, (double)frame.level().mean_square(), 0.0001);
+        DOUBLES_EQUAL(0.2, (double)frame.level().peak(), 0.0001);
+    }
+
+    // no packets
+    {
+        core::Slice<sample_t> buf = new_buffer(SamplesPerPacket);
+        Frame frame(buf.data(), buf.size());
+        CHECK(dp.read(frame));
+
+        CHECK(frame.has_level());
+        DOUBLES_EQUAL(0.0, (double)frame.level().rms(), 0.0001);
+        DOUBLES_EQUAL(0.0, (double)frame.level().peak(), 0.0001);
+    }
+}
+
 } // namespace audio
 } // namespace roc
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/frame.h"
+#include "roc_audio/frame_level.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+const double Epsilon = 1e-6;
+
+} // namespace
+
+TEST_GROUP(frame_level) {};
+
+TEST(frame_level, empty) {
+    FrameLevel level;
+
+    UNSIGNED_LONGS_EQUAL(0, level.num_samples());
+    DOUBLES_EQUAL(0.0, (double)level.mean_square(), Epsilon);
+    DOUBLES_EQUAL(0.0, (double)level.rms(), Epsilon);
+    DOUBLES_EQUAL(0.0, (double)level.peak(), Epsilon);
+}
+
+TEST(frame_level, samples) {
+    const sample_t samples[] = { 0.5f, -0.5f, 0.5f, -0.5f };
+
+    FrameLevel level;
+    level.add_samples(samples, 4);
+
+    UNSIGNED_LONGS_EQUAL(4, level.num_samples());
+    DOUBLES_EQUAL(0.25, (double)level.mean_square(), Epsilon);
+    DOUBLES_EQUAL(0.5, (double)level.rms(), Epsilon);
+    DOUBLES_EQUAL(0.5, (double)level.peak(), Epsilon);
+}
+
+TEST(frame_level, samples_and_zeros) {
+    const sample_t samples[] = { 0.2f, -0.8f };
+
+    FrameLevel level;
+    level.add_samples(samples, 2);
+    level.add_zeros(2);
+
+    UNSIGNED_LONGS_EQUAL(4, level.num_samples());
+    DOUBLES_EQUAL((0.04 + 0.64) / 4, (double)level.mean_square(), Epsilon);
+    DOUBLES_EQUAL(0.8, (double)level.peak(), Epsilon);
+}
+
+TEST(frame_level, combine) {
+    const sample_t samples1[] = { 0.1f, 0.1f };
+    const sample_t samples2[] = { -0.3f, 0.3f, -0.3f, 0.3f, -0.3f, 0.3f };
+
+    FrameLevel level1;
+    level1.add_samples(samples1, 2);
+
+    FrameLevel level2;
+    level2.add_samples(samples2, 6);
+
+    FrameLevel level;
+    level.add_level(level1);
+    level.add_level(level2);
+
+    UNSIGNED_LONGS_EQUAL(8, level.num_samples());
+    DOUBLES_EQUAL((0.01 * 2 + 0.09 * 6) / 8, (double)level.mean_square(), Epsilon);
+    DOUBLES_EQUAL(0.3, (double)level.peak(), Epsilon);
+}
+
+TEST(frame_level, frame) {
+    sample_t samples[] = { 0.1f, 0.2f };
+
+    Frame frame(samples, 2);
+    CHECK(!frame.has_level());
+
+    FrameLevel level;
+    level.add_samples(samples, 2);
+
+    frame.set_level(level);
+    CHECK(frame.has_level());
+    DOUBLES_EQUAL(0.2, (double)frame.level().peak(), Epsilon);
+}
+
+} // namespace audio
+} // namespace roc
@@ -57,5 +57,95 @@ TEST(freq_estimator, small_queue_size) {
     } while (fe.freq_coeff() > 0.99f);
 }
 
+TEST(freq_estimator, fast_phase_disabled) {
+    fe_config.P_fast = 0;
+
+    FreqEstimator fe(fe_config, Target);
+    CHECK(!fe.is_fast());
+
+    for (size_t n = 0; n < 1000; n++) {
+        fe.update(Target);
+    }
+
+    CHECK(!fe.is_fast());
+    DOUBLES_EQUAL(1.0, (double)fe.freq_coeff(), Epsilon);
+}
+
+TEST(freq_estimator, fast_phase_leave) {
+    FreqEstimator fe(fe_config, Target);
+    CHECK(fe.is_fast());
+
+    for (size_t n = 0; n < fe_config.stable_updates - 1; n++) {
+        fe.update(Target);
+        CHECK(fe.is_fast());
+    }
+
+    fe.update(Target);
+    CHECK(!fe.is_fast());
+
+    DOUBLES_EQUAL(1.0, (double)fe.freq_coeff(), Epsilon);
+}
+
+TEST(freq_estimator, fast_phase_reacts_faster) {
+    FreqEstimatorConfig slow_config = fe_config;
+    slow_config.P_fast = 0;
+
+    FreqEstimator fast_fe(fe_config, Target);
+    FreqEstimator slow_fe(slow_config, Target);
+
+    // latency deviates, but not enough to leave stable range
+    const packet::timestamp_t latency =
+        (packet::timestamp_t)(Target * (1 + fe_config.stable_tolerance / 2));
+
+    for (size_t n = 0; n < 100; n++) {
+        fast_fe.update(latency);
+        slow_fe.update(latency);
+    }
+
+    CHECK(fast_fe.freq_coeff() > 1.0f);
+    CHECK(fast_fe.freq_coeff() > slow_fe.freq_coeff());
+}
+
+TEST(freq_estimator, fast_phase_recovery) {
+    FreqEstimator fe(fe_config, Target);
+
+    for (size_t n = 0; n < fe_config.stable_updates; n++) {
+        fe.update(Target);
+    }
+    CHECK(!fe.is_fast());
+
+    // latency jumps beyond recovery tolerance
+    while (!fe.is_fast()) {
+        fe.update(Target * 2);
+    }
+
+    // latency returns to target
+    for (size_t n = 0; fe.is_fast(); n++) {
+        CHECK(n < fe_config.stable_updates * 10);
+        fe.update(Target);
+    }
+}
+
+TEST(freq_estimator, restore_drift) {
+    const float drift = 0.001f;
+
+    FreqEstimator fe(fe_config, Target);
+    CHECK(fe.is_fast());
+
+    fe.set_drift(drift);
+
+    DOUBLES_EQUAL((double)drift, (double)fe.drift(), Epsilon);
+    DOUBLES_EQUAL(1.0 + (double)drift, (double)fe.freq_coeff(), Epsilon);
+
+    // restored drift is kept both in fast and normal phases
+    for (size_t n = 0; n < fe_config.stable_updates * 2; n++) {
+        fe.update(Target);
+        DOUBLES_EQUAL(1.0 + (double)drift, (double)fe.freq_coeff(), Epsilon);
+    }
+
+    CHECK(!fe.is_fast());
+    DOUBLES_EQUAL((double)drift, (double)fe.drift(), Epsilon);
+}
+
 } // namespace audio
 } // namespace roc
@@ -24,10 +24,13 @@ public:
     MockReader(bool fail_on_empty = true)
         : pos_(0)
         , size_(0)
+        , n_reads_(0)
         , fail_on_empty_(fail_on_empty) {
     }
 
     virtual bool read(Frame& frame) {
+        n_reads_++;
+
         if (fail_on_empty_) {
             CHECK(pos_ + frame.num_samples() <= size_);
         } else if (pos_ + frame.num_samples() > size_) {
@@ -69,6 +72,10 @@ public:
         return size_ - pos_;
     }
 
+    size_t num_reads() const {
+        return n_reads_;
+    }
+
 private:
     enum { MaxSz = 64 * 1024 };
 
@@ -76,6 +83,7 @@ private:
     unsigned flags_[MaxSz];
     size_t pos_;
     size_t size_;
+    size_t n_reads_;
     const bool fail_on_empty_;
 };
 
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/depacketizer.h"
+#include "roc_audio/latency_monitor.h"
+#include "roc_audio/pcm_decoder.h"
+#include "roc_audio/pcm_encoder.h"
+#include "roc_audio/resampler_map.h"
+#include "roc_audio/resampler_reader.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/seqnum_queue.h"
+#include "roc_rtp/composer.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum {
+    SampleRate = 44100,
+    ChMask = 0x1,
+    SamplesPerPacket = 441,
+    LatencyPackets = 20,
+    MaxBufSize = 4000,
+    MaxQueueSize = 100
+};
+
+const SampleSpec SampleSpecs(SampleRate, ChMask);
+const PcmFormat PcmFmt(PcmEncoding_SInt16, PcmEndian_Big);
+
+const core::nanoseconds_t PacketDuration =
+    SampleSpecs.samples_per_chan_2_ns(SamplesPerPacket);
+
+core::HeapAllocator allocator;
+core::BufferFactory<sample_t> sample_buffer_factory(allocator, MaxBufSize, true);
+core::BufferFactory<uint8_t> byte_buffer_factory(allocator, MaxBufSize, true);
+packet::PacketFactory packet_factory(allocator, true);
+
+rtp::Composer rtp_composer(NULL);
+
+LatencyMonitorConfig make_config() {
+    LatencyMonitorConfig config;
+    // one estimator update per packet
+    config.fe_update_interval = PacketDuration;
+    config.min_latency = 0;
+    config.max_latency = PacketDuration * LatencyPackets * 2;
+    return config;
+}
+
+// Session pipeline part needed by latency monitor. Every step writes one packet
+// to the queue and reads one packet from depacketizer, so latency stays the same.
+class TestSession : public core::NonCopyable<> {
+public:
+    TestSession()
+        : queue_(allocator, MaxQueueSize)
+        , encoder_(PcmFmt, SampleSpecs)
+        , decoder_(PcmFmt, SampleSpecs)
+        , depacketizer_(queue_, decoder_, SampleSpecs, false)
+        , resampler_(ResamplerMap::instance().new_resampler(
+                         ResamplerBackend_Default, allocator, sample_buffer_factory,
+                         ResamplerProfile_Low, PacketDuration, SampleSpecs),
+                     allocator)
+        , resampler_reader_(depacketizer_, *resampler_, SampleSpecs, SampleSpecs)
+        , monitor_(queue_,
+                   depacketizer_,
+                   &resampler_reader_,
+                   make_config(),
+                   PacketDuration * LatencyPackets,
+                   SampleSpecs,
+                   SampleSpecs,
+                   FreqEstimatorConfig())
+        , wr_ts_(0) {
+        CHECK(resampler_reader_.valid());
+        CHECK(monitor_.valid());
+
+        write(LatencyPackets);
+    }
+
+    LatencyMonitor& monitor() {
+        return monitor_;
+    }
+
+    void write(size_t n_packets) {
+        for (size_t n = 0; n < n_packets; n++) {
+            queue_.write(new_packet_(wr_ts_));
+            wr_ts_ += SamplesPerPacket;
+        }
+    }
+
+    void step(size_t n_steps) {
+        for (size_t n = 0; n < n_steps; n++) {
+            write(1);
+
+            sample_t samples[SamplesPerPacket];
+            Frame frame(samples, SamplesPerPacket);
+            CHECK(depacketizer_.read(frame));
+
+            CHECK(monitor_.update(depacketizer_.timestamp()));
+        }
+    }
+
+private:
+    packet::PacketPtr new_packet_(packet::timestamp_t ts) {
+        packet::PacketPtr pp = packet_factory.new_packet();
+        CHECK(pp);
+
+        core::Slice<uint8_t> bp = byte_buffer_factory.new_buffer();
+        CHECK(bp);
+
+        CHECK(
+            rtp_composer.prepare(*pp, bp, encoder_.encoded_byte_count(SamplesPerPacket)));
+
+        pp->set_data(bp);
+
+        pp->rtp()->seqnum = packet::seqnum_t(ts / SamplesPerPacket);
+        pp->rtp()->timestamp = ts;
+        pp->rtp()->duration = SamplesPerPacket;
+
+        sample_t samples[SamplesPerPacket] = {};
+
+        encoder_.begin(pp->rtp()->payload.data(), pp->rtp()->payload.size());
+        UNSIGNED_LONGS_EQUAL(SamplesPerPacket, encoder_.write(samples, SamplesPerPacket));
+        encoder_.end();
+
+        CHECK(rtp_composer.compose(*pp));
+
+        return pp;
+    }
+
+    packet::SeqnumQueue queue_;
+    PcmEncoder encoder_;
+    PcmDecoder decoder_;
+    Depacketizer depacketizer_;
+    core::ScopedPtr<IResampler> resampler_;
+    ResamplerReader resampler_reader_;
+    LatencyMonitor monitor_;
+
+    packet::timestamp_t wr_ts_;
+};
+
+} // namespace
+
+TEST_GROUP(latency_monitor) {};
+
+TEST(latency_monitor, external_scaling) {
+    TestSession follower;
+
+    follower.step(10);
+    DOUBLES_EQUAL(1.0, (double)follower.monitor().metrics().scaling, 0.0001);
+
+    // leader is found
+    follower.monitor().set_external_scaling(true, 1.003f);
+    follower.step(1);
+
+    DOUBLES_EQUAL(1.003, (double)follower.monitor().metrics().scaling, 0.0001);
+    DOUBLES_EQUAL(0.003, (double)follower.monitor().state().drift, 0.0001);
+
+    // leader's scaling changes
+    follower.monitor().set_external_scaling(true, 0.998f);
+    follower.step(1);
+
+    DOUBLES_EQUAL(0.998, (double)follower.monitor().metrics().scaling, 0.0001);
+    DOUBLES_EQUAL(-0.002, (double)follower.monitor().state().drift, 0.0001);
+
+    // leader's cname disappears, latency is on target
+    follower.monitor().set_external_scaling(false, 1.0f);
+    follower.step(1);
+
+    DOUBLES_EQUAL(1.0, (double)follower.monitor().metrics().scaling, 0.0001);
+    DOUBLES_EQUAL(0.0, (double)follower.monitor().state().drift, 0.0001);
+}
+
+TEST(latency_monitor, external_scaling_restarts_estimator) {
+    enum { NumStableSteps = 300, NumFollowSteps = 50, NumCheckSteps = 2 };
+
+    TestSession follower;
+    TestSession standalone;
+
+    // both estimators leave fast phase
+    follower.step(NumStableSteps);
+    standalone.step(NumStableSteps);
+
+    // follower uses leader's scaling
+    follower.monitor().set_external_scaling(true, 1.002f);
+    follower.step(NumFollowSteps);
+    standalone.step(NumFollowSteps);
+
+    DOUBLES_EQUAL(1.002, (double)follower.monitor().metrics().scaling, 0.0001);
+    DOUBLES_EQUAL(1.0, (double)standalone.monitor().metrics().scaling, 0.0001);
+
+    // leader's cname disappears
+    follower.monitor().set_external_scaling(false, 1.0f);
+
+    // latency grows by 10% of target, below recovery tolerance, so only
+    // restarted estimator is in fast phase and reacts right away
+    follower.write(LatencyPackets / 10);
+    standalone.write(LatencyPackets / 10);
+
+    follower.step(NumCheckSteps);
+    standalone.step(NumCheckSteps);
+
+    const float follower_scaling = follower.monitor().metrics().scaling;
+    const float standalone_scaling = standalone.monitor().metrics().scaling;
+
+    CHECK(follower_scaling > 1.001f);
+    CHECK(follower_scaling - 1.0f > (standalone_scaling - 1.0f) * 10);
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/loss_concealer.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum {
+    SampleRate = 8000,
+    ChMask = 0x3,
+    NumCh = 2,
+
+    // 200 Hz tone
+    Period = 40,
+
+    // 10 ms of full volume and 60 ms of fade out
+    HoldSamples = 80,
+    FadeSamples = 480,
+
+    // 2.5 ms
+    CrossfadeSamples = 20,
+
+    MaxSamples = 1000
+};
+
+const SampleSpec sample_spec(SampleRate, ChMask);
+
+core::HeapAllocator allocator;
+
+// channels have different amplitudes
+sample_t tone(size_t pos, size_t chan) {
+    return sample_t(0.5 / (chan + 1) * std::sin(2 * M_PI * pos / Period));
+}
+
+void generate(sample_t* samples, size_t pos, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        for (size_t c = 0; c < NumCh; c++) {
+            samples[n * NumCh + c] = tone(pos + n, c);
+        }
+    }
+}
+
+} // namespace
+
+TEST_GROUP(loss_concealer) {
+    sample_t samples[MaxSamples * NumCh];
+};
+
+TEST(loss_concealer, no_history) {
+    LossConcealer concealer(sample_spec, allocator);
+    CHECK(concealer.valid());
+
+    generate(samples, 0, MaxSamples);
+
+    concealer.conceal(samples, 100);
+
+    for (size_t n = 0; n < 100 * NumCh; n++) {
+        DOUBLES_EQUAL(0.0, (double)samples[n], 0.0);
+    }
+
+    CHECK(!concealer.concealing());
+}
+
+TEST(loss_concealer, continue_tone) {
+    LossConcealer concealer(sample_spec, allocator);
+    CHECK(concealer.valid());
+
+    const size_t n_history = 400;
+
+    generate(samples, 0, n_history);
+    concealer.process(samples, n_history);
+
+    concealer.conceal(samples, HoldSamples);
+    CHECK(concealer.concealing());
+
+    for (size_t n = 0; n < HoldSamples; n++) {
+        for (size_t c = 0; c < NumCh; c++) {
+            DOUBLES_EQUAL((double)tone(n_history + n, c), (double)samples[n * NumCh + c],
+                          0.01);
+        }
+    }
+}
+
+TEST(loss_concealer, fade_out) {
+    LossConcealer concealer(sample_spec, allocator);
+    CHECK(concealer.valid());
+
+    const size_t n_history = 400;
+
+    generate(samples, 0, n_history);
+    concealer.process(samples, n_history);
+
+    concealer.conceal(samples, MaxSamples);
+
+    sample_t prev_peak = 1;
+
+    // every next period is quieter than the previous one
+    for (size_t p = HoldSamples / Period; p < FadeSamples / Period; p++) {
+        sample_t peak = 0;
+        for (size_t n = p * Period * NumCh; n < (p + 1) * Period * NumCh; n++) {
+            peak = std::max(peak, (sample_t)std::fabs(samples[n]));
+        }
+        CHECK(peak < prev_peak);
+        prev_peak = peak;
+    }
+
+    for (size_t n = FadeSamples * NumCh; n < MaxSamples * NumCh; n++) {
+        DOUBLES_EQUAL(0.0, (double)samples[n], 0.0);
+    }
+}
+
+TEST(loss_concealer, repair) {
+    LossConcealer concealer(sample_spec, allocator);
+    CHECK(concealer.valid());
+
+    const size_t n_history = concealer.history_length();
+    const size_t n_delay = 50;
+
+    for (size_t n = 0; n < MaxSamples * NumCh; n++) {
+        samples[n] = 0;
+    }
+    concealer.process(samples, n_history);
+
+    // late samples replace silence in history, except those which are older
+    // than history
+    generate(samples, 0, n_history);
+    concealer.repair(samples, n_history, n_delay);
+
+    generate(samples, n_history, n_delay);
+    concealer.repair(samples, n_delay, 0);
+
+    concealer.conceal(samples, HoldSamples);
+    CHECK(concealer.concealing());
+
+    // concealment continues the repaired signal
+    for (size_t n = 0; n < HoldSamples; n++) {
+        for (size_t c = 0; c < NumCh; c++) {
+            DOUBLES_EQUAL((double)tone(n_history + n_delay + n, c),
+                          (double)samples[n * NumCh + c], 0.01);
+        }
+    }
+}
+
+TEST(loss_concealer, crossfade) {
+    LossConcealer concealer(sample_spec, allocator);
+    CHECK(concealer.valid());
+
+    const size_t n_history = 400;
+    const size_t n_lost = 100;
+
+    generate(samples, 0, n_history);
+    concealer.process(samples, n_history);
+
+    concealer.conceal(samples, n_lost);
+
+    for (size_t n = 0; n < MaxSamples * NumCh; n++) {
+        samples[n] = 0.25f;
+    }
+
+    // crossfade may span several calls
+    concealer.process(samples, CrossfadeSamples / 2);
+    concealer.process(samples + CrossfadeSamples / 2 * NumCh, 100);
+    CHECK(!concealer.concealing());
+
+    for (size_t n = 0; n < CrossfadeSamples; n++) {
+        const double synth = 0.5
+            * std::sin(2 * M_PI * (n_history + n_lost + n) / Period)
+            * (1 - double(n_lost + n - HoldSamples) / (FadeSamples - HoldSamples));
+        const double w = double(n + 1) / (CrossfadeSamples + 1);
+
+        DOUBLES_EQUAL(0.25 * w + synth * (1 - w), (double)samples[n * NumCh], 0.01);
+    }
+
+    for (size_t n = CrossfadeSamples * NumCh; n < 100 * NumCh; n++) {
+        DOUBLES_EQUAL(0.25, (double)samples[n], 0.0);
+    }
+}
+
+} // namespace audio
+} // namespace roc
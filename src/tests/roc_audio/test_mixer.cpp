@@ -13,6 +13,7 @@
 #include "roc_audio/mixer.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/optional.h"
 #include "roc_core/stddefs.h"
 
 namespace roc {
@@ -64,10 +65,12 @@ TEST(mixer, no_readers) {
 TEST(mixer, one_reader) {
     test::MockReader reader;
 
+    MixerInput input(reader, MixerInputConfig());
+
     Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
     CHECK(mixer.valid());
 
-    mixer.add_input(reader);
+    mixer.add_input(input);
 
     reader.add(BufSz, 0.11f);
     expect_output(mixer, BufSz, 0.11f);
@@ -78,10 +81,12 @@ TEST(mixer, one_reader) {
 TEST(mixer, one_reader_large) {
     test::MockReader reader;
 
+    MixerInput input(reader, MixerInputConfig());
+
     Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
     CHECK(mixer.valid());
 
-    mixer.add_input(reader);
+    mixer.add_input(input);
 
     reader.add(MaxBufSz * 2, 0.11f);
     expect_output(mixer, MaxBufSz * 2, 0.11f);
@@ -89,15 +94,45 @@ TEST(mixer, one_reader_large) {
     CHECK(reader.num_unread() == 0);
 }
 
+TEST(mixer, two_readers_short_frame_length) {
+    test::MockReader reader1;
+    test::MockReader reader2;
+
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+
+    // frame length is much smaller than buffer size, but mixer should
+    // still mix whole buffer in one pass
+    Mixer mixer(buffer_factory, MaxBufDuration / 10, SampleSpecs);
+    CHECK(mixer.valid());
+
+    mixer.add_input(input1);
+    mixer.add_input(input2);
+
+    reader1.add(MaxBufSz, 0.11f);
+    reader2.add(MaxBufSz, 0.22f);
+
+    expect_output(mixer, MaxBufSz, 0.33f);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+
+    UNSIGNED_LONGS_EQUAL(1, reader1.num_reads());
+    UNSIGNED_LONGS_EQUAL(1, reader2.num_reads());
+}
+
 TEST(mixer, two_readers) {
     test::MockReader reader1;
     test::MockReader reader2;
 
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+
     Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
     CHECK(mixer.valid());
 
-    mixer.add_input(reader1);
-    mixer.add_input(reader2);
+    mixer.add_input(input1);
+    mixer.add_input(input2);
 
     reader1.add(BufSz, 0.11f);
     reader2.add(BufSz, 0.22f);
@@ -112,23 +147,26 @@ TEST(mixer, remove_reader) {
     test::MockReader reader1;
     test::MockReader reader2;
 
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+
     Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
     CHECK(mixer.valid());
 
-    mixer.add_input(reader1);
-    mixer.add_input(reader2);
+    mixer.add_input(input1);
+    mixer.add_input(input2);
 
     reader1.add(BufSz, 0.11f);
     reader2.add(BufSz, 0.22f);
     expect_output(mixer, BufSz, 0.33f);
 
-    mixer.remove_input(reader2);
+    mixer.remove_input(input2);
 
     reader1.add(BufSz, 0.44f);
     reader2.add(BufSz, 0.55f);
     expect_output(mixer, BufSz, 0.44f);
 
-    mixer.remove_input(reader1);
+    mixer.remove_input(input1);
 
     reader1.add(BufSz, 0.77f);
     reader2.add(BufSz, 0.88f);
@@ -142,11 +180,14 @@ TEST(mixer, clamp) {
     test::MockReader reader1;
     test::MockReader reader2;
 
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+
     Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
     CHECK(mixer.valid());
 
-    mixer.add_input(reader1);
-    mixer.add_input(reader2);
+    mixer.add_input(input1);
+    mixer.add_input(input2);
 
     reader1.add(BufSz, 0.900f);
     reader2.add(BufSz, 0.101f);
@@ -167,17 +208,141 @@ TEST(mixer, clamp) {
     CHECK(reader2.num_unread() == 0);
 }
 
+TEST(mixer, clamp_after_all_inputs) {
+    test::MockReader reader1;
+    test::MockReader reader2;
+    test::MockReader reader3;
+
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+    MixerInput input3(reader3, MixerInputConfig());
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(mixer.valid());
+
+    mixer.add_input(input1);
+    mixer.add_input(input2);
+    mixer.add_input(input3);
+
+    reader1.add(BufSz, 0.9f);
+    reader2.add(BufSz, 0.9f);
+    reader3.add(BufSz, -0.9f);
+
+    expect_output(mixer, BufSz, 0.9f);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+    CHECK(reader3.num_unread() == 0);
+}
+
+TEST(mixer, clamp_one_reader) {
+    test::MockReader reader1;
+    test::MockReader reader2;
+
+    MixerInputConfig config2;
+    config2.gain = 0.5f;
+
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, config2);
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(mixer.valid());
+
+    // unity gain
+    mixer.add_input(input1);
+
+    reader1.add(BufSz, 1.5f);
+    expect_output(mixer, BufSz, 1.0f);
+
+    reader1.add(BufSz, -1.5f);
+    expect_output(mixer, BufSz, -1.0f);
+
+    mixer.remove_input(input1);
+
+    // non-unity gain
+    mixer.add_input(input2);
+
+    reader2.add(BufSz, 4.0f);
+    expect_output(mixer, BufSz, 1.0f);
+
+    reader2.add(BufSz, -4.0f);
+    expect_output(mixer, BufSz, -1.0f);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+}
+
+TEST(mixer, many_readers) {
+    enum { NumReaders = 11, OddBufSz = 37 };
+
+    test::MockReader readers[NumReaders];
+    core::Optional<MixerInput> inputs[NumReaders];
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(mixer.valid());
+
+    for (size_t i = 0; i < NumReaders; i++) {
+        inputs[i].reset(new (inputs[i]) MixerInput(readers[i], MixerInputConfig()));
+        mixer.add_input(*inputs[i]);
+    }
+
+    for (size_t i = 0; i < NumReaders; i++) {
+        readers[i].add(OddBufSz, 0.01f);
+        readers[i].add(MaxBufSz * 2, 0.02f);
+    }
+
+    expect_output(mixer, OddBufSz, 0.01f * NumReaders);
+    expect_output(mixer, MaxBufSz * 2, 0.02f * NumReaders);
+
+    for (size_t i = 0; i < NumReaders; i++) {
+        CHECK(readers[i].num_unread() == 0);
+    }
+}
+
+TEST(mixer, first_reader_fails) {
+    test::MockReader reader1(false);
+    test::MockReader reader2(false);
+    test::MockReader reader3(false);
+
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+    MixerInput input3(reader3, MixerInputConfig());
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(mixer.valid());
+
+    mixer.add_input(input1);
+    mixer.add_input(input2);
+    mixer.add_input(input3);
+
+    reader2.add(BufSz, 0.22f);
+    reader3.add(BufSz, 0.33f);
+    expect_output(mixer, BufSz, 0.55f);
+
+    reader3.add(BufSz, 0.33f);
+    expect_output(mixer, BufSz, 0.33f);
+
+    expect_output(mixer, BufSz, 0.0f);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+    CHECK(reader3.num_unread() == 0);
+}
+
 TEST(mixer, flags) {
     enum { BigBatch = MaxBufSz * 2 };
 
     test::MockReader reader1;
     test::MockReader reader2;
 
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+
     Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
     CHECK(mixer.valid());
 
-    mixer.add_input(reader1);
-    mixer.add_input(reader2);
+    mixer.add_input(input1);
+    mixer.add_input(input2);
 
     reader1.add(BigBatch, 0.1f, 0);
     reader1.add(BigBatch, 0.1f, Frame::FlagNonblank);
@@ -196,5 +361,287 @@ TEST(mixer, flags) {
     CHECK(reader2.num_unread() == 0);
 }
 
+TEST(mixer, zero_inputs) {
+    test::MockReader reader1;
+    test::MockReader reader2;
+    test::MockReader reader3;
+
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+    MixerInput input3(reader3, MixerInputConfig());
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(mixer.valid());
+
+    mixer.add_input(input1);
+    mixer.add_input(input2);
+    mixer.add_input(input3);
+
+    // all inputs are zero
+    reader1.add(BufSz, 0.0f, Frame::FlagZeros);
+    reader2.add(BufSz, 0.0f, Frame::FlagZeros);
+    reader3.add(BufSz, 0.0f, Frame::FlagZeros);
+
+    expect_output(mixer, BufSz, 0.0f, Frame::FlagZeros);
+
+    // inputs with FlagZeros are skipped, so their samples are not added
+    // (non-zero values are used here only to check that they're skipped)
+    reader1.add(BufSz, 0.5f, Frame::FlagZeros);
+    reader2.add(BufSz, 0.2f, Frame::FlagNonblank);
+    reader3.add(BufSz, 0.5f, Frame::FlagZeros);
+
+    expect_output(mixer, BufSz, 0.2f, Frame::FlagNonblank);
+
+    reader1.add(BufSz, 0.1f, 0);
+    reader2.add(BufSz, 0.5f, Frame::FlagZeros);
+    reader3.add(BufSz, 0.3f, 0);
+
+    expect_output(mixer, BufSz, 0.4f, 0);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+    CHECK(reader3.num_unread() == 0);
+}
+
+TEST(mixer, gain) {
+    test::MockReader reader1;
+    test::MockReader reader2;
+
+    MixerInputConfig config1;
+    config1.gain = 0.5f;
+
+    MixerInputConfig config2;
+    config2.gain = 2.0f;
+
+    MixerInput input1(reader1, config1);
+    MixerInput input2(reader2, config2);
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(mixer.valid());
+
+    mixer.add_input(input1);
+
+    // single input is scaled too
+    reader1.add(BufSz, 0.4f);
+    expect_output(mixer, BufSz, 0.2f);
+
+    mixer.add_input(input2);
+
+    reader1.add(BufSz, 0.4f);
+    reader2.add(BufSz, 0.1f);
+    expect_output(mixer, BufSz, 0.4f);
+
+    // boosted input is clamped
+    reader1.add(BufSz, 0.0f, Frame::FlagZeros);
+    reader2.add(BufSz, 0.8f);
+    expect_output(mixer, BufSz, SampleMax);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+}
+
+TEST(mixer, ducking) {
+    test::MockReader reader1;
+    test::MockReader reader2;
+
+    MixerInputConfig config1;
+    config1.duck_gain = 0.25f;
+
+    MixerInputConfig config2;
+    config2.priority = 1;
+
+    MixerInput input1(reader1, config1);
+    MixerInput input2(reader2, config2);
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(mixer.valid());
+
+    mixer.add_input(input1);
+    mixer.add_input(input2);
+
+    for (size_t n = 0; n < 3; n++) {
+        reader1.add(BufSz, 0.4f);
+        reader2.add(BufSz, 0.2f);
+    }
+    for (size_t n = 0; n < 3; n++) {
+        reader1.add(BufSz, 0.4f);
+        reader2.add(BufSz, 0.0f, Frame::FlagZeros);
+    }
+
+    // ducking is decided by previous block
+    expect_output(mixer, BufSz, 0.6f);
+
+    // input1 is ramped down
+    {
+        core::Slice<sample_t> buf = new_buffer(BufSz);
+        Frame frame(buf.data(), buf.size());
+        CHECK(mixer.read(frame));
+
+        CHECK(frame.samples()[0] < 0.6f);
+        DOUBLES_EQUAL(0.3, (double)frame.samples()[BufSz - 1], 0.0001);
+
+        for (size_t n = 1; n < BufSz; n++) {
+            CHECK(frame.samples()[n] < frame.samples()[n - 1]);
+        }
+    }
+
+    expect_output(mixer, BufSz, 0.3f);
+
+    // input2 became silent, input1 is still ducked during this block
+    expect_output(mixer, BufSz, 0.1f);
+
+    // input1 is ramped up
+    {
+        core::Slice<sample_t> buf = new_buffer(BufSz);
+        Frame frame(buf.data(), buf.size());
+        CHECK(mixer.read(frame));
+
+        DOUBLES_EQUAL(0.4, (double)frame.samples()[BufSz - 1], 0.0001);
+
+        for (size_t n = 1; n < BufSz; n++) {
+            CHECK(frame.samples()[n] > frame.samples()[n - 1]);
+        }
+    }
+
+    expect_output(mixer, BufSz, 0.4f);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+}
+
+TEST(mixer, max_active_inputs) {
+    enum { NumInputs = 4, MaxActive = 2, NumBlocks = 20 };
+
+    test::MockReader readers[NumInputs];
+    sample_t values[NumInputs] = { 0.01f, 0.02f, 0.03f, 0.04f };
+
+    core::Optional<MixerInput> inputs[NumInputs];
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs, MaxActive);
+    CHECK(mixer.valid());
+
+    for (size_t i = 0; i < NumInputs; i++) {
+        inputs[i].reset(new (inputs[i]) MixerInput(readers[i], MixerInputConfig()));
+        mixer.add_input(*inputs[i]);
+    }
+
+    // first added inputs are mixed until loudness is known
+    for (size_t i = 0; i < NumInputs; i++) {
+        readers[i].add(BufSz, values[i]);
+    }
+    expect_output(mixer, BufSz, 0.03f);
+
+    // two loudest inputs are ramped in, others are ramped out
+    for (size_t n = 0; n < NumBlocks; n++) {
+        for (size_t i = 0; i < NumInputs; i++) {
+            readers[i].add(BufSz, values[i]);
+        }
+        core::Slice<sample_t> buf = new_buffer(BufSz);
+        Frame frame(buf.data(), buf.size());
+        CHECK(mixer.read(frame));
+    }
+    for (size_t i = 0; i < NumInputs; i++) {
+        readers[i].add(BufSz, values[i]);
+    }
+    expect_output(mixer, BufSz, 0.07f);
+
+    // first input becomes the loudest speaker
+    values[0] = 0.2f;
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        for (size_t i = 0; i < NumInputs; i++) {
+            readers[i].add(BufSz, values[i]);
+        }
+        core::Slice<sample_t> buf = new_buffer(BufSz);
+        Frame frame(buf.data(), buf.size());
+        CHECK(mixer.read(frame));
+    }
+    for (size_t i = 0; i < NumInputs; i++) {
+        readers[i].add(BufSz, values[i]);
+    }
+    expect_output(mixer, BufSz, 0.24f);
+
+    // all inputs are still read
+    for (size_t i = 0; i < NumInputs; i++) {
+        CHECK(readers[i].num_unread() == 0);
+    }
+}
+
+TEST(mixer, max_active_inputs_silent) {
+    test::MockReader reader1;
+    test::MockReader reader2;
+
+    MixerInput input1(reader1, MixerInputConfig());
+    MixerInput input2(reader2, MixerInputConfig());
+
+    Mixer mixer(buffer_factory, MaxBufDuration, SampleSpecs, 1);
+    CHECK(mixer.valid());
+
+    mixer.add_input(input1);
+    mixer.add_input(input2);
+
+    for (size_t n = 0; n < 10; n++) {
+        reader1.add(BufSz, 0.0f, Frame::FlagZeros);
+        reader2.add(BufSz, 0.3f);
+    }
+
+    // first input is selected and silent, second is muted
+    expect_output(mixer, BufSz, 0.0f, Frame::FlagZeros);
+
+    // second input is ramped in
+    {
+        core::Slice<sample_t> buf = new_buffer(BufSz);
+        Frame frame(buf.data(), buf.size());
+        CHECK(mixer.read(frame));
+        DOUBLES_EQUAL(0.3, (double)frame.samples()[BufSz - 1], 0.0001);
+    }
+
+    expect_output(mixer, BufSz, 0.3f);
+}
+
+TEST(mixer, tree) {
+    enum { NumInputs = 4 };
+
+    test::MockReader readers[NumInputs];
+
+    Mixer top_mixer(buffer_factory, MaxBufDuration, SampleSpecs);
+    Mixer sub_mixer1(buffer_factory, MaxBufDuration, SampleSpecs);
+    Mixer sub_mixer2(buffer_factory, MaxBufDuration, SampleSpecs);
+    CHECK(top_mixer.valid());
+    CHECK(sub_mixer1.valid());
+    CHECK(sub_mixer2.valid());
+
+    core::Optional<MixerInput> inputs[NumInputs];
+    for (size_t i = 0; i < NumInputs; i++) {
+        inputs[i].reset(new (inputs[i]) MixerInput(readers[i], MixerInputConfig()));
+        (i < NumInputs / 2 ? sub_mixer1 : sub_mixer2).add_input(*inputs[i]);
+    }
+
+    // sub-mixers produce partial sums, which are mixed by top mixer
+    MixerInput sub_input1(sub_mixer1, MixerInputConfig());
+    MixerInput sub_input2(sub_mixer2, MixerInputConfig());
+
+    top_mixer.add_input(sub_input1);
+    top_mixer.add_input(sub_input2);
+
+    for (size_t i = 0; i < NumInputs; i++) {
+        readers[i].add(BufSz, sample_t(i + 1) * 0.1f);
+    }
+    expect_output(top_mixer, BufSz, 1.0f);
+
+    for (size_t i = 0; i < NumInputs; i++) {
+        readers[i].add(BufSz, 0.0f, Frame::FlagZeros);
+    }
+    expect_output(top_mixer, BufSz, 0.0f, Frame::FlagZeros);
+
+    for (size_t i = 0; i < NumInputs; i++) {
+        CHECK(readers[i].num_unread() == 0);
+        (i < NumInputs / 2 ? sub_mixer1 : sub_mixer2).remove_input(*inputs[i]);
+    }
+
+    top_mixer.remove_input(sub_input1);
+    top_mixer.remove_input(sub_input2);
+}
+
 } // namespace audio
 } // namespace roc
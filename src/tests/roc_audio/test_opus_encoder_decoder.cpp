@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#ifdef ROC_TARGET_OPUS
+
+#include "roc_audio/opus_decoder.h"
+#include "roc_audio/opus_encoder.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum {
+    SampleRate = 48000,
+    NumCh = 2,
+    ChMask = 0x3,
+    SamplesPerFrame = 480, // 10 ms
+    NumFrames = 40,
+    MaxBufSize = 2000
+};
+
+const size_t Bitrate = 96000;
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> byte_buffer_factory(allocator, MaxBufSize, true);
+
+core::Slice<uint8_t> frames[NumFrames];
+
+void fill_samples(sample_t* samples, size_t pos, size_t n_samples) {
+    for (size_t i = 0; i < n_samples; i++) {
+        const sample_t s =
+            (sample_t)std::sin(2 * M_PI * 440 * double(pos + i) / SampleRate) / 2;
+        for (size_t j = 0; j < NumCh; j++) {
+            *samples++ = s;
+        }
+    }
+}
+
+double rms(const sample_t* samples, size_t n_samples) {
+    double sum = 0;
+    for (size_t i = 0; i < n_samples * NumCh; i++) {
+        sum += double(samples[i]) * double(samples[i]);
+    }
+    return std::sqrt(sum / double(n_samples * NumCh));
+}
+
+void encode_frames() {
+    OpusEncoder encoder(SampleSpec(SampleRate, ChMask), Bitrate);
+    CHECK(encoder.valid());
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        frames[n] = byte_buffer_factory.new_buffer();
+        CHECK(frames[n]);
+
+        frames[n].reslice(0, encoder.encoded_byte_count(SamplesPerFrame));
+
+        sample_t samples[SamplesPerFrame * NumCh];
+        fill_samples(samples, n * SamplesPerFrame, SamplesPerFrame);
+
+        encoder.begin(frames[n].data(), frames[n].size());
+        UNSIGNED_LONGS_EQUAL(SamplesPerFrame, encoder.write(samples, SamplesPerFrame));
+        encoder.end();
+    }
+}
+
+} // namespace
+
+TEST_GROUP(opus_encoder_decoder) {
+    void setup() {
+        encode_frames();
+    }
+
+    void teardown() {
+        for (size_t n = 0; n < NumFrames; n++) {
+            frames[n] = core::Slice<uint8_t>();
+        }
+    }
+};
+
+TEST(opus_encoder_decoder, encoded_byte_count) {
+    OpusEncoder encoder(SampleSpec(SampleRate, ChMask), Bitrate);
+    CHECK(encoder.valid());
+
+    // 10 ms at 96 kbit/s
+    UNSIGNED_LONGS_EQUAL(120, encoder.encoded_byte_count(480));
+
+    // rounded up to 20 ms
+    UNSIGNED_LONGS_EQUAL(240, encoder.encoded_byte_count(500));
+
+    // no frame
+    UNSIGNED_LONGS_EQUAL(0, encoder.encoded_byte_count(0));
+
+    // longer than 60 ms
+    UNSIGNED_LONGS_EQUAL(0, encoder.encoded_byte_count(2881));
+}
+
+TEST(opus_encoder_decoder, encode_decode) {
+    OpusDecoder decoder(SampleSpec(SampleRate, ChMask));
+    CHECK(decoder.valid());
+
+    packet::timestamp_t ts = 100500;
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        UNSIGNED_LONGS_EQUAL(
+            SamplesPerFrame,
+            decoder.decoded_sample_count(frames[n].data(), frames[n].size()));
+
+        decoder.begin(ts, frames[n].data(), frames[n].size());
+
+        UNSIGNED_LONGS_EQUAL(ts, decoder.position());
+        UNSIGNED_LONGS_EQUAL(SamplesPerFrame, decoder.available());
+
+        sample_t samples[SamplesPerFrame * NumCh];
+        UNSIGNED_LONGS_EQUAL(SamplesPerFrame, decoder.read(samples, SamplesPerFrame));
+
+        UNSIGNED_LONGS_EQUAL(ts + SamplesPerFrame, decoder.position());
+        UNSIGNED_LONGS_EQUAL(0, decoder.available());
+
+        decoder.end();
+
+        // codec is lossy and has algorithmic delay, so compare only loudness
+        if (n > 2) {
+            sample_t expected[SamplesPerFrame * NumCh];
+            fill_samples(expected, n * SamplesPerFrame, SamplesPerFrame);
+
+            DOUBLES_EQUAL(rms(expected, SamplesPerFrame), rms(samples, SamplesPerFrame),
+                          0.05);
+        }
+
+        ts += SamplesPerFrame;
+    }
+}
+
+TEST(opus_encoder_decoder, shift) {
+    enum { Shift = 100 };
+
+    OpusDecoder decoder(SampleSpec(SampleRate, ChMask));
+    CHECK(decoder.valid());
+
+    decoder.begin(0, frames[0].data(), frames[0].size());
+
+    UNSIGNED_LONGS_EQUAL(Shift, decoder.shift(Shift));
+
+    UNSIGNED_LONGS_EQUAL(Shift, decoder.position());
+    UNSIGNED_LONGS_EQUAL(SamplesPerFrame - Shift, decoder.available());
+
+    sample_t samples[SamplesPerFrame * NumCh];
+    UNSIGNED_LONGS_EQUAL(SamplesPerFrame - Shift,
+                         decoder.read(samples, SamplesPerFrame));
+
+    UNSIGNED_LONGS_EQUAL(0, decoder.shift(Shift));
+
+    decoder.end();
+}
+
+TEST(opus_encoder_decoder, conceal_lost_frames) {
+    enum { LostFrame = 20, NumLost = 2 };
+
+    OpusDecoder decoder(SampleSpec(SampleRate, ChMask));
+    CHECK(decoder.valid());
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        if (n >= LostFrame && n < LostFrame + NumLost) {
+            continue;
+        }
+
+        const packet::timestamp_t ts = packet::timestamp_t(n * SamplesPerFrame);
+
+        decoder.begin(ts, frames[n].data(), frames[n].size());
+
+        if (n == LostFrame + NumLost) {
+            // lost frames are returned before current frame
+            UNSIGNED_LONGS_EQUAL(ts - NumLost * SamplesPerFrame, decoder.position());
+            UNSIGNED_LONGS_EQUAL((NumLost + 1) * SamplesPerFrame, decoder.available());
+
+            sample_t samples[SamplesPerFrame * NumCh];
+
+            for (size_t i = 0; i < NumLost; i++) {
+                UNSIGNED_LONGS_EQUAL(SamplesPerFrame,
+                                     decoder.read(samples, SamplesPerFrame));
+                CHECK(rms(samples, SamplesPerFrame) > 0.01);
+            }
+        } else {
+            UNSIGNED_LONGS_EQUAL(ts, decoder.position());
+            UNSIGNED_LONGS_EQUAL(SamplesPerFrame, decoder.available());
+        }
+
+        decoder.end();
+    }
+}
+
+TEST(opus_encoder_decoder, long_gap_not_concealed) {
+    enum { LostFrame = 20, NumLost = 10 };
+
+    OpusDecoder decoder(SampleSpec(SampleRate, ChMask));
+    CHECK(decoder.valid());
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        if (n >= LostFrame && n < LostFrame + NumLost) {
+            continue;
+        }
+
+        const packet::timestamp_t ts = packet::timestamp_t(n * SamplesPerFrame);
+
+        decoder.begin(ts, frames[n].data(), frames[n].size());
+
+        UNSIGNED_LONGS_EQUAL(ts, decoder.position());
+        UNSIGNED_LONGS_EQUAL(SamplesPerFrame, decoder.available());
+
+        decoder.end();
+    }
+}
+
+TEST(opus_encoder_decoder, incomplete_frame) {
+    enum { NumSamples = 300 };
+
+    OpusEncoder encoder(SampleSpec(SampleRate, ChMask), Bitrate);
+    CHECK(encoder.valid());
+
+    OpusDecoder decoder(SampleSpec(SampleRate, ChMask));
+    CHECK(decoder.valid());
+
+    core::Slice<uint8_t> frame = byte_buffer_factory.new_buffer();
+    CHECK(frame);
+
+    frame.reslice(0, encoder.encoded_byte_count(NumSamples));
+
+    sample_t samples[SamplesPerFrame * NumCh];
+    fill_samples(samples, 0, NumSamples);
+
+    encoder.begin(frame.data(), frame.size());
+    UNSIGNED_LONGS_EQUAL(NumSamples, encoder.write(samples, NumSamples));
+    encoder.end();
+
+    // padded to 10 ms
+    UNSIGNED_LONGS_EQUAL(SamplesPerFrame,
+                         decoder.decoded_sample_count(frame.data(), frame.size()));
+}
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_TARGET_OPUS
@@ -15,6 +15,7 @@
 #include "roc_audio/pcm_encoder.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_packet/ntp.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_packet/queue.h"
 #include "roc_rtp/composer.h"
@@ -28,6 +29,7 @@ const double Epsilon = 0.00001;
 
 enum {
     SamplesPerPacket = 200,
+    MaxSamplesPerPacket = SamplesPerPacket * 2,
     SampleRate = 1000,
 
     MaxPackets = 100,
@@ -92,9 +94,10 @@ public:
         payload_decoder_.begin(pp->rtp()->timestamp, pp->rtp()->payload.data(),
                                pp->rtp()->payload.size());
 
-        sample_t samples[SamplesPerPacket * NumCh] = {};
+        sample_t samples[MaxSamplesPerPacket * NumCh] = {};
 
-        UNSIGNED_LONGS_EQUAL(n_samples, payload_decoder_.read(samples, SamplesPerPacket));
+        UNSIGNED_LONGS_EQUAL(n_samples,
+                             payload_decoder_.read(samples, MaxSamplesPerPacket));
 
         payload_decoder_.end();
 
@@ -165,7 +168,8 @@ TEST(packetizer, one_buffer_one_packet) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
-                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType);
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
 
     FrameMaker frame_maker;
     PacketChecker packet_checker(decoder);
@@ -190,7 +194,8 @@ TEST(packetizer, one_buffer_multiple_packets) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
-                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType);
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
 
     FrameMaker frame_maker;
     PacketChecker packet_checker(decoder);
@@ -215,7 +220,8 @@ TEST(packetizer, multiple_buffers_one_packet) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
-                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType);
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
 
     FrameMaker frame_maker;
     PacketChecker packet_checker(decoder);
@@ -246,7 +252,8 @@ TEST(packetizer, multiple_buffers_multiple_packets) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
-                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType);
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
 
     FrameMaker frame_maker;
     PacketChecker packet_checker(decoder);
@@ -271,7 +278,8 @@ TEST(packetizer, flush) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
-                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType);
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
 
     FrameMaker frame_maker;
     PacketChecker packet_checker(decoder);
@@ -294,5 +302,332 @@ TEST(packetizer, flush) {
     }
 }
 
+TEST(packetizer, change_packet_length) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+    PcmDecoder decoder(PcmFmt, SampleSpecs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
+
+    FrameMaker frame_maker;
+    PacketChecker packet_checker(decoder);
+
+    // half of packet is written before the change, so this packet is
+    // completed with old length
+    frame_maker.write(packetizer, SamplesPerPacket / 2);
+
+    CHECK(packetizer.set_packet_length(PacketDuration / 2));
+    CHECK(packetizer.packet_length() == PacketDuration / 2);
+
+    frame_maker.write(packetizer, SamplesPerPacket / 2 + SamplesPerPacket);
+
+    UNSIGNED_LONGS_EQUAL(3, packet_queue.size());
+
+    packet_checker.read(packet_queue, SamplesPerPacket);
+    packet_checker.read(packet_queue, SamplesPerPacket / 2);
+    packet_checker.read(packet_queue, SamplesPerPacket / 2);
+
+    // aggregate samples into longer packets
+    CHECK(packetizer.set_packet_length(PacketDuration * 2));
+
+    frame_maker.write(packetizer, SamplesPerPacket * 3);
+
+    UNSIGNED_LONGS_EQUAL(1, packet_queue.size());
+
+    packet_checker.read(packet_queue, SamplesPerPacket * 2);
+
+    // incomplete packet is padded to its own length
+    packetizer.flush();
+
+    packet::PacketPtr pp = packet_queue.read();
+    CHECK(pp);
+
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket, pp->rtp()->duration);
+    UNSIGNED_LONGS_EQUAL(encoder.encoded_byte_count(SamplesPerPacket * 2),
+                         pp->rtp()->payload.size() + pp->rtp()->padding.size());
+}
+
+TEST(packetizer, bad_packet_length) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
+
+    CHECK(!packetizer.is_packet_length_supported(0));
+    CHECK(!packetizer.set_packet_length(0));
+    CHECK(!packetizer.set_packet_length(-1));
+
+    CHECK(packetizer.packet_length() == PacketDuration);
+}
+
+TEST(packetizer, fit_packet_length) {
+    enum { HeaderSize = 12, BytesPerSample = NumCh * 2 };
+
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
+
+    const core::nanoseconds_t max_length = PacketDuration * 2;
+
+    // limited by packet size
+    CHECK(packetizer.fit_packet_length(HeaderSize + BytesPerSample * 150, max_length)
+          == SampleSpecs.samples_per_chan_2_ns(150));
+    CHECK(packetizer.fit_packet_length(HeaderSize + BytesPerSample * 150 + 3, max_length)
+          == SampleSpecs.samples_per_chan_2_ns(150));
+
+    // limited by max length
+    CHECK(packetizer.fit_packet_length(MaxBufSize, max_length) == max_length);
+    CHECK(packetizer.fit_packet_length(MaxBufSize * 10, max_length) == max_length);
+
+    // limited by buffer size
+    CHECK(packetizer.fit_packet_length(MaxBufSize * 10, PacketDuration * 100)
+          == SampleSpecs.samples_per_chan_2_ns((MaxBufSize - HeaderSize)
+                                               / BytesPerSample));
+
+    // nothing fits
+    CHECK(packetizer.fit_packet_length(HeaderSize, max_length) == 0);
+    CHECK(packetizer.fit_packet_length(HeaderSize + BytesPerSample - 1, max_length)
+          == 0);
+    CHECK(packetizer.fit_packet_length(MaxBufSize, 0) == 0);
+
+    // fitted length can be applied
+    CHECK(packetizer.set_packet_length(
+        packetizer.fit_packet_length(HeaderSize + BytesPerSample * 150, max_length)));
+    CHECK(packetizer.packet_length() == SampleSpecs.samples_per_chan_2_ns(150));
+}
+
+TEST(packetizer, zeros) {
+    enum { Pos = SamplesPerPacket / 2 };
+
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
+
+    sample_t samples[SamplesPerPacket * NumCh] = {};
+
+    // silent packet
+    {
+        Frame frame(samples, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+    }
+
+    // packet with one non-zero sample
+    samples[Pos * NumCh] = 0.5f;
+    {
+        Frame frame(samples, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+    }
+    samples[Pos * NumCh] = 0;
+
+    // silent packet from two frames, one of which is known to be zero
+    {
+        Frame frame(samples, Pos * NumCh);
+        frame.set_flags(Frame::FlagZeros);
+        packetizer.write(frame);
+    }
+    {
+        Frame frame(samples, (SamplesPerPacket - Pos) * NumCh);
+        packetizer.write(frame);
+    }
+
+    // padded silent packet
+    {
+        Frame frame(samples, Pos * NumCh);
+        packetizer.write(frame);
+        packetizer.flush();
+    }
+
+    UNSIGNED_LONGS_EQUAL(4, packet_queue.size());
+
+    const bool expected[] = { true, false, true, true };
+
+    for (size_t n = 0; n < 4; n++) {
+        packet::PacketPtr pp = packet_queue.read();
+        CHECK(pp);
+        CHECK(pp->flags() & packet::Packet::FlagAudio);
+        CHECK(bool(pp->flags() & packet::Packet::FlagZeros) == expected[n]);
+    }
+}
+
+TEST(packetizer, dtx) {
+    enum {
+        HangoverPackets = 3,
+        KeepalivePackets = 4,
+        SilentPackets = 20,
+        LoudPackets = 2
+    };
+
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+
+    packet::Queue packet_queue;
+
+    DtxConfig dtx_config;
+    dtx_config.enabled = true;
+    dtx_config.threshold = 0.01f;
+    dtx_config.hangover = PacketDuration * HangoverPackets;
+    dtx_config.keepalive_interval = PacketDuration * KeepalivePackets;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          dtx_config);
+
+    sample_t loud[SamplesPerPacket * NumCh] = {};
+    sample_t quiet[SamplesPerPacket * NumCh] = {};
+
+    loud[0] = 0.5f;
+    quiet[0] = 0.005f;
+
+    for (size_t np = 0; np < LoudPackets; np++) {
+        Frame frame(loud, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+    }
+    for (size_t np = 0; np < SilentPackets; np++) {
+        Frame frame(quiet, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+    }
+    for (size_t np = 0; np < LoudPackets; np++) {
+        Frame frame(loud, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+    }
+
+    // loud packets, hangover, keepalives, loud packets
+    const size_t n_keepalive = (SilentPackets - HangoverPackets) / KeepalivePackets;
+    UNSIGNED_LONGS_EQUAL(LoudPackets * 2 + HangoverPackets + n_keepalive,
+                         packet_queue.size());
+
+    packet::PacketPtr first = packet_queue.read();
+    CHECK(first);
+    CHECK(!first->rtp()->marker);
+
+    packet::seqnum_t sn = first->rtp()->seqnum;
+    packet::timestamp_t ts = first->rtp()->timestamp;
+
+    for (size_t np = 1; np < LoudPackets + HangoverPackets; np++) {
+        packet::PacketPtr pp = packet_queue.read();
+        CHECK(pp);
+
+        sn++;
+        ts += SamplesPerPacket;
+
+        UNSIGNED_LONGS_EQUAL(sn, pp->rtp()->seqnum);
+        UNSIGNED_LONGS_EQUAL(ts, pp->rtp()->timestamp);
+        CHECK(!pp->rtp()->marker);
+    }
+
+    // keepalive packets have adjacent seqnums, but timestamps jump over pause
+    for (size_t np = 0; np < n_keepalive; np++) {
+        packet::PacketPtr pp = packet_queue.read();
+        CHECK(pp);
+
+        sn++;
+        ts += SamplesPerPacket * KeepalivePackets;
+
+        UNSIGNED_LONGS_EQUAL(sn, pp->rtp()->seqnum);
+        UNSIGNED_LONGS_EQUAL(ts, pp->rtp()->timestamp);
+        CHECK(!pp->rtp()->marker);
+    }
+
+    // first loud packet after pause has marker bit
+    for (size_t np = 0; np < LoudPackets; np++) {
+        packet::PacketPtr pp = packet_queue.read();
+        CHECK(pp);
+
+        sn++;
+
+        UNSIGNED_LONGS_EQUAL(sn, pp->rtp()->seqnum);
+        UNSIGNED_LONGS_EQUAL(first->rtp()->timestamp
+                                 + SamplesPerPacket * (LoudPackets + SilentPackets + np),
+                             pp->rtp()->timestamp);
+        CHECK(pp->rtp()->marker == (np == 0));
+    }
+
+    CHECK(!packet_queue.read());
+}
+
+TEST(packetizer, map_ntp_timestamp) {
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
+
+    packet::timestamp_t rtp_ts = 0;
+
+    // no packets yet
+    CHECK(!packetizer.map_ntp_timestamp(packet::ntp_timestamp(), rtp_ts));
+
+    FrameMaker frame_maker;
+    frame_maker.write(packetizer, SamplesPerPacket);
+
+    packet::PacketPtr pp = packet_queue.read();
+    CHECK(pp);
+
+    const packet::ntp_timestamp_t capture_ts = pp->rtp()->capture_timestamp;
+    CHECK(capture_ts != 0);
+
+    CHECK(packetizer.map_ntp_timestamp(capture_ts, rtp_ts));
+    UNSIGNED_LONGS_EQUAL(pp->rtp()->timestamp, rtp_ts);
+
+    // RTP timestamp is extrapolated in both directions
+    CHECK(packetizer.map_ntp_timestamp(
+        capture_ts + packet::nanoseconds_2_ntp(PacketDuration), rtp_ts));
+    UNSIGNED_LONGS_EQUAL(pp->rtp()->timestamp + SamplesPerPacket, rtp_ts);
+
+    CHECK(packetizer.map_ntp_timestamp(
+        capture_ts - packet::nanoseconds_2_ntp(PacketDuration), rtp_ts));
+    UNSIGNED_LONGS_EQUAL(pp->rtp()->timestamp - SamplesPerPacket, rtp_ts);
+}
+
+TEST(packetizer, capture_timestamp_large_frame) {
+    enum { NumPackets = 5 };
+
+    PcmEncoder encoder(PcmFmt, SampleSpecs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_factory,
+                          byte_buffer_factory, PacketDuration, SampleSpecs, PayloadType,
+                          DtxConfig());
+
+    FrameMaker frame_maker;
+    frame_maker.write(packetizer, SamplesPerPacket * NumPackets);
+
+    packet::PacketPtr first = packet_queue.read();
+    CHECK(first);
+    CHECK(first->rtp()->capture_timestamp != 0);
+
+    // packets of one frame get capture time of their first sample
+    for (size_t np = 1; np < NumPackets; np++) {
+        packet::PacketPtr pp = packet_queue.read();
+        CHECK(pp);
+
+        const core::nanoseconds_t delta = packet::ntp_2_nanoseconds(
+            pp->rtp()->capture_timestamp - first->rtp()->capture_timestamp);
+
+        const core::nanoseconds_t expected = PacketDuration * (core::nanoseconds_t)np;
+
+        CHECK(delta >= expected - core::Microsecond);
+        CHECK(delta <= expected + core::Microsecond);
+    }
+
+    CHECK(!packet_queue.read());
+}
+
 } // namespace audio
 } // namespace roc
@@ -100,6 +100,58 @@ void compare(const double* expected, const double* actual, size_t n_items) {
     }
 }
 
+// Map samples using byte-aligned offsets and unaligned offsets and
+// check that both paths produce identical results.
+void check_aligned_unaligned(const uint8_t* input,
+                             size_t n_samples,
+                             const PcmFormat& in_fmt,
+                             const PcmFormat& out_fmt) {
+    enum { MaxBytes = 1024, Shift = 3 };
+
+    PcmMapper mapper(in_fmt, out_fmt);
+    PcmMapper in_shifter(in_fmt, in_fmt);
+    PcmMapper out_shifter(out_fmt, out_fmt);
+
+    const size_t in_bytes = mapper.input_byte_count(n_samples);
+    const size_t out_bytes = mapper.output_byte_count(n_samples);
+
+    CHECK(in_bytes + 1 <= MaxBytes);
+    CHECK(out_bytes + 1 <= MaxBytes);
+
+    uint8_t aligned_output[MaxBytes] = {};
+
+    size_t in_off = 0;
+    size_t out_off = 0;
+    UNSIGNED_LONGS_EQUAL(n_samples,
+                         mapper.map(input, in_bytes, in_off, aligned_output, out_bytes,
+                                    out_off, n_samples));
+
+    uint8_t shifted_input[MaxBytes] = {};
+    uint8_t shifted_output[MaxBytes] = {};
+    uint8_t unaligned_output[MaxBytes] = {};
+
+    in_off = 0;
+    out_off = Shift;
+    UNSIGNED_LONGS_EQUAL(n_samples,
+                         in_shifter.map(input, in_bytes, in_off, shifted_input, MaxBytes,
+                                        out_off, n_samples));
+
+    in_off = Shift;
+    out_off = Shift;
+    UNSIGNED_LONGS_EQUAL(n_samples,
+                         mapper.map(shifted_input, MaxBytes, in_off, shifted_output,
+                                    MaxBytes, out_off, n_samples));
+
+    in_off = Shift;
+    out_off = 0;
+    UNSIGNED_LONGS_EQUAL(n_samples,
+                         out_shifter.map(shifted_output, MaxBytes, in_off,
+                                         unaligned_output, out_bytes, out_off,
+                                         n_samples));
+
+    compare(aligned_output, unaligned_output, out_bytes);
+}
+
 } // namespace
 
 TEST_GROUP(pcm_mapper) {};
@@ -1047,5 +1099,41 @@ TEST(pcm_mapper, le_to_be) {
     compare(expected_output, actual_output, NumOutputBytes);
 }
 
+TEST(pcm_mapper, aligned_fast_path) {
+    enum { NumSamples = 101 };
+
+    const PcmEncoding int_encodings[] = { PcmEncoding_SInt16, PcmEncoding_SInt24 };
+    const PcmEndian endians[] = { PcmEndian_Native, PcmEndian_Big, PcmEndian_Little };
+
+    uint8_t int_input[NumSamples * 4];
+    for (size_t n = 0; n < sizeof(int_input); n++) {
+        int_input[n] = uint8_t(n * 37 + 11);
+    }
+
+    float float_input[NumSamples];
+    for (size_t n = 0; n < NumSamples; n++) {
+        float_input[n] = -1.5f + 3.0f * float(n) / NumSamples;
+    }
+
+    for (size_t ie = 0; ie < ROC_ARRAY_SIZE(endians); ie++) {
+        for (size_t oe = 0; oe < ROC_ARRAY_SIZE(endians); oe++) {
+            const PcmFormat float_fmt(PcmEncoding_Float32, PcmEndian_Native);
+
+            check_aligned_unaligned((const uint8_t*)float_input, NumSamples, float_fmt,
+                                    PcmFormat(PcmEncoding_Float32, endians[oe]));
+
+            for (size_t enc = 0; enc < ROC_ARRAY_SIZE(int_encodings); enc++) {
+                const PcmFormat int_fmt(int_encodings[enc], endians[ie]);
+                const PcmFormat out_float_fmt(PcmEncoding_Float32, endians[oe]);
+
+                check_aligned_unaligned(int_input, NumSamples, int_fmt, out_float_fmt);
+                check_aligned_unaligned((const uint8_t*)float_input, NumSamples,
+                                        float_fmt,
+                                        PcmFormat(int_encodings[enc], endians[oe]));
+            }
+        }
+    }
+}
+
 } // namespace audio
 } // namespace roc
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "test_helpers/mock_reader.h"
+
+#include "roc_audio/prefetch_reader.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { BufSz = 100, SampleRate = 44100, ChannelMask = 0x1, MaxBufSz = 500 };
+
+const audio::SampleSpec SampleSpecs = audio::SampleSpec(SampleRate, ChannelMask);
+
+const core::nanoseconds_t MaxBufDuration = MaxBufSz * core::Second
+    / core::nanoseconds_t(SampleSpecs.sample_rate() * SampleSpecs.num_channels());
+
+core::HeapAllocator allocator;
+core::BufferFactory<sample_t> buffer_factory(allocator, MaxBufSz, true);
+
+void expect_output(IFrameReader& reader, size_t sz, sample_t value, unsigned flags = 0) {
+    sample_t samples[MaxBufSz * 2] = {};
+
+    Frame frame(samples, sz);
+    CHECK(reader.read(frame));
+
+    UNSIGNED_LONGS_EQUAL(flags, frame.flags());
+
+    for (size_t n = 0; n < sz; n++) {
+        DOUBLES_EQUAL((double)value, (double)frame.samples()[n], 0.0001);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(prefetch_reader) {};
+
+TEST(prefetch_reader, no_prefetch) {
+    test::MockReader mock_reader;
+    PrefetchReader prefetch_reader(mock_reader, buffer_factory, MaxBufDuration,
+                                   SampleSpecs);
+    CHECK(prefetch_reader.valid());
+
+    mock_reader.add(BufSz, 0.1f);
+
+    expect_output(prefetch_reader, BufSz, 0.1f);
+    UNSIGNED_LONGS_EQUAL(0, mock_reader.num_unread());
+}
+
+TEST(prefetch_reader, prefetch) {
+    test::MockReader mock_reader;
+    PrefetchReader prefetch_reader(mock_reader, buffer_factory, MaxBufDuration,
+                                   SampleSpecs);
+    CHECK(prefetch_reader.valid());
+
+    mock_reader.add(BufSz, 0.1f, Frame::FlagNonblank);
+    mock_reader.add(BufSz, 0.2f, Frame::FlagIncomplete);
+
+    prefetch_reader.prefetch(BufSz);
+    UNSIGNED_LONGS_EQUAL(BufSz, mock_reader.num_unread());
+
+    expect_output(prefetch_reader, BufSz, 0.1f, Frame::FlagNonblank);
+    UNSIGNED_LONGS_EQUAL(BufSz, mock_reader.num_unread());
+
+    prefetch_reader.prefetch(BufSz);
+    UNSIGNED_LONGS_EQUAL(0, mock_reader.num_unread());
+
+    expect_output(prefetch_reader, BufSz, 0.2f, Frame::FlagIncomplete);
+}
+
+TEST(prefetch_reader, prefetch_max_size) {
+    test::MockReader mock_reader;
+    PrefetchReader prefetch_reader(mock_reader, buffer_factory, MaxBufDuration,
+                                   SampleSpecs);
+    CHECK(prefetch_reader.valid());
+
+    UNSIGNED_LONGS_EQUAL(MaxBufSz, prefetch_reader.max_prefetch());
+
+    mock_reader.add(MaxBufSz * 2, 0.1f);
+
+    prefetch_reader.prefetch(MaxBufSz * 2);
+    UNSIGNED_LONGS_EQUAL(MaxBufSz, mock_reader.num_unread());
+
+    // rest is read from nested reader
+    expect_output(prefetch_reader, MaxBufSz * 2, 0.1f);
+    UNSIGNED_LONGS_EQUAL(0, mock_reader.num_unread());
+}
+
+TEST(prefetch_reader, partial_read) {
+    test::MockReader mock_reader;
+    PrefetchReader prefetch_reader(mock_reader, buffer_factory, MaxBufDuration,
+                                   SampleSpecs);
+    CHECK(prefetch_reader.valid());
+
+    mock_reader.add(BufSz, 0.1f, Frame::FlagZeros);
+    mock_reader.add(BufSz, 0.2f, Frame::FlagNonblank);
+
+    prefetch_reader.prefetch(BufSz);
+
+    expect_output(prefetch_reader, BufSz / 2, 0.1f, Frame::FlagZeros);
+    expect_output(prefetch_reader, BufSz / 2, 0.1f, Frame::FlagZeros);
+
+    prefetch_reader.prefetch(BufSz / 2);
+
+    // prefetched half and half from nested reader
+    expect_output(prefetch_reader, BufSz, 0.2f, Frame::FlagNonblank);
+    UNSIGNED_LONGS_EQUAL(0, mock_reader.num_unread());
+}
+
+TEST(prefetch_reader, partial_read_zeros) {
+    test::MockReader mock_reader;
+    PrefetchReader prefetch_reader(mock_reader, buffer_factory, MaxBufDuration,
+                                   SampleSpecs);
+    CHECK(prefetch_reader.valid());
+
+    mock_reader.add(BufSz / 2, 0.0f, Frame::FlagZeros);
+    mock_reader.add(BufSz / 2, 0.0f, Frame::FlagZeros | Frame::FlagDrops);
+
+    prefetch_reader.prefetch(BufSz / 2);
+
+    expect_output(prefetch_reader, BufSz, 0.0f, Frame::FlagZeros | Frame::FlagDrops);
+}
+
+TEST(prefetch_reader, prefetch_failed) {
+    test::MockReader mock_reader(false);
+    PrefetchReader prefetch_reader(mock_reader, buffer_factory, MaxBufDuration,
+                                   SampleSpecs);
+    CHECK(prefetch_reader.valid());
+
+    mock_reader.add(BufSz / 2, 0.1f);
+
+    prefetch_reader.prefetch(BufSz);
+
+    sample_t samples[BufSz] = {};
+    Frame frame(samples, BufSz);
+    CHECK(!prefetch_reader.read(frame));
+}
+
+} // namespace audio
+} // namespace roc
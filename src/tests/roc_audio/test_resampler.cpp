@@ -11,6 +11,7 @@
 #include "test_helpers/mock_reader.h"
 #include "test_helpers/mock_writer.h"
 
+#include "roc_audio/channel_mapper_reader.h"
 #include "roc_audio/iresampler.h"
 #include "roc_audio/resampler_map.h"
 #include "roc_audio/resampler_reader.h"
@@ -411,5 +412,335 @@ TEST(resampler, upscale_downscale_stereo) {
     }
 }
 
+TEST(resampler, multichannel_matches_mono) {
+    enum {
+        SampleRate = 44100,
+        MaxCh = 6,
+        NumPad = 2 * OutFrameSize,
+        NumSamples = 20 * OutFrameSize
+    };
+    const audio::SampleSpec MonoSpec = SampleSpec(SampleRate, 0x1);
+    const packet::channel_mask_t ChMasks[] = { 0x3, 0x3f };
+
+    const float Scaling = 0.97f;
+    const float Threshold = 0.0001f;
+
+    for (size_t n_mask = 0; n_mask < ROC_ARRAY_SIZE(ChMasks); n_mask++) {
+        const audio::SampleSpec MultiSpec = SampleSpec(SampleRate, ChMasks[n_mask]);
+        const size_t num_ch = MultiSpec.num_channels();
+
+        for (size_t n_meth = 0; n_meth < ROC_ARRAY_SIZE(resampler_methods); n_meth++) {
+            ResamplerMethod method = resampler_methods[n_meth];
+
+            sample_t input_ch[MaxCh][NumSamples];
+            sample_t input[NumSamples * MaxCh];
+
+            for (size_t ch = 0; ch < num_ch; ch++) {
+                generate_sine(input_ch[ch], NumSamples, NumPad + ch * 10);
+                for (size_t n = 0; n < NumSamples; n++) {
+                    input_ch[ch][n] *= float(ch + 1) / num_ch;
+                    input[n * num_ch + ch] = input_ch[ch][n];
+                }
+            }
+
+            sample_t output[NumSamples * MaxCh] = {};
+            resample(ResamplerBackend_Builtin, method, input, output,
+                     NumSamples * num_ch, MultiSpec, Scaling);
+
+            for (size_t ch = 0; ch < num_ch; ch++) {
+                sample_t expected_ch[NumSamples] = {};
+                resample(ResamplerBackend_Builtin, method, input_ch[ch], expected_ch,
+                         NumSamples, MonoSpec, Scaling);
+
+                sample_t output_ch[NumSamples] = {};
+                extract_channel(output_ch, output, (int)num_ch, (int)ch, NumSamples);
+
+                if (!compare(expected_ch, output_ch, NumSamples, Threshold)) {
+                    // for plot_resampler_test_dump.py
+                    dump(expected_ch, output_ch, NumSamples);
+
+                    roc_panic("multichannel output differs from mono output:"
+                              " num_ch=%d method=%d channel=%d",
+                              (int)num_ch, (int)method, (int)ch);
+                }
+            }
+        }
+    }
+}
+
+TEST(resampler, cubic_unity_scaling) {
+    enum {
+        SampleRate = 44100,
+        ChMask = 0x3,
+        NumPad = 2 * OutFrameSize,
+        NumTruncate = 8 * OutFrameSize,
+        NumSamples = 20 * OutFrameSize
+    };
+    const audio::SampleSpec SampleSpecs = SampleSpec(SampleRate, ChMask);
+
+    const float Threshold = 0.00001f;
+
+    for (size_t n_meth = 0; n_meth < ROC_ARRAY_SIZE(resampler_methods); n_meth++) {
+        ResamplerMethod method = resampler_methods[n_meth];
+
+        sample_t input[NumSamples];
+        generate_sine(input, NumSamples, NumPad);
+
+        sample_t output[NumSamples] = {};
+        resample(ResamplerBackend_Cubic, method, input, output, NumSamples, SampleSpecs,
+                 1.0f);
+
+        trim_leading_zeros(input, NumSamples, 0.1f);
+        trim_leading_zeros(output, NumSamples, 0.1f);
+
+        truncate(input, NumSamples, NumTruncate);
+        truncate(output, NumSamples, NumTruncate);
+
+        if (!compare(input, output, NumSamples, Threshold)) {
+            // for plot_resampler_test_dump.py
+            dump(input, output, NumSamples);
+
+            roc_panic("cubic resampler changed signal with unity scaling: method=%d",
+                      (int)method);
+        }
+    }
+}
+
+TEST(resampler, builtin_switch_profile) {
+    enum {
+        SampleRate = 44100,
+        ChMask = 0x1,
+        NumPad = 2 * OutFrameSize,
+        NumFrames = 40,
+        NumSamples = NumFrames * OutFrameSize
+    };
+    const audio::SampleSpec SampleSpecs = SampleSpec(SampleRate, ChMask);
+
+    const core::nanoseconds_t frame_duration =
+        SampleSpecs.samples_overall_2_ns(InFrameSize);
+
+    const float Scaling = 0.97f;
+    const float Threshold = 0.01f;
+
+    const ResamplerProfile profiles[] = {
+        ResamplerProfile_High,
+        ResamplerProfile_Low,
+        ResamplerProfile_Medium,
+        ResamplerProfile_High,
+    };
+
+    sample_t input[NumSamples];
+    generate_sine(input, NumSamples, NumPad);
+
+    test::MockReader ref_input, switch_input;
+    for (size_t n = 0; n < NumSamples; n++) {
+        ref_input.add(1, input[n]);
+        switch_input.add(1, input[n]);
+    }
+    ref_input.pad_zeros();
+    switch_input.pad_zeros();
+
+    core::ScopedPtr<IResampler> ref_resampler(
+        ResamplerMap::instance().new_resampler(ResamplerBackend_Builtin, allocator,
+                                               buffer_factory, ResamplerProfile_High,
+                                               frame_duration, SampleSpecs),
+        allocator);
+    CHECK(ref_resampler);
+    CHECK(ref_resampler->valid());
+
+    core::ScopedPtr<IResampler> switch_resampler(
+        ResamplerMap::instance().new_resampler(ResamplerBackend_Builtin, allocator,
+                                               buffer_factory, ResamplerProfile_High,
+                                               frame_duration, SampleSpecs),
+        allocator);
+    CHECK(switch_resampler);
+    CHECK(switch_resampler->valid());
+
+    ResamplerReader ref_reader(ref_input, *ref_resampler, SampleSpecs, SampleSpecs);
+    CHECK(ref_reader.valid());
+    CHECK(ref_reader.set_scaling(Scaling));
+
+    ResamplerReader switch_reader(switch_input, *switch_resampler, SampleSpecs,
+                                  SampleSpecs);
+    CHECK(switch_reader.valid());
+    CHECK(switch_reader.set_scaling(Scaling));
+
+    sample_t ref_output[NumSamples] = {};
+    sample_t switch_output[NumSamples] = {};
+
+    for (size_t nf = 0; nf < NumFrames; nf++) {
+        if (nf % 10 == 5) {
+            CHECK(switch_resampler->set_profile(profiles[nf / 10]));
+        }
+
+        Frame ref_frame(ref_output + nf * OutFrameSize, OutFrameSize);
+        CHECK(ref_reader.read(ref_frame));
+
+        Frame switch_frame(switch_output + nf * OutFrameSize, OutFrameSize);
+        CHECK(switch_reader.read(switch_frame));
+    }
+
+    // output stays aligned with reference and has no gaps,
+    // only filter quality differs
+    if (!compare(ref_output, switch_output, NumSamples, Threshold)) {
+        // for plot_resampler_test_dump.py
+        dump(ref_output, switch_output, NumSamples);
+
+        roc_panic("output of resampler with switched profile differs from reference");
+    }
+}
+
+TEST(resampler, reader_with_channel_mapping) {
+    enum { SampleRate = 44100, NumInput = 8000, NumOutput = 4000 };
+
+    const packet::channel_mask_t masks[][2] = {
+        { 0x1, 0x3 },  // upmix
+        { 0x3, 0x1 },  // downmix
+        { 0x3f, 0x3 }, // downmix
+    };
+
+    for (size_t n_mask = 0; n_mask < ROC_ARRAY_SIZE(masks); n_mask++) {
+        const SampleSpec in_spec(SampleRate, masks[n_mask][0]);
+        const SampleSpec out_spec(SampleRate, masks[n_mask][1]);
+        const SampleSpec mapped_spec(SampleRate, masks[n_mask][1]);
+
+        const core::nanoseconds_t frame_duration =
+            in_spec.samples_per_chan_2_ns(InFrameSize);
+
+        sample_t input[NumInput];
+        for (size_t n = 0; n < NumInput; n++) {
+            input[n] = (sample_t)std::sin(M_PI / 30 * double(n)) * 0.8f;
+        }
+
+        // separate channel mapper reader and resampler reader
+        sample_t expected[NumOutput] = {};
+        {
+            test::MockReader input_reader;
+            for (size_t n = 0; n < NumInput; n++) {
+                input_reader.add(1, input[n]);
+            }
+            input_reader.pad_zeros();
+
+            ChannelMapperReader mapper_reader(input_reader, buffer_factory,
+                                              frame_duration, in_spec, mapped_spec);
+            CHECK(mapper_reader.valid());
+
+            core::ScopedPtr<IResampler> resampler(
+                ResamplerMap::instance().new_resampler(
+                    ResamplerBackend_Builtin, allocator, buffer_factory,
+                    ResamplerProfile_High, frame_duration, mapped_spec),
+                allocator);
+            CHECK(resampler);
+
+            ResamplerReader rr(mapper_reader, *resampler, mapped_spec, out_spec);
+            CHECK(rr.valid());
+            CHECK(rr.set_scaling(0.97f));
+
+            Frame frame(expected, NumOutput);
+            CHECK(rr.read(frame));
+        }
+
+        // resampler reader with channel mapping
+        sample_t actual[NumOutput] = {};
+        {
+            test::MockReader input_reader;
+            for (size_t n = 0; n < NumInput; n++) {
+                input_reader.add(1, input[n]);
+            }
+            input_reader.pad_zeros();
+
+            const SampleSpec resampler_spec(
+                SampleRate, ResamplerReader::resampler_channels(in_spec, out_spec));
+            CHECK(resampler_spec.num_channels()
+                  == std::min(in_spec.num_channels(), out_spec.num_channels()));
+
+            core::ScopedPtr<IResampler> resampler(
+                ResamplerMap::instance().new_resampler(
+                    ResamplerBackend_Builtin, allocator, buffer_factory,
+                    ResamplerProfile_High, frame_duration, resampler_spec),
+                allocator);
+            CHECK(resampler);
+
+            ResamplerReader rr(input_reader, *resampler, buffer_factory, in_spec,
+                               out_spec, ChannelMixing_None);
+            CHECK(rr.valid());
+            CHECK(rr.set_scaling(0.97f));
+
+            Frame frame(actual, NumOutput);
+            CHECK(rr.read(frame));
+        }
+
+        if (!compare(expected, actual, NumOutput, 0.0001f)) {
+            // for plot_resampler_test_dump.py
+            dump(expected, actual, NumOutput);
+
+            roc_panic("fused channel mapping differs from separate mapping:"
+                      " in_mask=0x%x out_mask=0x%x",
+                      (unsigned)masks[n_mask][0], (unsigned)masks[n_mask][1]);
+        }
+    }
+}
+
+TEST(resampler, reader_zero_frames) {
+    enum {
+        SampleRate = 44100,
+        ChMask = 0x1,
+        NumZero = InFrameSize * 10,
+        NumSamples = InFrameSize * 20
+    };
+    const audio::SampleSpec SampleSpecs = SampleSpec(SampleRate, ChMask);
+    const core::nanoseconds_t frame_duration =
+        SampleSpecs.samples_per_chan_2_ns(InFrameSize);
+
+    for (size_t n_back = 0; n_back < ResamplerMap::instance().num_backends(); n_back++) {
+        ResamplerBackend backend = ResamplerMap::instance().nth_backend(n_back);
+
+        test::MockReader input_reader;
+        input_reader.add(NumZero, 0.0f, Frame::FlagZeros);
+        input_reader.add(NumSamples - NumZero, 0.5f, Frame::FlagNonblank);
+        input_reader.pad_zeros();
+
+        core::ScopedPtr<IResampler> resampler(
+            ResamplerMap::instance().new_resampler(backend, allocator, buffer_factory,
+                                                   ResamplerProfile_High,
+                                                   frame_duration, SampleSpecs),
+            allocator);
+        CHECK(resampler);
+
+        ResamplerReader rr(input_reader, *resampler, SampleSpecs, SampleSpecs);
+        CHECK(rr.valid());
+        CHECK(rr.set_scaling(0.99f));
+
+        bool seen_zeros = false;
+        bool seen_nonzero = false;
+
+        for (size_t pos = 0; pos < NumSamples; pos += InFrameSize / 2) {
+            sample_t samples[InFrameSize / 2];
+            Frame frame(samples, ROC_ARRAY_SIZE(samples));
+            CHECK(rr.read(frame));
+
+            bool is_zero = true;
+            for (size_t n = 0; n < ROC_ARRAY_SIZE(samples); n++) {
+                if (samples[n] > 0 || samples[n] < 0) {
+                    is_zero = false;
+                }
+            }
+
+            if (frame.flags() & Frame::FlagZeros) {
+                CHECK(is_zero);
+                CHECK(!seen_nonzero);
+                seen_zeros = true;
+            }
+
+            if (!is_zero) {
+                seen_nonzero = true;
+            }
+        }
+
+        CHECK(seen_zeros);
+        CHECK(seen_nonzero);
+    }
+}
+
 } // namespace audio
 } // namespace roc
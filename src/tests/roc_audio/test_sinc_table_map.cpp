@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/sinc_table_map.h"
+#include "roc_core/macro_helpers.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+double sinc_value(size_t index, size_t window_interp, size_t table_size) {
+    if (index == 0) {
+        return 1.0;
+    }
+    if (index >= table_size - 2) {
+        return 0.0;
+    }
+    const double t = (double)index / (double)window_interp;
+    const double window = 0.54
+        - 0.46
+            * std::cos(2 * M_PI
+                       * ((double)(index - 1) / 2.0 / (double)table_size + 0.5));
+    return std::sin(M_PI * t) / M_PI / t * window;
+}
+
+} // namespace
+
+TEST_GROUP(sinc_table_map) {};
+
+TEST(sinc_table_map, shared) {
+    const sample_t* table1 = SincTableMap::instance().get_table(16, 64);
+    const sample_t* table2 = SincTableMap::instance().get_table(16, 64);
+    const sample_t* table3 = SincTableMap::instance().get_table(32, 128);
+
+    CHECK(table1);
+    CHECK(table3);
+
+    POINTERS_EQUAL(table1, table2);
+    CHECK(table1 != table3);
+}
+
+TEST(sinc_table_map, values) {
+    enum {
+        WindowSize = 16,
+        WindowInterp = 64,
+        TableSize = WindowSize * WindowInterp + 2
+    };
+
+    const sample_t* table = SincTableMap::instance().get_table(WindowSize, WindowInterp);
+    CHECK(table);
+
+    DOUBLES_EQUAL(1.0, (double)table[0], 1e-6);
+
+    // sinc(x) is zero at integer x
+    for (size_t n = 1; n < WindowSize; n++) {
+        DOUBLES_EQUAL(0.0, (double)table[n * WindowInterp], 1e-6);
+    }
+
+    // decays from the center
+    CHECK(table[WindowInterp / 2] < table[0]);
+    CHECK(table[WindowInterp / 2] > 0);
+
+    // zero padding
+    DOUBLES_EQUAL(0.0, (double)table[TableSize - 2], 0);
+    DOUBLES_EQUAL(0.0, (double)table[TableSize - 1], 0);
+}
+
+TEST(sinc_table_map, profiles) {
+    const size_t params[][2] = { { 16, 64 }, { 32, 128 }, { 64, 512 }, { 8, 32 } };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(params); n++) {
+        const size_t window_size = params[n][0];
+        const size_t window_interp = params[n][1];
+        const size_t table_size = window_size * window_interp + 2;
+
+        const sample_t* table =
+            SincTableMap::instance().get_table(window_size, window_interp);
+        CHECK(table);
+
+        for (size_t i = 0; i < table_size; i++) {
+            DOUBLES_EQUAL(sinc_value(i, window_interp, table_size), (double)table[i],
+                          1e-6);
+        }
+    }
+}
+
+} // namespace audio
+} // namespace roc
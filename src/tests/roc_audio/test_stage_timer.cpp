@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/stage_timer.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+// 1000 samples per second, so that N samples last N milliseconds
+const SampleSpec sample_spec(1000, 0x1);
+
+} // namespace
+
+TEST_GROUP(stage_timer) {};
+
+TEST(stage_timer, empty) {
+    StageTimer timer("test", sample_spec);
+
+    UNSIGNED_LONGS_EQUAL(0, timer.num_frames());
+    UNSIGNED_LONGS_EQUAL(0, timer.num_late_frames());
+    LONGS_EQUAL(0, timer.max_time());
+    LONGS_EQUAL(0, timer.percentile(0.5));
+    DOUBLES_EQUAL(0.0, (double)timer.load(), 1e-9);
+}
+
+TEST(stage_timer, percentiles) {
+    StageTimer timer("test", sample_spec);
+
+    // 99 frames take 10us, 1 frame takes 3ms
+    for (size_t n = 0; n < 99; n++) {
+        timer.add_frame(10, 10 * core::Microsecond);
+    }
+    timer.add_frame(10, 3 * core::Millisecond);
+
+    UNSIGNED_LONGS_EQUAL(100, timer.num_frames());
+    UNSIGNED_LONGS_EQUAL(0, timer.num_late_frames());
+    LONGS_EQUAL(3 * core::Millisecond, timer.max_time());
+
+    // 10us falls into [8us; 16us) bucket
+    LONGS_EQUAL(16 * core::Microsecond, timer.percentile(0.5));
+    LONGS_EQUAL(16 * core::Microsecond, timer.percentile(0.99));
+
+    // 3ms falls into [2048us; 4096us) bucket, limited by max
+    LONGS_EQUAL(3 * core::Millisecond, timer.percentile(1.0));
+}
+
+TEST(stage_timer, late_frames) {
+    StageTimer timer("test", sample_spec);
+
+    // 10 samples = 10ms budget
+    timer.add_frame(10, 5 * core::Millisecond);
+    timer.add_frame(10, 10 * core::Millisecond);
+    timer.add_frame(10, 11 * core::Millisecond);
+    timer.add_frame(20, 15 * core::Millisecond);
+    timer.add_frame(20, 25 * core::Millisecond);
+
+    UNSIGNED_LONGS_EQUAL(5, timer.num_frames());
+    UNSIGNED_LONGS_EQUAL(2, timer.num_late_frames());
+    LONGS_EQUAL(25 * core::Millisecond, timer.max_time());
+}
+
+TEST(stage_timer, large_durations) {
+    StageTimer timer("test", sample_spec);
+
+    timer.add_frame(10, 100 * core::Second);
+
+    UNSIGNED_LONGS_EQUAL(1, timer.num_frames());
+    UNSIGNED_LONGS_EQUAL(1, timer.num_late_frames());
+    LONGS_EQUAL(100 * core::Second, timer.percentile(0.5));
+}
+
+TEST(stage_timer, load) {
+    StageTimer timer("test", sample_spec);
+
+    // first frame sets load immediately
+    timer.add_frame(10, 2 * core::Millisecond);
+    DOUBLES_EQUAL(0.2, (double)timer.load(), 1e-6);
+
+    // then load slowly follows changes
+    timer.add_frame(10, 7 * core::Millisecond);
+    CHECK(timer.load() > 0.2f);
+    CHECK(timer.load() < 0.3f);
+
+    for (size_t n = 0; n < 2000; n++) {
+        timer.add_frame(20, 10 * core::Millisecond);
+    }
+    DOUBLES_EQUAL(0.5, (double)timer.load(), 1e-3);
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/fast_clock.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+namespace {
+
+void BM_Clock_Monotonic(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(timestamp(ClockMonotonic));
+    }
+}
+
+BENCHMARK(BM_Clock_Monotonic);
+
+void BM_Clock_Fast(benchmark::State& state) {
+    // let calibration finish before measuring
+    (void)fast_timestamp();
+    sleep_for(ClockMonotonic, 150 * Millisecond);
+
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(fast_timestamp());
+    }
+
+    state.counters["calibrated"] = fast_clock_calibrated();
+}
+
+BENCHMARK(BM_Clock_Fast);
+
+} // namespace
+} // namespace core
+} // namespace roc
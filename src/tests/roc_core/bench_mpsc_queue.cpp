@@ -8,6 +8,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/mpmc_queue.h"
 #include "roc_core/mpsc_queue.h"
 #include "roc_core/mutex.h"
 #include "roc_core/thread.h"
@@ -16,7 +19,12 @@ namespace roc {
 namespace core {
 namespace {
 
-enum { BatchSize = 10000, NumIterations = 5000000, NumThreads = 16 };
+enum {
+    BatchSize = 10000,
+    NumIterations = 5000000,
+    NumThreads = 16,
+    MpmcCapacity = 1024
+};
 
 #if defined(ROC_BENCHMARK_USE_ACCESSORS)
 inline int get_thread_index(const benchmark::State& state) {
@@ -189,6 +197,120 @@ BENCHMARK_REGISTER_F(BM_MpscQueue, PopFront)
     ->Iterations(NumIterations)
     ->Unit(benchmark::kMicrosecond);
 
+// Bounded MPMC queue, for comparison with intrusive MPSC queue above.
+// Elements are pointers, so the cost of copying is the same for both queues.
+class BM_MpmcQueue : public benchmark::Fixture {
+public:
+    BM_MpmcQueue()
+        : queue_(allocator_, MpmcCapacity)
+        , stop_(0) {
+    }
+
+    inline MpmcQueue<Object*>& get_queue() {
+        return queue_;
+    }
+
+    inline Atomic<int>& get_stop() {
+        return stop_;
+    }
+
+    virtual void SetUp(const benchmark::State&) {
+        stop_ = 0;
+    }
+
+    virtual void TearDown(const benchmark::State&) {
+        Object* obj = NULL;
+        while (queue_.try_pop(obj)) {
+        }
+    }
+
+private:
+    HeapAllocator allocator_;
+    MpmcQueue<Object*> queue_;
+    Atomic<int> stop_;
+};
+
+class MpmcPushThread : public core::Thread {
+public:
+    MpmcPushThread()
+        : bf_(NULL) {
+    }
+
+    void init(BM_MpmcQueue& bf) {
+        bf_ = &bf;
+    }
+
+private:
+    virtual void run() {
+        MpmcQueue<Object*>& queue = bf_->get_queue();
+        Object obj;
+
+        while (!bf_->get_stop()) {
+            (void)queue.try_push(&obj);
+        }
+    }
+
+    BM_MpmcQueue* bf_;
+};
+
+// Every thread both pushes and pops, all threads contend on both ends.
+BENCHMARK_DEFINE_F(BM_MpmcQueue, PushPop)(benchmark::State& state) {
+    MpmcQueue<Object*>& queue = get_queue();
+
+    Object obj;
+    Object* popped = NULL;
+
+    while (state.KeepRunningBatch(BatchSize)) {
+        for (int n = 0; n < BatchSize; n++) {
+            (void)queue.try_push(&obj);
+            (void)queue.try_pop(popped);
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(BM_MpmcQueue, PushPop)
+    ->ThreadRange(1, NumThreads)
+    ->Iterations(NumIterations)
+    ->Unit(benchmark::kMicrosecond);
+
+// Single consumer and multiple producers, same as MpscQueue TryPopFront.
+BENCHMARK_DEFINE_F(BM_MpmcQueue, TryPop)(benchmark::State& state) {
+    const int64_t num_push_threads_arg = state.range(0);
+
+    MpmcPushThread* push_threads = new MpmcPushThread[size_t(num_push_threads_arg)];
+
+    for (int n = 0; n < num_push_threads_arg; n++) {
+        push_threads[n].init(*this);
+        push_threads[n].start();
+    }
+
+    MpmcQueue<Object*>& queue = get_queue();
+    Object* popped = NULL;
+
+    while (state.KeepRunningBatch(BatchSize)) {
+        for (int n = 0; n < BatchSize; n++) {
+            (void)queue.try_pop(popped);
+        }
+    }
+
+    get_stop() = 1;
+
+    for (int n = 0; n < num_push_threads_arg; n++) {
+        push_threads[n].join();
+    }
+
+    delete[] push_threads;
+}
+
+BENCHMARK_REGISTER_F(BM_MpmcQueue, TryPop)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Iterations(NumIterations)
+    ->Unit(benchmark::kMicrosecond);
+
 } // namespace
 } // namespace core
 } // namespace roc
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/align_ops.h"
+#include "roc_core/arena_allocator.h"
+#include "roc_core/heap_allocator.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct FailingAllocator : public IAllocator {
+    virtual void* allocate(size_t) {
+        return NULL;
+    }
+
+    virtual void deallocate(void*) {
+        FAIL("unexpected deallocate");
+    }
+};
+
+} // namespace
+
+TEST_GROUP(arena_allocator) {};
+
+TEST(arena_allocator, contiguous) {
+    HeapAllocator heap_allocator;
+
+    {
+        ArenaAllocator arena(heap_allocator, 1000);
+        CHECK(arena.capacity() >= 1000);
+
+        // arena block is allocated once
+        LONGS_EQUAL(1, heap_allocator.num_allocations());
+
+        char* p1 = (char*)arena.allocate(100);
+        char* p2 = (char*)arena.allocate(50);
+        char* p3 = (char*)arena.allocate(0);
+
+        CHECK(p1);
+        CHECK(p2);
+        CHECK(p3);
+
+        CHECK(AlignOps::align_max((size_t)p1) == (size_t)p1);
+        CHECK(AlignOps::align_max((size_t)p2) == (size_t)p2);
+        CHECK(AlignOps::align_max((size_t)p3) == (size_t)p3);
+
+        POINTERS_EQUAL(p1 + AlignOps::align_max(100), p2);
+        POINTERS_EQUAL(p2 + AlignOps::align_max(50), p3);
+
+        UNSIGNED_LONGS_EQUAL(AlignOps::align_max(100) + AlignOps::align_max(50)
+                                 + AlignOps::align_max(1),
+                             arena.used_bytes());
+
+        LONGS_EQUAL(1, heap_allocator.num_allocations());
+
+        arena.deallocate(p2);
+        arena.deallocate(p1);
+
+        // memory is not reused until everything is deallocated
+        CHECK(arena.used_bytes() != 0);
+
+        arena.deallocate(p3);
+
+        UNSIGNED_LONGS_EQUAL(0, arena.used_bytes());
+        POINTERS_EQUAL(p1, arena.allocate(10));
+        arena.deallocate(p1);
+
+        UNSIGNED_LONGS_EQUAL(0, arena.num_overflows());
+    }
+
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+TEST(arena_allocator, overflow) {
+    HeapAllocator heap_allocator;
+
+    {
+        ArenaAllocator arena(heap_allocator, 100);
+
+        void* p1 = arena.allocate(arena.capacity());
+        CHECK(p1);
+        LONGS_EQUAL(1, heap_allocator.num_allocations());
+
+        // doesn't fit, forwarded to underlying allocator
+        void* p2 = arena.allocate(10);
+        CHECK(p2);
+        LONGS_EQUAL(2, heap_allocator.num_allocations());
+        UNSIGNED_LONGS_EQUAL(1, arena.num_overflows());
+
+        arena.deallocate(p2);
+        LONGS_EQUAL(1, heap_allocator.num_allocations());
+
+        arena.deallocate(p1);
+        LONGS_EQUAL(1, heap_allocator.num_allocations());
+    }
+
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+TEST(arena_allocator, disabled) {
+    HeapAllocator heap_allocator;
+
+    {
+        ArenaAllocator arena(heap_allocator, 0);
+        UNSIGNED_LONGS_EQUAL(0, arena.capacity());
+        LONGS_EQUAL(0, heap_allocator.num_allocations());
+
+        void* p = arena.allocate(100);
+        CHECK(p);
+        LONGS_EQUAL(1, heap_allocator.num_allocations());
+        UNSIGNED_LONGS_EQUAL(0, arena.num_overflows());
+
+        arena.deallocate(p);
+        LONGS_EQUAL(0, heap_allocator.num_allocations());
+    }
+}
+
+TEST(arena_allocator, failed) {
+    FailingAllocator failing_allocator;
+
+    ArenaAllocator arena(failing_allocator, 100);
+    UNSIGNED_LONGS_EQUAL(0, arena.capacity());
+
+    POINTERS_EQUAL(NULL, arena.allocate(10));
+}
+
+} // namespace core
+} // namespace roc
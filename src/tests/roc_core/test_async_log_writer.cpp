@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/async_log_writer.h"
+#include "roc_core/log.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { NumThreads = 4, NumRecords = 100, RingSize = 128 };
+
+struct Collector {
+    Collector()
+        : n_records(0)
+        , n_drop_reports(0) {
+        for (size_t n = 0; n < NumThreads; n++) {
+            per_thread[n] = 0;
+        }
+    }
+
+    size_t n_records;
+    size_t n_drop_reports;
+    size_t per_thread[NumThreads];
+    int last[NumThreads];
+};
+
+void collect(const AsyncLogRecord& record, void* arg) {
+    Collector& collector = *(Collector*)arg;
+
+    if (strstr(record.text, "dropped")) {
+        collector.n_drop_reports++;
+        return;
+    }
+
+    const size_t thread = (size_t)record.line;
+    CHECK(thread < NumThreads);
+
+    int seq = -1;
+    CHECK(sscanf(record.text, "message %d", &seq) == 1);
+
+    // records from one thread are handled in order
+    if (collector.per_thread[thread] != 0) {
+        CHECK(seq == collector.last[thread] + 1);
+    }
+
+    collector.last[thread] = seq;
+    collector.per_thread[thread]++;
+    collector.n_records++;
+}
+
+AsyncLogRecord make_record(size_t thread, int seq) {
+    AsyncLogRecord record;
+    memset(&record, 0, sizeof(record));
+
+    record.level = LogInfo;
+    record.module = "test";
+    record.file = __FILE__;
+    record.line = (int)thread;
+    snprintf(record.text, sizeof(record.text), "message %d", seq);
+
+    return record;
+}
+
+class Producer : public Thread {
+public:
+    Producer(AsyncLogWriter& writer, size_t index)
+        : writer_(writer)
+        , index_(index) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < NumRecords; n++) {
+            CHECK(writer_.push(make_record(index_, (int)n)));
+            if (n % 10 == 0) {
+                sleep_for(ClockMonotonic, Millisecond);
+            }
+        }
+    }
+
+    AsyncLogWriter& writer_;
+    const size_t index_;
+};
+
+void log_capture(const LogMessage& msg, void** args) {
+    size_t& counter = *(size_t*)args[0];
+
+    if (strcmp(msg.text, "async logger test") == 0) {
+        counter++;
+    }
+}
+
+} // namespace
+
+TEST_GROUP(async_log_writer) {};
+
+TEST(async_log_writer, single_thread) {
+    Collector collector;
+
+    {
+        AsyncLogWriter writer(&collect, &collector);
+        CHECK(writer.start_writer());
+
+        for (size_t n = 0; n < NumRecords; n++) {
+            CHECK(writer.push(make_record(0, (int)n)));
+        }
+
+        writer.stop_writer();
+
+        UNSIGNED_LONGS_EQUAL(0, writer.num_drops());
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumRecords, collector.n_records);
+    UNSIGNED_LONGS_EQUAL(0, collector.n_drop_reports);
+}
+
+TEST(async_log_writer, multiple_threads) {
+    Collector collector;
+
+    {
+        AsyncLogWriter writer(&collect, &collector);
+        CHECK(writer.start_writer());
+
+        Producer* producers[NumThreads];
+        for (size_t n = 0; n < NumThreads; n++) {
+            producers[n] = new Producer(writer, n);
+            CHECK(producers[n]->start());
+        }
+
+        for (size_t n = 0; n < NumThreads; n++) {
+            producers[n]->join();
+            delete producers[n];
+        }
+
+        writer.stop_writer();
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumThreads * NumRecords, collector.n_records);
+    for (size_t n = 0; n < NumThreads; n++) {
+        UNSIGNED_LONGS_EQUAL(NumRecords, collector.per_thread[n]);
+    }
+}
+
+TEST(async_log_writer, overflow) {
+    Collector collector;
+
+    {
+        AsyncLogWriter writer(&collect, &collector);
+
+        // background thread is not started yet, so nothing is drained
+        for (size_t n = 0; n < RingSize + 10; n++) {
+            CHECK(writer.push(make_record(0, (int)n)));
+        }
+
+        CHECK(writer.start_writer());
+        writer.stop_writer();
+
+        UNSIGNED_LONGS_EQUAL(10, writer.num_drops());
+    }
+
+    UNSIGNED_LONGS_EQUAL(RingSize, collector.n_records);
+    UNSIGNED_LONGS_EQUAL(1, collector.n_drop_reports);
+}
+
+TEST(async_log_writer, logger) {
+    Logger& log = Logger::instance();
+
+    const LogLevel level = log.get_level();
+    log.set_level(LogInfo);
+
+    size_t counter = 0;
+    void* args[] = { &counter };
+    log.set_handler(&log_capture, args, 1);
+
+    CHECK(log.set_async(true));
+
+    for (size_t n = 0; n < NumRecords; n++) {
+        roc_log(LogInfo, "async logger test");
+    }
+
+    // disabling waits for pending messages
+    CHECK(log.set_async(false));
+
+    UNSIGNED_LONGS_EQUAL(NumRecords, counter);
+
+    log.set_handler(NULL, NULL, 0);
+    log.set_level(level);
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/cache_aligned.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct Counters {
+    CacheAligned<Atomic<int> > a;
+    CacheAligned<Atomic<int> > b;
+
+    Counters()
+        : a(1)
+        , b(2) {
+    }
+};
+
+} // namespace
+
+TEST_GROUP(cache_aligned) {};
+
+TEST(cache_aligned, access) {
+    CacheAligned<int> x;
+    LONGS_EQUAL(0, *x);
+
+    *x = 123;
+    LONGS_EQUAL(123, *x);
+
+    const CacheAligned<int>& cx = x;
+    LONGS_EQUAL(123, *cx);
+    POINTERS_EQUAL(&*x, x.operator->());
+}
+
+TEST(cache_aligned, separate_lines) {
+    Counters c;
+
+    LONGS_EQUAL(1, *c.a);
+    LONGS_EQUAL(2, *c.b);
+
+    ++*c.a;
+    LONGS_EQUAL(2, *c.a);
+    LONGS_EQUAL(2, *c.b);
+
+    // objects are always at least one cache line apart, regardless of
+    // alignment of enclosing object
+    const size_t a_addr = (size_t)&*c.a;
+    const size_t b_addr = (size_t)&*c.b;
+
+    CHECK(b_addr - a_addr >= CacheLineSize + sizeof(Atomic<int>));
+    CHECK(sizeof(CacheAligned<int>) >= CacheLineSize * 2 + sizeof(int));
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/align_ops.h"
+#include "roc_core/caching_allocator.h"
+#include "roc_core/heap_allocator.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { BlockSize = 1000, MaxBlocks = 2 };
+
+// Fails allocations while the number of blocks reaches limit.
+class LimitedAllocator : public IAllocator {
+public:
+    LimitedAllocator(IAllocator& allocator, size_t limit)
+        : allocator_(allocator)
+        , limit_(limit)
+        , n_blocks_(0) {
+    }
+
+    size_t num_blocks() const {
+        return n_blocks_;
+    }
+
+    virtual void* allocate(size_t size) {
+        if (n_blocks_ == limit_) {
+            return NULL;
+        }
+        n_blocks_++;
+        return allocator_.allocate(size);
+    }
+
+    virtual void deallocate(void* ptr) {
+        n_blocks_--;
+        allocator_.deallocate(ptr);
+    }
+
+private:
+    IAllocator& allocator_;
+    size_t limit_;
+    size_t n_blocks_;
+};
+
+} // namespace
+
+TEST_GROUP(caching_allocator) {
+    HeapAllocator heap_allocator;
+};
+
+TEST(caching_allocator, reuse) {
+    CachingAllocator allocator(heap_allocator, BlockSize, MaxBlocks);
+
+    void* p1 = allocator.allocate(BlockSize);
+    CHECK(p1);
+    CHECK(AlignOps::align_max((size_t)p1) == (size_t)p1);
+
+    void* p2 = allocator.allocate(BlockSize);
+    CHECK(p2);
+
+    LONGS_EQUAL(2, heap_allocator.num_allocations());
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_cached());
+
+    allocator.deallocate(p1);
+    allocator.deallocate(p2);
+
+    // blocks are kept in cache
+    LONGS_EQUAL(2, heap_allocator.num_allocations());
+    UNSIGNED_LONGS_EQUAL(2, allocator.num_cached());
+
+    // and reused
+    POINTERS_EQUAL(p2, allocator.allocate(BlockSize));
+    POINTERS_EQUAL(p1, allocator.allocate(BlockSize));
+
+    LONGS_EQUAL(2, heap_allocator.num_allocations());
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_cached());
+
+    allocator.deallocate(p1);
+    allocator.deallocate(p2);
+}
+
+TEST(caching_allocator, max_blocks) {
+    {
+        CachingAllocator allocator(heap_allocator, BlockSize, MaxBlocks);
+
+        void* blocks[MaxBlocks + 1];
+        for (size_t n = 0; n < ROC_ARRAY_SIZE(blocks); n++) {
+            blocks[n] = allocator.allocate(BlockSize);
+            CHECK(blocks[n]);
+        }
+
+        for (size_t n = 0; n < ROC_ARRAY_SIZE(blocks); n++) {
+            allocator.deallocate(blocks[n]);
+        }
+
+        // extra block is deallocated
+        UNSIGNED_LONGS_EQUAL(MaxBlocks, allocator.num_cached());
+        LONGS_EQUAL(MaxBlocks, heap_allocator.num_allocations());
+
+        allocator.release_cached();
+
+        UNSIGNED_LONGS_EQUAL(0, allocator.num_cached());
+        LONGS_EQUAL(0, heap_allocator.num_allocations());
+
+        allocator.deallocate(allocator.allocate(BlockSize));
+        UNSIGNED_LONGS_EQUAL(1, allocator.num_cached());
+    }
+
+    // destructor releases cache
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+TEST(caching_allocator, other_sizes) {
+    CachingAllocator allocator(heap_allocator, BlockSize, MaxBlocks);
+
+    void* p1 = allocator.allocate(BlockSize / 2);
+    CHECK(p1);
+    void* p2 = allocator.allocate(BlockSize * 2);
+    CHECK(p2);
+
+    allocator.deallocate(p1);
+    allocator.deallocate(p2);
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_cached());
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+TEST(caching_allocator, disabled) {
+    CachingAllocator allocator(heap_allocator, BlockSize, 0);
+
+    allocator.deallocate(allocator.allocate(BlockSize));
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_cached());
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+TEST(caching_allocator, memory_pressure) {
+    LimitedAllocator limited_allocator(heap_allocator, MaxBlocks);
+    CachingAllocator allocator(limited_allocator, BlockSize, MaxBlocks);
+
+    void* p1 = allocator.allocate(BlockSize);
+    CHECK(p1);
+    void* p2 = allocator.allocate(BlockSize);
+    CHECK(p2);
+
+    allocator.deallocate(p2);
+    UNSIGNED_LONGS_EQUAL(1, allocator.num_cached());
+
+    // cached block is released to satisfy allocation of different size
+    void* p3 = allocator.allocate(BlockSize / 2);
+    CHECK(p3);
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_cached());
+    UNSIGNED_LONGS_EQUAL(2, limited_allocator.num_blocks());
+
+    // nothing to release
+    POINTERS_EQUAL(NULL, allocator.allocate(BlockSize));
+
+    allocator.deallocate(p1);
+    allocator.deallocate(p3);
+}
+
+} // namespace core
+} // namespace roc
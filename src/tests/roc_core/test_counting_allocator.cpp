@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/align_ops.h"
+#include "roc_core/counting_allocator.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/slab_pool.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct FailingAllocator : public IAllocator {
+    virtual void* allocate(size_t) {
+        return NULL;
+    }
+
+    virtual void deallocate(void*) {
+        FAIL("unexpected deallocate");
+    }
+};
+
+} // namespace
+
+TEST_GROUP(counting_allocator) {};
+
+TEST(counting_allocator, allocate_deallocate) {
+    HeapAllocator heap_allocator;
+
+    {
+        CountingAllocator allocator(heap_allocator);
+
+        void* p1 = allocator.allocate(100);
+        CHECK(p1);
+        CHECK(AlignOps::align_max((size_t)p1) == (size_t)p1);
+
+        void* p2 = allocator.allocate(50);
+        CHECK(p2);
+        CHECK(AlignOps::align_max((size_t)p2) == (size_t)p2);
+
+        AllocationStats stats = allocator.stats();
+        UNSIGNED_LONGS_EQUAL(2, stats.num_allocations);
+        UNSIGNED_LONGS_EQUAL(150, stats.num_bytes);
+        UNSIGNED_LONGS_EQUAL(150, stats.peak_bytes);
+        UNSIGNED_LONGS_EQUAL(2, stats.total_allocations);
+        UNSIGNED_LONGS_EQUAL(0, stats.failed_allocations);
+
+        LONGS_EQUAL(2, heap_allocator.num_allocations());
+
+        allocator.deallocate(p1);
+
+        stats = allocator.stats();
+        UNSIGNED_LONGS_EQUAL(1, stats.num_allocations);
+        UNSIGNED_LONGS_EQUAL(50, stats.num_bytes);
+        UNSIGNED_LONGS_EQUAL(150, stats.peak_bytes);
+        UNSIGNED_LONGS_EQUAL(2, stats.total_allocations);
+
+        void* p3 = allocator.allocate(20);
+        CHECK(p3);
+
+        stats = allocator.stats();
+        UNSIGNED_LONGS_EQUAL(2, stats.num_allocations);
+        UNSIGNED_LONGS_EQUAL(70, stats.num_bytes);
+        UNSIGNED_LONGS_EQUAL(150, stats.peak_bytes);
+        UNSIGNED_LONGS_EQUAL(3, stats.total_allocations);
+
+        allocator.deallocate(p2);
+        allocator.deallocate(p3);
+
+        stats = allocator.stats();
+        UNSIGNED_LONGS_EQUAL(0, stats.num_allocations);
+        UNSIGNED_LONGS_EQUAL(0, stats.num_bytes);
+        UNSIGNED_LONGS_EQUAL(150, stats.peak_bytes);
+    }
+
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+TEST(counting_allocator, failed_allocation) {
+    FailingAllocator failing_allocator;
+    CountingAllocator allocator(failing_allocator);
+
+    CHECK(!allocator.allocate(100));
+    CHECK(!allocator.allocate(100));
+
+    AllocationStats stats = allocator.stats();
+    UNSIGNED_LONGS_EQUAL(0, stats.num_allocations);
+    UNSIGNED_LONGS_EQUAL(0, stats.num_bytes);
+    UNSIGNED_LONGS_EQUAL(0, stats.total_allocations);
+    UNSIGNED_LONGS_EQUAL(2, stats.failed_allocations);
+}
+
+TEST(counting_allocator, max_bytes) {
+    HeapAllocator heap_allocator;
+
+    {
+        CountingAllocator allocator(heap_allocator, 150);
+
+        void* p1 = allocator.allocate(100);
+        CHECK(p1);
+
+        CHECK(!allocator.allocate(51));
+        CHECK(!allocator.allocate(1000));
+
+        void* p2 = allocator.allocate(50);
+        CHECK(p2);
+
+        CHECK(!allocator.allocate(1));
+
+        AllocationStats stats = allocator.stats();
+        UNSIGNED_LONGS_EQUAL(2, stats.num_allocations);
+        UNSIGNED_LONGS_EQUAL(150, stats.num_bytes);
+        UNSIGNED_LONGS_EQUAL(150, stats.peak_bytes);
+        UNSIGNED_LONGS_EQUAL(2, stats.total_allocations);
+        UNSIGNED_LONGS_EQUAL(0, stats.failed_allocations);
+        UNSIGNED_LONGS_EQUAL(3, stats.limited_allocations);
+
+        LONGS_EQUAL(2, heap_allocator.num_allocations());
+
+        allocator.deallocate(p1);
+
+        void* p3 = allocator.allocate(100);
+        CHECK(p3);
+
+        stats = allocator.stats();
+        UNSIGNED_LONGS_EQUAL(150, stats.num_bytes);
+        UNSIGNED_LONGS_EQUAL(3, stats.limited_allocations);
+
+        allocator.deallocate(p2);
+        allocator.deallocate(p3);
+    }
+
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+TEST(counting_allocator, max_bytes_failed_allocation) {
+    FailingAllocator failing_allocator;
+    CountingAllocator allocator(failing_allocator, 100);
+
+    CHECK(!allocator.allocate(100));
+    CHECK(!allocator.allocate(100));
+
+    AllocationStats stats = allocator.stats();
+    UNSIGNED_LONGS_EQUAL(0, stats.num_bytes);
+    UNSIGNED_LONGS_EQUAL(0, stats.peak_bytes);
+    UNSIGNED_LONGS_EQUAL(2, stats.failed_allocations);
+    UNSIGNED_LONGS_EQUAL(0, stats.limited_allocations);
+}
+
+TEST(counting_allocator, slab_pool) {
+    enum { ObjectSize = 100, NumObjects = 10 };
+
+    HeapAllocator heap_allocator;
+
+    {
+        CountingAllocator allocator(heap_allocator);
+
+        {
+            SlabPool pool(allocator, ObjectSize, false);
+
+            void* pointers[NumObjects] = {};
+            for (size_t n = 0; n < NumObjects; n++) {
+                pointers[n] = pool.allocate();
+                CHECK(pointers[n]);
+            }
+
+            const SlabPoolStats pool_stats = pool.stats();
+            const AllocationStats alloc_stats = allocator.stats();
+
+            UNSIGNED_LONGS_EQUAL(pool_stats.num_slabs, alloc_stats.num_allocations);
+            UNSIGNED_LONGS_EQUAL(pool_stats.num_bytes, alloc_stats.num_bytes);
+
+            for (size_t n = 0; n < NumObjects; n++) {
+                pool.deallocate(pointers[n]);
+            }
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, allocator.stats().num_allocations);
+        UNSIGNED_LONGS_EQUAL(0, allocator.stats().num_bytes);
+    }
+
+    LONGS_EQUAL(0, heap_allocator.num_allocations());
+}
+
+} // namespace core
+} // namespace roc
@@ -8,11 +8,49 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "roc_core/cpu_dispatch.h"
+#include "roc_core/cpu_features.h"
 #include "roc_core/cpu_traits.h"
+#include "roc_core/macro_helpers.h"
 
 namespace roc {
 namespace core {
 
+namespace {
+
+int func_generic() {
+    return 1;
+}
+
+int func_simd() {
+    return 2;
+}
+
+struct TestTable {
+    int (*func)();
+};
+
+const CpuVariant<TestTable> test_variants[] = {
+    { CpuFeature_NEON, { func_simd } },
+    { CpuFeature_SSE2, { func_simd } },
+    { CpuFeature_Generic, { func_generic } },
+};
+
+struct TestVariants {
+    typedef TestTable Table;
+
+    static const char* name() {
+        return "test";
+    }
+
+    static const CpuVariant<Table>* variants(size_t& n_variants) {
+        n_variants = ROC_ARRAY_SIZE(test_variants);
+        return test_variants;
+    }
+};
+
+} // namespace
+
 TEST_GROUP(cpu) {};
 
 TEST(cpu, endianess) {
@@ -38,5 +76,63 @@ TEST(cpu, bitness) {
 #endif
 }
 
+TEST(cpu, features) {
+#if defined(__x86_64__) || defined(_M_X64)
+    CHECK(cpu_supports(CpuFeature_SSE2));
+#endif
+
+#if ROC_CPU_FAMILY != ROC_CPU_FAMILY_X86
+    CHECK(!cpu_supports(CpuFeature_SSE2));
+    CHECK(!cpu_supports(CpuFeature_SSSE3));
+    CHECK(!cpu_supports(CpuFeature_AVX2));
+#endif
+
+#if ROC_CPU_FAMILY != ROC_CPU_FAMILY_ARM
+    CHECK(!cpu_supports(CpuFeature_NEON));
+#endif
+
+    CHECK(cpu_supports(CpuFeature_Generic));
+    CHECK(!cpu_supports(CpuFeature_Max));
+}
+
+TEST(cpu, feature_names) {
+    for (int n = 0; n < CpuFeature_Max; n++) {
+        CHECK(strcmp(cpu_feature_to_str((CpuFeature)n), "<invalid>") != 0);
+    }
+    STRCMP_EQUAL("avx2", cpu_feature_to_str(CpuFeature_AVX2));
+}
+
+TEST(cpu, select) {
+    // generic only
+    {
+        const CpuVariant<TestTable>& variant = cpu_select(test_variants + 2, 1);
+        LONGS_EQUAL(CpuFeature_Generic, variant.feature);
+        LONGS_EQUAL(1, variant.table.func());
+    }
+    // first supported
+    {
+        const CpuVariant<TestTable>& variant =
+            cpu_select(test_variants, ROC_ARRAY_SIZE(test_variants));
+        CHECK(cpu_supports(variant.feature));
+        for (size_t n = 0; &test_variants[n] != &variant; n++) {
+            CHECK(!cpu_supports(test_variants[n].feature));
+        }
+        if (variant.feature == CpuFeature_Generic) {
+            LONGS_EQUAL(1, variant.table.func());
+        } else {
+            LONGS_EQUAL(2, variant.table.func());
+        }
+    }
+}
+
+TEST(cpu, dispatch) {
+    const TestTable& table = CpuDispatch<TestVariants>::table();
+    const CpuVariant<TestTable>& variant =
+        cpu_select(test_variants, ROC_ARRAY_SIZE(test_variants));
+
+    CHECK(table.func == variant.table.func);
+    CHECK(&CpuDispatch<TestVariants>::table() == &table);
+}
+
 } // namespace core
 } // namespace roc
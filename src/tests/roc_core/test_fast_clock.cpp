@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/fast_clock.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+// Wait until calibration period passes.
+void wait_calibration() {
+    (void)fast_timestamp();
+    sleep_for(ClockMonotonic, 150 * Millisecond);
+    (void)fast_timestamp();
+}
+
+} // namespace
+
+TEST_GROUP(fast_clock) {};
+
+TEST(fast_clock, follows_monotonic) {
+    wait_calibration();
+
+    for (int n = 0; n < 10; n++) {
+        const nanoseconds_t mono = timestamp(ClockMonotonic);
+        const nanoseconds_t fast = fast_timestamp();
+
+        CHECK(fast >= mono - Millisecond);
+        CHECK(fast <= mono + Millisecond);
+
+        sleep_for(ClockMonotonic, Millisecond);
+    }
+}
+
+TEST(fast_clock, non_decreasing) {
+    wait_calibration();
+
+    nanoseconds_t prev = fast_timestamp();
+
+    for (int n = 0; n < 100000; n++) {
+        const nanoseconds_t cur = fast_timestamp();
+        CHECK(cur >= prev);
+        prev = cur;
+    }
+}
+
+TEST(fast_clock, interval) {
+    wait_calibration();
+
+    const nanoseconds_t start = fast_timestamp();
+    sleep_for(ClockMonotonic, 10 * Millisecond);
+    const nanoseconds_t elapsed = fast_timestamp() - start;
+
+    CHECK(elapsed >= 10 * Millisecond - 100 * Microsecond);
+    CHECK(elapsed < Second);
+}
+
+} // namespace core
+} // namespace roc
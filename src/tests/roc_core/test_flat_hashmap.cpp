@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/flat_hashmap.h"
+#include "roc_core/hashsum.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/ref_counted.h"
+#include "roc_core/shared_ptr.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct HeapAllocation {
+    template <class T> void destroy(T& object) {
+        delete &object;
+    }
+};
+
+class Object : public RefCounted<Object, HeapAllocation> {};
+
+// all keys collide into few home slots
+struct CollidingTraits {
+    static hashsum_t key_hash(const uint32_t& key) {
+        return key % 3;
+    }
+
+    static bool key_equal(const uint32_t& key1, const uint32_t& key2) {
+        return key1 == key2;
+    }
+};
+
+} // namespace
+
+TEST_GROUP(flat_hashmap) {
+    HeapAllocator allocator;
+};
+
+TEST(flat_hashmap, empty) {
+    FlatHashmap<uint32_t, int> hashmap(allocator);
+
+    UNSIGNED_LONGS_EQUAL(0, hashmap.size());
+    UNSIGNED_LONGS_EQUAL(0, hashmap.capacity());
+
+    CHECK(!hashmap.contains(123));
+    POINTERS_EQUAL(NULL, hashmap.find(123));
+    CHECK(!hashmap.remove(123));
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(flat_hashmap, insert_find_remove) {
+    FlatHashmap<uint32_t, int> hashmap(allocator);
+
+    CHECK(hashmap.grow());
+    CHECK(hashmap.capacity() > 0);
+
+    hashmap.insert(111, 1);
+    hashmap.insert(222, 2);
+
+    UNSIGNED_LONGS_EQUAL(2, hashmap.size());
+
+    CHECK(hashmap.find(111));
+    CHECK(hashmap.find(222));
+    LONGS_EQUAL(1, *hashmap.find(111));
+    LONGS_EQUAL(2, *hashmap.find(222));
+    POINTERS_EQUAL(NULL, hashmap.find(333));
+
+    *hashmap.find(111) = 11;
+    LONGS_EQUAL(11, *hashmap.find(111));
+
+    CHECK(hashmap.remove(111));
+    CHECK(!hashmap.remove(111));
+
+    UNSIGNED_LONGS_EQUAL(1, hashmap.size());
+    CHECK(!hashmap.contains(111));
+    CHECK(hashmap.contains(222));
+}
+
+TEST(flat_hashmap, insert_remove_many) {
+    enum { NumIterations = 10, NumElements = 200 };
+
+    FlatHashmap<uint32_t, uint32_t> hashmap(allocator);
+
+    for (size_t i = 0; i < NumIterations; i++) {
+        for (uint32_t n = 0; n < NumElements; n++) {
+            CHECK(hashmap.grow());
+            hashmap.insert(n * 7919, n);
+        }
+
+        UNSIGNED_LONGS_EQUAL(NumElements, hashmap.size());
+
+        for (uint32_t n = 0; n < NumElements; n++) {
+            CHECK(hashmap.find(n * 7919));
+            UNSIGNED_LONGS_EQUAL(n, *hashmap.find(n * 7919));
+        }
+
+        // remove every second element
+        for (uint32_t n = 0; n < NumElements; n += 2) {
+            CHECK(hashmap.remove(n * 7919));
+        }
+
+        for (uint32_t n = 0; n < NumElements; n++) {
+            CHECK(hashmap.contains(n * 7919) == (n % 2 != 0));
+        }
+
+        for (uint32_t n = 1; n < NumElements; n += 2) {
+            CHECK(hashmap.remove(n * 7919));
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, hashmap.size());
+    }
+}
+
+TEST(flat_hashmap, collisions) {
+    enum { NumElements = 50 };
+
+    FlatHashmap<uint32_t, uint32_t, 0, CollidingTraits> hashmap(allocator);
+
+    for (uint32_t n = 0; n < NumElements; n++) {
+        CHECK(hashmap.grow());
+        hashmap.insert(n, n * 10);
+    }
+
+    for (uint32_t n = 0; n < NumElements; n++) {
+        CHECK(hashmap.find(n));
+        UNSIGNED_LONGS_EQUAL(n * 10, *hashmap.find(n));
+    }
+
+    CHECK(!hashmap.contains(NumElements));
+
+    // removal shifts following elements back, they should remain reachable
+    for (uint32_t n = 0; n < NumElements; n += 3) {
+        CHECK(hashmap.remove(n));
+    }
+
+    for (uint32_t n = 0; n < NumElements; n++) {
+        if (n % 3 == 0) {
+            CHECK(!hashmap.contains(n));
+        } else {
+            CHECK(hashmap.find(n));
+            UNSIGNED_LONGS_EQUAL(n * 10, *hashmap.find(n));
+        }
+    }
+}
+
+TEST(flat_hashmap, grow_rapidly) {
+    enum { NumElements = 1000 };
+
+    FlatHashmap<uint64_t, uint64_t> hashmap(allocator);
+
+    for (uint64_t n = 0; n < NumElements; n++) {
+        CHECK(hashmap.grow());
+        CHECK(hashmap.size() < hashmap.capacity());
+
+        hashmap.insert(n, n + 1);
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumElements, hashmap.size());
+    CHECK(allocator.num_allocations() == 1);
+
+    for (uint64_t n = 0; n < NumElements; n++) {
+        CHECK(hashmap.find(n));
+        CHECK(*hashmap.find(n) == n + 1);
+    }
+}
+
+TEST(flat_hashmap, embedding) {
+    enum { NumEmbedded = 10, NumElements = 100 };
+
+    FlatHashmap<uint32_t, uint32_t, NumEmbedded> hashmap(allocator);
+
+    CHECK(hashmap.capacity() >= NumEmbedded);
+
+    for (uint32_t n = 0; n < NumEmbedded; n++) {
+        CHECK(hashmap.grow());
+        hashmap.insert(n, n);
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+
+    for (uint32_t n = NumEmbedded; n < NumElements; n++) {
+        CHECK(hashmap.grow());
+        hashmap.insert(n, n);
+    }
+
+    CHECK(allocator.num_allocations() == 1);
+
+    for (uint32_t n = 0; n < NumElements; n++) {
+        CHECK(hashmap.find(n));
+        UNSIGNED_LONGS_EQUAL(n, *hashmap.find(n));
+    }
+}
+
+TEST(flat_hashmap, refcounting) {
+    SharedPtr<Object> obj1 = new Object;
+    SharedPtr<Object> obj2 = new Object;
+
+    {
+        FlatHashmap<uint32_t, SharedPtr<Object>, 4> hashmap(allocator);
+
+        hashmap.insert(1, obj1);
+        hashmap.insert(2, obj2);
+
+        LONGS_EQUAL(2, obj1->getref());
+        LONGS_EQUAL(2, obj2->getref());
+
+        // elements are moved to new slots
+        for (uint32_t n = 3; n < 20; n++) {
+            CHECK(hashmap.grow());
+            hashmap.insert(n, obj1);
+        }
+
+        LONGS_EQUAL(19, obj1->getref());
+        LONGS_EQUAL(2, obj2->getref());
+
+        CHECK(hashmap.remove(2));
+        LONGS_EQUAL(1, obj2->getref());
+
+        POINTERS_EQUAL(obj1.get(), hashmap.find(1)->get());
+    }
+
+    LONGS_EQUAL(1, obj1->getref());
+    LONGS_EQUAL(1, obj2->getref());
+}
+
+} // namespace core
+} // namespace roc
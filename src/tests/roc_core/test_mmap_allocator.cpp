@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/align_ops.h"
+#include "roc_core/mmap_allocator.h"
+#include "roc_core/slab_pool.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { SmallSize = 100, LargeSize = 1024 * 1024, HugeSize = 4 * 1024 * 1024 };
+
+void check_memory(void* memory, size_t size) {
+    CHECK(memory);
+    UNSIGNED_LONGS_EQUAL(0, (size_t)memory % AlignOps::max_alignment());
+
+    memset(memory, 0x55, size);
+
+    for (size_t n = 0; n < size; n += 4096) {
+        UNSIGNED_LONGS_EQUAL(0x55, ((uint8_t*)memory)[n]);
+    }
+    UNSIGNED_LONGS_EQUAL(0x55, ((uint8_t*)memory)[size - 1]);
+}
+
+} // namespace
+
+TEST_GROUP(mmap_allocator) {};
+
+TEST(mmap_allocator, small) {
+    MmapAllocator allocator(false, false);
+
+    void* memory = allocator.allocate(SmallSize);
+    check_memory(memory, SmallSize);
+
+    UNSIGNED_LONGS_EQUAL(1, allocator.num_allocations());
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_mapped_allocations());
+
+    allocator.deallocate(memory);
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(mmap_allocator, large) {
+    MmapAllocator allocator(false, false);
+
+    void* memory = allocator.allocate(LargeSize);
+    check_memory(memory, LargeSize);
+
+    UNSIGNED_LONGS_EQUAL(1, allocator.num_allocations());
+    UNSIGNED_LONGS_EQUAL(1, allocator.num_mapped_allocations());
+
+    allocator.deallocate(memory);
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_mapped_allocations());
+}
+
+TEST(mmap_allocator, hugepages) {
+    // falls back to regular pages if huge pages are not available
+    MmapAllocator allocator(true, false);
+
+    void* large = allocator.allocate(LargeSize);
+    check_memory(large, LargeSize);
+
+    void* huge = allocator.allocate(HugeSize);
+    check_memory(huge, HugeSize);
+
+    UNSIGNED_LONGS_EQUAL(2, allocator.num_allocations());
+
+    allocator.deallocate(large);
+    allocator.deallocate(huge);
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(mmap_allocator, lock_memory) {
+    // works even if mlock() fails because of limits
+    MmapAllocator allocator(false, true);
+
+    void* memory = allocator.allocate(LargeSize);
+    check_memory(memory, LargeSize);
+
+    allocator.deallocate(memory);
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(mmap_allocator, slab_pool) {
+    enum { NumObjects = 1000, ObjectSize = 1000 };
+
+    MmapAllocator allocator(true, false);
+
+    {
+        SlabPool pool(allocator, ObjectSize, true);
+        CHECK(pool.reserve(NumObjects));
+
+        CHECK(allocator.num_mapped_allocations() > 0);
+
+        void* pointers[NumObjects] = {};
+
+        for (size_t n = 0; n < NumObjects; n++) {
+            pointers[n] = pool.allocate();
+            check_memory(pointers[n], ObjectSize);
+        }
+
+        for (size_t n = 0; n < NumObjects; n++) {
+            pool.deallocate(pointers[n]);
+        }
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+} // namespace core
+} // namespace roc
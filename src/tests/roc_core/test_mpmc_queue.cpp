@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/mpmc_queue.h"
+#include "roc_core/ref_counted.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum {
+    NumProducers = 4,
+    NumConsumers = 4,
+    NumPerProducer = 10000,
+    QueueCapacity = 64
+};
+
+struct HeapAllocation {
+    template <class T> void destroy(T& object) {
+        delete &object;
+    }
+};
+
+class Object : public RefCounted<Object, HeapAllocation> {};
+
+class Producer : public Thread {
+public:
+    Producer(MpmcQueue<size_t>& queue, size_t index)
+        : queue_(queue)
+        , index_(index) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < NumPerProducer; n++) {
+            // element encodes producer index and sequence number
+            const size_t value = index_ * NumPerProducer + n;
+
+            while (!queue_.try_push(value)) {
+                sleep_for(ClockMonotonic, Microsecond);
+            }
+        }
+    }
+
+    MpmcQueue<size_t>& queue_;
+    const size_t index_;
+};
+
+class Consumer : public Thread {
+public:
+    Consumer(MpmcQueue<size_t>& queue, Atomic<int>& stop)
+        : queue_(queue)
+        , stop_(stop)
+        , sum_(0)
+        , count_(0)
+        , ordered_(true) {
+        for (size_t n = 0; n < NumProducers; n++) {
+            last_[n] = -1;
+        }
+    }
+
+    uint64_t sum() const {
+        return sum_;
+    }
+
+    size_t count() const {
+        return count_;
+    }
+
+    bool ordered() const {
+        return ordered_;
+    }
+
+private:
+    virtual void run() {
+        for (;;) {
+            size_t value = 0;
+
+            if (!queue_.try_pop(value)) {
+                if (stop_) {
+                    // drain what's left
+                    while (queue_.try_pop(value)) {
+                        handle_(value);
+                    }
+                    break;
+                }
+                sleep_for(ClockMonotonic, Microsecond);
+                continue;
+            }
+
+            handle_(value);
+        }
+    }
+
+    void handle_(size_t value) {
+        const size_t producer = value / NumPerProducer;
+        const long seq = long(value % NumPerProducer);
+
+        // elements from one producer are popped by one consumer in order
+        if (seq <= last_[producer]) {
+            ordered_ = false;
+        }
+        last_[producer] = seq;
+
+        sum_ += value;
+        count_++;
+    }
+
+    MpmcQueue<size_t>& queue_;
+    Atomic<int>& stop_;
+
+    uint64_t sum_;
+    size_t count_;
+    bool ordered_;
+    long last_[NumProducers];
+};
+
+} // namespace
+
+TEST_GROUP(mpmc_queue) {
+    HeapAllocator allocator;
+};
+
+TEST(mpmc_queue, capacity) {
+    {
+        MpmcQueue<int> queue(allocator, 1);
+        CHECK(queue.valid());
+        UNSIGNED_LONGS_EQUAL(1, queue.capacity());
+    }
+    {
+        MpmcQueue<int> queue(allocator, 5);
+        CHECK(queue.valid());
+        UNSIGNED_LONGS_EQUAL(8, queue.capacity());
+    }
+    {
+        MpmcQueue<int> queue(allocator, 16);
+        CHECK(queue.valid());
+        UNSIGNED_LONGS_EQUAL(16, queue.capacity());
+    }
+}
+
+TEST(mpmc_queue, push_pop) {
+    MpmcQueue<int> queue(allocator, 4);
+    CHECK(queue.valid());
+
+    int value = 0;
+    CHECK(!queue.try_pop(value));
+
+    for (int i = 0; i < 10; i++) {
+        for (int n = 0; n < 4; n++) {
+            CHECK(queue.try_push(i * 10 + n));
+        }
+
+        UNSIGNED_LONGS_EQUAL(4, queue.size());
+
+        // full
+        CHECK(!queue.try_push(-1));
+
+        for (int n = 0; n < 4; n++) {
+            CHECK(queue.try_pop(value));
+            LONGS_EQUAL(i * 10 + n, value);
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, queue.size());
+
+        // empty
+        CHECK(!queue.try_pop(value));
+    }
+}
+
+TEST(mpmc_queue, ownership) {
+    SharedPtr<Object> obj = new Object;
+
+    {
+        MpmcQueue<SharedPtr<Object> > queue(allocator, 4);
+        CHECK(queue.valid());
+
+        CHECK(queue.try_push(obj));
+        CHECK(queue.try_push(obj));
+        CHECK(queue.try_push(obj));
+        LONGS_EQUAL(4, obj->getref());
+
+        SharedPtr<Object> popped;
+        CHECK(queue.try_pop(popped));
+        LONGS_EQUAL(4, obj->getref());
+
+        popped = NULL;
+        LONGS_EQUAL(3, obj->getref());
+    }
+
+    // remaining elements are destroyed
+    LONGS_EQUAL(1, obj->getref());
+}
+
+TEST(mpmc_queue, concurrent) {
+    MpmcQueue<size_t> queue(allocator, QueueCapacity);
+    CHECK(queue.valid());
+
+    Atomic<int> stop(0);
+
+    Producer* producers[NumProducers];
+    Consumer* consumers[NumConsumers];
+
+    for (size_t n = 0; n < NumConsumers; n++) {
+        consumers[n] = new Consumer(queue, stop);
+        CHECK(consumers[n]->start());
+    }
+
+    for (size_t n = 0; n < NumProducers; n++) {
+        producers[n] = new Producer(queue, n);
+        CHECK(producers[n]->start());
+    }
+
+    for (size_t n = 0; n < NumProducers; n++) {
+        producers[n]->join();
+        delete producers[n];
+    }
+
+    stop = 1;
+
+    uint64_t total_sum = 0;
+    size_t total_count = 0;
+
+    for (size_t n = 0; n < NumConsumers; n++) {
+        consumers[n]->join();
+
+        CHECK(consumers[n]->ordered());
+
+        total_sum += consumers[n]->sum();
+        total_count += consumers[n]->count();
+
+        delete consumers[n];
+    }
+
+    const uint64_t n_total = NumProducers * NumPerProducer;
+
+    UNSIGNED_LONGS_EQUAL(n_total, total_count);
+    CHECK(total_sum == n_total * (n_total - 1) / 2);
+    UNSIGNED_LONGS_EQUAL(0, queue.size());
+}
+
+} // namespace core
+} // namespace roc
@@ -8,6 +8,7 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "roc_core/list.h"
 #include "roc_core/mpsc_queue.h"
 #include "roc_core/ref_counted.h"
 #include "roc_core/shared_ptr.h"
@@ -22,7 +23,7 @@ struct NoAllocation {
     }
 };
 
-struct Object : RefCounted<Object, NoAllocation>, MpscQueueNode {};
+struct Object : RefCounted<Object, NoAllocation>, MpscQueueNode, ListNode {};
 
 } // namespace
 
@@ -110,6 +111,70 @@ TEST(mpsc_queue, push_pop_many) {
     }
 }
 
+TEST(mpsc_queue, push_list) {
+    enum { NumObjs = 10 };
+
+    MpscQueue<Object, NoOwnership> queue;
+    Object objs[NumObjs];
+
+    for (int i = 0; i < 5; i++) {
+        List<Object, NoOwnership> list;
+
+        queue.push_back_list(list);
+        POINTERS_EQUAL(NULL, queue.pop_front_exclusive());
+
+        queue.push_back(objs[0]);
+
+        for (int n = 1; n < NumObjs - 1; n++) {
+            list.push_back(objs[n]);
+        }
+
+        queue.push_back_list(list);
+
+        LONGS_EQUAL(0, list.size());
+
+        queue.push_back(objs[NumObjs - 1]);
+
+        for (int n = 0; n < NumObjs; n++) {
+            POINTERS_EQUAL(&queue, objs[n].mpsc_queue_data()->queue);
+        }
+
+        for (int n = 0; n < NumObjs; n++) {
+            POINTERS_EQUAL(&objs[n], queue.try_pop_front_exclusive());
+        }
+
+        POINTERS_EQUAL(NULL, queue.try_pop_front_exclusive());
+    }
+}
+
+TEST(mpsc_queue, push_list_ownership) {
+    MpscQueue<Object, RefCountedOwnership> queue;
+
+    Object obj1;
+    Object obj2;
+
+    {
+        List<Object, RefCountedOwnership> list;
+
+        list.push_back(obj1);
+        list.push_back(obj2);
+
+        UNSIGNED_LONGS_EQUAL(1, obj1.getref());
+        UNSIGNED_LONGS_EQUAL(1, obj2.getref());
+
+        queue.push_back_list(list);
+
+        UNSIGNED_LONGS_EQUAL(1, obj1.getref());
+        UNSIGNED_LONGS_EQUAL(1, obj2.getref());
+    }
+
+    POINTERS_EQUAL(&obj1, queue.pop_front_exclusive().get());
+    POINTERS_EQUAL(&obj2, queue.pop_front_exclusive().get());
+
+    UNSIGNED_LONGS_EQUAL(0, obj1.getref());
+    UNSIGNED_LONGS_EQUAL(0, obj2.getref());
+}
+
 TEST(mpsc_queue, ownership) {
     MpscQueue<Object, RefCountedOwnership> queue;
 
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/rate_limiter.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(rate_limiter) {};
+
+TEST(rate_limiter, first_allowed) {
+    RateLimiter limiter(Second);
+
+    CHECK(limiter.would_allow());
+    CHECK(limiter.allow());
+
+    CHECK(!limiter.would_allow());
+    CHECK(!limiter.allow());
+}
+
+TEST(rate_limiter, one_per_period) {
+    const nanoseconds_t period = Millisecond * 20;
+
+    RateLimiter limiter(period);
+
+    CHECK(limiter.allow());
+    const nanoseconds_t start = timestamp(ClockMonotonic);
+
+    while (!limiter.would_allow()) {
+        CHECK(!limiter.allow());
+        sleep_for(ClockMonotonic, Millisecond);
+    }
+
+    // never allows before period passes
+    CHECK(timestamp(ClockMonotonic) - start >= period - Millisecond);
+
+    CHECK(limiter.allow());
+    CHECK(!limiter.allow());
+}
+
+TEST(rate_limiter, skipped_periods) {
+    const nanoseconds_t period = Millisecond * 5;
+
+    RateLimiter limiter(period);
+
+    CHECK(limiter.allow());
+
+    sleep_for(ClockMonotonic, period * 3);
+
+    // several missed periods are collapsed into one event
+    CHECK(limiter.allow());
+    CHECK(!limiter.allow());
+}
+
+} // namespace core
+} // namespace roc
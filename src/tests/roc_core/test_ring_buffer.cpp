@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/ring_buffer.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct Object {
+    static long n_objects;
+
+    size_t value;
+
+    Object(size_t v = 0)
+        : value(v) {
+        n_objects++;
+    }
+
+    Object(const Object& other)
+        : value(other.value) {
+        n_objects++;
+    }
+
+    ~Object() {
+        n_objects--;
+    }
+};
+
+long Object::n_objects = 0;
+
+} // namespace
+
+TEST_GROUP(ring_buffer) {
+    HeapAllocator allocator;
+};
+
+TEST(ring_buffer, empty) {
+    RingBuffer<Object> ring(allocator);
+
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+    UNSIGNED_LONGS_EQUAL(0, ring.capacity());
+    CHECK(ring.is_empty());
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(ring_buffer, grow) {
+    RingBuffer<Object> ring(allocator);
+
+    CHECK(ring.grow(3));
+    UNSIGNED_LONGS_EQUAL(4, ring.capacity());
+
+    CHECK(ring.grow(4));
+    UNSIGNED_LONGS_EQUAL(4, ring.capacity());
+
+    CHECK(ring.grow(5));
+    UNSIGNED_LONGS_EQUAL(8, ring.capacity());
+
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+    UNSIGNED_LONGS_EQUAL(1, allocator.num_allocations());
+}
+
+TEST(ring_buffer, push_pop) {
+    enum { Capacity = 8, NumIterations = 100 };
+
+    RingBuffer<Object> ring(allocator);
+    CHECK(ring.grow(Capacity));
+
+    size_t next_push = 0, next_pop = 0;
+
+    // wrap around many times, keeping ring partially filled
+    for (size_t i = 0; i < NumIterations; i++) {
+        while (!ring.is_full()) {
+            ring.push_back(Object(next_push++));
+        }
+
+        UNSIGNED_LONGS_EQUAL(Capacity, ring.size());
+        UNSIGNED_LONGS_EQUAL(next_pop, ring.front().value);
+        UNSIGNED_LONGS_EQUAL(next_push - 1, ring.back().value);
+
+        for (size_t n = 0; n < ring.size(); n++) {
+            UNSIGNED_LONGS_EQUAL(next_pop + n, ring[n].value);
+        }
+
+        for (size_t n = 0; n < i % Capacity + 1; n++) {
+            UNSIGNED_LONGS_EQUAL(next_pop++, ring.front().value);
+            ring.pop_front();
+        }
+    }
+
+    LONGS_EQUAL(ring.size(), Object::n_objects);
+}
+
+TEST(ring_buffer, push_pop_many) {
+    enum { Capacity = 16, Chunk = 5, NumIterations = 50 };
+
+    RingBuffer<size_t> ring(allocator);
+    CHECK(ring.grow(Capacity));
+
+    size_t next_push = 0, next_pop = 0;
+
+    for (size_t i = 0; i < NumIterations; i++) {
+        size_t in[Chunk * 2];
+        for (size_t n = 0; n < Chunk * 2; n++) {
+            in[n] = next_push + n;
+        }
+
+        const size_t n_pushed = ring.push_back_many(in, Chunk * 2);
+        CHECK(n_pushed <= Chunk * 2);
+        next_push += n_pushed;
+
+        if (n_pushed < Chunk * 2) {
+            CHECK(ring.is_full());
+        }
+
+        size_t out[Chunk];
+        const size_t n_popped = ring.pop_front_many(out, Chunk);
+        UNSIGNED_LONGS_EQUAL(Chunk, n_popped);
+
+        for (size_t n = 0; n < n_popped; n++) {
+            UNSIGNED_LONGS_EQUAL(next_pop++, out[n]);
+        }
+    }
+
+    const size_t n_remain = ring.size();
+    UNSIGNED_LONGS_EQUAL(n_remain, ring.pop_front_many(NULL, n_remain * 2));
+    CHECK(ring.is_empty());
+}
+
+TEST(ring_buffer, grow_wrapped) {
+    RingBuffer<Object> ring(allocator);
+    CHECK(ring.grow(4));
+
+    for (size_t n = 0; n < 4; n++) {
+        ring.push_back(Object(n));
+    }
+    ring.pop_front();
+    ring.pop_front();
+    ring.push_back(Object(4));
+    ring.push_back(Object(5));
+
+    // elements 2,3,4,5 wrap around the end of memory
+    CHECK(ring.grow(8));
+    UNSIGNED_LONGS_EQUAL(8, ring.capacity());
+    UNSIGNED_LONGS_EQUAL(4, ring.size());
+
+    for (size_t n = 0; n < 4; n++) {
+        UNSIGNED_LONGS_EQUAL(n + 2, ring[n].value);
+    }
+
+    LONGS_EQUAL(4, Object::n_objects);
+}
+
+TEST(ring_buffer, embedding) {
+    RingBuffer<Object, 8> ring(allocator);
+
+    CHECK(ring.grow(4));
+
+    for (size_t n = 0; n < 4; n++) {
+        ring.push_back(Object(n));
+    }
+    ring.pop_front();
+    ring.pop_front();
+    ring.push_back(Object(4));
+    ring.push_back(Object(5));
+
+    // still embedded, wrapped part is moved in place
+    CHECK(ring.grow(8));
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+
+    for (size_t n = 0; n < 4; n++) {
+        UNSIGNED_LONGS_EQUAL(n + 2, ring[n].value);
+    }
+
+    CHECK(ring.grow(16));
+    UNSIGNED_LONGS_EQUAL(1, allocator.num_allocations());
+
+    for (size_t n = 0; n < 4; n++) {
+        UNSIGNED_LONGS_EQUAL(n + 2, ring[n].value);
+    }
+
+    LONGS_EQUAL(4, Object::n_objects);
+}
+
+TEST(ring_buffer, constructor_destructor) {
+    {
+        RingBuffer<Object> ring(allocator);
+        CHECK(ring.grow(4));
+
+        ring.push_back(Object(1));
+        ring.push_back(Object(2));
+
+        LONGS_EQUAL(2, Object::n_objects);
+
+        ring.pop_front();
+        LONGS_EQUAL(1, Object::n_objects);
+    }
+
+    LONGS_EQUAL(0, Object::n_objects);
+}
+
+} // namespace core
+} // namespace roc
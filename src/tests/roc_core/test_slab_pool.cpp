@@ -11,6 +11,7 @@
 #include "roc_core/heap_allocator.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slab_pool.h"
+#include "roc_core/thread.h"
 
 namespace roc {
 namespace core {
@@ -34,6 +35,26 @@ struct TestAllocator : public HeapAllocator {
     }
 };
 
+class DeallocatorThread : public Thread, public NonCopyable<> {
+public:
+    DeallocatorThread(SlabPool& pool, void** pointers, size_t n_pointers)
+        : pool_(pool)
+        , pointers_(pointers)
+        , n_pointers_(n_pointers) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < n_pointers_; n++) {
+            pool_.deallocate(pointers_[n]);
+        }
+    }
+
+    SlabPool& pool_;
+    void** pointers_;
+    size_t n_pointers_;
+};
+
 } // namespace
 
 TEST_GROUP(slab_pool) {
@@ -370,5 +391,282 @@ TEST(slab_pool, max_size_reserve) {
     }
 }
 
+TEST(slab_pool, thread_cache_allocate_deallocate_many) {
+    enum { NumObjects = 100 };
+
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true, 0, 0, true);
+
+        for (int i = 0; i < 10; i++) {
+            void* pointers[NumObjects] = {};
+
+            for (size_t n = 0; n < NumObjects; n++) {
+                pointers[n] = pool.allocate();
+                CHECK(pointers[n]);
+
+                for (size_t k = 0; k < n; k++) {
+                    CHECK(pointers[k] != pointers[n]);
+                }
+
+                memset(pointers[n], (int)n, ObjectSize);
+            }
+
+            for (size_t n = 0; n < NumObjects; n++) {
+                pool.deallocate(pointers[n]);
+            }
+        }
+
+        CHECK(allocator.num_allocations() > 0);
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(slab_pool, thread_cache_deallocate_from_other_thread) {
+    enum { NumObjects = 100 };
+
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true, 0, 0, true);
+
+        for (int i = 0; i < 10; i++) {
+            void* pointers[NumObjects] = {};
+
+            for (size_t n = 0; n < NumObjects; n++) {
+                pointers[n] = pool.allocate();
+                CHECK(pointers[n]);
+            }
+
+            DeallocatorThread thread(pool, pointers, NumObjects);
+            CHECK(thread.start());
+            thread.join();
+        }
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(slab_pool, limit_allocate) {
+    enum { MaxObjects = 5 };
+
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true);
+        pool.set_limit(MaxObjects);
+
+        void* pointers[MaxObjects] = {};
+
+        for (size_t n = 0; n < MaxObjects; n++) {
+            pointers[n] = pool.allocate();
+            CHECK(pointers[n]);
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, pool.num_failed_allocations());
+
+        CHECK(!pool.allocate());
+        CHECK(!pool.allocate());
+
+        UNSIGNED_LONGS_EQUAL(2, pool.num_failed_allocations());
+
+        pool.deallocate(pointers[0]);
+
+        pointers[0] = pool.allocate();
+        CHECK(pointers[0]);
+
+        UNSIGNED_LONGS_EQUAL(2, pool.num_failed_allocations());
+
+        for (size_t n = 0; n < MaxObjects; n++) {
+            pool.deallocate(pointers[n]);
+        }
+
+        // slabs never exceed the limit
+        CHECK(allocator.cumulative_allocated_bytes < (MaxObjects + 1) * ObjectSize);
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(slab_pool, limit_reserve) {
+    enum { MaxObjects = 5 };
+
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true);
+        pool.set_limit(MaxObjects);
+
+        CHECK(!pool.reserve(MaxObjects + 1));
+        CHECK(pool.reserve(MaxObjects));
+
+        const size_t n_allocs = allocator.num_allocations();
+
+        void* pointers[MaxObjects] = {};
+
+        for (size_t n = 0; n < MaxObjects; n++) {
+            pointers[n] = pool.allocate();
+            CHECK(pointers[n]);
+        }
+
+        // no allocations after reserve
+        LONGS_EQUAL(n_allocs, allocator.num_allocations());
+
+        CHECK(!pool.allocate());
+        UNSIGNED_LONGS_EQUAL(1, pool.num_failed_allocations());
+
+        for (size_t n = 0; n < MaxObjects; n++) {
+            pool.deallocate(pointers[n]);
+        }
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(slab_pool, stats) {
+    enum { NumObjects = 10 };
+
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true);
+
+        SlabPoolStats stats = pool.stats();
+        UNSIGNED_LONGS_EQUAL(0, stats.num_slabs);
+        UNSIGNED_LONGS_EQUAL(0, stats.num_bytes);
+        UNSIGNED_LONGS_EQUAL(0, stats.total_slots);
+        UNSIGNED_LONGS_EQUAL(0, stats.used_slots);
+        UNSIGNED_LONGS_EQUAL(0, stats.free_slots);
+        UNSIGNED_LONGS_EQUAL(0, stats.peak_used_slots);
+
+        void* pointers[NumObjects] = {};
+
+        for (size_t n = 0; n < NumObjects; n++) {
+            pointers[n] = pool.allocate();
+            CHECK(pointers[n]);
+
+            stats = pool.stats();
+            UNSIGNED_LONGS_EQUAL(n + 1, stats.used_slots);
+            UNSIGNED_LONGS_EQUAL(n + 1, stats.peak_used_slots);
+            UNSIGNED_LONGS_EQUAL(stats.total_slots,
+                                 stats.used_slots + stats.free_slots);
+        }
+
+        stats = pool.stats();
+        CHECK(stats.num_slabs > 1);
+        UNSIGNED_LONGS_EQUAL(allocator.num_allocations(), stats.num_slabs);
+        UNSIGNED_LONGS_EQUAL(allocator.cumulative_allocated_bytes, stats.num_bytes);
+
+        for (size_t n = 0; n < NumObjects / 2; n++) {
+            pool.deallocate(pointers[n]);
+        }
+
+        stats = pool.stats();
+        UNSIGNED_LONGS_EQUAL(NumObjects / 2, stats.used_slots);
+        UNSIGNED_LONGS_EQUAL(NumObjects, stats.peak_used_slots);
+        UNSIGNED_LONGS_EQUAL(stats.total_slots, stats.used_slots + stats.free_slots);
+
+        for (size_t n = NumObjects / 2; n < NumObjects; n++) {
+            pool.deallocate(pointers[n]);
+        }
+
+        stats = pool.stats();
+        UNSIGNED_LONGS_EQUAL(0, stats.used_slots);
+        UNSIGNED_LONGS_EQUAL(NumObjects, stats.peak_used_slots);
+        UNSIGNED_LONGS_EQUAL(stats.total_slots, stats.free_slots);
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(slab_pool, stats_failed_allocations) {
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true);
+        pool.set_limit(1);
+
+        void* memory = pool.allocate();
+        CHECK(memory);
+
+        CHECK(!pool.allocate());
+
+        SlabPoolStats stats = pool.stats();
+        UNSIGNED_LONGS_EQUAL(1, stats.num_slabs);
+        UNSIGNED_LONGS_EQUAL(1, stats.total_slots);
+        UNSIGNED_LONGS_EQUAL(1, stats.used_slots);
+        UNSIGNED_LONGS_EQUAL(0, stats.free_slots);
+        UNSIGNED_LONGS_EQUAL(1, stats.failed_allocations);
+
+        pool.deallocate(memory);
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(slab_pool, limit_thread_cache) {
+    enum { MaxObjects = 100 };
+
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true, 0, 0, true);
+        pool.set_limit(MaxObjects);
+
+        for (int i = 0; i < 3; i++) {
+            void* pointers[MaxObjects] = {};
+
+            for (size_t n = 0; n < MaxObjects; n++) {
+                pointers[n] = pool.allocate();
+                CHECK(pointers[n]);
+            }
+
+            CHECK(!pool.allocate());
+
+            for (size_t n = 0; n < MaxObjects; n++) {
+                pool.deallocate(pointers[n]);
+            }
+        }
+
+        UNSIGNED_LONGS_EQUAL(3, pool.num_failed_allocations());
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(slab_pool, limit_thread_cache_deallocate_from_other_thread) {
+    // fits into cache of deallocating thread
+    enum { MaxObjects = 20 };
+
+    TestAllocator allocator;
+
+    {
+        SlabPool pool(allocator, ObjectSize, true, 0, 0, true);
+        pool.set_limit(MaxObjects);
+
+        for (int i = 0; i < 3; i++) {
+            void* pointers[MaxObjects] = {};
+
+            for (size_t n = 0; n < MaxObjects; n++) {
+                pointers[n] = pool.allocate();
+                CHECK(pointers[n]);
+            }
+
+            CHECK(!pool.allocate());
+
+            DeallocatorThread thread(pool, pointers, MaxObjects);
+            CHECK(thread.start());
+            thread.join();
+        }
+
+        UNSIGNED_LONGS_EQUAL(MaxObjects, pool.stats().total_slots);
+        UNSIGNED_LONGS_EQUAL(3, pool.num_failed_allocations());
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
 } // namespace core
 } // namespace roc
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/spsc_ring_buffer.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { Capacity = 10 };
+
+HeapAllocator allocator;
+
+class Producer : public Thread {
+public:
+    Producer(SpscRingBuffer<int>& ring, int n_elems)
+        : ring_(ring)
+        , n_elems_(n_elems) {
+    }
+
+private:
+    virtual void run() {
+        int next = 0;
+        while (next < n_elems_) {
+            int elems[3] = { next, next + 1, next + 2 };
+            const int n_left = n_elems_ - next;
+            next += (int)ring_.write(elems, (size_t)(n_left < 3 ? n_left : 3));
+        }
+    }
+
+    SpscRingBuffer<int>& ring_;
+    const int n_elems_;
+};
+
+} // namespace
+
+TEST_GROUP(spsc_ring_buffer) {};
+
+TEST(spsc_ring_buffer, empty) {
+    SpscRingBuffer<int> ring(allocator, Capacity);
+    CHECK(ring.valid());
+
+    UNSIGNED_LONGS_EQUAL(Capacity, ring.capacity());
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+
+    int elems[Capacity] = {};
+    UNSIGNED_LONGS_EQUAL(0, ring.read(elems, Capacity));
+}
+
+TEST(spsc_ring_buffer, write_read) {
+    SpscRingBuffer<int> ring(allocator, Capacity);
+    CHECK(ring.valid());
+
+    int in[4] = { 1, 2, 3, 4 };
+    UNSIGNED_LONGS_EQUAL(4, ring.write(in, 4));
+    UNSIGNED_LONGS_EQUAL(4, ring.size());
+
+    int out[4] = {};
+    UNSIGNED_LONGS_EQUAL(4, ring.read(out, 4));
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+
+    for (int n = 0; n < 4; n++) {
+        LONGS_EQUAL(in[n], out[n]);
+    }
+}
+
+TEST(spsc_ring_buffer, full) {
+    SpscRingBuffer<int> ring(allocator, Capacity);
+    CHECK(ring.valid());
+
+    int in[Capacity + 5];
+    for (int n = 0; n < Capacity + 5; n++) {
+        in[n] = n;
+    }
+
+    // only capacity elements fit
+    UNSIGNED_LONGS_EQUAL(Capacity, ring.write(in, Capacity + 5));
+    UNSIGNED_LONGS_EQUAL(Capacity, ring.size());
+    UNSIGNED_LONGS_EQUAL(0, ring.write(in, 1));
+
+    int out[Capacity + 5] = {};
+    UNSIGNED_LONGS_EQUAL(Capacity, ring.read(out, Capacity + 5));
+
+    for (int n = 0; n < Capacity; n++) {
+        LONGS_EQUAL(n, out[n]);
+    }
+}
+
+TEST(spsc_ring_buffer, wrap_around) {
+    SpscRingBuffer<int> ring(allocator, Capacity);
+    CHECK(ring.valid());
+
+    int next_in = 0;
+    int next_out = 0;
+
+    for (int iter = 0; iter < 20; iter++) {
+        int in[7];
+        for (int n = 0; n < 7; n++) {
+            in[n] = next_in++;
+        }
+        UNSIGNED_LONGS_EQUAL(7, ring.write(in, 7));
+
+        int out[7] = {};
+        UNSIGNED_LONGS_EQUAL(7, ring.read(out, 7));
+        for (int n = 0; n < 7; n++) {
+            LONGS_EQUAL(next_out++, out[n]);
+        }
+    }
+}
+
+TEST(spsc_ring_buffer, concurrent) {
+    enum { NumElems = 100000 };
+
+    SpscRingBuffer<int> ring(allocator, Capacity);
+    CHECK(ring.valid());
+
+    Producer producer(ring, NumElems);
+    CHECK(producer.start());
+
+    int next = 0;
+    while (next < NumElems) {
+        int out[4];
+        const size_t n_read = ring.read(out, 4);
+        for (size_t n = 0; n < n_read; n++) {
+            LONGS_EQUAL(next, out[n]);
+            next++;
+        }
+    }
+
+    producer.join();
+
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+}
+
+} // namespace core
+} // namespace roc
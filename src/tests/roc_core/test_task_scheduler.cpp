@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/task_scheduler.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { NumThreads = 3, NumTasks = 100 };
+
+class TestTask : public SchedulerTask {
+public:
+    TestTask()
+        : n_calls(0)
+        , started(0)
+        , order(-1)
+        , counter_(NULL)
+        , block_(NULL) {
+    }
+
+    void set_counter(Atomic<int>* counter) {
+        counter_ = counter;
+    }
+
+    void set_block(Atomic<int>* block) {
+        block_ = block;
+    }
+
+    Atomic<int> n_calls;
+    Atomic<int> started;
+    int order;
+
+private:
+    virtual void execute() {
+        started = 1;
+        if (block_) {
+            while (*block_) {
+                sleep_for(ClockMonotonic, Microsecond * 100);
+            }
+        }
+        if (counter_) {
+            order = (*counter_)++;
+        }
+        n_calls++;
+    }
+
+    Atomic<int>* counter_;
+    Atomic<int>* block_;
+};
+
+// Fans out nested tasks from worker thread.
+class FanoutTask : public SchedulerTask {
+public:
+    FanoutTask(TaskScheduler& sched)
+        : sched_(sched) {
+    }
+
+    TestTask children[10];
+
+private:
+    virtual void execute() {
+        for (size_t n = 0; n < ROC_ARRAY_SIZE(children); n++) {
+            sched_.schedule(children[n]);
+        }
+        for (size_t n = 0; n < ROC_ARRAY_SIZE(children); n++) {
+            CHECK(sched_.join(children[n]));
+        }
+    }
+
+    TaskScheduler& sched_;
+};
+
+} // namespace
+
+TEST_GROUP(task_scheduler) {
+    HeapAllocator allocator;
+};
+
+TEST(task_scheduler, schedule_join) {
+    TaskScheduler sched(NumThreads, ThreadConfig(), allocator);
+    CHECK(sched.valid());
+    UNSIGNED_LONGS_EQUAL(NumThreads, sched.num_threads());
+
+    TestTask tasks[NumTasks];
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        CHECK(!tasks[n].finished());
+        sched.schedule(tasks[n]);
+    }
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        CHECK(sched.join(tasks[n]));
+        CHECK(tasks[n].finished());
+        LONGS_EQUAL(1, tasks[n].n_calls);
+    }
+}
+
+TEST(task_scheduler, reschedule) {
+    TaskScheduler sched(NumThreads, ThreadConfig(), allocator);
+    CHECK(sched.valid());
+
+    TestTask task;
+
+    for (int n = 0; n < 10; n++) {
+        sched.schedule(task);
+        CHECK(sched.join(task));
+        LONGS_EQUAL(n + 1, task.n_calls);
+    }
+}
+
+TEST(task_scheduler, no_threads) {
+    TaskScheduler sched(0, ThreadConfig(), allocator);
+    CHECK(sched.valid());
+
+    TestTask tasks[10];
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(tasks); n++) {
+        sched.schedule(tasks[n]);
+    }
+
+    // nobody executes tasks until join
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(tasks); n++) {
+        CHECK(!tasks[n].finished());
+    }
+
+    // joining thread executes tasks itself
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(tasks); n++) {
+        CHECK(sched.join(tasks[n]));
+        LONGS_EQUAL(1, tasks[n].n_calls);
+    }
+}
+
+TEST(task_scheduler, deadline_order) {
+    TaskScheduler sched(0, ThreadConfig(), allocator);
+    CHECK(sched.valid());
+
+    Atomic<int> counter(0);
+
+    TestTask no_deadline, late, early, middle;
+    no_deadline.set_counter(&counter);
+    late.set_counter(&counter);
+    early.set_counter(&counter);
+    middle.set_counter(&counter);
+
+    const nanoseconds_t now = timestamp(ClockMonotonic);
+
+    sched.schedule(no_deadline);
+    sched.schedule(late, now + 3 * Second);
+    sched.schedule(early, now + 1 * Second);
+    sched.schedule(middle, now + 2 * Second);
+
+    // joining the last task executes all tasks in deadline order
+    CHECK(sched.join(no_deadline));
+
+    LONGS_EQUAL(0, early.order);
+    LONGS_EQUAL(1, middle.order);
+    LONGS_EQUAL(2, late.order);
+    LONGS_EQUAL(3, no_deadline.order);
+
+    UNSIGNED_LONGS_EQUAL(0, sched.num_late_tasks());
+}
+
+TEST(task_scheduler, join_deadline) {
+    TaskScheduler sched(1, ThreadConfig(), allocator);
+    CHECK(sched.valid());
+
+    Atomic<int> block(1);
+
+    TestTask blocking;
+    blocking.set_block(&block);
+
+    sched.schedule(blocking);
+
+    // wait until worker picks the task, otherwise join() would execute it
+    // on this thread
+    while (!blocking.started) {
+        sleep_for(ClockMonotonic, Millisecond);
+    }
+
+    // deadline expires while task is running
+    const nanoseconds_t deadline = timestamp(ClockMonotonic) + 10 * Millisecond;
+    CHECK(!sched.join(blocking, deadline));
+    CHECK(timestamp(ClockMonotonic) >= deadline);
+    CHECK(!blocking.finished());
+
+    block = 0;
+
+    CHECK(sched.join(blocking));
+    CHECK(blocking.finished());
+}
+
+TEST(task_scheduler, late_tasks) {
+    TaskScheduler sched(0, ThreadConfig(), allocator);
+    CHECK(sched.valid());
+
+    TestTask task;
+
+    // deadline already expired
+    sched.schedule(task, timestamp(ClockMonotonic) - Second);
+    CHECK(sched.join(task));
+
+    UNSIGNED_LONGS_EQUAL(1, sched.num_late_tasks());
+}
+
+TEST(task_scheduler, nested) {
+    TaskScheduler sched(NumThreads, ThreadConfig(), allocator);
+    CHECK(sched.valid());
+
+    FanoutTask task(sched);
+
+    sched.schedule(task);
+    CHECK(sched.join(task));
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(task.children); n++) {
+        CHECK(task.children[n].finished());
+        LONGS_EQUAL(1, task.children[n].n_calls);
+    }
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <sched.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+class TestThread : public Thread {
+public:
+    TestThread()
+        : cpu_(-1)
+        , r_(0) {
+    }
+
+    TestThread(const ThreadConfig& config)
+        : Thread(config)
+        , cpu_(-1)
+        , r_(0) {
+    }
+
+    ~TestThread() {
+    }
+
+    bool ran() const {
+        return r_;
+    }
+
+    int cpu() const {
+        return cpu_;
+    }
+
+private:
+    virtual void run() {
+#if defined(__linux__) && defined(CPU_SET)
+        cpu_ = sched_getcpu();
+#endif
+        r_ = true;
+    }
+
+    Atomic<int> cpu_;
+    Atomic<int> r_;
+};
+
+} // namespace
+
+TEST_GROUP(thread) {};
+
+TEST(thread, start_join) {
+    TestThread thr;
+
+    CHECK(!thr.joinable());
+    CHECK(thr.start());
+    CHECK(thr.joinable());
+
+    thr.join();
+
+    CHECK(!thr.joinable());
+    CHECK(thr.ran());
+}
+
+TEST(thread, realtime_policy) {
+    ThreadConfig config;
+    config.policy = ThreadPolicy_Fifo;
+
+    // thread should run even if there are no privileges to change policy
+    TestThread thr(config);
+
+    CHECK(thr.start());
+    thr.join();
+
+    CHECK(thr.ran());
+}
+
+#if defined(__linux__) && defined(CPU_SET)
+
+TEST(thread, cpu_affinity) {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CHECK(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0);
+
+    // find last cpu allowed for this process
+    int cpu = -1;
+    for (size_t n = 0; n < 64; n++) {
+        if (CPU_ISSET(n, &cpu_set)) {
+            cpu = (int)n;
+        }
+    }
+    CHECK(cpu >= 0);
+
+    ThreadConfig config;
+    config.cpu_mask = (uint64_t)1 << cpu;
+
+    TestThread thr(config);
+
+    CHECK(thr.start());
+    thr.join();
+
+    CHECK(thr.ran());
+    LONGS_EQUAL(cpu, thr.cpu());
+}
+
+#endif // defined(__linux__) && defined(CPU_SET)
+
+} // namespace core
+} // namespace roc
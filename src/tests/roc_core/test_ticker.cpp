@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/ticker.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(ticker) {};
+
+TEST(ticker, elapsed) {
+    Ticker ticker(1000);
+
+    UNSIGNED_LONGS_EQUAL(0, ticker.elapsed());
+
+    sleep_for(ClockMonotonic, Millisecond * 5);
+
+    CHECK(ticker.elapsed() >= 5);
+}
+
+TEST(ticker, wait) {
+    enum { Rate = 44100, FrameSize = 441, NumFrames = 20 };
+
+    Ticker ticker(Rate);
+    ticker.start();
+
+    const nanoseconds_t start = timestamp(ClockMonotonic);
+
+    for (Ticker::ticks_t ts = 0; ts < FrameSize * NumFrames; ts += FrameSize) {
+        ticker.wait(ts);
+
+        // never wakes up before deadline
+        CHECK(ticker.elapsed() >= ts);
+    }
+
+    // total time is defined by absolute deadline, not sum of waits
+    CHECK(timestamp(ClockMonotonic) - start
+          >= nanoseconds_t(FrameSize * (NumFrames - 1)) * Second / Rate);
+}
+
+TEST(ticker, wait_past_deadline) {
+    Ticker ticker(1000);
+    ticker.start();
+
+    sleep_for(ClockMonotonic, Millisecond * 5);
+
+    // waiting for a tick in the past returns immediately
+    const nanoseconds_t before = timestamp(ClockMonotonic);
+    const nanoseconds_t delay = ticker.wait(1);
+    CHECK(timestamp(ClockMonotonic) - before < Second);
+
+    // and reports how late it is
+    CHECK(delay >= Millisecond * 4);
+}
+
+TEST(ticker, remaining) {
+    Ticker ticker(1000);
+
+    // not started yet, nothing to wait for
+    CHECK(ticker.remaining(1000) == 0);
+
+    ticker.start();
+
+    const nanoseconds_t remaining = ticker.remaining(1000);
+    CHECK(remaining > 0);
+    CHECK(remaining <= Second);
+
+    sleep_for(ClockMonotonic, Millisecond * 5);
+
+    // deadline is in the past
+    CHECK(ticker.remaining(5) == 0);
+}
+
+} // namespace core
+} // namespace roc
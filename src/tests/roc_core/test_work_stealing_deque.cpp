@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/thread.h"
+#include "roc_core/work_stealing_deque.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { NumThieves = 3, NumElements = 20000, Capacity = 64 };
+
+struct Element {
+    Atomic<int> n_taken;
+
+    Element()
+        : n_taken(0) {
+    }
+};
+
+class Thief : public Thread {
+public:
+    Thief(WorkStealingDeque<Element>& deque, Atomic<int>& stop)
+        : deque_(deque)
+        , stop_(stop)
+        , n_stolen_(0) {
+    }
+
+    size_t num_stolen() const {
+        return n_stolen_;
+    }
+
+private:
+    virtual void run() {
+        while (!stop_) {
+            if (Element* elem = deque_.steal()) {
+                elem->n_taken++;
+                n_stolen_++;
+            }
+        }
+    }
+
+    WorkStealingDeque<Element>& deque_;
+    Atomic<int>& stop_;
+    size_t n_stolen_;
+};
+
+} // namespace
+
+TEST_GROUP(work_stealing_deque) {
+    HeapAllocator allocator;
+};
+
+TEST(work_stealing_deque, push_pop) {
+    WorkStealingDeque<Element> deque(allocator, 4);
+    CHECK(deque.valid());
+    UNSIGNED_LONGS_EQUAL(4, deque.capacity());
+
+    Element elems[4];
+
+    POINTERS_EQUAL(NULL, deque.pop());
+
+    for (size_t n = 0; n < 4; n++) {
+        CHECK(deque.push(&elems[n]));
+    }
+
+    CHECK(!deque.push(&elems[0]));
+    UNSIGNED_LONGS_EQUAL(4, deque.size());
+
+    // owner pops in LIFO order
+    for (size_t n = 4; n > 0; n--) {
+        POINTERS_EQUAL(&elems[n - 1], deque.pop());
+    }
+
+    POINTERS_EQUAL(NULL, deque.pop());
+    UNSIGNED_LONGS_EQUAL(0, deque.size());
+}
+
+TEST(work_stealing_deque, push_steal) {
+    WorkStealingDeque<Element> deque(allocator, 3);
+    CHECK(deque.valid());
+    UNSIGNED_LONGS_EQUAL(4, deque.capacity());
+
+    Element elems[4];
+
+    for (size_t i = 0; i < 10; i++) {
+        for (size_t n = 0; n < 4; n++) {
+            CHECK(deque.push(&elems[n]));
+        }
+
+        // thieves steal in FIFO order
+        POINTERS_EQUAL(&elems[0], deque.steal());
+        POINTERS_EQUAL(&elems[1], deque.steal());
+
+        // both ends meet
+        POINTERS_EQUAL(&elems[3], deque.pop());
+        POINTERS_EQUAL(&elems[2], deque.steal());
+
+        POINTERS_EQUAL(NULL, deque.steal());
+        POINTERS_EQUAL(NULL, deque.pop());
+    }
+}
+
+TEST(work_stealing_deque, concurrent) {
+    WorkStealingDeque<Element> deque(allocator, Capacity);
+    CHECK(deque.valid());
+
+    Element* elems = new Element[NumElements];
+
+    Atomic<int> stop(0);
+
+    Thief* thieves[NumThieves];
+    for (size_t n = 0; n < NumThieves; n++) {
+        thieves[n] = new Thief(deque, stop);
+        CHECK(thieves[n]->start());
+    }
+
+    size_t n_popped = 0;
+
+    for (size_t n = 0; n < NumElements; n++) {
+        while (!deque.push(&elems[n])) {
+            if (Element* elem = deque.pop()) {
+                elem->n_taken++;
+                n_popped++;
+            }
+        }
+
+        // pop sometimes, to race with thieves for the last element
+        if (n % 3 == 0) {
+            if (Element* elem = deque.pop()) {
+                elem->n_taken++;
+                n_popped++;
+            }
+        }
+    }
+
+    while (Element* elem = deque.pop()) {
+        elem->n_taken++;
+        n_popped++;
+    }
+
+    stop = 1;
+
+    size_t n_stolen = 0;
+    for (size_t n = 0; n < NumThieves; n++) {
+        thieves[n]->join();
+        n_stolen += thieves[n]->num_stolen();
+        delete thieves[n];
+    }
+
+    // every element is taken exactly once
+    UNSIGNED_LONGS_EQUAL(NumElements, n_popped + n_stolen);
+    for (size_t n = 0; n < NumElements; n++) {
+        LONGS_EQUAL(1, elems[n].n_taken);
+    }
+
+    delete[] elems;
+}
+
+} // namespace core
+} // namespace roc
@@ -74,6 +74,33 @@ BENCHMARK_REGISTER_F(BM_QueueContention, Schedule)
     ->Iterations(NumScheduleIterations)
     ->Unit(benchmark::kMicrosecond);
 
+BENCHMARK_DEFINE_F(BM_QueueContention, ScheduleBatch)(benchmark::State& state) {
+    NoopExecutor::Task* tasks = new NoopExecutor::Task[NumScheduleIterations];
+    ControlTask** task_ptrs = new ControlTask*[NumScheduleIterations];
+    size_t n_task = 0;
+
+    for (int n = 0; n < NumScheduleIterations; n++) {
+        task_ptrs[n] = &tasks[n];
+    }
+
+    while (state.KeepRunningBatch(BatchSize)) {
+        queue.schedule_batch(task_ptrs + n_task, BatchSize, executor, &completer);
+        n_task += BatchSize;
+    }
+
+    for (int n = 0; n < NumScheduleIterations; n++) {
+        queue.wait(tasks[n]);
+    }
+
+    delete[] task_ptrs;
+    delete[] tasks;
+}
+
+BENCHMARK_REGISTER_F(BM_QueueContention, ScheduleBatch)
+    ->ThreadRange(1, NumThreads)
+    ->Iterations(NumScheduleIterations)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_DEFINE_F(BM_QueueContention, ScheduleAt)(benchmark::State& state) {
     NoopExecutor::Task* tasks = new NoopExecutor::Task[NumScheduleAfterIterations];
     size_t n_task = 0;
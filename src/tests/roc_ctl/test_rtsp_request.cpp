@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/macro_helpers.h"
+#include "roc_ctl/rtsp_request.h"
+
+namespace roc {
+namespace ctl {
+
+TEST_GROUP(rtsp_request) {};
+
+TEST(rtsp_request, options) {
+    const char* str = "OPTIONS rtsp://127.0.0.1:554/stream RTSP/1.0\r\n"
+                      "CSeq: 1\r\n"
+                      "User-Agent: test\r\n"
+                      "\r\n";
+
+    RtspRequest request;
+    LONGS_EQUAL(strlen(str), parse_rtsp_request(str, strlen(str), request));
+
+    LONGS_EQUAL(RtspMethod_Options, request.method);
+    STRCMP_EQUAL("rtsp://127.0.0.1:554/stream", request.uri);
+    UNSIGNED_LONGS_EQUAL(1, request.cseq);
+    STRCMP_EQUAL("", request.transport);
+    STRCMP_EQUAL("", request.session);
+    UNSIGNED_LONGS_EQUAL(0, request.content_length);
+}
+
+TEST(rtsp_request, headers) {
+    const char* str = "SETUP rtsp://host/stream/source RTSP/1.0\n"
+                      "cseq:   42  \n"
+                      "TRANSPORT: RTP/AVP;unicast;client_port=4588-4589\n"
+                      "Session: 12345678;timeout=60\n"
+                      "\n";
+
+    RtspRequest request;
+    LONGS_EQUAL(strlen(str), parse_rtsp_request(str, strlen(str), request));
+
+    LONGS_EQUAL(RtspMethod_Setup, request.method);
+    STRCMP_EQUAL("rtsp://host/stream/source", request.uri);
+    UNSIGNED_LONGS_EQUAL(42, request.cseq);
+    STRCMP_EQUAL("RTP/AVP;unicast;client_port=4588-4589", request.transport);
+    STRCMP_EQUAL("12345678", request.session);
+}
+
+TEST(rtsp_request, methods) {
+    const char* methods[] = { "OPTIONS", "DESCRIBE", "SETUP", "PLAY", "TEARDOWN",
+                              "RECORD" };
+    const RtspMethod ids[] = { RtspMethod_Options, RtspMethod_Describe,
+                               RtspMethod_Setup,   RtspMethod_Play,
+                               RtspMethod_Teardown, RtspMethod_Unknown };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(methods); n++) {
+        char str[128];
+        snprintf(str, sizeof(str), "%s * RTSP/1.0\r\nCSeq: 2\r\n\r\n", methods[n]);
+
+        RtspRequest request;
+        LONGS_EQUAL(strlen(str), parse_rtsp_request(str, strlen(str), request));
+        LONGS_EQUAL(ids[n], request.method);
+    }
+}
+
+TEST(rtsp_request, incomplete) {
+    const char* str = "DESCRIBE rtsp://host/stream RTSP/1.0\r\n"
+                      "CSeq: 3\r\n"
+                      "\r\n";
+
+    for (size_t len = 0; len < strlen(str); len++) {
+        RtspRequest request;
+        LONGS_EQUAL(0, parse_rtsp_request(str, len, request));
+    }
+}
+
+TEST(rtsp_request, body) {
+    const char* str = "SET_PARAMETER rtsp://host/stream RTSP/1.0\r\n"
+                      "CSeq: 4\r\n"
+                      "Content-Length: 5\r\n"
+                      "\r\n"
+                      "hello"
+                      "OPTIONS * RTSP/1.0\r\n";
+
+    const size_t first_len = strlen(str) - strlen("OPTIONS * RTSP/1.0\r\n");
+
+    RtspRequest request;
+    LONGS_EQUAL(0, parse_rtsp_request(str, first_len - 1, request));
+    LONGS_EQUAL(first_len, parse_rtsp_request(str, strlen(str), request));
+
+    LONGS_EQUAL(RtspMethod_Unknown, request.method);
+    UNSIGNED_LONGS_EQUAL(5, request.content_length);
+
+    // second request is incomplete
+    LONGS_EQUAL(0, parse_rtsp_request(str + first_len, strlen(str) - first_len,
+                                      request));
+}
+
+TEST(rtsp_request, malformed) {
+    const char* strs[] = {
+        // no method
+        " rtsp://host/stream RTSP/1.0\r\nCSeq: 1\r\n\r\n",
+        // no version
+        "OPTIONS rtsp://host/stream\r\nCSeq: 1\r\n\r\n",
+        // bad version
+        "OPTIONS rtsp://host/stream HTTP/1.1\r\nCSeq: 1\r\n\r\n",
+        // no CSeq
+        "OPTIONS rtsp://host/stream RTSP/1.0\r\n\r\n",
+        // bad CSeq
+        "OPTIONS rtsp://host/stream RTSP/1.0\r\nCSeq: one\r\n\r\n",
+        // bad Content-Length
+        "OPTIONS rtsp://host/stream RTSP/1.0\r\nCSeq: 1\r\nContent-Length: -1\r\n\r\n",
+        // no colon
+        "OPTIONS rtsp://host/stream RTSP/1.0\r\nCSeq: 1\r\nSession\r\n\r\n",
+    };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(strs); n++) {
+        RtspRequest request;
+        LONGS_EQUAL(-1, parse_rtsp_request(strs[n], strlen(strs[n]), request));
+    }
+}
+
+TEST(rtsp_request, too_long) {
+    char str[1024] = "OPTIONS rtsp://host/";
+    for (size_t n = 0; n < RtspRequest::MaxUriLen; n++) {
+        strcat(str, "a");
+    }
+    strcat(str, " RTSP/1.0\r\nCSeq: 1\r\n\r\n");
+
+    RtspRequest request;
+    LONGS_EQUAL(-1, parse_rtsp_request(str, strlen(str), request));
+}
+
+} // namespace ctl
+} // namespace roc
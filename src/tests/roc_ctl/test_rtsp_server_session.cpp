@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_ctl/rtsp_server_session.h"
+
+namespace roc {
+namespace ctl {
+
+namespace {
+
+enum { MaxResponseLen = 2048 };
+
+const char* LocalHost = "192.168.0.1";
+
+RtspMediaInfo make_media(bool with_fec) {
+    RtspMediaInfo media;
+    media.source_port = 10001;
+    media.control_port = 10003;
+    if (with_fec) {
+        media.source_proto = address::Proto_RTP_RS8M_Source;
+        media.repair_port = 10002;
+    } else {
+        media.source_proto = address::Proto_RTP;
+    }
+    return media;
+}
+
+void request(RtspServerSession& session,
+             const RtspMediaInfo& media,
+             const char* req,
+             char* resp,
+             size_t resp_size) {
+    RtspRequest parsed;
+    CHECK(parse_rtsp_request(req, strlen(req), parsed) == (ssize_t)strlen(req));
+
+    core::StringBuilder builder(resp, resp_size);
+    CHECK(session.handle_request(parsed, media, LocalHost, builder));
+}
+
+void expect_status(const char* resp, const char* status) {
+    CHECK(strncmp(resp, status, strlen(status)) == 0);
+    CHECK(strstr(resp, "\r\n\r\n"));
+}
+
+} // namespace
+
+TEST_GROUP(rtsp_server_session) {};
+
+TEST(rtsp_server_session, options) {
+    RtspServerSession session("/stream", "abcd");
+    CHECK(session.valid());
+
+    char resp[MaxResponseLen];
+    request(session, make_media(false), "OPTIONS * RTSP/1.0\r\nCSeq: 7\r\n\r\n", resp,
+            sizeof(resp));
+
+    STRCMP_EQUAL("RTSP/1.0 200 OK\r\n"
+                 "CSeq: 7\r\n"
+                 "Public: OPTIONS, DESCRIBE, SETUP, PLAY, TEARDOWN\r\n"
+                 "\r\n",
+                 resp);
+}
+
+TEST(rtsp_server_session, describe) {
+    RtspServerSession session("/stream", "abcd");
+    CHECK(session.valid());
+
+    char resp[MaxResponseLen];
+    request(session, make_media(true),
+            "DESCRIBE rtsp://192.168.0.1:554/stream RTSP/1.0\r\nCSeq: 2\r\n\r\n", resp,
+            sizeof(resp));
+
+    const char* sdp = "v=0\r\n"
+                      "o=- abcd 1 IN IP4 192.168.0.1\r\n"
+                      "s=Roc Streaming\r\n"
+                      "c=IN IP4 192.168.0.1\r\n"
+                      "t=0 0\r\n"
+                      "m=audio 10001 RTP/AVP 10 11\r\n"
+                      "a=rtpmap:10 L16/44100/2\r\n"
+                      "a=rtpmap:11 L16/44100/1\r\n"
+                      "a=rtcp:10003\r\n"
+                      "a=fec-source-flow: id=0\r\n"
+                      "a=control:source\r\n"
+                      "m=application 10002 UDP/FEC\r\n"
+                      "a=fec-repair-flow: encoding-id=8\r\n"
+                      "a=control:repair\r\n";
+
+    char expected[MaxResponseLen];
+    snprintf(expected, sizeof(expected),
+             "RTSP/1.0 200 OK\r\n"
+             "CSeq: 2\r\n"
+             "Content-Base: rtsp://192.168.0.1:554/stream/\r\n"
+             "Content-Type: application/sdp\r\n"
+             "Content-Length: %lu\r\n"
+             "\r\n"
+             "%s",
+             (unsigned long)strlen(sdp), sdp);
+
+    STRCMP_EQUAL(expected, resp);
+}
+
+TEST(rtsp_server_session, describe_without_fec) {
+    RtspServerSession session("/", "abcd");
+    CHECK(session.valid());
+
+    char resp[MaxResponseLen];
+    request(session, make_media(false),
+            "DESCRIBE rtsp://host RTSP/1.0\r\nCSeq: 2\r\n\r\n", resp, sizeof(resp));
+
+    expect_status(resp, "RTSP/1.0 200 OK\r\n");
+    CHECK(strstr(resp, "m=audio 10001 RTP/AVP"));
+    CHECK(strstr(resp, "a=rtcp:10003\r\n"));
+    CHECK(!strstr(resp, "m=application"));
+    CHECK(!strstr(resp, "a=fec-"));
+}
+
+TEST(rtsp_server_session, describe_errors) {
+    RtspServerSession session("/stream", "abcd");
+    CHECK(session.valid());
+
+    char resp[MaxResponseLen];
+
+    // unknown path
+    request(session, make_media(false),
+            "DESCRIBE rtsp://host/other RTSP/1.0\r\nCSeq: 1\r\n\r\n", resp,
+            sizeof(resp));
+    expect_status(resp, "RTSP/1.0 404 ");
+
+    // no source attached yet
+    request(session, RtspMediaInfo(),
+            "DESCRIBE rtsp://host/stream RTSP/1.0\r\nCSeq: 2\r\n\r\n", resp,
+            sizeof(resp));
+    expect_status(resp, "RTSP/1.0 503 ");
+}
+
+TEST(rtsp_server_session, setup_play_teardown) {
+    RtspServerSession session("/stream", "abcd");
+    CHECK(session.valid());
+
+    const RtspMediaInfo media = make_media(true);
+    char resp[MaxResponseLen];
+
+    // play before setup
+    request(session, media, "PLAY rtsp://host/stream RTSP/1.0\r\nCSeq: 1\r\n\r\n",
+            resp, sizeof(resp));
+    expect_status(resp, "RTSP/1.0 454 ");
+
+    request(session, media,
+            "SETUP rtsp://host/stream/source RTSP/1.0\r\nCSeq: 2\r\n"
+            "Transport: RTP/AVP;unicast;client_port=5000-5001\r\n\r\n",
+            resp, sizeof(resp));
+    STRCMP_EQUAL("RTSP/1.0 200 OK\r\n"
+                 "CSeq: 2\r\n"
+                 "Transport: RTP/AVP;unicast;client_port=5000-5001;"
+                 "server_port=10001-10003\r\n"
+                 "Session: abcd\r\n"
+                 "\r\n",
+                 resp);
+
+    request(session, media,
+            "SETUP rtsp://host/stream/repair RTSP/1.0\r\nCSeq: 3\r\nSession: abcd\r\n"
+            "Transport: RTP/AVP;unicast;client_port=5002\r\n\r\n",
+            resp, sizeof(resp));
+    expect_status(resp, "RTSP/1.0 200 OK\r\n");
+    CHECK(strstr(resp, ";server_port=10002\r\n"));
+
+    CHECK(!session.is_playing());
+
+    // wrong session
+    request(session, media,
+            "PLAY rtsp://host/stream RTSP/1.0\r\nCSeq: 4\r\nSession: dcba\r\n\r\n", resp,
+            sizeof(resp));
+    expect_status(resp, "RTSP/1.0 454 ");
+    CHECK(!session.is_playing());
+
+    request(session, media,
+            "PLAY rtsp://host/stream RTSP/1.0\r\nCSeq: 5\r\nSession: abcd\r\n\r\n", resp,
+            sizeof(resp));
+    expect_status(resp, "RTSP/1.0 200 OK\r\nCSeq: 5\r\nSession: abcd\r\n");
+    CHECK(session.is_playing());
+
+    request(session, media,
+            "TEARDOWN rtsp://host/stream RTSP/1.0\r\nCSeq: 6\r\nSession: abcd\r\n\r\n",
+            resp, sizeof(resp));
+    STRCMP_EQUAL("RTSP/1.0 200 OK\r\nCSeq: 6\r\n\r\n", resp);
+    CHECK(!session.is_playing());
+}
+
+TEST(rtsp_server_session, setup_errors) {
+    RtspServerSession session("/stream", "abcd");
+    CHECK(session.valid());
+
+    char resp[MaxResponseLen];
+
+    // aggregate setup with several media
+    request(session, make_media(true),
+            "SETUP rtsp://host/stream RTSP/1.0\r\nCSeq: 1\r\n"
+            "Transport: RTP/AVP;unicast\r\n\r\n",
+            resp, sizeof(resp));
+    expect_status(resp, "RTSP/1.0 459 ");
+
+    // unknown track
+    request(session, make_media(false),
+            "SETUP rtsp://host/stream/video RTSP/1.0\r\nCSeq: 2\r\n"
+            "Transport: RTP/AVP;unicast\r\n\r\n",
+            resp, sizeof(resp));
+    expect_status(resp, "RTSP/1.0 404 ");
+
+    // repair not bound
+    request(session, make_media(false),
+            "SETUP rtsp://host/stream/repair RTSP/1.0\r\nCSeq: 3\r\n"
+            "Transport: RTP/AVP;unicast\r\n\r\n",
+            resp, sizeof(resp));
+    expect_status(resp, "RTSP/1.0 404 ");
+
+    // interleaved transport
+    request(session, make_media(false),
+            "SETUP rtsp://host/stream RTSP/1.0\r\nCSeq: 4\r\n"
+            "Transport: RTP/AVP/TCP;interleaved=0-1\r\n\r\n",
+            resp, sizeof(resp));
+    expect_status(resp, "RTSP/1.0 461 ");
+
+    // unknown method
+    request(session, make_media(false),
+            "RECORD rtsp://host/stream RTSP/1.0\r\nCSeq: 5\r\n\r\n", resp,
+            sizeof(resp));
+    expect_status(resp, "RTSP/1.0 501 ");
+
+    CHECK(!session.is_playing());
+}
+
+TEST(rtsp_server_session, bad_request) {
+    RtspServerSession session("/stream", "abcd");
+    CHECK(session.valid());
+
+    char resp[MaxResponseLen];
+    core::StringBuilder builder(resp, sizeof(resp));
+
+    CHECK(session.handle_bad_request(builder));
+    expect_status(resp, "RTSP/1.0 400 Bad Request\r\n");
+}
+
+TEST(rtsp_server_session, small_buffer) {
+    RtspServerSession session("/stream", "abcd");
+    CHECK(session.valid());
+
+    const char* req = "DESCRIBE rtsp://host/stream RTSP/1.0\r\nCSeq: 1\r\n\r\n";
+
+    RtspRequest parsed;
+    CHECK(parse_rtsp_request(req, strlen(req), parsed) > 0);
+
+    char resp[64];
+    core::StringBuilder builder(resp, sizeof(resp));
+
+    CHECK(!session.handle_request(parsed, make_media(true), LocalHost, builder));
+}
+
+} // namespace ctl
+} // namespace roc
@@ -23,8 +23,8 @@ class TestExecutor : public ControlTaskExecutor<TestExecutor> {
 public:
     class Task : public ControlTask {
     public:
-        Task()
-            : ControlTask(&TestExecutor::do_task_) {
+        Task(ControlTaskPriority priority = ControlTaskNormalPriority)
+            : ControlTask(&TestExecutor::do_task_, priority) {
         }
     };
 
@@ -385,6 +385,58 @@ TEST(task_queue, schedule_many_batched) {
     executor.check_all_unblocked();
 }
 
+TEST(task_queue, schedule_batch) {
+    enum { NumTasks = 20 };
+
+    TestExecutor executor;
+
+    ControlTaskQueue queue;
+    CHECK(queue.valid());
+
+    TestExecutor::Task tasks[NumTasks];
+    ControlTask* task_ptrs[NumTasks];
+
+    TestCompleter completer;
+    completer.expect_success(true);
+    completer.expect_cancelled(false);
+    completer.expect_n_calls(NumTasks);
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        executor.set_nth_result(n, true);
+        task_ptrs[n] = &tasks[n];
+    }
+
+    executor.block();
+
+    queue.schedule_batch(task_ptrs, NumTasks, executor, &completer);
+
+    // tasks are executed in submission order
+    for (size_t n = 0; n < NumTasks; n++) {
+        executor.unblock_one();
+
+        CHECK(completer.wait_called() == &tasks[n]);
+
+        UNSIGNED_LONGS_EQUAL(n + 1, executor.num_tasks());
+        CHECK(executor.nth_task(n) == &tasks[n]);
+
+        CHECK(tasks[n].succeeded());
+        CHECK(!tasks[n].cancelled());
+    }
+
+    executor.check_all_unblocked();
+}
+
+TEST(task_queue, schedule_batch_empty) {
+    TestExecutor executor;
+
+    ControlTaskQueue queue;
+    CHECK(queue.valid());
+
+    queue.schedule_batch(NULL, 0, executor, NULL);
+
+    UNSIGNED_LONGS_EQUAL(0, executor.num_tasks());
+}
+
 TEST(task_queue, schedule_and_wait_one) {
     { // success
         TestExecutor executor;
@@ -756,6 +808,115 @@ TEST(task_queue, schedule_at_same_deadline) {
     executor.check_all_unblocked();
 }
 
+TEST(task_queue, schedule_high_priority) {
+    enum { NumTasks = 6 };
+
+    TestExecutor executor;
+
+    ControlTaskQueue queue;
+    CHECK(queue.valid());
+
+    TestExecutor::Task first_task;
+    TestExecutor::Task normal_tasks[3];
+    TestExecutor::Task high_task_1(ControlTaskHighPriority);
+    TestExecutor::Task high_task_2(ControlTaskHighPriority);
+
+    ControlTask* task_ptrs[NumTasks] = {
+        &first_task,      &normal_tasks[0], &high_task_1,
+        &normal_tasks[1], &high_task_2,     &normal_tasks[2],
+    };
+
+    // high priority tasks overtake normal priority tasks
+    ControlTask* expected_order[NumTasks] = {
+        &first_task,      &high_task_1,     &high_task_2,
+        &normal_tasks[0], &normal_tasks[1], &normal_tasks[2],
+    };
+
+    TestCompleter completer;
+    completer.expect_success(true);
+    completer.expect_n_calls(NumTasks);
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        executor.set_nth_result(n, true);
+    }
+
+    executor.block();
+
+    queue.schedule(*task_ptrs[0], executor, &completer);
+
+    executor.wait_blocked();
+
+    for (size_t n = 1; n < NumTasks; n++) {
+        queue.schedule(*task_ptrs[n], executor, &completer);
+    }
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        executor.unblock_one();
+
+        CHECK(completer.wait_called() == expected_order[n]);
+
+        UNSIGNED_LONGS_EQUAL(n + 1, executor.num_tasks());
+        CHECK(executor.nth_task(n) == expected_order[n]);
+
+        CHECK(expected_order[n]->succeeded());
+    }
+
+    executor.check_all_unblocked();
+}
+
+TEST(task_queue, schedule_at_high_priority) {
+    TestExecutor executor;
+
+    ControlTaskQueue queue;
+    CHECK(queue.valid());
+
+    TestCompleter completer;
+    completer.expect_success(true);
+    completer.expect_n_calls(3);
+
+    TestExecutor::Task first_task;
+    TestExecutor::Task normal_task;
+    TestExecutor::Task high_task(ControlTaskHighPriority);
+
+    executor.set_nth_result(0, true);
+    executor.set_nth_result(1, true);
+    executor.set_nth_result(2, true);
+
+    executor.block();
+
+    queue.schedule(first_task, executor, &completer);
+
+    executor.wait_blocked();
+
+    const core::nanoseconds_t deadline =
+        core::timestamp(core::ClockMonotonic) + core::Millisecond;
+
+    queue.schedule_at(normal_task, deadline, executor, &completer);
+    queue.schedule_at(high_task, deadline, executor, &completer);
+
+    // wait until deadline expires while executor is blocked
+    core::sleep_for(core::ClockMonotonic, core::Millisecond * 10);
+
+    executor.unblock_one();
+    CHECK(completer.wait_called() == &first_task);
+    UNSIGNED_LONGS_EQUAL(1, executor.num_tasks());
+
+    // among tasks with same deadline, high priority task goes first
+    executor.unblock_one();
+    CHECK(completer.wait_called() == &high_task);
+    UNSIGNED_LONGS_EQUAL(2, executor.num_tasks());
+
+    executor.unblock_one();
+    CHECK(completer.wait_called() == &normal_task);
+    UNSIGNED_LONGS_EQUAL(3, executor.num_tasks());
+
+    CHECK(first_task.succeeded());
+    CHECK(normal_task.succeeded());
+    CHECK(high_task.succeeded());
+
+    executor.check_all_unblocked();
+}
+
 TEST(task_queue, schedule_at_and_schedule) {
     TestExecutor executor;
 
@@ -1324,6 +1485,66 @@ TEST(task_queue, reschedule_cancelled) {
     UNSIGNED_LONGS_EQUAL(1, executor.num_tasks());
 }
 
+TEST(task_queue, reschedule_cancelled_and_cancel) {
+    TestExecutor executor;
+
+    ControlTaskQueue queue;
+    CHECK(queue.valid());
+
+    UNSIGNED_LONGS_EQUAL(0, executor.num_tasks());
+
+    TestCompleter blocker_completer;
+    TestCompleter completer;
+
+    TestExecutor::Task blocker_task;
+    TestExecutor::Task task;
+
+    completer.expect_success(false);
+    completer.expect_cancelled(true);
+    completer.expect_n_calls(1);
+
+    queue.schedule_at(task, now_plus_delay(core::Second * 999), executor, &completer);
+
+    queue.async_cancel(task);
+    queue.wait(task);
+
+    CHECK(completer.wait_called() == &task);
+
+    CHECK(!task.succeeded());
+    CHECK(task.cancelled());
+
+    blocker_completer.expect_success(true);
+    blocker_completer.expect_cancelled(false);
+    blocker_completer.expect_n_calls(1);
+
+    completer.expect_success(false);
+    completer.expect_cancelled(true);
+    completer.expect_n_calls(1);
+
+    executor.set_nth_result(0, true);
+    executor.block();
+
+    queue.schedule(blocker_task, executor, &blocker_completer);
+    executor.wait_blocked();
+
+    // re-schedule cancelled task and cancel it again while the event loop
+    // is busy and can't fetch it from the ready queue
+    queue.schedule(task, executor, &completer);
+    queue.async_cancel(task);
+
+    executor.unblock_one();
+
+    CHECK(blocker_completer.wait_called() == &blocker_task);
+    CHECK(completer.wait_called() == &task);
+
+    CHECK(!task.succeeded());
+    CHECK(task.cancelled());
+
+    UNSIGNED_LONGS_EQUAL(1, executor.num_tasks());
+
+    executor.check_all_unblocked();
+}
+
 TEST(task_queue, no_starvation) {
     TestExecutor executor;
 
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_fec/codec_map.h"
+
+namespace roc {
+namespace fec {
+namespace {
+
+enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 1024 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, PayloadSize, true);
+
+void run_encode(benchmark::State& state, packet::FecScheme scheme) {
+    if (!CodecMap::instance().is_supported(scheme)) {
+        state.SkipWithError("scheme not supported");
+        return;
+    }
+
+    CodecConfig config;
+    config.scheme = scheme;
+
+    core::ScopedPtr<IBlockEncoder> encoder(
+        CodecMap::instance().new_encoder(config, buffer_factory, allocator), allocator);
+    if (!encoder) {
+        state.SkipWithError("can't create encoder");
+        return;
+    }
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = buffer_factory.new_buffer();
+        buffers[i].reslice(0, PayloadSize);
+        for (size_t j = 0; j < PayloadSize; j++) {
+            buffers[i].data()[j] = (uint8_t)(i + j);
+        }
+    }
+
+    while (state.KeepRunning()) {
+        encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize);
+        for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+            encoder->set(i, buffers[i]);
+        }
+        encoder->fill();
+        encoder->end();
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * NumSourcePackets);
+}
+
+void BM_Codec_Encode_ReedSolomon(benchmark::State& state) {
+    run_encode(state, packet::FEC_ReedSolomon_M8);
+}
+
+BENCHMARK(BM_Codec_Encode_ReedSolomon);
+
+void BM_Codec_Encode_LDPC(benchmark::State& state) {
+    run_encode(state, packet::FEC_LDPC_Staircase);
+}
+
+BENCHMARK(BM_Codec_Encode_LDPC);
+
+} // namespace
+} // namespace fec
+} // namespace roc
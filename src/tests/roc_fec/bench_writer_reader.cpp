@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_fec/composer.h"
+#include "roc_fec/headers.h"
+#include "roc_fec/parser.h"
+#include "roc_fec/reader.h"
+#include "roc_fec/writer.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/format_map.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/parser.h"
+
+// FEC writer and reader throughput, in source packets per second.
+//
+// Encode benchmarks measure fec::Writer producing repair packets for every
+// block. Decode benchmarks measure fec::Reader restoring lost packets; the
+// argument is packet loss rate in percent, for both source and repair packets.
+// Losses are random, so some blocks may be not recoverable at high loss rates;
+// "delivered" counter shows the fraction of source packets returned by reader.
+
+namespace roc {
+namespace fec {
+namespace {
+
+enum {
+    NumSourcePackets = 20,
+    NumRepairPackets = 10,
+    PayloadSize = 1000,
+    MaxBuffSize = 1500,
+    SourceID = 555
+};
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBuffSize, false);
+packet::PacketFactory packet_factory(allocator, false);
+
+rtp::FormatMap format_map;
+rtp::Parser rtp_parser(format_map, NULL);
+rtp::Composer rtp_composer(NULL);
+
+Parser<RS8M_PayloadID, Source, Footer> rs8m_source_parser(&rtp_parser);
+Parser<RS8M_PayloadID, Repair, Header> rs8m_repair_parser(NULL);
+Parser<LDPC_Source_PayloadID, Source, Footer> ldpc_source_parser(&rtp_parser);
+Parser<LDPC_Repair_PayloadID, Repair, Header> ldpc_repair_parser(NULL);
+
+Composer<RS8M_PayloadID, Source, Footer> rs8m_source_composer(&rtp_composer);
+Composer<RS8M_PayloadID, Repair, Header> rs8m_repair_composer(NULL);
+Composer<LDPC_Source_PayloadID, Source, Footer> ldpc_source_composer(&rtp_composer);
+Composer<LDPC_Repair_PayloadID, Repair, Header> ldpc_repair_composer(NULL);
+
+packet::IParser& source_parser(packet::FecScheme scheme) {
+    return scheme == packet::FEC_ReedSolomon_M8
+        ? (packet::IParser&)rs8m_source_parser
+        : (packet::IParser&)ldpc_source_parser;
+}
+
+packet::IParser& repair_parser(packet::FecScheme scheme) {
+    return scheme == packet::FEC_ReedSolomon_M8
+        ? (packet::IParser&)rs8m_repair_parser
+        : (packet::IParser&)ldpc_repair_parser;
+}
+
+packet::IComposer& source_composer(packet::FecScheme scheme) {
+    return scheme == packet::FEC_ReedSolomon_M8
+        ? (packet::IComposer&)rs8m_source_composer
+        : (packet::IComposer&)ldpc_source_composer;
+}
+
+packet::IComposer& repair_composer(packet::FecScheme scheme) {
+    return scheme == packet::FEC_ReedSolomon_M8
+        ? (packet::IComposer&)rs8m_repair_composer
+        : (packet::IComposer&)ldpc_repair_composer;
+}
+
+// Drops packets with given probability, reparses and queues remaining ones.
+class LossyNetwork : public packet::IWriter {
+public:
+    LossyNetwork(packet::FecScheme scheme, size_t loss_percent)
+        : source_parser_(source_parser(scheme))
+        , repair_parser_(repair_parser(scheme))
+        , loss_percent_(loss_percent) {
+    }
+
+    packet::IReader& source_reader() {
+        return source_queue_;
+    }
+
+    packet::IReader& repair_reader() {
+        return repair_queue_;
+    }
+
+    virtual void write(const packet::PacketPtr& pp) {
+        if (loss_percent_ != 0 && core::fast_random(0, 99) < loss_percent_) {
+            return;
+        }
+
+        const bool is_repair = (pp->flags() & packet::Packet::FlagRepair);
+
+        packet::PacketPtr rp = packet_factory.new_packet();
+        if (!rp) {
+            roc_panic("lossy network: can't allocate packet");
+        }
+
+        if (!(is_repair ? repair_parser_ : source_parser_).parse(*rp, pp->data())) {
+            roc_panic("lossy network: can't parse packet");
+        }
+        rp->set_data(pp->data());
+
+        if (is_repair) {
+            repair_queue_.write(rp);
+        } else {
+            source_queue_.write(rp);
+        }
+    }
+
+private:
+    packet::IParser& source_parser_;
+    packet::IParser& repair_parser_;
+
+    const size_t loss_percent_;
+
+    packet::Queue source_queue_;
+    packet::Queue repair_queue_;
+};
+
+// Discards packets.
+class NullWriter : public packet::IWriter {
+public:
+    virtual void write(const packet::PacketPtr& pp) {
+        benchmark::DoNotOptimize(pp.get());
+    }
+};
+
+packet::PacketPtr new_packet(packet::FecScheme scheme, size_t sn) {
+    packet::PacketPtr pp = packet_factory.new_packet();
+    if (!pp) {
+        roc_panic("bench: can't allocate packet");
+    }
+
+    core::Slice<uint8_t> bp = buffer_factory.new_buffer();
+    if (!bp) {
+        roc_panic("bench: can't allocate buffer");
+    }
+
+    if (!source_composer(scheme).prepare(*pp, bp, PayloadSize)) {
+        roc_panic("bench: can't prepare packet");
+    }
+    pp->set_data(bp);
+
+    pp->add_flags(packet::Packet::FlagAudio);
+
+    pp->rtp()->source = SourceID;
+    pp->rtp()->payload_type = rtp::PayloadType_L16_Stereo;
+    pp->rtp()->seqnum = packet::seqnum_t(sn);
+    pp->rtp()->timestamp = packet::timestamp_t(sn * 10);
+
+    for (size_t n = 0; n < PayloadSize; n++) {
+        pp->rtp()->payload.data()[n] = uint8_t(sn + n);
+    }
+
+    return pp;
+}
+
+void write_block(Writer& writer, packet::FecScheme scheme, size_t& sn) {
+    for (size_t n = 0; n < NumSourcePackets; n++) {
+        writer.write(new_packet(scheme, sn++));
+    }
+}
+
+void run_encode(benchmark::State& state, packet::FecScheme scheme) {
+    if (!CodecMap::instance().is_supported(scheme)) {
+        state.SkipWithError("scheme not supported");
+        return;
+    }
+
+    CodecConfig codec_config;
+    codec_config.scheme = scheme;
+
+    WriterConfig writer_config;
+    writer_config.n_source_packets = NumSourcePackets;
+    writer_config.n_repair_packets = NumRepairPackets;
+
+    core::ScopedPtr<IBlockEncoder> encoder(
+        CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+        allocator);
+    if (!encoder) {
+        state.SkipWithError("can't create encoder");
+        return;
+    }
+
+    NullWriter network;
+
+    Writer writer(writer_config, scheme, *encoder, network, source_composer(scheme),
+                  repair_composer(scheme), packet_factory, buffer_factory, allocator);
+    if (!writer.valid()) {
+        state.SkipWithError("can't create writer");
+        return;
+    }
+
+    size_t sn = 0;
+
+    while (state.KeepRunningBatch(NumSourcePackets)) {
+        write_block(writer, scheme, sn);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+void run_decode(benchmark::State& state, packet::FecScheme scheme) {
+    if (!CodecMap::instance().is_supported(scheme)) {
+        state.SkipWithError("scheme not supported");
+        return;
+    }
+
+    CodecConfig codec_config;
+    codec_config.scheme = scheme;
+
+    WriterConfig writer_config;
+    writer_config.n_source_packets = NumSourcePackets;
+    writer_config.n_repair_packets = NumRepairPackets;
+
+    ReaderConfig reader_config;
+
+    core::ScopedPtr<IBlockEncoder> encoder(
+        CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+        allocator);
+    core::ScopedPtr<IBlockDecoder> decoder(
+        CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+        allocator);
+    if (!encoder || !decoder) {
+        state.SkipWithError("can't create codec");
+        return;
+    }
+
+    LossyNetwork network(scheme, (size_t)state.range(0));
+
+    Writer writer(writer_config, scheme, *encoder, network, source_composer(scheme),
+                  repair_composer(scheme), packet_factory, buffer_factory, allocator);
+    Reader reader(reader_config, scheme, *decoder, network.source_reader(),
+                  network.repair_reader(), rtp_parser, packet_factory, allocator);
+    if (!writer.valid() || !reader.valid()) {
+        state.SkipWithError("can't create writer or reader");
+        return;
+    }
+
+    size_t sn = 0;
+    size_t n_read = 0;
+
+    while (state.KeepRunningBatch(NumSourcePackets)) {
+        state.PauseTiming();
+        write_block(writer, scheme, sn);
+        state.ResumeTiming();
+
+        while (packet::PacketPtr pp = reader.read()) {
+            n_read++;
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+    state.counters["delivered"] =
+        benchmark::Counter(double(n_read) / double(state.iterations()));
+}
+
+void BM_WriterReader_Encode_ReedSolomon(benchmark::State& state) {
+    run_encode(state, packet::FEC_ReedSolomon_M8);
+}
+
+BENCHMARK(BM_WriterReader_Encode_ReedSolomon)->Unit(benchmark::kMicrosecond);
+
+void BM_WriterReader_Encode_LDPC(benchmark::State& state) {
+    run_encode(state, packet::FEC_LDPC_Staircase);
+}
+
+BENCHMARK(BM_WriterReader_Encode_LDPC)->Unit(benchmark::kMicrosecond);
+
+void BM_WriterReader_Decode_ReedSolomon(benchmark::State& state) {
+    run_decode(state, packet::FEC_ReedSolomon_M8);
+}
+
+BENCHMARK(BM_WriterReader_Decode_ReedSolomon)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(5)
+    ->Arg(10)
+    ->Arg(20)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_WriterReader_Decode_LDPC(benchmark::State& state) {
+    run_decode(state, packet::FEC_LDPC_Staircase);
+}
+
+BENCHMARK(BM_WriterReader_Decode_LDPC)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(5)
+    ->Arg(10)
+    ->Arg(20)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_fec/batch_encoder.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/rs8m_encoder.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+enum { MaxPayloadSize = 100, MaxSymbols = 40 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxPayloadSize, true);
+
+struct Block {
+    size_t sblen;
+    size_t rblen;
+    size_t payload_size;
+
+    core::Slice<uint8_t> buffers[MaxSymbols];
+    core::Slice<uint8_t> expected[MaxSymbols];
+
+    Block(size_t s, size_t r, size_t p)
+        : sblen(s)
+        , rblen(r)
+        , payload_size(p) {
+        for (size_t i = 0; i < sblen + rblen; i++) {
+            buffers[i] = buffer_factory.new_buffer();
+            buffers[i].reslice(0, payload_size);
+
+            if (i < sblen) {
+                for (size_t j = 0; j < payload_size; j++) {
+                    buffers[i].data()[j] = (uint8_t)(i * 31 + j * 7 + s * 3 + r + p);
+                }
+            } else {
+                expected[i] = buffer_factory.new_buffer();
+                expected[i].reslice(0, payload_size);
+            }
+        }
+    }
+};
+
+// encode block with regular encoder
+void encode_expected(Block& block) {
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    Rs8mEncoder encoder(config, buffer_factory, allocator);
+    CHECK(encoder.valid());
+
+    CHECK(encoder.begin(block.sblen, block.rblen, block.payload_size));
+    for (size_t i = 0; i < block.sblen + block.rblen; i++) {
+        encoder.set(i, i < block.sblen ? block.buffers[i] : block.expected[i]);
+    }
+    encoder.fill();
+    encoder.end();
+}
+
+void submit_block(BatchEncoder& batch_encoder, BatchEncoderJob& job, Block& block) {
+    CHECK(job.begin(block.sblen, block.rblen, block.payload_size));
+    for (size_t i = 0; i < block.sblen + block.rblen; i++) {
+        job.set(i, block.buffers[i]);
+    }
+    batch_encoder.submit(job);
+}
+
+void check_block(const Block& block) {
+    for (size_t i = block.sblen; i < block.sblen + block.rblen; i++) {
+        for (size_t j = 0; j < block.payload_size; j++) {
+            UNSIGNED_LONGS_EQUAL(block.expected[i].data()[j], block.buffers[i].data()[j]);
+        }
+    }
+}
+
+} // namespace
+
+TEST_GROUP(batch_encoder) {};
+
+TEST(batch_encoder, same_as_rs8m_encoder) {
+    enum { NumJobs = 5 };
+
+    BatchEncoder batch_encoder(allocator);
+
+    Block b0(20, 10, 100), b1(20, 10, 100), b2(10, 5, 100), b3(20, 10, 60),
+        b4(20, 10, 100);
+    Block* blocks[NumJobs] = { &b0, &b1, &b2, &b3, &b4 };
+
+    BatchEncoderJob j0(allocator), j1(allocator), j2(allocator), j3(allocator),
+        j4(allocator);
+    BatchEncoderJob* jobs[NumJobs] = { &j0, &j1, &j2, &j3, &j4 };
+
+    for (size_t n = 0; n < NumJobs; n++) {
+        encode_expected(*blocks[n]);
+        submit_block(batch_encoder, *jobs[n], *blocks[n]);
+        CHECK(!jobs[n]->encoded());
+    }
+
+    // jobs with different sizes are interleaved, so they're split into batches
+    batch_encoder.flush();
+
+    for (size_t n = 0; n < NumJobs; n++) {
+        CHECK(jobs[n]->encoded());
+        check_block(*blocks[n]);
+        jobs[n]->end();
+    }
+}
+
+TEST(batch_encoder, reuse_job) {
+    BatchEncoder batch_encoder(allocator);
+    BatchEncoderJob job(allocator);
+
+    Block b0(20, 10, 100), b1(15, 3, 40);
+
+    encode_expected(b0);
+    encode_expected(b1);
+
+    submit_block(batch_encoder, job, b0);
+    batch_encoder.flush();
+    CHECK(job.encoded());
+    check_block(b0);
+    job.end();
+    CHECK(!job.encoded());
+
+    submit_block(batch_encoder, job, b1);
+    batch_encoder.flush();
+    CHECK(job.encoded());
+    check_block(b1);
+    job.end();
+}
+
+TEST(batch_encoder, cancel) {
+    BatchEncoder batch_encoder(allocator);
+    BatchEncoderJob j0(allocator), j1(allocator);
+
+    Block b0(20, 10, 100), b1(20, 10, 100);
+
+    encode_expected(b1);
+
+    submit_block(batch_encoder, j0, b0);
+    submit_block(batch_encoder, j1, b1);
+
+    batch_encoder.cancel(j0);
+    batch_encoder.flush();
+
+    CHECK(!j0.encoded());
+    CHECK(j1.encoded());
+    check_block(b1);
+
+    // no-op for job that is not submitted
+    batch_encoder.cancel(j1);
+
+    j0.end();
+    j1.end();
+}
+
+} // namespace fec
+} // namespace roc
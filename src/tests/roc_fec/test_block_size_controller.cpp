@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_fec/block_size_controller.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const size_t MaxBlockLength = 255;
+
+} // namespace
+
+TEST_GROUP(block_size_controller) {
+    BlockSizeControllerConfig config;
+    WriterConfig writer_config;
+
+    void setup() {
+        config.enabled = true;
+        config.min_source_packets = 10;
+        config.min_repair_packets = 1;
+        config.high_loss = 0.2f;
+        config.redundancy = 2.0f;
+        config.loss_smoothing = 1.0f;
+
+        writer_config.n_source_packets = 40;
+        writer_config.n_repair_packets = 20;
+    }
+};
+
+TEST(block_size_controller, initial) {
+    BlockSizeController controller(config, writer_config, MaxBlockLength);
+
+    UNSIGNED_LONGS_EQUAL(40, controller.n_source_packets());
+    UNSIGNED_LONGS_EQUAL(20, controller.n_repair_packets());
+}
+
+TEST(block_size_controller, clean_link) {
+    BlockSizeController controller(config, writer_config, MaxBlockLength);
+
+    controller.update(0);
+
+    UNSIGNED_LONGS_EQUAL(40, controller.n_source_packets());
+    UNSIGNED_LONGS_EQUAL(1, controller.n_repair_packets());
+}
+
+TEST(block_size_controller, lossy_link) {
+    BlockSizeController controller(config, writer_config, MaxBlockLength);
+
+    // half way to high_loss: 40 - 15 = 25 source packets,
+    // 2 * 0.1 * (25 + rblen) <= rblen gives 7 repair packets
+    controller.update(0.1f);
+
+    UNSIGNED_LONGS_EQUAL(25, controller.n_source_packets());
+    UNSIGNED_LONGS_EQUAL(7, controller.n_repair_packets());
+
+    // high_loss: minimum source packets,
+    // 2 * 0.2 * (10 + rblen) <= rblen gives 7 repair packets
+    controller.update(0.2f);
+
+    UNSIGNED_LONGS_EQUAL(10, controller.n_source_packets());
+    UNSIGNED_LONGS_EQUAL(7, controller.n_repair_packets());
+}
+
+TEST(block_size_controller, resilience_grows_with_loss) {
+    BlockSizeController controller(config, writer_config, MaxBlockLength);
+
+    float prev_ratio = 0;
+
+    for (size_t n = 0; n <= 20; n++) {
+        controller.update(float(n) / 100);
+
+        const float ratio =
+            float(controller.n_repair_packets()) / float(controller.n_source_packets());
+
+        CHECK(ratio >= prev_ratio);
+        prev_ratio = ratio;
+    }
+}
+
+TEST(block_size_controller, overhead_limit) {
+    BlockSizeController controller(config, writer_config, MaxBlockLength);
+
+    controller.update(0.9f);
+
+    UNSIGNED_LONGS_EQUAL(10, controller.n_source_packets());
+    UNSIGNED_LONGS_EQUAL(10, controller.n_repair_packets());
+}
+
+TEST(block_size_controller, max_block_length) {
+    writer_config.n_source_packets = 250;
+
+    BlockSizeController controller(config, writer_config, MaxBlockLength);
+
+    controller.update(0);
+
+    UNSIGNED_LONGS_EQUAL(250, controller.n_source_packets());
+    UNSIGNED_LONGS_EQUAL(1, controller.n_repair_packets());
+
+    controller.update(0.01f);
+
+    CHECK(controller.n_source_packets() + controller.n_repair_packets()
+          <= MaxBlockLength);
+}
+
+TEST(block_size_controller, smoothing) {
+    config.loss_smoothing = 0.5f;
+
+    BlockSizeController controller(config, writer_config, MaxBlockLength);
+
+    // first report is used as is
+    controller.update(0.2f);
+    DOUBLES_EQUAL(0.2, controller.loss(), 1e-6);
+
+    controller.update(0);
+    DOUBLES_EQUAL(0.1, controller.loss(), 1e-6);
+
+    controller.update(0);
+    DOUBLES_EQUAL(0.05, controller.loss(), 1e-6);
+
+    // invalid reports are clamped
+    controller.update(-1);
+    DOUBLES_EQUAL(0.025, controller.loss(), 1e-6);
+
+    controller.update(2);
+    DOUBLES_EQUAL(0.5125, controller.loss(), 1e-6);
+}
+
+} // namespace fec
+} // namespace roc
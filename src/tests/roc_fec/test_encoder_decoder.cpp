@@ -15,6 +15,13 @@
 #include "roc_core/log.h"
 #include "roc_core/scoped_ptr.h"
 #include "roc_fec/codec_map.h"
+#include "roc_fec/rs8m_decoder.h"
+#include "roc_fec/rs8m_encoder.h"
+
+#ifdef ROC_TARGET_OPENFEC
+#include "roc_fec/openfec_decoder.h"
+#include "roc_fec/openfec_encoder.h"
+#endif // ROC_TARGET_OPENFEC
 
 namespace roc {
 namespace fec {
@@ -26,6 +33,111 @@ const size_t MaxPayloadSize = 1024;
 core::HeapAllocator allocator;
 core::BufferFactory<uint8_t> buffer_factory(allocator, MaxPayloadSize, true);
 
+enum { GoldenSourcePackets = 20, GoldenRepairPackets = 10, GoldenPayloadSize = 16 };
+
+// Repair packets of Reed-Solomon over GF(2^8) for a block where byte j of
+// source packet i is (i * 31 + j). Computed by a scalar port of fec.c by
+// L. Rizzo, which is the code used by OpenFEC for RS_2_M codec with m=8:
+// generator polynomial 1+x^2+x^3+x^4+x^8, vandermonde matrix with inverted
+// top square, repair packet i encoded with row (sblen + i) of the matrix.
+const uint8_t GoldenRepair[GoldenRepairPackets][GoldenPayloadSize] = {
+    { 0xce, 0x0e, 0x79, 0xf7, 0x4a, 0xa7, 0x41, 0xb3, 0xa5, 0xd9, 0x5b, 0x80, 0xee, 0x44,
+      0xa4, 0x83 },
+    { 0x66, 0xac, 0xaf, 0x0a, 0x95, 0x00, 0x38, 0xa0, 0x67, 0xdb, 0x2d, 0x53, 0x69, 0x00,
+      0xfa, 0x96 },
+    { 0x17, 0x16, 0xb9, 0xfd, 0xdb, 0x05, 0xcc, 0x4a, 0x4f, 0x0c, 0x28, 0x4b, 0xd5, 0xf8,
+      0xff, 0xf6 },
+    { 0xbf, 0x40, 0x34, 0x6e, 0x87, 0xaa, 0x8d, 0x6a, 0x71, 0xf7, 0x56, 0x70, 0xfb, 0x41,
+      0xe2, 0x5c },
+    { 0xcd, 0x05, 0x05, 0xab, 0xe8, 0x4d, 0x62, 0xa3, 0x65, 0xe4, 0x16, 0x97, 0xb2, 0xa4,
+      0xd6, 0xb7 },
+    { 0x5d, 0x6f, 0x3c, 0xe4, 0x66, 0x5a, 0xb1, 0xc6, 0xad, 0x9a, 0x6d, 0xa1, 0x95, 0x02,
+      0x56, 0x38 },
+    { 0x63, 0xfd, 0x3e, 0xd9, 0xd5, 0x9c, 0xbf, 0x34, 0xd4, 0x11, 0x11, 0x72, 0x2b, 0x21,
+      0x01, 0x04 },
+    { 0xa8, 0xe1, 0x39, 0x44, 0x6e, 0xf5, 0x7c, 0xd2, 0x40, 0xe8, 0x9c, 0x6a, 0x07, 0x55,
+      0x1f, 0xab },
+    { 0x45, 0xdf, 0x26, 0xb5, 0x90, 0xed, 0xb4, 0x08, 0x8f, 0x9f, 0x5f, 0x82, 0xc0, 0x31,
+      0x69, 0x9b },
+    { 0x46, 0x78, 0x9e, 0xab, 0xce, 0x34, 0x96, 0x6c, 0xe1, 0xbe, 0x30, 0x42, 0x36, 0x9e,
+      0xab, 0xc0 },
+};
+
+uint8_t golden_source_byte(size_t i, size_t j) {
+    return (uint8_t)(i * 31 + j);
+}
+
+core::Slice<uint8_t> make_golden_buffer(size_t i) {
+    core::Slice<uint8_t> buf = buffer_factory.new_buffer();
+    buf.reslice(0, GoldenPayloadSize);
+
+    for (size_t j = 0; j < GoldenPayloadSize; j++) {
+        buf.data()[j] = i < GoldenSourcePackets
+            ? golden_source_byte(i, j)
+            : GoldenRepair[i - GoldenSourcePackets][j];
+    }
+
+    return buf;
+}
+
+void check_golden_encoding(IBlockEncoder& encoder) {
+    core::Slice<uint8_t> buffers[GoldenSourcePackets + GoldenRepairPackets];
+
+    CHECK(encoder.begin(GoldenSourcePackets, GoldenRepairPackets, GoldenPayloadSize));
+
+    for (size_t i = 0; i < GoldenSourcePackets + GoldenRepairPackets; ++i) {
+        if (i < GoldenSourcePackets) {
+            buffers[i] = make_golden_buffer(i);
+        } else {
+            buffers[i] = buffer_factory.new_buffer();
+            buffers[i].reslice(0, GoldenPayloadSize);
+        }
+        encoder.set(i, buffers[i]);
+    }
+
+    encoder.fill();
+    encoder.end();
+
+    for (size_t i = 0; i < GoldenRepairPackets; ++i) {
+        for (size_t j = 0; j < GoldenPayloadSize; j++) {
+            UNSIGNED_LONGS_EQUAL(GoldenRepair[i][j],
+                                 buffers[GoldenSourcePackets + i].data()[j]);
+        }
+    }
+}
+
+// Decodes golden block, when source packets in range [lost_begin; lost_end)
+// are lost, and only repair packets in range [repair_begin; repair_end)
+// are received.
+void check_golden_decoding(IBlockDecoder& decoder,
+                           size_t lost_begin,
+                           size_t lost_end,
+                           size_t repair_begin,
+                           size_t repair_end) {
+    CHECK(decoder.begin(GoldenSourcePackets, GoldenRepairPackets, GoldenPayloadSize));
+
+    for (size_t i = 0; i < GoldenSourcePackets; ++i) {
+        if (i < lost_begin || i >= lost_end) {
+            decoder.set(i, make_golden_buffer(i));
+        }
+    }
+    for (size_t i = repair_begin; i < repair_end; ++i) {
+        decoder.set(GoldenSourcePackets + i, make_golden_buffer(GoldenSourcePackets + i));
+    }
+
+    for (size_t i = lost_begin; i < lost_end; ++i) {
+        core::Slice<uint8_t> repaired = decoder.repair(i);
+        CHECK(repaired);
+        UNSIGNED_LONGS_EQUAL(GoldenPayloadSize, repaired.size());
+
+        for (size_t j = 0; j < GoldenPayloadSize; j++) {
+            UNSIGNED_LONGS_EQUAL(golden_source_byte(i, j), repaired.data()[j]);
+        }
+    }
+
+    decoder.end();
+}
+
 } // namespace
 
 class Codec {
@@ -221,6 +333,41 @@ TEST(encoder_decoder, full_repair_payload_sizes) {
     }
 }
 
+TEST(encoder_decoder, many_encoders_same_params) {
+    enum {
+        NumSourcePackets = 20,
+        NumRepairPackets = 10,
+        PayloadSize = 251,
+        NumIterations = 5
+    };
+
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        CodecConfig config;
+        config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        // every new encoder may reuse prepared codec state of previous ones,
+        // with the same or with other block sizes
+        for (size_t test_num = 0; test_num < NumIterations; ++test_num) {
+            const size_t n_source = NumSourcePackets + test_num % 2;
+
+            Codec code(config);
+            code.encode(n_source, NumRepairPackets, PayloadSize);
+
+            CHECK(code.decoder().begin(n_source, NumRepairPackets, PayloadSize));
+
+            for (size_t i = 0; i < n_source + NumRepairPackets; ++i) {
+                if (i == 3 || i == 11) {
+                    continue;
+                }
+                code.decoder().set(i, code.get_buffer(i));
+            }
+            CHECK(code.decode(n_source, PayloadSize));
+
+            code.decoder().end();
+        }
+    }
+}
+
 TEST(encoder_decoder, max_source_block) {
     for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); ++n_scheme) {
         CodecConfig config;
@@ -233,5 +380,211 @@ TEST(encoder_decoder, max_source_block) {
     }
 }
 
+TEST(encoder_decoder, rs8m_max_losses) {
+    enum {
+        NumSourcePackets = 30,
+        NumRepairPackets = 15,
+        PayloadSize = 333,
+        NumIterations = 20
+    };
+
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    Codec code(config);
+
+    for (size_t test_num = 0; test_num < NumIterations; ++test_num) {
+        code.encode(NumSourcePackets, NumRepairPackets, PayloadSize);
+
+        CHECK(code.decoder().begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+        bool lost[NumSourcePackets + NumRepairPackets] = {};
+        for (size_t n_lost = 0; n_lost < NumRepairPackets;) {
+            const size_t i =
+                (size_t)core::fast_random(0, NumSourcePackets + NumRepairPackets - 1);
+            if (!lost[i]) {
+                lost[i] = true;
+                n_lost++;
+            }
+        }
+
+        for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; ++i) {
+            if (!lost[i]) {
+                code.decoder().set(i, code.get_buffer(i));
+            }
+        }
+
+        // reed-solomon is MDS code, so any NumSourcePackets are enough
+        CHECK(code.decode(NumSourcePackets, PayloadSize));
+
+        code.decoder().end();
+    }
+}
+
+TEST(encoder_decoder, rs8m_incremental) {
+    enum {
+        NumSourcePackets = 20,
+        NumRepairPackets = 10,
+        PayloadSize = 251,
+        NumLost = 5
+    };
+
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    Codec code(config);
+    code.encode(NumSourcePackets, NumRepairPackets, PayloadSize);
+
+    CHECK(code.decoder().begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    // some repair packets arrive before source packets
+    for (size_t i = 0; i < NumLost / 2; ++i) {
+        code.decoder().set(NumSourcePackets + i, code.get_buffer(NumSourcePackets + i));
+    }
+
+    // source packets arrive, except a few
+    for (size_t i = 0; i < NumSourcePackets; ++i) {
+        if (i % (NumSourcePackets / NumLost) == 1) {
+            continue;
+        }
+        code.decoder().set(i, code.get_buffer(i));
+    }
+
+    // not enough packets yet
+    CHECK(!code.decoder().repair(1));
+
+    // remaining repair packets arrive
+    for (size_t i = NumLost / 2; i < NumRepairPackets; ++i) {
+        code.decoder().set(NumSourcePackets + i, code.get_buffer(NumSourcePackets + i));
+    }
+
+    CHECK(code.decode(NumSourcePackets, PayloadSize));
+
+    code.decoder().end();
+}
+
+TEST(encoder_decoder, rs8m_golden_encoding) {
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    Rs8mEncoder encoder(config, buffer_factory, allocator);
+    CHECK(encoder.valid());
+
+    check_golden_encoding(encoder);
+}
+
+TEST(encoder_decoder, rs8m_golden_decoding) {
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    Rs8mDecoder decoder(config, buffer_factory, allocator);
+    CHECK(decoder.valid());
+
+    // as many losses as repair packets, at the beginning and at the end of block
+    check_golden_decoding(decoder, 0, GoldenRepairPackets, 0, GoldenRepairPackets);
+    check_golden_decoding(decoder, GoldenSourcePackets - GoldenRepairPackets,
+                          GoldenSourcePackets, 0, GoldenRepairPackets);
+
+    // a few losses, repaired from the last repair packets only
+    check_golden_decoding(decoder, 7, 10, GoldenRepairPackets - 3, GoldenRepairPackets);
+}
+
+#ifdef ROC_TARGET_OPENFEC
+
+TEST(encoder_decoder, openfec_golden_encoding) {
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    OpenfecEncoder encoder(config, buffer_factory, allocator);
+    CHECK(encoder.valid());
+
+    check_golden_encoding(encoder);
+}
+
+TEST(encoder_decoder, openfec_golden_decoding) {
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    OpenfecDecoder decoder(config, buffer_factory, allocator);
+    CHECK(decoder.valid());
+
+    check_golden_decoding(decoder, 0, GoldenRepairPackets, 0, GoldenRepairPackets);
+    check_golden_decoding(decoder, 7, 10, GoldenRepairPackets - 3, GoldenRepairPackets);
+}
+
+TEST(encoder_decoder, rs8m_openfec_compatibility) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 251 };
+
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+
+    Rs8mEncoder rs8m_encoder(config, buffer_factory, allocator);
+    OpenfecEncoder openfec_encoder(config, buffer_factory, allocator);
+
+    CHECK(rs8m_encoder.valid());
+    CHECK(openfec_encoder.valid());
+
+    IBlockEncoder* encoders[] = { &rs8m_encoder, &openfec_encoder };
+
+    core::Slice<uint8_t> buffers[2][NumSourcePackets + NumRepairPackets];
+
+    for (size_t e = 0; e < 2; e++) {
+        CHECK(encoders[e]->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+        for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; ++i) {
+            buffers[e][i] = buffer_factory.new_buffer();
+            buffers[e][i].reslice(0, PayloadSize);
+
+            for (size_t j = 0; j < PayloadSize; j++) {
+                buffers[e][i].data()[j] =
+                    i < NumSourcePackets ? (uint8_t)(i * 31 + j) : (uint8_t)0;
+            }
+
+            encoders[e]->set(i, buffers[e][i]);
+        }
+
+        encoders[e]->fill();
+        encoders[e]->end();
+    }
+
+    // both backends should produce identical repair packets
+    for (size_t i = NumSourcePackets; i < NumSourcePackets + NumRepairPackets; ++i) {
+        CHECK(memcmp(buffers[0][i].data(), buffers[1][i].data(), PayloadSize) == 0);
+    }
+
+    Rs8mDecoder rs8m_decoder(config, buffer_factory, allocator);
+    OpenfecDecoder openfec_decoder(config, buffer_factory, allocator);
+
+    CHECK(rs8m_decoder.valid());
+    CHECK(openfec_decoder.valid());
+
+    IBlockDecoder* decoders[] = { &rs8m_decoder, &openfec_decoder };
+
+    // each backend should repair packets encoded by another one
+    for (size_t d = 0; d < 2; d++) {
+        const size_t e = 1 - d;
+
+        CHECK(decoders[d]->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+        for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; ++i) {
+            if (i < NumSourcePackets && i % 2 == 0) {
+                continue;
+            }
+            decoders[d]->set(i, buffers[e][i]);
+        }
+
+        for (size_t i = 0; i < NumSourcePackets; i += 2) {
+            core::Slice<uint8_t> repaired = decoders[d]->repair(i);
+            CHECK(repaired);
+            UNSIGNED_LONGS_EQUAL(PayloadSize, repaired.size());
+            CHECK(memcmp(buffers[e][i].data(), repaired.data(), PayloadSize) == 0);
+        }
+
+        decoders[d]->end();
+    }
+}
+
+#endif // ROC_TARGET_OPENFEC
+
 } // namespace fec
 } // namespace roc
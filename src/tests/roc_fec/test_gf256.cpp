@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/fast_random.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+// bitwise multiplication modulo x^8 + x^4 + x^3 + x^2 + 1
+uint8_t slow_mul(uint8_t a, uint8_t b) {
+    unsigned x = a, y = b, r = 0;
+    while (y) {
+        if (y & 1) {
+            r ^= x;
+        }
+        x <<= 1;
+        if (x & 0x100) {
+            x ^= 0x11D;
+        }
+        y >>= 1;
+    }
+    return (uint8_t)r;
+}
+
+} // namespace
+
+TEST_GROUP(gf256) {};
+
+TEST(gf256, mul) {
+    const Gf256& gf = Gf256::instance();
+
+    for (unsigned a = 0; a < 256; a++) {
+        for (unsigned b = 0; b < 256; b++) {
+            UNSIGNED_LONGS_EQUAL(slow_mul((uint8_t)a, (uint8_t)b),
+                                 gf.mul((uint8_t)a, (uint8_t)b));
+        }
+    }
+}
+
+TEST(gf256, div_inv) {
+    const Gf256& gf = Gf256::instance();
+
+    for (unsigned a = 0; a < 256; a++) {
+        for (unsigned b = 1; b < 256; b++) {
+            UNSIGNED_LONGS_EQUAL(a, gf.mul(gf.div((uint8_t)a, (uint8_t)b), (uint8_t)b));
+        }
+    }
+
+    for (unsigned a = 1; a < 256; a++) {
+        UNSIGNED_LONGS_EQUAL(1, gf.mul((uint8_t)a, gf.inv((uint8_t)a)));
+    }
+}
+
+TEST(gf256, exp) {
+    const Gf256& gf = Gf256::instance();
+
+    // primitive element generates all non-zero elements
+    bool seen[256] = {};
+    for (size_t n = 0; n < 255; n++) {
+        const uint8_t x = gf.exp(n);
+        CHECK(x != 0);
+        CHECK(!seen[x]);
+        seen[x] = true;
+    }
+
+    UNSIGNED_LONGS_EQUAL(1, gf.exp(0));
+    UNSIGNED_LONGS_EQUAL(2, gf.exp(1));
+    UNSIGNED_LONGS_EQUAL(1, gf.exp(255));
+}
+
+TEST(gf256, mul_add_region) {
+    enum { MaxSize = 200 };
+
+    const Gf256& gf = Gf256::instance();
+
+    // sizes and offsets cover both vectorized part and tail
+    for (size_t size = 0; size < MaxSize; size += 7) {
+        for (size_t off = 0; off < 3; off++) {
+            uint8_t src[MaxSize + 3], dst[MaxSize + 3], expected[MaxSize + 3];
+
+            for (size_t n = 0; n < size; n++) {
+                src[off + n] = (uint8_t)core::fast_random(0, 0xff);
+                dst[off + n] = expected[n] = (uint8_t)core::fast_random(0, 0xff);
+            }
+
+            const uint8_t c = (uint8_t)core::fast_random(0, 0xff);
+
+            for (size_t n = 0; n < size; n++) {
+                expected[n] ^= slow_mul(c, src[off + n]);
+            }
+
+            gf.mul_add_region(dst + off, src + off, c, size);
+
+            for (size_t n = 0; n < size; n++) {
+                UNSIGNED_LONGS_EQUAL(expected[n], dst[off + n]);
+            }
+        }
+    }
+}
+
+TEST(gf256, mul_region) {
+    enum { MaxSize = 200 };
+
+    const Gf256& gf = Gf256::instance();
+
+    for (size_t size = 0; size < MaxSize; size += 7) {
+        for (size_t off = 0; off < 3; off++) {
+            uint8_t src[MaxSize + 3], dst[MaxSize + 3];
+
+            for (size_t n = 0; n < size; n++) {
+                src[off + n] = (uint8_t)core::fast_random(0, 0xff);
+                dst[off + n] = (uint8_t)core::fast_random(0, 0xff);
+            }
+
+            // zero constant should clear region too
+            const uint8_t c = size % 2 ? (uint8_t)core::fast_random(0, 0xff) : 0;
+
+            gf.mul_region(dst + off, src + off, c, size);
+
+            for (size_t n = 0; n < size; n++) {
+                UNSIGNED_LONGS_EQUAL(slow_mul(c, src[off + n]), dst[off + n]);
+            }
+        }
+    }
+}
+
+} // namespace fec
+} // namespace roc
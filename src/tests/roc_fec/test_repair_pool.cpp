@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/thread.h"
+#include "roc_fec/repair_pool.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+core::HeapAllocator allocator;
+
+class TestTask : public RepairTask {
+public:
+    TestTask()
+        : n_calls_(0)
+        , tid_(0) {
+    }
+
+    int num_calls() const {
+        return n_calls_;
+    }
+
+    uint64_t tid() const {
+        return tid_;
+    }
+
+private:
+    virtual void execute() {
+        tid_ = core::Thread::get_tid();
+        n_calls_++;
+    }
+
+    core::Atomic<int> n_calls_;
+    uint64_t tid_;
+};
+
+} // namespace
+
+TEST_GROUP(repair_pool) {};
+
+TEST(repair_pool, no_threads) {
+    RepairPool pool(0, core::ThreadConfig(), allocator);
+    CHECK(pool.valid());
+
+    UNSIGNED_LONGS_EQUAL(0, pool.num_threads());
+
+    TestTask task;
+    CHECK(!task.finished());
+
+    pool.schedule(task);
+    CHECK(!task.finished());
+    LONGS_EQUAL(0, task.num_calls());
+
+    // executed on calling thread
+    pool.wait(task);
+    CHECK(task.finished());
+    LONGS_EQUAL(1, task.num_calls());
+    CHECK(task.tid() == core::Thread::get_tid());
+}
+
+TEST(repair_pool, many_tasks) {
+    enum { NumThreads = 3, NumTasks = 50, NumIterations = 10 };
+
+    RepairPool pool(NumThreads, core::ThreadConfig(), allocator);
+    CHECK(pool.valid());
+
+    UNSIGNED_LONGS_EQUAL(NumThreads, pool.num_threads());
+
+    TestTask tasks[NumTasks];
+
+    for (size_t iter = 0; iter < NumIterations; iter++) {
+        for (size_t n = 0; n < NumTasks; n++) {
+            pool.schedule(tasks[n]);
+        }
+
+        for (size_t n = 0; n < NumTasks; n++) {
+            pool.wait(tasks[n]);
+            CHECK(tasks[n].finished());
+        }
+    }
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        LONGS_EQUAL(NumIterations, tasks[n].num_calls());
+    }
+}
+
+TEST(repair_pool, background_execution) {
+    RepairPool pool(1, core::ThreadConfig(), allocator);
+    CHECK(pool.valid());
+
+    TestTask task;
+    pool.schedule(task);
+
+    while (!task.finished()) {
+        core::sleep_for(core::ClockMonotonic, core::Microsecond);
+    }
+
+    LONGS_EQUAL(1, task.num_calls());
+    CHECK(task.tid() != core::Thread::get_tid());
+
+    pool.wait(task);
+    LONGS_EQUAL(1, task.num_calls());
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_fec/rlc.h"
+
+namespace roc {
+namespace fec {
+
+TEST_GROUP(rlc_coefficients) {};
+
+TEST(rlc_coefficients, dense) {
+    uint8_t coeffs[RlcMaxWindowLength];
+
+    for (unsigned key = 0; key < 100; key++) {
+        rlc_coefficients((uint16_t)key, RlcDenseThreshold, coeffs, RlcMaxWindowLength);
+
+        for (size_t n = 0; n < RlcMaxWindowLength; n++) {
+            CHECK(coeffs[n] != 0);
+        }
+    }
+}
+
+TEST(rlc_coefficients, sparse) {
+    uint8_t coeffs[RlcMaxWindowLength];
+
+    // with dt=0, about 1/16 of coefficients may be non-zero
+    rlc_coefficients(1, 0, coeffs, RlcMaxWindowLength);
+
+    size_t n_zeros = 0;
+    for (size_t n = 0; n < RlcMaxWindowLength; n++) {
+        if (coeffs[n] == 0) {
+            n_zeros++;
+        }
+    }
+
+    CHECK(n_zeros > RlcMaxWindowLength / 2);
+}
+
+TEST(rlc_coefficients, deterministic) {
+    uint8_t coeffs1[RlcMaxWindowLength];
+    uint8_t coeffs2[RlcMaxWindowLength];
+
+    rlc_coefficients(555, RlcDenseThreshold, coeffs1, RlcMaxWindowLength);
+    rlc_coefficients(555, RlcDenseThreshold, coeffs2, RlcMaxWindowLength);
+
+    MEMCMP_EQUAL(coeffs1, coeffs2, RlcMaxWindowLength);
+
+    // shorter window gets prefix of the same sequence
+    rlc_coefficients(555, RlcDenseThreshold, coeffs2, 10);
+
+    MEMCMP_EQUAL(coeffs1, coeffs2, 10);
+
+    rlc_coefficients(556, RlcDenseThreshold, coeffs2, RlcMaxWindowLength);
+
+    CHECK(memcmp(coeffs1, coeffs2, RlcMaxWindowLength) != 0);
+}
+
+} // namespace fec
+} // namespace roc
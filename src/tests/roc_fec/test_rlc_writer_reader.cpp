@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "test_helpers/packet_dispatcher.h"
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_fec/composer.h"
+#include "roc_fec/headers.h"
+#include "roc_fec/parser.h"
+#include "roc_fec/rlc_reader.h"
+#include "roc_fec/rlc_writer.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/format_map.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/parser.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const size_t NumSourcePackets = 20;
+const size_t NumRepairPackets = 10;
+
+const unsigned SourceID = 555;
+const unsigned PayloadType = rtp::PayloadType_L16_Stereo;
+
+const size_t FECPayloadSize = 193;
+
+const size_t MaxBuffSize = 500;
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBuffSize, true);
+packet::PacketFactory packet_factory(allocator, true);
+
+rtp::FormatMap format_map;
+rtp::Parser rtp_parser(format_map, NULL);
+
+Parser<RLC_Source_PayloadID, Source, Footer> source_parser(&rtp_parser);
+Parser<RLC_Repair_PayloadID, Repair, Header> repair_parser(NULL);
+
+rtp::Composer rtp_composer(NULL);
+Composer<RLC_Source_PayloadID, Source, Footer> source_composer(&rtp_composer);
+Composer<RLC_Repair_PayloadID, Repair, Header> repair_composer(NULL);
+
+} // namespace
+
+TEST_GROUP(rlc_writer_reader) {
+    WriterConfig writer_config;
+
+    void setup() {
+        writer_config.n_source_packets = NumSourcePackets;
+        writer_config.n_repair_packets = NumRepairPackets;
+    }
+
+    packet::PacketPtr fill_one_packet(size_t sn) {
+        const size_t rtp_payload_size = FECPayloadSize - sizeof(rtp::Header);
+
+        packet::PacketPtr pp = packet_factory.new_packet();
+        CHECK(pp);
+
+        core::Slice<uint8_t> bp = buffer_factory.new_buffer();
+        CHECK(bp);
+
+        CHECK(source_composer.prepare(*pp, bp, rtp_payload_size));
+
+        pp->set_data(bp);
+
+        UNSIGNED_LONGS_EQUAL(FECPayloadSize, pp->fec()->payload.size());
+
+        pp->add_flags(packet::Packet::FlagAudio);
+
+        pp->rtp()->source = SourceID;
+        pp->rtp()->payload_type = PayloadType;
+        pp->rtp()->seqnum = packet::seqnum_t(sn);
+        pp->rtp()->timestamp = packet::timestamp_t(sn * 10);
+
+        for (size_t i = 0; i < rtp_payload_size; i++) {
+            pp->rtp()->payload.data()[i] = uint8_t(sn + i);
+        }
+
+        return pp;
+    }
+
+    void write_packets(RlcWriter& writer, size_t sn, size_t n_packets) {
+        for (size_t i = 0; i < n_packets; ++i) {
+            writer.write(fill_one_packet(sn + i));
+        }
+    }
+
+    void check_packet(const packet::PacketPtr& pp, size_t sn, bool restored) {
+        const size_t rtp_payload_size = FECPayloadSize - sizeof(rtp::Header);
+
+        CHECK(pp);
+
+        CHECK(pp->flags() & packet::Packet::FlagRTP);
+        CHECK(pp->flags() & packet::Packet::FlagAudio);
+
+        UNSIGNED_LONGS_EQUAL(SourceID, pp->rtp()->source);
+        UNSIGNED_LONGS_EQUAL(sn, pp->rtp()->seqnum);
+        UNSIGNED_LONGS_EQUAL(packet::timestamp_t(sn * 10), pp->rtp()->timestamp);
+        UNSIGNED_LONGS_EQUAL(PayloadType, pp->rtp()->payload_type);
+        UNSIGNED_LONGS_EQUAL(rtp_payload_size, pp->rtp()->payload.size());
+
+        for (size_t i = 0; i < rtp_payload_size; i++) {
+            UNSIGNED_LONGS_EQUAL(uint8_t(sn + i), pp->rtp()->payload.data()[i]);
+        }
+
+        if (restored) {
+            CHECK((pp->flags() & packet::Packet::FlagRestored) != 0);
+            CHECK(!pp->fec());
+        } else {
+            CHECK((pp->flags() & packet::Packet::FlagRestored) == 0);
+            CHECK(pp->fec());
+        }
+    }
+};
+
+TEST(rlc_writer_reader, no_losses) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    write_packets(writer, 0, NumSourcePackets);
+    dispatcher.push_stocks();
+
+    UNSIGNED_LONGS_EQUAL(NumSourcePackets, dispatcher.source_size());
+    UNSIGNED_LONGS_EQUAL(NumRepairPackets, dispatcher.repair_size());
+
+    for (size_t i = 0; i < NumSourcePackets; ++i) {
+        check_packet(reader.read(), i, false);
+    }
+
+    CHECK(!reader.read());
+}
+
+TEST(rlc_writer_reader, repair_packet_window) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+
+    // two periods, so that window becomes full
+    write_packets(writer, 0, NumSourcePackets * 2);
+    dispatcher.push_stocks();
+
+    UNSIGNED_LONGS_EQUAL(NumSourcePackets * 2, dispatcher.source_size());
+    UNSIGNED_LONGS_EQUAL(NumRepairPackets * 2, dispatcher.repair_size());
+
+    packet::PacketPtr first_source = dispatcher.source_reader().read();
+    CHECK(first_source);
+
+    const uint32_t first_esi = (uint32_t)first_source->fec()->encoding_symbol_id;
+
+    for (size_t n = 0; n < NumRepairPackets * 2; n++) {
+        packet::PacketPtr rp = dispatcher.repair_reader().read();
+        CHECK(rp);
+
+        CHECK(rp->flags() & packet::Packet::FlagRepair);
+
+        const packet::FEC& fec = *rp->fec();
+
+        // repair packet is written after every second source packet and
+        // covers last source packets, up to window length
+        const size_t n_covered = (n + 1) * 2;
+        const size_t window = n_covered < NumSourcePackets ? n_covered : NumSourcePackets;
+
+        UNSIGNED_LONGS_EQUAL(packet::FEC_RLC, fec.fec_scheme);
+        UNSIGNED_LONGS_EQUAL(window, fec.source_block_length);
+        UNSIGNED_LONGS_EQUAL(RlcDenseThreshold, fec.block_length);
+        UNSIGNED_LONGS_EQUAL(first_esi + n_covered - window, fec.encoding_symbol_id);
+        UNSIGNED_LONGS_EQUAL(FECPayloadSize, fec.payload.size());
+    }
+}
+
+TEST(rlc_writer_reader, lost_source_packet) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    // packets go as: source, source, repair, source, source, repair, ...
+    // lose third source packet
+    dispatcher.lose(3);
+
+    write_packets(writer, 0, NumSourcePackets);
+    dispatcher.push_stocks();
+
+    UNSIGNED_LONGS_EQUAL(NumSourcePackets - 1, dispatcher.source_size());
+
+    for (size_t i = 0; i < NumSourcePackets; ++i) {
+        check_packet(reader.read(), i, i == 2);
+    }
+
+    CHECK(!reader.read());
+}
+
+TEST(rlc_writer_reader, burst_losses) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    // lose source packets 2, 3, 4 and repair packet between them
+    dispatcher.lose(3);
+    dispatcher.lose(4);
+    dispatcher.lose(5);
+    dispatcher.lose(6);
+
+    write_packets(writer, 0, NumSourcePackets);
+    dispatcher.push_stocks();
+
+    UNSIGNED_LONGS_EQUAL(NumSourcePackets - 3, dispatcher.source_size());
+
+    for (size_t i = 0; i < NumSourcePackets; ++i) {
+        check_packet(reader.read(), i, i >= 2 && i <= 4);
+    }
+
+    CHECK(!reader.read());
+}
+
+TEST(rlc_writer_reader, lost_repair_packets) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    // lose two first repair packets and one source packet,
+    // later repair packets still cover it
+    dispatcher.lose(1);
+    dispatcher.lose(2);
+    dispatcher.lose(5);
+
+    write_packets(writer, 0, NumSourcePackets);
+    dispatcher.push_stocks();
+
+    for (size_t i = 0; i < NumSourcePackets; ++i) {
+        check_packet(reader.read(), i, i == 1);
+    }
+
+    CHECK(!reader.read());
+}
+
+TEST(rlc_writer_reader, repair_before_source) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    dispatcher.lose(7);
+
+    write_packets(writer, 0, NumSourcePackets);
+
+    dispatcher.push_repair_stock(NumRepairPackets);
+
+    // no source packets yet
+    CHECK(!reader.read());
+
+    dispatcher.push_source_stock(NumSourcePackets - 1);
+
+    for (size_t i = 0; i < NumSourcePackets; ++i) {
+        check_packet(reader.read(), i, i == 5);
+    }
+
+    CHECK(!reader.read());
+}
+
+TEST(rlc_writer_reader, late_source_packet) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    dispatcher.delay(4);
+
+    write_packets(writer, 0, NumSourcePackets);
+    dispatcher.push_stocks();
+
+    for (size_t i = 0; i < NumSourcePackets / 2; ++i) {
+        check_packet(reader.read(), i, i == 3);
+    }
+
+    // packet was already restored, so its late copy is dropped
+    dispatcher.push_delayed(4);
+
+    for (size_t i = NumSourcePackets / 2; i < NumSourcePackets; ++i) {
+        check_packet(reader.read(), i, false);
+    }
+
+    CHECK(!reader.read());
+}
+
+TEST(rlc_writer_reader, continuous_stream) {
+    enum { NumPeriods = 30 };
+
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    // lose two source packets in every period
+    dispatcher.lose(10);
+    dispatcher.lose(25);
+
+    size_t sn = 0;
+
+    for (size_t n_period = 0; n_period < NumPeriods; n_period++) {
+        write_packets(writer, sn, NumSourcePackets);
+        dispatcher.push_stocks();
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            check_packet(reader.read(), sn + i, i == 7 || i == 17);
+        }
+
+        CHECK(!reader.read());
+
+        sn += NumSourcePackets;
+    }
+}
+
+TEST(rlc_writer_reader, unrecoverable_loss) {
+    test::PacketDispatcher dispatcher(source_parser, repair_parser, packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    RlcWriter writer(writer_config, dispatcher, source_composer, repair_composer,
+                     packet_factory, buffer_factory, allocator);
+
+    RlcReader reader(dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                     packet_factory, buffer_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    dispatcher.lose(3);
+
+    write_packets(writer, 0, NumSourcePackets);
+
+    // deliver source packets only
+    dispatcher.push_source_stock(NumSourcePackets - 1);
+
+    for (size_t i = 0; i < NumSourcePackets; ++i) {
+        if (i == 2) {
+            continue;
+        }
+        check_packet(reader.read(), i, false);
+    }
+
+    CHECK(!reader.read());
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_fec/gf256.h"
+#include "roc_fec/rs8m_matrix.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+core::HeapAllocator allocator;
+
+} // namespace
+
+TEST_GROUP(rs8m_matrix) {};
+
+TEST(rs8m_matrix, invert) {
+    enum { Size = 20 };
+
+    const Gf256& gf = Gf256::instance();
+
+    uint8_t mat[Size * Size], orig[Size * Size], work[Size * Size];
+
+    for (size_t r = 0; r < Size; r++) {
+        for (size_t c = 0; c < Size; c++) {
+            // vandermonde matrix with distinct points is never singular
+            mat[r * Size + c] = orig[r * Size + c] = gf.exp((r + 1) * c);
+        }
+    }
+
+    CHECK(Rs8mMatrix::invert(mat, work, Size));
+
+    // inverse * original = identity
+    for (size_t r = 0; r < Size; r++) {
+        for (size_t c = 0; c < Size; c++) {
+            uint8_t sum = 0;
+            for (size_t k = 0; k < Size; k++) {
+                sum ^= gf.mul(mat[r * Size + k], orig[k * Size + c]);
+            }
+            UNSIGNED_LONGS_EQUAL(r == c ? 1 : 0, sum);
+        }
+    }
+}
+
+TEST(rs8m_matrix, invert_singular) {
+    enum { Size = 3 };
+
+    uint8_t mat[Size * Size] = { 1, 2, 3, 2, 4, 6, 5, 6, 7 };
+    uint8_t work[Size * Size];
+
+    // second row is first multiplied by 2
+    CHECK(!Rs8mMatrix::invert(mat, work, Size));
+}
+
+TEST(rs8m_matrix, build) {
+    Rs8mMatrix matrix(allocator);
+
+    CHECK(!matrix.build(0, 10));
+    CHECK(!matrix.build(200, 56));
+
+    CHECK(matrix.build(20, 10));
+    UNSIGNED_LONGS_EQUAL(20, matrix.sblen());
+    UNSIGNED_LONGS_EQUAL(10, matrix.rblen());
+
+    // for MDS code, replacing any row of identity part with any repair row
+    // should give non-singular matrix, so all coefficients should be non-zero
+    for (size_t r = 0; r < 10; r++) {
+        for (size_t n = 0; n < 20; n++) {
+            CHECK(matrix.repair_row(r)[n] != 0);
+        }
+    }
+}
+
+} // namespace fec
+} // namespace roc
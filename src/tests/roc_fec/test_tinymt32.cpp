@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_fec/tinymt32.h"
+
+namespace roc {
+namespace fec {
+
+TEST_GROUP(tinymt32) {};
+
+TEST(tinymt32, reference_sequence) {
+    // first outputs of TinyMT32 with RFC 8682 parameters and seed 1
+    const uint32_t expected[] = {
+        2545341989u, 981918433u, 3715302833u, 2387538352u, 3591001365u,
+    };
+
+    TinyMT32 prng(1);
+
+    for (size_t n = 0; n < sizeof(expected) / sizeof(expected[0]); n++) {
+        UNSIGNED_LONGS_EQUAL(expected[n], prng.next_u32());
+    }
+}
+
+TEST(tinymt32, same_seed) {
+    TinyMT32 prng1(12345);
+    TinyMT32 prng2(12345);
+
+    for (size_t n = 0; n < 1000; n++) {
+        UNSIGNED_LONGS_EQUAL(prng1.next_u32(), prng2.next_u32());
+    }
+}
+
+TEST(tinymt32, ranges) {
+    TinyMT32 prng(7);
+
+    for (size_t n = 0; n < 1000; n++) {
+        CHECK(prng.next_u4() < 16);
+        CHECK(prng.next_u8() < 256);
+    }
+}
+
+} // namespace fec
+} // namespace roc
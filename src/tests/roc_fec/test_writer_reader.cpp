@@ -14,11 +14,13 @@
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_fec/batch_encoder.h"
 #include "roc_fec/codec_map.h"
 #include "roc_fec/composer.h"
 #include "roc_fec/headers.h"
 #include "roc_fec/parser.h"
 #include "roc_fec/reader.h"
+#include "roc_fec/repair_pool.h"
 #include "roc_fec/writer.h"
 #include "roc_packet/interleaver.h"
 #include "roc_packet/packet_factory.h"
@@ -61,6 +63,113 @@ Composer<RS8M_PayloadID, Repair, Header> rs8m_repair_composer(NULL);
 Composer<LDPC_Source_PayloadID, Source, Footer> ldpc_source_composer(&rtp_composer);
 Composer<LDPC_Repair_PayloadID, Repair, Header> ldpc_repair_composer(NULL);
 
+// Forwards calls to another decoder and counts them.
+class CountingDecoder : public IBlockDecoder {
+public:
+    CountingDecoder(IBlockDecoder& decoder)
+        : decoder_(decoder)
+        , n_begin_(0)
+        , n_set_(0)
+        , n_repair_(0)
+        , n_end_(0) {
+    }
+
+    size_t num_begin() const {
+        return n_begin_;
+    }
+
+    size_t num_set() const {
+        return n_set_;
+    }
+
+    size_t num_repair() const {
+        return n_repair_;
+    }
+
+    size_t num_end() const {
+        return n_end_;
+    }
+
+    virtual size_t max_block_length() const {
+        return decoder_.max_block_length();
+    }
+
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size) {
+        n_begin_++;
+        return decoder_.begin(sblen, rblen, payload_size);
+    }
+
+    virtual void set(size_t index, const core::Slice<uint8_t>& buffer) {
+        n_set_++;
+        decoder_.set(index, buffer);
+    }
+
+    virtual core::Slice<uint8_t> repair(size_t index) {
+        n_repair_++;
+        return decoder_.repair(index);
+    }
+
+    virtual void end() {
+        n_end_++;
+        decoder_.end();
+    }
+
+private:
+    IBlockDecoder& decoder_;
+
+    size_t n_begin_;
+    size_t n_set_;
+    size_t n_repair_;
+    size_t n_end_;
+};
+
+// Forwards calls to another encoder and remembers buffers passed to it.
+class RecordingEncoder : public IBlockEncoder {
+public:
+    RecordingEncoder(IBlockEncoder& encoder)
+        : encoder_(encoder) {
+        for (size_t n = 0; n < NumSourcePackets + NumRepairPackets; n++) {
+            buffers_[n] = NULL;
+        }
+    }
+
+    const uint8_t* buffer(size_t index) const {
+        CHECK(index < NumSourcePackets + NumRepairPackets);
+        return buffers_[index];
+    }
+
+    virtual size_t alignment() const {
+        return encoder_.alignment();
+    }
+
+    virtual size_t max_block_length() const {
+        return encoder_.max_block_length();
+    }
+
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size) {
+        return encoder_.begin(sblen, rblen, payload_size);
+    }
+
+    virtual void set(size_t index, const core::Slice<uint8_t>& buffer) {
+        CHECK(index < NumSourcePackets + NumRepairPackets);
+        buffers_[index] = buffer.data();
+        encoder_.set(index, buffer);
+    }
+
+    virtual void fill() {
+        encoder_.fill();
+    }
+
+    virtual void end() {
+        encoder_.end();
+    }
+
+private:
+    IBlockEncoder& encoder_;
+
+    const uint8_t* buffers_[NumSourcePackets + NumRepairPackets];
+};
+
 } // namespace
 
 TEST_GROUP(writer_reader) {
@@ -255,6 +364,52 @@ TEST(writer_reader, no_losses) {
     }
 }
 
+TEST(writer_reader, encoder_uses_packet_buffers) {
+    // Encoder should read source payloads and write repair payloads in place,
+    // without intermediate copies.
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        CHECK(encoder);
+
+        RecordingEncoder recording_encoder(*encoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, recording_encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory,
+                      buffer_factory, allocator);
+
+        CHECK(writer.valid());
+
+        fill_all_packets(0);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            writer.write(source_packets[i]);
+        }
+        dispatcher.push_stocks();
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            POINTERS_EQUAL(source_packets[i]->fec()->payload.data(),
+                           recording_encoder.buffer(i));
+        }
+
+        for (size_t i = 0; i < NumRepairPackets; ++i) {
+            packet::PacketPtr p = dispatcher.repair_reader().read();
+            CHECK(p);
+
+            POINTERS_EQUAL(p->fec()->payload.data(),
+                           recording_encoder.buffer(NumSourcePackets + i));
+        }
+    }
+}
+
 TEST(writer_reader, 1_loss) {
     for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
         codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
@@ -781,6 +936,532 @@ TEST(writer_reader, late_out_of_order_packets) {
     }
 }
 
+TEST(writer_reader, no_decoding_without_losses) {
+    // Complete blocks should not reach decoder at all, even though
+    // repair packets for them are received.
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        CountingDecoder counting_decoder(*decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory,
+                      buffer_factory, allocator);
+
+        Reader reader(reader_config, codec_config.scheme, counting_decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, allocator);
+
+        CHECK(writer.valid());
+        CHECK(reader.valid());
+
+        for (size_t n_block = 0; n_block < 3; n_block++) {
+            fill_all_packets(NumSourcePackets * n_block);
+
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                writer.write(source_packets[i]);
+            }
+            dispatcher.push_stocks();
+
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                packet::PacketPtr p = reader.read();
+                CHECK(p);
+                check_audio_packet(p, NumSourcePackets * n_block + i);
+                check_restored(p, false);
+            }
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, counting_decoder.num_begin());
+        UNSIGNED_LONGS_EQUAL(0, counting_decoder.num_set());
+        UNSIGNED_LONGS_EQUAL(0, counting_decoder.num_repair());
+        UNSIGNED_LONGS_EQUAL(0, counting_decoder.num_end());
+    }
+}
+
+TEST(writer_reader, no_decoding_after_late_packet) {
+    // 1. Deliver all packets except one source packet.
+    // 2. Read packets before the missing one; decoding is started.
+    // 3. Deliver missing packet.
+    // 4. Read the rest packets; decoding is stopped without repairing.
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        CountingDecoder counting_decoder(*decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory,
+                      buffer_factory, allocator);
+
+        Reader reader(reader_config, codec_config.scheme, counting_decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, allocator);
+
+        CHECK(writer.valid());
+        CHECK(reader.valid());
+
+        const size_t late_packet = 5;
+
+        fill_all_packets(0);
+        dispatcher.delay(late_packet);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            writer.write(source_packets[i]);
+        }
+        dispatcher.push_stocks();
+
+        for (size_t i = 0; i < late_packet; ++i) {
+            packet::PacketPtr p = reader.read();
+            CHECK(p);
+            check_audio_packet(p, i);
+            check_restored(p, false);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, counting_decoder.num_begin());
+        UNSIGNED_LONGS_EQUAL(0, counting_decoder.num_end());
+
+        dispatcher.push_delayed(late_packet);
+
+        for (size_t i = late_packet; i < NumSourcePackets; ++i) {
+            packet::PacketPtr p = reader.read();
+            CHECK(p);
+            check_audio_packet(p, i);
+            check_restored(p, false);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, counting_decoder.num_begin());
+        UNSIGNED_LONGS_EQUAL(1, counting_decoder.num_end());
+        UNSIGNED_LONGS_EQUAL(0, counting_decoder.num_repair());
+        UNSIGNED_LONGS_EQUAL(NumSourcePackets - 1 + NumRepairPackets,
+                             counting_decoder.num_set());
+    }
+}
+
+TEST(writer_reader, skip_silence) {
+    enum { NumBlocks = 4, LostPacket = 2 };
+
+    // number of silent packets and repair packets sent in every block
+    const size_t silent_packets[NumBlocks] = { 10, NumSourcePackets, 1, 0 };
+    const size_t repair_packets[NumBlocks] = { 5, 0, NumRepairPackets,
+                                               NumRepairPackets };
+
+    writer_config.skip_silence = true;
+
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory,
+                      buffer_factory, allocator);
+
+        Reader reader(reader_config, codec_config.scheme, *decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, allocator);
+
+        CHECK(writer.valid());
+        CHECK(reader.valid());
+
+        // audible packet is lost in partially protected block
+        dispatcher.lose(LostPacket);
+
+        size_t total_repair = 0;
+
+        for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+            fill_all_packets(n_block * NumSourcePackets);
+
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                // silent packets are at the end of block
+                if (i >= NumSourcePackets - silent_packets[n_block]) {
+                    source_packets[i]->add_flags(packet::Packet::FlagZeros);
+                }
+                writer.write(source_packets[i]);
+            }
+
+            dispatcher.clear_losses();
+
+            total_repair += repair_packets[n_block];
+            UNSIGNED_LONGS_EQUAL(total_repair, dispatcher.repair_size());
+        }
+
+        CHECK(writer.alive());
+
+        dispatcher.push_stocks();
+
+        for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                packet::PacketPtr p = reader.read();
+                CHECK(p);
+                check_audio_packet(p, n_block * NumSourcePackets + i);
+                check_restored(p, n_block == 0 && i == LostPacket);
+            }
+        }
+    }
+}
+
+TEST(writer_reader, batch_encoder) {
+    enum { NumWriters = 3, NumBlocks = 5 };
+
+    codec_config.scheme = packet::FEC_ReedSolomon_M8;
+
+    BatchEncoder batch_encoder(allocator);
+
+    core::ScopedPtr<IBlockEncoder> encoders[NumWriters];
+    core::ScopedPtr<IBlockDecoder> decoders[NumWriters];
+
+    core::ScopedPtr<test::PacketDispatcher> dispatchers[NumWriters];
+    core::ScopedPtr<Writer> writers[NumWriters];
+    core::ScopedPtr<Reader> readers[NumWriters];
+
+    for (size_t n = 0; n < NumWriters; n++) {
+        encoders[n].reset(
+            CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+            allocator);
+        decoders[n].reset(
+            CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        CHECK(encoders[n]);
+        CHECK(decoders[n]);
+
+        dispatchers[n].reset(new (allocator) test::PacketDispatcher(
+                                 source_parser(), repair_parser(), packet_factory,
+                                 NumSourcePackets, NumRepairPackets),
+                             allocator);
+
+        writers[n].reset(new (allocator)
+                             Writer(writer_config, codec_config.scheme, *encoders[n],
+                                    *dispatchers[n], source_composer(),
+                                    repair_composer(), packet_factory, buffer_factory,
+                                    allocator, &batch_encoder),
+                         allocator);
+
+        readers[n].reset(new (allocator) Reader(reader_config, codec_config.scheme,
+                                                *decoders[n],
+                                                dispatchers[n]->source_reader(),
+                                                dispatchers[n]->repair_reader(),
+                                                rtp_parser, packet_factory, allocator),
+                         allocator);
+
+        CHECK(writers[n]->valid());
+        CHECK(readers[n]->valid());
+
+        // every writer loses different packet
+        dispatchers[n]->lose(n * 3 + 1);
+    }
+
+    for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+        for (size_t n = 0; n < NumWriters; n++) {
+            fill_all_packets(n_block * NumSourcePackets);
+
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                writers[n]->write(source_packets[i]);
+            }
+
+            // repair packets are delayed until flush
+            UNSIGNED_LONGS_EQUAL(n_block * NumRepairPackets,
+                                 dispatchers[n]->repair_size());
+        }
+
+        for (size_t n = 0; n < NumWriters; n++) {
+            writers[n]->flush();
+
+            UNSIGNED_LONGS_EQUAL((n_block + 1) * NumRepairPackets,
+                                 dispatchers[n]->repair_size());
+        }
+    }
+
+    for (size_t n = 0; n < NumWriters; n++) {
+        dispatchers[n]->push_stocks();
+
+        for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                packet::PacketPtr p = readers[n]->read();
+                CHECK(p);
+                check_audio_packet(p, n_block * NumSourcePackets + i);
+                check_restored(p, i == n * 3 + 1);
+            }
+        }
+
+        CHECK(writers[n]->alive());
+        CHECK(readers[n]->alive());
+    }
+}
+
+TEST(writer_reader, batch_encoder_no_flush) {
+    enum { NumBlocks = 3 };
+
+    codec_config.scheme = packet::FEC_ReedSolomon_M8;
+
+    BatchEncoder batch_encoder(allocator);
+
+    core::ScopedPtr<IBlockEncoder> encoder(
+        CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+        allocator);
+
+    core::ScopedPtr<IBlockDecoder> decoder(
+        CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+        allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    test::PacketDispatcher dispatcher(source_parser(), repair_parser(), packet_factory,
+                                      NumSourcePackets, NumRepairPackets);
+
+    Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                  source_composer(), repair_composer(), packet_factory, buffer_factory,
+                  allocator, &batch_encoder);
+
+    Reader reader(reader_config, codec_config.scheme, *decoder,
+                  dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                  packet_factory, allocator);
+
+    CHECK(writer.valid());
+    CHECK(reader.valid());
+
+    dispatcher.lose(10);
+
+    for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+        fill_all_packets(n_block * NumSourcePackets);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            writer.write(source_packets[i]);
+        }
+    }
+
+    // repair packets of previous blocks are flushed when next block begins;
+    // one source packet of every block is lost
+    UNSIGNED_LONGS_EQUAL(NumBlocks * (NumSourcePackets - 1), dispatcher.source_size());
+    UNSIGNED_LONGS_EQUAL((NumBlocks - 1) * NumRepairPackets, dispatcher.repair_size());
+
+    writer.flush();
+
+    UNSIGNED_LONGS_EQUAL(NumBlocks * NumRepairPackets, dispatcher.repair_size());
+
+    dispatcher.push_stocks();
+
+    for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            packet::PacketPtr p = reader.read();
+            CHECK(p);
+            check_audio_packet(p, n_block * NumSourcePackets + i);
+            check_restored(p, i == 10);
+        }
+    }
+}
+
+TEST(writer_reader, batch_encoder_unsupported_scheme) {
+    codec_config.scheme = packet::FEC_LDPC_Staircase;
+
+    if (!CodecMap::instance().is_supported(codec_config.scheme)) {
+        return;
+    }
+
+    BatchEncoder batch_encoder(allocator);
+
+    core::ScopedPtr<IBlockEncoder> encoder(
+        CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+        allocator);
+
+    CHECK(encoder);
+
+    packet::Queue queue;
+
+    Writer writer(writer_config, codec_config.scheme, *encoder, queue,
+                  source_composer(), repair_composer(), packet_factory, buffer_factory,
+                  allocator, &batch_encoder);
+
+    CHECK(!writer.valid());
+}
+
+TEST(writer_reader, background_decoding) {
+    enum { NumBlocks = 5 };
+
+    RepairPool repair_pool(2, core::ThreadConfig(), allocator);
+    CHECK(repair_pool.valid());
+
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory,
+                      buffer_factory, allocator);
+
+        Reader reader(reader_config, codec_config.scheme, *decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, allocator, &repair_pool);
+
+        CHECK(writer.valid());
+        CHECK(reader.valid());
+
+        dispatcher.lose(3);
+        dispatcher.lose(11);
+
+        for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+            fill_all_packets(n_block * NumSourcePackets);
+
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                writer.write(source_packets[i]);
+            }
+        }
+        dispatcher.push_stocks();
+
+        for (size_t n_block = 0; n_block < NumBlocks; n_block++) {
+            for (size_t i = 0; i < NumSourcePackets; ++i) {
+                packet::PacketPtr p = reader.read();
+                CHECK(p);
+                check_audio_packet(p, n_block * NumSourcePackets + i);
+                check_restored(p, i == 3 || i == 11);
+            }
+        }
+
+        CHECK(reader.alive());
+    }
+}
+
+TEST(writer_reader, background_decoding_packets_during_decoding) {
+    // 1. Deliver enough packets to start decoding; one source packet is lost
+    //    and another is delayed.
+    // 2. Read packets before the lost one; decoding task is scheduled.
+    // 3. Deliver delayed packet and the rest of repair packets while task
+    //    is still pending.
+    // 4. Read the rest packets; lost packet is restored and delayed one
+    //    is returned as is.
+    // Pool has no threads, so the task is executed when lost packet is needed.
+    RepairPool repair_pool(0, core::ThreadConfig(), allocator);
+    CHECK(repair_pool.valid());
+
+    for (size_t n_scheme = 0; n_scheme < CodecMap::instance().num_schemes(); n_scheme++) {
+        codec_config.scheme = CodecMap::instance().nth_scheme(n_scheme);
+
+        core::ScopedPtr<IBlockEncoder> encoder(
+            CodecMap::instance().new_encoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        core::ScopedPtr<IBlockDecoder> decoder(
+            CodecMap::instance().new_decoder(codec_config, buffer_factory, allocator),
+            allocator);
+
+        CHECK(encoder);
+        CHECK(decoder);
+
+        CountingDecoder counting_decoder(*decoder);
+
+        test::PacketDispatcher dispatcher(source_parser(), repair_parser(),
+                                          packet_factory, NumSourcePackets,
+                                          NumRepairPackets);
+
+        Writer writer(writer_config, codec_config.scheme, *encoder, dispatcher,
+                      source_composer(), repair_composer(), packet_factory,
+                      buffer_factory, allocator);
+
+        Reader reader(reader_config, codec_config.scheme, counting_decoder,
+                      dispatcher.source_reader(), dispatcher.repair_reader(), rtp_parser,
+                      packet_factory, allocator, &repair_pool);
+
+        CHECK(writer.valid());
+        CHECK(reader.valid());
+
+        const size_t lost_packet = 5;
+        const size_t late_packet = 9;
+
+        fill_all_packets(0);
+        dispatcher.lose(lost_packet);
+        dispatcher.delay(late_packet);
+
+        for (size_t i = 0; i < NumSourcePackets; ++i) {
+            writer.write(source_packets[i]);
+        }
+
+        dispatcher.push_source_stock(NumSourcePackets - 2);
+        dispatcher.push_repair_stock(2);
+
+        for (size_t i = 0; i < lost_packet; ++i) {
+            packet::PacketPtr p = reader.read();
+            CHECK(p);
+            check_audio_packet(p, i);
+            check_restored(p, false);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, counting_decoder.num_begin());
+        UNSIGNED_LONGS_EQUAL(0, counting_decoder.num_repair());
+
+        dispatcher.push_delayed(late_packet);
+        dispatcher.push_repair_stock(NumRepairPackets - 2);
+
+        for (size_t i = lost_packet; i < NumSourcePackets; ++i) {
+            packet::PacketPtr p = reader.read();
+            CHECK(p);
+            check_audio_packet(p, i);
+            check_restored(p, i == lost_packet);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, counting_decoder.num_begin());
+        UNSIGNED_LONGS_EQUAL(1, counting_decoder.num_end());
+
+        CHECK(reader.alive());
+    }
+}
+
 TEST(writer_reader, repair_packets_before_source_packets) {
     writer_config.n_source_packets = 30;
     writer_config.n_repair_packets = 40;
@@ -2032,11 +2713,16 @@ TEST(writer_reader, writer_resize_blocks) {
             CHECK(writer.resize(source_sizes[n], repair_sizes[n]));
 
             for (size_t i = 0; i < source_sizes[n]; ++i) {
+                // payload size may be changed only at block boundary
+                CHECK(writer.is_block_boundary() == (i == 0));
+
                 packet::PacketPtr p = fill_one_packet(wr_sn, payload_sizes[n]);
                 wr_sn++;
                 writer.write(p);
             }
 
+            CHECK(writer.is_block_boundary());
+
             UNSIGNED_LONGS_EQUAL(source_sizes[n], dispatcher.source_size());
             UNSIGNED_LONGS_EQUAL(repair_sizes[n], dispatcher.repair_size());
 
@@ -2629,22 +3315,14 @@ TEST(writer_reader, error_reader_decode_packet) {
             writer.write(fill_one_packet(sn++));
         }
 
-        // deliver second block
-        dispatcher.push_stocks();
-
-        // read second block packets before loss
-        for (size_t i = 0; i < 10; ++i) {
-            packet::PacketPtr p = reader.read();
-            CHECK(p);
-            check_audio_packet(p, BlockSize1 + i);
-            check_restored(p, false);
-        }
-
         // configure allocator to return errors
         mock_allocator.set_fail(true);
 
-        // reader should get an error from allocator when trying
-        // to repair lost packet and shut down
+        // deliver second block
+        dispatcher.push_stocks();
+
+        // reader should get an error from allocator when it detects loss
+        // and starts decoding second block, and shut down
         CHECK(!reader.read());
         CHECK(!reader.alive());
     }
@@ -2963,8 +3641,10 @@ TEST(writer_reader, reader_invalid_fec_scheme_source_packet) {
             packet::PacketPtr p = writer_queue.read();
             CHECK(p);
             CHECK((p->flags() & packet::Packet::FlagRepair) == 0);
-            p->fec()->fec_scheme = CodecMap::instance().nth_scheme(
-                (n_scheme + 1) % CodecMap::instance().num_schemes());
+            // use any other scheme, even if it's not supported
+            p->fec()->fec_scheme = codec_config.scheme == packet::FEC_ReedSolomon_M8
+                ? packet::FEC_LDPC_Staircase
+                : packet::FEC_ReedSolomon_M8;
             source_queue.write(p);
             UNSIGNED_LONGS_EQUAL(1, source_queue.size());
         }
@@ -3043,8 +3723,10 @@ TEST(writer_reader, reader_invalid_fec_scheme_repair_packet) {
             packet::PacketPtr p = writer_queue.read();
             CHECK(p);
             CHECK((p->flags() & packet::Packet::FlagRepair) != 0);
-            p->fec()->fec_scheme = CodecMap::instance().nth_scheme(
-                (n_scheme + 1) % CodecMap::instance().num_schemes());
+            // use any other scheme, even if it's not supported
+            p->fec()->fec_scheme = codec_config.scheme == packet::FEC_ReedSolomon_M8
+                ? packet::FEC_LDPC_Staircase
+                : packet::FEC_ReedSolomon_M8;
             repair_queue.write(p);
             UNSIGNED_LONGS_EQUAL(1, repair_queue.size());
         }
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_address/socket_addr.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/list.h"
+#include "roc_core/panic.h"
+#include "roc_netio/network_loop.h"
+#include "roc_packet/packet_factory.h"
+
+// These benchmarks measure cost of writing packets to a single UDP sender port
+// from multiple threads, like when several sender pipelines share one port.
+//
+// Packets are sent to a receiver port on localhost, which drops them.
+// Every iteration allocates a new packet, but all packets share one buffer.
+//
+// Pending packets counter and wakeup flag, which are written by both writer
+// threads and event loop thread, occupy separate cache lines, so that writers
+// don't invalidate the line with fields used only by event loop thread. The
+// effect is visible only when writers and event loop run on different cores.
+
+namespace roc {
+namespace netio {
+namespace {
+
+enum { NumThreads = 8, BatchSize = 32, PacketSize = 200 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, PacketSize, false);
+packet::PacketFactory packet_factory(allocator, false);
+
+class NoopWriter : public packet::IWriter {
+public:
+    virtual void write(const packet::PacketPtr&) {
+    }
+};
+
+struct BM_UdpSenderContention : benchmark::Fixture {
+    NoopWriter rx_writer;
+    NetworkLoop net_loop;
+
+    UdpSenderConfig tx_config;
+    UdpReceiverConfig rx_config;
+
+    packet::IWriter* tx_writer;
+    core::Slice<uint8_t> buffer;
+
+    BM_UdpSenderContention()
+        : net_loop(packet_factory, buffer_factory, allocator)
+        , tx_writer(NULL) {
+        if (!net_loop.valid()) {
+            roc_panic("bench: can't create network loop");
+        }
+
+        if (!rx_config.bind_address.set_host_port(address::Family_IPv4, "127.0.0.1",
+                                                  0)) {
+            roc_panic("bench: can't set receiver address");
+        }
+
+        NetworkLoop::Tasks::AddUdpReceiverPort rx_task(rx_config, rx_writer);
+        if (!net_loop.schedule_and_wait(rx_task)) {
+            roc_panic("bench: can't add receiver port");
+        }
+
+        if (!tx_config.bind_address.set_host_port(address::Family_IPv4, "127.0.0.1",
+                                                  0)) {
+            roc_panic("bench: can't set sender address");
+        }
+
+        NetworkLoop::Tasks::AddUdpSenderPort tx_task(tx_config);
+        if (!net_loop.schedule_and_wait(tx_task)) {
+            roc_panic("bench: can't add sender port");
+        }
+        tx_writer = tx_task.get_writer();
+
+        buffer = buffer_factory.new_buffer();
+        if (!buffer) {
+            roc_panic("bench: can't allocate buffer");
+        }
+        buffer.reslice(0, PacketSize);
+        memset(buffer.data(), 0, PacketSize);
+    }
+
+    packet::PacketPtr new_packet() {
+        packet::PacketPtr pp = packet_factory.new_packet();
+        if (!pp) {
+            roc_panic("bench: can't allocate packet");
+        }
+
+        pp->add_flags(packet::Packet::FlagUDP);
+        pp->udp()->src_addr = tx_config.bind_address;
+        pp->udp()->dst_addr = rx_config.bind_address;
+        pp->set_data(buffer);
+
+        return pp;
+    }
+};
+
+BENCHMARK_DEFINE_F(BM_UdpSenderContention, Write)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        tx_writer->write(new_packet());
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK_REGISTER_F(BM_UdpSenderContention, Write)
+    ->ThreadRange(1, NumThreads)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(BM_UdpSenderContention, WriteBatch)(benchmark::State& state) {
+    core::List<packet::Packet> batch;
+
+    while (state.KeepRunningBatch(BatchSize)) {
+        for (int n = 0; n < BatchSize; n++) {
+            batch.push_back(*new_packet());
+        }
+        tx_writer->write_batch(batch);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK_REGISTER_F(BM_UdpSenderContention, WriteBatch)
+    ->ThreadRange(1, NumThreads)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace netio
+} // namespace roc
@@ -11,6 +11,7 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "roc_core/buffer_factory.h"
 #include "roc_core/fast_random.h"
 #include "roc_core/stddefs.h"
 #include "roc_core/thread.h"
@@ -24,10 +25,16 @@ namespace test {
 
 class ConnReader : public core::Thread {
 public:
-    ConnReader(MockConnHandler& handler, IConn& conn, size_t total_bytes)
+    //! If @p buffer_factory is non-NULL, data is read into slices allocated
+    //! from it using try_read_slice().
+    ConnReader(MockConnHandler& handler,
+               IConn& conn,
+               size_t total_bytes,
+               core::BufferFactory<uint8_t>* buffer_factory = NULL)
         : handler_(handler)
         , conn_(conn)
-        , total_bytes_(total_bytes) {
+        , total_bytes_(total_bytes)
+        , buffer_factory_(buffer_factory) {
     }
 
 private:
@@ -51,7 +58,8 @@ private:
                 uint8_t buf[MaxBatch];
                 memset(buf, 0, sizeof(buf));
 
-                const ssize_t ret = conn_.try_read(buf, bufsz);
+                const ssize_t ret = buffer_factory_ ? read_slice_(buf, bufsz)
+                                                    : conn_.try_read(buf, bufsz);
 
                 if (ret == IOErr_WouldBlock) {
                     break;
@@ -73,10 +81,34 @@ private:
         }
     }
 
+    ssize_t read_slice_(uint8_t* buf, size_t& bufsz) {
+        core::Slice<uint8_t> slice = buffer_factory_->new_buffer();
+        roc_panic_if_not(slice);
+
+        // check that bytes are appended after existing slice contents
+        const size_t pos = core::fast_random(0, slice.capacity() - 1);
+        slice.reslice(0, pos);
+
+        const ssize_t ret = conn_.try_read_slice(slice);
+
+        bufsz = slice.capacity() - pos;
+
+        if (ret > 0) {
+            roc_panic_if_not(slice.size() == pos + (size_t)ret);
+            memcpy(buf, slice.data() + pos, (size_t)ret);
+        } else {
+            roc_panic_if_not(slice.size() == pos);
+        }
+
+        return ret;
+    }
+
     MockConnHandler& handler_;
     IConn& conn_;
 
     const size_t total_bytes_;
+
+    core::BufferFactory<uint8_t>* buffer_factory_;
 };
 
 } // namespace test
@@ -11,6 +11,7 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "roc_core/buffer_factory.h"
 #include "roc_core/fast_random.h"
 #include "roc_core/stddefs.h"
 #include "roc_core/thread.h"
@@ -25,10 +26,16 @@ namespace test {
 
 class ConnWriter : public core::Thread {
 public:
-    ConnWriter(MockConnHandler& handler, IConn& conn, size_t total_bytes)
+    //! If @p buffer_factory is non-NULL, data is split into slices allocated
+    //! from it and written using try_write_vec().
+    ConnWriter(MockConnHandler& handler,
+               IConn& conn,
+               size_t total_bytes,
+               core::BufferFactory<uint8_t>* buffer_factory = NULL)
         : handler_(handler)
         , conn_(conn)
-        , total_bytes_(total_bytes) {
+        , total_bytes_(total_bytes)
+        , buffer_factory_(buffer_factory) {
     }
 
 private:
@@ -59,14 +66,15 @@ private:
                     buf[i] = (uint8_t)(current_byte + i);
                 }
 
-                const ssize_t ret = conn_.try_write(buf, bufsz);
+                const ssize_t ret = buffer_factory_ ? write_vec_(buf, bufsz)
+                                                    : conn_.try_write(buf, bufsz);
 
                 if (ret == IOErr_WouldBlock) {
                     break;
                 } else {
                     if (ret < 1 || ret > (ssize_t)bufsz) {
                         roc_panic(
-                            "conn reader: try_write() returned %ld, expected [1; %ld]",
+                            "conn writer: try_write() returned %ld, expected [1; %ld]",
                             (long)ret, (long)bufsz);
                     }
                 }
@@ -77,10 +85,38 @@ private:
         }
     }
 
+    ssize_t write_vec_(const uint8_t* buf, size_t bufsz) {
+        enum { MaxSlices = 4 };
+
+        core::Slice<uint8_t> slices[MaxSlices];
+        size_t n_slices = 0;
+
+        size_t pos = 0;
+        while (pos < bufsz && n_slices < MaxSlices) {
+            slices[n_slices] = buffer_factory_->new_buffer();
+            roc_panic_if_not(slices[n_slices]);
+
+            size_t slicesz = core::fast_random(1, bufsz - pos);
+            if (slicesz > slices[n_slices].capacity()) {
+                slicesz = slices[n_slices].capacity();
+            }
+
+            slices[n_slices].reslice(0, slicesz);
+            memcpy(slices[n_slices].data(), buf + pos, slicesz);
+
+            pos += slicesz;
+            n_slices++;
+        }
+
+        return conn_.try_write_vec(slices, n_slices);
+    }
+
     MockConnHandler& handler_;
     IConn& conn_;
 
     const size_t total_bytes_;
+
+    core::BufferFactory<uint8_t>* buffer_factory_;
 };
 
 } // namespace test
@@ -10,7 +10,9 @@
 
 #include "roc_address/socket_addr_to_str.h"
 #include "roc_core/buffer_factory.h"
+#include "roc_core/cond.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/mutex.h"
 #include "roc_netio/network_loop.h"
 #include "roc_packet/packet_factory.h"
 
@@ -39,6 +41,46 @@ bool resolve_endpoint_address(NetworkLoop& net_loop,
     return true;
 }
 
+class CountingCompleter : public INetworkTaskCompleter {
+public:
+    CountingCompleter()
+        : cond_(mutex_)
+        , n_tasks_(0) {
+    }
+
+    virtual void network_task_completed(NetworkTask&) {
+        core::Mutex::Lock lock(mutex_);
+        n_tasks_++;
+        cond_.broadcast();
+    }
+
+    void wait_tasks(size_t n_tasks) {
+        core::Mutex::Lock lock(mutex_);
+        while (n_tasks_ < n_tasks) {
+            cond_.wait();
+        }
+    }
+
+private:
+    core::Mutex mutex_;
+    core::Cond cond_;
+    size_t n_tasks_;
+};
+
+void check_localhost(const address::SocketAddr& address, const char* port) {
+    CHECK(address.family() == address::Family_IPv4
+          || address.family() == address::Family_IPv6);
+
+    char expected[64] = {};
+    if (address.family() == address::Family_IPv4) {
+        snprintf(expected, sizeof(expected), "127.0.0.1:%s", port);
+    } else {
+        snprintf(expected, sizeof(expected), "[::1]:%s", port);
+    }
+
+    STRCMP_EQUAL(expected, address::socket_addr_to_str(address).c_str());
+}
+
 } // namespace
 
 TEST_GROUP(resolve) {};
@@ -94,6 +136,68 @@ TEST(resolve, hostname) {
     }
 }
 
+TEST(resolve, hostname_cached) {
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    address::EndpointUri endpoint_uri1(allocator);
+    CHECK(address::parse_endpoint_uri("rtp://localhost:123",
+                                      address::EndpointUri::Subset_Full, endpoint_uri1));
+
+    address::EndpointUri endpoint_uri2(allocator);
+    CHECK(address::parse_endpoint_uri("rtp://localhost:456",
+                                      address::EndpointUri::Subset_Full, endpoint_uri2));
+
+    for (int n = 0; n < 3; n++) {
+        address::SocketAddr address1;
+        CHECK(resolve_endpoint_address(net_loop, endpoint_uri1, address1));
+        check_localhost(address1, "123");
+
+        address::SocketAddr address2;
+        CHECK(resolve_endpoint_address(net_loop, endpoint_uri2, address2));
+        check_localhost(address2, "456");
+    }
+}
+
+TEST(resolve, hostname_concurrent) {
+    enum { NumTasks = 10 };
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    address::EndpointUri endpoint_uri(allocator);
+    CHECK(address::parse_endpoint_uri("rtp://localhost:123",
+                                      address::EndpointUri::Subset_Full, endpoint_uri));
+
+    NetworkLoop::Tasks::ResolveEndpointAddress task0(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task1(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task2(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task3(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task4(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task5(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task6(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task7(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task8(endpoint_uri);
+    NetworkLoop::Tasks::ResolveEndpointAddress task9(endpoint_uri);
+
+    NetworkLoop::Tasks::ResolveEndpointAddress* tasks[NumTasks] = {
+        &task0, &task1, &task2, &task3, &task4, &task5, &task6, &task7, &task8, &task9,
+    };
+
+    CountingCompleter completer;
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        net_loop.schedule(*tasks[n], completer);
+    }
+
+    completer.wait_tasks(NumTasks);
+
+    for (size_t n = 0; n < NumTasks; n++) {
+        CHECK(tasks[n]->success());
+        check_localhost(tasks[n]->get_address(), "123");
+    }
+}
+
 TEST(resolve, standard_port) {
     NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
     CHECK(net_loop.valid());
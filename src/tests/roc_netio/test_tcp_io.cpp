@@ -179,6 +179,58 @@ TEST(tcp_io, one_server_one_client_both_directions) {
     POINTERS_EQUAL(&server_conn_handler, acceptor.wait_removed());
 }
 
+TEST(tcp_io, one_server_one_client_slices) {
+    test::MockConnHandler client_conn_handler;
+    test::MockConnHandler server_conn_handler;
+
+    test::MockConnAcceptor acceptor;
+    acceptor.push_handler(server_conn_handler);
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    TcpServerConfig server_config = make_server_config("127.0.0.1", 0);
+
+    CHECK(add_tcp_server(net_loop, server_config, acceptor));
+
+    TcpClientConfig client_config = make_client_config("127.0.0.1", 0, "127.0.0.1",
+                                                       server_config.bind_address.port());
+
+    CHECK(add_tcp_client(net_loop, client_config, client_conn_handler));
+
+    IConn* server_conn = server_conn_handler.wait_established();
+    IConn* client_conn = client_conn_handler.wait_established();
+
+    POINTERS_EQUAL(server_conn, acceptor.wait_added());
+
+    test::ConnReader client_reader(client_conn_handler, *client_conn, TotalBytes,
+                                   &buffer_factory);
+    test::ConnWriter client_writer(client_conn_handler, *client_conn, TotalBytes,
+                                   &buffer_factory);
+
+    test::ConnReader server_reader(server_conn_handler, *server_conn, TotalBytes,
+                                   &buffer_factory);
+    test::ConnWriter server_writer(server_conn_handler, *server_conn, TotalBytes,
+                                   &buffer_factory);
+
+    client_reader.start();
+    server_reader.start();
+
+    client_writer.start();
+    server_writer.start();
+
+    client_writer.join();
+    server_writer.join();
+
+    client_reader.join();
+    server_reader.join();
+
+    terminate_and_wait(server_conn_handler, server_conn, test::ExpectNotFailed);
+    terminate_and_wait(client_conn_handler, client_conn, test::ExpectNotFailed);
+
+    POINTERS_EQUAL(&server_conn_handler, acceptor.wait_removed());
+}
+
 TEST(tcp_io, one_server_one_client_separate_loops) {
     test::MockConnHandler client_conn_handler;
     test::MockConnHandler server_conn_handler;
@@ -11,6 +11,7 @@
 #include "roc_address/socket_addr.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/list.h"
 #include "roc_netio/network_loop.h"
 #include "roc_packet/concurrent_queue.h"
 #include "roc_packet/packet_factory.h"
@@ -25,6 +26,7 @@ enum { NumIterations = 20, NumPackets = 10, BufferSize = 125 };
 core::HeapAllocator allocator;
 core::BufferFactory<uint8_t> buffer_factory(allocator, BufferSize, true);
 packet::PacketFactory packet_factory(allocator, true);
+packet::PacketFactory inline_packet_factory(allocator, BufferSize, true);
 
 UdpSenderConfig make_sender_config() {
     UdpSenderConfig config;
@@ -158,6 +160,230 @@ TEST(udp_io, one_sender_one_receiver_single_loop) {
     }
 }
 
+TEST(udp_io, one_sender_one_receiver_batching) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    tx_config.non_blocking_enabled = false;
+    tx_config.batching_enabled = true;
+    tx_config.gso_enabled = false;
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            tx_writer->write(new_packet(tx_config, rx_config, p));
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
+TEST(udp_io, one_sender_one_receiver_write_batch) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    for (int i = 0; i < NumIterations; i++) {
+        core::List<packet::Packet> batch;
+        for (int p = 0; p < NumPackets; p++) {
+            batch.push_back(*new_packet(tx_config, rx_config, p));
+        }
+        tx_writer->write_batch(batch);
+        UNSIGNED_LONGS_EQUAL(0, batch.size());
+
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
+TEST(udp_io, one_sender_one_receiver_batching_gso) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    tx_config.non_blocking_enabled = false;
+    tx_config.batching_enabled = true;
+    tx_config.gso_enabled = true;
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            tx_writer->write(new_packet(tx_config, rx_config, p));
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
+TEST(udp_io, one_sender_one_receiver_connected) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    tx_config.connect_address = rx_config.bind_address;
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            tx_writer->write(new_packet(tx_config, rx_config, p));
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
+TEST(udp_io, one_sender_one_receiver_connected_batching) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    tx_config.non_blocking_enabled = false;
+    tx_config.batching_enabled = true;
+    tx_config.gso_enabled = true;
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    tx_config.connect_address = rx_config.bind_address;
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            tx_writer->write(new_packet(tx_config, rx_config, p));
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
+TEST(udp_io, one_sender_one_receiver_recvmmsg) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    rx_config.enable_recvmmsg = true;
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            tx_writer->write(new_packet(tx_config, rx_config, p));
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
+TEST(udp_io, one_sender_one_receiver_inline_buffers) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    NetworkLoop net_loop(inline_packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            tx_writer->write(new_packet(tx_config, rx_config, p));
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
+TEST(udp_io, one_sender_one_receiver_recvmmsg_inline_buffers) {
+    packet::ConcurrentQueue rx_queue;
+
+    UdpSenderConfig tx_config = make_sender_config();
+    UdpReceiverConfig rx_config = make_receiver_config();
+
+    rx_config.enable_recvmmsg = true;
+
+    NetworkLoop net_loop(inline_packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    packet::IWriter* tx_writer = NULL;
+    CHECK(add_udp_sender(net_loop, tx_config, &tx_writer));
+    CHECK(tx_writer);
+
+    CHECK(add_udp_receiver(net_loop, rx_config, rx_queue));
+
+    for (int i = 0; i < NumIterations; i++) {
+        for (int p = 0; p < NumPackets; p++) {
+            tx_writer->write(new_packet(tx_config, rx_config, p));
+        }
+        for (int p = 0; p < NumPackets; p++) {
+            check_packet(rx_queue.read(), tx_config, rx_config, p);
+        }
+    }
+}
+
 TEST(udp_io, one_sender_one_receiver_separate_loops) {
     packet::ConcurrentQueue rx_queue;
 
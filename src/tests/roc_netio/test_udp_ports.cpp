@@ -165,6 +165,82 @@ TEST(udp_ports, add_addrinuse) {
     UNSIGNED_LONGS_EQUAL(0, net_loop2.num_ports());
 }
 
+#if defined(SO_REUSEPORT)
+
+TEST(udp_ports, add_reuseport) {
+    packet::ConcurrentQueue queue;
+
+    NetworkLoop net_loop1(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop1.valid());
+
+    NetworkLoop net_loop2(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop2.valid());
+
+    UdpReceiverConfig rx_config = make_receiver_config("127.0.0.1", 0);
+    rx_config.reuseport = true;
+
+    NetworkLoop::PortHandle rx_handle1 = add_udp_receiver(net_loop1, rx_config, queue);
+    CHECK(rx_handle1);
+    CHECK(rx_config.bind_address.port() != 0);
+
+    // same port can be bound again by another loop
+    NetworkLoop::PortHandle rx_handle2 = add_udp_receiver(net_loop2, rx_config, queue);
+    CHECK(rx_handle2);
+
+    UNSIGNED_LONGS_EQUAL(1, net_loop1.num_ports());
+    UNSIGNED_LONGS_EQUAL(1, net_loop2.num_ports());
+
+    // but only if reuseport is enabled
+    UdpReceiverConfig rx_config_no_reuse = rx_config;
+    rx_config_no_reuse.reuseport = false;
+
+    CHECK(!add_udp_receiver(net_loop2, rx_config_no_reuse, queue));
+
+    remove_port(net_loop1, rx_handle1);
+    remove_port(net_loop2, rx_handle2);
+
+    UNSIGNED_LONGS_EQUAL(0, net_loop1.num_ports());
+    UNSIGNED_LONGS_EQUAL(0, net_loop2.num_ports());
+}
+
+#endif // defined(SO_REUSEPORT)
+
+TEST(udp_ports, add_socket_options) {
+    packet::ConcurrentQueue queue;
+
+    NetworkLoop net_loop(packet_factory, buffer_factory, allocator);
+    CHECK(net_loop.valid());
+
+    UdpSenderConfig tx_config = make_sender_config("127.0.0.1", 0);
+    tx_config.send_buffer_size = 64 * 1024;
+    tx_config.dscp = 46;
+    tx_config.priority = 0;
+    tx_config.pacing_rate = 1024 * 1024;
+
+    UdpReceiverConfig rx_config = make_receiver_config("127.0.0.1", 0);
+    rx_config.recv_buffer_size = 64 * 1024;
+    rx_config.busy_poll_us = 50;
+
+    NetworkLoop::PortHandle tx_handle = add_udp_sender(net_loop, tx_config);
+    CHECK(tx_handle);
+
+    NetworkLoop::PortHandle rx_handle = add_udp_receiver(net_loop, rx_config, queue);
+    CHECK(rx_handle);
+
+    UNSIGNED_LONGS_EQUAL(2, net_loop.num_ports());
+
+    // DSCP is a 6-bit field
+    UdpSenderConfig bad_tx_config = make_sender_config("127.0.0.1", 0);
+    bad_tx_config.dscp = 64;
+
+    CHECK(!add_udp_sender(net_loop, bad_tx_config));
+
+    remove_port(net_loop, tx_handle);
+    remove_port(net_loop, rx_handle);
+
+    UNSIGNED_LONGS_EQUAL(0, net_loop.num_ports());
+}
+
 TEST(udp_ports, add_broadcast_sender) {
     packet::ConcurrentQueue queue;
 
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/interleaver.h"
+#include "roc_packet/packet_factory.h"
+
+// Interleaver throughput, in packets per second.
+//
+// Argument is interleaving block size.
+
+namespace roc {
+namespace packet {
+namespace {
+
+enum { NumPackets = 1024 };
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, false);
+
+class NullWriter : public IWriter {
+public:
+    virtual void write(const PacketPtr& packet) {
+        benchmark::DoNotOptimize(packet.get());
+    }
+};
+
+void BM_Interleaver_Write(benchmark::State& state) {
+    NullWriter writer;
+
+    Interleaver interleaver(writer, allocator, (size_t)state.range(0));
+    if (!interleaver.valid()) {
+        state.SkipWithError("can't create interleaver");
+        return;
+    }
+
+    PacketPtr packets[NumPackets];
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n] = packet_factory.new_packet();
+        packets[n]->add_flags(Packet::FlagRTP);
+        packets[n]->rtp()->seqnum = seqnum_t(n);
+    }
+
+    size_t pos = 0;
+
+    while (state.KeepRunning()) {
+        interleaver.write(packets[pos]);
+
+        if (++pos == NumPackets) {
+            pos = 0;
+        }
+    }
+
+    interleaver.flush();
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_Interleaver_Write)->RangeMultiplier(4)->Range(4, 256);
+
+} // namespace
+} // namespace packet
+} // namespace roc
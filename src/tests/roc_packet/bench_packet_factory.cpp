@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/slab_pool.h"
+#include "roc_core/thread.h"
+#include "roc_packet/concurrent_queue.h"
+#include "roc_packet/packet_factory.h"
+
+// Packet allocation throughput, in allocated and freed objects per second.
+//
+// AllocFree benchmarks allocate and free batches of objects from multiple
+// threads sharing one pool. CrossThread benchmark allocates packets on several
+// producer threads (the argument) and frees them on the benchmark thread, which
+// is the pattern of network thread and pipeline thread.
+
+namespace roc {
+namespace packet {
+namespace {
+
+enum {
+    BatchSize = 64,
+    MaxInFlight = 1024,
+    MaxThreads = 8,
+    ObjectSize = 256
+};
+
+core::HeapAllocator allocator;
+
+PacketFactory packet_factory(allocator, false);
+
+core::SlabPool slab_pool(allocator, ObjectSize, false, 0, 0, false);
+core::SlabPool slab_pool_cached(allocator, ObjectSize, false, 0, 0, true);
+
+void BM_PacketFactory_AllocFree(benchmark::State& state) {
+    PacketPtr packets[BatchSize];
+
+    while (state.KeepRunningBatch(BatchSize)) {
+        for (size_t n = 0; n < BatchSize; n++) {
+            packets[n] = packet_factory.new_packet();
+        }
+        for (size_t n = 0; n < BatchSize; n++) {
+            packets[n] = NULL;
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_PacketFactory_AllocFree)->ThreadRange(1, MaxThreads);
+
+void BM_SlabPool_AllocFree(benchmark::State& state) {
+    core::SlabPool& pool = state.range(0) ? slab_pool_cached : slab_pool;
+
+    void* objects[BatchSize];
+
+    while (state.KeepRunningBatch(BatchSize)) {
+        for (size_t n = 0; n < BatchSize; n++) {
+            objects[n] = pool.allocate();
+        }
+        for (size_t n = 0; n < BatchSize; n++) {
+            pool.deallocate(objects[n]);
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_SlabPool_AllocFree)->Arg(0)->Arg(1)->ThreadRange(1, MaxThreads);
+
+class ProducerThread : public core::Thread {
+public:
+    ProducerThread()
+        : queue_(NULL)
+        , credits_(NULL)
+        , in_flight_(NULL)
+        , stop_(NULL) {
+    }
+
+    void init(IWriter& queue,
+              core::Semaphore& credits,
+              core::Atomic<long>& in_flight,
+              core::Atomic<int>& stop) {
+        queue_ = &queue;
+        credits_ = &credits;
+        in_flight_ = &in_flight;
+        stop_ = &stop;
+    }
+
+private:
+    virtual void run() {
+        for (;;) {
+            credits_->wait();
+            if (*stop_) {
+                break;
+            }
+
+            PacketPtr packet = packet_factory.new_packet();
+            if (!packet) {
+                break;
+            }
+
+            ++*in_flight_;
+            queue_->write(packet);
+        }
+    }
+
+    IWriter* queue_;
+    core::Semaphore* credits_;
+    core::Atomic<long>* in_flight_;
+    core::Atomic<int>* stop_;
+};
+
+void BM_PacketFactory_CrossThread(benchmark::State& state) {
+    const size_t num_producers = (size_t)state.range(0);
+
+    ConcurrentQueue queue(ConcurrentQueue::Blocking);
+    core::Semaphore credits(MaxInFlight);
+    core::Atomic<long> in_flight(0);
+    core::Atomic<int> stop(0);
+
+    ProducerThread producers[MaxThreads];
+
+    for (size_t n = 0; n < num_producers; n++) {
+        producers[n].init(queue, credits, in_flight, stop);
+        producers[n].start();
+    }
+
+    while (state.KeepRunningBatch(BatchSize)) {
+        for (size_t n = 0; n < BatchSize; n++) {
+            PacketPtr packet = queue.read();
+            --in_flight;
+            packet = NULL;
+            credits.post();
+        }
+    }
+
+    stop = 1;
+    for (size_t n = 0; n < num_producers; n++) {
+        credits.post();
+    }
+    for (size_t n = 0; n < num_producers; n++) {
+        producers[n].join();
+    }
+
+    while (in_flight > 0) {
+        queue.read();
+        --in_flight;
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_PacketFactory_CrossThread)->RangeMultiplier(2)->Range(1, MaxThreads);
+
+} // namespace
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/router.h"
+
+// Router throughput, in packets per second.
+//
+// Router has two routes, for audio and repair packets, like on receiver.
+// Argument is how many audio packets are written per one repair packet.
+
+namespace roc {
+namespace packet {
+namespace {
+
+enum { NumPackets = 1024, SourceID = 123 };
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, false);
+
+class NullWriter : public IWriter {
+public:
+    virtual void write(const PacketPtr& packet) {
+        benchmark::DoNotOptimize(packet.get());
+    }
+};
+
+void BM_Router_Write(benchmark::State& state) {
+    const size_t audio_per_repair = (size_t)state.range(0);
+
+    NullWriter audio_writer;
+    NullWriter repair_writer;
+
+    Router router(allocator);
+    if (!router.add_route(audio_writer, Packet::FlagAudio)
+        || !router.add_route(repair_writer, Packet::FlagRepair)) {
+        state.SkipWithError("can't add route");
+        return;
+    }
+
+    PacketPtr packets[NumPackets];
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n] = packet_factory.new_packet();
+        packets[n]->add_flags(Packet::FlagRTP);
+        packets[n]->add_flags(n % (audio_per_repair + 1) == audio_per_repair
+                                  ? Packet::FlagRepair
+                                  : Packet::FlagAudio);
+        packets[n]->rtp()->source = SourceID;
+    }
+
+    size_t pos = 0;
+
+    while (state.KeepRunning()) {
+        router.write(packets[pos]);
+
+        if (++pos == NumPackets) {
+            pos = 0;
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_Router_Write)->Arg(1)->Arg(2)->Arg(4)->Arg(10);
+
+} // namespace
+} // namespace packet
+} // namespace roc
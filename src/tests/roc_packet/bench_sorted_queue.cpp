@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/seqnum_queue.h"
+#include "roc_packet/sorted_queue.h"
+
+// Packet queue throughput, in written packets per second.
+//
+// Queue is kept at fixed depth (the argument): after every write, packets are
+// read until queue size doesn't exceed the depth, like in jitter buffer.
+//
+// Patterns:
+//  - InOrder: seqnums are increasing
+//  - Reordered: seqnums are shuffled within windows of ReorderWindow packets
+//  - Duplicate: every DuplicatePeriod-th packet is resent DuplicateDistance
+//    packets later
+
+namespace roc {
+namespace packet {
+namespace {
+
+enum {
+    NumPackets = 4096,
+    ReorderWindow = 8,
+    DuplicatePeriod = 4,
+    DuplicateDistance = 4
+};
+
+enum Pattern { Pattern_InOrder, Pattern_Reordered, Pattern_Duplicate };
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, false);
+
+// Seqnums to write, relative to beginning of the lap.
+seqnum_t pattern_seqnums[NumPackets];
+
+// Number of distinct seqnums per lap.
+size_t pattern_len;
+
+void init_pattern(Pattern pattern) {
+    switch (pattern) {
+    case Pattern_InOrder:
+        for (size_t n = 0; n < NumPackets; n++) {
+            pattern_seqnums[n] = (seqnum_t)n;
+        }
+        pattern_len = NumPackets;
+        break;
+
+    case Pattern_Reordered:
+        for (size_t n = 0; n < NumPackets; n++) {
+            pattern_seqnums[n] = (seqnum_t)n;
+        }
+        for (size_t n = 0; n < NumPackets; n += ReorderWindow) {
+            for (size_t i = ReorderWindow - 1; i > 0; i--) {
+                const size_t j = (size_t)core::fast_random(0, (uint32_t)i);
+                const seqnum_t tmp = pattern_seqnums[n + i];
+                pattern_seqnums[n + i] = pattern_seqnums[n + j];
+                pattern_seqnums[n + j] = tmp;
+            }
+        }
+        pattern_len = NumPackets;
+        break;
+
+    case Pattern_Duplicate: {
+        size_t sn = 0;
+        for (size_t n = 0; n < NumPackets; n++) {
+            if (n % (DuplicatePeriod + 1) == DuplicatePeriod && sn >= DuplicateDistance) {
+                pattern_seqnums[n] = (seqnum_t)(sn - DuplicateDistance);
+            } else {
+                pattern_seqnums[n] = (seqnum_t)sn++;
+            }
+        }
+        pattern_len = sn;
+    } break;
+    }
+}
+
+template <class Queue> void run_queue(benchmark::State& state, Queue& queue) {
+    const size_t depth = (size_t)state.range(0);
+
+    PacketPtr packets[NumPackets];
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n] = packet_factory.new_packet();
+        packets[n]->add_flags(Packet::FlagRTP);
+    }
+
+    size_t pos = 0;
+    seqnum_t base = 0;
+
+    while (state.KeepRunning()) {
+        Packet& packet = *packets[pos];
+        packet.rtp()->seqnum = seqnum_t(base + pattern_seqnums[pos]);
+
+        queue.write(packets[pos]);
+
+        while (queue.size() > depth) {
+            benchmark::DoNotOptimize(queue.read());
+        }
+
+        if (++pos == NumPackets) {
+            pos = 0;
+            base = seqnum_t(base + pattern_len);
+        }
+    }
+
+    while (queue.size() != 0) {
+        queue.read();
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+void run_sorted_queue(benchmark::State& state, Pattern pattern) {
+    init_pattern(pattern);
+
+    SortedQueue queue(0);
+    run_queue(state, queue);
+}
+
+void run_seqnum_queue(benchmark::State& state, Pattern pattern) {
+    init_pattern(pattern);
+
+    SeqnumQueue queue(allocator, 0);
+    if (!queue.valid()) {
+        state.SkipWithError("can't create queue");
+        return;
+    }
+
+    run_queue(state, queue);
+}
+
+void BM_SortedQueue_InOrder(benchmark::State& state) {
+    run_sorted_queue(state, Pattern_InOrder);
+}
+
+BENCHMARK(BM_SortedQueue_InOrder)->RangeMultiplier(8)->Range(8, 512);
+
+void BM_SortedQueue_Reordered(benchmark::State& state) {
+    run_sorted_queue(state, Pattern_Reordered);
+}
+
+BENCHMARK(BM_SortedQueue_Reordered)->RangeMultiplier(8)->Range(8, 512);
+
+void BM_SortedQueue_Duplicate(benchmark::State& state) {
+    run_sorted_queue(state, Pattern_Duplicate);
+}
+
+BENCHMARK(BM_SortedQueue_Duplicate)->RangeMultiplier(8)->Range(8, 512);
+
+void BM_SeqnumQueue_InOrder(benchmark::State& state) {
+    run_seqnum_queue(state, Pattern_InOrder);
+}
+
+BENCHMARK(BM_SeqnumQueue_InOrder)->RangeMultiplier(8)->Range(8, 512);
+
+void BM_SeqnumQueue_Reordered(benchmark::State& state) {
+    run_seqnum_queue(state, Pattern_Reordered);
+}
+
+BENCHMARK(BM_SeqnumQueue_Reordered)->RangeMultiplier(8)->Range(8, 512);
+
+void BM_SeqnumQueue_Duplicate(benchmark::State& state) {
+    run_seqnum_queue(state, Pattern_Duplicate);
+}
+
+BENCHMARK(BM_SeqnumQueue_Duplicate)->RangeMultiplier(8)->Range(8, 512);
+
+} // namespace
+} // namespace packet
+} // namespace roc
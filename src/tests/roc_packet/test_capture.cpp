@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_address/socket_addr.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/temp_file.h"
+#include "roc_packet/capture_reader.h"
+#include "roc_packet/capture_writer.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { BufSize = 100, NumPackets = 10 };
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, true);
+core::BufferFactory<uint8_t> buffer_factory(allocator, BufSize, true);
+
+address::SocketAddr new_address(address::AddrFamily family, int port) {
+    address::SocketAddr addr;
+    CHECK(addr.set_host_port(family, family == address::Family_IPv4 ? "127.0.0.1" : "::1",
+                             port));
+    return addr;
+}
+
+core::nanoseconds_t nth_timestamp(size_t n) {
+    return core::Second * 1000 + (core::nanoseconds_t)n * 12345;
+}
+
+PacketPtr new_packet(const address::SocketAddr& src_addr,
+                     core::nanoseconds_t timestamp,
+                     size_t size,
+                     uint8_t value) {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+    buffer.reslice(0, size);
+
+    for (size_t n = 0; n < size; n++) {
+        buffer.data()[n] = uint8_t(value + n);
+    }
+
+    packet->add_flags(Packet::FlagUDP);
+    packet->udp()->src_addr = src_addr;
+    packet->udp()->receive_timestamp = timestamp;
+    packet->set_data(buffer);
+
+    return packet;
+}
+
+void write_raw(const char* path, const char* data, size_t size) {
+    FILE* fp = fopen(path, "wb");
+    CHECK(fp);
+    UNSIGNED_LONGS_EQUAL(size, fwrite(data, 1, size, fp));
+    LONGS_EQUAL(0, fclose(fp));
+}
+
+} // namespace
+
+TEST_GROUP(capture) {};
+
+TEST(capture, write_read) {
+    core::TempFile file("test.rcap");
+
+    const address::SocketAddr addrs[] = {
+        new_address(address::Family_IPv4, 1234),
+        new_address(address::Family_IPv6, 4321),
+    };
+
+    {
+        CaptureWriter writer;
+        CHECK(writer.open(file.path()));
+
+        for (size_t n = 0; n < NumPackets; n++) {
+            PacketPtr pp =
+                new_packet(addrs[n % 2], nth_timestamp(n), BufSize - n, uint8_t(n));
+            CHECK(writer.write(*pp, unsigned(n % 3)));
+        }
+
+        UNSIGNED_LONGS_EQUAL(NumPackets, writer.num_packets());
+    }
+
+    CaptureReader reader(packet_factory, buffer_factory);
+    CHECK(reader.open(file.path()));
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        unsigned stream_id = 99;
+        PacketPtr pp = reader.read(stream_id);
+        CHECK(pp);
+
+        UNSIGNED_LONGS_EQUAL(n % 3, stream_id);
+
+        CHECK(pp->udp());
+        CHECK(pp->udp()->src_addr == addrs[n % 2]);
+        LONGS_EQUAL(nth_timestamp(n), pp->udp()->receive_timestamp);
+
+        UNSIGNED_LONGS_EQUAL(BufSize - n, pp->data().size());
+        for (size_t i = 0; i < pp->data().size(); i++) {
+            UNSIGNED_LONGS_EQUAL(uint8_t(n + i), pp->data().data()[i]);
+        }
+    }
+
+    unsigned stream_id = 0;
+    CHECK(!reader.read(stream_id));
+    CHECK(!reader.failed());
+}
+
+TEST(capture, empty) {
+    core::TempFile file("test.rcap");
+
+    {
+        CaptureWriter writer;
+        CHECK(writer.open(file.path()));
+    }
+
+    CaptureReader reader(packet_factory, buffer_factory);
+    CHECK(reader.open(file.path()));
+
+    unsigned stream_id = 0;
+    CHECK(!reader.read(stream_id));
+    CHECK(!reader.failed());
+}
+
+TEST(capture, not_opened) {
+    CaptureWriter writer;
+
+    PacketPtr pp = new_packet(new_address(address::Family_IPv4, 1234), 0, 10, 0);
+    CHECK(!writer.write(*pp, 0));
+
+    UNSIGNED_LONGS_EQUAL(0, writer.num_packets());
+}
+
+TEST(capture, bad_header) {
+    core::TempFile file("test.rcap");
+
+    write_raw(file.path(), "XCAP\0\1\0\0", 8);
+
+    CaptureReader reader(packet_factory, buffer_factory);
+    CHECK(!reader.open(file.path()));
+    CHECK(reader.failed());
+}
+
+TEST(capture, bad_version) {
+    core::TempFile file("test.rcap");
+
+    write_raw(file.path(), "RCAP\0\2\0\0", 8);
+
+    CaptureReader reader(packet_factory, buffer_factory);
+    CHECK(!reader.open(file.path()));
+    CHECK(reader.failed());
+}
+
+TEST(capture, truncated) {
+    core::TempFile file("test.rcap");
+
+    {
+        CaptureWriter writer;
+        CHECK(writer.open(file.path()));
+
+        PacketPtr pp = new_packet(new_address(address::Family_IPv4, 1234), 0, 10, 0);
+        CHECK(writer.write(*pp, 0));
+    }
+
+    FILE* fp = fopen(file.path(), "rb");
+    CHECK(fp);
+    char data[128];
+    const size_t size = fread(data, 1, sizeof(data), fp);
+    LONGS_EQUAL(0, fclose(fp));
+
+    write_raw(file.path(), data, size - 1);
+
+    CaptureReader reader(packet_factory, buffer_factory);
+    CHECK(reader.open(file.path()));
+
+    unsigned stream_id = 0;
+    CHECK(!reader.read(stream_id));
+    CHECK(reader.failed());
+}
+
+TEST(capture, datagram_too_large) {
+    core::TempFile file("test.rcap");
+
+    core::BufferFactory<uint8_t> large_buffer_factory(allocator, BufSize * 2, true);
+
+    {
+        CaptureWriter writer;
+        CHECK(writer.open(file.path()));
+
+        PacketPtr pp = packet_factory.new_packet();
+        CHECK(pp);
+
+        core::Slice<uint8_t> buffer = large_buffer_factory.new_buffer();
+        CHECK(buffer);
+        memset(buffer.data(), 0, buffer.size());
+
+        pp->add_flags(Packet::FlagUDP);
+        pp->udp()->src_addr = new_address(address::Family_IPv4, 1234);
+        pp->set_data(buffer);
+
+        CHECK(writer.write(*pp, 0));
+    }
+
+    CaptureReader reader(packet_factory, buffer_factory);
+    CHECK(reader.open(file.path()));
+
+    unsigned stream_id = 0;
+    CHECK(!reader.read(stream_id));
+    CHECK(reader.failed());
+}
+
+} // namespace packet
+} // namespace roc
@@ -9,6 +9,8 @@
 #include <CppUTest/TestHarness.h>
 
 #include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_core/thread.h"
 #include "roc_packet/concurrent_queue.h"
 #include "roc_packet/packet_factory.h"
 
@@ -26,6 +28,26 @@ PacketPtr new_packet() {
     return packet;
 }
 
+class Writer : public core::Thread {
+public:
+    Writer(IWriter& writer, PacketPtr* packets, size_t n_packets)
+        : writer_(writer)
+        , packets_(packets)
+        , n_packets_(n_packets) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < n_packets_; n++) {
+            writer_.write(packets_[n]);
+        }
+    }
+
+    IWriter& writer_;
+    PacketPtr* packets_;
+    size_t n_packets_;
+};
+
 } // namespace
 
 TEST_GROUP(concurrent_queue) {};
@@ -43,5 +65,67 @@ TEST(concurrent_queue, write_read) {
     CHECK(queue.read() == p2);
 }
 
+TEST(concurrent_queue, non_blocking) {
+    ConcurrentQueue queue(ConcurrentQueue::NonBlocking);
+
+    CHECK(!queue.read());
+
+    PacketPtr p1 = new_packet();
+    PacketPtr p2 = new_packet();
+
+    queue.write(p1);
+    queue.write(p2);
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+
+    CHECK(!queue.read());
+}
+
+TEST(concurrent_queue, concurrent_writers) {
+    enum { NumWriters = 4, NumPackets = 1000 };
+
+    ConcurrentQueue queue(ConcurrentQueue::Blocking);
+
+    PacketPtr packets[NumWriters][NumPackets];
+
+    for (size_t w = 0; w < NumWriters; w++) {
+        for (size_t n = 0; n < NumPackets; n++) {
+            packets[w][n] = new_packet();
+        }
+    }
+
+    core::ScopedPtr<Writer> writers[NumWriters];
+
+    for (size_t w = 0; w < NumWriters; w++) {
+        writers[w].reset(new (allocator) Writer(queue, packets[w], NumPackets),
+                         allocator);
+        CHECK(writers[w]->start());
+    }
+
+    // packets of every writer should be read in the same order as written
+    size_t positions[NumWriters] = {};
+
+    for (size_t i = 0; i < NumWriters * NumPackets; i++) {
+        PacketPtr pp = queue.read();
+        CHECK(pp);
+
+        bool found = false;
+        for (size_t w = 0; w < NumWriters; w++) {
+            if (positions[w] < NumPackets && packets[w][positions[w]] == pp) {
+                positions[w]++;
+                found = true;
+                break;
+            }
+        }
+        CHECK(found);
+    }
+
+    for (size_t w = 0; w < NumWriters; w++) {
+        writers[w]->join();
+        LONGS_EQUAL(NumPackets, positions[w]);
+    }
+}
+
 } // namespace packet
 } // namespace roc
@@ -119,6 +119,36 @@ TEST(delayed_reader, trim) {
     CHECK(!dr.read());
 }
 
+TEST(delayed_reader, trim_backlog) {
+    enum { DelayPackets = 5 };
+
+    Queue queue;
+    DelayedReader dr(queue, NumSamples * DelayPackets * NsPerSample, SampleSpecs);
+
+    PacketPtr packets[NumPackets];
+
+    // session starts from a burst of packets, much larger than delay
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        packets[n] = new_packet(n);
+        packets[n]->rtp()->duration = NumSamples;
+        queue.write(packets[n]);
+    }
+
+    // stale packets are discarded, and playback starts right at target latency
+    PacketPtr first = dr.read();
+    CHECK(first);
+    UNSIGNED_LONGS_EQUAL(NumSamples * DelayPackets,
+                         packets[NumPackets - 1]->end() - first->begin());
+
+    CHECK(first == packets[NumPackets - DelayPackets]);
+
+    for (seqnum_t n = NumPackets - DelayPackets + 1; n < NumPackets; n++) {
+        CHECK(dr.read() == packets[n]);
+    }
+
+    CHECK(!dr.read());
+}
+
 TEST(delayed_reader, late_duplicates) {
     Queue queue;
     DelayedReader dr(queue, NumSamples * (NumPackets - 1) * NsPerSample, SampleSpecs);
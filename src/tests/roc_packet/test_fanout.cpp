@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_address/socket_addr.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/fanout.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { BufSize = 100, NumDestinations = 3 };
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, true);
+core::BufferFactory<uint8_t> buffer_factory(allocator, BufSize, true);
+
+address::SocketAddr new_address(int port) {
+    address::SocketAddr addr;
+    CHECK(addr.set_host_port(address::Family_IPv4, "127.0.0.1", port));
+    return addr;
+}
+
+PacketPtr new_packet(unsigned flags) {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+
+    packet->add_flags(Packet::FlagUDP | Packet::FlagComposed | flags);
+    packet->udp()->src_addr = new_address(1000);
+    packet->udp()->dst_addr = new_address(2000);
+
+    packet->set_data(buffer);
+
+    return packet;
+}
+
+class BatchCounter : public IWriter {
+public:
+    BatchCounter(IWriter& writer)
+        : writer_(writer)
+        , n_writes_(0)
+        , n_batches_(0) {
+    }
+
+    virtual void write(const PacketPtr& packet) {
+        n_writes_++;
+        writer_.write(packet);
+    }
+
+    virtual void write_batch(core::List<Packet>& packets) {
+        n_batches_++;
+        while (PacketPtr packet = packets.front()) {
+            packets.remove(*packet);
+            writer_.write(packet);
+        }
+    }
+
+    size_t n_writes() const {
+        return n_writes_;
+    }
+
+    size_t n_batches() const {
+        return n_batches_;
+    }
+
+private:
+    IWriter& writer_;
+
+    size_t n_writes_;
+    size_t n_batches_;
+};
+
+} // namespace
+
+TEST_GROUP(fanout) {};
+
+TEST(fanout, no_destinations) {
+    Queue queue;
+    Fanout fanout(queue, packet_factory, allocator);
+
+    UNSIGNED_LONGS_EQUAL(0, fanout.num_destinations());
+
+    PacketPtr packet = new_packet(0);
+    fanout.write(packet);
+
+    UNSIGNED_LONGS_EQUAL(1, queue.size());
+    CHECK(queue.read() == packet);
+}
+
+TEST(fanout, many_destinations) {
+    Queue queue;
+    Fanout fanout(queue, packet_factory, allocator);
+
+    for (int n = 0; n < NumDestinations; n++) {
+        CHECK(fanout.add_destination(new_address(3000 + n)));
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumDestinations, fanout.num_destinations());
+
+    PacketPtr packet = new_packet(Packet::FlagRepair);
+    fanout.write(packet);
+
+    UNSIGNED_LONGS_EQUAL(NumDestinations + 1, queue.size());
+
+    for (int n = 0; n < NumDestinations; n++) {
+        PacketPtr copy = queue.read();
+        CHECK(copy);
+        CHECK(copy != packet);
+
+        CHECK(copy->udp());
+        CHECK(copy->udp()->src_addr == new_address(1000));
+        CHECK(copy->udp()->dst_addr == new_address(3000 + n));
+
+        CHECK(copy->flags() & Packet::FlagComposed);
+        CHECK(copy->flags() & Packet::FlagRepair);
+
+        CHECK(copy->data().data() == packet->data().data());
+        UNSIGNED_LONGS_EQUAL(packet->data().size(), copy->data().size());
+    }
+
+    CHECK(queue.read() == packet);
+    CHECK(packet->udp()->dst_addr == new_address(2000));
+}
+
+TEST(fanout, batching) {
+    Queue queue;
+    BatchCounter counter(queue);
+    Fanout fanout(counter, packet_factory, allocator);
+
+    for (int n = 0; n < NumDestinations; n++) {
+        CHECK(fanout.add_destination(new_address(3000 + n)));
+    }
+
+    PacketPtr packet = new_packet(0);
+    fanout.write(packet);
+
+    // original packet and all copies are written at once
+    UNSIGNED_LONGS_EQUAL(0, counter.n_writes());
+    UNSIGNED_LONGS_EQUAL(1, counter.n_batches());
+    UNSIGNED_LONGS_EQUAL(NumDestinations + 1, queue.size());
+}
+
+} // namespace packet
+} // namespace roc
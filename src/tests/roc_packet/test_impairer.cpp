@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_address/socket_addr.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/impairer.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { BufSize = 100, NumPackets = 100, NumStatPackets = 200000, Seed = 12345 };
+
+const core::nanoseconds_t Delay = 50 * core::Millisecond;
+const core::nanoseconds_t Jitter = 20 * core::Millisecond;
+const core::nanoseconds_t Step = core::Millisecond;
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, true);
+core::BufferFactory<uint8_t> buffer_factory(allocator, BufSize, true);
+
+PacketPtr new_packet() {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+
+    packet->add_flags(Packet::FlagUDP);
+    CHECK(packet->udp()->src_addr.set_host_port(address::Family_IPv4, "127.0.0.1",
+                                                1234));
+    packet->udp()->receive_timestamp = 123;
+
+    packet->set_data(buffer);
+
+    return packet;
+}
+
+} // namespace
+
+TEST_GROUP(impairer) {};
+
+TEST(impairer, config_defaults) {
+    ImpairerConfig config;
+
+    CHECK(config.valid());
+    CHECK(!config.enabled());
+
+    config.delay = Delay;
+    CHECK(config.enabled());
+}
+
+TEST(impairer, config_invalid) {
+    {
+        ImpairerConfig config;
+        config.good_loss = 1.5f;
+        CHECK(!config.valid());
+
+        Queue queue;
+        Impairer impairer(queue, packet_factory, allocator, config);
+        CHECK(!impairer.valid());
+    }
+    {
+        ImpairerConfig config;
+        config.jitter = -1;
+        CHECK(!config.valid());
+    }
+    {
+        ImpairerConfig config;
+        CHECK(!config.set_loss(-0.1f, 1));
+        CHECK(!config.set_loss(1, 1));
+        CHECK(!config.set_loss(0.1f, 0.5f));
+        CHECK(!config.set_loss(0.9f, 2));
+        CHECK(config.set_loss(0.5f, 1));
+        CHECK(config.valid());
+    }
+}
+
+TEST(impairer, no_impairment) {
+    ImpairerConfig config;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        PacketPtr packet = new_packet();
+        impairer.write(packet);
+
+        UNSIGNED_LONGS_EQUAL(1, queue.size());
+        CHECK(queue.read() == packet);
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, impairer.num_delayed());
+}
+
+TEST(impairer, loss_all) {
+    ImpairerConfig config;
+    config.good_loss = 1;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        impairer.write(new_packet());
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, queue.size());
+}
+
+TEST(impairer, loss_bursts) {
+    const float LossRate = 0.1f;
+    const float BurstLength = 3;
+
+    ImpairerConfig config;
+    CHECK(config.set_loss(LossRate, BurstLength));
+    config.seed = Seed;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    size_t n_lost = 0, n_bursts = 0;
+    bool prev_lost = false;
+
+    for (size_t n = 0; n < NumStatPackets; n++) {
+        impairer.write(new_packet());
+
+        const bool lost = !queue.read();
+        if (lost) {
+            n_lost++;
+            if (!prev_lost) {
+                n_bursts++;
+            }
+        }
+        prev_lost = lost;
+    }
+
+    DOUBLES_EQUAL(LossRate, (double)n_lost / NumStatPackets, 0.01);
+    CHECK(n_bursts > 0);
+    DOUBLES_EQUAL(BurstLength, (double)n_lost / n_bursts, 0.2);
+}
+
+TEST(impairer, same_seed) {
+    ImpairerConfig config;
+    CHECK(config.set_loss(0.3f, 2));
+    config.duplicate = 0.2f;
+    config.seed = Seed;
+
+    Queue queue1;
+    Impairer impairer1(queue1, packet_factory, allocator, config);
+    CHECK(impairer1.valid());
+
+    Queue queue2;
+    Impairer impairer2(queue2, packet_factory, allocator, config);
+    CHECK(impairer2.valid());
+
+    for (size_t n = 0; n < NumPackets * 10; n++) {
+        impairer1.write(new_packet());
+        impairer2.write(new_packet());
+
+        UNSIGNED_LONGS_EQUAL(queue1.size(), queue2.size());
+
+        while (queue1.size() != 0) {
+            queue1.read();
+            queue2.read();
+        }
+    }
+}
+
+TEST(impairer, delay) {
+    ImpairerConfig config;
+    config.delay = Delay;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    PacketPtr packets[NumPackets];
+
+    core::nanoseconds_t now = core::Second;
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        impairer.advance(now + (core::nanoseconds_t)n * Step);
+
+        packets[n] = new_packet();
+        impairer.write(packets[n]);
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumPackets - Delay / Step, impairer.num_delayed());
+    UNSIGNED_LONGS_EQUAL(Delay / Step, queue.size());
+
+    impairer.advance(now + Delay + (core::nanoseconds_t)NumPackets * Step);
+
+    UNSIGNED_LONGS_EQUAL(0, impairer.num_delayed());
+    UNSIGNED_LONGS_EQUAL(NumPackets, queue.size());
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        CHECK(queue.read() == packets[n]);
+    }
+}
+
+TEST(impairer, delay_deadline) {
+    ImpairerConfig config;
+    config.delay = Delay;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    impairer.advance(core::Second);
+    impairer.write(new_packet());
+
+    impairer.advance(core::Second + Delay - 1);
+    UNSIGNED_LONGS_EQUAL(0, queue.size());
+    UNSIGNED_LONGS_EQUAL(1, impairer.num_delayed());
+
+    impairer.advance(core::Second + Delay);
+    UNSIGNED_LONGS_EQUAL(1, queue.size());
+    UNSIGNED_LONGS_EQUAL(0, impairer.num_delayed());
+}
+
+TEST(impairer, jitter) {
+    ImpairerConfig config;
+    config.delay = Delay;
+    config.jitter = Jitter;
+    config.seed = Seed;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    impairer.advance(0);
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        impairer.write(new_packet());
+    }
+
+    impairer.advance(Delay - Jitter - 1);
+    UNSIGNED_LONGS_EQUAL(0, queue.size());
+
+    impairer.advance(Delay);
+    CHECK(queue.size() > 0);
+    CHECK(queue.size() < NumPackets);
+
+    impairer.advance(Delay + Jitter);
+    UNSIGNED_LONGS_EQUAL(NumPackets, queue.size());
+    UNSIGNED_LONGS_EQUAL(0, impairer.num_delayed());
+}
+
+TEST(impairer, reorder) {
+    ImpairerConfig config;
+    config.delay = Delay;
+    config.reorder = 1;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    impairer.advance(0);
+
+    PacketPtr packet = new_packet();
+    impairer.write(packet);
+
+    UNSIGNED_LONGS_EQUAL(0, impairer.num_delayed());
+    UNSIGNED_LONGS_EQUAL(1, queue.size());
+    CHECK(queue.read() == packet);
+}
+
+TEST(impairer, duplicate) {
+    ImpairerConfig config;
+    config.duplicate = 1;
+
+    Queue queue;
+    Impairer impairer(queue, packet_factory, allocator, config);
+    CHECK(impairer.valid());
+
+    PacketPtr packet = new_packet();
+    impairer.write(packet);
+
+    UNSIGNED_LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.read() == packet);
+
+    PacketPtr copy = queue.read();
+    CHECK(copy);
+    CHECK(copy != packet);
+
+    UNSIGNED_LONGS_EQUAL(Packet::FlagUDP, copy->flags());
+    CHECK(copy->udp()->src_addr == packet->udp()->src_addr);
+    LONGS_EQUAL(packet->udp()->receive_timestamp, copy->udp()->receive_timestamp);
+    POINTERS_EQUAL(packet->data().data(), copy->data().data());
+    UNSIGNED_LONGS_EQUAL(packet->data().size(), copy->data().size());
+}
+
+} // namespace packet
+} // namespace roc
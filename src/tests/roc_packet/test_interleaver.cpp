@@ -112,5 +112,56 @@ TEST(interleaver, flush) {
     }
 }
 
+TEST(interleaver, max_delay) {
+    enum { BlockSize = 40, NumBlocks = 5 };
+
+    const size_t delays[] = { 1, 2, 5, 10 };
+
+    for (size_t nd = 0; nd < sizeof(delays) / sizeof(delays[0]); nd++) {
+        Queue queue;
+        Interleaver intrlvr(queue, allocator, BlockSize, delays[nd]);
+
+        CHECK(intrlvr.valid());
+        LONGS_EQUAL(BlockSize, intrlvr.block_size());
+        LONGS_EQUAL(delays[nd], intrlvr.max_delay());
+
+        core::Array<bool> packets_ctr(allocator);
+        CHECK(packets_ctr.resize(BlockSize * NumBlocks));
+
+        for (size_t i = 0; i < packets_ctr.size(); i++) {
+            packets_ctr[i] = false;
+        }
+
+        size_t n_read = 0;
+
+        for (size_t i = 0; i < BlockSize * NumBlocks; i++) {
+            intrlvr.write(new_packet(seqnum_t(i)));
+
+            while (PacketPtr p = queue.read()) {
+                const size_t sn = p->rtp()->seqnum;
+
+                CHECK(sn <= i);
+                CHECK(!packets_ctr[sn]);
+
+                // Packet was delayed by no more than max_delay packets.
+                CHECK(i - sn <= delays[nd]);
+
+                packets_ctr[sn] = true;
+                n_read++;
+            }
+        }
+
+        LONGS_EQUAL(BlockSize * NumBlocks, n_read);
+    }
+}
+
+TEST(interleaver, max_delay_large) {
+    Queue queue;
+    Interleaver intrlvr(queue, allocator, 10, 100);
+
+    CHECK(intrlvr.valid());
+    LONGS_EQUAL(9, intrlvr.max_delay());
+}
+
 } // namespace packet
 } // namespace roc
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_packet/demultiplexer.h"
+#include "roc_packet/multiplexer.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { MaxBufSize = 1000, MaxDatagramSize = 500 };
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, true);
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBufSize, true);
+
+PacketPtr new_packet(size_t size, uint8_t value) {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+
+    buffer.reslice(0, size);
+    memset(buffer.data(), value, size);
+
+    packet->add_flags(Packet::FlagUDP);
+    packet->udp()->dst_addr = address::SocketAddr();
+
+    packet->set_data(buffer);
+
+    return packet;
+}
+
+void check_packet(const PacketPtr& packet, size_t size, uint8_t value) {
+    CHECK(packet);
+    CHECK(packet->udp());
+
+    UNSIGNED_LONGS_EQUAL(size, packet->data().size());
+
+    for (size_t n = 0; n < size; n++) {
+        UNSIGNED_LONGS_EQUAL(value, packet->data().data()[n]);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(multiplexer) {};
+
+TEST(multiplexer, one_datagram) {
+    // one-byte and two-byte sub-headers
+    const size_t sizes[] = { 1, 127, 128, 200 };
+    const size_t n_packets = ROC_ARRAY_SIZE(sizes);
+
+    Queue datagrams;
+    Multiplexer mux(datagrams, packet_factory, buffer_factory, MaxDatagramSize);
+
+    for (size_t n = 0; n < n_packets; n++) {
+        mux.write(new_packet(sizes[n], uint8_t(n + 1)));
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, datagrams.size());
+
+    mux.flush();
+
+    UNSIGNED_LONGS_EQUAL(1, datagrams.size());
+
+    PacketPtr datagram = datagrams.read();
+    CHECK(datagram);
+    CHECK(datagram->udp());
+
+    UNSIGNED_LONGS_EQUAL(1 + (1 + 1) + (1 + 127) + (2 + 128) + (2 + 200),
+                         datagram->data().size());
+    UNSIGNED_LONGS_EQUAL(Multiplexer::Marker, datagram->data().data()[0]);
+
+    Queue packets;
+    Demultiplexer demux(packet_factory);
+
+    CHECK(demux.demultiplex(*datagram, packets));
+
+    UNSIGNED_LONGS_EQUAL(n_packets, packets.size());
+
+    for (size_t n = 0; n < n_packets; n++) {
+        check_packet(packets.read(), sizes[n], uint8_t(n + 1));
+    }
+}
+
+TEST(multiplexer, many_datagrams) {
+    enum { NumPackets = 10, PacketSize = 150, PacketsPerDatagram = 3 };
+
+    Queue datagrams;
+    Multiplexer mux(datagrams, packet_factory, buffer_factory, MaxDatagramSize);
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        mux.write(new_packet(PacketSize, uint8_t(n)));
+    }
+
+    mux.flush();
+    mux.flush();
+
+    UNSIGNED_LONGS_EQUAL((NumPackets + PacketsPerDatagram - 1) / PacketsPerDatagram,
+                         datagrams.size());
+
+    Queue packets;
+    Demultiplexer demux(packet_factory);
+
+    while (PacketPtr datagram = datagrams.read()) {
+        CHECK(datagram->data().size() <= MaxDatagramSize);
+        CHECK(demux.demultiplex(*datagram, packets));
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, packets.size());
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        check_packet(packets.read(), PacketSize, uint8_t(n));
+    }
+}
+
+TEST(multiplexer, too_large) {
+    Queue datagrams;
+    Multiplexer mux(datagrams, packet_factory, buffer_factory, MaxDatagramSize);
+
+    mux.write(new_packet(10, 1));
+    mux.write(new_packet(MaxDatagramSize, 2));
+    mux.write(new_packet(10, 3));
+    mux.flush();
+
+    UNSIGNED_LONGS_EQUAL(2, datagrams.size());
+
+    Queue packets;
+    Demultiplexer demux(packet_factory);
+
+    while (PacketPtr datagram = datagrams.read()) {
+        CHECK(demux.demultiplex(*datagram, packets));
+    }
+
+    UNSIGNED_LONGS_EQUAL(2, packets.size());
+
+    check_packet(packets.read(), 10, 1);
+    check_packet(packets.read(), 10, 3);
+}
+
+TEST(multiplexer, malformed) {
+    Queue datagrams;
+    Multiplexer mux(datagrams, packet_factory, buffer_factory, MaxDatagramSize);
+
+    mux.write(new_packet(10, 1));
+    mux.write(new_packet(200, 2));
+    mux.flush();
+
+    PacketPtr datagram = datagrams.read();
+    CHECK(datagram);
+
+    Demultiplexer demux(packet_factory);
+
+    { // truncated second sub-packet
+        Queue packets;
+
+        PacketPtr truncated = packet_factory.new_packet();
+        CHECK(truncated);
+        truncated->add_flags(Packet::FlagUDP);
+        truncated->set_data(
+            datagram->data().subslice(0, datagram->data().size() - 1));
+
+        CHECK(!demux.demultiplex(*truncated, packets));
+
+        UNSIGNED_LONGS_EQUAL(1, packets.size());
+        check_packet(packets.read(), 10, 1);
+    }
+
+    { // bad marker
+        Queue packets;
+
+        datagram->data().data()[0] = 0x80;
+
+        CHECK(!demux.demultiplex(*datagram, packets));
+        UNSIGNED_LONGS_EQUAL(0, packets.size());
+    }
+}
+
+} // namespace packet
+} // namespace roc
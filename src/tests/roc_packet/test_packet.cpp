@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, 100, true);
+PacketFactory packet_factory(allocator, true);
+
+} // namespace
+
+TEST_GROUP(packet) {};
+
+TEST(packet, no_flags) {
+    PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    UNSIGNED_LONGS_EQUAL(0, pp->flags());
+
+    CHECK(!pp->udp());
+    CHECK(!pp->rtp());
+    CHECK(!pp->fec());
+    CHECK(!pp->rtcp());
+}
+
+TEST(packet, rtp_fec) {
+    PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    pp->add_flags(Packet::FlagRTP);
+    pp->add_flags(Packet::FlagFEC);
+
+    CHECK(pp->rtp());
+    CHECK(pp->fec());
+    CHECK(!pp->rtcp());
+
+    // headers are zero-initialized
+    UNSIGNED_LONGS_EQUAL(0, pp->rtp()->seqnum);
+    LONGS_EQUAL(FEC_None, pp->fec()->fec_scheme);
+    UNSIGNED_LONGS_EQUAL(0, pp->fec()->encoding_symbol_id);
+    CHECK(!pp->fec()->payload);
+
+    pp->rtp()->seqnum = 123;
+    pp->fec()->encoding_symbol_id = 456;
+    pp->fec()->payload = buffer_factory.new_buffer();
+
+    UNSIGNED_LONGS_EQUAL(123, pp->rtp()->seqnum);
+    UNSIGNED_LONGS_EQUAL(456, pp->fec()->encoding_symbol_id);
+    CHECK(pp->fec()->payload);
+}
+
+TEST(packet, rtcp) {
+    PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    pp->add_flags(Packet::FlagUDP | Packet::FlagRTCP);
+
+    CHECK(pp->udp());
+    CHECK(pp->rtcp());
+    CHECK(!pp->rtp());
+    CHECK(!pp->fec());
+
+    CHECK(!pp->rtcp()->data);
+
+    pp->rtcp()->data = buffer_factory.new_buffer();
+    CHECK(pp->rtcp()->data);
+}
+
+TEST(packet, container_of) {
+    PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    pp->add_flags(Packet::FlagUDP);
+
+    POINTERS_EQUAL(pp.get(), Packet::container_of(pp->udp()));
+}
+
+} // namespace packet
+} // namespace roc
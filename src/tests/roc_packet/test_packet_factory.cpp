@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/align_ops.h"
+#include "roc_core/buffer.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_factory.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { BufferSize = 100 };
+
+} // namespace
+
+TEST_GROUP(packet_factory) {};
+
+TEST(packet_factory, no_inline_buffers) {
+    core::HeapAllocator allocator;
+    PacketFactory factory(allocator, true);
+
+    UNSIGNED_LONGS_EQUAL(0, factory.inline_buffer_size());
+
+    PacketPtr pp = factory.new_packet();
+    CHECK(pp);
+    CHECK(!pp->inline_buffer());
+}
+
+TEST(packet_factory, inline_buffer) {
+    core::HeapAllocator allocator;
+
+    {
+        PacketFactory factory(allocator, BufferSize, true);
+
+        UNSIGNED_LONGS_EQUAL(BufferSize, factory.inline_buffer_size());
+
+        {
+            PacketPtr pp = factory.new_packet_with_buffer();
+            CHECK(pp);
+
+            core::Slice<uint8_t> buf = pp->inline_buffer();
+            CHECK(buf);
+            UNSIGNED_LONGS_EQUAL(BufferSize, buf.size());
+            UNSIGNED_LONGS_EQUAL(BufferSize, buf.capacity());
+
+            memset(buf.data(), 0xff, BufferSize);
+
+            pp->set_data(buf.subslice(0, BufferSize / 2));
+            POINTERS_EQUAL(buf.data(), pp->data().data());
+
+            // packet and buffer share single memory chunk
+            LONGS_EQUAL(core::AlignOps::align_max(sizeof(Packet))
+                            + sizeof(core::Buffer<uint8_t>),
+                        (char*)buf.data() - (char*)pp.get());
+
+            core::Buffer<uint8_t>* bp = core::Buffer<uint8_t>::container_of(buf.data());
+            POINTERS_EQUAL(pp.get(), &factory.inline_buffer_owner(*bp));
+        }
+
+        // memory is returned to pool, but not to allocator
+        CHECK(allocator.num_allocations() > 0);
+
+        // plain packets use separate pool
+        PacketPtr pp = factory.new_packet();
+        CHECK(pp);
+        CHECK(!pp->inline_buffer());
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(packet_factory, inline_buffer_many) {
+    enum { NumPackets = 50 };
+
+    core::HeapAllocator allocator;
+
+    {
+        PacketFactory factory(allocator, BufferSize, true);
+
+        PacketPtr packets[NumPackets];
+
+        for (size_t i = 0; i < NumPackets; i++) {
+            packets[i] = factory.new_packet_with_buffer();
+            CHECK(packets[i]);
+
+            memset(packets[i]->inline_buffer().data(), (int)i, BufferSize);
+        }
+
+        for (size_t i = 0; i < NumPackets; i++) {
+            for (size_t n = 0; n < BufferSize; n++) {
+                UNSIGNED_LONGS_EQUAL(i, packets[i]->inline_buffer().data()[n]);
+            }
+        }
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(packet_factory, inline_buffer_outlives_packet) {
+    core::HeapAllocator allocator;
+
+    {
+        PacketFactory factory(allocator, BufferSize, true);
+
+        core::Slice<uint8_t> slice;
+
+        {
+            PacketPtr pp = factory.new_packet_with_buffer();
+            CHECK(pp);
+
+            memset(pp->inline_buffer().data(), 0x11, BufferSize);
+
+            slice = pp->inline_buffer().subslice(10, 20);
+        }
+
+        // slice still holds buffer, and thus the whole chunk
+        CHECK(slice);
+        UNSIGNED_LONGS_EQUAL(10, slice.size());
+        for (size_t n = 0; n < slice.size(); n++) {
+            UNSIGNED_LONGS_EQUAL(0x11, slice.data()[n]);
+        }
+
+        const char* chunk = (const char*)slice.data() - 10;
+
+        slice = core::Slice<uint8_t>();
+
+        // chunk is returned to pool and can be reused
+        PacketPtr pp = factory.new_packet_with_buffer();
+        CHECK(pp);
+        POINTERS_EQUAL(chunk, pp->inline_buffer().data());
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(packet_factory, inline_buffer_other_data) {
+    core::HeapAllocator allocator;
+
+    {
+        PacketFactory factory(allocator, BufferSize, true);
+        core::BufferFactory<uint8_t> buffer_factory(allocator, BufferSize, true);
+
+        PacketPtr pp = factory.new_packet_with_buffer();
+        CHECK(pp);
+
+        // packet keeps its memory even if its data refers to another buffer
+        core::Slice<uint8_t> other = buffer_factory.new_buffer();
+        CHECK(other);
+        pp->set_data(other);
+
+        CHECK(pp->inline_buffer());
+        CHECK(pp->data().data() != pp->inline_buffer().data());
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+} // namespace packet
+} // namespace roc
@@ -156,5 +156,59 @@ TEST(router, different_routes_different_sources) {
     UNSIGNED_LONGS_EQUAL(1, queue_f.size());
 }
 
+TEST(router, add_route_after_drop) {
+    Router router(allocator);
+
+    Queue queue_a;
+    CHECK(router.add_route(queue_a, Packet::FlagAudio));
+
+    router.write(new_packet(11, Packet::FlagFEC));
+    UNSIGNED_LONGS_EQUAL(0, queue_a.size());
+
+    Queue queue_f;
+    CHECK(router.add_route(queue_f, Packet::FlagFEC));
+
+    router.write(new_packet(11, Packet::FlagFEC));
+    UNSIGNED_LONGS_EQUAL(0, queue_a.size());
+    UNSIGNED_LONGS_EQUAL(1, queue_f.size());
+}
+
+TEST(router, many_sources) {
+    enum { NumRoutes = 40, NumPackets = 10 };
+
+    Router router(allocator);
+
+    Queue queues[NumRoutes];
+    for (size_t n = 0; n < NumRoutes; n++) {
+        CHECK(router.add_route(queues[n], Packet::FlagAudio));
+    }
+
+    // bind every route to its own source
+    for (size_t n = 0; n < NumRoutes; n++) {
+        router.write(new_packet(source_t(1000 + n * 7), Packet::FlagAudio));
+    }
+
+    // packets of every source go to the route bound to it
+    for (size_t np = 0; np < NumPackets; np++) {
+        for (size_t n = 0; n < NumRoutes; n++) {
+            const size_t nr = (n * 13 + np) % NumRoutes;
+            PacketPtr p = new_packet(source_t(1000 + nr * 7), Packet::FlagAudio);
+            router.write(p);
+            CHECK(p->getref() == 2);
+        }
+    }
+
+    // packets of unknown source are dropped
+    router.write(new_packet(1, Packet::FlagAudio));
+
+    for (size_t n = 0; n < NumRoutes; n++) {
+        UNSIGNED_LONGS_EQUAL(NumPackets + 1, queues[n].size());
+
+        while (PacketPtr p = queues[n].read()) {
+            UNSIGNED_LONGS_EQUAL(1000 + n * 7, p->source());
+        }
+    }
+}
+
 } // namespace packet
 } // namespace roc
@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/seqnum_queue.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+core::HeapAllocator allocator;
+PacketFactory packet_factory(allocator, true);
+
+PacketPtr new_packet(seqnum_t sn) {
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    packet->add_flags(Packet::FlagRTP);
+    packet->rtp()->seqnum = sn;
+
+    return packet;
+}
+
+} // namespace
+
+TEST_GROUP(seqnum_queue) {};
+
+TEST(seqnum_queue, empty) {
+    SeqnumQueue queue(allocator, 0);
+
+    CHECK(!queue.tail());
+    CHECK(!queue.head());
+
+    CHECK(!queue.read());
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(seqnum_queue, two_packets) {
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(2);
+
+    queue.write(p2);
+    queue.write(p1);
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.tail() == p2.get());
+    CHECK(queue.head() == p1.get());
+
+    CHECK(queue.read() == p1);
+
+    LONGS_EQUAL(1, queue.size());
+
+    CHECK(queue.tail() == p2.get());
+    CHECK(queue.head() == p2.get());
+
+    CHECK(queue.read() == p2);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.tail());
+    CHECK(!queue.head());
+
+    CHECK(!queue.read());
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(seqnum_queue, many_packets) {
+    enum { NumPackets = 10 };
+
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr packets[NumPackets];
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        packets[n] = new_packet(n);
+    }
+
+    for (ssize_t n = 0; n < NumPackets; n++) {
+        queue.write(packets[(n + NumPackets / 2) % NumPackets]);
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    CHECK(queue.head() == packets[0].get());
+    CHECK(queue.tail() == packets[NumPackets - 1].get());
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        CHECK(queue.read() == packets[n]);
+    }
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(seqnum_queue, out_of_order) {
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(2);
+
+    queue.write(p2);
+
+    LONGS_EQUAL(1, queue.size());
+
+    CHECK(queue.tail() == p2.get());
+    CHECK(queue.head() == p2.get());
+
+    CHECK(queue.read() == p2);
+
+    LONGS_EQUAL(0, queue.size());
+
+    queue.write(p1);
+
+    LONGS_EQUAL(1, queue.size());
+
+    CHECK(queue.tail() == p1.get());
+    CHECK(queue.head() == p1.get());
+
+    CHECK(queue.read() == p1);
+
+    CHECK(!queue.tail());
+    CHECK(!queue.head());
+
+    CHECK(!queue.read());
+}
+
+TEST(seqnum_queue, out_of_order_many_packets) {
+    enum { NumPackets = 20 };
+
+    SeqnumQueue queue(allocator, 0);
+
+    for (packet::seqnum_t n = 0; n < 7; ++n) {
+        queue.write(new_packet(n));
+    }
+
+    for (packet::seqnum_t n = 11; n < NumPackets; ++n) {
+        queue.write(new_packet(n));
+    }
+
+    for (packet::seqnum_t n = 0; n < 7; ++n) {
+        const packet::PacketPtr p = queue.read();
+
+        CHECK(p);
+        CHECK(p->rtp()->seqnum == n);
+    }
+
+    queue.write(new_packet(9));
+    queue.write(new_packet(10));
+
+    for (packet::seqnum_t n = 9; n < NumPackets; ++n) {
+        const packet::PacketPtr p = queue.read();
+
+        CHECK(p->rtp()->seqnum == n);
+
+        if (n == 10) {
+            queue.write(new_packet(8));
+            queue.write(new_packet(7));
+
+            CHECK(queue.read()->rtp()->seqnum == 7);
+            CHECK(queue.read()->rtp()->seqnum == 8);
+        }
+    }
+}
+
+TEST(seqnum_queue, one_duplicate) {
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(1);
+
+    queue.write(p1);
+    queue.write(p2);
+
+    LONGS_EQUAL(1, queue.size());
+
+    CHECK(queue.tail() == p1.get());
+    CHECK(queue.head() == p1.get());
+
+    CHECK(queue.read() == p1);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.tail());
+    CHECK(!queue.head());
+
+    CHECK(!queue.read());
+}
+
+TEST(seqnum_queue, many_duplicates) {
+    const size_t NumPackets = 10;
+
+    SeqnumQueue queue(allocator, 0);
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        queue.write(new_packet(n));
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        queue.write(new_packet(n));
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        CHECK(queue.read()->rtp()->seqnum == n);
+    }
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(seqnum_queue, max_size) {
+    SeqnumQueue queue(allocator, 2);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(2);
+    PacketPtr p3 = new_packet(3);
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.head() == p1.get());
+    CHECK(queue.tail() == p2.get());
+
+    CHECK(queue.read() == p1);
+
+    LONGS_EQUAL(1, queue.size());
+
+    queue.write(p3);
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.head() == p2.get());
+    CHECK(queue.tail() == p3.get());
+}
+
+TEST(seqnum_queue, overflow_ordered1) {
+    const seqnum_t sn = seqnum_t(-1);
+
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(seqnum_t(sn - 10));
+    PacketPtr p2 = new_packet(sn);
+    PacketPtr p3 = new_packet(seqnum_t(sn + 10));
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    LONGS_EQUAL(3, queue.size());
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+    CHECK(queue.read() == p3);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.read());
+}
+
+TEST(seqnum_queue, overflow_ordered2) {
+    const seqnum_t sn = seqnum_t(-1) >> 1;
+
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(seqnum_t(sn - 10));
+    PacketPtr p2 = new_packet(sn);
+    PacketPtr p3 = new_packet(seqnum_t(sn + 10));
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    LONGS_EQUAL(3, queue.size());
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+    CHECK(queue.read() == p3);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.read());
+}
+
+TEST(seqnum_queue, overflow_sorting) {
+    const seqnum_t sn = seqnum_t(-1);
+
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(seqnum_t(sn - 10));
+    PacketPtr p2 = new_packet(sn);
+    PacketPtr p3 = new_packet(seqnum_t(sn + 10));
+
+    queue.write(p2);
+    queue.write(p1);
+    queue.write(p3);
+
+    LONGS_EQUAL(3, queue.size());
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+    CHECK(queue.read() == p3);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.read());
+}
+
+TEST(seqnum_queue, overflow_out_of_order) {
+    const seqnum_t sn = seqnum_t(-1);
+
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(seqnum_t(sn - 10));
+    PacketPtr p2 = new_packet(sn);
+    PacketPtr p3 = new_packet(sn / 2);
+
+    queue.write(p1);
+
+    LONGS_EQUAL(1, queue.size());
+    CHECK(queue.read() == p1);
+    LONGS_EQUAL(0, queue.size());
+
+    queue.write(p2);
+
+    LONGS_EQUAL(1, queue.size());
+    CHECK(queue.read() == p2);
+    LONGS_EQUAL(0, queue.size());
+
+    queue.write(p3);
+
+    LONGS_EQUAL(1, queue.size());
+    CHECK(queue.read() == p3);
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.read());
+}
+
+TEST(seqnum_queue, latest) {
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(3);
+    PacketPtr p3 = new_packet(2);
+    PacketPtr p4 = new_packet(4);
+
+    LONGS_EQUAL(0, queue.size());
+    CHECK(!queue.latest());
+
+    queue.write(p1);
+    LONGS_EQUAL(1, queue.size());
+    CHECK(queue.latest() == p1.get());
+
+    queue.write(p2);
+    LONGS_EQUAL(2, queue.size());
+    CHECK(queue.latest() == p2.get());
+
+    queue.write(p3);
+    LONGS_EQUAL(3, queue.size());
+    CHECK(queue.latest() == p2.get());
+
+    CHECK(queue.read());
+    LONGS_EQUAL(2, queue.size());
+    CHECK(queue.latest() == p2.get());
+
+    CHECK(queue.read());
+    LONGS_EQUAL(1, queue.size());
+    CHECK(queue.latest() == p2.get());
+
+    CHECK(queue.read());
+    LONGS_EQUAL(0, queue.size());
+    CHECK(queue.latest() == p2.get());
+
+    queue.write(p4);
+    LONGS_EQUAL(1, queue.size());
+    CHECK(queue.latest() == p4.get());
+}
+TEST(seqnum_queue, lost_packets) {
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(5);
+    PacketPtr p3 = new_packet(100);
+
+    queue.write(p1);
+    queue.write(p3);
+    queue.write(p2);
+
+    LONGS_EQUAL(3, queue.size());
+
+    CHECK(queue.head() == p1.get());
+    CHECK(queue.tail() == p3.get());
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.head() == p2.get());
+
+    CHECK(queue.read() == p2);
+    CHECK(queue.head() == p3.get());
+
+    CHECK(queue.read() == p3);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.read());
+}
+
+TEST(seqnum_queue, window_growth) {
+    enum { NumPackets = 2000, Reorder = 7 };
+
+    SeqnumQueue queue(allocator, 0);
+    CHECK(queue.valid());
+
+    PacketPtr packets[NumPackets];
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n] = new_packet(seqnum_t(seqnum_t(-1) - NumPackets / 2 + n));
+    }
+
+    // write packets in reverse order within every block
+    for (size_t n = 0; n < NumPackets; n += Reorder) {
+        for (size_t k = Reorder; k > 0; k--) {
+            if (n + k - 1 < NumPackets) {
+                queue.write(packets[n + k - 1]);
+            }
+        }
+        queue.write(packets[n]);
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    CHECK(queue.head() == packets[0].get());
+    CHECK(queue.tail() == packets[NumPackets - 1].get());
+    CHECK(queue.latest() == packets[NumPackets - 1].get());
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        CHECK(queue.read() == packets[n]);
+    }
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(seqnum_queue, window_growth_backwards) {
+    enum { NumPackets = 1000 };
+
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr packets[NumPackets];
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n] = new_packet(seqnum_t(n));
+    }
+
+    for (size_t n = NumPackets; n > 0; n--) {
+        queue.write(packets[n - 1]);
+        CHECK(queue.head() == packets[n - 1].get());
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        CHECK(queue.read() == packets[n]);
+    }
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(seqnum_queue, window_overflow) {
+    const seqnum_t sn = 100;
+
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr p1 = new_packet(sn);
+    PacketPtr p2 = new_packet(seqnum_t(sn + 0x8000));
+    PacketPtr p3 = new_packet(seqnum_t(sn - 0x8000));
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    LONGS_EQUAL(1, queue.size());
+
+    CHECK(queue.head() == p1.get());
+    CHECK(queue.tail() == p1.get());
+
+    CHECK(queue.read() == p1);
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(seqnum_queue, no_rtp) {
+    SeqnumQueue queue(allocator, 0);
+
+    PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    queue.write(packet);
+
+    LONGS_EQUAL(0, queue.size());
+    CHECK(!queue.latest());
+    CHECK(!queue.read());
+}
+
+} // namespace packet
+} // namespace roc
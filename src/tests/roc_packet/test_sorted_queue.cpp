@@ -56,15 +56,15 @@ TEST(sorted_queue, two_packets) {
 
     LONGS_EQUAL(2, queue.size());
 
-    CHECK(queue.tail() == p2);
-    CHECK(queue.head() == p1);
+    CHECK(queue.tail() == p2.get());
+    CHECK(queue.head() == p1.get());
 
     CHECK(queue.read() == p1);
 
     LONGS_EQUAL(1, queue.size());
 
-    CHECK(queue.tail() == p2);
-    CHECK(queue.head() == p2);
+    CHECK(queue.tail() == p2.get());
+    CHECK(queue.head() == p2.get());
 
     CHECK(queue.read() == p2);
 
@@ -95,8 +95,8 @@ TEST(sorted_queue, many_packets) {
 
     LONGS_EQUAL(NumPackets, queue.size());
 
-    CHECK(queue.head() == packets[0]);
-    CHECK(queue.tail() == packets[NumPackets - 1]);
+    CHECK(queue.head() == packets[0].get());
+    CHECK(queue.tail() == packets[NumPackets - 1].get());
 
     for (size_t n = 0; n < NumPackets; n++) {
         CHECK(queue.read() == packets[n]);
@@ -115,8 +115,8 @@ TEST(sorted_queue, out_of_order) {
 
     LONGS_EQUAL(1, queue.size());
 
-    CHECK(queue.tail() == p2);
-    CHECK(queue.head() == p2);
+    CHECK(queue.tail() == p2.get());
+    CHECK(queue.head() == p2.get());
 
     CHECK(queue.read() == p2);
 
@@ -126,8 +126,8 @@ TEST(sorted_queue, out_of_order) {
 
     LONGS_EQUAL(1, queue.size());
 
-    CHECK(queue.tail() == p1);
-    CHECK(queue.head() == p1);
+    CHECK(queue.tail() == p1.get());
+    CHECK(queue.head() == p1.get());
 
     CHECK(queue.read() == p1);
 
@@ -186,8 +186,8 @@ TEST(sorted_queue, one_duplicate) {
 
     LONGS_EQUAL(1, queue.size());
 
-    CHECK(queue.tail() == p1);
-    CHECK(queue.head() == p1);
+    CHECK(queue.tail() == p1.get());
+    CHECK(queue.head() == p1.get());
 
     CHECK(queue.read() == p1);
 
@@ -236,8 +236,8 @@ TEST(sorted_queue, max_size) {
 
     LONGS_EQUAL(2, queue.size());
 
-    CHECK(queue.head() == p1);
-    CHECK(queue.tail() == p2);
+    CHECK(queue.head() == p1.get());
+    CHECK(queue.tail() == p2.get());
 
     CHECK(queue.read() == p1);
 
@@ -247,8 +247,8 @@ TEST(sorted_queue, max_size) {
 
     LONGS_EQUAL(2, queue.size());
 
-    CHECK(queue.head() == p2);
-    CHECK(queue.tail() == p3);
+    CHECK(queue.head() == p2.get());
+    CHECK(queue.tail() == p3.get());
 }
 
 TEST(sorted_queue, overflow_ordered1) {
@@ -366,31 +366,68 @@ TEST(sorted_queue, latest) {
 
     queue.write(p1);
     LONGS_EQUAL(1, queue.size());
-    CHECK(queue.latest() == p1);
+    CHECK(queue.latest() == p1.get());
 
     queue.write(p2);
     LONGS_EQUAL(2, queue.size());
-    CHECK(queue.latest() == p2);
+    CHECK(queue.latest() == p2.get());
 
     queue.write(p3);
     LONGS_EQUAL(3, queue.size());
-    CHECK(queue.latest() == p2);
+    CHECK(queue.latest() == p2.get());
 
     CHECK(queue.read());
     LONGS_EQUAL(2, queue.size());
-    CHECK(queue.latest() == p2);
+    CHECK(queue.latest() == p2.get());
 
     CHECK(queue.read());
     LONGS_EQUAL(1, queue.size());
-    CHECK(queue.latest() == p2);
+    CHECK(queue.latest() == p2.get());
 
     CHECK(queue.read());
     LONGS_EQUAL(0, queue.size());
-    CHECK(queue.latest() == p2);
+    CHECK(queue.latest() == p2.get());
 
     queue.write(p4);
     LONGS_EQUAL(1, queue.size());
-    CHECK(queue.latest() == p4);
+    CHECK(queue.latest() == p4.get());
+}
+
+TEST(sorted_queue, ownership) {
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(2);
+
+    {
+        SortedQueue queue(0);
+
+        queue.write(p1);
+        queue.write(p2);
+
+        // queue holds one reference to every packet, latest packet is
+        // referenced once more
+        LONGS_EQUAL(2, p1->getref());
+        LONGS_EQUAL(3, p2->getref());
+
+        // peeking doesn't acquire references
+        CHECK(queue.head() == p1.get());
+        CHECK(queue.tail() == p2.get());
+        CHECK(queue.latest() == p2.get());
+
+        LONGS_EQUAL(2, p1->getref());
+        LONGS_EQUAL(3, p2->getref());
+
+        // reading passes reference to caller
+        PacketPtr pp = queue.read();
+        CHECK(pp == p1);
+        LONGS_EQUAL(2, p1->getref());
+
+        pp = NULL;
+        LONGS_EQUAL(1, p1->getref());
+    }
+
+    // destructor releases remaining packets
+    LONGS_EQUAL(1, p1->getref());
+    LONGS_EQUAL(1, p2->getref());
 }
 
 } // namespace packet
@@ -50,5 +50,141 @@ TEST(context, reference_counting) {
     CHECK(!context.is_used());
 }
 
+TEST(context, reserve) {
+    ContextConfig context_config;
+    context_config.reserved_packets = 10;
+    context_config.reserved_byte_buffers = 10;
+    context_config.reserved_sample_buffers = 10;
+
+    Context context(context_config, allocator);
+
+    CHECK(context.valid());
+}
+
+TEST(context, reserve_above_limit) {
+    ContextConfig context_config;
+    context_config.reserved_packets = 10;
+    context_config.max_packets = 5;
+
+    Context context(context_config, allocator);
+
+    CHECK(!context.valid());
+}
+
+TEST(context, limit) {
+    enum { MaxObjects = 5 };
+
+    ContextConfig context_config;
+    context_config.max_packets = MaxObjects;
+    context_config.max_byte_buffers = MaxObjects;
+    context_config.max_sample_buffers = MaxObjects;
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    UNSIGNED_LONGS_EQUAL(0, context.memory_stats().packet_alloc_failures);
+    UNSIGNED_LONGS_EQUAL(0, context.memory_stats().byte_buffer_alloc_failures);
+    UNSIGNED_LONGS_EQUAL(0, context.memory_stats().sample_buffer_alloc_failures);
+
+    packet::PacketPtr packets[MaxObjects];
+    core::Slice<uint8_t> byte_buffers[MaxObjects];
+    core::Slice<audio::sample_t> sample_buffers[MaxObjects];
+
+    for (size_t n = 0; n < MaxObjects; n++) {
+        CHECK(packets[n] = context.packet_factory().new_packet());
+        CHECK(byte_buffers[n] = context.byte_buffer_factory().new_buffer());
+        CHECK(sample_buffers[n] = context.sample_buffer_factory().new_buffer());
+    }
+
+    CHECK(!context.packet_factory().new_packet());
+    CHECK(!context.byte_buffer_factory().new_buffer());
+    CHECK(!context.sample_buffer_factory().new_buffer());
+
+    UNSIGNED_LONGS_EQUAL(1, context.memory_stats().packet_alloc_failures);
+    UNSIGNED_LONGS_EQUAL(1, context.memory_stats().byte_buffer_alloc_failures);
+    UNSIGNED_LONGS_EQUAL(1, context.memory_stats().sample_buffer_alloc_failures);
+}
+
+TEST(context, memory_stats) {
+    enum { NumObjects = 5 };
+
+    ContextConfig context_config;
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    packet::PacketPtr packets[NumObjects];
+    core::Slice<uint8_t> byte_buffers[NumObjects];
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        CHECK(packets[n] = context.packet_factory().new_packet());
+        CHECK(byte_buffers[n] = context.byte_buffer_factory().new_buffer());
+    }
+
+    const ContextMemoryStats stats = context.memory_stats();
+
+    CHECK(stats.packet_pool.num_slabs > 0);
+    CHECK(stats.packet_pool.used_slots >= NumObjects);
+    CHECK(stats.packet_pool.peak_used_slots >= NumObjects);
+    UNSIGNED_LONGS_EQUAL(stats.packet_pool.total_slots,
+                         stats.packet_pool.used_slots + stats.packet_pool.free_slots);
+
+    CHECK(stats.byte_buffer_pool.num_slabs > 0);
+    CHECK(stats.byte_buffer_pool.used_slots >= NumObjects);
+    UNSIGNED_LONGS_EQUAL(stats.byte_buffer_pool.total_slots,
+                         stats.byte_buffer_pool.used_slots
+                             + stats.byte_buffer_pool.free_slots);
+
+    UNSIGNED_LONGS_EQUAL(stats.packet_pool.num_slabs + stats.inline_packet_pool.num_slabs
+                             + stats.byte_buffer_pool.num_slabs
+                             + stats.sample_buffer_pool.num_slabs,
+                         stats.pool_memory.num_allocations);
+
+    UNSIGNED_LONGS_EQUAL(stats.packet_pool.num_bytes + stats.inline_packet_pool.num_bytes
+                             + stats.byte_buffer_pool.num_bytes
+                             + stats.sample_buffer_pool.num_bytes,
+                         stats.pool_memory.num_bytes);
+}
+
+TEST(context, network_threads) {
+    ContextConfig context_config;
+    context_config.network_threads = 3;
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    UNSIGNED_LONGS_EQUAL(3, context.num_network_loops());
+    POINTERS_EQUAL(&context.network_loop(), &context.network_loop(0));
+
+    for (size_t n = 0; n < context.num_network_loops(); n++) {
+        CHECK(context.network_loop(n).valid());
+        LONGS_EQUAL(-1, context.network_loop_cpu(n));
+    }
+}
+
+TEST(context, network_threads_cpus) {
+    ContextConfig context_config;
+    context_config.network_threads = 3;
+    context_config.network_thread.cpu_mask = 0x5;
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    UNSIGNED_LONGS_EQUAL(3, context.num_network_loops());
+
+    // cpus are assigned round-robin
+    LONGS_EQUAL(0, context.network_loop_cpu(0));
+    LONGS_EQUAL(2, context.network_loop_cpu(1));
+    LONGS_EQUAL(0, context.network_loop_cpu(2));
+}
+
+TEST(context, network_threads_too_many) {
+    ContextConfig context_config;
+    context_config.network_threads = MaxNetworkThreads + 1;
+
+    Context context(context_config, allocator);
+    CHECK(!context.valid());
+}
+
 } // namespace peer
 } // namespace roc
@@ -9,6 +9,7 @@
 #include <CppUTest/TestHarness.h>
 
 #include "roc_core/heap_allocator.h"
+#include "roc_core/optional.h"
 #include "roc_fec/codec_map.h"
 #include "roc_peer/context.h"
 #include "roc_peer/receiver.h"
@@ -44,6 +45,49 @@ TEST(receiver, source) {
                          receiver_config.common.output_sample_spec.sample_rate());
 }
 
+TEST(receiver, read_pcm) {
+    enum { NumSamples = 441 * 2 * 3 };
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    { // float frames are read as is
+        Receiver receiver(context, receiver_config);
+        CHECK(receiver.valid());
+
+        UNSIGNED_LONGS_EQUAL(sizeof(float), receiver.frame_sample_size());
+
+        float samples[NumSamples];
+        for (size_t n = 0; n < NumSamples; n++) {
+            samples[n] = 0.5f;
+        }
+
+        CHECK(receiver.read_pcm(samples, sizeof(samples)));
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            DOUBLES_EQUAL(0.0, (double)samples[n], 0.0001);
+        }
+    }
+
+    { // integer frames are converted
+        Receiver receiver(context, receiver_config, audio::PcmEncoding_SInt16);
+        CHECK(receiver.valid());
+
+        UNSIGNED_LONGS_EQUAL(sizeof(int16_t), receiver.frame_sample_size());
+
+        int16_t samples[NumSamples];
+        for (size_t n = 0; n < NumSamples; n++) {
+            samples[n] = 1234;
+        }
+
+        CHECK(receiver.read_pcm(samples, sizeof(samples)));
+
+        for (size_t n = 0; n < NumSamples; n++) {
+            LONGS_EQUAL(0, samples[n]);
+        }
+    }
+}
+
 TEST(receiver, bind) {
     Context context(context_config, allocator);
     CHECK(context.valid());
@@ -97,6 +141,188 @@ TEST(receiver, bind_slots) {
     UNSIGNED_LONGS_EQUAL(context.network_loop().num_ports(), 0);
 }
 
+TEST(receiver, bind_consolidated_zero_port) {
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    {
+        Receiver receiver(context, receiver_config);
+        CHECK(receiver.valid());
+
+        address::EndpointUri consolidated_endp(allocator);
+        parse_uri(consolidated_endp, "rtsp://127.0.0.1:0");
+
+        CHECK(
+            !receiver.bind(DefaultSlot, address::Iface_Consolidated, consolidated_endp));
+
+        UNSIGNED_LONGS_EQUAL(context.network_loop().num_ports(), 0);
+
+        // slot is left without bound interfaces
+        address::EndpointUri source_endp(allocator);
+        parse_uri(source_endp, "rtp://127.0.0.1:0");
+
+        CHECK(receiver.bind(DefaultSlot, address::Iface_AudioSource, source_endp));
+
+        UNSIGNED_LONGS_EQUAL(context.network_loop().num_ports(), 1);
+    }
+
+    UNSIGNED_LONGS_EQUAL(context.network_loop().num_ports(), 0);
+}
+
+TEST(receiver, bind_many) {
+    // more than one batch
+    enum { NumSlots = 40 };
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    {
+        Receiver receiver(context, receiver_config);
+        CHECK(receiver.valid());
+
+        core::Optional<address::EndpointUri> endpoints[NumSlots];
+        Receiver::Binding bindings[NumSlots];
+
+        for (size_t n = 0; n < NumSlots; n++) {
+            endpoints[n].reset(new (endpoints[n]) address::EndpointUri(allocator));
+            parse_uri(*endpoints[n], "rtp://127.0.0.1:0");
+
+            bindings[n].slot_index = n;
+            bindings[n].iface = address::Iface_AudioSource;
+            bindings[n].uri = endpoints[n].get();
+        }
+
+        CHECK(receiver.bind_many(bindings, NumSlots));
+
+        UNSIGNED_LONGS_EQUAL(NumSlots, context.network_loop().num_ports());
+
+        for (size_t n = 0; n < NumSlots; n++) {
+            CHECK(endpoints[n]->port() != 0);
+
+            for (size_t m = 0; m < n; m++) {
+                CHECK(endpoints[n]->port() != endpoints[m]->port());
+            }
+        }
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, context.network_loop().num_ports());
+}
+
+TEST(receiver, bind_many_rollback) {
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    {
+        Receiver receiver(context, receiver_config);
+        CHECK(receiver.valid());
+
+        address::EndpointUri busy_endp(allocator);
+        parse_uri(busy_endp, "rtp://127.0.0.1:0");
+
+        CHECK(receiver.bind(0, address::Iface_AudioSource, busy_endp));
+        UNSIGNED_LONGS_EQUAL(1, context.network_loop().num_ports());
+
+        address::EndpointUri free_endp(allocator);
+        parse_uri(free_endp, "rtp://127.0.0.1:0");
+
+        address::EndpointUri same_endp(allocator);
+        parse_uri(same_endp, "rtp://127.0.0.1:0");
+        same_endp.set_port(busy_endp.port());
+
+        Receiver::Binding bindings[2];
+
+        bindings[0].slot_index = 1;
+        bindings[0].iface = address::Iface_AudioSource;
+        bindings[0].uri = &free_endp;
+
+        bindings[1].slot_index = 2;
+        bindings[1].iface = address::Iface_AudioSource;
+        bindings[1].uri = &same_endp;
+
+        // second port is busy, so first one is unbound back
+        CHECK(!receiver.bind_many(bindings, 2));
+        UNSIGNED_LONGS_EQUAL(1, context.network_loop().num_ports());
+        CHECK(free_endp.port() == 0);
+
+        // interfaces can be bound again
+        same_endp.set_port(0);
+        CHECK(receiver.bind_many(bindings, 2));
+        UNSIGNED_LONGS_EQUAL(3, context.network_loop().num_ports());
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, context.network_loop().num_ports());
+}
+
+TEST(receiver, bind_many_incompatible) {
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    {
+        Receiver receiver(context, receiver_config);
+        CHECK(receiver.valid());
+
+        address::EndpointUri endp1(allocator);
+        parse_uri(endp1, "rtp://127.0.0.1:0");
+
+        address::EndpointUri endp2(allocator);
+        parse_uri(endp2, "rtp+rs8m://127.0.0.1:0");
+
+        Receiver::Binding bindings[2];
+
+        bindings[0].slot_index = 0;
+        bindings[0].iface = address::Iface_AudioSource;
+        bindings[0].uri = &endp1;
+
+        bindings[1].slot_index = 1;
+        bindings[1].iface = address::Iface_AudioSource;
+        bindings[1].uri = &endp2;
+
+        // same interface of different slots uses different protocols
+        CHECK(!receiver.bind_many(bindings, 2));
+        UNSIGNED_LONGS_EQUAL(0, context.network_loop().num_ports());
+
+        if (fec::CodecMap::instance().is_supported(packet::FEC_ReedSolomon_M8)) {
+            // compatibility state of failed call is not kept
+            CHECK(receiver.bind(0, address::Iface_AudioSource, endp2));
+        }
+    }
+}
+
+#if defined(SO_REUSEPORT)
+
+TEST(receiver, bind_network_threads) {
+    enum { NumThreads = 3 };
+
+    context_config.network_threads = NumThreads;
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    UNSIGNED_LONGS_EQUAL(NumThreads, context.num_network_loops());
+
+    {
+        Receiver receiver(context, receiver_config);
+        CHECK(receiver.valid());
+
+        address::EndpointUri source_endp(allocator);
+        parse_uri(source_endp, "rtp://127.0.0.1:0");
+
+        CHECK(receiver.bind(DefaultSlot, address::Iface_AudioSource, source_endp));
+        CHECK(source_endp.port() != 0);
+
+        // port is bound on every network loop
+        for (size_t n = 0; n < NumThreads; n++) {
+            UNSIGNED_LONGS_EQUAL(1, context.network_loop(n).num_ports());
+        }
+    }
+
+    for (size_t n = 0; n < NumThreads; n++) {
+        UNSIGNED_LONGS_EQUAL(0, context.network_loop(n).num_ports());
+    }
+}
+
+#endif // defined(SO_REUSEPORT)
+
 TEST(receiver, endpoints_no_fec) {
     Context context(context_config, allocator);
     CHECK(context.valid());
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_peer/context.h"
+#include "roc_peer/receiver_pool.h"
+
+namespace roc {
+namespace peer {
+
+namespace {
+
+enum { DefaultSlot = 0, PoolSize = 3 };
+
+core::HeapAllocator allocator;
+
+void parse_uri(address::EndpointUri& uri, const char* str) {
+    CHECK(address::parse_endpoint_uri(str, address::EndpointUri::Subset_Full, uri));
+}
+
+} // namespace
+
+TEST_GROUP(receiver_pool) {
+    ContextConfig context_config;
+    pipeline::ReceiverConfig receiver_config;
+};
+
+TEST(receiver_pool, acquire_refill) {
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    {
+        ReceiverPool pool(context, receiver_config, audio::PcmEncoding_Float32,
+                          PoolSize);
+        CHECK(pool.valid());
+
+        UNSIGNED_LONGS_EQUAL(PoolSize, pool.num_idle());
+        CHECK(context.is_used());
+
+        Receiver* receivers[PoolSize + 1] = {};
+
+        for (size_t n = 0; n < PoolSize; n++) {
+            receivers[n] = pool.acquire();
+            CHECK(receivers[n]);
+            CHECK(receivers[n]->valid());
+
+            UNSIGNED_LONGS_EQUAL(PoolSize - n - 1, pool.num_idle());
+        }
+
+        // empty pool opens receiver on demand
+        receivers[PoolSize] = pool.acquire();
+        CHECK(receivers[PoolSize]);
+        CHECK(receivers[PoolSize]->valid());
+        UNSIGNED_LONGS_EQUAL(0, pool.num_idle());
+
+        CHECK(pool.refill());
+        UNSIGNED_LONGS_EQUAL(PoolSize, pool.num_idle());
+
+        for (size_t n = 0; n < PoolSize + 1; n++) {
+            allocator.destroy_object(*receivers[n]);
+        }
+    }
+
+    CHECK(!context.is_used());
+}
+
+TEST(receiver_pool, bind) {
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    {
+        ReceiverPool pool(context, receiver_config, audio::PcmEncoding_Float32,
+                          PoolSize);
+        CHECK(pool.valid());
+
+        Receiver* receiver = pool.acquire();
+        CHECK(receiver);
+
+        address::EndpointUri source_endp(allocator);
+        parse_uri(source_endp, "rtp://127.0.0.1:0");
+
+        CHECK(receiver->bind(DefaultSlot, address::Iface_AudioSource, source_endp));
+        CHECK(source_endp.port() != 0);
+
+        UNSIGNED_LONGS_EQUAL(context.network_loop().num_ports(), 1);
+
+        allocator.destroy_object(*receiver);
+    }
+
+    UNSIGNED_LONGS_EQUAL(context.network_loop().num_ports(), 0);
+}
+
+} // namespace peer
+} // namespace roc
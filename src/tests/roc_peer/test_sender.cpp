@@ -44,6 +44,31 @@ TEST(sender, sink) {
                          sender_config.input_sample_spec.sample_rate());
 }
 
+TEST(sender, write_pcm) {
+    enum { NumSamples = 441 * 2 * 3 };
+
+    Context context(context_config, allocator);
+    CHECK(context.valid());
+
+    const audio::PcmEncoding encodings[] = {
+        audio::PcmEncoding_Float32,
+        audio::PcmEncoding_SInt16,
+        audio::PcmEncoding_SInt24,
+        audio::PcmEncoding_SInt32,
+    };
+    const size_t sample_sizes[] = { 4, 2, 3, 4 };
+
+    for (size_t n = 0; n < sizeof(encodings) / sizeof(encodings[0]); n++) {
+        Sender sender(context, sender_config, encodings[n]);
+        CHECK(sender.valid());
+
+        UNSIGNED_LONGS_EQUAL(sample_sizes[n], sender.frame_sample_size());
+
+        uint8_t samples[NumSamples * 4] = {};
+        sender.write_pcm(samples, NumSamples * sender.frame_sample_size());
+    }
+}
+
 TEST(sender, connect) {
     Context context(context_config, allocator);
     CHECK(context.valid());
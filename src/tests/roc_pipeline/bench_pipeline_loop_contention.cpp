@@ -10,6 +10,10 @@
 
 #include "roc_core/fast_random.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_core/ticker.h"
+#include "roc_core/time.h"
 #include "roc_ctl/control_task_executor.h"
 #include "roc_ctl/control_task_queue.h"
 #include "roc_pipeline/pipeline_loop.h"
@@ -18,26 +22,121 @@ namespace roc {
 namespace pipeline {
 namespace {
 
-// This benchmarks starts a few threads using the same pipeline and measures
-// scheduling times under contention.
+// These benchmarks start a few threads using the same pipeline and measure
+// scheduling and frame processing times under contention.
 //
-// It allows to ensure that the scheduling time does not depend on the
-// contention level, i.e. the number of threads running.
+// BM_PipelineContention/Schedule measures schedule() times. It allows to ensure
+// that the scheduling time does not depend on the contention level, i.e. the
+// number of threads running.
 //
 // Note that the scheduling time for one-thread run is higher because the
 // pipeline is able to perform in-place task execution in this case and the
 // scheduling time also includes task execution time.
+//
+// BM_PipelineContention_Frames measures process_subframes_and_tasks() times,
+// while the given number of threads are scheduling tasks concurrently. It
+// allows to ensure that task submission doesn't add jitter to frame processing.
+//
+// Both benchmarks report tail latencies (p99 and max, in microseconds), and
+// fail if p99 exceeds the corresponding bound. Max is reported but is not
+// checked, since it's affected by preemptions of benchmark threads by OS.
+// The bounds assume that there are enough CPU cores to run all threads in
+// parallel; otherwise, the measured latencies are dominated by preemptions.
+//
+// Counters and deadline shared by frame and task threads (pending tasks and
+// frames, processing state, next frame deadline) occupy separate cache lines.
+// Otherwise, every schedule() call would invalidate the line holding fields
+// used by frame processing, adding to BM_PipelineContention_Frames p99 when
+// threads run on different cores. On a single core there is no false sharing,
+// and padding doesn't affect results.
 
 enum {
     SampleRate = 1000000, // 1 sample = 1 us (for convenience)
     Chans = 0x1,
     NumThreads = 16,
     NumIterations = 1000000,
-    BatchSize = 10000
+    BatchSize = 10000,
+    FrameSize = 1000, // duration of the frame (1000 = 1ms)
+    NumFrames = 3000,
+    MaxPendingTasks = 100
 };
 
+// tail latency bound for schedule()
+const double MaxScheduleP99 = 50; // us
+
+// tail latency bound for process_subframes_and_tasks()
+// (frame processing itself is no-op, so it's mostly the in-frame
+// task processing time and the time waiting for the pipeline)
+const double MaxFrameP99 = 100; // us
+
 core::HeapAllocator allocator;
 
+// Histogram of latencies with fixed bucket width.
+class LatencyHistogram {
+public:
+    LatencyHistogram()
+        : count_(0)
+        , max_(0) {
+        memset(buckets_, 0, sizeof(buckets_));
+    }
+
+    void add(core::nanoseconds_t t) {
+        size_t n = size_t(t / BucketWidth);
+        if (n >= NumBuckets) {
+            n = NumBuckets - 1;
+        }
+
+        buckets_[n]++;
+        count_++;
+
+        if (t > max_) {
+            max_ = t;
+        }
+    }
+
+    // Get percentile (0..1), in microseconds.
+    double percentile(double p) const {
+        size_t acc = 0;
+        for (size_t n = 0; n < NumBuckets; n++) {
+            acc += buckets_[n];
+            if (acc != 0 && double(acc) >= p * double(count_)) {
+                return double(core::nanoseconds_t(n + 1) * BucketWidth) / 1000;
+            }
+        }
+        return max();
+    }
+
+    // Get maximum, in microseconds.
+    double max() const {
+        return double(max_) / 1000;
+    }
+
+private:
+    enum {
+        NumBuckets = 2000,
+        BucketWidth = 250 // ns
+    };
+
+    size_t buckets_[NumBuckets];
+    size_t count_;
+    core::nanoseconds_t max_;
+};
+
+void export_latency(benchmark::State& state,
+                    const LatencyHistogram& hist,
+                    double max_p99,
+                    const char* error) {
+    const double p99 = hist.percentile(0.99);
+
+    state.counters["p99"] = benchmark::Counter(p99, benchmark::Counter::kAvgThreads);
+    state.counters["max"] =
+        benchmark::Counter(hist.max(), benchmark::Counter::kAvgThreads);
+
+    if (p99 > max_p99) {
+        state.SkipWithError(error);
+    }
+}
+
 class NoopPipeline : public PipelineLoop,
                      private IPipelineTaskScheduler,
                      public ctl::ControlTaskExecutor<NoopPipeline> {
@@ -65,6 +164,8 @@ public:
         }
     }
 
+    using PipelineLoop::process_subframes_and_tasks;
+
 private:
     struct BackgroundProcessingTask : ctl::ControlTask {
         BackgroundProcessingTask(NoopPipeline& p)
@@ -110,6 +211,42 @@ public:
     }
 };
 
+class TaskThread : public core::Thread, private IPipelineTaskCompleter {
+public:
+    TaskThread(NoopPipeline& pipeline)
+        : pipeline_(pipeline)
+        , pending_(0)
+        , stop_(false) {
+    }
+
+    void stop() {
+        stop_ = true;
+    }
+
+private:
+    virtual void run() {
+        while (!stop_) {
+            // don't let the queue grow infinitely
+            if (pending_ >= MaxPendingTasks) {
+                core::sleep_for(core::ClockMonotonic, core::Microsecond * 10);
+                continue;
+            }
+
+            ++pending_;
+            pipeline_.schedule(*new NoopPipeline::Task, *this);
+        }
+    }
+
+    virtual void pipeline_task_completed(PipelineTask& task) {
+        delete &(NoopPipeline::Task&)task;
+        --pending_;
+    }
+
+    NoopPipeline& pipeline_;
+    core::Atomic<int> pending_;
+    core::Atomic<int> stop_;
+};
+
 struct BM_PipelineContention : benchmark::Fixture {
     ctl::ControlTaskQueue control_queue;
 
@@ -128,15 +265,21 @@ BENCHMARK_DEFINE_F(BM_PipelineContention, Schedule)(benchmark::State& state) {
     NoopPipeline::Task* tasks = new NoopPipeline::Task[NumIterations];
     size_t n_task = 0;
 
+    LatencyHistogram hist;
+
     while (state.KeepRunningBatch(BatchSize)) {
         for (int n = 0; n < BatchSize; n++) {
+            const core::nanoseconds_t start = core::timestamp(core::ClockMonotonic);
             pipeline.schedule(tasks[n_task++], completer);
+            hist.add(core::timestamp(core::ClockMonotonic) - start);
         }
     }
 
     pipeline.stop_and_wait();
 
     delete[] tasks;
+
+    export_latency(state, hist, MaxScheduleP99, "schedule() p99 exceeds bound");
 }
 
 BENCHMARK_REGISTER_F(BM_PipelineContention, Schedule)
@@ -144,6 +287,61 @@ BENCHMARK_REGISTER_F(BM_PipelineContention, Schedule)
     ->Iterations(NumIterations)
     ->Unit(benchmark::kMicrosecond);
 
+void BM_PipelineContention_Frames(benchmark::State& state) {
+    ctl::ControlTaskQueue control_queue;
+
+    TaskConfig config;
+    NoopPipeline pipeline(config, control_queue);
+
+    TaskThread* threads[NumThreads] = {};
+
+    const size_t n_threads = (size_t)state.range(0);
+
+    for (size_t n = 0; n < n_threads; n++) {
+        threads[n] = new TaskThread(pipeline);
+        threads[n]->start();
+    }
+
+    core::Ticker ticker(SampleRate);
+    size_t ts = 0;
+
+    audio::sample_t data[FrameSize] = {};
+    audio::Frame frame(data, FrameSize);
+
+    LatencyHistogram hist;
+
+    while (state.KeepRunning()) {
+        ticker.wait(ts);
+
+        const core::nanoseconds_t start = core::timestamp(core::ClockMonotonic);
+        pipeline.process_subframes_and_tasks(frame);
+        hist.add(core::timestamp(core::ClockMonotonic) - start);
+
+        ts += frame.num_samples();
+    }
+
+    for (size_t n = 0; n < n_threads; n++) {
+        threads[n]->stop();
+        threads[n]->join();
+    }
+
+    pipeline.stop_and_wait();
+
+    for (size_t n = 0; n < n_threads; n++) {
+        delete threads[n];
+    }
+
+    export_latency(state, hist, MaxFrameP99,
+                   "process_subframes_and_tasks() p99 exceeds bound");
+}
+
+BENCHMARK(BM_PipelineContention_Frames)
+    ->RangeMultiplier(4)
+    ->Range(1, NumThreads)
+    ->Iterations(NumFrames)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
 } // namespace
 } // namespace pipeline
 } // namespace roc
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/fast_random.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_pipeline/receiver_source.h"
+#include "roc_pipeline/sender_sink.h"
+#include "roc_rtp/format_map.h"
+
+// Loopback pipeline throughput.
+//
+// Every session is a separate SenderSink that sends packets directly to the
+// endpoints of a single ReceiverSource, bypassing network. One benchmark
+// iteration writes one packet worth of samples to every sender, delivers the
+// produced packets to receiver, and reads one packet worth of mixed samples
+// from receiver.
+//
+// Arguments are number of sessions and packet length in milliseconds.
+// Benchmark variants select FEC scheme and receiver resampler profile.
+//
+// The "rt_sessions" counter is the number of sessions that one core can handle
+// in real time, i.e. the duration of audio processed by all sessions divided by
+// CPU time. The sender and receiver costs are both included, so a node running
+// only receivers can handle somewhat more.
+
+namespace roc {
+namespace pipeline {
+namespace {
+
+enum {
+    MaxBufSize = 4096,
+
+    SampleRate = 44100,
+    ChMask = 0x3,
+    NumCh = 2,
+
+    SourcePackets = 20,
+    RepairPackets = 10,
+
+    // target latency, in packets; should exceed FEC block
+    LatencyPackets = SourcePackets * 3 / 2,
+
+    MaxSessions = 64
+};
+
+enum { NoResampling = -1 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<audio::sample_t> sample_buffer_factory(allocator, MaxBufSize, false);
+core::BufferFactory<uint8_t> byte_buffer_factory(allocator, MaxBufSize, false);
+packet::PacketFactory packet_factory(allocator, false);
+rtp::FormatMap format_map;
+
+// Copies packets produced by sender, as if they were received from network
+// from given address, and writes them to receiver endpoint.
+class LoopbackWriter : public packet::IWriter, public core::NonCopyable<> {
+public:
+    LoopbackWriter()
+        : writer_(NULL) {
+    }
+
+    void init(packet::IWriter* writer, const address::SocketAddr& src_addr) {
+        writer_ = writer;
+        src_addr_ = src_addr;
+    }
+
+    virtual void write(const packet::PacketPtr& pa) {
+        if (!writer_) {
+            return;
+        }
+
+        packet::PacketPtr pb = packet_factory.new_packet();
+        if (!pb) {
+            roc_panic("loopback: can't allocate packet");
+        }
+
+        pb->add_flags(packet::Packet::FlagUDP);
+        *pb->udp() = *pa->udp();
+        pb->udp()->src_addr = src_addr_;
+
+        pb->set_data(pa->data());
+
+        writer_->write(pb);
+    }
+
+private:
+    packet::IWriter* writer_;
+    address::SocketAddr src_addr_;
+};
+
+address::Protocol source_proto(packet::FecScheme scheme) {
+    switch (scheme) {
+    case packet::FEC_ReedSolomon_M8:
+        return address::Proto_RTP_RS8M_Source;
+    case packet::FEC_LDPC_Staircase:
+        return address::Proto_RTP_LDPC_Source;
+    case packet::FEC_RLC:
+        return address::Proto_RTP_RLC_Source;
+    default:
+        break;
+    }
+    return address::Proto_RTP;
+}
+
+address::Protocol repair_proto(packet::FecScheme scheme) {
+    switch (scheme) {
+    case packet::FEC_ReedSolomon_M8:
+        return address::Proto_RS8M_Repair;
+    case packet::FEC_LDPC_Staircase:
+        return address::Proto_LDPC_Repair;
+    case packet::FEC_RLC:
+        return address::Proto_RLC_Repair;
+    default:
+        break;
+    }
+    return address::Proto_None;
+}
+
+SenderConfig sender_config(packet::FecScheme scheme, core::nanoseconds_t packet_len) {
+    SenderConfig config;
+
+    config.input_sample_spec = audio::SampleSpec(SampleRate, ChMask);
+    config.packet_length = packet_len;
+    config.internal_frame_length = packet_len;
+
+    config.fec_encoder.scheme = scheme;
+    config.fec_writer.n_source_packets = SourcePackets;
+    config.fec_writer.n_repair_packets = RepairPackets;
+
+    config.timing = false;
+    config.poisoning = false;
+    config.profiling = false;
+
+    return config;
+}
+
+ReceiverConfig receiver_config(int resampler_profile, core::nanoseconds_t packet_len) {
+    ReceiverConfig config;
+
+    config.common.output_sample_spec = audio::SampleSpec(SampleRate, ChMask);
+    config.common.internal_frame_length = packet_len;
+
+    config.common.resampling = (resampler_profile != NoResampling);
+    config.common.timing = false;
+    config.common.poisoning = false;
+    config.common.profiling = false;
+
+    ReceiverSessionConfig& sess = config.default_session;
+
+    sess.target_latency = packet_len * LatencyPackets;
+    sess.latency_monitor.min_latency = -sess.target_latency;
+    sess.latency_monitor.max_latency = sess.target_latency * 2;
+    sess.watchdog.no_playback_timeout = sess.target_latency * 20;
+
+    if (resampler_profile != NoResampling) {
+        sess.resampler_backend = audio::ResamplerBackend_Builtin;
+        sess.resampler_profile = (audio::ResamplerProfile)resampler_profile;
+    }
+
+    return config;
+}
+
+void fill_noise(audio::sample_t* samples, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        samples[n] = (audio::sample_t)core::fast_random(0, 1000) / 1000 - 0.5f;
+    }
+}
+
+bool step(benchmark::State& state,
+          core::ScopedPtr<SenderSink>* senders,
+          size_t num_sessions,
+          ReceiverSource& receiver,
+          audio::sample_t* input,
+          audio::sample_t* output,
+          size_t packet_samples) {
+    for (size_t n = 0; n < num_sessions; n++) {
+        audio::Frame frame(input, packet_samples);
+        senders[n]->write(frame);
+    }
+
+    audio::Frame frame(output, packet_samples);
+    if (!receiver.read(frame)) {
+        state.SkipWithError("can't read frame");
+        return false;
+    }
+
+    benchmark::DoNotOptimize(output[0]);
+    return true;
+}
+
+void run_loopback(benchmark::State& state,
+                  packet::FecScheme scheme,
+                  int resampler_profile) {
+    const size_t num_sessions = (size_t)state.range(0);
+    const core::nanoseconds_t packet_len = state.range(1) * core::Millisecond;
+    const size_t packet_samples =
+        size_t(packet_len * SampleRate / core::Second) * NumCh;
+
+    if (num_sessions > MaxSessions || packet_samples > MaxBufSize) {
+        state.SkipWithError("bad arguments");
+        return;
+    }
+
+    if (scheme != packet::FEC_None && !fec::CodecMap::instance().is_supported(scheme)) {
+        state.SkipWithError("fec scheme not supported");
+        return;
+    }
+
+    ReceiverSource receiver(receiver_config(resampler_profile, packet_len), format_map,
+                            packet_factory, byte_buffer_factory, sample_buffer_factory,
+                            allocator);
+    if (!receiver.valid()) {
+        state.SkipWithError("can't create receiver");
+        return;
+    }
+
+    ReceiverSlot* receiver_slot = receiver.create_slot();
+    if (!receiver_slot) {
+        state.SkipWithError("can't create receiver slot");
+        return;
+    }
+
+    ReceiverEndpoint* receiver_source_endpoint =
+        receiver_slot->create_endpoint(address::Iface_AudioSource, source_proto(scheme));
+    ReceiverEndpoint* receiver_repair_endpoint = NULL;
+
+    if (!receiver_source_endpoint) {
+        state.SkipWithError("can't create receiver endpoint");
+        return;
+    }
+
+    if (repair_proto(scheme) != address::Proto_None) {
+        receiver_repair_endpoint = receiver_slot->create_endpoint(
+            address::Iface_AudioRepair, repair_proto(scheme));
+        if (!receiver_repair_endpoint) {
+            state.SkipWithError("can't create receiver endpoint");
+            return;
+        }
+    }
+
+    core::ScopedPtr<SenderSink> senders[MaxSessions];
+
+    LoopbackWriter source_writers[MaxSessions];
+    LoopbackWriter repair_writers[MaxSessions];
+
+    for (size_t n = 0; n < num_sessions; n++) {
+        address::SocketAddr src_addr;
+        if (!src_addr.set_host_port(address::Family_IPv4, "127.0.0.1", int(10000 + n))) {
+            state.SkipWithError("can't set address");
+            return;
+        }
+
+        address::SocketAddr dst_addr;
+        if (!dst_addr.set_host_port(address::Family_IPv4, "127.0.0.1", 20000)) {
+            state.SkipWithError("can't set address");
+            return;
+        }
+
+        senders[n].reset(new (allocator) SenderSink(sender_config(scheme, packet_len),
+                                                    format_map, packet_factory,
+                                                    byte_buffer_factory,
+                                                    sample_buffer_factory, allocator),
+                         allocator);
+        if (!senders[n] || !senders[n]->valid()) {
+            state.SkipWithError("can't create sender");
+            return;
+        }
+
+        SenderSlot* sender_slot = senders[n]->create_slot();
+        if (!sender_slot) {
+            state.SkipWithError("can't create sender slot");
+            return;
+        }
+
+        SenderEndpoint* sender_source_endpoint = sender_slot->create_endpoint(
+            address::Iface_AudioSource, source_proto(scheme));
+        if (!sender_source_endpoint) {
+            state.SkipWithError("can't create sender endpoint");
+            return;
+        }
+
+        source_writers[n].init(&receiver_source_endpoint->writer(), src_addr);
+        sender_source_endpoint->set_destination_writer(source_writers[n]);
+        sender_source_endpoint->set_destination_address(dst_addr);
+
+        if (receiver_repair_endpoint) {
+            SenderEndpoint* sender_repair_endpoint = sender_slot->create_endpoint(
+                address::Iface_AudioRepair, repair_proto(scheme));
+            if (!sender_repair_endpoint) {
+                state.SkipWithError("can't create sender endpoint");
+                return;
+            }
+
+            repair_writers[n].init(&receiver_repair_endpoint->writer(), src_addr);
+            sender_repair_endpoint->set_destination_writer(repair_writers[n]);
+            sender_repair_endpoint->set_destination_address(dst_addr);
+        }
+    }
+
+    audio::sample_t input[MaxBufSize];
+    audio::sample_t output[MaxBufSize];
+
+    fill_noise(input, packet_samples);
+
+    // fill receiver queues up to target latency
+    for (size_t np = 0; np < LatencyPackets; np++) {
+        for (size_t n = 0; n < num_sessions; n++) {
+            audio::Frame frame(input, packet_samples);
+            senders[n]->write(frame);
+        }
+    }
+
+    // let receiver create sessions before measurement
+    if (!step(state, senders, num_sessions, receiver, input, output, packet_samples)) {
+        return;
+    }
+
+    while (state.KeepRunning()) {
+        if (!step(state, senders, num_sessions, receiver, input, output,
+                  packet_samples)) {
+            return;
+        }
+    }
+
+    if (receiver.num_sessions() != num_sessions) {
+        state.SkipWithError("some sessions were terminated");
+        return;
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(packet_samples)
+                            * int64_t(num_sessions));
+
+    state.counters["rt_sessions"] = benchmark::Counter(
+        double(state.iterations()) * double(num_sessions) * double(packet_len)
+            / double(core::Second),
+        benchmark::Counter::kIsRate);
+}
+
+void loopback_args(benchmark::internal::Benchmark* b) {
+    const int64_t sessions[] = { 1, 8, 32 };
+    const int64_t packet_lens[] = { 2, 5, 10 };
+
+    for (size_t s = 0; s < sizeof(sessions) / sizeof(sessions[0]); s++) {
+        for (size_t p = 0; p < sizeof(packet_lens) / sizeof(packet_lens[0]); p++) {
+            b->ArgPair(sessions[s], packet_lens[p]);
+        }
+    }
+}
+
+void BM_Loopback_Bare(benchmark::State& state) {
+    run_loopback(state, packet::FEC_None, NoResampling);
+}
+
+BENCHMARK(BM_Loopback_Bare)->Apply(loopback_args)->Unit(benchmark::kMicrosecond);
+
+void BM_Loopback_ReedSolomon(benchmark::State& state) {
+    run_loopback(state, packet::FEC_ReedSolomon_M8, NoResampling);
+}
+
+BENCHMARK(BM_Loopback_ReedSolomon)->Apply(loopback_args)->Unit(benchmark::kMicrosecond);
+
+void BM_Loopback_LDPC(benchmark::State& state) {
+    run_loopback(state, packet::FEC_LDPC_Staircase, NoResampling);
+}
+
+BENCHMARK(BM_Loopback_LDPC)->Apply(loopback_args)->Unit(benchmark::kMicrosecond);
+
+void BM_Loopback_RLC(benchmark::State& state) {
+    run_loopback(state, packet::FEC_RLC, NoResampling);
+}
+
+BENCHMARK(BM_Loopback_RLC)->Apply(loopback_args)->Unit(benchmark::kMicrosecond);
+
+void BM_Loopback_ResamplerLow(benchmark::State& state) {
+    run_loopback(state, packet::FEC_None, audio::ResamplerProfile_Low);
+}
+
+BENCHMARK(BM_Loopback_ResamplerLow)->Apply(loopback_args)->Unit(benchmark::kMicrosecond);
+
+void BM_Loopback_ResamplerMedium(benchmark::State& state) {
+    run_loopback(state, packet::FEC_None, audio::ResamplerProfile_Medium);
+}
+
+BENCHMARK(BM_Loopback_ResamplerMedium)
+    ->Apply(loopback_args)
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_Loopback_ResamplerHigh(benchmark::State& state) {
+    run_loopback(state, packet::FEC_None, audio::ResamplerProfile_High);
+}
+
+BENCHMARK(BM_Loopback_ResamplerHigh)->Apply(loopback_args)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace pipeline
+} // namespace roc
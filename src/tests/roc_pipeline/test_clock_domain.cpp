@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_pipeline/clock_domain.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+const core::nanoseconds_t Epoch = 1000 * core::Second;
+const core::nanoseconds_t FrameLength = 10 * core::Millisecond;
+
+} // namespace
+
+TEST_GROUP(clock_domain) {};
+
+TEST(clock_domain, first_join) {
+    ClockDomain domain;
+
+    // first pipeline defines epoch
+    LONGS_EQUAL(Epoch, domain.join(Epoch, FrameLength));
+}
+
+TEST(clock_domain, align_to_boundary) {
+    ClockDomain domain;
+
+    LONGS_EQUAL(Epoch, domain.join(Epoch, FrameLength));
+
+    // exactly at boundary
+    LONGS_EQUAL(Epoch + FrameLength * 3,
+                domain.join(Epoch + FrameLength * 3, FrameLength));
+
+    // between boundaries
+    LONGS_EQUAL(Epoch + FrameLength, domain.join(Epoch + 1, FrameLength));
+    LONGS_EQUAL(Epoch + FrameLength * 5,
+                domain.join(Epoch + FrameLength * 4 + FrameLength / 2, FrameLength));
+}
+
+TEST(clock_domain, different_frame_length) {
+    ClockDomain domain;
+
+    LONGS_EQUAL(Epoch, domain.join(Epoch, FrameLength));
+
+    // boundaries are counted from the same epoch in units of joining frame length
+    LONGS_EQUAL(Epoch + FrameLength * 2,
+                domain.join(Epoch + FrameLength + 1, FrameLength * 2));
+}
+
+TEST(clock_domain, before_epoch) {
+    ClockDomain domain;
+
+    LONGS_EQUAL(Epoch, domain.join(Epoch, FrameLength));
+    LONGS_EQUAL(Epoch, domain.join(Epoch - FrameLength / 2, FrameLength));
+}
+
+} // namespace pipeline
+} // namespace roc
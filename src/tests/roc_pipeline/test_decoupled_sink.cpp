@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/time.h"
+#include "roc_pipeline/decoupled_sink.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+enum { SampleRate = 1000, NumCh = 2, FrameSize = 20, MaxSamples = 10000 };
+
+const core::nanoseconds_t FrameLength = 10 * core::Millisecond;
+const core::nanoseconds_t BufferLength = 50 * core::Millisecond;
+
+core::HeapAllocator allocator;
+
+// Records all written samples.
+class RecordingSink : public sndio::ISink {
+public:
+    RecordingSink()
+        : n_samples_(0)
+        , n_frames_(0)
+        , bad_frame_size_(false) {
+    }
+
+    size_t num_samples() const {
+        core::Mutex::Lock lock(mutex_);
+        return n_samples_;
+    }
+
+    audio::sample_t nth_sample(size_t n) const {
+        core::Mutex::Lock lock(mutex_);
+        return samples_[n];
+    }
+
+    bool bad_frame_size() const {
+        core::Mutex::Lock lock(mutex_);
+        return bad_frame_size_;
+    }
+
+    virtual sndio::DeviceType type() const {
+        return sndio::DeviceType_Sink;
+    }
+
+    virtual sndio::DeviceState state() const {
+        return sndio::DeviceState_Active;
+    }
+
+    virtual void pause() {
+    }
+
+    virtual bool resume() {
+        return true;
+    }
+
+    virtual bool restart() {
+        return true;
+    }
+
+    virtual audio::SampleSpec sample_spec() const {
+        return audio::SampleSpec(SampleRate, 0x3);
+    }
+
+    virtual core::nanoseconds_t latency() const {
+        return 0;
+    }
+
+    virtual bool has_clock() const {
+        return false;
+    }
+
+    virtual void write(audio::Frame& frame) {
+        core::Mutex::Lock lock(mutex_);
+
+        if (frame.num_samples() != FrameSize) {
+            bad_frame_size_ = true;
+        }
+
+        for (size_t n = 0; n < frame.num_samples() && n_samples_ < MaxSamples; n++) {
+            samples_[n_samples_++] = frame.samples()[n];
+        }
+        n_frames_++;
+    }
+
+private:
+    core::Mutex mutex_;
+
+    audio::sample_t samples_[MaxSamples];
+    size_t n_samples_;
+    size_t n_frames_;
+    bool bad_frame_size_;
+};
+
+} // namespace
+
+TEST_GROUP(decoupled_sink) {};
+
+TEST(decoupled_sink, write_in_order) {
+    enum { NumSamples = 2000, WriteSize = 6 };
+
+    RecordingSink out_sink;
+
+    DecoupledSink sink(out_sink, FrameLength, BufferLength, allocator);
+    CHECK(sink.valid());
+
+    size_t next = 1;
+    while (next <= NumSamples) {
+        audio::sample_t samples[WriteSize];
+        for (size_t n = 0; n < WriteSize; n++) {
+            samples[n] = (audio::sample_t)(next + n);
+        }
+
+        audio::Frame frame(samples, WriteSize);
+        sink.write(frame);
+
+        next += WriteSize;
+
+        // give pipeline thread time to keep up
+        core::sleep_for(core::ClockMonotonic, core::Microsecond * 100);
+    }
+
+    // wrapped sink always receives frames of configured size
+    CHECK(!out_sink.bad_frame_size());
+
+    // ordering can be checked only if no samples were dropped because of
+    // scheduling delays of pipeline thread
+    if (sink.num_overruns() == 0) {
+        const size_t n_expected = (next - 1) / FrameSize * FrameSize;
+
+        while (out_sink.num_samples() < n_expected) {
+            core::sleep_for(core::ClockMonotonic, core::Millisecond);
+        }
+
+        for (size_t n = 0; n < n_expected; n++) {
+            DOUBLES_EQUAL((double)(n + 1), (double)out_sink.nth_sample(n), 0.0001);
+        }
+    }
+}
+
+TEST(decoupled_sink, overrun) {
+    enum { WriteSize = 200 };
+
+    RecordingSink out_sink;
+
+    DecoupledSink sink(out_sink, FrameLength, BufferLength, allocator);
+    CHECK(sink.valid());
+
+    audio::sample_t samples[WriteSize] = {};
+    audio::Frame frame(samples, WriteSize);
+
+    // buffer holds 100 samples, so writing more never blocks, but drops samples
+    sink.write(frame);
+
+    CHECK(sink.num_overruns() == 1);
+}
+
+} // namespace pipeline
+} // namespace roc
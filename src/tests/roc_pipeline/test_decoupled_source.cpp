@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/time.h"
+#include "roc_pipeline/decoupled_source.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+enum { SampleRate = 1000, NumCh = 2, FrameSize = 20 };
+
+const core::nanoseconds_t FrameLength = 10 * core::Millisecond;
+const core::nanoseconds_t BufferLength = 50 * core::Millisecond;
+
+core::HeapAllocator allocator;
+
+// Produces increasing sample values starting from 1, up to given limit.
+class CountingSource : public sndio::ISource {
+public:
+    CountingSource(size_t limit)
+        : next_(0)
+        , limit_(limit)
+        , reclock_ts_(0) {
+    }
+
+    packet::ntp_timestamp_t last_reclock() const {
+        return (packet::ntp_timestamp_t)reclock_ts_;
+    }
+
+    virtual sndio::DeviceType type() const {
+        return sndio::DeviceType_Source;
+    }
+
+    virtual sndio::DeviceState state() const {
+        return sndio::DeviceState_Active;
+    }
+
+    virtual void pause() {
+    }
+
+    virtual bool resume() {
+        return true;
+    }
+
+    virtual bool restart() {
+        return true;
+    }
+
+    virtual audio::SampleSpec sample_spec() const {
+        return audio::SampleSpec(SampleRate, 0x3);
+    }
+
+    virtual core::nanoseconds_t latency() const {
+        return 0;
+    }
+
+    virtual bool has_clock() const {
+        return false;
+    }
+
+    virtual void reclock(packet::ntp_timestamp_t ts) {
+        reclock_ts_ = (long long)ts;
+    }
+
+    virtual bool read(audio::Frame& frame) {
+        if (next_ >= limit_) {
+            return false;
+        }
+        for (size_t n = 0; n < frame.num_samples(); n++) {
+            frame.samples()[n] = (audio::sample_t)(++next_);
+        }
+        return true;
+    }
+
+private:
+    size_t next_;
+    const size_t limit_;
+    core::Atomic<long long> reclock_ts_;
+};
+
+} // namespace
+
+TEST_GROUP(decoupled_source) {};
+
+TEST(decoupled_source, read_in_order) {
+    enum { NumSamples = 2000 };
+
+    CountingSource in_source((size_t)-1);
+
+    DecoupledSource source(in_source, FrameLength, BufferLength, allocator);
+    CHECK(source.valid());
+
+    audio::sample_t samples[FrameSize];
+    audio::Frame frame(samples, FrameSize);
+
+    size_t next = 1;
+    while (next < NumSamples) {
+        CHECK(source.read(frame));
+
+        for (size_t n = 0; n < FrameSize; n++) {
+            if (samples[n] < 0.5f) {
+                // underrun, the rest of the frame is zeroed
+                for (; n < FrameSize; n++) {
+                    DOUBLES_EQUAL(0.0, (double)samples[n], 0.0001);
+                }
+                core::sleep_for(core::ClockMonotonic, core::Millisecond);
+                break;
+            }
+            DOUBLES_EQUAL((double)next, (double)samples[n], 0.0001);
+            next++;
+        }
+    }
+}
+
+TEST(decoupled_source, eof) {
+    enum { NumSamples = 200 };
+
+    CountingSource in_source(NumSamples);
+
+    DecoupledSource source(in_source, FrameLength, BufferLength, allocator);
+    CHECK(source.valid());
+
+    audio::sample_t samples[FrameSize];
+    audio::Frame frame(samples, FrameSize);
+
+    size_t n_samples = 0;
+    while (source.read(frame)) {
+        for (size_t n = 0; n < FrameSize; n++) {
+            if (samples[n] > 0 || samples[n] < 0) {
+                n_samples++;
+            }
+        }
+        core::sleep_for(core::ClockMonotonic, core::Microsecond * 100);
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumSamples, n_samples);
+}
+
+TEST(decoupled_source, reclock) {
+    CountingSource in_source((size_t)-1);
+
+    DecoupledSource source(in_source, FrameLength, BufferLength, allocator);
+    CHECK(source.valid());
+
+    audio::sample_t samples[FrameSize];
+    audio::Frame frame(samples, FrameSize);
+
+    const packet::ntp_timestamp_t ts = packet::ntp_timestamp_t(1) << 40;
+
+    // timestamp is forwarded by background thread, shifted by buffered length
+    while (in_source.last_reclock() == 0) {
+        CHECK(source.read(frame));
+        source.reclock(ts);
+        core::sleep_for(core::ClockMonotonic, core::Millisecond);
+    }
+
+    CHECK(in_source.last_reclock() >= ts);
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -39,7 +39,9 @@ public:
                  const address::SocketAddr& dst_addr)
         : writer_(writer)
         , composer_(composer)
-        , payload_encoder_(format_map.format(pt)->new_encoder(allocator), allocator)
+        , payload_encoder_(
+              format_map.format(pt)->new_encoder(allocator, *format_map.format(pt)),
+              allocator)
         , packet_factory_(packet_factory)
         , buffer_factory_(buffer_factory)
         , src_addr_(src_addr)
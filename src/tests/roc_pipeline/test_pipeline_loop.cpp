@@ -54,6 +54,7 @@ public:
         , frame_allow_counter_(999999)
         , task_allow_counter_(999999)
         , time_(StartTime)
+        , frame_processing_time_(0)
         , exp_frame_val_(0)
         , exp_frame_sz_(0)
         , exp_sched_deadline_(-1)
@@ -68,6 +69,17 @@ public:
         time_ = t;
     }
 
+    void set_frame_processing_time(core::nanoseconds_t t) {
+        core::Mutex::Lock lock(mutex_);
+        frame_processing_time_ = t;
+    }
+
+    PipelineLoopMetrics get_metrics() const {
+        PipelineLoopMetrics metrics;
+        get_pipeline_metrics(metrics);
+        return metrics;
+    }
+
     void block_frames() {
         core::Mutex::Lock lock(mutex_);
         frame_allow_counter_ = 0;
@@ -176,6 +188,7 @@ public:
 
     using PipelineLoop::num_pending_frames;
     using PipelineLoop::num_pending_tasks;
+    using PipelineLoop::process_frames_and_tasks;
     using PipelineLoop::process_subframes_and_tasks;
 
 private:
@@ -201,6 +214,7 @@ private:
             roc_panic_if(std::abs(frame.samples()[n] - exp_frame_val_) > Epsilon);
         }
         n_processed_frames_++;
+        time_ += frame_processing_time_;
         return true;
     }
 
@@ -254,6 +268,7 @@ private:
     int task_allow_counter_;
 
     core::nanoseconds_t time_;
+    core::nanoseconds_t frame_processing_time_;
 
     audio::sample_t exp_frame_val_;
     size_t exp_frame_sz_;
@@ -1768,6 +1783,121 @@ TEST(task_pipeline, process_frame_min_samples_between_frames) {
     UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_cancellations());
 }
 
+TEST(task_pipeline, process_frame_adaptive_splitting) {
+    config.enable_adaptive_frame_splitting = true;
+
+    TestPipeline pipeline(config);
+
+    pipeline.set_time(StartTime);
+
+    // first frame
+    // there are no pending tasks, so it should not be split
+    audio::Frame frame1(samples, MaxFrameSize * 2);
+    fill_frame(frame1, 0.1f, 0, MaxFrameSize * 2);
+    pipeline.expect_frame(0.1f, MaxFrameSize * 2);
+
+    pipeline.process_subframes_and_tasks(frame1);
+
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_processed_frames());
+
+    // next frame is expected at this time
+    const core::nanoseconds_t frame2_time =
+        StartTime + MaxFrameSize * 2 * core::Microsecond;
+    pipeline.set_time(frame2_time);
+
+    TestCompleter completer1(pipeline);
+    TestPipeline::Task task1;
+    TestCompleter completer2(pipeline);
+    TestPipeline::Task task2;
+    TestCompleter completer3(pipeline);
+    TestPipeline::Task task3;
+
+    // schedule() can't process tasks in-place because we're near frame deadline,
+    // so it should add tasks to the queue and call schedule_task_processing()
+    pipeline.expect_sched_deadline(frame2_time + NoTaskProcessingGap / 2);
+    pipeline.schedule(task1, completer1);
+    pipeline.schedule(task2, completer2);
+    pipeline.schedule(task3, completer3);
+
+    UNSIGNED_LONGS_EQUAL(3, pipeline.num_pending_tasks());
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_calls());
+
+    // second frame
+    // there are pending tasks, so it should be split
+    audio::Frame frame2(samples, MaxFrameSize * 2);
+    fill_frame(frame2, 0.2f, 0, MaxFrameSize * 2);
+    pipeline.expect_frame(0.2f, MaxFrameSize);
+
+    // next process_subframe_imp() call will block
+    pipeline.block_frames();
+
+    // next process_task_imp() call will block
+    pipeline.block_tasks();
+
+    AsyncFrameWriter fw(pipeline, frame2);
+    fw.start();
+
+    // wait until first sub-frame is blocked
+    pipeline.wait_blocked();
+
+    // emulate sub-frame processing, 100ns per sample
+    const core::nanoseconds_t subframe_time = MaxFrameSize * 100;
+    pipeline.set_time(frame2_time + subframe_time);
+
+    // unblock first sub-frame and wait until blocked on task1
+    pipeline.unblock_one_frame();
+    pipeline.wait_blocked();
+
+    // fixed in-frame deadline is expired, but there is enough time to process
+    // the second sub-frame before the next frame deadline
+    pipeline.set_time(frame2_time + subframe_time + MaxInframeProcessing * 10);
+
+    // unblock task1 and wait until blocked on task2
+    pipeline.unblock_one_task();
+    pipeline.wait_blocked();
+
+    // now we need the rest of the time to process the second sub-frame
+    pipeline.set_time(frame2_time + MaxFrameSize * 2 * core::Microsecond
+                      - NoTaskProcessingGap / 2 - subframe_time);
+
+    // unblock task2 and wait until blocked on second sub-frame
+    pipeline.unblock_one_task();
+    pipeline.wait_blocked();
+
+    UNSIGNED_LONGS_EQUAL(2, pipeline.num_processed_frames());
+
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_pending_tasks());
+    UNSIGNED_LONGS_EQUAL(2, pipeline.num_processed_tasks());
+
+    UNSIGNED_LONGS_EQUAL(0, pipeline.num_tasks_processed_in_sched());
+    UNSIGNED_LONGS_EQUAL(2, pipeline.num_tasks_processed_in_frame());
+    UNSIGNED_LONGS_EQUAL(0, pipeline.num_tasks_processed_in_proc());
+
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_calls());
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_cancellations());
+
+    // unblock second sub-frame and task3 and wait until frame is processed
+    pipeline.unblock_all_tasks();
+    pipeline.unblock_all_frames();
+    fw.join();
+
+    UNSIGNED_LONGS_EQUAL(3, pipeline.num_processed_frames());
+
+    UNSIGNED_LONGS_EQUAL(0, pipeline.num_pending_tasks());
+    UNSIGNED_LONGS_EQUAL(3, pipeline.num_processed_tasks());
+
+    UNSIGNED_LONGS_EQUAL(0, pipeline.num_tasks_processed_in_sched());
+    UNSIGNED_LONGS_EQUAL(3, pipeline.num_tasks_processed_in_frame());
+    UNSIGNED_LONGS_EQUAL(0, pipeline.num_tasks_processed_in_proc());
+
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_calls());
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_cancellations());
+
+    POINTERS_EQUAL(&task1, completer1.get_task());
+    POINTERS_EQUAL(&task2, completer2.get_task());
+    POINTERS_EQUAL(&task3, completer3.get_task());
+}
+
 TEST(task_pipeline, schedule_from_completion_completer_called_in_place) {
     TestPipeline pipeline(config);
 
@@ -2198,5 +2328,115 @@ TEST(task_pipeline, schedule_and_wait_until_process_frame_called) {
     UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_cancellations());
 }
 
+TEST(task_pipeline, process_frames_batch) {
+    TestPipeline pipeline(config);
+
+    audio::Frame frame(samples, FrameSize);
+    fill_frame(frame, 0.1f, 0, FrameSize);
+    pipeline.expect_frame(0.1f, FrameSize);
+
+    pipeline.set_time(StartTime);
+
+    CHECK(pipeline.process_subframes_and_tasks(frame));
+
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_processed_frames());
+
+    TestCompleter completer(pipeline);
+    TestPipeline::Task task;
+
+    // deadline expired, task is enqueued
+    pipeline.set_time(StartTime + FrameSize * core::Microsecond
+                      - NoTaskProcessingGap / 2);
+    pipeline.expect_sched_deadline(StartTime + FrameSize * core::Microsecond
+                                   + NoTaskProcessingGap / 2);
+
+    pipeline.schedule(task, completer);
+
+    POINTERS_EQUAL(NULL, completer.get_task());
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_pending_tasks());
+
+    audio::sample_t* frames[] = {
+        samples,
+        samples + FrameSize,
+        samples + FrameSize * 2,
+    };
+    for (size_t n = 0; n < FrameSize * 3; n++) {
+        samples[n] = 0.1f;
+    }
+
+    pipeline.set_time(StartTime + FrameSize * core::Microsecond);
+
+    // all frames are processed in one call, task is processed between frames
+    size_t n_processed = 0;
+    CHECK(pipeline.process_frames_and_tasks(frames, 3, FrameSize, n_processed));
+
+    UNSIGNED_LONGS_EQUAL(3, n_processed);
+    UNSIGNED_LONGS_EQUAL(4, pipeline.num_processed_frames());
+
+    POINTERS_EQUAL(&task, completer.get_task());
+
+    UNSIGNED_LONGS_EQUAL(0, pipeline.num_pending_tasks());
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_processed_tasks());
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_tasks_processed_in_frame());
+
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_calls());
+    UNSIGNED_LONGS_EQUAL(1, pipeline.num_sched_cancellations());
+
+    UNSIGNED_LONGS_EQUAL(4, pipeline.get_metrics().frames);
+}
+
+TEST(task_pipeline, deadline_metrics) {
+    for (int precise = 0; precise <= 1; precise++) {
+        config.enable_precise_task_scheduling = precise;
+
+        TestPipeline pipeline(config);
+
+        audio::Frame frame(samples, FrameSize);
+        fill_frame(frame, 0.1f, 0, FrameSize);
+        pipeline.expect_frame(0.1f, FrameSize);
+
+        const core::nanoseconds_t frame_duration = FrameSize * core::Microsecond;
+
+        // processing fits into frame duration
+        pipeline.set_frame_processing_time(frame_duration / 5);
+        CHECK(pipeline.process_subframes_and_tasks(frame));
+
+        PipelineLoopMetrics metrics = pipeline.get_metrics();
+        UNSIGNED_LONGS_EQUAL(1, metrics.frames);
+        UNSIGNED_LONGS_EQUAL(0, metrics.missed_deadlines);
+        UNSIGNED_LONGS_EQUAL(0, metrics.late_wakeups);
+        LONGS_EQUAL(0, metrics.max_overrun);
+
+        // processing takes longer than frame duration
+        pipeline.set_frame_processing_time(frame_duration + 1000 * core::Microsecond);
+        CHECK(pipeline.process_subframes_and_tasks(frame));
+
+        metrics = pipeline.get_metrics();
+        UNSIGNED_LONGS_EQUAL(2, metrics.frames);
+        UNSIGNED_LONGS_EQUAL(1, metrics.missed_deadlines);
+        UNSIGNED_LONGS_EQUAL(0, metrics.late_wakeups);
+        LONGS_EQUAL(1000 * core::Microsecond, metrics.max_overrun);
+
+        // processing is fast, but wakeup was late
+        pipeline.set_frame_processing_time(frame_duration / 5);
+        CHECK(pipeline.process_subframes_and_tasks(frame, frame_duration * 9 / 10));
+
+        metrics = pipeline.get_metrics();
+        UNSIGNED_LONGS_EQUAL(3, metrics.frames);
+        UNSIGNED_LONGS_EQUAL(2, metrics.missed_deadlines);
+        UNSIGNED_LONGS_EQUAL(1, metrics.late_wakeups);
+        LONGS_EQUAL(1000 * core::Microsecond, metrics.max_overrun);
+        LONGS_EQUAL(frame_duration * 9 / 10, metrics.max_wakeup_delay);
+
+        // small wakeup delay is not counted as late wakeup
+        CHECK(pipeline.process_subframes_and_tasks(frame, frame_duration / 10));
+
+        metrics = pipeline.get_metrics();
+        UNSIGNED_LONGS_EQUAL(4, metrics.frames);
+        UNSIGNED_LONGS_EQUAL(2, metrics.missed_deadlines);
+        UNSIGNED_LONGS_EQUAL(1, metrics.late_wakeups);
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -12,6 +12,8 @@
 
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
 #include "roc_fec/codec_map.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/receiver_loop.h"
@@ -100,6 +102,36 @@ private:
     core::Atomic<int> done_;
 };
 
+// Writes junk packet to endpoint after a delay.
+class DelayedWriter : public core::Thread {
+public:
+    DelayedWriter(packet::IWriter& writer, core::nanoseconds_t delay)
+        : writer_(writer)
+        , delay_(delay) {
+    }
+
+private:
+    virtual void run() {
+        core::sleep_for(core::ClockMonotonic, delay_);
+
+        // packet contents don't matter, it's dropped by parser
+        packet::PacketPtr pp = packet_factory.new_packet();
+        roc_panic_if_not(pp);
+
+        core::Slice<uint8_t> buffer = byte_buffer_factory.new_buffer();
+        roc_panic_if_not(buffer);
+        memset(buffer.data(), 0, buffer.size());
+
+        pp->add_flags(packet::Packet::FlagUDP);
+        pp->set_data(buffer);
+
+        writer_.write(pp);
+    }
+
+    packet::IWriter& writer_;
+    const core::nanoseconds_t delay_;
+};
+
 } // namespace
 
 TEST_GROUP(receiver_loop) {
@@ -161,5 +193,182 @@ TEST(receiver_loop, endpoints_async) {
     scheduler.wait_done();
 }
 
+TEST(receiver_loop, shared_clock_domain) {
+    enum { FrameSize = MaxBufDuration * DefaultSampleRate / core::Second * 2 };
+
+    config.common.timing = true;
+
+    ClockDomain clock_domain;
+
+    ReceiverLoop receiver1(scheduler, config, format_map, packet_factory,
+                           byte_buffer_factory, sample_buffer_factory, allocator,
+                           &clock_domain);
+    CHECK(receiver1.valid());
+
+    ReceiverLoop receiver2(scheduler, config, format_map, packet_factory,
+                           byte_buffer_factory, sample_buffer_factory, allocator,
+                           &clock_domain);
+    CHECK(receiver2.valid());
+
+    audio::sample_t samples[FrameSize];
+    audio::Frame frame(samples, FrameSize);
+
+    const core::nanoseconds_t epoch = core::timestamp(core::ClockMonotonic);
+
+    // first receiver defines epoch
+    CHECK(receiver1.source().read(frame));
+
+    core::sleep_for(core::ClockMonotonic, MaxBufDuration / 4);
+
+    // second receiver joins in the middle of the frame, so it starts at next
+    // frame boundary of the first receiver
+    CHECK(receiver2.source().read(frame));
+    CHECK(core::timestamp(core::ClockMonotonic) - epoch >= MaxBufDuration);
+}
+
+TEST(receiver_loop, read_delay) {
+    enum { FrameSize = MaxBufDuration * DefaultSampleRate / core::Second * 2 };
+
+    audio::sample_t samples[FrameSize];
+    audio::Frame frame(samples, FrameSize);
+
+    { // without timing, never blocks
+        ReceiverLoop receiver(scheduler, config, format_map, packet_factory,
+                              byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(receiver.valid());
+
+        CHECK(receiver.source().read(frame));
+        CHECK(receiver.read_delay() == 0);
+    }
+
+    config.common.timing = true;
+
+    { // with timing, next frame is due after current one
+        ReceiverLoop receiver(scheduler, config, format_map, packet_factory,
+                              byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(receiver.valid());
+
+        CHECK(receiver.read_delay() == 0);
+        CHECK(receiver.source().read(frame));
+
+        const core::nanoseconds_t delay = receiver.read_delay();
+        CHECK(delay > 0);
+        CHECK(delay <= MaxBufDuration);
+
+        core::sleep_for(core::ClockMonotonic, delay);
+        CHECK(receiver.read_delay() == 0);
+    }
+}
+
+TEST(receiver_loop, read_frames) {
+    enum {
+        FrameSize = MaxBufDuration * DefaultSampleRate / core::Second * 2,
+        NumFrames = 3
+    };
+
+    audio::sample_t samples[FrameSize * NumFrames];
+
+    audio::sample_t* frames[] = {
+        samples,
+        samples + FrameSize,
+        samples + FrameSize * 2,
+    };
+
+    { // without timing, all frames are read in one pipeline entry
+        ReceiverLoop receiver(scheduler, config, format_map, packet_factory,
+                              byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(receiver.valid());
+
+        CHECK(receiver.read_frames(frames, NumFrames, FrameSize));
+        CHECK(receiver.read_delay() == 0);
+    }
+
+    config.common.timing = true;
+
+    { // with timing, every frame waits for its deadline
+        ReceiverLoop receiver(scheduler, config, format_map, packet_factory,
+                              byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(receiver.valid());
+
+        const core::nanoseconds_t start = core::timestamp(core::ClockMonotonic);
+
+        CHECK(receiver.read_frames(frames, NumFrames, FrameSize));
+
+        const core::nanoseconds_t elapsed =
+            core::timestamp(core::ClockMonotonic) - start;
+
+        CHECK(elapsed >= MaxBufDuration * (NumFrames - 1));
+        CHECK(receiver.read_delay() > 0);
+    }
+}
+
+TEST(receiver_loop, power_saving) {
+    enum { FrameSize = MaxBufDuration * DefaultSampleRate / core::Second * 2 };
+
+    config.common.power_saving = true;
+
+    ReceiverLoop receiver(scheduler, config, format_map, packet_factory,
+                          byte_buffer_factory, sample_buffer_factory, allocator);
+    CHECK(receiver.valid());
+
+    ReceiverLoop::SlotHandle slot = NULL;
+    packet::IWriter* writer = NULL;
+
+    {
+        ReceiverLoop::Tasks::CreateSlot task;
+        CHECK(receiver.schedule_and_wait(task));
+        CHECK(task.success());
+        slot = task.get_handle();
+    }
+
+    {
+        ReceiverLoop::Tasks::CreateEndpoint task(slot, address::Iface_AudioSource,
+                                                 address::Proto_RTP);
+        CHECK(receiver.schedule_and_wait(task));
+        CHECK(task.success());
+        writer = task.get_writer();
+    }
+
+    audio::sample_t samples[FrameSize];
+    for (size_t n = 0; n < FrameSize; n++) {
+        samples[n] = 1;
+    }
+
+    audio::Frame frame(samples, FrameSize);
+
+    ReceiverSlotMetrics metrics;
+
+    { // idle receiver returns zeros without entering pipeline
+        CHECK(receiver.source().read(frame));
+
+        for (size_t n = 0; n < FrameSize; n++) {
+            DOUBLES_EQUAL(0.0, (double)samples[n], 0.0001);
+        }
+        CHECK(frame.flags() & audio::Frame::FlagZeros);
+
+        receiver.get_metrics(slot, metrics);
+        UNSIGNED_LONGS_EQUAL(0, metrics.pipeline.frames);
+
+        CHECK(!receiver.wait_active(0));
+        CHECK(!receiver.wait_active(core::Millisecond));
+    }
+
+    { // waiter is woken up by incoming packet
+        DelayedWriter delayed_writer(*writer, core::Millisecond * 10);
+        CHECK(delayed_writer.start());
+
+        CHECK(receiver.wait_active(core::Second * 60));
+
+        delayed_writer.join();
+    }
+
+    { // active receiver enters pipeline
+        CHECK(receiver.source().read(frame));
+
+        receiver.get_metrics(slot, metrics);
+        UNSIGNED_LONGS_EQUAL(1, metrics.pipeline.frames);
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -14,6 +14,7 @@
 #include "roc_core/atomic.h"
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
 #include "roc_core/time.h"
 #include "roc_fec/codec_map.h"
 #include "roc_packet/packet_factory.h"
@@ -75,6 +76,36 @@ create_endpoint(ReceiverSlot* slot, address::Interface iface, address::Protocol
     return &endpoint->writer();
 }
 
+class EventLog : public IReceiverEventHandler {
+public:
+    EventLog()
+        : n_added(0)
+        , n_removed(0)
+        , n_stable(0)
+        , last_id(0) {
+    }
+
+    virtual void on_session_added(size_t session_id) {
+        n_added++;
+        last_id = session_id;
+    }
+
+    virtual void on_session_removed(size_t session_id) {
+        n_removed++;
+        last_id = session_id;
+    }
+
+    virtual void on_session_latency_stable(size_t session_id) {
+        n_stable++;
+        last_id = session_id;
+    }
+
+    size_t n_added;
+    size_t n_removed;
+    size_t n_stable;
+    size_t last_id;
+};
+
 } // namespace
 
 TEST_GROUP(receiver_source) {
@@ -248,6 +279,59 @@ TEST(receiver_source, initial_latency) {
     }
 }
 
+TEST(receiver_source, slot_latency_override) {
+    enum { SlotLatency = Latency * 2 };
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlotConfig slot_config;
+    slot_config.target_latency = SlotLatency * core::Second / SampleRate;
+
+    ReceiverSlot* slot = receiver.create_slot(slot_config);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer(allocator, *endpoint1_writer, rtp_composer,
+                                     format_map, packet_factory, byte_buffer_factory,
+                                     PayloadType, src1, dst1);
+
+    // session waits for slot latency instead of default latency
+    for (size_t np = 0; np < SlotLatency / SamplesPerPacket - 1; np++) {
+        packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+    }
+
+    packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+
+    for (size_t np = 0; np < SlotLatency / SamplesPerPacket; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+    }
+
+    ReceiverSlotMetrics metrics;
+    slot->get_metrics(metrics);
+
+    UNSIGNED_LONGS_EQUAL(1, metrics.num_sessions);
+    DOUBLES_EQUAL((double)slot_config.target_latency,
+                  (double)metrics.sessions[0].target_latency, core::Microsecond);
+}
+
 TEST(receiver_source, initial_latency_timeout) {
     ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
                             sample_buffer_factory, allocator);
@@ -317,6 +401,163 @@ TEST(receiver_source, timeout) {
     }
 }
 
+TEST(receiver_source, idle_release) {
+    enum { IdleTimeout = Latency * 2 };
+
+    config.common.idle_release_timeout = IdleTimeout * core::Second / SampleRate;
+
+    // receiver memory is tracked separately from packets and buffers
+    core::HeapAllocator receiver_allocator;
+
+    {
+        ReceiverSource receiver(config, format_map, packet_factory,
+                                byte_buffer_factory, sample_buffer_factory,
+                                receiver_allocator);
+
+        CHECK(receiver.valid());
+
+        ReceiverSlot* slot = create_slot(receiver);
+        CHECK(slot);
+
+        packet::IWriter* endpoint1_writer =
+            create_endpoint(slot, address::Iface_AudioSource, proto1);
+        CHECK(endpoint1_writer);
+
+        test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+        test::PacketWriter packet_writer(allocator, *endpoint1_writer, rtp_composer,
+                                         format_map, packet_factory, byte_buffer_factory,
+                                         PayloadType, src1, dst1);
+
+        const size_t n_idle = receiver_allocator.num_allocations();
+
+        packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                    SampleSpecs);
+
+        for (size_t nf = 0; nf < Latency / SamplesPerFrame; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+        UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+
+        while (receiver.num_sessions() != 0) {
+            frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+        }
+
+        // session arena is kept for reuse
+        CHECK(receiver_allocator.num_allocations() > n_idle);
+
+        for (size_t n = 0; n < IdleTimeout / SamplesPerFrame; n++) {
+            frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+        }
+
+        // and released after idle timeout
+        frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+        UNSIGNED_LONGS_EQUAL(n_idle, receiver_allocator.num_allocations());
+
+        // traffic resumes
+        packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                    SampleSpecs);
+
+        frame_reader.set_offset(Latency * NumCh);
+        frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, receiver_allocator.num_allocations());
+}
+
+TEST(receiver_source, max_queued_packets) {
+    enum { QueuedPackets = Latency / SamplesPerPacket };
+
+    config.default_session.max_queued_packets = QueuedPackets;
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer(allocator, *endpoint1_writer, rtp_composer,
+                                     format_map, packet_factory, byte_buffer_factory,
+                                     PayloadType, src1, dst1);
+
+    packet_writer.write_packets(QueuedPackets * 3, SamplesPerPacket, SampleSpecs);
+
+    // only packets that fit into session queue are played
+    for (size_t np = 0; np < QueuedPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+    }
+
+    for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+        frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+    }
+
+    UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+}
+
+TEST(receiver_source, control_interval) {
+    enum { ControlInterval = SamplesPerPacket * 2 };
+
+    config.common.control_interval = ControlInterval * core::Second / SampleRate;
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer(allocator, *endpoint1_writer, rtp_composer,
+                                     format_map, packet_factory, byte_buffer_factory,
+                                     PayloadType, src1, dst1);
+
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                SampleSpecs);
+
+    // packets are delivered every frame, regardless of control interval
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+
+        packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+    }
+
+    // watchdog still terminates session, at most one control interval later
+    size_t n_frames = 0;
+    while (receiver.num_sessions() != 0) {
+        frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+        n_frames++;
+    }
+
+    CHECK(n_frames * SamplesPerFrame <= Timeout + ControlInterval);
+}
+
 TEST(receiver_source, initial_trim) {
     ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
                             sample_buffer_factory, allocator);
@@ -352,6 +593,69 @@ TEST(receiver_source, initial_trim) {
     }
 }
 
+TEST(receiver_source, latency_overflow_catchup) {
+    enum { ExtraPackets = Latency * 3 / SamplesPerPacket };
+
+    config.default_session.latency_monitor.max_latency =
+        Latency * 2 * core::Second / SampleRate;
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer(allocator, *endpoint1_writer, rtp_composer,
+                                     format_map, packet_factory, byte_buffer_factory,
+                                     PayloadType, src1, dst1);
+
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                SampleSpecs);
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+        packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    // burst of packets makes latency larger than maximum
+    packet_writer.write_packets(ExtraPackets, SamplesPerPacket, SampleSpecs);
+
+    // session skips samples to return to target latency instead of terminating
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            core::Slice<audio::sample_t> samples = sample_buffer_factory.new_buffer();
+            CHECK(samples);
+            samples.reslice(0, SamplesPerFrame * NumCh);
+
+            audio::Frame frame(samples.data(), samples.size());
+            CHECK(receiver.read(frame));
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+        }
+        packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    ReceiverSlotMetrics metrics;
+    slot->get_metrics(metrics);
+
+    UNSIGNED_LONGS_EQUAL(1, metrics.num_sessions);
+    CHECK(metrics.sessions[0].skipped_packets > 0);
+    CHECK(metrics.sessions[0].skipped_packets <= ExtraPackets);
+    CHECK(metrics.sessions[0].niq_latency
+          <= config.default_session.latency_monitor.max_latency);
+    UNSIGNED_LONGS_EQUAL(0, metrics.sessions[0].late_packets);
+}
+
 TEST(receiver_source, two_sessions_synchronous) {
     ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
                             sample_buffer_factory, allocator);
@@ -444,6 +748,63 @@ TEST(receiver_source, two_sessions_overlapping) {
     }
 }
 
+TEST(receiver_source, cpu_budget_exhausted) {
+    // budget is less than load of any session
+    config.common.cpu_budget = 1e-6f;
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer1(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src1, dst1);
+
+    // first session is always admitted
+    packet_writer1.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                 SampleSpecs);
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+        }
+
+        packet_writer1.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    test::PacketWriter packet_writer2(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src2, dst1);
+
+    packet_writer2.set_offset(packet_writer1.offset() - size_t(Latency * NumCh));
+    packet_writer2.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                 SampleSpecs);
+
+    // second session is rejected, first one keeps playing
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+
+            UNSIGNED_LONGS_EQUAL(1, receiver.num_sessions());
+        }
+
+        packet_writer1.write_packets(1, SamplesPerPacket, SampleSpecs);
+        packet_writer2.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+}
+
 TEST(receiver_source, two_sessions_two_endpoints) {
     ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
                             sample_buffer_factory, allocator);
@@ -1319,5 +1680,388 @@ TEST(receiver_source, status) {
     }
 }
 
+TEST(receiver_source, worker_threads_many_sessions) {
+    enum { NumSessions = 4, NumThreads = 2 };
+
+    config.common.worker_threads = NumThreads;
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    core::ScopedPtr<test::PacketWriter> packet_writers[NumSessions];
+
+    for (size_t ns = 0; ns < NumSessions; ns++) {
+        packet_writers[ns].reset(new (allocator) test::PacketWriter(
+                                     allocator, *endpoint1_writer, rtp_composer,
+                                     format_map, packet_factory, byte_buffer_factory,
+                                     PayloadType, test::new_address(int(10 + ns)), dst1),
+                                 allocator);
+        CHECK(packet_writers[ns]);
+    }
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        for (size_t ns = 0; ns < NumSessions; ns++) {
+            packet_writers[ns]->write_packets(1, SamplesPerPacket, SampleSpecs);
+        }
+    }
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, NumSessions);
+
+            UNSIGNED_LONGS_EQUAL(NumSessions, receiver.num_sessions());
+        }
+
+        for (size_t ns = 0; ns < NumSessions; ns++) {
+            packet_writers[ns]->write_packets(1, SamplesPerPacket, SampleSpecs);
+        }
+    }
+}
+
+TEST(receiver_source, worker_threads_timeout) {
+    config.common.worker_threads = 2;
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer1(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src1, dst1);
+
+    test::PacketWriter packet_writer2(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src2, dst1);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        packet_writer1.write_packets(1, SamplesPerPacket, SampleSpecs);
+        packet_writer2.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 2);
+        }
+
+        UNSIGNED_LONGS_EQUAL(2, receiver.num_sessions());
+    }
+
+    while (receiver.num_sessions() != 0) {
+        frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+    }
+}
+
+TEST(receiver_source, metrics) {
+    enum { DelayedPackets = 5 };
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer(allocator, *endpoint1_writer, rtp_composer,
+                                     format_map, packet_factory, byte_buffer_factory,
+                                     PayloadType, src1, dst1);
+
+    {
+        ReceiverSlotMetrics metrics;
+        slot->get_metrics(metrics);
+
+        UNSIGNED_LONGS_EQUAL(0, metrics.num_sessions);
+    }
+
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket,
+                                SampleSpecs);
+    packet_writer.shift_to(Latency / SamplesPerPacket + DelayedPackets, SamplesPerPacket,
+                           SampleSpecs);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+        packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    {
+        ReceiverSlotMetrics metrics;
+        slot->get_metrics(metrics);
+
+        UNSIGNED_LONGS_EQUAL(1, metrics.num_sessions);
+        CHECK(metrics.sessions[0].alive);
+        CHECK(metrics.sessions[0].niq_latency > 0);
+        DOUBLES_EQUAL((double)config.default_session.target_latency,
+                      (double)metrics.sessions[0].target_latency, core::Microsecond);
+        CHECK(metrics.sessions[0].queue_size > 0);
+        CHECK(metrics.sessions[0].memory_bytes > 0);
+        UNSIGNED_LONGS_EQUAL(0, metrics.sessions[0].lost_packets);
+        UNSIGNED_LONGS_EQUAL(0, metrics.sessions[0].late_packets);
+        UNSIGNED_LONGS_EQUAL(0, metrics.sessions[0].repaired_packets);
+    }
+
+    for (size_t np = 0; np < DelayedPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 0);
+        }
+    }
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+        packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    packet_writer.shift_to(Latency / SamplesPerPacket, SamplesPerPacket, SampleSpecs);
+    packet_writer.write_packets(DelayedPackets, SamplesPerPacket, SampleSpecs);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+    }
+
+    {
+        ReceiverSlotMetrics metrics;
+        slot->get_metrics(metrics);
+
+        UNSIGNED_LONGS_EQUAL(1, metrics.num_sessions);
+        UNSIGNED_LONGS_EQUAL(DelayedPackets, metrics.sessions[0].lost_packets);
+        UNSIGNED_LONGS_EQUAL(DelayedPackets, metrics.sessions[0].late_packets);
+    }
+}
+
+TEST(receiver_source, read_sessions) {
+    enum { MaxFrames = 4, FrameSize = SamplesPerFrame * NumCh };
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::PacketWriter packet_writer1(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src1, dst1);
+
+    test::PacketWriter packet_writer2(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src2, dst1);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        packet_writer1.write_packets(1, SamplesPerPacket, SampleSpecs);
+        packet_writer2.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    audio::sample_t samples[MaxFrames][FrameSize];
+    ReceiverSessionFrame frames[MaxFrames];
+    for (size_t n = 0; n < MaxFrames; n++) {
+        frames[n].samples = samples[n];
+    }
+
+    size_t session_ids[2] = {};
+    uint8_t offset = 0;
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            size_t n_frames = 0;
+            CHECK(receiver.read_sessions(frames, MaxFrames, n_frames, FrameSize));
+
+            UNSIGNED_LONGS_EQUAL(2, n_frames);
+            UNSIGNED_LONGS_EQUAL(2, receiver.num_sessions());
+
+            for (size_t n = 0; n < n_frames; n++) {
+                CHECK(frames[n].session_id != 0);
+                if (np == 0 && nf == 0) {
+                    session_ids[n] = frames[n].session_id;
+                } else {
+                    UNSIGNED_LONGS_EQUAL(session_ids[n], frames[n].session_id);
+                }
+            }
+
+            // each frame holds samples of one session, not a mix
+            for (size_t ns = 0; ns < FrameSize; ns++) {
+                DOUBLES_EQUAL((double)test::nth_sample(offset), (double)samples[0][ns],
+                              test::Epsilon);
+                DOUBLES_EQUAL((double)test::nth_sample(offset), (double)samples[1][ns],
+                              test::Epsilon);
+                offset++;
+            }
+        }
+
+        packet_writer1.write_packets(1, SamplesPerPacket, SampleSpecs);
+        packet_writer2.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    CHECK(session_ids[0] != session_ids[1]);
+
+    ReceiverSlotMetrics metrics;
+    slot->get_metrics(metrics);
+
+    UNSIGNED_LONGS_EQUAL(2, metrics.num_sessions);
+    CHECK(metrics.sessions[0].session_id == session_ids[0]
+          || metrics.sessions[0].session_id == session_ids[1]);
+    CHECK(metrics.sessions[1].session_id == session_ids[0]
+          || metrics.sessions[1].session_id == session_ids[1]);
+}
+
+TEST(receiver_source, read_sessions_overflow) {
+    enum { FrameSize = SamplesPerFrame * NumCh };
+
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::PacketWriter packet_writer1(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src1, dst1);
+
+    test::PacketWriter packet_writer2(allocator, *endpoint1_writer, rtp_composer,
+                                      format_map, packet_factory, byte_buffer_factory,
+                                      PayloadType, src2, dst1);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        packet_writer1.write_packets(1, SamplesPerPacket, SampleSpecs);
+        packet_writer2.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    audio::sample_t samples[FrameSize];
+    ReceiverSessionFrame frame;
+    frame.samples = samples;
+
+    uint8_t offset = 0;
+
+    // only one session fits, but both should keep advancing
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            size_t n_frames = 0;
+            CHECK(receiver.read_sessions(&frame, 1, n_frames, FrameSize));
+
+            UNSIGNED_LONGS_EQUAL(1, n_frames);
+            UNSIGNED_LONGS_EQUAL(2, receiver.num_sessions());
+
+            for (size_t ns = 0; ns < FrameSize; ns++) {
+                DOUBLES_EQUAL((double)test::nth_sample(offset), (double)samples[ns],
+                              test::Epsilon);
+                offset++;
+            }
+        }
+
+        packet_writer1.write_packets(1, SamplesPerPacket, SampleSpecs);
+        packet_writer2.write_packets(1, SamplesPerPacket, SampleSpecs);
+    }
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+    frame_reader.set_offset(offset);
+
+    // discarded session is in sync with returned one
+    for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+        frame_reader.read_samples(FrameSize, 2);
+    }
+}
+
+TEST(receiver_source, events) {
+    ReceiverSource receiver(config, format_map, packet_factory, byte_buffer_factory,
+                            sample_buffer_factory, allocator);
+
+    CHECK(receiver.valid());
+
+    EventLog event_log;
+    receiver.set_event_handler(&event_log);
+
+    ReceiverSlot* slot = create_slot(receiver);
+    CHECK(slot);
+
+    packet::IWriter* endpoint1_writer =
+        create_endpoint(slot, address::Iface_AudioSource, proto1);
+    CHECK(endpoint1_writer);
+
+    test::FrameReader frame_reader(receiver, sample_buffer_factory);
+
+    test::PacketWriter packet_writer(allocator, *endpoint1_writer, rtp_composer,
+                                     format_map, packet_factory, byte_buffer_factory,
+                                     PayloadType, src1, dst1);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket - 1; np++) {
+        packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, event_log.n_added);
+        UNSIGNED_LONGS_EQUAL(0, event_log.n_stable);
+        UNSIGNED_LONGS_EQUAL(0, event_log.n_removed);
+    }
+
+    const size_t session_id = event_log.last_id;
+    CHECK(session_id != 0);
+
+    packet_writer.write_packets(1, SamplesPerPacket, SampleSpecs);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+
+        UNSIGNED_LONGS_EQUAL(1, event_log.n_added);
+        UNSIGNED_LONGS_EQUAL(1, event_log.n_stable);
+        UNSIGNED_LONGS_EQUAL(0, event_log.n_removed);
+        UNSIGNED_LONGS_EQUAL(session_id, event_log.last_id);
+    }
+
+    while (receiver.num_sessions() != 0) {
+        frame_reader.skip_zeros(SamplesPerFrame * NumCh);
+    }
+
+    UNSIGNED_LONGS_EQUAL(1, event_log.n_added);
+    UNSIGNED_LONGS_EQUAL(1, event_log.n_stable);
+    UNSIGNED_LONGS_EQUAL(1, event_log.n_removed);
+    UNSIGNED_LONGS_EQUAL(session_id, event_log.last_id);
+}
+
 } // namespace pipeline
 } // namespace roc
@@ -12,6 +12,7 @@
 
 #include "roc_core/buffer_factory.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/time.h"
 #include "roc_packet/packet_factory.h"
 #include "roc_pipeline/sender_loop.h"
 #include "roc_rtp/format_map.h"
@@ -134,5 +135,84 @@ TEST(sender_loop, endpoints_async) {
     scheduler.wait_done();
 }
 
+TEST(sender_loop, write_delay) {
+    enum { FrameSize = 441 * 2 };
+
+    const core::nanoseconds_t frame_length =
+        config.input_sample_spec.samples_overall_2_ns(FrameSize);
+
+    audio::sample_t samples[FrameSize] = {};
+    audio::Frame frame(samples, FrameSize);
+
+    { // without timing, never blocks
+        SenderLoop sender(scheduler, config, format_map, packet_factory,
+                          byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(sender.valid());
+
+        sender.sink().write(frame);
+        CHECK(sender.write_delay() == 0);
+    }
+
+    config.timing = true;
+
+    { // with timing, next frame is due after current one
+        SenderLoop sender(scheduler, config, format_map, packet_factory,
+                          byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(sender.valid());
+
+        CHECK(sender.write_delay() == 0);
+        sender.sink().write(frame);
+
+        const core::nanoseconds_t delay = sender.write_delay();
+        CHECK(delay > 0);
+        CHECK(delay <= frame_length);
+
+        core::sleep_for(core::ClockMonotonic, delay);
+        CHECK(sender.write_delay() == 0);
+    }
+}
+
+TEST(sender_loop, write_frames) {
+    enum { FrameSize = 441 * 2, NumFrames = 3 };
+
+    const core::nanoseconds_t frame_length =
+        config.input_sample_spec.samples_overall_2_ns(FrameSize);
+
+    audio::sample_t samples[FrameSize * NumFrames] = {};
+
+    audio::sample_t* frames[] = {
+        samples,
+        samples + FrameSize,
+        samples + FrameSize * 2,
+    };
+
+    { // without timing, all frames are written in one pipeline entry
+        SenderLoop sender(scheduler, config, format_map, packet_factory,
+                          byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(sender.valid());
+
+        sender.write_frames(frames, NumFrames, FrameSize);
+        CHECK(sender.write_delay() == 0);
+    }
+
+    config.timing = true;
+
+    { // with timing, every frame waits for its deadline
+        SenderLoop sender(scheduler, config, format_map, packet_factory,
+                          byte_buffer_factory, sample_buffer_factory, allocator);
+        CHECK(sender.valid());
+
+        const core::nanoseconds_t start = core::timestamp(core::ClockMonotonic);
+
+        sender.write_frames(frames, NumFrames, FrameSize);
+
+        const core::nanoseconds_t elapsed =
+            core::timestamp(core::ClockMonotonic) - start;
+
+        CHECK(elapsed >= frame_length * (NumFrames - 1));
+        CHECK(sender.write_delay() > 0);
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
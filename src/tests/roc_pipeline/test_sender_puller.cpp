@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "test_helpers/scheduler.h"
+
+#include "roc_core/atomic.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/time.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_pipeline/sender_loop.h"
+#include "roc_pipeline/sender_puller.h"
+#include "roc_rtp/format_map.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+enum { MaxBufSize = 1000, FrameSize = 441 * 2 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<audio::sample_t> sample_buffer_factory(allocator, MaxBufSize, true);
+core::BufferFactory<uint8_t> byte_buffer_factory(allocator, MaxBufSize, true);
+packet::PacketFactory packet_factory(allocator, true);
+
+rtp::FormatMap format_map;
+
+// Counts invocations and asks to stop after given number of frames.
+class CountingCallback : public IFrameCallback {
+public:
+    CountingCallback(size_t max_frames)
+        : max_frames_((int)max_frames)
+        , n_frames_(0)
+        , bad_frame_(false) {
+    }
+
+    size_t num_frames() const {
+        return (size_t)(int)n_frames_;
+    }
+
+    bool bad_frame() const {
+        return bad_frame_;
+    }
+
+    virtual bool fill_frame(audio::Frame& frame) {
+        if (frame.num_samples() != FrameSize) {
+            bad_frame_ = true;
+        }
+        for (size_t n = 0; n < frame.num_samples(); n++) {
+            if (frame.samples()[n] > 0.1f || frame.samples()[n] < -0.1f) {
+                bad_frame_ = true;
+            }
+            frame.samples()[n] = 0.5f;
+        }
+
+        if (max_frames_ != 0 && n_frames_ == max_frames_) {
+            return false;
+        }
+
+        n_frames_++;
+        return true;
+    }
+
+private:
+    const int max_frames_;
+
+    core::Atomic<int> n_frames_;
+    core::Atomic<int> bad_frame_;
+};
+
+} // namespace
+
+TEST_GROUP(sender_puller) {
+    test::Scheduler scheduler;
+
+    SenderConfig config;
+
+    void setup() {
+        config.timing = true;
+    }
+};
+
+TEST(sender_puller, pull_until_stop) {
+    enum { NumFrames = 5 };
+
+    const core::nanoseconds_t frame_length =
+        config.input_sample_spec.samples_overall_2_ns(FrameSize);
+
+    SenderLoop sender(scheduler, config, format_map, packet_factory, byte_buffer_factory,
+                      sample_buffer_factory, allocator);
+    CHECK(sender.valid());
+
+    CountingCallback callback(NumFrames);
+
+    const core::nanoseconds_t start = core::timestamp(core::ClockMonotonic);
+
+    SenderPuller puller(sender, callback, frame_length, allocator);
+    CHECK(puller.valid());
+
+    while (puller.running()) {
+        core::sleep_for(core::ClockMonotonic, core::Millisecond);
+    }
+
+    const core::nanoseconds_t elapsed = core::timestamp(core::ClockMonotonic) - start;
+
+    UNSIGNED_LONGS_EQUAL(NumFrames, callback.num_frames());
+    CHECK(!callback.bad_frame());
+
+    // first frame is pulled immediately, every next one after frame deadline
+    CHECK(elapsed >= (NumFrames - 1) * frame_length);
+}
+
+TEST(sender_puller, stop_on_destroy) {
+    const core::nanoseconds_t frame_length =
+        config.input_sample_spec.samples_overall_2_ns(FrameSize);
+
+    SenderLoop sender(scheduler, config, format_map, packet_factory, byte_buffer_factory,
+                      sample_buffer_factory, allocator);
+    CHECK(sender.valid());
+
+    CountingCallback callback(0);
+
+    {
+        SenderPuller puller(sender, callback, frame_length, allocator);
+        CHECK(puller.valid());
+
+        while (callback.num_frames() < 3) {
+            core::sleep_for(core::ClockMonotonic, core::Millisecond);
+        }
+
+        CHECK(puller.running());
+    }
+
+    const size_t n_frames = callback.num_frames();
+
+    core::sleep_for(core::ClockMonotonic, frame_length * 3);
+
+    UNSIGNED_LONGS_EQUAL(n_frames, callback.num_frames());
+    CHECK(!callback.bad_frame());
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -112,6 +112,47 @@ TEST(sender_sink, write) {
     CHECK(!queue.read());
 }
 
+TEST(sender_sink, impairment_loss) {
+    packet::Queue queue;
+
+    config.impairment.good_loss = 1;
+
+    SenderSink sender(config, format_map, packet_factory, byte_buffer_factory,
+                      sample_buffer_factory, allocator);
+    CHECK(sender.valid());
+
+    SenderSlot* slot = sender.create_slot();
+    CHECK(slot);
+
+    SenderEndpoint* source_endpoint =
+        slot->create_endpoint(address::Iface_AudioSource, source_proto);
+    CHECK(source_endpoint);
+
+    source_endpoint->set_destination_writer(queue);
+    source_endpoint->set_destination_address(dst_addr);
+
+    test::FrameWriter frame_writer(sender, sample_buffer_factory);
+
+    for (size_t nf = 0; nf < ManyFrames; nf++) {
+        frame_writer.write_samples(SamplesPerFrame * NumCh);
+    }
+
+    CHECK(!queue.read());
+}
+
+TEST(sender_sink, impairment_invalid) {
+    config.impairment.duplicate = 2;
+
+    SenderSink sender(config, format_map, packet_factory, byte_buffer_factory,
+                      sample_buffer_factory, allocator);
+    CHECK(sender.valid());
+
+    SenderSlot* slot = sender.create_slot();
+    CHECK(slot);
+
+    CHECK(!slot->create_endpoint(address::Iface_AudioSource, source_proto));
+}
+
 TEST(sender_sink, frame_size_small) {
     enum {
         SamplesPerSmallFrame = SamplesPerFrame / 2,
@@ -190,5 +231,156 @@ TEST(sender_sink, frame_size_large) {
     CHECK(!queue.read());
 }
 
+TEST(sender_sink, match_input_rate) {
+    enum { InputRate = 48000, DynamicPt = 100 };
+
+    const audio::SampleSpec input_spec(InputRate, ChMask);
+
+    rtp::FormatMap dynamic_format_map;
+    CHECK(dynamic_format_map.add_pcm_format(
+        DynamicPt, audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big),
+        input_spec));
+
+    rtp::Parser dynamic_rtp_parser(dynamic_format_map, NULL);
+
+    config.input_sample_spec = input_spec;
+    config.packet_length = SamplesPerPacket * core::Second / InputRate;
+    config.resampling = true;
+    config.match_input_rate = true;
+
+    packet::Queue queue;
+
+    SenderSink sender(config, dynamic_format_map, packet_factory, byte_buffer_factory,
+                      sample_buffer_factory, allocator);
+    CHECK(sender.valid());
+
+    SenderSlot* slot = sender.create_slot();
+    CHECK(slot);
+
+    SenderEndpoint* source_endpoint =
+        slot->create_endpoint(address::Iface_AudioSource, source_proto);
+    CHECK(source_endpoint);
+
+    source_endpoint->set_destination_writer(queue);
+    source_endpoint->set_destination_address(dst_addr);
+
+    test::FrameWriter frame_writer(sender, sample_buffer_factory);
+
+    for (size_t nf = 0; nf < ManyFrames; nf++) {
+        frame_writer.write_samples(SamplesPerFrame * NumCh);
+    }
+
+    // samples are packetized as is, without resampling
+    test::PacketReader packet_reader(allocator, queue, dynamic_rtp_parser,
+                                     dynamic_format_map, packet_factory,
+                                     (rtp::PayloadType)DynamicPt, dst_addr);
+
+    for (size_t np = 0; np < ManyFrames / FramesPerPacket; np++) {
+        packet_reader.read_packet(SamplesPerPacket, input_spec);
+    }
+
+    CHECK(!queue.read());
+}
+
+TEST(sender_sink, zeros_many_slots) {
+    enum { NumSlots = 3 };
+
+    packet::Queue queues[NumSlots];
+
+    SenderSink sender(config, format_map, packet_factory, byte_buffer_factory,
+                      sample_buffer_factory, allocator);
+    CHECK(sender.valid());
+
+    for (size_t ns = 0; ns < NumSlots; ns++) {
+        SenderSlot* slot = sender.create_slot();
+        CHECK(slot);
+
+        SenderEndpoint* source_endpoint =
+            slot->create_endpoint(address::Iface_AudioSource, source_proto);
+        CHECK(source_endpoint);
+
+        source_endpoint->set_destination_writer(queues[ns]);
+        source_endpoint->set_destination_address(dst_addr);
+    }
+
+    for (size_t nf = 0; nf < ManyFrames; nf++) {
+        core::Slice<audio::sample_t> samples = sample_buffer_factory.new_buffer();
+        CHECK(samples);
+        samples.reslice(0, SamplesPerFrame * NumCh);
+
+        for (size_t n = 0; n < samples.size(); n++) {
+            samples.data()[n] = 0;
+        }
+
+        audio::Frame frame(samples.data(), samples.size());
+        sender.write(frame);
+
+        CHECK(frame.flags() & audio::Frame::FlagZeros);
+    }
+
+    test::FrameWriter frame_writer(sender, sample_buffer_factory);
+
+    for (size_t nf = 0; nf < ManyFrames; nf++) {
+        frame_writer.write_samples(SamplesPerFrame * NumCh);
+    }
+
+    for (size_t ns = 0; ns < NumSlots; ns++) {
+        for (size_t np = 0; np < ManyFrames / FramesPerPacket; np++) {
+            packet::PacketPtr pp = queues[ns].read();
+            CHECK(pp);
+            CHECK(pp->flags() & packet::Packet::FlagZeros);
+        }
+
+        for (size_t np = 0; np < ManyFrames / FramesPerPacket; np++) {
+            packet::PacketPtr pp = queues[ns].read();
+            CHECK(pp);
+            CHECK(!(pp->flags() & packet::Packet::FlagZeros));
+        }
+
+        CHECK(!queues[ns].read());
+    }
+}
+
+TEST(sender_sink, worker_threads_many_slots) {
+    enum { NumThreads = 3, NumSlots = 8 };
+
+    config.worker_threads = NumThreads;
+
+    packet::Queue queues[NumSlots];
+
+    SenderSink sender(config, format_map, packet_factory, byte_buffer_factory,
+                      sample_buffer_factory, allocator);
+    CHECK(sender.valid());
+
+    for (size_t ns = 0; ns < NumSlots; ns++) {
+        SenderSlot* slot = sender.create_slot();
+        CHECK(slot);
+
+        SenderEndpoint* source_endpoint =
+            slot->create_endpoint(address::Iface_AudioSource, source_proto);
+        CHECK(source_endpoint);
+
+        source_endpoint->set_destination_writer(queues[ns]);
+        source_endpoint->set_destination_address(dst_addr);
+    }
+
+    test::FrameWriter frame_writer(sender, sample_buffer_factory);
+
+    for (size_t nf = 0; nf < ManyFrames; nf++) {
+        frame_writer.write_samples(SamplesPerFrame * NumCh);
+    }
+
+    for (size_t ns = 0; ns < NumSlots; ns++) {
+        test::PacketReader packet_reader(allocator, queues[ns], rtp_parser, format_map,
+                                         packet_factory, PayloadType, dst_addr);
+
+        for (size_t np = 0; np < ManyFrames / FramesPerPacket; np++) {
+            packet_reader.read_packet(SamplesPerPacket, SampleSpecs);
+        }
+
+        CHECK(!queues[ns].read());
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
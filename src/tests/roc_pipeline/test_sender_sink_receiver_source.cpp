@@ -20,6 +20,7 @@
 #include "roc_pipeline/receiver_source.h"
 #include "roc_pipeline/sender_sink.h"
 #include "roc_rtp/format_map.h"
+#include "roc_rtp/srtp_config.h"
 
 namespace roc {
 namespace pipeline {
@@ -71,9 +72,34 @@ enum {
     FlagReedSolomon = (1 << 4),
 
     // enable LDPC-Staircase FEC scheme on sender
-    FlagLDPC = (1 << 5)
+    FlagLDPC = (1 << 5),
+
+    // enable sliding window RLC FEC scheme on sender
+    FlagRLC = (1 << 6),
+
+    // encode Reed-Solomon FEC blocks using batch encoder on sender
+    FlagBatchFec = (1 << 7),
+
+    // combine packets into multiplexed datagrams
+    FlagMultiplexing = (1 << 8),
+
+    // duplicate every received packet using impairer
+    FlagDuplicates = (1 << 9),
+
+    // enable srtp
+    FlagSRTP = (1 << 10)
 };
 
+rtp::SrtpConfig srtp_config(int flags) {
+    rtp::SrtpConfig config;
+
+    if (flags & FlagSRTP) {
+        CHECK(rtp::parse_srtp_key("4fl6DT4Bi+DWT6MsBt5BOQ7Gda1Jiv7rtpYLOqvm", config));
+    }
+
+    return config;
+}
+
 core::HeapAllocator allocator;
 core::BufferFactory<audio::sample_t> sample_buffer_factory(allocator, MaxBufSize, true);
 core::BufferFactory<uint8_t> byte_buffer_factory(allocator, MaxBufSize, true);
@@ -95,10 +121,16 @@ SenderConfig sender_config(int flags) {
         config.fec_encoder.scheme = packet::FEC_LDPC_Staircase;
     }
 
+    if (flags & FlagRLC) {
+        config.fec_encoder.scheme = packet::FEC_RLC;
+    }
+
     config.fec_writer.n_source_packets = SourcePackets;
     config.fec_writer.n_repair_packets = RepairPackets;
 
     config.interleaving = (flags & FlagInterleaving);
+    config.multiplexed_packet_size = (flags & FlagMultiplexing) ? MaxBufSize : 0;
+    config.srtp = srtp_config(flags);
     config.timing = false;
     config.poisoning = true;
     config.profiling = true;
@@ -106,7 +138,7 @@ SenderConfig sender_config(int flags) {
     return config;
 }
 
-ReceiverConfig receiver_config() {
+ReceiverConfig receiver_config(int flags) {
     ReceiverConfig config;
 
     config.common.output_sample_spec = audio::SampleSpec(SampleRate, ChMask);
@@ -115,6 +147,9 @@ ReceiverConfig receiver_config() {
     config.common.resampling = false;
     config.common.timing = false;
     config.common.poisoning = true;
+    config.common.multiplexing = (flags & FlagMultiplexing);
+    config.common.impairment.duplicate = (flags & FlagDuplicates) ? 1 : 0;
+    config.common.srtp = srtp_config(flags);
 
     config.default_session.target_latency = Latency * core::Second / SampleRate;
     config.default_session.watchdog.no_playback_timeout =
@@ -130,6 +165,9 @@ address::Protocol select_source_proto(int flags) {
     if (flags & FlagLDPC) {
         return address::Proto_RTP_LDPC_Source;
     }
+    if (flags & FlagRLC) {
+        return address::Proto_RTP_RLC_Source;
+    }
     return address::Proto_RTP;
 }
 
@@ -140,6 +178,9 @@ address::Protocol select_repair_proto(int flags) {
     if (flags & FlagLDPC) {
         return address::Proto_LDPC_Repair;
     }
+    if (flags & FlagRLC) {
+        return address::Proto_RLC_Repair;
+    }
     return address::Proto_None;
 }
 
@@ -150,6 +191,9 @@ bool is_fec_supported(int flags) {
     if (flags & FlagLDPC) {
         return fec::CodecMap::instance().is_supported(packet::FEC_LDPC_Staircase);
     }
+    if (flags & FlagRLC) {
+        return fec::CodecMap::instance().is_supported(packet::FEC_RLC);
+    }
     return true;
 }
 
@@ -184,8 +228,11 @@ void send_receive(int flags, size_t num_sessions) {
     address::SocketAddr receiver_source_addr = test::new_address(11);
     address::SocketAddr receiver_repair_addr = test::new_address(22);
 
+    fec::BatchEncoder batch_encoder(allocator);
+
     SenderSink sender(sender_config(flags), format_map, packet_factory,
-                      byte_buffer_factory, sample_buffer_factory, allocator);
+                      byte_buffer_factory, sample_buffer_factory, allocator,
+                      (flags & FlagBatchFec) ? &batch_encoder : NULL);
 
     CHECK(sender.valid());
 
@@ -211,7 +258,7 @@ void send_receive(int flags, size_t num_sessions) {
         sender_repair_endpoint->set_destination_address(receiver_repair_addr);
     }
 
-    ReceiverSource receiver(receiver_config(), format_map, packet_factory,
+    ReceiverSource receiver(receiver_config(flags), format_map, packet_factory,
                             byte_buffer_factory, sample_buffer_factory, allocator);
 
     CHECK(receiver.valid());
@@ -287,6 +334,18 @@ TEST(sender_sink_receiver_source, fec_ldpc) {
     }
 }
 
+TEST(sender_sink_receiver_source, fec_rlc) {
+    if (is_fec_supported(FlagRLC)) {
+        send_receive(FlagRLC, 1);
+    }
+}
+
+TEST(sender_sink_receiver_source, fec_rlc_loss) {
+    if (is_fec_supported(FlagRLC)) {
+        send_receive(FlagRLC | FlagLosses, 1);
+    }
+}
+
 TEST(sender_sink_receiver_source, fec_interleaving) {
     if (is_fec_supported(FlagReedSolomon)) {
         send_receive(FlagReedSolomon | FlagInterleaving, 1);
@@ -299,6 +358,18 @@ TEST(sender_sink_receiver_source, fec_loss) {
     }
 }
 
+TEST(sender_sink_receiver_source, fec_batch_loss) {
+    if (is_fec_supported(FlagReedSolomon)) {
+        send_receive(FlagReedSolomon | FlagBatchFec | FlagLosses, 1);
+    }
+}
+
+TEST(sender_sink_receiver_source, fec_batch_interleaving) {
+    if (is_fec_supported(FlagReedSolomon)) {
+        send_receive(FlagReedSolomon | FlagBatchFec | FlagInterleaving, 1);
+    }
+}
+
 TEST(sender_sink_receiver_source, fec_drop_source) {
     if (is_fec_supported(FlagReedSolomon)) {
         send_receive(FlagReedSolomon | FlagDropSource, 0);
@@ -311,5 +382,45 @@ TEST(sender_sink_receiver_source, fec_drop_repair) {
     }
 }
 
+TEST(sender_sink_receiver_source, multiplexing) {
+    send_receive(FlagMultiplexing, 1);
+}
+
+TEST(sender_sink_receiver_source, fec_multiplexing) {
+    if (is_fec_supported(FlagReedSolomon)) {
+        send_receive(FlagReedSolomon | FlagMultiplexing, 1);
+    }
+}
+
+TEST(sender_sink_receiver_source, duplicates) {
+    send_receive(FlagDuplicates, 1);
+}
+
+TEST(sender_sink_receiver_source, fec_duplicates) {
+    if (is_fec_supported(FlagReedSolomon)) {
+        send_receive(FlagReedSolomon | FlagDuplicates, 1);
+    }
+}
+
+#ifdef ROC_TARGET_OPENSSL
+
+TEST(sender_sink_receiver_source, srtp) {
+    send_receive(FlagSRTP, 1);
+}
+
+TEST(sender_sink_receiver_source, srtp_interleaving) {
+    send_receive(FlagSRTP | FlagInterleaving, 1);
+}
+
+TEST(sender_sink_receiver_source, srtp_multiplexing) {
+    send_receive(FlagSRTP | FlagMultiplexing, 1);
+}
+
+TEST(sender_sink_receiver_source, srtp_duplicates) {
+    send_receive(FlagSRTP | FlagDuplicates, 1);
+}
+
+#endif // ROC_TARGET_OPENSSL
+
 } // namespace pipeline
 } // namespace roc
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/temp_file.h"
+#include "roc_pipeline/session_state_store.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+const double Epsilon = 1e-9;
+
+audio::LatencyMonitorState make_state(float drift) {
+    audio::LatencyMonitorState state;
+    state.drift = drift;
+    state.scaling = 1 + drift;
+    state.target_latency = 100 * core::Millisecond;
+    return state;
+}
+
+void expect_state(const SessionStateStore& store,
+                  packet::source_t ssrc,
+                  const char* cname,
+                  float drift) {
+    audio::LatencyMonitorState state;
+    CHECK(store.find(ssrc, cname, state));
+
+    DOUBLES_EQUAL((double)drift, (double)state.drift, Epsilon);
+    DOUBLES_EQUAL((double)(1 + drift), (double)state.scaling, Epsilon);
+    CHECK(state.target_latency == 100 * core::Millisecond);
+}
+
+} // namespace
+
+TEST_GROUP(session_state_store) {};
+
+TEST(session_state_store, empty) {
+    SessionStateStore store;
+
+    UNSIGNED_LONGS_EQUAL(0, store.num_entries());
+
+    audio::LatencyMonitorState state;
+    CHECK(!store.find(1, "", state));
+    CHECK(!store.find(1, "cname", state));
+}
+
+TEST(session_state_store, find_by_ssrc) {
+    SessionStateStore store;
+
+    store.update(1, "", make_state(0.001f));
+    store.update(2, "", make_state(0.002f));
+
+    UNSIGNED_LONGS_EQUAL(2, store.num_entries());
+
+    expect_state(store, 1, "", 0.001f);
+    expect_state(store, 2, "", 0.002f);
+
+    audio::LatencyMonitorState state;
+    CHECK(!store.find(3, "", state));
+}
+
+TEST(session_state_store, find_by_cname) {
+    SessionStateStore store;
+
+    store.update(1, "alice", make_state(0.001f));
+    store.update(2, "bob", make_state(0.002f));
+
+    // same ssrc, cname not known yet
+    expect_state(store, 1, "", 0.001f);
+
+    // sender restarted with new ssrc
+    expect_state(store, 10, "bob", 0.002f);
+
+    // ssrc collision with another sender
+    audio::LatencyMonitorState state;
+    CHECK(!store.find(1, "carol", state));
+}
+
+TEST(session_state_store, update) {
+    SessionStateStore store;
+
+    store.update(1, "alice", make_state(0.001f));
+    store.update(1, "", make_state(0.003f));
+
+    UNSIGNED_LONGS_EQUAL(1, store.num_entries());
+
+    // cname is kept
+    expect_state(store, 5, "alice", 0.003f);
+}
+
+TEST(session_state_store, evict_oldest) {
+    SessionStateStore store;
+
+    for (size_t n = 0; n < SessionStateStore::MaxEntries; n++) {
+        store.update((packet::source_t)n, "", make_state(0.001f));
+    }
+
+    // refresh first entry, so that second one becomes the oldest
+    store.update(0, "", make_state(0.002f));
+
+    store.update(1000, "", make_state(0.003f));
+
+    UNSIGNED_LONGS_EQUAL(SessionStateStore::MaxEntries, store.num_entries());
+
+    audio::LatencyMonitorState state;
+    CHECK(!store.find(1, "", state));
+
+    expect_state(store, 0, "", 0.002f);
+    expect_state(store, 1000, "", 0.003f);
+}
+
+TEST(session_state_store, save_load) {
+    core::TempFile file("state.txt");
+
+    {
+        SessionStateStore store;
+
+        store.update(1, "alice@example.com", make_state(0.00012345f));
+        store.update(2, "", make_state(-0.0005f));
+
+        CHECK(store.save(file.path()));
+    }
+
+    {
+        SessionStateStore store;
+
+        CHECK(store.load(file.path()));
+        UNSIGNED_LONGS_EQUAL(2, store.num_entries());
+
+        expect_state(store, 1, "", 0.00012345f);
+        expect_state(store, 7, "alice@example.com", 0.00012345f);
+        expect_state(store, 2, "", -0.0005f);
+    }
+}
+
+TEST(session_state_store, load_missing) {
+    core::TempFile file("state.txt");
+
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s.missing", file.path());
+
+    SessionStateStore store;
+    store.update(1, "", make_state(0.001f));
+
+    CHECK(store.load(path));
+    UNSIGNED_LONGS_EQUAL(0, store.num_entries());
+}
+
+TEST(session_state_store, load_malformed) {
+    core::TempFile file("state.txt");
+
+    FILE* fp = fopen(file.path(), "w");
+    CHECK(fp);
+    fprintf(fp, "# comment\n"
+                "\n"
+                "garbage\n"
+                "1 0.001 0 100000000 zero_scaling\n"
+                "2 0.002 1.002 100000000 bob\n");
+    fclose(fp);
+
+    SessionStateStore store;
+
+    CHECK(store.load(file.path()));
+    UNSIGNED_LONGS_EQUAL(1, store.num_entries());
+
+    expect_state(store, 2, "bob", 0.002f);
+}
+
+} // namespace pipeline
+} // namespace roc
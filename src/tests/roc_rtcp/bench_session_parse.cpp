@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/panic.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_rtcp/composer.h"
+#include "roc_rtcp/session.h"
+
+// RTCP receive path throughput, in processed compound packets per second.
+//
+// ReceiverReport benchmark processes a report from receiver with given number
+// of sources (the argument) on sender side: RR blocks, XR blocks and SDES.
+// SenderReport benchmark processes a report from sender with given number
+// of sources on receiver side: SR and SDES with CNAME items.
+
+namespace roc {
+namespace rtcp {
+namespace {
+
+enum { MaxBufSize = 4096, Source = 100 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBufSize, false);
+packet::PacketFactory packet_factory(allocator, false);
+
+class BenchReceiverHooks : public IReceiverHooks {
+public:
+    BenchReceiverHooks(size_t num_sources)
+        : num_sources_(num_sources) {
+    }
+
+    virtual void on_update_source(packet::source_t, const char* cname) {
+        benchmark::DoNotOptimize(cname);
+    }
+
+    virtual void on_remove_source(packet::source_t) {
+    }
+
+    virtual size_t on_get_num_sources() {
+        return num_sources_;
+    }
+
+    virtual ReceptionMetrics on_get_reception_metrics(size_t source_index) {
+        ReceptionMetrics metrics;
+        metrics.ssrc = packet::source_t(Source + source_index);
+        metrics.ext_last_seqnum = 1000;
+        metrics.ext_first_seqnum = 900;
+        metrics.n_loss_runs = 3;
+        metrics.loss_runs[0] = 50;
+        metrics.loss_runs[1] = 2;
+        metrics.loss_runs[2] = 49;
+        return metrics;
+    }
+
+    virtual void on_add_sending_metrics(const SendingMetrics& metrics) {
+        benchmark::DoNotOptimize(metrics);
+    }
+
+    virtual void on_add_link_metrics(const LinkMetrics& metrics) {
+        benchmark::DoNotOptimize(metrics);
+    }
+
+private:
+    size_t num_sources_;
+};
+
+class BenchSenderHooks : public ISenderHooks {
+public:
+    BenchSenderHooks(size_t num_sources)
+        : num_sources_(num_sources) {
+    }
+
+    virtual size_t on_get_num_sources() {
+        return num_sources_;
+    }
+
+    virtual packet::source_t on_get_sending_source(size_t source_index) {
+        return packet::source_t(Source + source_index);
+    }
+
+    virtual SendingMetrics on_get_sending_metrics(packet::ntp_timestamp_t report_time) {
+        SendingMetrics metrics;
+        metrics.origin_ntp = report_time;
+        return metrics;
+    }
+
+    virtual void on_add_reception_metrics(const ReceptionMetrics& metrics) {
+        benchmark::DoNotOptimize(metrics);
+    }
+
+    virtual void on_add_link_metrics(const LinkMetrics& metrics) {
+        benchmark::DoNotOptimize(metrics);
+    }
+
+private:
+    size_t num_sources_;
+};
+
+void BM_Session_ParseReceiverReport(benchmark::State& state) {
+    const size_t num_sources = (size_t)state.range(0);
+
+    Composer composer;
+
+    BenchReceiverHooks recv_hooks(num_sources);
+    packet::Queue recv_queue;
+    Session recv_session(SessionConfig(), &recv_hooks, NULL, &recv_queue, composer,
+                         packet_factory, buffer_factory);
+
+    BenchSenderHooks send_hooks(1);
+    packet::Queue send_queue;
+    Session send_session(SessionConfig(), NULL, &send_hooks, &send_queue, composer,
+                         packet_factory, buffer_factory);
+
+    recv_session.generate_packets();
+    packet::PacketPtr pp = recv_queue.read();
+    roc_panic_if_not(pp);
+
+    while (state.KeepRunning()) {
+        send_session.process_packet(pp);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_Session_ParseReceiverReport)->Arg(1)->Arg(8)->Arg(31)->Arg(100);
+
+void BM_Session_ParseSenderReport(benchmark::State& state) {
+    const size_t num_sources = (size_t)state.range(0);
+
+    Composer composer;
+
+    BenchSenderHooks send_hooks(num_sources);
+    packet::Queue send_queue;
+    Session send_session(SessionConfig(), NULL, &send_hooks, &send_queue, composer,
+                         packet_factory, buffer_factory);
+
+    BenchReceiverHooks recv_hooks(0);
+    packet::Queue recv_queue;
+    Session recv_session(SessionConfig(), &recv_hooks, NULL, &recv_queue, composer,
+                         packet_factory, buffer_factory);
+
+    send_session.generate_packets();
+    packet::PacketPtr pp = send_queue.read();
+    roc_panic_if_not(pp);
+
+    while (state.KeepRunning()) {
+        recv_session.process_packet(pp);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_Session_ParseSenderReport)->Arg(1)->Arg(8)->Arg(31);
+
+} // namespace
+} // namespace rtcp
+} // namespace roc
@@ -41,6 +41,22 @@ core::Slice<uint8_t> new_buffer(const uint8_t* data, size_t datasz) {
 
 TEST_GROUP(rtcp) {};
 
+TEST(rtcp, reception_block_fract_loss) {
+    header::ReceptionReportBlock blk;
+
+    blk.set_fract_loss(0, 100);
+    DOUBLES_EQUAL(0.0, blk.fract_loss(), 1e-8);
+
+    blk.set_fract_loss(1, 8);
+    DOUBLES_EQUAL(0.125, blk.fract_loss(), 1e-8);
+
+    blk.set_fract_loss(1, 2);
+    DOUBLES_EQUAL(0.5, blk.fract_loss(), 1e-8);
+
+    blk.set_fract_loss(10, 10);
+    DOUBLES_EQUAL(255.0 / 256.0, blk.fract_loss(), 1e-8);
+}
+
 TEST(rtcp, loopback_sr_sdes) {
     core::Slice<uint8_t> buff = new_buffer(NULL, 0).subslice(0, 0);
     Builder builder(buff);
@@ -393,6 +409,95 @@ TEST(rtcp, loopback_rr_sdes_xr) {
     CHECK_EQUAL(Traverser::Iterator::END, it.next());
 }
 
+TEST(rtcp, loopback_xr_loss_rle_stat_summary) {
+    core::Slice<uint8_t> buff = new_buffer(NULL, 0).subslice(0, 0);
+    Builder builder(buff);
+
+    header::ReceiverReportPacket rr;
+    rr.set_ssrc(1);
+
+    header::XrPacket xr;
+    xr.set_ssrc(1);
+
+    header::XrLossRleBlock loss_rle;
+    loss_rle.set_ssrc(222);
+    loss_rle.set_begin_seq(100);
+    loss_rle.set_end_seq(110);
+
+    header::XrLossRleChunk chunks[3];
+    chunks[0].set_run(true, 5);
+    chunks[1].set_run(false, 2);
+    chunks[2].set_run(true, 3);
+
+    header::XrStatSummaryBlock stat_summary;
+    stat_summary.set_ssrc(222);
+    stat_summary.set_begin_seq(100);
+    stat_summary.set_end_seq(110);
+    stat_summary.set_lost_packets(2);
+    stat_summary.set_dup_packets(4);
+
+    // Synthesize part
+
+    builder.begin_rr(rr);
+    builder.end_rr();
+
+    builder.begin_xr(xr);
+    builder.begin_xr_loss_rle(loss_rle);
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(chunks); n++) {
+        builder.add_xr_loss_rle_chunk(chunks[n]);
+    }
+    builder.end_xr_loss_rle();
+    builder.add_xr_stat_summary(stat_summary);
+    builder.end_xr();
+
+    // Parsing part
+
+    Traverser parser(buff);
+    CHECK(parser.parse());
+
+    Traverser::Iterator it = parser.iter();
+    CHECK_EQUAL(Traverser::Iterator::RR, it.next());
+    CHECK_EQUAL(Traverser::Iterator::XR, it.next());
+
+    XrTraverser xr_tr = it.get_xr();
+    CHECK(xr_tr.parse());
+    UNSIGNED_LONGS_EQUAL(2, xr_tr.blocks_count());
+
+    XrTraverser::Iterator xr_it = xr_tr.iter();
+
+    CHECK_EQUAL(XrTraverser::Iterator::LOSS_RLE_BLOCK, xr_it.next());
+    const header::XrLossRleBlock& ploss_rle = xr_it.get_loss_rle();
+
+    // odd number of chunks is padded with null chunk
+    CHECK_EQUAL(0, ploss_rle.header().len_bytes() % 4);
+    UNSIGNED_LONGS_EQUAL(4, ploss_rle.num_chunks());
+    UNSIGNED_LONGS_EQUAL(222, ploss_rle.ssrc());
+    UNSIGNED_LONGS_EQUAL(100, ploss_rle.begin_seq());
+    UNSIGNED_LONGS_EQUAL(110, ploss_rle.end_seq());
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(chunks); n++) {
+        CHECK(!ploss_rle.get_chunk(n).is_null());
+        CHECK(!ploss_rle.get_chunk(n).is_bit_vector());
+        CHECK_EQUAL(chunks[n].run_received(), ploss_rle.get_chunk(n).run_received());
+        UNSIGNED_LONGS_EQUAL(chunks[n].run_length(), ploss_rle.get_chunk(n).run_length());
+    }
+    CHECK(ploss_rle.get_chunk(3).is_null());
+
+    CHECK_EQUAL(XrTraverser::Iterator::STAT_SUMMARY_BLOCK, xr_it.next());
+    const header::XrStatSummaryBlock& pstat_summary = xr_it.get_stat_summary();
+
+    UNSIGNED_LONGS_EQUAL(222, pstat_summary.ssrc());
+    UNSIGNED_LONGS_EQUAL(100, pstat_summary.begin_seq());
+    UNSIGNED_LONGS_EQUAL(110, pstat_summary.end_seq());
+    CHECK(pstat_summary.has_loss());
+    CHECK(pstat_summary.has_dup());
+    CHECK(!pstat_summary.has_jitter());
+    UNSIGNED_LONGS_EQUAL(2, pstat_summary.lost_packets());
+    UNSIGNED_LONGS_EQUAL(4, pstat_summary.dup_packets());
+
+    CHECK_EQUAL(XrTraverser::Iterator::END, xr_it.next());
+    CHECK_EQUAL(Traverser::Iterator::END, it.next());
+}
+
 // Check bye.
 TEST(rtcp, loopback_bye) {
     core::Slice<uint8_t> buff = new_buffer(NULL, 0).subslice(0, 0);
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_rtcp/composer.h"
+#include "roc_rtcp/session.h"
+
+namespace roc {
+namespace rtcp {
+
+namespace {
+
+enum { MaxBufSize = 1492, SmallBufSize = 300, Source = 123, ManySources = 40 };
+
+const uint16_t LossRuns[] = { 5, 2, 3, 1, 4 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBufSize, true);
+core::BufferFactory<uint8_t> small_buffer_factory(allocator, SmallBufSize, true);
+packet::PacketFactory packet_factory(allocator, true);
+
+class TestReceiverHooks : public IReceiverHooks {
+public:
+    TestReceiverHooks(size_t num_sources = 1)
+        : n_link_metrics(0)
+        , num_sources_(num_sources) {
+    }
+
+    virtual void on_update_source(packet::source_t, const char*) {
+    }
+
+    virtual void on_remove_source(packet::source_t) {
+    }
+
+    virtual size_t on_get_num_sources() {
+        return num_sources_;
+    }
+
+    virtual ReceptionMetrics on_get_reception_metrics(size_t source_index) {
+        CHECK(source_index < num_sources_);
+
+        ReceptionMetrics metrics;
+        metrics.ssrc = packet::source_t(Source + source_index);
+        metrics.ext_first_seqnum = 65530;
+        metrics.ext_last_seqnum = 65530 + 15 - 1;
+        metrics.cum_loss = 3;
+        metrics.n_loss_runs = ROC_ARRAY_SIZE(LossRuns);
+        memcpy(metrics.loss_runs, LossRuns, sizeof(LossRuns));
+        metrics.dup_packets = 7;
+
+        return metrics;
+    }
+
+    virtual void on_add_sending_metrics(const SendingMetrics&) {
+    }
+
+    virtual void on_add_link_metrics(const LinkMetrics& metrics) {
+        n_link_metrics++;
+        link_metrics = metrics;
+    }
+
+    size_t n_link_metrics;
+    LinkMetrics link_metrics;
+
+private:
+    size_t num_sources_;
+};
+
+class TestSenderHooks : public ISenderHooks {
+public:
+    TestSenderHooks()
+        : n_reception_metrics(0)
+        , n_link_metrics(0) {
+        memset(source_reported, 0, sizeof(source_reported));
+    }
+
+    virtual size_t on_get_num_sources() {
+        return 1;
+    }
+
+    virtual packet::source_t on_get_sending_source(size_t) {
+        return Source;
+    }
+
+    virtual SendingMetrics on_get_sending_metrics(packet::ntp_timestamp_t report_time) {
+        SendingMetrics metrics;
+        metrics.origin_ntp = report_time;
+        return metrics;
+    }
+
+    virtual void on_add_reception_metrics(const ReceptionMetrics& metrics) {
+        n_reception_metrics++;
+        reception_metrics = metrics;
+
+        CHECK(metrics.ssrc >= Source && metrics.ssrc < Source + ManySources);
+        source_reported[metrics.ssrc - Source] = true;
+    }
+
+    virtual void on_add_link_metrics(const LinkMetrics& metrics) {
+        n_link_metrics++;
+        link_metrics = metrics;
+    }
+
+    size_t n_reception_metrics;
+    ReceptionMetrics reception_metrics;
+    bool source_reported[ManySources];
+
+    size_t n_link_metrics;
+    LinkMetrics link_metrics;
+};
+
+void deliver(Session& from, packet::Queue& from_queue, Session& to) {
+    from.generate_packets();
+
+    packet::PacketPtr pp = from_queue.read();
+    CHECK(pp);
+    CHECK(!from_queue.read());
+
+    to.process_packet(pp);
+}
+
+} // namespace
+
+TEST_GROUP(session) {};
+
+TEST(session, xr_loss_runs) {
+    Composer composer;
+
+    TestReceiverHooks recv_hooks;
+    packet::Queue recv_queue;
+    Session recv_session(SessionConfig(), &recv_hooks, NULL, &recv_queue, composer,
+                         packet_factory, buffer_factory);
+    CHECK(recv_session.valid());
+
+    TestSenderHooks send_hooks;
+    packet::Queue send_queue;
+    Session send_session(SessionConfig(), NULL, &send_hooks, &send_queue, composer,
+                         packet_factory, buffer_factory);
+    CHECK(send_session.valid());
+
+    deliver(recv_session, recv_queue, send_session);
+
+    UNSIGNED_LONGS_EQUAL(1, send_hooks.n_reception_metrics);
+
+    const ReceptionMetrics& metrics = send_hooks.reception_metrics;
+
+    UNSIGNED_LONGS_EQUAL(Source, metrics.ssrc);
+    UNSIGNED_LONGS_EQUAL(65530 + 15 - 1, metrics.ext_last_seqnum);
+    // extended seqnum is restored from reception block despite wrap
+    UNSIGNED_LONGS_EQUAL(65530, metrics.ext_first_seqnum);
+    UNSIGNED_LONGS_EQUAL(ROC_ARRAY_SIZE(LossRuns), metrics.n_loss_runs);
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(LossRuns); n++) {
+        UNSIGNED_LONGS_EQUAL(LossRuns[n], metrics.loss_runs[n]);
+    }
+    UNSIGNED_LONGS_EQUAL(7, metrics.dup_packets);
+}
+
+TEST(session, xr_round_trip_time) {
+    Composer composer;
+
+    TestReceiverHooks recv_hooks;
+    packet::Queue recv_queue;
+    Session recv_session(SessionConfig(), &recv_hooks, NULL, &recv_queue, composer,
+                         packet_factory, buffer_factory);
+    CHECK(recv_session.valid());
+
+    TestSenderHooks send_hooks;
+    packet::Queue send_queue;
+    Session send_session(SessionConfig(), NULL, &send_hooks, &send_queue, composer,
+                         packet_factory, buffer_factory);
+    CHECK(send_session.valid());
+
+    // receiver sends RRTR
+    deliver(recv_session, recv_queue, send_session);
+    UNSIGNED_LONGS_EQUAL(0, send_hooks.n_link_metrics);
+    UNSIGNED_LONGS_EQUAL(0, recv_hooks.n_link_metrics);
+
+    // sender replies with DLRR and sends own RRTR
+    deliver(send_session, send_queue, recv_session);
+    UNSIGNED_LONGS_EQUAL(0, send_hooks.n_link_metrics);
+    UNSIGNED_LONGS_EQUAL(1, recv_hooks.n_link_metrics);
+
+    CHECK(recv_hooks.link_metrics.rtt >= 0);
+    CHECK(recv_hooks.link_metrics.rtt < core::Second);
+
+    // receiver replies with DLRR
+    deliver(recv_session, recv_queue, send_session);
+    UNSIGNED_LONGS_EQUAL(1, send_hooks.n_link_metrics);
+    UNSIGNED_LONGS_EQUAL(1, recv_hooks.n_link_metrics);
+
+    CHECK(send_hooks.link_metrics.rtt >= 0);
+    CHECK(send_hooks.link_metrics.rtt < core::Second);
+}
+
+TEST(session, many_sources) {
+    Composer composer;
+
+    TestReceiverHooks recv_hooks(ManySources);
+    packet::Queue recv_queue;
+    Session recv_session(SessionConfig(), &recv_hooks, NULL, &recv_queue, composer,
+                         packet_factory, buffer_factory);
+    CHECK(recv_session.valid());
+
+    TestSenderHooks send_hooks;
+    packet::Queue send_queue;
+    Session send_session(SessionConfig(), NULL, &send_hooks, &send_queue, composer,
+                         packet_factory, buffer_factory);
+    CHECK(send_session.valid());
+
+    // more than 31 sources are reported using two RR packets in one compound packet
+    deliver(recv_session, recv_queue, send_session);
+
+    UNSIGNED_LONGS_EQUAL(ManySources, send_hooks.n_reception_metrics);
+    for (size_t n = 0; n < ManySources; n++) {
+        CHECK(send_hooks.source_reported[n]);
+    }
+}
+
+TEST(session, sources_rotation) {
+    Composer composer;
+
+    TestReceiverHooks recv_hooks(ManySources);
+    packet::Queue recv_queue;
+    Session recv_session(SessionConfig(), &recv_hooks, NULL, &recv_queue, composer,
+                         packet_factory, small_buffer_factory);
+    CHECK(recv_session.valid());
+
+    TestSenderHooks send_hooks;
+    packet::Queue send_queue;
+    Session send_session(SessionConfig(), NULL, &send_hooks, &send_queue, composer,
+                         packet_factory, buffer_factory);
+    CHECK(send_session.valid());
+
+    // sources don't fit into small packet
+    deliver(recv_session, recv_queue, send_session);
+
+    const size_t n_per_report = send_hooks.n_reception_metrics;
+    CHECK(n_per_report > 0);
+    CHECK(n_per_report < ManySources);
+
+    // subsequent reports cover remaining sources
+    while (send_hooks.n_reception_metrics < ManySources) {
+        deliver(recv_session, recv_queue, send_session);
+    }
+
+    for (size_t n = 0; n < ManySources; n++) {
+        CHECK(send_hooks.source_reported[n]);
+    }
+}
+
+TEST(session, interval_scaling) {
+    Composer composer;
+
+    SessionConfig config;
+    config.min_report_interval = 100 * core::Millisecond;
+    config.report_bandwidth = 10000;
+
+    for (size_t num_sources = 1; num_sources <= ManySources; num_sources *= 40) {
+        TestReceiverHooks recv_hooks(num_sources);
+        packet::Queue recv_queue;
+        Session recv_session(config, &recv_hooks, NULL, &recv_queue, composer,
+                             packet_factory, buffer_factory);
+        CHECK(recv_session.valid());
+
+        const core::nanoseconds_t start = recv_session.generation_deadline();
+
+        recv_session.generate_packets();
+        CHECK(recv_queue.read());
+
+        const core::nanoseconds_t interval = recv_session.generation_deadline() - start;
+
+        if (num_sources == 1) {
+            // small report, interval is bounded by minimum
+            // (randomized to [0.5, 1.5] and divided by e-3/2)
+            CHECK(interval <= 200 * core::Millisecond);
+        } else {
+            // 40 reception blocks alone take ~1KB, and there are 41 members
+            CHECK(interval >= 2 * core::Second);
+        }
+    }
+}
+
+} // namespace rtcp
+} // namespace roc
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "test_packets/rtp_l16_1ch_10s_4pad_2csrc_12ext_marker.h"
+#include "test_packets/rtp_l16_2ch_320s.h"
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_rtp/format_map.h"
+#include "roc_rtp/header_view.h"
+#include "roc_rtp/parser.h"
+
+// These benchmarks measure per-packet cost of RTP parsing on receive path.
+//
+// Every iteration allocates a new packet, like receiver does for every
+// datagram, so allocation cost is measured separately and should be
+// subtracted from parsing benchmarks.
+
+namespace roc {
+namespace rtp {
+namespace {
+
+enum { MaxBufSize = test::PacketInfo::MaxData };
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBufSize, false);
+packet::PacketFactory packet_factory(allocator, false);
+
+const test::PacketInfo* packet_infos[] = {
+    &test::rtp_l16_2ch_320s,
+    &test::rtp_l16_1ch_10s_4pad_2csrc_12ext_marker,
+};
+
+core::Slice<uint8_t> make_buffer(const test::PacketInfo& pi) {
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    if (!buffer) {
+        roc_panic("bench: can't allocate buffer");
+    }
+
+    buffer.reslice(0, pi.packet_size);
+    memcpy(buffer.data(), pi.raw_data, pi.packet_size);
+
+    return buffer;
+}
+
+packet::PacketPtr make_packet(const core::Slice<uint8_t>& buffer) {
+    packet::PacketPtr pp = packet_factory.new_packet();
+    if (!pp) {
+        roc_panic("bench: can't allocate packet");
+    }
+
+    pp->set_data(buffer);
+
+    return pp;
+}
+
+void BM_Parser_Alloc(benchmark::State& state) {
+    core::Slice<uint8_t> buffer = make_buffer(*packet_infos[state.range(0)]);
+
+    while (state.KeepRunning()) {
+        packet::PacketPtr pp = make_packet(buffer);
+        benchmark::DoNotOptimize(pp.get());
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_Parser_Alloc)->Arg(0)->Arg(1);
+
+void BM_Parser_Parse(benchmark::State& state) {
+    core::Slice<uint8_t> buffer = make_buffer(*packet_infos[state.range(0)]);
+
+    FormatMap format_map;
+    Parser parser(format_map, NULL);
+
+    while (state.KeepRunning()) {
+        packet::PacketPtr pp = make_packet(buffer);
+
+        if (!parser.parse(*pp, pp->data())) {
+            roc_panic("bench: can't parse packet");
+        }
+
+        benchmark::DoNotOptimize(pp->rtp()->seqnum);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_Parser_Parse)->Arg(0)->Arg(1);
+
+// Same as above, but additionally access CSRC and extension, which are
+// decoded on demand.
+void BM_Parser_ParseHeaderView(benchmark::State& state) {
+    core::Slice<uint8_t> buffer = make_buffer(*packet_infos[state.range(0)]);
+
+    FormatMap format_map;
+    Parser parser(format_map, NULL);
+
+    while (state.KeepRunning()) {
+        packet::PacketPtr pp = make_packet(buffer);
+
+        if (!parser.parse(*pp, pp->data())) {
+            roc_panic("bench: can't parse packet");
+        }
+
+        HeaderView view(*pp->rtp());
+
+        for (size_t n = 0; n < view.num_csrc(); n++) {
+            benchmark::DoNotOptimize(view.csrc(n));
+        }
+
+        if (view.has_extension()) {
+            benchmark::DoNotOptimize(view.extension_type());
+            benchmark::DoNotOptimize(view.extension_data().size());
+        }
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK(BM_Parser_ParseHeaderView)->Arg(0)->Arg(1);
+
+} // namespace
+} // namespace rtp
+} // namespace roc
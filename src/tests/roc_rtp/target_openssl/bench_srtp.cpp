@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/optional.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/srtp_context.h"
+
+// These benchmarks measure per-packet cost of SRTP protection on sender path
+// and unprotection on receiver path, for different payload sizes.
+//
+// Packets are processed in place, like in pipeline. Receiver rejects replayed
+// packets, so every packet is unprotected only once, and the batch of
+// protected packets is regenerated when it's exhausted, with timing paused.
+
+namespace roc {
+namespace rtp {
+namespace {
+
+enum { MaxBufSize = 2048, NumPackets = 1024 };
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBufSize, false);
+
+SrtpConfig make_config() {
+    SrtpConfig config;
+    config.enabled = true;
+    for (size_t n = 0; n < SrtpConfig::MasterKeySize; n++) {
+        config.master_key[n] = (uint8_t)n;
+    }
+    for (size_t n = 0; n < SrtpConfig::MasterSaltSize; n++) {
+        config.master_salt[n] = (uint8_t)(n * 3);
+    }
+    return config;
+}
+
+core::Slice<uint8_t> make_packet(size_t payload_size, packet::seqnum_t seqnum) {
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    if (!buffer) {
+        roc_panic("bench: can't allocate buffer");
+    }
+
+    buffer.reslice(0, sizeof(Header) + payload_size);
+    memset(buffer.data(), 0x5A, buffer.size());
+
+    Header& header = *(Header*)buffer.data();
+    header.clear();
+    header.set_version(V2);
+    header.set_payload_type(PayloadType_L16_Stereo);
+    header.set_ssrc(0xCAFEBABE);
+    header.set_seqnum(seqnum);
+
+    return buffer;
+}
+
+void protect_packets(SrtpContext& sender,
+                     core::Slice<uint8_t>* packets,
+                     size_t payload_size) {
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n].reslice(0, sizeof(Header) + payload_size + sender.overhead());
+
+        if (!sender.protect(packets[n])) {
+            roc_panic("bench: can't protect packet");
+        }
+    }
+}
+
+void BM_Srtp_Protect(benchmark::State& state) {
+    const size_t payload_size = (size_t)state.range(0);
+
+    SrtpContext sender(make_config(), SrtpProto_RTP);
+    if (!sender.valid()) {
+        roc_panic("bench: can't create srtp context");
+    }
+
+    core::Slice<uint8_t> packet = make_packet(payload_size, 0);
+    Header& header = *(Header*)packet.data();
+
+    packet::seqnum_t seqnum = 0;
+
+    while (state.KeepRunning()) {
+        header.set_seqnum(seqnum++);
+        packet.reslice(0, sizeof(Header) + payload_size + sender.overhead());
+
+        if (!sender.protect(packet)) {
+            roc_panic("bench: can't protect packet");
+        }
+
+        benchmark::DoNotOptimize(packet.data()[packet.size() - 1]);
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(payload_size));
+}
+
+BENCHMARK(BM_Srtp_Protect)->Arg(160)->Arg(960)->Arg(1400);
+
+void BM_Srtp_Unprotect(benchmark::State& state) {
+    const size_t payload_size = (size_t)state.range(0);
+
+    core::Slice<uint8_t> packets[NumPackets];
+    for (size_t n = 0; n < NumPackets; n++) {
+        packets[n] = make_packet(payload_size, (packet::seqnum_t)n);
+    }
+
+    core::Optional<SrtpContext> sender;
+    core::Optional<SrtpContext> receiver;
+
+    size_t pos = NumPackets;
+
+    while (state.KeepRunning()) {
+        if (pos == NumPackets) {
+            state.PauseTiming();
+
+            // new contexts, so that sequence numbers are not treated as replayed
+            sender.reset(new (sender) SrtpContext(make_config(), SrtpProto_RTP));
+            receiver.reset(new (receiver) SrtpContext(make_config(), SrtpProto_RTP));
+
+            if (!sender->valid() || !receiver->valid()) {
+                roc_panic("bench: can't create srtp context");
+            }
+
+            protect_packets(*sender, packets, payload_size);
+            pos = 0;
+
+            state.ResumeTiming();
+        }
+
+        if (!receiver->unprotect(packets[pos])) {
+            roc_panic("bench: can't unprotect packet");
+        }
+
+        benchmark::DoNotOptimize(packets[pos].data()[packets[pos].size() - 1]);
+        pos++;
+    }
+
+    state.SetItemsProcessed(int64_t(state.iterations()));
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(payload_size));
+}
+
+BENCHMARK(BM_Srtp_Unprotect)->Arg(160)->Arg(960)->Arg(1400);
+
+} // namespace
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/macro_helpers.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/format_map.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/parser.h"
+#include "roc_rtp/srtp_composer.h"
+#include "roc_rtp/srtp_context.h"
+#include "roc_rtp/srtp_parser.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { MaxBufSize = 1000, PayloadSize = 64 };
+
+// test vectors from RFC 3711 B.3 and libsrtp
+const uint8_t MasterKey[] = { 0xE1, 0xF9, 0x7A, 0x0D, 0x3E, 0x01, 0x8B, 0xE0,
+                              0xD6, 0x4F, 0xA3, 0x2C, 0x06, 0xDE, 0x41, 0x39 };
+
+const uint8_t MasterSalt[] = { 0x0E, 0xC6, 0x75, 0xAD, 0x49, 0x8A, 0xFE,
+                               0xEB, 0xB6, 0x96, 0x0B, 0x3A, 0xAB, 0xE6 };
+
+const uint8_t SessionKey[] = { 0xC6, 0x1E, 0x7A, 0x93, 0x74, 0x4F, 0x39, 0xEE,
+                               0x10, 0x73, 0x4A, 0xFE, 0x3F, 0xF7, 0xA0, 0x87 };
+
+const uint8_t SessionSalt[] = { 0x30, 0xCB, 0xBC, 0x08, 0x86, 0x3D, 0x8C,
+                                0x85, 0xD4, 0x9D, 0xB3, 0x4A, 0x9A, 0xE1 };
+
+const uint8_t SessionAuthKey[] = { 0xCE, 0xBE, 0x32, 0x1F, 0x6F, 0xF7, 0x71,
+                                   0x6B, 0x6F, 0xD4, 0xAB, 0x49, 0xAF, 0x25,
+                                   0x6A, 0x15, 0x6D, 0x38, 0xBA, 0xA4 };
+
+const uint8_t PlainPacket[] = { 0x80, 0x0F, 0x12, 0x34, 0xDE, 0xCA, 0xFB,
+                                0xAD, 0xCA, 0xFE, 0xBA, 0xBE, 0xAB, 0xAB,
+                                0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+                                0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB };
+
+const uint8_t ProtectedPacket[] = {
+    0x80, 0x0F, 0x12, 0x34, 0xDE, 0xCA, 0xFB, 0xAD, 0xCA, 0xFE,
+    0xBA, 0xBE, 0x4E, 0x55, 0xDC, 0x4C, 0xE7, 0x99, 0x78, 0xD8,
+    0x8C, 0xA4, 0xD2, 0x15, 0x94, 0x9D, 0x24, 0x02, 0xB7, 0x8D,
+    0x6A, 0xCC, 0x99, 0xEA, 0x17, 0x9B, 0x8D, 0xBB
+};
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBufSize, true);
+packet::PacketFactory packet_factory(allocator, true);
+FormatMap format_map;
+
+SrtpConfig make_config(uint8_t key_xor = 0) {
+    SrtpConfig config;
+    config.enabled = true;
+    memcpy(config.master_key, MasterKey, sizeof(MasterKey));
+    memcpy(config.master_salt, MasterSalt, sizeof(MasterSalt));
+    config.master_key[0] ^= key_xor;
+    return config;
+}
+
+core::Slice<uint8_t> make_buffer(const uint8_t* data, size_t size) {
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+    buffer.reslice(0, size);
+    memcpy(buffer.data(), data, size);
+    return buffer;
+}
+
+core::Slice<uint8_t> copy_buffer(const core::Slice<uint8_t>& src) {
+    return make_buffer(src.data(), src.size());
+}
+
+packet::PacketPtr compose_packet(packet::IComposer& composer,
+                                 packet::seqnum_t seqnum,
+                                 uint8_t value) {
+    packet::PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+    buffer.reslice(0, 0);
+
+    CHECK(composer.prepare(*pp, buffer, PayloadSize));
+    pp->set_data(buffer);
+
+    pp->rtp()->source = 0xCAFEBABE;
+    pp->rtp()->seqnum = seqnum;
+    pp->rtp()->timestamp = (packet::timestamp_t)seqnum * 100;
+    pp->rtp()->payload_type = PayloadType_L16_Stereo;
+
+    memset(pp->rtp()->payload.data(), value, PayloadSize);
+
+    CHECK(composer.compose(*pp));
+
+    return pp;
+}
+
+bool parse_packet(packet::IParser& parser,
+                  const core::Slice<uint8_t>& buffer,
+                  packet::seqnum_t seqnum,
+                  uint8_t value) {
+    packet::PacketPtr pp = packet_factory.new_packet();
+    CHECK(pp);
+
+    // parse a copy, because packet is decrypted in place
+    core::Slice<uint8_t> data = copy_buffer(buffer);
+    pp->set_data(data);
+
+    if (!parser.parse(*pp, pp->data())) {
+        return false;
+    }
+
+    CHECK(pp->rtp());
+    UNSIGNED_LONGS_EQUAL(0xCAFEBABE, pp->rtp()->source);
+    UNSIGNED_LONGS_EQUAL(seqnum, pp->rtp()->seqnum);
+    UNSIGNED_LONGS_EQUAL(PayloadSize, pp->rtp()->payload.size());
+
+    for (size_t n = 0; n < PayloadSize; n++) {
+        UNSIGNED_LONGS_EQUAL(value, pp->rtp()->payload.data()[n]);
+    }
+
+    return true;
+}
+
+} // namespace
+
+TEST_GROUP(srtp) {};
+
+TEST(srtp, derive_keys) {
+    SrtpContext context(make_config(), SrtpProto_RTP);
+    CHECK(context.valid());
+
+    MEMCMP_EQUAL(SessionKey, context.session_key(), sizeof(SessionKey));
+    MEMCMP_EQUAL(SessionSalt, context.session_salt(), sizeof(SessionSalt));
+    MEMCMP_EQUAL(SessionAuthKey, context.session_auth_key(), sizeof(SessionAuthKey));
+}
+
+TEST(srtp, protect_known_answer) {
+    SrtpContext context(make_config(), SrtpProto_RTP);
+    CHECK(context.valid());
+
+    UNSIGNED_LONGS_EQUAL(sizeof(ProtectedPacket) - sizeof(PlainPacket),
+                         context.overhead());
+
+    core::Slice<uint8_t> data = make_buffer(PlainPacket, sizeof(PlainPacket));
+    data.reslice(0, sizeof(PlainPacket) + context.overhead());
+
+    CHECK(context.protect(data));
+
+    UNSIGNED_LONGS_EQUAL(sizeof(ProtectedPacket), data.size());
+    MEMCMP_EQUAL(ProtectedPacket, data.data(), sizeof(ProtectedPacket));
+}
+
+TEST(srtp, unprotect_known_answer) {
+    SrtpContext context(make_config(), SrtpProto_RTP);
+    CHECK(context.valid());
+
+    core::Slice<uint8_t> data = make_buffer(ProtectedPacket, sizeof(ProtectedPacket));
+
+    CHECK(context.unprotect(data));
+
+    UNSIGNED_LONGS_EQUAL(sizeof(PlainPacket), data.size());
+    MEMCMP_EQUAL(PlainPacket, data.data(), sizeof(PlainPacket));
+}
+
+TEST(srtp, compose_parse) {
+    Composer rtp_composer(NULL);
+    SrtpComposer composer(make_config(), SrtpProto_RTP, rtp_composer);
+    CHECK(composer.valid());
+
+    Parser rtp_parser(format_map, NULL);
+    SrtpParser parser(make_config(), SrtpProto_RTP, rtp_parser);
+    CHECK(parser.valid());
+
+    for (packet::seqnum_t sn = 0; sn < 10; sn++) {
+        packet::PacketPtr pp = compose_packet(composer, sn, 0x11);
+
+        const size_t header_size = sizeof(Header);
+
+        UNSIGNED_LONGS_EQUAL(header_size + PayloadSize + SrtpContext::AuthTagSize,
+                             pp->data().size());
+
+        // payload is encrypted
+        bool is_plaintext = true;
+        for (size_t n = 0; n < PayloadSize; n++) {
+            if (pp->data().data()[header_size + n] != 0x11) {
+                is_plaintext = false;
+            }
+        }
+        CHECK(!is_plaintext);
+
+        CHECK(parse_packet(parser, pp->data(), sn, 0x11));
+    }
+}
+
+TEST(srtp, tampered) {
+    Composer rtp_composer(NULL);
+    SrtpComposer composer(make_config(), SrtpProto_RTP, rtp_composer);
+
+    Parser rtp_parser(format_map, NULL);
+    SrtpParser parser(make_config(), SrtpProto_RTP, rtp_parser);
+
+    packet::PacketPtr pp = compose_packet(composer, 100, 0x22);
+
+    const size_t positions[] = { 2, sizeof(Header), pp->data().size() - 1 };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(positions); n++) {
+        core::Slice<uint8_t> data = copy_buffer(pp->data());
+        data.data()[positions[n]] ^= 0x01;
+
+        CHECK(!parse_packet(parser, data, 100, 0x22));
+    }
+
+    CHECK(parse_packet(parser, pp->data(), 100, 0x22));
+}
+
+TEST(srtp, wrong_key) {
+    Composer rtp_composer(NULL);
+    SrtpComposer composer(make_config(), SrtpProto_RTP, rtp_composer);
+
+    Parser rtp_parser(format_map, NULL);
+    SrtpParser parser(make_config(0x01), SrtpProto_RTP, rtp_parser);
+
+    packet::PacketPtr pp = compose_packet(composer, 100, 0x33);
+
+    CHECK(!parse_packet(parser, pp->data(), 100, 0x33));
+}
+
+TEST(srtp, replay) {
+    Composer rtp_composer(NULL);
+    SrtpComposer composer(make_config(), SrtpProto_RTP, rtp_composer);
+
+    Parser rtp_parser(format_map, NULL);
+    SrtpParser parser(make_config(), SrtpProto_RTP, rtp_parser);
+
+    packet::PacketPtr packets[SrtpContext::ReplayWindowSize + 10];
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(packets); n++) {
+        packets[n] = compose_packet(composer, packet::seqnum_t(n), 0x44);
+    }
+
+    // reordered packets are accepted
+    CHECK(parse_packet(parser, packets[1]->data(), 1, 0x44));
+    CHECK(parse_packet(parser, packets[0]->data(), 0, 0x44));
+    CHECK(parse_packet(parser, packets[3]->data(), 3, 0x44));
+
+    // duplicates are rejected
+    CHECK(!parse_packet(parser, packets[0]->data(), 0, 0x44));
+    CHECK(!parse_packet(parser, packets[3]->data(), 3, 0x44));
+
+    CHECK(parse_packet(parser, packets[2]->data(), 2, 0x44));
+
+    // packets which are too old are rejected
+    const size_t last = ROC_ARRAY_SIZE(packets) - 1;
+    CHECK(parse_packet(parser, packets[last]->data(), packet::seqnum_t(last), 0x44));
+
+    CHECK(!parse_packet(parser, packets[5]->data(), 5, 0x44));
+    CHECK(parse_packet(parser, packets[last - 5]->data(), packet::seqnum_t(last - 5),
+                       0x44));
+}
+
+TEST(srtp, seqnum_rollover) {
+    Composer rtp_composer(NULL);
+    SrtpComposer composer(make_config(), SrtpProto_RTP, rtp_composer);
+
+    Parser rtp_parser(format_map, NULL);
+    SrtpParser parser(make_config(), SrtpProto_RTP, rtp_parser);
+
+    const packet::seqnum_t first_sn = 65530;
+
+    for (size_t n = 0; n < 20; n++) {
+        const packet::seqnum_t sn = packet::seqnum_t(first_sn + n);
+
+        packet::PacketPtr pp = compose_packet(composer, sn, 0x55);
+        CHECK(parse_packet(parser, pp->data(), sn, 0x55));
+    }
+}
+
+TEST(srtp, join_running_sender) {
+    Composer rtp_composer(NULL);
+    SrtpComposer composer(make_config(), SrtpProto_RTP, rtp_composer);
+
+    // sender wraps sequence number a few times
+    packet::PacketPtr pp;
+    for (size_t n = 0; n < 3 * 65536 + 100; n += 100) {
+        pp = compose_packet(composer, packet::seqnum_t(n), 0x66);
+    }
+
+    // receiver starts after that
+    Parser rtp_parser(format_map, NULL);
+    SrtpParser parser(make_config(), SrtpProto_RTP, rtp_parser);
+
+    CHECK(parse_packet(parser, pp->data(), pp->rtp()->seqnum, 0x66));
+
+    for (size_t n = 1; n < 10; n++) {
+        const packet::seqnum_t sn = packet::seqnum_t(pp->rtp()->seqnum + 1);
+
+        pp = compose_packet(composer, sn, 0x66);
+        CHECK(parse_packet(parser, pp->data(), sn, 0x66));
+    }
+}
+
+TEST(srtp, rtcp) {
+    SrtpContext sender(make_config(), SrtpProto_RTCP);
+    SrtpContext receiver(make_config(), SrtpProto_RTCP);
+
+    CHECK(sender.valid());
+    CHECK(receiver.valid());
+
+    UNSIGNED_LONGS_EQUAL(SrtpContext::SrtcpIndexSize + SrtpContext::AuthTagSize,
+                         sender.overhead());
+
+    // receiver report with sender ssrc and some data
+    uint8_t plain[32] = { 0x80, 0xC9, 0x00, 0x07, 0xCA, 0xFE, 0xBA, 0xBE };
+    for (size_t n = 8; n < sizeof(plain); n++) {
+        plain[n] = (uint8_t)n;
+    }
+
+    for (size_t i = 0; i < 5; i++) {
+        core::Slice<uint8_t> data = make_buffer(plain, sizeof(plain));
+        data.reslice(0, sizeof(plain) + sender.overhead());
+
+        CHECK(sender.protect(data));
+
+        // header and ssrc are not encrypted, the rest is
+        MEMCMP_EQUAL(plain, data.data(), 8);
+        CHECK(memcmp(plain + 8, data.data() + 8, sizeof(plain) - 8) != 0);
+
+        // srtcp index with encryption flag
+        UNSIGNED_LONGS_EQUAL(0x80, data.data()[sizeof(plain)]);
+        UNSIGNED_LONGS_EQUAL(i, data.data()[sizeof(plain) + 3]);
+
+        core::Slice<uint8_t> replayed = copy_buffer(data);
+
+        CHECK(receiver.unprotect(data));
+        UNSIGNED_LONGS_EQUAL(sizeof(plain), data.size());
+        MEMCMP_EQUAL(plain, data.data(), sizeof(plain));
+
+        CHECK(!receiver.unprotect(replayed));
+    }
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_rtp/format_map.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { DynamicPt = 100 };
+
+core::HeapAllocator allocator;
+
+} // namespace
+
+TEST_GROUP(format_map) {};
+
+TEST(format_map, builtin_formats) {
+    FormatMap format_map;
+
+    const Format* fmt = format_map.format(PayloadType_L16_Stereo);
+    CHECK(fmt);
+
+    UNSIGNED_LONGS_EQUAL(PayloadType_L16_Stereo, fmt->payload_type);
+    UNSIGNED_LONGS_EQUAL(44100, fmt->sample_spec.sample_rate());
+    UNSIGNED_LONGS_EQUAL(0x3, fmt->sample_spec.channel_mask());
+
+    fmt = format_map.format(PayloadType_L16_Mono);
+    CHECK(fmt);
+
+    UNSIGNED_LONGS_EQUAL(PayloadType_L16_Mono, fmt->payload_type);
+    UNSIGNED_LONGS_EQUAL(44100, fmt->sample_spec.sample_rate());
+    UNSIGNED_LONGS_EQUAL(0x1, fmt->sample_spec.channel_mask());
+
+    CHECK(!format_map.format(DynamicPt));
+}
+
+TEST(format_map, add_pcm_format) {
+    enum { NumSamples = 100 };
+
+    FormatMap format_map;
+
+    CHECK(format_map.add_pcm_format(
+        DynamicPt, audio::PcmFormat(audio::PcmEncoding_SInt24, audio::PcmEndian_Big),
+        audio::SampleSpec(48000, 0x1)));
+
+    const Format* fmt = format_map.format(DynamicPt);
+    CHECK(fmt);
+
+    UNSIGNED_LONGS_EQUAL(DynamicPt, fmt->payload_type);
+    UNSIGNED_LONGS_EQUAL(48000, fmt->sample_spec.sample_rate());
+    UNSIGNED_LONGS_EQUAL(0x1, fmt->sample_spec.channel_mask());
+    UNSIGNED_LONGS_EQUAL(packet::Packet::FlagAudio, fmt->packet_flags);
+
+    core::ScopedPtr<audio::IFrameEncoder> encoder(fmt->new_encoder(allocator, *fmt),
+                                                  allocator);
+    CHECK(encoder);
+
+    core::ScopedPtr<audio::IFrameDecoder> decoder(fmt->new_decoder(allocator, *fmt),
+                                                  allocator);
+    CHECK(decoder);
+
+    // 24-bit mono
+    UNSIGNED_LONGS_EQUAL(NumSamples * 3, encoder->encoded_byte_count(NumSamples));
+
+    uint8_t frame[NumSamples * 3] = {};
+    UNSIGNED_LONGS_EQUAL(NumSamples, decoder->decoded_sample_count(frame, sizeof(frame)));
+}
+
+TEST(format_map, find_pcm_format) {
+    FormatMap format_map;
+
+    const audio::PcmFormat s16_be(audio::PcmEncoding_SInt16, audio::PcmEndian_Big);
+    const audio::PcmFormat s24_be(audio::PcmEncoding_SInt24, audio::PcmEndian_Big);
+
+    const Format* fmt = format_map.find_pcm_format(s16_be, audio::SampleSpec(44100, 0x3));
+    CHECK(fmt);
+    UNSIGNED_LONGS_EQUAL(PayloadType_L16_Stereo, fmt->payload_type);
+
+    fmt = format_map.find_pcm_format(s16_be, audio::SampleSpec(44100, 0x1));
+    CHECK(fmt);
+    UNSIGNED_LONGS_EQUAL(PayloadType_L16_Mono, fmt->payload_type);
+
+    CHECK(!format_map.find_pcm_format(s16_be, audio::SampleSpec(48000, 0x3)));
+    CHECK(!format_map.find_pcm_format(s24_be, audio::SampleSpec(44100, 0x3)));
+
+    CHECK(format_map.add_pcm_format(DynamicPt, s16_be, audio::SampleSpec(48000, 0x3)));
+
+    fmt = format_map.find_pcm_format(s16_be, audio::SampleSpec(48000, 0x3));
+    CHECK(fmt);
+    UNSIGNED_LONGS_EQUAL(DynamicPt, fmt->payload_type);
+
+    CHECK(!format_map.find_pcm_format(s16_be, audio::SampleSpec(48000, 0x1)));
+}
+
+TEST(format_map, add_duplicate) {
+    FormatMap format_map;
+
+    CHECK(!format_map.add_pcm_format(
+        PayloadType_L16_Stereo,
+        audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big),
+        audio::SampleSpec(48000, 0x3)));
+
+    const Format* fmt = format_map.format(PayloadType_L16_Stereo);
+    CHECK(fmt);
+    UNSIGNED_LONGS_EQUAL(44100, fmt->sample_spec.sample_rate());
+
+    CHECK(format_map.add_pcm_format(
+        DynamicPt, audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big),
+        audio::SampleSpec(48000, 0x3)));
+
+    CHECK(!format_map.add_pcm_format(
+        DynamicPt, audio::PcmFormat(audio::PcmEncoding_SInt16, audio::PcmEndian_Big),
+        audio::SampleSpec(48000, 0x3)));
+}
+
+TEST(format_map, add_invalid) {
+    FormatMap format_map;
+
+    const audio::PcmFormat pcm_format(audio::PcmEncoding_SInt16, audio::PcmEndian_Big);
+
+    // payload type doesn't fit into 7 bits
+    CHECK(!format_map.add_pcm_format(128, pcm_format, audio::SampleSpec(48000, 0x3)));
+
+    // no sample rate
+    audio::SampleSpec no_rate;
+    no_rate.set_channel_mask(0x3);
+    CHECK(!format_map.add_pcm_format(DynamicPt, pcm_format, no_rate));
+
+    // no channels
+    audio::SampleSpec no_channels;
+    no_channels.set_sample_rate(48000);
+    CHECK(!format_map.add_pcm_format(DynamicPt, pcm_format, no_channels));
+
+    // no constructors
+    Format fmt;
+    fmt.payload_type = (PayloadType)DynamicPt;
+    fmt.sample_spec = audio::SampleSpec(48000, 0x3);
+    CHECK(!format_map.add_format(fmt));
+
+    CHECK(!format_map.format(DynamicPt));
+}
+
+TEST(format_map, add_many) {
+    FormatMap format_map;
+
+    const audio::PcmFormat pcm_format(audio::PcmEncoding_SInt16, audio::PcmEndian_Big);
+
+    size_t n_added = 0;
+
+    for (unsigned int pt = 96; pt <= 127; pt++) {
+        if (format_map.format(pt)) {
+            continue;
+        }
+        if (!format_map.add_pcm_format(pt, pcm_format, audio::SampleSpec(48000, 0x3))) {
+            break;
+        }
+        CHECK(format_map.format(pt));
+        n_added++;
+    }
+
+    // limited, but there is room for several formats
+    CHECK(n_added > 4);
+    CHECK(n_added < 32);
+}
+
+} // namespace rtp
+} // namespace roc
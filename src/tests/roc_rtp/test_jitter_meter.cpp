@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_pipeline/config.h"
+#include "roc_rtp/jitter_meter.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { Src1 = 55, Src2 = 77, SampleRate = 10000, SamplesPerPacket = 100 };
+
+const core::nanoseconds_t PacketDuration = SamplesPerPacket * core::Second / SampleRate;
+
+const audio::SampleSpec SampleSpecs =
+    audio::SampleSpec(SampleRate, pipeline::DefaultChannelMask);
+
+core::HeapAllocator allocator;
+packet::PacketFactory packet_factory(allocator, true);
+
+packet::PacketPtr new_packet(packet::source_t src,
+                             packet::timestamp_t ts,
+                             core::nanoseconds_t recv_ts,
+                             packet::seqnum_t sn = 0) {
+    packet::PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    packet->add_flags(packet::Packet::FlagRTP | packet::Packet::FlagUDP);
+    packet->rtp()->source = src;
+    packet->rtp()->seqnum = sn;
+    packet->rtp()->timestamp = ts;
+    packet->udp()->receive_timestamp = recv_ts;
+
+    return packet;
+}
+
+} // namespace
+
+TEST_GROUP(jitter_meter) {};
+
+TEST(jitter_meter, no_jitter) {
+    enum { NumPackets = 100 };
+
+    JitterMeter meter(SampleSpecs);
+
+    const core::nanoseconds_t start = 1000 * core::Second;
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        meter.update(
+            *new_packet(Src1, n * SamplesPerPacket, start + (long)n * PacketDuration));
+
+        LONGS_EQUAL(0, meter.jitter());
+    }
+}
+
+TEST(jitter_meter, constant_jitter) {
+    enum { NumPackets = 1000 };
+
+    JitterMeter meter(SampleSpecs);
+
+    const core::nanoseconds_t start = 1000 * core::Second;
+    const core::nanoseconds_t delay = core::Millisecond;
+
+    // every second packet is delayed, so every transit delta is 'delay'
+    for (size_t n = 0; n < NumPackets; n++) {
+        meter.update(*new_packet(Src1, n * SamplesPerPacket,
+                                 start + (long)n * PacketDuration
+                                     + (n % 2 == 0 ? 0 : delay)));
+    }
+
+    CHECK(meter.jitter() > delay * 99 / 100);
+    CHECK(meter.jitter() <= delay);
+}
+
+TEST(jitter_meter, source_change) {
+    enum { NumPackets = 100 };
+
+    JitterMeter meter(SampleSpecs);
+
+    const core::nanoseconds_t start = 1000 * core::Second;
+    const core::nanoseconds_t delay = core::Millisecond;
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        meter.update(*new_packet(Src1, n * SamplesPerPacket,
+                                 start + (long)n * PacketDuration
+                                     + (n % 2 == 0 ? 0 : delay)));
+    }
+
+    CHECK(meter.jitter() > 0);
+
+    // new source, timestamps are unrelated to previous ones
+    meter.update(*new_packet(Src2, 12345, start + NumPackets * PacketDuration));
+    LONGS_EQUAL(0, meter.jitter());
+
+    meter.update(*new_packet(Src2, 12345 + SamplesPerPacket,
+                             start + (NumPackets + 1) * PacketDuration));
+    LONGS_EQUAL(0, meter.jitter());
+}
+
+TEST(jitter_meter, no_receive_timestamp) {
+    JitterMeter meter(SampleSpecs);
+
+    meter.update(*new_packet(Src1, 0, 1000 * core::Second));
+    meter.update(*new_packet(Src1, SamplesPerPacket, 0));
+    meter.update(*new_packet(Src1, SamplesPerPacket * 2,
+                             1000 * core::Second + PacketDuration * 2));
+
+    LONGS_EQUAL(0, meter.jitter());
+}
+
+TEST(jitter_meter, peak_delay) {
+    enum { NumPackets = 1000 };
+
+    const core::nanoseconds_t window = 10 * PacketDuration;
+    const core::nanoseconds_t delay = 3 * core::Millisecond;
+
+    JitterMeter meter(SampleSpecs, window);
+
+    const core::nanoseconds_t start = 1000 * core::Second;
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        // one packet is delayed in the middle
+        const core::nanoseconds_t recv_ts =
+            start + (long)n * PacketDuration + (n == NumPackets / 2 ? delay : 0);
+
+        meter.update(*new_packet(Src1, n * SamplesPerPacket, recv_ts,
+                                 (packet::seqnum_t)n));
+
+        CHECK(meter.has_peaks() == (n >= 10));
+
+        if (n >= NumPackets / 2 && n < NumPackets / 2 + 10) {
+            LONGS_EQUAL(delay, meter.peak_delay());
+        }
+        LONGS_EQUAL(0, meter.peak_burst());
+    }
+
+    // delayed packet is forgotten after two windows
+    LONGS_EQUAL(0, meter.peak_delay());
+}
+
+TEST(jitter_meter, peak_burst) {
+    enum { NumPackets = 1000, NumLost = 3 };
+
+    const core::nanoseconds_t window = 10 * PacketDuration;
+
+    JitterMeter meter(SampleSpecs, window);
+
+    const core::nanoseconds_t start = 1000 * core::Second;
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        // a few packets are lost in the middle
+        if (n >= NumPackets / 2 && n < NumPackets / 2 + NumLost) {
+            continue;
+        }
+
+        meter.update(*new_packet(Src1, n * SamplesPerPacket,
+                                 start + (long)n * PacketDuration,
+                                 (packet::seqnum_t)n));
+
+        if (n >= NumPackets / 2 && n < NumPackets / 2 + 10) {
+            LONGS_EQUAL(NumLost * PacketDuration, meter.peak_burst());
+        }
+        LONGS_EQUAL(0, meter.peak_delay());
+    }
+
+    // burst is forgotten after two windows
+    LONGS_EQUAL(0, meter.peak_burst());
+}
+
+} // namespace rtp
+} // namespace roc
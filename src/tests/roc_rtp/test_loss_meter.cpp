@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_rtp/loss_meter.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { Src1 = 55, Src2 = 77 };
+
+core::HeapAllocator allocator;
+packet::PacketFactory packet_factory(allocator, true);
+
+packet::PacketPtr new_packet(packet::source_t src, packet::seqnum_t sn) {
+    packet::PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    packet->add_flags(packet::Packet::FlagRTP);
+    packet->rtp()->source = src;
+    packet->rtp()->seqnum = sn;
+
+    return packet;
+}
+
+} // namespace
+
+TEST_GROUP(loss_meter) {};
+
+TEST(loss_meter, no_losses) {
+    LossMeter meter;
+    CHECK(!meter.started());
+
+    for (packet::seqnum_t sn = 100; sn < 200; sn++) {
+        meter.update(*new_packet(Src1, sn));
+    }
+
+    CHECK(meter.started());
+    UNSIGNED_LONGS_EQUAL(199, meter.ext_seqnum());
+    LONGS_EQUAL(0, (long)meter.cum_loss());
+    DOUBLES_EQUAL(0.0, (double)meter.report_fract_loss(), 1e-6);
+}
+
+TEST(loss_meter, losses) {
+    LossMeter meter;
+
+    // every fourth packet is lost
+    for (packet::seqnum_t sn = 0; sn < 100; sn++) {
+        if (sn % 4 != 3) {
+            meter.update(*new_packet(Src1, sn));
+        }
+    }
+
+    UNSIGNED_LONGS_EQUAL(98, meter.ext_seqnum());
+    LONGS_EQUAL(24, (long)meter.cum_loss());
+    DOUBLES_EQUAL(24.0 / 99, (double)meter.report_fract_loss(), 1e-6);
+
+    // fraction is computed since previous report
+    for (packet::seqnum_t sn = 100; sn < 200; sn++) {
+        if (sn % 2 == 0) {
+            meter.update(*new_packet(Src1, sn));
+        }
+    }
+
+    LONGS_EQUAL(24 + 50, (long)meter.cum_loss());
+    DOUBLES_EQUAL(50.0 / 100, (double)meter.report_fract_loss(), 1e-6);
+
+    // nothing expected since previous report
+    DOUBLES_EQUAL(0.0, (double)meter.report_fract_loss(), 1e-6);
+}
+
+TEST(loss_meter, reorder_and_duplicates) {
+    LossMeter meter;
+
+    meter.update(*new_packet(Src1, 10));
+    meter.update(*new_packet(Src1, 12));
+    meter.update(*new_packet(Src1, 11));
+
+    UNSIGNED_LONGS_EQUAL(12, meter.ext_seqnum());
+    LONGS_EQUAL(0, (long)meter.cum_loss());
+
+    meter.update(*new_packet(Src1, 12));
+    meter.update(*new_packet(Src1, 12));
+
+    // duplicates make loss negative, but not fraction
+    LONGS_EQUAL(-2, (long)meter.cum_loss());
+    DOUBLES_EQUAL(0.0, (double)meter.report_fract_loss(), 1e-6);
+}
+
+TEST(loss_meter, seqnum_overflow) {
+    LossMeter meter;
+
+    for (packet::seqnum_t sn = 65530; sn != 10; sn++) {
+        meter.update(*new_packet(Src1, sn));
+    }
+
+    UNSIGNED_LONGS_EQUAL(65536 + 9, meter.ext_seqnum());
+    LONGS_EQUAL(0, (long)meter.cum_loss());
+
+    // late packet from previous cycle
+    meter.update(*new_packet(Src1, 65535));
+
+    UNSIGNED_LONGS_EQUAL(65536 + 9, meter.ext_seqnum());
+    LONGS_EQUAL(-1, (long)meter.cum_loss());
+}
+
+TEST(loss_meter, loss_runs) {
+    LossMeter meter;
+
+    uint32_t begin = 0;
+    uint16_t runs[8];
+
+    // received 100-104, lost 105-106, received 107-109, lost 110, received 111
+    for (packet::seqnum_t sn = 100; sn <= 111; sn++) {
+        if (sn != 105 && sn != 106 && sn != 110) {
+            meter.update(*new_packet(Src1, sn));
+        }
+    }
+    // duplicate
+    meter.update(*new_packet(Src1, 108));
+
+    UNSIGNED_LONGS_EQUAL(5, meter.report_loss_runs(begin, runs, ROC_ARRAY_SIZE(runs)));
+    UNSIGNED_LONGS_EQUAL(100, begin);
+    UNSIGNED_LONGS_EQUAL(5, runs[0]);
+    UNSIGNED_LONGS_EQUAL(2, runs[1]);
+    UNSIGNED_LONGS_EQUAL(3, runs[2]);
+    UNSIGNED_LONGS_EQUAL(1, runs[3]);
+    UNSIGNED_LONGS_EQUAL(1, runs[4]);
+    UNSIGNED_LONGS_EQUAL(1, meter.report_dup_packets());
+
+    // nothing new since previous report
+    UNSIGNED_LONGS_EQUAL(0, meter.report_loss_runs(begin, runs, ROC_ARRAY_SIZE(runs)));
+    UNSIGNED_LONGS_EQUAL(112, begin);
+    UNSIGNED_LONGS_EQUAL(0, meter.report_dup_packets());
+
+    // lost 112-113, received 114, then 112 arrives late
+    meter.update(*new_packet(Src1, 114));
+    meter.update(*new_packet(Src1, 112));
+
+    UNSIGNED_LONGS_EQUAL(3, meter.report_loss_runs(begin, runs, ROC_ARRAY_SIZE(runs)));
+    UNSIGNED_LONGS_EQUAL(112, begin);
+    UNSIGNED_LONGS_EQUAL(1, runs[0]);
+    UNSIGNED_LONGS_EQUAL(1, runs[1]);
+    UNSIGNED_LONGS_EQUAL(1, runs[2]);
+}
+
+TEST(loss_meter, loss_runs_truncated) {
+    LossMeter meter;
+
+    uint32_t begin = 0;
+    uint16_t runs[2];
+
+    // every second packet is lost
+    for (packet::seqnum_t sn = 0; sn <= 10; sn += 2) {
+        meter.update(*new_packet(Src1, sn));
+    }
+
+    // report is truncated to fit runs
+    UNSIGNED_LONGS_EQUAL(2, meter.report_loss_runs(begin, runs, ROC_ARRAY_SIZE(runs)));
+    UNSIGNED_LONGS_EQUAL(0, begin);
+    UNSIGNED_LONGS_EQUAL(1, runs[0]);
+    UNSIGNED_LONGS_EQUAL(1, runs[1]);
+
+    // and continues from where previous one stopped
+    UNSIGNED_LONGS_EQUAL(2, meter.report_loss_runs(begin, runs, ROC_ARRAY_SIZE(runs)));
+    UNSIGNED_LONGS_EQUAL(2, begin);
+    UNSIGNED_LONGS_EQUAL(1, runs[0]);
+    UNSIGNED_LONGS_EQUAL(1, runs[1]);
+}
+
+TEST(loss_meter, source_change) {
+    LossMeter meter;
+
+    meter.update(*new_packet(Src1, 10));
+    meter.update(*new_packet(Src1, 20));
+
+    LONGS_EQUAL(9, (long)meter.cum_loss());
+
+    // meter starts over
+    meter.update(*new_packet(Src2, 500));
+    meter.update(*new_packet(Src2, 501));
+
+    UNSIGNED_LONGS_EQUAL(501, meter.ext_seqnum());
+    LONGS_EQUAL(0, (long)meter.cum_loss());
+}
+
+} // namespace rtp
+} // namespace roc
@@ -20,6 +20,7 @@
 #include "roc_packet/packet_factory.h"
 #include "roc_rtp/composer.h"
 #include "roc_rtp/format_map.h"
+#include "roc_rtp/header_view.h"
 #include "roc_rtp/parser.h"
 
 namespace roc {
@@ -84,6 +85,25 @@ void check_packet_fields(const packet::Packet& packet, const test::PacketInfo& p
     UNSIGNED_LONGS_EQUAL(pi.padding, (packet.rtp()->padding.size() != 0));
 }
 
+void check_packet_header(const packet::Packet& packet, const test::PacketInfo& pi) {
+    HeaderView view(*packet.rtp());
+
+    UNSIGNED_LONGS_EQUAL(pi.num_csrc, view.num_csrc());
+    for (size_t n = 0; n < pi.num_csrc; n++) {
+        UNSIGNED_LONGS_EQUAL(pi.csrc[n], view.csrc(n));
+    }
+
+    UNSIGNED_LONGS_EQUAL(pi.extension, view.has_extension());
+    if (!pi.extension) {
+        CHECK(!view.extension_data());
+        return;
+    }
+
+    UNSIGNED_LONGS_EQUAL(pi.ext_type, view.extension_type());
+    UNSIGNED_LONGS_EQUAL(pi.ext_data_size, view.extension_data().size());
+    CHECK(memcmp(view.extension_data().data(), pi.ext_data, pi.ext_data_size) == 0);
+}
+
 void set_packet_fields(packet::Packet& packet, const test::PacketInfo& pi) {
     CHECK(packet.rtp());
 
@@ -174,12 +194,13 @@ void check_parse_decode(const test::PacketInfo& pi) {
     const Format* format = format_map.format(packet->rtp()->payload_type);
     CHECK(format);
 
-    core::ScopedPtr<audio::IFrameDecoder> decoder(format->new_decoder(allocator),
-                                                  allocator);
+    core::ScopedPtr<audio::IFrameDecoder> decoder(
+        format->new_decoder(allocator, *format), allocator);
     CHECK(decoder);
 
     check_format_info(*format, pi);
     check_packet_fields(*packet, pi);
+    check_packet_header(*packet, pi);
     check_packet_data(*packet, pi);
 
     decode_samples(*decoder, *packet, pi);
@@ -199,8 +220,8 @@ void check_compose_encode(const test::PacketInfo& pi) {
     const Format* format = format_map.format(pi.pt);
     CHECK(format);
 
-    core::ScopedPtr<audio::IFrameEncoder> encoder(format->new_encoder(allocator),
-                                                  allocator);
+    core::ScopedPtr<audio::IFrameEncoder> encoder(
+        format->new_encoder(allocator, *format), allocator);
     CHECK(encoder);
 
     Composer composer(NULL);
@@ -254,5 +275,121 @@ TEST(packet_formats, l16_1ch_10s_4pad_2csrc_12ext_marker) {
     check(test::rtp_l16_1ch_10s_4pad_2csrc_12ext_marker, CanParse);
 }
 
+TEST(packet_formats, capture_timestamp) {
+    enum { PayloadSize = 32 };
+
+    const packet::ntp_timestamp_t capture_ts = 0x0123456789abcdefull;
+
+    core::Slice<uint8_t> buffer = new_buffer(NULL, 0);
+    CHECK(buffer);
+
+    packet::PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    Composer composer(NULL, true);
+
+    CHECK(composer.prepare(*packet, buffer, PayloadSize));
+    packet->set_data(buffer);
+
+    // header, extension header, and abs-capture-time element padded to 12 bytes
+    UNSIGNED_LONGS_EQUAL(sizeof(Header) + 16, packet->rtp()->header.size());
+    UNSIGNED_LONGS_EQUAL(PayloadSize, packet->rtp()->payload.size());
+
+    packet->rtp()->seqnum = 123;
+    packet->rtp()->timestamp = 456;
+    packet->rtp()->payload_type = PayloadType_L16_Stereo;
+    packet->rtp()->capture_timestamp = capture_ts;
+
+    CHECK(composer.compose(*packet));
+
+    FormatMap format_map;
+    Parser parser(format_map, NULL);
+
+    packet::PacketPtr parsed = packet_factory.new_packet();
+    CHECK(parsed);
+
+    parsed->set_data(buffer);
+    CHECK(parser.parse(*parsed, parsed->data()));
+
+    UNSIGNED_LONGS_EQUAL(123, parsed->rtp()->seqnum);
+    UNSIGNED_LONGS_EQUAL(456, parsed->rtp()->timestamp);
+    CHECK(parsed->rtp()->capture_timestamp == capture_ts);
+    UNSIGNED_LONGS_EQUAL(PayloadSize, parsed->rtp()->payload.size());
+
+    HeaderView view(*parsed->rtp());
+    CHECK(view.has_extension());
+    UNSIGNED_LONGS_EQUAL(ExtProfile_OneByte, view.extension_type());
+    UNSIGNED_LONGS_EQUAL(12, view.extension_data().size());
+}
+
+TEST(packet_formats, compose_sequence) {
+    enum { PayloadSize = 32, NumPackets = 6 };
+
+    const packet::source_t sources[NumPackets] = { 11, 11, 11, 22, 22, 22 };
+    const unsigned payload_types[NumPackets] = {
+        PayloadType_L16_Stereo, PayloadType_L16_Stereo, PayloadType_L16_Stereo,
+        PayloadType_L16_Stereo, PayloadType_L16_Mono,   PayloadType_L16_Mono
+    };
+
+    FormatMap format_map;
+    Parser parser(format_map, NULL);
+
+    Composer composer(NULL, true);
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        core::Slice<uint8_t> buffer = new_buffer(NULL, 0);
+        CHECK(buffer);
+
+        packet::PacketPtr packet = packet_factory.new_packet();
+        CHECK(packet);
+
+        CHECK(composer.prepare(*packet, buffer, PayloadSize));
+        packet->set_data(buffer);
+
+        packet->rtp()->source = sources[n];
+        packet->rtp()->seqnum = packet::seqnum_t(100 + n);
+        packet->rtp()->timestamp = packet::timestamp_t(1000 + n * 10);
+        packet->rtp()->marker = (n % 2 == 1);
+        packet->rtp()->payload_type = payload_types[n];
+        packet->rtp()->capture_timestamp = packet::ntp_timestamp_t(5000 + n);
+
+        if (n == 2) {
+            CHECK(composer.pad(*packet, 4));
+        }
+
+        CHECK(composer.compose(*packet));
+
+        packet::PacketPtr parsed = packet_factory.new_packet();
+        CHECK(parsed);
+
+        parsed->set_data(buffer);
+        CHECK(parser.parse(*parsed, parsed->data()));
+
+        UNSIGNED_LONGS_EQUAL(sources[n], parsed->rtp()->source);
+        UNSIGNED_LONGS_EQUAL(100 + n, parsed->rtp()->seqnum);
+        UNSIGNED_LONGS_EQUAL(1000 + n * 10, parsed->rtp()->timestamp);
+        CHECK(parsed->rtp()->marker == (n % 2 == 1));
+        UNSIGNED_LONGS_EQUAL(payload_types[n], parsed->rtp()->payload_type);
+        CHECK(parsed->rtp()->capture_timestamp == 5000 + n);
+        UNSIGNED_LONGS_EQUAL(n == 2 ? 4 : 0, parsed->rtp()->padding.size());
+    }
+}
+
+TEST(packet_formats, capture_timestamp_unknown_extension) {
+    FormatMap format_map;
+    Parser parser(format_map, NULL);
+
+    const test::PacketInfo& pi = test::rtp_l16_1ch_10s_12ext;
+
+    packet::PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    packet->set_data(new_buffer(pi.raw_data, pi.packet_size));
+    CHECK(parser.parse(*packet, packet->data()));
+
+    // extension is not RFC 8285 one-byte header
+    CHECK(packet->rtp()->capture_timestamp == 0);
+}
+
 } // namespace rtp
 } // namespace roc
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "test_packets/rtp_l16_1ch_10s_4pad_2csrc_12ext_marker.h"
+#include "test_packets/rtp_l16_2ch_300s_80pad.h"
+#include "test_packets/rtp_l16_2ch_320s.h"
+
+#include "roc_core/buffer_factory.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/temp_file.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_packet/queue.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/format_map.h"
+#include "roc_rtp/parser.h"
+#include "roc_rtp/recorder.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { MaxBufSize = test::PacketInfo::MaxData, SampleRate = 44100, Port = 10001 };
+
+const audio::SampleSpec SampleSpecs(SampleRate, 0x3);
+
+core::HeapAllocator allocator;
+core::BufferFactory<uint8_t> buffer_factory(allocator, MaxBufSize, true);
+packet::PacketFactory packet_factory(allocator, true);
+
+packet::PacketPtr parse_packet(const test::PacketInfo& pi) {
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+    buffer.reslice(0, pi.packet_size);
+    memcpy(buffer.data(), pi.raw_data, pi.packet_size);
+
+    packet::PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+    packet->set_data(buffer);
+
+    FormatMap format_map;
+    Parser parser(format_map, NULL);
+    CHECK(parser.parse(*packet, packet->data()));
+
+    return packet;
+}
+
+packet::PacketPtr compose_packet(packet::seqnum_t sn, packet::timestamp_t ts) {
+    enum { PayloadSize = 40 };
+
+    core::Slice<uint8_t> buffer = buffer_factory.new_buffer();
+    CHECK(buffer);
+
+    packet::PacketPtr packet = packet_factory.new_packet();
+    CHECK(packet);
+
+    Composer composer(NULL);
+    CHECK(composer.prepare(*packet, buffer, PayloadSize));
+    packet->set_data(buffer);
+
+    packet->rtp()->seqnum = sn;
+    packet->rtp()->timestamp = ts;
+    packet->rtp()->payload_type = PayloadType_L16_Stereo;
+    memset(packet->rtp()->payload.data(), sn & 0xff, PayloadSize);
+
+    CHECK(composer.compose(*packet));
+
+    return packet;
+}
+
+size_t read_file(const char* path, uint8_t* data, size_t size) {
+    FILE* fp = fopen(path, "rb");
+    CHECK(fp);
+    const size_t n = fread(data, 1, size, fp);
+    fclose(fp);
+    return n;
+}
+
+uint16_t read16(const uint8_t* p) {
+    return uint16_t((p[0] << 8) | p[1]);
+}
+
+uint32_t read32(const uint8_t* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8)
+        | uint32_t(p[3]);
+}
+
+class IndexFile {
+public:
+    IndexFile(const char* path) {
+        snprintf(path_, sizeof(path_), "%s.idx", path);
+    }
+
+    ~IndexFile() {
+        remove(path_);
+    }
+
+    const char* path() const {
+        return path_;
+    }
+
+private:
+    char path_[PATH_MAX];
+};
+
+} // namespace
+
+TEST_GROUP(recorder) {};
+
+TEST(recorder, bitwise_identical) {
+    core::TempFile file("test.rtpdump");
+    IndexFile index(file.path());
+
+    const test::PacketInfo* packets[] = {
+        &test::rtp_l16_2ch_320s,
+        &test::rtp_l16_2ch_300s_80pad,
+        &test::rtp_l16_1ch_10s_4pad_2csrc_12ext_marker,
+    };
+    enum { NumPackets = ROC_ARRAY_SIZE(packets) };
+
+    packet::Queue queue;
+    for (size_t n = 0; n < NumPackets; n++) {
+        queue.write(parse_packet(*packets[n]));
+    }
+
+    {
+        Recorder recorder(queue, file.path(), "127.0.0.1", Port, SampleSpecs);
+        CHECK(recorder.valid());
+
+        for (size_t n = 0; n < NumPackets; n++) {
+            packet::PacketPtr pp = recorder.read();
+            CHECK(pp);
+            UNSIGNED_LONGS_EQUAL(packets[n]->seqnum, pp->rtp()->seqnum);
+        }
+        CHECK(!recorder.read());
+
+        UNSIGNED_LONGS_EQUAL(NumPackets, recorder.num_packets());
+    }
+
+    uint8_t data[MaxBufSize * 4];
+    const size_t size = read_file(file.path(), data, sizeof(data));
+
+    const char* line = "#!rtpplay1.0 127.0.0.1/10001\n";
+    CHECK(size > strlen(line));
+    CHECK(memcmp(data, line, strlen(line)) == 0);
+
+    const uint8_t* pos = data + strlen(line);
+    UNSIGNED_LONGS_EQUAL(Port, read16(pos + 12));
+    pos += 16;
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        const test::PacketInfo& pi = *packets[n];
+
+        UNSIGNED_LONGS_EQUAL(pi.packet_size + 8, read16(pos));
+        UNSIGNED_LONGS_EQUAL(pi.packet_size, read16(pos + 2));
+        pos += 8;
+
+        CHECK(memcmp(pos, pi.raw_data, pi.packet_size) == 0);
+        pos += pi.packet_size;
+    }
+
+    UNSIGNED_LONGS_EQUAL(size, size_t(pos - data));
+}
+
+TEST(recorder, offsets_and_index) {
+    enum { NumPackets = 7, SamplesPerPacket = SampleRate / 2, FirstTs = 0xfffff000 };
+
+    core::TempFile file("test.rtpdump");
+    IndexFile index(file.path());
+
+    packet::Queue queue;
+    for (size_t n = 0; n < NumPackets; n++) {
+        queue.write(compose_packet(packet::seqnum_t(100 + n),
+                                   packet::timestamp_t(FirstTs + n * SamplesPerPacket)));
+    }
+
+    {
+        Recorder recorder(queue, file.path(), "127.0.0.1", Port, SampleSpecs);
+        CHECK(recorder.valid());
+
+        while (recorder.read()) {
+        }
+        UNSIGNED_LONGS_EQUAL(NumPackets, recorder.num_packets());
+    }
+
+    uint8_t data[MaxBufSize * 4];
+    const size_t size = read_file(file.path(), data, sizeof(data));
+
+    const uint8_t* first = (const uint8_t*)memchr(data, '\n', size) + 1 + 16;
+    const uint8_t* pos = first;
+
+    size_t record_pos[NumPackets];
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        record_pos[n] = size_t(pos - data);
+
+        // 500ms per packet, across timestamp wrap
+        UNSIGNED_LONGS_EQUAL(n * 500, read32(pos + 4));
+        pos += read16(pos);
+    }
+    UNSIGNED_LONGS_EQUAL(size, size_t(pos - data));
+
+    FILE* fp = fopen(index.path(), "r");
+    CHECK(fp);
+
+    char line[128];
+    CHECK(fgets(line, sizeof(line), fp));
+    STRCMP_EQUAL("# roc rtpdump index v1\n", line);
+
+    // one entry per second, pointing to packets 0, 2, 4, 6
+    for (size_t n = 0; n < NumPackets; n += 2) {
+        CHECK(fgets(line, sizeof(line), fp));
+
+        unsigned long offset_ms = 0, ts = 0, sn = 0;
+        unsigned long long file_pos = 0;
+        CHECK(sscanf(line, "%lu %lu %lu %llu", &offset_ms, &ts, &sn, &file_pos) == 4);
+
+        UNSIGNED_LONGS_EQUAL(n * 500, offset_ms);
+        UNSIGNED_LONGS_EQUAL(packet::timestamp_t(FirstTs + n * SamplesPerPacket), ts);
+        UNSIGNED_LONGS_EQUAL(100 + n, sn);
+        UNSIGNED_LONGS_EQUAL(record_pos[n], (size_t)file_pos);
+    }
+    CHECK(!fgets(line, sizeof(line), fp));
+
+    fclose(fp);
+}
+
+TEST(recorder, bad_path) {
+    packet::Queue queue;
+    queue.write(compose_packet(1, 1000));
+
+    Recorder recorder(queue, "/nonexistent/dir/test.rtpdump", "127.0.0.1", Port,
+                      SampleSpecs);
+    CHECK(!recorder.valid());
+
+    // packets are still passed through
+    packet::PacketPtr pp = recorder.read();
+    CHECK(pp);
+    UNSIGNED_LONGS_EQUAL(1, pp->rtp()->seqnum);
+    UNSIGNED_LONGS_EQUAL(0, recorder.num_packets());
+}
+
+} // namespace rtp
+} // namespace roc
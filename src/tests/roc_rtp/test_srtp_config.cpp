@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/macro_helpers.h"
+#include "roc_rtp/srtp_config.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+const uint8_t MasterKey[] = { 0xE1, 0xF9, 0x7A, 0x0D, 0x3E, 0x01, 0x8B, 0xE0,
+                              0xD6, 0x4F, 0xA3, 0x2C, 0x06, 0xDE, 0x41, 0x39 };
+
+const uint8_t MasterSalt[] = { 0x0E, 0xC6, 0x75, 0xAD, 0x49, 0x8A, 0xFE,
+                               0xEB, 0xB6, 0x96, 0x0B, 0x3A, 0xAB, 0xE6 };
+
+} // namespace
+
+TEST_GROUP(srtp_config) {};
+
+TEST(srtp_config, parse_key) {
+    SrtpConfig config;
+    CHECK(!config.enabled);
+
+    CHECK(parse_srtp_key("4fl6DT4Bi+DWT6MsBt5BOQ7Gda1Jiv7rtpYLOqvm", config));
+
+    CHECK(config.enabled);
+    MEMCMP_EQUAL(MasterKey, config.master_key, sizeof(MasterKey));
+    MEMCMP_EQUAL(MasterSalt, config.master_salt, sizeof(MasterSalt));
+}
+
+TEST(srtp_config, parse_key_invalid) {
+    const char* keys[] = {
+        "",
+        // too short
+        "4fl6DT4Bi+DWT6MsBt5BOQ7Gda1Jiv7rtpYLOq",
+        // too long
+        "4fl6DT4Bi+DWT6MsBt5BOQ7Gda1Jiv7rtpYLOqvmAAAA",
+        // invalid character
+        "4fl6DT4Bi+DWT6MsBt5BOQ7Gda1Jiv7rtpYLOqv!",
+        // characters after padding
+        "4fl6DT4Bi+DWT6MsBt5BOQ7Gda1Jiv7rtpYLOqvm=A",
+    };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(keys); n++) {
+        SrtpConfig config;
+        CHECK(!parse_srtp_key(keys[n], config));
+        CHECK(!config.enabled);
+    }
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_sdp/media_formats.h"
+#include "roc_sdp/session_description.h"
+
+namespace roc {
+namespace sdp {
+
+namespace {
+
+enum { DynamicPt1 = 100, DynamicPt2 = 101 };
+
+core::HeapAllocator allocator;
+
+bool add_rtpmap(MediaDescription& media,
+                unsigned pt,
+                const char* encoding,
+                long rate,
+                long channels) {
+    return media.add_payload_id(pt)
+        && media.add_rtpmap(pt, encoding, strlen(encoding), rate, channels);
+}
+
+} // namespace
+
+TEST_GROUP(media_formats) {};
+
+TEST(media_formats, dynamic_pcm) {
+    SessionDescription session_description(allocator);
+    CHECK(session_description.add_media_description());
+
+    MediaDescription& media = *session_description.last_media_description();
+    CHECK(add_rtpmap(media, DynamicPt1, "L16", 48000, 2));
+    CHECK(add_rtpmap(media, DynamicPt2, "l24", 96000, 1));
+
+    rtp::FormatMap format_map;
+    CHECK(register_media_formats(media, format_map));
+
+    const rtp::Format* fmt = format_map.format(DynamicPt1);
+    CHECK(fmt);
+    UNSIGNED_LONGS_EQUAL(audio::PcmEncoding_SInt16, fmt->pcm_format.encoding);
+    UNSIGNED_LONGS_EQUAL(48000, fmt->sample_spec.sample_rate());
+    UNSIGNED_LONGS_EQUAL(0x3, fmt->sample_spec.channel_mask());
+
+    fmt = format_map.format(DynamicPt2);
+    CHECK(fmt);
+    UNSIGNED_LONGS_EQUAL(audio::PcmEncoding_SInt24, fmt->pcm_format.encoding);
+    UNSIGNED_LONGS_EQUAL(96000, fmt->sample_spec.sample_rate());
+    UNSIGNED_LONGS_EQUAL(0x1, fmt->sample_spec.channel_mask());
+
+    // same description can be applied again
+    CHECK(register_media_formats(media, format_map));
+}
+
+TEST(media_formats, static_payload_type) {
+    SessionDescription session_description(allocator);
+    CHECK(session_description.add_media_description());
+
+    MediaDescription& media = *session_description.last_media_description();
+    CHECK(media.add_payload_id(rtp::PayloadType_L16_Stereo));
+
+    rtp::FormatMap format_map;
+    CHECK(register_media_formats(media, format_map));
+
+    // unknown payload type without rtpmap
+    CHECK(media.add_payload_id(DynamicPt1));
+    CHECK(!register_media_formats(media, format_map));
+}
+
+TEST(media_formats, conflicts) {
+    rtp::FormatMap format_map;
+
+    {
+        SessionDescription session_description(allocator);
+        CHECK(session_description.add_media_description());
+
+        MediaDescription& media = *session_description.last_media_description();
+        CHECK(add_rtpmap(media, DynamicPt1, "L16", 48000, 2));
+        CHECK(register_media_formats(media, format_map));
+    }
+
+    {
+        // same payload type, different rate
+        SessionDescription session_description(allocator);
+        CHECK(session_description.add_media_description());
+
+        MediaDescription& media = *session_description.last_media_description();
+        CHECK(add_rtpmap(media, DynamicPt1, "L16", 44100, 2));
+        CHECK(!register_media_formats(media, format_map));
+    }
+
+    {
+        // static payload type redefined
+        SessionDescription session_description(allocator);
+        CHECK(session_description.add_media_description());
+
+        MediaDescription& media = *session_description.last_media_description();
+        CHECK(add_rtpmap(media, rtp::PayloadType_L16_Stereo, "L16", 48000, 2));
+        CHECK(!register_media_formats(media, format_map));
+    }
+
+    {
+        // unsupported encoding
+        SessionDescription session_description(allocator);
+        CHECK(session_description.add_media_description());
+
+        MediaDescription& media = *session_description.last_media_description();
+        CHECK(add_rtpmap(media, DynamicPt2, "PCMU", 8000, 1));
+        CHECK(!register_media_formats(media, format_map));
+    }
+}
+
+TEST(media_formats, fec_scheme) {
+    SessionDescription session_description(allocator);
+    CHECK(session_description.add_media_description());
+
+    MediaDescription& media = *session_description.last_media_description();
+
+    fec::CodecConfig config;
+    configure_media_fec(media, config);
+    CHECK_EQUAL(packet::FEC_None, config.scheme);
+
+    CHECK(media.set_fec_encoding_id(7));
+    configure_media_fec(media, config);
+    CHECK_EQUAL(packet::FEC_LDPC_Staircase, config.scheme);
+
+    CHECK(media.set_fec_encoding_id(8));
+    configure_media_fec(media, config);
+    CHECK_EQUAL(packet::FEC_ReedSolomon_M8, config.scheme);
+
+    CHECK(!media.set_fec_encoding_id(123));
+}
+
+} // namespace sdp
+} // namespace roc
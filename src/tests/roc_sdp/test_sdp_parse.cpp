@@ -78,5 +78,63 @@ TEST(sdp_parser, media_descriptions) {
     CHECK_EQUAL(11, media3->default_payload_id());
 }
 
+TEST(sdp_parser, media_attributes) {
+    SessionDescription session_description(allocator);
+    CHECK(parse_sdp("v=0\r\n"
+                    "o=test_origin 16914 1 IN IP4 192.168.58.15\r\n"
+                    "c=IN IP4 230.255.12.42/250\r\n"
+                    "a=sendonly\r\n"
+                    "m=audio 12345 RTP/AVP 100 101\r\n"
+                    "a=rtpmap:100 L16/48000/2\r\n"
+                    "a=rtpmap:101 L24/96000\r\n"
+                    "a=fmtp:101 foo=bar\r\n"
+                    "m=application 12346 RTP/AVP 102\r\n"
+                    "a=fec-repair-flow: encoding-id=8; ss-fssi=n:255\r\n",
+                    session_description));
+
+    core::SharedPtr<MediaDescription> media1 =
+        session_description.first_media_description();
+
+    UNSIGNED_LONGS_EQUAL(2, media1->nb_rtpmaps());
+
+    const RtpMap* rtpmap = media1->find_rtpmap(100);
+    CHECK(rtpmap);
+    STRCMP_EQUAL("L16", rtpmap->encoding);
+    UNSIGNED_LONGS_EQUAL(48000, rtpmap->clock_rate);
+    UNSIGNED_LONGS_EQUAL(2, rtpmap->num_channels);
+
+    rtpmap = media1->find_rtpmap(101);
+    CHECK(rtpmap);
+    STRCMP_EQUAL("L24", rtpmap->encoding);
+    UNSIGNED_LONGS_EQUAL(96000, rtpmap->clock_rate);
+    UNSIGNED_LONGS_EQUAL(1, rtpmap->num_channels);
+
+    CHECK_EQUAL(packet::FEC_None, media1->fec_scheme());
+
+    core::SharedPtr<MediaDescription> media2 =
+        session_description.nextof_media_description(media1);
+
+    UNSIGNED_LONGS_EQUAL(0, media2->nb_rtpmaps());
+    CHECK_EQUAL(packet::FEC_ReedSolomon_M8, media2->fec_scheme());
+}
+
+TEST(sdp_parser, bad_media_attributes) {
+    SessionDescription session_description(allocator);
+
+    // no clock rate
+    CHECK(!parse_sdp("v=0\r\n"
+                     "o=test_origin 16914 1 IN IP4 192.168.58.15\r\n"
+                     "m=audio 12345 RTP/AVP 100\r\n"
+                     "a=rtpmap:100 L16",
+                     session_description));
+
+    // unknown fec encoding
+    CHECK(!parse_sdp("v=0\r\n"
+                     "o=test_origin 16914 1 IN IP4 192.168.58.15\r\n"
+                     "m=application 12346 RTP/AVP 102\r\n"
+                     "a=fec-repair-flow: encoding-id=123",
+                     session_description));
+}
+
 } // namespace sdp
 } // namespace roc
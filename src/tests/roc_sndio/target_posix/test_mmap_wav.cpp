@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <stdio.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/temp_file.h"
+#include "roc_sndio/mmap_wav_sink.h"
+#include "roc_sndio/mmap_wav_source.h"
+#include "roc_sndio/wav_backend.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum { FrameSize = 500, NumFrames = 20, SampleRate = 44100, ChMask = 0x3, NumChans = 2 };
+
+const double Epsilon = 0.00001;
+
+core::HeapAllocator allocator;
+
+audio::sample_t nth_sample(size_t n) {
+    return audio::sample_t(n % 1000) / 1000.0f - 0.5f;
+}
+
+void write_file(const char* path, const Config& config, size_t n_frames) {
+    MmapWavSink sink(config);
+    CHECK(sink.valid());
+    CHECK(sink.open(path));
+
+    size_t pos = 0;
+
+    for (size_t nf = 0; nf < n_frames; nf++) {
+        audio::sample_t samples[FrameSize * NumChans];
+        for (size_t ns = 0; ns < FrameSize * NumChans; ns++) {
+            samples[ns] = nth_sample(pos++);
+        }
+
+        audio::Frame frame(samples, FrameSize * NumChans);
+        sink.write(frame);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(mmap_wav) {
+    Config config;
+
+    void setup() {
+        config.sample_spec = audio::SampleSpec(SampleRate, ChMask);
+        config.frame_length = FrameSize * core::Second / SampleRate;
+    }
+};
+
+TEST(mmap_wav, write_read) {
+    core::TempFile file("test.wav");
+
+    write_file(file.path(), config, NumFrames);
+
+    MmapWavSource source(config);
+    CHECK(source.valid());
+    CHECK(source.open(file.path()));
+
+    CHECK(!source.has_clock());
+    CHECK(source.state() == DeviceState_Active);
+
+    size_t pos = 0;
+
+    for (size_t nf = 0; nf < NumFrames; nf++) {
+        audio::sample_t samples[FrameSize * NumChans] = {};
+        audio::Frame frame(samples, FrameSize * NumChans);
+
+        CHECK(source.read(frame));
+
+        for (size_t ns = 0; ns < FrameSize * NumChans; ns++) {
+            DOUBLES_EQUAL(nth_sample(pos++), samples[ns], Epsilon);
+        }
+    }
+
+    audio::sample_t samples[FrameSize * NumChans] = {};
+    audio::Frame frame(samples, FrameSize * NumChans);
+
+    CHECK(!source.read(frame));
+}
+
+TEST(mmap_wav, partial_frame) {
+    core::TempFile file("test.wav");
+
+    write_file(file.path(), config, 1);
+
+    MmapWavSource source(config);
+    CHECK(source.open(file.path()));
+
+    audio::sample_t samples[FrameSize * NumChans * 2];
+    for (size_t ns = 0; ns < FrameSize * NumChans * 2; ns++) {
+        samples[ns] = 1;
+    }
+    audio::Frame frame(samples, FrameSize * NumChans * 2);
+
+    CHECK(source.read(frame));
+
+    for (size_t ns = 0; ns < FrameSize * NumChans; ns++) {
+        DOUBLES_EQUAL(nth_sample(ns), samples[ns], Epsilon);
+    }
+    for (size_t ns = FrameSize * NumChans; ns < FrameSize * NumChans * 2; ns++) {
+        DOUBLES_EQUAL(0, samples[ns], Epsilon);
+    }
+
+    CHECK(!source.read(frame));
+}
+
+TEST(mmap_wav, sample_rate_auto) {
+    core::TempFile file("test.wav");
+
+    write_file(file.path(), config, 1);
+
+    config.sample_spec.set_sample_rate(0);
+
+    MmapWavSource source(config);
+    CHECK(source.open(file.path()));
+    CHECK(source.sample_spec().sample_rate() == SampleRate);
+}
+
+TEST(mmap_wav, channels_mismatch) {
+    core::TempFile file("test.wav");
+
+    write_file(file.path(), config, 1);
+
+    config.sample_spec.set_channel_mask(0x1);
+
+    MmapWavSource source(config);
+    CHECK(!source.open(file.path()));
+}
+
+TEST(mmap_wav, pause_restart) {
+    core::TempFile file("test.wav");
+
+    write_file(file.path(), config, 2);
+
+    MmapWavSource source(config);
+    CHECK(source.open(file.path()));
+
+    audio::sample_t samples1[FrameSize * NumChans] = {};
+    audio::Frame frame1(samples1, FrameSize * NumChans);
+
+    CHECK(source.read(frame1));
+
+    source.pause();
+    CHECK(source.state() == DeviceState_Paused);
+
+    audio::sample_t samples2[FrameSize * NumChans] = {};
+    audio::Frame frame2(samples2, FrameSize * NumChans);
+
+    CHECK(!source.read(frame2));
+
+    CHECK(source.restart());
+    CHECK(source.state() == DeviceState_Active);
+
+    CHECK(source.read(frame2));
+
+    if (memcmp(samples1, samples2, sizeof(samples1)) != 0) {
+        FAIL("frames should be equal");
+    }
+}
+
+TEST(mmap_wav, not_wav) {
+    core::TempFile file("test.wav");
+
+    FILE* fp = fopen(file.path(), "w");
+    CHECK(fp);
+    fprintf(fp, "not a wav file");
+    fclose(fp);
+
+    MmapWavSource source(config);
+    CHECK(!source.open(file.path()));
+}
+
+TEST(mmap_wav, bad_file) {
+    MmapWavSource source(config);
+    CHECK(!source.open("/bad/file.wav"));
+
+    MmapWavSink sink(config);
+    CHECK(!sink.open("/bad/file.wav"));
+}
+
+TEST(mmap_wav, backend_auto_detect) {
+    core::TempFile wav_file("test.wav");
+    core::TempFile other_file("test.mp3");
+
+    write_file(wav_file.path(), config, 1);
+
+    WavBackend backend;
+
+    {
+        core::ScopedPtr<IDevice> device(
+            backend.open_device(DeviceType_Source, DriverType_File, NULL,
+                                wav_file.path(), config, allocator),
+            allocator);
+        CHECK(device);
+        CHECK(device->type() == DeviceType_Source);
+    }
+
+    {
+        core::ScopedPtr<IDevice> device(
+            backend.open_device(DeviceType_Sink, DriverType_File, NULL,
+                                other_file.path(), config, allocator),
+            allocator);
+        CHECK(!device);
+    }
+
+    {
+        core::ScopedPtr<IDevice> device(
+            backend.open_device(DeviceType_Sink, DriverType_File, "wav",
+                                other_file.path(), config, allocator),
+            allocator);
+        CHECK(device);
+        CHECK(device->type() == DeviceType_Sink);
+    }
+}
+
+} // namespace sndio
+} // namespace roc
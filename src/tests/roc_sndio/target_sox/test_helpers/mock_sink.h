@@ -20,7 +20,18 @@ namespace test {
 class MockSink : public ISink {
 public:
     MockSink()
-        : pos_(0) {
+        : pos_(0)
+        , clock_(false)
+        , n_waits_(0) {
+    }
+
+    // Emulate sink with own clock which supports wait_ready().
+    void enable_clock() {
+        clock_ = true;
+    }
+
+    size_t num_waits() const {
+        return n_waits_;
     }
 
     virtual DeviceType type() const {
@@ -54,7 +65,20 @@ public:
     }
 
     virtual bool has_clock() const {
-        return false;
+        return clock_;
+    }
+
+    virtual bool has_ready_wait() const {
+        return clock_;
+    }
+
+    virtual bool wait_ready(size_t n_samples, core::nanoseconds_t timeout) {
+        CHECK(clock_);
+        CHECK(n_samples > 0);
+        CHECK(timeout > 0);
+
+        n_waits_++;
+        return true;
     }
 
     virtual void write(audio::Frame& frame) {
@@ -82,6 +106,9 @@ private:
 
     audio::sample_t samples_[MaxSz];
     size_t pos_;
+
+    bool clock_;
+    size_t n_waits_;
 };
 
 } // namespace test
@@ -127,5 +127,60 @@ TEST(pump, write_overwrite_read) {
     mock_writer.check(num_returned1, num_returned2);
 }
 
+TEST(pump, sink_clock) {
+    enum { NumFrames = 10, NumSamples = BufSize * NumFrames };
+
+    test::MockSource mock_source;
+    mock_source.add(NumSamples);
+
+    test::MockSink mock_sink;
+    mock_sink.enable_clock();
+
+    Pump pump(buffer_factory, mock_source, NULL, mock_sink, BufDuration, SampleSpecs,
+              Pump::ModeOneshot, Pump::ClockSink);
+    CHECK(pump.valid());
+    CHECK(pump.run());
+
+    // pump waited for sink before reading every frame
+    UNSIGNED_LONGS_EQUAL(NumFrames, mock_sink.num_waits());
+
+    mock_sink.check(0, NumSamples);
+}
+
+TEST(pump, sink_clock_unsupported) {
+    enum { NumFrames = 10, NumSamples = BufSize * NumFrames };
+
+    test::MockSource mock_source;
+    mock_source.add(NumSamples);
+
+    test::MockSink mock_sink;
+
+    Pump pump(buffer_factory, mock_source, NULL, mock_sink, BufDuration, SampleSpecs,
+              Pump::ModeOneshot, Pump::ClockSink);
+    CHECK(pump.valid());
+    CHECK(pump.run());
+
+    // sink has no clock, pump fell back to default mode
+    UNSIGNED_LONGS_EQUAL(0, mock_sink.num_waits());
+
+    mock_sink.check(0, NumSamples);
+}
+
+TEST(pump, no_clock) {
+    enum { NumFrames = 10, NumSamples = BufSize * NumFrames };
+
+    test::MockSource mock_source;
+    mock_source.add(NumSamples);
+
+    test::MockSink mock_sink;
+
+    Pump pump(buffer_factory, mock_source, NULL, mock_sink, BufDuration, SampleSpecs,
+              Pump::ModeOneshot, Pump::ClockNone);
+    CHECK(pump.valid());
+    CHECK(pump.run());
+
+    mock_sink.check(0, NumSamples);
+}
+
 } // namespace sndio
 } // namespace roc
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_sndio/backend_map.h"
+
+namespace roc {
+namespace sndio {
+
+TEST_GROUP(backend_map) {};
+
+TEST(backend_map, find_nth_driver) {
+    BackendMap& backend_map = BackendMap::instance();
+
+    // lazy discovery returns drivers in the same order as full discovery
+    const DriverInfo* first_driver = backend_map.find_nth_driver(0);
+
+    const size_t n_drivers = backend_map.num_drivers();
+
+    if (n_drivers == 0) {
+        CHECK(!first_driver);
+        return;
+    }
+
+    POINTERS_EQUAL(&backend_map.nth_driver(0), first_driver);
+
+    for (size_t n = 0; n < n_drivers; n++) {
+        const DriverInfo* driver = backend_map.find_nth_driver(n);
+
+        CHECK(driver);
+        POINTERS_EQUAL(&backend_map.nth_driver(n), driver);
+        CHECK(driver->backend);
+    }
+
+    CHECK(!backend_map.find_nth_driver(n_drivers));
+    CHECK(!backend_map.find_nth_driver(n_drivers + 100));
+}
+
+TEST(backend_map, nth_backend) {
+    BackendMap& backend_map = BackendMap::instance();
+
+    for (size_t n = 0; n < backend_map.num_backends(); n++) {
+        IBackend& backend = backend_map.nth_backend(n);
+
+        // backend is initialized once
+        POINTERS_EQUAL(&backend, &backend_map.nth_backend(n));
+    }
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/semaphore.h"
+#include "roc_core/stddefs.h"
+#include "roc_sndio/fanout_sink.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum {
+    SampleRate = 1000,
+    ChMask = 0x3,
+    NumCh = 2,
+    FrameSize = 10 * NumCh,
+    QueueFrames = 4,
+    NumFrames = 50,
+    MaxSamples = NumFrames * FrameSize * 2
+};
+
+const audio::SampleSpec SampleSpecs(SampleRate, ChMask);
+
+const core::nanoseconds_t FrameLength = 10 * core::Millisecond;
+const core::nanoseconds_t QueueLength = QueueFrames * FrameLength;
+
+core::HeapAllocator allocator;
+
+class TestSink : public ISink {
+public:
+    explicit TestSink(bool clock)
+        : clock_(clock)
+        , gated_(false)
+        , n_samples_(0)
+        , n_writes_(0)
+        , n_pauses_(0)
+        , n_resumes_(0)
+        , pause_pos_(0)
+        , resume_pos_(0) {
+    }
+
+    // Block first write() until open_gate() is called.
+    void close_gate() {
+        gated_ = true;
+    }
+
+    void open_gate() {
+        gate_.post();
+    }
+
+    size_t num_samples() const {
+        return n_samples_;
+    }
+
+    size_t num_writes() const {
+        return n_writes_;
+    }
+
+    size_t num_pauses() const {
+        return n_pauses_;
+    }
+
+    size_t num_resumes() const {
+        return n_resumes_;
+    }
+
+    size_t pause_pos() const {
+        return pause_pos_;
+    }
+
+    size_t resume_pos() const {
+        return resume_pos_;
+    }
+
+    audio::sample_t sample(size_t n) const {
+        return samples_[n];
+    }
+
+    virtual DeviceType type() const {
+        return DeviceType_Sink;
+    }
+
+    virtual DeviceState state() const {
+        return DeviceState_Active;
+    }
+
+    virtual void pause() {
+        n_pauses_++;
+        pause_pos_ = n_samples_;
+    }
+
+    virtual bool resume() {
+        n_resumes_++;
+        resume_pos_ = n_samples_;
+        return true;
+    }
+
+    virtual bool restart() {
+        return true;
+    }
+
+    virtual audio::SampleSpec sample_spec() const {
+        return SampleSpecs;
+    }
+
+    virtual core::nanoseconds_t latency() const {
+        return 0;
+    }
+
+    virtual bool has_clock() const {
+        return clock_;
+    }
+
+    virtual core::nanoseconds_t preferred_frame_length() const {
+        return clock_ ? FrameLength / 2 : 0;
+    }
+
+    virtual void write(audio::Frame& frame) {
+        if (gated_) {
+            gate_.wait();
+            gated_ = false;
+        }
+
+        CHECK(n_samples_ + frame.num_samples() <= MaxSamples);
+
+        memcpy(samples_ + n_samples_, frame.samples(),
+               frame.num_samples() * sizeof(audio::sample_t));
+
+        n_samples_ += frame.num_samples();
+        n_writes_++;
+    }
+
+private:
+    const bool clock_;
+
+    core::Semaphore gate_;
+    bool gated_;
+
+    audio::sample_t samples_[MaxSamples];
+    size_t n_samples_;
+    size_t n_writes_;
+
+    size_t n_pauses_;
+    size_t n_resumes_;
+    size_t pause_pos_;
+    size_t resume_pos_;
+};
+
+audio::sample_t nth_sample(size_t n) {
+    return audio::sample_t(uint8_t(n)) / audio::sample_t(1 << 8);
+}
+
+void write_frames(FanoutSink& fanout, size_t num_frames, size_t frame_size, size_t& pos) {
+    audio::sample_t samples[MaxSamples];
+
+    for (size_t nf = 0; nf < num_frames; nf++) {
+        for (size_t ns = 0; ns < frame_size; ns++) {
+            samples[ns] = nth_sample(pos + ns);
+        }
+
+        audio::Frame frame(samples, frame_size);
+        fanout.write(frame);
+
+        pos += frame_size;
+    }
+}
+
+void check_samples(const TestSink& sink, size_t num_samples) {
+    UNSIGNED_LONGS_EQUAL(num_samples, sink.num_samples());
+
+    for (size_t n = 0; n < num_samples; n++) {
+        DOUBLES_EQUAL((double)nth_sample(n), (double)sink.sample(n), 0.0001);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(fanout_sink) {};
+
+TEST(fanout_sink, no_outputs) {
+    FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+    CHECK(fanout.valid());
+
+    UNSIGNED_LONGS_EQUAL(0, fanout.num_outputs());
+
+    CHECK(!fanout.has_clock());
+    LONGS_EQUAL(0, fanout.latency());
+
+    size_t pos = 0;
+    write_frames(fanout, NumFrames, FrameSize, pos);
+}
+
+TEST(fanout_sink, one_output) {
+    TestSink sink(true);
+
+    {
+        FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+        CHECK(fanout.valid());
+
+        CHECK(fanout.add_output(sink));
+        UNSIGNED_LONGS_EQUAL(1, fanout.num_outputs());
+
+        size_t pos = 0;
+        write_frames(fanout, NumFrames, FrameSize, pos);
+
+        UNSIGNED_LONGS_EQUAL(0, fanout.num_drops(0));
+    }
+
+    check_samples(sink, NumFrames * FrameSize);
+    UNSIGNED_LONGS_EQUAL(NumFrames, sink.num_writes());
+}
+
+TEST(fanout_sink, multiple_outputs) {
+    TestSink sink1(true);
+    TestSink sink2(false);
+    TestSink sink3(false);
+
+    {
+        FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+        CHECK(fanout.valid());
+
+        CHECK(fanout.add_output(sink1));
+        CHECK(fanout.add_output(sink2));
+        CHECK(fanout.add_output(sink3));
+        UNSIGNED_LONGS_EQUAL(3, fanout.num_outputs());
+
+        size_t pos = 0;
+        for (size_t n = 0; n < NumFrames; n++) {
+            write_frames(fanout, 1, FrameSize, pos);
+
+            // let non-master outputs keep up
+            while (sink2.num_writes() != n + 1 || sink3.num_writes() != n + 1) {
+                core::sleep_for(core::ClockMonotonic, core::Microsecond * 10);
+            }
+        }
+
+        UNSIGNED_LONGS_EQUAL(0, fanout.num_drops(0));
+        UNSIGNED_LONGS_EQUAL(0, fanout.num_drops(1));
+        UNSIGNED_LONGS_EQUAL(0, fanout.num_drops(2));
+    }
+
+    check_samples(sink1, NumFrames * FrameSize);
+    check_samples(sink2, NumFrames * FrameSize);
+    check_samples(sink3, NumFrames * FrameSize);
+}
+
+TEST(fanout_sink, split_large_frames) {
+    TestSink sink(true);
+
+    enum { LargeFrameSize = FrameSize * 3 + NumCh * 2 };
+
+    {
+        FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+        CHECK(fanout.valid());
+
+        CHECK(fanout.add_output(sink));
+
+        size_t pos = 0;
+        write_frames(fanout, 5, LargeFrameSize, pos);
+    }
+
+    check_samples(sink, 5 * LargeFrameSize);
+    UNSIGNED_LONGS_EQUAL(5 * 4, sink.num_writes());
+}
+
+TEST(fanout_sink, clock_master) {
+    TestSink sink1(false);
+    TestSink sink2(true);
+    TestSink sink3(true);
+
+    FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+    CHECK(fanout.valid());
+
+    CHECK(fanout.add_output(sink1));
+    CHECK(!fanout.has_clock());
+    LONGS_EQUAL(0, fanout.preferred_frame_length());
+
+    CHECK(fanout.add_output(sink2));
+    CHECK(fanout.add_output(sink3));
+
+    CHECK(fanout.has_clock());
+    LONGS_EQUAL(FrameLength / 2, fanout.preferred_frame_length());
+}
+
+TEST(fanout_sink, slow_output) {
+    TestSink master(true);
+    TestSink slow(false);
+
+    slow.close_gate();
+
+    {
+        FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+        CHECK(fanout.valid());
+
+        CHECK(fanout.add_output(master));
+        CHECK(fanout.add_output(slow));
+
+        // slow output is blocked, but writer is paced only by master
+        size_t pos = 0;
+        write_frames(fanout, NumFrames, FrameSize, pos);
+
+        CHECK(fanout.num_drops(1) > 0);
+        UNSIGNED_LONGS_EQUAL(0, fanout.num_drops(0));
+
+        slow.open_gate();
+    }
+
+    check_samples(master, NumFrames * FrameSize);
+
+    CHECK(slow.num_samples() < NumFrames * FrameSize);
+    CHECK(slow.num_samples() >= QueueFrames * FrameSize);
+}
+
+TEST(fanout_sink, pause_resume) {
+    TestSink sink1(true);
+    TestSink sink2(false);
+
+    {
+        FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+        CHECK(fanout.valid());
+
+        CHECK(fanout.add_output(sink1));
+        CHECK(fanout.add_output(sink2));
+
+        size_t pos = 0;
+        write_frames(fanout, 2, FrameSize, pos);
+
+        fanout.pause();
+
+        write_frames(fanout, 1, FrameSize, pos);
+
+        CHECK(fanout.resume());
+
+        write_frames(fanout, 1, FrameSize, pos);
+    }
+
+    // commands are applied in order with frames
+    UNSIGNED_LONGS_EQUAL(1, sink1.num_pauses());
+    UNSIGNED_LONGS_EQUAL(1, sink1.num_resumes());
+    UNSIGNED_LONGS_EQUAL(2 * FrameSize, sink1.pause_pos());
+    UNSIGNED_LONGS_EQUAL(3 * FrameSize, sink1.resume_pos());
+
+    UNSIGNED_LONGS_EQUAL(1, sink2.num_pauses());
+    UNSIGNED_LONGS_EQUAL(1, sink2.num_resumes());
+    UNSIGNED_LONGS_EQUAL(2 * FrameSize, sink2.pause_pos());
+    UNSIGNED_LONGS_EQUAL(3 * FrameSize, sink2.resume_pos());
+}
+
+TEST(fanout_sink, spec_mismatch) {
+    class MonoSink : public TestSink {
+    public:
+        MonoSink()
+            : TestSink(true) {
+        }
+
+        virtual audio::SampleSpec sample_spec() const {
+            return audio::SampleSpec(SampleRate, 0x1);
+        }
+    };
+
+    MonoSink sink;
+
+    FanoutSink fanout(SampleSpecs, FrameLength, QueueLength, allocator);
+    CHECK(fanout.valid());
+
+    CHECK(!fanout.add_output(sink));
+    UNSIGNED_LONGS_EQUAL(0, fanout.num_outputs());
+}
+
+} // namespace sndio
+} // namespace roc
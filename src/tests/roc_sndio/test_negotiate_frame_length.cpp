@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/stddefs.h"
+#include "roc_sndio/negotiate_frame_length.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum { SampleRate = 48000, ChMask = 0x3 };
+
+const audio::SampleSpec SampleSpecs(SampleRate, ChMask);
+
+class TestDevice : public IDevice {
+public:
+    explicit TestDevice(size_t period_size)
+        : period_size_(period_size) {
+    }
+
+    virtual DeviceType type() const {
+        return DeviceType_Sink;
+    }
+
+    virtual DeviceState state() const {
+        return DeviceState_Active;
+    }
+
+    virtual void pause() {
+    }
+
+    virtual bool resume() {
+        return true;
+    }
+
+    virtual bool restart() {
+        return true;
+    }
+
+    virtual audio::SampleSpec sample_spec() const {
+        return SampleSpecs;
+    }
+
+    virtual core::nanoseconds_t latency() const {
+        return 0;
+    }
+
+    virtual bool has_clock() const {
+        return true;
+    }
+
+    virtual core::nanoseconds_t preferred_frame_length() const {
+        return SampleSpecs.samples_per_chan_2_ns(period_size_);
+    }
+
+private:
+    size_t period_size_;
+};
+
+size_t negotiate(size_t period_size, size_t frame_size) {
+    TestDevice device(period_size);
+
+    return SampleSpecs.ns_2_samples_per_chan(negotiate_frame_length(
+        device, SampleSpecs.samples_per_chan_2_ns(frame_size)));
+}
+
+} // namespace
+
+TEST_GROUP(negotiate_frame_length) {};
+
+TEST(negotiate_frame_length, no_preference) {
+    UNSIGNED_LONGS_EQUAL(336, negotiate(0, 336));
+}
+
+TEST(negotiate_frame_length, equal) {
+    UNSIGNED_LONGS_EQUAL(480, negotiate(480, 480));
+}
+
+TEST(negotiate_frame_length, period_smaller) {
+    // one frame per period
+    UNSIGNED_LONGS_EQUAL(256, negotiate(256, 336));
+}
+
+TEST(negotiate_frame_length, period_larger) {
+    // three frames per period
+    UNSIGNED_LONGS_EQUAL(320, negotiate(960, 336));
+
+    // two frames per period
+    UNSIGNED_LONGS_EQUAL(512, negotiate(1024, 700));
+}
+
+TEST(negotiate_frame_length, skip_non_divisors) {
+    // 1000 is not divisible by 3, but is divisible by 4
+    UNSIGNED_LONGS_EQUAL(250, negotiate(1000, 336));
+}
+
+TEST(negotiate_frame_length, no_suitable_divisor) {
+    // 1009 is prime, all divisors are too small
+    UNSIGNED_LONGS_EQUAL(336, negotiate(1009, 336));
+}
+
+} // namespace sndio
+} // namespace roc
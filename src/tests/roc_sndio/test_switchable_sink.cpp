@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/atomic.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_sndio/switchable_sink.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum { SampleRate = 44100, ChMask = 0x3, FrameSize = 20 };
+
+class TestSink : public ISink {
+public:
+    TestSink(size_t sample_rate, bool clock)
+        : sample_rate_(sample_rate)
+        , clock_(clock)
+        , paused_(false)
+        , n_samples_(0)
+        , n_writes_(0) {
+    }
+
+    size_t num_samples() const {
+        return n_samples_;
+    }
+
+    size_t num_writes() const {
+        return n_writes_;
+    }
+
+    virtual DeviceType type() const {
+        return DeviceType_Sink;
+    }
+
+    virtual DeviceState state() const {
+        return paused_ ? DeviceState_Paused : DeviceState_Active;
+    }
+
+    virtual void pause() {
+        paused_ = true;
+    }
+
+    virtual bool resume() {
+        paused_ = false;
+        return true;
+    }
+
+    virtual bool restart() {
+        paused_ = false;
+        return true;
+    }
+
+    virtual audio::SampleSpec sample_spec() const {
+        return audio::SampleSpec(sample_rate_, ChMask);
+    }
+
+    virtual core::nanoseconds_t latency() const {
+        return 0;
+    }
+
+    virtual bool has_clock() const {
+        return clock_;
+    }
+
+    virtual void write(audio::Frame& frame) {
+        n_samples_ += frame.num_samples();
+        n_writes_++;
+    }
+
+private:
+    const size_t sample_rate_;
+    const bool clock_;
+
+    bool paused_;
+    size_t n_samples_;
+    size_t n_writes_;
+};
+
+class Writer : public core::Thread {
+public:
+    explicit Writer(ISink& sink)
+        : sink_(sink)
+        , stop_(false)
+        , n_writes_(0) {
+    }
+
+    void stop() {
+        stop_ = true;
+    }
+
+    size_t num_writes() const {
+        return n_writes_;
+    }
+
+private:
+    virtual void run() {
+        audio::sample_t samples[FrameSize] = {};
+
+        while (!stop_) {
+            audio::Frame frame(samples, FrameSize);
+            sink_.write(frame);
+            n_writes_++;
+        }
+    }
+
+    ISink& sink_;
+    core::Atomic<int> stop_;
+    core::Atomic<size_t> n_writes_;
+};
+
+void write_frames(ISink& sink, size_t n_frames) {
+    audio::sample_t samples[FrameSize] = {};
+
+    for (size_t n = 0; n < n_frames; n++) {
+        audio::Frame frame(samples, FrameSize);
+        sink.write(frame);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(switchable_sink) {};
+
+TEST(switchable_sink, forward) {
+    TestSink sink(SampleRate, true);
+
+    SwitchableSink switchable(sink);
+
+    CHECK(switchable.has_clock());
+    UNSIGNED_LONGS_EQUAL(SampleRate, switchable.sample_spec().sample_rate());
+
+    write_frames(switchable, 10);
+
+    UNSIGNED_LONGS_EQUAL(10 * FrameSize, sink.num_samples());
+    UNSIGNED_LONGS_EQUAL(0, switchable.num_switches());
+}
+
+TEST(switchable_sink, switch_between_frames) {
+    TestSink sink1(SampleRate, true);
+    TestSink sink2(SampleRate, true);
+
+    SwitchableSink switchable(sink1);
+
+    write_frames(switchable, 10);
+
+    POINTERS_EQUAL(&sink1, switchable.switch_sink(sink2));
+    UNSIGNED_LONGS_EQUAL(1, switchable.num_switches());
+
+    write_frames(switchable, 5);
+
+    UNSIGNED_LONGS_EQUAL(10, sink1.num_writes());
+    UNSIGNED_LONGS_EQUAL(5, sink2.num_writes());
+
+    POINTERS_EQUAL(&sink2, switchable.switch_sink(sink1));
+    UNSIGNED_LONGS_EQUAL(2, switchable.num_switches());
+
+    write_frames(switchable, 3);
+
+    UNSIGNED_LONGS_EQUAL(13, sink1.num_writes());
+    UNSIGNED_LONGS_EQUAL(5, sink2.num_writes());
+}
+
+TEST(switchable_sink, switch_to_same) {
+    TestSink sink(SampleRate, true);
+
+    SwitchableSink switchable(sink);
+
+    POINTERS_EQUAL(&sink, switchable.switch_sink(sink));
+    UNSIGNED_LONGS_EQUAL(0, switchable.num_switches());
+}
+
+TEST(switchable_sink, incompatible) {
+    TestSink sink1(SampleRate, true);
+    TestSink sink2(SampleRate * 2, true);
+    TestSink sink3(SampleRate, false);
+
+    SwitchableSink switchable(sink1);
+
+    POINTERS_EQUAL(NULL, switchable.switch_sink(sink2));
+    POINTERS_EQUAL(NULL, switchable.switch_sink(sink3));
+    UNSIGNED_LONGS_EQUAL(0, switchable.num_switches());
+
+    write_frames(switchable, 10);
+
+    UNSIGNED_LONGS_EQUAL(10, sink1.num_writes());
+    UNSIGNED_LONGS_EQUAL(0, sink2.num_writes());
+    UNSIGNED_LONGS_EQUAL(0, sink3.num_writes());
+}
+
+TEST(switchable_sink, keep_paused) {
+    TestSink sink1(SampleRate, true);
+    TestSink sink2(SampleRate, true);
+
+    SwitchableSink switchable(sink1);
+
+    switchable.pause();
+    CHECK(switchable.state() == DeviceState_Paused);
+
+    POINTERS_EQUAL(&sink1, switchable.switch_sink(sink2));
+
+    CHECK(sink2.state() == DeviceState_Paused);
+    CHECK(switchable.state() == DeviceState_Paused);
+
+    CHECK(switchable.resume());
+    CHECK(sink2.state() == DeviceState_Active);
+}
+
+TEST(switchable_sink, concurrent_switch) {
+    TestSink sink1(SampleRate, true);
+    TestSink sink2(SampleRate, true);
+
+    SwitchableSink switchable(sink1);
+
+    Writer writer(switchable);
+    CHECK(writer.start());
+
+    for (size_t n = 0; n < 100; n++) {
+        CHECK(switchable.switch_sink(n % 2 == 0 ? sink2 : sink1));
+    }
+
+    writer.stop();
+    writer.join();
+
+    UNSIGNED_LONGS_EQUAL(100, switchable.num_switches());
+    UNSIGNED_LONGS_EQUAL(writer.num_writes(), sink1.num_writes() + sink2.num_writes());
+    UNSIGNED_LONGS_EQUAL(writer.num_writes() * FrameSize,
+                         sink1.num_samples() + sink2.num_samples());
+}
+
+} // namespace sndio
+} // namespace roc
@@ -83,6 +83,19 @@ int main(int argc, char** argv) {
         }
     }
 
+    core::nanoseconds_t block_length = converter_config.internal_frame_length;
+
+    if (args.block_length_given) {
+        if (!core::parse_duration(args.block_length_arg, block_length)) {
+            roc_log(LogError, "invalid --block-length: bad format");
+            return 1;
+        }
+        if (block_length < converter_config.internal_frame_length) {
+            roc_log(LogError, "invalid --block-length: should be >= --frame-length");
+            return 1;
+        }
+    }
+
     sndio::BackendMap::instance().set_frame_size(converter_config.internal_frame_length,
                                                  converter_config.input_sample_spec);
 
@@ -92,6 +105,10 @@ int main(int argc, char** argv) {
             converter_config.internal_frame_length),
         args.poisoning_flag);
 
+    core::BufferFactory<audio::sample_t> block_buffer_factory(
+        allocator, converter_config.input_sample_spec.ns_2_samples_overall(block_length),
+        args.poisoning_flag);
+
     sndio::Config source_config;
     source_config.sample_spec.set_channel_mask(
         converter_config.input_sample_spec.channel_mask());
@@ -224,9 +241,10 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    sndio::Pump pump(buffer_factory, *input_source, NULL, converter,
-                     converter_config.internal_frame_length,
-                     converter_config.input_sample_spec, sndio::Pump::ModePermanent);
+    // both input and output are files, so frames are moved as fast as possible
+    sndio::Pump pump(block_buffer_factory, *input_source, NULL, converter, block_length,
+                     converter_config.input_sample_spec, sndio::Pump::ModePermanent,
+                     sndio::Pump::ClockNone);
     if (!pump.valid()) {
         roc_log(LogError, "can't create audio pump");
         return 1;
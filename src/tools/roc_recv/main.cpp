@@ -10,25 +10,295 @@
 #include "roc_address/io_uri.h"
 #include "roc_audio/resampler_profile.h"
 #include "roc_core/array.h"
+#include "roc_core/cond.h"
 #include "roc_core/crash_handler.h"
 #include "roc_core/heap_allocator.h"
 #include "roc_core/log.h"
+#include "roc_core/mutex.h"
 #include "roc_core/parse_duration.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_core/thread.h"
 #include "roc_netio/network_loop.h"
+#include "roc_packet/capture_writer.h"
 #include "roc_peer/context.h"
 #include "roc_peer/receiver.h"
 #include "roc_pipeline/converter_source.h"
 #include "roc_pipeline/receiver_source.h"
+#include "roc_pipeline/session_state_store.h"
+#include "roc_rtp/srtp_config.h"
 #include "roc_sndio/backend_dispatcher.h"
 #include "roc_sndio/backend_map.h"
+#include "roc_sndio/fanout_sink.h"
+#include "roc_sndio/negotiate_frame_length.h"
 #include "roc_sndio/print_supported.h"
 #include "roc_sndio/pump.h"
 
 #include "roc_recv/cmdline.h"
+#include "streams_file.h"
 
 using namespace roc;
 
+namespace {
+
+enum { MaxTeeOutputs = 8 };
+
+// length of per-output queues of fanout sink, if --io-queue is not given
+const core::nanoseconds_t DefaultTeeQueueLength = 200 * core::Millisecond;
+
+// how often --state-file is rewritten while receiver is running
+const core::nanoseconds_t StateFileSaveInterval = 5 * core::Second;
+
+// receiver, output, and pump of one stream of --streams file;
+// all streams share peer context, and thus network thread and pools
+// Periodically writes session state store to --state-file, so that state
+// survives if the process is killed, and once more when destroyed. Should be
+// destroyed after receivers, which save state of their sessions on destruction.
+class StateFileSaver : public core::Thread {
+public:
+    StateFileSaver(pipeline::SessionStateStore& store, const char* path)
+        : store_(store)
+        , path_(path)
+        , cond_(mutex_)
+        , stop_(false) {
+    }
+
+    ~StateFileSaver() {
+        if (joinable()) {
+            {
+                core::Mutex::Lock lock(mutex_);
+                stop_ = true;
+                cond_.signal();
+            }
+            join();
+        }
+
+        store_.save(path_);
+    }
+
+private:
+    virtual void run() {
+        core::Mutex::Lock lock(mutex_);
+
+        while (!stop_) {
+            cond_.timed_wait(StateFileSaveInterval);
+
+            if (!stop_) {
+                store_.save(path_);
+            }
+        }
+    }
+
+    pipeline::SessionStateStore& store_;
+    const char* path_;
+
+    core::Mutex mutex_;
+    core::Cond cond_;
+    bool stop_;
+};
+
+class ReceiverStream : public core::Thread {
+public:
+    ReceiverStream(size_t index, peer::Context& context)
+        : index_(index)
+        , context_(context)
+        , ok_(false) {
+    }
+
+    ~ReceiverStream() {
+        if (joinable()) {
+            pump_->stop();
+            join();
+        }
+    }
+
+    bool open(const tools::StreamUris& uris,
+              const gengetopt_args_info& args,
+              sndio::BackendDispatcher& backend_dispatcher,
+              pipeline::ReceiverConfig receiver_config,
+              const sndio::Config& io_config,
+              pipeline::SessionStateStore* session_store) {
+        address::IoUri output_uri(context_.allocator());
+        if (*uris.device) {
+            if (!address::parse_io_uri(uris.device, output_uri)
+                || output_uri.is_special_file()) {
+                roc_log(LogError, "stream %lu: invalid output file or device URI: %s",
+                        (unsigned long)index_, uris.device);
+                return false;
+            }
+            sink_.reset(backend_dispatcher.open_sink(output_uri, NULL, io_config,
+                                                     context_.allocator()),
+                        context_.allocator());
+        } else {
+            sink_.reset(
+                backend_dispatcher.open_default_sink(io_config, context_.allocator()),
+                context_.allocator());
+        }
+        if (!sink_) {
+            roc_log(LogError, "stream %lu: can't open output file or device: uri=%s",
+                    (unsigned long)index_, uris.device);
+            return false;
+        }
+
+        receiver_config.common.timing = !sink_->has_clock();
+        receiver_config.common.output_sample_spec.set_sample_rate(
+            sink_->sample_spec().sample_rate());
+
+        if (receiver_config.common.output_sample_spec.sample_rate() == 0) {
+            roc_log(LogError, "stream %lu: can't detect output sample rate",
+                    (unsigned long)index_);
+            return false;
+        }
+
+        if (!args.frame_length_given) {
+            receiver_config.common.internal_frame_length = sndio::negotiate_frame_length(
+                *sink_, receiver_config.common.internal_frame_length);
+        }
+
+        receiver_.reset(new (context_.allocator())
+                            peer::Receiver(context_, receiver_config),
+                        context_.allocator());
+        if (!receiver_ || !receiver_->valid()) {
+            roc_log(LogError, "stream %lu: can't create receiver peer",
+                    (unsigned long)index_);
+            return false;
+        }
+
+        receiver_->set_session_store(session_store);
+
+        if (!bind_(args, address::Iface_AudioSource, uris.source)
+            || !bind_(args, address::Iface_AudioRepair, uris.repair)
+            || !bind_(args, address::Iface_AudioControl, uris.control)) {
+            return false;
+        }
+
+        pump_.reset(new (context_.allocator()) sndio::Pump(
+                        context_.sample_buffer_factory(), receiver_->source(), NULL,
+                        *sink_, receiver_config.common.internal_frame_length,
+                        receiver_config.common.output_sample_spec,
+                        args.oneshot_flag ? sndio::Pump::ModeOneshot
+                                          : sndio::Pump::ModePermanent,
+                        args.sink_clock_flag ? sndio::Pump::ClockSink
+                                             : sndio::Pump::ClockDefault),
+                    context_.allocator());
+        if (!pump_ || !pump_->valid()) {
+            roc_log(LogError, "stream %lu: can't create pump", (unsigned long)index_);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ok() const {
+        return ok_;
+    }
+
+private:
+    bool
+    bind_(const gengetopt_args_info& args, address::Interface iface, const char* uri) {
+        if (!*uri) {
+            return true;
+        }
+
+        address::EndpointUri endpoint(context_.allocator());
+        if (!address::parse_endpoint_uri(uri, address::EndpointUri::Subset_Full,
+                                         endpoint)) {
+            roc_log(LogError, "stream %lu: can't parse %s endpoint: %s",
+                    (unsigned long)index_, address::interface_to_str(iface), uri);
+            return false;
+        }
+
+        if (args.reuseaddr_given && !receiver_->set_reuseaddr(0, iface, true)) {
+            roc_log(LogError, "stream %lu: can't set reuseaddr option for %s endpoint",
+                    (unsigned long)index_, address::interface_to_str(iface));
+            return false;
+        }
+
+        if (args.sock_buf_size_given
+            && !receiver_->set_socket_buffer_size(0, iface,
+                                                  (size_t)args.sock_buf_size_arg)) {
+            roc_log(LogError, "stream %lu: can't set socket buffer size for %s endpoint",
+                    (unsigned long)index_, address::interface_to_str(iface));
+            return false;
+        }
+
+        if (!receiver_->bind(0, iface, endpoint)) {
+            roc_log(LogError, "stream %lu: can't bind %s endpoint: %s",
+                    (unsigned long)index_, address::interface_to_str(iface), uri);
+            return false;
+        }
+
+        return true;
+    }
+
+    virtual void run() {
+        ok_ = pump_->run();
+    }
+
+    const size_t index_;
+    peer::Context& context_;
+
+    core::ScopedPtr<sndio::ISink> sink_;
+    core::ScopedPtr<peer::Receiver> receiver_;
+    core::ScopedPtr<sndio::Pump> pump_;
+
+    bool ok_;
+};
+
+int run_streams(const gengetopt_args_info& args,
+                peer::Context& context,
+                sndio::BackendDispatcher& backend_dispatcher,
+                const pipeline::ReceiverConfig& receiver_config,
+                const sndio::Config& io_config,
+                pipeline::SessionStateStore* session_store) {
+    if (args.output_given || args.output_format_given || args.tee_given
+        || args.backup_given || args.source_given || args.repair_given
+        || args.control_given || args.miface_given || args.capture_given) {
+        roc_log(LogError,
+                "--streams can't be used together with --output, --output-format,"
+                " --tee, --backup, --source, --repair, --control, --miface,"
+                " or --capture");
+        return 1;
+    }
+
+    core::Array<tools::StreamUris> uris(context.allocator());
+    if (!tools::parse_streams_file(args.streams_arg, "output", uris)) {
+        return 1;
+    }
+
+    roc_log(LogInfo, "starting %lu streams from --streams file",
+            (unsigned long)uris.size());
+
+    core::ScopedPtr<ReceiverStream> streams[tools::MaxStreams];
+
+    for (size_t n = 0; n < uris.size(); n++) {
+        streams[n].reset(new (context.allocator()) ReceiverStream(n, context),
+                         context.allocator());
+        if (!streams[n]
+            || !streams[n]->open(uris[n], args, backend_dispatcher, receiver_config,
+                                 io_config, session_store)) {
+            return 1;
+        }
+    }
+
+    for (size_t n = 0; n < uris.size(); n++) {
+        if (!streams[n]->start()) {
+            roc_log(LogError, "stream %lu: can't start thread", (unsigned long)n);
+            return 1;
+        }
+    }
+
+    bool ok = true;
+
+    for (size_t n = 0; n < uris.size(); n++) {
+        streams[n]->join();
+        ok = streams[n]->ok() && ok;
+    }
+
+    return ok ? 0 : 1;
+}
+
+} // namespace
+
 int main(int argc, char** argv) {
     core::HeapAllocator::enable_panic_on_leak();
 
@@ -63,6 +333,13 @@ int main(int argc, char** argv) {
         break;
     }
 
+    if (args.async_log_flag) {
+        if (!core::Logger::instance().set_async(true)) {
+            roc_log(LogError, "can't enable asynchronous logging");
+            return 1;
+        }
+    }
+
     peer::ContextConfig context_config;
 
     context_config.poisoning = args.poisoning_flag;
@@ -102,6 +379,13 @@ int main(int argc, char** argv) {
 
     pipeline::ReceiverConfig receiver_config;
 
+    if (args.low_latency_flag) {
+        receiver_config.common.internal_frame_length =
+            pipeline::LowLatencyInternalFrameLength;
+        receiver_config.common.control_interval = pipeline::LowLatencyControlInterval;
+        receiver_config.tasks.enable_precise_task_scheduling = false;
+    }
+
     if (args.frame_length_given) {
         if (!core::parse_duration(args.frame_length_arg,
                                   receiver_config.common.internal_frame_length)) {
@@ -154,6 +438,11 @@ int main(int argc, char** argv) {
             * pipeline::DefaultMaxLatencyFactor;
     }
 
+    receiver_config.default_session.latency_monitor.adaptive_latency =
+        args.adaptive_latency_flag;
+    receiver_config.default_session.latency_monitor.sync_playback =
+        args.sync_playback_flag;
+
     if (args.np_timeout_given) {
         if (!core::parse_duration(
                 args.np_timeout_arg,
@@ -220,6 +509,78 @@ int main(int argc, char** argv) {
     receiver_config.common.poisoning = args.poisoning_flag;
     receiver_config.common.profiling = args.profiling_flag;
     receiver_config.common.beeping = args.beeping_flag;
+    receiver_config.common.concealment = args.plc_flag;
+    receiver_config.common.multiplexing = args.mux_flag;
+
+    if (args.record_dir_given) {
+        receiver_config.common.recording_dir = args.record_dir_arg;
+    }
+
+    if (args.srtp_key_given) {
+        if (!rtp::parse_srtp_key(args.srtp_key_arg, receiver_config.common.srtp)) {
+            roc_log(LogError, "invalid --srtp-key: should be base64 of 30 bytes");
+            return 1;
+        }
+    }
+
+    packet::ImpairerConfig& impairer_config = receiver_config.common.impairment;
+
+    if (args.impair_loss_given || args.impair_burst_given) {
+        const double loss = args.impair_loss_given ? args.impair_loss_arg : 0;
+        const double burst = args.impair_burst_given ? args.impair_burst_arg : 1;
+        if (!impairer_config.set_loss(float(loss / 100), float(burst))) {
+            roc_log(LogError,
+                    "invalid --impair-loss or --impair-burst: loss should be in"
+                    " range [0; 100), burst should be >= 1, and loss can't exceed"
+                    " burst / (burst + 1) * 100");
+            return 1;
+        }
+    }
+
+    if (args.impair_delay_given) {
+        if (!core::parse_duration(args.impair_delay_arg, impairer_config.delay)
+            || impairer_config.delay < 0) {
+            roc_log(LogError, "invalid --impair-delay");
+            return 1;
+        }
+    }
+
+    if (args.impair_jitter_given) {
+        if (!core::parse_duration(args.impair_jitter_arg, impairer_config.jitter)
+            || impairer_config.jitter < 0) {
+            roc_log(LogError, "invalid --impair-jitter");
+            return 1;
+        }
+    }
+
+    if (args.impair_reorder_given) {
+        if (args.impair_reorder_arg < 0 || args.impair_reorder_arg > 100) {
+            roc_log(LogError, "invalid --impair-reorder: should be in range [0; 100]");
+            return 1;
+        }
+        impairer_config.reorder = float(args.impair_reorder_arg / 100);
+    }
+
+    if (args.impair_dup_given) {
+        if (args.impair_dup_arg < 0 || args.impair_dup_arg > 100) {
+            roc_log(LogError, "invalid --impair-dup: should be in range [0; 100]");
+            return 1;
+        }
+        impairer_config.duplicate = float(args.impair_dup_arg / 100);
+    }
+
+    if (args.impair_seed_given) {
+        impairer_config.seed = (uint32_t)args.impair_seed_arg;
+    }
+
+    if (impairer_config.enabled()) {
+        roc_log(LogInfo, "simulating network impairments on incoming packets");
+    }
+
+    if (args.sock_buf_size_given && args.sock_buf_size_arg <= 0) {
+        roc_log(LogError, "invalid --sock-buf-size: should be > 0");
+        return 1;
+    }
 
     sndio::Config io_config;
     io_config.frame_length = receiver_config.common.internal_frame_length;
@@ -233,6 +594,13 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (args.io_queue_given) {
+        if (!core::parse_duration(args.io_queue_arg, io_config.queue_length)) {
+            roc_log(LogError, "invalid --io-queue");
+            return 1;
+        }
+    }
+
     if (args.rate_given) {
         if (args.rate_arg <= 0) {
             roc_log(LogError, "invalid --rate: should be > 0");
@@ -245,6 +613,33 @@ int main(int argc, char** argv) {
         }
     }
 
+    // declared before receivers, to be destroyed after them
+    pipeline::SessionStateStore session_store;
+    core::ScopedPtr<StateFileSaver> state_saver;
+
+    if (args.state_file_given) {
+        if (!session_store.load(args.state_file_arg)) {
+            roc_log(LogError, "can't load --state-file: %s", args.state_file_arg);
+            return 1;
+        }
+
+        state_saver.reset(new (context.allocator())
+                              StateFileSaver(session_store, args.state_file_arg),
+                          context.allocator());
+        if (!state_saver || !state_saver->start()) {
+            roc_log(LogError, "can't start --state-file saver");
+            return 1;
+        }
+    }
+
+    pipeline::SessionStateStore* session_store_ptr =
+        args.state_file_given ? &session_store : NULL;
+
+    if (args.streams_given) {
+        return run_streams(args, context, backend_dispatcher, receiver_config,
+                           io_config, session_store_ptr);
+    }
+
     address::IoUri output_uri(context.allocator());
     if (args.output_given) {
         if (!address::parse_io_uri(args.output_arg, output_uri)) {
@@ -293,6 +688,78 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    if (!args.frame_length_given) {
+        // align frames to device period to avoid partial writes
+        receiver_config.common.internal_frame_length = sndio::negotiate_frame_length(
+            *output_sink, receiver_config.common.internal_frame_length);
+    }
+
+    // declared after output sinks, to be destroyed (and join output threads)
+    // before them
+    core::ScopedPtr<sndio::ISink> tee_sinks[MaxTeeOutputs];
+    core::ScopedPtr<sndio::FanoutSink> fanout_sink;
+
+    sndio::ISink* pump_sink = output_sink.get();
+
+    if (args.tee_given) {
+        if (args.tee_given > MaxTeeOutputs) {
+            roc_log(LogError, "too many --tee outputs: count=%u max=%u",
+                    (unsigned)args.tee_given, (unsigned)MaxTeeOutputs);
+            return 1;
+        }
+
+        sndio::Config tee_config = io_config;
+        tee_config.frame_length = receiver_config.common.internal_frame_length;
+        tee_config.sample_spec.set_sample_rate(
+            receiver_config.common.output_sample_spec.sample_rate());
+
+        fanout_sink.reset(new (context.allocator()) sndio::FanoutSink(
+                              receiver_config.common.output_sample_spec,
+                              receiver_config.common.internal_frame_length,
+                              args.io_queue_given ? io_config.queue_length
+                                                  : DefaultTeeQueueLength,
+                              context.allocator()),
+                          context.allocator());
+
+        if (!fanout_sink || !fanout_sink->valid()) {
+            roc_log(LogError, "can't create fanout sink");
+            return 1;
+        }
+
+        if (!fanout_sink->add_output(*output_sink)) {
+            roc_log(LogError, "can't add output to fanout sink");
+            return 1;
+        }
+
+        for (size_t n = 0; n < args.tee_given; n++) {
+            address::IoUri tee_uri(context.allocator());
+            if (!address::parse_io_uri(args.tee_arg[n], tee_uri)) {
+                roc_log(LogError, "invalid --tee file or device URI: %s",
+                        args.tee_arg[n]);
+                return 1;
+            }
+
+            tee_sinks[n].reset(backend_dispatcher.open_sink(tee_uri, NULL, tee_config,
+                                                            context.allocator()),
+                               context.allocator());
+            if (!tee_sinks[n]) {
+                roc_log(LogError, "can't open --tee file or device: uri=%s",
+                        args.tee_arg[n]);
+                return 1;
+            }
+
+            if (!fanout_sink->add_output(*tee_sinks[n])) {
+                roc_log(LogError, "can't add --tee output: uri=%s", args.tee_arg[n]);
+                return 1;
+            }
+        }
+
+        // clock master may be any of the outputs
+        receiver_config.common.timing = !fanout_sink->has_clock();
+
+        pump_sink = fanout_sink.get();
+    }
+
     core::ScopedPtr<sndio::ISource> backup_source;
     core::ScopedPtr<pipeline::ConverterSource> backup_pipeline;
 
@@ -359,12 +826,26 @@ int main(int argc, char** argv) {
         }
     }
 
+    packet::CaptureWriter capture_writer;
+    if (args.capture_given) {
+        if (!capture_writer.open(args.capture_arg)) {
+            roc_log(LogError, "can't open --capture file: %s", args.capture_arg);
+            return 1;
+        }
+    }
+
     peer::Receiver receiver(context, receiver_config);
     if (!receiver.valid()) {
         roc_log(LogError, "can't create receiver peer");
         return 1;
     }
 
+    if (args.capture_given) {
+        receiver.set_capture_writer(&capture_writer);
+    }
+
+    receiver.set_session_store(session_store_ptr);
+
     if (args.source_given == 0) {
         roc_log(LogError, "at least one --source endpoint should be specified");
         return 1;
@@ -419,6 +900,14 @@ int main(int argc, char** argv) {
             }
         }
 
+        if (args.sock_buf_size_given) {
+            if (!receiver.set_socket_buffer_size(slot, address::Iface_AudioSource,
+                                                 (size_t)args.sock_buf_size_arg)) {
+                roc_log(LogError, "can't set socket buffer size for --source endpoint");
+                return 1;
+            }
+        }
+
         if (!receiver.bind(slot, address::Iface_AudioSource, endpoint)) {
             roc_log(LogError, "can't bind --source endpoint: %s", args.source_arg[slot]);
             return 1;
@@ -450,6 +939,14 @@ int main(int argc, char** argv) {
             }
         }
 
+        if (args.sock_buf_size_given) {
+            if (!receiver.set_socket_buffer_size(slot, address::Iface_AudioRepair,
+                                                 (size_t)args.sock_buf_size_arg)) {
+                roc_log(LogError, "can't set socket buffer size for --repair endpoint");
+                return 1;
+            }
+        }
+
         if (!receiver.bind(slot, address::Iface_AudioRepair, endpoint)) {
             roc_log(LogError, "can't bind --repair port: %s", args.repair_arg[slot]);
             return 1;
@@ -482,6 +979,14 @@ int main(int argc, char** argv) {
             }
         }
 
+        if (args.sock_buf_size_given) {
+            if (!receiver.set_socket_buffer_size(slot, address::Iface_AudioControl,
+                                                 (size_t)args.sock_buf_size_arg)) {
+                roc_log(LogError, "can't set socket buffer size for --control endpoint");
+                return 1;
+            }
+        }
+
         if (!receiver.bind(slot, address::Iface_AudioControl, endpoint)) {
             roc_log(LogError, "can't bind --control endpoint: %s",
                     args.control_arg[slot]);
@@ -491,9 +996,10 @@ int main(int argc, char** argv) {
 
     sndio::Pump pump(
         context.sample_buffer_factory(), receiver.source(), backup_pipeline.get(),
-        *output_sink, receiver_config.common.internal_frame_length,
+        *pump_sink, receiver_config.common.internal_frame_length,
         receiver_config.common.output_sample_spec,
-        args.oneshot_flag ? sndio::Pump::ModeOneshot : sndio::Pump::ModePermanent);
+        args.oneshot_flag ? sndio::Pump::ModeOneshot : sndio::Pump::ModePermanent,
+        args.sink_clock_flag ? sndio::Pump::ClockSink : sndio::Pump::ClockDefault);
     if (!pump.valid()) {
         roc_log(LogError, "can't create pump");
         return 1;
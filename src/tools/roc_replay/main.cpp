@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_address/endpoint_uri.h"
+#include "roc_address/interface.h"
+#include "roc_address/io_uri.h"
+#include "roc_audio/resampler_profile.h"
+#include "roc_core/buffer_factory.h"
+#include "roc_core/crash_handler.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/parse_duration.h"
+#include "roc_core/scoped_ptr.h"
+#include "roc_core/time.h"
+#include "roc_packet/capture_reader.h"
+#include "roc_packet/packet_factory.h"
+#include "roc_pipeline/receiver_source.h"
+#include "roc_rtp/format_map.h"
+#include "roc_sndio/backend_dispatcher.h"
+#include "roc_sndio/backend_map.h"
+
+#include "roc_replay/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+bool add_endpoint(pipeline::ReceiverSlot& slot,
+                  address::Interface iface,
+                  const char* uri_str,
+                  const char* option,
+                  core::IAllocator& allocator,
+                  pipeline::ReceiverEndpoint* endpoints[]) {
+    address::EndpointUri uri(allocator);
+
+    if (!address::parse_endpoint_uri(uri_str, address::EndpointUri::Subset_Full, uri)) {
+        roc_log(LogError, "can't parse --%s endpoint: %s", option, uri_str);
+        return false;
+    }
+
+    if (!(endpoints[iface] = slot.create_endpoint(iface, uri.proto()))) {
+        roc_log(LogError, "can't create --%s endpoint: %s", option, uri_str);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::HeapAllocator::enable_panic_on_leak();
+
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedPtr<gengetopt_args_info, core::CustomAllocation> args_holder(
+        &args, &cmdline_parser_free);
+
+    core::Logger::instance().set_verbosity(args.verbose_given);
+
+    switch (args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(core::ColorsAuto);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsEnabled);
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsDisabled);
+        break;
+
+    default:
+        break;
+    }
+
+    core::HeapAllocator allocator;
+    sndio::BackendDispatcher backend_dispatcher;
+
+    pipeline::ReceiverConfig receiver_config;
+
+    if (args.frame_length_given) {
+        if (!core::parse_duration(args.frame_length_arg,
+                                  receiver_config.common.internal_frame_length)) {
+            roc_log(LogError, "invalid --frame-length: bad format");
+            return 1;
+        }
+        if (receiver_config.common.output_sample_spec.ns_2_samples_overall(
+                receiver_config.common.internal_frame_length)
+            <= 0) {
+            roc_log(LogError, "invalid --frame-length: should be > 0");
+            return 1;
+        }
+    }
+
+    sndio::BackendMap::instance().set_frame_size(
+        receiver_config.common.internal_frame_length,
+        receiver_config.common.output_sample_spec);
+
+    if (args.sess_latency_given) {
+        if (!core::parse_duration(args.sess_latency_arg,
+                                  receiver_config.default_session.target_latency)) {
+            roc_log(LogError, "invalid --sess-latency");
+            return 1;
+        }
+    }
+
+    if (args.min_latency_given) {
+        if (!core::parse_duration(
+                args.min_latency_arg,
+                receiver_config.default_session.latency_monitor.min_latency)) {
+            roc_log(LogError, "invalid --min-latency");
+            return 1;
+        }
+    } else {
+        receiver_config.default_session.latency_monitor.min_latency =
+            receiver_config.default_session.target_latency
+            * pipeline::DefaultMinLatencyFactor;
+    }
+
+    if (args.max_latency_given) {
+        if (!core::parse_duration(
+                args.max_latency_arg,
+                receiver_config.default_session.latency_monitor.max_latency)) {
+            roc_log(LogError, "invalid --max-latency");
+            return 1;
+        }
+    } else {
+        receiver_config.default_session.latency_monitor.max_latency =
+            receiver_config.default_session.target_latency
+            * pipeline::DefaultMaxLatencyFactor;
+    }
+
+    receiver_config.common.resampling = !args.no_resampling_flag;
+
+    switch (args.resampler_backend_arg) {
+    case resampler_backend_arg_default:
+        receiver_config.default_session.resampler_backend =
+            audio::ResamplerBackend_Default;
+        break;
+    case resampler_backend_arg_builtin:
+        receiver_config.default_session.resampler_backend =
+            audio::ResamplerBackend_Builtin;
+        break;
+    case resampler_backend_arg_speex:
+        receiver_config.default_session.resampler_backend = audio::ResamplerBackend_Speex;
+        break;
+    default:
+        break;
+    }
+
+    switch (args.resampler_profile_arg) {
+    case resampler_profile_arg_low:
+        receiver_config.default_session.resampler_profile = audio::ResamplerProfile_Low;
+        break;
+
+    case resampler_profile_arg_medium:
+        receiver_config.default_session.resampler_profile =
+            audio::ResamplerProfile_Medium;
+        break;
+
+    case resampler_profile_arg_high:
+        receiver_config.default_session.resampler_profile = audio::ResamplerProfile_High;
+        break;
+
+    default:
+        break;
+    }
+
+    receiver_config.common.poisoning = args.poisoning_flag;
+    receiver_config.common.profiling = args.profiling_flag;
+    receiver_config.common.beeping = args.beeping_flag;
+    receiver_config.common.concealment = args.plc_flag;
+    receiver_config.common.multiplexing = args.mux_flag;
+
+    // frames are produced as fast as possible, without waiting for clock
+    receiver_config.common.timing = false;
+
+    if (args.rate_given) {
+        if (args.rate_arg <= 0) {
+            roc_log(LogError, "invalid --rate: should be > 0");
+            return 1;
+        }
+        receiver_config.common.output_sample_spec.set_sample_rate((size_t)args.rate_arg);
+    }
+
+    sndio::Config sink_config;
+    sink_config.sample_spec = receiver_config.common.output_sample_spec;
+    sink_config.frame_length = receiver_config.common.internal_frame_length;
+
+    address::IoUri output_uri(allocator);
+    if (args.output_given) {
+        if (!address::parse_io_uri(args.output_arg, output_uri)
+            || !output_uri.is_file()) {
+            roc_log(LogError, "invalid --output file URI");
+            return 1;
+        }
+    }
+
+    if (!args.output_format_given && output_uri.is_special_file()) {
+        roc_log(LogError, "--output-format should be specified if --output is \"-\"");
+        return 1;
+    }
+
+    core::ScopedPtr<sndio::ISink> output_sink;
+    if (args.output_given) {
+        output_sink.reset(backend_dispatcher.open_sink(output_uri, args.output_format_arg,
+                                                       sink_config, allocator),
+                          allocator);
+        if (!output_sink) {
+            roc_log(LogError, "can't open output: %s", args.output_arg);
+            return 1;
+        }
+        if (output_sink->has_clock()) {
+            roc_log(LogError, "unsupported output: %s", args.output_arg);
+            return 1;
+        }
+    }
+
+    size_t max_packet_size = 2048;
+    if (args.packet_limit_given) {
+        if (args.packet_limit_arg <= 0) {
+            roc_log(LogError, "invalid --packet-limit: should be > 0");
+            return 1;
+        }
+        max_packet_size = (size_t)args.packet_limit_arg;
+    }
+
+    const size_t frame_size =
+        receiver_config.common.output_sample_spec.ns_2_samples_overall(
+            receiver_config.common.internal_frame_length);
+
+    packet::PacketFactory packet_factory(allocator, args.poisoning_flag);
+    core::BufferFactory<uint8_t> byte_buffer_factory(allocator, max_packet_size,
+                                                     args.poisoning_flag);
+    core::BufferFactory<audio::sample_t> sample_buffer_factory(allocator, frame_size,
+                                                               args.poisoning_flag);
+
+    rtp::FormatMap format_map;
+
+    pipeline::ReceiverSource receiver(receiver_config, format_map, packet_factory,
+                                      byte_buffer_factory, sample_buffer_factory,
+                                      allocator);
+    if (!receiver.valid()) {
+        roc_log(LogError, "can't create receiver pipeline");
+        return 1;
+    }
+
+    pipeline::ReceiverSlot* slot = receiver.create_slot();
+    if (!slot) {
+        roc_log(LogError, "can't create receiver slot");
+        return 1;
+    }
+
+    pipeline::ReceiverEndpoint* endpoints[address::Iface_Max] = {};
+
+    if (!add_endpoint(*slot, address::Iface_AudioSource, args.source_arg, "source",
+                      allocator, endpoints)) {
+        return 1;
+    }
+
+    if (args.repair_given) {
+        if (!add_endpoint(*slot, address::Iface_AudioRepair, args.repair_arg, "repair",
+                          allocator, endpoints)) {
+            return 1;
+        }
+    }
+
+    if (args.control_given) {
+        if (!add_endpoint(*slot, address::Iface_AudioControl, args.control_arg,
+                          "control", allocator, endpoints)) {
+            return 1;
+        }
+    }
+
+    packet::CaptureReader capture_reader(packet_factory, byte_buffer_factory);
+    if (!capture_reader.open(args.input_arg)) {
+        roc_log(LogError, "can't open --input capture file: %s", args.input_arg);
+        return 1;
+    }
+
+    core::Slice<audio::sample_t> frame_buffer = sample_buffer_factory.new_buffer();
+    if (!frame_buffer) {
+        roc_log(LogError, "can't allocate frame buffer");
+        return 1;
+    }
+    frame_buffer.reslice(0, frame_size);
+
+    const core::nanoseconds_t frame_length =
+        receiver_config.common.internal_frame_length;
+
+    // after the capture ends, continue playback until queued packets are played
+    const size_t drain_frames = size_t(
+        receiver_config.default_session.latency_monitor.max_latency / frame_length + 1);
+
+    size_t n_packets = 0, n_skipped = 0, n_frames = 0, n_drained = 0;
+
+    unsigned stream_id = 0;
+    packet::PacketPtr pp = capture_reader.read(stream_id);
+
+    // virtual time, advanced by one frame length per frame
+    core::nanoseconds_t replay_time = pp ? pp->udp()->receive_timestamp : 0;
+
+    const core::nanoseconds_t start_time = core::timestamp(core::ClockMonotonic);
+
+    while (pp || n_drained < drain_frames) {
+        // deliver all datagrams that arrived before the frame
+        while (pp && pp->udp()->receive_timestamp <= replay_time) {
+            if (stream_id < (unsigned)address::Iface_Max && endpoints[stream_id]) {
+                endpoints[stream_id]->writer().write(pp);
+                n_packets++;
+            } else {
+                n_skipped++;
+            }
+            pp = capture_reader.read(stream_id);
+        }
+
+        if (!pp && capture_reader.failed()) {
+            roc_log(LogError, "can't read --input capture file: %s", args.input_arg);
+            return 1;
+        }
+
+        audio::Frame frame(frame_buffer.data(), frame_buffer.size());
+
+        if (!receiver.read(frame)) {
+            roc_log(LogError, "can't read frame from receiver pipeline");
+            return 1;
+        }
+
+        if (output_sink) {
+            output_sink->write(frame);
+        }
+
+        n_frames++;
+        if (!pp) {
+            n_drained++;
+        }
+
+        replay_time += frame_length;
+    }
+
+    const core::nanoseconds_t elapsed_time =
+        core::timestamp(core::ClockMonotonic) - start_time;
+
+    const double audio_sec = (double)n_frames * frame_length / core::Second;
+    const double elapsed_sec = (double)elapsed_time / core::Second;
+
+    printf("replayed %lu packets (%lu skipped) into %lu frames\n",
+           (unsigned long)n_packets, (unsigned long)n_skipped, (unsigned long)n_frames);
+    printf("audio duration %.3fs, processing time %.3fs, speed %.1fx\n", audio_sec,
+           elapsed_sec, elapsed_sec > 0 ? audio_sec / elapsed_sec : 0.);
+
+    return 0;
+}
@@ -16,19 +16,253 @@
 #include "roc_core/log.h"
 #include "roc_core/parse_duration.h"
 #include "roc_core/scoped_ptr.h"
+#include "roc_core/thread.h"
 #include "roc_netio/network_loop.h"
 #include "roc_peer/context.h"
 #include "roc_peer/sender.h"
 #include "roc_pipeline/sender_sink.h"
+#include "roc_rtp/srtp_config.h"
 #include "roc_sndio/backend_dispatcher.h"
 #include "roc_sndio/backend_map.h"
+#include "roc_sndio/negotiate_frame_length.h"
 #include "roc_sndio/print_supported.h"
 #include "roc_sndio/pump.h"
 
 #include "roc_send/cmdline.h"
+#include "streams_file.h"
 
 using namespace roc;
 
+namespace {
+
+// sender, input, and pump of one stream of --streams file;
+// all streams share peer context, and thus network thread and pools
+class SenderStream : public core::Thread {
+public:
+    SenderStream(size_t index, peer::Context& context)
+        : index_(index)
+        , context_(context)
+        , ok_(false) {
+    }
+
+    ~SenderStream() {
+        if (joinable()) {
+            pump_->stop();
+            join();
+        }
+    }
+
+    bool open(const tools::StreamUris& uris,
+              const gengetopt_args_info& args,
+              sndio::BackendDispatcher& backend_dispatcher,
+              pipeline::SenderConfig sender_config,
+              const sndio::Config& io_config) {
+        address::EndpointUri source_endpoint(context_.allocator());
+        if (!address::parse_endpoint_uri(uris.source, address::EndpointUri::Subset_Full,
+                                         source_endpoint)) {
+            roc_log(LogError, "stream %lu: can't parse source endpoint: %s",
+                    (unsigned long)index_, uris.source);
+            return false;
+        }
+
+        const address::ProtocolAttrs* source_attrs =
+            address::ProtocolMap::instance().find_proto_by_id(source_endpoint.proto());
+        if (source_attrs) {
+            sender_config.fec_encoder.scheme = source_attrs->fec_scheme;
+        }
+
+        address::IoUri input_uri(context_.allocator());
+        if (*uris.device) {
+            if (!address::parse_io_uri(uris.device, input_uri)
+                || input_uri.is_special_file()) {
+                roc_log(LogError, "stream %lu: invalid input file or device URI: %s",
+                        (unsigned long)index_, uris.device);
+                return false;
+            }
+            source_.reset(backend_dispatcher.open_source(input_uri, NULL, io_config,
+                                                         context_.allocator()),
+                          context_.allocator());
+        } else {
+            source_.reset(
+                backend_dispatcher.open_default_source(io_config, context_.allocator()),
+                context_.allocator());
+        }
+        if (!source_) {
+            roc_log(LogError, "stream %lu: can't open input file or device: uri=%s",
+                    (unsigned long)index_, uris.device);
+            return false;
+        }
+
+        sender_config.timing = !source_->has_clock();
+        sender_config.input_sample_spec.set_sample_rate(
+            source_->sample_spec().sample_rate());
+
+        if (!args.frame_length_given) {
+            sender_config.internal_frame_length = sndio::negotiate_frame_length(
+                *source_, sender_config.internal_frame_length);
+        }
+
+        sender_.reset(new (context_.allocator()) peer::Sender(context_, sender_config),
+                      context_.allocator());
+        if (!sender_ || !sender_->valid()) {
+            roc_log(LogError, "stream %lu: can't create sender peer",
+                    (unsigned long)index_);
+            return false;
+        }
+
+        if (!connect_(args, address::Iface_AudioSource, uris.source)
+            || !connect_(args, address::Iface_AudioRepair, uris.repair)
+            || !connect_(args, address::Iface_AudioControl, uris.control)) {
+            return false;
+        }
+
+        pump_.reset(new (context_.allocator()) sndio::Pump(
+                        context_.sample_buffer_factory(), *source_, NULL,
+                        sender_->sink(), sender_config.internal_frame_length,
+                        sender_config.input_sample_spec, sndio::Pump::ModePermanent),
+                    context_.allocator());
+        if (!pump_ || !pump_->valid()) {
+            roc_log(LogError, "stream %lu: can't create audio pump",
+                    (unsigned long)index_);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ok() const {
+        return ok_;
+    }
+
+private:
+    bool
+    connect_(const gengetopt_args_info& args, address::Interface iface, const char* uri) {
+        if (!*uri) {
+            return true;
+        }
+
+        const char* iface_str = address::interface_to_str(iface);
+
+        address::EndpointUri endpoint(context_.allocator());
+        if (!address::parse_endpoint_uri(uri, address::EndpointUri::Subset_Full,
+                                         endpoint)) {
+            roc_log(LogError, "stream %lu: can't parse %s endpoint: %s",
+                    (unsigned long)index_, iface_str, uri);
+            return false;
+        }
+
+        if (args.reuseaddr_given && !sender_->set_reuseaddr(0, iface, true)) {
+            roc_log(LogError, "stream %lu: can't set reuseaddr option for %s endpoint",
+                    (unsigned long)index_, iface_str);
+            return false;
+        }
+
+        if (args.sock_buf_size_given
+            && !sender_->set_socket_buffer_size(0, iface,
+                                                (size_t)args.sock_buf_size_arg)) {
+            roc_log(LogError, "stream %lu: can't set socket buffer size for %s endpoint",
+                    (unsigned long)index_, iface_str);
+            return false;
+        }
+
+        if (args.dscp_given && !sender_->set_dscp(0, iface, args.dscp_arg)) {
+            roc_log(LogError, "stream %lu: can't set dscp for %s endpoint",
+                    (unsigned long)index_, iface_str);
+            return false;
+        }
+
+        if (iface != address::Iface_AudioControl) {
+            if (args.pacing_rate_given
+                && !sender_->set_pacing_rate(0, iface, (size_t)args.pacing_rate_arg)) {
+                roc_log(LogError, "stream %lu: can't set pacing rate for %s endpoint",
+                        (unsigned long)index_, iface_str);
+                return false;
+            }
+
+            if (args.connect_socket_given
+                && !sender_->set_connect_socket(0, iface, true)) {
+                roc_log(LogError,
+                        "stream %lu: can't set connect socket for %s endpoint",
+                        (unsigned long)index_, iface_str);
+                return false;
+            }
+        }
+
+        if (!sender_->connect(0, iface, endpoint)) {
+            roc_log(LogError, "stream %lu: can't connect sender to %s endpoint: %s",
+                    (unsigned long)index_, iface_str, uri);
+            return false;
+        }
+
+        return true;
+    }
+
+    virtual void run() {
+        ok_ = pump_->run();
+    }
+
+    const size_t index_;
+    peer::Context& context_;
+
+    core::ScopedPtr<sndio::ISource> source_;
+    core::ScopedPtr<peer::Sender> sender_;
+    core::ScopedPtr<sndio::Pump> pump_;
+
+    bool ok_;
+};
+
+int run_streams(const gengetopt_args_info& args,
+                peer::Context& context,
+                sndio::BackendDispatcher& backend_dispatcher,
+                const pipeline::SenderConfig& sender_config,
+                const sndio::Config& io_config) {
+    if (args.input_given || args.input_format_given || args.source_given
+        || args.repair_given || args.control_given) {
+        roc_log(LogError,
+                "--streams can't be used together with --input, --input-format,"
+                " --source, --repair, or --control");
+        return 1;
+    }
+
+    core::Array<tools::StreamUris> uris(context.allocator());
+    if (!tools::parse_streams_file(args.streams_arg, "input", uris)) {
+        return 1;
+    }
+
+    roc_log(LogInfo, "starting %lu streams from --streams file",
+            (unsigned long)uris.size());
+
+    core::ScopedPtr<SenderStream> streams[tools::MaxStreams];
+
+    for (size_t n = 0; n < uris.size(); n++) {
+        streams[n].reset(new (context.allocator()) SenderStream(n, context),
+                         context.allocator());
+        if (!streams[n]
+            || !streams[n]->open(uris[n], args, backend_dispatcher, sender_config,
+                                 io_config)) {
+            return 1;
+        }
+    }
+
+    for (size_t n = 0; n < uris.size(); n++) {
+        if (!streams[n]->start()) {
+            roc_log(LogError, "stream %lu: can't start thread", (unsigned long)n);
+            return 1;
+        }
+    }
+
+    bool ok = true;
+
+    for (size_t n = 0; n < uris.size(); n++) {
+        streams[n]->join();
+        ok = streams[n]->ok() && ok;
+    }
+
+    return ok ? 0 : 1;
+}
+
+} // namespace
+
 int main(int argc, char** argv) {
     core::HeapAllocator::enable_panic_on_leak();
 
@@ -63,6 +297,13 @@ int main(int argc, char** argv) {
         break;
     }
 
+    if (args.async_log_flag) {
+        if (!core::Logger::instance().set_async(true)) {
+            roc_log(LogError, "can't enable asynchronous logging");
+            return 1;
+        }
+    }
+
     peer::ContextConfig context_config;
 
     context_config.poisoning = args.poisoning_flag;
@@ -101,6 +342,16 @@ int main(int argc, char** argv) {
 
     pipeline::SenderConfig sender_config;
 
+    switch (args.packet_encoding_arg) {
+    case packet_encoding_arg_opus:
+        sender_config.payload_type = rtp::PayloadType_Opus;
+        // default packet length is not a valid opus frame duration
+        sender_config.packet_length = 10 * core::Millisecond;
+        break;
+    default:
+        break;
+    }
+
     if (args.packet_length_given) {
         if (!core::parse_duration(args.packet_length_arg, sender_config.packet_length)) {
             roc_log(LogError, "invalid --packet-length");
@@ -164,6 +415,14 @@ int main(int argc, char** argv) {
         sender_config.fec_writer.n_repair_packets = (size_t)args.nbrpr_arg;
     }
 
+    if (args.fec_skip_silence_flag) {
+        if (sender_config.fec_encoder.scheme == packet::FEC_None) {
+            roc_log(LogError, "--fec-skip-silence can't be used when fec is disabled");
+            return 1;
+        }
+        sender_config.fec_writer.skip_silence = true;
+    }
+
     sender_config.resampling = !args.no_resampling_flag;
 
     switch (args.resampler_backend_arg) {
@@ -198,6 +457,93 @@ int main(int argc, char** argv) {
     }
 
     sender_config.interleaving = args.interleaving_flag;
+    sender_config.capture_timestamps = args.capture_timestamps_flag;
+    sender_config.dtx.enabled = args.dtx_flag;
+
+    if (args.mux_size_given) {
+        if (args.mux_size_arg <= 0) {
+            roc_log(LogError, "invalid --mux-size: should be > 0");
+            return 1;
+        }
+        sender_config.multiplexed_packet_size = (size_t)args.mux_size_arg;
+    }
+
+    if (args.srtp_key_given) {
+        if (!rtp::parse_srtp_key(args.srtp_key_arg, sender_config.srtp)) {
+            roc_log(LogError, "invalid --srtp-key: should be base64 of 30 bytes");
+            return 1;
+        }
+    }
+
+    packet::ImpairerConfig& impairer_config = sender_config.impairment;
+
+    if (args.impair_loss_given || args.impair_burst_given) {
+        const double loss = args.impair_loss_given ? args.impair_loss_arg : 0;
+        const double burst = args.impair_burst_given ? args.impair_burst_arg : 1;
+        if (!impairer_config.set_loss(float(loss / 100), float(burst))) {
+            roc_log(LogError,
+                    "invalid --impair-loss or --impair-burst: loss should be in"
+                    " range [0; 100), burst should be >= 1, and loss can't exceed"
+                    " burst / (burst + 1) * 100");
+            return 1;
+        }
+    }
+
+    if (args.impair_delay_given) {
+        if (!core::parse_duration(args.impair_delay_arg, impairer_config.delay)
+            || impairer_config.delay < 0) {
+            roc_log(LogError, "invalid --impair-delay");
+            return 1;
+        }
+    }
+
+    if (args.impair_jitter_given) {
+        if (!core::parse_duration(args.impair_jitter_arg, impairer_config.jitter)
+            || impairer_config.jitter < 0) {
+            roc_log(LogError, "invalid --impair-jitter");
+            return 1;
+        }
+    }
+
+    if (args.impair_reorder_given) {
+        if (args.impair_reorder_arg < 0 || args.impair_reorder_arg > 100) {
+            roc_log(LogError, "invalid --impair-reorder: should be in range [0; 100]");
+            return 1;
+        }
+        impairer_config.reorder = float(args.impair_reorder_arg / 100);
+    }
+
+    if (args.impair_dup_given) {
+        if (args.impair_dup_arg < 0 || args.impair_dup_arg > 100) {
+            roc_log(LogError, "invalid --impair-dup: should be in range [0; 100]");
+            return 1;
+        }
+        impairer_config.duplicate = float(args.impair_dup_arg / 100);
+    }
+
+    if (args.impair_seed_given) {
+        impairer_config.seed = (uint32_t)args.impair_seed_arg;
+    }
+
+    if (impairer_config.enabled()) {
+        roc_log(LogInfo, "simulating network impairments on outgoing packets");
+    }
+
+    if (args.sock_buf_size_given && args.sock_buf_size_arg <= 0) {
+        roc_log(LogError, "invalid --sock-buf-size: should be > 0");
+        return 1;
+    }
+
+    if (args.dscp_given && (args.dscp_arg < 0 || args.dscp_arg > 63)) {
+        roc_log(LogError, "invalid --dscp: should be in range [0; 63]");
+        return 1;
+    }
+
+    if (args.pacing_rate_given && args.pacing_rate_arg <= 0) {
+        roc_log(LogError, "invalid --pacing-rate: should be > 0");
+        return 1;
+    }
+
     sender_config.poisoning = args.poisoning_flag;
     sender_config.profiling = args.profiling_flag;
 
@@ -225,6 +571,10 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (args.streams_given) {
+        return run_streams(args, context, backend_dispatcher, sender_config, io_config);
+    }
+
     address::IoUri input_uri(context.allocator());
     if (args.input_given) {
         if (!address::parse_io_uri(args.input_arg, input_uri)) {
@@ -267,6 +617,12 @@ int main(int argc, char** argv) {
     sender_config.input_sample_spec.set_sample_rate(
         input_source->sample_spec().sample_rate());
 
+    if (!args.frame_length_given) {
+        // align frames to device period to avoid partial reads
+        sender_config.internal_frame_length = sndio::negotiate_frame_length(
+            *input_source, sender_config.internal_frame_length);
+    }
+
     peer::Sender sender(context, sender_config);
     if (!sender.valid()) {
         roc_log(LogError, "can't create sender peer");
@@ -310,6 +666,36 @@ int main(int argc, char** argv) {
             }
         }
 
+        if (args.sock_buf_size_given) {
+            if (!sender.set_socket_buffer_size(slot, address::Iface_AudioSource,
+                                               (size_t)args.sock_buf_size_arg)) {
+                roc_log(LogError, "can't set socket buffer size for --source endpoint");
+                return 1;
+            }
+        }
+
+        if (args.dscp_given) {
+            if (!sender.set_dscp(slot, address::Iface_AudioSource, args.dscp_arg)) {
+                roc_log(LogError, "can't set dscp for --source endpoint");
+                return 1;
+            }
+        }
+
+        if (args.pacing_rate_given) {
+            if (!sender.set_pacing_rate(slot, address::Iface_AudioSource,
+                                        (size_t)args.pacing_rate_arg)) {
+                roc_log(LogError, "can't set pacing rate for --source endpoint");
+                return 1;
+            }
+        }
+
+        if (args.connect_socket_given) {
+            if (!sender.set_connect_socket(slot, address::Iface_AudioSource, true)) {
+                roc_log(LogError, "can't set connect socket for --source endpoint");
+                return 1;
+            }
+        }
+
         if (!sender.connect(slot, address::Iface_AudioSource, source_endpoint)) {
             roc_log(LogError, "can't connect sender to source endpoint");
             return 1;
@@ -332,6 +718,36 @@ int main(int argc, char** argv) {
             }
         }
 
+        if (args.sock_buf_size_given) {
+            if (!sender.set_socket_buffer_size(slot, address::Iface_AudioRepair,
+                                               (size_t)args.sock_buf_size_arg)) {
+                roc_log(LogError, "can't set socket buffer size for --repair endpoint");
+                return 1;
+            }
+        }
+
+        if (args.dscp_given) {
+            if (!sender.set_dscp(slot, address::Iface_AudioRepair, args.dscp_arg)) {
+                roc_log(LogError, "can't set dscp for --repair endpoint");
+                return 1;
+            }
+        }
+
+        if (args.pacing_rate_given) {
+            if (!sender.set_pacing_rate(slot, address::Iface_AudioRepair,
+                                        (size_t)args.pacing_rate_arg)) {
+                roc_log(LogError, "can't set pacing rate for --repair endpoint");
+                return 1;
+            }
+        }
+
+        if (args.connect_socket_given) {
+            if (!sender.set_connect_socket(slot, address::Iface_AudioRepair, true)) {
+                roc_log(LogError, "can't set connect socket for --repair endpoint");
+                return 1;
+            }
+        }
+
         if (!sender.connect(slot, address::Iface_AudioRepair, repair_endpoint)) {
             roc_log(LogError, "can't connect sender to repair endpoint");
             return 1;
@@ -355,6 +771,21 @@ int main(int argc, char** argv) {
             }
         }
 
+        if (args.sock_buf_size_given) {
+            if (!sender.set_socket_buffer_size(slot, address::Iface_AudioControl,
+                                               (size_t)args.sock_buf_size_arg)) {
+                roc_log(LogError, "can't set socket buffer size for --control endpoint");
+                return 1;
+            }
+        }
+
+        if (args.dscp_given) {
+            if (!sender.set_dscp(slot, address::Iface_AudioControl, args.dscp_arg)) {
+                roc_log(LogError, "can't set dscp for --control endpoint");
+                return 1;
+            }
+        }
+
         if (!sender.connect(slot, address::Iface_AudioControl, control_endpoint)) {
             roc_log(LogError, "can't connect sender to control endpoint");
             return 1;
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "streams_file.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace tools {
+
+namespace {
+
+enum { MaxLineLen = 4096 };
+
+bool parse_stream_line(char* line,
+                       size_t line_num,
+                       const char* device_key,
+                       StreamUris& uris) {
+    memset(&uris, 0, sizeof(uris));
+
+    for (char* tok = strtok(line, " \t\r\n"); tok; tok = strtok(NULL, " \t\r\n")) {
+        char* value = strchr(tok, '=');
+        if (!value) {
+            roc_log(LogError, "invalid --streams file: line %lu: expected key=value: %s",
+                    (unsigned long)line_num, tok);
+            return false;
+        }
+        *value++ = '\0';
+
+        char* dst = NULL;
+        if (strcmp(tok, device_key) == 0) {
+            dst = uris.device;
+        } else if (strcmp(tok, "source") == 0) {
+            dst = uris.source;
+        } else if (strcmp(tok, "repair") == 0) {
+            dst = uris.repair;
+        } else if (strcmp(tok, "control") == 0) {
+            dst = uris.control;
+        } else {
+            roc_log(LogError, "invalid --streams file: line %lu: unknown key: %s",
+                    (unsigned long)line_num, tok);
+            return false;
+        }
+
+        if (strlen(value) >= MaxStreamUriLen) {
+            roc_log(LogError, "invalid --streams file: line %lu: %s is too long",
+                    (unsigned long)line_num, tok);
+            return false;
+        }
+        strcpy(dst, value);
+    }
+
+    if (!*uris.source) {
+        roc_log(LogError, "invalid --streams file: line %lu: source is missing",
+                (unsigned long)line_num);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+bool parse_streams_file(const char* path,
+                        const char* device_key,
+                        core::Array<StreamUris>& streams) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        roc_log(LogError, "can't open --streams file: %s", path);
+        return false;
+    }
+
+    char line[MaxLineLen];
+    size_t line_num = 0;
+    bool ok = true;
+
+    while (ok && fgets(line, sizeof(line), fp)) {
+        line_num++;
+
+        if (!strchr(line, '\n') && !feof(fp)) {
+            roc_log(LogError, "invalid --streams file: line %lu: line is too long",
+                    (unsigned long)line_num);
+            ok = false;
+            break;
+        }
+
+        const char* begin = line + strspn(line, " \t\r\n");
+        if (*begin == '\0' || *begin == '#') {
+            continue;
+        }
+
+        if (streams.size() == MaxStreams) {
+            roc_log(LogError, "too many streams in --streams file: max=%u",
+                    (unsigned)MaxStreams);
+            ok = false;
+            break;
+        }
+
+        StreamUris uris;
+        if (!parse_stream_line(line, line_num, device_key, uris)
+            || !streams.grow_exp(streams.size() + 1)) {
+            ok = false;
+            break;
+        }
+        streams.push_back(uris);
+    }
+
+    fclose(fp);
+
+    if (ok && streams.size() == 0) {
+        roc_log(LogError, "invalid --streams file: no streams defined");
+        ok = false;
+    }
+
+    return ok;
+}
+
+} // namespace tools
+} // namespace roc
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 Roc Streaming authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file streams_file.h
+//! @brief Parse --streams file of command line tools.
+
+#ifndef ROC_TOOLS_STREAMS_FILE_H_
+#define ROC_TOOLS_STREAMS_FILE_H_
+
+#include "roc_core/array.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace tools {
+
+enum {
+    //! Maximum number of streams in --streams file.
+    MaxStreams = 128,
+
+    //! Maximum length of URI in --streams file.
+    MaxStreamUriLen = 1024
+};
+
+//! URIs of one stream, from one line of --streams file.
+struct StreamUris {
+    //! Input or output file or device URI, may be empty.
+    char device[MaxStreamUriLen];
+
+    //! Source endpoint URI, never empty.
+    char source[MaxStreamUriLen];
+
+    //! Repair endpoint URI, may be empty.
+    char repair[MaxStreamUriLen];
+
+    //! Control endpoint URI, may be empty.
+    char control[MaxStreamUriLen];
+};
+
+//! Parse --streams file.
+//!
+//! @remarks
+//!  Each non-empty line not starting with '#' defines one stream as a list
+//!  of key=value pairs, e.g.:
+//!  @code
+//!   output=alsa://hw:1,0 source=rtp+rs8m://0.0.0.0:10001 repair=rs8m://0.0.0.0:10002
+//!  @endcode
+//!  Allowed keys are @p device_key ("input" for sender, "output" for receiver),
+//!  "source", "repair", and "control". "source" is required.
+//!
+//! @returns
+//!  false if the file can't be read, is invalid, or defines no streams.
+bool parse_streams_file(const char* path,
+                        const char* device_key,
+                        core::Array<StreamUris>& streams);
+
+} // namespace tools
+} // namespace roc
+
+#endif // ROC_TOOLS_STREAMS_FILE_H_